@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# vim:set et sts=4:
+# -*- coding: utf-8 -*-
+#
+# Generate the symmetric deletion index of English word list.
+#
+# Every word is indexed by the strings deleting at most max_distance
+# characters from its first prefix_length characters, so the words
+# within the edit distance of the input share a deletion with it.
+# The keys are the FNV-1a hashes of the deletions, sorted by hash,
+# the words of a key are sorted by frequency. All integers are little
+# endian.
+#
+#   header:  magic[8], max_distance, prefix_length, n_words, n_keys,
+#            n_items, words_offset, keys_offset, items_offset,
+#            strings_offset
+#   words:   { string_offset, freq (float) } * n_words
+#   keys:    { hash, items_begin, n_items } * n_keys
+#   items:   { word_index } * n_items
+#   strings: NUL terminated words
+
+import sys
+import struct
+
+MAGIC = b"PYDELIX1"
+MAX_DISTANCE = 2
+PREFIX_LENGTH = 7
+# only the most frequent words of a deletion are kept.
+KEY_TOP_K = 128
+
+
+def read_english(filename):
+    words = {}
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            items = line.split()
+            if len(items) != 2:
+                continue
+            word, freq = items[0].lower(), float(items[1])
+            words[word] = words.get(word, 0.0) + freq
+    # sort by freq desc, then by word.
+    return sorted(words.items(), key=lambda item: (-item[1], item[0]))
+
+
+def fnv1a(string):
+    value = 2166136261
+    for byte in string.encode("utf8"):
+        value ^= byte
+        value = (value * 16777619) & 0xffffffff
+    return value
+
+
+def deletions(word, distance):
+    results = {word}
+    edges = {word}
+    for i in range(distance):
+        deleted = set()
+        for string in edges:
+            for j in range(len(string)):
+                deleted.add(string[:j] + string[j + 1:])
+        deleted -= results
+        results |= deleted
+        edges = deleted
+    return results
+
+
+def build_keys(entries):
+    keys = {}
+    for index, (word, freq) in enumerate(entries):
+        hashes = set(fnv1a(deletion) for deletion in
+                     deletions(word[:PREFIX_LENGTH], MAX_DISTANCE))
+        for value in hashes:
+            items = keys.setdefault(value, [])
+            if len(items) < KEY_TOP_K:
+                items.append(index)
+    return keys
+
+
+def gen_index(entries, keys, output):
+    strings = bytearray()
+    word_records = bytearray()
+    for word, freq in entries:
+        word_records += struct.pack("<If", len(strings), freq)
+        strings += word.encode("utf8") + b"\0"
+
+    items = bytearray()
+    key_records = bytearray()
+    n_items = 0
+    for value in sorted(keys):
+        key_records += struct.pack("<III", value, n_items, len(keys[value]))
+        for index in keys[value]:
+            items += struct.pack("<I", index)
+        n_items += len(keys[value])
+
+    header_size = len(MAGIC) + 9 * 4
+    words_offset = header_size
+    keys_offset = words_offset + len(word_records)
+    items_offset = keys_offset + len(key_records)
+    strings_offset = items_offset + len(items)
+
+    with open(output, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<IIIIIIIII", MAX_DISTANCE, PREFIX_LENGTH,
+                            len(entries), len(keys), n_items,
+                            words_offset, keys_offset, items_offset,
+                            strings_offset))
+        f.write(word_records)
+        f.write(key_records)
+        f.write(items)
+        f.write(strings)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: %s input output" % sys.argv[0])
+        sys.exit(1)
+
+    entries = read_english(sys.argv[1])
+    gen_index(entries, build_keys(entries), sys.argv[2])
+
+
+if __name__ == "__main__":
+    main()
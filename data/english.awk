@@ -8,7 +8,7 @@ BEGIN {
     print "CREATE TABLE IF NOT EXISTS \"english\" ( "   \
         "\"word\" TEXT NOT NULL PRIMARY KEY,"           \
         "\"freq\" FLOAT NOT NULL DEFAULT(0)"            \
-        ");";
+        ") WITHOUT ROWID;";
 
     # Create desc table
     print "CREATE TABLE IF NOT EXISTS desc (name TEXT PRIMARY KEY, value TEXT);";
@@ -20,6 +20,10 @@ BEGIN {
 
     #quit sqlite3
 END {
+    # Create the covering index of the case insensitive prefix scans
+    print "CREATE INDEX IF NOT EXISTS \"english_prefix\" ON \"english\" ( " \
+        "\"word\" COLLATE NOCASE, \"freq\");";
+
     # Commit the transcation
     print "COMMIT;"
 }
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# vim:set et sts=4:
+# -*- coding: utf-8 -*-
+#
+# Generate the prefix index of English word list or strokes table.
+#
+# The index is a trie, each node stores the words of its prefix,
+# which are sorted by value. All integers are little endian.
+#
+#   header:  magic[8], n_words, n_nodes, n_items,
+#            words_offset, nodes_offset, items_offset, strings_offset
+#   words:   { string_offset, value (float) } * n_words
+#   nodes:   { ch, first_child, n_children, items_begin, n_items } * n_nodes
+#   items:   { word_index } * n_items
+#   strings: NUL terminated words
+#
+# For English word list, the key is the lower case word, the value is
+# the frequency, and each node only keeps the top K words.
+# For strokes table, the key is the strokes, the value is the sequence,
+# and each node keeps all characters in sequence order.
+
+import sys
+import struct
+
+MAGIC = b"PYPFIDX1"
+ENGLISH_TOP_K = 64
+
+
+def read_english(filename):
+    words = {}
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            items = line.split()
+            if len(items) != 2:
+                continue
+            word, freq = items[0].lower(), float(items[1])
+            words[word] = words.get(word, 0.0) + freq
+    # sort by freq desc, then by word.
+    entries = sorted(words.items(), key=lambda item: (-item[1], item[0]))
+    return [(word, word, freq) for word, freq in entries]
+
+
+def read_strokes(filename):
+    entries = []
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            items = line.split()
+            if len(items) != 4:
+                continue
+            character, sequence, strokes = items[0], int(items[1]), items[2]
+            entries.append((strokes, character, float(sequence)))
+    # sort by sequence asc.
+    entries.sort(key=lambda item: item[2])
+    return entries
+
+
+def build_trie(entries, top_k):
+    # node: [ch, children dict, items list]
+    root = [0, {}, []]
+    for index, (key, word, value) in enumerate(entries):
+        node = root
+        if not top_k or len(node[2]) < top_k:
+            node[2].append(index)
+        for ch in key:
+            node = node[1].setdefault(ch, [ord(ch), {}, []])
+            if not top_k or len(node[2]) < top_k:
+                node[2].append(index)
+    return root
+
+
+def gen_index(entries, root, output):
+    # assign node indices in breadth first order,
+    # so the children of a node are continuous.
+    nodes = [root]
+    i = 0
+    records = []
+    while i < len(nodes):
+        node = nodes[i]
+        children = [node[1][ch] for ch in sorted(node[1])]
+        records.append((node, len(nodes), len(children)))
+        nodes.extend(children)
+        i += 1
+
+    strings = bytearray()
+    word_records = bytearray()
+    for key, word, value in entries:
+        word_records += struct.pack("<If", len(strings), value)
+        strings += word.encode("utf8") + b"\0"
+
+    items = bytearray()
+    node_records = bytearray()
+    n_items = 0
+    for node, first_child, n_children in records:
+        if 0 == n_children:
+            first_child = 0
+        node_records += struct.pack("<IIIII", node[0], first_child,
+                                    n_children, n_items, len(node[2]))
+        for index in node[2]:
+            items += struct.pack("<I", index)
+        n_items += len(node[2])
+
+    header_size = len(MAGIC) + 7 * 4
+    words_offset = header_size
+    nodes_offset = words_offset + len(word_records)
+    items_offset = nodes_offset + len(node_records)
+    strings_offset = items_offset + len(items)
+
+    with open(output, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<IIIIIII", len(entries), len(records), n_items,
+                            words_offset, nodes_offset, items_offset,
+                            strings_offset))
+        f.write(word_records)
+        f.write(node_records)
+        f.write(items)
+        f.write(strings)
+
+
+def main():
+    if len(sys.argv) != 4 or sys.argv[1] not in ("english", "strokes"):
+        print("Usage: %s english|strokes input output" % sys.argv[0])
+        sys.exit(1)
+
+    if sys.argv[1] == "english":
+        entries = read_english(sys.argv[2])
+        root = build_trie(entries, ENGLISH_TOP_K)
+    else:
+        entries = read_strokes(sys.argv[2])
+        root = build_trie(entries, 0)
+    gen_index(entries, root, sys.argv[3])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# vim:set et sts=4:
+# -*- coding: utf-8 -*-
+#
+# Generate the positional bitset index of strokes table.
+#
+# The characters are sorted by sequence, bit i of a bitset is the i-th
+# character. There is one bitset per (position, stroke type) pair, for
+# the stroke types in "hspnz" order, so the strokes with the wildcards
+# are matched by the bitwise and of the bitsets of their positions.
+# All integers are little endian.
+#
+#   header:  magic[8], n_characters, n_positions, n_words,
+#            bitsets_offset, characters_offset, strings_offset
+#   bitsets: { word (32 bits) * n_words } * 5 * n_positions
+#   characters: { string_offset } * n_characters
+#   strings: NUL terminated characters
+
+import sys
+import struct
+
+MAGIC = b"PYSTRBS1"
+STROKE_TYPES = "hspnz"
+
+
+def read_strokes(filename):
+    entries = []
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            items = line.split()
+            if len(items) != 4:
+                continue
+            character, sequence, strokes = items[0], int(items[1]), items[2]
+            if not strokes or any(s not in STROKE_TYPES for s in strokes):
+                continue
+            entries.append((sequence, character, strokes))
+    # sort by sequence asc.
+    entries.sort(key=lambda item: item[0])
+    return entries
+
+
+def gen_bitset(entries, output):
+    n_characters = len(entries)
+    n_positions = max(len(strokes) for _, _, strokes in entries)
+    n_words = (n_characters + 31) // 32
+
+    bitsets = [[0] * n_words for _ in range(n_positions * len(STROKE_TYPES))]
+    for index, (_, _, strokes) in enumerate(entries):
+        for position, stroke in enumerate(strokes):
+            bitset = bitsets[position * len(STROKE_TYPES) +
+                             STROKE_TYPES.index(stroke)]
+            bitset[index // 32] |= 1 << (index % 32)
+
+    bitset_records = bytearray()
+    for bitset in bitsets:
+        bitset_records += struct.pack("<%dI" % n_words, *bitset)
+
+    strings = bytearray()
+    character_records = bytearray()
+    for _, character, _ in entries:
+        character_records += struct.pack("<I", len(strings))
+        strings += character.encode("utf8") + b"\0"
+
+    header_size = len(MAGIC) + 6 * 4
+    bitsets_offset = header_size
+    characters_offset = bitsets_offset + len(bitset_records)
+    strings_offset = characters_offset + len(character_records)
+
+    with open(output, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<IIIIII", n_characters, n_positions, n_words,
+                            bitsets_offset, characters_offset,
+                            strings_offset))
+        f.write(bitset_records)
+        f.write(character_records)
+        f.write(strings)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: %s input output" % sys.argv[0])
+        sys.exit(1)
+
+    gen_bitset(read_strokes(sys.argv[1]), sys.argv[2])
+
+
+if __name__ == "__main__":
+    main()
@@ -24,6 +24,10 @@ NF == 4 {
 
     #quit sqlite3
 END {
+    # Create the covering index of the prefix scans
+    print "CREATE INDEX IF NOT EXISTS \"strokes_prefix\" ON \"strokes\" ( " \
+        "\"strokes\", \"sequence\", \"character\");";
+
     # Commit the transcation
     print "COMMIT;"
 }
@@ -60,6 +60,12 @@ void lua_plugin_openlibs (lua_State *L) {
   }
 }
 
+static const lua_native_helpers_t * native_helpers = NULL;
+
+void lua_plugin_set_native_helpers(const lua_native_helpers_t * helpers){
+  native_helpers = helpers;
+}
+
 void lua_plugin_store_plugin(lua_State * L, IBusEnginePlugin * plugin){
   luaL_newmetatable(L, LUA_IMELIBNAME);
   lua_pushliteral(L, LUA_IMELIB_CONTEXT);
@@ -68,6 +74,23 @@ void lua_plugin_store_plugin(lua_State * L, IBusEnginePlugin * plugin){
   lua_pop(L, 1);
 }
 
+void lua_plugin_mark_worker(lua_State * L){
+  luaL_newmetatable(L, LUA_IMELIBNAME);
+  lua_pushliteral(L, LUA_IMELIB_WORKER);
+  lua_pushboolean(L, TRUE);
+  lua_rawset(L, -3);
+  lua_pop(L, 1);
+}
+
+gboolean lua_plugin_is_worker(lua_State * L){
+  luaL_newmetatable(L, LUA_IMELIBNAME);
+  lua_pushliteral(L, LUA_IMELIB_WORKER);
+  lua_rawget(L, -2);
+  gboolean worker = lua_toboolean(L, -1);
+  lua_pop(L, 2);
+  return worker;
+}
+
 IBusEnginePlugin * lua_plugin_retrieve_plugin(lua_State * L) {
   luaL_newmetatable(L, LUA_IMELIBNAME);
   lua_pushliteral(L, LUA_IMELIB_CONTEXT);
@@ -79,6 +102,39 @@ IBusEnginePlugin * lua_plugin_retrieve_plugin(lua_State * L) {
   return plugin;
 }
 
+static int ime_convert_string(lua_State * L, gchar * (* convert)(const char * str)){
+  const char * s = luaL_checklstring(L, 1, NULL);
+
+  if ( NULL == convert ){
+    lua_settop(L, 1);
+    return 1;
+  }
+
+  gchar * str = convert(s);
+  lua_pushstring(L, str);
+  g_free(str);
+  lua_remove(L, 1);
+  return 1;
+}
+
+static int ime_format_chinese_number(lua_State * L){
+  static const char * const styles[] = {
+    "simplest", "simplified", "traditional", NULL
+  };
+  lua_Integer num = luaL_checkinteger(L, 1);
+  int style = luaL_checkoption(L, 2, "simplified", styles);
+
+  if ( NULL == native_helpers || num < 0 ){
+    lua_pushnil(L);
+    return 1;
+  }
+
+  gchar * str = native_helpers->format_chinese_number(num, style);
+  lua_pushstring(L, str);
+  g_free(str);
+  return 1;
+}
+
 static int ime_get_last_commit(lua_State* L){
   /*TODO: not implemented. */
   fprintf(stderr, "TODO: ime_get_last_commit unimplemented.\n");
@@ -109,6 +165,11 @@ static int ime_int_to_hex_string(lua_State* L){
     return 1;
 }
 
+static int ime_half_to_full(lua_State * L){
+  return ime_convert_string
+    (L, native_helpers ? native_helpers->half_to_full : NULL);
+}
+
 static int ime_join_string(lua_State* L){
   luaL_Buffer buf;
   size_t vec_len; size_t i;
@@ -150,6 +211,165 @@ static int ime_join_string(lua_State* L){
   return 1;
 }
 
+#define LUA_IMELIB_TABLE "ime.table"
+
+typedef struct _lua_table_row_t{
+  const char * key;
+  const char * value;
+} lua_table_row_t;
+
+/* the rows point into the contents, sorted by the keys,
+   the rows of the same key are kept in the file order. */
+typedef struct _lua_column_table_t{
+  gchar * contents;
+  GArray * rows;
+} lua_column_table_t;
+
+/* the tables are loaded once for the process and never changed,
+   so the worker state shares them with the main state. */
+static GMutex column_tables_lock;
+static GHashTable * column_tables = NULL;
+
+static gint compare_table_row(gconstpointer a, gconstpointer b){
+  return strcmp(((const lua_table_row_t *) a)->key,
+                ((const lua_table_row_t *) b)->key);
+}
+
+/* each line is the key and the value separated by a tab,
+   the empty lines and the lines starting with '#' are skipped. */
+static lua_column_table_t * load_column_table(const char * filename){
+  gchar * contents = NULL;
+  if ( !g_file_get_contents(filename, &contents, NULL, NULL) )
+    return NULL;
+
+  lua_column_table_t * table = g_new0(lua_column_table_t, 1);
+  table->contents = contents;
+  table->rows = g_array_new(FALSE, FALSE, sizeof(lua_table_row_t));
+
+  gchar * line = contents;
+  while ( '\0' != *line ){
+    gchar * next = strchr(line, '\n');
+    if ( NULL != next )
+      *next++ = '\0';
+    else
+      next = line + strlen(line);
+
+    size_t len = strlen(line);
+    if ( len > 0 && '\r' == line[len - 1] )
+      line[len - 1] = '\0';
+
+    gchar * value = strchr(line, '\t');
+    if ( NULL != value && value != line && '#' != line[0] ){
+      *value++ = '\0';
+      lua_table_row_t row = {line, value};
+      g_array_append_val(table->rows, row);
+    }
+    line = next;
+  }
+
+  /* the sort is stable. */
+  g_array_sort(table->rows, compare_table_row);
+  return table;
+}
+
+static lua_column_table_t * acquire_column_table(const char * filename){
+  g_mutex_lock(&column_tables_lock);
+
+  if ( NULL == column_tables )
+    column_tables = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+  lua_column_table_t * table = g_hash_table_lookup(column_tables, filename);
+  if ( NULL == table ){
+    table = load_column_table(filename);
+    if ( NULL != table )
+      g_hash_table_insert(column_tables, g_strdup(filename), table);
+  }
+
+  g_mutex_unlock(&column_tables_lock);
+  return table;
+}
+
+/* the first row not less than the first len bytes of the key. */
+static guint column_table_lower_bound(const lua_column_table_t * table,
+                                      const char * key, size_t len){
+  guint begin = 0, end = table->rows->len;
+  while ( begin < end ){
+    guint middle = begin + (end - begin) / 2;
+    const lua_table_row_t * row =
+      &g_array_index(table->rows, lua_table_row_t, middle);
+    if ( strncmp(row->key, key, len) < 0 )
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+  return begin;
+}
+
+static const lua_column_table_t * ime_check_table(lua_State * L, int index){
+  return *(lua_column_table_t **) luaL_checkudata(L, index, LUA_IMELIB_TABLE);
+}
+
+static int ime_load_table(lua_State * L){
+  const char * filename = luaL_checklstring(L, 1, NULL);
+
+  lua_column_table_t * table = acquire_column_table(filename);
+  if ( NULL == table ){
+    lua_pushnil(L);
+    lua_pushfstring(L, "can not load table %s.", filename);
+    return 2;
+  }
+
+  lua_column_table_t ** handle = lua_newuserdata(L, sizeof(table));
+  *handle = table;
+  luaL_newmetatable(L, LUA_IMELIB_TABLE);
+  lua_setmetatable(L, -2);
+  return 1;
+}
+
+/* the values of the key, in the file order. */
+static int ime_lookup_table(lua_State * L){
+  const lua_column_table_t * table = ime_check_table(L, 1);
+  size_t l; int n = 0; guint i;
+  const char * key = luaL_checklstring(L, 2, &l);
+
+  lua_newtable(L);
+  /* compare the trailing-zero for the exact match. */
+  for ( i = column_table_lower_bound(table, key, l + 1);
+        i < table->rows->len; ++i ){
+    const lua_table_row_t * row =
+      &g_array_index(table->rows, lua_table_row_t, i);
+    if ( 0 != strcmp(row->key, key) )
+      break;
+    lua_pushstring(L, row->value);
+    lua_rawseti(L, -2, ++n);
+  }
+  return 1;
+}
+
+/* the values and the keys starting with the prefix, in the key order. */
+static int ime_search_table(lua_State * L){
+  const lua_column_table_t * table = ime_check_table(L, 1);
+  size_t l; int n = 0; guint i;
+  const char * prefix = luaL_checklstring(L, 2, &l);
+  lua_Integer limit = luaL_optinteger(L, 3, 100);
+
+  lua_newtable(L);
+  lua_newtable(L);
+  for ( i = column_table_lower_bound(table, prefix, l);
+        i < table->rows->len && n < limit; ++i ){
+    const lua_table_row_t * row =
+      &g_array_index(table->rows, lua_table_row_t, i);
+    if ( 0 != strncmp(row->key, prefix, l) )
+      break;
+    ++n;
+    lua_pushstring(L, row->value);
+    lua_rawseti(L, -3, n);
+    lua_pushstring(L, row->key);
+    lua_rawseti(L, -2, n);
+  }
+  return 2;
+}
+
 static int ime_parse_mapping(lua_State * L){
   const char * src_string, * line_sep, * key_value_sep, * values_sep;
   int m, n;
@@ -220,16 +440,23 @@ static int ime_register_command(lua_State * L){
 
   new_command.description = luaL_checklstring(L, 3, NULL);
 
-  if ( !lua_isnone(L, 4)) {
+  if ( !lua_isnoneornil(L, 4)) {
     new_command.leading = luaL_checklstring(L, 4, NULL);
   }else{
     new_command.leading = "digit";
   }
 
-  if ( !lua_isnone(L, 5)) {
+  if ( !lua_isnoneornil(L, 5)) {
     new_command.help = luaL_checklstring(L, 5, NULL);
   }
 
+  /* optional async flag. */
+  new_command.async = lua_toboolean(L, 6);
+
+  /* the worker state has the commands of the main state. */
+  if (lua_plugin_is_worker(L))
+    return 0;
+
   gboolean result = ibus_engine_plugin_add_command
     (lua_plugin_retrieve_plugin(L), &new_command);
 
@@ -280,7 +507,8 @@ static int ime_register_trigger(lua_State * L){
   new_trigger.candidate_trigger_strings =
     (gchar **)g_ptr_array_free(array, FALSE);
 
-  gboolean result = ibus_engine_plugin_add_trigger
+  gboolean result = lua_plugin_is_worker(L) ||
+    ibus_engine_plugin_add_trigger
     (lua_plugin_retrieve_plugin(L), &new_trigger);
 
   g_free(new_trigger.input_trigger_strings);
@@ -302,6 +530,11 @@ static int ime_register_converter(lua_State * L){
   lua_pop(L, 1);
 
   new_converter.description = luaL_checklstring(L, 2, NULL);
+  /* optional batch flag. */
+  new_converter.batch = lua_toboolean(L, 3);
+
+  if (lua_plugin_is_worker(L))
+    return 0;
 
   gboolean result = ibus_engine_plugin_add_converter
     (lua_plugin_retrieve_plugin(L), &new_converter);
@@ -312,6 +545,11 @@ static int ime_register_converter(lua_State * L){
   return 0;
 }
 
+static int ime_simp_to_trad(lua_State * L){
+  return ime_convert_string
+    (L, native_helpers ? native_helpers->simp_to_trad : NULL);
+}
+
 static int ime_split_string(lua_State * L){
   gchar ** str_vec;
   guint str_vec_len = 0; int i;
@@ -438,14 +676,20 @@ static int ime_utf16_to_utf8(lua_State* L){
 }
 
 static const luaL_Reg imelib[] = {
+  {"format_chinese_number", ime_format_chinese_number},
   {"get_last_commit", ime_get_last_commit},
   {"get_version", ime_get_version},
+  {"half_to_full", ime_half_to_full},
   {"int_to_hex_string", ime_int_to_hex_string},
   {"join_string", ime_join_string},
+  {"load_table", ime_load_table},
+  {"lookup_table", ime_lookup_table},
   {"parse_mapping", ime_parse_mapping},
   {"register_command", ime_register_command},
   {"register_converter", ime_register_converter},
   {"register_trigger", ime_register_trigger},
+  {"search_table", ime_search_table},
+  {"simp_to_trad", ime_simp_to_trad},
   {"split_string", ime_split_string},
   {"trim_string_left", ime_trim_string_left},
   {"trim_string_right", ime_trim_string_right},
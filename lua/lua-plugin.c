@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <glib/gstdio.h>
 
 #include "lua-plugin.h"
 
@@ -35,14 +36,68 @@
 
 #endif
 
+typedef struct _lua_async_request_t{
+  gchar * lua_function_name;
+  gchar * argument;
+  guint serial;
+  IBusEnginePluginAsyncCallback callback;
+  gpointer user_data;
+  IBusEnginePlugin * plugin; /* the reference is released in the main loop. */
+  GArray * candidates; /* the results from the worker. */
+  gboolean exceeded;
+} lua_async_request_t;
+
 struct _IBusEnginePluginPrivate{
   lua_State * L;
-  GArray * lua_commands; /* Array of lua_command_t. */
+  GArray * lua_commands; /* Array of lua_command_t, sorted by name. */
+  GHashTable * command_index; /* map command name to index + 1. */
   GArray * lua_triggers; /* Array of lua_trigger_t. */
+  /* compiled trigger strings, map to the index of lua_triggers. */
+  GHashTable * input_trigger_table; /* exact strings. */
+  GArray * input_trigger_patterns; /* Array of lua_trigger_pattern_t. */
+  GHashTable * candidate_trigger_table;
+  GArray * candidate_trigger_patterns;
   GArray * lua_converters; /* Array of lua_converter_t. */
   gchar * use_converter;
+  /* the execution budget of the calls on the key path. */
+  gint64 call_time_budget; /* in microseconds. */
+  guint call_instruction_budget;
+  GHashTable * disabled_functions; /* over budget functions. */
+  guint disabled_count;
+  GHashTable * overruns; /* map function name to the consecutive overruns. */
+  GHashTable * called_functions; /* the functions called since the load. */
+  /* the async commands run in the worker thread with its own lua state,
+     which loads the same scripts. */
+  GPtrArray * scripts; /* the loaded script filenames. */
+  GThread * worker;
+  GMutex worker_lock;
+  GCond worker_cond;
+  lua_async_request_t * pending; /* only the latest request is kept. */
+  gboolean worker_quit;
+  gint async_serial; /* the serial of the latest request, atomic. */
 };
 
+/* the default budget of one call. */
+#define LUA_CALL_TIME_BUDGET (100 * 1000)
+#define LUA_CALL_INSTRUCTION_BUDGET (20 * 1000 * 1000)
+/* the budget of one async call, which is off the key path. */
+#define LUA_ASYNC_TIME_BUDGET (2 * 1000 * 1000)
+#define LUA_ASYNC_INSTRUCTION_BUDGET (400 * 1000 * 1000)
+/* the async iterator is pulled at most these results. */
+#define LUA_ASYNC_MAX_RESULTS 100
+/* the hook checks the budget every these instructions. */
+#define LUA_CALL_HOOK_COUNT 1000
+/* the function is disabled after these consecutive overruns. */
+#define LUA_CALL_MAX_OVERRUNS 3
+/* the first call may load the tables, like ime.load_table,
+   it has the budget of these calls. */
+#define LUA_FIRST_CALL_BUDGET_SCALE 10
+
+typedef struct _lua_trigger_pattern_t{
+  GPatternSpec * spec;
+  guint index;
+} lua_trigger_pattern_t;
+
 G_DEFINE_TYPE_WITH_CODE (IBusEnginePlugin, ibus_engine_plugin, G_TYPE_OBJECT, G_ADD_PRIVATE (IBusEnginePlugin));
 
 #define IBUS_ENGINE_PLUGIN_GET_PRIVATE(obj) (ibus_engine_plugin_get_instance_private (obj))
@@ -53,6 +108,7 @@ static void lua_command_clone(lua_command_t * command, lua_command_t * new_comma
   new_command->description = g_strdup(command->description);
   new_command->leading = g_strdup(command->leading);
   new_command->help = g_strdup(command->help);
+  new_command->async = command->async;
 }
 
 static void lua_command_reclaim(lua_command_t * command){
@@ -80,6 +136,7 @@ static void lua_trigger_reclaim(lua_trigger_t * trigger){
 static void lua_converter_clone(lua_converter_t * converter, lua_converter_t * new_converter){
   new_converter->lua_function_name = g_strdup(converter->lua_function_name);
   new_converter->description = g_strdup(converter->description);
+  new_converter->batch = converter->batch;
 }
 
 static void lua_converter_reclaim(lua_converter_t * converter){
@@ -98,17 +155,77 @@ lua_plugin_init(IBusEnginePluginPrivate * plugin){
 
   g_assert ( NULL == plugin->lua_commands );
   plugin->lua_commands = g_array_new(TRUE, TRUE, sizeof(lua_command_t));
+  g_assert ( NULL == plugin->command_index );
+  plugin->command_index = g_hash_table_new(g_str_hash, g_str_equal);
 
   g_assert ( NULL == plugin->lua_triggers );
   plugin->lua_triggers = g_array_new(TRUE, TRUE, sizeof(lua_trigger_t));
+  plugin->input_trigger_table = g_hash_table_new_full
+    (g_str_hash, g_str_equal, g_free, NULL);
+  plugin->input_trigger_patterns = g_array_new
+    (FALSE, TRUE, sizeof(lua_trigger_pattern_t));
+  plugin->candidate_trigger_table = g_hash_table_new_full
+    (g_str_hash, g_str_equal, g_free, NULL);
+  plugin->candidate_trigger_patterns = g_array_new
+    (FALSE, TRUE, sizeof(lua_trigger_pattern_t));
 
   g_assert ( NULL == plugin->lua_converters );
   plugin->lua_converters = g_array_new(TRUE, TRUE, sizeof(lua_converter_t));
   plugin->use_converter = NULL;
 
+  plugin->call_time_budget = LUA_CALL_TIME_BUDGET;
+  plugin->call_instruction_budget = LUA_CALL_INSTRUCTION_BUDGET;
+  g_assert ( NULL == plugin->disabled_functions );
+  plugin->disabled_functions = g_hash_table_new_full
+    (g_str_hash, g_str_equal, g_free, NULL);
+  plugin->disabled_count = 0;
+  g_assert ( NULL == plugin->overruns );
+  plugin->overruns = g_hash_table_new_full
+    (g_str_hash, g_str_equal, g_free, NULL);
+  g_assert ( NULL == plugin->called_functions );
+  plugin->called_functions = g_hash_table_new_full
+    (g_str_hash, g_str_equal, g_free, NULL);
+
+  g_assert ( NULL == plugin->scripts );
+  plugin->scripts = g_ptr_array_new_with_free_func(g_free);
+  plugin->worker = NULL;
+  g_mutex_init(&plugin->worker_lock);
+  g_cond_init(&plugin->worker_cond);
+  plugin->pending = NULL;
+  plugin->worker_quit = FALSE;
+  plugin->async_serial = 0;
+
   return 0;
 }
 
+static void lua_async_request_free(lua_async_request_t * request){
+  g_free(request->lua_function_name);
+  g_free(request->argument);
+  if (request->candidates)
+    ibus_engine_plugin_free_candidates(request->candidates);
+  g_object_unref(request->plugin);
+  g_free(request);
+}
+
+static void
+lua_plugin_free_trigger_patterns(GHashTable ** table, GArray ** patterns){
+  size_t i;
+
+  if ( *table ){
+    g_hash_table_destroy(*table);
+    *table = NULL;
+  }
+
+  if ( *patterns ){
+    for ( i = 0; i < (*patterns)->len; ++i){
+      lua_trigger_pattern_t * pattern = &g_array_index(*patterns, lua_trigger_pattern_t, i);
+      g_pattern_spec_free(pattern->spec);
+    }
+    g_array_free(*patterns, TRUE);
+    *patterns = NULL;
+  }
+}
+
 static int
 lua_plugin_fini(IBusEnginePluginPrivate * plugin){
   size_t i;
@@ -116,6 +233,29 @@ lua_plugin_fini(IBusEnginePluginPrivate * plugin){
   lua_trigger_t * trigger;
   lua_converter_t * converter;
 
+  /* every request holds the plugin, the worker is waiting here. */
+  if ( plugin->worker ){
+    g_mutex_lock(&plugin->worker_lock);
+    plugin->worker_quit = TRUE;
+    g_cond_signal(&plugin->worker_cond);
+    g_mutex_unlock(&plugin->worker_lock);
+    g_thread_join(plugin->worker);
+    plugin->worker = NULL;
+  }
+  g_assert ( NULL == plugin->pending );
+  g_mutex_clear(&plugin->worker_lock);
+  g_cond_clear(&plugin->worker_cond);
+
+  if ( plugin->scripts ){
+    g_ptr_array_free(plugin->scripts, TRUE);
+    plugin->scripts = NULL;
+  }
+
+  if ( plugin->command_index ){
+    g_hash_table_destroy(plugin->command_index);
+    plugin->command_index = NULL;
+  }
+
   if ( plugin->lua_commands ){
     for ( i = 0; i < plugin->lua_commands->len; ++i){
       command = &g_array_index(plugin->lua_commands, lua_command_t, i);
@@ -134,6 +274,11 @@ lua_plugin_fini(IBusEnginePluginPrivate * plugin){
     plugin->lua_triggers = NULL;
   }
 
+  lua_plugin_free_trigger_patterns(&plugin->input_trigger_table,
+                                   &plugin->input_trigger_patterns);
+  lua_plugin_free_trigger_patterns(&plugin->candidate_trigger_table,
+                                   &plugin->candidate_trigger_patterns);
+
   if ( plugin->lua_converters ){
     for ( i = 0; i < plugin->lua_converters->len; ++i){
       converter = &g_array_index(plugin->lua_converters, lua_converter_t, i);
@@ -149,6 +294,21 @@ lua_plugin_fini(IBusEnginePluginPrivate * plugin){
   g_free(plugin->use_converter);
   plugin->use_converter = NULL;
 
+  if ( plugin->disabled_functions ){
+    g_hash_table_destroy(plugin->disabled_functions);
+    plugin->disabled_functions = NULL;
+  }
+
+  if ( plugin->overruns ){
+    g_hash_table_destroy(plugin->overruns);
+    plugin->overruns = NULL;
+  }
+
+  if ( plugin->called_functions ){
+    g_hash_table_destroy(plugin->called_functions);
+    plugin->called_functions = NULL;
+  }
+
   return 0;
 }
 
@@ -211,22 +371,127 @@ static int report (lua_State *L, int status) {
   return status;
 }
 
+/* the loaded scripts may fix the slow functions, they are enabled again. */
+static void lua_plugin_reset_budgets(IBusEnginePluginPrivate * priv){
+  g_hash_table_remove_all(priv->disabled_functions);
+  priv->disabled_count = 0;
+  g_hash_table_remove_all(priv->overruns);
+  g_hash_table_remove_all(priv->called_functions);
+}
+
+/* the worker loads the scripts before the next request. */
+static void lua_plugin_add_script(IBusEnginePluginPrivate * priv, const char * filename){
+  g_mutex_lock(&priv->worker_lock);
+  g_ptr_array_add(priv->scripts, g_strdup(filename));
+  g_mutex_unlock(&priv->worker_lock);
+  lua_plugin_reset_budgets(priv);
+}
+
 int ibus_engine_plugin_load_lua_script(IBusEnginePlugin * plugin, const char * filename){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_plugin_add_script(priv, filename);
   int status = luaL_dofile(priv->L, filename);
   return report(priv->L, status);
 }
 
+#define LUA_BYTECODE_MAGIC "IBLUAC1"
+
+/* the bytecode is valid for the script with the same mtime and size. */
+typedef struct _lua_bytecode_header_t{
+  char magic[8];
+  gint64 mtime;
+  gint64 size;
+} lua_bytecode_header_t;
+
+static int lua_plugin_dump_writer(lua_State * L, const void * p, size_t sz, void * ud){
+  g_byte_array_append((GByteArray *) ud, (const guint8 *) p, sz);
+  return 0;
+}
+
+static void lua_plugin_save_bytecode(lua_State * L, const lua_bytecode_header_t * header, const char * cachename){
+  GByteArray * buffer = g_byte_array_new();
+  g_byte_array_append(buffer, (const guint8 *) header, sizeof(*header));
+
+#if LUA_VERSION_NUM >= 503
+  int status = lua_dump(L, lua_plugin_dump_writer, buffer, 0);
+#else
+  int status = lua_dump(L, lua_plugin_dump_writer, buffer);
+#endif
+
+  if (0 == status) {
+    gchar * dirname = g_path_get_dirname(cachename);
+    g_mkdir_with_parents(dirname, 0700);
+    g_free(dirname);
+    g_file_set_contents(cachename, (const gchar *) buffer->data, buffer->len, NULL);
+  }
+  g_byte_array_free(buffer, TRUE);
+}
+
+int ibus_engine_plugin_load_lua_script_cached(IBusEnginePlugin * plugin, const char * filename, const char * cachename){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_State * L = priv->L;
+
+  GStatBuf st;
+  if (0 != g_stat(filename, &st))
+    return ibus_engine_plugin_load_lua_script(plugin, filename);
+
+  lua_plugin_add_script(priv, filename);
+
+  lua_bytecode_header_t header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, LUA_BYTECODE_MAGIC, sizeof(LUA_BYTECODE_MAGIC));
+  header.mtime = st.st_mtime;
+  header.size = st.st_size;
+
+  gchar * chunkname = g_strconcat("@", filename, NULL);
+  int status = -1;
+
+  gchar * contents = NULL;
+  gsize length = 0;
+  if (g_file_get_contents(cachename, &contents, &length, NULL)) {
+    if (length > sizeof(header) &&
+        0 == memcmp(contents, &header, sizeof(header))) {
+      status = luaL_loadbuffer(L, contents + sizeof(header),
+                               length - sizeof(header), chunkname);
+      /* fall back to the script, such as the lua is upgraded. */
+      if (status)
+        lua_pop(L, 1);
+    }
+    g_free(contents);
+  }
+
+  if (status) {
+    status = luaL_loadfile(L, filename);
+    if (0 == status)
+      lua_plugin_save_bytecode(L, &header, cachename);
+  }
+  g_free(chunkname);
+
+  if (0 == status)
+    status = lua_pcall(L, 0, LUA_MULTRET, 0);
+  return report(L, status);
+}
+
+
+/* the first command not less than the prefix. */
+static guint lua_plugin_lower_bound_command(GArray * lua_commands, const char * prefix){
+  guint begin = 0, end = lua_commands->len;
 
-static gint compare_command(gconstpointer a, gconstpointer b){
-  lua_command_t * ca = (lua_command_t *) a;
-  lua_command_t * cb = (lua_command_t *) b;
-  return strcmp(ca->command_name, cb->command_name);
+  while (begin < end) {
+    guint middle = begin + (end - begin) / 2;
+    lua_command_t * command = &g_array_index(lua_commands, lua_command_t, middle);
+    if (strcmp(command->command_name, prefix) < 0)
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+  return begin;
 }
 
 gboolean ibus_engine_plugin_add_command(IBusEnginePlugin * plugin, lua_command_t * command){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   GArray * lua_commands = priv->lua_commands;
+  guint i;
 
   if ( ibus_engine_plugin_lookup_command( plugin, command->command_name) )
     return FALSE;
@@ -234,9 +499,15 @@ gboolean ibus_engine_plugin_add_command(IBusEnginePlugin * plugin, lua_command_t
   lua_command_t new_command;
   lua_command_clone(command, &new_command);
 
-  g_array_append_val(lua_commands, new_command);
-  /* Note: need to improve speed here? */
-  g_array_sort(lua_commands, compare_command);
+  /* keep the commands sorted, and re-index the moved commands. */
+  guint position = lua_plugin_lower_bound_command(lua_commands, new_command.command_name);
+  g_array_insert_val(lua_commands, position, new_command);
+
+  for (i = position; i < lua_commands->len; ++i) {
+    lua_command_t * moved = &g_array_index(lua_commands, lua_command_t, i);
+    g_hash_table_insert(priv->command_index, (gpointer) moved->command_name,
+                        GUINT_TO_POINTER(i + 1));
+  }
 
   return TRUE;
 }
@@ -244,10 +515,24 @@ gboolean ibus_engine_plugin_add_command(IBusEnginePlugin * plugin, lua_command_t
 const lua_command_t * ibus_engine_plugin_lookup_command(IBusEnginePlugin * plugin, const char * command_name){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   GArray * lua_commands = priv->lua_commands;
-  lua_command_t lookup_command = {.command_name = command_name, };
 
-  lua_command_t * result = bsearch(&lookup_command, lua_commands->data, lua_commands->len, sizeof(lua_command_t), compare_command);
-  return result;
+  guint index = GPOINTER_TO_UINT(g_hash_table_lookup(priv->command_index, command_name));
+  if (0 == index)
+    return NULL;
+  return &g_array_index(lua_commands, lua_command_t, index - 1);
+}
+
+void ibus_engine_plugin_lookup_commands(IBusEnginePlugin * plugin, const char * prefix, guint * begin, guint * end){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  GArray * lua_commands = priv->lua_commands;
+  size_t len = strlen(prefix);
+
+  guint i = lua_plugin_lower_bound_command(lua_commands, prefix);
+  *begin = i;
+  while (i < lua_commands->len &&
+         0 == strncmp(g_array_index(lua_commands, lua_command_t, i).command_name, prefix, len))
+    ++i;
+  *end = i;
 }
 
 const GArray * ibus_engine_plugin_get_available_commands(IBusEnginePlugin * plugin){
@@ -255,6 +540,52 @@ const GArray * ibus_engine_plugin_get_available_commands(IBusEnginePlugin * plug
   return priv->lua_commands;
 }
 
+/* compile the trigger strings, the earlier trigger wins. */
+static void lua_plugin_compile_trigger_strings(GHashTable * table, GArray * patterns, gchar ** strings, guint index){
+  gchar ** string;
+
+  if ( NULL == strings )
+    return;
+
+  for (string = strings; *string != NULL; ++string){
+    if (strpbrk(*string, "*?")) {
+      lua_trigger_pattern_t pattern;
+      pattern.spec = g_pattern_spec_new(*string);
+      pattern.index = index;
+      g_array_append_val(patterns, pattern);
+    } else if (!g_hash_table_contains(table, *string)) {
+      g_hash_table_insert(table, g_strdup(*string), GUINT_TO_POINTER(index));
+    }
+  }
+}
+
+static gboolean lua_plugin_match_trigger(GArray * lua_triggers, GHashTable * table, GArray * patterns, const char * string, const char ** lua_function_name){
+  guint index = G_MAXUINT; gpointer value = NULL;
+  guint i; guint length;
+
+  if (g_hash_table_lookup_extended(table, string, NULL, &value))
+    index = GPOINTER_TO_UINT(value);
+
+  /* only the patterns of the earlier triggers need to be checked,
+     the patterns are in order of triggers. */
+  length = strlen(string);
+  for (i = 0; i < patterns->len; ++i){
+    lua_trigger_pattern_t * pattern = &g_array_index(patterns, lua_trigger_pattern_t, i);
+    if (pattern->index >= index)
+      break;
+    if (g_pattern_match(pattern->spec, length, string, NULL)){
+      index = pattern->index;
+      break;
+    }
+  }
+
+  if (G_MAXUINT == index)
+    return FALSE;
+
+  *lua_function_name = g_array_index(lua_triggers, lua_trigger_t, index).lua_function_name;
+  return TRUE;
+}
+
 gboolean ibus_engine_plugin_add_trigger(IBusEnginePlugin * plugin, lua_trigger_t * trigger){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   GArray * lua_triggers = priv->lua_triggers;
@@ -264,6 +595,14 @@ gboolean ibus_engine_plugin_add_trigger(IBusEnginePlugin * plugin, lua_trigger_t
 
   g_array_append_val(lua_triggers, new_trigger);
 
+  guint index = lua_triggers->len - 1;
+  lua_plugin_compile_trigger_strings(priv->input_trigger_table,
+                                     priv->input_trigger_patterns,
+                                     new_trigger.input_trigger_strings, index);
+  lua_plugin_compile_trigger_strings(priv->candidate_trigger_table,
+                                     priv->candidate_trigger_patterns,
+                                     new_trigger.candidate_trigger_strings, index);
+
   return TRUE;
 }
 
@@ -274,40 +613,20 @@ const GArray * ibus_engine_plugin_get_available_triggers(IBusEnginePlugin * plug
 
 gboolean ibus_engine_plugin_match_input(IBusEnginePlugin * plugin, const char * input, const char ** lua_function_name){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
-  GArray * lua_triggers = priv->lua_triggers;
 
-  gint i; gchar ** pattern;
-  for (i = 0; i < lua_triggers->len; ++i){
-    lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, i);
-
-    for (pattern = trigger->input_trigger_strings; *pattern != NULL; ++pattern){
-      if (g_pattern_match_simple(*pattern, input)){
-        *lua_function_name = trigger->lua_function_name;
-        return TRUE;
-      }
-    }
-  }
-
-  return FALSE;
+  return lua_plugin_match_trigger(priv->lua_triggers,
+                                  priv->input_trigger_table,
+                                  priv->input_trigger_patterns,
+                                  input, lua_function_name);
 }
 
 gboolean ibus_engine_plugin_match_candidate(IBusEnginePlugin * plugin, const char * candidate, const char ** lua_function_name){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
-  GArray * lua_triggers = priv->lua_triggers;
-
-  gint i; gchar ** pattern;
-  for (i = 0; i < lua_triggers->len; ++i){
-    lua_trigger_t * trigger = &g_array_index(lua_triggers, lua_trigger_t, i);
 
-    for (pattern = trigger->candidate_trigger_strings; *pattern != NULL; ++pattern){
-      if (g_pattern_match_simple(*pattern, candidate)){
-        *lua_function_name = trigger->lua_function_name;
-        return TRUE;
-      }
-    }
-  }
-
-  return FALSE;
+  return lua_plugin_match_trigger(priv->lua_triggers,
+                                  priv->candidate_trigger_table,
+                                  priv->candidate_trigger_patterns,
+                                  candidate, lua_function_name);
 }
 
 gboolean ibus_engine_plugin_add_converter(IBusEnginePlugin * plugin, lua_converter_t * converter){
@@ -350,6 +669,122 @@ const char * ibus_engine_plugin_get_converter(IBusEnginePlugin * plugin){
   return priv->use_converter;  
 }
 
+gboolean ibus_engine_plugin_is_batch_converter(IBusEnginePlugin * plugin, const char * lua_function_name){
+  const lua_converter_t * converter = ibus_engine_plugin_lookup_converter
+    (plugin, lua_function_name);
+  return converter ? converter->batch : FALSE;
+}
+
+const lua_converter_t * ibus_engine_plugin_lookup_converter(IBusEnginePlugin * plugin, const char * lua_function_name){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  GArray * lua_converters = priv->lua_converters;
+
+  gint i;
+  for (i = 0; i < lua_converters->len; ++i) {
+    lua_converter_t * converter = &g_array_index
+      (lua_converters, lua_converter_t, i);
+    if (g_strcmp0 (converter->lua_function_name, lua_function_name) == 0)
+      return converter;
+  }
+
+  return NULL;
+}
+
+/* the budget of the running call, the calls are not nested in one thread,
+   the main thread and the worker have their own budgets. */
+static __thread struct {
+  gint64 deadline;
+  guint instructions;
+  guint max_instructions;
+  gboolean exceeded;
+  /* the async call is cancelled when the serial is changed. */
+  gint * serial;
+  gint expected;
+} lua_call_budget;
+
+static void lua_plugin_budget_hook(lua_State * L, lua_Debug * ar){
+  if (lua_call_budget.serial &&
+      g_atomic_int_get(lua_call_budget.serial) != lua_call_budget.expected)
+    luaL_error(L, "async call cancelled");
+
+  lua_call_budget.instructions += LUA_CALL_HOOK_COUNT;
+  if (lua_call_budget.instructions > lua_call_budget.max_instructions ||
+      g_get_monotonic_time() > lua_call_budget.deadline) {
+    lua_call_budget.exceeded = TRUE;
+    luaL_error(L, "execution budget exceeded");
+  }
+}
+
+/* count the consecutive overruns of the function, one slow call is
+   tolerated, the function is disabled after LUA_CALL_MAX_OVERRUNS. */
+static void lua_plugin_record_overrun(IBusEnginePluginPrivate * priv, const char * lua_function_name, gboolean exceeded){
+  if (!exceeded) {
+    if (g_hash_table_size(priv->overruns))
+      g_hash_table_remove(priv->overruns, lua_function_name);
+    return;
+  }
+
+  guint overruns = GPOINTER_TO_UINT
+    (g_hash_table_lookup(priv->overruns, lua_function_name)) + 1;
+  if (overruns < LUA_CALL_MAX_OVERRUNS) {
+    g_warning("lua function %s exceeded the execution budget.",
+              lua_function_name);
+    g_hash_table_insert(priv->overruns, g_strdup(lua_function_name),
+                        GUINT_TO_POINTER(overruns));
+    return;
+  }
+
+  g_warning("lua function %s exceeded the execution budget %u times, disabled.",
+            lua_function_name, overruns);
+  g_hash_table_remove(priv->overruns, lua_function_name);
+  g_hash_table_add(priv->disabled_functions, g_strdup(lua_function_name));
+  priv->disabled_count++;
+}
+
+/* call the function below the argument within the execution budget,
+   the function over budget repeatedly is disabled, and the error is popped. */
+static int lua_plugin_budget_call(IBusEnginePluginPrivate * priv, const char * lua_function_name, int nargs){
+  lua_State * L = priv->L;
+  gint64 time_budget = priv->call_time_budget;
+  guint instruction_budget = priv->call_instruction_budget;
+
+  /* the cold loads of the first call are not charged to the budget. */
+  if (!g_hash_table_contains(priv->called_functions, lua_function_name)) {
+    g_hash_table_add(priv->called_functions, g_strdup(lua_function_name));
+    time_budget *= LUA_FIRST_CALL_BUDGET_SCALE;
+    instruction_budget *= LUA_FIRST_CALL_BUDGET_SCALE;
+  }
+
+  lua_call_budget.deadline = g_get_monotonic_time() + time_budget;
+  lua_call_budget.instructions = 0;
+  lua_call_budget.max_instructions = instruction_budget;
+  lua_call_budget.exceeded = FALSE;
+  lua_call_budget.serial = NULL;
+
+  lua_sethook(L, lua_plugin_budget_hook, LUA_MASKCOUNT, LUA_CALL_HOOK_COUNT);
+  int result = lua_pcall(L, nargs, 1, 0);
+  lua_sethook(L, NULL, 0, 0);
+
+  lua_plugin_record_overrun(priv, lua_function_name, lua_call_budget.exceeded);
+
+  if (result)
+    lua_pop(L, 1);
+  return result;
+}
+
+void ibus_engine_plugin_set_call_budget(IBusEnginePlugin * plugin, gint64 time_budget, guint instruction_budget){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  priv->call_time_budget = time_budget;
+  priv->call_instruction_budget = instruction_budget;
+  /* the functions are judged by the new budget. */
+  lua_plugin_reset_budgets(priv);
+}
+
+guint ibus_engine_plugin_get_disabled_count(IBusEnginePlugin * plugin){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  return priv->disabled_count;
+}
+
 int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function_name, const char * argument /*optional, maybe NULL.*/){
   IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
   int type; int result;
@@ -360,6 +795,9 @@ int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function
      but empty string is acceptable. */
   if (NULL == argument) argument = "";
 
+  if (g_hash_table_contains(priv->disabled_functions, lua_function_name))
+    return 0;
+
   /* check whether lua_function_name exists. */
   lua_getglobal(L, lua_function_name);
   type = lua_type(L, -1);
@@ -367,7 +805,7 @@ int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function
     return 0;
   lua_pushstring(L, argument);
 
-  result = lua_pcall(L, 1, 1, 0);
+  result = lua_plugin_budget_call(priv, lua_function_name, 1);
   if (result) return 0;
 
   type = lua_type(L, -1);
@@ -380,6 +818,56 @@ int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function
   return 0;
 }
 
+gchar ** ibus_engine_plugin_call_batch(IBusEnginePlugin * plugin, const char * lua_function_name, const char * const * arguments, guint num){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  int type; int result; guint i;
+  gchar ** results;
+
+  lua_State * L = priv->L;
+
+  if (g_hash_table_contains(priv->disabled_functions, lua_function_name))
+    return NULL;
+
+  /* check whether lua_function_name exists. */
+  lua_getglobal(L, lua_function_name);
+  type = lua_type(L, -1);
+  if ( LUA_TFUNCTION != type ){
+    lua_pop(L, 1);
+    return NULL;
+  }
+
+  lua_createtable(L, num, 0);
+  for (i = 0; i < num; ++i){
+    lua_pushstring(L, arguments[i] ? arguments[i] : "");
+    lua_rawseti(L, -2, i + 1);
+  }
+
+  result = lua_plugin_budget_call(priv, lua_function_name, 1);
+  if (result)
+    return NULL;
+
+  type = lua_type(L, -1);
+  if ( LUA_TTABLE != type ){
+    lua_pop(L, 1);
+    return NULL;
+  }
+
+  /* keep the argument when the converted value is missing. */
+  results = g_new0(gchar *, num + 1);
+  for (i = 0; i < num; ++i){
+    lua_rawgeti(L, -1, i + 1);
+    type = lua_type(L, -1);
+    if ( LUA_TNUMBER == type || LUA_TSTRING == type )
+      results[i] = g_strdup(lua_tostring(L, -1));
+    else
+      results[i] = g_strdup(arguments[i] ? arguments[i] : "");
+    lua_pop(L, 1);
+  }
+  lua_pop(L, 1);
+
+  return results;
+}
+
 /**
  * get a candidate from lua return value.
  */
@@ -488,8 +976,240 @@ GArray * ibus_engine_plugin_get_retvals(IBusEnginePlugin * plugin){
   return result;
 }
 
+int ibus_engine_plugin_get_iterator(IBusEnginePlugin * plugin){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_State * L = priv->L;
+
+  if ( LUA_TFUNCTION != lua_type(L, -1) )
+    return LUA_NOREF;
+
+  return luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+GArray * ibus_engine_plugin_pull_iterator(IBusEnginePlugin * plugin, const char * lua_function_name, int iterator, guint num){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_State * L = priv->L; guint i;
+  const lua_command_candidate_t * candidate = NULL;
+
+  GArray * result = g_array_new(TRUE, TRUE, sizeof(lua_command_candidate_t *));
+
+  if (g_hash_table_contains(priv->disabled_functions, lua_function_name))
+    return result;
+
+  /* each step of the iterator has its own budget. */
+  for ( i = 0; i < num; ++i ){
+    lua_rawgeti(L, LUA_REGISTRYINDEX, iterator);
+    if (lua_plugin_budget_call(priv, lua_function_name, 0))
+      break;
+
+    if ( lua_isnil(L, -1) ){
+      lua_pop(L, 1);
+      break;
+    }
+
+    candidate = ibus_engine_plugin_get_candidate(L);
+    lua_pop(L, 1);
+
+    g_array_append_val(result, candidate);
+  }
+
+  return result;
+}
+
+void ibus_engine_plugin_free_iterator(IBusEnginePlugin * plugin, int iterator){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  luaL_unref(priv->L, LUA_REGISTRYINDEX, iterator);
+}
+
 void ibus_engine_plugin_free_candidate(lua_command_candidate_t * candidate){
   g_free((gpointer)candidate->content);
   g_free((gpointer)candidate->suggest);
   g_free((gpointer)candidate->help);
 }
+
+void ibus_engine_plugin_free_candidates(GArray * candidates){
+  guint i;
+
+  for ( i = 0; i < candidates->len; ++i ){
+    lua_command_candidate_t * candidate = g_array_index(candidates, lua_command_candidate_t *, i);
+    ibus_engine_plugin_free_candidate(candidate);
+    free(candidate);
+  }
+  g_array_free(candidates, TRUE);
+}
+
+/* collect the results of the async call below the top of the stack,
+   the results are in the table, the single value or the iterator. */
+static GArray * lua_plugin_worker_call(lua_State * L, const char * lua_function_name, const char * argument){
+  const lua_command_candidate_t * candidate = NULL;
+  GArray * result = g_array_new(TRUE, TRUE, sizeof(lua_command_candidate_t *));
+  int type; int i;
+
+  lua_getglobal(L, lua_function_name);
+  if ( LUA_TFUNCTION != lua_type(L, -1) ){
+    lua_pop(L, 1);
+    return result;
+  }
+  lua_pushstring(L, argument);
+
+  if (lua_pcall(L, 1, 1, 0)){
+    lua_pop(L, 1);
+    return result;
+  }
+
+  type = lua_type(L, -1);
+  if ( LUA_TTABLE == type ){
+    int elem_num = lua_objlen(L, -1);
+    for ( i = 0; i < elem_num; ++i ){
+      lua_rawgeti(L, -1, i + 1);
+      candidate = ibus_engine_plugin_get_candidate(L);
+      lua_pop(L, 1);
+      g_array_append_val(result, candidate);
+    }
+  } else if ( LUA_TFUNCTION == type ){
+    for ( i = 0; i < LUA_ASYNC_MAX_RESULTS; ++i ){
+      lua_pushvalue(L, -1);
+      if (lua_pcall(L, 0, 1, 0)){
+        lua_pop(L, 1);
+        break;
+      }
+      if ( lua_isnil(L, -1) ){
+        lua_pop(L, 1);
+        break;
+      }
+      candidate = ibus_engine_plugin_get_candidate(L);
+      lua_pop(L, 1);
+      g_array_append_val(result, candidate);
+    }
+  } else if ( LUA_TNUMBER == type || LUA_TBOOLEAN == type || LUA_TSTRING == type ){
+    candidate = ibus_engine_plugin_get_candidate(L);
+    g_array_append_val(result, candidate);
+  }
+  lua_pop(L, 1);
+
+  return result;
+}
+
+/* deliver the results in the main loop, the stale results are dropped. */
+static gboolean lua_plugin_deliver_results(gpointer data){
+  lua_async_request_t * request = data;
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(request->plugin);
+
+  lua_plugin_record_overrun(priv, request->lua_function_name,
+                            request->exceeded);
+
+  if (request->candidates &&
+      request->serial == (guint) g_atomic_int_get(&priv->async_serial)) {
+    GArray * candidates = request->candidates;
+    request->candidates = NULL;
+    request->callback(request->plugin, candidates, request->user_data);
+  }
+
+  lua_async_request_free(request);
+  return FALSE;
+}
+
+static gpointer lua_plugin_worker(gpointer data){
+  IBusEnginePlugin * plugin = data;
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  guint loaded = 0;
+
+  lua_State * L = lua_open();
+  lua_plugin_openlibs(L);
+  lua_plugin_store_plugin(L, plugin);
+  lua_plugin_mark_worker(L);
+
+  g_mutex_lock(&priv->worker_lock);
+  while (TRUE) {
+    while (!priv->worker_quit && NULL == priv->pending)
+      g_cond_wait(&priv->worker_cond, &priv->worker_lock);
+    if (priv->worker_quit)
+      break;
+
+    lua_async_request_t * request = priv->pending;
+    priv->pending = NULL;
+
+    /* load the scripts loaded by the main state since the last request. */
+    while (loaded < priv->scripts->len) {
+      gchar * filename = g_strdup(g_ptr_array_index(priv->scripts, loaded++));
+      g_mutex_unlock(&priv->worker_lock);
+      report(L, luaL_dofile(L, filename));
+      g_free(filename);
+      g_mutex_lock(&priv->worker_lock);
+    }
+    g_mutex_unlock(&priv->worker_lock);
+
+    lua_call_budget.deadline = g_get_monotonic_time() + LUA_ASYNC_TIME_BUDGET;
+    lua_call_budget.instructions = 0;
+    lua_call_budget.max_instructions = LUA_ASYNC_INSTRUCTION_BUDGET;
+    lua_call_budget.exceeded = FALSE;
+    lua_call_budget.serial = &priv->async_serial;
+    lua_call_budget.expected = request->serial;
+
+    lua_sethook(L, lua_plugin_budget_hook, LUA_MASKCOUNT, LUA_CALL_HOOK_COUNT);
+    request->candidates = lua_plugin_worker_call
+      (L, request->lua_function_name, request->argument);
+    lua_sethook(L, NULL, 0, 0);
+    request->exceeded = lua_call_budget.exceeded;
+
+    /* the request always goes back to release the plugin in the main loop. */
+    g_idle_add(lua_plugin_deliver_results, request);
+
+    g_mutex_lock(&priv->worker_lock);
+  }
+  g_mutex_unlock(&priv->worker_lock);
+
+  lua_close(L);
+  return NULL;
+}
+
+guint ibus_engine_plugin_call_async(IBusEnginePlugin * plugin, const char * lua_function_name, const char * argument, IBusEnginePluginAsyncCallback callback, gpointer user_data){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_async_request_t * stale;
+
+  if (NULL == argument) argument = "";
+
+  if (g_hash_table_contains(priv->disabled_functions, lua_function_name))
+    return 0;
+
+  lua_async_request_t * request = g_new0(lua_async_request_t, 1);
+  request->lua_function_name = g_strdup(lua_function_name);
+  request->argument = g_strdup(argument);
+  request->callback = callback;
+  request->user_data = user_data;
+  request->plugin = g_object_ref(plugin);
+
+  /* the new serial cancels the running call. */
+  guint serial = (guint) g_atomic_int_add(&priv->async_serial, 1) + 1;
+  if (0 == serial)
+    serial = (guint) g_atomic_int_add(&priv->async_serial, 1) + 1;
+  request->serial = serial;
+
+  g_mutex_lock(&priv->worker_lock);
+  if (NULL == priv->worker)
+    priv->worker = g_thread_new("lua-plugin", lua_plugin_worker, plugin);
+  stale = priv->pending;
+  priv->pending = request;
+  g_cond_signal(&priv->worker_cond);
+  g_mutex_unlock(&priv->worker_lock);
+
+  if (stale)
+    lua_async_request_free(stale);
+
+  return serial;
+}
+
+void ibus_engine_plugin_cancel_async(IBusEnginePlugin * plugin){
+  IBusEnginePluginPrivate * priv = IBUS_ENGINE_PLUGIN_GET_PRIVATE(plugin);
+  lua_async_request_t * stale;
+
+  g_atomic_int_inc(&priv->async_serial);
+
+  g_mutex_lock(&priv->worker_lock);
+  stale = priv->pending;
+  priv->pending = NULL;
+  g_mutex_unlock(&priv->worker_lock);
+
+  if (stale)
+    lua_async_request_free(stale);
+}
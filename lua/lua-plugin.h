@@ -37,6 +37,7 @@ LUALIB_API int (luaopen_ime) (lua_State * L);
 LUALIB_API int (luaopen_myos) (lua_State * L);
 
 #define LUA_IMELIB_CONTEXT "__context"
+#define LUA_IMELIB_WORKER "__worker"
 
 typedef struct _lua_command_t{
   const char * command_name;
@@ -44,6 +45,7 @@ typedef struct _lua_command_t{
   const char * description;
   const char * leading; /* optional, default "digit". */
   const char * help; /* optional. */
+  gboolean async; /* optional, runs on the worker lua state. */
 } lua_command_t;
 
 typedef struct _lua_command_candidate_t{
@@ -62,6 +64,7 @@ typedef struct _lua_trigger_t{
 typedef struct _lua_converter_t{
   const char * lua_function_name;
   const char * description;
+  gboolean batch; /* optional, converts a table of strings at once. */
 } lua_converter_t;
 
 /*
@@ -79,8 +82,23 @@ typedef struct _IBusEnginePlugin IBusEnginePlugin;
 typedef struct _IBusEnginePluginClass IBusEnginePluginClass;
 typedef struct _IBusEnginePluginPrivate IBusEnginePluginPrivate;
 
+/* the native helpers of the engine for the scripts, the returned strings
+   are freed with g_free, they are called from the worker state too. */
+typedef struct _lua_native_helpers_t{
+  gchar * (* simp_to_trad)(const char * str);
+  gchar * (* half_to_full)(const char * str);
+  /* the style is simplest, simplified or traditional in 0, 1, 2. */
+  gchar * (* format_chinese_number)(gint64 num, int style);
+} lua_native_helpers_t;
+
 void lua_plugin_openlibs (lua_State *L);
+/* set the native helpers before the scripts are loaded, without them
+   the conversions return the input unchanged. */
+void lua_plugin_set_native_helpers(const lua_native_helpers_t * helpers);
 void lua_plugin_store_plugin(lua_State * L, IBusEnginePlugin * plugin);
+/* the worker state loads the same scripts, but skips the registrations. */
+void lua_plugin_mark_worker(lua_State * L);
+gboolean lua_plugin_is_worker(lua_State * L);
 
 struct _IBusEnginePlugin
 {
@@ -107,6 +125,12 @@ IBusEnginePlugin * ibus_engine_plugin_new();
  */
 int ibus_engine_plugin_load_lua_script(IBusEnginePlugin * plugin, const char * filename);
 
+/**
+ * load a lua script through the bytecode cache file,
+ * the cache is re-compiled when the script is modified.
+ */
+int ibus_engine_plugin_load_lua_script_cached(IBusEnginePlugin * plugin, const char * filename, const char * cachename);
+
 /**
  * add a lua_command_t to plugin.
  */
@@ -160,6 +184,16 @@ gboolean ibus_engine_plugin_set_converter(IBusEnginePlugin * plugin, const char
  */
 const char * ibus_engine_plugin_get_converter(IBusEnginePlugin * plugin);
 
+/**
+ * check whether the converter with the lua function name accepts a table of strings.
+ */
+gboolean ibus_engine_plugin_is_batch_converter(IBusEnginePlugin * plugin, const char * lua_function_name);
+
+/**
+ * lookup the converter with the lua function name, NULL if not found.
+ */
+const lua_converter_t * ibus_engine_plugin_lookup_converter(IBusEnginePlugin * plugin, const char * lua_function_name);
+
 /**
  * Lookup a special command in ime lua extension.
  * command must be an 2-char long string.
@@ -167,6 +201,25 @@ const char * ibus_engine_plugin_get_converter(IBusEnginePlugin * plugin);
  */
 const lua_command_t * ibus_engine_plugin_lookup_command(IBusEnginePlugin * plugin, const char * command_name);
 
+/**
+ * lookup the commands starting with the prefix,
+ * they are in [begin, end) of the available commands.
+ */
+void ibus_engine_plugin_lookup_commands(IBusEnginePlugin * plugin, const char * prefix, guint * begin, guint * end);
+
+/**
+ * set the execution budget of the calls, in microseconds and lua instructions,
+ * the function is disabled after it exceeds the budget in consecutive calls,
+ * the first call of a function has a larger budget for its cold loads.
+ * setting the budget or loading a script enables the functions again.
+ */
+void ibus_engine_plugin_set_call_budget(IBusEnginePlugin * plugin, gint64 time_budget, guint instruction_budget);
+
+/**
+ * get the number of the functions disabled by the execution budget.
+ */
+guint ibus_engine_plugin_get_disabled_count(IBusEnginePlugin * plugin);
+
 /**
  * retval int: returns the number of results,
  *              only support string or string array.
@@ -174,6 +227,13 @@ const lua_command_t * ibus_engine_plugin_lookup_command(IBusEnginePlugin * plugi
  */
 int ibus_engine_plugin_call(IBusEnginePlugin * plugin, const char * lua_function_name, const char * argument /*optional, maybe NULL.*/);
 
+/**
+ * call the batch converter once with a table of the arguments.
+ * retval gchar **: the converted strings in the same order, (values have been copied.)
+ *                  NULL terminated, free with g_strfreev, or NULL on failure.
+ */
+gchar ** ibus_engine_plugin_call_batch(IBusEnginePlugin * plugin, const char * lua_function_name, const char * const * arguments, guint num);
+
 /**
  * retrieve the first string value. (value has been copied.)
  */
@@ -189,6 +249,41 @@ const lua_command_candidate_t * ibus_engine_plugin_get_retval(IBusEnginePlugin *
  */
 GArray * ibus_engine_plugin_get_retvals(IBusEnginePlugin * plugin);
 
+/**
+ * take the iterator function returned by the call, LUA_NOREF if not any.
+ * the command returns the iterator to produce the results page by page.
+ */
+int ibus_engine_plugin_get_iterator(IBusEnginePlugin * plugin);
+
+/**
+ * pull at most num results from the iterator,
+ * the returned array is shorter than num when the iterator ends.
+ */
+GArray * ibus_engine_plugin_pull_iterator(IBusEnginePlugin * plugin, const char * lua_function_name, int iterator, guint num);
+
+void ibus_engine_plugin_free_iterator(IBusEnginePlugin * plugin, int iterator);
+
+/**
+ * receive the array of lua_command_candidate_t values of the async call,
+ * the callback takes the array, free with ibus_engine_plugin_free_candidates.
+ */
+typedef void (* IBusEnginePluginAsyncCallback)(IBusEnginePlugin * plugin, GArray * candidates, gpointer user_data);
+
+/**
+ * call the lua function on the worker lua state, the results are
+ * posted to the callback in the main loop. only the latest call is
+ * kept, the stale call is cancelled and its results are dropped.
+ * retval guint: the serial of the call, or 0 if the function is disabled.
+ */
+guint ibus_engine_plugin_call_async(IBusEnginePlugin * plugin, const char * lua_function_name, const char * argument, IBusEnginePluginAsyncCallback callback, gpointer user_data);
+
+/**
+ * cancel the pending async call, its callback will not be called.
+ */
+void ibus_engine_plugin_cancel_async(IBusEnginePlugin * plugin);
+
+void ibus_engine_plugin_free_candidates(GArray * candidates);
+
 void ibus_engine_plugin_free_candidate(lua_command_candidate_t * candidate);
 
 G_END_DECLS
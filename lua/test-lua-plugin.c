@@ -21,9 +21,21 @@
 
 #include <stdio.h>
 #include <glib.h>
+#include <glib/gstdio.h>
 
 #include "lua-plugin.h"
 
+static void async_results_ready(IBusEnginePlugin * plugin, GArray * candidates, gpointer user_data){
+  GMainLoop * loop = user_data;
+
+  /* only the latest call is delivered. */
+  g_assert(2 == candidates->len);
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 0)->content, "hello"));
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 1)->content, "HELLO"));
+  ibus_engine_plugin_free_candidates(candidates);
+  g_main_loop_quit(loop);
+}
+
 int main(int argc, char * argv[]){
   printf("starting test...\n");
 
@@ -31,9 +43,114 @@ int main(int argc, char * argv[]){
   plugin = ibus_engine_plugin_new();
 
   ibus_engine_plugin_load_lua_script(plugin, LUASCRIPTDIR G_DIR_SEPARATOR_S "test.lua");
-  
+
+  const char * arguments[] = {"hello", "world"};
+  g_assert(ibus_engine_plugin_is_batch_converter(plugin, "upper_converter"));
+  gchar ** results = ibus_engine_plugin_call_batch
+    (plugin, "upper_converter", arguments, G_N_ELEMENTS(arguments));
+  g_assert(NULL != results);
+  g_assert(0 == g_strcmp0(results[0], "HELLO"));
+  g_assert(0 == g_strcmp0(results[1], "WORLD"));
+  g_assert(NULL == results[2]);
+  g_strfreev(results);
+
+  const char * lua_function_name = NULL;
+  g_assert(ibus_engine_plugin_match_input(plugin, "echoing", &lua_function_name));
+  g_assert(0 == g_strcmp0(lua_function_name, "echo_trigger"));
+  g_assert(!ibus_engine_plugin_match_input(plugin, "ech", &lua_function_name));
+  g_assert(ibus_engine_plugin_match_candidate(plugin, "回声", &lua_function_name));
+  g_assert(!ibus_engine_plugin_match_candidate(plugin, "回", &lua_function_name));
+
+  /* the commands are sorted by name. */
+  guint begin = 0, end = 0;
+  ibus_engine_plugin_lookup_commands(plugin, "c", &begin, &end);
+  g_assert(2 == end - begin);
+  const GArray * commands = ibus_engine_plugin_get_available_commands(plugin);
+  g_assert(0 == g_strcmp0(g_array_index(commands, lua_command_t, begin).command_name, "ca"));
+  g_assert(NULL != ibus_engine_plugin_lookup_command(plugin, "ct"));
+  g_assert(NULL == ibus_engine_plugin_lookup_command(plugin, "cx"));
+
+  /* the results of the iterator are pulled page by page. */
+  g_assert(0 == ibus_engine_plugin_call(plugin, "count_command", ""));
+  int iterator = ibus_engine_plugin_get_iterator(plugin);
+  g_assert(LUA_NOREF != iterator);
+  GArray * candidates = ibus_engine_plugin_pull_iterator(plugin, "count_command", iterator, 2);
+  g_assert(2 == candidates->len);
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 0)->content, "1"));
+  g_array_free(candidates, TRUE);
+  candidates = ibus_engine_plugin_pull_iterator(plugin, "count_command", iterator, 2);
+  g_assert(1 == candidates->len);
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 0)->content, "3"));
+  g_array_free(candidates, TRUE);
+  ibus_engine_plugin_free_iterator(plugin, iterator);
+
+  /* the endless function is stopped, and disabled after it is stopped
+     three times in a row. */
+  ibus_engine_plugin_set_call_budget(plugin, 10 * 1000, 1000 * 1000);
+  g_assert(0 == ibus_engine_plugin_call(plugin, "busy_function", "hello"));
+  g_assert(0 == ibus_engine_plugin_call(plugin, "busy_function", "hello"));
+  g_assert(0 == ibus_engine_plugin_get_disabled_count(plugin));
+  g_assert(0 == ibus_engine_plugin_call(plugin, "busy_function", "hello"));
+  g_assert(1 == ibus_engine_plugin_get_disabled_count(plugin));
+  g_assert(0 == ibus_engine_plugin_call(plugin, "busy_function", "hello"));
+  g_assert(1 == ibus_engine_plugin_get_disabled_count(plugin));
+
+  /* the new budget enables the functions again. */
+  ibus_engine_plugin_set_call_budget(plugin, 10 * 1000, 1000 * 1000);
+  g_assert(0 == ibus_engine_plugin_get_disabled_count(plugin));
+
+  /* the async command runs on the worker, the stale call is cancelled. */
+  const lua_command_t * command = ibus_engine_plugin_lookup_command(plugin, "as");
+  g_assert(NULL != command && command->async);
+  g_assert(!ibus_engine_plugin_lookup_command(plugin, "ct")->async);
+  GMainLoop * loop = g_main_loop_new(NULL, FALSE);
+  g_assert(0 != ibus_engine_plugin_call_async(plugin, "endless_command", "", async_results_ready, loop));
+  g_assert(0 != ibus_engine_plugin_call_async(plugin, "async_command", "hel", async_results_ready, loop));
+  g_assert(0 != ibus_engine_plugin_call_async(plugin, "async_command", "hello", async_results_ready, loop));
+  g_main_loop_run(loop);
+  g_main_loop_unref(loop);
+
+  /* the table is sorted by the keys, the equal keys keep the file order. */
+  gchar * tablename = g_build_filename
+    (g_get_tmp_dir(), "test-lua-plugin.table", NULL);
+  const char * table = "# comment\nnin\t您\nni\t你\nhao\t好\n\nni\t泥\nnv\t女";
+  g_assert(g_file_set_contents(tablename, table, -1, NULL));
+  g_assert(3 == ibus_engine_plugin_call(plugin, "table_lookup", tablename));
+  candidates = ibus_engine_plugin_get_retvals(plugin);
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 0)->content, "你,泥"));
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 1)->content, "你,泥,您"));
+  g_assert(0 == g_strcmp0(g_array_index(candidates, lua_command_candidate_t *, 2)->content, "nin"));
+  ibus_engine_plugin_free_candidates(candidates);
+  g_unlink(tablename);
+  g_free(tablename);
+
+  g_assert(1 == ibus_engine_plugin_call(plugin, "echo_trigger", "hello"));
+  gchar * result = ibus_engine_plugin_get_first_result(plugin);
+  g_assert(0 == g_strcmp0(result, "hello"));
+  g_free(result);
+
   g_object_unref(plugin);
 
+  /* the second plugin loads the bytecode saved by the first one. */
+  gchar * cachename = g_build_filename
+    (g_get_tmp_dir(), "test-lua-plugin.luac", NULL);
+  g_unlink(cachename);
+
+  gint i;
+  for (i = 0; i < 2; i++) {
+    plugin = ibus_engine_plugin_new();
+    g_assert(0 == ibus_engine_plugin_load_lua_script_cached
+             (plugin, LUASCRIPTDIR G_DIR_SEPARATOR_S "test.lua", cachename));
+    g_assert(g_file_test(cachename, G_FILE_TEST_IS_REGULAR));
+    g_assert(NULL != ibus_engine_plugin_lookup_converter(plugin, "upper_converter"));
+    g_assert(NULL == ibus_engine_plugin_lookup_converter(plugin, "lower_converter"));
+    g_assert(ibus_engine_plugin_match_input(plugin, "echoing", &lua_function_name));
+    g_object_unref(plugin);
+  }
+
+  g_unlink(cachename);
+  g_free(cachename);
+
   printf("done.\n");
   return 0;
 }
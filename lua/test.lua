@@ -35,4 +35,61 @@ end
 
 -- print(ime.join_string({nil, "  "}, ","));
 
+-- the conversions return the input unchanged without the engine.
+assert("简体" == ime.simp_to_trad("简体"))
+assert("abc" == ime.half_to_full("abc"))
+assert(nil == ime.format_chinese_number(123, "traditional"))
+
+function table_lookup(filename)
+  local tab = assert(ime.load_table(filename))
+  assert(0 == #ime.lookup_table(tab, "n"))
+  local values, keys = ime.search_table(tab, "n", 3)
+  return {ime.join_string(ime.lookup_table(tab, "ni"), ","),
+          ime.join_string(values, ","), keys[3]}
+end
+
+function upper_converter(inputs)
+  local outputs = {}
+  for i, v in ipairs(inputs) do
+    outputs[i] = string.upper(v)
+  end
+  return outputs
+end
+
+ime.register_converter("upper_converter", "Upper Case", true)
+
+function echo_trigger(input)
+  return input
+end
+
+ime.register_trigger("echo_trigger", "Echo", {"echo*"}, {"回声"})
+
+function count_command(input)
+  local i = 0
+  return function()
+    i = i + 1
+    if i <= 3 then return tostring(i) end
+    return nil
+  end
+end
+
+ime.register_command("ct", "count_command", "Count")
+ime.register_command("ca", "count_command", "Count Again")
+
+function busy_function(input)
+  while true do end
+end
+
+function async_command(input)
+  return {input, string.upper(input)}
+end
+
+ime.register_command("as", "async_command", "Async", nil, nil, true)
+
+function endless_command(input)
+  while true do end
+end
+
+ime.register_command("ae", "endless_command", "Endless", nil, nil, true)
+
 print("test finished...");
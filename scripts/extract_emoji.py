@@ -95,30 +95,84 @@ def prepare_emojis():
     chs_emojis = sorted(chs_emojis, key=compare)
 
 
-def gen_english_emojis():
+# all strings are interned into one blob, the tables store offsets.
+
+strings_blob = []
+strings_offsets = {}
+strings_length = 0
+
+def intern_string(string):
+    global strings_length
+    if string in strings_offsets:
+        return strings_offsets[string]
+
+    offset = strings_length
+    strings_offsets[string] = offset
+    strings_blob.append(string)
+    strings_length += len(string.encode('utf8')) + 1
+    return offset
+
+def intern_emojis():
+    for match, string in eng_emojis + chs_emojis:
+        intern_string(match)
+        intern_string(string)
+
+def gen_emoji_strings():
     entries = []
-    for match, string in eng_emojis:
-        match = '"{0}"'.format(match)
-        entry = '{0:<10}, "{1}"'.format(match, string)
-        entries.append(entry)
-    return ',\n'.join(entries)
+    for string in strings_blob:
+        entries.append('"{0}\\0"'.format(string))
+    return '\n'.join(entries)
 
-def gen_chinese_emojis():
+def gen_emojis(emojis):
     entries = []
-    for match, string in chs_emojis:
-        match = '"{0}"'.format(match)
-        entry = '{0:<10}, "{1}"'.format(match, string)
+    for match, string in emojis:
+        entry = '{{ {0:>6}, {1:>6} }},   /* {2} */'.format \
+                (strings_offsets[match], strings_offsets[string], match)
         entries.append(entry)
-    return ',\n'.join(entries)
-
+    return '\n'.join(entries)
+
+# keep the same hash function as emoji_hash in PYPEmojiCandidates.cc
+
+def emoji_hash(string):
+    value = 2166136261
+    for byte in string.encode('utf8'):
+        value ^= byte
+        value = (value * 16777619) & 0xffffffff
+    return value
+
+def gen_emoji_hash(emojis):
+    size = 1
+    while size < len(emojis) * 2:
+        size *= 2
+    assert len(emojis) < 65535
+
+    # open addressing with linear probing, store index + 1.
+    slots = [0] * size
+    for index, (match, string) in enumerate(emojis):
+        slot = emoji_hash(match) & (size - 1)
+        while slots[slot] != 0:
+            slot = (slot + 1) & (size - 1)
+        slots[slot] = index + 1
+
+    lines = []
+    for i in range(0, size, 16):
+        lines.append(', '.join(str(slot) for slot in slots[i:i + 16]))
+    return ',\n'.join(lines)
 
 def get_table_content(tablename):
+    # Interned strings
+    if tablename == 'EMOJI_STRINGS':
+        return gen_emoji_strings()
     # English Emojis
     if tablename == 'ENGLISH_EMOJIS':
-        return gen_english_emojis()
+        return gen_emojis(eng_emojis)
+    if tablename == 'ENGLISH_EMOJI_HASH':
+        return gen_emoji_hash(eng_emojis)
     # Chinese Emojis
     if tablename == 'CHINESE_EMOJIS':
-        return gen_chinese_emojis()
+        return gen_emojis(chs_emojis)
+    if tablename == 'CHINESE_EMOJI_HASH':
+        return gen_emoji_hash(chs_emojis)
 
 def expand_file(filename):
     infile = open(filename, "r")
@@ -145,4 +199,5 @@ if __name__ == "__main__":
     #print(args)
 
     prepare_emojis()
+    intern_emojis()
     expand_file(args.infile)
@@ -1,5 +1,8 @@
 # vim:set et sts=4:
 # -*- coding: utf-8 -*-
+#
+# The punctuations are in one string blob with the offset table, so the
+# table has no pointer to relocate when the engine is loaded.
 
 from punct import *
 
@@ -9,24 +12,46 @@ def tocstr(s):
     return '"%s"' % s
 
 def gen_table():
-    array = []
-    i = 0
-    print 'static const gchar * const'
-    print 'puncts[] = {'
+    strings = []
+    offsets = []
+    index = {}
+    offset = 0
     for k, vs in punct_map:
-        k = tocstr(k)
-        vs = map(tocstr, vs)
-        array.append((i, k))
-        line = '    %s, %s, NULL,' % (k, ", ".join(vs))
-        print line.encode("utf8")
-        i += len(vs) + 2
-    print '};'
-    print
-    print 'static const gchar * const * const'
-    print 'punct_table[] = {'
-    for i, k in array:
-        print '    &puncts[%d],    // %s' % (i, k)
-    print '};'
+        index[ord(k or '\0')] = (len(offsets), len(vs))
+        for v in vs:
+            strings.append(v)
+            offsets.append(offset)
+            offset += len(v.encode('utf8')) + 1
+
+    print('static const gchar punct_strings[] =')
+    for s in strings:
+        print(tocstr(s)[:-1] + '\\0"')
+    print(';')
+    print()
+    print('/* offsets of the punctuations in punct_strings. */')
+    print('static const guint16 punct_offsets[] = {')
+    for i in range(0, len(offsets), 8):
+        print('    %s,' % ', '.join(str(o) for o in offsets[i:i + 8]))
+    print('};')
+    print()
+    print('static inline const gchar *')
+    print('punct_string (guint i)')
+    print('{')
+    print('    return punct_strings + punct_offsets[i];')
+    print('}')
+    print()
+    # the direct index from the ascii key to the candidates in punct_offsets.
+    print('static const struct {')
+    print('    guint16 begin;')
+    print('    guint16 size;')
+    print('} punct_index[128] = {')
+    for c in range(128):
+        if c in index:
+            i, n = index[c]
+            print('    { %d, %d },    // %s' % (i, n, tocstr(chr(c)) if c else '""'))
+        else:
+            print('    { 0, 0 },')
+    print('};')
 
 if __name__ == "__main__":
     gen_table()
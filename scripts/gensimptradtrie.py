@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Generate the trie of simp_to_trad table for longest match conversion.
+#
+# The nodes are in breadth first order, the children of a node are
+# continuous and sorted by character, node 0 is the root. trad is the
+# index of simp_to_trad table, or -1 when the node is not a phrase.
+
+import re
+import sys
+
+# the strings of the table are the simp and trad phrases in turn.
+def read_table(filename):
+    pattern = re.compile(r'^"([^"]*)\\0"$')
+    strings = []
+    with open(filename, encoding="utf8") as f:
+        for line in f:
+            m = pattern.match(line)
+            if m:
+                strings.append(m.group(1))
+    return strings[0::2]
+
+def build_trie(records):
+    # node: [ch, children dict, trad]
+    root = [0, {}, -1]
+    for index, simp in enumerate(records):
+        node = root
+        for c in simp:
+            node = node[1].setdefault(c, [ord(c), {}, -1])
+        node[2] = index
+    return root
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: %s PYSimpTradConverterTable.h" % sys.argv[0])
+        sys.exit(1)
+
+    root = build_trie(read_table(sys.argv[1]))
+
+    nodes = [root]
+    i = 0
+    lines = []
+    while i < len(nodes):
+        node = nodes[i]
+        children = [node[1][c] for c in sorted(node[1])]
+        first_child = len(nodes) if children else 0
+        comment = chr(node[0]) if node[0] else "root"
+        lines.append('    { 0x%x, %d, %d, %d },   // %s' %
+                     (node[0], first_child, len(children), node[2], comment))
+        nodes.extend(children)
+        i += 1
+
+    print("static const struct {")
+    print("    gunichar ch;")
+    print("    guint32 first_child;")
+    print("    guint32 n_children;")
+    print("    gint32 trad;")
+    print("} simp_to_trad_trie[] = {")
+    for line in lines:
+        print(line)
+    print("};")
+
+if __name__ == "__main__":
+    main()
@@ -53,17 +53,33 @@ def get_records():
     maxlen = max([len(k) for (k, v) in records])
     for i in range(1,  maxlen - 1):
         records = filter_more(records, i)
-    records = [(k.encode("utf8"), v.encode("utf8")) for (k, v) in records]
-    records.sort()
+    records.sort(key=lambda r: (r[0].encode("utf8"), r[1].encode("utf8")))
     return maxlen, records
 
-def main():
-    print("static const gchar *simp_to_trad[][2] = {")
-    maxlen, records = get_records()
+# the phrases are in one string blob with the offset table,
+# so the table has no pointer to relocate when the engine is loaded.
+def print_table(maxlen, records):
+    print("static const gchar simp_to_trad_strings[] =")
+    offsets = []
+    offset = 0
     for s, ts in records:
-        print('    { "%s", "%s" },' % (s, ts))
+        print('"%s\\0"' % s)
+        print('"%s\\0"' % ts)
+        offsets.append((offset, offset + len(s.encode("utf8")) + 1))
+        offset += len(s.encode("utf8")) + len(ts.encode("utf8")) + 2
+    print(";")
+    print()
+    print("/* offsets of the simp and trad phrases in simp_to_trad_strings,")
+    print("   sorted by the simp phrase. */")
+    print("static const guint32 simp_to_trad[][2] = {")
+    for s, t in offsets:
+        print("    { %d, %d }," % (s, t))
     print("};")
     print('#define SIMP_TO_TRAD_MAX_LEN (%d)' % maxlen)
 
+def main():
+    maxlen, records = get_records()
+    print_table(maxlen, records)
+
 if __name__ == "__main__":
     main()
@@ -438,6 +438,7 @@ class PreferencesDialog:
         filter_text = Gtk.FileFilter()
         filter_text.set_name("Text files")
         filter_text.add_mime_type("text/plain")
+        filter_text.add_mime_type("application/gzip")
         dialog.add_filter(filter_text)
 
         response = dialog.run()
@@ -457,6 +458,7 @@ class PreferencesDialog:
         filter_text = Gtk.FileFilter()
         filter_text.set_name("Text files")
         filter_text.add_mime_type("text/plain")
+        filter_text.add_mime_type("application/gzip")
         dialog.add_filter(filter_text)
 
         response = dialog.run()
@@ -0,0 +1,668 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Replay the recorded key streams through the editors without ibus-daemon.
+ *
+ * Each line of the corpus is one key stream, every character is sent as
+ * its keysym, and the named keys are written as "<space>", "<Return>",
+ * "<BackSpace>" and so on. The editor is reset after each line.
+ *
+ * The soak mode replays the synthetic key streams instead, the streams
+ * commit the candidates to train the user phrases and the english
+ * words, the memory and the latency are sampled into a report.
+ *
+ * The trace mode replays the keys.trace recorded by the engine with
+ * --record-keys, the key classes are sent as the representative keys
+ * and the main loop runs in the recorded pauses.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+#include <ibus.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <new>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include "PYConfig.h"
+#include "PYPConfig.h"
+#include "PYLibPinyin.h"
+#include "PYText.h"
+#include "PYLookupTable.h"
+#include "PYPinyinProperties.h"
+#include "PYPFullPinyinEditor.h"
+#include "PYPDoublePinyinEditor.h"
+#include "PYPBopomofoEditor.h"
+#include "PYStats.h"
+#include "PYKeyRecorder.h"
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+#include "PYEnglishEditor.h"
+#endif
+
+using namespace PY;
+
+/* options */
+static gchar *editor_name = NULL;
+static gint repeat = 1;
+static gint64 soak = 0;
+static gint sample = 100000;
+static gint seed = 1;
+static gchar *report_name = NULL;
+static gchar *trace_name = NULL;
+
+static const GOptionEntry entries[] =
+{
+    { "editor", 'e', 0, G_OPTION_ARG_STRING, &editor_name,
+        "full, double or bopomofo", "EDITOR" },
+    { "repeat", 'r', 0, G_OPTION_ARG_INT, &repeat,
+        "replay the corpus N times", "N" },
+    { "soak", 's', 0, G_OPTION_ARG_INT64, &soak,
+        "replay N synthetic keys instead", "N" },
+    { "sample", 0, 0, G_OPTION_ARG_INT, &sample,
+        "sample the soak every N keys", "N" },
+    { "seed", 0, 0, G_OPTION_ARG_INT, &seed,
+        "the seed of the synthetic keys", "N" },
+    { "report", 0, 0, G_OPTION_ARG_FILENAME, &report_name,
+        "write the soak samples to FILE", "FILE" },
+    { "trace", 't', 0, G_OPTION_ARG_FILENAME, &trace_name,
+        "replay the recorded key trace FILE instead", "FILE" },
+    { NULL },
+};
+
+/* the stub of ibus engine, only counts the updates. */
+class CountingSink : public EditorSink {
+public:
+    CountingSink (void) : m_commits (0), m_updates (0) { }
+
+    guint commits (void) const { return m_commits; }
+    guint updates (void) const { return m_updates; }
+
+    void commitText (Text & text) { m_commits ++; }
+
+    void updatePreeditText (Text & text, guint cursor, gboolean visible)
+    { m_updates ++; }
+    void showPreeditText (void) { }
+    void hidePreeditText (void) { }
+
+    void updateAuxiliaryText (Text & text, gboolean visible)
+    { m_updates ++; }
+    void showAuxiliaryText (void) { }
+    void hideAuxiliaryText (void) { }
+
+    void updateLookupTable (LookupTable & table, gboolean visible)
+    { m_updates ++; }
+    void updateLookupTableFast (LookupTable & table, gboolean visible)
+    { m_updates ++; }
+    void showLookupTable (void) { }
+    void hideLookupTable (void) { }
+
+private:
+    guint m_commits;
+    guint m_updates;
+};
+
+/* parse one line of the corpus into keysyms. */
+static gboolean
+parse_keys (const gchar *line, std::vector<guint> & keys)
+{
+    const gchar *p = line;
+
+    while (*p) {
+        if (*p == '<') {
+            const gchar *end = strchr (p, '>');
+            if (end == NULL || end == p + 1) {
+                g_warning ("bad key name in line: %s", line);
+                return FALSE;
+            }
+
+            gchar *name = g_strndup (p + 1, end - p - 1);
+            guint keyval = ibus_keyval_from_name (name);
+            if (keyval == IBUS_KEY_VoidSymbol) {
+                g_warning ("unknown key name: %s", name);
+                g_free (name);
+                return FALSE;
+            }
+            g_free (name);
+
+            keys.push_back (keyval);
+            p = end + 1;
+            continue;
+        }
+
+        gunichar ch = g_utf8_get_char (p);
+        keys.push_back (ibus_unicode_to_keyval (ch));
+        p = g_utf8_next_char (p);
+    }
+
+    return TRUE;
+}
+
+static gboolean
+load_corpus (const gchar *filename, std::vector<std::vector<guint> > & corpus)
+{
+    gchar *contents = NULL;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (filename, &contents, NULL, &error)) {
+        g_warning ("can not read %s: %s", filename, error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    gboolean retval = TRUE;
+    for (gchar **line = lines; *line; line++) {
+        if (**line == '\0')
+            continue;
+
+        std::vector<guint> keys;
+        if (!parse_keys (*line, keys)) {
+            retval = FALSE;
+            break;
+        }
+        corpus.push_back (keys);
+    }
+
+    g_strfreev (lines);
+    return retval;
+}
+
+static gint64
+percentile (const std::vector<gint64> & latencies, guint percent)
+{
+    if (latencies.empty ())
+        return 0;
+    gsize index = (latencies.size () - 1) * percent / 100;
+    return latencies[index];
+}
+
+/* count the allocations of the C++ objects, such as the strings. */
+static std::atomic<guint64> allocations (0);
+
+void *
+operator new (size_t size)
+{
+    allocations.fetch_add (1, std::memory_order_relaxed);
+    void *p = malloc (size ? size : 1);
+    if (p == NULL)
+        throw std::bad_alloc ();
+    return p;
+}
+
+void
+operator delete (void *p) noexcept
+{
+    free (p);
+}
+
+static const gchar * const soak_syllables[] = {
+    "wo", "ni", "ta", "men", "de", "shi", "zai", "you", "le", "bu",
+    "zhong", "guo", "ren", "min", "da", "xue", "sheng", "huo", "gong", "zuo",
+    "peng", "jia", "ting", "hao", "kan", "shu", "dian", "nao", "shou", "ji",
+    "tian", "qi", "jin", "ming", "nian", "xin", "kai", "chu", "fa", "xian",
+};
+
+static const gchar * const soak_words[] = {
+    "hello", "world", "input", "method", "keyboard", "engine", "library",
+    "window", "phrase", "english", "candidate", "dictionary", "session",
+};
+
+/* the pinyin streams commit by space or by a label key, one stream
+   of eight is an english word when english input is built. */
+static void
+soak_stream (GRand *rand, gboolean & english, std::vector<guint> & keys)
+{
+    keys.clear ();
+
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+    english = g_rand_int_range (rand, 0, 8) == 0;
+    if (english) {
+        const gchar *word = soak_words[g_rand_int_range
+                                       (rand, 0, G_N_ELEMENTS (soak_words))];
+        keys.push_back ('v');
+        for (const gchar *p = word; *p; p++)
+            keys.push_back (*p);
+        keys.push_back (IBUS_KEY_space);
+        return;
+    }
+#else
+    english = FALSE;
+#endif
+
+    gint n = g_rand_int_range (rand, 1, 5);
+    for (gint i = 0; i < n; i++) {
+        const gchar *syllable = soak_syllables
+            [g_rand_int_range (rand, 0, G_N_ELEMENTS (soak_syllables))];
+        for (const gchar *p = syllable; *p; p++)
+            keys.push_back (*p);
+    }
+
+    if (g_rand_int_range (rand, 0, 4) == 0)
+        keys.push_back ('1' + g_rand_int_range (rand, 0, 5));
+    keys.push_back (IBUS_KEY_space);
+}
+
+/* the resident size in KiB. */
+static guint64
+soak_rss (void)
+{
+    FILE *file = fopen ("/proc/self/status", "r");
+    if (file == NULL)
+        return 0;
+
+    char line[128];
+    guint64 rss = 0;
+    while (fgets (line, sizeof (line), file)) {
+        if (strncmp (line, "VmRSS:", 6) == 0)
+            rss = g_ascii_strtoull (line + 6, NULL, 10);
+    }
+    fclose (file);
+    return rss;
+}
+
+static guint64
+soak_heap (void)
+{
+#if defined (__GLIBC__) && __GLIBC_PREREQ (2, 33)
+    struct mallinfo2 info = mallinfo2 ();
+    return info.uordblks / 1024;
+#else
+    return 0;
+#endif
+}
+
+/* the columns of the soak report, the subsystems are the stats pairs
+   of the calls and the time, reported as the mean of the interval. */
+static const struct {
+    const gchar *name;
+    StatsCounter calls;
+} soak_subsystems[] = {
+    { "english_db_us", STATS_ENGLISH_QUERIES },
+    { "stroke_db_us", STATS_STROKE_QUERIES },
+    { "save_user_db_us", STATS_SAVES },
+    { "lua_us", STATS_LUA_CALLS },
+};
+
+enum {
+    SOAK_RSS = 0,
+    SOAK_HEAP,
+    SOAK_ALLOCATIONS,
+    SOAK_P99,
+    SOAK_SUBSYSTEMS,
+    SOAK_COLUMNS = SOAK_SUBSYSTEMS + G_N_ELEMENTS (soak_subsystems)
+};
+
+static const gchar * const soak_column_names[SOAK_SUBSYSTEMS] = {
+    "rss_kib", "heap_kib", "allocations", "p99_us",
+};
+
+/* the least squares slope of the column per million keys. */
+static gdouble
+soak_slope (const std::vector<gdouble> & keys,
+            const std::vector<gdouble> & values)
+{
+    gsize n = keys.size ();
+    if (n < 2)
+        return 0;
+
+    gdouble sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (gsize i = 0; i < n; i++) {
+        gdouble x = keys[i] / 1000000.0;
+        sx += x;
+        sy += values[i];
+        sxx += x * x;
+        sxy += x * values[i];
+    }
+
+    gdouble d = n * sxx - sx * sx;
+    return d != 0 ? (n * sxy - sx * sy) / d : 0;
+}
+
+static void
+run_soak (Editor *editor, Editor *english_editor, FILE *report)
+{
+    GRand *rand = g_rand_new_with_seed (seed);
+    std::vector<guint> keys;
+    std::vector<gint64> latencies;
+    std::vector<gdouble> sampled_keys;
+    std::vector<gdouble> columns[SOAK_COLUMNS];
+    guint64 last_calls[G_N_ELEMENTS (soak_subsystems)] = { 0 };
+    guint64 last_time[G_N_ELEMENTS (soak_subsystems)] = { 0 };
+    guint64 last_allocations = allocations.load ();
+    gint64 start = g_get_monotonic_time ();
+    gint64 count = 0;
+
+    fprintf (report, "keys\tseconds");
+    for (guint i = 0; i < SOAK_SUBSYSTEMS; i++)
+        fprintf (report, "\t%s", soak_column_names[i]);
+    for (guint i = 0; i < G_N_ELEMENTS (soak_subsystems); i++)
+        fprintf (report, "\t%s", soak_subsystems[i].name);
+    fprintf (report, "\n");
+
+    while (count < soak) {
+        gboolean english = FALSE;
+        soak_stream (rand, english, keys);
+        Editor *target = english && english_editor ? english_editor : editor;
+
+        for (gsize j = 0; j < keys.size (); j++) {
+            gint64 begin = g_get_monotonic_time ();
+            target->processKeyEvent (keys[j], 0, 0);
+            target->processKeyEvent (keys[j], 0, IBUS_RELEASE_MASK);
+            latencies.push_back (g_get_monotonic_time () - begin);
+            count ++;
+        }
+        target->reset ();
+
+        /* run the idle trainings and the saves as the main loop does. */
+        while (g_main_context_iteration (NULL, FALSE));
+
+        if (latencies.size () < (gsize) sample && count < soak)
+            continue;
+
+        std::sort (latencies.begin (), latencies.end ());
+        guint64 current = allocations.load ();
+        gdouble values[SOAK_COLUMNS];
+        values[SOAK_RSS] = soak_rss ();
+        values[SOAK_HEAP] = soak_heap ();
+        values[SOAK_ALLOCATIONS] = current - last_allocations;
+        values[SOAK_P99] = percentile (latencies, 99);
+        last_allocations = current;
+        latencies.clear ();
+
+        for (guint i = 0; i < G_N_ELEMENTS (soak_subsystems); i++) {
+            StatsCounter calls = soak_subsystems[i].calls;
+            guint64 n = Stats::get (calls) - last_calls[i];
+            guint64 time = Stats::get ((StatsCounter) (calls + 1)) - last_time[i];
+            values[SOAK_SUBSYSTEMS + i] = n ? (gdouble) time / n : 0;
+            last_calls[i] += n;
+            last_time[i] += time;
+        }
+
+        fprintf (report, "%" G_GINT64_FORMAT "\t%.1f", count,
+                 (g_get_monotonic_time () - start) / 1000000.0);
+        for (guint i = 0; i < SOAK_COLUMNS; i++) {
+            fprintf (report, "\t%.1f", values[i]);
+            columns[i].push_back (values[i]);
+        }
+        fprintf (report, "\n");
+        fflush (report);
+        sampled_keys.push_back (count);
+    }
+
+    /* the growth of each column per million keys. */
+    for (guint i = 0; i < SOAK_COLUMNS; i++) {
+        const gchar *name = i < SOAK_SUBSYSTEMS ? soak_column_names[i] :
+            soak_subsystems[i - SOAK_SUBSYSTEMS].name;
+        fprintf (report, "# slope\t%s\t%.3f\n", name,
+                 soak_slope (sampled_keys, columns[i]));
+    }
+
+    g_rand_free (rand);
+}
+
+/* the pauses longer than 100ms run the main loop, where the idle
+   trainings and saves of the engine run in the real sessions. */
+#define TRACE_IDLE_INTERVAL (100 * 1000)
+
+static const gchar * const trace_class_names[KEY_CLASS_LAST] = {
+    "letter", "digit", "punct", "edit", "page", "select", "other",
+};
+
+/* the representative key of the recorded key, the letters of the
+   traces without the letters are taken from the synthetic syllables. */
+static guint
+trace_keyval (const KeyRecord & record, GRand *rand, const gchar *& letters)
+{
+    switch (record.key_class) {
+    case KEY_CLASS_LETTER:
+        if (record.letter)
+            return record.letter;
+        if (*letters == '\0')
+            letters = soak_syllables[g_rand_int_range
+                                     (rand, 0, G_N_ELEMENTS (soak_syllables))];
+        return *letters++;
+    case KEY_CLASS_DIGIT:
+        return IBUS_KEY_1;
+    case KEY_CLASS_PUNCT:
+        return IBUS_KEY_comma;
+    case KEY_CLASS_EDIT:
+        return IBUS_KEY_BackSpace;
+    case KEY_CLASS_PAGE:
+        return IBUS_KEY_Page_Down;
+    case KEY_CLASS_SELECT:
+        return IBUS_KEY_space;
+    }
+    return IBUS_KEY_VoidSymbol;
+}
+
+static void
+run_trace (Editor *editor, Editor *english_editor,
+           const std::vector<KeyRecord> & records)
+{
+    GRand *rand = g_rand_new_with_seed (seed);
+    const gchar *letters = "";
+    std::vector<gint64> recorded;
+    std::vector<gint64> replayed;
+    guint classes[KEY_CLASS_LAST] = { 0 };
+    guint skipped = 0;
+    guint pauses = 0;
+
+    for (gsize i = 0; i < records.size (); i++) {
+        const KeyRecord & record = records[i];
+        guint before = record.modes >> 4;
+        guint after = record.modes & 0xf;
+        guint keyval = trace_keyval (record, rand, letters);
+
+        /* only the pinyin and the english modes are replayed. */
+        Editor *target = NULL;
+        if (KEY_MODE_ENGLISH == before || KEY_MODE_ENGLISH == after) {
+            target = english_editor;
+            if (KEY_MODE_ENGLISH != before)
+                keyval = IBUS_KEY_v;
+        } else if ((KEY_MODE_INIT == before || KEY_MODE_SUGGESTION == before) &&
+                   (KEY_MODE_INIT == after || KEY_MODE_SUGGESTION == after)) {
+            target = editor;
+        }
+
+        if (target == NULL || keyval == IBUS_KEY_VoidSymbol) {
+            skipped ++;
+            continue;
+        }
+
+        if (record.interval > TRACE_IDLE_INTERVAL) {
+            while (g_main_context_iteration (NULL, FALSE));
+            pauses ++;
+        }
+
+        gint64 begin = g_get_monotonic_time ();
+        target->processKeyEvent (keyval, 0, 0);
+        target->processKeyEvent (keyval, 0, IBUS_RELEASE_MASK);
+        replayed.push_back (g_get_monotonic_time () - begin);
+        recorded.push_back (record.latency);
+        classes[record.key_class] ++;
+
+        if (target == english_editor && KEY_MODE_ENGLISH != after)
+            english_editor->reset ();
+    }
+
+    std::sort (recorded.begin (), recorded.end ());
+    std::sort (replayed.begin (), replayed.end ());
+
+    g_print ("keys: %" G_GSIZE_FORMAT " skipped: %u pauses: %u\n",
+             replayed.size (), skipped, pauses);
+    g_print ("classes:");
+    for (guint i = 0; i < KEY_CLASS_LAST; i++) {
+        g_print (" %s=%.1f%%", trace_class_names[i], replayed.empty () ?
+                 0.0 : classes[i] * 100.0 / replayed.size ());
+    }
+    g_print ("\n");
+    g_print ("recorded: p50=%" G_GINT64_FORMAT "us p99=%" G_GINT64_FORMAT "us\n",
+             percentile (recorded, 50), percentile (recorded, 99));
+    g_print ("replayed: p50=%" G_GINT64_FORMAT "us p99=%" G_GINT64_FORMAT "us\n",
+             percentile (replayed, 50), percentile (replayed, 99));
+
+    g_rand_free (rand);
+}
+
+int
+main (gint argc, gchar **argv)
+{
+    GError *error = NULL;
+    GOptionContext *context;
+
+    setlocale (LC_ALL, "");
+
+    context = g_option_context_new ("CORPUS... - replay key streams through the editors");
+    g_option_context_add_main_entries (context, entries, "ibus-libpinyin");
+
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_print ("Option parsing failed: %s\n", error->message);
+        exit (EXIT_FAILURE);
+    }
+    g_option_context_free (context);
+
+    if (argc < 2 && soak <= 0 && trace_name == NULL) {
+        g_print ("Usage: %s [--editor=full|double|bopomofo] CORPUS...\n"
+                 "       %s [--editor=full|double] --soak=N [--report=FILE]\n"
+                 "       %s [--editor=full|double|bopomofo] --trace=FILE\n",
+                 argv[0], argv[0], argv[0]);
+        exit (EXIT_FAILURE);
+    }
+
+    std::vector<KeyRecord> records;
+    if (trace_name && !KeyRecorder::load (trace_name, records))
+        exit (EXIT_FAILURE);
+
+    std::vector<std::vector<guint> > corpus;
+    for (gint i = 1; i < argc; i++) {
+        if (!load_corpus (argv[i], corpus))
+            exit (EXIT_FAILURE);
+    }
+
+    ibus_init ();
+
+    LibPinyinBackEnd::init ();
+    PinyinConfig::init ();
+    BopomofoConfig::init ();
+
+    std::string name = editor_name ? editor_name : "full";
+    Config *config = NULL;
+    if (name == "bopomofo")
+        config = &BopomofoConfig::instance ();
+    else
+        config = &PinyinConfig::instance ();
+
+    PinyinProperties props (*config);
+    EditorPtr editor;
+    if (name == "full")
+        editor.reset (new FullPinyinEditor (props, *config));
+    else if (name == "double")
+        editor.reset (new DoublePinyinEditor (props, *config));
+    else if (name == "bopomofo")
+        editor.reset (new BopomofoEditor (props, *config));
+    else {
+        g_print ("Unknown editor: %s\n", name.c_str ());
+        exit (EXIT_FAILURE);
+    }
+
+    CountingSink sink;
+    editor->setSink (&sink);
+
+    if (soak > 0 || trace_name) {
+        EditorPtr english_editor;
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+        if (name != "bopomofo") {
+            english_editor.reset (new EnglishEditor (props, *config));
+            english_editor->setSink (&sink);
+        }
+#endif
+        if (trace_name) {
+            run_trace (editor.get (), english_editor.get (), records);
+        } else {
+            FILE *report = stdout;
+            if (report_name && (report = fopen (report_name, "w")) == NULL) {
+                g_print ("can not write %s\n", report_name);
+                exit (EXIT_FAILURE);
+            }
+
+            run_soak (editor.get (), english_editor.get (), report);
+            if (report != stdout)
+                fclose (report);
+        }
+
+        english_editor.reset ();
+        editor.reset ();
+        LibPinyinBackEnd::finalize ();
+        g_free (editor_name);
+        g_free (report_name);
+        g_free (trace_name);
+        return 0;
+    }
+
+    std::vector<gint64> latencies;
+    gint64 start = g_get_monotonic_time ();
+
+    for (gint round = 0; round < repeat; round++) {
+        for (gsize i = 0; i < corpus.size (); i++) {
+            const std::vector<guint> & keys = corpus[i];
+            for (gsize j = 0; j < keys.size (); j++) {
+                gint64 begin = g_get_monotonic_time ();
+                editor->processKeyEvent (keys[j], 0, 0);
+                editor->processKeyEvent (keys[j], 0, IBUS_RELEASE_MASK);
+                latencies.push_back (g_get_monotonic_time () - begin);
+            }
+            editor->reset ();
+        }
+    }
+
+    gint64 elapsed = g_get_monotonic_time () - start;
+    std::sort (latencies.begin (), latencies.end ());
+
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+
+    g_print ("editor: %s\n", name.c_str ());
+    g_print ("keys: %" G_GSIZE_FORMAT " commits: %u updates: %u\n",
+             latencies.size (), sink.commits (), sink.updates ());
+    g_print ("keys/sec: %.1f\n",
+             elapsed ? latencies.size () * 1000000.0 / elapsed : 0.0);
+    g_print ("latency: p50=%" G_GINT64_FORMAT "us p90=%" G_GINT64_FORMAT "us"
+             " p99=%" G_GINT64_FORMAT "us max=%" G_GINT64_FORMAT "us\n",
+             percentile (latencies, 50), percentile (latencies, 90),
+             percentile (latencies, 99), percentile (latencies, 100));
+    g_print ("peak rss: %ld KiB\n", usage.ru_maxrss);
+
+    editor.reset ();
+    LibPinyinBackEnd::finalize ();
+    g_free (editor_name);
+    g_free (report_name);
+    g_free (trace_name);
+    return 0;
+}
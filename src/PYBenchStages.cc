@@ -0,0 +1,626 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Measure the candidate stages and the converters one by one.
+ *
+ * Each line of the candidate corpus is the pinyin and the candidates
+ * guessed by libpinyin, separated by tabs. The corpus is recorded from
+ * the key streams of bench-engine with "--record=FILE", the recorded
+ * candidates are replayed through the stages, only libpinyin and the
+ * suggestion stages guess on the instance again.
+ *
+ * The stages run "--repeat" times for each line, so the conversion
+ * caches are warm after the first round, the converters are measured
+ * without the caches.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+#include <ibus.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include "PYConfig.h"
+#include "PYPConfig.h"
+#include "PYLibPinyin.h"
+#include "PYString.h"
+#include "PYPinyinProperties.h"
+#include "PYSimpTradConverter.h"
+#include "PYHalfFullConverter.h"
+#include "PYChineseNumber.h"
+#include "PYPunctTable.h"
+#include "PYPFullPinyinEditor.h"
+#include "PYPSuggestionEditor.h"
+#include "PYPLibPinyinCandidates.h"
+#include "PYPEmojiCandidates.h"
+#include "PYPTradCandidates.h"
+#include "PYPSuggestionCandidates.h"
+#ifdef IBUS_BUILD_LUA_EXTENSION
+#include "PYPLuaTriggerCandidates.h"
+#include "PYPLuaConverterCandidates.h"
+#endif
+
+using namespace PY;
+
+/* options */
+static gchar *record_file = NULL;
+static gchar *stage_name = NULL;
+static gint repeat = 100;
+#ifdef IBUS_BUILD_LUA_EXTENSION
+static gchar **lua_scripts = NULL;
+static gchar *lua_converter = NULL;
+#endif
+
+static const GOptionEntry entries[] =
+{
+    { "record", 0, 0, G_OPTION_ARG_FILENAME, &record_file,
+        "record the candidates of the key streams to FILE", "FILE" },
+    { "stage", 's', 0, G_OPTION_ARG_STRING, &stage_name,
+        "only run the named stage", "STAGE" },
+    { "repeat", 'r', 0, G_OPTION_ARG_INT, &repeat,
+        "run each line N times", "N" },
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    { "lua-script", 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &lua_scripts,
+        "load the lua triggers and converters from FILE", "FILE" },
+    { "lua-converter", 0, 0, G_OPTION_ARG_STRING, &lua_converter,
+        "the lua converter to measure", "NAME" },
+#endif
+    { NULL },
+};
+
+/* count the allocations of the measured thread,
+   the mallocs of glibc are wrapped in the program. */
+static __thread gboolean meter_counting = FALSE;
+static __thread guint64 meter_allocations = 0;
+static __thread guint64 meter_bytes = 0;
+
+#ifdef __GLIBC__
+extern "C" {
+
+void *__libc_malloc (size_t size);
+void *__libc_calloc (size_t nmemb, size_t size);
+void *__libc_realloc (void *ptr, size_t size);
+
+void *
+malloc (size_t size)
+{
+    if (G_UNLIKELY (meter_counting)) {
+        meter_allocations ++;
+        meter_bytes += size;
+    }
+    return __libc_malloc (size);
+}
+
+void *
+calloc (size_t nmemb, size_t size)
+{
+    if (G_UNLIKELY (meter_counting)) {
+        meter_allocations ++;
+        meter_bytes += nmemb * size;
+    }
+    return __libc_calloc (nmemb, size);
+}
+
+void *
+realloc (void *ptr, size_t size)
+{
+    if (G_UNLIKELY (meter_counting)) {
+        meter_allocations ++;
+        meter_bytes += size;
+    }
+    return __libc_realloc (ptr, size);
+}
+
+}
+#endif
+
+/* the accumulated cost of the operations of one stage. */
+class Meter {
+public:
+    Meter (const gchar *name)
+        : m_name (name), m_ops (0), m_nanoseconds (0),
+          m_allocations (0), m_bytes (0), m_start (0) { }
+
+    void start (void)
+    {
+        meter_allocations = 0;
+        meter_bytes = 0;
+        meter_counting = TRUE;
+        m_start = now ();
+    }
+
+    void stop (void)
+    {
+        m_nanoseconds += now () - m_start;
+        meter_counting = FALSE;
+        m_allocations += meter_allocations;
+        m_bytes += meter_bytes;
+        m_ops ++;
+    }
+
+    void report (void) const
+    {
+        if (m_ops == 0) {
+            g_print ("%-24s skipped\n", m_name);
+            return;
+        }
+
+        g_print ("%-24s %10.1f ns/op %8.2f allocs/op %10.1f bytes/op"
+                 " (%" G_GUINT64_FORMAT " ops)\n", m_name,
+                 (gdouble) m_nanoseconds / m_ops,
+                 (gdouble) m_allocations / m_ops,
+                 (gdouble) m_bytes / m_ops, m_ops);
+    }
+
+private:
+    static guint64 now (void)
+    {
+        struct timespec ts;
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+        return (guint64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+    }
+
+    const gchar *m_name;
+    guint64 m_ops;
+    guint64 m_nanoseconds;
+    guint64 m_allocations;
+    guint64 m_bytes;
+    guint64 m_start;
+};
+
+/* one line of the candidate corpus. */
+struct Recorded {
+    std::string pinyin;
+    std::vector<EnhancedCandidate> candidates;
+};
+
+typedef std::vector<Recorded> Corpus;
+
+/* the state shared by the stage benchmarks. */
+struct BenchContext {
+    Config *config;
+    FullPinyinEditor *editor;
+    SuggestionEditor *suggestion;
+    Corpus corpus;
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    IBusEnginePlugin *plugin;
+#endif
+};
+
+/* the key events are sent through the public interface of Editor. */
+static void
+type_pinyin (Editor *editor, const std::string & pinyin)
+{
+    editor->reset ();
+    for (size_t i = 0; i < pinyin.length (); i++) {
+        editor->processKeyEvent (pinyin[i], 0, 0);
+        editor->processKeyEvent (pinyin[i], 0, IBUS_RELEASE_MASK);
+    }
+}
+
+/* load the tab separated candidate corpus. */
+static gboolean
+load_corpus (const gchar *filename, Corpus & corpus)
+{
+    gchar *contents = NULL;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (filename, &contents, NULL, &error)) {
+        g_warning ("can not read %s: %s", filename, error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    for (gchar **line = lines; *line; line++) {
+        if (**line == '\0')
+            continue;
+
+        gchar **fields = g_strsplit (*line, "\t", -1);
+        Recorded recorded;
+        recorded.pinyin = fields[0];
+        for (guint i = 1; fields[i]; i++) {
+            EnhancedCandidate enhanced;
+            enhanced.m_candidate_type = CANDIDATE_NORMAL;
+            enhanced.m_candidate_id = i - 1;
+            enhanced.m_display_string = fields[i];
+            recorded.candidates.push_back (enhanced);
+        }
+        g_strfreev (fields);
+
+        corpus.push_back (recorded);
+    }
+
+    g_strfreev (lines);
+    return TRUE;
+}
+
+/* the pinyin of the key streams are the runs of the letters. */
+static gboolean
+record_corpus (BenchContext & context, const gchar *keys_file,
+               FILE *output)
+{
+    gchar *contents = NULL;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (keys_file, &contents, NULL, &error)) {
+        g_warning ("can not read %s: %s", keys_file, error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    LibPinyinCandidates stage (context.editor);
+    guint page_size = context.config->pageSize ();
+
+    const gchar *p = contents;
+    while (*p) {
+        if (!g_ascii_islower (*p)) {
+            p++;
+            continue;
+        }
+
+        const gchar *end = p;
+        while (g_ascii_islower (*end))
+            end++;
+        std::string pinyin (p, end - p);
+        p = end;
+
+        type_pinyin (context.editor, pinyin);
+        std::vector<EnhancedCandidate> candidates;
+        stage.processCandidates (candidates, 0, page_size + 1);
+
+        fputs (pinyin.c_str (), output);
+        for (size_t i = 0; i < candidates.size (); i++) {
+            fputc ('\t', output);
+            fputs (candidates[i].m_display_string.c_str (), output);
+        }
+        fputc ('\n', output);
+    }
+
+    g_free (contents);
+    return TRUE;
+}
+
+static void
+bench_libpinyin (BenchContext & context, Meter & meter)
+{
+    LibPinyinCandidates stage (context.editor);
+    guint page_size = context.config->pageSize ();
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        type_pinyin (context.editor, context.corpus[i].pinyin);
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> candidates;
+            meter.start ();
+            stage.processCandidates (candidates, 0, page_size + 1);
+            meter.stop ();
+        }
+    }
+}
+
+static void
+bench_emoji (BenchContext & context, Meter & meter)
+{
+    EmojiCandidates stage (context.editor);
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        type_pinyin (context.editor, recorded.pinyin);
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> injected;
+            meter.start ();
+            stage.processCandidates (recorded.candidates, injected);
+            meter.stop ();
+        }
+    }
+}
+
+static void
+bench_traditional (BenchContext & context, Meter & meter)
+{
+    TraditionalCandidates stage (context.editor, *context.config);
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> candidates = recorded.candidates;
+            meter.start ();
+            stage.processCandidates (candidates);
+            meter.stop ();
+        }
+    }
+}
+
+#ifdef IBUS_BUILD_LUA_EXTENSION
+static void
+bench_lua_trigger (BenchContext & context, Meter & meter)
+{
+    LuaTriggerCandidates stage (context.editor);
+    stage.setLuaPlugin (context.plugin);
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        type_pinyin (context.editor, recorded.pinyin);
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> injected;
+            meter.start ();
+            stage.processCandidates (recorded.candidates, injected);
+            meter.stop ();
+        }
+    }
+}
+
+static void
+bench_lua_converter (BenchContext & context, Meter & meter)
+{
+    LuaConverterCandidates stage (context.editor);
+    stage.setLuaPlugin (context.plugin);
+    if (lua_converter == NULL || !stage.setConverter (lua_converter))
+        return;
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> candidates = recorded.candidates;
+            meter.start ();
+            stage.processCandidates (candidates);
+            meter.stop ();
+        }
+    }
+}
+#endif
+
+/* predict after the first candidate, as selected by the user. */
+static void
+bench_suggestion (BenchContext & context, Meter & meter)
+{
+    SuggestionCandidates stage (context.suggestion);
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        if (recorded.candidates.empty ())
+            continue;
+
+        const gchar *prefix = recorded.candidates[0].m_display_string.c_str ();
+        for (gint j = 0; j < repeat; j++) {
+            std::vector<EnhancedCandidate> candidates;
+            meter.start ();
+            stage.predict (prefix);
+            stage.processCandidates (candidates);
+            meter.stop ();
+        }
+    }
+}
+
+static void
+bench_simp_trad (BenchContext & context, Meter & meter)
+{
+    SimpTradConverter converter (*context.config);
+    String trad;
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const std::vector<EnhancedCandidate> & candidates =
+            context.corpus[i].candidates;
+        for (size_t k = 0; k < candidates.size (); k++) {
+            const gchar *simp = candidates[k].m_display_string.c_str ();
+            for (gint j = 0; j < repeat; j++) {
+                trad.clear ();
+                meter.start ();
+                converter.simpToTrad (simp, trad);
+                meter.stop ();
+            }
+        }
+    }
+}
+
+/* the full width text is the pinyin and the candidates. */
+static void
+bench_half_full (BenchContext & context, Meter & meter)
+{
+    String full;
+
+    for (size_t i = 0; i < context.corpus.size (); i++) {
+        const Recorded & recorded = context.corpus[i];
+        for (gint j = 0; j < repeat; j++) {
+            full.clear ();
+            meter.start ();
+            HalfFullConverter::convertString (recorded.pinyin.c_str (), full);
+            for (size_t k = 0; k < recorded.candidates.size (); k++)
+                HalfFullConverter::convertString
+                    (recorded.candidates[k].m_display_string.c_str (), full);
+            meter.stop ();
+        }
+    }
+}
+
+/* collect the punctuations of each printable key, as the punct editor. */
+static void
+bench_punct (BenchContext & context, Meter & meter)
+{
+    std::vector<const gchar *> puncts_of_key;
+
+    for (gint j = 0; j < repeat; j++) {
+        for (guint ch = 0x20; ch < G_N_ELEMENTS (punct_index); ch++) {
+            if (punct_index[ch].size == 0)
+                continue;
+
+            puncts_of_key.clear ();
+            meter.start ();
+            for (guint k = 0; k < punct_index[ch].size; k++)
+                puncts_of_key.push_back (punct_string (punct_index[ch].begin + k));
+            meter.stop ();
+        }
+    }
+}
+
+/* the numbers are formatted by all the styles, as the ext editor. */
+static void
+bench_chinese_number (BenchContext & context, Meter & meter)
+{
+    static const gint64 numbers[] = {
+        0, 7, 10, 15, 120, 1001, 10086, 100000, 20181231,
+        1234567890, G_GINT64_CONSTANT (100000000000001), G_MAXINT64,
+    };
+    static const ChineseNumberStyle styles[] = {
+        CHINESE_NUMBER_SIMPLIFIED,
+        CHINESE_NUMBER_TRADITIONAL,
+        CHINESE_NUMBER_SIMPLEST,
+    };
+
+    gchar buffer[CHINESE_NUMBER_BUFFER_SIZE];
+    for (gint j = 0; j < repeat; j++) {
+        for (guint i = 0; i < G_N_ELEMENTS (numbers); i++) {
+            meter.start ();
+            for (guint k = 0; k < G_N_ELEMENTS (styles); k++)
+                ChineseNumber::format (numbers[i], styles[k], buffer);
+            meter.stop ();
+        }
+    }
+}
+
+typedef void (*BenchFunc) (BenchContext & context, Meter & meter);
+
+static const struct {
+    const gchar *name;
+    BenchFunc func;
+} benches[] = {
+    { "LibPinyinCandidates", bench_libpinyin },
+    { "EmojiCandidates", bench_emoji },
+    { "TraditionalCandidates", bench_traditional },
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    { "LuaTriggerCandidates", bench_lua_trigger },
+    { "LuaConverterCandidates", bench_lua_converter },
+#endif
+    { "SuggestionCandidates", bench_suggestion },
+    { "SimpTradConverter", bench_simp_trad },
+    { "HalfFullConverter", bench_half_full },
+    { "PunctTable", bench_punct },
+    { "ChineseNumber", bench_chinese_number },
+};
+
+int
+main (gint argc, gchar **argv)
+{
+    GError *error = NULL;
+    GOptionContext *option_context;
+
+    setlocale (LC_ALL, "");
+
+    option_context = g_option_context_new
+        ("CORPUS... - measure the candidate stages and the converters");
+    g_option_context_add_main_entries (option_context, entries,
+                                       "ibus-libpinyin");
+
+    if (!g_option_context_parse (option_context, &argc, &argv, &error)) {
+        g_print ("Option parsing failed: %s\n", error->message);
+        exit (EXIT_FAILURE);
+    }
+    g_option_context_free (option_context);
+
+    if (argc < 2) {
+        g_print ("Usage: %s [--record=FILE] [--stage=STAGE] CORPUS...\n",
+                 argv[0]);
+        exit (EXIT_FAILURE);
+    }
+
+#ifndef __GLIBC__
+    g_print ("the allocations are only counted with glibc.\n");
+#endif
+
+    ibus_init ();
+
+    LibPinyinBackEnd::init ();
+    PinyinConfig::init ();
+
+    BenchContext context;
+    context.config = &PinyinConfig::instance ();
+
+    /* the editors are freed before the back end. */
+    PinyinProperties props (*context.config);
+    context.editor = new FullPinyinEditor (props, *context.config);
+    context.suggestion = new SuggestionEditor (props, *context.config);
+    context.editor->focusIn ();
+    context.suggestion->focusIn ();
+
+    /* the corpus arguments are the key streams when recording. */
+    if (record_file) {
+        FILE *output = fopen (record_file, "w");
+        if (output == NULL) {
+            g_print ("can not write %s\n", record_file);
+            exit (EXIT_FAILURE);
+        }
+
+        gboolean retval = TRUE;
+        for (gint i = 1; i < argc && retval; i++)
+            retval = record_corpus (context, argv[i], output);
+        fclose (output);
+        if (!retval)
+            exit (EXIT_FAILURE);
+    } else {
+        for (gint i = 1; i < argc; i++) {
+            if (!load_corpus (argv[i], context.corpus))
+                exit (EXIT_FAILURE);
+        }
+    }
+
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    context.plugin = ibus_engine_plugin_new ();
+    for (gchar **script = lua_scripts; script && *script; script++) {
+        if (ibus_engine_plugin_load_lua_script (context.plugin, *script)) {
+            g_print ("can not load %s\n", *script);
+            exit (EXIT_FAILURE);
+        }
+    }
+#endif
+
+    if (!record_file)
+        g_print ("lines: %" G_GSIZE_FORMAT " repeat: %d\n",
+                 context.corpus.size (), repeat);
+
+    for (guint i = 0; i < G_N_ELEMENTS (benches) && !record_file; i++) {
+        if (stage_name && strcmp (stage_name, benches[i].name))
+            continue;
+
+        Meter meter (benches[i].name);
+        benches[i].func (context, meter);
+        meter.report ();
+    }
+
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    g_object_unref (context.plugin);
+    g_strfreev (lua_scripts);
+    g_free (lua_converter);
+#endif
+
+    delete context.editor;
+    delete context.suggestion;
+    LibPinyinBackEnd::finalize ();
+    g_free (record_file);
+    g_free (stage_name);
+    return 0;
+}
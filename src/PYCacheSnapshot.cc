@@ -0,0 +1,201 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYCacheSnapshot.h"
+#include <glib/gstdio.h>
+#include <map>
+
+namespace PY {
+
+#define CACHE_SNAPSHOT_MAGIC   "PYCSNAP"
+/* bumped when the encoding of the values is changed. */
+#define CACHE_SNAPSHOT_VERSION (1)
+
+/* All integers are stored in little endian, the sections follow. */
+struct SnapshotHeader {
+    gchar magic[8];
+    guint32 version;
+    guint32 fingerprint;
+    guint32 n_sections;
+    guint32 length;
+};
+
+gboolean CacheSnapshot::m_loaded = FALSE;
+
+/* constructed by the first snapshotable, as the caches are static. */
+static std::map<std::string, Snapshotable *> &
+snapshotables (void)
+{
+    static std::map<std::string, Snapshotable *> objects;
+    return objects;
+}
+
+Snapshotable::Snapshotable (const char *name)
+    : m_snapshot_name (name)
+{
+    if (m_snapshot_name)
+        snapshotables ()[m_snapshot_name] = this;
+}
+
+Snapshotable::~Snapshotable (void)
+{
+    if (m_snapshot_name)
+        snapshotables ().erase (m_snapshot_name);
+}
+
+static guint32
+snapshot_hash (const std::string & str)
+{
+    guint32 value = 2166136261u;
+    for (size_t i = 0; i < str.size (); ++i) {
+        value ^= (guchar) str[i];
+        value *= 16777619u;
+    }
+    return value;
+}
+
+static gchar *
+snapshot_filename (void)
+{
+    return g_build_filename (g_get_user_cache_dir (), "ibus", "libpinyin",
+                             "cache.snapshot", NULL);
+}
+
+/* each section is the name, the tag, the number of the entries and
+   the size of the entries, the unknown sections are skipped. */
+gboolean
+CacheSnapshot::save (const std::string & fingerprint)
+{
+    if (!m_loaded)
+        return FALSE;
+
+    SnapshotWriter writer;
+    guint sections = 0, saved = 0;
+
+    std::map<std::string, Snapshotable *>::iterator iter;
+    for (iter = snapshotables ().begin ();
+         iter != snapshotables ().end (); ++iter) {
+        SnapshotWriter entries;
+        guint num = iter->second->saveSnapshot (entries);
+        if (0 == num)
+            continue;
+
+        writer.putString (iter->first);
+        writer.putString (iter->second->snapshotTag ());
+        writer.putUInt (num);
+        writer.putUInt (entries.data ().size ());
+        writer.data ().append (entries.data ());
+        sections++;
+        saved += num;
+    }
+
+    SnapshotHeader header;
+    memset (&header, 0, sizeof (header));
+    memcpy (header.magic, CACHE_SNAPSHOT_MAGIC, sizeof (CACHE_SNAPSHOT_MAGIC));
+    header.version = GUINT32_TO_LE (CACHE_SNAPSHOT_VERSION);
+    header.fingerprint = GUINT32_TO_LE (snapshot_hash (fingerprint));
+    header.n_sections = GUINT32_TO_LE (sections);
+    header.length = GUINT32_TO_LE (writer.data ().size ());
+
+    std::string contents ((const gchar *) &header, sizeof (header));
+    contents.append (writer.data ());
+
+    gchar *filename = snapshot_filename ();
+    gchar *dirname = g_path_get_dirname (filename);
+    g_mkdir_with_parents (dirname, 0700);
+    g_free (dirname);
+
+    gboolean retval = g_file_set_contents (filename, contents.c_str (),
+                                           contents.length (), NULL);
+    g_debug ("saved %u cache entries in %u sections to %s.",
+             saved, sections, filename);
+    g_free (filename);
+    return retval;
+}
+
+gboolean
+CacheSnapshot::load (const std::string & fingerprint)
+{
+    if (m_loaded)
+        return FALSE;
+    m_loaded = TRUE;
+
+    gchar *filename = snapshot_filename ();
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, NULL);
+    if (NULL == file) {
+        g_free (filename);
+        return FALSE;
+    }
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize length = g_mapped_file_get_length (file);
+    const SnapshotHeader *header = (const SnapshotHeader *) data;
+    gboolean retval = FALSE;
+    guint restored = 0;
+
+    do {
+        if (length < sizeof (SnapshotHeader))
+            break;
+        if (memcmp (header->magic, CACHE_SNAPSHOT_MAGIC,
+                    sizeof (CACHE_SNAPSHOT_MAGIC)))
+            break;
+        if (GUINT32_FROM_LE (header->version) != CACHE_SNAPSHOT_VERSION)
+            break;
+        if (GUINT32_FROM_LE (header->length) !=
+            length - sizeof (SnapshotHeader))
+            break;
+
+        /* the dictionaries or the config is changed since the save. */
+        retval = TRUE;
+        if (GUINT32_FROM_LE (header->fingerprint) != snapshot_hash (fingerprint))
+            break;
+
+        SnapshotReader reader (data + sizeof (SnapshotHeader), data + length);
+        guint32 sections = GUINT32_FROM_LE (header->n_sections);
+
+        for (guint i = 0; i < sections; i++) {
+            std::string name, tag;
+            guint32 num = 0, size = 0;
+            SnapshotReader entries (NULL, NULL);
+            if (!reader.getString (name) || !reader.getString (tag) ||
+                !reader.getUInt (num) || !reader.getUInt (size) ||
+                !reader.getBlock (size, entries)) {
+                retval = FALSE;
+                break;
+            }
+
+            std::map<std::string, Snapshotable *>::iterator iter =
+                snapshotables ().find (name);
+            if (iter != snapshotables ().end ())
+                restored += iter->second->loadSnapshot (tag, num, entries);
+        }
+    } while (0);
+
+    if (!retval)
+        g_warning ("invalid cache snapshot: %s.\n", filename);
+    else
+        g_debug ("restored %u cache entries from %s.", restored, filename);
+
+    g_mapped_file_unref (file);
+    g_free (filename);
+    return retval;
+}
+
+};
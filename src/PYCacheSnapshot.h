@@ -0,0 +1,166 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_CACHE_SNAPSHOT_H_
+#define __PY_CACHE_SNAPSHOT_H_
+
+#include <glib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace PY {
+
+/* the entries of the caches in the snapshot, little endian integers
+ * and length prefixed strings. */
+class SnapshotWriter {
+public:
+    void putUInt (guint32 value)
+    {
+        value = GUINT32_TO_LE (value);
+        m_data.append ((const gchar *) &value, sizeof (value));
+    }
+
+    void putString (const std::string & str)
+    {
+        putUInt (str.size ());
+        m_data.append (str);
+    }
+
+    std::string & data (void) { return m_data; }
+
+private:
+    std::string m_data;
+};
+
+/* read in the mapped snapshot file, fails at the end of the section. */
+class SnapshotReader {
+public:
+    SnapshotReader (const gchar *begin, const gchar *end)
+        : m_cursor (begin), m_end (end) { }
+
+    gboolean getUInt (guint32 & value)
+    {
+        if (m_end - m_cursor < (gssize) sizeof (value))
+            return FALSE;
+        memcpy (&value, m_cursor, sizeof (value));
+        value = GUINT32_FROM_LE (value);
+        m_cursor += sizeof (value);
+        return TRUE;
+    }
+
+    gboolean getString (std::string & str)
+    {
+        guint32 size = 0;
+        if (!getUInt (size) || (gsize) (m_end - m_cursor) < size)
+            return FALSE;
+        str.assign (m_cursor, size);
+        m_cursor += size;
+        return TRUE;
+    }
+
+    /* the next size bytes are read by the block. */
+    gboolean getBlock (guint32 size, SnapshotReader & block)
+    {
+        if ((gsize) (m_end - m_cursor) < size)
+            return FALSE;
+        block = SnapshotReader (m_cursor, m_cursor + size);
+        m_cursor += size;
+        return TRUE;
+    }
+
+private:
+    const gchar *m_cursor;
+    const gchar *m_end;
+};
+
+/* the values of the snapshot caches. */
+inline void
+snapshot_put (SnapshotWriter & writer, const std::string & value)
+{
+    writer.putString (value);
+}
+
+inline gboolean
+snapshot_get (SnapshotReader & reader, std::string & value)
+{
+    return reader.getString (value);
+}
+
+inline void
+snapshot_put (SnapshotWriter & writer, const std::vector<std::string> & value)
+{
+    writer.putUInt (value.size ());
+    for (guint i = 0; i < value.size (); i++)
+        writer.putString (value[i]);
+}
+
+inline gboolean
+snapshot_get (SnapshotReader & reader, std::vector<std::string> & value)
+{
+    guint32 size = 0;
+    if (!reader.getUInt (size))
+        return FALSE;
+    value.resize (size);
+    for (guint i = 0; i < size; i++) {
+        if (!reader.getString (value[i]))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* The caches saved in the snapshot, registered by the name while they
+ * are alive, the caches without the name are not saved. */
+class Snapshotable {
+public:
+    Snapshotable (const char *name);
+    virtual ~Snapshotable (void);
+
+    const char *snapshotName (void) const { return m_snapshot_name; }
+
+    /* the tag of the entries, and the entries from the most recent. */
+    virtual std::string snapshotTag (void) const = 0;
+    virtual guint saveSnapshot (SnapshotWriter & writer) const = 0;
+
+    /* only restored into the empty cache, returns the restored entries. */
+    virtual guint loadSnapshot (const std::string & tag, guint num,
+                                SnapshotReader & reader) = 0;
+
+private:
+    const char *m_snapshot_name;
+};
+
+/* Save the warm caches across the restarts, in the versioned file
+ * in the user cache directory. The snapshot is dropped when the
+ * fingerprint of the dictionaries and the config is changed. */
+class CacheSnapshot {
+public:
+    /* the snapshot is kept until it is loaded. */
+    static gboolean save (const std::string & fingerprint);
+    /* loaded once, in the main thread. */
+    static gboolean load (const std::string & fingerprint);
+
+private:
+    static gboolean m_loaded;
+};
+
+};
+
+#endif
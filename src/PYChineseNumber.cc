@@ -0,0 +1,132 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYChineseNumber.h"
+#include <string.h>
+
+namespace PY {
+
+static const char * numbers [2][10] = {
+    {"零", "壹", "贰", "叁", "肆", "伍", "陆", "柒", "捌", "玖",},
+    {"〇", "一", "二", "三", "四", "五", "六", "七", "八", "九",},
+};
+
+struct unit_t{
+    const char * unit_zh_name;  // Chinese Character
+    const bool persist;         // Whether to force eating zero and force inserting into result string.
+};
+
+static const unit_t units_simplified[] ={
+    {"兆", true},
+    {"亿", true},
+    {"万", true},
+    {"千", false},
+    {"百", false},
+    {"十", false},
+    {"",   true},
+};
+
+static const unit_t units_traditional[] ={
+    {"兆", true},
+    {"亿", true},
+    {"万", true},
+    {"仟", false},
+    {"佰", false},
+    {"拾", false},
+    {"",   true},
+};
+
+#define UNIT_TEN 5
+
+/* the unit of each digit of gint64, from the lowest one. */
+static const guint8 unit_positions[19] = {
+    6, 5, 4, 3, 2, 5, 4, 3, 1, 5, 4, 3, 0, 5, 4, 3, 2, 5, 4,
+};
+
+static inline gchar *
+prepend (gchar *p, const char *str)
+{
+    size_t len = strlen (str);
+    p -= len;
+    memcpy (p, str, len);
+    return p;
+}
+
+const gchar *
+ChineseNumber::format (gint64 num, ChineseNumberStyle style,
+                       gchar buffer[CHINESE_NUMBER_BUFFER_SIZE])
+{
+    gchar *p = buffer + CHINESE_NUMBER_BUFFER_SIZE - 1;
+    *p = '\0';
+
+    if (CHINESE_NUMBER_SIMPLEST == style) {
+        if (0 == num)
+            return prepend (p, numbers[1][0]);
+        for (; num > 0; num /= 10)
+            p = prepend (p, numbers[1][num % 10]);
+        return p;
+    }
+
+    const char * const * number = numbers[1];
+    const unit_t * units = units_simplified;
+    if (CHINESE_NUMBER_TRADITIONAL == style) {
+        number = numbers[0];
+        units = units_traditional;
+        if (0 == num)
+            return prepend (p, number[0]);
+    }
+
+    bool eat_zero = false;
+    for (guint pos = 0; num > 0; pos++) {
+        int remains = num % 10;
+        num = num / 10;
+        guint i = unit_positions[pos];
+
+        if (units[i].persist) {
+            p = prepend (p, units[i].unit_zh_name);
+            eat_zero = true;
+        }
+
+        if (remains == 0) {
+            if (eat_zero)
+                continue;
+
+            p = prepend (p, number[0]);
+            eat_zero = true;
+            continue;
+        } else {
+            eat_zero = false;
+        }
+
+        /* 十 instead of 一十 for the leading ten. */
+        if (num == 0 && remains == 1 && i == UNIT_TEN)
+            p = prepend (p, units[i].unit_zh_name);
+        else if (units[i].persist)
+            p = prepend (p, number[remains]);
+        else {
+            p = prepend (p, units[i].unit_zh_name);
+            p = prepend (p, number[remains]);
+        }
+    }
+
+    return p;
+}
+
+};
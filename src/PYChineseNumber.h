@@ -0,0 +1,50 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_CHINESE_NUMBER_H_
+#define __PY_CHINESE_NUMBER_H_
+
+#include <glib.h>
+
+namespace PY {
+
+enum ChineseNumberStyle {
+    /* 一二三, digit by digit. */
+    CHINESE_NUMBER_SIMPLEST = 0,
+    /* 一百二十三 */
+    CHINESE_NUMBER_SIMPLIFIED,
+    /* 壹佰贰拾叁 */
+    CHINESE_NUMBER_TRADITIONAL,
+};
+
+/* enough for the longest form of G_MAXINT64. */
+#define CHINESE_NUMBER_BUFFER_SIZE 128
+
+class ChineseNumber {
+public:
+    /* Format the number right to left into the end of the buffer,
+     * returns the first character, the negative numbers are empty. */
+    static const gchar * format (gint64 num, ChineseNumberStyle style,
+                                 gchar buffer[CHINESE_NUMBER_BUFFER_SIZE]);
+};
+
+};
+
+#endif
@@ -19,6 +19,8 @@
  */
 #include "PYConfig.h"
 
+#include <string.h>
+
 #include "PYTypes.h"
 #include "PYBus.h"
 
@@ -29,6 +31,7 @@ Config::Config (const std::string & name)
     : m_schema_id (name)
 {
     m_settings = NULL;
+    m_revision = 0;
     initDefaultValues ();
 }
 
@@ -46,12 +49,18 @@ Config::initDefaultValues (void)
     m_sort_option = SORT_BY_PHRASE_LENGTH_AND_PINYIN_LENGTH_AND_FREQUENCY;
     m_show_suggestion = FALSE;
     m_emoji_candidate = TRUE;
+    m_english_candidate = TRUE;
 
     m_shift_select_candidate = FALSE;
     m_minus_equal_page = TRUE;
     m_comma_period_page = TRUE;
     m_auto_commit = FALSE;
 
+    m_enable_cloud_input = FALSE;
+    m_cloud_input_source = 0;
+    m_cloud_candidates_number = 1;
+    m_cloud_request_delay_time = 600;
+
     m_double_pinyin = FALSE;
     m_double_pinyin_schema = DOUBLE_PINYIN_DEFAULT;
 
@@ -69,25 +78,132 @@ Config::initDefaultValues (void)
     m_punct_switch = "<Control>period";
     m_both_switch = "";
     m_trad_switch = "<Control><Shift>f";
+    compileSwitches ();
 
     m_network_dictionary_start_timestamp = 0;
     m_network_dictionary_end_timestamp = 0;
 }
 
 
+void
+Config::compileSwitches (void)
+{
+    m_main_switch_key = Accelerator::fromName (m_main_switch);
+    m_letter_switch_key = Accelerator::fromName (m_letter_switch);
+    m_punct_switch_key = Accelerator::fromName (m_punct_switch);
+    m_both_switch_key = Accelerator::fromName (m_both_switch);
+    m_trad_switch_key = Accelerator::fromName (m_trad_switch);
+}
+
 void
 Config::readDefaultValues (void)
 {
 }
 
+static const struct {
+    const gchar * const name;
+    guint mask;
+} accelerator_modifiers [] = {
+    { "Control", IBUS_CONTROL_MASK },
+    { "Alt",     IBUS_MOD1_MASK    },
+    { "Shift",   IBUS_SHIFT_MASK   },
+    { "Meta",    IBUS_META_MASK    },
+    { "Super",   IBUS_SUPER_MASK   },
+    { "Hyper",   IBUS_HYPER_MASK   },
+};
+
+Accelerator
+Accelerator::fromName (const std::string & name)
+{
+    Accelerator accel;
+    const gchar *p = name.c_str ();
+
+    while ('<' == *p) {
+        const gchar *end = strchr (p, '>');
+        if (NULL == end)
+            return Accelerator ();
+
+        guint i = 0;
+        for (; i < G_N_ELEMENTS (accelerator_modifiers); i++) {
+            const gchar *modifier = accelerator_modifiers[i].name;
+            if ((gsize) (end - p - 1) == strlen (modifier) &&
+                0 == strncmp (p + 1, modifier, end - p - 1))
+                break;
+        }
+        if (G_N_ELEMENTS (accelerator_modifiers) == i)
+            return Accelerator ();
+
+        accel.modifiers |= accelerator_modifiers[i].mask;
+        p = end + 1;
+    }
+
+    if (*p) {
+        guint keyval = ibus_keyval_from_name (p);
+        if (IBUS_KEY_VoidSymbol == keyval)
+            return Accelerator ();
+        accel.keyval = ibus_keyval_to_lower (keyval);
+    }
+
+    return accel;
+}
+
+Accelerator
+Accelerator::fromKeyEvent (guint keyval, guint modifiers)
+{
+    /* the modifier keys are matched as the modifiers. */
+    switch (keyval) {
+    case IBUS_KEY_Control_L:
+    case IBUS_KEY_Control_R:
+        modifiers |= IBUS_CONTROL_MASK;
+        keyval = 0;
+        break;
+    case IBUS_KEY_Alt_L:
+    case IBUS_KEY_Alt_R:
+        modifiers |= IBUS_MOD1_MASK;
+        keyval = 0;
+        break;
+    case IBUS_KEY_Shift_L:
+    case IBUS_KEY_Shift_R:
+        modifiers |= IBUS_SHIFT_MASK;
+        keyval = 0;
+        break;
+    case IBUS_KEY_Meta_L:
+    case IBUS_KEY_Meta_R:
+        modifiers |= IBUS_META_MASK;
+        keyval = 0;
+        break;
+    case IBUS_KEY_Super_L:
+    case IBUS_KEY_Super_R:
+        modifiers |= IBUS_SUPER_MASK;
+        keyval = 0;
+        break;
+    case IBUS_KEY_Hyper_L:
+    case IBUS_KEY_Hyper_R:
+        modifiers |= IBUS_HYPER_MASK;
+        keyval = 0;
+        break;
+    }
+
+    Accelerator accel;
+    accel.keyval = keyval ? ibus_keyval_to_lower (keyval) : 0;
+    accel.modifiers = modifiers &
+        (IBUS_CONTROL_MASK | IBUS_MOD1_MASK | IBUS_SHIFT_MASK |
+         IBUS_META_MASK | IBUS_SUPER_MASK | IBUS_HYPER_MASK);
+    return accel;
+}
+
 bool
 Config::read (const gchar * name,
               bool          defval)
 {
     GVariant *value = NULL;
     if ((value = g_settings_get_value (m_settings, name)) != NULL) {
-        if (g_variant_classify (value) == G_VARIANT_CLASS_BOOLEAN)
-            return g_variant_get_boolean (value);
+        if (g_variant_classify (value) == G_VARIANT_CLASS_BOOLEAN) {
+            bool retval = g_variant_get_boolean (value);
+            g_variant_unref (value);
+            return retval;
+        }
+        g_variant_unref (value);
     }
 
     g_warn_if_reached ();
@@ -100,8 +216,12 @@ Config::read (const gchar * name,
 {
     GVariant *value = NULL;
     if ((value = g_settings_get_value (m_settings, name)) != NULL) {
-        if (g_variant_classify (value) == G_VARIANT_CLASS_INT32)
-            return g_variant_get_int32 (value);
+        if (g_variant_classify (value) == G_VARIANT_CLASS_INT32) {
+            gint retval = g_variant_get_int32 (value);
+            g_variant_unref (value);
+            return retval;
+        }
+        g_variant_unref (value);
     }
 
     g_warn_if_reached ();
@@ -114,8 +234,12 @@ Config::read (const gchar * name,
 {
     GVariant *value = NULL;
     if ((value = g_settings_get_value (m_settings, name)) != NULL) {
-        if (g_variant_classify (value) == G_VARIANT_CLASS_STRING)
-            return g_variant_get_string (value, NULL);
+        if (g_variant_classify (value) == G_VARIANT_CLASS_STRING) {
+            std::string retval = g_variant_get_string (value, NULL);
+            g_variant_unref (value);
+            return retval;
+        }
+        g_variant_unref (value);
     }
 
     g_warn_if_reached ();
@@ -128,8 +252,12 @@ Config::read (const gchar * name,
 {
     GVariant *value = NULL;
     if ((value = g_settings_get_value (m_settings, name)) != NULL) {
-        if (g_variant_classify (value) == G_VARIANT_CLASS_INT64)
-            return g_variant_get_int64 (value);
+        if (g_variant_classify (value) == G_VARIANT_CLASS_INT64) {
+            gint64 retval = g_variant_get_int64 (value);
+            g_variant_unref (value);
+            return retval;
+        }
+        g_variant_unref (value);
     }
 
     g_warn_if_reached ();
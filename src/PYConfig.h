@@ -33,6 +33,23 @@
 
 namespace PY {
 
+/* the hotkey compiled from its accelerator name, like "<Control>period". */
+struct Accelerator {
+    guint keyval;       /* in lower case, 0 for the modifiers only. */
+    guint modifiers;
+
+    Accelerator (void) : keyval (0), modifiers (0) { }
+
+    gboolean valid (void) const { return keyval != 0 || modifiers != 0; }
+
+    bool operator == (const Accelerator & other) const
+    { return keyval == other.keyval && modifiers == other.modifiers; }
+
+    /* the invalid accelerator is returned for the bad name. */
+    static Accelerator fromName (const std::string & name);
+    static Accelerator fromKeyEvent (guint keyval, guint modifiers);
+};
+
 typedef enum {
     DISPLAY_STYLE_TRADITIONAL,
     DISPLAY_STYLE_COMPACT
@@ -44,8 +61,8 @@ protected:
     virtual ~Config (void);
 
 public:
-    std::string dictionaries (void) const       { return m_dictionaries; }
-    std::string luaConverter (void) const       { return m_lua_converter; }
+    const std::string & dictionaries (void) const { return m_dictionaries; }
+    const std::string & luaConverter (void) const { return m_lua_converter; }
     pinyin_option_t option (void) const         { return m_option & m_option_mask; }
     guint orientation (void) const              { return m_orientation; }
     guint pageSize (void) const                 { return m_page_size; }
@@ -54,10 +71,15 @@ public:
     sort_option_t sortOption (void) const       { return m_sort_option; }
     gboolean showSuggestion (void) const        { return m_show_suggestion; }
     gboolean emojiCandidate (void) const        { return m_emoji_candidate; }
+    gboolean englishCandidate (void) const      { return m_english_candidate; }
     gboolean shiftSelectCandidate (void) const  { return m_shift_select_candidate; }
     gboolean minusEqualPage (void) const        { return m_minus_equal_page; }
     gboolean commaPeriodPage (void) const       { return m_comma_period_page; }
     gboolean autoCommit (void) const            { return m_auto_commit; }
+    gboolean enableCloudInput (void) const      { return m_enable_cloud_input; }
+    gint cloudInputSource (void) const          { return m_cloud_input_source; }
+    guint cloudCandidatesNumber (void) const    { return m_cloud_candidates_number; }
+    guint cloudRequestDelayTime (void) const    { return m_cloud_request_delay_time; }
     gboolean doublePinyin (void) const          { return m_double_pinyin; }
     DoublePinyinScheme doublePinyinSchema (void) const { return m_double_pinyin_schema; }
     gboolean initChinese (void) const           { return m_init_chinese; }
@@ -71,17 +93,26 @@ public:
     gboolean auxiliarySelectKeyKP (void) const  { return m_auxiliary_select_key_kp; }
     gboolean enterKey (void) const  { return m_enter_key; }
 
-    std::string mainSwitch (void) const         { return m_main_switch; }
-    std::string letterSwitch (void) const       { return m_letter_switch; }
-    std::string punctSwitch (void) const        { return m_punct_switch; }
-    std::string bothSwitch (void) const         { return m_both_switch; }
-    std::string tradSwitch (void) const         { return m_trad_switch; }
-    std::string openccConfig (void) const       { return m_opencc_config; }
+    const std::string & mainSwitch (void) const { return m_main_switch; }
+    const std::string & letterSwitch (void) const { return m_letter_switch; }
+    const std::string & punctSwitch (void) const { return m_punct_switch; }
+    const std::string & bothSwitch (void) const { return m_both_switch; }
+    const std::string & tradSwitch (void) const { return m_trad_switch; }
+
+    /* the compiled switches. */
+    const Accelerator & mainSwitchKey (void) const   { return m_main_switch_key; }
+    const Accelerator & letterSwitchKey (void) const { return m_letter_switch_key; }
+    const Accelerator & punctSwitchKey (void) const  { return m_punct_switch_key; }
+    const Accelerator & bothSwitchKey (void) const   { return m_both_switch_key; }
+    const Accelerator & tradSwitchKey (void) const   { return m_trad_switch_key; }
+    const std::string & openccConfig (void) const { return m_opencc_config; }
 
     gint64 networkDictionaryStartTimestamp (void) const
     { return m_network_dictionary_start_timestamp; }
     gint64 networkDictionaryEndTimestamp (void) const
     { return m_network_dictionary_end_timestamp; }
+    /* bumped when the options applied to the backend are changed. */
+    guint revision (void) const                 { return m_revision; }
 
 public:
     /* write option */
@@ -89,6 +120,10 @@ public:
     { return FALSE; }
     virtual gboolean networkDictionaryEndTimestamp (gint64 timestamp)
     { return FALSE; }
+    virtual gboolean importDictionaryProgress (gint progress)
+    { return FALSE; }
+    virtual gboolean exportDictionaryProgress (gint count)
+    { return FALSE; }
 
 protected:
     bool read (const gchar * name, bool defval);
@@ -96,6 +131,8 @@ protected:
     std::string read (const gchar * name, const gchar * defval);
     gint64 read (const gchar * name, gint64 defval);
     void initDefaultValues (void);
+    /* compile the switches after they are changed. */
+    void compileSwitches (void);
 
     gboolean write (const gchar * name, bool val);
     gboolean write (const gchar * name, gint val);
@@ -119,6 +156,7 @@ protected:
     std::string m_opencc_config;
     pinyin_option_t m_option;
     pinyin_option_t m_option_mask;
+    guint m_revision;
 
     gint m_orientation;
     guint m_page_size;
@@ -127,12 +165,18 @@ protected:
     sort_option_t m_sort_option;
     gboolean m_show_suggestion;
     gboolean m_emoji_candidate;
+    gboolean m_english_candidate;
 
     gboolean m_shift_select_candidate;
     gboolean m_minus_equal_page;
     gboolean m_comma_period_page;
     gboolean m_auto_commit;
 
+    gboolean m_enable_cloud_input;
+    gint m_cloud_input_source;
+    guint m_cloud_candidates_number;
+    guint m_cloud_request_delay_time;
+
     gboolean m_double_pinyin;
     DoublePinyinScheme m_double_pinyin_schema;
 
@@ -155,6 +199,12 @@ protected:
     std::string m_both_switch;
     std::string m_trad_switch;
 
+    Accelerator m_main_switch_key;
+    Accelerator m_letter_switch_key;
+    Accelerator m_punct_switch_key;
+    Accelerator m_both_switch_key;
+    Accelerator m_trad_switch_key;
+
     gint64 m_network_dictionary_start_timestamp;
     gint64 m_network_dictionary_end_timestamp;
 };
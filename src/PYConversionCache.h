@@ -0,0 +1,160 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_CONVERSION_CACHE_H_
+#define __PY_CONVERSION_CACHE_H_
+
+#include <glib.h>
+#include <string>
+#include <list>
+#include <map>
+#include "PYStats.h"
+#include "PYReclaim.h"
+#include "PYCacheSnapshot.h"
+
+namespace PY {
+
+/* Bounded LRU cache keyed by strings, such as the string conversions,
+ * the tag names the conversion, the cache is cleared when the tag is
+ * changed. The lookups are counted in the hits and misses stats, the
+ * entries are dropped when idle. The named caches are saved in the
+ * cache snapshot, when the tag is only valid in this process, such as
+ * a serial, the restored entries are adopted by the first tag. */
+template <typename Value>
+class BoundedCache : public Reclaimable, public Snapshotable {
+public:
+    BoundedCache (guint capacity, StatsCounter hits = STATS_LAST,
+                  const char *snapshot = NULL, gboolean local_tag = FALSE)
+        : Snapshotable (snapshot), m_capacity (capacity), m_hits (hits),
+          m_local_tag (local_tag), m_adopt_tag (FALSE) { }
+
+    void setTag (const std::string & tag)
+    {
+        if (G_LIKELY (tag == m_tag))
+            return;
+        if (m_adopt_tag) {
+            m_adopt_tag = FALSE;
+            m_tag = tag;
+            return;
+        }
+        clear ();
+        m_tag = tag;
+    }
+
+    gboolean lookup (const std::string & in, Value & out)
+    {
+        typename Index::iterator iter = m_index.find (in);
+        Stats::lookup (m_hits, iter != m_index.end ());
+        if (iter == m_index.end ())
+            return FALSE;
+
+        /* move to the front as the most recently used. */
+        m_entries.splice (m_entries.begin (), m_entries, iter->second);
+        out = iter->second->second;
+        return TRUE;
+    }
+
+    void insert (const std::string & in, const Value & out)
+    {
+        typename Index::iterator iter = m_index.find (in);
+        if (iter != m_index.end ()) {
+            iter->second->second = out;
+            m_entries.splice (m_entries.begin (), m_entries, iter->second);
+            return;
+        }
+
+        m_entries.push_front (Entry (in, out));
+        m_index[in] = m_entries.begin ();
+
+        if (m_entries.size () > m_capacity) {
+            m_index.erase (m_entries.back ().first);
+            m_entries.pop_back ();
+        }
+    }
+
+    void clear (void)
+    {
+        m_index.clear ();
+        m_entries.clear ();
+        m_adopt_tag = FALSE;
+    }
+
+    void reclaim (void) { clear (); }
+
+    typedef std::pair<std::string, Value> Entry;
+
+    /* the most recently used entry is the first. */
+    const std::list<Entry> & entries (void) const { return m_entries; }
+
+    std::string snapshotTag (void) const
+    {
+        return m_local_tag ? std::string () : m_tag;
+    }
+
+    guint saveSnapshot (SnapshotWriter & writer) const
+    {
+        typename std::list<Entry>::const_iterator iter;
+        for (iter = m_entries.begin (); iter != m_entries.end (); ++iter) {
+            writer.putString (iter->first);
+            snapshot_put (writer, iter->second);
+        }
+        return m_entries.size ();
+    }
+
+    guint loadSnapshot (const std::string & tag, guint num,
+                        SnapshotReader & reader)
+    {
+        if (!m_entries.empty ())
+            return 0;
+
+        /* the entries are saved from the most recent. */
+        Entry entry;
+        for (guint i = 0; i < num && m_entries.size () < m_capacity; i++) {
+            if (!reader.getString (entry.first) ||
+                !snapshot_get (reader, entry.second))
+                break;
+            if (m_index.find (entry.first) != m_index.end ())
+                continue;
+            m_entries.push_back (entry);
+            m_index[entry.first] = --m_entries.end ();
+        }
+
+        m_tag = tag;
+        m_adopt_tag = m_local_tag && !m_entries.empty ();
+        return m_entries.size ();
+    }
+
+private:
+    typedef std::map<std::string, typename std::list<Entry>::iterator> Index;
+
+    guint m_capacity;
+    StatsCounter m_hits;
+    std::string m_tag;
+    gboolean m_local_tag;
+    gboolean m_adopt_tag;
+    std::list<Entry> m_entries;
+    Index m_index;
+};
+
+typedef BoundedCache<std::string> ConversionCache;
+
+};
+
+#endif
@@ -0,0 +1,339 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYDeletionIndex.h"
+#include <string.h>
+#include <string>
+#include <set>
+
+namespace PY {
+
+#define DELETION_INDEX_MAGIC "PYDELIX1"
+
+/* the longer words are not corrected. */
+#define MAX_WORD_LENGTH      (64)
+/* check the deadline every 64 candidates. */
+#define CHECK_CANDIDATES     (64)
+
+/* All integers are stored in little endian, see data/deletion-index.py. */
+struct DeletionIndex::Header {
+    gchar magic[8];
+    guint32 max_distance;
+    guint32 prefix_length;
+    guint32 n_words;
+    guint32 n_keys;
+    guint32 n_items;
+    guint32 words_offset;
+    guint32 keys_offset;
+    guint32 items_offset;
+    guint32 strings_offset;
+};
+
+struct DeletionIndex::WordEntry {
+    guint32 string_offset;
+    guint32 freq;
+};
+
+struct DeletionIndex::Key {
+    guint32 hash;
+    guint32 items_begin;
+    guint32 n_items;
+};
+
+static inline gfloat
+le_to_float (guint32 value)
+{
+    union {
+        guint32 i;
+        gfloat f;
+    } u;
+    u.i = GUINT32_FROM_LE (value);
+    return u.f;
+}
+
+/* keep synced with fnv1a of data/deletion-index.py. */
+static guint32
+fnv1a_hash (const std::string & str)
+{
+    guint32 value = 2166136261u;
+    for (size_t i = 0; i < str.size (); ++i) {
+        value ^= (guchar) str[i];
+        value *= 16777619u;
+    }
+    return value;
+}
+
+DeletionIndex::DeletionIndex ()
+    : m_file (NULL),
+      m_data (NULL),
+      m_length (0),
+      m_header (NULL),
+      m_words (NULL),
+      m_keys (NULL),
+      m_items (NULL),
+      m_strings (NULL)
+{
+}
+
+DeletionIndex::~DeletionIndex ()
+{
+    unload ();
+}
+
+void
+DeletionIndex::unload (void)
+{
+    if (m_file)
+        g_mapped_file_unref (m_file);
+    m_file = NULL;
+    m_data = NULL;
+    m_length = 0;
+    m_header = NULL;
+    m_words = NULL;
+    m_keys = NULL;
+    m_items = NULL;
+    m_strings = NULL;
+}
+
+gboolean
+DeletionIndex::load (const char *filename)
+{
+    unload ();
+
+    if (!g_file_test (filename, G_FILE_TEST_IS_REGULAR))
+        return FALSE;
+
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, NULL);
+    if (file == NULL)
+        return FALSE;
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize length = g_mapped_file_get_length (file);
+    const Header *header = (const Header *) data;
+
+    do {
+        if (length < sizeof (Header))
+            break;
+        if (memcmp (header->magic, DELETION_INDEX_MAGIC, sizeof (header->magic)))
+            break;
+
+        guint32 n_words = GUINT32_FROM_LE (header->n_words);
+        guint32 n_keys = GUINT32_FROM_LE (header->n_keys);
+        guint32 n_items = GUINT32_FROM_LE (header->n_items);
+        guint32 words_offset = GUINT32_FROM_LE (header->words_offset);
+        guint32 keys_offset = GUINT32_FROM_LE (header->keys_offset);
+        guint32 items_offset = GUINT32_FROM_LE (header->items_offset);
+        guint32 strings_offset = GUINT32_FROM_LE (header->strings_offset);
+
+        /* check the sections are inside of the file, in order. */
+        if (words_offset + (guint64) n_words * sizeof (WordEntry) > keys_offset)
+            break;
+        if (keys_offset + (guint64) n_keys * sizeof (Key) > items_offset)
+            break;
+        if (items_offset + (guint64) n_items * sizeof (guint32) > strings_offset)
+            break;
+        if (strings_offset > length || data[length - 1] != '\0')
+            break;
+
+        m_file = file;
+        m_data = data;
+        m_length = length;
+        m_header = header;
+        m_words = (const WordEntry *) (data + words_offset);
+        m_keys = (const Key *) (data + keys_offset);
+        m_items = (const guint32 *) (data + items_offset);
+        m_strings = data + strings_offset;
+        return TRUE;
+    } while (0);
+
+    g_warning ("invalid deletion index: %s.\n", filename);
+    g_mapped_file_unref (file);
+    return FALSE;
+}
+
+guint
+DeletionIndex::maxDistance (void) const
+{
+    if (!isLoaded ())
+        return 0;
+    return GUINT32_FROM_LE (m_header->max_distance);
+}
+
+const DeletionIndex::Key *
+DeletionIndex::findKey (guint32 hash) const
+{
+    guint32 begin = 0;
+    guint32 end = GUINT32_FROM_LE (m_header->n_keys);
+
+    /* keys are sorted by hash. */
+    while (begin < end) {
+        guint32 middle = begin + (end - begin) / 2;
+        guint32 value = GUINT32_FROM_LE (m_keys[middle].hash);
+        if (value == hash)
+            return m_keys + middle;
+        if (value < hash)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return NULL;
+}
+
+/* the strings deleting at most distance characters from the word. */
+static void
+collect_deletions (const std::string & word, guint distance,
+                   std::set<std::string> & deletions)
+{
+    if (!deletions.insert (word).second || 0 == distance)
+        return;
+
+    for (size_t i = 0; i < word.size (); ++i) {
+        std::string deleted (word);
+        deleted.erase (i, 1);
+        collect_deletions (deleted, distance - 1, deletions);
+    }
+}
+
+gboolean
+DeletionIndex::listCorrections (const char *input, guint max_distance,
+                                gint64 deadline,
+                                std::vector<Word> & words) const
+{
+    words.clear ();
+
+    if (!isLoaded ())
+        return FALSE;
+
+    std::string lower (input);
+    if (lower.empty () || lower.size () > MAX_WORD_LENGTH)
+        return TRUE;
+    for (size_t i = 0; i < lower.size (); ++i)
+        lower[i] = g_ascii_tolower (lower[i]);
+
+    max_distance = MIN (max_distance, maxDistance ());
+    guint32 prefix_length = GUINT32_FROM_LE (m_header->prefix_length);
+    std::set<std::string> deletions;
+    collect_deletions (lower.substr (0, prefix_length), max_distance,
+                       deletions);
+
+    guint32 n_words = GUINT32_FROM_LE (m_header->n_words);
+    guint32 n_items = GUINT32_FROM_LE (m_header->n_items);
+    gsize strings_length = m_length - (m_strings - m_data);
+    std::set<guint32> checked;
+    guint candidates = 0;
+
+    std::set<std::string>::const_iterator iter;
+    for (iter = deletions.begin (); iter != deletions.end (); ++iter) {
+        const Key *key = findKey (fnv1a_hash (*iter));
+        if (key == NULL)
+            continue;
+
+        guint32 begin = GUINT32_FROM_LE (key->items_begin);
+        guint32 end = begin + GUINT32_FROM_LE (key->n_items);
+        if (end > n_items)
+            return FALSE;
+
+        for (guint32 i = begin; i < end; ++i) {
+            if (0 == ++candidates % CHECK_CANDIDATES &&
+                g_get_monotonic_time () > deadline)
+                return TRUE;
+
+            guint32 word_index = GUINT32_FROM_LE (m_items[i]);
+            if (word_index >= n_words)
+                return FALSE;
+            if (!checked.insert (word_index).second)
+                continue;
+
+            const WordEntry *entry = m_words + word_index;
+            guint32 offset = GUINT32_FROM_LE (entry->string_offset);
+            if (offset >= strings_length)
+                return FALSE;
+
+            /* the hashes may collide, verify the distance. */
+            const char *word = m_strings + offset;
+            guint distance = editDistance (lower.c_str (), word, max_distance);
+            if (distance > max_distance)
+                continue;
+
+            Word correction;
+            correction.word = word;
+            correction.value = le_to_float (entry->freq);
+            correction.distance = distance;
+            words.push_back (correction);
+        }
+    }
+
+    return TRUE;
+}
+
+guint
+DeletionIndex::editDistance (const char *lhs, const char *rhs,
+                             guint max_distance)
+{
+    guint lhs_len = strlen (lhs);
+    guint rhs_len = strlen (rhs);
+
+    guint length_diff = lhs_len > rhs_len ?
+        lhs_len - rhs_len : rhs_len - lhs_len;
+    if (length_diff > max_distance)
+        return max_distance + 1;
+    if (lhs_len > MAX_WORD_LENGTH || rhs_len > MAX_WORD_LENGTH)
+        return max_distance + 1;
+
+    /* the last three rows of the optimal string alignment distance. */
+    guint rows[3][MAX_WORD_LENGTH + 1];
+    guint *prev2 = rows[0], *prev = rows[1], *current = rows[2];
+
+    for (guint j = 0; j <= rhs_len; ++j)
+        prev[j] = j;
+
+    for (guint i = 1; i <= lhs_len; ++i) {
+        current[0] = i;
+        guint row_min = current[0];
+        gchar a = g_ascii_tolower (lhs[i - 1]);
+
+        for (guint j = 1; j <= rhs_len; ++j) {
+            gchar b = g_ascii_tolower (rhs[j - 1]);
+            guint cost = a == b ? 0 : 1;
+            guint value = MIN (prev[j] + 1, current[j - 1] + 1);
+            value = MIN (value, prev[j - 1] + cost);
+
+            /* the transposition of the adjacent characters. */
+            if (i > 1 && j > 1 && a == g_ascii_tolower (rhs[j - 2]) &&
+                g_ascii_tolower (lhs[i - 2]) == b)
+                value = MIN (value, prev2[j - 2] + 1);
+
+            current[j] = value;
+            row_min = MIN (row_min, value);
+        }
+
+        if (row_min > max_distance)
+            return max_distance + 1;
+
+        guint *rotated = prev2;
+        prev2 = prev;
+        prev = current;
+        current = rotated;
+    }
+
+    return MIN (prev[rhs_len], max_distance + 1);
+}
+
+};
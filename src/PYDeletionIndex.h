@@ -0,0 +1,79 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_DELETION_INDEX_
+#define __PY_DELETION_INDEX_
+
+#include <glib.h>
+#include <vector>
+
+namespace PY {
+
+/* Read only symmetric deletion index of the English word list,
+ * generated by data/deletion-index.py and mapped into memory. */
+class DeletionIndex {
+public:
+    struct Word {
+        const char *word;
+        gfloat value;
+        guint distance;
+    };
+
+    DeletionIndex ();
+    ~DeletionIndex ();
+
+    gboolean load (const char *filename);
+    gboolean isLoaded (void) const { return m_file != NULL; }
+
+    guint maxDistance (void) const;
+
+    /* List the words within the max distance of the input, matched in
+       lower case, the search stops at the deadline of monotonic time. */
+    gboolean listCorrections (const char *input, guint max_distance,
+                              gint64 deadline,
+                              std::vector<Word> & words) const;
+
+    /* The optimal string alignment distance of the lower case strings,
+       or max_distance + 1 when it is larger than max_distance. */
+    static guint editDistance (const char *lhs, const char *rhs,
+                               guint max_distance);
+
+private:
+    struct Header;
+    struct WordEntry;
+    struct Key;
+
+    const Key *findKey (guint32 hash) const;
+    void unload (void);
+
+    GMappedFile *m_file;
+    const gchar *m_data;
+    gsize m_length;
+
+    const Header *m_header;
+    const WordEntry *m_words;
+    const Key *m_keys;
+    const guint32 *m_items;
+    const gchar *m_strings;
+};
+
+};
+
+#endif
@@ -23,7 +23,8 @@
 namespace PY {
 
 Editor::Editor (PinyinProperties & props, Config & config)
-    : m_cursor (0),
+    : m_sink (NULL),
+      m_cursor (0),
       m_props (props),
       m_config (config)
 {
@@ -139,6 +140,16 @@ Editor::candidateClicked (guint index, guint button, guint state)
 {
 }
 
+void
+Editor::focusIn (void)
+{
+}
+
+void
+Editor::focusOut (void)
+{
+}
+
 void
 Editor::update (void)
 {
@@ -22,6 +22,7 @@
 
 #include <glib.h>
 #include "PYSignal.h"
+#include "PYEditorSink.h"
 #include "PYString.h"
 #include "PYUtil.h"
 #include "PYPEnhancedCandidates.h"
@@ -40,6 +41,8 @@ class TraditionalCandidates;
 class LuaTriggerCandidates;
 class LuaConverterCandidates;
 class EmojiCandidates;
+class EnglishCandidates;
+class CloudCandidates;
 
 class Editor {
     friend class TraditionalCandidates;
@@ -51,6 +54,14 @@ class Editor {
 
     friend class EmojiCandidates;
 
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+    friend class EnglishCandidates;
+#endif
+
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    friend class CloudCandidates;
+#endif
+
 public:
     Editor (PinyinProperties & prop, Config & config);
     virtual ~Editor (void);
@@ -63,6 +74,8 @@ public:
     virtual void update (void);
     virtual void reset (void);
     virtual void candidateClicked (guint index, guint button, guint state);
+    virtual void focusIn (void);
+    virtual void focusOut (void);
 
     const String & text (void) const
     {
@@ -75,6 +88,9 @@ public:
         m_cursor = cursor;
     }
 
+    /* the sink is called instead of the signals. */
+    void setSink (EditorSink *sink)                     { m_sink = sink; }
+
     /* signals */
     signal <void (Text &)> & signalCommitText (void)    { return m_signal_commit_text; }
 
@@ -99,57 +115,90 @@ protected:
     /* methods */
     void commitText (Text & text) const
     {
-        m_signal_commit_text (text);
+        if (G_LIKELY (m_sink))
+            m_sink->commitText (text);
+        else
+            m_signal_commit_text (text);
     }
 
     void updatePreeditText (Text & text, guint cursor, gboolean visible) const
     {
-        m_signal_update_preedit_text (text, cursor, visible);
+        if (G_LIKELY (m_sink))
+            m_sink->updatePreeditText (text, cursor, visible);
+        else
+            m_signal_update_preedit_text (text, cursor, visible);
     }
 
     void showPreeditText (void) const
     {
-        m_signal_show_preedit_text ();
+        if (G_LIKELY (m_sink))
+            m_sink->showPreeditText ();
+        else
+            m_signal_show_preedit_text ();
     }
 
     void hidePreeditText (void) const
     {
-        m_signal_hide_preedit_text ();
+        if (G_LIKELY (m_sink))
+            m_sink->hidePreeditText ();
+        else
+            m_signal_hide_preedit_text ();
     }
 
     void updateAuxiliaryText (Text & text, gboolean visible) const
     {
-        m_signal_update_auxiliary_text (text, visible);
+        if (G_LIKELY (m_sink))
+            m_sink->updateAuxiliaryText (text, visible);
+        else
+            m_signal_update_auxiliary_text (text, visible);
     }
 
     void showAuxiliaryText (void) const
     {
-        m_signal_show_auxiliary_text ();
+        if (G_LIKELY (m_sink))
+            m_sink->showAuxiliaryText ();
+        else
+            m_signal_show_auxiliary_text ();
     }
 
     void hideAuxiliaryText (void) const
     {
-        m_signal_hide_auxiliary_text ();
+        if (G_LIKELY (m_sink))
+            m_sink->hideAuxiliaryText ();
+        else
+            m_signal_hide_auxiliary_text ();
     }
 
     void updateLookupTable (LookupTable & table, gboolean visible) const
     {
-        m_signal_update_lookup_table (table, visible);
+        if (G_LIKELY (m_sink))
+            m_sink->updateLookupTable (table, visible);
+        else
+            m_signal_update_lookup_table (table, visible);
     }
 
     void updateLookupTableFast (LookupTable & table, gboolean visible) const
     {
-        m_signal_update_lookup_table_fast (table, visible);
+        if (G_LIKELY (m_sink))
+            m_sink->updateLookupTableFast (table, visible);
+        else
+            m_signal_update_lookup_table_fast (table, visible);
     }
 
     void showLookupTable (void) const
     {
-        m_signal_show_lookup_table ();
+        if (G_LIKELY (m_sink))
+            m_sink->showLookupTable ();
+        else
+            m_signal_show_lookup_table ();
     }
 
     void hideLookupTable (void) const
     {
-        m_signal_hide_lookup_table ();
+        if (G_LIKELY (m_sink))
+            m_sink->hideLookupTable ();
+        else
+            m_signal_hide_lookup_table ();
     }
 
 protected:
@@ -169,6 +218,8 @@ protected:
     signal <void ()> m_signal_show_lookup_table;
     signal <void ()> m_signal_hide_lookup_table;
 
+    EditorSink *m_sink;
+
 protected:
     String m_text;
     guint  m_cursor;
@@ -0,0 +1,57 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_EDITOR_SINK_H_
+#define __PY_EDITOR_SINK_H_
+
+#include <glib.h>
+
+namespace PY {
+
+class Text;
+class LookupTable;
+
+/* The receiver of the editor updates, the updates of the key events are
+ * called through it directly instead of the signals when it is set. */
+class EditorSink {
+public:
+    virtual ~EditorSink (void) { }
+
+    virtual void commitText (Text & text) = 0;
+
+    virtual void updatePreeditText (Text & text, guint cursor,
+                                    gboolean visible) = 0;
+    virtual void showPreeditText (void) = 0;
+    virtual void hidePreeditText (void) = 0;
+
+    virtual void updateAuxiliaryText (Text & text, gboolean visible) = 0;
+    virtual void showAuxiliaryText (void) = 0;
+    virtual void hideAuxiliaryText (void) = 0;
+
+    virtual void updateLookupTable (LookupTable & table, gboolean visible) = 0;
+    virtual void updateLookupTableFast (LookupTable & table,
+                                        gboolean visible) = 0;
+    virtual void showLookupTable (void) = 0;
+    virtual void hideLookupTable (void) = 0;
+};
+
+};
+
+#endif
@@ -20,8 +20,13 @@
 
 #include "PYEngine.h"
 #include <cstring>
+#include <algorithm>
 #include "PYPPinyinEngine.h"
 #include "PYPBopomofoEngine.h"
+#include "PYTrace.h"
+#include "PYKeyRecorder.h"
+#include "PYPreload.h"
+#include "PYReclaim.h"
 
 namespace PY {
 /* code of engine class of GObject */
@@ -193,7 +198,29 @@ ibus_pinyin_engine_process_key_event (IBusEngine     *engine,
                                       guint           modifiers)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
-    return pinyin->engine->processKeyEvent (keyval, keycode, modifiers);
+    TraceScope trace (TRACE_PROCESS_KEY_EVENT);
+
+    Reclaim::keyPressed ();
+    if (!(modifiers & IBUS_RELEASE_MASK))
+        Preload::keyPressed ();
+
+    gint64 begin = 0;
+    gint mode = 0;
+    if (G_UNLIKELY (KeyRecorder::enabled ())) {
+        begin = g_get_monotonic_time ();
+        mode = pinyin->engine->inputMode ();
+    }
+
+    /* send the updates of the key event once. */
+    pinyin->engine->beginUpdate ();
+    gboolean retval = pinyin->engine->processKeyEvent (keyval, keycode, modifiers);
+    pinyin->engine->endUpdate ();
+
+    if (G_UNLIKELY (begin) && !pinyin->engine->contentIsPassword ())
+        KeyRecorder::record (keyval, modifiers, mode,
+                             pinyin->engine->inputMode (), retval,
+                             g_get_monotonic_time () - begin);
+    return retval;
 }
 
 #if IBUS_CHECK_VERSION (1, 5, 4)
@@ -213,7 +240,9 @@ ibus_pinyin_engine_property_activate (IBusEngine    *engine,
                                       guint          prop_state)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
+    pinyin->engine->beginUpdate ();
     pinyin->engine->propertyActivate (prop_name, prop_state);
+    pinyin->engine->endUpdate ();
 }
 static void
 ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
@@ -222,7 +251,9 @@ ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
                                       guint       state)
 {
     IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;
+    pinyin->engine->beginUpdate ();
     pinyin->engine->candidateClicked (index, button, state);
+    pinyin->engine->endUpdate ();
 }
 
 #define FUNCTION(name, Name)                                        \
@@ -230,7 +261,9 @@ ibus_pinyin_engine_candidate_clicked (IBusEngine *engine,
     ibus_pinyin_engine_##name (IBusEngine *engine)                  \
     {                                                               \
         IBusPinyinEngine *pinyin = (IBusPinyinEngine *) engine;     \
+        pinyin->engine->beginUpdate ();                             \
         pinyin->engine->Name ();                                    \
+        pinyin->engine->endUpdate ();                               \
         ((IBusEngineClass *) ibus_pinyin_engine_parent_class)       \
             ->name (engine);                                        \
     }
@@ -245,7 +278,15 @@ FUNCTION(cursor_up,   cursorUp)
 FUNCTION(cursor_down, cursorDown)
 #undef FUNCTION
 
-Engine::Engine (IBusEngine *engine) : m_engine (engine)
+Engine::Engine (IBusEngine *engine)
+    : m_engine (engine),
+      m_update_depth (0),
+      m_update_flags (0),
+      m_preedit_cursor (0),
+      m_preedit_visible (FALSE),
+      m_auxiliary_visible (FALSE),
+      m_lookup_table (NULL),
+      m_lookup_table_visible (FALSE)
 {
 #if IBUS_CHECK_VERSION (1, 5, 4)
     m_input_purpose = IBUS_INPUT_PURPOSE_FREE_FORM;
@@ -265,83 +306,334 @@ Engine::contentIsPassword()
 void
 Engine::focusOut (void)
 {
+    /* the panel forgets the lookup table. */
+    m_lookup_table_digest.clear ();
+    m_preedit_digest.clear ();
+    m_auxiliary_digest.clear ();
+
 #if IBUS_CHECK_VERSION (1, 5, 4)
     m_input_purpose = IBUS_INPUT_PURPOSE_FREE_FORM;
 #endif
 }
 
-#if IBUS_CHECK_VERSION(1, 5, 4)
+static void
+append_text_digest (std::string & digest, IBusText *text)
+{
+    if (text == NULL)
+        return;
+
+    digest += ibus_text_get_text (text);
+    digest += '\0';
+
+    IBusAttrList *attrs = ibus_text_get_attributes (text);
+    if (attrs == NULL)
+        return;
+
+    IBusAttribute *attr;
+    for (guint i = 0; (attr = ibus_attr_list_get (attrs, i)) != NULL; i++) {
+        guint values[] = {
+            ibus_attribute_get_attr_type (attr),
+            ibus_attribute_get_value (attr),
+            ibus_attribute_get_start_index (attr),
+            ibus_attribute_get_end_index (attr)
+        };
+        digest.append ((const gchar *) values, sizeof (values));
+    }
+    digest += '\0';
+}
+
+enum {
+    UPDATE_PREEDIT_TEXT         = 1 << 0,
+    UPDATE_AUXILIARY_TEXT       = 1 << 1,
+    UPDATE_LOOKUP_TABLE         = 1 << 2,
+    /* only shown or hidden, without the table. */
+    UPDATE_LOOKUP_TABLE_VISIBLE = 1 << 3,
+    UPDATE_PROPERTIES           = 1 << 4,
+};
+
 void
-Engine::setContentType (guint purpose, guint hints)
+Engine::updatePreeditText (Text & text, guint cursor, gboolean visible)
 {
-    m_input_purpose = (IBusInputPurpose) purpose;
+    m_preedit_text = (IBusText *) text;
+    m_preedit_cursor = cursor;
+    m_preedit_visible = visible;
+    m_update_flags |= UPDATE_PREEDIT_TEXT;
+    flushUpdate ();
 }
-#endif
 
-Engine::~Engine (void)
+void
+Engine::showPreeditText (void)
 {
+    m_preedit_visible = TRUE;
+    m_update_flags |= UPDATE_PREEDIT_TEXT;
+    flushUpdate ();
 }
 
-gboolean
-pinyin_accelerator_name(guint keyval, guint modifiers, std::string & name) {
-    name = "";
-
-    /* Convert some key press to modifiers. */
-    switch (keyval) {
-    case IBUS_KEY_Control_L:
-    case IBUS_KEY_Control_R:
-        modifiers |= IBUS_CONTROL_MASK;
-        keyval = 0;
-        break;
-    case IBUS_KEY_Alt_L:
-    case IBUS_KEY_Alt_R:
-        modifiers |= IBUS_MOD1_MASK;
-        keyval = 0;
-        break;
-    case IBUS_KEY_Shift_L:
-    case IBUS_KEY_Shift_R:
-        modifiers |= IBUS_SHIFT_MASK;
-        keyval = 0;
-        break;
-    case IBUS_KEY_Meta_L:
-    case IBUS_KEY_Meta_R:
-        modifiers |= IBUS_META_MASK;
-        keyval = 0;
-        break;
-    case IBUS_KEY_Super_L:
-    case IBUS_KEY_Super_R:
-        modifiers |= IBUS_SUPER_MASK;
-        keyval = 0;
-        break;
-    case IBUS_KEY_Hyper_L:
-    case IBUS_KEY_Hyper_R:
-        modifiers |= IBUS_HYPER_MASK;
-        keyval = 0;
-        break;
+void
+Engine::hidePreeditText (void)
+{
+    m_preedit_visible = FALSE;
+    m_update_flags |= UPDATE_PREEDIT_TEXT;
+    flushUpdate ();
+}
+
+void
+Engine::updateAuxiliaryText (Text & text, gboolean visible)
+{
+    m_auxiliary_text = (IBusText *) text;
+    m_auxiliary_visible = visible;
+    m_update_flags |= UPDATE_AUXILIARY_TEXT;
+    flushUpdate ();
+}
+
+void
+Engine::showAuxiliaryText (void)
+{
+    m_auxiliary_visible = TRUE;
+    m_update_flags |= UPDATE_AUXILIARY_TEXT;
+    flushUpdate ();
+}
+
+void
+Engine::hideAuxiliaryText (void)
+{
+    m_auxiliary_visible = FALSE;
+    m_update_flags |= UPDATE_AUXILIARY_TEXT;
+    flushUpdate ();
+}
+
+void
+Engine::updateLookupTable (LookupTable &table, gboolean visible)
+{
+    m_lookup_table = &table;
+    m_lookup_table_visible = visible;
+    m_update_flags |= UPDATE_LOOKUP_TABLE;
+    m_update_flags &= ~UPDATE_LOOKUP_TABLE_VISIBLE;
+    flushUpdate ();
+}
+
+void
+Engine::showLookupTable (void)
+{
+    m_lookup_table_visible = TRUE;
+    if (!(m_update_flags & UPDATE_LOOKUP_TABLE))
+        m_update_flags |= UPDATE_LOOKUP_TABLE_VISIBLE;
+    flushUpdate ();
+}
+
+void
+Engine::hideLookupTable (void)
+{
+    m_lookup_table_visible = FALSE;
+    if (!(m_update_flags & UPDATE_LOOKUP_TABLE))
+        m_update_flags |= UPDATE_LOOKUP_TABLE_VISIBLE;
+    flushUpdate ();
+}
+
+/* the state of the property shown by the panel. */
+static void
+property_digest (std::string & digest, IBusProperty *prop)
+{
+    guint header[] = {
+        (guint) ibus_property_get_prop_type (prop),
+        (guint) ibus_property_get_state (prop),
+        (guint) ibus_property_get_sensitive (prop),
+        (guint) ibus_property_get_visible (prop)
+    };
+    digest.assign ((const gchar *) header, sizeof (header));
+
+    const gchar *icon = ibus_property_get_icon (prop);
+    if (icon)
+        digest += icon;
+    digest += '\0';
+
+    append_text_digest (digest, ibus_property_get_label (prop));
+    digest += '\0';
+    append_text_digest (digest, ibus_property_get_symbol (prop));
+    digest += '\0';
+    append_text_digest (digest, ibus_property_get_tooltip (prop));
+}
+
+void
+Engine::registerProperties (PropList & props)
+{
+    IBusPropList *prop_list = props;
+    std::string keys;
+    std::map<std::string, std::string> digests;
+
+    IBusProperty *prop;
+    for (guint i = 0; (prop = ibus_prop_list_get (prop_list, i)) != NULL; i++) {
+        const gchar *key = ibus_property_get_key (prop);
+        keys += key;
+        keys += '\0';
+        property_digest (digests[key], prop);
+    }
+
+    /* ibus-daemon keeps the registered properties of the engine,
+       and sends them to the panel on focus in. */
+    if (keys == m_properties_keys && digests == m_property_digests)
+        return;
+
+    m_properties_keys.swap (keys);
+    m_property_digests.swap (digests);
+    ibus_engine_register_properties (m_engine, prop_list);
+}
+
+void
+Engine::updateProperty (Property & prop)
+{
+    IBusProperty *property = prop;
+    if (std::find (m_pending_properties.begin (), m_pending_properties.end (),
+                   property) == m_pending_properties.end ())
+        m_pending_properties.push_back (property);
+
+    m_update_flags |= UPDATE_PROPERTIES;
+    flushUpdate ();
+}
+
+void
+Engine::sendProperty (IBusProperty *prop)
+{
+    std::string digest;
+    property_digest (digest, prop);
+
+    std::string & last = m_property_digests[ibus_property_get_key (prop)];
+    if (digest == last)
+        return;
+    last.swap (digest);
+
+    ibus_engine_update_property (m_engine, prop);
+}
+
+void
+Engine::endUpdate (void)
+{
+    g_assert (m_update_depth > 0);
+    m_update_depth --;
+    flushUpdate ();
+}
+
+/* the text, its attributes, the cursor and the visibility. */
+static void
+text_state_digest (std::string & digest, IBusText *text,
+                   guint cursor, gboolean visible)
+{
+    guint header[] = { cursor, (guint) visible };
+    digest.assign ((const gchar *) header, sizeof (header));
+    append_text_digest (digest, text);
+}
+
+void
+Engine::flushUpdate (void)
+{
+    if (m_update_depth > 0 || m_update_flags == 0)
+        return;
+
+    guint flags = m_update_flags;
+    m_update_flags = 0;
+
+    std::string digest;
+
+    if (flags & UPDATE_PREEDIT_TEXT) {
+        text_state_digest (digest, m_preedit_text,
+                           m_preedit_cursor, m_preedit_visible);
+        if (digest != m_preedit_digest) {
+            TraceScope trace (TRACE_UPDATE_PREEDIT_TEXT);
+            m_preedit_digest.swap (digest);
+            if (m_preedit_text)
+                ibus_engine_update_preedit_text
+                    (m_engine, m_preedit_text, m_preedit_cursor,
+                     m_preedit_visible);
+            else if (m_preedit_visible)
+                ibus_engine_show_preedit_text (m_engine);
+            else
+                ibus_engine_hide_preedit_text (m_engine);
+        }
     }
 
-    /* Convert modifiers. */
-    if (modifiers & IBUS_CONTROL_MASK)
-        name += "<Control>";
-    if (modifiers & IBUS_MOD1_MASK)
-        name += "<Alt>";
-    if (modifiers & IBUS_SHIFT_MASK)
-        name += "<Shift>";
-    if (modifiers & IBUS_META_MASK)
-        name += "<Meta>";
-    if (modifiers & IBUS_SUPER_MASK)
-        name += "<Super>";
-    if (modifiers & IBUS_HYPER_MASK)
-        name += "<Hyper>";
-
-
-    /* Convert keyval. */
-    if (keyval) {
-        const gchar * symbol = ibus_keyval_name (ibus_keyval_to_lower (keyval));
-        name += symbol;
+    if (flags & UPDATE_AUXILIARY_TEXT) {
+        text_state_digest (digest, m_auxiliary_text, 0, m_auxiliary_visible);
+        if (digest != m_auxiliary_digest) {
+            TraceScope trace (TRACE_UPDATE_AUXILIARY_TEXT);
+            m_auxiliary_digest.swap (digest);
+            if (m_auxiliary_text)
+                ibus_engine_update_auxiliary_text
+                    (m_engine, m_auxiliary_text, m_auxiliary_visible);
+            else if (m_auxiliary_visible)
+                ibus_engine_show_auxiliary_text (m_engine);
+            else
+                ibus_engine_hide_auxiliary_text (m_engine);
+        }
+    }
+
+    if (flags & UPDATE_LOOKUP_TABLE) {
+        sendLookupTable (*m_lookup_table, m_lookup_table_visible);
+    } else if (flags & UPDATE_LOOKUP_TABLE_VISIBLE) {
+        m_lookup_table_digest.clear ();
+        if (m_lookup_table_visible)
+            ibus_engine_show_lookup_table (m_engine);
+        else
+            ibus_engine_hide_lookup_table (m_engine);
+    }
+
+    if (flags & UPDATE_PROPERTIES) {
+        for (gsize i = 0; i < m_pending_properties.size (); i++)
+            sendProperty (m_pending_properties[i]);
+        m_pending_properties.clear ();
+    }
+}
+
+void
+Engine::sendLookupTable (LookupTable &table, gboolean visible)
+{
+    TraceScope trace (TRACE_UPDATE_LOOKUP_TABLE);
+
+    IBusLookupTable *lookup_table = table;
+    guint size = table.size ();
+    guint page_size = table.pageSize ();
+    guint cursor = table.cursorPos ();
+    guint page_begin = page_size ? cursor / page_size * page_size : 0;
+
+    guint header[] = {
+        (guint) visible,
+        size,
+        page_size,
+        cursor,
+        (guint) ibus_lookup_table_is_cursor_visible (lookup_table),
+        table.orientation ()
+    };
+    std::string digest ((const gchar *) header, sizeof (header));
+
+    /* the neighbours enable the page buttons of the panel. */
+    guint begin = page_begin ? page_begin - 1 : 0;
+    guint end = MIN (page_begin + page_size + 1, size);
+    for (guint i = begin; i < end; i++)
+        append_text_digest (digest, table.getCandidate (i));
+
+    for (guint i = 0; i < page_size; i++) {
+        IBusText *label = ibus_lookup_table_get_label (lookup_table, i);
+        if (label == NULL)
+            break;
+        append_text_digest (digest, label);
     }
 
-    return TRUE;
+    if (digest == m_lookup_table_digest)
+        return;
+    m_lookup_table_digest.swap (digest);
+
+    ibus_engine_update_lookup_table_fast (m_engine, table, visible);
+}
+
+#if IBUS_CHECK_VERSION(1, 5, 4)
+void
+Engine::setContentType (guint purpose, guint hints)
+{
+    m_input_purpose = (IBusInputPurpose) purpose;
+}
+#endif
+
+Engine::~Engine (void)
+{
 }
 
 };
@@ -21,11 +21,15 @@
 #define __PY_ENGINE_H_
 
 #include <ibus.h>
+#include <string>
+#include <vector>
+#include <map>
 
 #include "PYPointer.h"
 #include "PYLookupTable.h"
 #include "PYProperty.h"
 #include "PYEditor.h"
+#include "PYTrace.h"
 
 namespace PY {
 
@@ -34,7 +38,7 @@ namespace PY {
 
 GType   ibus_pinyin_engine_get_type    (void);
 
-class Engine {
+class Engine : public EditorSink {
 public:
     Engine (IBusEngine *engine);
     virtual ~Engine (void);
@@ -58,83 +62,87 @@ public:
     virtual gboolean propertyActivate (const gchar *prop_name, guint prop_state) = 0;
     virtual void candidateClicked (guint index, guint button, guint state) = 0;
 
-protected:
-    void commitText (Text & text) const
-    {
-        ibus_engine_commit_text (m_engine, text);
-    }
-
-    void updatePreeditText (Text & text, guint cursor, gboolean visible) const
-    {
-        ibus_engine_update_preedit_text (m_engine, text, cursor, visible);
-    }
-
-    void showPreeditText (void) const
-    {
-        ibus_engine_show_preedit_text (m_engine);
-    }
-
-    void hidePreeditText (void) const
-    {
-        ibus_engine_hide_preedit_text (m_engine);
-    }
+    /* the input mode, recorded by the key recorder. */
+    virtual gint inputMode (void) const { return 0; }
 
-    void updateAuxiliaryText (Text & text, gboolean visible) const
-    {
-        ibus_engine_update_auxiliary_text (m_engine, text, visible);
-    }
+    /* hold the updates of the editors until the last endUpdate. */
+    void beginUpdate (void) { m_update_depth ++; }
+    void endUpdate (void);
 
-    void showAuxiliaryText (void) const
+protected:
+    /* the editor sink, called by the editors directly. */
+    virtual void commitText (Text & text)
     {
-        ibus_engine_show_auxiliary_text (m_engine);
+        /* some clients drop the preedit text on the commit. */
+        m_preedit_digest.clear ();
+        ibus_engine_commit_text (m_engine, text);
     }
 
-    void hideAuxiliaryText (void) const
-    {
-        ibus_engine_hide_auxiliary_text (m_engine);
-    }
+    /* in the update transaction only the latest states are kept, and
+       they are sent once when the transaction ends. */
+    virtual void updatePreeditText (Text & text, guint cursor, gboolean visible);
+    virtual void showPreeditText (void);
+    virtual void hidePreeditText (void);
 
-    void updateLookupTable (LookupTable &table, gboolean visible) const
-    {
-        ibus_engine_update_lookup_table (m_engine, table, visible);
-    }
+    virtual void updateAuxiliaryText (Text & text, gboolean visible);
+    virtual void showAuxiliaryText (void);
+    virtual void hideAuxiliaryText (void);
 
-    void updateLookupTableFast (LookupTable &table, gboolean visible) const
-    {
-        ibus_engine_update_lookup_table_fast (m_engine, table, visible);
-    }
+    /* only the visible page and its neighbours are sent,
+       and nothing is sent when they are unchanged. */
+    virtual void updateLookupTable (LookupTable &table, gboolean visible);
 
-    void showLookupTable (void) const
+    virtual void updateLookupTableFast (LookupTable &table, gboolean visible)
     {
-        ibus_engine_show_lookup_table (m_engine);
+        updateLookupTable (table, visible);
     }
 
-    void hideLookupTable (void) const
-    {
-        ibus_engine_hide_lookup_table (m_engine);
-    }
+    virtual void showLookupTable (void);
+    virtual void hideLookupTable (void);
 
-    void registerProperties (PropList & props) const
-    {
-        ibus_engine_register_properties (m_engine, props);
-    }
+    /* nothing is sent when the panel already has the same properties,
+       and the updates of one property are sent once in the transaction. */
+    void registerProperties (PropList & props);
+    void updateProperty (Property & prop);
 
-    void updateProperty (Property & prop) const
-    {
-        ibus_engine_update_property (m_engine, prop);
-    }
+private:
+    void flushUpdate (void);
+    void sendProperty (IBusProperty *prop);
+    void sendLookupTable (LookupTable &table, gboolean visible);
 
 protected:
     Pointer<IBusEngine>  m_engine;      // engine pointer
 
+    /* the visible page of the last sent lookup table. */
+    std::string m_lookup_table_digest;
+
+    /* the last sent preedit and auxiliary texts. */
+    std::string m_preedit_digest;
+    std::string m_auxiliary_digest;
+
+    /* the keys of the registered properties in order,
+       and the last sent state of each property. */
+    std::string m_properties_keys;
+    std::map<std::string, std::string> m_property_digests;
+
+    /* the pending updates of the transaction. */
+    guint m_update_depth;
+    guint m_update_flags;
+    Pointer<IBusText> m_preedit_text;
+    guint m_preedit_cursor;
+    gboolean m_preedit_visible;
+    Pointer<IBusText> m_auxiliary_text;
+    gboolean m_auxiliary_visible;
+    LookupTable *m_lookup_table;
+    gboolean m_lookup_table_visible;
+    /* owned by the properties of the engine. */
+    std::vector<IBusProperty *> m_pending_properties;
+
 #if IBUS_CHECK_VERSION (1, 5, 4)
     IBusInputPurpose m_input_purpose;
 #endif
 
 };
 
-gboolean pinyin_accelerator_name(guint keyval, guint modifiers,
-                                 std::string & name);
-
 };
 #endif
@@ -22,6 +22,9 @@
 #include <string.h>
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
 #include <stdio.h>
 #include <libintl.h>
 #include <sqlite3.h>
@@ -29,30 +32,44 @@
 #include <glib/gstdio.h>
 #include "PYConfig.h"
 #include "PYString.h"
+#include "PYTypes.h"
+#include "PYPrefixIndex.h"
+#include "PYDeletionIndex.h"
+#include "PYStats.h"
+#include "PYReclaim.h"
+#include "PYPersistence.h"
 
 #define _(text) (gettext(text))
 
 namespace PY {
 
-#define DB_BACKUP_TIMEOUT   (60)
+#define DB_JOURNAL_TIMEOUT   (60)
 
-class EnglishDatabase{
+/* the same as the top words of each node in the prefix index. */
+#define SYSTEM_DB_LIST_LIMIT (64)
+
+/* the spelling corrections are searched at most 2ms per key,
+   the short words only allow one typo. */
+#define CORRECTION_TIME_BUDGET      (2 * 1000)
+#define CORRECTION_SHORT_WORD       (4)
+
+class EnglishDatabase : public Reclaimable {
 public:
     EnglishDatabase(){
         m_sqlite = NULL;
         m_sql = "";
         m_user_db = "";
-        m_timeout_id = 0;
-        m_timer = g_timer_new ();
+        for (guint i = 0; i < STMT_LAST; ++i)
+            m_statements[i] = NULL;
+        Persistence::add (STORE_ENGLISH_USER_DB, DB_JOURNAL_TIMEOUT,
+                          EnglishDatabase::saveCallback, this);
     }
 
     ~EnglishDatabase(){
-        g_timer_destroy (m_timer);
-        if (m_timeout_id != 0) {
-            saveUserDB ();
-            g_source_remove (m_timeout_id);
-        }
+        Persistence::remove (STORE_ENGLISH_USER_DB, this);
+        flushJournal ();
 
+        finalizeStatements ();
         if (m_sqlite){
             sqlite3_close (m_sqlite);
             m_sqlite = NULL;
@@ -160,6 +177,10 @@ public:
             return FALSE;
         }
 
+        /* the user db is attached later, and keeps its own page cache. */
+        m_sql.printf ("PRAGMA main.mmap_size = %d;", SYSTEM_DB_MMAP_SIZE);
+        executeSQL (m_sqlite);
+
 #if 0
         m_sql.printf (SQL_ATTACH_DB, user_db);
         if (!executeSQL (m_sqlite)) {
@@ -169,86 +190,325 @@ public:
         }
         return TRUE;
 #endif
-        return loadUserDB();
+        if (!loadUserDB ())
+            return FALSE;
+        return loadUserWords ();
+    }
+
+    /* Load the prefix index of the system word list. */
+    gboolean openIndex(const char *filename){
+        return m_index.load (filename);
+    }
+
+    /* Load the deletion index for the spelling corrections. */
+    gboolean openDeletionIndex(const char *filename){
+        return m_deletion_index.load (filename);
+    }
+
+    /* List the words within the edit distance of the input, ranked by
+       the distance and the freq merged with the user words. */
+    gboolean listCorrections(const char *input, std::vector<std::string> & words){
+        words.clear ();
+
+        if (!m_deletion_index.isLoaded ())
+            return FALSE;
+
+        guint max_distance = strlen (input) <= CORRECTION_SHORT_WORD ? 1 : 2;
+        gint64 deadline = g_get_monotonic_time () + CORRECTION_TIME_BUDGET;
+
+        std::vector<DeletionIndex::Word> corrections;
+        if (!m_deletion_index.listCorrections (input, max_distance, deadline,
+                                               corrections))
+            return FALSE;
+
+        std::map<std::string, Correction> merged;
+        for (size_t i = 0; i < corrections.size (); ++i) {
+            Correction & correction = merged[corrections[i].word];
+            correction.distance = corrections[i].distance;
+            correction.freq += corrections[i].value;
+        }
+
+        /* the user words are few, check them one by one. */
+        std::map<std::string, float>::const_iterator iter;
+        for (iter = m_user_words.begin (); iter != m_user_words.end (); ++iter) {
+            guint distance = DeletionIndex::editDistance
+                (input, iter->first.c_str (), max_distance);
+            if (distance > max_distance)
+                continue;
+
+            Correction & correction = merged[iter->first];
+            correction.distance = distance;
+            correction.freq += iter->second;
+        }
+
+        std::vector<std::pair<std::string, Correction> > sorted
+            (merged.begin (), merged.end ());
+        std::sort (sorted.begin (), sorted.end (), compareCorrection);
+
+        words.reserve (sorted.size ());
+        for (size_t i = 0; i < sorted.size (); ++i)
+            words.push_back (sorted[i].first);
+        return TRUE;
     }
 
     /* List the words in freq order. */
     gboolean listWords(const char *prefix, std::vector<std::string> & words){
-        sqlite3_stmt *stmt = NULL;
-        const char *tail = NULL;
+        if (m_index.isLoaded ())
+            return listIndexedWords (prefix, words);
+
+        StatsScope stats (STATS_ENGLISH_QUERIES);
         words.clear ();
 
-        /* list words */
-        const char *SQL_DB_LIST = 
-            "SELECT word FROM ( "
-            "SELECT * FROM english UNION ALL SELECT * FROM userdb.english) "
-            " WHERE word LIKE \"%s%\" GROUP BY word ORDER BY SUM(freq) DESC;";
-        m_sql.printf (SQL_DB_LIST, prefix);
-        int result = sqlite3_prepare_v2 (m_sqlite, m_sql.c_str(), -1, &stmt, &tail);
-        if (result != SQLITE_OK)
+        sqlite3_stmt *stmt = getStatement (STMT_LIST_WORDS);
+        if (stmt == NULL)
             return FALSE;
+        sqlite3_bind_text (stmt, 1, prefix, -1, SQLITE_STATIC);
+        sqlite3_bind_int (stmt, 2, SYSTEM_DB_LIST_LIMIT);
 
-        result = sqlite3_step (stmt);
+        std::map<std::string, float> merged;
+        int result = sqlite3_step (stmt);
         while (result == SQLITE_ROW){
             /* get the words. */
             result = sqlite3_column_type (stmt, 0);
-            if (result != SQLITE_TEXT)
+            if (result != SQLITE_TEXT) {
+                sqlite3_reset (stmt);
                 return FALSE;
+            }
 
             const char *word = (const char *)sqlite3_column_text (stmt, 0);
-            words.push_back (word);
+            merged[word] += sqlite3_column_double (stmt, 1);
             result = sqlite3_step (stmt);
         }
 
-        sqlite3_finalize (stmt);
+        sqlite3_reset (stmt);
         if (result != SQLITE_DONE)
             return FALSE;
+
+        mergeUserWords (prefix, merged, words);
         return TRUE;
     }
 
     /* Get the freq of user sqlite db. */
     gboolean getWordInfo(const char *word, float & freq){
-        sqlite3_stmt *stmt = NULL;
-        const char *tail = NULL;
-        /* get word info. */
-        const char *SQL_DB_SELECT = 
-            "SELECT freq FROM userdb.english WHERE word = \"%s\";";
-        m_sql.printf (SQL_DB_SELECT, word);
-        int result = sqlite3_prepare_v2 (m_sqlite, m_sql.c_str(), -1, &stmt, &tail);
-        g_assert (result == SQLITE_OK);
-        result = sqlite3_step (stmt);
-        if (result != SQLITE_ROW)
-            return FALSE;
-        result = sqlite3_column_type (stmt, 0);
-        if (result != SQLITE_FLOAT)
+        flushJournal ();
+
+        StatsScope stats (STATS_ENGLISH_QUERIES);
+        sqlite3_stmt *stmt = getStatement (STMT_GET_WORD_INFO);
+        if (stmt == NULL)
             return FALSE;
-        freq = sqlite3_column_double (stmt, 0);
-        result = sqlite3_finalize (stmt);
-        g_assert (result == SQLITE_OK);
-        return TRUE;
+        sqlite3_bind_text (stmt, 1, word, -1, SQLITE_STATIC);
+
+        gboolean retval = FALSE;
+        if (sqlite3_step (stmt) == SQLITE_ROW &&
+            sqlite3_column_type (stmt, 0) == SQLITE_FLOAT) {
+            freq = sqlite3_column_double (stmt, 0);
+            retval = TRUE;
+        }
+        sqlite3_reset (stmt);
+        return retval;
     }
 
     /* Update the freq with delta value. */
     gboolean updateWord(const char *word, float freq){
-        const char *SQL_DB_UPDATE =
-            "UPDATE userdb.english SET freq = \"%f\" WHERE word = \"%s\";";
-        m_sql.printf (SQL_DB_UPDATE, freq, word);
-        gboolean retval =  executeSQL (m_sqlite);
-        modified ();
+        flushJournal ();
+
+        sqlite3_stmt *stmt = getStatement (STMT_UPDATE_WORD);
+        if (stmt == NULL)
+            return FALSE;
+        sqlite3_bind_double (stmt, 1, freq);
+        sqlite3_bind_text (stmt, 2, word, -1, SQLITE_STATIC);
+
+        gboolean retval = stepStatement (stmt);
+        if (retval)
+            m_user_words[word] = freq;
         return retval;
     }
 
     /* Insert the word into user db with the initial freq. */
     gboolean insertWord(const char *word, float freq){
-        const char *SQL_DB_INSERT =
-            "INSERT INTO userdb.english (word, freq) VALUES (\"%s\", \"%f\");";
-        m_sql.printf (SQL_DB_INSERT, word, freq);
-        gboolean retval = executeSQL (m_sqlite);
-        modified ();
+        flushJournal ();
+
+        sqlite3_stmt *stmt = getStatement (STMT_INSERT_WORD);
+        if (stmt == NULL)
+            return FALSE;
+        sqlite3_bind_text (stmt, 1, word, -1, SQLITE_STATIC);
+        sqlite3_bind_double (stmt, 2, freq);
+
+        gboolean retval = stepStatement (stmt);
+        if (retval)
+            m_user_words[word] = freq;
         return retval;
     }
 
+    /* Add the delta to the freq, insert the word when not found,
+       the delta is written to user db later by flushJournal. */
+    gboolean trainWord(const char *word, float delta){
+        if (m_sqlite == NULL)
+            return FALSE;
+
+        m_journal.push_back (std::make_pair (std::string (word), delta));
+        m_user_words[word] += delta;
+        modified ();
+        return TRUE;
+    }
+
+    gboolean isIndexed (void) const { return m_index.isLoaded (); }
+
+    /* drop the page cache of sqlite when idle. */
+    void reclaim (void){
+        if (m_sqlite)
+            sqlite3_db_release_memory (m_sqlite);
+        Stats::setMax (STATS_SQLITE_HIGH_WATER,
+                       sqlite3_memory_highwater (FALSE) / 1024);
+    }
+
 private:
+    struct Correction {
+        guint distance;
+        float freq;
+
+        Correction () : distance (0), freq (0) { }
+    };
+
+    static bool compareCorrection (const std::pair<std::string, Correction> & lhs,
+                                   const std::pair<std::string, Correction> & rhs){
+        if (lhs.second.distance != rhs.second.distance)
+            return lhs.second.distance < rhs.second.distance;
+        if (lhs.second.freq != rhs.second.freq)
+            return lhs.second.freq > rhs.second.freq;
+        return lhs.first < rhs.first;
+    }
+
+    static bool compareWord (const std::pair<std::string, float> & lhs,
+                             const std::pair<std::string, float> & rhs){
+        if (lhs.second != rhs.second)
+            return lhs.second > rhs.second;
+        return lhs.first < rhs.first;
+    }
+
+    /* Merge the top words of the system index with the user words. */
+    gboolean listIndexedWords(const char *prefix, std::vector<std::string> & words){
+        words.clear ();
+
+        std::vector<PrefixIndex::Word> system_words;
+        if (!m_index.listWords (prefix, system_words))
+            return FALSE;
+
+        std::map<std::string, float> merged;
+        for (size_t i = 0; i < system_words.size (); ++i)
+            merged[system_words[i].word] += system_words[i].value;
+
+        mergeUserWords (prefix, merged, words);
+        return TRUE;
+    }
+
+    /* Merge the user words of the prefix, and sort by the freq. */
+    void mergeUserWords(const char *prefix, std::map<std::string, float> & merged,
+                        std::vector<std::string> & words){
+        /* the user words are few, match them case insensitively. */
+        size_t len = strlen (prefix);
+        std::map<std::string, float>::const_iterator iter;
+        for (iter = m_user_words.begin (); iter != m_user_words.end (); ++iter) {
+            if (0 == g_ascii_strncasecmp (iter->first.c_str (), prefix, len))
+                merged[iter->first] += iter->second;
+        }
+
+        std::vector<std::pair<std::string, float> > sorted
+            (merged.begin (), merged.end ());
+        std::sort (sorted.begin (), sorted.end (), compareWord);
+
+        words.reserve (sorted.size ());
+        for (size_t i = 0; i < sorted.size (); ++i)
+            words.push_back (sorted[i].first);
+    }
+
+    /* Cache the user words for the lookup. */
+    gboolean loadUserWords (void){
+        sqlite3_stmt *stmt = NULL;
+        const char *tail = NULL;
+        m_user_words.clear ();
+
+        const char *SQL_DB_USER_WORDS =
+            "SELECT word, freq FROM userdb.english;";
+        int result = sqlite3_prepare_v2 (m_sqlite, SQL_DB_USER_WORDS, -1, &stmt, &tail);
+        if (result != SQLITE_OK)
+            return FALSE;
+
+        result = sqlite3_step (stmt);
+        while (result == SQLITE_ROW){
+            const char *word = (const char *) sqlite3_column_text (stmt, 0);
+            if (word)
+                m_user_words[word] = sqlite3_column_double (stmt, 1);
+            result = sqlite3_step (stmt);
+        }
+
+        sqlite3_finalize (stmt);
+        return result == SQLITE_DONE;
+    }
+
+    enum {
+        STMT_LIST_WORDS = 0,
+        STMT_GET_WORD_INFO,
+        STMT_UPDATE_WORD,
+        STMT_INSERT_WORD,
+        STMT_TRAIN_WORD,
+        STMT_LAST
+    };
+
+    /* Prepare the statement on first use, then reuse it. */
+    sqlite3_stmt *getStatement(guint index){
+        static const char * const SQL_STATEMENTS[STMT_LAST] = {
+            /* STMT_LIST_WORDS */
+            "SELECT word, freq FROM main.english "
+            "WHERE word COLLATE NOCASE >= ?1 "
+            "AND word COLLATE NOCASE < ?1 || x'ff' "
+            "ORDER BY freq DESC LIMIT ?2;",
+            /* STMT_GET_WORD_INFO */
+            "SELECT freq FROM userdb.english WHERE word = ?1;",
+            /* STMT_UPDATE_WORD */
+            "UPDATE userdb.english SET freq = ?1 WHERE word = ?2;",
+            /* STMT_INSERT_WORD */
+            "INSERT INTO userdb.english (word, freq) VALUES (?1, ?2);",
+            /* STMT_TRAIN_WORD */
+            "INSERT INTO userdb.english (word, freq) VALUES (?1, ?2) "
+            "ON CONFLICT (word) DO UPDATE SET freq = freq + excluded.freq;",
+        };
+
+        g_assert (index < STMT_LAST);
+        sqlite3_stmt *stmt = m_statements[index];
+        if (stmt) {
+            sqlite3_reset (stmt);
+            sqlite3_clear_bindings (stmt);
+            return stmt;
+        }
+
+        if (sqlite3_prepare_v2 (m_sqlite, SQL_STATEMENTS[index], -1,
+                                &stmt, NULL) != SQLITE_OK) {
+            g_warning ("%s: %s", sqlite3_errmsg (m_sqlite),
+                       SQL_STATEMENTS[index]);
+            return NULL;
+        }
+        m_statements[index] = stmt;
+        return stmt;
+    }
+
+    gboolean stepStatement(sqlite3_stmt *stmt){
+        StatsScope stats (STATS_ENGLISH_QUERIES);
+        int result = sqlite3_step (stmt);
+        if (result != SQLITE_DONE)
+            g_warning ("%s: %s", sqlite3_errmsg (m_sqlite), sqlite3_sql (stmt));
+        sqlite3_reset (stmt);
+        return result == SQLITE_DONE;
+    }
+
+    void finalizeStatements(void){
+        for (guint i = 0; i < STMT_LAST; ++i) {
+            if (m_statements[i])
+                sqlite3_finalize (m_statements[i]);
+            m_statements[i] = NULL;
+        }
+    }
+
     gboolean executeSQL(sqlite3 *sqlite){
         gchar *errmsg = NULL;
         if (sqlite3_exec (sqlite, m_sql.c_str (), NULL, NULL, &errmsg)
@@ -261,125 +521,177 @@ private:
         return TRUE;
     }
 
+    /* Attach the user database in WAL mode, written in place. */
     gboolean loadUserDB (void){
-        sqlite3 *userdb =  NULL;
-        /* Attach user database */
-        do {
-            const char *SQL_ATTACH_DB =
-                "ATTACH DATABASE ':memory:' AS userdb;";
-            m_sql.printf (SQL_ATTACH_DB);
-            if (!executeSQL (m_sqlite))
-                break;
-
-            /* Note: user db is always created by openDatabase. */
-            if (sqlite3_open_v2 ( m_user_db, &userdb,
-                                  SQLITE_OPEN_READWRITE |
-                                  SQLITE_OPEN_CREATE, NULL) != SQLITE_OK)
-                break;
+        sqlite3_stmt *stmt = NULL;
+        const char *SQL_ATTACH_DB =
+            "ATTACH DATABASE ?1 AS userdb;";
 
-            sqlite3_backup *backup = sqlite3_backup_init (m_sqlite, "userdb", userdb, "main");
+        /* Note: user db is always created by openDatabase. */
+        if (sqlite3_prepare_v2 (m_sqlite, SQL_ATTACH_DB, -1,
+                                &stmt, NULL) != SQLITE_OK)
+            return FALSE;
+        sqlite3_bind_text (stmt, 1, m_user_db, -1, SQLITE_STATIC);
+        int result = sqlite3_step (stmt);
+        sqlite3_finalize (stmt);
+        if (result != SQLITE_DONE)
+            return FALSE;
 
-            if (backup) {
-                sqlite3_backup_step (backup, -1);
-                sqlite3_backup_finish (backup);
-            }
+        m_sql = "PRAGMA userdb.journal_mode = WAL;\n";
+        m_sql << "PRAGMA userdb.synchronous = NORMAL;\n";
+        return executeSQL (m_sqlite);
+    }
 
-            sqlite3_close (userdb);
+    /* Apply the trained deltas to user db in one transaction,
+       the cost is proportional to the changes since last flush. */
+    gboolean flushJournal (void){
+        if (m_journal.empty ())
             return TRUE;
-        } while (0);
-
-        if (userdb)
-            sqlite3_close (userdb);
-        return FALSE;
-    }
 
-    gboolean saveUserDB (void){
-        sqlite3 *userdb = NULL;
-        String tmpfile = String(m_user_db) + "-tmp";
-        do {
-            /* remove tmpfile if it exist */
-            g_unlink(tmpfile);
+        m_sql = "BEGIN TRANSACTION;";
+        if (!executeSQL (m_sqlite))
+            return FALSE;
 
-            if (sqlite3_open_v2 (tmpfile, &userdb,
-                                 SQLITE_OPEN_READWRITE |
-                                 SQLITE_OPEN_CREATE, NULL) != SQLITE_OK)
+        gboolean retval = TRUE;
+        for (size_t i = 0; i < m_journal.size (); ++i) {
+            sqlite3_stmt *stmt = getStatement (STMT_TRAIN_WORD);
+            if (stmt == NULL) {
+                retval = FALSE;
                 break;
-
-            sqlite3_backup *backup = sqlite3_backup_init (userdb, "main", m_sqlite, "userdb");
-
-            if (backup == NULL)
+            }
+            sqlite3_bind_text (stmt, 1, m_journal[i].first.c_str (), -1,
+                               SQLITE_STATIC);
+            sqlite3_bind_double (stmt, 2, m_journal[i].second);
+            if (!stepStatement (stmt)) {
+                retval = FALSE;
                 break;
+            }
+        }
 
-            sqlite3_backup_step (backup, -1);
-            sqlite3_backup_finish (backup);
-            sqlite3_close (userdb);
+        m_sql = retval ? "COMMIT;" : "ROLLBACK;";
+        retval = executeSQL (m_sqlite) && retval;
 
-            g_rename(tmpfile, m_user_db);
-            return TRUE;
-        } while (0);
-
-        if (userdb)
-            sqlite3_close (userdb);
-        g_unlink (tmpfile);
-        return FALSE;
+        /* keep the deltas to retry later. */
+        if (retval)
+            m_journal.clear ();
+        return retval;
     }
 
+    /* the journal is flushed by Persistence after it is idle. */
     void modified (void){
-        /* Restart the timer */
-        g_timer_start (m_timer);
-
-        if (m_timeout_id != 0)
-            return;
-
-        m_timeout_id = g_timeout_add_seconds (DB_BACKUP_TIMEOUT,
-                                              EnglishDatabase::timeoutCallback,
-                                              static_cast<gpointer> (this));
+        Persistence::modified (STORE_ENGLISH_USER_DB);
     }
 
-    static gboolean timeoutCallback (gpointer data){
+    static gboolean saveCallback (gpointer data){
         EnglishDatabase *self = static_cast<EnglishDatabase *> (data);
-
-        /* Get elapsed time since last modification of database. */
-        guint elapsed = (guint) g_timer_elapsed (self->m_timer, NULL);
-
-        if (elapsed >= DB_BACKUP_TIMEOUT &&
-            self->saveUserDB ()) {
-            self->m_timeout_id = 0;
-            return FALSE;
-        }
-
-        return TRUE;
+        return self->flushJournal ();
     }
 
     sqlite3 *m_sqlite;
     String m_sql;
     const char *m_user_db;
+    sqlite3_stmt *m_statements[STMT_LAST];
+
+    PrefixIndex m_index;
+    DeletionIndex m_deletion_index;
+    std::map<std::string, float> m_user_words;
 
-    guint m_timeout_id;
-    GTimer *m_timer;
+    /* the trained deltas not written to user db yet. */
+    std::vector<std::pair<std::string, float> > m_journal;
 };
 
-EnglishEditor::EnglishEditor (PinyinProperties & props, Config &config)
-    : Editor (props, config), m_train_factor (0.1)
+/* opened by the first English editor, closed with the last one. */
+static std::weak_ptr<EnglishDatabase> english_database;
+
+static std::shared_ptr<EnglishDatabase>
+open_english_database (void)
 {
-    m_english_database = new EnglishDatabase;
+    std::shared_ptr<EnglishDatabase> database = english_database.lock ();
+    if (database)
+        return database;
+
+    database.reset (new EnglishDatabase);
 
     gchar *path = g_build_filename (g_get_user_cache_dir (),
                                      "ibus", "libpinyin", "english-user.db", NULL);
 
-    gboolean result = m_english_database->openDatabase
+    gboolean result = database->openDatabase
         (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "english.db",
          "english-user.db") ||
-        m_english_database->openDatabase
+        database->openDatabase
         (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "english.db", path);
     if (!result)
         g_warning ("can't open English word list database.\n");
+
+    /* fall back to the sql query without the index. */
+    if (result &&
+        !database->openIndex
+        (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "english.index"))
+        database->openIndex
+            (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "english.index");
+
+    /* no spelling corrections without the deletion index. */
+    if (result &&
+        !database->openDeletionIndex
+        (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "english.deletes"))
+        database->openDeletionIndex
+            (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "english.deletes");
+
+    english_database = database;
+    return database;
+}
+
+EnglishWords::EnglishWords (void)
+{
+}
+
+EnglishWords::~EnglishWords (void)
+{
+}
+
+gboolean
+EnglishWords::open (void)
+{
+    if (G_UNLIKELY (!m_database))
+        m_database = open_english_database ();
+    return m_database->isIndexed ();
+}
+
+gboolean
+EnglishWords::listWords (const char *prefix, guint num,
+                         std::vector<std::string> & words)
+{
+    words.clear ();
+
+    if (!open ())
+        return FALSE;
+
+    /* the indexed words are at most the top words of one node. */
+    if (!m_database->listWords (prefix, words))
+        return FALSE;
+
+    if (words.size () > num)
+        words.resize (num);
+    return TRUE;
+}
+
+gboolean
+EnglishWords::train (const char *word, float delta)
+{
+    if (!m_database)
+        return FALSE;
+    return m_database->trainWord (word, delta);
+}
+
+EnglishEditor::EnglishEditor (PinyinProperties & props, Config &config)
+    : Editor (props, config), m_train_factor (0.1)
+{
+    m_english_database = open_english_database ();
 }
 
 EnglishEditor::~EnglishEditor ()
 {
-    delete m_english_database;
-    m_english_database = NULL;
+    m_english_database.reset ();
 }
 
 gboolean
@@ -635,6 +947,17 @@ EnglishEditor::updateStateFromInput (void)
     if (!retval)
         return FALSE;
 
+    /* fill the first page with the spelling corrections. */
+    std::vector<std::string> corrections;
+    if (words.size () < m_lookup_table.pageSize () &&
+        m_english_database->listCorrections (prefix.c_str (), corrections)) {
+        std::set<std::string> listed (words.begin (), words.end ());
+        for (size_t i = 0; i < corrections.size (); ++i) {
+            if (listed.insert (corrections[i]).second)
+                words.push_back (corrections[i]);
+        }
+    }
+
     clearLookupTable ();
     std::vector<std::string>::iterator iter;
     for (iter = words.begin (); iter != words.end (); ++iter){
@@ -775,15 +1098,7 @@ EnglishEditor::removeCharAfter (void)
 gboolean
 EnglishEditor::train (const char *word, float delta)
 {
-    float freq = 0;
-    gboolean retval = m_english_database->getWordInfo (word, freq);
-    if (retval) {
-        freq += delta;
-        m_english_database->updateWord (word, freq);
-    } else {
-        m_english_database->insertWord (word, delta);
-    }
-    return TRUE;
+    return m_english_database->trainWord (word, delta);
 }
 
 #if 0
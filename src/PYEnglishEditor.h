@@ -21,6 +21,8 @@
 #ifndef __PY_ENGLISH_EDITOR_
 #define __PY_ENGLISH_EDITOR_
 
+#include <string>
+#include <vector>
 #include "PYEditor.h"
 #include "PYLookupTable.h"
 
@@ -74,11 +76,33 @@ private:
     String m_preedit_text;
     String m_auxiliary_text;
 
-    EnglishDatabase *m_english_database;
+    /* shared by the English editors of all engines. */
+    std::shared_ptr<EnglishDatabase> m_english_database;
 
     const static int m_aux_text_len = 50;
 };
 
+/* The English words for the inline candidates of the pinyin editors,
+ * the database is shared with the English editors and opened on the
+ * first lookup. */
+class EnglishWords {
+public:
+    EnglishWords (void);
+    ~EnglishWords (void);
+
+    /* open the database, TRUE when the prefix index is loaded,
+       the sql query is too slow for each key. */
+    gboolean open (void);
+
+    /* list at most num words of the prefix in freq order. */
+    gboolean listWords (const char *prefix, guint num,
+                        std::vector<std::string> & words);
+    gboolean train (const char *word, float delta);
+
+private:
+    std::shared_ptr<EnglishDatabase> m_database;
+};
+
 };
 
 #endif
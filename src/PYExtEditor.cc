@@ -24,6 +24,8 @@
 #include "PYConfig.h"
 #include "PYPointer.h"
 #include "PYLookupTable.h"
+#include "PYChineseNumber.h"
+#include "PYStats.h"
 
 #include "PYEditor.h"
 #include "PYExtEditor.h"
@@ -31,117 +33,6 @@
 namespace PY {
 
 
-static const char * numbers [2][10] = {
-    {"零", "壹", "贰", "叁", "肆", "伍", "陆", "柒", "捌", "玖",},
-    {"〇", "一", "二", "三", "四", "五", "六", "七", "八", "九",},
-};
-
-struct unit_t{
-    const char * unit_zh_name;  // Chinese Character
-    const int digits;           // Position in string.
-    const bool persist;         // Whether to force eating zero and force inserting into result string.
-};
-
-static unit_t units_simplified[] ={
-    {"兆", 12, true},
-    {"亿", 8, true},
-    {"万", 4, true},
-    {"千", 3, false},
-    {"百", 2, false},
-    {"十", 1, false},
-    {"",   0, true},
-};
-
-static unit_t units_traditional[] ={
-    {"兆", 12, true},
-    {"亿", 8, true},
-    {"万", 4, true},
-    {"仟", 3, false},
-    {"佰", 2, false},
-    {"拾", 1, false},
-    {"",   0, true},
-};
-
-
-static const std::string
-simplest_cn_number(gint64 num)
-{
-    std::string result = "";
-    if ( num == 0 )
-        result = numbers[1][0];
-    while (num > 0) {
-        int remains = num % 10;
-        num = num / 10;
-        result = std::string ( numbers[1][remains] ) + result;
-    }
-
-    return result;
-}
-
-static inline const std::string
-translate_to_longform(gint64 num, const char * number[10], unit_t units[], int units_len)
-{
-    std::string result = "";
-    int cur_pos = -1;
-    bool eat_zero = false;
-
-    while (num > 0) {
-        int remains = num % 10;
-        num = num / 10;
-        cur_pos ++;
-        std::string unit = "";
-        int pos = cur_pos;
-        size_t i = 6;
-        while ( pos > 0 ) {
-            for ( i = 0; i < units_len; ++i) {
-                pos = pos % units[i].digits;
-                if ( pos == 0 )
-                    break;
-            }
-        }
-
-        if ( units[i].persist ) {
-            result = std::string (units[i].unit_zh_name) + result;
-            eat_zero = true;
-        }
-
-        if ( remains == 0){
-            if ( eat_zero ) continue;
-
-            result = std::string (number[0]) + result;
-            eat_zero = true;
-            continue;
-        }else{
-            eat_zero = false;
-        }
-
-        if (num == 0 && remains == 1 && i == 5)
-            result = std::string (units[i].unit_zh_name) + result;
-        else if (units[i].persist)
-            result = std::string (number[remains]) + result;
-        else
-            result = std::string (number[remains]) + std::string (units[i].unit_zh_name) + result;
-    }
-
-    return result;
-}
-
-static const std::string
-simplified_number(gint64 num)
-{
-    return translate_to_longform(num, numbers[1], units_simplified, G_N_ELEMENTS(units_simplified));
-}
-
-static const std::string
-traditional_number(gint64 num)
-{
-    if ( 0 == num )
-        return numbers[0][0];
-    return translate_to_longform(num, numbers[0], units_traditional, G_N_ELEMENTS(units_traditional));
-}
-
-
-
 /* Write digit/alpha/none Label generator here.
  * foreach (results): 1, from get_retval; 2..n from get_retvals.
  */
@@ -151,13 +42,20 @@ ExtEditor::ExtEditor (PinyinProperties & props, Config & config)
       m_mode (LABEL_NONE),
       m_result_num (0),
       m_candidate (NULL),
-      m_candidates (NULL)
+      m_candidates (NULL),
+      m_iterator (LUA_NOREF)
+{
+}
+
+ExtEditor::~ExtEditor (void)
 {
+    clearCommandResults ();
 }
 
 gboolean
 ExtEditor::setLuaPlugin (IBusEnginePlugin *plugin)
 {
+    clearCommandResults ();
     m_lua_plugin = plugin;
     return TRUE;
 }
@@ -395,6 +293,10 @@ ExtEditor::pageUp (void)
 void
 ExtEditor::pageDown (void)
 {
+    guint page_size = m_lookup_table.pageSize ();
+    guint cursor_pos = m_lookup_table.cursorPos ();
+    fetchCommandResults ((cursor_pos / page_size + 3) * page_size);
+
     if (G_LIKELY(m_lookup_table.pageDown ())) {
         update ();
     }
@@ -446,6 +348,10 @@ ExtEditor::cursorUp (void)
 void
 ExtEditor::cursorDown (void)
 {
+    guint page_size = m_lookup_table.pageSize ();
+    guint cursor_pos = m_lookup_table.cursorPos ();
+    fetchCommandResults ((cursor_pos / page_size + 2) * page_size);
+
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
         update ();
     }
@@ -505,22 +411,15 @@ ExtEditor::selectCandidate (guint index)
     case LABEL_LIST_COMMANDS:
         {
             std::string prefix = m_text.substr (1, 2);
-            int len = prefix.length ();
-            const char * prefix_str = prefix.c_str ();
             const GArray * commands = ibus_engine_plugin_get_available_commands (m_lua_plugin);
-            int match_count = -1;
-            for (int i = 0; i < static_cast<int>(commands->len); ++i) {
-                lua_command_t * command = &g_array_index (commands, lua_command_t, i);
-                if ( strncmp (prefix_str, command->command_name, len) == 0 ) {
-                    match_count++;
-                }
-                if ( match_count == static_cast<int>(index) ) {
-                    m_text.clear ();
-                    m_text = "i";
-                    m_text += command->command_name;
-                    m_cursor = m_text.length ();
-                    break;
-                }
+            guint begin = 0, end = 0;
+            ibus_engine_plugin_lookup_commands (m_lua_plugin, prefix.c_str (), &begin, &end);
+            if ( index < end - begin ) {
+                lua_command_t * command = &g_array_index (commands, lua_command_t, begin + index);
+                m_text.clear ();
+                m_text = "i";
+                m_text += command->command_name;
+                m_cursor = m_text.length ();
             }
             updateStateFromInput ();
             update ();
@@ -531,8 +430,8 @@ ExtEditor::selectCandidate (guint index)
     case LABEL_LIST_ALPHA:
     case LABEL_LIST_NONE:
         {
-            g_return_val_if_fail (m_result_num > 1, FALSE);
-            g_return_val_if_fail (static_cast<int>(index) < m_result_num, FALSE);
+            g_return_val_if_fail (m_candidates != NULL, FALSE);
+            g_return_val_if_fail (index < m_candidates->len, FALSE);
 
             const lua_command_candidate_t * candidate = g_array_index (m_candidates, lua_command_candidate_t *, index);
             if ( candidate->content ) {
@@ -576,6 +475,8 @@ bool
 ExtEditor::updateStateFromInput (void)
 {
     /* Do parse and candidates update here. */
+    clearCommandResults ();
+
     /* prefix i double check here. */
     if ( !m_text.length () ) {
         m_preedit_text = "";
@@ -685,21 +586,17 @@ ExtEditor::fillCommandCandidates (std::string prefix)
 {
     clearLookupTable ();
 
-    /* fill candidates here. */
-    int len = prefix.length ();
-    const char * prefix_str = prefix.c_str ();
+    /* fill candidates here, the commands are sorted by name. */
     const GArray * commands = ibus_engine_plugin_get_available_commands (m_lua_plugin);
-    int count = -1;
-    for ( int i = 0; i < static_cast<int>(commands->len); ++i) {
+    guint begin = 0, end = 0;
+    ibus_engine_plugin_lookup_commands (m_lua_plugin, prefix.c_str (), &begin, &end);
+    for ( guint i = begin; i < end; ++i) {
         lua_command_t * command = &g_array_index (commands, lua_command_t, i);
-        if ( strncmp (prefix_str, command->command_name, len) == 0) {
-            count++;
-            std::string candidate = command->command_name;
-            candidate += ".";
-            candidate += command->description;
-            m_lookup_table.setLabel (count, Text (""));
-            m_lookup_table.appendCandidate (Text (candidate));
-        }
+        std::string candidate = command->command_name;
+        candidate += ".";
+        candidate += command->description;
+        m_lookup_table.setLabel (i - begin, Text (""));
+        m_lookup_table.appendCandidate (Text (candidate));
     }
 
     return true;
@@ -712,24 +609,26 @@ ExtEditor::fillCommand (std::string command_name, const char * argument)
     if ( NULL == command )
         return false;
 
-    if ( m_result_num != 0) {
-        if ( m_result_num == 1) {
-            ibus_engine_plugin_free_candidate ((lua_command_candidate_t *)m_candidate);
-            m_candidate = NULL;
-        }else{
-            for ( int i = 0; i < m_result_num; ++i) {
-                const lua_command_candidate_t * candidate = g_array_index (m_candidates, lua_command_candidate_t *, i);
-                ibus_engine_plugin_free_candidate ((lua_command_candidate_t *)candidate);
-            }
+    clearCommandResults ();
 
-            g_array_free (m_candidates, TRUE);
-            m_candidates = NULL;
-        }
-        m_result_num = 0;
-        g_assert (m_candidates == NULL && m_candidate == NULL);
+    if ( command->async ) {
+        /* the lookup table is filled when the results are ready,
+         * the previous call of the command is cancelled. */
+        ibus_engine_plugin_call_async (m_lua_plugin, command->lua_function_name,
+                                       argument, commandResultsReady, this);
+    } else {
+        StatsScope stats (STATS_LUA_CALLS);
+        m_result_num = ibus_engine_plugin_call (m_lua_plugin, command->lua_function_name, argument);
     }
 
-    m_result_num = ibus_engine_plugin_call (m_lua_plugin, command->lua_function_name, argument);
+    /* the command may return an iterator instead of all the results. */
+    if ( 0 == m_result_num ) {
+        m_iterator = ibus_engine_plugin_get_iterator (m_lua_plugin);
+        if ( LUA_NOREF != m_iterator ) {
+            m_iterator_function = command->lua_function_name;
+            m_candidates = g_array_new (TRUE, TRUE, sizeof (lua_command_candidate_t *));
+        }
+    }
 
     if ( 1 == m_result_num )
         m_mode = LABEL_LIST_SINGLE;
@@ -773,27 +672,104 @@ ExtEditor::fillCommand (std::string command_name, const char * argument)
         m_lookup_table.appendCandidate (Text (result));
     }else if (m_result_num > 1) {
         m_candidates = ibus_engine_plugin_get_retvals (m_lua_plugin);
-        for ( int i = 0; i < m_result_num; ++i) {
+        appendCommandResults (0);
+    }else if (LUA_NOREF != m_iterator) {
+        /* one more page is prefetched. */
+        fetchCommandResults (2 * m_lookup_table.pageSize ());
+    }
+
+    return true;
+}
+
+void
+ExtEditor::clearCommandResults (void)
+{
+    if ( m_candidate ) {
+        ibus_engine_plugin_free_candidate ((lua_command_candidate_t *)m_candidate);
+        m_candidate = NULL;
+    }
+
+    if ( m_candidates ) {
+        for ( guint i = 0; i < m_candidates->len; ++i) {
             const lua_command_candidate_t * candidate = g_array_index (m_candidates, lua_command_candidate_t *, i);
-            result = "";
-            if ( candidate->content ) {
-                result = candidate->content;
-                if (strstr (result.c_str (), "\n"))
-                    result = "(字符画)";
-            }
-            if ( candidate->suggest && candidate-> help ) {
-                result += candidate->suggest;
-                result += " ";
-                result += "[";
-                result += candidate->help;
-                result += "]";
-            }
+            ibus_engine_plugin_free_candidate ((lua_command_candidate_t *)candidate);
+        }
+
+        g_array_free (m_candidates, TRUE);
+        m_candidates = NULL;
+    }
+
+    if ( LUA_NOREF != m_iterator ) {
+        ibus_engine_plugin_free_iterator (m_lua_plugin, m_iterator);
+        m_iterator = LUA_NOREF;
+    }
+
+    /* drop the results of the async command not yet ready. */
+    if ( m_lua_plugin )
+        ibus_engine_plugin_cancel_async (m_lua_plugin);
+
+    m_result_num = 0;
+}
+
+void
+ExtEditor::commandResultsReady (IBusEnginePlugin *plugin,
+                                GArray *candidates,
+                                gpointer user_data)
+{
+    ExtEditor *self = static_cast<ExtEditor *> (user_data);
+
+    g_assert (NULL == self->m_candidates);
+    self->m_candidates = candidates;
+    self->m_result_num = candidates->len;
+    self->appendCommandResults (0);
+    self->updateLookupTable ();
+}
 
-            m_lookup_table.appendCandidate (Text (result));
+void
+ExtEditor::appendCommandResults (guint begin)
+{
+    std::string result;
+    for ( guint i = begin; i < m_candidates->len; ++i) {
+        const lua_command_candidate_t * candidate = g_array_index (m_candidates, lua_command_candidate_t *, i);
+        result = "";
+        if ( candidate->content ) {
+            result = candidate->content;
+            if (strstr (result.c_str (), "\n"))
+                result = "(字符画)";
         }
+        if ( candidate->suggest && candidate-> help ) {
+            result += candidate->suggest;
+            result += " ";
+            result += "[";
+            result += candidate->help;
+            result += "]";
+        }
+
+        m_lookup_table.appendCandidate (Text (result));
     }
+}
 
-    return true;
+void
+ExtEditor::fetchCommandResults (guint end)
+{
+    if ( LUA_NOREF == m_iterator || m_candidates->len >= end )
+        return;
+
+    guint begin = m_candidates->len;
+    guint num = end - begin;
+    GArray * candidates = ibus_engine_plugin_pull_iterator
+        (m_lua_plugin, m_iterator_function.c_str (), m_iterator, num);
+    g_array_append_vals (m_candidates, candidates->data, candidates->len);
+
+    /* the iterator is finished. */
+    if ( candidates->len < num ) {
+        ibus_engine_plugin_free_iterator (m_lua_plugin, m_iterator);
+        m_iterator = LUA_NOREF;
+    }
+    g_array_free (candidates, TRUE);
+
+    m_result_num = m_candidates->len;
+    appendCommandResults (begin);
 }
 
 bool
@@ -806,22 +782,19 @@ ExtEditor::fillChineseNumber(gint64 num)
             m_lookup_table.setLabel ( i - 1, Text (i - 1 + 'a') );
     }
 
-    std::string result = simplified_number(num);
-    if ( !result.empty() ){
-        Text text(result);
-        m_lookup_table.appendCandidate(text);
-    }
-
-    result = traditional_number(num);
-    if ( !result.empty() ){
-        Text text(result);
-        m_lookup_table.appendCandidate(text);
-    }
+    static const ChineseNumberStyle styles[] = {
+        CHINESE_NUMBER_SIMPLIFIED,
+        CHINESE_NUMBER_TRADITIONAL,
+        CHINESE_NUMBER_SIMPLEST,
+    };
 
-    result = simplest_cn_number(num);
-    if ( !result.empty() ){
-        Text text(result);
-        m_lookup_table.appendCandidate(text);
+    gchar buffer[CHINESE_NUMBER_BUFFER_SIZE];
+    for ( guint i = 0; i < G_N_ELEMENTS (styles); ++i ) {
+        const gchar * result = ChineseNumber::format (num, styles[i], buffer);
+        if ( *result ){
+            Text text(result);
+            m_lookup_table.appendCandidate(text);
+        }
     }
 
     return TRUE;
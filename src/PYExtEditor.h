@@ -27,6 +27,7 @@ namespace PY {
 class ExtEditor : public Editor {
 public:
     ExtEditor (PinyinProperties & props, Config & config);
+    virtual ~ExtEditor (void);
 
     virtual gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
     virtual void pageUp (void);
@@ -46,6 +47,14 @@ private:
     bool fillCommandCandidates (void);
     bool fillCommandCandidates (std::string prefix);
     bool fillCommand (std::string command_name, const char * argument);
+    void clearCommandResults (void);
+    void appendCommandResults (guint begin);
+    /* pull the results of the iterator until end. */
+    void fetchCommandResults (guint end);
+    /* fill the results of the async command when they are ready. */
+    static void commandResultsReady (IBusEnginePlugin *plugin,
+                                     GArray *candidates,
+                                     gpointer user_data);
 
     bool fillChineseNumber(gint64 num);
 
@@ -90,6 +99,9 @@ private:
     int m_result_num;
     const lua_command_candidate_t * m_candidate;
     GArray * m_candidates;
+    /* the iterator of the results not yet pulled. */
+    int m_iterator;
+    std::string m_iterator_function;
 
     const static int m_aux_text_len = 50;
 };
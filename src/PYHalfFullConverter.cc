@@ -87,10 +87,34 @@ HalfFullConverter::m_table[][3] = {
     { 0xFFEE, 0x25CB, 1 },
 };
 
+/* the halfwidth katakana block, indexed by ch - HALFWIDTH_KATAKANA_BEGIN,
+   generated from the ranges of m_table above. */
+const gunichar
+HalfFullConverter::m_katakana[HALFWIDTH_KATAKANA_END - HALFWIDTH_KATAKANA_BEGIN] = {
+    0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3,
+    0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30FC,
+    0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF,
+    0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF,
+    0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD,
+    0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+    0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA,
+    0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3,
+};
+
 gunichar
 HalfFullConverter::toFull (gunichar ch)
 {
-    for (guint i = 0; i < G_N_ELEMENTS (m_table); i++) {
+    /* the printable ascii block maps to U+FF01 - U+FF5E. */
+    if (G_LIKELY (ch < 0x0080)) {
+        if (G_LIKELY (ch > 0x0020 && ch < 0x007F))
+            return ch + 0xFEE0;
+        return ch == 0x0020 ? 0x3000 : ch;
+    }
+
+    if (ch >= HALFWIDTH_KATAKANA_BEGIN && ch < HALFWIDTH_KATAKANA_END)
+        return m_katakana[ch - HALFWIDTH_KATAKANA_BEGIN];
+
+    for (guint i = 2; i < G_N_ELEMENTS (m_table); i++) {
         if (G_UNLIKELY (ch < m_table[i][0]))
             return ch;
         if (G_UNLIKELY (ch < m_table[i][0] + m_table[i][2]))
@@ -102,6 +126,15 @@ HalfFullConverter::toFull (gunichar ch)
 gunichar
 HalfFullConverter::toHalf (gunichar ch)
 {
+    /* U+2190 is the lowest full width character in m_table. */
+    if (G_LIKELY (ch < 0x2190))
+        return ch;
+
+    if (ch >= 0xFF01 && ch < 0xFF5F)
+        return ch - 0xFEE0;
+    if (ch == 0x3000)
+        return 0x0020;
+
     for (guint i = 0; i < G_N_ELEMENTS (m_table); i++) {
         if (G_LIKELY (ch < m_table[i][1]))
             continue;
@@ -112,5 +145,41 @@ HalfFullConverter::toHalf (gunichar ch)
     return ch;
 }
 
-};
+void
+HalfFullConverter::convertString (const gchar *str, String & out)
+{
+    /* full width ascii is 3 bytes long in utf-8. */
+    gchar buf[3 * 64];
 
+    const gchar *p = str;
+    while (*p != '\0') {
+        /* convert the ascii run without decoding utf-8. */
+        gsize len = 0;
+        while (len + 3 <= sizeof (buf) && *p != '\0' &&
+               G_LIKELY ((guchar) *p < 0x80)) {
+            guchar c = *p++;
+            if (G_LIKELY (c > 0x20 && c < 0x7F)) {
+                /* U+FF01 - U+FF5E: EF BC 81 - EF BD 9E. */
+                guchar low = c - 0x20;
+                buf[len++] = 0xEF;
+                buf[len++] = 0xBC | (low >> 6);
+                buf[len++] = 0x80 | (low & 0x3F);
+            } else if (c == 0x20) {
+                /* U+3000: E3 80 80. */
+                buf[len++] = 0xE3;
+                buf[len++] = 0x80;
+                buf[len++] = 0x80;
+            } else {
+                buf[len++] = c;
+            }
+        }
+        out.append (buf, len);
+
+        if (*p != '\0' && (guchar) *p >= 0x80) {
+            out.appendUnichar (toFull (g_utf8_get_char (p)));
+            p = g_utf8_next_char (p);
+        }
+    }
+}
+
+};
@@ -21,17 +21,25 @@
 #define __PY_HALF_FULL_CONVERTER_H_
 
 #include <glib.h>
+#include "PYString.h"
 
 namespace PY {
 
+#define HALFWIDTH_KATAKANA_BEGIN 0xFF61
+#define HALFWIDTH_KATAKANA_END   0xFF9E
+
 class HalfFullConverter {
 
 public:
     static gunichar toFull (gunichar ch);
     static gunichar toHalf (gunichar ch);
 
+    /* append the full width form of the utf-8 string to out. */
+    static void convertString (const gchar *str, String & out);
+
 private:
     const static guint m_table[][3];
+    const static gunichar m_katakana[];
 };
 
 };
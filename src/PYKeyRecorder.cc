@@ -0,0 +1,281 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+#include "PYKeyRecorder.h"
+#include <ibus.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <glib/gstdio.h>
+
+namespace PY {
+
+#define KEY_TRACE_MAGIC "PYKT"
+#define KEY_TRACE_VERSION (1)
+/* about 3 MiB of the latest key presses. */
+#define KEY_TRACE_CAPACITY (1 << 18)
+#define KEY_TRACE_FLUSH_TIMEOUT (60)
+#define KEY_TRACE_PENDING_MAX (4096)
+
+struct KeyTraceHeader {
+    gchar magic[4];
+    guint32 version;
+    guint32 capacity;
+    /* the slot of the next record. */
+    guint32 next;
+    /* the records written since the file is created. */
+    guint64 count;
+};
+
+static KeyTraceHeader key_trace_header;
+static std::vector<KeyRecord> key_trace_pending;
+static gint key_trace_fd = -1;
+static gint64 key_trace_last = 0;
+
+gboolean KeyRecorder::m_enabled = FALSE;
+gboolean KeyRecorder::m_letters = FALSE;
+
+static gboolean
+key_trace_valid (const KeyTraceHeader & header)
+{
+    return 0 == memcmp (header.magic, KEY_TRACE_MAGIC, 4) &&
+        KEY_TRACE_VERSION == header.version &&
+        header.capacity > 0 && header.next < header.capacity;
+}
+
+static guint32
+key_trace_saturate (gint64 value)
+{
+    return CLAMP (value, 0, (gint64) G_MAXUINT32);
+}
+
+void
+KeyRecorder::enable (gboolean letters)
+{
+    if (m_enabled)
+        return;
+
+    gchar *dirname = g_build_filename (g_get_user_cache_dir (),
+                                       "ibus", "libpinyin", NULL);
+    g_mkdir_with_parents (dirname, 0700);
+    gchar *filename = g_build_filename (dirname, "keys.trace", NULL);
+    g_free (dirname);
+
+    key_trace_fd = g_open (filename, O_RDWR | O_CREAT, 0600);
+    if (key_trace_fd < 0) {
+        g_warning ("can not open %s.", filename);
+        g_free (filename);
+        return;
+    }
+
+    /* continue the ring of the last run, or start a new one. */
+    KeyTraceHeader & header = key_trace_header;
+    if ((ssize_t) sizeof (header) != pread (key_trace_fd, &header, sizeof (header), 0) ||
+        !key_trace_valid (header) || KEY_TRACE_CAPACITY != header.capacity) {
+        memcpy (header.magic, KEY_TRACE_MAGIC, 4);
+        header.version = KEY_TRACE_VERSION;
+        header.capacity = KEY_TRACE_CAPACITY;
+        header.next = 0;
+        header.count = 0;
+
+        off_t size = sizeof (header) +
+            (off_t) KEY_TRACE_CAPACITY * sizeof (KeyRecord);
+        if (ftruncate (key_trace_fd, size) < 0 ||
+            (ssize_t) sizeof (header) != pwrite (key_trace_fd, &header, sizeof (header), 0)) {
+            g_warning ("can not write %s.", filename);
+            close (key_trace_fd);
+            key_trace_fd = -1;
+            g_free (filename);
+            return;
+        }
+    }
+    g_free (filename);
+
+    m_letters = letters;
+    m_enabled = TRUE;
+    g_timeout_add_seconds (KEY_TRACE_FLUSH_TIMEOUT,
+                           KeyRecorder::timeoutCallback, NULL);
+}
+
+void
+KeyRecorder::record (guint keyval, guint modifiers, gint mode_before,
+                     gint mode, gboolean handled, gint64 latency)
+{
+    if (!m_enabled || (modifiers & IBUS_RELEASE_MASK))
+        return;
+
+    gint64 begin = g_get_monotonic_time () - latency;
+
+    KeyRecord record;
+    record.interval = key_trace_last ?
+        key_trace_saturate (begin - key_trace_last) : 0;
+    record.latency = key_trace_saturate (latency);
+    record.key_class = classify (keyval, modifiers);
+    record.letter = m_letters && KEY_CLASS_LETTER == record.key_class ?
+        remapLetter ((gchar) keyval) : 0;
+    record.modes = ((mode_before & 0xf) << 4) | (mode & 0xf);
+    record.flags = handled ? KEY_RECORD_HANDLED : 0;
+    key_trace_last = begin;
+
+    key_trace_pending.push_back (record);
+    if (G_UNLIKELY (key_trace_pending.size () >= KEY_TRACE_PENDING_MAX))
+        flush ();
+}
+
+void
+KeyRecorder::flush (void)
+{
+    if (key_trace_fd < 0 || key_trace_pending.empty ())
+        return;
+
+    KeyTraceHeader & header = key_trace_header;
+    gsize i = 0;
+    while (i < key_trace_pending.size ()) {
+        /* wrap around at the end of the ring. */
+        guint32 n = MIN (key_trace_pending.size () - i,
+                         (gsize) (header.capacity - header.next));
+        off_t offset = sizeof (header) +
+            (off_t) header.next * sizeof (KeyRecord);
+        if (pwrite (key_trace_fd, &key_trace_pending[i],
+                    n * sizeof (KeyRecord), offset) < 0)
+            break;
+
+        header.next = (header.next + n) % header.capacity;
+        header.count += n;
+        i += n;
+    }
+
+    key_trace_pending.clear ();
+    if (pwrite (key_trace_fd, &header, sizeof (header), 0) < 0)
+        g_warning ("can not write the key trace header.");
+}
+
+gboolean
+KeyRecorder::load (const gchar *filename, std::vector<KeyRecord> & records)
+{
+    gchar *contents = NULL;
+    gsize length = 0;
+    GError *error = NULL;
+
+    if (!g_file_get_contents (filename, &contents, &length, &error)) {
+        g_warning ("can not read %s: %s", filename, error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    KeyTraceHeader header;
+    if (length < sizeof (header)) {
+        g_free (contents);
+        return FALSE;
+    }
+    memcpy (&header, contents, sizeof (header));
+
+    if (!key_trace_valid (header) || length < sizeof (header) +
+        (gsize) header.capacity * sizeof (KeyRecord)) {
+        g_warning ("bad key trace: %s", filename);
+        g_free (contents);
+        return FALSE;
+    }
+
+    const KeyRecord *slots = (const KeyRecord *) (contents + sizeof (header));
+    if (header.count >= header.capacity) {
+        /* the ring is full, the oldest record is at the next slot. */
+        records.insert (records.end (), slots + header.next,
+                        slots + header.capacity);
+    }
+    records.insert (records.end (), slots, slots + header.next);
+
+    g_free (contents);
+    return TRUE;
+}
+
+KeyClass
+KeyRecorder::classify (guint keyval, guint modifiers)
+{
+    if (modifiers & (IBUS_CONTROL_MASK | IBUS_MOD1_MASK | IBUS_SUPER_MASK))
+        return KEY_CLASS_OTHER;
+
+    switch (keyval) {
+    case IBUS_space:
+    case IBUS_Return:
+    case IBUS_KP_Enter:
+        return KEY_CLASS_SELECT;
+    case IBUS_BackSpace:
+    case IBUS_Delete:
+    case IBUS_Escape:
+    case IBUS_Left:
+    case IBUS_Right:
+    case IBUS_Home:
+    case IBUS_End:
+        return KEY_CLASS_EDIT;
+    case IBUS_Page_Up:
+    case IBUS_Page_Down:
+    case IBUS_Up:
+    case IBUS_Down:
+        return KEY_CLASS_PAGE;
+    }
+
+    if ((keyval >= IBUS_a && keyval <= IBUS_z) ||
+        (keyval >= IBUS_A && keyval <= IBUS_Z))
+        return KEY_CLASS_LETTER;
+    if (keyval >= IBUS_0 && keyval <= IBUS_9)
+        return KEY_CLASS_DIGIT;
+    if (keyval > IBUS_space && keyval <= IBUS_asciitilde)
+        return KEY_CLASS_PUNCT;
+    return KEY_CLASS_OTHER;
+}
+
+/* keep the vowel and consonant pattern, the zh/ch/sh and the nasal
+   finals, so "zhongguo" becomes "shanggua". */
+gchar
+KeyRecorder::remapLetter (gchar ch)
+{
+    gchar lower = g_ascii_tolower (ch);
+    gchar mapped;
+
+    switch (lower) {
+    case 'a': case 'e': case 'o':
+        mapped = 'a';
+        break;
+    case 'i': case 'u': case 'v':
+        mapped = 'u';
+        break;
+    case 'g': case 'h': case 'n': case 'r':
+        mapped = lower;
+        break;
+    default:
+        mapped = 's';
+        break;
+    }
+
+    return g_ascii_isupper (ch) ? g_ascii_toupper (mapped) : mapped;
+}
+
+gboolean
+KeyRecorder::timeoutCallback (gpointer data)
+{
+    flush ();
+    return TRUE;
+}
+
+};
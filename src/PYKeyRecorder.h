@@ -0,0 +1,105 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_KEY_RECORDER_H_
+#define __PY_KEY_RECORDER_H_
+
+#include <glib.h>
+#include <vector>
+
+namespace PY {
+
+/* the classes of the keys, no content is recorded. */
+enum KeyClass {
+    KEY_CLASS_LETTER = 0,
+    KEY_CLASS_DIGIT,
+    KEY_CLASS_PUNCT,
+    /* BackSpace, Delete, Escape and the cursor movements. */
+    KEY_CLASS_EDIT,
+    /* Page_Up, Page_Down, Up and Down. */
+    KEY_CLASS_PAGE,
+    /* space and Return. */
+    KEY_CLASS_SELECT,
+    /* the other keys and the shortcuts. */
+    KEY_CLASS_OTHER,
+    KEY_CLASS_LAST
+};
+
+/* the input modes of the pinyin and bopomofo engines. */
+enum KeyRecordMode {
+    KEY_MODE_INIT = 0,
+    KEY_MODE_PUNCT,
+    KEY_MODE_RAW,
+    KEY_MODE_ENGLISH,
+    KEY_MODE_STROKE,
+    KEY_MODE_EXTENSION,
+    KEY_MODE_SUGGESTION,
+};
+
+#define KEY_RECORD_HANDLED (1 << 0)
+
+/* one key press in the ring file, in the host byte order. */
+struct KeyRecord {
+    /* microseconds since the previous key press, saturated. */
+    guint32 interval;
+    /* microseconds of the key event in the engine, saturated. */
+    guint32 latency;
+    guint8 key_class;
+    /* the remapped letter, or 0 when the letters are not recorded. */
+    guint8 letter;
+    /* the input mode before the key in the high 4 bits,
+       and the input mode after the key in the low 4 bits. */
+    guint8 modes;
+    guint8 flags;
+};
+
+/* Opt-in capture of the typing rhythms into the ring file
+ * keys.trace in the user cache directory, for the replay of
+ * bench-engine --trace. The password fields are not recorded. */
+class KeyRecorder {
+public:
+    /* the letters are remapped to keep only the syllable shapes. */
+    static void enable (gboolean letters);
+    static gboolean enabled (void) { return m_enabled; }
+
+    /* the release events are ignored. */
+    static void record (guint keyval, guint modifiers, gint mode_before,
+                        gint mode, gboolean handled, gint64 latency);
+
+    /* write the pending records into the ring file. */
+    static void flush (void);
+
+    /* read the records of the ring file, the oldest first. */
+    static gboolean load (const gchar *filename,
+                          std::vector<KeyRecord> & records);
+
+    static KeyClass classify (guint keyval, guint modifiers);
+    static gchar remapLetter (gchar ch);
+
+private:
+    static gboolean timeoutCallback (gpointer data);
+
+    static gboolean m_enabled;
+    static gboolean m_letters;
+};
+
+};
+
+#endif
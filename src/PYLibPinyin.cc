@@ -22,10 +22,30 @@
 
 #include <string.h>
 #include <time.h>
+#include <algorithm>
+#include <glib/gstdio.h>
+#include <gio/gio.h>
 #include <pinyin.h>
 #include "PYPConfig.h"
+#include "PYCacheSnapshot.h"
+#include "PYPersistence.h"
+#include "PYStats.h"
+#include "PYString.h"
 
 #define LIBPINYIN_SAVE_TIMEOUT   (5 * 60)
+#define INSTANCE_POOL_SIZE       4
+
+/* each import step runs 10ms, check the time every 256 lines. */
+#define IMPORT_STEP_TIME         (10 * 1000)
+#define IMPORT_CHECK_LINES       256
+
+#define NETWORK_DICTIONARY_FILE  PKGDATADIR G_DIR_SEPARATOR_S "network.txt"
+/* reload the network dictionary 3 seconds after the last change. */
+#define NETWORK_RELOAD_DELAY     3
+
+/* the export writes through a large buffer, the files named "*.gz"
+   are compressed. */
+#define EXPORT_BUFFER_SIZE       (256 * 1024)
 
 using namespace PY;
 
@@ -34,18 +54,105 @@ std::unique_ptr<LibPinyinBackEnd> LibPinyinBackEnd::m_instance;
 static LibPinyinBackEnd libpinyin_backend;
 
 LibPinyinBackEnd::LibPinyinBackEnd () {
-    m_timeout_id = 0;
-    m_timer = g_timer_new ();
+    m_trained_id = 0;
+    m_unjournaled = FALSE;
+    m_saving_unjournaled = FALSE;
+    m_save_id = 0;
+    m_save_pending = 0;
+    Persistence::add (STORE_PINYIN_CONTEXT, LIBPINYIN_SAVE_TIMEOUT,
+                      LibPinyinBackEnd::savePinyinCallback, this);
+    Persistence::add (STORE_CHEWING_CONTEXT, LIBPINYIN_SAVE_TIMEOUT,
+                      LibPinyinBackEnd::saveChewingCallback, this);
     m_pinyin_context = NULL;
     m_chewing_context = NULL;
+    m_modified_serial = 0;
+    m_owner = g_thread_self ();
+    g_rw_lock_init (&m_context_lock);
+    m_write_depth = 0;
+    g_mutex_init (&m_write_lock);
+    m_write_id = 0;
+    markApplied (m_pinyin_options, NULL, NULL);
+    markApplied (m_chewing_options, NULL, NULL);
+    m_network_file = NULL;
+    m_network_monitor = NULL;
+    m_network_timeout_id = 0;
+    m_network_reload.thread = NULL;
+    m_network_reload.file = NULL;
+    m_network_reload.n_targets = 0;
+    m_network_reload.current = 0;
+    m_network_reload.import_id = 0;
+    m_network_reload.pending = FALSE;
+    m_import_file = NULL;
+    m_import_iter = NULL;
+    m_import_offset = 0;
+    m_import_id = 0;
+    m_import_progress = -1;
+    m_export_stream = NULL;
+    m_export_cancellable = NULL;
+    m_export_iter = NULL;
+    m_export_count = 0;
+    m_export_id = 0;
+    m_addon_id = 0;
+    m_pinyin_loader.thread = NULL;
+    m_chewing_loader.thread = NULL;
+    g_mutex_init (&m_network_lock);
+    g_mutex_init (&m_warm_up_lock);
+    g_cond_init (&m_warm_up_cond);
 }
 
 LibPinyinBackEnd::~LibPinyinBackEnd () {
-    g_timer_destroy (m_timer);
-    if (m_timeout_id != 0) {
+    waitPinyinContext (-1);
+    waitChewingContext (-1);
+
+    if (m_import_id)
+        finishImport (FALSE);
+    if (m_export_id)
+        finishExport (FALSE);
+    if (m_addon_id)
+        g_source_remove (m_addon_id);
+    m_addon_id = 0;
+
+    /* the trainings are replayed from the journals on the next start,
+       only the other modifications need the full save here. */
+    gboolean pending = m_trained_id != 0 || m_save_id != 0 ||
+        Persistence::isModified (STORE_PINYIN_CONTEXT) ||
+        Persistence::isModified (STORE_CHEWING_CONTEXT);
+    gboolean unjournaled = m_unjournaled ||
+        (m_save_id != 0 && m_saving_unjournaled);
+
+    if (m_trained_id != 0)
+        g_source_remove (m_trained_id);
+    m_trained_id = 0;
+    if (m_save_id != 0)
+        g_source_remove (m_save_id);
+    m_save_id = 0;
+    Persistence::remove (STORE_PINYIN_CONTEXT, this);
+    Persistence::remove (STORE_CHEWING_CONTEXT, this);
+
+    if (pending && unjournaled)
         saveUserDB ();
-        g_source_remove (m_timeout_id);
+    syncJournals ();
+
+    if (m_network_monitor) {
+        g_file_monitor_cancel (m_network_monitor);
+        g_object_unref (m_network_monitor);
+        m_network_monitor = NULL;
     }
+    if (m_network_timeout_id)
+        g_source_remove (m_network_timeout_id);
+    m_network_timeout_id = 0;
+    if (m_network_reload.thread)
+        g_thread_join (m_network_reload.thread);
+    m_network_reload.thread = NULL;
+    m_network_reload.pending = FALSE;
+    finishNetworkReload ();
+
+    for (guint i = 0; i < m_pinyin_instances.size (); i++)
+        pinyin_free_instance (m_pinyin_instances[i]);
+    m_pinyin_instances.clear ();
+    for (guint i = 0; i < m_chewing_instances.size (); i++)
+        pinyin_free_instance (m_chewing_instances[i]);
+    m_chewing_instances.clear ();
 
     if (m_pinyin_context)
         pinyin_fini(m_pinyin_context);
@@ -53,121 +160,517 @@ LibPinyinBackEnd::~LibPinyinBackEnd () {
     if (m_chewing_context)
         pinyin_fini(m_chewing_context);
     m_chewing_context = NULL;
+
+    if (m_network_file)
+        g_mapped_file_unref (m_network_file);
+    m_network_file = NULL;
+
+    /* drop the writes not run yet. */
+    if (m_write_id)
+        g_source_remove (m_write_id);
+    m_write_id = 0;
+    for (size_t i = 0; i < m_writes.size (); ++i) {
+        if (m_writes[i].destroy)
+            m_writes[i].destroy (m_writes[i].data);
+    }
+    m_writes.clear ();
+    g_mutex_clear (&m_write_lock);
+    g_rw_lock_clear (&m_context_lock);
+
+    g_mutex_clear (&m_network_lock);
+    g_mutex_clear (&m_warm_up_lock);
+    g_cond_clear (&m_warm_up_cond);
 }
 
-pinyin_context_t *
-LibPinyinBackEnd::initPinyinContext (Config *config)
+void
+LibPinyinBackEnd::queueWrite (ContextWriteFunc func, gpointer data,
+                              GDestroyNotify destroy)
+{
+    ContextWrite write = { func, data, destroy };
+
+    g_mutex_lock (&m_write_lock);
+    m_writes.push_back (write);
+    if (0 == m_write_id)
+        m_write_id = g_idle_add (LibPinyinBackEnd::writeCallback, this);
+    g_mutex_unlock (&m_write_lock);
+}
+
+void
+LibPinyinBackEnd::beginWrite (void)
+{
+    g_assert (g_thread_self () == m_owner);
+
+    if (m_write_depth ++)
+        return;
+
+    g_rw_lock_writer_lock (&m_context_lock);
+    /* keep the order of the queued writes. */
+    runWrites ();
+}
+
+void
+LibPinyinBackEnd::endWrite (void)
+{
+    g_assert (m_write_depth > 0);
+
+    if (-- m_write_depth)
+        return;
+
+    g_rw_lock_writer_unlock (&m_context_lock);
+}
+
+void
+LibPinyinBackEnd::beginRead (void)
+{
+    /* the main thread already excludes the writes. */
+    g_assert (g_thread_self () != m_owner);
+    g_rw_lock_reader_lock (&m_context_lock);
+}
+
+void
+LibPinyinBackEnd::endRead (void)
+{
+    g_rw_lock_reader_unlock (&m_context_lock);
+}
+
+/* called with the write lock held. */
+void
+LibPinyinBackEnd::runWrites (void)
+{
+    for (;;) {
+        g_mutex_lock (&m_write_lock);
+        if (m_writes.empty ()) {
+            g_mutex_unlock (&m_write_lock);
+            return;
+        }
+        ContextWrite write = m_writes.front ();
+        m_writes.pop_front ();
+        g_mutex_unlock (&m_write_lock);
+
+        write.func (this, write.data);
+        if (write.destroy)
+            write.destroy (write.data);
+    }
+}
+
+gboolean
+LibPinyinBackEnd::writeCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    g_mutex_lock (&self->m_write_lock);
+    self->m_write_id = 0;
+    g_mutex_unlock (&self->m_write_lock);
+
+    ContextWriter writer (*self);
+    return FALSE;
+}
+
+/* constrain the sentence to the phrase, the longest candidate matching
+   the rest of the phrase is chosen at each offset, the reached offset
+   of the input is returned in end. */
+gboolean
+LibPinyinBackEnd::choosePhrase (pinyin_instance_t *instance,
+                                const gchar *phrase, size_t length,
+                                size_t *end)
+{
+    const gchar *rest = phrase;
+    size_t offset = 0;
+
+    while (*rest && offset < length) {
+        pinyin_guess_candidates (instance, offset,
+                                 SORT_BY_PHRASE_LENGTH_AND_FREQUENCY);
+
+        guint num = 0;
+        pinyin_get_n_candidate (instance, &num);
+
+        lookup_candidate_t *chosen = NULL;
+        size_t chosen_length = 0;
+        for (guint i = 0; i < num; i++) {
+            lookup_candidate_t *candidate = NULL;
+            pinyin_get_candidate (instance, i, &candidate);
+
+            lookup_candidate_type_t type;
+            pinyin_get_candidate_type (instance, candidate, &type);
+            if (type != NORMAL_CANDIDATE && type != ADDON_CANDIDATE)
+                continue;
+
+            const gchar *str = NULL;
+            pinyin_get_candidate_string (instance, candidate, &str);
+            size_t len = strlen (str);
+            if (len > chosen_length && strncmp (rest, str, len) == 0) {
+                chosen = candidate;
+                chosen_length = len;
+            }
+        }
+
+        if (NULL == chosen)
+            break;
+
+        offset = pinyin_choose_candidate (instance, offset, chosen);
+        rest += chosen_length;
+    }
+
+    /* the partial choices are undone when the phrase is not spelled. */
+    gboolean spelled = *rest == '\0';
+    if (!spelled)
+        pinyin_clear_constraints (instance);
+
+    pinyin_guess_sentence (instance);
+    if (end)
+        *end = spelled ? offset : 0;
+    return spelled;
+}
+
+/* returns the number of the replayed trainings. */
+guint
+LibPinyinBackEnd::replayJournal (pinyin_context_t *context,
+                                 const char *filename)
+{
+    std::vector<TrainingJournal::Record> records;
+    if (!TrainingJournal::read (filename, records) || records.empty ())
+        return 0;
+
+    gint64 start = g_get_monotonic_time ();
+    pinyin_instance_t *instance = pinyin_alloc_instance (context);
+    guint replayed = 0;
+
+    for (size_t i = 0; i < records.size (); i++) {
+        const TrainingJournal::Record & record = records[i];
+
+        /* the journaled pinyin are full pinyin separated by "'". */
+        pinyin_reset (instance);
+        pinyin_parse_more_full_pinyins (instance, record.pinyin.c_str ());
+        pinyin_guess_sentence (instance);
+
+        if (record.flags & TrainingJournal::RECORD_TRAIN) {
+            size_t end = 0;
+            if (!choosePhrase (instance, record.phrase.c_str (),
+                               record.pinyin.length (), &end) ||
+                end < record.pinyin.length ())
+                continue;
+            pinyin_train (instance, 0);
+        }
+
+        if (record.flags & TrainingJournal::RECORD_REMEMBER)
+            pinyin_remember_user_input (instance, record.phrase.c_str (), -1);
+        replayed ++;
+    }
+
+    pinyin_free_instance (instance);
+
+    g_debug ("replayed %u of %" G_GSIZE_FORMAT " trainings from %s "
+             "in %" G_GINT64_FORMAT " ms.", replayed, records.size (),
+             filename, (g_get_monotonic_time () - start) / 1000);
+    return replayed;
+}
+
+/* only touches the context and the loader, safe in worker threads. */
+void
+LibPinyinBackEnd::loadContext (ContextLoader & loader)
 {
-    pinyin_context_t * context = NULL;
+    StatsScope stats (STATS_CONTEXT_INITS);
 
     gchar * userdir = g_build_filename (g_get_user_cache_dir (),
-                                        "ibus", "libpinyin", NULL);
+                                        "ibus", loader.name, NULL);
     int retval = g_mkdir_with_parents (userdir, 0700);
     if (retval) {
         g_free (userdir); userdir = NULL;
     }
-    context = pinyin_init (LIBPINYIN_DATADIR, userdir);
+    pinyin_context_t * context = pinyin_init (LIBPINYIN_DATADIR, userdir);
+    gchar * fingerprint = userdir ?
+        g_build_filename (userdir, "network.fingerprint", NULL) : NULL;
+    gchar * journal = userdir ?
+        g_build_filename (userdir, "training.journal", NULL) : NULL;
     g_free (userdir);
 
     /* init network dictionary */
-    time_t start = config->networkDictionaryStartTimestamp ();
-    time_t end = config->networkDictionaryEndTimestamp ();
+    readNetworkDictionary (context, NETWORK_DICTIONARY_FILE,
+                           fingerprint, loader.start, loader.end,
+                           loader.changed);
+    g_free (fingerprint);
+
+    /* the addon dictionaries are loaded later in idle, see updateAddons. */
 
-    readNetworkDictionary (context, PKGDATADIR G_DIR_SEPARATOR_S "network.txt",
-                           start, end);
+    /* replay the trainings not saved before the last exit. */
+    if (journal) {
+        loader.journal_file = journal;
+        loader.replayed = replayJournal (context, journal);
+    }
+    g_free (journal);
+
+    loader.context = context;
+}
+
+/* read the config in the main thread. */
+void
+LibPinyinBackEnd::prepareContext (ContextLoader & loader, const char * name,
+                                  TrainingJournal *journal, Config *config)
+{
+    loader.backend = this;
+    loader.name = name;
+    loader.journal = journal;
+    loader.journal_file.clear ();
+    loader.replayed = 0;
+    loader.start = config->networkDictionaryStartTimestamp ();
+    loader.end = config->networkDictionaryEndTimestamp ();
+    loader.changed = FALSE;
+    loader.context = NULL;
+    loader.thread = NULL;
+    loader.done = FALSE;
+}
 
+pinyin_context_t *
+LibPinyinBackEnd::finishContext (ContextLoader & loader, Config *config)
+{
     /* save the timestamp */
-    config->networkDictionaryStartTimestamp (start);
-    config->networkDictionaryEndTimestamp (end);
+    config->networkDictionaryStartTimestamp (loader.start);
+    config->networkDictionaryEndTimestamp (loader.end);
 
-    /* load addon dictionaries */
-    const char *dicts = config->dictionaries ().c_str ();
-    gchar ** indices = g_strsplit_set (dicts, ";", -1);
-    for (size_t i = 0; i < g_strv_length(indices); ++i) {
-        int index = atoi (indices [i]);
-        if (index <= 1)
-            continue;
+    if (loader.changed)
+        modified (storeOf (*loader.journal));
+    else if (loader.replayed)
+        Persistence::modified (storeOf (*loader.journal));
 
-        pinyin_load_addon_phrase_library (context, index);
-    }
-    g_strfreev (indices);
+    if (!loader.journal_file.empty ())
+        loader.journal->open (loader.journal_file.c_str ());
 
+    pinyin_context_t * context = loader.context;
+    loader.context = NULL;
     return context;
 }
 
-pinyin_instance_t *
-LibPinyinBackEnd::allocPinyinInstance ()
+pinyin_context_t *
+LibPinyinBackEnd::initPinyinContext (Config *config)
 {
-    Config * config = &PinyinConfig::instance ();
-    if (NULL == m_pinyin_context) {
-        m_pinyin_context = initPinyinContext (config);
-    }
+    ContextLoader loader;
+    prepareContext (loader, "libpinyin", &m_pinyin_journal, config);
+    loadContext (loader);
+    return finishContext (loader, config);
+}
 
-    setPinyinOptions (config);
-    return pinyin_alloc_instance (m_pinyin_context);
+pinyin_context_t *
+LibPinyinBackEnd::initChewingContext (Config *config)
+{
+    ContextLoader loader;
+    prepareContext (loader, "libbopomofo", &m_chewing_journal, config);
+    loadContext (loader);
+    return finishContext (loader, config);
 }
 
 void
-LibPinyinBackEnd::freePinyinInstance (pinyin_instance_t *instance)
+LibPinyinBackEnd::warmUp (void)
 {
-    pinyin_free_instance (instance);
+    if (NULL == m_pinyin_context && NULL == m_pinyin_loader.thread) {
+        prepareContext (m_pinyin_loader, "libpinyin", &m_pinyin_journal,
+                        &PinyinConfig::instance ());
+        m_pinyin_loader.thread = g_thread_new
+            ("libpinyin", LibPinyinBackEnd::warmUpThread, &m_pinyin_loader);
+    }
+
+    if (NULL == m_chewing_context && NULL == m_chewing_loader.thread) {
+        prepareContext (m_chewing_loader, "libbopomofo", &m_chewing_journal,
+                        &BopomofoConfig::instance ());
+        m_chewing_loader.thread = g_thread_new
+            ("libbopomofo", LibPinyinBackEnd::warmUpThread, &m_chewing_loader);
+    }
+
+    watchNetworkDictionary ();
+
+    g_idle_add_full (G_PRIORITY_LOW, LibPinyinBackEnd::snapshotCallback,
+                     NULL, NULL);
 }
 
-pinyin_context_t *
-LibPinyinBackEnd::initChewingContext (Config *config)
+gpointer
+LibPinyinBackEnd::warmUpThread (gpointer data)
 {
-    pinyin_context_t * context = NULL;
+    ContextLoader * loader = static_cast<ContextLoader *> (data);
+    LibPinyinBackEnd * backend = loader->backend;
 
-    gchar * userdir = g_build_filename (g_get_user_cache_dir (),
-                                        "ibus", "libbopomofo", NULL);
-    int retval = g_mkdir_with_parents (userdir, 0700);
-    if (retval) {
-        g_free(userdir); userdir = NULL;
+    backend->loadContext (*loader);
+
+    g_mutex_lock (&backend->m_warm_up_lock);
+    loader->done = TRUE;
+    g_cond_broadcast (&backend->m_warm_up_cond);
+    g_mutex_unlock (&backend->m_warm_up_lock);
+
+    /* install the context in the main loop. */
+    g_idle_add (LibPinyinBackEnd::warmUpCallback, NULL);
+    return NULL;
+}
+
+gboolean
+LibPinyinBackEnd::waitContext (ContextLoader & loader, gint64 timeout)
+{
+    if (NULL == loader.thread)
+        return TRUE;
+
+    gint64 end_time = g_get_monotonic_time () + timeout;
+
+    g_mutex_lock (&m_warm_up_lock);
+    while (!loader.done) {
+        if (timeout < 0)
+            g_cond_wait (&m_warm_up_cond, &m_warm_up_lock);
+        else if (!g_cond_wait_until (&m_warm_up_cond, &m_warm_up_lock,
+                                     end_time))
+            break;
     }
-    context = pinyin_init (LIBPINYIN_DATADIR, userdir);
-    g_free(userdir);
+    gboolean done = loader.done;
+    g_mutex_unlock (&m_warm_up_lock);
 
-    /* init network dictionary */
-    time_t start = config->networkDictionaryStartTimestamp ();
-    time_t end = config->networkDictionaryEndTimestamp ();
+    if (!done)
+        return FALSE;
 
-    readNetworkDictionary (context, PKGDATADIR G_DIR_SEPARATOR_S "network.txt",
-                           start, end);
+    g_thread_join (loader.thread);
+    loader.thread = NULL;
 
-    /* save the timestamp */
-    config->networkDictionaryStartTimestamp (start);
-    config->networkDictionaryEndTimestamp (end);
+    if (&loader == &m_pinyin_loader)
+        m_pinyin_context = finishContext (loader, &PinyinConfig::instance ());
+    else
+        m_chewing_context = finishContext (loader, &BopomofoConfig::instance ());
+    return TRUE;
+}
 
-    /* load addon dictionaries */
-    const char *dicts = config->dictionaries ().c_str ();
-    gchar ** indices = g_strsplit_set (dicts, ";", -1);
-    for (size_t i = 0; i < g_strv_length(indices); ++i) {
-        int index = atoi (indices [i]);
-        if (index <= 1)
-            continue;
+gboolean
+LibPinyinBackEnd::waitPinyinContext (gint64 timeout)
+{
+    return waitContext (m_pinyin_loader, timeout);
+}
+
+gboolean
+LibPinyinBackEnd::waitChewingContext (gint64 timeout)
+{
+    return waitContext (m_chewing_loader, timeout);
+}
+
+gboolean
+LibPinyinBackEnd::warmUpCallback (gpointer data)
+{
+    if (NULL == m_instance.get ())
+        return FALSE;
+
+    m_instance->waitPinyinContext (0);
+    m_instance->waitChewingContext (0);
+    return FALSE;
+}
+
+/* the saved user dictionaries, the system tables and the config read by
+   the cached conversions and predictions, of both settings. */
+std::string
+LibPinyinBackEnd::snapshotFingerprint (void)
+{
+    static const char * const names[] = { "libpinyin", "libbopomofo" };
+    static const char * const files[] = {
+        "user.conf", "training.journal", "network.fingerprint"
+    };
+
+    String fingerprint;
+    gchar * path = g_build_filename (LIBPINYIN_DATADIR, "table.conf", NULL);
+    GStatBuf buf;
+    if (0 == g_stat (path, &buf))
+        fingerprint.appendPrintf ("%ld:%ld;", (long) buf.st_mtime,
+                                  (long) buf.st_size);
+    g_free (path);
+
+    for (guint i = 0; i < G_N_ELEMENTS (names); i++) {
+        for (guint j = 0; j < G_N_ELEMENTS (files); j++) {
+            path = g_build_filename (g_get_user_cache_dir (), "ibus",
+                                     names[i], files[j], NULL);
+            if (0 == g_stat (path, &buf))
+                fingerprint.appendPrintf ("%ld:%ld;", (long) buf.st_mtime,
+                                          (long) buf.st_size);
+            else
+                fingerprint.append ("-;");
+            g_free (path);
+        }
+    }
 
-        pinyin_load_addon_phrase_library (context, index);
+    Config * configs[] = {
+        &PinyinConfig::instance (), &BopomofoConfig::instance ()
+    };
+    for (guint i = 0; i < G_N_ELEMENTS (configs); i++) {
+        fingerprint.appendPrintf ("%d;%s;%s;", (int) configs[i]->sortOption (),
+                                  configs[i]->openccConfig ().c_str (),
+                                  configs[i]->dictionaries ().c_str ());
     }
-    g_strfreev (indices);
+    return fingerprint;
+}
 
-    return context;
+gboolean
+LibPinyinBackEnd::snapshotCallback (gpointer data)
+{
+    if (NULL == m_instance.get ())
+        return FALSE;
+
+    /* only restored into the caches still empty after the start up. */
+    CacheSnapshot::load (snapshotFingerprint ());
+    return FALSE;
+}
+
+pinyin_instance_t *
+LibPinyinBackEnd::allocPinyinInstance ()
+{
+    Config * config = &PinyinConfig::instance ();
+    waitPinyinContext (-1);
+    if (NULL == m_pinyin_context) {
+        m_pinyin_context = initPinyinContext (config);
+    }
+
+    setPinyinOptions (config);
+
+    if (!m_pinyin_instances.empty ()) {
+        pinyin_instance_t *instance = m_pinyin_instances.back ();
+        m_pinyin_instances.pop_back ();
+        return instance;
+    }
+
+    return pinyin_alloc_instance (m_pinyin_context);
+}
+
+void
+LibPinyinBackEnd::freePinyinInstance (pinyin_instance_t *instance)
+{
+    if (m_pinyin_instances.size () < INSTANCE_POOL_SIZE) {
+        pinyin_reset (instance);
+        m_pinyin_instances.push_back (instance);
+        return;
+    }
+
+    pinyin_free_instance (instance);
 }
 
 pinyin_instance_t *
 LibPinyinBackEnd::allocChewingInstance ()
 {
     Config *config = &BopomofoConfig::instance ();
+    waitChewingContext (-1);
     if (NULL == m_chewing_context) {
         m_chewing_context = initChewingContext (config);
     }
 
     setChewingOptions (config);
-    return pinyin_alloc_instance (m_chewing_context);
+
+    if (!m_chewing_instances.empty ()) {
+        pinyin_instance_t *instance = m_chewing_instances.back ();
+        m_chewing_instances.pop_back ();
+        return instance;
+    }
+
+    pinyin_instance_t *instance = pinyin_alloc_instance (m_chewing_context);
+    m_chewing_allocated.insert (instance);
+    return instance;
 }
 
 void
 LibPinyinBackEnd::freeChewingInstance (pinyin_instance_t *instance)
 {
+    if (m_chewing_instances.size () < INSTANCE_POOL_SIZE) {
+        pinyin_reset (instance);
+        m_chewing_instances.push_back (instance);
+        return;
+    }
+
+    m_chewing_allocated.erase (instance);
     pinyin_free_instance (instance);
 }
 
@@ -180,7 +683,12 @@ LibPinyinBackEnd::init (void) {
 
 void
 LibPinyinBackEnd::finalize (void) {
+    if (NULL == m_instance.get ())
+        return;
+
+    /* the user db is saved and the journals are synced before. */
     m_instance.reset ();
+    CacheSnapshot::save (snapshotFingerprint ());
 }
 
 gboolean
@@ -189,12 +697,20 @@ LibPinyinBackEnd::setPinyinOptions (Config *config)
     if (NULL == m_pinyin_context)
         return FALSE;
 
+    if (isApplied (m_pinyin_options, m_pinyin_context, config))
+        return TRUE;
+
+    ContextWriter writer (*this);
     DoublePinyinScheme scheme = config->doublePinyinSchema ();
     pinyin_set_double_pinyin_scheme (m_pinyin_context, scheme);
 
     pinyin_option_t options = config->option()
         | USE_RESPLIT_TABLE | USE_DIVIDED_TABLE;
     pinyin_set_options (m_pinyin_context, options);
+
+    updateAddons (m_pinyin_addons, config->dictionaries ());
+
+    markApplied (m_pinyin_options, m_pinyin_context, config);
     return TRUE;
 }
 
@@ -204,121 +720,475 @@ LibPinyinBackEnd::setChewingOptions (Config *config)
     if (NULL == m_chewing_context)
         return FALSE;
 
+    if (isApplied (m_chewing_options, m_chewing_context, config))
+        return TRUE;
+
+    ContextWriter writer (*this);
     ZhuyinScheme scheme = config->bopomofoKeyboardMapping ();
     pinyin_set_zhuyin_scheme (m_chewing_context, scheme);
 
     pinyin_option_t options = config->option() | USE_TONE;
     pinyin_set_options(m_chewing_context, options);
+
+    updateAddons (m_chewing_addons, config->dictionaries ());
+
+    markApplied (m_chewing_options, m_chewing_context, config);
     return TRUE;
 }
 
+gboolean
+LibPinyinBackEnd::isApplied (const AppliedOptions & applied,
+                             pinyin_context_t *context, Config *config)
+{
+    return applied.context == context && applied.config == config &&
+        applied.revision == config->revision ();
+}
+
+void
+LibPinyinBackEnd::markApplied (AppliedOptions & applied,
+                               pinyin_context_t *context, Config *config)
+{
+    applied.context = context;
+    applied.config = config;
+    applied.revision = config ? config->revision () : 0;
+}
+
 void
-LibPinyinBackEnd::modified (void)
+LibPinyinBackEnd::updateAddons (AddonLibraries & addons,
+                                const std::string & dictionaries)
 {
-    /* Restart the timer */
-    g_timer_start (m_timer);
+    addons.wanted.clear ();
+    gchar ** indices = g_strsplit_set (dictionaries.c_str (), ";", -1);
+    for (size_t i = 0; i < g_strv_length(indices); ++i) {
+        int index = atoi (indices [i]);
+        if (index <= 1 || index > G_MAXUINT8)
+            continue;
+
+        addons.wanted.push_back (index);
+    }
+    g_strfreev (indices);
 
-    if (m_timeout_id != 0)
+    if (m_addon_id != 0 || addons.wanted == addons.loaded)
         return;
 
-    m_timeout_id = g_timeout_add_seconds (LIBPINYIN_SAVE_TIMEOUT,
-                                          LibPinyinBackEnd::timeoutCallback,
-                                          static_cast<gpointer> (this));
+    m_addon_id = g_idle_add_full (G_PRIORITY_LOW,
+                                  LibPinyinBackEnd::addonCallback,
+                                  static_cast<gpointer> (this), NULL);
 }
 
+/* unload or load one library, returns FALSE when nothing is left. */
 gboolean
-LibPinyinBackEnd::importPinyinDictionary (const char *filename)
+LibPinyinBackEnd::stepAddons (pinyin_context_t *context,
+                              AddonLibraries & addons)
 {
-    /* user phrase library should be already loaded here. */
-    FILE * dictfile = fopen (filename, "r");
-    if (NULL == dictfile)
+    if (NULL == context)
         return FALSE;
 
-    import_iterator_t * iter = pinyin_begin_add_phrases
-        (m_pinyin_context, USER_DICTIONARY);
+    std::vector<guint8> & wanted = addons.wanted;
+    std::vector<guint8> & loaded = addons.loaded;
 
-    if (NULL == iter) {
-        fclose(dictfile);
-        return FALSE;
+    for (size_t i = 0; i < loaded.size (); ++i) {
+        if (std::find (wanted.begin (), wanted.end (), loaded[i]) !=
+            wanted.end ())
+            continue;
+
+        pinyin_unload_addon_phrase_library (context, loaded[i]);
+        loaded.erase (loaded.begin () + i);
+        m_modified_serial ++;
+        return TRUE;
     }
 
-    char* linebuf = NULL; size_t size = 0; ssize_t read;
-    while ((read = getline (&linebuf, &size, dictfile)) != -1) {
-        if (0 == strlen (linebuf))
+    for (size_t i = 0; i < wanted.size (); ++i) {
+        if (std::find (loaded.begin (), loaded.end (), wanted[i]) !=
+            loaded.end ())
             continue;
 
-        if ( '\n' == linebuf[strlen (linebuf) - 1] ) {
-            linebuf[strlen (linebuf) - 1] = '\0';
-        }
+        gint64 start = g_get_monotonic_time ();
+        pinyin_load_addon_phrase_library (context, wanted[i]);
+        loaded.push_back (wanted[i]);
+        m_modified_serial ++;
 
-        gchar ** items = g_strsplit_set (linebuf, " \t", 3);
-        guint len = g_strv_length (items);
+        g_debug ("loaded addon library %u in %" G_GINT64_FORMAT " ms.",
+                 wanted[i], (g_get_monotonic_time () - start) / 1000);
+        return TRUE;
+    }
 
-        gchar * phrase = NULL, * pinyin = NULL;
-        gint count = -1;
-        if (2 == len || 3 == len) {
-            phrase = items[0];
-            pinyin = items[1];
-            if (3 == len)
-                count = atoi (items[2]);
-        } else
-            continue;
+    return FALSE;
+}
 
-        pinyin_iterator_add_phrase (iter, phrase, pinyin, count);
+gboolean
+LibPinyinBackEnd::addonCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+    ContextWriter writer (*self);
 
-        g_strfreev (items);
-    }
+    if (self->stepAddons (self->m_pinyin_context, self->m_pinyin_addons))
+        return TRUE;
+    if (self->stepAddons (self->m_chewing_context, self->m_chewing_addons))
+        return TRUE;
 
-    pinyin_end_add_phrases (iter);
-    fclose (dictfile);
+    self->m_addon_id = 0;
+    return FALSE;
+}
 
-    modified ();
-    return TRUE;
+void
+LibPinyinBackEnd::modified (pinyin_instance_t *instance)
+{
+    modified (storeOf (journalOf (instance)));
 }
 
+void
+LibPinyinBackEnd::modified (PersistentStore store)
+{
+    m_modified_serial ++;
+    m_unjournaled = TRUE;
+    Persistence::modified (store);
+}
+
+static gboolean
+is_compressed_file (const char *filename)
+{
+    return g_str_has_suffix (filename, ".gz");
+}
+
+/* map the plain text file, or decompress the "*.gz" file. */
+static GBytes *
+read_dictionary_file (const char *filename, GError **error)
+{
+    if (!is_compressed_file (filename)) {
+        GMappedFile *file = g_mapped_file_new (filename, FALSE, error);
+        if (NULL == file)
+            return NULL;
+        GBytes *bytes = g_mapped_file_get_bytes (file);
+        g_mapped_file_unref (file);
+        return bytes;
+    }
+
+    GFile *file = g_file_new_for_path (filename);
+    GFileInputStream *input = g_file_read (file, NULL, error);
+    g_object_unref (file);
+    if (NULL == input)
+        return NULL;
+
+    GConverter *decompressor = G_CONVERTER
+        (g_zlib_decompressor_new (G_ZLIB_COMPRESSOR_FORMAT_GZIP));
+    GInputStream *stream = g_converter_input_stream_new
+        (G_INPUT_STREAM (input), decompressor);
+    g_object_unref (decompressor);
+    g_object_unref (input);
+
+    GOutputStream *output = g_memory_output_stream_new_resizable ();
+    gssize size = g_output_stream_splice
+        (output, stream, (GOutputStreamSpliceFlags)
+         (G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE |
+          G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET), NULL, error);
+    g_object_unref (stream);
+
+    GBytes *bytes = NULL;
+    if (size >= 0)
+        bytes = g_memory_output_stream_steal_as_bytes
+            (G_MEMORY_OUTPUT_STREAM (output));
+    g_object_unref (output);
+    return bytes;
+}
+
+/* import the dictionary in low priority idle batches, the libpinyin
+   context is not thread safe, so the typing is interleaved with the
+   batches instead. the empty filename cancels the running import. */
 gboolean
-LibPinyinBackEnd::exportPinyinDictionary (const char *filename)
+LibPinyinBackEnd::importPinyinDictionary (const char *filename)
 {
-    /* user phrase library should be already loaded here. */
-    FILE * dictfile = fopen (filename, "w");
-    if (NULL == dictfile)
+    if (m_import_id)
+        finishImport (FALSE);
+
+    if (NULL == filename || '\0' == filename[0])
         return FALSE;
 
-    export_iterator_t * iter = pinyin_begin_get_phrases
-        (m_pinyin_context, USER_DICTIONARY);
+    /* complete the running export before import. */
+    if (m_export_id) {
+        while (exportStep ());
+        finishExport (!g_cancellable_is_cancelled (m_export_cancellable));
+    }
 
-    if (NULL == iter) {
-        fclose(dictfile);
+    GError *error = NULL;
+    m_import_file = read_dictionary_file (filename, &error);
+    if (NULL == m_import_file) {
+        g_warning ("can not open %s: %s", filename, error->message);
+        g_error_free (error);
         return FALSE;
     }
 
-    /* use " " as the separator. */
-    while (pinyin_iterator_has_next_phrase (iter)) {
-        gchar * phrase = NULL; gchar * pinyin = NULL;
-        gint count = -1;
-
-        g_assert (pinyin_iterator_get_next_phrase (iter, &phrase, &pinyin, &count));
-
-        if (-1 == count) /* skip output the default count. */
-            fprintf (dictfile, "%s %s\n", phrase, pinyin);
-        else /* output the count. */
-            fprintf (dictfile, "%s %s %d\n", phrase, pinyin, count);
+    /* user phrase library should be already loaded here. */
+    waitPinyinContext (-1);
+    if (NULL == m_pinyin_context)
+        m_pinyin_context = initPinyinContext (&PinyinConfig::instance ());
 
-        g_free (phrase); g_free (pinyin);
+    ContextWriter writer (*this);
+    m_import_iter = pinyin_begin_add_phrases
+        (m_pinyin_context, USER_DICTIONARY);
+    if (NULL == m_import_iter) {
+        g_bytes_unref (m_import_file);
+        m_import_file = NULL;
+        return FALSE;
     }
 
-    pinyin_end_get_phrases(iter);
-    fclose (dictfile);
+    m_import_offset = 0;
+    m_import_progress = -1;
+    m_import_id = g_idle_add_full (G_PRIORITY_LOW,
+                                   LibPinyinBackEnd::importCallback,
+                                   static_cast<gpointer> (this), NULL);
     return TRUE;
 }
 
+/* return FALSE when the whole file is imported. */
 gboolean
-LibPinyinBackEnd::clearPinyinUserData (const char *target)
+LibPinyinBackEnd::importStep (void)
 {
-    if (NULL == m_pinyin_context)
-        return FALSE;
+    gsize length = 0;
+    const gchar * contents = (const gchar *)
+        g_bytes_get_data (m_import_file, &length);
+    const gchar * end = contents + length;
+
+    std::string phrase, pinyin;
+    gint64 deadline = g_get_monotonic_time () + IMPORT_STEP_TIME;
+    ContextWriter writer (*this);
+
+    const gchar * line = contents + m_import_offset;
+    for (guint n = 0; line < end; ++n) {
+        if (0 == n % IMPORT_CHECK_LINES && g_get_monotonic_time () > deadline)
+            break;
 
-    if (0 == strcmp ("all", target)) {
+        const gchar * eol = (const gchar *) memchr (line, '\n', end - line);
+        if (NULL == eol)
+            eol = end;
+
+        gint count = -1;
+        if (split_phrase_line (line, eol, phrase, pinyin, count))
+            pinyin_iterator_add_phrase (m_import_iter, phrase.c_str (),
+                                        pinyin.c_str (), count);
+
+        line = eol < end ? eol + 1 : end;
+    }
+    m_import_offset = line - contents;
+
+    /* report the progress in percent. */
+    gint progress = length ? (gint) (m_import_offset * 100 / length) : 100;
+    if (progress != m_import_progress) {
+        m_import_progress = progress;
+        PinyinConfig::instance ().importDictionaryProgress (progress);
+    }
+
+    return line < end;
+}
+
+void
+LibPinyinBackEnd::finishImport (gboolean completed)
+{
+    if (m_import_id) {
+        g_source_remove (m_import_id);
+        m_import_id = 0;
+    }
+
+    /* keep the imported phrases when cancelled. */
+    ContextWriter writer (*this);
+    pinyin_end_add_phrases (m_import_iter);
+    m_import_iter = NULL;
+    g_bytes_unref (m_import_file);
+    m_import_file = NULL;
+
+    if (!completed)
+        PinyinConfig::instance ().importDictionaryProgress (-1);
+
+    modified (STORE_PINYIN_CONTEXT);
+}
+
+gboolean
+LibPinyinBackEnd::importCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    if (self->importStep ())
+        return TRUE;
+
+    self->m_import_id = 0;
+    self->finishImport (TRUE);
+    return FALSE;
+}
+
+/* export the dictionary in low priority idle batches like the import,
+   the lines are written through the buffered stream, and the file is
+   replaced when the export is completed. the empty filename cancels the
+   running export. */
+gboolean
+LibPinyinBackEnd::exportPinyinDictionary (const char *filename)
+{
+    if (m_export_id)
+        finishExport (FALSE);
+
+    if (NULL == filename || '\0' == filename[0])
+        return FALSE;
+
+    /* complete the running import before export. */
+    if (m_import_id) {
+        while (importStep ());
+        finishImport (TRUE);
+    }
+
+    /* user phrase library should be already loaded here. */
+    waitPinyinContext (-1);
+    if (NULL == m_pinyin_context)
+        return FALSE;
+
+    m_export_cancellable = g_cancellable_new ();
+
+    GError *error = NULL;
+    GFile *file = g_file_new_for_path (filename);
+    GFileOutputStream *output = g_file_replace
+        (file, NULL, FALSE, G_FILE_CREATE_NONE, m_export_cancellable, &error);
+    g_object_unref (file);
+    if (NULL == output) {
+        g_warning ("can not create %s: %s", filename, error->message);
+        g_error_free (error);
+        g_object_unref (m_export_cancellable);
+        m_export_cancellable = NULL;
+        return FALSE;
+    }
+
+    GOutputStream *stream = G_OUTPUT_STREAM (output);
+    if (is_compressed_file (filename)) {
+        GConverter *compressor = G_CONVERTER
+            (g_zlib_compressor_new (G_ZLIB_COMPRESSOR_FORMAT_GZIP, -1));
+        stream = g_converter_output_stream_new (stream, compressor);
+        g_object_unref (compressor);
+        g_object_unref (output);
+    }
+
+    m_export_stream = g_buffered_output_stream_new_sized
+        (stream, EXPORT_BUFFER_SIZE);
+    g_object_unref (stream);
+
+    m_export_iter = pinyin_begin_get_phrases
+        (m_pinyin_context, USER_DICTIONARY);
+    if (NULL == m_export_iter) {
+        finishExport (FALSE);
+        return FALSE;
+    }
+
+    m_export_count = 0;
+    PinyinConfig::instance ().exportDictionaryProgress (0);
+    m_export_id = g_idle_add_full (G_PRIORITY_LOW,
+                                   LibPinyinBackEnd::exportCallback,
+                                   static_cast<gpointer> (this), NULL);
+    return TRUE;
+}
+
+/* return FALSE when the whole dictionary is exported, or the write fails. */
+gboolean
+LibPinyinBackEnd::exportStep (void)
+{
+    String line;
+    gint64 deadline = g_get_monotonic_time () + IMPORT_STEP_TIME;
+
+    for (guint n = 0; pinyin_iterator_has_next_phrase (m_export_iter); ++n) {
+        if (0 == n % IMPORT_CHECK_LINES && g_get_monotonic_time () > deadline)
+            break;
+
+        gchar * phrase = NULL; gchar * pinyin = NULL;
+        gint count = -1;
+
+        if (!pinyin_iterator_get_next_phrase (m_export_iter,
+                                              &phrase, &pinyin, &count))
+            break;
+
+        /* use " " as the separator, skip output the default count. */
+        line = phrase;
+        line += ' ';
+        line += pinyin;
+        if (-1 != count) {
+            line += ' ';
+            line.appendInt (count);
+        }
+        line += '\n';
+        g_free (phrase); g_free (pinyin);
+
+        GError *error = NULL;
+        if (!g_output_stream_write_all (m_export_stream, line.data (),
+                                        line.size (), NULL,
+                                        m_export_cancellable, &error)) {
+            g_warning ("can not export dictionary: %s", error->message);
+            g_error_free (error);
+            g_cancellable_cancel (m_export_cancellable);
+            return FALSE;
+        }
+        m_export_count ++;
+    }
+
+    /* report the number of the exported phrases. */
+    PinyinConfig::instance ().exportDictionaryProgress (m_export_count);
+    return pinyin_iterator_has_next_phrase (m_export_iter);
+}
+
+void
+LibPinyinBackEnd::finishExport (gboolean completed)
+{
+    if (m_export_id) {
+        g_source_remove (m_export_id);
+        m_export_id = 0;
+    }
+
+    if (m_export_iter)
+        pinyin_end_get_phrases (m_export_iter);
+    m_export_iter = NULL;
+
+    /* the cancelled stream keeps the old file. */
+    if (!completed)
+        g_cancellable_cancel (m_export_cancellable);
+
+    GError *error = NULL;
+    if (!g_output_stream_close (m_export_stream,
+                                m_export_cancellable, &error)) {
+        if (completed)
+            g_warning ("can not export dictionary: %s", error->message);
+        g_error_free (error);
+        completed = FALSE;
+    }
+    g_object_unref (m_export_stream);
+    m_export_stream = NULL;
+    g_object_unref (m_export_cancellable);
+    m_export_cancellable = NULL;
+
+    if (!completed)
+        PinyinConfig::instance ().exportDictionaryProgress (-1);
+}
+
+gboolean
+LibPinyinBackEnd::exportCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    gboolean more = self->exportStep ();
+    if (more)
+        return TRUE;
+
+    self->m_export_id = 0;
+    self->finishExport (!g_cancellable_is_cancelled
+                        (self->m_export_cancellable));
+    return FALSE;
+}
+
+gboolean
+LibPinyinBackEnd::clearPinyinUserData (const char *target)
+{
+    if (m_import_id)
+        finishImport (FALSE);
+    if (m_export_id)
+        finishExport (FALSE);
+
+    if (NULL == m_pinyin_context)
+        return FALSE;
+
+    ContextWriter writer (*this);
+    if (0 == strcmp ("all", target)) {
         pinyin_mask_out (m_pinyin_context, 0x0, 0x0);
         PinyinConfig::instance ().networkDictionaryStartTimestamp (0);
         PinyinConfig::instance ().networkDictionaryEndTimestamp (0);
@@ -333,7 +1203,7 @@ LibPinyinBackEnd::clearPinyinUserData (const char *target)
         g_warning ("unknown clear target: %s.\n", target);
     }
 
-    modified ();
+    modified (STORE_PINYIN_CONTEXT);
     return TRUE;
 }
 
@@ -343,78 +1213,395 @@ LibPinyinBackEnd::rememberUserInput (pinyin_instance_t *instance,
 {
     /* pre-check the incomplete pinyin keys, prepare pinyin string,
        remember user input. */
+    ContextWriter writer (*this);
     pinyin_remember_user_input (instance, phrase, -1);
+    m_modified_serial ++;
 
     /* save later,
        will mark modified from pinyin/bopomofo editor. */
     return TRUE;
 }
 
+/* the pinyin of the phrase separated by "'",
+   when each character of the phrase has its pinyin key. */
+static gboolean
+get_pinyin_string (pinyin_instance_t *instance, const gchar *phrase,
+                   std::string & pinyin)
+{
+    guint len = 0;
+    pinyin_get_n_pinyin (instance, &len);
+    if (len == 0 || len != g_utf8_strlen (phrase, -1))
+        return FALSE;
+
+    for (guint i = 0; i < len; ++i) {
+        PinyinKey *key = NULL;
+        pinyin_get_pinyin_key (instance, i, &key);
+
+        gchar *str = NULL;
+        pinyin_get_pinyin_string (instance, key, &str);
+        if (NULL == str)
+            return FALSE;
+
+        if (i)
+            pinyin += '\'';
+        pinyin += str;
+        g_free (str);
+    }
+    return TRUE;
+}
+
+void
+LibPinyinBackEnd::trained (pinyin_instance_t *instance, const gchar *phrase,
+                           gboolean remember)
+{
+    /* the instance is reset after the commit,
+       so the remembering can not be deferred. */
+    if (remember) {
+        ContextWriter writer (*this);
+        pinyin_remember_user_input (instance, phrase, -1);
+    }
+    m_modified_serial ++;
+
+    std::string pinyin;
+    TrainingJournal & journal = journalOf (instance);
+    if (journal.isOpened () && get_pinyin_string (instance, phrase, pinyin)) {
+        guint flags = TrainingJournal::RECORD_TRAIN;
+        if (remember)
+            flags |= TrainingJournal::RECORD_REMEMBER;
+        journal.append (flags, pinyin.c_str (), phrase);
+    } else {
+        m_unjournaled = TRUE;
+    }
+    Persistence::modified (storeOf (journal));
+
+    if (m_trained_id != 0)
+        return;
+
+    m_trained_id = g_idle_add_full (G_PRIORITY_LOW,
+                                    LibPinyinBackEnd::trainedCallback,
+                                    static_cast<gpointer> (this), NULL);
+}
+
 gboolean
-LibPinyinBackEnd::timeoutCallback (gpointer data)
+LibPinyinBackEnd::trainedCallback (gpointer data)
 {
     LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
 
-    /* Get the elapsed time since last modification of database. */
-    guint elapsed = (guint)g_timer_elapsed (self->m_timer, NULL);
+    self->m_trained_id = 0;
+    /* fsync the trainings of the burst at once. */
+    self->syncJournals ();
+    return FALSE;
+}
 
-    if (elapsed >= LIBPINYIN_SAVE_TIMEOUT &&
-        self->saveUserDB ()) {
-        self->m_timeout_id = 0;
-        return FALSE;
+TrainingJournal &
+LibPinyinBackEnd::journalOf (pinyin_instance_t *instance)
+{
+    if (m_chewing_allocated.count (instance))
+        return m_chewing_journal;
+    return m_pinyin_journal;
+}
+
+PersistentStore
+LibPinyinBackEnd::storeOf (TrainingJournal & journal)
+{
+    if (&journal == &m_chewing_journal)
+        return STORE_CHEWING_CONTEXT;
+    return STORE_PINYIN_CONTEXT;
+}
+
+PersistentStore
+LibPinyinBackEnd::storeOf (pinyin_context_t *context)
+{
+    if (context == m_chewing_context)
+        return STORE_CHEWING_CONTEXT;
+    return STORE_PINYIN_CONTEXT;
+}
+
+void
+LibPinyinBackEnd::syncJournals (void)
+{
+    m_pinyin_journal.sync ();
+    m_chewing_journal.sync ();
+}
+
+void
+LibPinyinBackEnd::flush (void)
+{
+    if (m_trained_id != 0) {
+        g_source_remove (m_trained_id);
+        m_trained_id = 0;
+        syncJournals ();
     }
+}
+
+void
+LibPinyinBackEnd::startSave (PersistentStore store)
+{
+    m_save_pending |= 1 << store;
+
+    /* the modifications until now are in the contexts to save. */
+    m_saving_unjournaled = m_saving_unjournaled || m_unjournaled;
+    m_unjournaled = FALSE;
+
+    /* key events are dispatched before the save steps. */
+    if (m_save_id != 0)
+        return;
 
+    m_save_id = g_idle_add_full (G_PRIORITY_LOW,
+                                 LibPinyinBackEnd::saveCallback,
+                                 static_cast<gpointer> (this), NULL);
+}
+
+gboolean
+LibPinyinBackEnd::savePinyinCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+    self->startSave (STORE_PINYIN_CONTEXT);
     return TRUE;
 }
 
+gboolean
+LibPinyinBackEnd::saveChewingCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+    self->startSave (STORE_CHEWING_CONTEXT);
+    return TRUE;
+}
+
+gboolean
+LibPinyinBackEnd::saveCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    /* save one context at a time, to keep each stall short. */
+    if (self->m_save_pending & (1 << STORE_PINYIN_CONTEXT)) {
+        self->m_save_pending &= ~(1 << STORE_PINYIN_CONTEXT);
+        self->saveContext (self->m_pinyin_context, "libpinyin",
+                           self->m_pinyin_journal);
+    } else if (self->m_save_pending & (1 << STORE_CHEWING_CONTEXT)) {
+        self->m_save_pending &= ~(1 << STORE_CHEWING_CONTEXT);
+        self->saveContext (self->m_chewing_context, "libbopomofo",
+                           self->m_chewing_journal);
+    }
+
+    if (self->m_save_pending)
+        return TRUE;
+
+    self->m_save_id = 0;
+    self->m_saving_unjournaled = FALSE;
+    CacheSnapshot::save (snapshotFingerprint ());
+    return FALSE;
+}
+
 gboolean
 LibPinyinBackEnd::saveUserDB (void)
 {
-    if (m_pinyin_context)
-        pinyin_save (m_pinyin_context);
-    if (m_chewing_context)
-        pinyin_save (m_chewing_context);
+    saveContext (m_pinyin_context, "libpinyin", m_pinyin_journal);
+    saveContext (m_chewing_context, "libbopomofo", m_chewing_journal);
+    m_unjournaled = FALSE;
+    return TRUE;
+}
+
+gboolean
+LibPinyinBackEnd::saveContext (pinyin_context_t *context, const char *name,
+                               TrainingJournal & journal)
+{
+    if (NULL == context)
+        return FALSE;
+
+    time_t now = time (NULL);
+    gint64 start = g_get_monotonic_time ();
+    {
+        ContextWriter writer (*this);
+        pinyin_save (context);
+    }
+    gint64 duration = g_get_monotonic_time () - start;
+    Stats::add (STATS_SAVES);
+    Stats::add (STATS_SAVE_TIME, duration);
+
+    /* the journaled trainings are saved in the context now. */
+    journal.truncate ();
+
+    /* count the bytes of the files re-written by pinyin_save. */
+    goffset written = 0;
+    gchar * userdir = g_build_filename (g_get_user_cache_dir (),
+                                        "ibus", name, NULL);
+    GDir * dir = g_dir_open (userdir, 0, NULL);
+    if (dir) {
+        const gchar * filename = NULL;
+        while ((filename = g_dir_read_name (dir)) != NULL) {
+            gchar * path = g_build_filename (userdir, filename, NULL);
+            GStatBuf buf;
+            if (0 == g_stat (path, &buf) && buf.st_mtime >= now)
+                written += buf.st_size;
+            g_free (path);
+        }
+        g_dir_close (dir);
+    }
+    g_free (userdir);
+
+    g_debug ("saved %s user db in %" G_GINT64_FORMAT " ms, "
+             "%" G_GOFFSET_FORMAT " bytes written.",
+             name, duration / 1000, written);
     return TRUE;
 }
 
 #define TIMESTAMP_LINE "# timestamp: %ld\n"
 
+/* the fingerprint of the loaded network dictionary. */
+struct NetworkFingerprint {
+    gint64 mtime;
+    gint64 size;
+    guint64 hash;
+    gint64 start;
+    gint64 loaded;
+};
+
+static gboolean
+read_network_fingerprint (const gchar * filename,
+                          NetworkFingerprint & fingerprint)
+{
+    gchar *contents = NULL;
+    if (!g_file_get_contents (filename, &contents, NULL, NULL))
+        return FALSE;
+
+    int retval = sscanf (contents, "%" G_GINT64_FORMAT " %" G_GINT64_FORMAT
+                         " %" G_GUINT64_FORMAT " %" G_GINT64_FORMAT
+                         " %" G_GINT64_FORMAT,
+                         &fingerprint.mtime, &fingerprint.size,
+                         &fingerprint.hash, &fingerprint.start,
+                         &fingerprint.loaded);
+    g_free (contents);
+    return 5 == retval;
+}
+
+static void
+write_network_fingerprint (const gchar * filename,
+                           const NetworkFingerprint & fingerprint)
+{
+    gchar *contents = g_strdup_printf
+        ("%" G_GINT64_FORMAT " %" G_GINT64_FORMAT " %" G_GUINT64_FORMAT
+         " %" G_GINT64_FORMAT " %" G_GINT64_FORMAT "\n",
+         fingerprint.mtime, fingerprint.size, fingerprint.hash,
+         fingerprint.start, fingerprint.loaded);
+    g_file_set_contents (filename, contents, -1, NULL);
+    g_free (contents);
+}
+
+/* FNV-1a */
+static guint64
+hash_network_dictionary (const gchar * contents, gsize length)
+{
+    guint64 hash = G_GUINT64_CONSTANT (14695981039346656037);
+    for (gsize i = 0; i < length; ++i) {
+        hash ^= (guchar) contents[i];
+        hash *= G_GUINT64_CONSTANT (1099511628211);
+    }
+    return hash;
+}
+
+/* parse "# timestamp: %ld" line. */
+static gboolean
+parse_network_timestamp (const gchar * line, const gchar * end,
+                         time_t & stamp)
+{
+    static const char prefix[] = "# timestamp: ";
+    const gsize len = sizeof (prefix) - 1;
+
+    if ((gsize) (end - line) < len || 0 != strncmp (line, prefix, len))
+        return FALSE;
+
+    stamp = 0;
+    gboolean negative = FALSE;
+    const gchar * p = line + len;
+    if (p < end && '-' == *p) {
+        negative = TRUE;
+        ++p;
+    }
+    for (; p < end && g_ascii_isdigit (*p); ++p)
+        stamp = stamp * 10 + (*p - '0');
+    if (negative)
+        stamp = -stamp;
+    return TRUE;
+}
+
+/* split the line into phrase, pinyin and the optional count,
+   as g_strsplit_set (line, " \t", 3) does. */
+static gboolean
+split_phrase_line (const gchar * line, const gchar * eol,
+                   std::string & phrase, std::string & pinyin, gint & count)
+{
+    const gchar * p = line;
+    while (p < eol && ' ' != *p && '\t' != *p)
+        ++p;
+    if (p == eol)
+        return FALSE;
+    phrase.assign (line, p - line);
+
+    const gchar * q = ++p;
+    while (q < eol && ' ' != *q && '\t' != *q)
+        ++q;
+    pinyin.assign (p, q - p);
+
+    count = -1;
+    if (q < eol)
+        count = atoi (std::string (q + 1, eol - q - 1).c_str ());
+    return TRUE;
+}
+
 bool
 LibPinyinBackEnd::readNetworkDictionary(pinyin_context_t * context,
                                         const char * filename,
+                                        const char * fingerprint_file,
                                         /* inout */ time_t & start,
-                                        /* inout */ time_t & loaded)
+                                        /* inout */ time_t & loaded,
+                                        /* out */ bool & changed)
 {
-    time_t current = time (NULL);
-
-    FILE * dictfile = fopen (filename, "r");
-
-    if (NULL == dictfile) {
+    GStatBuf buf;
+    if (g_stat (filename, &buf) != 0) {
         fprintf (stderr, "failed to open file: %s.\n", filename);
         return FALSE;
     }
 
-    if (!checkNetworkDictionary (context, dictfile, start, loaded)) {
-        fclose (dictfile);
+    /* skip unchanged network dictionary without reading it. */
+    NetworkFingerprint fingerprint;
+    gboolean cached = fingerprint_file &&
+        read_network_fingerprint (fingerprint_file, fingerprint) &&
+        fingerprint.start == start && fingerprint.loaded == loaded;
+
+    if (cached &&
+        fingerprint.mtime == (gint64) buf.st_mtime &&
+        fingerprint.size == (gint64) buf.st_size)
+        return TRUE;
+
+    /* the mapped file is shared by the pinyin and chewing contexts. */
+    g_mutex_lock (&m_network_lock);
+    if (NULL == m_network_file)
+        m_network_file = g_mapped_file_new (filename, FALSE, NULL);
+    g_mutex_unlock (&m_network_lock);
+    if (NULL == m_network_file) {
+        fprintf (stderr, "failed to open file: %s.\n", filename);
         return FALSE;
     }
 
-    fseek (dictfile, 0, SEEK_SET);
+    const gchar * contents = g_mapped_file_get_contents (m_network_file);
+    gsize length = g_mapped_file_get_length (m_network_file);
+    guint64 hash = hash_network_dictionary (contents, length);
 
-    /* read to the loaded time. */
-    forwardNetworkDictionary (dictfile, loaded);
-
-    /* import the rest of network dictionary. */
-    bool retval = importRestNetworkDictionary (context, dictfile, loaded);
-
-    fclose (dictfile);
-
-    /* if network.txt only contains one time stamp entry */
-    if (start > loaded)
-        loaded = start;
+    if (!(cached && fingerprint.hash == hash)) {
+        if (!importNetworkDictionary (context, contents, length,
+                                      start, loaded, changed))
+            return FALSE;
+    }
 
-    if (retval)
-        modified ();
+    if (fingerprint_file) {
+        fingerprint.mtime = buf.st_mtime;
+        fingerprint.size = buf.st_size;
+        fingerprint.hash = hash;
+        fingerprint.start = start;
+        fingerprint.loaded = loaded;
+        write_network_fingerprint (fingerprint_file, fingerprint);
+    }
     return TRUE;
 }
 
@@ -423,103 +1610,372 @@ LibPinyinBackEnd::clearNetworkDictionary (pinyin_context_t * context)
 {
     pinyin_mask_out (context, PHRASE_INDEX_LIBRARY_MASK,
                      PHRASE_INDEX_MAKE_TOKEN (NETWORK_DICTIONARY, null_token));
-    modified ();
     return TRUE;
 }
 
-bool
-LibPinyinBackEnd::checkNetworkDictionary (pinyin_context_t * context,
-                                          FILE * dictfile,
-                                          /* inout */ time_t & start,
-                                          /* inout */ time_t & loaded)
+/* scan the network dictionary in one pass, the lines before the first
+   time stamp newer than loaded are skipped, the rest are collected. */
+gboolean
+LibPinyinBackEnd::scanNetworkDictionary (const gchar * contents,
+                                         gsize length,
+                                         NetworkUpdate & update)
 {
-    long stamp = 0;
-    /* check the first line with start time. */
-    int retval = fscanf (dictfile, TIMESTAMP_LINE, &stamp);
+    const gchar * end = contents + length;
+    update.clear = FALSE;
+    update.lines.clear ();
 
     /* empty network dictionary. */
-    if (retval == EOF) {
-        clearNetworkDictionary (context);
+    if (0 == length) {
+        update.clear = TRUE;
         return FALSE;
     }
 
+    /* check the first line with start time. */
+    const gchar * eol = (const gchar *) memchr (contents, '\n', length);
+    time_t stamp = 0;
+    parse_network_timestamp (contents, eol ? eol : end, stamp);
+
     /* clear network dictionary if start time is changed. */
-    if (start != stamp) {
-        clearNetworkDictionary (context);
+    if (update.start != stamp) {
+        update.clear = TRUE;
 
         /* reset the time */
-        start = stamp;
-        loaded = stamp - 1;
+        update.start = stamp;
+        update.loaded = stamp - 1;
     }
 
-    return TRUE;
-}
+    bool forward = TRUE;
 
-bool
-LibPinyinBackEnd::forwardNetworkDictionary (FILE * dictfile,
-                                            /* in */ time_t loaded)
-{
-    char* linebuf = NULL; size_t size = 0; ssize_t read;
-    while ((read = getline (&linebuf, &size, dictfile)) != -1) {
-        if (0 == strlen (linebuf))
+    for (const gchar * line = contents; line < end; line = eol + 1) {
+        eol = (const gchar *) memchr (line, '\n', end - line);
+        if (NULL == eol)
+            eol = end;
+
+        if (line == eol)
             continue;
 
-        if ('#' != linebuf[0])
+        /* read to the loaded time. */
+        if (forward) {
+            if ('#' == *line && parse_network_timestamp (line, eol, stamp) &&
+                update.loaded < stamp)
+                forward = FALSE;
             continue;
+        }
 
-        time_t stamp;
-        sscanf (linebuf, TIMESTAMP_LINE, &stamp);
+        if ('#' == *line) {
+            parse_network_timestamp (line, eol, update.loaded);
+            continue;
+        }
 
-        if (loaded < stamp)
-            break;
+        update.lines.push_back (std::make_pair (line, eol));
     }
 
+    /* if network.txt only contains one time stamp entry */
+    if (update.start > update.loaded)
+        update.loaded = update.start;
     return TRUE;
 }
 
 bool
-LibPinyinBackEnd::importRestNetworkDictionary (pinyin_context_t * context,
-                                               FILE * dictfile,
-                                               /* out */ time_t & loaded)
+LibPinyinBackEnd::importNetworkDictionary (pinyin_context_t * context,
+                                           const gchar * contents,
+                                           gsize length,
+                                           /* inout */ time_t & start,
+                                           /* inout */ time_t & loaded,
+                                           /* out */ bool & changed)
 {
-    bool retval = FALSE;
+    NetworkUpdate update;
+    update.start = start;
+    update.loaded = loaded;
 
-    import_iterator_t * iter = pinyin_begin_add_phrases
-        (context, NETWORK_DICTIONARY);
+    gboolean retval = scanNetworkDictionary (contents, length, update);
+    if (update.clear) {
+        clearNetworkDictionary (context);
+        changed = TRUE;
+    }
+    if (!retval)
+        return FALSE;
 
-    char* linebuf = NULL; size_t size = 0; ssize_t read;
-    while ((read = getline (&linebuf, &size, dictfile)) != -1) {
-        if (0 == strlen (linebuf))
-            continue;
+    if (!update.lines.empty ()) {
+        import_iterator_t * iter = pinyin_begin_add_phrases
+            (context, NETWORK_DICTIONARY);
+        std::string phrase, pinyin;
+        for (size_t i = 0; i < update.lines.size (); ++i) {
+            gint count = -1;
+            if (split_phrase_line (update.lines[i].first,
+                                   update.lines[i].second,
+                                   phrase, pinyin, count))
+                pinyin_iterator_add_phrase (iter, phrase.c_str (),
+                                            pinyin.c_str (), count);
+        }
+        pinyin_end_add_phrases (iter);
+        changed = TRUE;
+    }
+
+    start = update.start;
+    loaded = update.loaded;
+    return TRUE;
+}
+
+void
+LibPinyinBackEnd::watchNetworkDictionary (void)
+{
+    if (m_network_monitor)
+        return;
+
+    GFile *file = g_file_new_for_path (NETWORK_DICTIONARY_FILE);
+    m_network_monitor = g_file_monitor_file (file, G_FILE_MONITOR_NONE,
+                                             NULL, NULL);
+    g_object_unref (file);
+    if (NULL == m_network_monitor)
+        return;
+
+    g_signal_connect (m_network_monitor, "changed",
+                      G_CALLBACK (LibPinyinBackEnd::networkChangedCallback),
+                      this);
+}
+
+/* the file is usually replaced in several events, reload it after
+   the events are settled. */
+void
+LibPinyinBackEnd::networkChangedCallback (GFileMonitor *monitor,
+                                          GFile *file, GFile *other,
+                                          GFileMonitorEvent event,
+                                          gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    if (G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED == event)
+        return;
+
+    if (self->m_network_timeout_id)
+        g_source_remove (self->m_network_timeout_id);
+    self->m_network_timeout_id = g_timeout_add_seconds
+        (NETWORK_RELOAD_DELAY, LibPinyinBackEnd::networkTimeoutCallback, self);
+}
+
+gboolean
+LibPinyinBackEnd::networkTimeoutCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+
+    self->m_network_timeout_id = 0;
+    self->reloadNetworkDictionary ();
+    return FALSE;
+}
+
+/* the contexts still loading read the new file themselves. */
+void
+LibPinyinBackEnd::reloadNetworkDictionary (void)
+{
+    NetworkReload & reload = m_network_reload;
 
-        if ('#' == linebuf[0]) {
-            sscanf (linebuf, TIMESTAMP_LINE, &loaded);
+    if (reload.thread || reload.import_id) {
+        reload.pending = TRUE;
+        return;
+    }
+    reload.pending = FALSE;
+
+    struct {
+        pinyin_context_t *context;
+        Config *config;
+        const char *name;
+    } contexts [] = {
+        { m_pinyin_context, &PinyinConfig::instance (), "libpinyin" },
+        { m_chewing_context, &BopomofoConfig::instance (), "libbopomofo" },
+    };
+
+    reload.n_targets = 0;
+    for (guint i = 0; i < G_N_ELEMENTS (contexts); ++i) {
+        if (NULL == contexts[i].context)
             continue;
+
+        NetworkTarget & target = reload.targets[reload.n_targets++];
+        target.context = contexts[i].context;
+        target.config = contexts[i].config;
+        target.name = contexts[i].name;
+        target.update.start = target.config->networkDictionaryStartTimestamp ();
+        target.update.loaded = target.config->networkDictionaryEndTimestamp ();
+        target.update.clear = FALSE;
+        target.update.lines.clear ();
+        target.next = 0;
+        target.iter = NULL;
+    }
+
+    if (0 == reload.n_targets)
+        return;
+
+    reload.current = 0;
+    reload.thread = g_thread_new
+        ("network", LibPinyinBackEnd::networkScanThread, this);
+}
+
+/* only touches the reload, the contexts are imported in the main loop. */
+gpointer
+LibPinyinBackEnd::networkScanThread (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
+    NetworkReload & reload = self->m_network_reload;
+
+    GStatBuf buf;
+    reload.file = NULL;
+    if (0 == g_stat (NETWORK_DICTIONARY_FILE, &buf))
+        reload.file = g_mapped_file_new (NETWORK_DICTIONARY_FILE, FALSE, NULL);
+
+    if (reload.file) {
+        const gchar * contents = g_mapped_file_get_contents (reload.file);
+        gsize length = g_mapped_file_get_length (reload.file);
+        reload.mtime = buf.st_mtime;
+        reload.size = buf.st_size;
+        reload.hash = hash_network_dictionary (contents, length);
+
+        for (guint i = 0; i < reload.n_targets; ++i)
+            scanNetworkDictionary (contents, length, reload.targets[i].update);
+    }
+
+    g_idle_add (LibPinyinBackEnd::networkScannedCallback, NULL);
+    return NULL;
+}
+
+gboolean
+LibPinyinBackEnd::networkScannedCallback (gpointer data)
+{
+    if (NULL == m_instance.get ())
+        return FALSE;
+
+    LibPinyinBackEnd *self = m_instance.get ();
+    NetworkReload & reload = self->m_network_reload;
+
+    g_thread_join (reload.thread);
+    reload.thread = NULL;
+
+    if (NULL == reload.file) {
+        self->finishNetworkReload ();
+        return FALSE;
+    }
+
+    reload.import_id = g_idle_add_full
+        (G_PRIORITY_LOW, LibPinyinBackEnd::networkImportCallback,
+         static_cast<gpointer> (self), NULL);
+    return FALSE;
+}
+
+/* return FALSE when all the contexts are imported. */
+gboolean
+LibPinyinBackEnd::networkImportStep (void)
+{
+    NetworkReload & reload = m_network_reload;
+
+    /* wait for the running import of the user dictionary. */
+    if (m_import_iter)
+        return TRUE;
+
+    std::string phrase, pinyin;
+    gint64 deadline = g_get_monotonic_time () + IMPORT_STEP_TIME;
+    guint n = 0;
+    ContextWriter writer (*this);
+
+    for (; reload.current < reload.n_targets; ++reload.current) {
+        NetworkTarget & target = reload.targets[reload.current];
+        NetworkUpdate & update = target.update;
+
+        if (0 == target.next && NULL == target.iter) {
+            if (update.clear)
+                clearNetworkDictionary (target.context);
+            if (!update.lines.empty ())
+                target.iter = pinyin_begin_add_phrases
+                    (target.context, NETWORK_DICTIONARY);
         }
 
-        if ( '\n' == linebuf[strlen (linebuf) - 1] ) {
-            linebuf[strlen (linebuf) - 1] = '\0';
+        for (; target.next < update.lines.size (); ++target.next, ++n) {
+            if (0 == n % IMPORT_CHECK_LINES &&
+                g_get_monotonic_time () > deadline)
+                return TRUE;
+
+            gint count = -1;
+            if (split_phrase_line (update.lines[target.next].first,
+                                   update.lines[target.next].second,
+                                   phrase, pinyin, count))
+                pinyin_iterator_add_phrase (target.iter, phrase.c_str (),
+                                            pinyin.c_str (), count);
         }
 
-        gchar ** items = g_strsplit_set (linebuf, " \t", 3);
-        guint len = g_strv_length (items);
+        if (target.iter) {
+            pinyin_end_add_phrases (target.iter);
+            target.iter = NULL;
+        }
 
-        gchar * phrase = NULL, * pinyin = NULL;
-        gint count = -1;
-        if (2 == len || 3 == len) {
-            phrase = items[0];
-            pinyin = items[1];
-            if (3 == len)
-                count = atoi (items[2]);
-        } else
-            continue;
+        if (update.clear || !update.lines.empty ())
+            modified (storeOf (target.context));
+
+        /* save the timestamp and the fingerprint of the imported file. */
+        target.config->networkDictionaryStartTimestamp (update.start);
+        target.config->networkDictionaryEndTimestamp (update.loaded);
+
+        NetworkFingerprint fingerprint;
+        fingerprint.mtime = reload.mtime;
+        fingerprint.size = reload.size;
+        fingerprint.hash = reload.hash;
+        fingerprint.start = update.start;
+        fingerprint.loaded = update.loaded;
+        gchar *filename = g_build_filename (g_get_user_cache_dir (), "ibus",
+                                            target.name, "network.fingerprint",
+                                            NULL);
+        write_network_fingerprint (filename, fingerprint);
+        g_free (filename);
+    }
+
+    return FALSE;
+}
+
+gboolean
+LibPinyinBackEnd::networkImportCallback (gpointer data)
+{
+    LibPinyinBackEnd *self = static_cast<LibPinyinBackEnd *> (data);
 
-        pinyin_iterator_add_phrase (iter, phrase, pinyin, count);
-        retval = TRUE;
+    if (self->networkImportStep ())
+        return TRUE;
 
-        g_strfreev (items);
+    self->m_network_reload.import_id = 0;
+    self->finishNetworkReload ();
+    return FALSE;
+}
+
+void
+LibPinyinBackEnd::finishNetworkReload (void)
+{
+    NetworkReload & reload = m_network_reload;
+
+    if (reload.import_id) {
+        g_source_remove (reload.import_id);
+        reload.import_id = 0;
+    }
+
+    /* keep the imported phrases when stopped. */
+    ContextWriter writer (*this);
+    for (guint i = 0; i < reload.n_targets; ++i) {
+        NetworkTarget & target = reload.targets[i];
+        if (target.iter)
+            pinyin_end_add_phrases (target.iter);
+        target.iter = NULL;
+        target.update.lines.clear ();
+    }
+    reload.n_targets = 0;
+
+    /* the contexts loaded later map the new file. */
+    if (reload.file) {
+        g_mutex_lock (&m_network_lock);
+        if (NULL == m_pinyin_loader.thread && NULL == m_chewing_loader.thread) {
+            if (m_network_file)
+                g_mapped_file_unref (m_network_file);
+            m_network_file = reload.file;
+        } else {
+            g_mapped_file_unref (reload.file);
+        }
+        g_mutex_unlock (&m_network_lock);
+        reload.file = NULL;
     }
 
-    pinyin_end_add_phrases (iter);
-    return retval;
+    if (reload.pending && m_instance.get () == this)
+        reloadNetworkDictionary ();
 }
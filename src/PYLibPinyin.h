@@ -22,14 +22,26 @@
 #define __PY_LIB_PINYIN_H_
 
 #include <memory>
+#include <deque>
+#include <string>
+#include <vector>
+#include <set>
 #include <time.h>
 #include <glib.h>
+#include <gio/gio.h>
+#include "PYTrainingJournal.h"
+#include "PYPersistence.h"
 
 typedef struct _pinyin_context_t pinyin_context_t;
 typedef struct _pinyin_instance_t pinyin_instance_t;
+typedef struct _import_iterator_t import_iterator_t;
+typedef struct _export_iterator_t export_iterator_t;
 
 namespace PY {
 
+/* the key events wait at most 50ms for the warming up contexts. */
+#define WARM_UP_WAIT_TIME (50 * 1000)
+
 class Config;
 
 class LibPinyinBackEnd{
@@ -44,11 +56,27 @@ public:
     pinyin_context_t * initPinyinContext (Config *config);
     pinyin_context_t * initChewingContext (Config *config);
 
+    /* initialize the contexts in the worker threads. */
+    void warmUp (void);
+    /* reload the network dictionary when it is changed, the file is
+       scanned in a worker thread and the new phrases are imported in
+       idle into the loaded contexts. */
+    void watchNetworkDictionary (void);
+    /* wait at most timeout microseconds for the warming up context,
+       negative timeout waits until it is ready. */
+    gboolean waitPinyinContext (gint64 timeout);
+    gboolean waitChewingContext (gint64 timeout);
+
     pinyin_instance_t *allocPinyinInstance ();
     void freePinyinInstance (pinyin_instance_t *instance);
     pinyin_instance_t *allocChewingInstance ();
     void freeChewingInstance (pinyin_instance_t *instance);
-    void modified (void);
+    /* mark the context of the instance, or the store, to be saved. */
+    void modified (pinyin_instance_t *instance);
+    void modified (PersistentStore store);
+    /* bumped when the user phrases or their frequencies are changed,
+       or the addon libraries are loaded. */
+    guint modifiedSerial (void) const { return m_modified_serial; }
 
     gboolean importPinyinDictionary (const char *filename);
     gboolean exportPinyinDictionary (const char *filename);
@@ -56,6 +84,36 @@ public:
 
     gboolean rememberUserInput (pinyin_instance_t *instance, const gchar *phrase);
 
+    /* after pinyin_train, the training is journaled, and the
+       journal of the burst of selections is synced once in idle. */
+    void trained (pinyin_instance_t *instance, const gchar *phrase,
+                  gboolean remember);
+    /* sync the pending trainings now, the contexts are saved by
+       Persistence. */
+    void flush (void);
+
+    /* choose the candidates spelling the phrase from the start of
+       the input, end is the input offset after the chosen candidates,
+       the constraints are cleared when it fails. */
+    static gboolean choosePhrase (pinyin_instance_t *instance,
+                                  const gchar *phrase, size_t length,
+                                  size_t *end);
+
+    /* The contexts are owned by the main thread. The changes, such as
+       the trainings, the imports and the saves, run in the main thread
+       under the write lock, the other threads queue them in order.
+       The main thread reads without the lock, the other threads read
+       in the ContextReader scope. */
+    typedef void (* ContextWriteFunc) (LibPinyinBackEnd *backend,
+                                       gpointer data);
+    void queueWrite (ContextWriteFunc func, gpointer data,
+                     GDestroyNotify destroy);
+    /* the queued writes run first, nested writes are allowed. */
+    void beginWrite (void);
+    void endWrite (void);
+    void beginRead (void);
+    void endRead (void);
+
     /* use static initializer in C++. */
     static LibPinyinBackEnd & instance (void) { return *m_instance; }
 
@@ -66,36 +124,249 @@ public:
 protected:
     bool readNetworkDictionary(pinyin_context_t * context,
                                const char * filename,
+                               const char * fingerprint_file,
                                /* inout */ time_t & start,
-                               /* inout */ time_t & loaded);
+                               /* inout */ time_t & loaded,
+                               /* out */ bool & changed);
 
 private:
     gboolean saveUserDB (void);
-    static gboolean timeoutCallback (gpointer data);
+    gboolean saveContext (pinyin_context_t *context, const char *name,
+                          TrainingJournal & journal);
+    /* the contexts are saved by Persistence, in low priority idle. */
+    static gboolean savePinyinCallback (gpointer data);
+    static gboolean saveChewingCallback (gpointer data);
+    static gboolean saveCallback (gpointer data);
+    static gboolean trainedCallback (gpointer data);
+    void startSave (PersistentStore store);
+
+    TrainingJournal & journalOf (pinyin_instance_t *instance);
+    PersistentStore storeOf (TrainingJournal & journal);
+    PersistentStore storeOf (pinyin_context_t *context);
+    void syncJournals (void);
+    static guint replayJournal (pinyin_context_t *context,
+                                const char *filename);
+
+    struct ContextWrite {
+        ContextWriteFunc func;
+        gpointer data;
+        GDestroyNotify destroy;
+    };
+
+    void runWrites (void);
+    static gboolean writeCallback (gpointer data);
+
+    gboolean importStep (void);
+    void finishImport (gboolean completed);
+    static gboolean importCallback (gpointer data);
+
+    gboolean exportStep (void);
+    void finishExport (gboolean completed);
+    static gboolean exportCallback (gpointer data);
+
+    /* the lines of the network dictionary to import into a context,
+       the timestamps are updated to the scanned ones. */
+    struct NetworkUpdate {
+        time_t start;
+        time_t loaded;
+        bool clear;
+        std::vector<std::pair<const gchar *, const gchar *> > lines;
+    };
+
+    struct NetworkTarget {
+        pinyin_context_t *context;
+        Config *config;
+        const char *name;
+        NetworkUpdate update;
+        gsize next; /* the next line to import. */
+        import_iterator_t *iter;
+    };
+
+    struct NetworkReload {
+        GThread *thread;
+        GMappedFile *file;
+        gint64 mtime;
+        gint64 size;
+        guint64 hash;
+        NetworkTarget targets[2];
+        guint n_targets;
+        guint current;
+        guint import_id;
+        gboolean pending; /* changed again while reloading. */
+    };
+
+    static gboolean scanNetworkDictionary (const gchar * contents,
+                                           gsize length,
+                                           NetworkUpdate & update);
+    static void networkChangedCallback (GFileMonitor *monitor,
+                                        GFile *file, GFile *other,
+                                        GFileMonitorEvent event,
+                                        gpointer data);
+    static gboolean networkTimeoutCallback (gpointer data);
+    void reloadNetworkDictionary (void);
+    static gpointer networkScanThread (gpointer data);
+    static gboolean networkScannedCallback (gpointer data);
+    gboolean networkImportStep (void);
+    static gboolean networkImportCallback (gpointer data);
+    void finishNetworkReload (void);
 
     bool clearNetworkDictionary (pinyin_context_t * context);
-    bool checkNetworkDictionary (pinyin_context_t * context,
-                                 FILE * dictfile,
-                                 /* inout */ time_t & start,
-                                 /* inout */ time_t & loaded);
-    bool forwardNetworkDictionary (FILE * dictfile,
-                                   /* in */ time_t loaded);
-    bool importRestNetworkDictionary (pinyin_context_t * context,
-                                      FILE * dictfile,
-                                      /* out */ time_t & loaded);
+    bool importNetworkDictionary (pinyin_context_t * context,
+                                  const gchar * contents,
+                                  gsize length,
+                                  /* inout */ time_t & start,
+                                  /* inout */ time_t & loaded,
+                                  /* out */ bool & changed);
+
+    struct ContextLoader {
+        LibPinyinBackEnd *backend;
+        const char *name;
+        time_t start;
+        time_t end;
+        bool changed;
+        TrainingJournal *journal;
+        std::string journal_file;
+        guint replayed;
+        pinyin_context_t *context;
+        GThread *thread;
+        gboolean done;
+    };
+
+    void prepareContext (ContextLoader & loader, const char * name,
+                         TrainingJournal *journal, Config *config);
+    void loadContext (ContextLoader & loader);
+    pinyin_context_t * finishContext (ContextLoader & loader, Config *config);
+    gboolean waitContext (ContextLoader & loader, gint64 timeout);
+    static gpointer warmUpThread (gpointer data);
+    static gboolean warmUpCallback (gpointer data);
+
+    /* the warm caches are restored in idle at start up, and saved after
+       the contexts, see CacheSnapshot. */
+    static std::string snapshotFingerprint (void);
+    static gboolean snapshotCallback (gpointer data);
+
+    /* the addon libraries of a context, in the order of the setting. */
+    struct AddonLibraries {
+        std::vector<guint8> wanted;
+        std::vector<guint8> loaded;
+    };
+
+    void updateAddons (AddonLibraries & addons,
+                       const std::string & dictionaries);
+
+    /* the config revision set to the context, the options are only
+       set again after they are changed. */
+    struct AppliedOptions {
+        pinyin_context_t *context;
+        Config *config;
+        guint revision;
+    };
+
+    static gboolean isApplied (const AppliedOptions & applied,
+                               pinyin_context_t *context, Config *config);
+    static void markApplied (AppliedOptions & applied,
+                             pinyin_context_t *context, Config *config);
+    gboolean stepAddons (pinyin_context_t *context, AddonLibraries & addons);
+    static gboolean addonCallback (gpointer data);
 
 private:
     /* libpinyin context */
     pinyin_context_t *m_pinyin_context;
     pinyin_context_t *m_chewing_context;
+    guint m_modified_serial;
 
-    guint m_timeout_id;
-    GTimer *m_timer;
+    /* the writes of the contexts, see queueWrite. */
+    GThread *m_owner;
+    GRWLock m_context_lock;
+    guint m_write_depth;
+    GMutex m_write_lock;
+    std::deque<ContextWrite> m_writes;
+    guint m_write_id;
+
+    /* the mapped network dictionary, shared by the contexts. */
+    GMappedFile *m_network_file;
+    GMutex m_network_lock;
+
+    /* the running import of the user dictionary. */
+    GBytes *m_import_file;
+    import_iterator_t *m_import_iter;
+    gsize m_import_offset;
+    guint m_import_id;
+    gint m_import_progress;
+
+    /* the running export of the user dictionary. */
+    GOutputStream *m_export_stream;
+    GCancellable *m_export_cancellable;
+    export_iterator_t *m_export_iter;
+    guint m_export_count;
+    guint m_export_id;
+
+    /* the contexts warming up in the worker threads. */
+    ContextLoader m_pinyin_loader;
+    ContextLoader m_chewing_loader;
+    GMutex m_warm_up_lock;
+    GCond m_warm_up_cond;
+
+    /* the addon libraries are loaded or unloaded one by one in idle. */
+    AddonLibraries m_pinyin_addons;
+    AddonLibraries m_chewing_addons;
+    guint m_addon_id;
+
+    AppliedOptions m_pinyin_options;
+    AppliedOptions m_chewing_options;
+
+    /* the network dictionary is reloaded after it is changed. */
+    GFileMonitor *m_network_monitor;
+    guint m_network_timeout_id;
+    NetworkReload m_network_reload;
+
+    /* the returned instances, re-used by the focused editors. */
+    std::vector<pinyin_instance_t *> m_pinyin_instances;
+    std::vector<pinyin_instance_t *> m_chewing_instances;
+
+    /* the trainings not yet synced in the journals. */
+    guint m_trained_id;
+
+    /* the trainings since the last save of the contexts. */
+    TrainingJournal m_pinyin_journal;
+    TrainingJournal m_chewing_journal;
+    /* the instances of m_chewing_context, journaled separately. */
+    std::set<pinyin_instance_t *> m_chewing_allocated;
+    /* the modifications not in the journals are saved on shutdown. */
+    gboolean m_unjournaled;
+    gboolean m_saving_unjournaled;
+
+    /* save the contexts one by one in low priority idle. */
+    guint m_save_id;
+    /* the bits of the stores to save. */
+    guint m_save_pending;
 
 private:
     static std::unique_ptr<LibPinyinBackEnd> m_instance;
 };
 
+/* Change the contexts in the scope, in the main thread. */
+class ContextWriter {
+public:
+    ContextWriter (LibPinyinBackEnd & backend) : m_backend (backend)
+    { m_backend.beginWrite (); }
+    ~ContextWriter (void) { m_backend.endWrite (); }
+
+private:
+    LibPinyinBackEnd & m_backend;
+};
+
+/* Read the contexts in the scope, in the other threads. */
+class ContextReader {
+public:
+    ContextReader (LibPinyinBackEnd & backend) : m_backend (backend)
+    { m_backend.beginRead (); }
+    ~ContextReader (void) { m_backend.endRead (); }
+
+private:
+    LibPinyinBackEnd & m_backend;
+};
+
 };
 
 #endif
@@ -31,6 +31,12 @@
 #include "PYConfig.h"
 #include "PYPConfig.h"
 #include "PYLibPinyin.h"
+#include "PYTrace.h"
+#include "PYKeyRecorder.h"
+#include "PYStats.h"
+#include "PYPreload.h"
+#include "PYReclaim.h"
+#include "PYPersistence.h"
 
 using namespace PY;
 
@@ -41,6 +47,7 @@ static Pointer<IBusFactory> factory;
 /* options */
 static gboolean ibus = FALSE;
 static gboolean verbose = FALSE;
+static gchar *record_keys = NULL;
 
 static void
 show_version_and_quit (void)
@@ -55,6 +62,9 @@ static const GOptionEntry entries[] =
         (gpointer) show_version_and_quit, "Show the application's version.", NULL },
     { "ibus",    'i', 0, G_OPTION_ARG_NONE, &ibus, "component is executed by ibus", NULL },
     { "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "verbose", NULL },
+    { "record-keys", 0, 0, G_OPTION_ARG_STRING, &record_keys,
+        "record the key timings, only the classes or also the syllable shapes",
+        "classes|syllables" },
     { NULL },
 };
 
@@ -86,11 +96,16 @@ start_component (void)
         exit (0);
     }
 
+    /* read ahead the data files while the contexts are loading. */
+    Preload::start ();
+
     LibPinyinBackEnd::init ();
 
     PinyinConfig::init ();
     BopomofoConfig::init ();
 
+    LibPinyinBackEnd::instance ().warmUp ();
+
     g_signal_connect ((IBusBus *)bus, "disconnected", G_CALLBACK (ibus_disconnected_cb), NULL);
 
     component = ibus_component_new ("org.freedesktop.IBus.Libpinyin",
@@ -126,6 +141,8 @@ start_component (void)
                                                      "us"));
 
     factory = ibus_factory_new (ibus_bus_get_connection (bus));
+    Stats::registerObject (ibus_bus_get_connection (bus));
+    Reclaim::start ();
 
     if (ibus) {
         ibus_factory_add_engine (factory, "libpinyin", IBUS_TYPE_PINYIN_ENGINE);
@@ -142,18 +159,23 @@ start_component (void)
 }
 
 #include <signal.h>
+#include <glib-unix.h>
 
-static void
-sigterm_cb (int sig)
+/* dispatched in the main loop instead of the signal handler,
+   the backend is finalized by atexit_cb. */
+static gboolean
+sigterm_cb (gpointer data)
 {
-    LibPinyinBackEnd::finalize ();
-
     ::exit (EXIT_FAILURE);
+    return FALSE;
 }
 
 static void
 atexit_cb (void)
 {
+    Trace::report ();
+    KeyRecorder::flush ();
+    Persistence::flush ();
     LibPinyinBackEnd::finalize ();
 }
 
@@ -178,8 +200,20 @@ main (gint argc, gchar **argv)
         exit (-1);
     }
 
-    ::signal (SIGTERM, sigterm_cb);
-    ::signal (SIGINT, sigterm_cb);
+    if (verbose)
+        Trace::enable ();
+
+    if (record_keys) {
+        if (0 == g_strcmp0 (record_keys, "classes"))
+            KeyRecorder::enable (FALSE);
+        else if (0 == g_strcmp0 (record_keys, "syllables"))
+            KeyRecorder::enable (TRUE);
+        else
+            g_warning ("unknown key record mode: %s", record_keys);
+    }
+
+    g_unix_signal_add (SIGTERM, sigterm_cb, NULL);
+    g_unix_signal_add (SIGINT, sigterm_cb, NULL);
     g_atexit (atexit_cb);
 
     start_component ();
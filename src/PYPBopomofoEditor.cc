@@ -21,6 +21,7 @@
 #include "PYPBopomofoEditor.h"
 #include "PYConfig.h"
 #include "PYLibPinyin.h"
+#include "PYTrace.h"
 #include "PYPinyinProperties.h"
 #include "PYSimpTradConverter.h"
 #include "PYHalfFullConverter.h"
@@ -43,17 +44,65 @@ const static gchar * bopomofo_select_keys[] = {
 BopomofoEditor::BopomofoEditor
 (PinyinProperties & props, Config & config)
     : PhoneticEditor (props, config),
-      m_select_mode (FALSE)
+      m_select_mode (FALSE),
+      m_key_classes_select_keys (-1),
+      m_key_classes_mapping (-1)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocChewingInstance ();
 }
 
 BopomofoEditor::~BopomofoEditor (void)
 {
-    LibPinyinBackEnd::instance ().freeChewingInstance (m_instance);
+    if (m_instance)
+        freeInstance (m_instance);
     m_instance = NULL;
 }
 
+pinyin_instance_t *
+BopomofoEditor::allocInstance (void)
+{
+    /* the keyboard mapping is applied to the context on alloc. */
+    m_key_classes_mapping = -1;
+    return LibPinyinBackEnd::instance ().allocChewingInstance ();
+}
+
+void
+BopomofoEditor::updateKeyClasses (void)
+{
+    gint select_keys = m_config.selectKeys ();
+    gint mapping = m_config.bopomofoKeyboardMapping ();
+
+    if (G_LIKELY (select_keys == m_key_classes_select_keys &&
+                  mapping == m_key_classes_mapping))
+        return;
+
+    for (guint ch = 0; ch < G_N_ELEMENTS (m_key_classes); ch++) {
+        gchar ** symbols = NULL;
+        m_key_classes[ch].select = -1;
+        m_key_classes[ch].bopomofo = ch != 0 &&
+            pinyin_in_chewing_keyboard (m_instance, ch, &symbols);
+        g_strfreev (symbols);
+    }
+
+    const gchar * keys = bopomofo_select_keys[select_keys];
+    for (const gchar * p = keys; *p; ++p)
+        m_key_classes[(guchar) *p].select = p - keys;
+
+    m_key_classes_select_keys = select_keys;
+    m_key_classes_mapping = mapping;
+}
+
+void
+BopomofoEditor::freeInstance (pinyin_instance_t *instance)
+{
+    LibPinyinBackEnd::instance ().freeChewingInstance (instance);
+}
+
+gboolean
+BopomofoEditor::contextReady (gint64 timeout)
+{
+    return LibPinyinBackEnd::instance ().waitChewingContext (timeout);
+}
+
 void
 BopomofoEditor::reset (void)
 {
@@ -68,9 +117,9 @@ BopomofoEditor::insert (gint ch)
     if (G_UNLIKELY (m_text.length () >= MAX_PINYIN_LEN))
         return TRUE;
 
+    markChanged (m_cursor);
     m_text.insert (m_cursor++, ch);
-    updatePinyin ();
-    update ();
+    updateDeferred ();
 
     return TRUE;
 }
@@ -144,19 +193,13 @@ BopomofoEditor::processSelectKey (guint keyval, guint keycode,
     if (G_LIKELY (!m_select_mode && ((modifiers & IBUS_MOD1_MASK) == 0)))
         return FALSE;
 
-    const gchar * pos = NULL;
-    const gchar * keys = bopomofo_select_keys[m_config.selectKeys ()];
-    for ( const gchar * p = keys; *p; ++p ) {
-        if ( *p == keyval )
-            pos = p;
-    }
-
-    if (pos == NULL)
+    if (keyval >= G_N_ELEMENTS (m_key_classes) ||
+        m_key_classes[keyval].select < 0)
         return FALSE;
 
     m_select_mode = TRUE;
 
-    guint i = pos - keys;
+    guint i = m_key_classes[keyval].select;
     selectCandidateInPage (i);
 
     update ();
@@ -170,10 +213,15 @@ BopomofoEditor::processBopomofo (guint keyval, guint keycode,
     if (G_UNLIKELY (cmshm_filter (modifiers) != 0))
         return m_text ? TRUE : FALSE;
 
-    gchar ** symbols = NULL;
-    if (!pinyin_in_chewing_keyboard (m_instance, keyval, &symbols))
-        return FALSE;
-    g_strfreev (symbols);
+    if (G_LIKELY (keyval < G_N_ELEMENTS (m_key_classes))) {
+        if (!m_key_classes[keyval].bopomofo)
+            return FALSE;
+    } else {
+        gchar ** symbols = NULL;
+        if (!pinyin_in_chewing_keyboard (m_instance, keyval, &symbols))
+            return FALSE;
+        g_strfreev (symbols);
+    }
 
     if (keyval == IBUS_space)
         return FALSE;
@@ -195,6 +243,12 @@ BopomofoEditor::processKeyEvent (guint keyval, guint keycode,
                   IBUS_META_MASK |
                   IBUS_LOCK_MASK);
 
+    /* pass the keys through while the context is warming up. */
+    if (G_UNLIKELY (m_instance == NULL) && !contextReady (WARM_UP_WAIT_TIME))
+        return FALSE;
+    checkoutInstance ();
+    updateKeyClasses ();
+
     if (G_UNLIKELY (processGuideKey (keyval, keycode, modifiers)))
         return TRUE;
     if (G_UNLIKELY (processSelectKey (keyval, keycode, modifiers)))
@@ -276,12 +330,13 @@ BopomofoEditor::updateLookupTable (void)
         return;
     }
 
-    m_lookup_table.clear ();
+    clearLookupTable ();
 
     fillLookupTable ();
     updateLookupTableLabel ();
     if (m_lookup_table.size()) {
         Editor::updateLookupTable (m_lookup_table, TRUE);
+        prefetchCandidates ();
     } else {
         hideLookupTable ();
     }
@@ -298,8 +353,13 @@ BopomofoEditor::updatePinyin (void)
         return;
     }
 
-    m_pinyin_len =
-        pinyin_parse_more_chewings (m_instance, m_text.c_str ());
+    {
+        TraceScope trace (TRACE_PARSE_PINYIN);
+        m_pinyin_len =
+            pinyin_parse_more_chewings (m_instance, m_text.c_str ());
+    }
+
+    TraceScope trace (TRACE_GUESS_SENTENCE);
     pinyin_guess_sentence (m_instance);
 }
 
@@ -54,10 +54,26 @@ protected:
     virtual void commit (const gchar *str);
     using PhoneticEditor::commit;
 
+    virtual pinyin_instance_t * allocInstance (void);
+    virtual void freeInstance (pinyin_instance_t *instance);
+    virtual gboolean contextReady (gint64 timeout);
+
     void reset ();
 
     gboolean insert (gint ch);
 
+    void updateKeyClasses (void);
+
+    /* the classes of the latin-1 keyvals, rebuilt when the
+       select keys or the keyboard mapping is changed. */
+    struct KeyClass {
+        gint8 select;           /* the index in the select keys or -1 */
+        gboolean bopomofo;      /* in the chewing keyboard */
+    };
+    KeyClass m_key_classes[256];
+    gint m_key_classes_select_keys;
+    gint m_key_classes_mapping;
+
 };
 
 };
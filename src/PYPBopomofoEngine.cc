@@ -28,6 +28,7 @@
 #include "PYPSuggestionEditor.h"
 #include "PYConfig.h"
 #include "PYPConfig.h"
+#include "PYLibPinyin.h"
 
 using namespace PY;
 
@@ -60,6 +61,7 @@ BopomofoEngine::BopomofoEngine (IBusEngine *engine)
 /* destructor */
 BopomofoEngine::~BopomofoEngine (void)
 {
+    Persistence::flush ();
 }
 
 /* keep synced with pinyin engine. */
@@ -67,11 +69,12 @@ gboolean
 BopomofoEngine::processAccelKeyEvent (guint keyval, guint keycode,
                                       guint modifiers)
 {
-    std::string accel;
-    pinyin_accelerator_name (keyval, modifiers, accel);
+    TraceScope trace (TRACE_PROCESS_ACCEL_KEY_EVENT);
+    const Config & config = BopomofoConfig::instance ();
+    Accelerator accel = Accelerator::fromKeyEvent (keyval, modifiers);
 
     /* Safe Guard for empty key. */
-    if ("" == accel)
+    if (!accel.valid ())
         return FALSE;
 
     /* check Shift or Ctrl + Release hotkey,
@@ -82,7 +85,7 @@ BopomofoEngine::processAccelKeyEvent (guint keyval, guint keycode,
         gboolean triggered = FALSE;
 
         if (m_prev_pressed_key == keyval) {
-            if (BopomofoConfig::instance ().mainSwitch () == accel) {
+            if (config.mainSwitchKey () == accel) {
                 triggered = TRUE;
             }
         }
@@ -111,21 +114,21 @@ BopomofoEngine::processAccelKeyEvent (guint keyval, guint keycode,
     }
 
     /* Toggle full/half Letter Mode */
-    if (BopomofoConfig::instance ().letterSwitch () == accel) {
+    if (config.letterSwitchKey () == accel) {
         m_props.toggleModeFull ();
         m_prev_pressed_key = keyval;
         return TRUE;
     }
 
     /* Toggle full/half Punct Mode */
-    if (BopomofoConfig::instance ().punctSwitch () == accel) {
+    if (config.punctSwitchKey () == accel) {
         m_props.toggleModeFullPunct ();
         m_prev_pressed_key = keyval;
         return TRUE;
     }
 
     /* Toggle both full/half Mode */
-    if (BopomofoConfig::instance ().bothSwitch () == accel) {
+    if (config.bothSwitchKey () == accel) {
         if (m_props.modeFull () != m_props.modeFullPunct ()) {
             m_props.toggleModeFull ();
             m_prev_pressed_key = keyval;
@@ -139,7 +142,7 @@ BopomofoEngine::processAccelKeyEvent (guint keyval, guint keycode,
     }
 
     /* Toggle simp/trad Chinese Mode */
-    if (BopomofoConfig::instance ().tradSwitch () == accel) {
+    if (config.tradSwitchKey () == accel) {
         m_props.toggleModeSimp ();
         m_prev_pressed_key = keyval;
         return TRUE;
@@ -206,9 +209,13 @@ BopomofoEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
         retval = m_fallback_editor->processKeyEvent (keyval, keycode, modifiers);
 
 out:
-    /* needed for SuggestionEditor */
+    /* needed for SuggestionEditor, predict after the commit is sent. */
     if (m_need_update) {
-        m_editors[m_input_mode]->update ();
+        if (m_input_mode == MODE_SUGGESTION)
+            static_cast<SuggestionEditor *> (m_editors[m_input_mode].get ())
+                ->updateDeferred ();
+        else
+            m_editors[m_input_mode]->update ();
         m_need_update = FALSE;
     }
 
@@ -221,6 +228,10 @@ out:
 void
 BopomofoEngine::focusIn (void)
 {
+    for (gint i = 0; i < MODE_LAST; i++) {
+        m_editors[i]->focusIn ();
+    }
+
     registerProperties (m_props.properties ());
 }
 
@@ -230,6 +241,16 @@ BopomofoEngine::focusOut (void)
     Engine::focusOut ();
 
     reset ();
+
+    /* return the libpinyin instances. */
+    for (gint i = 0; i < MODE_LAST; i++) {
+        m_editors[i]->focusOut ();
+    }
+
+    /* sync the trainings, the user databases are saved by the timer,
+       unless they are overdue. */
+    LibPinyinBackEnd::instance ().flush ();
+    Persistence::flushDue ();
 }
 
 void
@@ -335,31 +356,8 @@ BopomofoEngine::commitText (Text & text)
 void
 BopomofoEngine::connectEditorSignals (EditorPtr editor)
 {
-    editor->signalCommitText ().connect (
-        std::bind (&BopomofoEngine::commitText, this, _1));
-
-    editor->signalUpdatePreeditText ().connect (
-        std::bind (&BopomofoEngine::updatePreeditText, this, _1, _2, _3));
-    editor->signalShowPreeditText ().connect (
-        std::bind (&BopomofoEngine::showPreeditText, this));
-    editor->signalHidePreeditText ().connect (
-        std::bind (&BopomofoEngine::hidePreeditText, this));
-
-    editor->signalUpdateAuxiliaryText ().connect (
-        std::bind (&BopomofoEngine::updateAuxiliaryText, this, _1, _2));
-    editor->signalShowAuxiliaryText ().connect (
-        std::bind (&BopomofoEngine::showAuxiliaryText, this));
-    editor->signalHideAuxiliaryText ().connect (
-        std::bind (&BopomofoEngine::hideAuxiliaryText, this));
-
-    editor->signalUpdateLookupTable ().connect (
-        std::bind (&BopomofoEngine::updateLookupTable, this, _1, _2));
-    editor->signalUpdateLookupTableFast ().connect (
-        std::bind (&BopomofoEngine::updateLookupTableFast, this, _1, _2));
-    editor->signalShowLookupTable ().connect (
-        std::bind (&BopomofoEngine::showLookupTable, this));
-    editor->signalHideLookupTable ().connect (
-        std::bind (&BopomofoEngine::hideLookupTable, this));
+    /* the updates are called directly, not through the signals. */
+    editor->setSink (this);
 }
 
 
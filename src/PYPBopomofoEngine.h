@@ -47,6 +47,7 @@ public:
     void cursorDown (void);
     gboolean propertyActivate (const gchar *prop_name, guint prop_state);
     void candidateClicked (guint index, guint button, guint state);
+    gint inputMode (void) const { return m_input_mode; }
 
 private:
     gboolean processPunct (guint keyval, guint keycode, guint modifiers);
@@ -0,0 +1,455 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPCloudCandidates.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <glib/gstdio.h>
+#include <json-glib/json-glib.h>
+#include "PYPPhoneticEditor.h"
+#include "PYConfig.h"
+
+using namespace PY;
+
+/* the recently fetched pinyin, also saved to the disk. */
+#define CLOUD_CACHE_SIZE 512
+/* save the disk cache after the responses settle down. */
+#define CLOUD_SAVE_TIMEOUT 30
+/* the longer pinyin are unlikely to be useful. */
+#define CLOUD_MAX_PINYIN_LENGTH 64
+#define CLOUD_REQUEST_TIMEOUT 5
+
+#define BAIDU_URL_TEMPLATE "https://olime.baidu.com/py?input=%s&inputtype=py&bg=0&ed=%d&result=hanzi&resultcoding=utf-8&ch_en=1&clientinfo=web&version=1"
+#define GOOGLE_URL_TEMPLATE "https://www.google.com/inputtools/request?ime=pinyin&text=%s&num=%d"
+
+SoupSession *CloudCandidates::m_session = NULL;
+BoundedCache<CloudCandidates::Phrases>
+CloudCandidates::m_cache (CLOUD_CACHE_SIZE, STATS_CLOUD_CACHE_HITS);
+gboolean CloudCandidates::m_cache_loaded = FALSE;
+guint CloudCandidates::m_save_source = 0;
+
+CloudCandidates::CloudCandidates (PhoneticEditor *editor)
+    : m_delayed_source (0)
+{
+    m_editor = editor;
+}
+
+CloudCandidates::~CloudCandidates ()
+{
+    reset ();
+    cancelRequests ();
+}
+
+static gchar *
+cloud_cache_filename (void)
+{
+    return g_build_filename (g_get_user_cache_dir (), "ibus", "libpinyin",
+                             "cloud-cache.txt", NULL);
+}
+
+static gboolean
+is_cloud_pinyin (const std::string & pinyin)
+{
+    if (pinyin.empty () || pinyin.length () > CLOUD_MAX_PINYIN_LENGTH)
+        return FALSE;
+
+    for (gsize i = 0; i < pinyin.length (); i++) {
+        gchar ch = pinyin[i];
+        if (!(ch >= 'a' && ch <= 'z') && ch != '\'')
+            return FALSE;
+    }
+    return TRUE;
+}
+
+gboolean
+CloudCandidates::processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                    std::vector<EnhancedCandidate> & injected)
+{
+    /* the cloud candidates are for the whole pinyin. */
+    if (m_editor->getLookupCursor () != 0)
+        return FALSE;
+
+    std::string pinyin (m_editor->m_text.c_str (), m_editor->m_pinyin_len);
+    if (!is_cloud_pinyin (pinyin))
+        return FALSE;
+
+    loadCache ();
+
+    Phrases phrases;
+    if (!m_cache.lookup (pinyin, phrases)) {
+        /* wait for the typing to pause. */
+        if (m_requests.find (pinyin) == m_requests.end ()) {
+            if (m_delayed_source)
+                g_source_remove (m_delayed_source);
+            m_pending_pinyin = pinyin;
+            m_delayed_source = g_timeout_add
+                (m_editor->m_config.cloudRequestDelayTime (),
+                 CloudCandidates::delayedRequestCallback, this);
+        }
+        return FALSE;
+    }
+
+    /* skip the phrases already shown in the first page. */
+    guint page_size = m_editor->m_config.pageSize ();
+    guint shown = std::min (page_size, (guint) candidates.size ());
+    guint num = m_editor->m_config.cloudCandidatesNumber ();
+
+    std::vector<EnhancedCandidate> cloud;
+    for (guint i = 0; i < phrases.size () && cloud.size () < num; i++) {
+        gboolean found = FALSE;
+        for (guint j = 0; j < shown && !found; j++)
+            found = candidates[j].m_display_string == phrases[i];
+        if (found)
+            continue;
+
+        EnhancedCandidate enhanced;
+        enhanced.m_candidate_type = CANDIDATE_CLOUD_INPUT;
+        enhanced.m_candidate_id = i;
+        enhanced.m_display_string = phrases[i];
+        cloud.push_back (enhanced);
+    }
+
+    if (cloud.empty ())
+        return FALSE;
+
+    injected.insert (injected.begin (), cloud.begin (), cloud.end ());
+    return TRUE;
+}
+
+gboolean
+CloudCandidates::injectCandidates (CandidateContext & context)
+{
+    if (!context.m_cloud)
+        return FALSE;
+
+    return processCandidates (context.m_cache, context.m_injected);
+}
+
+int
+CloudCandidates::selectCandidate (EnhancedCandidate & enhanced)
+{
+    assert (CANDIDATE_CLOUD_INPUT == enhanced.m_candidate_type);
+
+    return SELECT_CANDIDATE_COMMIT;
+}
+
+gboolean
+CloudCandidates::removeCandidate (EnhancedCandidate & enhanced)
+{
+    assert (CANDIDATE_CLOUD_INPUT == enhanced.m_candidate_type);
+
+    return FALSE;
+}
+
+void
+CloudCandidates::reset (void)
+{
+    if (m_delayed_source) {
+        g_source_remove (m_delayed_source);
+        m_delayed_source = 0;
+    }
+    m_pending_pinyin.clear ();
+}
+
+gboolean
+CloudCandidates::delayedRequestCallback (gpointer data)
+{
+    CloudCandidates *self = (CloudCandidates *) data;
+    self->m_delayed_source = 0;
+    self->sendRequest (self->m_pending_pinyin);
+    self->m_pending_pinyin.clear ();
+    return FALSE;
+}
+
+void
+CloudCandidates::sendRequest (const std::string & pinyin)
+{
+    if (m_requests.find (pinyin) != m_requests.end ())
+        return;
+
+    if (G_UNLIKELY (m_session == NULL))
+        m_session = soup_session_new_with_options
+            (SOUP_SESSION_TIMEOUT, CLOUD_REQUEST_TIMEOUT, NULL);
+
+    gchar *escaped = g_uri_escape_string (pinyin.c_str (), NULL, FALSE);
+    gint num = m_editor->m_config.cloudCandidatesNumber () +
+        m_editor->m_config.pageSize ();
+    gchar *url = NULL;
+    if (CLOUD_INPUT_SOURCE_GOOGLE == m_editor->m_config.cloudInputSource ())
+        url = g_strdup_printf (GOOGLE_URL_TEMPLATE, escaped, num);
+    else
+        url = g_strdup_printf (BAIDU_URL_TEMPLATE, escaped, num);
+    g_free (escaped);
+
+    SoupMessage *message = soup_message_new ("GET", url);
+    g_free (url);
+    if (message == NULL)
+        return;
+
+    Request *request = new Request;
+    request->owner = this;
+    request->pinyin = pinyin;
+    request->message = message;
+    m_requests[pinyin] = request;
+
+    /* the session takes the message. */
+    soup_session_queue_message (m_session, message,
+                                CloudCandidates::responseCallback, request);
+}
+
+void
+CloudCandidates::cancelRequests (void)
+{
+    /* the requests are freed in the response callback. */
+    std::map<std::string, Request *>::iterator iter;
+    for (iter = m_requests.begin (); iter != m_requests.end (); ++iter) {
+        iter->second->owner = NULL;
+        soup_session_cancel_message (m_session, iter->second->message,
+                                     SOUP_STATUS_CANCELLED);
+    }
+    m_requests.clear ();
+}
+
+void
+CloudCandidates::responseCallback (SoupSession *session,
+                                   SoupMessage *message,
+                                   gpointer data)
+{
+    Request *request = (Request *) data;
+    CloudCandidates *self = request->owner;
+
+    if (self == NULL) {
+        delete request;
+        return;
+    }
+    self->m_requests.erase (request->pinyin);
+
+    Phrases phrases;
+    gboolean retval = FALSE;
+    if (SOUP_STATUS_IS_SUCCESSFUL (message->status_code)) {
+        const gchar *body = message->response_body->data;
+        gsize length = message->response_body->length;
+
+        if (CLOUD_INPUT_SOURCE_GOOGLE == self->m_editor->m_config.cloudInputSource ())
+            retval = parseGoogleResponse (body, length, phrases);
+        else
+            retval = parseBaiduResponse (body, length, phrases);
+    }
+
+    if (retval && !phrases.empty ())
+        self->receiveResponse (request->pinyin, phrases);
+    delete request;
+}
+
+void
+CloudCandidates::receiveResponse (const std::string & pinyin, Phrases & phrases)
+{
+    m_cache.insert (pinyin, phrases);
+
+    if (m_save_source == 0)
+        m_save_source = g_timeout_add_seconds
+            (CLOUD_SAVE_TIMEOUT, CloudCandidates::saveCallback, NULL);
+
+    /* refresh when the user is still on the first page of the pinyin. */
+    PhoneticEditor *editor = m_editor;
+    if (editor->m_text.length () < pinyin.length () ||
+        0 != strncmp (editor->m_text.c_str (), pinyin.c_str (), pinyin.length ()) ||
+        editor->m_pinyin_len != pinyin.length ())
+        return;
+
+    if (editor->m_lookup_table.cursorPos () >= editor->m_lookup_table.pageSize ())
+        return;
+
+    editor->m_enhanced_valid = FALSE;
+    editor->updateLookupTable ();
+}
+
+/* {"status":"T","result":[[["你好",5,{...}],...],"ni'hao"],...} */
+gboolean
+CloudCandidates::parseBaiduResponse (const gchar *data, gsize length,
+                                     Phrases & phrases)
+{
+    JsonParser *parser = json_parser_new ();
+    if (!json_parser_load_from_data (parser, data, length, NULL)) {
+        g_object_unref (parser);
+        return FALSE;
+    }
+
+    gboolean retval = FALSE;
+    JsonNode *root = json_parser_get_root (parser);
+    do {
+        if (!JSON_NODE_HOLDS_OBJECT (root))
+            break;
+        JsonObject *object = json_node_get_object (root);
+
+        if (!json_object_has_member (object, "status") ||
+            g_strcmp0 (json_object_get_string_member (object, "status"), "T"))
+            break;
+
+        if (!json_object_has_member (object, "result"))
+            break;
+        JsonArray *result = json_object_get_array_member (object, "result");
+        if (result == NULL || json_array_get_length (result) < 1)
+            break;
+
+        JsonNode *node = json_array_get_element (result, 0);
+        if (!JSON_NODE_HOLDS_ARRAY (node))
+            break;
+        JsonArray *items = json_node_get_array (node);
+
+        for (guint i = 0; i < json_array_get_length (items); i++) {
+            JsonNode *item = json_array_get_element (items, i);
+            if (!JSON_NODE_HOLDS_ARRAY (item))
+                continue;
+            JsonArray *fields = json_node_get_array (item);
+            if (json_array_get_length (fields) < 1)
+                continue;
+            const gchar *phrase = json_array_get_string_element (fields, 0);
+            if (phrase && *phrase)
+                phrases.push_back (phrase);
+        }
+        retval = TRUE;
+    } while (0);
+
+    g_object_unref (parser);
+    return retval;
+}
+
+/* ["SUCCESS",[["nihao",["你好","尼好",...],[],{...}]]] */
+gboolean
+CloudCandidates::parseGoogleResponse (const gchar *data, gsize length,
+                                      Phrases & phrases)
+{
+    JsonParser *parser = json_parser_new ();
+    if (!json_parser_load_from_data (parser, data, length, NULL)) {
+        g_object_unref (parser);
+        return FALSE;
+    }
+
+    gboolean retval = FALSE;
+    JsonNode *root = json_parser_get_root (parser);
+    do {
+        if (!JSON_NODE_HOLDS_ARRAY (root))
+            break;
+        JsonArray *array = json_node_get_array (root);
+        if (json_array_get_length (array) < 2)
+            break;
+
+        if (g_strcmp0 (json_array_get_string_element (array, 0), "SUCCESS"))
+            break;
+
+        JsonNode *node = json_array_get_element (array, 1);
+        if (!JSON_NODE_HOLDS_ARRAY (node))
+            break;
+        JsonArray *results = json_node_get_array (node);
+        if (json_array_get_length (results) < 1)
+            break;
+
+        node = json_array_get_element (results, 0);
+        if (!JSON_NODE_HOLDS_ARRAY (node))
+            break;
+        JsonArray *result = json_node_get_array (node);
+        if (json_array_get_length (result) < 2)
+            break;
+
+        node = json_array_get_element (result, 1);
+        if (!JSON_NODE_HOLDS_ARRAY (node))
+            break;
+        JsonArray *items = json_node_get_array (node);
+
+        for (guint i = 0; i < json_array_get_length (items); i++) {
+            const gchar *phrase = json_array_get_string_element (items, i);
+            if (phrase && *phrase)
+                phrases.push_back (phrase);
+        }
+        retval = TRUE;
+    } while (0);
+
+    g_object_unref (parser);
+    return retval;
+}
+
+/* one pinyin per line, followed by the tab separated phrases. */
+void
+CloudCandidates::loadCache (void)
+{
+    if (G_LIKELY (m_cache_loaded))
+        return;
+    m_cache_loaded = TRUE;
+
+    gchar *filename = cloud_cache_filename ();
+    gchar *contents = NULL;
+    gboolean retval = g_file_get_contents (filename, &contents, NULL, NULL);
+    g_free (filename);
+    if (!retval)
+        return;
+
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    /* the most recently used is saved first. */
+    guint num = g_strv_length (lines);
+    for (guint i = num; i > 0; i--) {
+        gchar **fields = g_strsplit (lines[i - 1], "\t", -1);
+        if (fields[0] && fields[1] && is_cloud_pinyin (fields[0])) {
+            Phrases phrases;
+            for (gchar **field = fields + 1; *field; field++)
+                phrases.push_back (*field);
+            m_cache.insert (fields[0], phrases);
+        }
+        g_strfreev (fields);
+    }
+
+    g_strfreev (lines);
+}
+
+void
+CloudCandidates::saveCache (void)
+{
+    gchar *filename = cloud_cache_filename ();
+    gchar *dirname = g_path_get_dirname (filename);
+    g_mkdir_with_parents (dirname, 0700);
+    g_free (dirname);
+
+    std::string contents;
+    const std::list<BoundedCache<Phrases>::Entry> & entries = m_cache.entries ();
+    std::list<BoundedCache<Phrases>::Entry>::const_iterator iter;
+    for (iter = entries.begin (); iter != entries.end (); ++iter) {
+        contents += iter->first;
+        for (guint i = 0; i < iter->second.size (); i++) {
+            contents += '\t';
+            contents += iter->second[i];
+        }
+        contents += '\n';
+    }
+
+    g_file_set_contents (filename, contents.c_str (), contents.length (), NULL);
+    g_free (filename);
+}
+
+gboolean
+CloudCandidates::saveCallback (gpointer data)
+{
+    m_save_source = 0;
+    saveCache ();
+    return FALSE;
+}
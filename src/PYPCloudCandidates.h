@@ -0,0 +1,108 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __PY_LIB_PINYIN_CLOUD_CANDIDATES_H_
+#define __PY_LIB_PINYIN_CLOUD_CANDIDATES_H_
+
+#include <libsoup/soup.h>
+#include <map>
+#include "PYPEnhancedCandidates.h"
+#include "PYConversionCache.h"
+
+namespace PY {
+
+class PhoneticEditor;
+
+enum CloudInputSource {
+    CLOUD_INPUT_SOURCE_BAIDU = 0,
+    CLOUD_INPUT_SOURCE_GOOGLE
+};
+
+/* Fetch the candidates of the pinyin from the cloud input service,
+ * the key event never waits for the network, the results are cached
+ * on disk and injected when they arrive. */
+class CloudCandidates : public EnhancedCandidates<PhoneticEditor> {
+public:
+    CloudCandidates (PhoneticEditor *editor);
+    virtual ~CloudCandidates ();
+
+public:
+    /* push the cached cloud candidates to the front of injected,
+       or request them after the delay time. */
+    gboolean processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                std::vector<EnhancedCandidate> & injected);
+    gboolean injectCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_CLOUD_INPUT == type;
+    }
+
+    int selectCandidate (EnhancedCandidate & enhanced);
+    gboolean removeCandidate (EnhancedCandidate & enhanced);
+
+    /* drop the pending request of the old pinyin. */
+    void reset (void);
+
+private:
+    typedef std::vector<std::string> Phrases;
+
+    struct Request {
+        CloudCandidates *owner;
+        std::string pinyin;
+        SoupMessage *message;
+    };
+
+    void sendRequest (const std::string & pinyin);
+    void cancelRequests (void);
+    void receiveResponse (const std::string & pinyin, Phrases & phrases);
+
+    static gboolean delayedRequestCallback (gpointer data);
+    static void responseCallback (SoupSession *session,
+                                  SoupMessage *message,
+                                  gpointer data);
+
+    static gboolean parseBaiduResponse (const gchar *data, gsize length,
+                                        Phrases & phrases);
+    static gboolean parseGoogleResponse (const gchar *data, gsize length,
+                                         Phrases & phrases);
+
+    static void loadCache (void);
+    static void saveCache (void);
+    static gboolean saveCallback (gpointer data);
+
+private:
+    /* the pinyin waiting for the delay time. */
+    std::string m_pending_pinyin;
+    guint m_delayed_source;
+
+    /* the requests in flight, keyed by pinyin. */
+    std::map<std::string, Request *> m_requests;
+
+    static SoupSession *m_session;
+    static BoundedCache<Phrases> m_cache;
+    static gboolean m_cache_loaded;
+    static guint m_save_source;
+};
+
+};
+
+#endif
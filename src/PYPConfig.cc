@@ -23,6 +23,7 @@
 #include <pinyin.h>
 #include "PYBus.h"
 #include "PYLibPinyin.h"
+#include "PYSimpTradConverter.h"
 
 #define USE_G_SETTINGS_LIST_KEYS 0
 
@@ -37,10 +38,15 @@ const gchar * const CONFIG_REMEMBER_EVERY_INPUT      = "remember-every-input";
 const gchar * const CONFIG_SORT_OPTION               = "sort-candidate-option";
 const gchar * const CONFIG_SHOW_SUGGESTION           = "show-suggestion";
 const gchar * const CONFIG_EMOJI_CANDIDATE           = "emoji-candidate";
+const gchar * const CONFIG_ENGLISH_CANDIDATE         = "english-candidate";
 const gchar * const CONFIG_SHIFT_SELECT_CANDIDATE    = "shift-select-candidate";
 const gchar * const CONFIG_MINUS_EQUAL_PAGE          = "minus-equal-page";
 const gchar * const CONFIG_COMMA_PERIOD_PAGE         = "comma-period-page";
 const gchar * const CONFIG_AUTO_COMMIT               = "auto-commit";
+const gchar * const CONFIG_ENABLE_CLOUD_INPUT        = "enable-cloud-input";
+const gchar * const CONFIG_CLOUD_INPUT_SOURCE        = "cloud-input-source";
+const gchar * const CONFIG_CLOUD_CANDIDATES_NUMBER   = "cloud-candidates-number";
+const gchar * const CONFIG_CLOUD_REQUEST_DELAY_TIME  = "cloud-request-delay-time";
 const gchar * const CONFIG_DOUBLE_PINYIN             = "double-pinyin";
 const gchar * const CONFIG_DOUBLE_PINYIN_SCHEMA      = "double-pinyin-schema";
 const gchar * const CONFIG_INIT_CHINESE              = "init-chinese";
@@ -57,7 +63,9 @@ const gchar * const CONFIG_AUXILIARY_SELECT_KEY_F    = "auxiliary-select-key-f";
 const gchar * const CONFIG_AUXILIARY_SELECT_KEY_KP   = "auxiliary-select-key-kp";
 const gchar * const CONFIG_ENTER_KEY                 = "enter-key";
 const gchar * const CONFIG_IMPORT_DICTIONARY         = "import-dictionary";
+const gchar * const CONFIG_IMPORT_DICTIONARY_PROGRESS = "import-dictionary-progress";
 const gchar * const CONFIG_EXPORT_DICTIONARY         = "export-dictionary";
+const gchar * const CONFIG_EXPORT_DICTIONARY_PROGRESS = "export-dictionary-progress";
 const gchar * const CONFIG_CLEAR_USER_DATA           = "clear-user-data";
 /* const gchar * const CONFIG_CTRL_SWITCH               = "ctrl-switch"; */
 const gchar * const CONFIG_MAIN_SWITCH               = "main-switch";
@@ -78,7 +86,9 @@ std::unique_ptr<PinyinConfig> PinyinConfig::m_instance;
 std::unique_ptr<BopomofoConfig> BopomofoConfig::m_instance;
 
 LibPinyinConfig::LibPinyinConfig (const std::string & name)
-    : Config (name)
+    : Config (name),
+      m_apply_id (0),
+      m_applied (FALSE)
 {
     m_settings = g_settings_new (m_schema_id.c_str ());
     initDefaultValues ();
@@ -90,6 +100,8 @@ LibPinyinConfig::LibPinyinConfig (const std::string & name)
 
 LibPinyinConfig::~LibPinyinConfig (void)
 {
+    if (m_apply_id)
+        g_source_remove (m_apply_id);
     g_object_unref (m_settings);
     m_settings = NULL;
 }
@@ -108,6 +120,18 @@ LibPinyinConfig::networkDictionaryEndTimestamp (gint64 timestamp)
     return write (CONFIG_NETWORK_DICTIONARY_END_TIMESTAMP, timestamp);
 }
 
+gboolean
+LibPinyinConfig::importDictionaryProgress (gint progress)
+{
+    return write (CONFIG_IMPORT_DICTIONARY_PROGRESS, progress);
+}
+
+gboolean
+LibPinyinConfig::exportDictionaryProgress (gint count)
+{
+    return write (CONFIG_EXPORT_DICTIONARY_PROGRESS, count);
+}
+
 void
 LibPinyinConfig::initDefaultValues (void)
 {
@@ -121,12 +145,18 @@ LibPinyinConfig::initDefaultValues (void)
     m_sort_option = SORT_BY_PHRASE_LENGTH_AND_PINYIN_LENGTH_AND_FREQUENCY;
     m_show_suggestion = FALSE;
     m_emoji_candidate = TRUE;
+    m_english_candidate = TRUE;
 
     m_shift_select_candidate = FALSE;
     m_minus_equal_page = TRUE;
     m_comma_period_page = TRUE;
     m_auto_commit = FALSE;
 
+    m_enable_cloud_input = FALSE;
+    m_cloud_input_source = 0;
+    m_cloud_candidates_number = 1;
+    m_cloud_request_delay_time = 600;
+
     m_double_pinyin = FALSE;
     m_double_pinyin_schema = DOUBLE_PINYIN_DEFAULT;
 
@@ -146,6 +176,7 @@ LibPinyinConfig::initDefaultValues (void)
     m_punct_switch = "<Control>period";
     m_both_switch = "";
     m_trad_switch = "<Control><Shift>f";
+    compileSwitches ();
 
     m_network_dictionary_start_timestamp = 0;
     m_network_dictionary_end_timestamp = 0;
@@ -253,6 +284,7 @@ LibPinyinConfig::readDefaultValues (void)
 
     m_show_suggestion = read (CONFIG_SHOW_SUGGESTION, false);
     m_emoji_candidate = read (CONFIG_EMOJI_CANDIDATE, true);
+    m_english_candidate = read (CONFIG_ENGLISH_CANDIDATE, true);
 
     m_dictionaries = read (CONFIG_DICTIONARIES, "");
     m_opencc_config = read (CONFIG_OPENCC_CONFIG, "s2t.json");
@@ -333,6 +365,8 @@ LibPinyinConfig::valueChanged (const std::string &schema_id,
         m_show_suggestion = normalizeGVariant (value, false);
     } else if (CONFIG_EMOJI_CANDIDATE == name) {
         m_emoji_candidate = normalizeGVariant (value, true);
+    } else if (CONFIG_ENGLISH_CANDIDATE == name) {
+        m_english_candidate = normalizeGVariant (value, true);
     } else if (CONFIG_DICTIONARIES == name) {
         m_dictionaries = normalizeGVariant (value, std::string (""));
     } else if (CONFIG_OPENCC_CONFIG == name) {
@@ -393,10 +427,49 @@ LibPinyinConfig::valueChangedCallback (GSettings   *settings,
     self->valueChanged (self->m_schema_id, name, value);
     g_variant_unref (value);
 
-    if (self->m_schema_id == "com.github.libpinyin.ibus-libpinyin.libpinyin")
-        LibPinyinBackEnd::instance ().setPinyinOptions (self);
-    if (self->m_schema_id == "com.github.libpinyin.ibus-libpinyin.libbopomofo")
-        LibPinyinBackEnd::instance ().setChewingOptions (self);
+    /* the setup dialog changes many values at once. */
+    if (!self->m_apply_id)
+        self->m_apply_id = g_idle_add (LibPinyinConfig::applyCallback, self);
+}
+
+gboolean
+LibPinyinConfig::applyCallback (gpointer data)
+{
+    LibPinyinConfig *self = static_cast<LibPinyinConfig *> (data);
+    self->m_apply_id = 0;
+    self->applyValues ();
+    return FALSE;
+}
+
+void
+LibPinyinConfig::applyValues (void)
+{
+    compileSwitches ();
+
+    if (!m_applied || m_opencc_config != m_applied_opencc_config) {
+        SimpTradConverter::preload (m_opencc_config);
+        m_applied_opencc_config = m_opencc_config;
+    }
+
+    /* only the options of libpinyin are applied to the backend. */
+    if (m_applied &&
+        option () == m_applied_option &&
+        m_double_pinyin_schema == m_applied_double_pinyin_schema &&
+        m_bopomofo_keyboard_mapping == m_applied_bopomofo_keyboard_mapping &&
+        m_dictionaries == m_applied_dictionaries)
+        return;
+
+    m_applied = TRUE;
+    m_applied_option = option ();
+    m_applied_double_pinyin_schema = m_double_pinyin_schema;
+    m_applied_bopomofo_keyboard_mapping = m_bopomofo_keyboard_mapping;
+    m_applied_dictionaries = m_dictionaries;
+    m_revision++;
+
+    if (m_schema_id == "com.github.libpinyin.ibus-libpinyin.libpinyin")
+        LibPinyinBackEnd::instance ().setPinyinOptions (this);
+    if (m_schema_id == "com.github.libpinyin.ibus-libpinyin.libbopomofo")
+        LibPinyinBackEnd::instance ().setChewingOptions (this);
 }
 
 static const struct {
@@ -438,6 +511,7 @@ PinyinConfig::init ()
     if (m_instance.get () == NULL) {
         m_instance.reset (new PinyinConfig ());
         m_instance->readDefaultValues ();
+        m_instance->applyValues ();
     }
 }
 
@@ -471,6 +545,14 @@ PinyinConfig::readDefaultValues (void)
     m_comma_period_page = read (CONFIG_COMMA_PERIOD_PAGE, true);
     m_auto_commit = read (CONFIG_AUTO_COMMIT, false);
 
+    /* cloud input */
+    m_enable_cloud_input = read (CONFIG_ENABLE_CLOUD_INPUT, false);
+    m_cloud_input_source = read (CONFIG_CLOUD_INPUT_SOURCE, 0);
+    m_cloud_candidates_number = CLAMP
+        (read (CONFIG_CLOUD_CANDIDATES_NUMBER, 1), 1, 10);
+    m_cloud_request_delay_time = CLAMP
+        (read (CONFIG_CLOUD_REQUEST_DELAY_TIME, 600), 200, 5000);
+
     /* lua */
     m_lua_converter = read (CONFIG_LUA_CONVERTER, "");
 
@@ -536,6 +618,17 @@ PinyinConfig::valueChanged (const std::string &schema_id,
         m_lua_converter = normalizeGVariant (value, std::string (""));
     else if (CONFIG_AUTO_COMMIT == name)
         m_auto_commit = normalizeGVariant (value, false);
+    /* cloud input */
+    else if (CONFIG_ENABLE_CLOUD_INPUT == name)
+        m_enable_cloud_input = normalizeGVariant (value, false);
+    else if (CONFIG_CLOUD_INPUT_SOURCE == name)
+        m_cloud_input_source = normalizeGVariant (value, 0);
+    else if (CONFIG_CLOUD_CANDIDATES_NUMBER == name)
+        m_cloud_candidates_number = CLAMP
+            (normalizeGVariant (value, 1), 1, 10);
+    else if (CONFIG_CLOUD_REQUEST_DELAY_TIME == name)
+        m_cloud_request_delay_time = CLAMP
+            (normalizeGVariant (value, 600), 200, 5000);
     else if (CONFIG_IMPORT_DICTIONARY == name) {
         std::string filename = normalizeGVariant (value, std::string(""));
         LibPinyinBackEnd::instance ().importPinyinDictionary (filename.c_str ());
@@ -592,6 +685,7 @@ BopomofoConfig::init ()
     if (m_instance.get () == NULL) {
         m_instance.reset (new BopomofoConfig ());
         m_instance->readDefaultValues ();
+        m_instance->applyValues ();
     }
 }
 
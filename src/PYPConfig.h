@@ -41,9 +41,14 @@ protected:
 public:
     virtual gboolean networkDictionaryStartTimestamp (gint64 timestamp);
     virtual gboolean networkDictionaryEndTimestamp (gint64 timestamp);
+    virtual gboolean importDictionaryProgress (gint progress);
+    virtual gboolean exportDictionaryProgress (gint count);
 
 protected:
     void initDefaultValues (void);
+    /* apply the derived state of the values once, after all the values
+       are read or a burst of changes. */
+    void applyValues (void);
 
     virtual void readDefaultValues (void);
     virtual gboolean valueChanged (const std::string &schema_id,
@@ -53,8 +58,18 @@ private:
     static void valueChangedCallback (GSettings      *settings,
                                       const gchar    *name,
                                       LibPinyinConfig *self);
+    static gboolean applyCallback (gpointer data);
 
 protected:
+    guint m_apply_id;
+
+    /* the applied values, the backend is updated when they are changed. */
+    gboolean m_applied;
+    pinyin_option_t m_applied_option;
+    DoublePinyinScheme m_applied_double_pinyin_schema;
+    ZhuyinScheme m_applied_bopomofo_keyboard_mapping;
+    std::string m_applied_dictionaries;
+    std::string m_applied_opencc_config;
 };
 
 /* PinyinConfig */
@@ -21,6 +21,7 @@
 #include "PYPDoublePinyinEditor.h"
 #include "PYConfig.h"
 #include "PYLibPinyin.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
@@ -35,17 +36,20 @@ using namespace PY;
 #define IS_ALPHA(c) \
         ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
 
+/* each double pinyin syllable is typed by two keys. */
+#define DOUBLE_PINYIN_KEY_LEN 2
+
 
 DoublePinyinEditor::DoublePinyinEditor
 ( PinyinProperties & props, Config & config)
     : PinyinEditor (props, config)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
 }
 
 DoublePinyinEditor::~DoublePinyinEditor (void)
 {
-    LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
+    if (m_instance)
+        freeInstance (m_instance);
     m_instance = NULL;
 }
 
@@ -68,9 +72,9 @@ DoublePinyinEditor::insert (gint ch)
     }
 #endif
 
+    markChanged (m_cursor);
     m_text.insert (m_cursor++, ch);
-    updatePinyin ();
-    update ();
+    updateDeferred ();
 
     return TRUE;
 }
@@ -102,6 +106,12 @@ DoublePinyinEditor::processKeyEvent (guint keyval, guint keycode,
 void
 DoublePinyinEditor::updatePinyin (void)
 {
+    guint changed_offset = m_changed_offset;
+    gboolean parsed_valid = m_parsed_valid;
+
+    m_parsed_valid = TRUE;
+    m_changed_offset = G_MAXUINT;
+
     if (G_UNLIKELY (m_text.empty ())) {
         m_pinyin_len = 0;
         /* TODO: check whether to replace "" with NULL. */
@@ -110,9 +120,31 @@ DoublePinyinEditor::updatePinyin (void)
         return;
     }
 
-    m_pinyin_len =
-        pinyin_parse_more_double_pinyins (m_instance, m_text.c_str ());
-    pinyin_guess_sentence (m_instance);
+    /* the parse stops at the first invalid key pair,
+       the text changed after the pair can't be parsed. */
+    if (parsed_valid &&
+        changed_offset >= m_pinyin_len + DOUBLE_PINYIN_KEY_LEN)
+        return;
+
+    guint pinyin_len = m_pinyin_len;
+    {
+        TraceScope trace (TRACE_PARSE_PINYIN);
+        m_pinyin_len =
+            pinyin_parse_more_double_pinyins (m_instance, m_text.c_str ());
+    }
+
+    /* the parsed keys are unchanged, keep the sentence. */
+    if (parsed_valid && changed_offset >= pinyin_len &&
+        m_pinyin_len == pinyin_len)
+        return;
+
+    {
+        TraceScope trace (TRACE_GUESS_SENTENCE);
+        pinyin_guess_sentence (m_instance);
+    }
+
+    if (commitStableHead ())
+        updatePinyin ();
 }
 
 
@@ -127,18 +159,20 @@ DoublePinyinEditor::updateAuxiliaryText (void)
         return;
     }
 
-    m_buffer.clear ();
+    if (!auxiliaryTextCached ()) {
+        m_auxiliary_buffer.clear ();
 
-    gchar * aux_text = NULL;
-    pinyin_get_double_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
-    m_buffer << aux_text;
-    g_free(aux_text);
+        gchar * aux_text = NULL;
+        pinyin_get_double_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
+        m_auxiliary_buffer << aux_text;
+        g_free(aux_text);
 
-    /* append rest text */
-    const gchar * p = m_text.c_str() + m_pinyin_len;
-    m_buffer << p;
+        /* append rest text */
+        const gchar * p = m_text.c_str() + m_pinyin_len;
+        m_auxiliary_buffer << p;
+    }
 
-    StaticText text (m_buffer);
+    StaticText text (m_auxiliary_buffer);
     if (DISPLAY_STYLE_TRADITIONAL == m_config.displayStyle ())
         Editor::updateAuxiliaryText (text, TRUE);
     if (DISPLAY_STYLE_COMPACT == m_config.displayStyle ())
@@ -26,6 +26,7 @@
 #include "PYPPhoneticEditor.h"
 #include "PYConfig.h"
 #include "PYPEmojiTable.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
@@ -34,66 +35,108 @@ EmojiCandidates::EmojiCandidates (Editor *editor)
     m_editor = editor;
 }
 
-static bool compare_match_less_than (const EmojiItem & lhs,
-                                     const EmojiItem & rhs) {
-    return 0 > std::strcmp (lhs.m_emoji_match, rhs.m_emoji_match);
+/* only complete the English emoji with enough characters, and not
+   the syllables, such as "shi" to "shield". */
+#define EMOJI_COMPLETION_MIN_LENGTH 3
+
+#define EMOJI_MATCH(item) (emoji_strings + (item).m_emoji_match)
+#define EMOJI_STRING(item) (emoji_strings + (item).m_emoji_string)
+
+/* keep the same hash function as scripts/extract_emoji.py. */
+static inline guint32 emoji_hash (const char * str) {
+    guint32 value = 2166136261u;
+    for (const guchar * p = (const guchar *) str; *p; ++p) {
+        value ^= *p;
+        value *= 16777619u;
+    }
+    return value;
 }
 
 static bool search_emoji (const EmojiItem * emojis,
-                          guint emojis_len,
+                          const guint16 * hash,
+                          guint hash_len,
                           const char * match,
                           std::string & emoji) {
-    const EmojiItem item = {match, NULL};
+    guint mask = hash_len - 1;
+    guint slot = emoji_hash (match) & mask;
+
+    for (; hash[slot] != 0; slot = (slot + 1) & mask) {
+        const EmojiItem & item = emojis[hash[slot] - 1];
+        if (0 == std::strcmp (EMOJI_MATCH (item), match)) {
+            emoji = EMOJI_STRING (item);
+            return true;
+        }
+    }
 
-    std::pair<const EmojiItem *, const EmojiItem *> range;
-    range = std::equal_range (emojis, emojis + emojis_len,
-                              item, compare_match_less_than);
+    return false;
+}
 
-    guint range_len = range.second - range.first;
-    assert(range_len <= 1);
+static bool compare_match_less_than (const EmojiItem & lhs,
+                                     const char * rhs) {
+    return 0 > std::strcmp (EMOJI_MATCH (lhs), rhs);
+}
 
-    if (range_len == 1) {
-        const EmojiItem * index = range.first;
+/* find the first emoji whose match starts with the prefix. */
+static bool complete_emoji (const EmojiItem * emojis,
+                            guint emojis_len,
+                            const char * prefix,
+                            std::string & emoji) {
+    const EmojiItem * item = std::lower_bound
+        (emojis, emojis + emojis_len, prefix, compare_match_less_than);
 
-        emoji = index->m_emoji_string;
-        return true;
-    }
+    if (item == emojis + emojis_len)
+        return false;
 
-    return false;
+    if (0 != std::strncmp (EMOJI_MATCH (*item), prefix, std::strlen (prefix)))
+        return false;
+
+    emoji = EMOJI_STRING (*item);
+    return true;
 }
 
 gboolean
 EmojiCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+{
+    std::vector<EnhancedCandidate> injected;
+    if (!processCandidates (candidates, injected))
+        return FALSE;
+
+    candidates.insert (candidates.begin () +
+                       nbest_candidates_length (candidates),
+                       injected.begin (), injected.end ());
+    return TRUE;
+}
+
+gboolean
+EmojiCandidates::processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                    std::vector<EnhancedCandidate> & injected,
+                                    gboolean complete)
 {
     EnhancedCandidate enhanced;
     enhanced.m_candidate_type = CANDIDATE_EMOJI;
     enhanced.m_candidate_id = 0;
 
-    std::vector<EnhancedCandidate>::iterator pos;
-    for (pos = candidates.begin (); pos != candidates.end (); ++pos) {
-        if (CANDIDATE_NBEST_MATCH != pos->m_candidate_type)
-            break;
-    }
-
     std::string emoji;
-    if (search_emoji (english_emoji_table,
-                      G_N_ELEMENTS (english_emoji_table),
-                      m_editor->m_text, emoji)) {
+    const char * text = m_editor->m_text;
+    if (search_emoji (english_emoji_table, english_emoji_hash,
+                      G_N_ELEMENTS (english_emoji_hash), text, emoji) ||
+        (complete && std::strlen (text) >= EMOJI_COMPLETION_MIN_LENGTH &&
+         complete_emoji (english_emoji_table,
+                         G_N_ELEMENTS (english_emoji_table), text, emoji))) {
         enhanced.m_display_string = emoji;
-        candidates.insert (pos, enhanced);
+        injected.insert (injected.begin (), enhanced);
         return TRUE;
     } else {
         int num = std::min
             (m_editor->m_config.pageSize (), (guint)candidates.size ());
         for (int i = 0; i < num; ++i) {
-            String text = candidates[i].m_display_string;
+            const char * text = candidates[i].m_display_string.c_str ();
 
-            if (search_emoji (chinese_emoji_table,
-                              G_N_ELEMENTS (chinese_emoji_table),
-                              text, emoji)) {
+            if (search_emoji (chinese_emoji_table, chinese_emoji_hash,
+                              G_N_ELEMENTS (chinese_emoji_hash), text, emoji)) {
 
                 enhanced.m_display_string = emoji;
-                candidates.insert (pos, enhanced);
+                injected.insert (injected.begin (), enhanced);
                 return TRUE;
             }
         }
@@ -102,6 +145,17 @@ EmojiCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
     return FALSE;
 }
 
+gboolean
+EmojiCandidates::injectCandidates (CandidateContext & context)
+{
+    if (!context.m_emoji)
+        return FALSE;
+
+    TraceScope trace (TRACE_EMOJI_CANDIDATES);
+    return processCandidates (context.m_cache, context.m_injected,
+                              context.m_unparsed);
+}
+
 int
 EmojiCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
@@ -33,6 +33,17 @@ public:
 
 public:
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* push the emoji candidate to the front of injected, the English
+       emoji names are only completed from the prefix when complete. */
+    gboolean processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                std::vector<EnhancedCandidate> & injected,
+                                gboolean complete = FALSE);
+    gboolean injectCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_EMOJI == type;
+    }
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
@@ -6,3303 +6,8556 @@
 
 namespace PY{
 
+/* offsets of the strings in emoji_strings. */
 typedef struct {
-    const char * m_emoji_match;
-    const char * m_emoji_string;
+    guint32 m_emoji_match;
+    guint32 m_emoji_string;
 } EmojiItem;
 
+const char emoji_strings[] =
+"a\0"
+"🅰\0"
+"ab\0"
+"🆎\0"
+"abacus\0"
+"🧮\0"
+"abc\0"
+"🔤\0"
+"abcd\0"
+"🔡\0"
+"access\0"
+"♿\0"
+"actor\0"
+"🧑‍🎤\0"
+"adore\0"
+"🥰\0"
+"adult\0"
+"🧑\0"
+"aerial\0"
+"🚡\0"
+"afro\0"
+"🦱\0"
+"aid\0"
+"⛑\0"
+"alarm\0"
+"⏰\0"
+"alien\0"
+"👽\0"
+"alpaca\0"
+"🦙\0"
+"amoeba\0"
+"🦠\0"
+"anchor\0"
+"⚓\0"
+"angel\0"
+"😇\0"
+"angry\0"
+"😡\0"
+"ant\0"
+"🐜\0"
+"ape\0"
+"🦧\0"
+"apple\0"
+"🍎\0"
+"archer\0"
+"🏹\0"
+"arctic\0"
+"🐻‍❄\0"
+"arepa\0"
+"🫓\0"
+"army\0"
+"🪖\0"
+"arrow\0"
+"💘\0"
+"art\0"
+"🎭\0"
+"artist\0"
+"🧑‍🎨\0"
+"ashes\0"
+"⚱\0"
+"ask\0"
+"🙏\0"
+"atm\0"
+"🏧\0"
+"atom\0"
+"⚛\0"
+"autumn\0"
+"🥮\0"
+"axe\0"
+"🪓\0"
+"b\0"
+"🅱\0"
+"baby\0"
+"👶\0"
+"back\0"
+"🔙\0"
+"bacon\0"
+"🥓\0"
+"badge\0"
+"📛\0"
+"badger\0"
+"🦡\0"
+"bag\0"
+"👜\0"
+"bagel\0"
+"🥯\0"
+"bait\0"
+"🪤\0"
+"bakery\0"
+"bald\0"
+"🦲\0"
+"ball\0"
+"🏌\0"
+"ballet\0"
+"🩰\0"
+"ballot\0"
+"🗳\0"
+"bamboo\0"
+"🎍\0"
+"banana\0"
+"🍌\0"
+"banjo\0"
+"🪕\0"
+"bank\0"
+"🏦\0"
+"banner\0"
+"🎋\0"
+"bar\0"
+"🍫\0"
+"barber\0"
+"💇\0"
+"basket\0"
+"🧺\0"
+"bat\0"
+"🦇\0"
+"bath\0"
+"🛀\0"
+"beach\0"
+"🏖\0"
+"beacon\0"
+"🚨\0"
+"bead\0"
+"🧿\0"
+"beads\0"
+"📿\0"
+"bear\0"
+"🐻\0"
+"beard\0"
+"🧔\0"
+"bearer\0"
+"🐍\0"
+"beat\0"
+"🪘\0"
+"beauty\0"
+"beaver\0"
+"🦫\0"
+"bed\0"
+"🛏\0"
+"bee\0"
+"🐝\0"
+"beer\0"
+"🍺\0"
+"beetle\0"
+"🪲\0"
+"bell\0"
+"🛎\0"
+"bento\0"
+"🍱\0"
+"berry\0"
+"🫐\0"
+"biceps\0"
+"💪\0"
+"bike\0"
+"🚵\0"
+"biking\0"
+"🚴\0"
+"bikini\0"
+"👙\0"
+"bill\0"
+"💴\0"
+"bird\0"
+"🪶\0"
+"birdie\0"
+"🏸\0"
+"bison\0"
+"🦬\0"
+"bisque\0"
+"🦞\0"
+"black\0"
+"🖤\0"
+"bleed\0"
+"🩸\0"
+"blind\0"
+"🧑‍🦯\0"
+"blond\0"
+"👱\0"
+"blonde\0"
+"👱‍♀\0"
+"blow\0"
+"🍃\0"
+"blue\0"
+"blush\0"
+"😊\0"
+"boar\0"
+"🐗\0"
+"board\0"
+"🛹\0"
+"boat\0"
+"🚣\0"
+"body\0"
+"👂\0"
+"bolt\0"
+"🔩\0"
+"bomb\0"
+"💣\0"
+"bone\0"
+"🦴\0"
+"book\0"
+"📔\0"
+"books\0"
+"📚\0"
+"boom\0"
+"💥\0"
+"boot\0"
+"🥾\0"
+"bored\0"
+"🥱\0"
+"boring\0"
+"🪴\0"
+"bottle\0"
+"🍼\0"
+"bow\0"
+"🙇\0"
+"bowing\0"
+"🙇‍♂\0"
+"bowl\0"
+"🍜\0"
+"box\0"
+"boxing\0"
+"🥊\0"
+"boy\0"
+"👦\0"
+"brain\0"
+"🧠\0"
+"bread\0"
+"🍞\0"
+"break\0"
+"💔\0"
+"breast\0"
+"🤱\0"
+"breath\0"
+"🫁\0"
+"brick\0"
+"🧱\0"
+"bricks\0"
+"bride\0"
+"👰\0"
+"bridge\0"
+"🌉\0"
+"briefs\0"
+"🩲\0"
+"bright\0"
+"😎\0"
+"broken\0"
+"bronze\0"
+"🥉\0"
+"broom\0"
+"🧹\0"
+"brown\0"
+"🤎\0"
+"brush\0"
+"🪥\0"
+"bubble\0"
+"🧋\0"
+"bucket\0"
+"🪣\0"
+"bug\0"
+"bulb\0"
+"💡\0"
+"bull\0"
+"🐂\0"
+"bullet\0"
+"🚅\0"
+"bunny\0"
+"🐰\0"
+"burger\0"
+"🍔\0"
+"bus\0"
+"🚌\0"
+"bust\0"
+"👤\0"
+"butter\0"
+"🧈\0"
+"button\0"
+"🔼\0"
+"c\0"
+"©\0"
+"cable\0"
+"🚠\0"
+"cactus\0"
+"🌵\0"
+"cake\0"
+"🍥\0"
+"call\0"
+"🤙\0"
+"camel\0"
+"🐪\0"
+"camera\0"
+"🤳\0"
+"can\0"
+"🥫\0"
+"cancel\0"
+"✖\0"
+"candle\0"
+"🕯\0"
+"candy\0"
+"🍬\0"
+"canoe\0"
+"🛶\0"
+"cap\0"
+"👲\0"
+"car\0"
+"🚃\0"
+"card\0"
+"♠\0"
+"care\0"
+"💅\0"
+"carp\0"
+"🎏\0"
+"carrot\0"
+"🥕\0"
+"cart\0"
+"🛒\0"
+"cask\0"
+"castle\0"
+"🏯\0"
+"cat\0"
+"😺\0"
+"catch\0"
+"🪝\0"
+"cd\0"
+"💿\0"
+"cell\0"
+"📱\0"
+"cereal\0"
+"🥣\0"
+"chain\0"
+"⛓\0"
+"chains\0"
+"chair\0"
+"💺\0"
+"chapel\0"
+"💒\0"
+"charm\0"
+"chart\0"
+"💹\0"
+"check\0"
+"✅\0"
+"cheese\0"
+"🫕\0"
+"chef\0"
+"🧑‍🍳\0"
+"cherry\0"
+"🌸\0"
+"chess\0"
+"♟\0"
+"chest\0"
+"🧰\0"
+"chick\0"
+"🐣\0"
+"child\0"
+"🧒\0"
+"chime\0"
+"🎐\0"
+"chop\0"
+"🥩\0"
+"church\0"
+"⛪\0"
+"cinema\0"
+"🎥\0"
+"circle\0"
+"⏺\0"
+"circus\0"
+"🎪\0"
+"citrus\0"
+"🍋\0"
+"city\0"
+"🏙\0"
+"cl\0"
+"🆑\0"
+"claim\0"
+"🛄\0"
+"clamp\0"
+"🗜\0"
+"clap\0"
+"👏\0"
+"claus\0"
+"🎅\0"
+"claws\0"
+"clay\0"
+"clean\0"
+"climb\0"
+"🪜\0"
+"clink\0"
+"🍻\0"
+"clock\0"
+"⌚\0"
+"closed\0"
+"😚\0"
+"closet\0"
+"🚾\0"
+"cloud\0"
+"☁\0"
+"clover\0"
+"🍀\0"
+"clown\0"
+"🤡\0"
+"clue\0"
+"🧩\0"
+"coat\0"
+"🧥\0"
+"coder\0"
+"🧑‍💻\0"
+"coffee\0"
+"☕\0"
+"coffin\0"
+"⚰\0"
+"cog\0"
+"⚙\0"
+"coin\0"
+"🪙\0"
+"cold\0"
+"😅\0"
+"comet\0"
+"☄\0"
+"comic\0"
+"💢\0"
+"conga\0"
+"congee\0"
+"cook\0"
+"cooked\0"
+"🍚\0"
+"cookie\0"
+"🍪\0"
+"cool\0"
+"cop\0"
+"👮\0"
+"cork\0"
+"🍾\0"
+"corn\0"
+"🌽\0"
+"couch\0"
+"🛋\0"
+"couple\0"
+"🧑‍🤝‍🧑\0"
+"cover\0"
+"cow\0"
+"🐮\0"
+"cowboy\0"
+"🤠\0"
+"crab\0"
+"🦀\0"
+"crayon\0"
+"🖍\0"
+"cream\0"
+"🍦\0"
+"credit\0"
+"💳\0"
+"crook\0"
+"cross\0"
+"🤞\0"
+"crown\0"
+"👑\0"
+"crush\0"
+"cry\0"
+"😢\0"
+"cup\0"
+"🍵\0"
+"cupid\0"
+"curl\0"
+"📃\0"
+"curly\0"
+"curry\0"
+"🍛\0"
+"curve\0"
+"cygnet\0"
+"🦢\0"
+"dagger\0"
+"🗡\0"
+"dairy\0"
+"dam\0"
+"dance\0"
+"🕺\0"
+"dancer\0"
+"👯\0"
+"danger\0"
+"⚡\0"
+"dango\0"
+"🍡\0"
+"dark\0"
+"🌑\0"
+"dart\0"
+"🎯\0"
+"dash\0"
+"💨\0"
+"date\0"
+"📅\0"
+"dazed\0"
+"😳\0"
+"deaf\0"
+"🧏\0"
+"death\0"
+"💀\0"
+"deer\0"
+"🦌\0"
+"demon\0"
+"👿\0"
+"dental\0"
+"desert\0"
+"🏜\0"
+"devil\0"
+"dharma\0"
+"☸\0"
+"dialog\0"
+"💬\0"
+"diaper\0"
+"🧷\0"
+"dice\0"
+"🎲\0"
+"die\0"
+"diesel\0"
+"⛽\0"
+"dim\0"
+"🔅\0"
+"dish\0"
+"📡\0"
+"disk\0"
+"💽\0"
+"divide\0"
+"➗\0"
+"diving\0"
+"🦪\0"
+"diya\0"
+"🪔\0"
+"dizzy\0"
+"🥴\0"
+"djinn\0"
+"🧞\0"
+"dna\0"
+"🧬\0"
+"doctor\0"
+"😷\0"
+"dodo\0"
+"🦤\0"
+"dog\0"
+"🐶\0"
+"doll\0"
+"🪆\0"
+"dollar\0"
+"💰\0"
+"donut\0"
+"🍩\0"
+"door\0"
+"🚪\0"
+"double\0"
+"⏩\0"
+"doubt\0"
+"🤷\0"
+"dove\0"
+"🕊\0"
+"down\0"
+"👇\0"
+"dragon\0"
+"🐲\0"
+"dress\0"
+"👗\0"
+"drink\0"
+"🫖\0"
+"drop\0"
+"☔\0"
+"drum\0"
+"duck\0"
+"🦆\0"
+"dung\0"
+"💩\0"
+"dupe\0"
+"dusk\0"
+"🌆\0"
+"dvd\0"
+"📀\0"
+"eagle\0"
+"🦅\0"
+"ear\0"
+"earbud\0"
+"🎧\0"
+"earth\0"
+"🌍\0"
+"east\0"
+"➡\0"
+"egg\0"
+"🥚\0"
+"eight\0"
+"🕗\0"
+"eject\0"
+"⏏\0"
+"eleven\0"
+"🕚\0"
+"elf\0"
+"🧝\0"
+"email\0"
+"✉\0"
+"emblem\0"
+"🔱\0"
+"end\0"
+"🔚\0"
+"engine\0"
+"🚂\0"
+"entry\0"
+"⛔\0"
+"euro\0"
+"💶\0"
+"evil\0"
+"🙈\0"
+"ewe\0"
+"🐑\0"
+"eye\0"
+"😄\0"
+"eyes\0"
+"🤩\0"
+"face\0"
+"🥸\0"
+"fairy\0"
+"🧚\0"
+"family\0"
+"👪\0"
+"farmer\0"
+"🧑‍🌾\0"
+"fast\0"
+"father\0"
+"favor\0"
+"fax\0"
+"📠\0"
+"fear\0"
+"😨\0"
+"feet\0"
+"🐾\0"
+"female\0"
+"fencer\0"
+"🤺\0"
+"ferris\0"
+"🎡\0"
+"ferry\0"
+"⛴\0"
+"fever\0"
+"🦟\0"
+"field\0"
+"🏑\0"
+"file\0"
+"📁\0"
+"filing\0"
+"🗄\0"
+"film\0"
+"🎞\0"
+"finger\0"
+"🖐\0"
+"fire\0"
+"🚒\0"
+"first\0"
+"🥇\0"
+"fish\0"
+"🐟\0"
+"fist\0"
+"✊\0"
+"five\0"
+"🕔\0"
+"flag\0"
+"🏳‍⚧\0"
+"flame\0"
+"🔥\0"
+"flash\0"
+"📸\0"
+"flex\0"
+"flight\0"
+"floor\0"
+"🤣\0"
+"floppy\0"
+"💾\0"
+"flower\0"
+"💐\0"
+"fly\0"
+"🪰\0"
+"fog\0"
+"🌁\0"
+"foggy\0"
+"folder\0"
+"fondue\0"
+"food\0"
+"🫒\0"
+"foot\0"
+"🦶\0"
+"fork\0"
+"🍽\0"
+"four\0"
+"fox\0"
+"🦊\0"
+"frame\0"
+"🪟\0"
+"frames\0"
+"free\0"
+"🆓\0"
+"french\0"
+"🥐\0"
+"fried\0"
+"🍤\0"
+"fries\0"
+"🍟\0"
+"frog\0"
+"🐸\0"
+"frown\0"
+"🙁\0"
+"fruit\0"
+"🍇\0"
+"frying\0"
+"🍳\0"
+"fuel\0"
+"fuji\0"
+"🗻\0"
+"full\0"
+"💯\0"
+"game\0"
+"🏐\0"
+"garden\0"
+"🏡\0"
+"garlic\0"
+"🧄\0"
+"gas\0"
+"gear\0"
+"geek\0"
+"🤓\0"
+"gem\0"
+"💎\0"
+"gene\0"
+"genie\0"
+"ghost\0"
+"👻\0"
+"gift\0"
+"🧧\0"
+"ginger\0"
+"🦰\0"
+"girl\0"
+"👧\0"
+"glass\0"
+"🥛\0"
+"globe\0"
+"glove\0"
+"🥎\0"
+"gloves\0"
+"🧤\0"
+"glow\0"
+"🌟\0"
+"goal\0"
+"🥍\0"
+"goat\0"
+"🐐\0"
+"goblin\0"
+"👺\0"
+"gold\0"
+"golf\0"
+"good\0"
+"🦸\0"
+"goofy\0"
+"🤪\0"
+"grain\0"
+"🌾\0"
+"grape\0"
+"grapes\0"
+"graph\0"
+"grave\0"
+"🪦\0"
+"gray\0"
+"🦳\0"
+"green\0"
+"💚\0"
+"grin\0"
+"😀\0"
+"groom\0"
+"🤵\0"
+"grow\0"
+"growth\0"
+"guard\0"
+"💂\0"
+"guide\0"
+"🦮\0"
+"guitar\0"
+"🎸\0"
+"gun\0"
+"🔫\0"
+"gyro\0"
+"🥙\0"
+"hair\0"
+"halo\0"
+"hammer\0"
+"🔨\0"
+"hand\0"
+"👋\0"
+"happy\0"
+"🙋\0"
+"hashi\0"
+"🥢\0"
+"hat\0"
+"head\0"
+"🗣\0"
+"hear\0"
+"🙉\0"
+"heart\0"
+"🫀\0"
+"hearts\0"
+"heavy\0"
+"🪨\0"
+"heel\0"
+"👠\0"
+"hello\0"
+"🫂\0"
+"helmet\0"
+"help\0"
+"💁\0"
+"herb\0"
+"🌿\0"
+"herd\0"
+"hero\0"
+"hidden\0"
+"🥷\0"
+"hijab\0"
+"🧕\0"
+"hike\0"
+"🚶\0"
+"hiking\0"
+"hindu\0"
+"🛕\0"
+"hippo\0"
+"🦛\0"
+"hit\0"
+"hocho\0"
+"🔪\0"
+"hockey\0"
+"hoist\0"
+"🛗\0"
+"hold\0"
+"hole\0"
+"🕳\0"
+"home\0"
+"🏠\0"
+"honey\0"
+"🍯\0"
+"hook\0"
+"hoop\0"
+"🏀\0"
+"hooray\0"
+"🙌\0"
+"horn\0"
+"🥳\0"
+"horns\0"
+"😈\0"
+"horse\0"
+"🏇\0"
+"hot\0"
+"🥵\0"
+"hotdog\0"
+"🌭\0"
+"hotel\0"
+"🛌\0"
+"house\0"
+"houses\0"
+"🏘\0"
+"hug\0"
+"hump\0"
+"hurt\0"
+"🤕\0"
+"hushed\0"
+"😯\0"
+"hut\0"
+"🛖\0"
+"i\0"
+"ℹ\0"
+"ice\0"
+"id\0"
+"🆔\0"
+"idea\0"
+"ill\0"
+"🤒\0"
+"imp\0"
+"inbox\0"
+"📥\0"
+"index\0"
+"👈\0"
+"injury\0"
+"ink\0"
+"🔏\0"
+"input\0"
+"🔠\0"
+"insect\0"
+"inside\0"
+"💠\0"
+"iron\0"
+"🧇\0"
+"ironic\0"
+"😼\0"
+"islam\0"
+"🕌\0"
+"island\0"
+"🏝\0"
+"jack\0"
+"🎃\0"
+"jacket\0"
+"jeans\0"
+"👖\0"
+"jewel\0"
+"jiaozi\0"
+"🥟\0"
+"jigsaw\0"
+"jockey\0"
+"joey\0"
+"🦘\0"
+"joke\0"
+"😜\0"
+"joker\0"
+"🃏\0"
+"joy\0"
+"😂\0"
+"judge\0"
+"🧑‍⚖\0"
+"judo\0"
+"🥋\0"
+"jug\0"
+"🏺\0"
+"juggle\0"
+"🤹\0"
+"juice\0"
+"🥤\0"
+"jump\0"
+"kaaba\0"
+"🕋\0"
+"kale\0"
+"🥬\0"
+"karate\0"
+"kebab\0"
+"key\0"
+"🔐\0"
+"kick\0"
+"🦵\0"
+"kimono\0"
+"👘\0"
+"king\0"
+"kiss\0"
+"😘\0"
+"kite\0"
+"🪁\0"
+"kiwi\0"
+"🥝\0"
+"kneel\0"
+"🧎\0"
+"knife\0"
+"knit\0"
+"🧶\0"
+"knobs\0"
+"🎛\0"
+"knot\0"
+"🪢\0"
+"koala\0"
+"🐨\0"
+"lab\0"
+"🧪\0"
+"label\0"
+"🏷\0"
+"ladder\0"
+"lamp\0"
+"laptop\0"
+"💻\0"
+"large\0"
+"🦣\0"
+"lather\0"
+"🧼\0"
+"latin\0"
+"laugh\0"
+"😆\0"
+"lavash\0"
+"lazy\0"
+"🦥\0"
+"leaf\0"
+"ledger\0"
+"📒\0"
+"left\0"
+"◀\0"
+"leg\0"
+"lemon\0"
+"letter\0"
+"💌\0"
+"level\0"
+"🎚\0"
+"lie\0"
+"🤥\0"
+"life\0"
+"lift\0"
+"lifter\0"
+"🏋\0"
+"light\0"
+"limb\0"
+"link\0"
+"🖇\0"
+"lion\0"
+"🦁\0"
+"lips\0"
+"💋\0"
+"liquor\0"
+"🥃\0"
+"litter\0"
+"🚮\0"
+"lizard\0"
+"🦎\0"
+"llama\0"
+"loaf\0"
+"lock\0"
+"🔓\0"
+"locked\0"
+"🔒\0"
+"locker\0"
+"🛅\0"
+"log\0"
+"🪵\0"
+"loop\0"
+"➰\0"
+"lorry\0"
+"🚛\0"
+"lotion\0"
+"🧴\0"
+"loud\0"
+"🔊\0"
+"love\0"
+"😍\0"
+"low\0"
+"luck\0"
+"lumber\0"
+"🪚\0"
+"lungs\0"
+"m\0"
+"Ⓜ\0"
+"mad\0"
+"mage\0"
+"🧙\0"
+"maggot\0"
+"magic\0"
+"🪄\0"
+"magnet\0"
+"🧲\0"
+"mail\0"
+"maize\0"
+"makeup\0"
+"💄\0"
+"male\0"
+"🐏\0"
+"man\0"
+"👨\0"
+"mango\0"
+"🥭\0"
+"map\0"
+"🗺\0"
+"maple\0"
+"🍁\0"
+"mark\0"
+"❣\0"
+"marker\0"
+"📑\0"
+"mask\0"
+"mate\0"
+"🧉\0"
+"math\0"
+"➕\0"
+"maze\0"
+"meat\0"
+"🍖\0"
+"medal\0"
+"🎖\0"
+"medium\0"
+"🔉\0"
+"meh\0"
+"😐\0"
+"melon\0"
+"🍈\0"
+"melted\0"
+"memo\0"
+"📝\0"
+"men\0"
+"👯‍♂\0"
+"mercy\0"
+"🥺\0"
+"merman\0"
+"🧜\0"
+"metal\0"
+"metro\0"
+"🚇\0"
+"mic\0"
+"🎙\0"
+"milk\0"
+"mining\0"
+"⛏\0"
+"minus\0"
+"➖\0"
+"mirror\0"
+"🪞\0"
+"moai\0"
+"🗿\0"
+"mobile\0"
+"mode\0"
+"📳\0"
+"molusc\0"
+"🦑\0"
+"money\0"
+"monkey\0"
+"moon\0"
+"mortar\0"
+"mosque\0"
+"mother\0"
+"🤶\0"
+"motor\0"
+"🛵\0"
+"mouse\0"
+"🐭\0"
+"mouth\0"
+"😃\0"
+"movie\0"
+"moyai\0"
+"mug\0"
+"munch\0"
+"😱\0"
+"muscle\0"
+"museum\0"
+"🖼\0"
+"music\0"
+"🎼\0"
+"mute\0"
+"🔇\0"
+"naan\0"
+"nail\0"
+"name\0"
+"nazar\0"
+"neck\0"
+"🧣\0"
+"needle\0"
+"🪡\0"
+"nerd\0"
+"net\0"
+"🥅\0"
+"new\0"
+"🆕\0"
+"news\0"
+"📰\0"
+"ng\0"
+"🆖\0"
+"nib\0"
+"✒\0"
+"night\0"
+"🌃\0"
+"nine\0"
+"🕘\0"
+"ninja\0"
+"no\0"
+"noodle\0"
+"north\0"
+"⬆\0"
+"nose\0"
+"not\0"
+"note\0"
+"🎵\0"
+"notes\0"
+"🎶\0"
+"nurse\0"
+"🧑‍⚕\0"
+"nut\0"
+"🥜\0"
+"o\0"
+"⭕\0"
+"ocean\0"
+"🌊\0"
+"oden\0"
+"🍢\0"
+"off\0"
+"📴\0"
+"ogre\0"
+"👹\0"
+"oh\0"
+"🙀\0"
+"oil\0"
+"🛢\0"
+"old\0"
+"🧓\0"
+"olive\0"
+"om\0"
+"🕉\0"
+"on\0"
+"🔛\0"
+"once\0"
+"🔂\0"
+"one\0"
+"🕐\0"
+"onion\0"
+"🧅\0"
+"open\0"
+"orange\0"
+"🧡\0"
+"organ\0"
+"otter\0"
+"🦦\0"
+"outbox\0"
+"📤\0"
+"owl\0"
+"🦉\0"
+"ox\0"
+"oyster\0"
+"pad\0"
+"🗒\0"
+"paddle\0"
+"🏓\0"
+"paella\0"
+"🥘\0"
+"page\0"
+"pager\0"
+"📟\0"
+"pail\0"
+"palm\0"
+"🤦\0"
+"pan\0"
+"panda\0"
+"🐼\0"
+"pants\0"
+"paper\0"
+"📜\0"
+"parcel\0"
+"📦\0"
+"park\0"
+"🏞\0"
+"parlor\0"
+"parrot\0"
+"🦜\0"
+"part\0"
+"〽\0"
+"party\0"
+"🪅\0"
+"pasta\0"
+"🍝\0"
+"pastry\0"
+"patrol\0"
+"🚓\0"
+"pause\0"
+"⏯\0"
+"paw\0"
+"pc\0"
+"peace\0"
+"peach\0"
+"🍑\0"
+"peahen\0"
+"🦚\0"
+"peanut\0"
+"pear\0"
+"🍐\0"
+"pearl\0"
+"pen\0"
+"pencil\0"
+"✏\0"
+"pepper\0"
+"🫑\0"
+"person\0"
+"pest\0"
+"pester\0"
+"pet\0"
+"phone\0"
+"piano\0"
+"🎹\0"
+"pick\0"
+"picket\0"
+"🪧\0"
+"pickle\0"
+"🥒\0"
+"pickup\0"
+"🛻\0"
+"picnic\0"
+"pie\0"
+"🥧\0"
+"piece\0"
+"pig\0"
+"🐷\0"
+"pill\0"
+"💊\0"
+"pilot\0"
+"🧑‍✈\0"
+"pin\0"
+"📌\0"
+"pine\0"
+"pink\0"
+"pirate\0"
+"pistol\0"
+"pita\0"
+"pizza\0"
+"🍕\0"
+"plane\0"
+"plant\0"
+"plate\0"
+"play\0"
+"▶\0"
+"please\0"
+"plug\0"
+"🔌\0"
+"plus\0"
+"plush\0"
+"🧸\0"
+"point\0"
+"pole\0"
+"💈\0"
+"police\0"
+"polish\0"
+"polo\0"
+"🤽\0"
+"poo\0"
+"poodle\0"
+"🐩\0"
+"poop\0"
+"popper\0"
+"🎉\0"
+"porous\0"
+"🧽\0"
+"post\0"
+"🏣\0"
+"postal\0"
+"📯\0"
+"pot\0"
+"potato\0"
+"🥔\0"
+"pouch\0"
+"👝\0"
+"pound\0"
+"💷\0"
+"prawn\0"
+"pray\0"
+"prayer\0"
+"🤲\0"
+"pretty\0"
+"🦋\0"
+"pride\0"
+"🏳‍🌈\0"
+"prince\0"
+"🤴\0"
+"print\0"
+"👣\0"
+"prize\0"
+"🏆\0"
+"proof\0"
+"🧾\0"
+"proud\0"
+"🥲\0"
+"puck\0"
+"🏒\0"
+"pulse\0"
+"pump\0"
+"punch\0"
+"purple\0"
+"💜\0"
+"purse\0"
+"👛\0"
+"puzzle\0"
+"queen\0"
+"quench\0"
+"🧯\0"
+"quiet\0"
+"🤫\0"
+"r\0"
+"®\0"
+"rabbit\0"
+"racing\0"
+"🏃‍♂\0"
+"radio\0"
+"📻\0"
+"rage\0"
+"rain\0"
+"⛈\0"
+"raised\0"
+"🤚\0"
+"ram\0"
+"ramen\0"
+"rat\0"
+"🐀\0"
+"rays\0"
+"☀\0"
+"razor\0"
+"🪒\0"
+"record\0"
+"red\0"
+"reload\0"
+"🔃\0"
+"repeat\0"
+"🔁\0"
+"resort\0"
+"⛵\0"
+"rewind\0"
+"⏪\0"
+"rhythm\0"
+"ribbon\0"
+"💝\0"
+"rice\0"
+"right\0"
+"ring\0"
+"💍\0"
+"roach\0"
+"🪳\0"
+"road\0"
+"🛣\0"
+"robot\0"
+"🤖\0"
+"rock\0"
+"rocket\0"
+"🧑‍🚀\0"
+"roll\0"
+"rolled\0"
+"🗞\0"
+"roller\0"
+"🛼\0"
+"rope\0"
+"rose\0"
+"🌹\0"
+"rugby\0"
+"🏉\0"
+"ruler\0"
+"📏\0"
+"rung\0"
+"rushed\0"
+"😰\0"
+"russia\0"
+"sad\0"
+"safety\0"
+"🦺\0"
+"sake\0"
+"🍶\0"
+"salad\0"
+"🥗\0"
+"salon\0"
+"💆\0"
+"salt\0"
+"🧂\0"
+"sand\0"
+"⌛\0"
+"sandal\0"
+"👡\0"
+"santa\0"
+"sari\0"
+"🥻\0"
+"sash\0"
+"🎽\0"
+"sassy\0"
+"saturn\0"
+"🪐\0"
+"sauna\0"
+"🧖\0"
+"saw\0"
+"sax\0"
+"🎷\0"
+"scale\0"
+"⚖\0"
+"scales\0"
+"scared\0"
+"scarf\0"
+"school\0"
+"🏫\0"
+"score\0"
+"scream\0"
+"screw\0"
+"🪛\0"
+"scroll\0"
+"scuba\0"
+"🤿\0"
+"sea\0"
+"seal\0"
+"🦭\0"
+"search\0"
+"🔍\0"
+"seat\0"
+"second\0"
+"🥈\0"
+"secure\0"
+"see\0"
+"selfie\0"
+"semi\0"
+"sent\0"
+"set\0"
+"📐\0"
+"seven\0"
+"🕖\0"
+"sewing\0"
+"shake\0"
+"🤝\0"
+"shaker\0"
+"shark\0"
+"🦈\0"
+"sharp\0"
+"shave\0"
+"shaved\0"
+"🍧\0"
+"shaven\0"
+"sheep\0"
+"shell\0"
+"🐚\0"
+"shield\0"
+"🛡\0"
+"shinto\0"
+"⛩\0"
+"ship\0"
+"shirt\0"
+"shoe\0"
+"👞\0"
+"shorts\0"
+"🩳\0"
+"shot\0"
+"shower\0"
+"🚿\0"
+"shrimp\0"
+"shrine\0"
+"shrug\0"
+"shush\0"
+"sick\0"
+"sign\0"
+"signal\0"
+"🚥\0"
+"silent\0"
+"😶\0"
+"silver\0"
+"singer\0"
+"sit\0"
+"🪑\0"
+"six\0"
+"🕕\0"
+"skate\0"
+"skewer\0"
+"ski\0"
+"⛷\0"
+"skier\0"
+"skill\0"
+"skis\0"
+"🎿\0"
+"skull\0"
+"skunk\0"
+"🦨\0"
+"sled\0"
+"🛷\0"
+"sledge\0"
+"sleep\0"
+"😪\0"
+"sleigh\0"
+"sleuth\0"
+"🕵\0"
+"slice\0"
+"slider\0"
+"slot\0"
+"🎰\0"
+"sloth\0"
+"slow\0"
+"sly\0"
+"🦝\0"
+"small\0"
+"smile\0"
+"smirk\0"
+"😏\0"
+"snail\0"
+"🐌\0"
+"snake\0"
+"snare\0"
+"sneeze\0"
+"🤧\0"
+"snow\0"
+"soap\0"
+"soar\0"
+"sob\0"
+"😭\0"
+"soccer\0"
+"⚽\0"
+"socks\0"
+"🧦\0"
+"soda\0"
+"soft\0"
+"solid\0"
+"soon\0"
+"🔜\0"
+"sorry\0"
+"sos\0"
+"🆘\0"
+"south\0"
+"⬇\0"
+"sow\0"
+"🐖\0"
+"space\0"
+"🛰\0"
+"speak\0"
+"🙊\0"
+"speech\0"
+"speed\0"
+"🚄\0"
+"spider\0"
+"🕷\0"
+"spiny\0"
+"🦔\0"
+"spiral\0"
+"split\0"
+"spock\0"
+"🖖\0"
+"sponge\0"
+"spool\0"
+"🧵\0"
+"spoon\0"
+"🥄\0"
+"spots\0"
+"🦒\0"
+"spy\0"
+"square\0"
+"⏹\0"
+"squid\0"
+"staff\0"
+"⚕\0"
+"stand\0"
+"🧍\0"
+"star\0"
+"statue\0"
+"🗽\0"
+"steak\0"
+"steam\0"
+"step\0"
+"stew\0"
+"🍲\0"
+"stick\0"
+"stink\0"
+"stomp\0"
+"stone\0"
+"stop\0"
+"🚏\0"
+"store\0"
+"🏪\0"
+"straw\0"
+"🧃\0"
+"string\0"
+"stripe\0"
+"🦓\0"
+"studio\0"
+"stuffy\0"
+"🧐\0"
+"subway\0"
+"suit\0"
+"🕴\0"
+"sun\0"
+"sunny\0"
+"sunset\0"
+"sushi\0"
+"🍣\0"
+"swan\0"
+"sweat\0"
+"sweet\0"
+"🍠\0"
+"swim\0"
+"🏊\0"
+"swirl\0"
+"sword\0"
+"swords\0"
+"⚔\0"
+"tabs\0"
+"taco\0"
+"🌮\0"
+"tada\0"
+"talk\0"
+"tamale\0"
+"🫔\0"
+"tao\0"
+"☯\0"
+"taoist\0"
+"tape\0"
+"📼\0"
+"target\0"
+"taste\0"
+"😝\0"
+"taxi\0"
+"🚕\0"
+"tea\0"
+"teacup\0"
+"teapot\0"
+"tear\0"
+"teeth\0"
+"teller\0"
+"temple\0"
+"ten\0"
+"🕙\0"
+"tennis\0"
+"🎾\0"
+"tent\0"
+"⛺\0"
+"thanks\0"
+"third\0"
+"thirty\0"
+"🕧\0"
+"thongs\0"
+"🩴\0"
+"thread\0"
+"three\0"
+"🕒\0"
+"thumb\0"
+"👍\0"
+"tichel\0"
+"ticket\0"
+"🎟\0"
+"tie\0"
+"tiger\0"
+"🐯\0"
+"timber\0"
+"timer\0"
+"tipsy\0"
+"tired\0"
+"😩\0"
+"tm\0"
+"™\0"
+"toilet\0"
+"🪠\0"
+"tomato\0"
+"🍅\0"
+"tongue\0"
+"😛\0"
+"tool\0"
+"tooth\0"
+"🦷\0"
+"top\0"
+"🎩\0"
+"tophat\0"
+"torch\0"
+"🔦\0"
+"tower\0"
+"🗼\0"
+"toy\0"
+"🪀\0"
+"train\0"
+"tram\0"
+"trap\0"
+"travel\0"
+"🧳\0"
+"tray\0"
+"tree\0"
+"🌲\0"
+"trend\0"
+"📈\0"
+"trophy\0"
+"truck\0"
+"tshirt\0"
+"👕\0"
+"tulip\0"
+"🌷\0"
+"turban\0"
+"👳\0"
+"turkey\0"
+"🦃\0"
+"turtle\0"
+"🐢\0"
+"tusk\0"
+"tuxedo\0"
+"tv\0"
+"📺\0"
+"twelve\0"
+"🕛\0"
+"twine\0"
+"twins\0"
+"👬\0"
+"twist\0"
+"two\0"
+"🕑\0"
+"ufo\0"
+"undead\0"
+"🧛\0"
+"unlock\0"
+"up\0"
+"👆\0"
+"upward\0"
+"urn\0"
+"v\0"
+"✌\0"
+"vat\0"
+"veil\0"
+"versus\0"
+"🆚\0"
+"vest\0"
+"vhs\0"
+"vice\0"
+"video\0"
+"view\0"
+"violin\0"
+"🎻\0"
+"virus\0"
+"vomit\0"
+"🤢\0"
+"vs\0"
+"vulcan\0"
+"waffle\0"
+"walk\0"
+"wall\0"
+"waning\0"
+"🌖\0"
+"watch\0"
+"water\0"
+"wave\0"
+"waving\0"
+"wavy\0"
+"〰\0"
+"waxing\0"
+"🌒\0"
+"wc\0"
+"🚹\0"
+"weapon\0"
+"weary\0"
+"web\0"
+"🕸\0"
+"weight\0"
+"west\0"
+"⬅\0"
+"whale\0"
+"🐳\0"
+"wheel\0"
+"whew\0"
+"😥\0"
+"whisky\0"
+"white\0"
+"🤍\0"
+"whoops\0"
+"🤭\0"
+"wicked\0"
+"wilted\0"
+"🥀\0"
+"wind\0"
+"window\0"
+"wine\0"
+"🍷\0"
+"wings\0"
+"💸\0"
+"wink\0"
+"😉\0"
+"wise\0"
+"wisent\0"
+"witch\0"
+"wizard\0"
+"wolf\0"
+"🐺\0"
+"woman\0"
+"👩\0"
+"women\0"
+"👯‍♀\0"
+"won\0"
+"😤\0"
+"wood\0"
+"wool\0"
+"woolly\0"
+"worker\0"
+"🧑‍🏭\0"
+"world\0"
+"worm\0"
+"🪱\0"
+"wrap\0"
+"🌯\0"
+"wrench\0"
+"🛠\0"
+"write\0"
+"✍\0"
+"wry\0"
+"x\0"
+"yacht\0"
+"yang\0"
+"yarn\0"
+"yawn\0"
+"yellow\0"
+"💛\0"
+"yen\0"
+"yin\0"
+"yoga\0"
+"🧘\0"
+"young\0"
+"yum\0"
+"😋\0"
+"yurt\0"
+"zap\0"
+"zebra\0"
+"zipper\0"
+"🤐\0"
+"zodiac\0"
+"zombie\0"
+"🧟\0"
+"zzz\0"
+"😴\0"
+"㵴火\0"
+"㵴火筒\0"
+"一\0"
+"一件头\0"
+"一堆屎\0"
+"一杯奶\0"
+"一次\0"
+"一点\0"
+"一点半\0"
+"🕜\0"
+"一百分\0"
+"一群\0"
+"七\0"
+"七点\0"
+"七点半\0"
+"🕢\0"
+"万圣节\0"
+"万字夹\0"
+"📎\0"
+"万岁\0"
+"三\0"
+"三十\0"
+"三叉戟\0"
+"三叶草\0"
+"☘\0"
+"三文治\0"
+"🥪\0"
+"三点\0"
+"三点半\0"
+"🕞\0"
+"三角尺\0"
+"三角形\0"
+"三角旗\0"
+"🚩\0"
+"上\0"
+"上升\0"
+"上弦月\0"
+"🌓\0"
+"上锁\0"
+"下\0"
+"下弦月\0"
+"🌗\0"
+"下跌\0"
+"📉\0"
+"不\0"
+"不久\0"
+"不关心\0"
+"不准\0"
+"不可\0"
+"丑小鸭\0"
+"世界\0"
+"丘比特\0"
+"业务\0"
+"👨‍💼\0"
+"东\0"
+"东京\0"
+"东北\0"
+"↗\0"
+"东南\0"
+"↘\0"
+"丝带\0"
+"🎗\0"
+"两个心\0"
+"💕\0"
+"两点\0"
+"两点半\0"
+"🕝\0"
+"个人\0"
+"中国帽\0"
+"中心\0"
+"中性\0"
+"中指\0"
+"🖕\0"
+"中暑\0"
+"中等\0"
+"中肤色\0"
+"🏽\0"
+"串\0"
+"串烧\0"
+"丸子\0"
+"丹参树\0"
+"举手\0"
+"✋\0"
+"举起\0"
+"举重\0"
+"举重者\0"
+"义肢\0"
+"🦾\0"
+"乌蝇\0"
+"乐谱\0"
+"乒乓\0"
+"乒乓球\0"
+"乘\0"
+"乘客\0"
+"🛳\0"
+"乘法\0"
+"九\0"
+"九点\0"
+"九点半\0"
+"🕤\0"
+"乞嚏\0"
+"乞讨\0"
+"书\0"
+"书包\0"
+"🎒\0"
+"书呆子\0"
+"书签\0"
+"乳制品\0"
+"乳房\0"
+"乳液\0"
+"乳液樽\0"
+"二\0"
+"二头肌\0"
+"亏\0"
+"亏凸月\0"
+"云\0"
+"五\0"
+"五点\0"
+"五点半\0"
+"🕠\0"
+"亚洲\0"
+"🌏\0"
+"亡灵\0"
+"交叉\0"
+"交叉旗\0"
+"🎌\0"
+"交叉骨\0"
+"☠\0"
+"交通\0"
+"亮度\0"
+"人\0"
+"🧑‍🍼\0"
+"人马座\0"
+"♐\0"
+"人鱼\0"
+"仓鼠\0"
+"🐹\0"
+"仓鼠脸\0"
+"仙人掌\0"
+"仙子\0"
+"仪器\0"
+"仪式\0"
+"🎑\0"
+"企\0"
+"企鹅\0"
+"🐧\0"
+"会计\0"
+"传呼机\0"
+"传真\0"
+"传真机\0"
+"伤心\0"
+"低\0"
+"低手\0"
+"体操\0"
+"🤸\0"
+"体育场\0"
+"🏟\0"
+"佛教\0"
+"佛法\0"
+"佛法轮\0"
+"侦探\0"
+"侧手翻\0"
+"便利店\0"
+"便当\0"
+"便条\0"
+"俄罗斯\0"
+"保健员\0"
+"保龄球\0"
+"🎳\0"
+"信\0"
+"信号\0"
+"信封\0"
+"信用\0"
+"信用卡\0"
+"信箱\0"
+"📫\0"
+"修甲\0"
+"假扮\0"
+"停\0"
+"停止\0"
+"🛑\0"
+"健康\0"
+"傍晚\0"
+"傻笑\0"
+"傻笑脸\0"
+"光\0"
+"光亮\0"
+"光头\0"
+"光学\0"
+"光环\0"
+"光碟\0"
+"免费\0"
+"🈚\0"
+"兑换\0"
+"💱\0"
+"兔\0"
+"兔耳\0"
+"兔脸\0"
+"入场\0"
+"入场券\0"
+"八\0"
+"八点\0"
+"八点半\0"
+"🕣\0"
+"八角形\0"
+"八角星\0"
+"✳\0"
+"公\0"
+"公主\0"
+"👸\0"
+"公事包\0"
+"💼\0"
+"公仔\0"
+"公园\0"
+"公牛\0"
+"公羊\0"
+"公路\0"
+"公鸡\0"
+"🐓\0"
+"六\0"
+"六点\0"
+"六点半\0"
+"🕡\0"
+"关闭\0"
+"兴奋\0"
+"💖\0"
+"内\0"
+"内衣\0"
+"冇位\0"
+"🈵\0"
+"写字\0"
+"军事\0"
+"军队\0"
+"农夫\0"
+"农夫车\0"
+"冥想\0"
+"冬甩\0"
+"冰\0"
+"🥶\0"
+"冰冷\0"
+"😓\0"
+"冰块\0"
+"🧊\0"
+"冰川\0"
+"冰球\0"
+"冲凉\0"
+"冷球\0"
+"冻\0"
+"冻伤\0"
+"冻结\0"
+"凉鞋\0"
+"凋谢\0"
+"减\0"
+"几何\0"
+"🔴\0"
+"出发\0"
+"🛫\0"
+"出汗\0"
+"击中\0"
+"刀\0"
+"分开\0"
+"分数\0"
+"分类\0"
+"🗂\0"
+"分量\0"
+"划艇\0"
+"初学者\0"
+"🔰\0"
+"刨\0"
+"刨冰\0"
+"利\0"
+"利是\0"
+"利是封\0"
+"到达\0"
+"🛬\0"
+"制服\0"
+"刷\0"
+"券\0"
+"刺\0"
+"刺猬\0"
+"刺绣\0"
+"剃刀\0"
+"剃头\0"
+"剃须\0"
+"剑\0"
+"剑击\0"
+"剔号\0"
+"剧场\0"
+"剪\0"
+"✂\0"
+"剪头发\0"
+"💇‍♂\0"
+"剪影\0"
+"割\0"
+"🈹\0"
+"办公室\0"
+"加\0"
+"勾\0"
+"包头\0"
+"包装\0"
+"🎁\0"
+"包裹\0"
+"匆忙\0"
+"匕首\0"
+"化妆\0"
+"化妆品\0"
+"化学\0"
+"⚗\0"
+"化学家\0"
+"🧑‍🔬\0"
+"化疗\0"
+"北\0"
+"北极熊\0"
+"匙羮\0"
+"医生\0"
+"医疗\0"
+"医药\0"
+"💉\0"
+"医院\0"
+"🏥\0"
+"匿名\0"
+"十\0"
+"十一\0"
+"🕦\0"
+"十一点\0"
+"十二\0"
+"十二点\0"
+"十八岁\0"
+"🔞\0"
+"十字架\0"
+"十点\0"
+"十点半\0"
+"🕥\0"
+"升降机\0"
+"半\0"
+"协助\0"
+"🐕‍🦺\0"
+"卒\0"
+"🤌\0"
+"卒手指\0"
+"单车\0"
+"单轨\0"
+"🚝\0"
+"卖点\0"
+"南\0"
+"南瓜\0"
+"博物馆\0"
+"卡\0"
+"卡片\0"
+"卡片盒\0"
+"📇\0"
+"卡车\0"
+"卫星\0"
+"卫生\0"
+"卫生间\0"
+"印\0"
+"印度寺\0"
+"印度教\0"
+"危险\0"
+"卷\0"
+"卷发\0"
+"卷心菜\0"
+"卷曲\0"
+"卷曲圈\0"
+"卷纸\0"
+"🧻\0"
+"卷起\0"
+"卷页\0"
+"卷饼\0"
+"压\0"
+"厌倦\0"
+"厕所\0"
+"🚽\0"
+"厕所泵\0"
+"厕纸\0"
+"原子\0"
+"原子笔\0"
+"🖊\0"
+"原驼\0"
+"厨师\0"
+"厨房刀\0"
+"叉\0"
+"叉同刀\0"
+"🍴\0"
+"双\0"
+"⏸\0"
+"双子\0"
+"♊\0"
+"双子座\0"
+"双眼\0"
+"👀\0"
+"双耳瓶\0"
+"双胞胎\0"
+"双重\0"
+"双鱼座\0"
+"反射\0"
+"🪃\0"
+"反射器\0"
+"反射镜\0"
+"反弹\0"
+"反手\0"
+"发件箱\0"
+"发光\0"
+"发出\0"
+"📩\0"
+"发动机\0"
+"发型师\0"
+"发明家\0"
+"发烧\0"
+"发疯\0"
+"发癫\0"
+"😠\0"
+"发誓\0"
+"🤬\0"
+"发送\0"
+"取消\0"
+"受伤\0"
+"口罩\0"
+"口震\0"
+"古典\0"
+"🏛\0"
+"可\0"
+"🉑\0"
+"台风\0"
+"🌀\0"
+"叶\0"
+"号角\0"
+"合\0"
+"🈴\0"
+"合埋\0"
+"合手\0"
+"合格\0"
+"吊钟\0"
+"🔔\0"
+"同情\0"
+"😮\0"
+"同意\0"
+"名牌\0"
+"向上\0"
+"向下\0"
+"向右\0"
+"🤜\0"
+"向左\0"
+"🤛\0"
+"吓亲\0"
+"😲\0"
+"吓惊\0"
+"听\0"
+"听筒\0"
+"🩺\0"
+"听障\0"
+"🦻\0"
+"吸力\0"
+"吸气\0"
+"吸水\0"
+"吸烟\0"
+"🚬\0"
+"吸血鬼\0"
+"吹\0"
+"吻\0"
+"呕吐\0"
+"呕心\0"
+"员工\0"
+"呜咽\0"
+"呢度\0"
+"🈁\0"
+"呼\0"
+"呼叫\0"
+"呼吸\0"
+"呼气\0"
+"咀唇\0"
+"和平\0"
+"和服\0"
+"咖哩\0"
+"咖哩饭\0"
+"咖啡\0"
+"咧嘴笑\0"
+"😁\0"
+"咪\0"
+"咪高峰\0"
+"哺乳\0"
+"👨‍🍼\0"
+"哺育\0"
+"唇印\0"
+"唇膏\0"
+"唔准\0"
+"唔吉利\0"
+"🐈‍⬛\0"
+"唔好\0"
+"唔客气\0"
+"😑\0"
+"唔开心\0"
+"😒\0"
+"唔相信\0"
+"唵\0"
+"啄木鸟\0"
+"商业\0"
+"🧑‍💼\0"
+"商人\0"
+"👨‍🔧\0"
+"商店\0"
+"商标\0"
+"啡色\0"
+"啡色心\0"
+"啤酒\0"
+"啤酒杯\0"
+"啧水\0"
+"喂哺\0"
+"喇叭\0"
+"喊\0"
+"喊嘅脸\0"
+"喷水池\0"
+"⛲\0"
+"嗯\0"
+"嘘\0"
+"嘘嘅脸\0"
+"嘟嘟鸟\0"
+"嘭嘭\0"
+"‼\0"
+"嘲笑\0"
+"嘴\0"
+"噢\0"
+"器官\0"
+"四\0"
+"四叶草\0"
+"四点\0"
+"🕓\0"
+"四点半\0"
+"🕟\0"
+"回力镖\0"
+"回带\0"
+"团\0"
+"🍙\0"
+"园丁\0"
+"困惑\0"
+"😖\0"
+"国王\0"
+"图\0"
+"图片\0"
+"图表\0"
+"圆屋\0"
+"圆形\0"
+"圆碌碌\0"
+"🙄\0"
+"圆禁钉\0"
+"📍\0"
+"圈\0"
+"圈套\0"
+"土星\0"
+"圣诞树\0"
+"🎄\0"
+"圣诞节\0"
+"在\0"
+"地下\0"
+"地图\0"
+"地球\0"
+"地球仪\0"
+"地铁\0"
+"场所\0"
+"🛐\0"
+"坏人\0"
+"🦹\0"
+"坐\0"
+"块\0"
+"坚硬\0"
+"坟墓\0"
+"坠落\0"
+"🌠\0"
+"垂直\0"
+"垃圾\0"
+"垃圾桶\0"
+"垒球\0"
+"垫\0"
+"城堡\0"
+"城市\0"
+"培养皿\0"
+"🧫\0"
+"培育\0"
+"基因\0"
+"基点\0"
+"基点间\0"
+"基督徒\0"
+"基督教\0"
+"✝\0"
+"塔\0"
+"墓地\0"
+"墓碑\0"
+"墙\0"
+"增长\0"
+"墨水\0"
+"墨西哥\0"
+"士兵\0"
+"士巴拿\0"
+"壳\0"
+"壶\0"
+"处女\0"
+"处女座\0"
+"♍\0"
+"夏日\0"
+"🍹\0"
+"外卖盒\0"
+"🥡\0"
+"外套\0"
+"外星\0"
+"外星人\0"
+"外框\0"
+"❔\0"
+"外送盘\0"
+"多动作\0"
+"多窿\0"
+"多谢\0"
+"夜晚\0"
+"大\0"
+"大卫\0"
+"✡\0"
+"大厦\0"
+"🏢\0"
+"大厨\0"
+"👨‍🍳\0"
+"大声\0"
+"大声公\0"
+"📢\0"
+"大头针\0"
+"大桥\0"
+"大烛台\0"
+"🕎\0"
+"大猩猩\0"
+"🦍\0"
+"大羊驼\0"
+"大虾\0"
+"大象\0"
+"🐘\0"
+"大阶\0"
+"大雾\0"
+"天使\0"
+"天妇罗\0"
+"天房\0"
+"天气\0"
+"🌡\0"
+"天父\0"
+"天真\0"
+"天秤\0"
+"天秤座\0"
+"天线\0"
+"天线棒\0"
+"📶\0"
+"天蝎座\0"
+"🦂\0"
+"天鹅\0"
+"太空\0"
+"太空人\0"
+"太阳\0"
+"太阳花\0"
+"🌻\0"
+"夫妇\0"
+"👭\0"
+"失望\0"
+"头\0"
+"头发\0"
+"头巾\0"
+"头晕\0"
+"😵\0"
+"头盔\0"
+"奇异果\0"
+"奇怪\0"
+"奖\0"
+"奖杯\0"
+"奖牌\0"
+"奥布朗\0"
+"女\0"
+"女人\0"
+"女仔\0"
+"女仙子\0"
+"🧚‍♀\0"
+"女侦探\0"
+"🕵‍♀\0"
+"女农夫\0"
+"👩‍🌾\0"
+"女厕\0"
+"🚺\0"
+"女厨师\0"
+"👩‍🍳\0"
+"女士\0"
+"女学生\0"
+"👩‍🎓\0"
+"女巫\0"
+"女巫师\0"
+"🧙‍♀\0"
+"女技工\0"
+"👩‍🔧\0"
+"女教师\0"
+"👩‍🏫\0"
+"女歌手\0"
+"👩‍🎤\0"
+"女殭尸\0"
+"🧟‍♀\0"
+"女法官\0"
+"👩‍⚖\0"
+"女王\0"
+"女精灵\0"
+"🧝‍♀\0"
+"女装\0"
+"👚\0"
+"女装帽\0"
+"👒\0"
+"女装靴\0"
+"👢\0"
+"女警察\0"
+"👮‍♀\0"
+"女超人\0"
+"🦸‍♀\0"
+"奶\0"
+"好\0"
+"好奇\0"
+"好累\0"
+"好运\0"
+"好食\0"
+"妈妈\0"
+"妖\0"
+"姓名\0"
+"姿势\0"
+"威士忌\0"
+"娃娃\0"
+"🎎\0"
+"娥眉月\0"
+"娱乐\0"
+"🚙\0"
+"娱乐家\0"
+"婚礼\0"
+"婴儿\0"
+"嬲\0"
+"嬲嘅脸\0"
+"子午线\0"
+"🌐\0"
+"子弹\0"
+"孔雀\0"
+"孕妇\0"
+"🤰\0"
+"字母\0"
+"学校\0"
+"学生\0"
+"🧑‍🎓\0"
+"孵化\0"
+"守卫员\0"
+"安全\0"
+"安息\0"
+"安静\0"
+"完全\0"
+"宗教\0"
+"宝石\0"
+"宝藏\0"
+"实验\0"
+"🥼\0"
+"实验室\0"
+"实验袍\0"
+"宠物\0"
+"客厅\0"
+"客船\0"
+"害怕\0"
+"家\0"
+"家庭\0"
+"家禽\0"
+"🍗\0"
+"寄信\0"
+"寄存\0"
+"寄生虫\0"
+"密码\0"
+"🔑\0"
+"富士\0"
+"富士山\0"
+"寒冷\0"
+"🌨\0"
+"寒冷的\0"
+"🏔\0"
+"对\0"
+"对唔住\0"
+"对话\0"
+"寺庙\0"
+"导师\0"
+"🧑‍🏫\0"
+"导盲\0"
+"导盲犬\0"
+"导航\0"
+"🧭\0"
+"寿司\0"
+"封面\0"
+"射击\0"
+"射手\0"
+"射手座\0"
+"射箭\0"
+"射线\0"
+"小\0"
+"🦐\0"
+"小丑\0"
+"小丑脸\0"
+"小天鹅\0"
+"小妖精\0"
+"小屋\0"
+"小巴\0"
+"🚐\0"
+"小提琴\0"
+"小教堂\0"
+"小水滴\0"
+"💧\0"
+"小童\0"
+"小精灵\0"
+"小量\0"
+"🤏\0"
+"小阶\0"
+"小鸡\0"
+"尺度\0"
+"尿片\0"
+"屋\0"
+"屎\0"
+"山\0"
+"山地\0"
+"山羊\0"
+"山羊座\0"
+"岗位\0"
+"岛\0"
+"崇拜\0"
+"巡逻\0"
+"工业\0"
+"工人\0"
+"工具\0"
+"工具箱\0"
+"工厂\0"
+"工程师\0"
+"巨灵\0"
+"巨石\0"
+"巨蛇\0"
+"巨蟹座\0"
+"巫婆\0"
+"巫师\0"
+"巴士\0"
+"巴士站\0"
+"市场\0"
+"布甸\0"
+"🍮\0"
+"帆船\0"
+"帐单\0"
+"帐篷\0"
+"帕克\0"
+"带\0"
+"帮助\0"
+"常青树\0"
+"帽\0"
+"干净\0"
+"平底镬\0"
+"平底鞋\0"
+"🥿\0"
+"平行\0"
+"年青\0"
+"幸运\0"
+"幻想\0"
+"幼小\0"
+"🌱\0"
+"幼苗\0"
+"庆祝\0"
+"床\0"
+"废纸篓\0"
+"🗑\0"
+"度假村\0"
+"座位\0"
+"座灯\0"
+"康加鼓\0"
+"建筑\0"
+"👷\0"
+"建筑师\0"
+"建造\0"
+"🏗\0"
+"开\0"
+"开会\0"
+"开发者\0"
+"开屏\0"
+"开玩笑\0"
+"开花\0"
+"开酒塞\0"
+"弓\0"
+"弓箭\0"
+"张开\0"
+"弦月\0"
+"弦线\0"
+"弯\0"
+"弯曲\0"
+"录像机\0"
+"📹\0"
+"录制\0"
+"录影带\0"
+"录影机\0"
+"录音室\0"
+"彗星\0"
+"彩虹\0"
+"🌈\0"
+"彩虹旗\0"
+"影片\0"
+"得\0"
+"🉐\0"
+"微生物\0"
+"微笑\0"
+"德古拉\0"
+"徽章\0"
+"心\0"
+"心脏\0"
+"心跳\0"
+"忌廉\0"
+"忍者\0"
+"忧心\0"
+"😔\0"
+"快\0"
+"快乐\0"
+"快到\0"
+"🚔\0"
+"快艇\0"
+"🚤\0"
+"快走\0"
+"快进\0"
+"快速\0"
+"念珠\0"
+"怀孕\0"
+"怀疑\0"
+"🤨\0"
+"怜悯\0"
+"怪物\0"
+"恋爱\0"
+"恐布\0"
+"恭喜\0"
+"㊗\0"
+"恶魔\0"
+"您好\0"
+"悬架\0"
+"🚟\0"
+"情人\0"
+"情侣\0"
+"情信\0"
+"惊叫\0"
+"惊恐\0"
+"惊慌\0"
+"惊讶\0"
+"惧怕\0"
+"想法\0"
+"感动\0"
+"感叹号\0"
+"感叹嘅\0"
+"感激\0"
+"感谢\0"
+"愤怒\0"
+"慢\0"
+"懒\0"
+"戏\0"
+"戏院\0"
+"成人\0"
+"成长\0"
+"我爱您\0"
+"🤟\0"
+"戒指\0"
+"战士\0"
+"战斗机\0"
+"房屋\0"
+"🏚\0"
+"手\0"
+"手势\0"
+"手卷\0"
+"手套\0"
+"手指\0"
+"手指公\0"
+"手掌\0"
+"手提袋\0"
+"手机\0"
+"手枪\0"
+"手球\0"
+"🤾\0"
+"手瓜\0"
+"手表\0"
+"手袋\0"
+"手风琴\0"
+"🪗\0"
+"手鼓\0"
+"扒\0"
+"打\0"
+"打印机\0"
+"🖨\0"
+"打喊露\0"
+"打开\0"
+"打开手\0"
+"👐\0"
+"打扮\0"
+"🧑‍🎄\0"
+"打气\0"
+"📣\0"
+"打电话\0"
+"托盘\0"
+"扣针\0"
+"扩音器\0"
+"扫\0"
+"扫把\0"
+"扭\0"
+"扭歪\0"
+"扭纹\0"
+"🥨\0"
+"扳手\0"
+"批\0"
+"技工\0"
+"🧑‍🔧\0"
+"技术\0"
+"投币口\0"
+"投票\0"
+"抗议\0"
+"折扣\0"
+"抢\0"
+"🏴‍☠\0"
+"护士\0"
+"护照\0"
+"🛂\0"
+"护理\0"
+"护符\0"
+"护镜\0"
+"🥽\0"
+"报纸\0"
+"抱抱\0"
+"抵达\0"
+"担心\0"
+"😟\0"
+"拉丁\0"
+"拉链\0"
+"拉面\0"
+"拍子\0"
+"拍手\0"
+"拍板\0"
+"🎬\0"
+"拖\0"
+"拖住\0"
+"拖头车\0"
+"拖拉机\0"
+"🚜\0"
+"拖鞋\0"
+"招牌\0"
+"拜拜\0"
+"拥抱\0"
+"拳击\0"
+"拳头\0"
+"拳套\0"
+"持有人\0"
+"指\0"
+"指南针\0"
+"指向\0"
+"指甲\0"
+"指甲油\0"
+"按摩\0"
+"按钮\0"
+"挑\0"
+"挥手\0"
+"挥紧手\0"
+"捏手\0"
+"捐血\0"
+"损伤\0"
+"换片\0"
+"🚼\0"
+"掌\0"
+"掌印\0"
+"排球\0"
+"探热针\0"
+"接受\0"
+"接收\0"
+"📨\0"
+"控制\0"
+"控制器\0"
+"🎮\0"
+"提子\0"
+"提示\0"
+"插头\0"
+"握\0"
+"握手\0"
+"握紧\0"
+"揽\0"
+"🤗\0"
+"搜寻\0"
+"搞笑\0"
+"摇\0"
+"摇摇\0"
+"摇滚\0"
+"🤘\0"
+"摔交\0"
+"🤼\0"
+"摔交手\0"
+"摧毁\0"
+"摩天轮\0"
+"摩艾\0"
+"撅嘴\0"
+"播放\0"
+"收件盘\0"
+"收件箱\0"
+"收到\0"
+"📲\0"
+"收据\0"
+"收费\0"
+"🈶\0"
+"收集\0"
+"收音机\0"
+"放低\0"
+"📪\0"
+"放大\0"
+"放射性\0"
+"☢\0"
+"放映机\0"
+"📽\0"
+"放松\0"
+"☺\0"
+"救护车\0"
+"🚑\0"
+"救生衣\0"
+"教堂\0"
+"教师\0"
+"👨‍🏫\0"
+"教授\0"
+"散子\0"
+"散子包\0"
+"敬礼\0"
+"数字\0"
+"🔢\0"
+"数学\0"
+"数学家\0"
+"👨‍🔬\0"
+"文件\0"
+"文件夹\0"
+"文化\0"
+"斑点\0"
+"斑马\0"
+"斧头\0"
+"斩\0"
+"新娘\0"
+"新干线\0"
+"新月\0"
+"新月面\0"
+"🌚\0"
+"新郎\0"
+"新闻\0"
+"方位\0"
+"方便\0"
+"方向\0"
+"方格旗\0"
+"🏁\0"
+"旅行\0"
+"旋转\0"
+"💞\0"
+"旋风\0"
+"🌪\0"
+"旗\0"
+"无\0"
+"无声\0"
+"无头发\0"
+"无用\0"
+"无知\0"
+"无表情\0"
+"无表达\0"
+"无限\0"
+"♾\0"
+"无限制\0"
+"无障碍\0"
+"日元\0"
+"日出\0"
+"🌄\0"
+"日历\0"
+"日圆\0"
+"日式\0"
+"日期\0"
+"日本\0"
+"日落\0"
+"旧\0"
+"🗝\0"
+"旧锁匙\0"
+"早上\0"
+"早餐\0"
+"时钟\0"
+"时髦\0"
+"昆虫\0"
+"明星\0"
+"明星脸\0"
+"星\0"
+"💫\0"
+"星夜\0"
+"星座\0"
+"星星\0"
+"显微镜\0"
+"🔬\0"
+"晕\0"
+"晚上\0"
+"晚礼服\0"
+"景观\0"
+"晴朗\0"
+"智力\0"
+"智慧\0"
+"暂停\0"
+"暗\0"
+"暴龙\0"
+"🦖\0"
+"曱甴\0"
+"曲发\0"
+"曲奇\0"
+"曲棍球\0"
+"月\0"
+"月亮\0"
+"月经\0"
+"月费\0"
+"🈷\0"
+"月饼\0"
+"有\0"
+"有雾\0"
+"服务\0"
+"服务员\0"
+"服务费\0"
+"🈂\0"
+"服装\0"
+"望远镜\0"
+"🔭\0"
+"木\0"
+"木头\0"
+"木屐\0"
+"木工\0"
+"木材\0"
+"木桶\0"
+"木锯\0"
+"未成年\0"
+"朱古力\0"
+"机动船\0"
+"🛥\0"
+"机械人\0"
+"机械脚\0"
+"🦿\0"
+"机械臂\0"
+"杂耍\0"
+"条\0"
+"条纹\0"
+"来\0"
+"杯\0"
+"松树\0"
+"板\0"
+"板手\0"
+"🔧\0"
+"板球\0"
+"🏏\0"
+"果仁\0"
+"果汁\0"
+"果汁盒\0"
+"果汁酒\0"
+"🥥\0"
+"枪\0"
+"枫叶\0"
+"枫树\0"
+"柑桔\0"
+"🍊\0"
+"柑橘\0"
+"柔软\0"
+"🔈\0"
+"柔道\0"
+"柜\0"
+"柠檬\0"
+"标志\0"
+"标签\0"
+"标记\0"
+"标语\0"
+"树\0"
+"树熊\0"
+"树獭\0"
+"栗子\0"
+"🌰\0"
+"格子\0"
+"桃\0"
+"框架\0"
+"框画\0"
+"桌球\0"
+"🎱\0"
+"桌面\0"
+"🖥\0"
+"桑拿\0"
+"档案\0"
+"档案柜\0"
+"桶\0"
+"梅花\0"
+"♣\0"
+"梨\0"
+"梯\0"
+"梯级\0"
+"梳打\0"
+"检查\0"
+"棍\0"
+"棒\0"
+"棒型图\0"
+"📊\0"
+"棒球\0"
+"⚾\0"
+"棒球帽\0"
+"🧢\0"
+"棕榈\0"
+"🌴\0"
+"棕榈树\0"
+"棺材\0"
+"植物\0"
+"椰子\0"
+"榄球\0"
+"槿\0"
+"🌺\0"
+"模式\0"
+"横额\0"
+"樱花\0"
+"樽\0"
+"橄榄\0"
+"橙\0"
+"橙色\0"
+"橙色书\0"
+"📙\0"
+"橙色心\0"
+"櫈\0"
+"欧元\0"
+"欧洲\0"
+"欧陆式\0"
+"🏰\0"
+"歌手\0"
+"歌记号\0"
+"正义\0"
+"👨‍⚖\0"
+"正方形\0"
+"步\0"
+"武器\0"
+"武术\0"
+"死\0"
+"死亡\0"
+"残月\0"
+"🌘\0"
+"殡仪馆\0"
+"殭尸\0"
+"毒菌\0"
+"🍄\0"
+"比坚尼\0"
+"比赛\0"
+"比高包\0"
+"毕业\0"
+"毕业帽\0"
+"🎓\0"
+"毛绒\0"
+"气体\0"
+"气球\0"
+"水\0"
+"水坝\0"
+"水晶\0"
+"🔮\0"
+"水晶球\0"
+"水果\0"
+"水桶\0"
+"水泥\0"
+"水点\0"
+"水牛\0"
+"水狸\0"
+"水球\0"
+"水瓶座\0"
+"水龟\0"
+"永远\0"
+"求助\0"
+"汉堡包\0"
+"汗\0"
+"汽球\0"
+"🎈\0"
+"汽车\0"
+"🚞\0"
+"沉默\0"
+"沙\0"
+"沙发\0"
+"沙律\0"
+"沙漏\0"
+"⏳\0"
+"沙漠\0"
+"沮丧\0"
+"河马\0"
+"油\0"
+"油桶\0"
+"治疗师\0"
+"治疗犬\0"
+"泉\0"
+"♨\0"
+"泊车\0"
+"🅿\0"
+"法国\0"
+"法官\0"
+"法式\0"
+"🥖\0"
+"泡\0"
+"泡泡\0"
+"泡菜\0"
+"波\0"
+"波板糖\0"
+"🍭\0"
+"波浪\0"
+"注册\0"
+"注射\0"
+"注释\0"
+"泳衣\0"
+"🩱\0"
+"泳裤\0"
+"泵\0"
+"洋葱\0"
+"洗头水\0"
+"洗手间\0"
+"洗衫\0"
+"洞\0"
+"⛳\0"
+"派对\0"
+"派对枪\0"
+"流动\0"
+"流口水\0"
+"🤤\0"
+"流星\0"
+"浅\0"
+"浅肤色\0"
+"🏻\0"
+"浓汤\0"
+"浪漫\0"
+"浮潜\0"
+"浴室\0"
+"浴缸\0"
+"海\0"
+"海关\0"
+"🛃\0"
+"海洋\0"
+"海浪\0"
+"海滩\0"
+"海狮\0"
+"海盗\0"
+"海盗旗\0"
+"海绵\0"
+"海豚\0"
+"🐬\0"
+"海豹\0"
+"海鲜\0"
+"海龟\0"
+"消闲\0"
+"消防员\0"
+"🧑‍🚒\0"
+"消防车\0"
+"润肤霜\0"
+"深肤色\0"
+"🏿\0"
+"清洁\0"
+"清真寺\0"
+"清酒\0"
+"渡船\0"
+"温度计\0"
+"温泉\0"
+"游乐场\0"
+"游戏\0"
+"🥌\0"
+"游戏杆\0"
+"🕹\0"
+"游水\0"
+"游艇\0"
+"溅\0"
+"💦\0"
+"溜冰\0"
+"⛸\0"
+"溜冰鞋\0"
+"滑块\0"
+"滑板\0"
+"滑板车\0"
+"滑浪\0"
+"🏄\0"
+"滑翔伞\0"
+"🪂\0"
+"滑雪\0"
+"滑雪板\0"
+"🏂\0"
+"滚动\0"
+"滚筒\0"
+"🎢\0"
+"滚轴\0"
+"满\0"
+"🌕\0"
+"满分\0"
+"满意\0"
+"满月\0"
+"满月面\0"
+"🌝\0"
+"滴汗\0"
+"演员\0"
+"漩涡\0"
+"漫画\0"
+"潜水\0"
+"潜水镜\0"
+"澳洲\0"
+"火\0"
+"火山\0"
+"🌋\0"
+"火焰\0"
+"火箭\0"
+"火花\0"
+"🎇\0"
+"火车\0"
+"火鸡\0"
+"灯\0"
+"灯泡\0"
+"灯笼\0"
+"灯笼椒\0"
+"灯胆\0"
+"灰烬\0"
+"灰色\0"
+"炖\0"
+"炮丈\0"
+"🧨\0"
+"炸\0"
+"炸弹\0"
+"炸药\0"
+"炸虾\0"
+"点\0"
+"烈酒\0"
+"烈酒㷴\0"
+"烘焙\0"
+"烛台\0"
+"烟肉\0"
+"烟花\0"
+"🎆\0"
+"烤肉串\0"
+"烤饼\0"
+"烧焊\0"
+"烩\0"
+"烩番薯\0"
+"热\0"
+"热带\0"
+"🦩\0"
+"热带鱼\0"
+"🐠\0"
+"热狗\0"
+"热腾腾\0"
+"热饮\0"
+"热香饼\0"
+"🥞\0"
+"煎\0"
+"煮熟\0"
+"煮食\0"
+"煲\0"
+"熄\0"
+"熊\0"
+"熊仔\0"
+"熊猫\0"
+"熊猫脸\0"
+"熊脸\0"
+"燃油\0"
+"燃油泵\0"
+"燕尾服\0"
+"🤵‍♀\0"
+"燕麦\0"
+"爆发\0"
+"爆炸\0"
+"爆炸头\0"
+"🤯\0"
+"爆谷\0"
+"🍿\0"
+"爪\0"
+"爬\0"
+"爱\0"
+"爱情\0"
+"片\0"
+"片装\0"
+"🍰\0"
+"版权\0"
+"牌\0"
+"牙\0"
+"牙刷\0"
+"牙医\0"
+"牙科\0"
+"牙齿\0"
+"牛\0"
+"牛仔\0"
+"牛仔裤\0"
+"牛女\0"
+"牛奶\0"
+"牛扒\0"
+"牛油\0"
+"牛油果\0"
+"🥑\0"
+"牛脸\0"
+"牛角\0"
+"牛角包\0"
+"牛角卷\0"
+"牧人\0"
+"👨‍🌾\0"
+"犀牛\0"
+"🦏\0"
+"犯罪\0"
+"犹太人\0"
+"犹太教\0"
+"🕍\0"
+"狂热\0"
+"狐狸\0"
+"狐狸脸\0"
+"狗\0"
+"狗脸\0"
+"狡猾\0"
+"独峰驼\0"
+"独木舟\0"
+"独角兽\0"
+"🦄\0"
+"狮子\0"
+"狮子座\0"
+"狮子狗\0"
+"狮子脸\0"
+"狸\0"
+"狼\0"
+"狼脸\0"
+"猩猩\0"
+"猪\0"
+"猪公\0"
+"猪扒\0"
+"猪脸\0"
+"猪鼻\0"
+"🐽\0"
+"猫\0"
+"猫头鹰\0"
+"猫脸\0"
+"🐱\0"
+"猿\0"
+"獭\0"
+"獾\0"
+"玉米\0"
+"王子\0"
+"玛黛茶\0"
+"玩\0"
+"🎴\0"
+"玩具\0"
+"玫瑰\0"
+"环虫\0"
+"玻璃\0"
+"玻璃杯\0"
+"🍸\0"
+"珍珠\0"
+"珠\0"
+"珠宝\0"
+"班卓琴\0"
+"班戟\0"
+"球\0"
+"球场\0"
+"球拍\0"
+"球棒\0"
+"理发\0"
+"瑜伽\0"
+"瑞士\0"
+"瓦肯式\0"
+"瓮\0"
+"甜\0"
+"甜品\0"
+"生命\0"
+"生姜\0"
+"生果\0"
+"生物\0"
+"生物学\0"
+"生病\0"
+"生肖\0"
+"⛎\0"
+"生菜\0"
+"生蚝\0"
+"用笔锁\0"
+"甲壳虫\0"
+"甲虫\0"
+"申\0"
+"🈸\0"
+"申请\0"
+"电\0"
+"电力\0"
+"电单车\0"
+"🏍\0"
+"电压\0"
+"电工\0"
+"电影\0"
+"电池\0"
+"🔋\0"
+"电筒\0"
+"电脑\0"
+"电视机\0"
+"电话\0"
+"电车\0"
+"电邮\0"
+"男\0"
+"👱‍♂\0"
+"男人\0"
+"男仔\0"
+"男仙子\0"
+"🧚‍♂\0"
+"男侦探\0"
+"🕵‍♂\0"
+"男农夫\0"
+"男厕\0"
+"男厨师\0"
+"男士\0"
+"男学生\0"
+"👨‍🎓\0"
+"男巫\0"
+"男巫师\0"
+"🧙‍♂\0"
+"男技工\0"
+"男教师\0"
+"男歌手\0"
+"👨‍🎤\0"
+"男殭尸\0"
+"🧟‍♂\0"
+"男法官\0"
+"男精灵\0"
+"🧝‍♂\0"
+"男装鞋\0"
+"男警察\0"
+"👮‍♂\0"
+"男超人\0"
+"🦸‍♂\0"
+"画画\0"
+"🖌\0"
+"画笔\0"
+"画面\0"
+"番枧\0"
+"番枧盒\0"
+"番茄\0"
+"番薯\0"
+"疟疾\0"
+"疾病\0"
+"病\0"
+"病毒\0"
+"痛苦\0"
+"😬\0"
+"痢\0"
+"登山者\0"
+"🧗\0"
+"白兔\0"
+"白羊座\0"
+"白色\0"
+"白色心\0"
+"白色旗\0"
+"🏳\0"
+"白花\0"
+"💮\0"
+"白菜\0"
+"白领\0"
+"百\0"
+"百撘卡\0"
+"的士\0"
+"皇冠\0"
+"皮纳塔\0"
+"皱眉\0"
+"☹\0"
+"盆栽\0"
+"盈\0"
+"盈凸月\0"
+"🌔\0"
+"盐\0"
+"盐樽\0"
+"盒\0"
+"盒子\0"
+"目标\0"
+"盲\0"
+"👨‍🦯\0"
+"盲人\0"
+"直升机\0"
+"🚁\0"
+"直尺\0"
+"直边\0"
+"相机\0"
+"盾\0"
+"眨眼\0"
+"眼\0"
+"眼泪\0"
+"眼睛\0"
+"眼镜\0"
+"着上\0"
+"睇\0"
+"短裤\0"
+"石\0"
+"石头\0"
+"砂浆\0"
+"砂锅\0"
+"砌图\0"
+"砖\0"
+"破折号\0"
+"破碎\0"
+"硬币\0"
+"碌地\0"
+"碎\0"
+"碗\0"
+"碟\0"
+"碰撞\0"
+"磁力\0"
+"磁性\0"
+"磁石\0"
+"磁碟\0"
+"礼物\0"
+"祈祷\0"
+"祝\0"
+"神奇\0"
+"神教\0"
+"神社\0"
+"祷告\0"
+"禁\0"
+"🈲\0"
+"禁止\0"
+"禁钉\0"
+"离境\0"
+"禾束\0"
+"秋天\0"
+"科学\0"
+"科学家\0"
+"秒表\0"
+"⏱\0"
+"秘\0"
+"㊙\0"
+"秘密\0"
+"秤\0"
+"穆斯林\0"
+"穗\0"
+"空\0"
+"🈳\0"
+"空中\0"
+"空手道\0"
+"突起\0"
+"窗\0"
+"窝夫\0"
+"窿\0"
+"竖起\0"
+"章鱼\0"
+"🐙\0"
+"童话\0"
+"👼\0"
+"竹\0"
+"竿\0"
+"🎣\0"
+"笃笃\0"
+"🛺\0"
+"笑\0"
+"笑脸\0"
+"笔\0"
+"笔尖\0"
+"笔记板\0"
+"📋\0"
+"笔记簿\0"
+"符号\0"
+"第一\0"
+"第三\0"
+"第二\0"
+"筷子\0"
+"算盘\0"
+"箭\0"
+"箭咀\0"
+"箭头\0"
+"箭靶\0"
+"箱\0"
+"篮\0"
+"篮圈\0"
+"篮球\0"
+"簿记\0"
+"米\0"
+"米饼\0"
+"🍘\0"
+"粉碎\0"
+"粗乘号\0"
+"粗减号\0"
+"粗剔号\0"
+"✔\0"
+"粗加号\0"
+"粗除号\0"
+"粟米\0"
+"粟米饼\0"
+"粥\0"
+"粪便\0"
+"粱龙\0"
+"🦕\0"
+"糕点\0"
+"糖果\0"
+"索引\0"
+"紧张\0"
+"💗\0"
+"紧急\0"
+"紫色\0"
+"紫色心\0"
+"累\0"
+"累嘅脸\0"
+"😫\0"
+"纠察\0"
+"纠缠\0"
+"红\0"
+"红包\0"
+"红心\0"
+"♥\0"
+"红色\0"
+"红色心\0"
+"❤\0"
+"红苹果\0"
+"红萝卜\0"
+"红酒杯\0"
+"红面\0"
+"红鹤\0"
+"级别\0"
+"纪念\0"
+"纱丽\0"
+"纳扎尔\0"
+"纸\0"
+"纸屑\0"
+"🎊\0"
+"纸屑球\0"
+"纸巾\0"
+"纸币\0"
+"纸牌\0"
+"线\0"
+"线索\0"
+"组合\0"
+"组装\0"
+"细\0"
+"细菌\0"
+"终极\0"
+"🥏\0"
+"经理\0"
+"结\0"
+"结他\0"
+"结束\0"
+"绘画\0"
+"绝种\0"
+"绳\0"
+"绳球\0"
+"绵羊\0"
+"绷带\0"
+"绿色\0"
+"绿色书\0"
+"📗\0"
+"绿色心\0"
+"缆\0"
+"缆车\0"
+"缝纫\0"
+"缝纫针\0"
+"缝线\0"
+"缝补\0"
+"缝针\0"
+"缸\0"
+"罐\0"
+"罐头\0"
+"网\0"
+"网球\0"
+"网球拍\0"
+"羊扒\0"
+"羊毛\0"
+"羊驼\0"
+"美人鱼\0"
+"美元\0"
+"💵\0"
+"美容\0"
+"美容店\0"
+"美式\0"
+"🏈\0"
+"美洲\0"
+"🌎\0"
+"羽毛\0"
+"羽毛球\0"
+"翼\0"
+"老\0"
+"老人\0"
+"老伯伯\0"
+"👴\0"
+"老婆婆\0"
+"👵\0"
+"老师\0"
+"老年\0"
+"老虎\0"
+"老虎机\0"
+"老虎脸\0"
+"老鼠\0"
+"老鼠夹\0"
+"老鼠脸\0"
+"耕种\0"
+"耳仔\0"
+"耳机\0"
+"耸肩\0"
+"聋\0"
+"聋人\0"
+"联锁\0"
+"肉\0"
+"肉丸\0"
+"🧆\0"
+"肉块\0"
+"肉菜饭\0"
+"肉连⻣\0"
+"肌肉\0"
+"肢\0"
+"肤色\0"
+"肩带\0"
+"肺\0"
+"背囊\0"
+"背心\0"
+"胜利\0"
+"胡椒粉\0"
+"胶布\0"
+"🩹\0"
+"胸像\0"
+"脉冲\0"
+"脉动\0"
+"脑\0"
+"脚\0"
+"脚印\0"
+"脚掌\0"
+"脱落\0"
+"🌳\0"
+"脸\0"
+"脸红\0"
+"腐烂\0"
+"腕龙\0"
+"腮红\0"
+"自动化\0"
+"自拍\0"
+"自来水\0"
+"🚰\0"
+"自然\0"
+"自由\0"
+"自行车\0"
+"🚳\0"
+"自豪\0"
+"臭\0"
+"臭鼬\0"
+"舞蹈员\0"
+"航班\0"
+"船\0"
+"艇\0"
+"色士风\0"
+"艺人\0"
+"艺术\0"
+"艺术家\0"
+"👨‍🎨\0"
+"节奏\0"
+"节日\0"
+"芒果\0"
+"芝士\0"
+"芭蕾舞\0"
+"花\0"
+"花园\0"
+"花束\0"
+"花栗鼠\0"
+"🐿\0"
+"花洒\0"
+"花环\0"
+"🏵\0"
+"花生\0"
+"花纸牌\0"
+"苦恼\0"
+"😧\0"
+"英镑\0"
+"英雄\0"
+"苹果\0"
+"茄子\0"
+"🍆\0"
+"茶\0"
+"茶壶\0"
+"茶杯\0"
+"草\0"
+"草蜢\0"
+"🦗\0"
+"荒岛\0"
+"荒废\0"
+"药\0"
+"药丸\0"
+"莓\0"
+"莫伊\0"
+"菜\0"
+"菠萝\0"
+"🍍\0"
+"菱形\0"
+"🔶\0"
+"营\0"
+"🈺\0"
+"营业\0"
+"落叶\0"
+"落叶树\0"
+"落雨\0"
+"葬礼\0"
+"葵扇\0"
+"蒙古包\0"
+"蒜头\0"
+"蒸气\0"
+"蒸气房\0"
+"蒸汽\0"
+"蒸馏器\0"
+"蓝光\0"
+"蓝色\0"
+"蓝色书\0"
+"📘\0"
+"蓝色心\0"
+"💙\0"
+"蓝莓\0"
+"蔬菜\0"
+"薄班戟\0"
+"薄饼\0"
+"薯仔\0"
+"薯条\0"
+"蘑菇\0"
+"虎头钳\0"
+"虫\0"
+"虾\0"
+"蚂蚁\0"
+"蚊\0"
+"蚝桶\0"
+"蚯蚓\0"
+"蛆\0"
+"蛇\0"
+"蛇夫座\0"
+"蛋\0"
+"蛋糕\0"
+"🎂\0"
+"蜂蜜獾\0"
+"蜗牛\0"
+"蜘蛛\0"
+"蜘蛛网\0"
+"蜜瓜\0"
+"蜜糖\0"
+"蜜糖罐\0"
+"蜜蜂\0"
+"蜡烛\0"
+"蜡笔\0"
+"蜥蜴\0"
+"蝎子\0"
+"蝙蝠\0"
+"蝴蝶\0"
+"蝴蝶结\0"
+"蝴蝶酥\0"
+"融\0"
+"螺\0"
+"螺丝\0"
+"螺丝批\0"
+"螺旋\0"
+"螺旋形\0"
+"螺栓\0"
+"螺母\0"
+"蟹\0"
+"血型\0"
+"血液\0"
+"行人\0"
+"🚸\0"
+"行尸\0"
+"行山\0"
+"行山鞋\0"
+"行李\0"
+"行紧路\0"
+"行路\0"
+"表情\0"
+"🙍\0"
+"表演\0"
+"衫\0"
+"袋\0"
+"袋棍球\0"
+"袋鼠\0"
+"袜\0"
+"裁剪\0"
+"装配\0"
+"👨‍🏭\0"
+"装饰\0"
+"裇衫\0"
+"裙\0"
+"裤\0"
+"西\0"
+"西兰花\0"
+"🥦\0"
+"西北\0"
+"↖\0"
+"西南\0"
+"↙\0"
+"西瓜\0"
+"🍉\0"
+"西装\0"
+"见证\0"
+"👁‍🗨\0"
+"解锁\0"
+"警告\0"
+"⚠\0"
+"警员\0"
+"警官\0"
+"警察\0"
+"警报\0"
+"警示灯\0"
+"警车\0"
+"警车灯\0"
+"计数\0"
+"计时器\0"
+"训紧觉\0"
+"训觉\0"
+"讯号\0"
+"讲\0"
+"讲价\0"
+"讲大话\0"
+"讲师\0"
+"讲野\0"
+"讽刺\0"
+"证据\0"
+"证明\0"
+"试味\0"
+"试管\0"
+"试食\0"
+"请\0"
+"谂野\0"
+"🤔\0"
+"调味\0"
+"调味料\0"
+"调查员\0"
+"调皮\0"
+"调色板\0"
+"谷物\0"
+"豹\0"
+"🐆\0"
+"账簿\0"
+"货币\0"
+"货船\0"
+"货车\0"
+"质问\0"
+"购物\0"
+"🛍\0"
+"购物袋\0"
+"购物车\0"
+"资讯\0"
+"赏月\0"
+"赛跑\0"
+"赛跑衫\0"
+"赛车\0"
+"🏎\0"
+"赛马\0"
+"赢\0"
+"赢咗\0"
+"赶上\0"
+"起重机\0"
+"超人\0"
+"超级\0"
+"趋势\0"
+"足球\0"
+"跆拳道\0"
+"跑\0"
+"跑步\0"
+"🏃\0"
+"跑鞋\0"
+"👟\0"
+"跪\0"
+"跪嘅人\0"
+"路\0"
+"跳\0"
+"跳伞\0"
+"跳动\0"
+"💓\0"
+"跳舞\0"
+"💃\0"
+"踏\0"
+"踢\0"
+"踩单车\0"
+"踫杯\0"
+"身份\0"
+"身体\0"
+"车\0"
+"车厘子\0"
+"🍒\0"
+"车站\0"
+"🚉\0"
+"车辆\0"
+"轨迹球\0"
+"🖲\0"
+"轮\0"
+"轮廓\0"
+"轮椅\0"
+"🧑‍🦼\0"
+"软\0"
+"软件\0"
+"软雪糕\0"
+"轰\0"
+"轻铁\0"
+"🚈\0"
+"较剪\0"
+"辅助\0"
+"输入\0"
+"辣\0"
+"🌶\0"
+"辣椒\0"
+"过山车\0"
+"过路\0"
+"运动\0"
+"运动场\0"
+"运动鞋\0"
+"返回\0"
+"进入\0"
+"进化\0"
+"远足\0"
+"连住\0"
+"连结\0"
+"🔗\0"
+"迪亚\0"
+"迪亚灯\0"
+"迷茫\0"
+"😕\0"
+"退出\0"
+"送礼\0"
+"送货\0"
+"🚚\0"
+"送货车\0"
+"逆时针\0"
+"🔄\0"
+"选框\0"
+"☑\0"
+"透明\0"
+"通渠\0"
+"速度\0"
+"道\0"
+"道教\0"
+"道歉\0"
+"遗传学\0"
+"遮\0"
+"邋遢\0"
+"邪恶\0"
+"邪眼\0"
+"邮件\0"
+"📧\0"
+"邮局\0"
+"🏤\0"
+"邮政\0"
+"邮箱\0"
+"郁金香\0"
+"部门\0"
+"🏬\0"
+"酒\0"
+"酒吧\0"
+"酒塞\0"
+"酒店\0"
+"酱\0"
+"酷\0"
+"醉\0"
+"醉嘅脸\0"
+"醒\0"
+"采矿\0"
+"重\0"
+"重覆\0"
+"重量\0"
+"野牛\0"
+"野餐\0"
+"金\0"
+"金属\0"
+"金牌\0"
+"金牛座\0"
+"针\0"
+"针筒\0"
+"针织\0"
+"钓鱼\0"
+"钓鱼竿\0"
+"钟\0"
+"钢琴\0"
+"钢笔\0"
+"🖋\0"
+"钩针\0"
+"钮\0"
+"钱\0"
+"钱袋\0"
+"钳\0"
+"钻石\0"
+"铁\0"
+"铁路\0"
+"铁路车\0"
+"铃\0"
+"铅笔\0"
+"铜\0"
+"铜牌\0"
+"银\0"
+"银河\0"
+"🌌\0"
+"银牌\0"
+"银纸\0"
+"银行\0"
+"链\0"
+"锁\0"
+"锁匙\0"
+"锅\0"
+"锚\0"
+"锤\0"
+"锤同挑\0"
+"⚒\0"
+"键盘\0"
+"锯\0"
+"镜\0"
+"镜片\0"
+"长大\0"
+"长条\0"
+"🏮\0"
+"长毛象\0"
+"长牙\0"
+"长裤\0"
+"长颈鹿\0"
+"长鼓\0"
+"门\0"
+"门券\0"
+"🎫\0"
+"闩\0"
+"闩埋\0"
+"📕\0"
+"闪\0"
+"闪光\0"
+"闪嘅心\0"
+"闪电\0"
+"🌩\0"
+"闪电云\0"
+"闪耀\0"
+"闪闪\0"
+"❇\0"
+"问\0"
+"问号\0"
+"❓\0"
+"问题\0"
+"⁉\0"
+"间尺\0"
+"间谍\0"
+"闷\0"
+"闹钟\0"
+"防晒\0"
+"阳\0"
+"阴\0"
+"阴沉\0"
+"阴阳\0"
+"阶砖\0"
+"♦\0"
+"阿米巴\0"
+"陆龟\0"
+"降落\0"
+"降落伞\0"
+"除\0"
+"陶醉\0"
+"陷阱\0"
+"隐形\0"
+"隐私\0"
+"障碍物\0"
+"🚧\0"
+"雀\0"
+"雀仔\0"
+"🐦\0"
+"雌性\0"
+"雌性猪\0"
+"雕像\0"
+"雨\0"
+"雨云\0"
+"🌧\0"
+"雪\0"
+"雪云\0"
+"雪人\0"
+"☃\0"
+"雪山\0"
+"雪橇\0"
+"雪糕\0"
+"雪花\0"
+"❄\0"
+"雷电\0"
+"雷龙\0"
+"雾\0"
+"🌫\0"
+"震动\0"
+"震惊\0"
+"露营\0"
+"🏕\0"
+"青瓜\0"
+"青色\0"
+"🍏\0"
+"青苹果\0"
+"青蛙\0"
+"青蛙脸\0"
+"靓\0"
+"静\0"
+"静音\0"
+"非洲\0"
+"非饮用\0"
+"🚱\0"
+"面\0"
+"面具\0"
+"面包\0"
+"面纱\0"
+"靴\0"
+"靴子\0"
+"靶\0"
+"靶心\0"
+"鞋\0"
+"鞠躬\0"
+"音乐\0"
+"音符\0"
+"页\0"
+"顶帽\0"
+"顶部\0"
+"🔝\0"
+"项链\0"
+"顺时针\0"
+"须\0"
+"预言\0"
+"🥠\0"
+"预订\0"
+"🈯\0"
+"领取\0"
+"领呔\0"
+"颈\0"
+"颈巾\0"
+"风\0"
+"风筝\0"
+"风脸\0"
+"🌬\0"
+"风铃\0"
+"飘动\0"
+"飞\0"
+"飞机\0"
+"飞机师\0"
+"飞碟\0"
+"飞镖\0"
+"食物\0"
+"餐具\0"
+"饭\0"
+"饭团\0"
+"饮\0"
+"饮品\0"
+"饮水\0"
+"饮用\0"
+"饮管杯\0"
+"饮酒\0"
+"饵\0"
+"饺子\0"
+"饼\0"
+"馅料\0"
+"馅饼\0"
+"香烟\0"
+"香肠\0"
+"香草\0"
+"香蕉\0"
+"马\0"
+"马戏团\0"
+"马拉松\0"
+"马脸\0"
+"🐴\0"
+"马蹄铁\0"
+"马骝\0"
+"马骝脸\0"
+"🐵\0"
+"驼峰\0"
+"骄傲\0"
+"骆马\0"
+"骆驼\0"
+"骑单车\0"
+"🚵‍♀\0"
+"骑师\0"
+"骨\0"
+"骨头\0"
+"骰子\0"
+"骷髅头\0"
+"高压\0"
+"高尔夫\0"
+"高根鞋\0"
+"高飞\0"
+"髪型屋\0"
+"鬼\0"
+"魅力\0"
+"魔术\0"
+"魔法棒\0"
+"魔鬼\0"
+"鱼\0"
+"鱿鱼\0"
+"鲤鱼\0"
+"鲤鱼旗\0"
+"鲨鱼\0"
+"鲸鱼\0"
+"鳄鱼\0"
+"🐊\0"
+"鳍\0"
+"鸡\0"
+"🐔\0"
+"鸡仔\0"
+"🐤\0"
+"鸡尾酒\0"
+"鸡泡鱼\0"
+"🐡\0"
+"鸡肶\0"
+"鸢尾花\0"
+"⚜\0"
+"鸣门卷\0"
+"鸭\0"
+"鸽\0"
+"鹰\0"
+"鹰嘴豆\0"
+"鹿\0"
+"麻雀\0"
+"🀄\0"
+"黄昏\0"
+"黄色\0"
+"黄色心\0"
+"黎紧\0"
+"🚍\0"
+"黑暗\0"
+"黑猫\0"
+"黑色\0"
+"黑色心\0"
+"黑色旗\0"
+"🏴\0"
+"鼓\0"
+"鼓棍\0"
+"🥁\0"
+"鼠\0"
+"鼻\0"
+"齿轮\0"
+"龙\0"
+"龙卷风\0"
+"龙脸\0"
+"龙虾\0"
+"龙门\0"
+;
+
+/* sorted by match for prefix completion. */
 const EmojiItem english_emoji_table[] = {
-"a"       , "🅰",
-"ab"      , "🆎",
-"abacus"  , "🧮",
-"abc"     , "🔤",
-"abcd"    , "🔡",
-"access"  , "♿",
-"actor"   , "🧑‍🎤",
-"adore"   , "🥰",
-"adult"   , "🧑",
-"aerial"  , "🚡",
-"afro"    , "🦱",
-"aid"     , "⛑",
-"alarm"   , "⏰",
-"alien"   , "👽",
-"alpaca"  , "🦙",
-"amoeba"  , "🦠",
-"anchor"  , "⚓",
-"angel"   , "😇",
-"angry"   , "😡",
-"ant"     , "🐜",
-"ape"     , "🦧",
-"apple"   , "🍎",
-"archer"  , "🏹",
-"arctic"  , "🐻‍❄",
-"arepa"   , "🫓",
-"army"    , "🪖",
-"arrow"   , "💘",
-"art"     , "🎭",
-"artist"  , "🧑‍🎨",
-"ashes"   , "⚱",
-"ask"     , "🙏",
-"atm"     , "🏧",
-"atom"    , "⚛",
-"autumn"  , "🥮",
-"axe"     , "🪓",
-"b"       , "🅱",
-"baby"    , "👶",
-"back"    , "🔙",
-"bacon"   , "🥓",
-"badge"   , "📛",
-"badger"  , "🦡",
-"bag"     , "👜",
-"bagel"   , "🥯",
-"bait"    , "🪤",
-"bakery"  , "🥯",
-"bald"    , "🦲",
-"ball"    , "🏌",
-"ballet"  , "🩰",
-"ballot"  , "🗳",
-"bamboo"  , "🎍",
-"banana"  , "🍌",
-"banjo"   , "🪕",
-"bank"    , "🏦",
-"banner"  , "🎋",
-"bar"     , "🍫",
-"barber"  , "💇",
-"basket"  , "🧺",
-"bat"     , "🦇",
-"bath"    , "🛀",
-"beach"   , "🏖",
-"beacon"  , "🚨",
-"bead"    , "🧿",
-"beads"   , "📿",
-"bear"    , "🐻",
-"beard"   , "🧔",
-"bearer"  , "🐍",
-"beat"    , "🪘",
-"beauty"  , "💇",
-"beaver"  , "🦫",
-"bed"     , "🛏",
-"bee"     , "🐝",
-"beer"    , "🍺",
-"beetle"  , "🪲",
-"bell"    , "🛎",
-"bento"   , "🍱",
-"berry"   , "🫐",
-"biceps"  , "💪",
-"bike"    , "🚵",
-"biking"  , "🚴",
-"bikini"  , "👙",
-"bill"    , "💴",
-"bird"    , "🪶",
-"birdie"  , "🏸",
-"bison"   , "🦬",
-"bisque"  , "🦞",
-"black"   , "🖤",
-"bleed"   , "🩸",
-"blind"   , "🧑‍🦯",
-"blond"   , "👱",
-"blonde"  , "👱‍♀",
-"blow"    , "🍃",
-"blue"    , "🫐",
-"blush"   , "😊",
-"boar"    , "🐗",
-"board"   , "🛹",
-"boat"    , "🚣",
-"body"    , "👂",
-"bolt"    , "🔩",
-"bomb"    , "💣",
-"bone"    , "🦴",
-"book"    , "📔",
-"books"   , "📚",
-"boom"    , "💥",
-"boot"    , "🥾",
-"bored"   , "🥱",
-"boring"  , "🪴",
-"bottle"  , "🍼",
-"bow"     , "🙇",
-"bowing"  , "🙇‍♂",
-"bowl"    , "🍜",
-"box"     , "🍱",
-"boxing"  , "🥊",
-"boy"     , "👦",
-"brain"   , "🧠",
-"bread"   , "🍞",
-"break"   , "💔",
-"breast"  , "🤱",
-"breath"  , "🫁",
-"brick"   , "🧱",
-"bricks"  , "🧱",
-"bride"   , "👰",
-"bridge"  , "🌉",
-"briefs"  , "🩲",
-"bright"  , "😎",
-"broken"  , "💔",
-"bronze"  , "🥉",
-"broom"   , "🧹",
-"brown"   , "🤎",
-"brush"   , "🪥",
-"bubble"  , "🧋",
-"bucket"  , "🪣",
-"bug"     , "🪲",
-"bulb"    , "💡",
-"bull"    , "🐂",
-"bullet"  , "🚅",
-"bunny"   , "🐰",
-"burger"  , "🍔",
-"bus"     , "🚌",
-"bust"    , "👤",
-"butter"  , "🧈",
-"button"  , "🔼",
-"c"       , "©",
-"cable"   , "🚠",
-"cactus"  , "🌵",
-"cake"    , "🍥",
-"call"    , "🤙",
-"camel"   , "🐪",
-"camera"  , "🤳",
-"can"     , "🥫",
-"cancel"  , "✖",
-"candle"  , "🕯",
-"candy"   , "🍬",
-"canoe"   , "🛶",
-"cap"     , "👲",
-"car"     , "🚃",
-"card"    , "♠",
-"care"    , "💅",
-"carp"    , "🎏",
-"carrot"  , "🥕",
-"cart"    , "🛒",
-"cask"    , "🪣",
-"castle"  , "🏯",
-"cat"     , "😺",
-"catch"   , "🪝",
-"cd"      , "💿",
-"cell"    , "📱",
-"cereal"  , "🥣",
-"chain"   , "⛓",
-"chains"  , "⛓",
-"chair"   , "💺",
-"chapel"  , "💒",
-"charm"   , "🧿",
-"chart"   , "💹",
-"check"   , "✅",
-"cheese"  , "🫕",
-"chef"    , "🧑‍🍳",
-"cherry"  , "🌸",
-"chess"   , "♟",
-"chest"   , "🧰",
-"chick"   , "🐣",
-"child"   , "🧒",
-"chime"   , "🎐",
-"chop"    , "🥩",
-"church"  , "⛪",
-"cinema"  , "🎥",
-"circle"  , "⏺",
-"circus"  , "🎪",
-"citrus"  , "🍋",
-"city"    , "🏙",
-"cl"      , "🆑",
-"claim"   , "🛄",
-"clamp"   , "🗜",
-"clap"    , "👏",
-"claus"   , "🎅",
-"claws"   , "🦞",
-"clay"    , "🧱",
-"clean"   , "🪥",
-"climb"   , "🪜",
-"clink"   , "🍻",
-"clock"   , "⌚",
-"closed"  , "😚",
-"closet"  , "🚾",
-"cloud"   , "☁",
-"clover"  , "🍀",
-"clown"   , "🤡",
-"clue"    , "🧩",
-"coat"    , "🧥",
-"coder"   , "🧑‍💻",
-"coffee"  , "☕",
-"coffin"  , "⚰",
-"cog"     , "⚙",
-"coin"    , "🪙",
-"cold"    , "😅",
-"comet"   , "☄",
-"comic"   , "💢",
-"conga"   , "🪘",
-"congee"  , "🥣",
-"cook"    , "🧑‍🍳",
-"cooked"  , "🍚",
-"cookie"  , "🍪",
-"cool"    , "😎",
-"cop"     , "👮",
-"cork"    , "🍾",
-"corn"    , "🌽",
-"couch"   , "🛋",
-"couple"  , "🧑‍🤝‍🧑",
-"cover"   , "📔",
-"cow"     , "🐮",
-"cowboy"  , "🤠",
-"crab"    , "🦀",
-"crayon"  , "🖍",
-"cream"   , "🍦",
-"credit"  , "💳",
-"crook"   , "🪝",
-"cross"   , "🤞",
-"crown"   , "👑",
-"crush"   , "🥰",
-"cry"     , "😢",
-"cup"     , "🍵",
-"cupid"   , "💘",
-"curl"    , "📃",
-"curly"   , "🦱",
-"curry"   , "🍛",
-"curve"   , "🪝",
-"cygnet"  , "🦢",
-"dagger"  , "🗡",
-"dairy"   , "🧈",
-"dam"     , "🦫",
-"dance"   , "🕺",
-"dancer"  , "👯",
-"danger"  , "⚡",
-"dango"   , "🍡",
-"dark"    , "🌑",
-"dart"    , "🎯",
-"dash"    , "💨",
-"date"    , "📅",
-"dazed"   , "😳",
-"deaf"    , "🧏",
-"death"   , "💀",
-"deer"    , "🦌",
-"demon"   , "👿",
-"dental"  , "🪥",
-"desert"  , "🏜",
-"devil"   , "👿",
-"dharma"  , "☸",
-"dialog"  , "💬",
-"diaper"  , "🧷",
-"dice"    , "🎲",
-"die"     , "🎲",
-"diesel"  , "⛽",
-"dim"     , "🔅",
-"dish"    , "📡",
-"disk"    , "💽",
-"divide"  , "➗",
-"diving"  , "🦪",
-"diya"    , "🪔",
-"dizzy"   , "🥴",
-"djinn"   , "🧞",
-"dna"     , "🧬",
-"doctor"  , "😷",
-"dodo"    , "🦤",
-"dog"     , "🐶",
-"doll"    , "🪆",
-"dollar"  , "💰",
-"donut"   , "🍩",
-"door"    , "🚪",
-"double"  , "⏩",
-"doubt"   , "🤷",
-"dove"    , "🕊",
-"down"    , "👇",
-"dragon"  , "🐲",
-"dress"   , "👗",
-"drink"   , "🫖",
-"drop"    , "☔",
-"drum"    , "🪘",
-"duck"    , "🦆",
-"dung"    , "💩",
-"dupe"    , "♟",
-"dusk"    , "🌆",
-"dvd"     , "📀",
-"eagle"   , "🦅",
-"ear"     , "👂",
-"earbud"  , "🎧",
-"earth"   , "🌍",
-"east"    , "➡",
-"egg"     , "🥚",
-"eight"   , "🕗",
-"eject"   , "⏏",
-"eleven"  , "🕚",
-"elf"     , "🧝",
-"email"   , "✉",
-"emblem"  , "🔱",
-"end"     , "🔚",
-"engine"  , "🚂",
-"entry"   , "⛔",
-"euro"    , "💶",
-"evil"    , "🙈",
-"ewe"     , "🐑",
-"eye"     , "😄",
-"eyes"    , "🤩",
-"face"    , "🥸",
-"fairy"   , "🧚",
-"family"  , "👪",
-"farmer"  , "🧑‍🌾",
-"fast"    , "⏩",
-"father"  , "🎅",
-"favor"   , "🙇‍♂",
-"fax"     , "📠",
-"fear"    , "😨",
-"feet"    , "🐾",
-"female"  , "🐑",
-"fencer"  , "🤺",
-"ferris"  , "🎡",
-"ferry"   , "⛴",
-"fever"   , "🦟",
-"field"   , "🏑",
-"file"    , "📁",
-"filing"  , "🗄",
-"film"    , "🎞",
-"finger"  , "🖐",
-"fire"    , "🚒",
-"first"   , "🥇",
-"fish"    , "🐟",
-"fist"    , "✊",
-"five"    , "🕔",
-"flag"    , "🏳‍⚧",
-"flame"   , "🔥",
-"flash"   , "📸",
-"flex"    , "💪",
-"flight"  , "🪶",
-"floor"   , "🤣",
-"floppy"  , "💾",
-"flower"  , "💐",
-"fly"     , "🪰",
-"fog"     , "🌁",
-"foggy"   , "🌁",
-"folder"  , "📁",
-"fondue"  , "🫕",
-"food"    , "🫒",
-"foot"    , "🦶",
-"fork"    , "🍽",
-"four"    , "🍀",
-"fox"     , "🦊",
-"frame"   , "🪟",
-"frames"  , "🎞",
-"free"    , "🆓",
-"french"  , "🥐",
-"fried"   , "🍤",
-"fries"   , "🍟",
-"frog"    , "🐸",
-"frown"   , "🙁",
-"fruit"   , "🍇",
-"frying"  , "🍳",
-"fuel"    , "⛽",
-"fuji"    , "🗻",
-"full"    , "💯",
-"game"    , "🏐",
-"garden"  , "🏡",
-"garlic"  , "🧄",
-"gas"     , "⛽",
-"gear"    , "⚙",
-"geek"    , "🤓",
-"gem"     , "💎",
-"gene"    , "🧬",
-"genie"   , "🧞",
-"ghost"   , "👻",
-"gift"    , "🧧",
-"ginger"  , "🦰",
-"girl"    , "👧",
-"glass"   , "🥛",
-"globe"   , "🌍",
-"glove"   , "🥎",
-"gloves"  , "🧤",
-"glow"    , "🌟",
-"goal"    , "🥍",
-"goat"    , "🐐",
-"goblin"  , "👺",
-"gold"    , "🪙",
-"golf"    , "🏌",
-"good"    , "🦸",
-"goofy"   , "🤪",
-"grain"   , "🌾",
-"grape"   , "🍇",
-"grapes"  , "🍇",
-"graph"   , "💹",
-"grave"   , "🪦",
-"gray"    , "🦳",
-"green"   , "💚",
-"grin"    , "😀",
-"groom"   , "🤵",
-"grow"    , "🪴",
-"growth"  , "💹",
-"guard"   , "💂",
-"guide"   , "🦮",
-"guitar"  , "🎸",
-"gun"     , "🔫",
-"gyro"    , "🥙",
-"hair"    , "👱",
-"halo"    , "😇",
-"hammer"  , "🔨",
-"hand"    , "👋",
-"happy"   , "🙋",
-"hashi"   , "🥢",
-"hat"     , "🤠",
-"head"    , "🗣",
-"hear"    , "🙉",
-"heart"   , "🫀",
-"hearts"  , "🥰",
-"heavy"   , "🪨",
-"heel"    , "👠",
-"hello"   , "🫂",
-"helmet"  , "🪖",
-"help"    , "💁",
-"herb"    , "🌿",
-"herd"    , "🦬",
-"hero"    , "🦸",
-"hidden"  , "🥷",
-"hijab"   , "🧕",
-"hike"    , "🚶",
-"hiking"  , "🥾",
-"hindu"   , "🛕",
-"hippo"   , "🦛",
-"hit"     , "🎯",
-"hocho"   , "🔪",
-"hockey"  , "🏑",
-"hoist"   , "🛗",
-"hold"    , "🧑‍🤝‍🧑",
-"hole"    , "🕳",
-"home"    , "🏠",
-"honey"   , "🍯",
-"hook"    , "🪝",
-"hoop"    , "🏀",
-"hooray"  , "🙌",
-"horn"    , "🥳",
-"horns"   , "😈",
-"horse"   , "🏇",
-"hot"     , "🥵",
-"hotdog"  , "🌭",
-"hotel"   , "🛌",
-"house"   , "🪴",
-"houses"  , "🏘",
-"hug"     , "🫂",
-"hump"    , "🐪",
-"hurt"    , "🤕",
-"hushed"  , "😯",
-"hut"     , "🛖",
-"i"       , "ℹ",
-"ice"     , "🍦",
-"id"      , "🆔",
-"idea"    , "💡",
-"ill"     , "🤒",
-"imp"     , "👿",
-"inbox"   , "📥",
-"index"   , "👈",
-"injury"  , "🤕",
-"ink"     , "🔏",
-"input"   , "🔠",
-"insect"  , "🪲",
-"inside"  , "💠",
-"iron"    , "🧇",
-"ironic"  , "😼",
-"islam"   , "🕌",
-"island"  , "🏝",
-"jack"    , "🎃",
-"jacket"  , "🧥",
-"jeans"   , "👖",
-"jewel"   , "💎",
-"jiaozi"  , "🥟",
-"jigsaw"  , "🧩",
-"jockey"  , "🏇",
-"joey"    , "🦘",
-"joke"    , "😜",
-"joker"   , "🃏",
-"joy"     , "😂",
-"judge"   , "🧑‍⚖",
-"judo"    , "🥋",
-"jug"     , "🏺",
-"juggle"  , "🤹",
-"juice"   , "🥤",
-"jump"    , "🦘",
-"kaaba"   , "🕋",
-"kale"    , "🥬",
-"karate"  , "🥋",
-"kebab"   , "🥙",
-"key"     , "🔐",
-"kick"    , "🦵",
-"kimono"  , "👘",
-"king"    , "👑",
-"kiss"    , "😘",
-"kite"    , "🪁",
-"kiwi"    , "🥝",
-"kneel"   , "🧎",
-"knife"   , "🍽",
-"knit"    , "🧶",
-"knobs"   , "🎛",
-"knot"    , "🪢",
-"koala"   , "🐨",
-"lab"     , "🧪",
-"label"   , "🏷",
-"ladder"  , "🪜",
-"lamp"    , "🪔",
-"laptop"  , "💻",
-"large"   , "🦣",
-"lather"  , "🧼",
-"latin"   , "🔠",
-"laugh"   , "😆",
-"lavash"  , "🫓",
-"lazy"    , "🦥",
-"leaf"    , "🌿",
-"ledger"  , "📒",
-"left"    , "◀",
-"leg"     , "🦵",
-"lemon"   , "🍋",
-"letter"  , "💌",
-"level"   , "🎚",
-"lie"     , "🤥",
-"life"    , "🧬",
-"lift"    , "🛗",
-"lifter"  , "🏋",
-"light"   , "🪶",
-"limb"    , "🦵",
-"link"    , "🖇",
-"lion"    , "🦁",
-"lips"    , "💋",
-"liquor"  , "🥃",
-"litter"  , "🚮",
-"lizard"  , "🦎",
-"llama"   , "🦙",
-"loaf"    , "🍞",
-"lock"    , "🔓",
-"locked"  , "🔒",
-"locker"  , "🛅",
-"log"     , "🪵",
-"loop"    , "➰",
-"lorry"   , "🚛",
-"lotion"  , "🧴",
-"loud"    , "🔊",
-"love"    , "😍",
-"low"     , "🔅",
-"luck"    , "🤞",
-"lumber"  , "🪚",
-"lungs"   , "🫁",
-"m"       , "Ⓜ",
-"mad"     , "😡",
-"mage"    , "🧙",
-"maggot"  , "🪰",
-"magic"   , "🪄",
-"magnet"  , "🧲",
-"mail"    , "💌",
-"maize"   , "🌽",
-"makeup"  , "💄",
-"male"    , "🐏",
-"man"     , "👨",
-"mango"   , "🥭",
-"map"     , "🗺",
-"maple"   , "🍁",
-"mark"    , "❣",
-"marker"  , "📑",
-"mask"    , "😷",
-"mate"    , "🧉",
-"math"    , "➕",
-"maze"    , "🌽",
-"meat"    , "🍖",
-"medal"   , "🎖",
-"medium"  , "🔉",
-"meh"     , "😐",
-"melon"   , "🍈",
-"melted"  , "🫕",
-"memo"    , "📝",
-"men"     , "👯‍♂",
-"mercy"   , "🥺",
-"merman"  , "🧜",
-"metal"   , "🪙",
-"metro"   , "🚇",
-"mic"     , "🎙",
-"milk"    , "🧋",
-"mining"  , "⛏",
-"minus"   , "➖",
-"mirror"  , "🪞",
-"moai"    , "🗿",
-"mobile"  , "📱",
-"mode"    , "📳",
-"molusc"  , "🦑",
-"money"   , "🪙",
-"monkey"  , "🙈",
-"moon"    , "🌑",
-"mortar"  , "🧱",
-"mosque"  , "🕌",
-"mother"  , "🤶",
-"motor"   , "🛵",
-"mouse"   , "🐭",
-"mouth"   , "😃",
-"movie"   , "🎥",
-"moyai"   , "🗿",
-"mug"     , "🍺",
-"munch"   , "😱",
-"muscle"  , "💪",
-"museum"  , "🖼",
-"music"   , "🎼",
-"mute"    , "🔇",
-"naan"    , "🫓",
-"nail"    , "💅",
-"name"    , "📛",
-"nazar"   , "🧿",
-"neck"    , "🧣",
-"needle"  , "🪡",
-"nerd"    , "🤓",
-"net"     , "🥅",
-"new"     , "🆕",
-"news"    , "📰",
-"ng"      , "🆖",
-"nib"     , "✒",
-"night"   , "🌃",
-"nine"    , "🕘",
-"ninja"   , "🥷",
-"no"      , "⛔",
-"noodle"  , "🍜",
-"north"   , "⬆",
-"nose"    , "🥸",
-"not"     , "⛔",
-"note"    , "🎵",
-"notes"   , "🎶",
-"nurse"   , "🧑‍⚕",
-"nut"     , "🥜",
-"o"       , "⭕",
-"ocean"   , "🌊",
-"oden"    , "🍢",
-"off"     , "📴",
-"ogre"    , "👹",
-"oh"      , "🙀",
-"oil"     , "🛢",
-"old"     , "🧓",
-"olive"   , "🫒",
-"om"      , "🕉",
-"on"      , "🔛",
-"once"    , "🔂",
-"one"     , "🕐",
-"onion"   , "🧅",
-"open"    , "😃",
-"orange"  , "🧡",
-"organ"   , "🫀",
-"otter"   , "🦦",
-"outbox"  , "📤",
-"owl"     , "🦉",
-"ox"      , "🐂",
-"oyster"  , "🦪",
-"pad"     , "🗒",
-"paddle"  , "🏓",
-"paella"  , "🥘",
-"page"    , "📃",
-"pager"   , "📟",
-"pail"    , "🪣",
-"palm"    , "🤦",
-"pan"     , "🍳",
-"panda"   , "🐼",
-"pants"   , "👖",
-"paper"   , "📜",
-"parcel"  , "📦",
-"park"    , "🏞",
-"parlor"  , "💇",
-"parrot"  , "🦜",
-"part"    , "〽",
-"party"   , "🪅",
-"pasta"   , "🍝",
-"pastry"  , "🍥",
-"patrol"  , "🚓",
-"pause"   , "⏯",
-"paw"     , "🐾",
-"pc"      , "💻",
-"peace"   , "🕊",
-"peach"   , "🍑",
-"peahen"  , "🦚",
-"peanut"  , "🥜",
-"pear"    , "🍐",
-"pearl"   , "🧋",
-"pen"     , "✒",
-"pencil"  , "✏",
-"pepper"  , "🫑",
-"person"  , "🧑",
-"pest"    , "🪰",
-"pester"  , "🦡",
-"pet"     , "🐶",
-"phone"   , "🤳",
-"piano"   , "🎹",
-"pick"    , "⛏",
-"picket"  , "🪧",
-"pickle"  , "🥒",
-"pickup"  , "🛻",
-"picnic"  , "🧺",
-"pie"     , "🥧",
-"piece"   , "🧩",
-"pig"     , "🐷",
-"pill"    , "💊",
-"pilot"   , "🧑‍✈",
-"pin"     , "📌",
-"pine"    , "🎍",
-"pink"    , "🏳‍⚧",
-"pirate"  , "🦜",
-"pistol"  , "🔫",
-"pita"    , "🫓",
-"pizza"   , "🍕",
-"plane"   , "🧑‍✈",
-"plant"   , "🪴",
-"plate"   , "🍽",
-"play"    , "▶",
-"please"  , "🙏",
-"plug"    , "🔌",
-"plus"    , "➕",
-"plush"   , "🧸",
-"point"   , "👈",
-"pole"    , "💈",
-"police"  , "👮",
-"polish"  , "💅",
-"polo"    , "🤽",
-"poo"     , "💩",
-"poodle"  , "🐩",
-"poop"    , "💩",
-"popper"  , "🎉",
-"porous"  , "🧽",
-"post"    , "🏣",
-"postal"  , "📯",
-"pot"     , "🫕",
-"potato"  , "🥔",
-"pouch"   , "👝",
-"pound"   , "💷",
-"prawn"   , "🍤",
-"pray"    , "🙏",
-"prayer"  , "🤲",
-"pretty"  , "🦋",
-"pride"   , "🏳‍🌈",
-"prince"  , "🤴",
-"print"   , "👣",
-"prize"   , "🏆",
-"proof"   , "🧾",
-"proud"   , "🥲",
-"puck"    , "🏒",
-"pulse"   , "🫀",
-"pump"    , "⛽",
-"punch"   , "✊",
-"purple"  , "💜",
-"purse"   , "👛",
-"puzzle"  , "🧩",
-"queen"   , "👑",
-"quench"  , "🧯",
-"quiet"   , "🤫",
-"r"       , "®",
-"rabbit"  , "🐰",
-"racing"  , "🏃‍♂",
-"radio"   , "📻",
-"rage"    , "😡",
-"rain"    , "⛈",
-"raised"  , "🤚",
-"ram"     , "🐏",
-"ramen"   , "🍜",
-"rat"     , "🐀",
-"rays"    , "☀",
-"razor"   , "🪒",
-"record"  , "⏺",
-"red"     , "😡",
-"reload"  , "🔃",
-"repeat"  , "🔁",
-"resort"  , "⛵",
-"rewind"  , "⏪",
-"rhythm"  , "🪘",
-"ribbon"  , "💝",
-"rice"    , "🌾",
-"right"   , "▶",
-"ring"    , "💍",
-"roach"   , "🪳",
-"road"    , "🛣",
-"robot"   , "🤖",
-"rock"    , "🪨",
-"rocket"  , "🧑‍🚀",
-"roll"    , "🥐",
-"rolled"  , "🗞",
-"roller"  , "🛼",
-"rope"    , "🪢",
-"rose"    , "🌹",
-"rugby"   , "🏉",
-"ruler"   , "📏",
-"rung"    , "🪜",
-"rushed"  , "😰",
-"russia"  , "🪆",
-"sad"     , "😢",
-"safety"  , "🦺",
-"sake"    , "🍶",
-"salad"   , "🥗",
-"salon"   , "💆",
-"salt"    , "🧂",
-"sand"    , "⌛",
-"sandal"  , "👡",
-"santa"   , "🎅",
-"sari"    , "🥻",
-"sash"    , "🎽",
-"sassy"   , "💁",
-"saturn"  , "🪐",
-"sauna"   , "🧖",
-"saw"     , "🪚",
-"sax"     , "🎷",
-"scale"   , "⚖",
-"scales"  , "🧑‍⚖",
-"scared"  , "😨",
-"scarf"   , "🧣",
-"school"  , "🏫",
-"score"   , "💯",
-"scream"  , "😱",
-"screw"   , "🪛",
-"scroll"  , "📜",
-"scuba"   , "🤿",
-"sea"     , "⛵",
-"seal"    , "🦭",
-"search"  , "🔍",
-"seat"    , "💺",
-"second"  , "🥈",
-"secure"  , "🔐",
-"see"     , "🙈",
-"selfie"  , "🤳",
-"semi"    , "🚛",
-"sent"    , "📤",
-"set"     , "📐",
-"seven"   , "🕖",
-"sewing"  , "🪡",
-"shake"   , "🤝",
-"shaker"  , "🧂",
-"shark"   , "🦈",
-"sharp"   , "🪒",
-"shave"   , "🪒",
-"shaved"  , "🍧",
-"shaven"  , "🦲",
-"sheep"   , "🐏",
-"shell"   , "🐚",
-"shield"  , "🛡",
-"shinto"  , "⛩",
-"ship"    , "⚓",
-"shirt"   , "🎽",
-"shoe"    , "👞",
-"shorts"  , "🩳",
-"shot"    , "🥃",
-"shower"  , "🚿",
-"shrimp"  , "🍤",
-"shrine"  , "⛩",
-"shrug"   , "🤷",
-"shush"   , "🤫",
-"sick"    , "😷",
-"sign"    , "🪧",
-"signal"  , "🚥",
-"silent"  , "😶",
-"silver"  , "🪙",
-"singer"  , "🧑‍🎤",
-"sit"     , "🪑",
-"six"     , "🕕",
-"skate"   , "🛼",
-"skewer"  , "🍢",
-"ski"     , "⛷",
-"skier"   , "⛷",
-"skill"   , "🤹",
-"skis"    , "🎿",
-"skull"   , "💀",
-"skunk"   , "🦨",
-"sled"    , "🛷",
-"sledge"  , "🛷",
-"sleep"   , "😪",
-"sleigh"  , "🛷",
-"sleuth"  , "🕵",
-"slice"   , "🍕",
-"slider"  , "🎚",
-"slot"    , "🎰",
-"sloth"   , "🦥",
-"slow"    , "🦥",
-"sly"     , "🦝",
-"small"   , "🤪",
-"smile"   , "😃",
-"smirk"   , "😏",
-"snail"   , "🐌",
-"snake"   , "🐍",
-"snare"   , "🪤",
-"sneeze"  , "🤧",
-"snow"    , "⛷",
-"soap"    , "🧼",
-"soar"    , "🪁",
-"sob"     , "😭",
-"soccer"  , "⚽",
-"socks"   , "🧦",
-"soda"    , "🥤",
-"soft"    , "🍦",
-"solid"   , "🪨",
-"soon"    , "🔜",
-"sorry"   , "🙇",
-"sos"     , "🆘",
-"south"   , "⬇",
-"sow"     , "🐖",
-"space"   , "🛰",
-"speak"   , "🙊",
-"speech"  , "💬",
-"speed"   , "🚄",
-"spider"  , "🕷",
-"spiny"   , "🦔",
-"spiral"  , "🐚",
-"split"   , "🪓",
-"spock"   , "🖖",
-"sponge"  , "🧽",
-"spool"   , "🧵",
-"spoon"   , "🥄",
-"spots"   , "🦒",
-"spy"     , "🕵",
-"square"  , "⏹",
-"squid"   , "🦑",
-"staff"   , "⚕",
-"stand"   , "🧍",
-"star"    , "🤩",
-"statue"  , "🗽",
-"steak"   , "🥩",
-"steam"   , "🚂",
-"step"    , "🪜",
-"stew"    , "🍲",
-"stick"   , "🍢",
-"stink"   , "🦨",
-"stomp"   , "🦶",
-"stone"   , "🪨",
-"stop"    , "🚏",
-"store"   , "🏪",
-"straw"   , "🧃",
-"string"  , "🧵",
-"stripe"  , "🦓",
-"studio"  , "🎙",
-"stuffy"  , "🧐",
-"subway"  , "🚇",
-"suit"    , "🕴",
-"sun"     , "😎",
-"sunny"   , "☀",
-"sunset"  , "🌆",
-"sushi"   , "🍣",
-"swan"    , "🦢",
-"sweat"   , "😅",
-"sweet"   , "🍠",
-"swim"    , "🏊",
-"swirl"   , "🍥",
-"sword"   , "🤺",
-"swords"  , "⚔",
-"tabs"    , "📑",
-"taco"    , "🌮",
-"tada"    , "🎉",
-"talk"    , "🦜",
-"tamale"  , "🫔",
-"tao"     , "☯",
-"taoist"  , "☯",
-"tape"    , "📼",
-"target"  , "🎯",
-"taste"   , "😝",
-"taxi"    , "🚕",
-"tea"     , "🧋",
-"teacup"  , "🍵",
-"teapot"  , "🫖",
-"tear"    , "🥲",
-"teeth"   , "🪥",
-"teller"  , "🏧",
-"temple"  , "🛕",
-"ten"     , "🕙",
-"tennis"  , "🎾",
-"tent"    , "⛺",
-"thanks"  , "🫂",
-"third"   , "🥉",
-"thirty"  , "🕧",
-"thongs"  , "🩴",
-"thread"  , "🧵",
-"three"   , "🕒",
-"thumb"   , "👍",
-"tichel"  , "🧕",
-"ticket"  , "🎟",
-"tie"     , "🪢",
-"tiger"   , "🐯",
-"timber"  , "🪵",
-"timer"   , "⌛",
-"tipsy"   , "🥴",
-"tired"   , "😩",
-"tm"      , "™",
-"toilet"  , "🪠",
-"tomato"  , "🍅",
-"tongue"  , "😛",
-"tool"    , "🪚",
-"tooth"   , "🦷",
-"top"     , "🎩",
-"tophat"  , "🎩",
-"torch"   , "🔦",
-"tower"   , "🗼",
-"toy"     , "🪀",
-"train"   , "🚂",
-"tram"    , "🚃",
-"trap"    , "🪤",
-"travel"  , "🧳",
-"tray"    , "📤",
-"tree"    , "🌲",
-"trend"   , "📈",
-"trophy"  , "🏆",
-"truck"   , "🛻",
-"tshirt"  , "👕",
-"tulip"   , "🌷",
-"turban"  , "👳",
-"turkey"  , "🦃",
-"turtle"  , "🐢",
-"tusk"    , "🦣",
-"tuxedo"  , "🤵",
-"tv"      , "📺",
-"twelve"  , "🕛",
-"twine"   , "🪢",
-"twins"   , "👬",
-"twist"   , "🪢",
-"two"     , "🕑",
-"ufo"     , "👽",
-"undead"  , "🧛",
-"unlock"  , "🔓",
-"up"      , "👆",
-"upward"  , "📈",
-"urn"     , "⚱",
-"v"       , "✌",
-"vat"     , "🪣",
-"veil"    , "👰",
-"versus"  , "🆚",
-"vest"    , "🦺",
-"vhs"     , "📼",
-"vice"    , "🗜",
-"video"   , "📻",
-"view"    , "🪟",
-"violin"  , "🎻",
-"virus"   , "🦟",
-"vomit"   , "🤢",
-"vs"      , "🆚",
-"vulcan"  , "🖖",
-"waffle"  , "🧇",
-"walk"    , "🚶",
-"wall"    , "🧱",
-"waning"  , "🌖",
-"watch"   , "⌚",
-"water"   , "🤽",
-"wave"    , "👋",
-"waving"  , "👋",
-"wavy"    , "〰",
-"waxing"  , "🌒",
-"wc"      , "🚹",
-"weapon"  , "🔪",
-"weary"   , "😩",
-"web"     , "🕸",
-"weight"  , "🏋",
-"west"    , "⬅",
-"whale"   , "🐳",
-"wheel"   , "🎡",
-"whew"    , "😥",
-"whisky"  , "🥃",
-"white"   , "🤍",
-"whoops"  , "🤭",
-"wicked"  , "🖤",
-"wilted"  , "🥀",
-"wind"    , "🍃",
-"window"  , "🪟",
-"wine"    , "🍷",
-"wings"   , "💸",
-"wink"    , "😉",
-"wise"    , "🦉",
-"wisent"  , "🦬",
-"witch"   , "🪄",
-"wizard"  , "🪄",
-"wolf"    , "🐺",
-"woman"   , "👩",
-"women"   , "👯‍♀",
-"won"     , "😤",
-"wood"    , "🪵",
-"wool"    , "🦙",
-"woolly"  , "🦣",
-"worker"  , "🧑‍🏭",
-"world"   , "🌍",
-"worm"    , "🪱",
-"wrap"    , "🌯",
-"wrench"  , "🛠",
-"write"   , "✍",
-"wry"     , "😼",
-"x"       , "✖",
-"yacht"   , "⛵",
-"yang"    , "☯",
-"yarn"    , "🧶",
-"yawn"    , "🥱",
-"yellow"  , "💛",
-"yen"     , "💴",
-"yin"     , "☯",
-"yoga"    , "🧘",
-"young"   , "👶",
-"yum"     , "😋",
-"yurt"    , "🛖",
-"zap"     , "⚡",
-"zebra"   , "🦓",
-"zipper"  , "🤐",
-"zodiac"  , "👧",
-"zombie"  , "🧟",
-"zzz"     , "😴"
+{      0,      2 },   /* a */
+{      7,     10 },   /* ab */
+{     15,     22 },   /* abacus */
+{     27,     31 },   /* abc */
+{     36,     41 },   /* abcd */
+{     46,     53 },   /* access */
+{     57,     63 },   /* actor */
+{     75,     81 },   /* adore */
+{     86,     92 },   /* adult */
+{     97,    104 },   /* aerial */
+{    109,    114 },   /* afro */
+{    119,    123 },   /* aid */
+{    127,    133 },   /* alarm */
+{    137,    143 },   /* alien */
+{    148,    155 },   /* alpaca */
+{    160,    167 },   /* amoeba */
+{    172,    179 },   /* anchor */
+{    183,    189 },   /* angel */
+{    194,    200 },   /* angry */
+{    205,    209 },   /* ant */
+{    214,    218 },   /* ape */
+{    223,    229 },   /* apple */
+{    234,    241 },   /* archer */
+{    246,    253 },   /* arctic */
+{    264,    270 },   /* arepa */
+{    275,    280 },   /* army */
+{    285,    291 },   /* arrow */
+{    296,    300 },   /* art */
+{    305,    312 },   /* artist */
+{    324,    330 },   /* ashes */
+{    334,    338 },   /* ask */
+{    343,    347 },   /* atm */
+{    352,    357 },   /* atom */
+{    361,    368 },   /* autumn */
+{    373,    377 },   /* axe */
+{    382,    384 },   /* b */
+{    389,    394 },   /* baby */
+{    399,    404 },   /* back */
+{    409,    415 },   /* bacon */
+{    420,    426 },   /* badge */
+{    431,    438 },   /* badger */
+{    443,    447 },   /* bag */
+{    452,    458 },   /* bagel */
+{    463,    468 },   /* bait */
+{    473,    458 },   /* bakery */
+{    480,    485 },   /* bald */
+{    490,    495 },   /* ball */
+{    500,    507 },   /* ballet */
+{    512,    519 },   /* ballot */
+{    524,    531 },   /* bamboo */
+{    536,    543 },   /* banana */
+{    548,    554 },   /* banjo */
+{    559,    564 },   /* bank */
+{    569,    576 },   /* banner */
+{    581,    585 },   /* bar */
+{    590,    597 },   /* barber */
+{    602,    609 },   /* basket */
+{    614,    618 },   /* bat */
+{    623,    628 },   /* bath */
+{    633,    639 },   /* beach */
+{    644,    651 },   /* beacon */
+{    656,    661 },   /* bead */
+{    666,    672 },   /* beads */
+{    677,    682 },   /* bear */
+{    687,    693 },   /* beard */
+{    698,    705 },   /* bearer */
+{    710,    715 },   /* beat */
+{    720,    597 },   /* beauty */
+{    727,    734 },   /* beaver */
+{    739,    743 },   /* bed */
+{    748,    752 },   /* bee */
+{    757,    762 },   /* beer */
+{    767,    774 },   /* beetle */
+{    779,    784 },   /* bell */
+{    789,    795 },   /* bento */
+{    800,    806 },   /* berry */
+{    811,    818 },   /* biceps */
+{    823,    828 },   /* bike */
+{    833,    840 },   /* biking */
+{    845,    852 },   /* bikini */
+{    857,    862 },   /* bill */
+{    867,    872 },   /* bird */
+{    877,    884 },   /* birdie */
+{    889,    895 },   /* bison */
+{    900,    907 },   /* bisque */
+{    912,    918 },   /* black */
+{    923,    929 },   /* bleed */
+{    934,    940 },   /* blind */
+{    952,    958 },   /* blond */
+{    963,    970 },   /* blonde */
+{    981,    986 },   /* blow */
+{    991,    806 },   /* blue */
+{    996,   1002 },   /* blush */
+{   1007,   1012 },   /* boar */
+{   1017,   1023 },   /* board */
+{   1028,   1033 },   /* boat */
+{   1038,   1043 },   /* body */
+{   1048,   1053 },   /* bolt */
+{   1058,   1063 },   /* bomb */
+{   1068,   1073 },   /* bone */
+{   1078,   1083 },   /* book */
+{   1088,   1094 },   /* books */
+{   1099,   1104 },   /* boom */
+{   1109,   1114 },   /* boot */
+{   1119,   1125 },   /* bored */
+{   1130,   1137 },   /* boring */
+{   1142,   1149 },   /* bottle */
+{   1154,   1158 },   /* bow */
+{   1163,   1170 },   /* bowing */
+{   1181,   1186 },   /* bowl */
+{   1191,    795 },   /* box */
+{   1195,   1202 },   /* boxing */
+{   1207,   1211 },   /* boy */
+{   1216,   1222 },   /* brain */
+{   1227,   1233 },   /* bread */
+{   1238,   1244 },   /* break */
+{   1249,   1256 },   /* breast */
+{   1261,   1268 },   /* breath */
+{   1273,   1279 },   /* brick */
+{   1284,   1279 },   /* bricks */
+{   1291,   1297 },   /* bride */
+{   1302,   1309 },   /* bridge */
+{   1314,   1321 },   /* briefs */
+{   1326,   1333 },   /* bright */
+{   1338,   1244 },   /* broken */
+{   1345,   1352 },   /* bronze */
+{   1357,   1363 },   /* broom */
+{   1368,   1374 },   /* brown */
+{   1379,   1385 },   /* brush */
+{   1390,   1397 },   /* bubble */
+{   1402,   1409 },   /* bucket */
+{   1414,    774 },   /* bug */
+{   1418,   1423 },   /* bulb */
+{   1428,   1433 },   /* bull */
+{   1438,   1445 },   /* bullet */
+{   1450,   1456 },   /* bunny */
+{   1461,   1468 },   /* burger */
+{   1473,   1477 },   /* bus */
+{   1482,   1487 },   /* bust */
+{   1492,   1499 },   /* butter */
+{   1504,   1511 },   /* button */
+{   1516,   1518 },   /* c */
+{   1521,   1527 },   /* cable */
+{   1532,   1539 },   /* cactus */
+{   1544,   1549 },   /* cake */
+{   1554,   1559 },   /* call */
+{   1564,   1570 },   /* camel */
+{   1575,   1582 },   /* camera */
+{   1587,   1591 },   /* can */
+{   1596,   1603 },   /* cancel */
+{   1607,   1614 },   /* candle */
+{   1619,   1625 },   /* candy */
+{   1630,   1636 },   /* canoe */
+{   1641,   1645 },   /* cap */
+{   1650,   1654 },   /* car */
+{   1659,   1664 },   /* card */
+{   1668,   1673 },   /* care */
+{   1678,   1683 },   /* carp */
+{   1688,   1695 },   /* carrot */
+{   1700,   1705 },   /* cart */
+{   1710,   1409 },   /* cask */
+{   1715,   1722 },   /* castle */
+{   1727,   1731 },   /* cat */
+{   1736,   1742 },   /* catch */
+{   1747,   1750 },   /* cd */
+{   1755,   1760 },   /* cell */
+{   1765,   1772 },   /* cereal */
+{   1777,   1783 },   /* chain */
+{   1787,   1783 },   /* chains */
+{   1794,   1800 },   /* chair */
+{   1805,   1812 },   /* chapel */
+{   1817,    661 },   /* charm */
+{   1823,   1829 },   /* chart */
+{   1834,   1840 },   /* check */
+{   1844,   1851 },   /* cheese */
+{   1856,   1861 },   /* chef */
+{   1873,   1880 },   /* cherry */
+{   1885,   1891 },   /* chess */
+{   1895,   1901 },   /* chest */
+{   1906,   1912 },   /* chick */
+{   1917,   1923 },   /* child */
+{   1928,   1934 },   /* chime */
+{   1939,   1944 },   /* chop */
+{   1949,   1956 },   /* church */
+{   1960,   1967 },   /* cinema */
+{   1972,   1979 },   /* circle */
+{   1983,   1990 },   /* circus */
+{   1995,   2002 },   /* citrus */
+{   2007,   2012 },   /* city */
+{   2017,   2020 },   /* cl */
+{   2025,   2031 },   /* claim */
+{   2036,   2042 },   /* clamp */
+{   2047,   2052 },   /* clap */
+{   2057,   2063 },   /* claus */
+{   2068,    907 },   /* claws */
+{   2074,   1279 },   /* clay */
+{   2079,   1385 },   /* clean */
+{   2085,   2091 },   /* climb */
+{   2096,   2102 },   /* clink */
+{   2107,   2113 },   /* clock */
+{   2117,   2124 },   /* closed */
+{   2129,   2136 },   /* closet */
+{   2141,   2147 },   /* cloud */
+{   2151,   2158 },   /* clover */
+{   2163,   2169 },   /* clown */
+{   2174,   2179 },   /* clue */
+{   2184,   2189 },   /* coat */
+{   2194,   2200 },   /* coder */
+{   2212,   2219 },   /* coffee */
+{   2223,   2230 },   /* coffin */
+{   2234,   2238 },   /* cog */
+{   2242,   2247 },   /* coin */
+{   2252,   2257 },   /* cold */
+{   2262,   2268 },   /* comet */
+{   2272,   2278 },   /* comic */
+{   2283,    715 },   /* conga */
+{   2289,   1772 },   /* congee */
+{   2296,   1861 },   /* cook */
+{   2301,   2308 },   /* cooked */
+{   2313,   2320 },   /* cookie */
+{   2325,   1333 },   /* cool */
+{   2330,   2334 },   /* cop */
+{   2339,   2344 },   /* cork */
+{   2349,   2354 },   /* corn */
+{   2359,   2365 },   /* couch */
+{   2370,   2377 },   /* couple */
+{   2396,   1083 },   /* cover */
+{   2402,   2406 },   /* cow */
+{   2411,   2418 },   /* cowboy */
+{   2423,   2428 },   /* crab */
+{   2433,   2440 },   /* crayon */
+{   2445,   2451 },   /* cream */
+{   2456,   2463 },   /* credit */
+{   2468,   1742 },   /* crook */
+{   2474,   2480 },   /* cross */
+{   2485,   2491 },   /* crown */
+{   2496,     81 },   /* crush */
+{   2502,   2506 },   /* cry */
+{   2511,   2515 },   /* cup */
+{   2520,    291 },   /* cupid */
+{   2526,   2531 },   /* curl */
+{   2536,    114 },   /* curly */
+{   2542,   2548 },   /* curry */
+{   2553,   1742 },   /* curve */
+{   2559,   2566 },   /* cygnet */
+{   2571,   2578 },   /* dagger */
+{   2583,   1499 },   /* dairy */
+{   2589,    734 },   /* dam */
+{   2593,   2599 },   /* dance */
+{   2604,   2611 },   /* dancer */
+{   2616,   2623 },   /* danger */
+{   2627,   2633 },   /* dango */
+{   2638,   2643 },   /* dark */
+{   2648,   2653 },   /* dart */
+{   2658,   2663 },   /* dash */
+{   2668,   2673 },   /* date */
+{   2678,   2684 },   /* dazed */
+{   2689,   2694 },   /* deaf */
+{   2699,   2705 },   /* death */
+{   2710,   2715 },   /* deer */
+{   2720,   2726 },   /* demon */
+{   2731,   1385 },   /* dental */
+{   2738,   2745 },   /* desert */
+{   2750,   2726 },   /* devil */
+{   2756,   2763 },   /* dharma */
+{   2767,   2774 },   /* dialog */
+{   2779,   2786 },   /* diaper */
+{   2791,   2796 },   /* dice */
+{   2801,   2796 },   /* die */
+{   2805,   2812 },   /* diesel */
+{   2816,   2820 },   /* dim */
+{   2825,   2830 },   /* dish */
+{   2835,   2840 },   /* disk */
+{   2845,   2852 },   /* divide */
+{   2856,   2863 },   /* diving */
+{   2868,   2873 },   /* diya */
+{   2878,   2884 },   /* dizzy */
+{   2889,   2895 },   /* djinn */
+{   2900,   2904 },   /* dna */
+{   2909,   2916 },   /* doctor */
+{   2921,   2926 },   /* dodo */
+{   2931,   2935 },   /* dog */
+{   2940,   2945 },   /* doll */
+{   2950,   2957 },   /* dollar */
+{   2962,   2968 },   /* donut */
+{   2973,   2978 },   /* door */
+{   2983,   2990 },   /* double */
+{   2994,   3000 },   /* doubt */
+{   3005,   3010 },   /* dove */
+{   3015,   3020 },   /* down */
+{   3025,   3032 },   /* dragon */
+{   3037,   3043 },   /* dress */
+{   3048,   3054 },   /* drink */
+{   3059,   3064 },   /* drop */
+{   3068,    715 },   /* drum */
+{   3073,   3078 },   /* duck */
+{   3083,   3088 },   /* dung */
+{   3093,   1891 },   /* dupe */
+{   3098,   3103 },   /* dusk */
+{   3108,   3112 },   /* dvd */
+{   3117,   3123 },   /* eagle */
+{   3128,   1043 },   /* ear */
+{   3132,   3139 },   /* earbud */
+{   3144,   3150 },   /* earth */
+{   3155,   3160 },   /* east */
+{   3164,   3168 },   /* egg */
+{   3173,   3179 },   /* eight */
+{   3184,   3190 },   /* eject */
+{   3194,   3201 },   /* eleven */
+{   3206,   3210 },   /* elf */
+{   3215,   3221 },   /* email */
+{   3225,   3232 },   /* emblem */
+{   3237,   3241 },   /* end */
+{   3246,   3253 },   /* engine */
+{   3258,   3264 },   /* entry */
+{   3268,   3273 },   /* euro */
+{   3278,   3283 },   /* evil */
+{   3288,   3292 },   /* ewe */
+{   3297,   3301 },   /* eye */
+{   3306,   3311 },   /* eyes */
+{   3316,   3321 },   /* face */
+{   3326,   3332 },   /* fairy */
+{   3337,   3344 },   /* family */
+{   3349,   3356 },   /* farmer */
+{   3368,   2990 },   /* fast */
+{   3373,   2063 },   /* father */
+{   3380,   1170 },   /* favor */
+{   3386,   3390 },   /* fax */
+{   3395,   3400 },   /* fear */
+{   3405,   3410 },   /* feet */
+{   3415,   3292 },   /* female */
+{   3422,   3429 },   /* fencer */
+{   3434,   3441 },   /* ferris */
+{   3446,   3452 },   /* ferry */
+{   3456,   3462 },   /* fever */
+{   3467,   3473 },   /* field */
+{   3478,   3483 },   /* file */
+{   3488,   3495 },   /* filing */
+{   3500,   3505 },   /* film */
+{   3510,   3517 },   /* finger */
+{   3522,   3527 },   /* fire */
+{   3532,   3538 },   /* first */
+{   3543,   3548 },   /* fish */
+{   3553,   3558 },   /* fist */
+{   3562,   3567 },   /* five */
+{   3572,   3577 },   /* flag */
+{   3588,   3594 },   /* flame */
+{   3599,   3605 },   /* flash */
+{   3610,    818 },   /* flex */
+{   3615,    872 },   /* flight */
+{   3622,   3628 },   /* floor */
+{   3633,   3640 },   /* floppy */
+{   3645,   3652 },   /* flower */
+{   3657,   3661 },   /* fly */
+{   3666,   3670 },   /* fog */
+{   3675,   3670 },   /* foggy */
+{   3681,   3483 },   /* folder */
+{   3688,   1851 },   /* fondue */
+{   3695,   3700 },   /* food */
+{   3705,   3710 },   /* foot */
+{   3715,   3720 },   /* fork */
+{   3725,   2158 },   /* four */
+{   3730,   3734 },   /* fox */
+{   3739,   3745 },   /* frame */
+{   3750,   3505 },   /* frames */
+{   3757,   3762 },   /* free */
+{   3767,   3774 },   /* french */
+{   3779,   3785 },   /* fried */
+{   3790,   3796 },   /* fries */
+{   3801,   3806 },   /* frog */
+{   3811,   3817 },   /* frown */
+{   3822,   3828 },   /* fruit */
+{   3833,   3840 },   /* frying */
+{   3845,   2812 },   /* fuel */
+{   3850,   3855 },   /* fuji */
+{   3860,   3865 },   /* full */
+{   3870,   3875 },   /* game */
+{   3880,   3887 },   /* garden */
+{   3892,   3899 },   /* garlic */
+{   3904,   2812 },   /* gas */
+{   3908,   2238 },   /* gear */
+{   3913,   3918 },   /* geek */
+{   3923,   3927 },   /* gem */
+{   3932,   2904 },   /* gene */
+{   3937,   2895 },   /* genie */
+{   3943,   3949 },   /* ghost */
+{   3954,   3959 },   /* gift */
+{   3964,   3971 },   /* ginger */
+{   3976,   3981 },   /* girl */
+{   3986,   3992 },   /* glass */
+{   3997,   3150 },   /* globe */
+{   4003,   4009 },   /* glove */
+{   4014,   4021 },   /* gloves */
+{   4026,   4031 },   /* glow */
+{   4036,   4041 },   /* goal */
+{   4046,   4051 },   /* goat */
+{   4056,   4063 },   /* goblin */
+{   4068,   2247 },   /* gold */
+{   4073,    495 },   /* golf */
+{   4078,   4083 },   /* good */
+{   4088,   4094 },   /* goofy */
+{   4099,   4105 },   /* grain */
+{   4110,   3828 },   /* grape */
+{   4116,   3828 },   /* grapes */
+{   4123,   1829 },   /* graph */
+{   4129,   4135 },   /* grave */
+{   4140,   4145 },   /* gray */
+{   4150,   4156 },   /* green */
+{   4161,   4166 },   /* grin */
+{   4171,   4177 },   /* groom */
+{   4182,   1137 },   /* grow */
+{   4187,   1829 },   /* growth */
+{   4194,   4200 },   /* guard */
+{   4205,   4211 },   /* guide */
+{   4216,   4223 },   /* guitar */
+{   4228,   4232 },   /* gun */
+{   4237,   4242 },   /* gyro */
+{   4247,    958 },   /* hair */
+{   4252,    189 },   /* halo */
+{   4257,   4264 },   /* hammer */
+{   4269,   4274 },   /* hand */
+{   4279,   4285 },   /* happy */
+{   4290,   4296 },   /* hashi */
+{   4301,   2418 },   /* hat */
+{   4305,   4310 },   /* head */
+{   4315,   4320 },   /* hear */
+{   4325,   4331 },   /* heart */
+{   4336,     81 },   /* hearts */
+{   4343,   4349 },   /* heavy */
+{   4354,   4359 },   /* heel */
+{   4364,   4370 },   /* hello */
+{   4375,    280 },   /* helmet */
+{   4382,   4387 },   /* help */
+{   4392,   4397 },   /* herb */
+{   4402,    895 },   /* herd */
+{   4407,   4083 },   /* hero */
+{   4412,   4419 },   /* hidden */
+{   4424,   4430 },   /* hijab */
+{   4435,   4440 },   /* hike */
+{   4445,   1114 },   /* hiking */
+{   4452,   4458 },   /* hindu */
+{   4463,   4469 },   /* hippo */
+{   4474,   2653 },   /* hit */
+{   4478,   4484 },   /* hocho */
+{   4489,   3473 },   /* hockey */
+{   4496,   4502 },   /* hoist */
+{   4507,   2377 },   /* hold */
+{   4512,   4517 },   /* hole */
+{   4522,   4527 },   /* home */
+{   4532,   4538 },   /* honey */
+{   4543,   1742 },   /* hook */
+{   4548,   4553 },   /* hoop */
+{   4558,   4565 },   /* hooray */
+{   4570,   4575 },   /* horn */
+{   4580,   4586 },   /* horns */
+{   4591,   4597 },   /* horse */
+{   4602,   4606 },   /* hot */
+{   4611,   4618 },   /* hotdog */
+{   4623,   4629 },   /* hotel */
+{   4634,   1137 },   /* house */
+{   4640,   4647 },   /* houses */
+{   4652,   4370 },   /* hug */
+{   4656,   1570 },   /* hump */
+{   4661,   4666 },   /* hurt */
+{   4671,   4678 },   /* hushed */
+{   4683,   4687 },   /* hut */
+{   4692,   4694 },   /* i */
+{   4698,   2451 },   /* ice */
+{   4702,   4705 },   /* id */
+{   4710,   1423 },   /* idea */
+{   4715,   4719 },   /* ill */
+{   4724,   2726 },   /* imp */
+{   4728,   4734 },   /* inbox */
+{   4739,   4745 },   /* index */
+{   4750,   4666 },   /* injury */
+{   4757,   4761 },   /* ink */
+{   4766,   4772 },   /* input */
+{   4777,    774 },   /* insect */
+{   4784,   4791 },   /* inside */
+{   4796,   4801 },   /* iron */
+{   4806,   4813 },   /* ironic */
+{   4818,   4824 },   /* islam */
+{   4829,   4836 },   /* island */
+{   4841,   4846 },   /* jack */
+{   4851,   2189 },   /* jacket */
+{   4858,   4864 },   /* jeans */
+{   4869,   3927 },   /* jewel */
+{   4875,   4882 },   /* jiaozi */
+{   4887,   2179 },   /* jigsaw */
+{   4894,   4597 },   /* jockey */
+{   4901,   4906 },   /* joey */
+{   4911,   4916 },   /* joke */
+{   4921,   4927 },   /* joker */
+{   4932,   4936 },   /* joy */
+{   4941,   4947 },   /* judge */
+{   4958,   4963 },   /* judo */
+{   4968,   4972 },   /* jug */
+{   4977,   4984 },   /* juggle */
+{   4989,   4995 },   /* juice */
+{   5000,   4906 },   /* jump */
+{   5005,   5011 },   /* kaaba */
+{   5016,   5021 },   /* kale */
+{   5026,   4963 },   /* karate */
+{   5033,   4242 },   /* kebab */
+{   5039,   5043 },   /* key */
+{   5048,   5053 },   /* kick */
+{   5058,   5065 },   /* kimono */
+{   5070,   2491 },   /* king */
+{   5075,   5080 },   /* kiss */
+{   5085,   5090 },   /* kite */
+{   5095,   5100 },   /* kiwi */
+{   5105,   5111 },   /* kneel */
+{   5116,   3720 },   /* knife */
+{   5122,   5127 },   /* knit */
+{   5132,   5138 },   /* knobs */
+{   5143,   5148 },   /* knot */
+{   5153,   5159 },   /* koala */
+{   5164,   5168 },   /* lab */
+{   5173,   5179 },   /* label */
+{   5184,   2091 },   /* ladder */
+{   5191,   2873 },   /* lamp */
+{   5196,   5203 },   /* laptop */
+{   5208,   5214 },   /* large */
+{   5219,   5226 },   /* lather */
+{   5231,   4772 },   /* latin */
+{   5237,   5243 },   /* laugh */
+{   5248,    270 },   /* lavash */
+{   5255,   5260 },   /* lazy */
+{   5265,   4397 },   /* leaf */
+{   5270,   5277 },   /* ledger */
+{   5282,   5287 },   /* left */
+{   5291,   5053 },   /* leg */
+{   5295,   2002 },   /* lemon */
+{   5301,   5308 },   /* letter */
+{   5313,   5319 },   /* level */
+{   5324,   5328 },   /* lie */
+{   5333,   2904 },   /* life */
+{   5338,   4502 },   /* lift */
+{   5343,   5350 },   /* lifter */
+{   5355,    872 },   /* light */
+{   5361,   5053 },   /* limb */
+{   5366,   5371 },   /* link */
+{   5376,   5381 },   /* lion */
+{   5386,   5391 },   /* lips */
+{   5396,   5403 },   /* liquor */
+{   5408,   5415 },   /* litter */
+{   5420,   5427 },   /* lizard */
+{   5432,    155 },   /* llama */
+{   5438,   1233 },   /* loaf */
+{   5443,   5448 },   /* lock */
+{   5453,   5460 },   /* locked */
+{   5465,   5472 },   /* locker */
+{   5477,   5481 },   /* log */
+{   5486,   5491 },   /* loop */
+{   5495,   5501 },   /* lorry */
+{   5506,   5513 },   /* lotion */
+{   5518,   5523 },   /* loud */
+{   5528,   5533 },   /* love */
+{   5538,   2820 },   /* low */
+{   5542,   2480 },   /* luck */
+{   5547,   5554 },   /* lumber */
+{   5559,   1268 },   /* lungs */
+{   5565,   5567 },   /* m */
+{   5571,    200 },   /* mad */
+{   5575,   5580 },   /* mage */
+{   5585,   3661 },   /* maggot */
+{   5592,   5598 },   /* magic */
+{   5603,   5610 },   /* magnet */
+{   5615,   5308 },   /* mail */
+{   5620,   2354 },   /* maize */
+{   5626,   5633 },   /* makeup */
+{   5638,   5643 },   /* male */
+{   5648,   5652 },   /* man */
+{   5657,   5663 },   /* mango */
+{   5668,   5672 },   /* map */
+{   5677,   5683 },   /* maple */
+{   5688,   5693 },   /* mark */
+{   5697,   5704 },   /* marker */
+{   5709,   2916 },   /* mask */
+{   5714,   5719 },   /* mate */
+{   5724,   5729 },   /* math */
+{   5733,   2354 },   /* maze */
+{   5738,   5743 },   /* meat */
+{   5748,   5754 },   /* medal */
+{   5759,   5766 },   /* medium */
+{   5771,   5775 },   /* meh */
+{   5780,   5786 },   /* melon */
+{   5791,   1851 },   /* melted */
+{   5798,   5803 },   /* memo */
+{   5808,   5812 },   /* men */
+{   5823,   5829 },   /* mercy */
+{   5834,   5841 },   /* merman */
+{   5846,   2247 },   /* metal */
+{   5852,   5858 },   /* metro */
+{   5863,   5867 },   /* mic */
+{   5872,   1397 },   /* milk */
+{   5877,   5884 },   /* mining */
+{   5888,   5894 },   /* minus */
+{   5898,   5905 },   /* mirror */
+{   5910,   5915 },   /* moai */
+{   5920,   1760 },   /* mobile */
+{   5927,   5932 },   /* mode */
+{   5937,   5944 },   /* molusc */
+{   5949,   2247 },   /* money */
+{   5955,   3283 },   /* monkey */
+{   5962,   2643 },   /* moon */
+{   5967,   1279 },   /* mortar */
+{   5974,   4824 },   /* mosque */
+{   5981,   5988 },   /* mother */
+{   5993,   5999 },   /* motor */
+{   6004,   6010 },   /* mouse */
+{   6015,   6021 },   /* mouth */
+{   6026,   1967 },   /* movie */
+{   6032,   5915 },   /* moyai */
+{   6038,    762 },   /* mug */
+{   6042,   6048 },   /* munch */
+{   6053,    818 },   /* muscle */
+{   6060,   6067 },   /* museum */
+{   6072,   6078 },   /* music */
+{   6083,   6088 },   /* mute */
+{   6093,    270 },   /* naan */
+{   6098,   1673 },   /* nail */
+{   6103,    426 },   /* name */
+{   6108,    661 },   /* nazar */
+{   6114,   6119 },   /* neck */
+{   6124,   6131 },   /* needle */
+{   6136,   3918 },   /* nerd */
+{   6141,   6145 },   /* net */
+{   6150,   6154 },   /* new */
+{   6159,   6164 },   /* news */
+{   6169,   6172 },   /* ng */
+{   6177,   6181 },   /* nib */
+{   6185,   6191 },   /* night */
+{   6196,   6201 },   /* nine */
+{   6206,   4419 },   /* ninja */
+{   6212,   3264 },   /* no */
+{   6215,   1186 },   /* noodle */
+{   6222,   6228 },   /* north */
+{   6232,   3321 },   /* nose */
+{   6237,   3264 },   /* not */
+{   6241,   6246 },   /* note */
+{   6251,   6257 },   /* notes */
+{   6262,   6268 },   /* nurse */
+{   6279,   6283 },   /* nut */
+{   6288,   6290 },   /* o */
+{   6294,   6300 },   /* ocean */
+{   6305,   6310 },   /* oden */
+{   6315,   6319 },   /* off */
+{   6324,   6329 },   /* ogre */
+{   6334,   6337 },   /* oh */
+{   6342,   6346 },   /* oil */
+{   6351,   6355 },   /* old */
+{   6360,   3700 },   /* olive */
+{   6366,   6369 },   /* om */
+{   6374,   6377 },   /* on */
+{   6382,   6387 },   /* once */
+{   6392,   6396 },   /* one */
+{   6401,   6407 },   /* onion */
+{   6412,   6021 },   /* open */
+{   6417,   6424 },   /* orange */
+{   6429,   4331 },   /* organ */
+{   6435,   6441 },   /* otter */
+{   6446,   6453 },   /* outbox */
+{   6458,   6462 },   /* owl */
+{   6467,   1433 },   /* ox */
+{   6470,   2863 },   /* oyster */
+{   6477,   6481 },   /* pad */
+{   6486,   6493 },   /* paddle */
+{   6498,   6505 },   /* paella */
+{   6510,   2531 },   /* page */
+{   6515,   6521 },   /* pager */
+{   6526,   1409 },   /* pail */
+{   6531,   6536 },   /* palm */
+{   6541,   3840 },   /* pan */
+{   6545,   6551 },   /* panda */
+{   6556,   4864 },   /* pants */
+{   6562,   6568 },   /* paper */
+{   6573,   6580 },   /* parcel */
+{   6585,   6590 },   /* park */
+{   6595,    597 },   /* parlor */
+{   6602,   6609 },   /* parrot */
+{   6614,   6619 },   /* part */
+{   6623,   6629 },   /* party */
+{   6634,   6640 },   /* pasta */
+{   6645,   1549 },   /* pastry */
+{   6652,   6659 },   /* patrol */
+{   6664,   6670 },   /* pause */
+{   6674,   3410 },   /* paw */
+{   6678,   5203 },   /* pc */
+{   6681,   3010 },   /* peace */
+{   6687,   6693 },   /* peach */
+{   6698,   6705 },   /* peahen */
+{   6710,   6283 },   /* peanut */
+{   6717,   6722 },   /* pear */
+{   6727,   1397 },   /* pearl */
+{   6733,   6181 },   /* pen */
+{   6737,   6744 },   /* pencil */
+{   6748,   6755 },   /* pepper */
+{   6760,     92 },   /* person */
+{   6767,   3661 },   /* pest */
+{   6772,    438 },   /* pester */
+{   6779,   2935 },   /* pet */
+{   6783,   1582 },   /* phone */
+{   6789,   6795 },   /* piano */
+{   6800,   5884 },   /* pick */
+{   6805,   6812 },   /* picket */
+{   6817,   6824 },   /* pickle */
+{   6829,   6836 },   /* pickup */
+{   6841,    609 },   /* picnic */
+{   6848,   6852 },   /* pie */
+{   6857,   2179 },   /* piece */
+{   6863,   6867 },   /* pig */
+{   6872,   6877 },   /* pill */
+{   6882,   6888 },   /* pilot */
+{   6899,   6903 },   /* pin */
+{   6908,    531 },   /* pine */
+{   6913,   3577 },   /* pink */
+{   6918,   6609 },   /* pirate */
+{   6925,   4232 },   /* pistol */
+{   6932,    270 },   /* pita */
+{   6937,   6943 },   /* pizza */
+{   6948,   6888 },   /* plane */
+{   6954,   1137 },   /* plant */
+{   6960,   3720 },   /* plate */
+{   6966,   6971 },   /* play */
+{   6975,    338 },   /* please */
+{   6982,   6987 },   /* plug */
+{   6992,   5729 },   /* plus */
+{   6997,   7003 },   /* plush */
+{   7008,   4745 },   /* point */
+{   7014,   7019 },   /* pole */
+{   7024,   2334 },   /* police */
+{   7031,   1673 },   /* polish */
+{   7038,   7043 },   /* polo */
+{   7048,   3088 },   /* poo */
+{   7052,   7059 },   /* poodle */
+{   7064,   3088 },   /* poop */
+{   7069,   7076 },   /* popper */
+{   7081,   7088 },   /* porous */
+{   7093,   7098 },   /* post */
+{   7103,   7110 },   /* postal */
+{   7115,   1851 },   /* pot */
+{   7119,   7126 },   /* potato */
+{   7131,   7137 },   /* pouch */
+{   7142,   7148 },   /* pound */
+{   7153,   3785 },   /* prawn */
+{   7159,    338 },   /* pray */
+{   7164,   7171 },   /* prayer */
+{   7176,   7183 },   /* pretty */
+{   7188,   7194 },   /* pride */
+{   7206,   7213 },   /* prince */
+{   7218,   7224 },   /* print */
+{   7229,   7235 },   /* prize */
+{   7240,   7246 },   /* proof */
+{   7251,   7257 },   /* proud */
+{   7262,   7267 },   /* puck */
+{   7272,   4331 },   /* pulse */
+{   7278,   2812 },   /* pump */
+{   7283,   3558 },   /* punch */
+{   7289,   7296 },   /* purple */
+{   7301,   7307 },   /* purse */
+{   7312,   2179 },   /* puzzle */
+{   7319,   2491 },   /* queen */
+{   7325,   7332 },   /* quench */
+{   7337,   7343 },   /* quiet */
+{   7348,   7350 },   /* r */
+{   7353,   1456 },   /* rabbit */
+{   7360,   7367 },   /* racing */
+{   7378,   7384 },   /* radio */
+{   7389,    200 },   /* rage */
+{   7394,   7399 },   /* rain */
+{   7403,   7410 },   /* raised */
+{   7415,   5643 },   /* ram */
+{   7419,   1186 },   /* ramen */
+{   7425,   7429 },   /* rat */
+{   7434,   7439 },   /* rays */
+{   7443,   7449 },   /* razor */
+{   7454,   1979 },   /* record */
+{   7461,    200 },   /* red */
+{   7465,   7472 },   /* reload */
+{   7477,   7484 },   /* repeat */
+{   7489,   7496 },   /* resort */
+{   7500,   7507 },   /* rewind */
+{   7511,    715 },   /* rhythm */
+{   7518,   7525 },   /* ribbon */
+{   7530,   4105 },   /* rice */
+{   7535,   6971 },   /* right */
+{   7541,   7546 },   /* ring */
+{   7551,   7557 },   /* roach */
+{   7562,   7567 },   /* road */
+{   7572,   7578 },   /* robot */
+{   7583,   4349 },   /* rock */
+{   7588,   7595 },   /* rocket */
+{   7607,   3774 },   /* roll */
+{   7612,   7619 },   /* rolled */
+{   7624,   7631 },   /* roller */
+{   7636,   5148 },   /* rope */
+{   7641,   7646 },   /* rose */
+{   7651,   7657 },   /* rugby */
+{   7662,   7668 },   /* ruler */
+{   7673,   2091 },   /* rung */
+{   7678,   7685 },   /* rushed */
+{   7690,   2945 },   /* russia */
+{   7697,   2506 },   /* sad */
+{   7701,   7708 },   /* safety */
+{   7713,   7718 },   /* sake */
+{   7723,   7729 },   /* salad */
+{   7734,   7740 },   /* salon */
+{   7745,   7750 },   /* salt */
+{   7755,   7760 },   /* sand */
+{   7764,   7771 },   /* sandal */
+{   7776,   2063 },   /* santa */
+{   7782,   7787 },   /* sari */
+{   7792,   7797 },   /* sash */
+{   7802,   4387 },   /* sassy */
+{   7808,   7815 },   /* saturn */
+{   7820,   7826 },   /* sauna */
+{   7831,   5554 },   /* saw */
+{   7835,   7839 },   /* sax */
+{   7844,   7850 },   /* scale */
+{   7854,   4947 },   /* scales */
+{   7861,   3400 },   /* scared */
+{   7868,   6119 },   /* scarf */
+{   7874,   7881 },   /* school */
+{   7886,   3865 },   /* score */
+{   7892,   6048 },   /* scream */
+{   7899,   7905 },   /* screw */
+{   7910,   6568 },   /* scroll */
+{   7917,   7923 },   /* scuba */
+{   7928,   7496 },   /* sea */
+{   7932,   7937 },   /* seal */
+{   7942,   7949 },   /* search */
+{   7954,   1800 },   /* seat */
+{   7959,   7966 },   /* second */
+{   7971,   5043 },   /* secure */
+{   7978,   3283 },   /* see */
+{   7982,   1582 },   /* selfie */
+{   7989,   5501 },   /* semi */
+{   7994,   6453 },   /* sent */
+{   7999,   8003 },   /* set */
+{   8008,   8014 },   /* seven */
+{   8019,   6131 },   /* sewing */
+{   8026,   8032 },   /* shake */
+{   8037,   7750 },   /* shaker */
+{   8044,   8050 },   /* shark */
+{   8055,   7449 },   /* sharp */
+{   8061,   7449 },   /* shave */
+{   8067,   8074 },   /* shaved */
+{   8079,    485 },   /* shaven */
+{   8086,   5643 },   /* sheep */
+{   8092,   8098 },   /* shell */
+{   8103,   8110 },   /* shield */
+{   8115,   8122 },   /* shinto */
+{   8126,    179 },   /* ship */
+{   8131,   7797 },   /* shirt */
+{   8137,   8142 },   /* shoe */
+{   8147,   8154 },   /* shorts */
+{   8159,   5403 },   /* shot */
+{   8164,   8171 },   /* shower */
+{   8176,   3785 },   /* shrimp */
+{   8183,   8122 },   /* shrine */
+{   8190,   3000 },   /* shrug */
+{   8196,   7343 },   /* shush */
+{   8202,   2916 },   /* sick */
+{   8207,   6812 },   /* sign */
+{   8212,   8219 },   /* signal */
+{   8224,   8231 },   /* silent */
+{   8236,   2247 },   /* silver */
+{   8243,     63 },   /* singer */
+{   8250,   8254 },   /* sit */
+{   8259,   8263 },   /* six */
+{   8268,   7631 },   /* skate */
+{   8274,   6310 },   /* skewer */
+{   8281,   8285 },   /* ski */
+{   8289,   8285 },   /* skier */
+{   8295,   4984 },   /* skill */
+{   8301,   8306 },   /* skis */
+{   8311,   2705 },   /* skull */
+{   8317,   8323 },   /* skunk */
+{   8328,   8333 },   /* sled */
+{   8338,   8333 },   /* sledge */
+{   8345,   8351 },   /* sleep */
+{   8356,   8333 },   /* sleigh */
+{   8363,   8370 },   /* sleuth */
+{   8375,   6943 },   /* slice */
+{   8381,   5319 },   /* slider */
+{   8388,   8393 },   /* slot */
+{   8398,   5260 },   /* sloth */
+{   8404,   5260 },   /* slow */
+{   8409,   8413 },   /* sly */
+{   8418,   4094 },   /* small */
+{   8424,   6021 },   /* smile */
+{   8430,   8436 },   /* smirk */
+{   8441,   8447 },   /* snail */
+{   8452,    705 },   /* snake */
+{   8458,    468 },   /* snare */
+{   8464,   8471 },   /* sneeze */
+{   8476,   8285 },   /* snow */
+{   8481,   5226 },   /* soap */
+{   8486,   5090 },   /* soar */
+{   8491,   8495 },   /* sob */
+{   8500,   8507 },   /* soccer */
+{   8511,   8517 },   /* socks */
+{   8522,   4995 },   /* soda */
+{   8527,   2451 },   /* soft */
+{   8532,   4349 },   /* solid */
+{   8538,   8543 },   /* soon */
+{   8548,   1158 },   /* sorry */
+{   8554,   8558 },   /* sos */
+{   8563,   8569 },   /* south */
+{   8573,   8577 },   /* sow */
+{   8582,   8588 },   /* space */
+{   8593,   8599 },   /* speak */
+{   8604,   2774 },   /* speech */
+{   8611,   8617 },   /* speed */
+{   8622,   8629 },   /* spider */
+{   8634,   8640 },   /* spiny */
+{   8645,   8098 },   /* spiral */
+{   8652,    377 },   /* split */
+{   8658,   8664 },   /* spock */
+{   8669,   7088 },   /* sponge */
+{   8676,   8682 },   /* spool */
+{   8687,   8693 },   /* spoon */
+{   8698,   8704 },   /* spots */
+{   8709,   8370 },   /* spy */
+{   8713,   8720 },   /* square */
+{   8724,   5944 },   /* squid */
+{   8730,   8736 },   /* staff */
+{   8740,   8746 },   /* stand */
+{   8751,   3311 },   /* star */
+{   8756,   8763 },   /* statue */
+{   8768,   1944 },   /* steak */
+{   8774,   3253 },   /* steam */
+{   8780,   2091 },   /* step */
+{   8785,   8790 },   /* stew */
+{   8795,   6310 },   /* stick */
+{   8801,   8323 },   /* stink */
+{   8807,   3710 },   /* stomp */
+{   8813,   4349 },   /* stone */
+{   8819,   8824 },   /* stop */
+{   8829,   8835 },   /* store */
+{   8840,   8846 },   /* straw */
+{   8851,   8682 },   /* string */
+{   8858,   8865 },   /* stripe */
+{   8870,   5867 },   /* studio */
+{   8877,   8884 },   /* stuffy */
+{   8889,   5858 },   /* subway */
+{   8896,   8901 },   /* suit */
+{   8906,   1333 },   /* sun */
+{   8910,   7439 },   /* sunny */
+{   8916,   3103 },   /* sunset */
+{   8923,   8929 },   /* sushi */
+{   8934,   2566 },   /* swan */
+{   8939,   2257 },   /* sweat */
+{   8945,   8951 },   /* sweet */
+{   8956,   8961 },   /* swim */
+{   8966,   1549 },   /* swirl */
+{   8972,   3429 },   /* sword */
+{   8978,   8985 },   /* swords */
+{   8989,   5704 },   /* tabs */
+{   8994,   8999 },   /* taco */
+{   9004,   7076 },   /* tada */
+{   9009,   6609 },   /* talk */
+{   9014,   9021 },   /* tamale */
+{   9026,   9030 },   /* tao */
+{   9034,   9030 },   /* taoist */
+{   9041,   9046 },   /* tape */
+{   9051,   2653 },   /* target */
+{   9058,   9064 },   /* taste */
+{   9069,   9074 },   /* taxi */
+{   9079,   1397 },   /* tea */
+{   9083,   2515 },   /* teacup */
+{   9090,   3054 },   /* teapot */
+{   9097,   7257 },   /* tear */
+{   9102,   1385 },   /* teeth */
+{   9108,    347 },   /* teller */
+{   9115,   4458 },   /* temple */
+{   9122,   9126 },   /* ten */
+{   9131,   9138 },   /* tennis */
+{   9143,   9148 },   /* tent */
+{   9152,   4370 },   /* thanks */
+{   9159,   1352 },   /* third */
+{   9165,   9172 },   /* thirty */
+{   9177,   9184 },   /* thongs */
+{   9189,   8682 },   /* thread */
+{   9196,   9202 },   /* three */
+{   9207,   9213 },   /* thumb */
+{   9218,   4430 },   /* tichel */
+{   9225,   9232 },   /* ticket */
+{   9237,   5148 },   /* tie */
+{   9241,   9247 },   /* tiger */
+{   9252,   5481 },   /* timber */
+{   9259,   7760 },   /* timer */
+{   9265,   2884 },   /* tipsy */
+{   9271,   9277 },   /* tired */
+{   9282,   9285 },   /* tm */
+{   9289,   9296 },   /* toilet */
+{   9301,   9308 },   /* tomato */
+{   9313,   9320 },   /* tongue */
+{   9325,   5554 },   /* tool */
+{   9330,   9336 },   /* tooth */
+{   9341,   9345 },   /* top */
+{   9350,   9345 },   /* tophat */
+{   9357,   9363 },   /* torch */
+{   9368,   9374 },   /* tower */
+{   9379,   9383 },   /* toy */
+{   9388,   3253 },   /* train */
+{   9394,   1654 },   /* tram */
+{   9399,    468 },   /* trap */
+{   9404,   9411 },   /* travel */
+{   9416,   6453 },   /* tray */
+{   9421,   9426 },   /* tree */
+{   9431,   9437 },   /* trend */
+{   9442,   7235 },   /* trophy */
+{   9449,   6836 },   /* truck */
+{   9455,   9462 },   /* tshirt */
+{   9467,   9473 },   /* tulip */
+{   9478,   9485 },   /* turban */
+{   9490,   9497 },   /* turkey */
+{   9502,   9509 },   /* turtle */
+{   9514,   5214 },   /* tusk */
+{   9519,   4177 },   /* tuxedo */
+{   9526,   9529 },   /* tv */
+{   9534,   9541 },   /* twelve */
+{   9546,   5148 },   /* twine */
+{   9552,   9558 },   /* twins */
+{   9563,   5148 },   /* twist */
+{   9569,   9573 },   /* two */
+{   9578,    143 },   /* ufo */
+{   9582,   9589 },   /* undead */
+{   9594,   5448 },   /* unlock */
+{   9601,   9604 },   /* up */
+{   9609,   9437 },   /* upward */
+{   9616,    330 },   /* urn */
+{   9620,   9622 },   /* v */
+{   9626,   1409 },   /* vat */
+{   9630,   1297 },   /* veil */
+{   9635,   9642 },   /* versus */
+{   9647,   7708 },   /* vest */
+{   9652,   9046 },   /* vhs */
+{   9656,   2042 },   /* vice */
+{   9661,   7384 },   /* video */
+{   9667,   3745 },   /* view */
+{   9672,   9679 },   /* violin */
+{   9684,   3462 },   /* virus */
+{   9690,   9696 },   /* vomit */
+{   9701,   9642 },   /* vs */
+{   9704,   8664 },   /* vulcan */
+{   9711,   4801 },   /* waffle */
+{   9718,   4440 },   /* walk */
+{   9723,   1279 },   /* wall */
+{   9728,   9735 },   /* waning */
+{   9740,   2113 },   /* watch */
+{   9746,   7043 },   /* water */
+{   9752,   4274 },   /* wave */
+{   9757,   4274 },   /* waving */
+{   9764,   9769 },   /* wavy */
+{   9773,   9780 },   /* waxing */
+{   9785,   9788 },   /* wc */
+{   9793,   4484 },   /* weapon */
+{   9800,   9277 },   /* weary */
+{   9806,   9810 },   /* web */
+{   9815,   5350 },   /* weight */
+{   9822,   9827 },   /* west */
+{   9831,   9837 },   /* whale */
+{   9842,   3441 },   /* wheel */
+{   9848,   9853 },   /* whew */
+{   9858,   5403 },   /* whisky */
+{   9865,   9871 },   /* white */
+{   9876,   9883 },   /* whoops */
+{   9888,    918 },   /* wicked */
+{   9895,   9902 },   /* wilted */
+{   9907,    986 },   /* wind */
+{   9912,   3745 },   /* window */
+{   9919,   9924 },   /* wine */
+{   9929,   9935 },   /* wings */
+{   9940,   9945 },   /* wink */
+{   9950,   6462 },   /* wise */
+{   9955,    895 },   /* wisent */
+{   9962,   5598 },   /* witch */
+{   9968,   5598 },   /* wizard */
+{   9975,   9980 },   /* wolf */
+{   9985,   9991 },   /* woman */
+{   9996,  10002 },   /* women */
+{  10013,  10017 },   /* won */
+{  10022,   5481 },   /* wood */
+{  10027,    155 },   /* wool */
+{  10032,   5214 },   /* woolly */
+{  10039,  10046 },   /* worker */
+{  10058,   3150 },   /* world */
+{  10064,  10069 },   /* worm */
+{  10074,  10079 },   /* wrap */
+{  10084,  10091 },   /* wrench */
+{  10096,  10102 },   /* write */
+{  10106,   4813 },   /* wry */
+{  10110,   1603 },   /* x */
+{  10112,   7496 },   /* yacht */
+{  10118,   9030 },   /* yang */
+{  10123,   5127 },   /* yarn */
+{  10128,   1125 },   /* yawn */
+{  10133,  10140 },   /* yellow */
+{  10145,    862 },   /* yen */
+{  10149,   9030 },   /* yin */
+{  10153,  10158 },   /* yoga */
+{  10163,    394 },   /* young */
+{  10169,  10173 },   /* yum */
+{  10178,   4687 },   /* yurt */
+{  10183,   2623 },   /* zap */
+{  10187,   8865 },   /* zebra */
+{  10193,  10200 },   /* zipper */
+{  10205,   3981 },   /* zodiac */
+{  10212,  10219 },   /* zombie */
+{  10224,  10228 },   /* zzz */
+};
+
+/* open addressing hash of matches, index + 1 of the table, 0 is empty. */
+const guint16 english_emoji_hash[] = {
+0, 990, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 988, 0, 556, 0,
+0, 747, 602, 665, 947, 618, 0, 0, 0, 61, 0, 0, 0, 0, 0, 0,
+0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 803, 0, 0, 1095,
+0, 0, 0, 462, 0, 501, 876, 0, 0, 77, 0, 0, 0, 0, 0, 0,
+0, 1060, 0, 0, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0, 0, 0,
+0, 885, 0, 0, 0, 722, 793, 0, 0, 0, 0, 0, 0, 181, 0, 0,
+0, 0, 0, 0, 0, 0, 849, 0, 0, 37, 720, 0, 0, 94, 0, 191,
+318, 0, 439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 233, 401, 708, 1096, 0, 186, 908, 0, 0, 0, 0, 0,
+693, 0, 0, 57, 551, 825, 976, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 478, 0, 759, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 991, 266, 0, 0, 0, 0, 0, 220,
+0, 0, 0, 0, 656, 201, 502, 962, 0, 763, 1035, 0, 0, 0, 0, 1019,
+0, 1084, 0, 0, 0, 0, 268, 1102, 0, 0, 0, 0, 779, 0, 0, 791,
+595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+43, 0, 0, 933, 1093, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 951, 813, 1073, 0, 0, 14, 0, 0, 0,
+0, 0, 0, 0, 0, 622, 0, 0, 0, 0, 0, 241, 0, 0, 507, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1011, 0, 753,
+0, 0, 0, 0, 0, 0, 0, 231, 0, 437, 0, 651, 0, 0, 0, 0,
+0, 974, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 553, 0, 0, 0, 0, 0, 0, 628, 0, 0, 0, 0, 0, 0, 870,
+0, 0, 0, 810, 450, 486, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 545, 397, 854,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+100, 137, 372, 0, 0, 0, 0, 578, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 597, 38, 0, 0, 245, 364, 456, 0, 0, 0, 0, 0, 0, 251, 703,
+428, 981, 1008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 488, 0, 0,
+0, 0, 599, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+403, 533, 0, 0, 0, 104, 0, 738, 400, 0, 411, 0, 612, 0, 0, 442,
+0, 0, 0, 0, 0, 0, 0, 0, 644, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 114, 0, 0, 1065, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+961, 1050, 0, 0, 0, 0, 510, 765, 0, 0, 0, 0, 247, 925, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1053, 0, 0, 0, 83, 797, 828, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1110, 305, 977, 1108, 216,
+355, 0, 0, 0, 0, 0, 926, 0, 0, 1082, 0, 414, 465, 0, 0, 365,
+0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 895, 383, 194, 632, 0,
+0, 0, 0, 326, 0, 0, 0, 336, 333, 0, 0, 0, 0, 694, 0, 0,
+274, 0, 0, 0, 0, 176, 0, 0, 40, 93, 204, 480, 0, 0, 0, 0,
+692, 699, 0, 0, 0, 711, 912, 0, 0, 0, 0, 0, 830, 0, 449, 160,
+736, 892, 0, 0, 799, 0, 958, 393, 0, 331, 0, 0, 0, 999, 645, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 325,
+786, 0, 279, 0, 0, 0, 252, 0, 889, 0, 0, 246, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1059,
+0, 558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537,
+1112, 0, 354, 0, 0, 664, 637, 0, 0, 0, 0, 108, 483, 950, 0, 0,
+0, 0, 0, 0, 518, 843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 760,
+1014, 0, 1009, 964, 638, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 774, 0, 0, 344, 0, 264, 860, 938, 0, 0, 0, 506,
+211, 911, 0, 929, 0, 0, 0, 0, 0, 662, 0, 0, 0, 0, 0, 1085,
+0, 0, 0, 0, 0, 552, 0, 737, 0, 0, 0, 0, 376, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 363, 0,
+0, 0, 903, 570, 0, 0, 0, 0, 0, 0, 0, 0, 944, 0, 902, 56,
+0, 0, 380, 631, 47, 0, 475, 0, 0, 0, 0, 0, 0, 717, 0, 0,
+560, 0, 0, 0, 0, 0, 0, 0, 296, 135, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 1017, 0, 374, 687, 762,
+0, 0, 0, 0, 0, 345, 0, 0, 445, 404, 407, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 103, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 814, 79, 986, 0, 0, 311, 0, 359, 0, 0, 653, 0, 0, 0,
+386, 835, 1068, 0, 0, 0, 168, 508, 621, 918, 0, 339, 0, 586, 0, 0,
+0, 0, 0, 0, 0, 989, 0, 0, 0, 0, 451, 660, 0, 0, 0, 0,
+696, 0, 0, 0, 243, 0, 0, 0, 0, 0, 433, 0, 0, 262, 0, 0,
+0, 0, 133, 724, 0, 0, 0, 591, 254, 0, 0, 0, 862, 956, 0, 178,
+239, 68, 102, 900, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 361, 0, 0, 0, 0, 0, 0, 0, 323, 796, 808, 0, 0, 0, 901,
+0, 875, 0, 0, 0, 0, 0, 0, 435, 0, 0, 0, 0, 0, 0, 0,
+219, 0, 0, 829, 0, 0, 492, 0, 0, 1101, 0, 0, 402, 167, 382, 647,
+671, 963, 0, 0, 978, 0, 0, 0, 0, 162, 0, 0, 0, 0, 152, 0,
+1080, 0, 1005, 230, 0, 0, 0, 0, 0, 0, 818, 0, 0, 624, 0, 0,
+307, 141, 610, 0, 0, 0, 0, 0, 0, 698, 0, 0, 471, 0, 0, 0,
+227, 0, 0, 0, 0, 0, 417, 0, 0, 654, 0, 0, 891, 837, 0, 1109,
+0, 0, 25, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0,
+577, 0, 0, 0, 0, 1092, 143, 576, 994, 146, 0, 0, 953, 0, 0, 0,
+0, 0, 0, 0, 0, 905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 187, 229, 0, 368, 659, 755, 1076, 0, 1047, 0,
+0, 277, 928, 438, 237, 1012, 0, 304, 0, 0, 0, 0, 0, 834, 0, 0,
+0, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 387,
+0, 0, 0, 0, 0, 0, 0, 139, 1043, 0, 0, 0, 873, 0, 0, 0,
+0, 0, 0, 855, 0, 0, 0, 0, 0, 0, 0, 0, 946, 0, 0, 214,
+0, 0, 280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 91, 1004, 0, 0, 681, 0, 0, 0, 0, 0, 0, 0, 0, 569, 0,
+0, 0, 0, 0, 0, 1111, 0, 0, 943, 0, 0, 473, 0, 0, 0, 0,
+0, 0, 0, 589, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+384, 422, 0, 0, 0, 0, 935, 0, 0, 0, 1106, 460, 0, 272, 0, 0,
+0, 0, 0, 0, 689, 0, 0, 0, 0, 579, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 567, 0, 0, 0,
+491, 99, 723, 922, 0, 0, 0, 0, 0, 0, 190, 371, 0, 0, 0, 0,
+0, 0, 0, 389, 495, 362, 0, 0, 175, 0, 313, 815, 584, 847, 0, 0,
+0, 0, 0, 0, 0, 1001, 0, 0, 0, 0, 0, 154, 0, 0, 41, 0,
+265, 0, 614, 998, 467, 67, 0, 0, 0, 0, 2, 0, 267, 92, 0, 0,
+0, 0, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 357, 0, 0,
+0, 0, 0, 427, 544, 0, 0, 0, 0, 0, 18, 1103, 0, 0, 0, 76,
+0, 0, 0, 0, 850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 89, 329, 874, 297, 0, 0, 212, 0, 0, 0,
+122, 629, 0, 0, 244, 682, 0, 0, 0, 0, 741, 0, 742, 0, 291, 0,
+0, 0, 0, 0, 26, 0, 0, 0, 0, 971, 807, 965, 0, 0, 0, 0,
+0, 50, 661, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 405, 688, 0, 0, 0, 0, 0, 0, 1023,
+0, 0, 324, 743, 857, 288, 896, 897, 0, 0, 0, 485, 487, 0, 1045, 0,
+0, 0, 0, 0, 884, 0, 691, 0, 78, 299, 542, 0, 0, 0, 0, 0,
+0, 985, 0, 0, 0, 728, 0, 509, 0, 700, 0, 0, 0, 0, 811, 0,
+309, 0, 0, 0, 0, 0, 27, 0, 0, 0, 198, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+831, 0, 0, 0, 0, 0, 0, 0, 423, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 583, 1039, 0, 0, 0, 0, 904, 418, 0, 0, 0, 0, 0, 0,
+616, 153, 496, 549, 0, 772, 0, 0, 0, 0, 0, 0, 46, 24, 0, 0,
+0, 269, 784, 0, 0, 0, 0, 0, 0, 341, 513, 0, 0, 459, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 817, 0, 270,
+0, 0, 208, 0, 0, 858, 0, 1079, 0, 727, 1010, 96, 0, 0, 0, 0,
+1040, 0, 0, 840, 0, 0, 0, 377, 0, 0, 0, 0, 223, 0, 0, 0,
+0, 0, 0, 0, 0, 766, 0, 0, 0, 0, 609, 0, 0, 0, 0, 1020,
+0, 0, 0, 0, 0, 416, 821, 30, 134, 286, 0, 0, 0, 0, 0, 128,
+0, 0, 0, 0, 0, 0, 899, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+59, 0, 240, 337, 0, 967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 222, 0, 1029, 1089, 0, 0, 0, 0, 822, 0, 0,
+0, 0, 0, 0, 0, 0, 1069, 0, 0, 0, 0, 0, 117, 0, 0, 0,
+0, 887, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+915, 809, 23, 385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 514, 0, 315, 398, 695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 21, 0, 0, 0, 0, 0, 970, 0, 635, 871, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1070, 7, 0, 394, 0, 0, 568,
+0, 0, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0,
+0, 11, 0, 0, 457, 1055, 984, 0, 0, 0, 119, 0, 321, 535, 1074, 0,
+0, 676, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 0, 0, 0,
+1044, 0, 898, 0, 0, 0, 308, 0, 0, 0, 0, 0, 886, 494, 519, 0,
+0, 0, 0, 0, 867, 0, 798, 0, 0, 0, 924, 0, 0, 0, 0, 0,
+0, 0, 0, 463, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1025, 0, 0, 0, 0, 0, 0, 1028, 781, 0, 0, 557, 0, 827,
+0, 0, 0, 0, 0, 524, 0, 0, 0, 0, 0, 314, 0, 0, 458, 49,
+588, 342, 550, 1105, 0, 0, 561, 0, 60, 968, 894, 0, 0, 0, 148, 0,
+0, 0, 0, 0, 0, 0, 16, 789, 0, 145, 0, 0, 0, 0, 0, 0,
+0, 525, 0, 725, 0, 0, 0, 0, 0, 0, 0, 554, 505, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 395, 0, 177, 0, 0, 0, 0, 0, 0, 71,
+468, 0, 0, 0, 0, 0, 0, 327, 196, 498, 864, 0, 969, 226, 0, 0,
+0, 0, 0, 1090, 0, 0, 0, 0, 0, 0, 0, 235, 249, 352, 1113, 0,
+125, 0, 979, 0, 0, 1016, 412, 0, 0, 832, 443, 748, 0, 0, 0, 121,
+0, 0, 82, 0, 0, 0, 923, 0, 0, 0, 0, 0, 276, 0, 0, 0,
+0, 0, 0, 565, 611, 0, 0, 317, 0, 0, 0, 0, 778, 0, 0, 0,
+0, 0, 0, 0, 0, 879, 1083, 346, 33, 0, 0, 0, 0, 0, 0, 0,
+718, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 301,
+0, 0, 0, 0, 378, 0, 0, 0, 316, 1034, 861, 939, 0, 0, 0, 0,
+0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 863, 4, 0, 0, 0, 0,
+0, 0, 625, 845, 0, 290, 812, 0, 0, 0, 0, 35, 0, 0, 0, 0,
+868, 0, 582, 0, 0, 0, 310, 0, 39, 218, 0, 390, 1, 0, 0, 955,
+0, 0, 0, 0, 0, 0, 0, 532, 0, 482, 0, 0, 0, 0, 982, 0,
+8, 663, 650, 0, 0, 253, 0, 0, 0, 0, 0, 0, 164, 0, 1067, 604,
+172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 156,
+0, 1018, 0, 343, 0, 149, 0, 0, 1086, 0, 0, 0, 909, 0, 0, 481,
+0, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 942, 0, 203, 0,
+948, 0, 391, 0, 0, 0, 0, 0, 261, 754, 28, 0, 0, 0, 0, 581,
+0, 646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+0, 0, 0, 0, 744, 48, 0, 0, 0, 0, 643, 474, 0, 0, 1064, 0,
+852, 0, 0, 0, 69, 0, 0, 0, 447, 0, 0, 0, 0, 5, 0, 0,
+0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 379,
+764, 1097, 0, 0, 0, 0, 0, 0, 848, 0, 0, 87, 739, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 0, 0, 0, 0, 0, 657,
+0, 0, 0, 0, 0, 202, 0, 0, 1021, 0, 0, 732, 0, 0, 0, 0,
+0, 0, 0, 1038, 697, 0, 0, 0, 0, 866, 648, 0, 0, 0, 0, 934,
+1054, 0, 31, 34, 0, 666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 966, 975, 0, 0, 0, 0, 0, 0, 541, 806, 0, 0, 0, 0, 877,
+328, 0, 0, 0, 0, 983, 0, 0, 101, 271, 677, 927, 0, 0, 0, 0,
+84, 454, 0, 0, 0, 0, 0, 740, 0, 0, 199, 0, 0, 0, 0, 285,
+0, 0, 303, 0, 0, 0, 562, 801, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 721, 932, 1006, 0, 0, 0, 590, 0, 0, 0, 130,
+672, 0, 0, 0, 0, 0, 670, 0, 0, 0, 842, 0, 446, 538, 702, 0,
+0, 559, 0, 0, 0, 110, 844, 0, 752, 913, 0, 0, 0, 0, 0, 0,
+0, 0, 701, 0, 0, 65, 0, 0, 0, 360, 0, 0, 0, 0, 0, 0,
+0, 209, 596, 0, 0, 0, 0, 0, 0, 0, 0, 883, 0, 0, 0, 0,
+373, 0, 0, 0, 17, 106, 792, 0, 0, 399, 0, 0, 221, 0, 823, 22,
+0, 0, 0, 0, 0, 0, 0, 420, 0, 0, 0, 0, 0, 0, 171, 600,
+0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 358, 0,
+469, 714, 1037, 987, 1036, 940, 0, 0, 603, 0, 0, 6, 0, 295, 0, 0,
+0, 0, 907, 0, 906, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 882, 0, 0, 0, 0, 0, 0, 0,
+678, 0, 0, 0, 756, 0, 0, 914, 0, 0, 0, 0, 0, 0, 0, 0,
+1032, 0, 0, 0, 0, 0, 0, 0, 0, 785, 890, 0, 0, 281, 0, 0,
+0, 0, 406, 0, 0, 0, 0, 0, 0, 0, 85, 1048, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 996, 448, 859, 0, 0, 0,
+66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 758, 788, 479, 1042, 0,
+1013, 0, 159, 1049, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712,
+0, 546, 278, 0, 0, 0, 0, 0, 151, 931, 185, 0, 0, 0, 0, 430,
+0, 0, 0, 0, 86, 865, 1061, 0, 0, 520, 0, 0, 0, 1078, 0, 0,
+0, 0, 0, 302, 1024, 257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1057, 1058, 215, 350, 425, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0,
+0, 0, 617, 1091, 0, 0, 20, 652, 0, 0, 0, 0, 0, 0, 396, 0,
+0, 0, 713, 0, 0, 0, 0, 0, 0, 1003, 0, 0, 0, 410, 0, 777,
+0, 0, 566, 0, 210, 0, 816, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 851, 0, 0, 0, 426, 0, 163, 804, 0, 0, 0, 0, 500, 0, 0,
+0, 0, 0, 0, 0, 105, 745, 0, 0, 517, 0, 150, 0, 351, 0, 188,
+432, 0, 0, 0, 0, 225, 0, 234, 751, 0, 0, 0, 0, 522, 941, 0,
+615, 0, 512, 15, 856, 0, 0, 0, 0, 0, 0, 0, 1002, 641, 0, 0,
+836, 0, 0, 158, 0, 0, 630, 174, 182, 0, 0, 320, 0, 0, 0, 0,
+228, 0, 142, 64, 0, 0, 0, 0, 0, 256, 436, 180, 826, 534, 888, 0,
+0, 0, 0, 773, 338, 952, 0, 0, 833, 1007, 0, 0, 0, 0, 0, 0,
+531, 820, 0, 893, 0, 0, 0, 72, 601, 0, 0, 709, 0, 0, 322, 453,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1104, 640, 0, 530, 685, 0, 0,
+236, 592, 205, 730, 1062, 0, 548, 0, 0, 547, 484, 790, 0, 0, 0, 0,
+0, 472, 0, 0, 0, 0, 0, 0, 0, 706, 0, 431, 0, 109, 0, 0,
+527, 0, 0, 0, 0, 166, 0, 0, 0, 0, 0, 954, 192, 408, 526, 169,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 824, 0, 0, 0, 0, 0, 528,
+613, 1087, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 29, 136,
+0, 0, 0, 0, 0, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 734, 63, 972, 0, 0, 0, 0, 0, 375, 0, 0, 1066, 0, 841, 0,
+347, 1027, 0, 945, 0, 0, 0, 805, 0, 282, 0, 0, 0, 0, 0, 9,
+213, 0, 802, 608, 0, 1051, 658, 0, 0, 289, 55, 319, 686, 0, 392, 794,
+0, 0, 217, 993, 0, 0, 0, 441, 0, 348, 0, 0, 369, 960, 0, 0,
+0, 0, 0, 731, 684, 768, 0, 0, 973, 0, 0, 0, 0, 0, 0, 284,
+429, 0, 0, 0, 0, 0, 98, 242, 846, 936, 0, 0, 733, 259, 0, 0,
+0, 0, 0, 0, 0, 232, 529, 0, 0, 0, 0, 0, 587, 0, 0, 1052,
+0, 0, 0, 716, 726, 746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 680, 0, 800, 0, 132, 0, 0, 0, 0, 910, 0, 0, 0, 0, 543,
+1030, 0, 0, 193, 0, 0, 0, 0, 0, 0, 170, 0, 294, 780, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 683, 0, 0, 0, 0, 0, 0, 0, 419,
+0, 0, 0, 881, 0, 0, 0, 0, 0, 0, 434, 0, 0, 0, 0, 598,
+0, 0, 0, 0, 523, 0, 0, 0, 464, 0, 0, 334, 0, 0, 0, 0,
+275, 0, 626, 0, 0, 0, 0, 921, 1015, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1041, 0, 0, 0, 0, 90, 0, 10, 493, 707, 0, 0,
+0, 0, 0, 503, 776, 36, 623, 787, 919, 0, 0, 0, 0, 673, 0, 0,
+0, 0, 0, 129, 555, 0, 490, 0, 461, 138, 705, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 997, 0, 0, 0, 0, 0, 0, 75,
+0, 0, 207, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0, 45, 750, 795,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 540,
+0, 126, 111, 0, 0, 0, 0, 0, 775, 183, 0, 0, 1098, 735, 0, 0,
+606, 0, 0, 0, 957, 1107, 0, 0, 580, 455, 649, 173, 0, 258, 0, 0,
+0, 0, 0, 0, 0, 0, 719, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 675, 444, 607, 0, 959,
+0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 1099, 0, 0, 0, 0,
+0, 44, 937, 0, 0, 0, 0, 53, 0, 0, 127, 470, 340, 388, 757, 0,
+0, 0, 0, 838, 0, 0, 0, 0, 0, 0, 250, 667, 1033, 0, 783, 0,
+0, 0, 0, 0, 769, 710, 0, 0, 0, 679, 1063, 0, 263, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1000, 0, 0, 642, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 593, 0, 0, 140,
+853, 872, 0, 0, 0, 0, 144, 0, 0, 0, 878, 992, 674, 749, 0, 452,
+292, 0, 0, 0, 0, 62, 255, 1088, 0, 920, 571, 0, 0, 0, 19, 0,
+1022, 0, 0, 0, 0, 0, 0, 0, 287, 605, 916, 120, 770, 1081, 0, 415,
+0, 0, 1071, 0, 0, 668, 515, 0, 0, 0, 0, 0, 81, 0, 0, 0,
+421, 917, 0, 0, 0, 0, 0, 0, 0, 869, 0, 0, 0, 564, 381, 0,
+0, 42, 0, 0, 0, 440, 0, 131, 0, 0, 0, 521, 880, 0, 197, 161,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+51, 0, 0, 0, 620, 330, 179, 634, 1031, 0, 0, 312, 1094, 200, 0, 0,
+0, 300, 633, 949, 0, 0, 489, 0, 0, 0, 594, 0, 332, 497, 782, 573,
+0, 52, 504, 930, 1075, 1100, 0, 0, 563, 298, 0, 477, 0, 0, 0, 839,
+0, 0, 0, 0, 0, 124, 0, 0, 206, 107, 0, 539, 0, 0, 0, 0,
+0, 293, 335, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 729, 0, 0, 0, 0, 0, 0, 0, 476,
+0, 575, 0, 0, 0, 0, 1077, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+761, 0, 0, 0, 0, 113, 0, 118, 0, 0, 0, 0, 1072, 0, 0, 0,
+572, 655, 0, 0, 619, 574, 669, 995, 0, 0, 0, 0, 0, 0, 704, 0,
+0, 0, 184, 0, 0, 115, 0, 0, 1046, 0, 627, 0, 0, 0, 0, 0,
+0, 0, 349, 819, 0, 0, 0, 0, 0, 0, 636, 0, 0, 0, 0, 499
 };
 
 const EmojiItem chinese_emoji_table[] = {
-"㵴火"      , "🧯",
-"㵴火筒"     , "🧯",
-"一"       , "🕐",
-"一件头"     , "🩲",
-"一堆屎"     , "💩",
-"一杯奶"     , "🥛",
-"一次"      , "🔂",
-"一点"      , "🕐",
-"一点半"     , "🕜",
-"一百分"     , "💯",
-"一群"      , "🦬",
-"七"       , "🕖",
-"七点"      , "🕖",
-"七点半"     , "🕢",
-"万圣节"     , "🎃",
-"万字夹"     , "📎",
-"万岁"      , "🙌",
-"三"       , "🕒",
-"三十"      , "🕧",
-"三叉戟"     , "🔱",
-"三叶草"     , "☘",
-"三文治"     , "🥪",
-"三点"      , "🕒",
-"三点半"     , "🕞",
-"三角尺"     , "📐",
-"三角形"     , "📐",
-"三角旗"     , "🚩",
-"上"       , "👆",
-"上升"      , "💹",
-"上弦月"     , "🌓",
-"上锁"      , "🔒",
-"下"       , "👇",
-"下弦月"     , "🌗",
-"下跌"      , "📉",
-"不"       , "🙈",
-"不久"      , "🔜",
-"不关心"     , "🤷",
-"不准"      , "⛔",
-"不可"      , "⛔",
-"丑小鸭"     , "🦢",
-"世界"      , "🌍",
-"丘比特"     , "💘",
-"业务"      , "👨‍💼",
-"东"       , "➡",
-"东京"      , "🗼",
-"东北"      , "↗",
-"东南"      , "↘",
-"丝带"      , "🎗",
-"两个心"     , "💕",
-"两点"      , "🕑",
-"两点半"     , "🕝",
-"个人"      , "💻",
-"中国帽"     , "👲",
-"中心"      , "🫀",
-"中性"      , "🧒",
-"中指"      , "🖕",
-"中暑"      , "🥵",
-"中等"      , "🔉",
-"中肤色"     , "🏽",
-"串"       , "🍡",
-"串烧"      , "🍢",
-"丸子"      , "🍡",
-"丹参树"     , "🎋",
-"举手"      , "✋",
-"举起"      , "🤚",
-"举重"      , "🏋",
-"举重者"     , "🏋",
-"义肢"      , "🦾",
-"乌蝇"      , "🪰",
-"乐谱"      , "🎼",
-"乒乓"      , "🏓",
-"乒乓球"     , "🏓",
-"乘"       , "✖",
-"乘客"      , "🛳",
-"乘法"      , "✖",
-"九"       , "🕘",
-"九点"      , "🕘",
-"九点半"     , "🕤",
-"乞嚏"      , "🤧",
-"乞讨"      , "🥺",
-"书"       , "📔",
-"书包"      , "🎒",
-"书呆子"     , "🤓",
-"书签"      , "📑",
-"乳制品"     , "🧈",
-"乳房"      , "🤱",
-"乳液"      , "🧴",
-"乳液樽"     , "🧴",
-"二"       , "🕑",
-"二头肌"     , "💪",
-"亏"       , "🌖",
-"亏凸月"     , "🌖",
-"云"       , "☁",
-"五"       , "🕔",
-"五点"      , "🕔",
-"五点半"     , "🕠",
-"亚洲"      , "🌏",
-"亡灵"      , "🧛",
-"交叉"      , "🤞",
-"交叉旗"     , "🎌",
-"交叉骨"     , "☠",
-"交通"      , "🚥",
-"亮度"      , "🔅",
-"人"       , "🧑‍🍼",
-"人马座"     , "♐",
-"人鱼"      , "🧜",
-"仓鼠"      , "🐹",
-"仓鼠脸"     , "🐹",
-"仙人掌"     , "🌵",
-"仙子"      , "🧚",
-"仪器"      , "🎷",
-"仪式"      , "🎑",
-"企"       , "🧍",
-"企鹅"      , "🐧",
-"会计"      , "🧾",
-"传呼机"     , "📟",
-"传真"      , "📠",
-"传真机"     , "📠",
-"伤心"      , "😢",
-"低"       , "🔅",
-"低手"      , "🥎",
-"体操"      , "🤸",
-"体育场"     , "🏟",
-"佛教"      , "☸",
-"佛法"      , "☸",
-"佛法轮"     , "☸",
-"侦探"      , "🕵",
-"侧手翻"     , "🤸",
-"便利店"     , "🏪",
-"便当"      , "🍱",
-"便条"      , "📝",
-"俄罗斯"     , "🪆",
-"保健员"     , "🧑‍⚕",
-"保龄球"     , "🎳",
-"信"       , "💌",
-"信号"      , "🚥",
-"信封"      , "✉",
-"信用"      , "💳",
-"信用卡"     , "💳",
-"信箱"      , "📫",
-"修甲"      , "💅",
-"假扮"      , "🥸",
-"停"       , "🚏",
-"停止"      , "🛑",
-"健康"      , "🤧",
-"傍晚"      , "🌆",
-"傻笑"      , "😏",
-"傻笑脸"     , "😏",
-"光"       , "🪶",
-"光亮"      , "☀",
-"光头"      , "🦲",
-"光学"      , "💽",
-"光环"      , "😇",
-"光碟"      , "💽",
-"免费"      , "🈚",
-"兑换"      , "💱",
-"兔"       , "🐰",
-"兔耳"      , "👯",
-"兔脸"      , "🐰",
-"入场"      , "🎟",
-"入场券"     , "🎟",
-"八"       , "🕗",
-"八点"      , "🕗",
-"八点半"     , "🕣",
-"八角形"     , "🛑",
-"八角星"     , "✳",
-"公"       , "🐏",
-"公主"      , "👸",
-"公事包"     , "💼",
-"公仔"      , "🪆",
-"公园"      , "🏞",
-"公牛"      , "🐂",
-"公羊"      , "🐏",
-"公路"      , "🛣",
-"公鸡"      , "🐓",
-"六"       , "🕕",
-"六点"      , "🕕",
-"六点半"     , "🕡",
-"关闭"      , "📫",
-"兴奋"      , "💖",
-"内"       , "💠",
-"内衣"      , "🩲",
-"冇位"      , "🈵",
-"写字"      , "✍",
-"军事"      , "🪖",
-"军队"      , "🪖",
-"农夫"      , "🧑‍🌾",
-"农夫车"     , "🛻",
-"冥想"      , "🧘",
-"冬甩"      , "🍩",
-"冰"       , "🥶",
-"冰冷"      , "😓",
-"冰块"      , "🧊",
-"冰川"      , "🐻‍❄",
-"冰球"      , "🏒",
-"冲凉"      , "🛀",
-"冷球"      , "🧶",
-"冻"       , "😅",
-"冻伤"      , "🥶",
-"冻结"      , "🥶",
-"凉鞋"      , "🩴",
-"凋谢"      , "🥀",
-"减"       , "➖",
-"几何"      , "🔴",
-"出发"      , "🛫",
-"出汗"      , "🥵",
-"击中"      , "🎯",
-"刀"       , "🍽",
-"分开"      , "🪓",
-"分数"      , "💯",
-"分类"      , "🗂",
-"分量"      , "🥃",
-"划艇"      , "🚣",
-"初学者"     , "🔰",
-"刨"       , "🍧",
-"刨冰"      , "🍧",
-"利"       , "🪒",
-"利是"      , "🧧",
-"利是封"     , "🧧",
-"到达"      , "🛬",
-"制服"      , "🥋",
-"刷"       , "🪥",
-"券"       , "🎟",
-"刺"       , "🦔",
-"刺猬"      , "🦔",
-"刺绣"      , "🪡",
-"剃刀"      , "🪒",
-"剃头"      , "🦲",
-"剃须"      , "🪒",
-"剑"       , "🤺",
-"剑击"      , "🤺",
-"剔号"      , "✅",
-"剧场"      , "🎭",
-"剪"       , "✂",
-"剪头发"     , "💇‍♂",
-"剪影"      , "🗣",
-"割"       , "🈹",
-"办公室"     , "👨‍💼",
-"加"       , "➕",
-"勾"       , "🪝",
-"包头"      , "🧕",
-"包装"      , "🎁",
-"包裹"      , "📦",
-"匆忙"      , "😰",
-"匕首"      , "🗡",
-"化妆"      , "💄",
-"化妆品"     , "💅",
-"化学"      , "⚗",
-"化学家"     , "🧑‍🔬",
-"化疗"      , "🦲",
-"北"       , "⬆",
-"北极熊"     , "🐻‍❄",
-"匙羮"      , "🥄",
-"医生"      , "😷",
-"医疗"      , "🩸",
-"医药"      , "💉",
-"医院"      , "🏥",
-"匿名"      , "🥸",
-"十"       , "🕙",
-"十一"      , "🕦",
-"十一点"     , "🕚",
-"十二"      , "🕛",
-"十二点"     , "🕛",
-"十八岁"     , "🔞",
-"十字架"     , "⛪",
-"十点"      , "🕙",
-"十点半"     , "🕥",
-"升降机"     , "🛗",
-"半"       , "🚛",
-"协助"      , "🐕‍🦺",
-"卒"       , "🤌",
-"卒手指"     , "🤌",
-"单车"      , "🚴",
-"单轨"      , "🚝",
-"卖点"      , "🪝",
-"南"       , "⬇",
-"南瓜"      , "🎃",
-"博物馆"     , "🖼",
-"卡"       , "💳",
-"卡片"      , "🗂",
-"卡片盒"     , "📇",
-"卡车"      , "🚒",
-"卫星"      , "🛰",
-"卫生"      , "🪥",
-"卫生间"     , "🚹",
-"印"       , "👣",
-"印度寺"     , "🛕",
-"印度教"     , "🕉",
-"危险"      , "⚡",
-"卷"       , "🧵",
-"卷发"      , "🦱",
-"卷心菜"     , "🥬",
-"卷曲"      , "🦱",
-"卷曲圈"     , "➰",
-"卷纸"      , "🧻",
-"卷起"      , "🗞",
-"卷页"      , "📃",
-"卷饼"      , "🌯",
-"压"       , "🗜",
-"厌倦"      , "🙀",
-"厕所"      , "🚽",
-"厕所泵"     , "🪠",
-"厕纸"      , "🧻",
-"原子"      , "⚛",
-"原子笔"     , "🖊",
-"原驼"      , "🦙",
-"厨师"      , "🧑‍🍳",
-"厨房刀"     , "🔪",
-"叉"       , "🍽",
-"叉同刀"     , "🍴",
-"双"       , "⏸",
-"双子"      , "♊",
-"双子座"     , "👬",
-"双眼"      , "👀",
-"双耳瓶"     , "🏺",
-"双胞胎"     , "👬",
-"双重"      , "⏩",
-"双鱼座"     , "🐟",
-"反射"      , "🪃",
-"反射器"     , "🪞",
-"反射镜"     , "🪞",
-"反弹"      , "🪃",
-"反手"      , "🤚",
-"发件箱"     , "📤",
-"发光"      , "🌟",
-"发出"      , "📩",
-"发动机"     , "🚂",
-"发型师"     , "💇",
-"发明家"     , "🧑‍💻",
-"发烧"      , "🦟",
-"发疯"      , "😡",
-"发癫"      , "😠",
-"发誓"      , "🤬",
-"发送"      , "📩",
-"取消"      , "✖",
-"受伤"      , "🤕",
-"口罩"      , "😷",
-"口震"      , "😱",
-"古典"      , "🏛",
-"可"       , "🉑",
-"台风"      , "🌀",
-"叶"       , "🌿",
-"号角"      , "🥳",
-"合"       , "🈴",
-"合埋"      , "😚",
-"合手"      , "🙏",
-"合格"      , "🈴",
-"吊钟"      , "🔔",
-"同情"      , "😮",
-"同意"      , "🤝",
-"名牌"      , "📛",
-"向上"      , "💹",
-"向下"      , "⬇",
-"向右"      , "🤜",
-"向左"      , "🤛",
-"吓亲"      , "😲",
-"吓惊"      , "😯",
-"听"       , "🙉",
-"听筒"      , "🩺",
-"听障"      , "🦻",
-"吸力"      , "🧲",
-"吸气"      , "🫁",
-"吸水"      , "🧽",
-"吸烟"      , "🚬",
-"吸血鬼"     , "🧛",
-"吹"       , "🍃",
-"吻"       , "😘",
-"呕吐"      , "🤢",
-"呕心"      , "🤢",
-"员工"      , "⚕",
-"呜咽"      , "😭",
-"呢度"      , "🈁",
-"呼"       , "😥",
-"呼叫"      , "🤭",
-"呼吸"      , "🫁",
-"呼气"      , "🫁",
-"咀唇"      , "💋",
-"和平"      , "🕊",
-"和服"      , "👘",
-"咖哩"      , "🍛",
-"咖哩饭"     , "🍛",
-"咖啡"      , "☕",
-"咧嘴笑"     , "😁",
-"咪"       , "🎙",
-"咪高峰"     , "🎙",
-"哺乳"      , "👨‍🍼",
-"哺育"      , "🧑‍🍼",
-"唇印"      , "💋",
-"唇膏"      , "💄",
-"唔准"      , "🙈",
-"唔吉利"     , "🐈‍⬛",
-"唔好"      , "🙈",
-"唔客气"     , "😑",
-"唔开心"     , "😒",
-"唔相信"     , "🤦",
-"唵"       , "🕉",
-"啄木鸟"     , "🦜",
-"商业"      , "🧑‍💼",
-"商人"      , "👨‍🔧",
-"商店"      , "🏪",
-"商标"      , "™",
-"啡色"      , "🤎",
-"啡色心"     , "🤎",
-"啤酒"      , "🍺",
-"啤酒杯"     , "🍺",
-"啧水"      , "🐳",
-"喂哺"      , "🧑‍🍼",
-"喇叭"      , "🔇",
-"喊"       , "😢",
-"喊嘅脸"     , "😢",
-"喷水池"     , "⛲",
-"嗯"       , "😋",
-"嘘"       , "🤫",
-"嘘嘅脸"     , "🤫",
-"嘟嘟鸟"     , "🦤",
-"嘭嘭"      , "‼",
-"嘲笑"      , "🤌",
-"嘴"       , "😃",
-"噢"       , "🙀",
-"器官"      , "🫀",
-"四"       , "🍀",
-"四叶草"     , "🍀",
-"四点"      , "🕓",
-"四点半"     , "🕟",
-"回力镖"     , "🪃",
-"回带"      , "◀",
-"团"       , "🍙",
-"园丁"      , "🧑‍🌾",
-"困惑"      , "😖",
-"国王"      , "👑",
-"图"       , "💹",
-"图片"      , "🖼",
-"图表"      , "💹",
-"圆屋"      , "🛖",
-"圆形"      , "⏺",
-"圆碌碌"     , "🙄",
-"圆禁钉"     , "📍",
-"圈"       , "➰",
-"圈套"      , "🪝",
-"土星"      , "🪐",
-"圣诞树"     , "🎄",
-"圣诞节"     , "🎅",
-"在"       , "🔛",
-"地下"      , "🤣",
-"地图"      , "🗺",
-"地球"      , "🌍",
-"地球仪"     , "🌍",
-"地铁"      , "🚇",
-"场所"      , "🛐",
-"坏人"      , "🦹",
-"坐"       , "🪑",
-"块"       , "🧩",
-"坚硬"      , "🪨",
-"坟墓"      , "🪦",
-"坠落"      , "🌠",
-"垂直"      , "⏸",
-"垃圾"      , "🚮",
-"垃圾桶"     , "🚮",
-"垒球"      , "🥎",
-"垫"       , "🗒",
-"城堡"      , "🏯",
-"城市"      , "🏙",
-"培养皿"     , "🧫",
-"培育"      , "🪴",
-"基因"      , "🧬",
-"基点"      , "⬆",
-"基点间"     , "↗",
-"基督徒"     , "⛪",
-"基督教"     , "✝",
-"塔"       , "🗼",
-"墓地"      , "🪦",
-"墓碑"      , "🪦",
-"墙"       , "🧱",
-"增长"      , "💹",
-"墨水"      , "🔏",
-"墨西哥"     , "🫔",
-"士兵"      , "🪖",
-"士巴拿"     , "🛠",
-"壳"       , "🐚",
-"壶"       , "🫖",
-"处女"      , "👧",
-"处女座"     , "♍",
-"夏日"      , "🍹",
-"外卖盒"     , "🥡",
-"外套"      , "🧥",
-"外星"      , "👽",
-"外星人"     , "👽",
-"外框"      , "❔",
-"外送盘"     , "📤",
-"多动作"     , "🤹",
-"多窿"      , "🧽",
-"多谢"      , "🫂",
-"夜晚"      , "🌃",
-"大"       , "🦣",
-"大卫"      , "✡",
-"大厦"      , "🏢",
-"大厨"      , "👨‍🍳",
-"大声"      , "🔊",
-"大声公"     , "📢",
-"大头针"     , "📌",
-"大桥"      , "🌉",
-"大烛台"     , "🕎",
-"大猩猩"     , "🦍",
-"大羊驼"     , "🦙",
-"大虾"      , "🍤",
-"大象"      , "🐘",
-"大阶"      , "🔠",
-"大雾"      , "🌁",
-"天使"      , "😇",
-"天妇罗"     , "🍤",
-"天房"      , "🕋",
-"天气"      , "🌡",
-"天父"      , "🎅",
-"天真"      , "😇",
-"天秤"      , "⚖",
-"天秤座"     , "⚖",
-"天线"      , "📡",
-"天线棒"     , "📶",
-"天蝎座"     , "🦂",
-"天鹅"      , "🦢",
-"太空"      , "🛰",
-"太空人"     , "🧑‍🚀",
-"太阳"      , "😎",
-"太阳花"     , "🌻",
-"夫妇"      , "👭",
-"失望"      , "😥",
-"头"       , "🗣",
-"头发"      , "🦳",
-"头巾"      , "👳",
-"头晕"      , "😵",
-"头盔"      , "🪖",
-"奇异果"     , "🥝",
-"奇怪"      , "🤓",
-"奖"       , "🏆",
-"奖杯"      , "🏆",
-"奖牌"      , "🎖",
-"奥布朗"     , "🧚",
-"女"       , "👱‍♀",
-"女人"      , "👩",
-"女仔"      , "👧",
-"女仙子"     , "🧚‍♀",
-"女侦探"     , "🕵‍♀",
-"女农夫"     , "👩‍🌾",
-"女厕"      , "🚺",
-"女厨师"     , "👩‍🍳",
-"女士"      , "👠",
-"女学生"     , "👩‍🎓",
-"女巫"      , "🪄",
-"女巫师"     , "🧙‍♀",
-"女技工"     , "👩‍🔧",
-"女教师"     , "👩‍🏫",
-"女歌手"     , "👩‍🎤",
-"女殭尸"     , "🧟‍♀",
-"女法官"     , "👩‍⚖",
-"女王"      , "👑",
-"女精灵"     , "🧝‍♀",
-"女装"      , "👚",
-"女装帽"     , "👒",
-"女装靴"     , "👢",
-"女警察"     , "👮‍♀",
-"女超人"     , "🦸‍♀",
-"奶"       , "🍼",
-"好"       , "🦸",
-"好奇"      , "🦝",
-"好累"      , "😩",
-"好运"      , "🧧",
-"好食"      , "😋",
-"妈妈"      , "🤶",
-"妖"       , "👿",
-"姓名"      , "📛",
-"姿势"      , "🙇",
-"威士忌"     , "🥃",
-"娃娃"      , "🎎",
-"娥眉月"     , "🌒",
-"娱乐"      , "🚙",
-"娱乐家"     , "🧑‍🎤",
-"婚礼"      , "👰",
-"婴儿"      , "👶",
-"嬲"       , "😡",
-"嬲嘅脸"     , "😠",
-"子午线"     , "🌐",
-"子弹"      , "🚅",
-"孔雀"      , "🦚",
-"孕妇"      , "🤰",
-"字母"      , "🔠",
-"学校"      , "🏫",
-"学生"      , "🧑‍🎓",
-"孵化"      , "🐣",
-"守卫员"     , "💂",
-"安全"      , "🦺",
-"安息"      , "🪦",
-"安静"      , "🔇",
-"完全"      , "😲",
-"宗教"      , "⛪",
-"宝石"      , "💎",
-"宝藏"      , "🪙",
-"实验"      , "🥼",
-"实验室"     , "🧪",
-"实验袍"     , "🥼",
-"宠物"      , "🐶",
-"客厅"      , "💇",
-"客船"      , "🛳",
-"害怕"      , "😨",
-"家"       , "🏠",
-"家庭"      , "👪",
-"家禽"      , "🍗",
-"寄信"      , "💌",
-"寄存"      , "🛅",
-"寄生虫"     , "🪱",
-"密码"      , "🔑",
-"富士"      , "🗻",
-"富士山"     , "🗻",
-"寒冷"      , "🌨",
-"寒冷的"     , "🏔",
-"对"       , "🆚",
-"对唔住"     , "🙇",
-"对话"      , "💬",
-"寺庙"      , "🛕",
-"导师"      , "🧑‍🏫",
-"导盲"      , "🦮",
-"导盲犬"     , "🦮",
-"导航"      , "🧭",
-"寿司"      , "🍣",
-"封面"      , "📔",
-"射击"      , "🌠",
-"射手"      , "🏹",
-"射手座"     , "🏹",
-"射箭"      , "🏹",
-"射线"      , "☀",
-"小"       , "🦐",
-"小丑"      , "🤡",
-"小丑脸"     , "🤡",
-"小天鹅"     , "🦢",
-"小妖精"     , "👺",
-"小屋"      , "🛖",
-"小巴"      , "🚐",
-"小提琴"     , "🎻",
-"小教堂"     , "💒",
-"小水滴"     , "💧",
-"小童"      , "🧒",
-"小精灵"     , "🧝",
-"小量"      , "🤏",
-"小阶"      , "🔡",
-"小鸡"      , "🐣",
-"尺度"      , "🧑‍⚖",
-"尿片"      , "🧷",
-"屋"       , "🪴",
-"屎"       , "💩",
-"山"       , "🏔",
-"山地"      , "🚵",
-"山羊"      , "🐐",
-"山羊座"     , "🐐",
-"岗位"      , "🚩",
-"岛"       , "🏝",
-"崇拜"      , "🥰",
-"巡逻"      , "🚓",
-"工业"      , "🧑‍🏭",
-"工人"      , "🧑‍🏭",
-"工具"      , "🪚",
-"工具箱"     , "🧰",
-"工厂"      , "🧑‍🏭",
-"工程师"     , "🧑‍🔬",
-"巨灵"      , "🧞",
-"巨石"      , "🪨",
-"巨蛇"      , "🐍",
-"巨蟹座"     , "🦀",
-"巫婆"      , "🧙",
-"巫师"      , "🪄",
-"巴士"      , "🚌",
-"巴士站"     , "🚏",
-"市场"      , "💹",
-"布甸"      , "🍮",
-"帆船"      , "⛵",
-"帐单"      , "💴",
-"帐篷"      , "⛺",
-"帕克"      , "🧚",
-"带"       , "📼",
-"帮助"      , "💁",
-"常青树"     , "🌲",
-"帽"       , "🤠",
-"干净"      , "🪥",
-"平底镬"     , "🍳",
-"平底鞋"     , "🥿",
-"平行"      , "🤹",
-"年青"      , "👶",
-"幸运"      , "🤞",
-"幻想"      , "😇",
-"幼小"      , "🌱",
-"幼苗"      , "🌱",
-"庆祝"      , "🪅",
-"床"       , "🛏",
-"废纸篓"     , "🗑",
-"度假村"     , "⛵",
-"座位"      , "💺",
-"座灯"      , "🛋",
-"康加鼓"     , "🪘",
-"建筑"      , "👷",
-"建筑师"     , "🧑‍💼",
-"建造"      , "🏗",
-"开"       , "🔓",
-"开会"      , "🤝",
-"开发者"     , "🧑‍💻",
-"开屏"      , "🦚",
-"开玩笑"     , "😜",
-"开花"      , "🌸",
-"开酒塞"     , "🍾",
-"弓"       , "🏹",
-"弓箭"      , "🏹",
-"张开"      , "🖐",
-"弦月"      , "🌒",
-"弦线"      , "🪕",
-"弯"       , "🪝",
-"弯曲"      , "🪝",
-"录像机"     , "📹",
-"录制"      , "⏺",
-"录影带"     , "📼",
-"录影机"     , "📼",
-"录音室"     , "🎙",
-"彗星"      , "☄",
-"彩虹"      , "🌈",
-"彩虹旗"     , "🏳‍🌈",
-"影片"      , "📻",
-"得"       , "🉐",
-"微生物"     , "🦠",
-"微笑"      , "🥲",
-"德古拉"     , "🧛",
-"徽章"      , "🔱",
-"心"       , "💌",
-"心脏"      , "🫀",
-"心跳"      , "🫀",
-"忌廉"      , "🍦",
-"忍者"      , "🥷",
-"忧心"      , "😔",
-"快"       , "⏩",
-"快乐"      , "😂",
-"快到"      , "🚔",
-"快艇"      , "🚤",
-"快走"      , "💨",
-"快进"      , "⏩",
-"快速"      , "💨",
-"念珠"      , "📿",
-"怀孕"      , "🤰",
-"怀疑"      , "🤨",
-"怜悯"      , "🥺",
-"怪物"      , "💀",
-"恋爱"      , "🥰",
-"恐布"      , "😝",
-"恭喜"      , "㊗",
-"恶魔"      , "👿",
-"您好"      , "🫂",
-"悬架"      , "🚟",
-"情人"      , "💝",
-"情侣"      , "🧑‍🤝‍🧑",
-"情信"      , "💌",
-"惊叫"      , "😱",
-"惊恐"      , "😨",
-"惊慌"      , "😨",
-"惊讶"      , "😯",
-"惧怕"      , "😱",
-"想法"      , "💡",
-"感动"      , "🥲",
-"感叹号"     , "‼",
-"感叹嘅"     , "❣",
-"感激"      , "🥲",
-"感谢"      , "🙇‍♂",
-"愤怒"      , "😡",
-"慢"       , "🦥",
-"懒"       , "🦥",
-"戏"       , "🎞",
-"戏院"      , "🎥",
-"成人"      , "🧑",
-"成长"      , "🪴",
-"我爱您"     , "🤟",
-"戒指"      , "💍",
-"战士"      , "🪖",
-"战斗机"     , "🥷",
-"房屋"      , "🏚",
-"手"       , "👋",
-"手势"      , "🤌",
-"手卷"      , "🫔",
-"手套"      , "🥎",
-"手指"      , "🤌",
-"手指公"     , "👍",
-"手掌"      , "🤦",
-"手提袋"     , "👝",
-"手机"      , "🤳",
-"手枪"      , "🔫",
-"手球"      , "🤾",
-"手瓜"      , "💪",
-"手表"      , "⌚",
-"手袋"      , "👜",
-"手风琴"     , "🪗",
-"手鼓"      , "🪘",
-"扒"       , "🥩",
-"打"       , "✊",
-"打印机"     , "🖨",
-"打喊露"     , "🥱",
-"打开"      , "🪟",
-"打开手"     , "👐",
-"打扮"      , "🧑‍🎄",
-"打气"      , "📣",
-"打电话"     , "🤙",
-"托盘"      , "📤",
-"扣针"      , "🧷",
-"扩音器"     , "📣",
-"扫"       , "🧹",
-"扫把"      , "🧹",
-"扭"       , "🪢",
-"扭歪"      , "😼",
-"扭纹"      , "🥨",
-"扳手"      , "🛠",
-"批"       , "🥧",
-"技工"      , "🧑‍🔧",
-"技术"      , "🤹",
-"投币口"     , "🎰",
-"投票"      , "🗳",
-"抗议"      , "🪧",
-"折扣"      , "🈹",
-"抢"       , "🏴‍☠",
-"护士"      , "🧑‍⚕",
-"护照"      , "🛂",
-"护理"      , "💅",
-"护符"      , "🧿",
-"护镜"      , "🥽",
-"报纸"      , "📰",
-"抱抱"      , "🫂",
-"抵达"      , "🛬",
-"担心"      , "😟",
-"拉丁"      , "🔠",
-"拉链"      , "🤐",
-"拉面"      , "🍜",
-"拍子"      , "🪘",
-"拍手"      , "👏",
-"拍板"      , "🎬",
-"拖"       , "👭",
-"拖住"      , "🧑‍🤝‍🧑",
-"拖头车"     , "🚛",
-"拖拉机"     , "🚜",
-"拖鞋"      , "🥿",
-"招牌"      , "💈",
-"拜拜"      , "🫂",
-"拥抱"      , "🫂",
-"拳击"      , "🥊",
-"拳头"      , "✊",
-"拳套"      , "🥊",
-"持有人"     , "🐍",
-"指"       , "👈",
-"指南针"     , "🧭",
-"指向"      , "👈",
-"指甲"      , "💅",
-"指甲油"     , "💅",
-"按摩"      , "💆",
-"按钮"      , "🔼",
-"挑"       , "⛏",
-"挥手"      , "👋",
-"挥紧手"     , "👋",
-"捏手"      , "🤏",
-"捐血"      , "🩸",
-"损伤"      , "🤕",
-"换片"      , "🚼",
-"掌"       , "🐾",
-"掌印"      , "🐾",
-"排球"      , "🏐",
-"探热针"     , "🤒",
-"接受"      , "🉑",
-"接收"      , "📨",
-"控制"      , "🎛",
-"控制器"     , "🎮",
-"提子"      , "🍇",
-"提示"      , "💁",
-"插头"      , "🔌",
-"握"       , "🤝",
-"握手"      , "🤝",
-"握紧"      , "✊",
-"揽"       , "🤗",
-"搜寻"      , "🔍",
-"搞笑"      , "💢",
-"摇"       , "🪀",
-"摇摇"      , "🪀",
-"摇滚"      , "🤘",
-"摔交"      , "🤼",
-"摔交手"     , "🤼",
-"摧毁"      , "⚡",
-"摩天轮"     , "🎡",
-"摩艾"      , "🗿",
-"撅嘴"      , "😡",
-"播放"      , "▶",
-"收件盘"     , "📥",
-"收件箱"     , "📥",
-"收到"      , "📲",
-"收据"      , "🧾",
-"收费"      , "🈶",
-"收集"      , "🛻",
-"收音机"     , "📻",
-"放低"      , "📪",
-"放大"      , "🔍",
-"放射性"     , "☢",
-"放映机"     , "📽",
-"放松"      , "☺",
-"救护车"     , "🚑",
-"救生衣"     , "🦺",
-"教堂"      , "⛪",
-"教师"      , "👨‍🏫",
-"教授"      , "🧑‍🏫",
-"散子"      , "👛",
-"散子包"     , "👛",
-"敬礼"      , "🖖",
-"数字"      , "🔢",
-"数学"      , "➕",
-"数学家"     , "👨‍🔬",
-"文件"      , "📃",
-"文件夹"     , "📁",
-"文化"      , "🧫",
-"斑点"      , "🦒",
-"斑马"      , "🦓",
-"斧头"      , "🪓",
-"斩"       , "🪓",
-"新娘"      , "👰",
-"新干线"     , "🚄",
-"新月"      , "🌑",
-"新月面"     , "🌚",
-"新郎"      , "🤵",
-"新闻"      , "📰",
-"方位"      , "🧭",
-"方便"      , "🏪",
-"方向"      , "⬆",
-"方格旗"     , "🏁",
-"旅行"      , "🧳",
-"旋转"      , "💞",
-"旋风"      , "🌪",
-"旗"       , "🎏",
-"无"       , "🈚",
-"无声"      , "😶",
-"无头发"     , "🦲",
-"无用"      , "🪴",
-"无知"      , "🤷",
-"无表情"     , "😐",
-"无表达"     , "😑",
-"无限"      , "♾",
-"无限制"     , "♾",
-"无障碍"     , "🛗",
-"日元"      , "💹",
-"日出"      , "🌄",
-"日历"      , "📅",
-"日圆"      , "💴",
-"日式"      , "🏣",
-"日期"      , "📅",
-"日本"      , "🍙",
-"日落"      , "🌆",
-"旧"       , "🗝",
-"旧锁匙"     , "🗝",
-"早上"      , "🌄",
-"早餐"      , "🥣",
-"时钟"      , "⌚",
-"时髦"      , "💁",
-"昆虫"      , "🪲",
-"明星"      , "🤩",
-"明星脸"     , "🤩",
-"星"       , "💫",
-"星夜"      , "🌃",
-"星座"      , "👧",
-"星星"      , "🌃",
-"显微镜"     , "🔬",
-"晕"       , "🥴",
-"晚上"      , "🌉",
-"晚礼服"     , "🤵",
-"景观"      , "🪟",
-"晴朗"      , "☀",
-"智力"      , "🧠",
-"智慧"      , "🦉",
-"暂停"      , "⏯",
-"暗"       , "🔅",
-"暴龙"      , "🦖",
-"曱甴"      , "🪳",
-"曲发"      , "🦱",
-"曲奇"      , "🍪",
-"曲棍球"     , "🏑",
-"月"       , "🌒",
-"月亮"      , "🌑",
-"月经"      , "🩸",
-"月费"      , "🈷",
-"月饼"      , "🥮",
-"有"       , "🈶",
-"有雾"      , "🌁",
-"服务"      , "🐕‍🦺",
-"服务员"     , "🛎",
-"服务费"     , "🈂",
-"服装"      , "👣",
-"望远镜"     , "🔭",
-"木"       , "🪓",
-"木头"      , "🪵",
-"木屐"      , "🩴",
-"木工"      , "🪚",
-"木材"      , "🪚",
-"木桶"      , "🪣",
-"木锯"      , "🪚",
-"未成年"     , "🔞",
-"朱古力"     , "🫕",
-"机动船"     , "🛥",
-"机械人"     , "🤖",
-"机械脚"     , "🦿",
-"机械臂"     , "🦾",
-"杂耍"      , "🤹",
-"条"       , "🍫",
-"条纹"      , "🦓",
-"来"       , "📨",
-"杯"       , "🥛",
-"松树"      , "🎍",
-"板"       , "🛹",
-"板手"      , "🔧",
-"板球"      , "🏏",
-"果仁"      , "🥜",
-"果汁"      , "🥤",
-"果汁盒"     , "🧃",
-"果汁酒"     , "🥥",
-"枪"       , "🎉",
-"枫叶"      , "🍁",
-"枫树"      , "🍁",
-"柑桔"      , "🍊",
-"柑橘"      , "🍋",
-"柔软"      , "🔈",
-"柔道"      , "🥋",
-"柜"       , "🗄",
-"柠檬"      , "🍋",
-"标志"      , "🪧",
-"标签"      , "📑",
-"标记"      , "📑",
-"标语"      , "🪧",
-"树"       , "🌲",
-"树熊"      , "🐨",
-"树獭"      , "🦥",
-"栗子"      , "🌰",
-"格子"      , "🏁",
-"桃"       , "🍑",
-"框架"      , "🪟",
-"框画"      , "🖼",
-"桌球"      , "🎱",
-"桌面"      , "🖥",
-"桑拿"      , "🧖",
-"档案"      , "📁",
-"档案柜"     , "🗄",
-"桶"       , "🛢",
-"梅花"      , "♣",
-"梨"       , "🍐",
-"梯"       , "🪜",
-"梯级"      , "🪜",
-"梳打"      , "🥤",
-"检查"      , "🛂",
-"棍"       , "🥍",
-"棒"       , "🍢",
-"棒型图"     , "📊",
-"棒球"      , "⚾",
-"棒球帽"     , "🧢",
-"棕榈"      , "🌴",
-"棕榈树"     , "🌴",
-"棺材"      , "⚰",
-"植物"      , "🪴",
-"椰子"      , "🥥",
-"榄球"      , "🏉",
-"槿"       , "🌺",
-"模式"      , "📳",
-"横额"      , "🎋",
-"樱花"      , "🌸",
-"樽"       , "🍼",
-"橄榄"      , "🫒",
-"橙"       , "🍊",
-"橙色"      , "🧡",
-"橙色书"     , "📙",
-"橙色心"     , "🧡",
-"櫈"       , "💺",
-"欧元"      , "💶",
-"欧洲"      , "🌍",
-"欧陆式"     , "🏰",
-"歌手"      , "🧑‍🎤",
-"歌记号"     , "〽",
-"正义"      , "👨‍⚖",
-"正方形"     , "⏹",
-"步"       , "🪜",
-"武器"      , "🔪",
-"武术"      , "🥋",
-"死"       , "💀",
-"死亡"      , "☠",
-"残月"      , "🌘",
-"殡仪馆"     , "⚱",
-"殭尸"      , "🧟",
-"毒菌"      , "🍄",
-"比坚尼"     , "👙",
-"比赛"      , "🏐",
-"比高包"     , "🥯",
-"毕业"      , "🧑‍🎓",
-"毕业帽"     , "🎓",
-"毛绒"      , "🧸",
-"气体"      , "⛽",
-"气球"      , "💬",
-"水"       , "🤽",
-"水坝"      , "🦫",
-"水晶"      , "🔮",
-"水晶球"     , "🔮",
-"水果"      , "🥭",
-"水桶"      , "🪣",
-"水泥"      , "🧱",
-"水点"      , "☔",
-"水牛"      , "🦬",
-"水狸"      , "🦫",
-"水球"      , "🤽",
-"水瓶座"     , "🏺",
-"水龟"      , "🐢",
-"永远"      , "♾",
-"求助"      , "🆘",
-"汉堡包"     , "🍔",
-"汗"       , "😅",
-"汽球"      , "🎈",
-"汽车"      , "🚞",
-"沉默"      , "😯",
-"沙"       , "⌛",
-"沙发"      , "🛋",
-"沙律"      , "🥗",
-"沙漏"      , "⏳",
-"沙漠"      , "🏜",
-"沮丧"      , "😔",
-"河马"      , "🦛",
-"油"       , "🛢",
-"油桶"      , "🛢",
-"治疗师"     , "🧑‍⚕",
-"治疗犬"     , "🐕‍🦺",
-"泉"       , "♨",
-"泊车"      , "🅿",
-"法国"      , "🥐",
-"法官"      , "🧑‍⚖",
-"法式"      , "🥖",
-"泡"       , "🧋",
-"泡泡"      , "💬",
-"泡菜"      , "🥒",
-"波"       , "🏌",
-"波板糖"     , "🍭",
-"波浪"      , "🌊",
-"注册"      , "®",
-"注射"      , "💉",
-"注释"      , "🗒",
-"泳衣"      , "🩱",
-"泳裤"      , "🩲",
-"泵"       , "⛽",
-"洋葱"      , "🧅",
-"洗头水"     , "🧴",
-"洗手间"     , "🚹",
-"洗衫"      , "🧺",
-"洞"       , "⛳",
-"派对"      , "🪅",
-"派对枪"     , "🎉",
-"流动"      , "📱",
-"流口水"     , "🤤",
-"流星"      , "🌠",
-"浅"       , "🥘",
-"浅肤色"     , "🏻",
-"浓汤"      , "🦞",
-"浪漫"      , "💒",
-"浮潜"      , "🤿",
-"浴室"      , "🪥",
-"浴缸"      , "🛀",
-"海"       , "⛵",
-"海关"      , "🛃",
-"海洋"      , "🌊",
-"海浪"      , "🌊",
-"海滩"      , "🏖",
-"海狮"      , "🦭",
-"海盗"      , "🦜",
-"海盗旗"     , "🏴‍☠",
-"海绵"      , "🧽",
-"海豚"      , "🐬",
-"海豹"      , "🦭",
-"海鲜"      , "🍢",
-"海龟"      , "🐢",
-"消闲"      , "♟",
-"消防员"     , "🧑‍🚒",
-"消防车"     , "🧑‍🚒",
-"润肤霜"     , "🧴",
-"深肤色"     , "🏿",
-"清洁"      , "🧹",
-"清真寺"     , "🕌",
-"清酒"      , "🍶",
-"渡船"      , "⛴",
-"温度计"     , "🌡",
-"温泉"      , "♨",
-"游乐场"     , "🎡",
-"游戏"      , "🥌",
-"游戏杆"     , "🕹",
-"游水"      , "🏊",
-"游艇"      , "⛵",
-"溅"       , "💦",
-"溜冰"      , "⛸",
-"溜冰鞋"     , "🛼",
-"滑块"      , "🎚",
-"滑板"      , "🛹",
-"滑板车"     , "🛵",
-"滑浪"      , "🏄",
-"滑翔伞"     , "🪂",
-"滑雪"      , "⛷",
-"滑雪板"     , "🏂",
-"滚动"      , "📜",
-"滚筒"      , "🎢",
-"滚轴"      , "🛼",
-"满"       , "🌕",
-"满分"      , "💯",
-"满意"      , "😆",
-"满月"      , "🌕",
-"满月面"     , "🌝",
-"滴汗"      , "💦",
-"演员"      , "🧑‍🎤",
-"漩涡"      , "🍥",
-"漫画"      , "💩",
-"潜水"      , "🦪",
-"潜水镜"     , "🤿",
-"澳洲"      , "🪃",
-"火"       , "🚒",
-"火山"      , "🌋",
-"火焰"      , "🔥",
-"火箭"      , "🧑‍🚀",
-"火花"      , "🎇",
-"火车"      , "🚂",
-"火鸡"      , "🦃",
-"灯"       , "🚨",
-"灯泡"      , "💡",
-"灯笼"      , "🎃",
-"灯笼椒"     , "🫑",
-"灯胆"      , "💡",
-"灰烬"      , "⚱",
-"灰色"      , "🦳",
-"炖"       , "🍲",
-"炮丈"      , "🧨",
-"炸"       , "🍤",
-"炸弹"      , "💣",
-"炸药"      , "🧨",
-"炸虾"      , "🍤",
-"点"       , "🕛",
-"烈酒"      , "🥃",
-"烈酒㷴"     , "🥃",
-"烘焙"      , "🥯",
-"烛台"      , "🕎",
-"烟肉"      , "🥓",
-"烟花"      , "🎆",
-"烤肉串"     , "🥙",
-"烤饼"      , "🫓",
-"烧焊"      , "🥽",
-"烩"       , "🍠",
-"烩番薯"     , "🍠",
-"热"       , "🥵",
-"热带"      , "🦩",
-"热带鱼"     , "🐠",
-"热狗"      , "🌭",
-"热腾腾"     , "♨",
-"热饮"      , "☕",
-"热香饼"     , "🥞",
-"煎"       , "🍳",
-"煮熟"      , "🍚",
-"煮食"      , "🍳",
-"煲"       , "🫕",
-"熄"       , "🧯",
-"熊"       , "🐻",
-"熊仔"      , "🧸",
-"熊猫"      , "🐼",
-"熊猫脸"     , "🐼",
-"熊脸"      , "🐻",
-"燃油"      , "⛽",
-"燃油泵"     , "⛽",
-"燕尾服"     , "🤵‍♀",
-"燕麦"      , "🥣",
-"爆发"      , "🌋",
-"爆炸"      , "🧨",
-"爆炸头"     , "🤯",
-"爆谷"      , "🍿",
-"爪"       , "🦞",
-"爬"       , "🪜",
-"爱"       , "😍",
-"爱情"      , "💌",
-"片"       , "🍕",
-"片装"      , "🍰",
-"版权"      , "©",
-"牌"       , "📛",
-"牙"       , "🪥",
-"牙刷"      , "🪥",
-"牙医"      , "🦷",
-"牙科"      , "🪥",
-"牙齿"      , "🦷",
-"牛"       , "🐮",
-"牛仔"      , "🤠",
-"牛仔裤"     , "👖",
-"牛女"      , "🤠",
-"牛奶"      , "🧋",
-"牛扒"      , "🥩",
-"牛油"      , "🧈",
-"牛油果"     , "🥑",
-"牛脸"      , "🐮",
-"牛角"      , "😈",
-"牛角包"     , "🥐",
-"牛角卷"     , "🥐",
-"牧人"      , "👨‍🌾",
-"犀牛"      , "🦏",
-"犯罪"      , "🦹",
-"犹太人"     , "✡",
-"犹太教"     , "🕍",
-"狂热"      , "🥵",
-"狐狸"      , "🦊",
-"狐狸脸"     , "🦊",
-"狗"       , "🐶",
-"狗脸"      , "🐶",
-"狡猾"      , "🦝",
-"独峰驼"     , "🐪",
-"独木舟"     , "🛶",
-"独角兽"     , "🦄",
-"狮子"      , "🦁",
-"狮子座"     , "🦁",
-"狮子狗"     , "🐩",
-"狮子脸"     , "🦁",
-"狸"       , "🦝",
-"狼"       , "🐺",
-"狼脸"      , "🐺",
-"猩猩"      , "🦧",
-"猪"       , "🐷",
-"猪公"      , "🐗",
-"猪扒"      , "🥩",
-"猪脸"      , "🐷",
-"猪鼻"      , "🐽",
-"猫"       , "😺",
-"猫头鹰"     , "🦉",
-"猫脸"      , "🐱",
-"猿"       , "🦧",
-"獭"       , "🦦",
-"獾"       , "🦡",
-"玉米"      , "🌽",
-"王子"      , "🤴",
-"玛黛茶"     , "🧉",
-"玩"       , "🎴",
-"玩具"      , "🪀",
-"玫瑰"      , "🌹",
-"环虫"      , "🪱",
-"玻璃"      , "🥃",
-"玻璃杯"     , "🍸",
-"珍珠"      , "🧋",
-"珠"       , "🧿",
-"珠宝"      , "💎",
-"班卓琴"     , "🪕",
-"班戟"      , "🥞",
-"球"       , "🤾",
-"球场"      , "🏑",
-"球拍"      , "🏓",
-"球棒"      , "🏏",
-"理发"      , "💇",
-"瑜伽"      , "🧘",
-"瑞士"      , "🫕",
-"瓦肯式"     , "🖖",
-"瓮"       , "⚱",
-"甜"       , "🍡",
-"甜品"      , "🍡",
-"生命"      , "🧬",
-"生姜"      , "🦰",
-"生果"      , "🍇",
-"生物"      , "👹",
-"生物学"     , "🧫",
-"生病"      , "🤒",
-"生肖"      , "⛎",
-"生菜"      , "🥬",
-"生蚝"      , "🦪",
-"用笔锁"     , "🔏",
-"甲壳虫"     , "🪲",
-"甲虫"      , "🪲",
-"申"       , "🈸",
-"申请"      , "🈸",
-"电"       , "🚃",
-"电力"      , "⚡",
-"电单车"     , "🏍",
-"电压"      , "⚡",
-"电工"      , "🧑‍🔧",
-"电影"      , "🎥",
-"电池"      , "🔋",
-"电筒"      , "🔦",
-"电脑"      , "💻",
-"电视机"     , "📺",
-"电话"      , "📱",
-"电车"      , "🚃",
-"电邮"      , "✉",
-"男"       , "👱‍♂",
-"男人"      , "👨",
-"男仔"      , "👦",
-"男仙子"     , "🧚‍♂",
-"男侦探"     , "🕵‍♂",
-"男农夫"     , "👨‍🌾",
-"男厕"      , "🚹",
-"男厨师"     , "👨‍🍳",
-"男士"      , "👞",
-"男学生"     , "👨‍🎓",
-"男巫"      , "🧙",
-"男巫师"     , "🧙‍♂",
-"男技工"     , "👨‍🔧",
-"男教师"     , "👨‍🏫",
-"男歌手"     , "👨‍🎤",
-"男殭尸"     , "🧟‍♂",
-"男法官"     , "👨‍⚖",
-"男精灵"     , "🧝‍♂",
-"男装鞋"     , "👞",
-"男警察"     , "👮‍♂",
-"男超人"     , "🦸‍♂",
-"画画"      , "🖌",
-"画笔"      , "🖌",
-"画面"      , "🎞",
-"番枧"      , "🧼",
-"番枧盒"     , "🧼",
-"番茄"      , "🍅",
-"番薯"      , "🍠",
-"疟疾"      , "🦟",
-"疾病"      , "🪰",
-"病"       , "😷",
-"病毒"      , "🦟",
-"痛苦"      , "😬",
-"痢"       , "😛",
-"登山者"     , "🧗",
-"白兔"      , "🐰",
-"白羊座"     , "🐏",
-"白色"      , "🤍",
-"白色心"     , "🤍",
-"白色旗"     , "🏳",
-"白花"      , "💮",
-"白菜"      , "🥬",
-"白领"      , "🧑‍💼",
-"百"       , "💯",
-"百撘卡"     , "🃏",
-"的士"      , "🚕",
-"皇冠"      , "👑",
-"皮纳塔"     , "🪅",
-"皱眉"      , "☹",
-"盆栽"      , "🪴",
-"盈"       , "🌒",
-"盈凸月"     , "🌔",
-"盐"       , "🧂",
-"盐樽"      , "🧂",
-"盒"       , "🍱",
-"盒子"      , "📥",
-"目标"      , "🥍",
-"盲"       , "👨‍🦯",
-"盲人"      , "🧑‍🦯",
-"直升机"     , "🚁",
-"直尺"      , "📏",
-"直边"      , "📏",
-"相机"      , "🤳",
-"盾"       , "🛡",
-"眨眼"      , "😉",
-"眼"       , "😄",
-"眼泪"      , "🥲",
-"眼睛"      , "🤩",
-"眼镜"      , "🥸",
-"着上"      , "🥿",
-"睇"       , "🙈",
-"短裤"      , "🩳",
-"石"       , "🥌",
-"石头"      , "🪨",
-"砂浆"      , "🧱",
-"砂锅"      , "🥘",
-"砌图"      , "🧩",
-"砖"       , "🧱",
-"破折号"     , "〰",
-"破碎"      , "💔",
-"硬币"      , "🪙",
-"碌地"      , "🤣",
-"碎"       , "💔",
-"碗"       , "🍜",
-"碟"       , "🍽",
-"碰撞"      , "💥",
-"磁力"      , "🧭",
-"磁性"      , "🧲",
-"磁石"      , "🧲",
-"磁碟"      , "💾",
-"礼物"      , "🧧",
-"祈祷"      , "🤲",
-"祝"       , "㊗",
-"神奇"      , "🧝",
-"神教"      , "⛩",
-"神社"      , "⛩",
-"祷告"      , "📿",
-"禁"       , "🈲",
-"禁止"      , "🙈",
-"禁钉"      , "📌",
-"离境"      , "🛫",
-"禾束"      , "🌾",
-"秋天"      , "🥮",
-"科学"      , "🧪",
-"科学家"     , "🧑‍🔬",
-"秒表"      , "⏱",
-"秘"       , "㊙",
-"秘密"      , "㊙",
-"秤"       , "👨‍⚖",
-"穆斯林"     , "🕌",
-"穗"       , "🌾",
-"空"       , "🈳",
-"空中"      , "🚡",
-"空手道"     , "🥋",
-"突起"      , "🌔",
-"窗"       , "🪟",
-"窝夫"      , "🧇",
-"窿"       , "🕳",
-"竖起"      , "👍",
-"章鱼"      , "🐙",
-"童话"      , "👼",
-"竹"       , "🎍",
-"竿"       , "🎣",
-"笃笃"      , "🛺",
-"笑"       , "😆",
-"笑脸"      , "😀",
-"笔"       , "✒",
-"笔尖"      , "✒",
-"笔记板"     , "📋",
-"笔记簿"     , "📔",
-"符号"      , "❣",
-"第一"      , "🥇",
-"第三"      , "🥉",
-"第二"      , "🥈",
-"筷子"      , "🥢",
-"算盘"      , "🧮",
-"箭"       , "💘",
-"箭咀"      , "📲",
-"箭头"      , "🏹",
-"箭靶"      , "🎯",
-"箱"       , "🧰",
-"篮"       , "🧺",
-"篮圈"      , "🏀",
-"篮球"      , "🏀",
-"簿记"      , "🧾",
-"米"       , "🌾",
-"米饼"      , "🍘",
-"粉碎"      , "🥰",
-"粗乘号"     , "✖",
-"粗减号"     , "➖",
-"粗剔号"     , "✔",
-"粗加号"     , "➕",
-"粗除号"     , "➗",
-"粟米"      , "🌽",
-"粟米饼"     , "🫓",
-"粥"       , "🥣",
-"粪便"      , "💩",
-"粱龙"      , "🦕",
-"糕点"      , "🍥",
-"糖果"      , "🍬",
-"索引"      , "🗂",
-"紧张"      , "💗",
-"紧急"      , "🦺",
-"紫色"      , "💜",
-"紫色心"     , "💜",
-"累"       , "😩",
-"累嘅脸"     , "😫",
-"纠察"      , "🪧",
-"纠缠"      , "🦡",
-"红"       , "😡",
-"红包"      , "🧧",
-"红心"      , "♥",
-"红色"      , "🍎",
-"红色心"     , "❤",
-"红苹果"     , "🍎",
-"红萝卜"     , "🥕",
-"红酒杯"     , "🍷",
-"红面"      , "🥵",
-"红鹤"      , "🦩",
-"级别"      , "🎚",
-"纪念"      , "🎗",
-"纱丽"      , "🥻",
-"纳扎尔"     , "🧿",
-"纸"       , "📜",
-"纸屑"      , "🎊",
-"纸屑球"     , "🎊",
-"纸巾"      , "🧻",
-"纸币"      , "💴",
-"纸牌"      , "♠",
-"线"       , "🧵",
-"线索"      , "🧩",
-"组合"      , "📐",
-"组装"      , "🪆",
-"细"       , "🤪",
-"细菌"      , "🦠",
-"终极"      , "🥏",
-"经理"      , "🧑‍💼",
-"结"       , "🪢",
-"结他"      , "🎸",
-"结束"      , "🔚",
-"绘画"      , "🖼",
-"绝种"      , "🦣",
-"绳"       , "🪢",
-"绳球"      , "🪢",
-"绵羊"      , "🐏",
-"绷带"      , "🤕",
-"绿色"      , "💚",
-"绿色书"     , "📗",
-"绿色心"     , "💚",
-"缆"       , "🚠",
-"缆车"      , "🚠",
-"缝纫"      , "🧵",
-"缝纫针"     , "🪡",
-"缝线"      , "🪡",
-"缝补"      , "🪡",
-"缝针"      , "🪡",
-"缸"       , "🪣",
-"罐"       , "🍯",
-"罐头"      , "🥫",
-"网"       , "🕸",
-"网球"      , "🎾",
-"网球拍"     , "🎾",
-"羊扒"      , "🥩",
-"羊毛"      , "🦣",
-"羊驼"      , "🦙",
-"美人鱼"     , "🧜",
-"美元"      , "💵",
-"美容"      , "💇",
-"美容店"     , "💆",
-"美式"      , "🏈",
-"美洲"      , "🌎",
-"羽毛"      , "🪶",
-"羽毛球"     , "🏸",
-"翼"       , "💸",
-"老"       , "🦳",
-"老人"      , "🧓",
-"老伯伯"     , "👴",
-"老婆婆"     , "👵",
-"老师"      , "🧑‍🏫",
-"老年"      , "🧓",
-"老虎"      , "🐯",
-"老虎机"     , "🎰",
-"老虎脸"     , "🐯",
-"老鼠"      , "🐭",
-"老鼠夹"     , "🪤",
-"老鼠脸"     , "🐭",
-"耕种"      , "🧺",
-"耳仔"      , "👂",
-"耳机"      , "🎧",
-"耸肩"      , "🤷",
-"聋"       , "🧏",
-"聋人"      , "🧏",
-"联锁"      , "🧩",
-"肉"       , "🍖",
-"肉丸"      , "🧆",
-"肉块"      , "🥩",
-"肉菜饭"     , "🥘",
-"肉连⻣"     , "🍖",
-"肌肉"      , "💪",
-"肢"       , "🦵",
-"肤色"      , "🏻",
-"肩带"      , "🎽",
-"肺"       , "🫁",
-"背囊"      , "🥾",
-"背心"      , "🦺",
-"胜利"      , "✌",
-"胡椒粉"     , "🫑",
-"胶布"      , "🩹",
-"胸像"      , "👤",
-"脉冲"      , "🫀",
-"脉动"      , "💗",
-"脑"       , "🧠",
-"脚"       , "🦵",
-"脚印"      , "👣",
-"脚掌"      , "🦶",
-"脱落"      , "🌳",
-"脸"       , "😀",
-"脸红"      , "😳",
-"腐烂"      , "🪰",
-"腕龙"      , "🦕",
-"腮红"      , "😊",
-"自动化"     , "🏧",
-"自拍"      , "🤳",
-"自来水"     , "🚰",
-"自然"      , "😐",
-"自由"      , "🗽",
-"自行车"     , "🚳",
-"自豪"      , "🥲",
-"臭"       , "💩",
-"臭鼬"      , "🦨",
-"舞蹈员"     , "👯",
-"航班"      , "🪶",
-"船"       , "⚓",
-"艇"       , "🚣",
-"色士风"     , "🎷",
-"艺人"      , "👨‍🎤",
-"艺术"      , "🎭",
-"艺术家"     , "👨‍🎨",
-"节奏"      , "🪘",
-"节日"      , "🥮",
-"芒果"      , "🥭",
-"芝士"      , "🫕",
-"芭蕾舞"     , "🩰",
-"花"       , "💐",
-"花园"      , "🏡",
-"花束"      , "💐",
-"花栗鼠"     , "🐿",
-"花洒"      , "🚿",
-"花环"      , "🏵",
-"花生"      , "🥜",
-"花纸牌"     , "🎴",
-"苦恼"      , "😧",
-"英镑"      , "💷",
-"英雄"      , "🦸",
-"苹果"      , "🍎",
-"茄子"      , "🍆",
-"茶"       , "🧋",
-"茶壶"      , "🫖",
-"茶杯"      , "🍵",
-"草"       , "🍀",
-"草蜢"      , "🦗",
-"荒岛"      , "🏝",
-"荒废"      , "🏚",
-"药"       , "😷",
-"药丸"      , "💊",
-"莓"       , "🫐",
-"莫伊"      , "🗿",
-"菜"       , "🥬",
-"菠萝"      , "🍍",
-"菱形"      , "🔶",
-"营"       , "🈺",
-"营业"      , "🈺",
-"落叶"      , "🍁",
-"落叶树"     , "🌳",
-"落雨"      , "🌈",
-"葬礼"      , "⚱",
-"葵扇"      , "♠",
-"蒙古包"     , "🛖",
-"蒜头"      , "🧄",
-"蒸气"      , "🍜",
-"蒸气房"     , "🧖",
-"蒸汽"      , "🚂",
-"蒸馏器"     , "⚗",
-"蓝光"      , "📀",
-"蓝色"      , "🫐",
-"蓝色书"     , "📘",
-"蓝色心"     , "💙",
-"蓝莓"      , "🫐",
-"蔬菜"      , "🫑",
-"薄班戟"     , "🥞",
-"薄饼"      , "🫓",
-"薯仔"      , "🥔",
-"薯条"      , "🍟",
-"蘑菇"      , "🍄",
-"虎头钳"     , "🗜",
-"虫"       , "🪱",
-"虾"       , "🍤",
-"蚂蚁"      , "🐜",
-"蚊"       , "🦟",
-"蚝桶"      , "🥡",
-"蚯蚓"      , "🪱",
-"蛆"       , "🪰",
-"蛇"       , "🐍",
-"蛇夫座"     , "🐍",
-"蛋"       , "🥚",
-"蛋糕"      , "🎂",
-"蜂蜜獾"     , "🦡",
-"蜗牛"      , "🐌",
-"蜘蛛"      , "🕷",
-"蜘蛛网"     , "🕸",
-"蜜瓜"      , "🍈",
-"蜜糖"      , "🍯",
-"蜜糖罐"     , "🍯",
-"蜜蜂"      , "🐝",
-"蜡烛"      , "🕯",
-"蜡笔"      , "🖍",
-"蜥蜴"      , "🦎",
-"蝎子"      , "🦂",
-"蝙蝠"      , "🦇",
-"蝴蝶"      , "🦋",
-"蝴蝶结"     , "💝",
-"蝴蝶酥"     , "🥨",
-"融"       , "🫕",
-"螺"       , "🐚",
-"螺丝"      , "🪛",
-"螺丝批"     , "🪛",
-"螺旋"      , "🗒",
-"螺旋形"     , "🐚",
-"螺栓"      , "🔩",
-"螺母"      , "🔩",
-"蟹"       , "🦀",
-"血型"      , "🅰",
-"血液"      , "🩸",
-"行人"      , "🚸",
-"行尸"      , "🧟",
-"行山"      , "🥾",
-"行山鞋"     , "🥾",
-"行李"      , "🧳",
-"行紧路"     , "🚶",
-"行路"      , "🚶",
-"表情"      , "🙍",
-"表演"      , "🎭",
-"衫"       , "🎽",
-"袋"       , "👝",
-"袋棍球"     , "🥍",
-"袋鼠"      , "🦘",
-"袜"       , "🧦",
-"裁剪"      , "🪡",
-"装配"      , "👨‍🏭",
-"装饰"      , "📔",
-"裇衫"      , "👕",
-"裙"       , "👗",
-"裤"       , "👖",
-"西"       , "⬅",
-"西兰花"     , "🥦",
-"西北"      , "↖",
-"西南"      , "↙",
-"西瓜"      , "🍉",
-"西装"      , "🕴",
-"见证"      , "👁‍🗨",
-"解锁"      , "🔓",
-"警告"      , "⚠",
-"警员"      , "👮",
-"警官"      , "👮",
-"警察"      , "👮",
-"警报"      , "⏰",
-"警示灯"     , "🚨",
-"警车"      , "🚓",
-"警车灯"     , "🚨",
-"计数"      , "🧮",
-"计时器"     , "⌛",
-"训紧觉"     , "😴",
-"训觉"      , "😪",
-"讯号"      , "📶",
-"讲"       , "🙊",
-"讲价"      , "🉐",
-"讲大话"     , "🤥",
-"讲师"      , "👨‍🏫",
-"讲野"      , "💬",
-"讽刺"      , "😼",
-"证据"      , "🧾",
-"证明"      , "🧾",
-"试味"      , "😝",
-"试管"      , "🧪",
-"试食"      , "😋",
-"请"       , "🙏",
-"谂野"      , "🤔",
-"调味"      , "🧄",
-"调味料"     , "🧂",
-"调查员"     , "🕵",
-"调皮"      , "🦦",
-"调色板"     , "🧑‍🎨",
-"谷物"      , "🌾",
-"豹"       , "🐆",
-"账簿"      , "📒",
-"货币"      , "💴",
-"货船"      , "🎢",
-"货车"      , "🛻",
-"质问"      , "🤌",
-"购物"      , "🛍",
-"购物袋"     , "🛍",
-"购物车"     , "🛒",
-"资讯"      , "💁",
-"赏月"      , "🎑",
-"赛跑"      , "🏃‍♂",
-"赛跑衫"     , "🎽",
-"赛车"      , "🏎",
-"赛马"      , "🏇",
-"赢"       , "😤",
-"赢咗"      , "😤",
-"赶上"      , "🪝",
-"起重机"     , "🛗",
-"超人"      , "🦸",
-"超级"      , "🦸",
-"趋势"      , "💹",
-"足球"      , "⚽",
-"跆拳道"     , "🥋",
-"跑"       , "💨",
-"跑步"      , "🏃",
-"跑鞋"      , "👟",
-"跪"       , "🧎",
-"跪嘅人"     , "🧎",
-"路"       , "🛣",
-"跳"       , "🦘",
-"跳伞"      , "🪂",
-"跳动"      , "💓",
-"跳舞"      , "💃",
-"踏"       , "🦶",
-"踢"       , "🦵",
-"踩单车"     , "🚴",
-"踫杯"      , "🍻",
-"身份"      , "🆔",
-"身体"      , "👂",
-"车"       , "🚃",
-"车厘子"     , "🍒",
-"车站"      , "🚉",
-"车辆"      , "🚝",
-"轨迹球"     , "🖲",
-"轮"       , "🎡",
-"轮廓"      , "☺",
-"轮椅"      , "🧑‍🦼",
-"软"       , "🧇",
-"软件"      , "🧑‍💻",
-"软雪糕"     , "🍦",
-"轰"       , "💥",
-"轻铁"      , "🚈",
-"较剪"      , "✂",
-"辅助"      , "🦾",
-"输入"      , "🔠",
-"辣"       , "🌶",
-"辣椒"      , "🫑",
-"过山车"     , "🎢",
-"过路"      , "🚸",
-"运动"      , "👟",
-"运动场"     , "🎽",
-"运动鞋"     , "👟",
-"返回"      , "🔙",
-"进入"      , "⛔",
-"进化"      , "🧬",
-"远足"      , "🚶",
-"连住"      , "🖇",
-"连结"      , "🔗",
-"迪亚"      , "🪔",
-"迪亚灯"     , "🪔",
-"迷茫"      , "😕",
-"退出"      , "⏏",
-"送礼"      , "🎁",
-"送货"      , "🚚",
-"送货车"     , "🚚",
-"逆时针"     , "🔄",
-"选框"      , "☑",
-"透明"      , "🪟",
-"通渠"      , "🪠",
-"速度"      , "🚄",
-"道"       , "☯",
-"道教"      , "☯",
-"道歉"      , "🙇",
-"遗传学"     , "🧬",
-"遮"       , "🏖",
-"邋遢"      , "🧐",
-"邪恶"      , "🙈",
-"邪眼"      , "🧿",
-"邮件"      , "📧",
-"邮局"      , "🏤",
-"邮政"      , "🏣",
-"邮箱"      , "📫",
-"郁金香"     , "🌷",
-"部门"      , "🏬",
-"酒"       , "🍷",
-"酒吧"      , "🍶",
-"酒塞"      , "🍾",
-"酒店"      , "🛌",
-"酱"       , "🥯",
-"酷"       , "😎",
-"醉"       , "🥴",
-"醉嘅脸"     , "🥴",
-"醒"       , "😎",
-"采矿"      , "⛏",
-"重"       , "🪨",
-"重覆"      , "🔁",
-"重量"      , "⚖",
-"野牛"      , "🦬",
-"野餐"      , "🧺",
-"金"       , "🪙",
-"金属"      , "🪙",
-"金牌"      , "🥇",
-"金牛座"     , "🐂",
-"针"       , "🪡",
-"针筒"      , "💉",
-"针织"      , "🧶",
-"钓鱼"      , "🦦",
-"钓鱼竿"     , "🎣",
-"钟"       , "🛎",
-"钢琴"      , "🎹",
-"钢笔"      , "🖋",
-"钩针"      , "🧶",
-"钮"       , "🎛",
-"钱"       , "🪙",
-"钱袋"      , "💰",
-"钳"       , "🗜",
-"钻石"      , "💍",
-"铁"       , "🧇",
-"铁路"      , "🚂",
-"铁路车"     , "🚃",
-"铃"       , "🎐",
-"铅笔"      , "✏",
-"铜"       , "🥉",
-"铜牌"      , "🥉",
-"银"       , "🪙",
-"银河"      , "🌌",
-"银牌"      , "🥈",
-"银纸"      , "💴",
-"银行"      , "🏦",
-"链"       , "⛓",
-"锁"       , "🔓",
-"锁匙"      , "🔐",
-"锅"       , "🍲",
-"锚"       , "⚓",
-"锤"       , "🔨",
-"锤同挑"     , "⚒",
-"键盘"      , "🎹",
-"锯"       , "🪚",
-"镜"       , "🪞",
-"镜片"      , "🔍",
-"长大"      , "💗",
-"长条"      , "🏮",
-"长毛象"     , "🦣",
-"长牙"      , "🦣",
-"长裤"      , "👖",
-"长颈鹿"     , "🦒",
-"长鼓"      , "🪘",
-"门"       , "🚪",
-"门券"      , "🎫",
-"闩"       , "📴",
-"闩埋"      , "📕",
-"闪"       , "💖",
-"闪光"      , "📸",
-"闪嘅心"     , "💖",
-"闪电"      , "🌩",
-"闪电云"     , "🌩",
-"闪耀"      , "🌟",
-"闪闪"      , "❇",
-"问"       , "🙏",
-"问号"      , "❓",
-"问题"      , "⁉",
-"间尺"      , "📏",
-"间谍"      , "🕵",
-"闷"       , "🪴",
-"闹钟"      , "⏰",
-"防晒"      , "🧴",
-"阳"       , "☯",
-"阴"       , "☯",
-"阴沉"      , "🪐",
-"阴阳"      , "☯",
-"阶砖"      , "♦",
-"阿米巴"     , "🦠",
-"陆龟"      , "🐢",
-"降落"      , "🛬",
-"降落伞"     , "🪂",
-"除"       , "➗",
-"陶醉"      , "🥴",
-"陷阱"      , "🪤",
-"隐形"      , "🥷",
-"隐私"      , "🔏",
-"障碍物"     , "🚧",
-"雀"       , "🦃",
-"雀仔"      , "🐦",
-"雌性"      , "🐑",
-"雌性猪"     , "🐖",
-"雕像"      , "🗽",
-"雨"       , "⛈",
-"雨云"      , "🌧",
-"雪"       , "⛷",
-"雪云"      , "🌨",
-"雪人"      , "☃",
-"雪山"      , "🏔",
-"雪橇"      , "🛷",
-"雪糕"      , "🍦",
-"雪花"      , "❄",
-"雷电"      , "⛈",
-"雷龙"      , "🦕",
-"雾"       , "🌫",
-"震动"      , "📳",
-"震惊"      , "🤯",
-"露营"      , "🏕",
-"青瓜"      , "🥒",
-"青色"      , "🍏",
-"青苹果"     , "🍏",
-"青蛙"      , "🐸",
-"青蛙脸"     , "🐸",
-"靓"       , "🦩",
-"静"       , "🤫",
-"静音"      , "🔇",
-"非洲"      , "🦱",
-"非饮用"     , "🚱",
-"面"       , "🥸",
-"面具"      , "🥸",
-"面包"      , "🍞",
-"面纱"      , "🧕",
-"靴"       , "🥾",
-"靴子"      , "👢",
-"靶"       , "🎯",
-"靶心"      , "🎯",
-"鞋"       , "👞",
-"鞠躬"      , "🙏",
-"音乐"      , "🎼",
-"音符"      , "🎵",
-"页"       , "📃",
-"顶帽"      , "🎩",
-"顶部"      , "🔝",
-"项链"      , "📿",
-"顺时针"     , "🔃",
-"须"       , "🧔",
-"预言"      , "🥠",
-"预订"      , "🈯",
-"领取"      , "🛄",
-"领呔"      , "🪢",
-"颈"       , "🧣",
-"颈巾"      , "🧣",
-"风"       , "🍃",
-"风筝"      , "🪁",
-"风脸"      , "🌬",
-"风铃"      , "🎐",
-"飘动"      , "🍃",
-"飞"       , "🕊",
-"飞机"      , "🧑‍✈",
-"飞机师"     , "🧑‍✈",
-"飞碟"      , "👽",
-"飞镖"      , "🎯",
-"食物"      , "🫒",
-"餐具"      , "🥄",
-"饭"       , "🍙",
-"饭团"      , "🍙",
-"饮"       , "🫖",
-"饮品"      , "🍼",
-"饮水"      , "🚰",
-"饮用"      , "🚰",
-"饮管杯"     , "🥤",
-"饮酒"      , "🍶",
-"饵"       , "🪤",
-"饺子"      , "🥟",
-"饼"       , "🍘",
-"馅料"      , "🥧",
-"馅饼"      , "🫓",
-"香烟"      , "🚬",
-"香肠"      , "🌭",
-"香草"      , "🌿",
-"香蕉"      , "🍌",
-"马"       , "🏇",
-"马戏团"     , "🎪",
-"马拉松"     , "🏃",
-"马脸"      , "🐴",
-"马蹄铁"     , "🧲",
-"马骝"      , "🙈",
-"马骝脸"     , "🐵",
-"驼峰"      , "🐪",
-"骄傲"      , "🦚",
-"骆马"      , "🦙",
-"骆驼"      , "🐪",
-"骑单车"     , "🚵‍♀",
-"骑师"      , "🏇",
-"骨"       , "🍖",
-"骨头"      , "🦴",
-"骰子"      , "🎲",
-"骷髅头"     , "💀",
-"高压"      , "⚡",
-"高尔夫"     , "🏌",
-"高根鞋"     , "👠",
-"高飞"      , "🪁",
-"髪型屋"     , "💈",
-"鬼"       , "👻",
-"魅力"      , "🧿",
-"魔术"      , "🪄",
-"魔法棒"     , "🪄",
-"魔鬼"      , "👿",
-"鱼"       , "🐟",
-"鱿鱼"      , "🦑",
-"鲤鱼"      , "🎏",
-"鲤鱼旗"     , "🎏",
-"鲨鱼"      , "🦈",
-"鲸鱼"      , "🐳",
-"鳄鱼"      , "🐊",
-"鳍"       , "🐬",
-"鸡"       , "🐔",
-"鸡仔"      , "🐤",
-"鸡尾酒"     , "🍸",
-"鸡泡鱼"     , "🐡",
-"鸡肶"      , "🍗",
-"鸢尾花"     , "⚜",
-"鸣门卷"     , "🍥",
-"鸭"       , "🦆",
-"鸽"       , "🕊",
-"鹰"       , "🦅",
-"鹰嘴豆"     , "🧆",
-"鹿"       , "🦌",
-"麻雀"      , "🀄",
-"黄昏"      , "🌆",
-"黄色"      , "💛",
-"黄色心"     , "💛",
-"黎紧"      , "🚍",
-"黑暗"      , "🌑",
-"黑猫"      , "🐈‍⬛",
-"黑色"      , "🖤",
-"黑色心"     , "🖤",
-"黑色旗"     , "🏴",
-"鼓"       , "🪘",
-"鼓棍"      , "🥁",
-"鼠"       , "🐀",
-"鼻"       , "🥸",
-"齿轮"      , "⚙",
-"龙"       , "🐲",
-"龙卷风"     , "🌀",
-"龙脸"      , "🐲",
-"龙虾"      , "🦞",
-"龙门"      , "🥅"
+{  10233,   7332 },   /* 㵴火 */
+{  10240,   7332 },   /* 㵴火筒 */
+{  10250,   6396 },   /* 一 */
+{  10254,   1321 },   /* 一件头 */
+{  10264,   3088 },   /* 一堆屎 */
+{  10274,   3992 },   /* 一杯奶 */
+{  10284,   6387 },   /* 一次 */
+{  10291,   6396 },   /* 一点 */
+{  10298,  10308 },   /* 一点半 */
+{  10313,   3865 },   /* 一百分 */
+{  10323,    895 },   /* 一群 */
+{  10330,   8014 },   /* 七 */
+{  10334,   8014 },   /* 七点 */
+{  10341,  10351 },   /* 七点半 */
+{  10356,   4846 },   /* 万圣节 */
+{  10366,  10376 },   /* 万字夹 */
+{  10381,   4565 },   /* 万岁 */
+{  10388,   9202 },   /* 三 */
+{  10392,   9172 },   /* 三十 */
+{  10399,   3232 },   /* 三叉戟 */
+{  10409,  10419 },   /* 三叶草 */
+{  10423,  10433 },   /* 三文治 */
+{  10438,   9202 },   /* 三点 */
+{  10445,  10455 },   /* 三点半 */
+{  10460,   8003 },   /* 三角尺 */
+{  10470,   8003 },   /* 三角形 */
+{  10480,  10490 },   /* 三角旗 */
+{  10495,   9604 },   /* 上 */
+{  10499,   1829 },   /* 上升 */
+{  10506,  10516 },   /* 上弦月 */
+{  10521,   5460 },   /* 上锁 */
+{  10528,   3020 },   /* 下 */
+{  10532,  10542 },   /* 下弦月 */
+{  10547,  10554 },   /* 下跌 */
+{  10559,   3283 },   /* 不 */
+{  10563,   8543 },   /* 不久 */
+{  10570,   3000 },   /* 不关心 */
+{  10580,   3264 },   /* 不准 */
+{  10587,   3264 },   /* 不可 */
+{  10594,   2566 },   /* 丑小鸭 */
+{  10604,   3150 },   /* 世界 */
+{  10611,    291 },   /* 丘比特 */
+{  10621,  10628 },   /* 业务 */
+{  10640,   3160 },   /* 东 */
+{  10644,   9374 },   /* 东京 */
+{  10651,  10658 },   /* 东北 */
+{  10662,  10669 },   /* 东南 */
+{  10673,  10680 },   /* 丝带 */
+{  10685,  10695 },   /* 两个心 */
+{  10700,   9573 },   /* 两点 */
+{  10707,  10717 },   /* 两点半 */
+{  10722,   5203 },   /* 个人 */
+{  10729,   1645 },   /* 中国帽 */
+{  10739,   4331 },   /* 中心 */
+{  10746,   1923 },   /* 中性 */
+{  10753,  10760 },   /* 中指 */
+{  10765,   4606 },   /* 中暑 */
+{  10772,   5766 },   /* 中等 */
+{  10779,  10789 },   /* 中肤色 */
+{  10794,   2633 },   /* 串 */
+{  10798,   6310 },   /* 串烧 */
+{  10805,   2633 },   /* 丸子 */
+{  10812,    576 },   /* 丹参树 */
+{  10822,  10829 },   /* 举手 */
+{  10833,   7410 },   /* 举起 */
+{  10840,   5350 },   /* 举重 */
+{  10847,   5350 },   /* 举重者 */
+{  10857,  10864 },   /* 义肢 */
+{  10869,   3661 },   /* 乌蝇 */
+{  10876,   6078 },   /* 乐谱 */
+{  10883,   6493 },   /* 乒乓 */
+{  10890,   6493 },   /* 乒乓球 */
+{  10900,   1603 },   /* 乘 */
+{  10904,  10911 },   /* 乘客 */
+{  10916,   1603 },   /* 乘法 */
+{  10923,   6201 },   /* 九 */
+{  10927,   6201 },   /* 九点 */
+{  10934,  10944 },   /* 九点半 */
+{  10949,   8471 },   /* 乞嚏 */
+{  10956,   5829 },   /* 乞讨 */
+{  10963,   1083 },   /* 书 */
+{  10967,  10974 },   /* 书包 */
+{  10979,   3918 },   /* 书呆子 */
+{  10989,   5704 },   /* 书签 */
+{  10996,   1499 },   /* 乳制品 */
+{  11006,   1256 },   /* 乳房 */
+{  11013,   5513 },   /* 乳液 */
+{  11020,   5513 },   /* 乳液樽 */
+{  11030,   9573 },   /* 二 */
+{  11034,    818 },   /* 二头肌 */
+{  11044,   9735 },   /* 亏 */
+{  11048,   9735 },   /* 亏凸月 */
+{  11058,   2147 },   /* 云 */
+{  11062,   3567 },   /* 五 */
+{  11066,   3567 },   /* 五点 */
+{  11073,  11083 },   /* 五点半 */
+{  11088,  11095 },   /* 亚洲 */
+{  11100,   9589 },   /* 亡灵 */
+{  11107,   2480 },   /* 交叉 */
+{  11114,  11124 },   /* 交叉旗 */
+{  11129,  11139 },   /* 交叉骨 */
+{  11143,   8219 },   /* 交通 */
+{  11150,   2820 },   /* 亮度 */
+{  11157,  11161 },   /* 人 */
+{  11173,  11183 },   /* 人马座 */
+{  11187,   5841 },   /* 人鱼 */
+{  11194,  11201 },   /* 仓鼠 */
+{  11206,  11201 },   /* 仓鼠脸 */
+{  11216,   1539 },   /* 仙人掌 */
+{  11226,   3332 },   /* 仙子 */
+{  11233,   7839 },   /* 仪器 */
+{  11240,  11247 },   /* 仪式 */
+{  11252,   8746 },   /* 企 */
+{  11256,  11263 },   /* 企鹅 */
+{  11268,   7246 },   /* 会计 */
+{  11275,   6521 },   /* 传呼机 */
+{  11285,   3390 },   /* 传真 */
+{  11292,   3390 },   /* 传真机 */
+{  11302,   2506 },   /* 伤心 */
+{  11309,   2820 },   /* 低 */
+{  11313,   4009 },   /* 低手 */
+{  11320,  11327 },   /* 体操 */
+{  11332,  11342 },   /* 体育场 */
+{  11347,   2763 },   /* 佛教 */
+{  11354,   2763 },   /* 佛法 */
+{  11361,   2763 },   /* 佛法轮 */
+{  11371,   8370 },   /* 侦探 */
+{  11378,  11327 },   /* 侧手翻 */
+{  11388,   8835 },   /* 便利店 */
+{  11398,    795 },   /* 便当 */
+{  11405,   5803 },   /* 便条 */
+{  11412,   2945 },   /* 俄罗斯 */
+{  11422,   6268 },   /* 保健员 */
+{  11432,  11442 },   /* 保龄球 */
+{  11447,   5308 },   /* 信 */
+{  11451,   8219 },   /* 信号 */
+{  11458,   3221 },   /* 信封 */
+{  11465,   2463 },   /* 信用 */
+{  11472,   2463 },   /* 信用卡 */
+{  11482,  11489 },   /* 信箱 */
+{  11494,   1673 },   /* 修甲 */
+{  11501,   3321 },   /* 假扮 */
+{  11508,   8824 },   /* 停 */
+{  11512,  11519 },   /* 停止 */
+{  11524,   8471 },   /* 健康 */
+{  11531,   3103 },   /* 傍晚 */
+{  11538,   8436 },   /* 傻笑 */
+{  11545,   8436 },   /* 傻笑脸 */
+{  11555,    872 },   /* 光 */
+{  11559,   7439 },   /* 光亮 */
+{  11566,    485 },   /* 光头 */
+{  11573,   2840 },   /* 光学 */
+{  11580,    189 },   /* 光环 */
+{  11587,   2840 },   /* 光碟 */
+{  11594,  11601 },   /* 免费 */
+{  11606,  11613 },   /* 兑换 */
+{  11618,   1456 },   /* 兔 */
+{  11622,   2611 },   /* 兔耳 */
+{  11629,   1456 },   /* 兔脸 */
+{  11636,   9232 },   /* 入场 */
+{  11643,   9232 },   /* 入场券 */
+{  11653,   3179 },   /* 八 */
+{  11657,   3179 },   /* 八点 */
+{  11664,  11674 },   /* 八点半 */
+{  11679,  11519 },   /* 八角形 */
+{  11689,  11699 },   /* 八角星 */
+{  11703,   5643 },   /* 公 */
+{  11707,  11714 },   /* 公主 */
+{  11719,  11729 },   /* 公事包 */
+{  11734,   2945 },   /* 公仔 */
+{  11741,   6590 },   /* 公园 */
+{  11748,   1433 },   /* 公牛 */
+{  11755,   5643 },   /* 公羊 */
+{  11762,   7567 },   /* 公路 */
+{  11769,  11776 },   /* 公鸡 */
+{  11781,   8263 },   /* 六 */
+{  11785,   8263 },   /* 六点 */
+{  11792,  11802 },   /* 六点半 */
+{  11807,  11489 },   /* 关闭 */
+{  11814,  11821 },   /* 兴奋 */
+{  11826,   4791 },   /* 内 */
+{  11830,   1321 },   /* 内衣 */
+{  11837,  11844 },   /* 冇位 */
+{  11849,  10102 },   /* 写字 */
+{  11856,    280 },   /* 军事 */
+{  11863,    280 },   /* 军队 */
+{  11870,   3356 },   /* 农夫 */
+{  11877,   6836 },   /* 农夫车 */
+{  11887,  10158 },   /* 冥想 */
+{  11894,   2968 },   /* 冬甩 */
+{  11901,  11905 },   /* 冰 */
+{  11910,  11917 },   /* 冰冷 */
+{  11922,  11929 },   /* 冰块 */
+{  11934,    253 },   /* 冰川 */
+{  11941,   7267 },   /* 冰球 */
+{  11948,    628 },   /* 冲凉 */
+{  11955,   5127 },   /* 冷球 */
+{  11962,   2257 },   /* 冻 */
+{  11966,  11905 },   /* 冻伤 */
+{  11973,  11905 },   /* 冻结 */
+{  11980,   9184 },   /* 凉鞋 */
+{  11987,   9902 },   /* 凋谢 */
+{  11994,   5894 },   /* 减 */
+{  11998,  12005 },   /* 几何 */
+{  12010,  12017 },   /* 出发 */
+{  12022,   4606 },   /* 出汗 */
+{  12029,   2653 },   /* 击中 */
+{  12036,   3720 },   /* 刀 */
+{  12040,    377 },   /* 分开 */
+{  12047,   3865 },   /* 分数 */
+{  12054,  12061 },   /* 分类 */
+{  12066,   5403 },   /* 分量 */
+{  12073,   1033 },   /* 划艇 */
+{  12080,  12090 },   /* 初学者 */
+{  12095,   8074 },   /* 刨 */
+{  12099,   8074 },   /* 刨冰 */
+{  12106,   7449 },   /* 利 */
+{  12110,   3959 },   /* 利是 */
+{  12117,   3959 },   /* 利是封 */
+{  12127,  12134 },   /* 到达 */
+{  12139,   4963 },   /* 制服 */
+{  12146,   1385 },   /* 刷 */
+{  12150,   9232 },   /* 券 */
+{  12154,   8640 },   /* 刺 */
+{  12158,   8640 },   /* 刺猬 */
+{  12165,   6131 },   /* 刺绣 */
+{  12172,   7449 },   /* 剃刀 */
+{  12179,    485 },   /* 剃头 */
+{  12186,   7449 },   /* 剃须 */
+{  12193,   3429 },   /* 剑 */
+{  12197,   3429 },   /* 剑击 */
+{  12204,   1840 },   /* 剔号 */
+{  12211,    300 },   /* 剧场 */
+{  12218,  12222 },   /* 剪 */
+{  12226,  12236 },   /* 剪头发 */
+{  12247,   4310 },   /* 剪影 */
+{  12254,  12258 },   /* 割 */
+{  12263,  10628 },   /* 办公室 */
+{  12273,   5729 },   /* 加 */
+{  12277,   1742 },   /* 勾 */
+{  12281,   4430 },   /* 包头 */
+{  12288,  12295 },   /* 包装 */
+{  12300,   6580 },   /* 包裹 */
+{  12307,   7685 },   /* 匆忙 */
+{  12314,   2578 },   /* 匕首 */
+{  12321,   5633 },   /* 化妆 */
+{  12328,   1673 },   /* 化妆品 */
+{  12338,  12345 },   /* 化学 */
+{  12349,  12359 },   /* 化学家 */
+{  12371,    485 },   /* 化疗 */
+{  12378,   6228 },   /* 北 */
+{  12382,    253 },   /* 北极熊 */
+{  12392,   8693 },   /* 匙羮 */
+{  12399,   2916 },   /* 医生 */
+{  12406,    929 },   /* 医疗 */
+{  12413,  12420 },   /* 医药 */
+{  12425,  12432 },   /* 医院 */
+{  12437,   3321 },   /* 匿名 */
+{  12444,   9126 },   /* 十 */
+{  12448,  12455 },   /* 十一 */
+{  12460,   3201 },   /* 十一点 */
+{  12470,   9541 },   /* 十二 */
+{  12477,   9541 },   /* 十二点 */
+{  12487,  12497 },   /* 十八岁 */
+{  12502,   1956 },   /* 十字架 */
+{  12512,   9126 },   /* 十点 */
+{  12519,  12529 },   /* 十点半 */
+{  12534,   4502 },   /* 升降机 */
+{  12544,   5501 },   /* 半 */
+{  12548,  12555 },   /* 协助 */
+{  12567,  12571 },   /* 卒 */
+{  12576,  12571 },   /* 卒手指 */
+{  12586,    840 },   /* 单车 */
+{  12593,  12600 },   /* 单轨 */
+{  12605,   1742 },   /* 卖点 */
+{  12612,   8569 },   /* 南 */
+{  12616,   4846 },   /* 南瓜 */
+{  12623,   6067 },   /* 博物馆 */
+{  12633,   2463 },   /* 卡 */
+{  12637,  12061 },   /* 卡片 */
+{  12644,  12654 },   /* 卡片盒 */
+{  12659,   3527 },   /* 卡车 */
+{  12666,   8588 },   /* 卫星 */
+{  12673,   1385 },   /* 卫生 */
+{  12680,   9788 },   /* 卫生间 */
+{  12690,   7224 },   /* 印 */
+{  12694,   4458 },   /* 印度寺 */
+{  12704,   6369 },   /* 印度教 */
+{  12714,   2623 },   /* 危险 */
+{  12721,   8682 },   /* 卷 */
+{  12725,    114 },   /* 卷发 */
+{  12732,   5021 },   /* 卷心菜 */
+{  12742,    114 },   /* 卷曲 */
+{  12749,   5491 },   /* 卷曲圈 */
+{  12759,  12766 },   /* 卷纸 */
+{  12771,   7619 },   /* 卷起 */
+{  12778,   2531 },   /* 卷页 */
+{  12785,  10079 },   /* 卷饼 */
+{  12792,   2042 },   /* 压 */
+{  12796,   6337 },   /* 厌倦 */
+{  12803,  12810 },   /* 厕所 */
+{  12815,   9296 },   /* 厕所泵 */
+{  12825,  12766 },   /* 厕纸 */
+{  12832,    357 },   /* 原子 */
+{  12839,  12849 },   /* 原子笔 */
+{  12854,    155 },   /* 原驼 */
+{  12861,   1861 },   /* 厨师 */
+{  12868,   4484 },   /* 厨房刀 */
+{  12878,   3720 },   /* 叉 */
+{  12882,  12892 },   /* 叉同刀 */
+{  12897,  12901 },   /* 双 */
+{  12905,  12912 },   /* 双子 */
+{  12916,   9558 },   /* 双子座 */
+{  12926,  12933 },   /* 双眼 */
+{  12938,   4972 },   /* 双耳瓶 */
+{  12948,   9558 },   /* 双胞胎 */
+{  12958,   2990 },   /* 双重 */
+{  12965,   3548 },   /* 双鱼座 */
+{  12975,  12982 },   /* 反射 */
+{  12987,   5905 },   /* 反射器 */
+{  12997,   5905 },   /* 反射镜 */
+{  13007,  12982 },   /* 反弹 */
+{  13014,   7410 },   /* 反手 */
+{  13021,   6453 },   /* 发件箱 */
+{  13031,   4031 },   /* 发光 */
+{  13038,  13045 },   /* 发出 */
+{  13050,   3253 },   /* 发动机 */
+{  13060,    597 },   /* 发型师 */
+{  13070,   2200 },   /* 发明家 */
+{  13080,   3462 },   /* 发烧 */
+{  13087,    200 },   /* 发疯 */
+{  13094,  13101 },   /* 发癫 */
+{  13106,  13113 },   /* 发誓 */
+{  13118,  13045 },   /* 发送 */
+{  13125,   1603 },   /* 取消 */
+{  13132,   4666 },   /* 受伤 */
+{  13139,   2916 },   /* 口罩 */
+{  13146,   6048 },   /* 口震 */
+{  13153,  13160 },   /* 古典 */
+{  13165,  13169 },   /* 可 */
+{  13174,  13181 },   /* 台风 */
+{  13186,   4397 },   /* 叶 */
+{  13190,   4575 },   /* 号角 */
+{  13197,  13201 },   /* 合 */
+{  13206,   2124 },   /* 合埋 */
+{  13213,    338 },   /* 合手 */
+{  13220,  13201 },   /* 合格 */
+{  13227,  13234 },   /* 吊钟 */
+{  13239,  13246 },   /* 同情 */
+{  13251,   8032 },   /* 同意 */
+{  13258,    426 },   /* 名牌 */
+{  13265,   1829 },   /* 向上 */
+{  13272,   8569 },   /* 向下 */
+{  13279,  13286 },   /* 向右 */
+{  13291,  13298 },   /* 向左 */
+{  13303,  13310 },   /* 吓亲 */
+{  13315,   4678 },   /* 吓惊 */
+{  13322,   4320 },   /* 听 */
+{  13326,  13333 },   /* 听筒 */
+{  13338,  13345 },   /* 听障 */
+{  13350,   5610 },   /* 吸力 */
+{  13357,   1268 },   /* 吸气 */
+{  13364,   7088 },   /* 吸水 */
+{  13371,  13378 },   /* 吸烟 */
+{  13383,   9589 },   /* 吸血鬼 */
+{  13393,    986 },   /* 吹 */
+{  13397,   5080 },   /* 吻 */
+{  13401,   9696 },   /* 呕吐 */
+{  13408,   9696 },   /* 呕心 */
+{  13415,   8736 },   /* 员工 */
+{  13422,   8495 },   /* 呜咽 */
+{  13429,  13436 },   /* 呢度 */
+{  13441,   9853 },   /* 呼 */
+{  13445,   9883 },   /* 呼叫 */
+{  13452,   1268 },   /* 呼吸 */
+{  13459,   1268 },   /* 呼气 */
+{  13466,   5391 },   /* 咀唇 */
+{  13473,   3010 },   /* 和平 */
+{  13480,   5065 },   /* 和服 */
+{  13487,   2548 },   /* 咖哩 */
+{  13494,   2548 },   /* 咖哩饭 */
+{  13504,   2219 },   /* 咖啡 */
+{  13511,  13521 },   /* 咧嘴笑 */
+{  13526,   5867 },   /* 咪 */
+{  13530,   5867 },   /* 咪高峰 */
+{  13540,  13547 },   /* 哺乳 */
+{  13559,  11161 },   /* 哺育 */
+{  13566,   5391 },   /* 唇印 */
+{  13573,   5633 },   /* 唇膏 */
+{  13580,   3283 },   /* 唔准 */
+{  13587,  13597 },   /* 唔吉利 */
+{  13608,   3283 },   /* 唔好 */
+{  13615,  13625 },   /* 唔客气 */
+{  13630,  13640 },   /* 唔开心 */
+{  13645,   6536 },   /* 唔相信 */
+{  13655,   6369 },   /* 唵 */
+{  13659,   6609 },   /* 啄木鸟 */
+{  13669,  13676 },   /* 商业 */
+{  13688,  13695 },   /* 商人 */
+{  13707,   8835 },   /* 商店 */
+{  13714,   9285 },   /* 商标 */
+{  13721,   1374 },   /* 啡色 */
+{  13728,   1374 },   /* 啡色心 */
+{  13738,    762 },   /* 啤酒 */
+{  13745,    762 },   /* 啤酒杯 */
+{  13755,   9837 },   /* 啧水 */
+{  13762,  11161 },   /* 喂哺 */
+{  13769,   6088 },   /* 喇叭 */
+{  13776,   2506 },   /* 喊 */
+{  13780,   2506 },   /* 喊嘅脸 */
+{  13790,  13800 },   /* 喷水池 */
+{  13804,  10173 },   /* 嗯 */
+{  13808,   7343 },   /* 嘘 */
+{  13812,   7343 },   /* 嘘嘅脸 */
+{  13822,   2926 },   /* 嘟嘟鸟 */
+{  13832,  13839 },   /* 嘭嘭 */
+{  13843,  12571 },   /* 嘲笑 */
+{  13850,   6021 },   /* 嘴 */
+{  13854,   6337 },   /* 噢 */
+{  13858,   4331 },   /* 器官 */
+{  13865,   2158 },   /* 四 */
+{  13869,   2158 },   /* 四叶草 */
+{  13879,  13886 },   /* 四点 */
+{  13891,  13901 },   /* 四点半 */
+{  13906,  12982 },   /* 回力镖 */
+{  13916,   5287 },   /* 回带 */
+{  13923,  13927 },   /* 团 */
+{  13932,   3356 },   /* 园丁 */
+{  13939,  13946 },   /* 困惑 */
+{  13951,   2491 },   /* 国王 */
+{  13958,   1829 },   /* 图 */
+{  13962,   6067 },   /* 图片 */
+{  13969,   1829 },   /* 图表 */
+{  13976,   4687 },   /* 圆屋 */
+{  13983,   1979 },   /* 圆形 */
+{  13990,  14000 },   /* 圆碌碌 */
+{  14005,  14015 },   /* 圆禁钉 */
+{  14020,   5491 },   /* 圈 */
+{  14024,   1742 },   /* 圈套 */
+{  14031,   7815 },   /* 土星 */
+{  14038,  14048 },   /* 圣诞树 */
+{  14053,   2063 },   /* 圣诞节 */
+{  14063,   6377 },   /* 在 */
+{  14067,   3628 },   /* 地下 */
+{  14074,   5672 },   /* 地图 */
+{  14081,   3150 },   /* 地球 */
+{  14088,   3150 },   /* 地球仪 */
+{  14098,   5858 },   /* 地铁 */
+{  14105,  14112 },   /* 场所 */
+{  14117,  14124 },   /* 坏人 */
+{  14129,   8254 },   /* 坐 */
+{  14133,   2179 },   /* 块 */
+{  14137,   4349 },   /* 坚硬 */
+{  14144,   4135 },   /* 坟墓 */
+{  14151,  14158 },   /* 坠落 */
+{  14163,  12901 },   /* 垂直 */
+{  14170,   5415 },   /* 垃圾 */
+{  14177,   5415 },   /* 垃圾桶 */
+{  14187,   4009 },   /* 垒球 */
+{  14194,   6481 },   /* 垫 */
+{  14198,   1722 },   /* 城堡 */
+{  14205,   2012 },   /* 城市 */
+{  14212,  14222 },   /* 培养皿 */
+{  14227,   1137 },   /* 培育 */
+{  14234,   2904 },   /* 基因 */
+{  14241,   6228 },   /* 基点 */
+{  14248,  10658 },   /* 基点间 */
+{  14258,   1956 },   /* 基督徒 */
+{  14268,  14278 },   /* 基督教 */
+{  14282,   9374 },   /* 塔 */
+{  14286,   4135 },   /* 墓地 */
+{  14293,   4135 },   /* 墓碑 */
+{  14300,   1279 },   /* 墙 */
+{  14304,   1829 },   /* 增长 */
+{  14311,   4761 },   /* 墨水 */
+{  14318,   9021 },   /* 墨西哥 */
+{  14328,    280 },   /* 士兵 */
+{  14335,  10091 },   /* 士巴拿 */
+{  14345,   8098 },   /* 壳 */
+{  14349,   3054 },   /* 壶 */
+{  14353,   3981 },   /* 处女 */
+{  14360,  14370 },   /* 处女座 */
+{  14374,  14381 },   /* 夏日 */
+{  14386,  14396 },   /* 外卖盒 */
+{  14401,   2189 },   /* 外套 */
+{  14408,    143 },   /* 外星 */
+{  14415,    143 },   /* 外星人 */
+{  14425,  14432 },   /* 外框 */
+{  14436,   6453 },   /* 外送盘 */
+{  14446,   4984 },   /* 多动作 */
+{  14456,   7088 },   /* 多窿 */
+{  14463,   4370 },   /* 多谢 */
+{  14470,   6191 },   /* 夜晚 */
+{  14477,   5214 },   /* 大 */
+{  14481,  14488 },   /* 大卫 */
+{  14492,  14499 },   /* 大厦 */
+{  14504,  14511 },   /* 大厨 */
+{  14523,   5523 },   /* 大声 */
+{  14530,  14540 },   /* 大声公 */
+{  14545,   6903 },   /* 大头针 */
+{  14555,   1309 },   /* 大桥 */
+{  14562,  14572 },   /* 大烛台 */
+{  14577,  14587 },   /* 大猩猩 */
+{  14592,    155 },   /* 大羊驼 */
+{  14602,   3785 },   /* 大虾 */
+{  14609,  14616 },   /* 大象 */
+{  14621,   4772 },   /* 大阶 */
+{  14628,   3670 },   /* 大雾 */
+{  14635,    189 },   /* 天使 */
+{  14642,   3785 },   /* 天妇罗 */
+{  14652,   5011 },   /* 天房 */
+{  14659,  14666 },   /* 天气 */
+{  14671,   2063 },   /* 天父 */
+{  14678,    189 },   /* 天真 */
+{  14685,   7850 },   /* 天秤 */
+{  14692,   7850 },   /* 天秤座 */
+{  14702,   2830 },   /* 天线 */
+{  14709,  14719 },   /* 天线棒 */
+{  14724,  14734 },   /* 天蝎座 */
+{  14739,   2566 },   /* 天鹅 */
+{  14746,   8588 },   /* 太空 */
+{  14753,   7595 },   /* 太空人 */
+{  14763,   1333 },   /* 太阳 */
+{  14770,  14780 },   /* 太阳花 */
+{  14785,  14792 },   /* 夫妇 */
+{  14797,   9853 },   /* 失望 */
+{  14804,   4310 },   /* 头 */
+{  14808,   4145 },   /* 头发 */
+{  14815,   9485 },   /* 头巾 */
+{  14822,  14829 },   /* 头晕 */
+{  14834,    280 },   /* 头盔 */
+{  14841,   5100 },   /* 奇异果 */
+{  14851,   3918 },   /* 奇怪 */
+{  14858,   7235 },   /* 奖 */
+{  14862,   7235 },   /* 奖杯 */
+{  14869,   5754 },   /* 奖牌 */
+{  14876,   3332 },   /* 奥布朗 */
+{  14886,    970 },   /* 女 */
+{  14890,   9991 },   /* 女人 */
+{  14897,   3981 },   /* 女仔 */
+{  14904,  14914 },   /* 女仙子 */
+{  14925,  14935 },   /* 女侦探 */
+{  14946,  14956 },   /* 女农夫 */
+{  14968,  14975 },   /* 女厕 */
+{  14980,  14990 },   /* 女厨师 */
+{  15002,   4359 },   /* 女士 */
+{  15009,  15019 },   /* 女学生 */
+{  15031,   5598 },   /* 女巫 */
+{  15038,  15048 },   /* 女巫师 */
+{  15059,  15069 },   /* 女技工 */
+{  15081,  15091 },   /* 女教师 */
+{  15103,  15113 },   /* 女歌手 */
+{  15125,  15135 },   /* 女殭尸 */
+{  15146,  15156 },   /* 女法官 */
+{  15167,   2491 },   /* 女王 */
+{  15174,  15184 },   /* 女精灵 */
+{  15195,  15202 },   /* 女装 */
+{  15207,  15217 },   /* 女装帽 */
+{  15222,  15232 },   /* 女装靴 */
+{  15237,  15247 },   /* 女警察 */
+{  15258,  15268 },   /* 女超人 */
+{  15279,   1149 },   /* 奶 */
+{  15283,   4083 },   /* 好 */
+{  15287,   8413 },   /* 好奇 */
+{  15294,   9277 },   /* 好累 */
+{  15301,   3959 },   /* 好运 */
+{  15308,  10173 },   /* 好食 */
+{  15315,   5988 },   /* 妈妈 */
+{  15322,   2726 },   /* 妖 */
+{  15326,    426 },   /* 姓名 */
+{  15333,   1158 },   /* 姿势 */
+{  15340,   5403 },   /* 威士忌 */
+{  15350,  15357 },   /* 娃娃 */
+{  15362,   9780 },   /* 娥眉月 */
+{  15372,  15379 },   /* 娱乐 */
+{  15384,     63 },   /* 娱乐家 */
+{  15394,   1297 },   /* 婚礼 */
+{  15401,    394 },   /* 婴儿 */
+{  15408,    200 },   /* 嬲 */
+{  15412,  13101 },   /* 嬲嘅脸 */
+{  15422,  15432 },   /* 子午线 */
+{  15437,   1445 },   /* 子弹 */
+{  15444,   6705 },   /* 孔雀 */
+{  15451,  15458 },   /* 孕妇 */
+{  15463,   4772 },   /* 字母 */
+{  15470,   7881 },   /* 学校 */
+{  15477,  15484 },   /* 学生 */
+{  15496,   1912 },   /* 孵化 */
+{  15503,   4200 },   /* 守卫员 */
+{  15513,   7708 },   /* 安全 */
+{  15520,   4135 },   /* 安息 */
+{  15527,   6088 },   /* 安静 */
+{  15534,  13310 },   /* 完全 */
+{  15541,   1956 },   /* 宗教 */
+{  15548,   3927 },   /* 宝石 */
+{  15555,   2247 },   /* 宝藏 */
+{  15562,  15569 },   /* 实验 */
+{  15574,   5168 },   /* 实验室 */
+{  15584,  15569 },   /* 实验袍 */
+{  15594,   2935 },   /* 宠物 */
+{  15601,    597 },   /* 客厅 */
+{  15608,  10911 },   /* 客船 */
+{  15615,   3400 },   /* 害怕 */
+{  15622,   4527 },   /* 家 */
+{  15626,   3344 },   /* 家庭 */
+{  15633,  15640 },   /* 家禽 */
+{  15645,   5308 },   /* 寄信 */
+{  15652,   5472 },   /* 寄存 */
+{  15659,  10069 },   /* 寄生虫 */
+{  15669,  15676 },   /* 密码 */
+{  15681,   3855 },   /* 富士 */
+{  15688,   3855 },   /* 富士山 */
+{  15698,  15705 },   /* 寒冷 */
+{  15710,  15720 },   /* 寒冷的 */
+{  15725,   9642 },   /* 对 */
+{  15729,   1158 },   /* 对唔住 */
+{  15739,   2774 },   /* 对话 */
+{  15746,   4458 },   /* 寺庙 */
+{  15753,  15760 },   /* 导师 */
+{  15772,   4211 },   /* 导盲 */
+{  15779,   4211 },   /* 导盲犬 */
+{  15789,  15796 },   /* 导航 */
+{  15801,   8929 },   /* 寿司 */
+{  15808,   1083 },   /* 封面 */
+{  15815,  14158 },   /* 射击 */
+{  15822,    241 },   /* 射手 */
+{  15829,    241 },   /* 射手座 */
+{  15839,    241 },   /* 射箭 */
+{  15846,   7439 },   /* 射线 */
+{  15853,  15857 },   /* 小 */
+{  15862,   2169 },   /* 小丑 */
+{  15869,   2169 },   /* 小丑脸 */
+{  15879,   2566 },   /* 小天鹅 */
+{  15889,   4063 },   /* 小妖精 */
+{  15899,   4687 },   /* 小屋 */
+{  15906,  15913 },   /* 小巴 */
+{  15918,   9679 },   /* 小提琴 */
+{  15928,   1812 },   /* 小教堂 */
+{  15938,  15948 },   /* 小水滴 */
+{  15953,   1923 },   /* 小童 */
+{  15960,   3210 },   /* 小精灵 */
+{  15970,  15977 },   /* 小量 */
+{  15982,     41 },   /* 小阶 */
+{  15989,   1912 },   /* 小鸡 */
+{  15996,   4947 },   /* 尺度 */
+{  16003,   2786 },   /* 尿片 */
+{  16010,   1137 },   /* 屋 */
+{  16014,   3088 },   /* 屎 */
+{  16018,  15720 },   /* 山 */
+{  16022,    828 },   /* 山地 */
+{  16029,   4051 },   /* 山羊 */
+{  16036,   4051 },   /* 山羊座 */
+{  16046,  10490 },   /* 岗位 */
+{  16053,   4836 },   /* 岛 */
+{  16057,     81 },   /* 崇拜 */
+{  16064,   6659 },   /* 巡逻 */
+{  16071,  10046 },   /* 工业 */
+{  16078,  10046 },   /* 工人 */
+{  16085,   5554 },   /* 工具 */
+{  16092,   1901 },   /* 工具箱 */
+{  16102,  10046 },   /* 工厂 */
+{  16109,  12359 },   /* 工程师 */
+{  16119,   2895 },   /* 巨灵 */
+{  16126,   4349 },   /* 巨石 */
+{  16133,    705 },   /* 巨蛇 */
+{  16140,   2428 },   /* 巨蟹座 */
+{  16150,   5580 },   /* 巫婆 */
+{  16157,   5598 },   /* 巫师 */
+{  16164,   1477 },   /* 巴士 */
+{  16171,   8824 },   /* 巴士站 */
+{  16181,   1829 },   /* 市场 */
+{  16188,  16195 },   /* 布甸 */
+{  16200,   7496 },   /* 帆船 */
+{  16207,    862 },   /* 帐单 */
+{  16214,   9148 },   /* 帐篷 */
+{  16221,   3332 },   /* 帕克 */
+{  16228,   9046 },   /* 带 */
+{  16232,   4387 },   /* 帮助 */
+{  16239,   9426 },   /* 常青树 */
+{  16249,   2418 },   /* 帽 */
+{  16253,   1385 },   /* 干净 */
+{  16260,   3840 },   /* 平底镬 */
+{  16270,  16280 },   /* 平底鞋 */
+{  16285,   4984 },   /* 平行 */
+{  16292,    394 },   /* 年青 */
+{  16299,   2480 },   /* 幸运 */
+{  16306,    189 },   /* 幻想 */
+{  16313,  16320 },   /* 幼小 */
+{  16325,  16320 },   /* 幼苗 */
+{  16332,   6629 },   /* 庆祝 */
+{  16339,    743 },   /* 床 */
+{  16343,  16353 },   /* 废纸篓 */
+{  16358,   7496 },   /* 度假村 */
+{  16368,   1800 },   /* 座位 */
+{  16375,   2365 },   /* 座灯 */
+{  16382,    715 },   /* 康加鼓 */
+{  16392,  16399 },   /* 建筑 */
+{  16404,  13676 },   /* 建筑师 */
+{  16414,  16421 },   /* 建造 */
+{  16426,   5448 },   /* 开 */
+{  16430,   8032 },   /* 开会 */
+{  16437,   2200 },   /* 开发者 */
+{  16447,   6705 },   /* 开屏 */
+{  16454,   4916 },   /* 开玩笑 */
+{  16464,   1880 },   /* 开花 */
+{  16471,   2344 },   /* 开酒塞 */
+{  16481,    241 },   /* 弓 */
+{  16485,    241 },   /* 弓箭 */
+{  16492,   3517 },   /* 张开 */
+{  16499,   9780 },   /* 弦月 */
+{  16506,    554 },   /* 弦线 */
+{  16513,   1742 },   /* 弯 */
+{  16517,   1742 },   /* 弯曲 */
+{  16524,  16534 },   /* 录像机 */
+{  16539,   1979 },   /* 录制 */
+{  16546,   9046 },   /* 录影带 */
+{  16556,   9046 },   /* 录影机 */
+{  16566,   5867 },   /* 录音室 */
+{  16576,   2268 },   /* 彗星 */
+{  16583,  16590 },   /* 彩虹 */
+{  16595,   7194 },   /* 彩虹旗 */
+{  16605,   7384 },   /* 影片 */
+{  16612,  16616 },   /* 得 */
+{  16621,    167 },   /* 微生物 */
+{  16631,   7257 },   /* 微笑 */
+{  16638,   9589 },   /* 德古拉 */
+{  16648,   3232 },   /* 徽章 */
+{  16655,   5308 },   /* 心 */
+{  16659,   4331 },   /* 心脏 */
+{  16666,   4331 },   /* 心跳 */
+{  16673,   2451 },   /* 忌廉 */
+{  16680,   4419 },   /* 忍者 */
+{  16687,  16694 },   /* 忧心 */
+{  16699,   2990 },   /* 快 */
+{  16703,   4936 },   /* 快乐 */
+{  16710,  16717 },   /* 快到 */
+{  16722,  16729 },   /* 快艇 */
+{  16734,   2663 },   /* 快走 */
+{  16741,   2990 },   /* 快进 */
+{  16748,   2663 },   /* 快速 */
+{  16755,    672 },   /* 念珠 */
+{  16762,  15458 },   /* 怀孕 */
+{  16769,  16776 },   /* 怀疑 */
+{  16781,   5829 },   /* 怜悯 */
+{  16788,   2705 },   /* 怪物 */
+{  16795,     81 },   /* 恋爱 */
+{  16802,   9064 },   /* 恐布 */
+{  16809,  16816 },   /* 恭喜 */
+{  16820,   2726 },   /* 恶魔 */
+{  16827,   4370 },   /* 您好 */
+{  16834,  16841 },   /* 悬架 */
+{  16846,   7525 },   /* 情人 */
+{  16853,   2377 },   /* 情侣 */
+{  16860,   5308 },   /* 情信 */
+{  16867,   6048 },   /* 惊叫 */
+{  16874,   3400 },   /* 惊恐 */
+{  16881,   3400 },   /* 惊慌 */
+{  16888,   4678 },   /* 惊讶 */
+{  16895,   6048 },   /* 惧怕 */
+{  16902,   1423 },   /* 想法 */
+{  16909,   7257 },   /* 感动 */
+{  16916,  13839 },   /* 感叹号 */
+{  16926,   5693 },   /* 感叹嘅 */
+{  16936,   7257 },   /* 感激 */
+{  16943,   1170 },   /* 感谢 */
+{  16950,    200 },   /* 愤怒 */
+{  16957,   5260 },   /* 慢 */
+{  16961,   5260 },   /* 懒 */
+{  16965,   3505 },   /* 戏 */
+{  16969,   1967 },   /* 戏院 */
+{  16976,     92 },   /* 成人 */
+{  16983,   1137 },   /* 成长 */
+{  16990,  17000 },   /* 我爱您 */
+{  17005,   7546 },   /* 戒指 */
+{  17012,    280 },   /* 战士 */
+{  17019,   4419 },   /* 战斗机 */
+{  17029,  17036 },   /* 房屋 */
+{  17041,   4274 },   /* 手 */
+{  17045,  12571 },   /* 手势 */
+{  17052,   9021 },   /* 手卷 */
+{  17059,   4009 },   /* 手套 */
+{  17066,  12571 },   /* 手指 */
+{  17073,   9213 },   /* 手指公 */
+{  17083,   6536 },   /* 手掌 */
+{  17090,   7137 },   /* 手提袋 */
+{  17100,   1582 },   /* 手机 */
+{  17107,   4232 },   /* 手枪 */
+{  17114,  17121 },   /* 手球 */
+{  17126,    818 },   /* 手瓜 */
+{  17133,   2113 },   /* 手表 */
+{  17140,    447 },   /* 手袋 */
+{  17147,  17157 },   /* 手风琴 */
+{  17162,    715 },   /* 手鼓 */
+{  17169,   1944 },   /* 扒 */
+{  17173,   3558 },   /* 打 */
+{  17177,  17187 },   /* 打印机 */
+{  17192,   1125 },   /* 打喊露 */
+{  17202,   3745 },   /* 打开 */
+{  17209,  17219 },   /* 打开手 */
+{  17224,  17231 },   /* 打扮 */
+{  17243,  17250 },   /* 打气 */
+{  17255,   1559 },   /* 打电话 */
+{  17265,   6453 },   /* 托盘 */
+{  17272,   2786 },   /* 扣针 */
+{  17279,  17250 },   /* 扩音器 */
+{  17289,   1363 },   /* 扫 */
+{  17293,   1363 },   /* 扫把 */
+{  17300,   5148 },   /* 扭 */
+{  17304,   4813 },   /* 扭歪 */
+{  17311,  17318 },   /* 扭纹 */
+{  17323,  10091 },   /* 扳手 */
+{  17330,   6852 },   /* 批 */
+{  17334,  17341 },   /* 技工 */
+{  17353,   4984 },   /* 技术 */
+{  17360,   8393 },   /* 投币口 */
+{  17370,    519 },   /* 投票 */
+{  17377,   6812 },   /* 抗议 */
+{  17384,  12258 },   /* 折扣 */
+{  17391,  17395 },   /* 抢 */
+{  17406,   6268 },   /* 护士 */
+{  17413,  17420 },   /* 护照 */
+{  17425,   1673 },   /* 护理 */
+{  17432,    661 },   /* 护符 */
+{  17439,  17446 },   /* 护镜 */
+{  17451,   6164 },   /* 报纸 */
+{  17458,   4370 },   /* 抱抱 */
+{  17465,  12134 },   /* 抵达 */
+{  17472,  17479 },   /* 担心 */
+{  17484,   4772 },   /* 拉丁 */
+{  17491,  10200 },   /* 拉链 */
+{  17498,   1186 },   /* 拉面 */
+{  17505,    715 },   /* 拍子 */
+{  17512,   2052 },   /* 拍手 */
+{  17519,  17526 },   /* 拍板 */
+{  17531,  14792 },   /* 拖 */
+{  17535,   2377 },   /* 拖住 */
+{  17542,   5501 },   /* 拖头车 */
+{  17552,  17562 },   /* 拖拉机 */
+{  17567,  16280 },   /* 拖鞋 */
+{  17574,   7019 },   /* 招牌 */
+{  17581,   4370 },   /* 拜拜 */
+{  17588,   4370 },   /* 拥抱 */
+{  17595,   1202 },   /* 拳击 */
+{  17602,   3558 },   /* 拳头 */
+{  17609,   1202 },   /* 拳套 */
+{  17616,    705 },   /* 持有人 */
+{  17626,   4745 },   /* 指 */
+{  17630,  15796 },   /* 指南针 */
+{  17640,   4745 },   /* 指向 */
+{  17647,   1673 },   /* 指甲 */
+{  17654,   1673 },   /* 指甲油 */
+{  17664,   7740 },   /* 按摩 */
+{  17671,   1511 },   /* 按钮 */
+{  17678,   5884 },   /* 挑 */
+{  17682,   4274 },   /* 挥手 */
+{  17689,   4274 },   /* 挥紧手 */
+{  17699,  15977 },   /* 捏手 */
+{  17706,    929 },   /* 捐血 */
+{  17713,   4666 },   /* 损伤 */
+{  17720,  17727 },   /* 换片 */
+{  17732,   3410 },   /* 掌 */
+{  17736,   3410 },   /* 掌印 */
+{  17743,   3875 },   /* 排球 */
+{  17750,   4719 },   /* 探热针 */
+{  17760,  13169 },   /* 接受 */
+{  17767,  17774 },   /* 接收 */
+{  17779,   5138 },   /* 控制 */
+{  17786,  17796 },   /* 控制器 */
+{  17801,   3828 },   /* 提子 */
+{  17808,   4387 },   /* 提示 */
+{  17815,   6987 },   /* 插头 */
+{  17822,   8032 },   /* 握 */
+{  17826,   8032 },   /* 握手 */
+{  17833,   3558 },   /* 握紧 */
+{  17840,  17844 },   /* 揽 */
+{  17849,   7949 },   /* 搜寻 */
+{  17856,   2278 },   /* 搞笑 */
+{  17863,   9383 },   /* 摇 */
+{  17867,   9383 },   /* 摇摇 */
+{  17874,  17881 },   /* 摇滚 */
+{  17886,  17893 },   /* 摔交 */
+{  17898,  17893 },   /* 摔交手 */
+{  17908,   2623 },   /* 摧毁 */
+{  17915,   3441 },   /* 摩天轮 */
+{  17925,   5915 },   /* 摩艾 */
+{  17932,    200 },   /* 撅嘴 */
+{  17939,   6971 },   /* 播放 */
+{  17946,   4734 },   /* 收件盘 */
+{  17956,   4734 },   /* 收件箱 */
+{  17966,  17973 },   /* 收到 */
+{  17978,   7246 },   /* 收据 */
+{  17985,  17992 },   /* 收费 */
+{  17997,   6836 },   /* 收集 */
+{  18004,   7384 },   /* 收音机 */
+{  18014,  18021 },   /* 放低 */
+{  18026,   7949 },   /* 放大 */
+{  18033,  18043 },   /* 放射性 */
+{  18047,  18057 },   /* 放映机 */
+{  18062,  18069 },   /* 放松 */
+{  18073,  18083 },   /* 救护车 */
+{  18088,   7708 },   /* 救生衣 */
+{  18098,   1956 },   /* 教堂 */
+{  18105,  18112 },   /* 教师 */
+{  18124,  15760 },   /* 教授 */
+{  18131,   7307 },   /* 散子 */
+{  18138,   7307 },   /* 散子包 */
+{  18148,   8664 },   /* 敬礼 */
+{  18155,  18162 },   /* 数字 */
+{  18167,   5729 },   /* 数学 */
+{  18174,  18184 },   /* 数学家 */
+{  18196,   2531 },   /* 文件 */
+{  18203,   3483 },   /* 文件夹 */
+{  18213,  14222 },   /* 文化 */
+{  18220,   8704 },   /* 斑点 */
+{  18227,   8865 },   /* 斑马 */
+{  18234,    377 },   /* 斧头 */
+{  18241,    377 },   /* 斩 */
+{  18245,   1297 },   /* 新娘 */
+{  18252,   8617 },   /* 新干线 */
+{  18262,   2643 },   /* 新月 */
+{  18269,  18279 },   /* 新月面 */
+{  18284,   4177 },   /* 新郎 */
+{  18291,   6164 },   /* 新闻 */
+{  18298,  15796 },   /* 方位 */
+{  18305,   8835 },   /* 方便 */
+{  18312,   6228 },   /* 方向 */
+{  18319,  18329 },   /* 方格旗 */
+{  18334,   9411 },   /* 旅行 */
+{  18341,  18348 },   /* 旋转 */
+{  18353,  18360 },   /* 旋风 */
+{  18365,   1683 },   /* 旗 */
+{  18369,  11601 },   /* 无 */
+{  18373,   8231 },   /* 无声 */
+{  18380,    485 },   /* 无头发 */
+{  18390,   1137 },   /* 无用 */
+{  18397,   3000 },   /* 无知 */
+{  18404,   5775 },   /* 无表情 */
+{  18414,  13625 },   /* 无表达 */
+{  18424,  18431 },   /* 无限 */
+{  18435,  18431 },   /* 无限制 */
+{  18445,   4502 },   /* 无障碍 */
+{  18455,   1829 },   /* 日元 */
+{  18462,  18469 },   /* 日出 */
+{  18474,   2673 },   /* 日历 */
+{  18481,    862 },   /* 日圆 */
+{  18488,   7098 },   /* 日式 */
+{  18495,   2673 },   /* 日期 */
+{  18502,  13927 },   /* 日本 */
+{  18509,   3103 },   /* 日落 */
+{  18516,  18520 },   /* 旧 */
+{  18525,  18520 },   /* 旧锁匙 */
+{  18535,  18469 },   /* 早上 */
+{  18542,   1772 },   /* 早餐 */
+{  18549,   2113 },   /* 时钟 */
+{  18556,   4387 },   /* 时髦 */
+{  18563,    774 },   /* 昆虫 */
+{  18570,   3311 },   /* 明星 */
+{  18577,   3311 },   /* 明星脸 */
+{  18587,  18591 },   /* 星 */
+{  18596,   6191 },   /* 星夜 */
+{  18603,   3981 },   /* 星座 */
+{  18610,   6191 },   /* 星星 */
+{  18617,  18627 },   /* 显微镜 */
+{  18632,   2884 },   /* 晕 */
+{  18636,   1309 },   /* 晚上 */
+{  18643,   4177 },   /* 晚礼服 */
+{  18653,   3745 },   /* 景观 */
+{  18660,   7439 },   /* 晴朗 */
+{  18667,   1222 },   /* 智力 */
+{  18674,   6462 },   /* 智慧 */
+{  18681,   6670 },   /* 暂停 */
+{  18688,   2820 },   /* 暗 */
+{  18692,  18699 },   /* 暴龙 */
+{  18704,   7557 },   /* 曱甴 */
+{  18711,    114 },   /* 曲发 */
+{  18718,   2320 },   /* 曲奇 */
+{  18725,   3473 },   /* 曲棍球 */
+{  18735,   9780 },   /* 月 */
+{  18739,   2643 },   /* 月亮 */
+{  18746,    929 },   /* 月经 */
+{  18753,  18760 },   /* 月费 */
+{  18765,    368 },   /* 月饼 */
+{  18772,  17992 },   /* 有 */
+{  18776,   3670 },   /* 有雾 */
+{  18783,  12555 },   /* 服务 */
+{  18790,    784 },   /* 服务员 */
+{  18800,  18810 },   /* 服务费 */
+{  18815,   7224 },   /* 服装 */
+{  18822,  18832 },   /* 望远镜 */
+{  18837,    377 },   /* 木 */
+{  18841,   5481 },   /* 木头 */
+{  18848,   9184 },   /* 木屐 */
+{  18855,   5554 },   /* 木工 */
+{  18862,   5554 },   /* 木材 */
+{  18869,   1409 },   /* 木桶 */
+{  18876,   5554 },   /* 木锯 */
+{  18883,  12497 },   /* 未成年 */
+{  18893,   1851 },   /* 朱古力 */
+{  18903,  18913 },   /* 机动船 */
+{  18918,   7578 },   /* 机械人 */
+{  18928,  18938 },   /* 机械脚 */
+{  18943,  10864 },   /* 机械臂 */
+{  18953,   4984 },   /* 杂耍 */
+{  18960,    585 },   /* 条 */
+{  18964,   8865 },   /* 条纹 */
+{  18971,  17774 },   /* 来 */
+{  18975,   3992 },   /* 杯 */
+{  18979,    531 },   /* 松树 */
+{  18986,   1023 },   /* 板 */
+{  18990,  18997 },   /* 板手 */
+{  19002,  19009 },   /* 板球 */
+{  19014,   6283 },   /* 果仁 */
+{  19021,   4995 },   /* 果汁 */
+{  19028,   8846 },   /* 果汁盒 */
+{  19038,  19048 },   /* 果汁酒 */
+{  19053,   7076 },   /* 枪 */
+{  19057,   5683 },   /* 枫叶 */
+{  19064,   5683 },   /* 枫树 */
+{  19071,  19078 },   /* 柑桔 */
+{  19083,   2002 },   /* 柑橘 */
+{  19090,  19097 },   /* 柔软 */
+{  19102,   4963 },   /* 柔道 */
+{  19109,   3495 },   /* 柜 */
+{  19113,   2002 },   /* 柠檬 */
+{  19120,   6812 },   /* 标志 */
+{  19127,   5704 },   /* 标签 */
+{  19134,   5704 },   /* 标记 */
+{  19141,   6812 },   /* 标语 */
+{  19148,   9426 },   /* 树 */
+{  19152,   5159 },   /* 树熊 */
+{  19159,   5260 },   /* 树獭 */
+{  19166,  19173 },   /* 栗子 */
+{  19178,  18329 },   /* 格子 */
+{  19185,   6693 },   /* 桃 */
+{  19189,   3745 },   /* 框架 */
+{  19196,   6067 },   /* 框画 */
+{  19203,  19210 },   /* 桌球 */
+{  19215,  19222 },   /* 桌面 */
+{  19227,   7826 },   /* 桑拿 */
+{  19234,   3483 },   /* 档案 */
+{  19241,   3495 },   /* 档案柜 */
+{  19251,   6346 },   /* 桶 */
+{  19255,  19262 },   /* 梅花 */
+{  19266,   6722 },   /* 梨 */
+{  19270,   2091 },   /* 梯 */
+{  19274,   2091 },   /* 梯级 */
+{  19281,   4995 },   /* 梳打 */
+{  19288,  17420 },   /* 检查 */
+{  19295,   4041 },   /* 棍 */
+{  19299,   6310 },   /* 棒 */
+{  19303,  19313 },   /* 棒型图 */
+{  19318,  19325 },   /* 棒球 */
+{  19329,  19339 },   /* 棒球帽 */
+{  19344,  19351 },   /* 棕榈 */
+{  19356,  19351 },   /* 棕榈树 */
+{  19366,   2230 },   /* 棺材 */
+{  19373,   1137 },   /* 植物 */
+{  19380,  19048 },   /* 椰子 */
+{  19387,   7657 },   /* 榄球 */
+{  19394,  19398 },   /* 槿 */
+{  19403,   5932 },   /* 模式 */
+{  19410,    576 },   /* 横额 */
+{  19417,   1880 },   /* 樱花 */
+{  19424,   1149 },   /* 樽 */
+{  19428,   3700 },   /* 橄榄 */
+{  19435,  19078 },   /* 橙 */
+{  19439,   6424 },   /* 橙色 */
+{  19446,  19456 },   /* 橙色书 */
+{  19461,   6424 },   /* 橙色心 */
+{  19471,   1800 },   /* 櫈 */
+{  19475,   3273 },   /* 欧元 */
+{  19482,   3150 },   /* 欧洲 */
+{  19489,  19499 },   /* 欧陆式 */
+{  19504,     63 },   /* 歌手 */
+{  19511,   6619 },   /* 歌记号 */
+{  19521,  19528 },   /* 正义 */
+{  19539,   8720 },   /* 正方形 */
+{  19549,   2091 },   /* 步 */
+{  19553,   4484 },   /* 武器 */
+{  19560,   4963 },   /* 武术 */
+{  19567,   2705 },   /* 死 */
+{  19571,  11139 },   /* 死亡 */
+{  19578,  19585 },   /* 残月 */
+{  19590,    330 },   /* 殡仪馆 */
+{  19600,  10219 },   /* 殭尸 */
+{  19607,  19614 },   /* 毒菌 */
+{  19619,    852 },   /* 比坚尼 */
+{  19629,   3875 },   /* 比赛 */
+{  19636,    458 },   /* 比高包 */
+{  19646,  15484 },   /* 毕业 */
+{  19653,  19663 },   /* 毕业帽 */
+{  19668,   7003 },   /* 毛绒 */
+{  19675,   2812 },   /* 气体 */
+{  19682,   2774 },   /* 气球 */
+{  19689,   7043 },   /* 水 */
+{  19693,    734 },   /* 水坝 */
+{  19700,  19707 },   /* 水晶 */
+{  19712,  19707 },   /* 水晶球 */
+{  19722,   5663 },   /* 水果 */
+{  19729,   1409 },   /* 水桶 */
+{  19736,   1279 },   /* 水泥 */
+{  19743,   3064 },   /* 水点 */
+{  19750,    895 },   /* 水牛 */
+{  19757,    734 },   /* 水狸 */
+{  19764,   7043 },   /* 水球 */
+{  19771,   4972 },   /* 水瓶座 */
+{  19781,   9509 },   /* 水龟 */
+{  19788,  18431 },   /* 永远 */
+{  19795,   8558 },   /* 求助 */
+{  19802,   1468 },   /* 汉堡包 */
+{  19812,   2257 },   /* 汗 */
+{  19816,  19823 },   /* 汽球 */
+{  19828,  19835 },   /* 汽车 */
+{  19840,   4678 },   /* 沉默 */
+{  19847,   7760 },   /* 沙 */
+{  19851,   2365 },   /* 沙发 */
+{  19858,   7729 },   /* 沙律 */
+{  19865,  19872 },   /* 沙漏 */
+{  19876,   2745 },   /* 沙漠 */
+{  19883,  16694 },   /* 沮丧 */
+{  19890,   4469 },   /* 河马 */
+{  19897,   6346 },   /* 油 */
+{  19901,   6346 },   /* 油桶 */
+{  19908,   6268 },   /* 治疗师 */
+{  19918,  12555 },   /* 治疗犬 */
+{  19928,  19932 },   /* 泉 */
+{  19936,  19943 },   /* 泊车 */
+{  19948,   3774 },   /* 法国 */
+{  19955,   4947 },   /* 法官 */
+{  19962,  19969 },   /* 法式 */
+{  19974,   1397 },   /* 泡 */
+{  19978,   2774 },   /* 泡泡 */
+{  19985,   6824 },   /* 泡菜 */
+{  19992,    495 },   /* 波 */
+{  19996,  20006 },   /* 波板糖 */
+{  20011,   6300 },   /* 波浪 */
+{  20018,   7350 },   /* 注册 */
+{  20025,  12420 },   /* 注射 */
+{  20032,   6481 },   /* 注释 */
+{  20039,  20046 },   /* 泳衣 */
+{  20051,   1321 },   /* 泳裤 */
+{  20058,   2812 },   /* 泵 */
+{  20062,   6407 },   /* 洋葱 */
+{  20069,   5513 },   /* 洗头水 */
+{  20079,   9788 },   /* 洗手间 */
+{  20089,    609 },   /* 洗衫 */
+{  20096,  20100 },   /* 洞 */
+{  20104,   6629 },   /* 派对 */
+{  20111,   7076 },   /* 派对枪 */
+{  20121,   1760 },   /* 流动 */
+{  20128,  20138 },   /* 流口水 */
+{  20143,  14158 },   /* 流星 */
+{  20150,   6505 },   /* 浅 */
+{  20154,  20164 },   /* 浅肤色 */
+{  20169,    907 },   /* 浓汤 */
+{  20176,   1812 },   /* 浪漫 */
+{  20183,   7923 },   /* 浮潜 */
+{  20190,   1385 },   /* 浴室 */
+{  20197,    628 },   /* 浴缸 */
+{  20204,   7496 },   /* 海 */
+{  20208,  20215 },   /* 海关 */
+{  20220,   6300 },   /* 海洋 */
+{  20227,   6300 },   /* 海浪 */
+{  20234,    639 },   /* 海滩 */
+{  20241,   7937 },   /* 海狮 */
+{  20248,   6609 },   /* 海盗 */
+{  20255,  17395 },   /* 海盗旗 */
+{  20265,   7088 },   /* 海绵 */
+{  20272,  20279 },   /* 海豚 */
+{  20284,   7937 },   /* 海豹 */
+{  20291,   6310 },   /* 海鲜 */
+{  20298,   9509 },   /* 海龟 */
+{  20305,   1891 },   /* 消闲 */
+{  20312,  20322 },   /* 消防员 */
+{  20334,  20322 },   /* 消防车 */
+{  20344,   5513 },   /* 润肤霜 */
+{  20354,  20364 },   /* 深肤色 */
+{  20369,   1363 },   /* 清洁 */
+{  20376,   4824 },   /* 清真寺 */
+{  20386,   7718 },   /* 清酒 */
+{  20393,   3452 },   /* 渡船 */
+{  20400,  14666 },   /* 温度计 */
+{  20410,  19932 },   /* 温泉 */
+{  20417,   3441 },   /* 游乐场 */
+{  20427,  20434 },   /* 游戏 */
+{  20439,  20449 },   /* 游戏杆 */
+{  20454,   8961 },   /* 游水 */
+{  20461,   7496 },   /* 游艇 */
+{  20468,  20472 },   /* 溅 */
+{  20477,  20484 },   /* 溜冰 */
+{  20488,   7631 },   /* 溜冰鞋 */
+{  20498,   5319 },   /* 滑块 */
+{  20505,   1023 },   /* 滑板 */
+{  20512,   5999 },   /* 滑板车 */
+{  20522,  20529 },   /* 滑浪 */
+{  20534,  20544 },   /* 滑翔伞 */
+{  20549,   8285 },   /* 滑雪 */
+{  20556,  20566 },   /* 滑雪板 */
+{  20571,   6568 },   /* 滚动 */
+{  20578,  20585 },   /* 滚筒 */
+{  20590,   7631 },   /* 滚轴 */
+{  20597,  20601 },   /* 满 */
+{  20606,   3865 },   /* 满分 */
+{  20613,   5243 },   /* 满意 */
+{  20620,  20601 },   /* 满月 */
+{  20627,  20637 },   /* 满月面 */
+{  20642,  20472 },   /* 滴汗 */
+{  20649,     63 },   /* 演员 */
+{  20656,   1549 },   /* 漩涡 */
+{  20663,   3088 },   /* 漫画 */
+{  20670,   2863 },   /* 潜水 */
+{  20677,   7923 },   /* 潜水镜 */
+{  20687,  12982 },   /* 澳洲 */
+{  20694,   3527 },   /* 火 */
+{  20698,  20705 },   /* 火山 */
+{  20710,   3594 },   /* 火焰 */
+{  20717,   7595 },   /* 火箭 */
+{  20724,  20731 },   /* 火花 */
+{  20736,   3253 },   /* 火车 */
+{  20743,   9497 },   /* 火鸡 */
+{  20750,    651 },   /* 灯 */
+{  20754,   1423 },   /* 灯泡 */
+{  20761,   4846 },   /* 灯笼 */
+{  20768,   6755 },   /* 灯笼椒 */
+{  20778,   1423 },   /* 灯胆 */
+{  20785,    330 },   /* 灰烬 */
+{  20792,   4145 },   /* 灰色 */
+{  20799,   8790 },   /* 炖 */
+{  20803,  20810 },   /* 炮丈 */
+{  20815,   3785 },   /* 炸 */
+{  20819,   1063 },   /* 炸弹 */
+{  20826,  20810 },   /* 炸药 */
+{  20833,   3785 },   /* 炸虾 */
+{  20840,   9541 },   /* 点 */
+{  20844,   5403 },   /* 烈酒 */
+{  20851,   5403 },   /* 烈酒㷴 */
+{  20861,    458 },   /* 烘焙 */
+{  20868,  14572 },   /* 烛台 */
+{  20875,    415 },   /* 烟肉 */
+{  20882,  20889 },   /* 烟花 */
+{  20894,   4242 },   /* 烤肉串 */
+{  20904,    270 },   /* 烤饼 */
+{  20911,  17446 },   /* 烧焊 */
+{  20918,   8951 },   /* 烩 */
+{  20922,   8951 },   /* 烩番薯 */
+{  20932,   4606 },   /* 热 */
+{  20936,  20943 },   /* 热带 */
+{  20948,  20958 },   /* 热带鱼 */
+{  20963,   4618 },   /* 热狗 */
+{  20970,  19932 },   /* 热腾腾 */
+{  20980,   2219 },   /* 热饮 */
+{  20987,  20997 },   /* 热香饼 */
+{  21002,   3840 },   /* 煎 */
+{  21006,   2308 },   /* 煮熟 */
+{  21013,   3840 },   /* 煮食 */
+{  21020,   1851 },   /* 煲 */
+{  21024,   7332 },   /* 熄 */
+{  21028,    682 },   /* 熊 */
+{  21032,   7003 },   /* 熊仔 */
+{  21039,   6551 },   /* 熊猫 */
+{  21046,   6551 },   /* 熊猫脸 */
+{  21056,    682 },   /* 熊脸 */
+{  21063,   2812 },   /* 燃油 */
+{  21070,   2812 },   /* 燃油泵 */
+{  21080,  21090 },   /* 燕尾服 */
+{  21101,   1772 },   /* 燕麦 */
+{  21108,  20705 },   /* 爆发 */
+{  21115,  20810 },   /* 爆炸 */
+{  21122,  21132 },   /* 爆炸头 */
+{  21137,  21144 },   /* 爆谷 */
+{  21149,    907 },   /* 爪 */
+{  21153,   2091 },   /* 爬 */
+{  21157,   5533 },   /* 爱 */
+{  21161,   5308 },   /* 爱情 */
+{  21168,   6943 },   /* 片 */
+{  21172,  21179 },   /* 片装 */
+{  21184,   1518 },   /* 版权 */
+{  21191,    426 },   /* 牌 */
+{  21195,   1385 },   /* 牙 */
+{  21199,   1385 },   /* 牙刷 */
+{  21206,   9336 },   /* 牙医 */
+{  21213,   1385 },   /* 牙科 */
+{  21220,   9336 },   /* 牙齿 */
+{  21227,   2406 },   /* 牛 */
+{  21231,   2418 },   /* 牛仔 */
+{  21238,   4864 },   /* 牛仔裤 */
+{  21248,   2418 },   /* 牛女 */
+{  21255,   1397 },   /* 牛奶 */
+{  21262,   1944 },   /* 牛扒 */
+{  21269,   1499 },   /* 牛油 */
+{  21276,  21286 },   /* 牛油果 */
+{  21291,   2406 },   /* 牛脸 */
+{  21298,   4586 },   /* 牛角 */
+{  21305,   3774 },   /* 牛角包 */
+{  21315,   3774 },   /* 牛角卷 */
+{  21325,  21332 },   /* 牧人 */
+{  21344,  21351 },   /* 犀牛 */
+{  21356,  14124 },   /* 犯罪 */
+{  21363,  14488 },   /* 犹太人 */
+{  21373,  21383 },   /* 犹太教 */
+{  21388,   4606 },   /* 狂热 */
+{  21395,   3734 },   /* 狐狸 */
+{  21402,   3734 },   /* 狐狸脸 */
+{  21412,   2935 },   /* 狗 */
+{  21416,   2935 },   /* 狗脸 */
+{  21423,   8413 },   /* 狡猾 */
+{  21430,   1570 },   /* 独峰驼 */
+{  21440,   1636 },   /* 独木舟 */
+{  21450,  21460 },   /* 独角兽 */
+{  21465,   5381 },   /* 狮子 */
+{  21472,   5381 },   /* 狮子座 */
+{  21482,   7059 },   /* 狮子狗 */
+{  21492,   5381 },   /* 狮子脸 */
+{  21502,   8413 },   /* 狸 */
+{  21506,   9980 },   /* 狼 */
+{  21510,   9980 },   /* 狼脸 */
+{  21517,    218 },   /* 猩猩 */
+{  21524,   6867 },   /* 猪 */
+{  21528,   1012 },   /* 猪公 */
+{  21535,   1944 },   /* 猪扒 */
+{  21542,   6867 },   /* 猪脸 */
+{  21549,  21556 },   /* 猪鼻 */
+{  21561,   1731 },   /* 猫 */
+{  21565,   6462 },   /* 猫头鹰 */
+{  21575,  21582 },   /* 猫脸 */
+{  21587,    218 },   /* 猿 */
+{  21591,   6441 },   /* 獭 */
+{  21595,    438 },   /* 獾 */
+{  21599,   2354 },   /* 玉米 */
+{  21606,   7213 },   /* 王子 */
+{  21613,   5719 },   /* 玛黛茶 */
+{  21623,  21627 },   /* 玩 */
+{  21632,   9383 },   /* 玩具 */
+{  21639,   7646 },   /* 玫瑰 */
+{  21646,  10069 },   /* 环虫 */
+{  21653,   5403 },   /* 玻璃 */
+{  21660,  21670 },   /* 玻璃杯 */
+{  21675,   1397 },   /* 珍珠 */
+{  21682,    661 },   /* 珠 */
+{  21686,   3927 },   /* 珠宝 */
+{  21693,    554 },   /* 班卓琴 */
+{  21703,  20997 },   /* 班戟 */
+{  21710,  17121 },   /* 球 */
+{  21714,   3473 },   /* 球场 */
+{  21721,   6493 },   /* 球拍 */
+{  21728,  19009 },   /* 球棒 */
+{  21735,    597 },   /* 理发 */
+{  21742,  10158 },   /* 瑜伽 */
+{  21749,   1851 },   /* 瑞士 */
+{  21756,   8664 },   /* 瓦肯式 */
+{  21766,    330 },   /* 瓮 */
+{  21770,   2633 },   /* 甜 */
+{  21774,   2633 },   /* 甜品 */
+{  21781,   2904 },   /* 生命 */
+{  21788,   3971 },   /* 生姜 */
+{  21795,   3828 },   /* 生果 */
+{  21802,   6329 },   /* 生物 */
+{  21809,  14222 },   /* 生物学 */
+{  21819,   4719 },   /* 生病 */
+{  21826,  21833 },   /* 生肖 */
+{  21837,   5021 },   /* 生菜 */
+{  21844,   2863 },   /* 生蚝 */
+{  21851,   4761 },   /* 用笔锁 */
+{  21861,    774 },   /* 甲壳虫 */
+{  21871,    774 },   /* 甲虫 */
+{  21878,  21882 },   /* 申 */
+{  21887,  21882 },   /* 申请 */
+{  21894,   1654 },   /* 电 */
+{  21898,   2623 },   /* 电力 */
+{  21905,  21915 },   /* 电单车 */
+{  21920,   2623 },   /* 电压 */
+{  21927,  17341 },   /* 电工 */
+{  21934,   1967 },   /* 电影 */
+{  21941,  21948 },   /* 电池 */
+{  21953,   9363 },   /* 电筒 */
+{  21960,   5203 },   /* 电脑 */
+{  21967,   9529 },   /* 电视机 */
+{  21977,   1760 },   /* 电话 */
+{  21984,   1654 },   /* 电车 */
+{  21991,   3221 },   /* 电邮 */
+{  21998,  22002 },   /* 男 */
+{  22013,   5652 },   /* 男人 */
+{  22020,   1211 },   /* 男仔 */
+{  22027,  22037 },   /* 男仙子 */
+{  22048,  22058 },   /* 男侦探 */
+{  22069,  21332 },   /* 男农夫 */
+{  22079,   9788 },   /* 男厕 */
+{  22086,  14511 },   /* 男厨师 */
+{  22096,   8142 },   /* 男士 */
+{  22103,  22113 },   /* 男学生 */
+{  22125,   5580 },   /* 男巫 */
+{  22132,  22142 },   /* 男巫师 */
+{  22153,  13695 },   /* 男技工 */
+{  22163,  18112 },   /* 男教师 */
+{  22173,  22183 },   /* 男歌手 */
+{  22195,  22205 },   /* 男殭尸 */
+{  22216,  19528 },   /* 男法官 */
+{  22226,  22236 },   /* 男精灵 */
+{  22247,   8142 },   /* 男装鞋 */
+{  22257,  22267 },   /* 男警察 */
+{  22278,  22288 },   /* 男超人 */
+{  22299,  22306 },   /* 画画 */
+{  22311,  22306 },   /* 画笔 */
+{  22318,   3505 },   /* 画面 */
+{  22325,   5226 },   /* 番枧 */
+{  22332,   5226 },   /* 番枧盒 */
+{  22342,   9308 },   /* 番茄 */
+{  22349,   8951 },   /* 番薯 */
+{  22356,   3462 },   /* 疟疾 */
+{  22363,   3661 },   /* 疾病 */
+{  22370,   2916 },   /* 病 */
+{  22374,   3462 },   /* 病毒 */
+{  22381,  22388 },   /* 痛苦 */
+{  22393,   9320 },   /* 痢 */
+{  22397,  22407 },   /* 登山者 */
+{  22412,   1456 },   /* 白兔 */
+{  22419,   5643 },   /* 白羊座 */
+{  22429,   9871 },   /* 白色 */
+{  22436,   9871 },   /* 白色心 */
+{  22446,  22456 },   /* 白色旗 */
+{  22461,  22468 },   /* 白花 */
+{  22473,   5021 },   /* 白菜 */
+{  22480,  13676 },   /* 白领 */
+{  22487,   3865 },   /* 百 */
+{  22491,   4927 },   /* 百撘卡 */
+{  22501,   9074 },   /* 的士 */
+{  22508,   2491 },   /* 皇冠 */
+{  22515,   6629 },   /* 皮纳塔 */
+{  22525,  22532 },   /* 皱眉 */
+{  22536,   1137 },   /* 盆栽 */
+{  22543,   9780 },   /* 盈 */
+{  22547,  22557 },   /* 盈凸月 */
+{  22562,   7750 },   /* 盐 */
+{  22566,   7750 },   /* 盐樽 */
+{  22573,    795 },   /* 盒 */
+{  22577,   4734 },   /* 盒子 */
+{  22584,   4041 },   /* 目标 */
+{  22591,  22595 },   /* 盲 */
+{  22607,    940 },   /* 盲人 */
+{  22614,  22624 },   /* 直升机 */
+{  22629,   7668 },   /* 直尺 */
+{  22636,   7668 },   /* 直边 */
+{  22643,   1582 },   /* 相机 */
+{  22650,   8110 },   /* 盾 */
+{  22654,   9945 },   /* 眨眼 */
+{  22661,   3301 },   /* 眼 */
+{  22665,   7257 },   /* 眼泪 */
+{  22672,   3311 },   /* 眼睛 */
+{  22679,   3321 },   /* 眼镜 */
+{  22686,  16280 },   /* 着上 */
+{  22693,   3283 },   /* 睇 */
+{  22697,   8154 },   /* 短裤 */
+{  22704,  20434 },   /* 石 */
+{  22708,   4349 },   /* 石头 */
+{  22715,   1279 },   /* 砂浆 */
+{  22722,   6505 },   /* 砂锅 */
+{  22729,   2179 },   /* 砌图 */
+{  22736,   1279 },   /* 砖 */
+{  22740,   9769 },   /* 破折号 */
+{  22750,   1244 },   /* 破碎 */
+{  22757,   2247 },   /* 硬币 */
+{  22764,   3628 },   /* 碌地 */
+{  22771,   1244 },   /* 碎 */
+{  22775,   1186 },   /* 碗 */
+{  22779,   3720 },   /* 碟 */
+{  22783,   1104 },   /* 碰撞 */
+{  22790,  15796 },   /* 磁力 */
+{  22797,   5610 },   /* 磁性 */
+{  22804,   5610 },   /* 磁石 */
+{  22811,   3640 },   /* 磁碟 */
+{  22818,   3959 },   /* 礼物 */
+{  22825,   7171 },   /* 祈祷 */
+{  22832,  16816 },   /* 祝 */
+{  22836,   3210 },   /* 神奇 */
+{  22843,   8122 },   /* 神教 */
+{  22850,   8122 },   /* 神社 */
+{  22857,    672 },   /* 祷告 */
+{  22864,  22868 },   /* 禁 */
+{  22873,   3283 },   /* 禁止 */
+{  22880,   6903 },   /* 禁钉 */
+{  22887,  12017 },   /* 离境 */
+{  22894,   4105 },   /* 禾束 */
+{  22901,    368 },   /* 秋天 */
+{  22908,   5168 },   /* 科学 */
+{  22915,  12359 },   /* 科学家 */
+{  22925,  22932 },   /* 秒表 */
+{  22936,  22940 },   /* 秘 */
+{  22944,  22940 },   /* 秘密 */
+{  22951,  19528 },   /* 秤 */
+{  22955,   4824 },   /* 穆斯林 */
+{  22965,   4105 },   /* 穗 */
+{  22969,  22973 },   /* 空 */
+{  22978,    104 },   /* 空中 */
+{  22985,   4963 },   /* 空手道 */
+{  22995,  22557 },   /* 突起 */
+{  23002,   3745 },   /* 窗 */
+{  23006,   4801 },   /* 窝夫 */
+{  23013,   4517 },   /* 窿 */
+{  23017,   9213 },   /* 竖起 */
+{  23024,  23031 },   /* 章鱼 */
+{  23036,  23043 },   /* 童话 */
+{  23048,    531 },   /* 竹 */
+{  23052,  23056 },   /* 竿 */
+{  23061,  23068 },   /* 笃笃 */
+{  23073,   5243 },   /* 笑 */
+{  23077,   4166 },   /* 笑脸 */
+{  23084,   6181 },   /* 笔 */
+{  23088,   6181 },   /* 笔尖 */
+{  23095,  23105 },   /* 笔记板 */
+{  23110,   1083 },   /* 笔记簿 */
+{  23120,   5693 },   /* 符号 */
+{  23127,   3538 },   /* 第一 */
+{  23134,   1352 },   /* 第三 */
+{  23141,   7966 },   /* 第二 */
+{  23148,   4296 },   /* 筷子 */
+{  23155,     22 },   /* 算盘 */
+{  23162,    291 },   /* 箭 */
+{  23166,  17973 },   /* 箭咀 */
+{  23173,    241 },   /* 箭头 */
+{  23180,   2653 },   /* 箭靶 */
+{  23187,   1901 },   /* 箱 */
+{  23191,    609 },   /* 篮 */
+{  23195,   4553 },   /* 篮圈 */
+{  23202,   4553 },   /* 篮球 */
+{  23209,   7246 },   /* 簿记 */
+{  23216,   4105 },   /* 米 */
+{  23220,  23227 },   /* 米饼 */
+{  23232,     81 },   /* 粉碎 */
+{  23239,   1603 },   /* 粗乘号 */
+{  23249,   5894 },   /* 粗减号 */
+{  23259,  23269 },   /* 粗剔号 */
+{  23273,   5729 },   /* 粗加号 */
+{  23283,   2852 },   /* 粗除号 */
+{  23293,   2354 },   /* 粟米 */
+{  23300,    270 },   /* 粟米饼 */
+{  23310,   1772 },   /* 粥 */
+{  23314,   3088 },   /* 粪便 */
+{  23321,  23328 },   /* 粱龙 */
+{  23333,   1549 },   /* 糕点 */
+{  23340,   1625 },   /* 糖果 */
+{  23347,  12061 },   /* 索引 */
+{  23354,  23361 },   /* 紧张 */
+{  23366,   7708 },   /* 紧急 */
+{  23373,   7296 },   /* 紫色 */
+{  23380,   7296 },   /* 紫色心 */
+{  23390,   9277 },   /* 累 */
+{  23394,  23404 },   /* 累嘅脸 */
+{  23409,   6812 },   /* 纠察 */
+{  23416,    438 },   /* 纠缠 */
+{  23423,    200 },   /* 红 */
+{  23427,   3959 },   /* 红包 */
+{  23434,  23441 },   /* 红心 */
+{  23445,    229 },   /* 红色 */
+{  23452,  23462 },   /* 红色心 */
+{  23466,    229 },   /* 红苹果 */
+{  23476,   1695 },   /* 红萝卜 */
+{  23486,   9924 },   /* 红酒杯 */
+{  23496,   4606 },   /* 红面 */
+{  23503,  20943 },   /* 红鹤 */
+{  23510,   5319 },   /* 级别 */
+{  23517,  10680 },   /* 纪念 */
+{  23524,   7787 },   /* 纱丽 */
+{  23531,    661 },   /* 纳扎尔 */
+{  23541,   6568 },   /* 纸 */
+{  23545,  23552 },   /* 纸屑 */
+{  23557,  23552 },   /* 纸屑球 */
+{  23567,  12766 },   /* 纸巾 */
+{  23574,    862 },   /* 纸币 */
+{  23581,   1664 },   /* 纸牌 */
+{  23588,   8682 },   /* 线 */
+{  23592,   2179 },   /* 线索 */
+{  23599,   8003 },   /* 组合 */
+{  23606,   2945 },   /* 组装 */
+{  23613,   4094 },   /* 细 */
+{  23617,    167 },   /* 细菌 */
+{  23624,  23631 },   /* 终极 */
+{  23636,  13676 },   /* 经理 */
+{  23643,   5148 },   /* 结 */
+{  23647,   4223 },   /* 结他 */
+{  23654,   3241 },   /* 结束 */
+{  23661,   6067 },   /* 绘画 */
+{  23668,   5214 },   /* 绝种 */
+{  23675,   5148 },   /* 绳 */
+{  23679,   5148 },   /* 绳球 */
+{  23686,   5643 },   /* 绵羊 */
+{  23693,   4666 },   /* 绷带 */
+{  23700,   4156 },   /* 绿色 */
+{  23707,  23717 },   /* 绿色书 */
+{  23722,   4156 },   /* 绿色心 */
+{  23732,   1527 },   /* 缆 */
+{  23736,   1527 },   /* 缆车 */
+{  23743,   8682 },   /* 缝纫 */
+{  23750,   6131 },   /* 缝纫针 */
+{  23760,   6131 },   /* 缝线 */
+{  23767,   6131 },   /* 缝补 */
+{  23774,   6131 },   /* 缝针 */
+{  23781,   1409 },   /* 缸 */
+{  23785,   4538 },   /* 罐 */
+{  23789,   1591 },   /* 罐头 */
+{  23796,   9810 },   /* 网 */
+{  23800,   9138 },   /* 网球 */
+{  23807,   9138 },   /* 网球拍 */
+{  23817,   1944 },   /* 羊扒 */
+{  23824,   5214 },   /* 羊毛 */
+{  23831,    155 },   /* 羊驼 */
+{  23838,   5841 },   /* 美人鱼 */
+{  23848,  23855 },   /* 美元 */
+{  23860,    597 },   /* 美容 */
+{  23867,   7740 },   /* 美容店 */
+{  23877,  23884 },   /* 美式 */
+{  23889,  23896 },   /* 美洲 */
+{  23901,    872 },   /* 羽毛 */
+{  23908,    884 },   /* 羽毛球 */
+{  23918,   9935 },   /* 翼 */
+{  23922,   4145 },   /* 老 */
+{  23926,   6355 },   /* 老人 */
+{  23933,  23943 },   /* 老伯伯 */
+{  23948,  23958 },   /* 老婆婆 */
+{  23963,  15760 },   /* 老师 */
+{  23970,   6355 },   /* 老年 */
+{  23977,   9247 },   /* 老虎 */
+{  23984,   8393 },   /* 老虎机 */
+{  23994,   9247 },   /* 老虎脸 */
+{  24004,   6010 },   /* 老鼠 */
+{  24011,    468 },   /* 老鼠夹 */
+{  24021,   6010 },   /* 老鼠脸 */
+{  24031,    609 },   /* 耕种 */
+{  24038,   1043 },   /* 耳仔 */
+{  24045,   3139 },   /* 耳机 */
+{  24052,   3000 },   /* 耸肩 */
+{  24059,   2694 },   /* 聋 */
+{  24063,   2694 },   /* 聋人 */
+{  24070,   2179 },   /* 联锁 */
+{  24077,   5743 },   /* 肉 */
+{  24081,  24088 },   /* 肉丸 */
+{  24093,   1944 },   /* 肉块 */
+{  24100,   6505 },   /* 肉菜饭 */
+{  24110,   5743 },   /* 肉连⻣ */
+{  24120,    818 },   /* 肌肉 */
+{  24127,   5053 },   /* 肢 */
+{  24131,  20164 },   /* 肤色 */
+{  24138,   7797 },   /* 肩带 */
+{  24145,   1268 },   /* 肺 */
+{  24149,   1114 },   /* 背囊 */
+{  24156,   7708 },   /* 背心 */
+{  24163,   9622 },   /* 胜利 */
+{  24170,   6755 },   /* 胡椒粉 */
+{  24180,  24187 },   /* 胶布 */
+{  24192,   1487 },   /* 胸像 */
+{  24199,   4331 },   /* 脉冲 */
+{  24206,  23361 },   /* 脉动 */
+{  24213,   1222 },   /* 脑 */
+{  24217,   5053 },   /* 脚 */
+{  24221,   7224 },   /* 脚印 */
+{  24228,   3710 },   /* 脚掌 */
+{  24235,  24242 },   /* 脱落 */
+{  24247,   4166 },   /* 脸 */
+{  24251,   2684 },   /* 脸红 */
+{  24258,   3661 },   /* 腐烂 */
+{  24265,  23328 },   /* 腕龙 */
+{  24272,   1002 },   /* 腮红 */
+{  24279,    347 },   /* 自动化 */
+{  24289,   1582 },   /* 自拍 */
+{  24296,  24306 },   /* 自来水 */
+{  24311,   5775 },   /* 自然 */
+{  24318,   8763 },   /* 自由 */
+{  24325,  24335 },   /* 自行车 */
+{  24340,   7257 },   /* 自豪 */
+{  24347,   3088 },   /* 臭 */
+{  24351,   8323 },   /* 臭鼬 */
+{  24358,   2611 },   /* 舞蹈员 */
+{  24368,    872 },   /* 航班 */
+{  24375,    179 },   /* 船 */
+{  24379,   1033 },   /* 艇 */
+{  24383,   7839 },   /* 色士风 */
+{  24393,  22183 },   /* 艺人 */
+{  24400,    300 },   /* 艺术 */
+{  24407,  24417 },   /* 艺术家 */
+{  24429,    715 },   /* 节奏 */
+{  24436,    368 },   /* 节日 */
+{  24443,   5663 },   /* 芒果 */
+{  24450,   1851 },   /* 芝士 */
+{  24457,    507 },   /* 芭蕾舞 */
+{  24467,   3652 },   /* 花 */
+{  24471,   3887 },   /* 花园 */
+{  24478,   3652 },   /* 花束 */
+{  24485,  24495 },   /* 花栗鼠 */
+{  24500,   8171 },   /* 花洒 */
+{  24507,  24514 },   /* 花环 */
+{  24519,   6283 },   /* 花生 */
+{  24526,  21627 },   /* 花纸牌 */
+{  24536,  24543 },   /* 苦恼 */
+{  24548,   7148 },   /* 英镑 */
+{  24555,   4083 },   /* 英雄 */
+{  24562,    229 },   /* 苹果 */
+{  24569,  24576 },   /* 茄子 */
+{  24581,   1397 },   /* 茶 */
+{  24585,   3054 },   /* 茶壶 */
+{  24592,   2515 },   /* 茶杯 */
+{  24599,   2158 },   /* 草 */
+{  24603,  24610 },   /* 草蜢 */
+{  24615,   4836 },   /* 荒岛 */
+{  24622,  17036 },   /* 荒废 */
+{  24629,   2916 },   /* 药 */
+{  24633,   6877 },   /* 药丸 */
+{  24640,    806 },   /* 莓 */
+{  24644,   5915 },   /* 莫伊 */
+{  24651,   5021 },   /* 菜 */
+{  24655,  24662 },   /* 菠萝 */
+{  24667,  24674 },   /* 菱形 */
+{  24679,  24683 },   /* 营 */
+{  24688,  24683 },   /* 营业 */
+{  24695,   5683 },   /* 落叶 */
+{  24702,  24242 },   /* 落叶树 */
+{  24712,  16590 },   /* 落雨 */
+{  24719,    330 },   /* 葬礼 */
+{  24726,   1664 },   /* 葵扇 */
+{  24733,   4687 },   /* 蒙古包 */
+{  24743,   3899 },   /* 蒜头 */
+{  24750,   1186 },   /* 蒸气 */
+{  24757,   7826 },   /* 蒸气房 */
+{  24767,   3253 },   /* 蒸汽 */
+{  24774,  12345 },   /* 蒸馏器 */
+{  24784,   3112 },   /* 蓝光 */
+{  24791,    806 },   /* 蓝色 */
+{  24798,  24808 },   /* 蓝色书 */
+{  24813,  24823 },   /* 蓝色心 */
+{  24828,    806 },   /* 蓝莓 */
+{  24835,   6755 },   /* 蔬菜 */
+{  24842,  20997 },   /* 薄班戟 */
+{  24852,    270 },   /* 薄饼 */
+{  24859,   7126 },   /* 薯仔 */
+{  24866,   3796 },   /* 薯条 */
+{  24873,  19614 },   /* 蘑菇 */
+{  24880,   2042 },   /* 虎头钳 */
+{  24890,  10069 },   /* 虫 */
+{  24894,   3785 },   /* 虾 */
+{  24898,    209 },   /* 蚂蚁 */
+{  24905,   3462 },   /* 蚊 */
+{  24909,  14396 },   /* 蚝桶 */
+{  24916,  10069 },   /* 蚯蚓 */
+{  24923,   3661 },   /* 蛆 */
+{  24927,    705 },   /* 蛇 */
+{  24931,    705 },   /* 蛇夫座 */
+{  24941,   3168 },   /* 蛋 */
+{  24945,  24952 },   /* 蛋糕 */
+{  24957,    438 },   /* 蜂蜜獾 */
+{  24967,   8447 },   /* 蜗牛 */
+{  24974,   8629 },   /* 蜘蛛 */
+{  24981,   9810 },   /* 蜘蛛网 */
+{  24991,   5786 },   /* 蜜瓜 */
+{  24998,   4538 },   /* 蜜糖 */
+{  25005,   4538 },   /* 蜜糖罐 */
+{  25015,    752 },   /* 蜜蜂 */
+{  25022,   1614 },   /* 蜡烛 */
+{  25029,   2440 },   /* 蜡笔 */
+{  25036,   5427 },   /* 蜥蜴 */
+{  25043,  14734 },   /* 蝎子 */
+{  25050,    618 },   /* 蝙蝠 */
+{  25057,   7183 },   /* 蝴蝶 */
+{  25064,   7525 },   /* 蝴蝶结 */
+{  25074,  17318 },   /* 蝴蝶酥 */
+{  25084,   1851 },   /* 融 */
+{  25088,   8098 },   /* 螺 */
+{  25092,   7905 },   /* 螺丝 */
+{  25099,   7905 },   /* 螺丝批 */
+{  25109,   6481 },   /* 螺旋 */
+{  25116,   8098 },   /* 螺旋形 */
+{  25126,   1053 },   /* 螺栓 */
+{  25133,   1053 },   /* 螺母 */
+{  25140,   2428 },   /* 蟹 */
+{  25144,      2 },   /* 血型 */
+{  25151,    929 },   /* 血液 */
+{  25158,  25165 },   /* 行人 */
+{  25170,  10219 },   /* 行尸 */
+{  25177,   1114 },   /* 行山 */
+{  25184,   1114 },   /* 行山鞋 */
+{  25194,   9411 },   /* 行李 */
+{  25201,   4440 },   /* 行紧路 */
+{  25211,   4440 },   /* 行路 */
+{  25218,  25225 },   /* 表情 */
+{  25230,    300 },   /* 表演 */
+{  25237,   7797 },   /* 衫 */
+{  25241,   7137 },   /* 袋 */
+{  25245,   4041 },   /* 袋棍球 */
+{  25255,   4906 },   /* 袋鼠 */
+{  25262,   8517 },   /* 袜 */
+{  25266,   6131 },   /* 裁剪 */
+{  25273,  25280 },   /* 装配 */
+{  25292,   1083 },   /* 装饰 */
+{  25299,   9462 },   /* 裇衫 */
+{  25306,   3043 },   /* 裙 */
+{  25310,   4864 },   /* 裤 */
+{  25314,   9827 },   /* 西 */
+{  25318,  25328 },   /* 西兰花 */
+{  25333,  25340 },   /* 西北 */
+{  25344,  25351 },   /* 西南 */
+{  25355,  25362 },   /* 西瓜 */
+{  25367,   8901 },   /* 西装 */
+{  25374,  25381 },   /* 见证 */
+{  25393,   5448 },   /* 解锁 */
+{  25400,  25407 },   /* 警告 */
+{  25411,   2334 },   /* 警员 */
+{  25418,   2334 },   /* 警官 */
+{  25425,   2334 },   /* 警察 */
+{  25432,    133 },   /* 警报 */
+{  25439,    651 },   /* 警示灯 */
+{  25449,   6659 },   /* 警车 */
+{  25456,    651 },   /* 警车灯 */
+{  25466,     22 },   /* 计数 */
+{  25473,   7760 },   /* 计时器 */
+{  25483,  10228 },   /* 训紧觉 */
+{  25493,   8351 },   /* 训觉 */
+{  25500,  14719 },   /* 讯号 */
+{  25507,   8599 },   /* 讲 */
+{  25511,  16616 },   /* 讲价 */
+{  25518,   5328 },   /* 讲大话 */
+{  25528,  18112 },   /* 讲师 */
+{  25535,   2774 },   /* 讲野 */
+{  25542,   4813 },   /* 讽刺 */
+{  25549,   7246 },   /* 证据 */
+{  25556,   7246 },   /* 证明 */
+{  25563,   9064 },   /* 试味 */
+{  25570,   5168 },   /* 试管 */
+{  25577,  10173 },   /* 试食 */
+{  25584,    338 },   /* 请 */
+{  25588,  25595 },   /* 谂野 */
+{  25600,   3899 },   /* 调味 */
+{  25607,   7750 },   /* 调味料 */
+{  25617,   8370 },   /* 调查员 */
+{  25627,   6441 },   /* 调皮 */
+{  25634,    312 },   /* 调色板 */
+{  25644,   4105 },   /* 谷物 */
+{  25651,  25655 },   /* 豹 */
+{  25660,   5277 },   /* 账簿 */
+{  25667,    862 },   /* 货币 */
+{  25674,  20585 },   /* 货船 */
+{  25681,   6836 },   /* 货车 */
+{  25688,  12571 },   /* 质问 */
+{  25695,  25702 },   /* 购物 */
+{  25707,  25702 },   /* 购物袋 */
+{  25717,   1705 },   /* 购物车 */
+{  25727,   4387 },   /* 资讯 */
+{  25734,  11247 },   /* 赏月 */
+{  25741,   7367 },   /* 赛跑 */
+{  25748,   7797 },   /* 赛跑衫 */
+{  25758,  25765 },   /* 赛车 */
+{  25770,   4597 },   /* 赛马 */
+{  25777,  10017 },   /* 赢 */
+{  25781,  10017 },   /* 赢咗 */
+{  25788,   1742 },   /* 赶上 */
+{  25795,   4502 },   /* 起重机 */
+{  25805,   4083 },   /* 超人 */
+{  25812,   4083 },   /* 超级 */
+{  25819,   1829 },   /* 趋势 */
+{  25826,   8507 },   /* 足球 */
+{  25833,   4963 },   /* 跆拳道 */
+{  25843,   2663 },   /* 跑 */
+{  25847,  25854 },   /* 跑步 */
+{  25859,  25866 },   /* 跑鞋 */
+{  25871,   5111 },   /* 跪 */
+{  25875,   5111 },   /* 跪嘅人 */
+{  25885,   7567 },   /* 路 */
+{  25889,   4906 },   /* 跳 */
+{  25893,  20544 },   /* 跳伞 */
+{  25900,  25907 },   /* 跳动 */
+{  25912,  25919 },   /* 跳舞 */
+{  25924,   3710 },   /* 踏 */
+{  25928,   5053 },   /* 踢 */
+{  25932,    840 },   /* 踩单车 */
+{  25942,   2102 },   /* 踫杯 */
+{  25949,   4705 },   /* 身份 */
+{  25956,   1043 },   /* 身体 */
+{  25963,   1654 },   /* 车 */
+{  25967,  25977 },   /* 车厘子 */
+{  25982,  25989 },   /* 车站 */
+{  25994,  12600 },   /* 车辆 */
+{  26001,  26011 },   /* 轨迹球 */
+{  26016,   3441 },   /* 轮 */
+{  26020,  18069 },   /* 轮廓 */
+{  26027,  26034 },   /* 轮椅 */
+{  26046,   4801 },   /* 软 */
+{  26050,   2200 },   /* 软件 */
+{  26057,   2451 },   /* 软雪糕 */
+{  26067,   1104 },   /* 轰 */
+{  26071,  26078 },   /* 轻铁 */
+{  26083,  12222 },   /* 较剪 */
+{  26090,  10864 },   /* 辅助 */
+{  26097,   4772 },   /* 输入 */
+{  26104,  26108 },   /* 辣 */
+{  26113,   6755 },   /* 辣椒 */
+{  26120,  20585 },   /* 过山车 */
+{  26130,  25165 },   /* 过路 */
+{  26137,  25866 },   /* 运动 */
+{  26144,   7797 },   /* 运动场 */
+{  26154,  25866 },   /* 运动鞋 */
+{  26164,    404 },   /* 返回 */
+{  26171,   3264 },   /* 进入 */
+{  26178,   2904 },   /* 进化 */
+{  26185,   4440 },   /* 远足 */
+{  26192,   5371 },   /* 连住 */
+{  26199,  26206 },   /* 连结 */
+{  26211,   2873 },   /* 迪亚 */
+{  26218,   2873 },   /* 迪亚灯 */
+{  26228,  26235 },   /* 迷茫 */
+{  26240,   3190 },   /* 退出 */
+{  26247,  12295 },   /* 送礼 */
+{  26254,  26261 },   /* 送货 */
+{  26266,  26261 },   /* 送货车 */
+{  26276,  26286 },   /* 逆时针 */
+{  26291,  26298 },   /* 选框 */
+{  26302,   3745 },   /* 透明 */
+{  26309,   9296 },   /* 通渠 */
+{  26316,   8617 },   /* 速度 */
+{  26323,   9030 },   /* 道 */
+{  26327,   9030 },   /* 道教 */
+{  26334,   1158 },   /* 道歉 */
+{  26341,   2904 },   /* 遗传学 */
+{  26351,    639 },   /* 遮 */
+{  26355,   8884 },   /* 邋遢 */
+{  26362,   3283 },   /* 邪恶 */
+{  26369,    661 },   /* 邪眼 */
+{  26376,  26383 },   /* 邮件 */
+{  26388,  26395 },   /* 邮局 */
+{  26400,   7098 },   /* 邮政 */
+{  26407,  11489 },   /* 邮箱 */
+{  26414,   9473 },   /* 郁金香 */
+{  26424,  26431 },   /* 部门 */
+{  26436,   9924 },   /* 酒 */
+{  26440,   7718 },   /* 酒吧 */
+{  26447,   2344 },   /* 酒塞 */
+{  26454,   4629 },   /* 酒店 */
+{  26461,    458 },   /* 酱 */
+{  26465,   1333 },   /* 酷 */
+{  26469,   2884 },   /* 醉 */
+{  26473,   2884 },   /* 醉嘅脸 */
+{  26483,   1333 },   /* 醒 */
+{  26487,   5884 },   /* 采矿 */
+{  26494,   4349 },   /* 重 */
+{  26498,   7484 },   /* 重覆 */
+{  26505,   7850 },   /* 重量 */
+{  26512,    895 },   /* 野牛 */
+{  26519,    609 },   /* 野餐 */
+{  26526,   2247 },   /* 金 */
+{  26530,   2247 },   /* 金属 */
+{  26537,   3538 },   /* 金牌 */
+{  26544,   1433 },   /* 金牛座 */
+{  26554,   6131 },   /* 针 */
+{  26558,  12420 },   /* 针筒 */
+{  26565,   5127 },   /* 针织 */
+{  26572,   6441 },   /* 钓鱼 */
+{  26579,  23056 },   /* 钓鱼竿 */
+{  26589,    784 },   /* 钟 */
+{  26593,   6795 },   /* 钢琴 */
+{  26600,  26607 },   /* 钢笔 */
+{  26612,   5127 },   /* 钩针 */
+{  26619,   5138 },   /* 钮 */
+{  26623,   2247 },   /* 钱 */
+{  26627,   2957 },   /* 钱袋 */
+{  26634,   2042 },   /* 钳 */
+{  26638,   7546 },   /* 钻石 */
+{  26645,   4801 },   /* 铁 */
+{  26649,   3253 },   /* 铁路 */
+{  26656,   1654 },   /* 铁路车 */
+{  26666,   1934 },   /* 铃 */
+{  26670,   6744 },   /* 铅笔 */
+{  26677,   1352 },   /* 铜 */
+{  26681,   1352 },   /* 铜牌 */
+{  26688,   2247 },   /* 银 */
+{  26692,  26699 },   /* 银河 */
+{  26704,   7966 },   /* 银牌 */
+{  26711,    862 },   /* 银纸 */
+{  26718,    564 },   /* 银行 */
+{  26725,   1783 },   /* 链 */
+{  26729,   5448 },   /* 锁 */
+{  26733,   5043 },   /* 锁匙 */
+{  26740,   8790 },   /* 锅 */
+{  26744,    179 },   /* 锚 */
+{  26748,   4264 },   /* 锤 */
+{  26752,  26762 },   /* 锤同挑 */
+{  26766,   6795 },   /* 键盘 */
+{  26773,   5554 },   /* 锯 */
+{  26777,   5905 },   /* 镜 */
+{  26781,   7949 },   /* 镜片 */
+{  26788,  23361 },   /* 长大 */
+{  26795,  26802 },   /* 长条 */
+{  26807,   5214 },   /* 长毛象 */
+{  26817,   5214 },   /* 长牙 */
+{  26824,   4864 },   /* 长裤 */
+{  26831,   8704 },   /* 长颈鹿 */
+{  26841,    715 },   /* 长鼓 */
+{  26848,   2978 },   /* 门 */
+{  26852,  26859 },   /* 门券 */
+{  26864,   6319 },   /* 闩 */
+{  26868,  26875 },   /* 闩埋 */
+{  26880,  11821 },   /* 闪 */
+{  26884,   3605 },   /* 闪光 */
+{  26891,  11821 },   /* 闪嘅心 */
+{  26901,  26908 },   /* 闪电 */
+{  26913,  26908 },   /* 闪电云 */
+{  26923,   4031 },   /* 闪耀 */
+{  26930,  26937 },   /* 闪闪 */
+{  26941,    338 },   /* 问 */
+{  26945,  26952 },   /* 问号 */
+{  26956,  26963 },   /* 问题 */
+{  26967,   7668 },   /* 间尺 */
+{  26974,   8370 },   /* 间谍 */
+{  26981,   1137 },   /* 闷 */
+{  26985,    133 },   /* 闹钟 */
+{  26992,   5513 },   /* 防晒 */
+{  26999,   9030 },   /* 阳 */
+{  27003,   9030 },   /* 阴 */
+{  27007,   7815 },   /* 阴沉 */
+{  27014,   9030 },   /* 阴阳 */
+{  27021,  27028 },   /* 阶砖 */
+{  27032,    167 },   /* 阿米巴 */
+{  27042,   9509 },   /* 陆龟 */
+{  27049,  12134 },   /* 降落 */
+{  27056,  20544 },   /* 降落伞 */
+{  27066,   2852 },   /* 除 */
+{  27070,   2884 },   /* 陶醉 */
+{  27077,    468 },   /* 陷阱 */
+{  27084,   4419 },   /* 隐形 */
+{  27091,   4761 },   /* 隐私 */
+{  27098,  27108 },   /* 障碍物 */
+{  27113,   9497 },   /* 雀 */
+{  27117,  27124 },   /* 雀仔 */
+{  27129,   3292 },   /* 雌性 */
+{  27136,   8577 },   /* 雌性猪 */
+{  27146,   8763 },   /* 雕像 */
+{  27153,   7399 },   /* 雨 */
+{  27157,  27164 },   /* 雨云 */
+{  27169,   8285 },   /* 雪 */
+{  27173,  15705 },   /* 雪云 */
+{  27180,  27187 },   /* 雪人 */
+{  27191,  15720 },   /* 雪山 */
+{  27198,   8333 },   /* 雪橇 */
+{  27205,   2451 },   /* 雪糕 */
+{  27212,  27219 },   /* 雪花 */
+{  27223,   7399 },   /* 雷电 */
+{  27230,  23328 },   /* 雷龙 */
+{  27237,  27241 },   /* 雾 */
+{  27246,   5932 },   /* 震动 */
+{  27253,  21132 },   /* 震惊 */
+{  27260,  27267 },   /* 露营 */
+{  27272,   6824 },   /* 青瓜 */
+{  27279,  27286 },   /* 青色 */
+{  27291,  27286 },   /* 青苹果 */
+{  27301,   3806 },   /* 青蛙 */
+{  27308,   3806 },   /* 青蛙脸 */
+{  27318,  20943 },   /* 靓 */
+{  27322,   7343 },   /* 静 */
+{  27326,   6088 },   /* 静音 */
+{  27333,    114 },   /* 非洲 */
+{  27340,  27350 },   /* 非饮用 */
+{  27355,   3321 },   /* 面 */
+{  27359,   3321 },   /* 面具 */
+{  27366,   1233 },   /* 面包 */
+{  27373,   4430 },   /* 面纱 */
+{  27380,   1114 },   /* 靴 */
+{  27384,  15232 },   /* 靴子 */
+{  27391,   2653 },   /* 靶 */
+{  27395,   2653 },   /* 靶心 */
+{  27402,   8142 },   /* 鞋 */
+{  27406,    338 },   /* 鞠躬 */
+{  27413,   6078 },   /* 音乐 */
+{  27420,   6246 },   /* 音符 */
+{  27427,   2531 },   /* 页 */
+{  27431,   9345 },   /* 顶帽 */
+{  27438,  27445 },   /* 顶部 */
+{  27450,    672 },   /* 项链 */
+{  27457,   7472 },   /* 顺时针 */
+{  27467,    693 },   /* 须 */
+{  27471,  27478 },   /* 预言 */
+{  27483,  27490 },   /* 预订 */
+{  27495,   2031 },   /* 领取 */
+{  27502,   5148 },   /* 领呔 */
+{  27509,   6119 },   /* 颈 */
+{  27513,   6119 },   /* 颈巾 */
+{  27520,    986 },   /* 风 */
+{  27524,   5090 },   /* 风筝 */
+{  27531,  27538 },   /* 风脸 */
+{  27543,   1934 },   /* 风铃 */
+{  27550,    986 },   /* 飘动 */
+{  27557,   3010 },   /* 飞 */
+{  27561,   6888 },   /* 飞机 */
+{  27568,   6888 },   /* 飞机师 */
+{  27578,    143 },   /* 飞碟 */
+{  27585,   2653 },   /* 飞镖 */
+{  27592,   3700 },   /* 食物 */
+{  27599,   8693 },   /* 餐具 */
+{  27606,  13927 },   /* 饭 */
+{  27610,  13927 },   /* 饭团 */
+{  27617,   3054 },   /* 饮 */
+{  27621,   1149 },   /* 饮品 */
+{  27628,  24306 },   /* 饮水 */
+{  27635,  24306 },   /* 饮用 */
+{  27642,   4995 },   /* 饮管杯 */
+{  27652,   7718 },   /* 饮酒 */
+{  27659,    468 },   /* 饵 */
+{  27663,   4882 },   /* 饺子 */
+{  27670,  23227 },   /* 饼 */
+{  27674,   6852 },   /* 馅料 */
+{  27681,    270 },   /* 馅饼 */
+{  27688,  13378 },   /* 香烟 */
+{  27695,   4618 },   /* 香肠 */
+{  27702,   4397 },   /* 香草 */
+{  27709,    543 },   /* 香蕉 */
+{  27716,   4597 },   /* 马 */
+{  27720,   1990 },   /* 马戏团 */
+{  27730,  25854 },   /* 马拉松 */
+{  27740,  27747 },   /* 马脸 */
+{  27752,   5610 },   /* 马蹄铁 */
+{  27762,   3283 },   /* 马骝 */
+{  27769,  27779 },   /* 马骝脸 */
+{  27784,   1570 },   /* 驼峰 */
+{  27791,   6705 },   /* 骄傲 */
+{  27798,    155 },   /* 骆马 */
+{  27805,   1570 },   /* 骆驼 */
+{  27812,  27822 },   /* 骑单车 */
+{  27833,   4597 },   /* 骑师 */
+{  27840,   5743 },   /* 骨 */
+{  27844,   1073 },   /* 骨头 */
+{  27851,   2796 },   /* 骰子 */
+{  27858,   2705 },   /* 骷髅头 */
+{  27868,   2623 },   /* 高压 */
+{  27875,    495 },   /* 高尔夫 */
+{  27885,   4359 },   /* 高根鞋 */
+{  27895,   5090 },   /* 高飞 */
+{  27902,   7019 },   /* 髪型屋 */
+{  27912,   3949 },   /* 鬼 */
+{  27916,    661 },   /* 魅力 */
+{  27923,   5598 },   /* 魔术 */
+{  27930,   5598 },   /* 魔法棒 */
+{  27940,   2726 },   /* 魔鬼 */
+{  27947,   3548 },   /* 鱼 */
+{  27951,   5944 },   /* 鱿鱼 */
+{  27958,   1683 },   /* 鲤鱼 */
+{  27965,   1683 },   /* 鲤鱼旗 */
+{  27975,   8050 },   /* 鲨鱼 */
+{  27982,   9837 },   /* 鲸鱼 */
+{  27989,  27996 },   /* 鳄鱼 */
+{  28001,  20279 },   /* 鳍 */
+{  28005,  28009 },   /* 鸡 */
+{  28014,  28021 },   /* 鸡仔 */
+{  28026,  21670 },   /* 鸡尾酒 */
+{  28036,  28046 },   /* 鸡泡鱼 */
+{  28051,  15640 },   /* 鸡肶 */
+{  28058,  28068 },   /* 鸢尾花 */
+{  28072,   1549 },   /* 鸣门卷 */
+{  28082,   3078 },   /* 鸭 */
+{  28086,   3010 },   /* 鸽 */
+{  28090,   3123 },   /* 鹰 */
+{  28094,  24088 },   /* 鹰嘴豆 */
+{  28104,   2715 },   /* 鹿 */
+{  28108,  28115 },   /* 麻雀 */
+{  28120,   3103 },   /* 黄昏 */
+{  28127,  10140 },   /* 黄色 */
+{  28134,  10140 },   /* 黄色心 */
+{  28144,  28151 },   /* 黎紧 */
+{  28156,   2643 },   /* 黑暗 */
+{  28163,  13597 },   /* 黑猫 */
+{  28170,    918 },   /* 黑色 */
+{  28177,    918 },   /* 黑色心 */
+{  28187,  28197 },   /* 黑色旗 */
+{  28202,    715 },   /* 鼓 */
+{  28206,  28213 },   /* 鼓棍 */
+{  28218,   7429 },   /* 鼠 */
+{  28222,   3321 },   /* 鼻 */
+{  28226,   2238 },   /* 齿轮 */
+{  28233,   3032 },   /* 龙 */
+{  28237,  13181 },   /* 龙卷风 */
+{  28247,   3032 },   /* 龙脸 */
+{  28254,    907 },   /* 龙虾 */
+{  28261,   6145 },   /* 龙门 */
+};
+
+const guint16 chinese_emoji_hash[] = {
+0, 28, 1509, 0, 0, 0, 0, 0, 0, 1009, 0, 0, 0, 0, 93, 0,
+1046, 1325, 0, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1845, 0, 0,
+0, 0, 579, 0, 0, 0, 1961, 0, 0, 0, 0, 0, 880, 506, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 474, 891, 371, 427, 872, 1113, 1687, 0, 0,
+0, 0, 1597, 0, 2146, 0, 0, 498, 1118, 0, 599, 0, 0, 0, 0, 0,
+1600, 1665, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 240, 1512, 2145,
+0, 670, 0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 780, 0, 0, 0,
+0, 0, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 2006, 0, 1280, 0, 0, 0, 967, 0,
+0, 0, 0, 968, 1331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1858, 0, 0, 0, 1547, 0, 0, 0, 0, 0, 692, 0, 0,
+0, 494, 2080, 0, 0, 0, 0, 380, 1030, 0, 0, 0, 0, 1209, 0, 0,
+0, 0, 0, 0, 0, 1317, 2130, 1953, 0, 0, 270, 0, 459, 1473, 0, 0,
+0, 1339, 0, 0, 781, 1197, 0, 0, 713, 0, 239, 0, 0, 0, 0, 0,
+0, 1464, 0, 0, 2138, 0, 0, 0, 0, 0, 1348, 0, 1873, 0, 0, 0,
+0, 641, 1288, 675, 1558, 0, 0, 0, 0, 1548, 0, 1925, 0, 0, 310, 1171,
+0, 0, 0, 0, 0, 0, 219, 16, 0, 581, 372, 1424, 0, 373, 0, 295,
+2032, 0, 0, 0, 1194, 0, 0, 0, 0, 1743, 1070, 1367, 1299, 0, 0, 0,
+0, 0, 0, 0, 0, 1033, 0, 0, 0, 0, 1269, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 1306, 1163, 1437, 1890, 0, 0, 0, 1795, 2088, 2156, 0,
+1907, 137, 0, 0, 0, 1923, 0, 0, 0, 0, 0, 366, 0, 1731, 0, 0,
+0, 0, 619, 0, 2128, 610, 840, 0, 1139, 714, 0, 0, 0, 0, 1978, 271,
+0, 2109, 1346, 0, 0, 500, 0, 0, 0, 0, 0, 936, 849, 0, 0, 0,
+730, 2149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1378, 0, 19, 0, 871,
+223, 0, 0, 0, 0, 0, 0, 0, 1072, 0, 0, 0, 0, 650, 0, 0,
+0, 1974, 0, 0, 35, 107, 0, 0, 0, 0, 260, 852, 334, 0, 0, 1716,
+201, 1222, 0, 238, 0, 0, 0, 808, 389, 0, 0, 0, 0, 368, 0, 665,
+0, 0, 0, 0, 0, 1495, 1145, 0, 1911, 0, 0, 0, 0, 2061, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1709, 0, 0, 0, 0, 1419, 688, 1999, 2053,
+0, 0, 0, 320, 0, 0, 423, 433, 950, 2062, 407, 1283, 0, 0, 1032, 1707,
+0, 0, 983, 1598, 2084, 1202, 0, 352, 0, 0, 1097, 1263, 1830, 0, 0, 0,
+1321, 1520, 1276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 761, 2004, 2068,
+0, 0, 1217, 0, 0, 1614, 563, 1085, 1682, 1136, 1730, 0, 370, 1076, 0, 0,
+1541, 0, 0, 0, 0, 0, 0, 0, 611, 647, 1617, 0, 1962, 0, 0, 0,
+0, 265, 0, 0, 0, 89, 0, 1450, 1035, 0, 0, 812, 1663, 1131, 0, 0,
+0, 0, 1634, 0, 1888, 1920, 1984, 0, 492, 0, 0, 0, 0, 0, 0, 0,
+1430, 0, 0, 0, 0, 0, 1067, 0, 436, 705, 1180, 0, 0, 1579, 0, 0,
+0, 1068, 1100, 1270, 0, 0, 395, 0, 0, 1156, 0, 487, 662, 2099, 0, 212,
+0, 0, 0, 1930, 153, 128, 247, 361, 0, 0, 1551, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 797, 0, 0, 0, 1636, 0, 0,
+0, 1954, 0, 0, 1305, 746, 0, 0, 595, 2143, 0, 0, 686, 0, 0, 0,
+1773, 1524, 1427, 0, 0, 1421, 0, 0, 0, 1186, 555, 1726, 0, 0, 0, 0,
+0, 0, 1924, 550, 0, 0, 0, 0, 929, 0, 0, 0, 0, 1396, 0, 0,
+0, 1142, 0, 1414, 1, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 1060,
+2081, 0, 0, 738, 0, 0, 0, 1674, 0, 0, 1103, 0, 0, 0, 0, 321,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 231, 0, 0, 1948, 1291,
+0, 0, 0, 0, 0, 0, 0, 0, 547, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2005, 0,
+1286, 0, 0, 0, 0, 0, 0, 777, 914, 1309, 0, 0, 120, 0, 0, 0,
+926, 1355, 0, 1236, 0, 0, 0, 0, 0, 0, 0, 0, 1757, 1505, 1865, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+2127, 1995, 0, 0, 0, 618, 1126, 0, 0, 0, 0, 0, 1557, 0, 267, 484,
+1542, 360, 1861, 0, 2079, 0, 1036, 1933, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 531, 1272, 2087, 1938, 0, 0, 7, 71, 0, 0, 0, 0, 0, 0,
+1528, 1313, 0, 0, 0, 2125, 0, 0, 965, 1425, 0, 175, 0, 0, 0, 1848,
+0, 0, 1451, 0, 438, 978, 1169, 2019, 0, 1049, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 626, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 176, 0, 437, 0, 0, 1268, 1615, 0, 0, 537,
+0, 1592, 0, 0, 0, 397, 0, 0, 0, 0, 783, 960, 909, 2046, 0, 0,
+0, 0, 0, 234, 504, 0, 0, 463, 0, 0, 0, 0, 0, 0, 0, 0,
+163, 0, 0, 0, 0, 873, 0, 0, 0, 0, 0, 911, 0, 0, 0, 0,
+0, 342, 851, 0, 0, 0, 0, 0, 0, 1622, 664, 0, 0, 0, 0, 0,
+0, 0, 0, 1591, 2048, 0, 0, 0, 1874, 0, 0, 0, 0, 0, 0, 0,
+0, 1799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+171, 281, 0, 1235, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 526, 2016, 0, 0, 0, 0, 0, 1012, 529, 0, 0, 0, 0, 0,
+0, 1242, 150, 0, 0, 0, 0, 0, 0, 70, 1129, 0, 0, 0, 0, 339,
+0, 1439, 0, 0, 0, 0, 649, 0, 1891, 0, 0, 528, 0, 0, 0, 0,
+0, 1695, 0, 0, 0, 846, 0, 0, 0, 0, 1045, 1582, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 309, 0, 80, 0,
+549, 1273, 0, 0, 0, 0, 0, 0, 1128, 0, 0, 0, 0, 0, 0, 0,
+0, 367, 0, 0, 0, 1565, 0, 0, 24, 0, 0, 0, 0, 1705, 0, 0,
+0, 1817, 0, 0, 0, 1805, 2003, 0, 0, 2161, 0, 0, 0, 0, 803, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1768, 0, 0, 0, 0,
+0, 0, 0, 1919, 721, 0, 224, 0, 0, 0, 0, 0, 1084, 0, 0, 0,
+0, 1034, 0, 0, 0, 1964, 0, 27, 0, 0, 497, 0, 23, 0, 542, 2064,
+0, 0, 0, 0, 0, 0, 0, 0, 980, 0, 0, 1116, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 501, 0, 904, 1082, 1751,
+2025, 0, 0, 735, 0, 0, 0, 0, 0, 0, 0, 328, 0, 1828, 195, 1835,
+0, 0, 742, 2100, 0, 50, 0, 0, 0, 97, 1970, 0, 1578, 2060, 0, 0,
+1658, 0, 0, 0, 0, 1504, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 197, 1659, 0, 0, 0, 0, 0, 1204, 0, 0, 1587, 748, 0, 132, 0,
+1017, 0, 0, 0, 0, 78, 0, 461, 0, 167, 0, 0, 0, 0, 1228, 0,
+0, 0, 0, 0, 0, 0, 0, 1432, 0, 832, 0, 0, 0, 1031, 90, 0,
+0, 0, 1965, 0, 0, 1337, 422, 0, 0, 1767, 0, 0, 0, 0, 1386, 0,
+0, 0, 0, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 987,
+0, 0, 1644, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 940, 0, 0,
+0, 503, 0, 0, 0, 0, 0, 0, 0, 2045, 0, 0, 0, 0, 1182, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1727, 315, 0, 0, 356,
+0, 0, 0, 0, 0, 0, 1539, 0, 0, 0, 0, 0, 184, 0, 0, 552,
+1408, 1412, 0, 0, 0, 2011, 0, 743, 0, 0, 0, 0, 0, 0, 0, 1127,
+0, 482, 0, 0, 0, 0, 0, 160, 1782, 1944, 1203, 333, 350, 1963, 0, 0,
+894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1511, 0, 0,
+0, 0, 326, 0, 384, 0, 0, 0, 0, 0, 0, 0, 1210, 0, 0, 1655,
+0, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1719, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1174, 1308, 0, 0, 0, 0,
+1053, 0, 0, 0, 0, 516, 0, 644, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 874, 0, 0, 1428, 0, 0, 0, 565, 0,
+0, 1498, 0, 0, 633, 879, 0, 0, 1972, 0, 0, 0, 394, 0, 0, 0,
+0, 2114, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 1611, 0,
+375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2132, 0, 0, 0, 0, 0,
+954, 2164, 822, 0, 0, 1717, 0, 257, 0, 0, 0, 0, 0, 0, 881, 1410,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1150, 1934, 2107, 1435,
+0, 0, 0, 0, 0, 0, 731, 1341, 0, 0, 541, 0, 262, 0, 0, 867,
+0, 0, 0, 1840, 0, 755, 0, 0, 308, 344, 1456, 2091, 0, 870, 0, 0,
+1146, 1187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 788,
+0, 0, 0, 0, 0, 316, 898, 1985, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1847, 1399, 0, 0, 0, 0, 0, 0, 0, 0, 162, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0,
+187, 0, 0, 0, 0, 0, 0, 0, 0, 1007, 0, 0, 0, 921, 0, 135,
+0, 0, 1550, 0, 0, 0, 0, 0, 1393, 345, 178, 815, 377, 0, 2034, 653,
+0, 1675, 0, 0, 1493, 620, 834, 2108, 0, 0, 0, 0, 0, 1488, 0, 841,
+0, 0, 0, 0, 0, 0, 0, 568, 0, 0, 0, 0, 0, 0, 1519, 0,
+0, 0, 0, 1574, 1176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 173, 403, 0, 0, 0, 269, 0, 1496, 0, 0, 0, 793, 0, 1218,
+2115, 0, 2172, 0, 0, 1123, 0, 0, 0, 0, 0, 1753, 1988, 1935, 0, 0,
+0, 0, 1895, 0, 1133, 1240, 1266, 0, 0, 0, 0, 1748, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1229, 975, 0, 0, 0, 0, 1166, 1482, 1630, 0,
+0, 1469, 0, 0, 0, 0, 955, 0, 0, 0, 185, 1141, 0, 0, 0, 0,
+0, 0, 0, 0, 61, 681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0,
+0, 0, 1021, 0, 1559, 1877, 0, 0, 2051, 0, 1759, 0, 533, 0, 0, 0,
+0, 0, 605, 0, 0, 151, 0, 227, 1896, 8, 0, 0, 2124, 1932, 0, 864,
+0, 0, 0, 0, 0, 2070, 0, 0, 0, 0, 266, 165, 0, 0, 0, 0,
+0, 0, 317, 1691, 0, 0, 0, 1770, 0, 1681, 0, 327, 1038, 0, 0, 0,
+0, 1196, 0, 1369, 869, 0, 0, 0, 0, 0, 0, 0, 0, 1208, 0, 0,
+0, 0, 0, 0, 0, 1219, 0, 1175, 0, 251, 0, 0, 0, 94, 0, 0,
+0, 0, 507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0,
+0, 0, 775, 387, 0, 0, 0, 0, 0, 801, 1563, 183, 1458, 453, 1789, 0,
+0, 249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1149, 0, 570, 0, 0, 0, 1477, 0, 0, 1720, 0, 0,
+0, 244, 1712, 0, 0, 907, 1026, 0, 0, 0, 0, 2001, 0, 0, 0, 0,
+0, 0, 885, 2023, 1155, 707, 0, 0, 0, 0, 0, 0, 1362, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1603, 0, 0, 0, 0,
+0, 0, 511, 1319, 0, 1553, 0, 0, 0, 0, 0, 636, 1223, 0, 0, 0,
+0, 0, 0, 1846, 0, 0, 158, 0, 0, 0, 958, 0, 0, 0, 2055, 1796,
+1821, 0, 0, 2175, 0, 0, 1762, 0, 1515, 673, 0, 0, 0, 0, 0, 0,
+1949, 0, 0, 0, 0, 0, 0, 1656, 0, 0, 1728, 0, 0, 0, 0, 0,
+0, 0, 933, 0, 0, 0, 0, 931, 0, 0, 86, 895, 0, 0, 0, 1532,
+0, 1936, 0, 0, 0, 0, 0, 179, 0, 0, 571, 1260, 2008, 0, 0, 0,
+2141, 0, 0, 0, 1850, 0, 0, 0, 558, 934, 0, 1631, 0, 0, 192, 0,
+0, 509, 927, 1051, 0, 0, 0, 2116, 0, 1193, 0, 0, 0, 0, 348, 0,
+0, 624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1521, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1364, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1608, 1290, 1889, 198, 0, 0, 0, 935,
+0, 0, 0, 0, 0, 1402, 0, 1124, 0, 0, 0, 0, 0, 833, 0, 448,
+1711, 2166, 1251, 0, 0, 1382, 0, 2094, 0, 1660, 1252, 1086, 0, 0, 0, 0,
+0, 0, 0, 0, 454, 0, 0, 0, 0, 1013, 0, 0, 0, 0, 643, 0,
+0, 1892, 1637, 0, 0, 0, 40, 69, 0, 0, 0, 0, 0, 566, 0, 0,
+963, 0, 0, 818, 1569, 0, 0, 0, 301, 0, 0, 0, 0, 0, 0, 1732,
+750, 0, 0, 0, 0, 1700, 1853, 0, 0, 0, 0, 355, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 237, 0, 0, 0, 1816,
+263, 0, 0, 0, 0, 0, 794, 0, 0, 1022, 1690, 0, 0, 0, 0, 0,
+0, 252, 0, 0, 0, 1433, 0, 0, 829, 0, 0, 0, 0, 0, 0, 55,
+0, 0, 0, 0, 0, 0, 1842, 0, 0, 0, 0, 0, 1265, 0, 1373, 1429,
+1079, 1791, 0, 0, 0, 0, 0, 1011, 0, 388, 0, 0, 0, 0, 1533, 1247,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 945, 752,
+0, 0, 0, 0, 0, 807, 336, 580, 1001, 1940, 1903, 0, 939, 0, 0, 0,
+0, 246, 0, 0, 0, 0, 0, 0, 0, 0, 972, 0, 1849, 0, 0, 0,
+0, 0, 0, 0, 1779, 508, 0, 44, 648, 0, 838, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 2137, 0, 0, 0, 890, 0, 129, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 821, 1401, 0, 63, 0, 660, 0, 221,
+0, 0, 0, 0, 0, 0, 0, 229, 0, 830, 2169, 0, 0, 1626, 0, 0,
+0, 148, 0, 0, 0, 0, 1785, 1552, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 592, 0, 0, 878, 0, 1225,
+1647, 0, 0, 0, 0, 0, 0, 228, 0, 0, 988, 0, 0, 1249, 0, 0,
+0, 0, 0, 0, 1915, 0, 0, 0, 593, 0, 0, 0, 131, 1955, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+635, 0, 0, 1764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 444, 0, 0, 0, 0, 1812, 0, 0, 0, 146, 0, 0, 0, 0, 1971,
+0, 0, 0, 0, 0, 0, 0, 901, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2092, 0, 0, 634, 0, 0,
+0, 0, 0, 796, 1883, 0, 0, 0, 0, 0, 0, 729, 0, 0, 0, 540,
+450, 485, 0, 0, 1050, 1158, 974, 369, 2066, 0, 747, 0, 0, 0, 0, 441,
+1114, 0, 1227, 0, 0, 0, 0, 1400, 0, 1297, 0, 0, 678, 1057, 0, 0,
+0, 157, 1823, 1723, 0, 0, 0, 0, 214, 1976, 0, 0, 0, 0, 0, 722,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 837, 396, 0, 0, 0, 1778,
+0, 0, 22, 1358, 0, 587, 0, 0, 0, 795, 374, 0, 1825, 1863, 0, 0,
+0, 1311, 0, 2035, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 1629, 0,
+0, 0, 0, 1277, 0, 0, 432, 0, 0, 0, 1361, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1576, 0, 172, 0, 0, 155, 1434, 1653, 0, 1692, 0, 0,
+0, 543, 591, 0, 1372, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0,
+557, 916, 0, 0, 0, 0, 0, 1904, 0, 0, 0, 1815, 0, 0, 0, 0,
+0, 0, 0, 1014, 0, 1010, 1893, 0, 699, 434, 0, 0, 0, 0, 479, 0,
+0, 0, 0, 477, 1621, 1950, 0, 0, 0, 612, 0, 1206, 0, 0, 0, 499,
+1445, 0, 1763, 0, 0, 0, 799, 1813, 0, 0, 0, 0, 866, 0, 0, 31,
+398, 0, 0, 0, 0, 0, 478, 1018, 0, 1822, 0, 0, 0, 0, 0, 0,
+0, 0, 1906, 0, 1327, 0, 1415, 0, 1190, 74, 1198, 0, 0, 0, 0, 0,
+112, 0, 0, 703, 1278, 0, 0, 0, 0, 0, 0, 0, 1257, 472, 0, 0,
+0, 0, 1098, 831, 0, 0, 1797, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+290, 0, 0, 0, 0, 0, 800, 805, 2040, 0, 744, 1154, 1365, 0, 0, 0,
+1117, 0, 0, 0, 0, 278, 1746, 0, 0, 0, 0, 1422, 0, 0, 0, 0,
+0, 0, 0, 937, 1245, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 908,
+1121, 578, 2024, 1099, 0, 199, 717, 0, 0, 0, 629, 0, 0, 0, 0, 2072,
+0, 0, 0, 0, 0, 0, 0, 0, 134, 1701, 0, 0, 0, 0, 145, 1643,
+0, 0, 0, 0, 1945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1164, 0, 0, 1191, 0, 0, 0, 0, 0, 0, 0, 1212, 431, 875, 0,
+0, 0, 0, 254, 1418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 362, 519,
+381, 606, 0, 913, 1975, 0, 0, 0, 1183, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 426, 225, 1351, 0, 0, 51, 856, 1585, 0, 0, 1329, 141, 1254, 0,
+1483, 0, 1734, 0, 0, 0, 0, 0, 1395, 0, 0, 0, 0, 0, 969, 0,
+0, 0, 1349, 0, 0, 1461, 0, 0, 0, 60, 0, 0, 0, 996, 0, 0,
+0, 0, 0, 33, 1989, 0, 977, 0, 0, 0, 0, 0, 0, 0, 294, 0,
+1037, 0, 0, 0, 0, 59, 181, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 124, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0,
+413, 297, 1138, 0, 0, 0, 0, 0, 1494, 0, 0, 0, 0, 684, 0, 0,
+1403, 1485, 0, 0, 1359, 0, 0, 1801, 0, 0, 0, 0, 0, 0, 623, 0,
+0, 0, 1898, 0, 0, 0, 0, 0, 2071, 0, 0, 0, 2121, 1130, 0, 0,
+0, 226, 2067, 0, 0, 0, 1841, 0, 0, 1160, 0, 300, 562, 0, 412, 0,
+628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1525, 0, 0, 0, 52,
+0, 0, 0, 125, 1332, 0, 0, 0, 0, 0, 1261, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1990, 1342, 0, 0, 0, 1777, 0, 512,
+0, 0, 0, 0, 782, 0, 0, 274, 0, 0, 0, 0, 0, 596, 0, 0,
+758, 0, 0, 0, 418, 0, 702, 0, 0, 1199, 0, 1546, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1740, 0, 0, 0, 0, 0, 0, 0, 0,
+902, 1487, 0, 685, 0, 865, 0, 0, 1115, 0, 435, 0, 0, 0, 0, 0,
+0, 98, 0, 0, 1871, 0, 0, 0, 0, 0, 728, 995, 0, 0, 0, 554,
+0, 0, 0, 1704, 0, 0, 0, 0, 0, 689, 0, 0, 0, 0, 0, 709,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 1639, 2028,
+0, 0, 0, 0, 0, 0, 1868, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1406, 0, 0, 470, 0, 0, 285, 1807, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 1491, 0,
+0, 1556, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 897, 1135, 1632,
+0, 1112, 0, 0, 0, 1489, 0, 0, 21, 0, 804, 0, 0, 0, 1352, 0,
+1192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1814, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 1230, 0, 0, 0,
+296, 0, 0, 122, 0, 1710, 0, 0, 0, 0, 0, 698, 0, 0, 0, 1538,
+0, 0, 0, 0, 0, 0, 0, 0, 1453, 1959, 277, 1596, 0, 0, 0, 1839,
+0, 536, 0, 0, 0, 0, 776, 0, 0, 313, 0, 0, 0, 616, 0, 0,
+809, 948, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1162, 0, 47, 0, 0, 0, 0, 1669, 1389, 0, 0, 0, 49, 1048, 0, 0,
+762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 318, 1255, 0,
+0, 0, 279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0,
+0, 0, 0, 1063, 0, 0, 0, 0, 0, 0, 1633, 0, 0, 0, 0, 0,
+970, 0, 655, 0, 0, 0, 0, 0, 0, 0, 1073, 0, 569, 0, 0, 0,
+496, 695, 0, 0, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0, 690,
+0, 307, 0, 0, 0, 0, 0, 997, 798, 0, 0, 0, 0, 0, 0, 0,
+446, 0, 261, 0, 0, 1516, 340, 0, 0, 992, 0, 0, 2139, 0, 0, 0,
+0, 0, 0, 0, 0, 726, 0, 0, 0, 0, 677, 0, 0, 0, 0, 0,
+0, 1824, 0, 0, 0, 0, 1322, 0, 0, 0, 0, 0, 0, 1902, 0, 0,
+0, 0, 0, 0, 0, 0, 627, 1295, 0, 0, 445, 0, 820, 0, 0, 0,
+0, 0, 0, 1831, 575, 810, 0, 110, 1706, 0, 302, 0, 1937, 0, 0, 0,
+0, 0, 657, 1580, 1750, 0, 0, 0, 1108, 1793, 0, 659, 1998, 0, 0, 0,
+0, 39, 0, 0, 0, 0, 0, 896, 0, 1832, 1679, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 376, 1298, 0, 0, 2030, 0, 0, 0, 982, 0, 0,
+170, 0, 0, 1929, 0, 0, 0, 0, 0, 0, 0, 0, 942, 0, 1987, 0,
+0, 674, 0, 0, 2044, 1385, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0,
+0, 0, 0, 0, 0, 1353, 823, 779, 0, 0, 0, 0, 0, 0, 0, 429,
+0, 0, 0, 0, 0, 0, 0, 0, 455, 0, 510, 0, 0, 956, 0, 0,
+522, 0, 0, 0, 0, 194, 0, 0, 0, 1452, 0, 515, 0, 0, 0, 280,
+0, 0, 0, 0, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 1234,
+2140, 0, 0, 0, 0, 1413, 1220, 0, 0, 1080, 0, 989, 0, 0, 0, 1172,
+984, 0, 696, 0, 0, 0, 0, 0, 0, 1159, 1282, 1645, 0, 1869, 0, 979,
+0, 96, 0, 0, 138, 1274, 0, 0, 0, 0, 0, 2050, 29, 1638, 0, 962,
+0, 0, 0, 460, 1188, 0, 0, 0, 631, 0, 0, 0, 0, 0, 1588, 2101,
+0, 0, 725, 824, 0, 0, 1466, 0, 0, 1363, 0, 1436, 1618, 0, 0, 0,
+202, 0, 1942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1982, 0, 0,
+0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 213, 0, 0, 0, 0, 0, 0, 0, 0, 0, 842, 0, 0, 0,
+1061, 0, 0, 0, 0, 0, 0, 1390, 0, 0, 1042, 0, 0, 0, 0, 567,
+0, 216, 0, 3, 0, 811, 0, 0, 0, 0, 0, 1006, 0, 1928, 0, 0,
+0, 0, 0, 0, 884, 0, 0, 732, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1165, 2105, 0, 0, 0, 0, 1003, 672, 1144,
+0, 0, 1956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1110, 0, 0, 918, 0, 0, 0, 0, 0, 410, 0, 0, 1248,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 1651, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0,
+0, 0, 1152, 0, 0, 0, 0, 95, 991, 919, 1870, 0, 0, 1594, 0, 0,
+0, 0, 0, 1093, 0, 0, 0, 0, 545, 0, 0, 1967, 1610, 1201, 0, 973,
+0, 0, 0, 0, 0, 0, 0, 0, 502, 0, 0, 0, 0, 0, 0, 0,
+0, 778, 0, 0, 314, 0, 0, 613, 724, 882, 0, 0, 0, 0, 1803, 0,
+79, 0, 1441, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+2093, 0, 513, 0, 0, 0, 0, 0, 1917, 0, 0, 0, 0, 0, 0, 2144,
+0, 0, 0, 0, 443, 1510, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 123, 2122, 1809, 2148, 1023, 1506, 0, 1694, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1020, 0, 0, 0,
+0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1983, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1529, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1167, 1540, 0, 1423, 0, 1864, 0, 0, 966, 0, 0, 0,
+491, 1916, 0, 0, 0, 476, 1058, 0, 0, 0, 1383, 0, 0, 764, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1405, 0, 711, 0, 0, 0,
+0, 0, 0, 0, 0, 607, 1320, 0, 0, 0, 0, 0, 0, 416, 2002, 2112,
+899, 0, 1296, 0, 0, 0, 0, 0, 1077, 1854, 2133, 0, 0, 0, 1766, 0,
+0, 0, 0, 0, 0, 0, 0, 2010, 365, 1043, 1503, 1216, 1926, 0, 177, 41,
+835, 1602, 1910, 661, 538, 2058, 2113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+603, 0, 0, 0, 0, 0, 12, 694, 925, 1514, 0, 0, 0, 0, 0, 0,
+0, 493, 0, 0, 0, 0, 0, 0, 0, 0, 1670, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 359, 0, 2162, 0, 1973, 0,
+753, 0, 767, 826, 0, 0, 0, 0, 638, 0, 84, 411, 617, 2049, 0, 0,
+0, 0, 0, 0, 572, 0, 0, 0, 658, 0, 200, 419, 1449, 0, 0, 0,
+0, 1090, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1381, 0, 0, 0, 2129, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 999,
+0, 2069, 1897, 0, 0, 0, 0, 0, 0, 0, 0, 386, 609, 1374, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 621, 64, 1668, 0, 1391, 0, 0, 0,
+452, 425, 1300, 0, 305, 0, 0, 0, 0, 0, 0, 256, 293, 1708, 0, 0,
+0, 0, 0, 0, 0, 0, 232, 0, 0, 0, 1836, 0, 0, 0, 0, 0,
+1715, 207, 264, 819, 0, 0, 0, 0, 495, 1486, 245, 1467, 0, 1922, 1029, 0,
+0, 0, 0, 0, 0, 952, 0, 0, 0, 0, 0, 0, 1671, 1237, 0, 1977,
+0, 0, 0, 0, 0, 0, 0, 771, 0, 0, 0, 0, 417, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1819, 1052, 2042, 0, 0, 2131, 0, 0, 0,
+0, 0, 462, 622, 666, 1672, 1914, 0, 0, 0, 0, 0, 1535, 0, 584, 2077,
+0, 0, 1409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1894, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1606, 43, 0, 324, 0, 1181, 0, 0,
+0, 1876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 139, 0, 0, 0, 0, 544, 553, 0, 0, 0, 1407, 253, 2102, 0, 859,
+1744, 0, 0, 0, 0, 0, 0, 0, 1652, 0, 0, 0, 0, 2015, 0, 0,
+0, 6, 0, 0, 0, 1104, 0, 0, 338, 209, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 994, 0, 0, 1747, 0, 1804, 0, 0, 0, 0, 0, 0,
+0, 0, 734, 1148, 1345, 2110, 346, 2036, 0, 0, 0, 0, 303, 480, 0, 0,
+0, 0, 1599, 0, 0, 468, 0, 784, 0, 693, 0, 1178, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 654, 1173, 0, 0, 0, 0, 101, 0, 0,
+1338, 0, 0, 0, 0, 0, 0, 0, 0, 912, 0, 0, 0, 0, 0, 62,
+0, 0, 817, 1575, 0, 0, 2157, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 736, 0, 0, 1185, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 2065, 0, 0, 0, 383, 0, 598, 922,
+2014, 0, 0, 0, 1908, 0, 0, 1226, 0, 0, 0, 1388, 0, 0, 0, 637,
+0, 0, 0, 0, 0, 0, 0, 87, 0, 1859, 1554, 1462, 0, 0, 2007, 0,
+0, 1340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1016, 218, 1745,
+1966, 0, 741, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1438,
+0, 0, 469, 0, 0, 54, 2037, 0, 1109, 0, 1523, 0, 1376, 0, 203, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1857, 1885, 0, 0, 0, 0, 0,
+0, 0, 0, 1478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1545,
+759, 1946, 0, 0, 0, 0, 0, 0, 0, 1465, 601, 0, 0, 1867, 0, 283,
+0, 0, 0, 0, 697, 1612, 0, 0, 2022, 0, 0, 0, 0, 0, 0, 439,
+0, 0, 915, 77, 0, 400, 0, 0, 0, 0, 0, 0, 1703, 0, 0, 0,
+0, 0, 928, 1008, 0, 857, 11, 189, 1102, 1246, 0, 0, 889, 1426, 0, 0,
+0, 0, 0, 0, 1872, 0, 0, 0, 0, 0, 0, 156, 354, 0, 0, 0,
+180, 0, 0, 0, 0, 0, 0, 757, 521, 1802, 1281, 1667, 0, 0, 0, 0,
+1584, 0, 0, 1642, 816, 0, 0, 0, 0, 0, 0, 1066, 0, 1041, 0, 0,
+0, 0, 0, 1392, 2135, 0, 0, 0, 0, 938, 0, 1264, 1040, 1786, 2056, 0,
+0, 0, 1678, 0, 0, 0, 0, 868, 1480, 0, 0, 0, 0, 0, 0, 1075,
+0, 0, 0, 0, 0, 449, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1497, 0, 0, 1729, 0, 739, 0, 0, 0, 2174, 0, 0, 0,
+0, 378, 0, 0, 236, 1881, 0, 0, 768, 1969, 0, 1755, 0, 0, 13, 1952,
+0, 0, 0, 0, 0, 1294, 0, 1015, 0, 0, 0, 0, 0, 0, 0, 1776,
+1527, 0, 0, 0, 0, 0, 1446, 860, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 790, 0, 0, 0, 828, 0, 527, 947, 0, 2013, 2147, 0, 0, 0,
+0, 0, 0, 906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 402, 1258, 0,
+0, 0, 0, 0, 66, 0, 287, 1347, 292, 0, 0, 951, 1783, 243, 0, 0,
+0, 1875, 0, 0, 0, 1838, 0, 0, 0, 1368, 1513, 0, 0, 573, 126, 0,
+791, 0, 0, 268, 0, 0, 0, 0, 0, 0, 442, 0, 682, 473, 0, 0,
+0, 2018, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 92, 559, 0, 0, 1333, 0, 490, 0, 0, 0, 0, 0, 0, 0,
+0, 1570, 0, 0, 0, 0, 1567, 0, 0, 0, 408, 0, 0, 0, 0, 0,
+0, 392, 0, 754, 0, 0, 0, 0, 0, 0, 0, 1696, 718, 858, 1213, 760,
+0, 0, 0, 1091, 2173, 0, 0, 1909, 0, 275, 0, 0, 1179, 0, 0, 1722,
+1605, 0, 0, 182, 1657, 0, 0, 1900, 505, 1455, 0, 0, 0, 1170, 0, 525,
+1184, 1568, 241, 0, 0, 990, 0, 0, 0, 0, 0, 0, 1673, 0, 0, 45,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 319, 1518, 0, 0, 0,
+0, 0, 845, 1343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2054, 0, 1677,
+385, 0, 0, 1808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 483, 0, 0, 414, 0, 0, 0, 0, 0, 1899, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1738, 0, 0, 0, 0, 0, 518, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1522,
+0, 0, 2039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 577, 0, 0, 708,
+0, 589, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1285, 406, 614,
+0, 0, 0, 0, 0, 668, 0, 1749, 1648, 0, 0, 0, 0, 1698, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2020, 0, 0, 0, 0, 1416, 0,
+0, 0, 0, 1069, 586, 337, 0, 0, 2041, 2103, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 106, 0, 0, 0, 1004, 2096, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 2027, 0, 0, 0, 0, 0, 0, 0, 0, 481,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1334, 0, 1492, 1534, 0, 0, 1787, 1312, 0, 0, 0, 421, 0,
+772, 0, 0, 0, 0, 727, 1697, 0, 706, 0, 121, 0, 0, 0, 0, 0,
+0, 0, 876, 1619, 0, 286, 0, 0, 30, 1476, 1699, 0, 0, 0, 2038, 159,
+0, 0, 0, 299, 530, 1827, 0, 2026, 475, 0, 0, 1078, 0, 255, 0, 0,
+0, 2059, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 1662, 0, 0, 0,
+0, 0, 656, 0, 0, 0, 0, 0, 1241, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1564, 0, 2158, 0, 0, 0, 1120, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1397, 0, 331, 0, 0, 0, 0, 46, 0, 1328, 0, 0,
+0, 0, 133, 0, 0, 0, 0, 0, 887, 564, 0, 0, 1279, 0, 0, 0,
+1879, 0, 0, 0, 0, 0, 0, 0, 1918, 0, 0, 2151, 1583, 53, 0, 1371,
+0, 0, 0, 1125, 0, 0, 0, 0, 250, 1586, 2095, 0, 0, 630, 0, 0,
+0, 0, 0, 0, 1354, 0, 639, 0, 0, 0, 2, 0, 2097, 0, 0, 0,
+0, 0, 0, 0, 99, 0, 0, 756, 1289, 0, 0, 1650, 0, 0, 0, 0,
+0, 1315, 456, 1562, 1680, 0, 0, 0, 0, 0, 0, 0, 720, 1471, 0, 0,
+0, 1468, 0, 0, 0, 0, 0, 0, 855, 0, 0, 0, 0, 399, 0, 0,
+0, 1860, 0, 291, 0, 0, 0, 0, 0, 2165, 0, 0, 0, 1560, 0, 0,
+0, 0, 2118, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1590, 0, 0, 0, 0, 0, 0, 1267,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+322, 0, 0, 0, 0, 0, 0, 0, 0, 174, 0, 65, 0, 0, 0, 766,
+0, 0, 0, 602, 1981, 0, 0, 0, 0, 0, 888, 2111, 1207, 0, 1484, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2029, 0, 0,
+0, 763, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 0, 691, 0, 0, 0,
+0, 0, 1411, 0, 15, 1623, 1649, 1685, 1714, 0, 0, 0, 0, 0, 1997, 0,
+827, 0, 0, 1387, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1733, 0, 0, 0, 113, 0, 0, 1459, 0, 0, 1027, 0, 0, 0, 0, 58,
+0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 924, 0, 464, 1561, 0, 0, 1318, 1880, 0, 1366,
+0, 0, 0, 0, 0, 0, 0, 0, 284, 0, 0, 188, 2073, 524, 0, 0,
+0, 0, 0, 0, 1250, 0, 0, 0, 847, 0, 0, 0, 632, 1939, 1221, 0,
+1304, 1330, 0, 0, 836, 943, 0, 0, 0, 0, 0, 0, 288, 1095, 230, 0,
+0, 1834, 0, 0, 0, 0, 0, 802, 0, 0, 0, 329, 0, 0, 0, 0,
+0, 0, 0, 0, 961, 0, 2047, 0, 0, 2104, 0, 0, 0, 0, 0, 26,
+0, 0, 0, 825, 1577, 1360, 0, 0, 523, 2168, 0, 0, 2009, 0, 0, 0,
+0, 0, 0, 1882, 0, 0, 0, 976, 0, 946, 0, 1798, 0, 282, 0, 0,
+687, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1774, 0,
+0, 1760, 298, 1490, 0, 0, 0, 0, 0, 0, 774, 0, 0, 0, 2150, 0,
+0, 325, 0, 0, 0, 0, 0, 0, 0, 0, 1195, 0, 0, 222, 1262, 186,
+0, 0, 0, 0, 1028, 0, 0, 0, 0, 1625, 14, 0, 1641, 0, 0, 0,
+0, 971, 1993, 0, 1231, 1788, 0, 0, 0, 0, 0, 0, 17, 1106, 0, 0,
+0, 0, 0, 0, 0, 853, 1087, 0, 0, 1607, 102, 0, 0, 0, 0, 0,
+0, 1256, 0, 0, 0, 0, 1991, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1887, 0, 0, 0, 0, 1132, 0, 0, 1702, 0, 0, 0, 1479, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 2134, 140, 0, 0, 0, 0, 0, 0,
+190, 276, 1994, 0, 1232, 1239, 1463, 1739, 1901, 0, 0, 0, 205, 0, 20, 0,
+0, 0, 0, 2021, 0, 0, 0, 1443, 1047, 0, 0, 930, 1737, 0, 272, 0,
+1177, 0, 0, 1566, 0, 1370, 0, 0, 208, 0, 0, 0, 0, 0, 2057, 574,
+1215, 0, 0, 0, 604, 0, 0, 582, 0, 0, 0, 0, 0, 0, 1555, 0,
+0, 0, 0, 1062, 0, 0, 0, 0, 1676, 0, 0, 0, 0, 0, 1074, 1765,
+843, 0, 168, 1526, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 532,
+1271, 1581, 2085, 0, 0, 0, 737, 1211, 0, 0, 0, 0, 0, 0, 1275, 680,
+0, 2126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1844, 0, 0, 363, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 81, 597, 669, 1544, 0, 0, 0, 964,
+1323, 0, 1292, 0, 1189, 1472, 0, 0, 0, 0, 1357, 0, 0, 447, 0, 0,
+1571, 712, 0, 0, 0, 2106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1771, 0, 0, 2000, 0, 0, 0, 1769, 0, 0, 1756, 0, 0,
+0, 0, 0, 0, 1689, 0, 683, 0, 1761, 0, 0, 1303, 1572, 0, 0, 0,
+0, 1499, 0, 0, 1829, 0, 1878, 0, 0, 0, 0, 1444, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 792, 1147, 1624, 1794, 2117, 0,
+0, 0, 1284, 0, 1350, 1356, 0, 0, 0, 0, 0, 0, 0, 143, 789, 1752,
+2017, 0, 0, 0, 1664, 0, 0, 0, 0, 0, 957, 0, 0, 0, 1688, 0,
+0, 0, 0, 1326, 1754, 0, 0, 0, 1543, 0, 0, 0, 0, 0, 0, 0,
+2012, 0, 0, 751, 0, 1081, 998, 0, 1855, 0, 0, 534, 0, 0, 0, 0,
+215, 332, 0, 0, 0, 0, 0, 1454, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 1244, 1593, 0, 0, 0, 1820, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1666, 1683, 2153, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1721, 0, 323, 0,
+0, 0, 0, 0, 164, 1238, 0, 0, 556, 0, 0, 0, 100, 220, 539, 844,
+1302, 0, 1002, 0, 0, 1661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 1992, 0, 0, 0, 0, 1122, 0, 0, 0, 0, 625, 1775, 0,
+0, 0, 0, 0, 769, 0, 2083, 0, 0, 0, 1502, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1589, 2171, 0, 2160, 0, 0, 854, 588, 0, 0, 1507, 0,
+357, 0, 0, 0, 0, 233, 0, 0, 18, 0, 0, 0, 1693, 0, 0, 0,
+0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 349,
+585, 467, 0, 0, 457, 716, 959, 0, 0, 0, 0, 0, 0, 0, 0, 1806,
+0, 0, 0, 0, 0, 0, 0, 0, 2063, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 745, 1960, 0, 1810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1394, 0, 0, 0, 0, 0, 0, 0, 900, 242, 1101, 258, 1818, 0, 0, 0,
+0, 0, 0, 0, 710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2082,
+0, 0, 0, 786, 1736, 0, 0, 877, 0, 0, 0, 109, 0, 0, 0, 0,
+0, 0, 0, 0, 740, 0, 0, 0, 0, 0, 1143, 0, 0, 0, 0, 1517,
+0, 0, 0, 0, 1646, 0, 1501, 0, 0, 0, 0, 0, 1440, 0, 0, 0,
+0, 0, 1684, 335, 953, 351, 813, 671, 0, 0, 0, 0, 0, 1420, 0, 147,
+0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1293, 0, 0, 0, 1417,
+0, 0, 0, 1243, 489, 1613, 0, 0, 0, 0, 430, 0, 0, 0, 0, 0,
+0, 1627, 0, 863, 0, 0, 0, 0, 0, 0, 0, 0, 848, 0, 986, 0,
+1943, 0, 259, 393, 0, 0, 1866, 0, 0, 0, 0, 0, 0, 0, 0, 1508,
+0, 787, 0, 0, 0, 0, 0, 0, 0, 1287, 0, 733, 0, 0, 0, 0,
+0, 546, 149, 217, 1654, 0, 0, 0, 0, 0, 0, 0, 0, 600, 2167, 0,
+0, 116, 663, 0, 1065, 0, 0, 0, 0, 0, 0, 0, 917, 1781, 0, 466,
+0, 0, 0, 0, 0, 0, 0, 0, 2155, 0, 0, 1044, 1927, 0, 2078, 0,
+981, 1083, 0, 0, 0, 1811, 0, 651, 0, 0, 0, 1460, 0, 1735, 0, 0,
+0, 0, 0, 0, 0, 1931, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 144, 196, 0, 1833, 1119, 1620, 0, 0, 0, 1790, 0, 0, 0, 0,
+0, 0, 0, 0, 923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 390, 4, 0, 0, 0, 0, 0, 0, 0, 0, 700, 0, 0, 2031,
+0, 0, 1168, 0, 0, 785, 1921, 0, 0, 0, 0, 0, 72, 114, 0, 0,
+949, 0, 0, 0, 0, 1941, 0, 0, 0, 0, 152, 0, 0, 0, 1852, 0,
+0, 0, 0, 118, 0, 0, 1151, 312, 749, 2136, 1089, 0, 0, 0, 0, 57,
+0, 0, 0, 0, 0, 0, 765, 0, 0, 0, 0, 1056, 0, 1431, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1474, 0, 0, 428, 1107, 0, 0, 0,
+0, 0, 0, 85, 0, 1205, 0, 561, 723, 1500, 0, 0, 0, 0, 932, 0,
+0, 0, 0, 535, 0, 1404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 117, 0, 2089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 486, 0, 1316,
+0, 0, 0, 1448, 1601, 1980, 401, 0, 0, 0, 0, 0, 0, 0, 0, 715,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 850, 91, 615, 0, 1000,
+0, 0, 0, 0, 1134, 451, 0, 886, 108, 0, 1713, 1536, 0, 0, 0, 0,
+0, 193, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 9, 0, 0, 0, 0, 440, 1025, 1837, 0, 0, 2090, 0, 1310,
+1470, 1800, 0, 0, 0, 1005, 1549, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1055, 1724, 1905, 0, 0, 0, 0, 0, 0, 0, 0, 920,
+0, 0, 471, 0, 0, 0, 0, 551, 0, 0, 0, 0, 839, 0, 0, 0,
+1019, 0, 0, 0, 0, 0, 903, 2170, 0, 0, 0, 0, 0, 1092, 1314, 0,
+0, 0, 0, 719, 0, 548, 905, 0, 0, 1157, 0, 0, 0, 0, 0, 0,
+0, 594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1301, 0, 191, 488, 0, 1447, 0, 2154, 0, 0, 1862, 0,
+0, 0, 1851, 0, 0, 2098, 0, 0, 0, 0, 1200, 0, 0, 1628, 640, 2076,
+0, 0, 0, 0, 0, 0, 2052, 0, 154, 0, 0, 2152, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 1996, 0, 0, 0, 1111, 0, 0,
+1609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2163,
+0, 0, 0, 1153, 0, 0, 0, 0, 0, 0, 0, 1947, 944, 0, 0, 0,
+1344, 0, 0, 0, 1780, 0, 0, 0, 111, 0, 0, 330, 0, 0, 32, 0,
+0, 0, 0, 0, 0, 0, 83, 343, 0, 0, 0, 42, 0, 0, 0, 862,
+0, 806, 1259, 1335, 1856, 1375, 0, 0, 0, 0, 0, 1105, 520, 1826, 0, 364,
+1137, 1986, 2119, 2142, 0, 1253, 676, 0, 0, 0, 0, 0, 0, 0, 0, 404,
+1307, 0, 0, 0, 0, 0, 347, 0, 0, 1958, 1772, 1094, 37, 0, 0, 0,
+0, 0, 0, 2086, 1913, 206, 0, 0, 0, 0, 642, 861, 1979, 0, 1088, 1071,
+0, 0, 0, 0, 1616, 645, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341,
+0, 0, 0, 289, 88, 0, 1718, 0, 0, 0, 0, 0, 0, 2120, 667, 1792,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1214, 893, 0, 0, 1725, 0,
+0, 590, 0, 1951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1573,
+0, 883, 0, 0, 0, 0, 1886, 1475, 773, 0, 0, 0, 0, 235, 0, 1398,
+0, 0, 704, 1912, 0, 0, 2075, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 1741, 0, 1595, 2043, 2123, 1784, 0, 0, 0,
+0, 0, 701, 1233, 358, 0, 0, 0, 0, 0, 1064, 0, 0, 0, 0, 0,
+993, 0, 892, 1758, 0, 1140, 0, 68, 306, 985, 0, 0, 560, 382, 0, 0,
+0, 0, 0, 0, 1457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+1161, 1537, 0, 1054, 0, 0, 0, 0, 391, 0, 0, 0, 1324, 0, 0, 0,
+0, 142, 1604, 379, 0, 941, 0, 0, 0, 210, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 104, 0, 0, 1742, 405, 0, 0, 0, 0, 1884, 0, 0, 0,
+0, 0, 0, 576, 1379, 1530, 1686, 1640, 0, 652, 0, 0, 0, 0, 0, 0,
+0, 0, 1635, 311, 2159, 0, 0, 130, 0, 0, 1531, 1481, 0, 0, 115, 0,
+0, 0, 0, 0, 0, 48, 0, 0, 0, 1843, 0, 0, 0, 0, 0, 0,
+0, 1336, 0, 0, 0, 0, 2074, 0, 0, 458, 36, 0, 0, 0, 0, 0,
+0, 0, 420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 1224, 1968, 0, 0, 679, 2033, 0, 1380, 0, 0, 0, 0, 1059, 0, 0,
+0, 0, 1377, 0, 0, 0, 0, 0, 0, 0, 0, 211, 304, 0, 0, 0
 };
 
 };
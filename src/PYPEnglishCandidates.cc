@@ -0,0 +1,125 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPEnglishCandidates.h"
+#include <assert.h>
+#include <algorithm>
+#include "PYEditor.h"
+#include "PYStats.h"
+#include "PYTrace.h"
+
+using namespace PY;
+
+/* the shorter input is mostly pinyin. */
+#define ENGLISH_CANDIDATE_MIN_LENGTH 3
+#define ENGLISH_CANDIDATE_NUM 2
+/* the update of the key spends at most 5ms before the lookup,
+   the lookup itself at most 1ms. */
+#define ENGLISH_CANDIDATE_UPDATE_BUDGET (5 * 1000)
+#define ENGLISH_CANDIDATE_LOOKUP_BUDGET (1 * 1000)
+/* the same as the English editor. */
+#define ENGLISH_CANDIDATE_TRAIN_FACTOR 0.1
+
+EnglishCandidates::EnglishCandidates (Editor *editor)
+    : m_skipped (FALSE)
+{
+    m_editor = editor;
+}
+
+gboolean
+EnglishCandidates::processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                      std::vector<EnhancedCandidate> & injected,
+                                      gint64 start)
+{
+    const String & text = m_editor->m_text;
+    if (text.length () < ENGLISH_CANDIDATE_MIN_LENGTH) {
+        m_skipped = FALSE;
+        return FALSE;
+    }
+
+    for (guint i = 0; i < text.length (); ++i) {
+        if (!g_ascii_isalpha (text[i]))
+            return FALSE;
+    }
+
+    if (m_skipped || !m_english_words.open ())
+        return FALSE;
+
+    gint64 now = g_get_monotonic_time ();
+    if (now - start > ENGLISH_CANDIDATE_UPDATE_BUDGET) {
+        Stats::add (STATS_ENGLISH_INLINE_SKIPS);
+        return FALSE;
+    }
+
+    if (!m_english_words.listWords (text, ENGLISH_CANDIDATE_NUM, m_words) ||
+        m_words.empty ())
+        return FALSE;
+
+    if (g_get_monotonic_time () - now > ENGLISH_CANDIDATE_LOOKUP_BUDGET)
+        m_skipped = TRUE;
+
+    /* the exact word first. */
+    for (guint i = 1; i < m_words.size (); ++i) {
+        if (0 == g_ascii_strcasecmp (m_words[i].c_str (), text)) {
+            std::rotate (m_words.begin (), m_words.begin () + i,
+                         m_words.begin () + i + 1);
+            break;
+        }
+    }
+
+    /* after the other injected candidates, before the conversions. */
+    for (guint i = 0; i < m_words.size (); ++i) {
+        EnhancedCandidate enhanced;
+        enhanced.m_candidate_type = CANDIDATE_ENGLISH;
+        enhanced.m_candidate_id = i;
+        enhanced.m_display_string = m_words[i];
+        injected.push_back (enhanced);
+    }
+    return TRUE;
+}
+
+gboolean
+EnglishCandidates::injectCandidates (CandidateContext & context)
+{
+    if (!context.m_english)
+        return FALSE;
+
+    TraceScope trace (TRACE_ENGLISH_CANDIDATES);
+    return processCandidates (context.m_cache, context.m_injected,
+                              context.m_start);
+}
+
+int
+EnglishCandidates::selectCandidate (EnhancedCandidate & enhanced)
+{
+    assert (CANDIDATE_ENGLISH == enhanced.m_candidate_type);
+
+    m_english_words.train (enhanced.m_display_string.c_str (),
+                           ENGLISH_CANDIDATE_TRAIN_FACTOR);
+    return SELECT_CANDIDATE_COMMIT;
+}
+
+gboolean
+EnglishCandidates::removeCandidate (EnhancedCandidate & enhanced)
+{
+    assert (CANDIDATE_ENGLISH == enhanced.m_candidate_type);
+
+    return FALSE;
+}
@@ -0,0 +1,64 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_LIB_PINYIN_ENGLISH_CANDIDATES_H_
+#define __PY_LIB_PINYIN_ENGLISH_CANDIDATES_H_
+
+#include "PYPEnhancedCandidates.h"
+#include "PYEnglishEditor.h"
+
+namespace PY {
+
+class Editor;
+
+/* The English words of the input inline with the pinyin candidates,
+ * merged after the nbest candidates with the other injected ones. */
+class EnglishCandidates : public EnhancedCandidates<Editor> {
+public:
+    EnglishCandidates (Editor *editor);
+
+public:
+    /* skipped when the update already spent the time budget since
+       start, or a lookup of the input was slower than the budget. */
+    gboolean processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                std::vector<EnhancedCandidate> & injected,
+                                gint64 start);
+    gboolean injectCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_ENGLISH == type;
+    }
+
+    int selectCandidate (EnhancedCandidate & enhanced);
+    gboolean removeCandidate (EnhancedCandidate & enhanced);
+
+protected:
+    EnglishWords m_english_words;
+    std::vector<std::string> m_words;
+
+    /* the lookup of the input was over the budget, reset when the
+       input is shorter than the minimum length. */
+    gboolean m_skipped;
+};
+
+};
+
+#endif
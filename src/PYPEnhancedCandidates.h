@@ -24,6 +24,7 @@
 #include <glib.h>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 namespace PY {
 
@@ -38,7 +39,8 @@ enum CandidateType {
     CANDIDATE_LUA_CONVERTER,
     CANDIDATE_SUGGESTION,
     CANDIDATE_CLOUD_INPUT,
-    CANDIDATE_EMOJI
+    CANDIDATE_EMOJI,
+    CANDIDATE_ENGLISH
 };
 
 enum SelectCandidateAction {
@@ -57,21 +59,187 @@ struct EnhancedCandidate {
     std::string m_display_string;
 };
 
+/* the shadow of a candidate before it is enhanced, the display string
+   is not kept, select and remove only need the type and id. */
+struct CandidateReference {
+    CandidateType m_candidate_type;
+    guint m_candidate_id;
+
+    CandidateReference (const EnhancedCandidate & enhanced)
+        : m_candidate_type (enhanced.m_candidate_type),
+          m_candidate_id (enhanced.m_candidate_id) { }
+
+    EnhancedCandidate candidate (void) const
+    {
+        EnhancedCandidate enhanced;
+        enhanced.m_candidate_type = m_candidate_type;
+        enhanced.m_candidate_id = m_candidate_id;
+        return enhanced;
+    }
+};
+
+/* the injected candidates are placed after the nbest candidates. */
+inline guint
+nbest_candidates_length (const std::vector<EnhancedCandidate> & candidates)
+{
+    guint i = 0;
+    while (i < candidates.size () &&
+           CANDIDATE_NBEST_MATCH == candidates[i].m_candidate_type)
+        i++;
+    return i;
+}
+
+/* merge the injected candidates in one pass, the strings of
+   the existing candidates are re-used without re-allocation. */
+inline void
+merge_injected_candidates (const std::vector<EnhancedCandidate> & candidates,
+                           const std::vector<EnhancedCandidate> & injected,
+                           std::vector<EnhancedCandidate> & merged)
+{
+    guint nbest = nbest_candidates_length (candidates);
+
+    merged.resize (candidates.size () + injected.size ());
+    std::vector<EnhancedCandidate>::iterator iter = merged.begin ();
+    iter = std::copy (candidates.begin (), candidates.begin () + nbest, iter);
+    iter = std::copy (injected.begin (), injected.end (), iter);
+    std::copy (candidates.begin () + nbest, candidates.end (), iter);
+}
+
+/* One update of the candidates threaded through the stages: the
+ * initial fill when begin is zero, or the candidates appended from
+ * begin when paging. */
+struct CandidateContext {
+    /* output of libpinyin candidates. */
+    const std::vector<EnhancedCandidate> & m_cache;
+    /* collected by the injecting stages on the initial fill. */
+    std::vector<EnhancedCandidate> & m_injected;
+    /* the merged candidates, converted in place. */
+    std::vector<EnhancedCandidate> & m_candidates;
+    guint m_begin;
+
+    /* the monotonic time when the update started. */
+    gint64 m_start;
+
+    /* the enabled stages. */
+    gboolean m_emoji;
+    gboolean m_english;
+    gboolean m_cloud;
+    gboolean m_simp;
+    const char * m_converter;
+
+    /* the input is not all parsed as pinyin. */
+    gboolean m_unparsed;
+
+    CandidateContext (const std::vector<EnhancedCandidate> & cache,
+                      std::vector<EnhancedCandidate> & injected,
+                      std::vector<EnhancedCandidate> & candidates,
+                      guint begin)
+        : m_cache (cache), m_injected (injected), m_candidates (candidates),
+          m_begin (begin), m_start (g_get_monotonic_time ()),
+          m_emoji (FALSE), m_english (FALSE), m_cloud (FALSE),
+          m_simp (TRUE), m_converter (""), m_unparsed (FALSE) { }
+};
+
 template <class IEditor>
 class EnhancedCandidates {
 
 public:
+    /* the candidate types selected and removed by the stage. */
+    static gboolean handles (CandidateType type);
+
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
 
+    /* the steps of CandidatePipeline, hidden by the stages using them. */
+    gboolean injectCandidates (CandidateContext & context) { return FALSE; }
+    gboolean convertCandidates (CandidateContext & context) { return FALSE; }
+
 protected:
 
     /* will call selectCandidateInternal method of class IEditor. */
     IEditor *m_editor;
 };
 
+/* The stages of an editor composed at compile time, the candidate is
+ * selected or removed by the first stage handling its type, so the
+ * dispatch is inlined into one chain of comparisons.
+ *
+ * The candidates are processed in the order of the stages: all stages
+ * inject into the context on the initial fill, the injected candidates
+ * are merged after the nbest candidates, then all stages convert the
+ * merged candidates from begin. */
+template <typename... Stages>
+class CandidatePipeline;
+
+template <>
+class CandidatePipeline<> {
+public:
+    void injectCandidates (CandidateContext & context) { }
+    void convertCandidates (CandidateContext & context) { }
+
+    int selectCandidate (EnhancedCandidate & enhanced)
+    {
+        g_assert_not_reached ();
+        return SELECT_CANDIDATE_ALREADY_HANDLED;
+    }
+
+    gboolean removeCandidate (EnhancedCandidate & enhanced)
+    {
+        g_assert_not_reached ();
+        return FALSE;
+    }
+};
+
+template <typename Stage, typename... Rest>
+class CandidatePipeline<Stage, Rest...> : public CandidatePipeline<Rest...> {
+public:
+    CandidatePipeline (Stage & stage, Rest & ... rest)
+        : CandidatePipeline<Rest...> (rest...), m_stage (stage) { }
+
+    /* called on the whole pipeline. */
+    void processCandidates (CandidateContext & context)
+    {
+        if (0 == context.m_begin) {
+            context.m_injected.clear ();
+            injectCandidates (context);
+            merge_injected_candidates (context.m_cache, context.m_injected,
+                                       context.m_candidates);
+        }
+        convertCandidates (context);
+    }
+
+    void injectCandidates (CandidateContext & context)
+    {
+        m_stage.injectCandidates (context);
+        CandidatePipeline<Rest...>::injectCandidates (context);
+    }
+
+    void convertCandidates (CandidateContext & context)
+    {
+        m_stage.convertCandidates (context);
+        CandidatePipeline<Rest...>::convertCandidates (context);
+    }
+
+    int selectCandidate (EnhancedCandidate & enhanced)
+    {
+        if (Stage::handles (enhanced.m_candidate_type))
+            return m_stage.selectCandidate (enhanced);
+        return CandidatePipeline<Rest...>::selectCandidate (enhanced);
+    }
+
+    gboolean removeCandidate (EnhancedCandidate & enhanced)
+    {
+        if (Stage::handles (enhanced.m_candidate_type))
+            return m_stage.removeCandidate (enhanced);
+        return CandidatePipeline<Rest...>::removeCandidate (enhanced);
+    }
+
+private:
+    Stage & m_stage;
+};
+
 };
 
 #endif
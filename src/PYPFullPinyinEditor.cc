@@ -21,19 +21,23 @@
 #include "PYPFullPinyinEditor.h"
 #include "PYConfig.h"
 #include "PYLibPinyin.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
+/* longer than any full pinyin syllable matched by the parser. */
+#define MAX_FULL_PINYIN_LEN 8
+
 FullPinyinEditor::FullPinyinEditor
 (PinyinProperties & props, Config & config)
     : PinyinEditor (props, config)
 {
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
 }
 
 FullPinyinEditor::~FullPinyinEditor (void)
 {
-    LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
+    if (m_instance)
+        freeInstance (m_instance);
     m_instance = NULL;
 }
 
@@ -50,10 +54,10 @@ FullPinyinEditor::insert (gint ch)
     if (G_UNLIKELY (m_text.length () >= MAX_PINYIN_LEN))
         return TRUE;
 
+    markChanged (m_cursor);
     m_text.insert (m_cursor++, ch);
 
-    updatePinyin ();
-    update ();
+    updateDeferred ();
     return TRUE;
 }
 
@@ -69,6 +73,12 @@ FullPinyinEditor::processKeyEvent (guint keyval,
 void
 FullPinyinEditor::updatePinyin (void)
 {
+    guint changed_offset = m_changed_offset;
+    gboolean parsed_valid = m_parsed_valid;
+
+    m_parsed_valid = TRUE;
+    m_changed_offset = G_MAXUINT;
+
     if (G_UNLIKELY (m_text.empty ())) {
         m_pinyin_len = 0;
         /* TODO: check whether to replace "" with NULL. */
@@ -77,9 +87,31 @@ FullPinyinEditor::updatePinyin (void)
         return;
     }
 
-    m_pinyin_len =
-        pinyin_parse_more_full_pinyins (m_instance, m_text.c_str ());
-    pinyin_guess_sentence (m_instance);
+    /* the changed text is too far from the parsed pinyin to
+       start a syllable, keep the parsed keys and sentence. */
+    if (parsed_valid &&
+        changed_offset >= m_pinyin_len + MAX_FULL_PINYIN_LEN)
+        return;
+
+    guint pinyin_len = m_pinyin_len;
+    {
+        TraceScope trace (TRACE_PARSE_PINYIN);
+        m_pinyin_len =
+            pinyin_parse_more_full_pinyins (m_instance, m_text.c_str ());
+    }
+
+    /* the parsed keys are unchanged, keep the sentence. */
+    if (parsed_valid && changed_offset >= pinyin_len &&
+        m_pinyin_len == pinyin_len)
+        return;
+
+    {
+        TraceScope trace (TRACE_GUESS_SENTENCE);
+        pinyin_guess_sentence (m_instance);
+    }
+
+    if (commitStableHead ())
+        updatePinyin ();
 }
 
 void
@@ -93,18 +125,20 @@ FullPinyinEditor::updateAuxiliaryText (void)
         return;
     }
 
-    m_buffer.clear ();
+    if (!auxiliaryTextCached ()) {
+        m_auxiliary_buffer.clear ();
 
-    gchar * aux_text = NULL;
-    pinyin_get_full_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
-    m_buffer << aux_text;
-    g_free(aux_text);
+        gchar * aux_text = NULL;
+        pinyin_get_full_pinyin_auxiliary_text (m_instance, m_cursor, &aux_text);
+        m_auxiliary_buffer << aux_text;
+        g_free(aux_text);
 
-    /* append rest text */
-    const gchar * p = m_text.c_str() + m_pinyin_len;
-    m_buffer << p;
+        /* append rest text */
+        const gchar * p = m_text.c_str() + m_pinyin_len;
+        m_auxiliary_buffer << p;
+    }
 
-    StaticText text (m_buffer);
+    StaticText text (m_auxiliary_buffer);
     if (DISPLAY_STYLE_TRADITIONAL == m_config.displayStyle ())
         Editor::updateAuxiliaryText (text, TRUE);
     if (DISPLAY_STYLE_COMPACT == m_config.displayStyle ())
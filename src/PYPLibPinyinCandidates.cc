@@ -24,19 +24,33 @@
 #include "PYConfig.h"
 #include "PYLibPinyin.h"
 #include "PYPPhoneticEditor.h"
+#include "PYStats.h"
 
 
 using namespace PY;
 
 gboolean
 LibPinyinCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+{
+    return processCandidates (candidates, 0, G_MAXUINT);
+}
+
+gboolean
+LibPinyinCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                        guint begin, guint end)
 {
     pinyin_instance_t *instance = m_editor->m_instance;
 
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
 
-    for (guint i = 0; i < len; i++) {
+    if (end > len)
+        end = len;
+
+    if (begin >= end)
+        return FALSE;
+
+    for (guint i = begin; i < end; i++) {
         lookup_candidate_t * candidate = NULL;
         pinyin_get_candidate (instance, i, &candidate);
 
@@ -72,6 +86,7 @@ LibPinyinCandidates::processCandidates (std::vector<EnhancedCandidate> & candida
         candidates.push_back (enhanced);
     }
 
+    Stats::add (STATS_CANDIDATES, end - begin);
     return TRUE;
 }
 
@@ -103,13 +118,14 @@ LibPinyinCandidates::selectCandidate (EnhancedCandidate & enhanced)
         guint8 index = 0;
         pinyin_get_candidate_nbest_index(instance, candidate, &index);
 
-        if (index != 0)
+        if (index != 0) {
+            ContextWriter writer (LibPinyinBackEnd::instance ());
             pinyin_train (instance, index);
+        }
 
         pinyin_get_sentence (instance, index, &str);
-        if (m_editor->m_config.rememberEveryInput ())
-            LibPinyinBackEnd::instance ().rememberUserInput (instance, str);
-        LibPinyinBackEnd::instance ().modified();
+        LibPinyinBackEnd::instance ().trained
+            (instance, str, m_editor->m_config.rememberEveryInput ());
         g_free (str);
 
         return SELECT_CANDIDATE_COMMIT;
@@ -123,11 +139,13 @@ LibPinyinCandidates::selectCandidate (EnhancedCandidate & enhanced)
     if (lookup_cursor == m_editor->m_text.length ()) {
         pinyin_get_sentence (instance, 0, &str);
         enhanced.m_display_string = str;
-        pinyin_train (instance, 0);
+        {
+            ContextWriter writer (LibPinyinBackEnd::instance ());
+            pinyin_train (instance, 0);
+        }
 
-        if (m_editor->m_config.rememberEveryInput ())
-            LibPinyinBackEnd::instance ().rememberUserInput (instance, str);
-        LibPinyinBackEnd::instance ().modified ();
+        LibPinyinBackEnd::instance ().trained
+            (instance, str, m_editor->m_config.rememberEveryInput ());
         g_free (str);
 
         return SELECT_CANDIDATE_MODIFY_IN_PLACE|SELECT_CANDIDATE_COMMIT;
@@ -155,6 +173,7 @@ LibPinyinCandidates::removeCandidate (EnhancedCandidate & enhanced)
     guint index = enhanced.m_candidate_id;
     pinyin_get_candidate (instance, index, &candidate);
     assert (pinyin_is_user_candidate (instance, candidate));
+    ContextWriter writer (LibPinyinBackEnd::instance ());
     pinyin_remove_user_candidate (instance, candidate);
 
     return TRUE;
@@ -35,6 +35,15 @@ public:
 
 public:
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* only materialize the candidates in [begin, end). */
+    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                guint begin, guint end);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_NBEST_MATCH == type || CANDIDATE_NORMAL == type ||
+            CANDIDATE_USER == type;
+    }
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
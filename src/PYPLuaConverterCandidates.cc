@@ -23,10 +23,18 @@
 #include "PYString.h"
 #include "PYConfig.h"
 #include "PYPPhoneticEditor.h"
+#include "PYStats.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
+#define CONVERSION_CACHE_SIZE 1024
+
+ConversionCache LuaConverterCandidates::m_cache (CONVERSION_CACHE_SIZE,
+                                                 STATS_LUA_CONVERTER_CACHE_HITS);
+
 LuaConverterCandidates::LuaConverterCandidates (Editor *editor)
+    : m_batch (FALSE)
 {
     m_editor = editor;
 }
@@ -35,66 +43,153 @@ gboolean
 LuaConverterCandidates::setLuaPlugin (IBusEnginePlugin * plugin)
 {
     m_lua_plugin = plugin;
+    m_converter.clear ();
+    m_batch = FALSE;
     return TRUE;
 }
 
 gboolean
 LuaConverterCandidates::setConverter (const char * lua_function_name)
 {
-    return ibus_engine_plugin_set_converter (m_lua_plugin, lua_function_name);
+    if (!m_lua_plugin || '\0' == lua_function_name[0]) {
+        m_converter = "";
+        return FALSE;
+    }
+
+    if (G_LIKELY (m_converter == lua_function_name))
+        return TRUE;
+
+    const lua_converter_t * converter = ibus_engine_plugin_lookup_converter
+        (m_lua_plugin, lua_function_name);
+
+    m_converter = converter ? lua_function_name : "";
+    m_batch = converter ? converter->batch : FALSE;
+    return converter != NULL;
+}
+
+void
+LuaConverterCandidates::convert (const char * converter,
+                                 const std::string & in, std::string & out)
+{
+    m_cache.setTag (converter);
+    if (m_cache.lookup (in, out))
+        return;
+
+    StatsScope stats (STATS_LUA_CALLS);
+    if (m_batch) {
+        const char * argument = in.c_str ();
+        gchar ** results = ibus_engine_plugin_call_batch
+            (m_lua_plugin, converter, &argument, 1);
+        out = results ? results[0] : in;
+        g_strfreev (results);
+    } else {
+        ibus_engine_plugin_call (m_lua_plugin, converter, in.c_str ());
+        gchar * string = ibus_engine_plugin_get_first_result (m_lua_plugin);
+        out = string ? string : "";
+        g_free (string);
+    }
+    m_cache.insert (in, out);
 }
 
 gboolean
-LuaConverterCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+LuaConverterCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                           guint begin)
 {
     if (!m_lua_plugin)
         return FALSE;
 
-    m_candidates.clear ();
+    if (0 == begin)
+        m_candidates.clear ();
 
-    const char * converter = ibus_engine_plugin_get_converter (m_lua_plugin);
-
-    if (NULL == converter)
+    /* the shadow is empty when the converter is not registered. */
+    if (m_converter.empty ())
         return FALSE;
 
-    for (guint i = 0; i < candidates.size (); i++) {
+    assert (m_candidates.size () == begin);
+
+    const char * converter = m_converter.c_str ();
+    gboolean batch = m_batch;
+    std::vector<guint> pending;
+
+    std::string converted;
+    for (guint i = begin; i < candidates.size (); i++) {
         EnhancedCandidate & enhanced = candidates[i];
 
-        m_candidates.push_back (enhanced);
+        m_candidates.push_back (CandidateReference (enhanced));
 
         enhanced.m_candidate_type = CANDIDATE_LUA_CONVERTER;
         enhanced.m_candidate_id = i;
 
-        ibus_engine_plugin_call (m_lua_plugin, converter,
-                                enhanced.m_display_string.c_str ());
-        gchar * string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-        enhanced.m_display_string = string;
-        g_free (string);
+        if (!batch) {
+            convert (converter, enhanced.m_display_string, converted);
+            enhanced.m_display_string.swap (converted);
+            continue;
+        }
+
+        /* collect the strings not in cache for the batch call,
+           the missed strings are kept unconverted. */
+        m_cache.setTag (converter);
+        if (!m_cache.lookup (enhanced.m_display_string,
+                             enhanced.m_display_string))
+            pending.push_back (i);
+    }
+
+    if (pending.empty ())
+        return TRUE;
+
+    std::vector<const char *> arguments;
+    for (guint i = 0; i < pending.size (); i++)
+        arguments.push_back (candidates[pending[i]].m_display_string.c_str ());
+
+    gchar ** results = NULL;
+    {
+        StatsScope stats (STATS_LUA_CALLS);
+        results = ibus_engine_plugin_call_batch
+            (m_lua_plugin, converter, &arguments[0], arguments.size ());
+    }
+    if (NULL == results)
+        return FALSE;
+
+    for (guint i = 0; i < pending.size (); i++) {
+        guint id = pending[i];
+        m_cache.insert (candidates[id].m_display_string, results[i]);
+        candidates[id].m_display_string = results[i];
     }
+    g_strfreev (results);
 
     return TRUE;
 }
 
+gboolean
+LuaConverterCandidates::convertCandidates (CandidateContext & context)
+{
+    if (0 == context.m_begin)
+        setConverter (context.m_converter);
+    if (!active ())
+        return FALSE;
+
+    TraceScope trace (TRACE_LUA_CONVERTER_CANDIDATES);
+    return processCandidates (context.m_candidates, context.m_begin);
+}
+
 int
 LuaConverterCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
     guint id = enhanced.m_candidate_id;
     assert (CANDIDATE_LUA_CONVERTER == enhanced.m_candidate_type);
 
-    const char * converter = ibus_engine_plugin_get_converter (m_lua_plugin);
-    assert (NULL != converter);
+    assert (!m_converter.empty ());
+    const char * converter = m_converter.c_str ();
 
     if (G_UNLIKELY (id >= m_candidates.size ()))
         return SELECT_CANDIDATE_ALREADY_HANDLED;
 
-    int action = m_editor->selectCandidateInternal (m_candidates[id]);
+    EnhancedCandidate candidate = m_candidates[id].candidate ();
+    int action = m_editor->selectCandidateInternal (candidate);
 
     if (action & SELECT_CANDIDATE_MODIFY_IN_PLACE) {
-        ibus_engine_plugin_call (m_lua_plugin, converter,
-                                 enhanced.m_display_string.c_str ());
-        gchar * string = ibus_engine_plugin_get_first_result (m_lua_plugin);
-        enhanced.m_display_string = string;
-        g_free (string);
+        convert (converter, candidate.m_display_string,
+                 enhanced.m_display_string);
     }
 
     return action;
@@ -109,5 +204,6 @@ LuaConverterCandidates::removeCandidate (EnhancedCandidate & enhanced)
     if (G_UNLIKELY (id >= m_candidates.size ()))
         return FALSE;
 
-    return m_editor->removeCandidateInternal (m_candidates[id]);
+    EnhancedCandidate candidate = m_candidates[id].candidate ();
+    return m_editor->removeCandidateInternal (candidate);
 }
@@ -26,6 +26,7 @@
 #include <vector>
 #include "PYPointer.h"
 #include "PYPEnhancedCandidates.h"
+#include "PYConversionCache.h"
 
 namespace PY {
 
@@ -38,17 +39,39 @@ public:
 public:
     gboolean setLuaPlugin (IBusEnginePlugin * plugin);
 
+    /* the converter is kept by each editor, the lua plugin is shared. */
     gboolean setConverter (const char * lua_function_name);
 
-    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* the converter is set and registered in the lua plugin. */
+    gboolean active (void) const { return !m_converter.empty (); }
+
+    /* convert the candidates from begin, which are appended since last call. */
+    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                guint begin = 0);
+    /* the converter is set on the initial fill. */
+    gboolean convertCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_LUA_CONVERTER == type;
+    }
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
 
 protected:
-    std::vector<EnhancedCandidate> m_candidates;
+    void convert (const char * converter, const std::string & in,
+                  std::string & out);
+
+    std::vector<CandidateReference> m_candidates;
+
+    /* shared by all editors. */
+    static ConversionCache m_cache;
 
     Pointer<IBusEnginePlugin> m_lua_plugin;
+
+    std::string m_converter;
+    gboolean m_batch;
 };
 
 };
@@ -23,6 +23,8 @@
 #include "PYString.h"
 #include "PYConfig.h"
 #include "PYPPhoneticEditor.h"
+#include "PYStats.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
@@ -40,6 +42,20 @@ LuaTriggerCandidates::setLuaPlugin (IBusEnginePlugin *plugin)
 
 gboolean
 LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+{
+    std::vector<EnhancedCandidate> injected;
+    if (!processCandidates (candidates, injected))
+        return FALSE;
+
+    candidates.insert (candidates.begin () +
+                       nbest_candidates_length (candidates),
+                       injected.begin (), injected.end ());
+    return TRUE;
+}
+
+gboolean
+LuaTriggerCandidates::processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                         std::vector<EnhancedCandidate> & injected)
 {
     if (!m_lua_plugin)
         return FALSE;
@@ -48,25 +64,22 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
     enhanced.m_candidate_type = CANDIDATE_LUA_TRIGGER;
     enhanced.m_candidate_id = 0;
 
-    std::vector<EnhancedCandidate>::iterator pos;
-    for (pos = candidates.begin (); pos != candidates.end (); ++pos) {
-        if (CANDIDATE_NBEST_MATCH != pos->m_candidate_type)
-            break;
-    }
-
     const char * lua_function_name = NULL;
     const char * text = m_editor->m_text;
     gchar * string = NULL;
 
     if (ibus_engine_plugin_match_input
         (m_lua_plugin, text, &lua_function_name)) {
-        ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+        {
+            StatsScope stats (STATS_LUA_CALLS);
+            ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+        }
 
         string = ibus_engine_plugin_get_first_result (m_lua_plugin);
         enhanced.m_display_string = string;
         g_free (string);
 
-        candidates.insert (pos, enhanced);
+        injected.insert (injected.begin (), enhanced);
         return TRUE;
     } else {
         int num = std::min
@@ -75,13 +88,16 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
             text = candidates[i].m_display_string.c_str ();
             if (ibus_engine_plugin_match_candidate
                 (m_lua_plugin, text, &lua_function_name)) {
-                ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+                {
+                    StatsScope stats (STATS_LUA_CALLS);
+                    ibus_engine_plugin_call (m_lua_plugin, lua_function_name, text);
+                }
 
                 string = ibus_engine_plugin_get_first_result (m_lua_plugin);
                 enhanced.m_display_string = string;
                 g_free (string);
 
-                candidates.insert (pos, enhanced);
+                injected.insert (injected.begin (), enhanced);
                 return TRUE;
             }
         }
@@ -90,6 +106,13 @@ LuaTriggerCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
     return FALSE;
 }
 
+gboolean
+LuaTriggerCandidates::injectCandidates (CandidateContext & context)
+{
+    TraceScope trace (TRACE_LUA_TRIGGER_CANDIDATES);
+    return processCandidates (context.m_cache, context.m_injected);
+}
+
 int
 LuaTriggerCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
@@ -38,6 +38,15 @@ public:
     gboolean setLuaPlugin (IBusEnginePlugin *plugin);
 
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* push the lua trigger candidate to the front of injected. */
+    gboolean processCandidates (const std::vector<EnhancedCandidate> & candidates,
+                                std::vector<EnhancedCandidate> & injected);
+    gboolean injectCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_LUA_TRIGGER == type;
+    }
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
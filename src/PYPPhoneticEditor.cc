@@ -22,26 +22,86 @@
 #include <assert.h>
 #include "PYConfig.h"
 #include "PYPinyinProperties.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
+/* materialize the visible page and the pages after it. */
+#define CANDIDATE_PREFETCH_PAGES 1
+
 /* init static members */
 PhoneticEditor::PhoneticEditor (PinyinProperties &props,
                                 Config &config)
     : Editor (props, config),
     m_pinyin_len (0),
     m_lookup_table (m_config.pageSize ()),
+    m_instance (NULL),
+    m_parsed_valid (FALSE),
+    m_changed_offset (0),
+    m_instance_serial (0),
+    m_update_source (0),
+    m_prefetch_source (0),
+    m_text_revision (0),
+    m_guessed_valid (FALSE),
+    m_guessed_revision (0),
+    m_guessed_lookup_cursor (0),
+    m_guessed_sort_option (m_config.sortOption ()),
+    m_guessed_config_revision (m_config.revision ()),
+    m_libpinyin_valid (FALSE),
+    m_enhanced_valid (FALSE),
+    m_enhanced_emoji (FALSE),
+    m_enhanced_english (FALSE),
+    m_enhanced_cloud (FALSE),
+    m_enhanced_simp (TRUE),
     m_libpinyin_candidates (this),
 #ifdef IBUS_BUILD_LUA_EXTENSION
     m_lua_trigger_candidates (this),
     m_lua_converter_candidates (this),
 #endif
     m_emoji_candidates (this),
-    m_traditional_candidates (this, config)
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+    m_english_candidates (this),
+#endif
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    m_cloud_candidates (this),
+#endif
+    m_traditional_candidates (this, config),
+    m_pipeline (m_libpinyin_candidates,
+                m_emoji_candidates,
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                m_lua_trigger_candidates,
+#endif
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+                m_cloud_candidates,
+#endif
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+                m_english_candidates,
+#endif
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                m_lua_converter_candidates,
+#endif
+                m_traditional_candidates)
 {
 }
 
 PhoneticEditor::~PhoneticEditor (){
+    if (m_update_source)
+        g_source_remove (m_update_source);
+    if (m_prefetch_source)
+        g_source_remove (m_prefetch_source);
+}
+
+/* the buffers of the candidates are rebuilt by the next key. */
+void
+PhoneticEditor::reclaim (void)
+{
+    if (!m_text.empty ())
+        return;
+
+    clearLookupTable ();
+    m_candidate_arena.shrink ();
+    std::vector<EnhancedCandidate> ().swap (m_candidates);
+    String ().swap (m_buffer);
 }
 
 #ifdef IBUS_BUILD_LUA_EXTENSION
@@ -77,6 +137,8 @@ PhoneticEditor::processSpace (guint keyval, guint keycode,
 gboolean
 PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers)
 {
+    flushUpdate ();
+
     if (m_text.empty ())
         return FALSE;
 
@@ -180,6 +242,7 @@ PhoneticEditor::processFunctionKey (guint keyval, guint keycode, guint modifiers
                 guint index = m_lookup_table.cursorPos ();
                 if (index < m_candidates.size () &&
                     removeCandidateInternal (m_candidates[index])) {
+                    invalidateCandidates ();
                     updatePinyin ();
                     update ();
                 }
@@ -207,53 +270,164 @@ PhoneticEditor::updateLookupTableFast (void)
 void
 PhoneticEditor::updateLookupTable (void)
 {
-    m_lookup_table.clear ();
+    /* candidates are unchanged, keep the page and cursor. */
+    if (!updateCandidates () &&
+        m_lookup_table.size () == m_candidates.size ()) {
+        if (m_lookup_table.size ())
+            updateLookupTableFast ();
+        else
+            hideLookupTable ();
+        return;
+    }
+
+    clearLookupTable ();
 
-    updateCandidates ();
     fillLookupTable ();
     if (m_lookup_table.size()) {
         Editor::updateLookupTable (m_lookup_table, TRUE);
+        prefetchCandidates ();
     } else {
         hideLookupTable ();
     }
 }
 
+/* return TRUE when m_candidates is re-built. */
 gboolean
 PhoneticEditor::updateCandidates (void)
 {
-    m_candidates.clear ();
+    gint64 start = g_get_monotonic_time ();
+
+    if (!m_libpinyin_valid) {
+        TraceScope trace (TRACE_LIBPINYIN_CANDIDATES);
+        m_libpinyin_cache.clear ();
+        /* only the visible page and the first candidate of the next
+           page on the key event, the rest are prefetched in idle. */
+        m_libpinyin_candidates.processCandidates
+            (m_libpinyin_cache, 0, m_config.pageSize () + 1);
+        m_libpinyin_valid = TRUE;
+        m_enhanced_valid = FALSE;
+    }
 
-    m_libpinyin_candidates.processCandidates (m_candidates);
+    gboolean emoji = m_config.emojiCandidate ();
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+    gboolean english = m_config.englishCandidate ();
+#else
+    gboolean english = FALSE;
+#endif
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    /* the cloud input is only for full pinyin. */
+    gboolean cloud = m_config.enableCloudInput () && !m_config.doublePinyin ();
+#else
+    gboolean cloud = FALSE;
+#endif
+    gboolean simp = m_props.modeSimp ();
+#ifdef IBUS_BUILD_LUA_EXTENSION
+    const std::string & converter = m_config.luaConverter ();
+#else
+    const std::string converter;
+#endif
 
-    if (m_config.emojiCandidate ())
-        m_emoji_candidates.processCandidates (m_candidates);
+    if (m_enhanced_valid &&
+        emoji == m_enhanced_emoji &&
+        english == m_enhanced_english &&
+        cloud == m_enhanced_cloud &&
+        simp == m_enhanced_simp &&
+        converter == m_enhanced_converter)
+        return FALSE;
 
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    m_lua_trigger_candidates.processCandidates (m_candidates);
+    CandidateContext context (m_libpinyin_cache, m_injected_candidates,
+                              m_candidates, 0);
+    context.m_start = start;
+    context.m_emoji = emoji;
+    context.m_english = english;
+    context.m_cloud = cloud;
+    context.m_simp = simp;
+    context.m_converter = converter.c_str ();
+    context.m_unparsed = m_pinyin_len < m_text.length ();
+    m_pipeline.processCandidates (context);
+
+    m_enhanced_valid = TRUE;
+    m_enhanced_emoji = emoji;
+    m_enhanced_english = english;
+    m_enhanced_cloud = cloud;
+    m_enhanced_simp = simp;
+    m_enhanced_converter = converter;
 
-    std::string converter = m_config.luaConverter ();
+    return TRUE;
+}
+
+/* fetch more candidates when the cursor moves near to the end. */
+gboolean
+PhoneticEditor::fetchCandidates (guint cursor)
+{
+    guint page_size = m_lookup_table.pageSize ();
+    guint num = (cursor / page_size + 1 + CANDIDATE_PREFETCH_PAGES) * page_size;
+
+    if (num <= m_candidates.size ())
+        return FALSE;
 
-    if (!converter.empty ()) {
-        m_lua_converter_candidates.setConverter (converter.c_str ());
-        m_lua_converter_candidates.processCandidates (m_candidates);
+    guint begin = m_libpinyin_cache.size ();
+    guint end = begin + (num - m_candidates.size ());
+    {
+        TraceScope trace (TRACE_LIBPINYIN_CANDIDATES);
+        if (!m_libpinyin_candidates.processCandidates
+            (m_libpinyin_cache, begin, end))
+            return FALSE;
     }
-#endif
 
-    if (!m_props.modeSimp ())
-        m_traditional_candidates.processCandidates (m_candidates);
+    guint start = m_candidates.size ();
+    m_candidates.insert (m_candidates.end (),
+                         m_libpinyin_cache.begin () + begin,
+                         m_libpinyin_cache.end ());
+
+    /* emoji and lua trigger only check the first page. */
+    CandidateContext context (m_libpinyin_cache, m_injected_candidates,
+                              m_candidates, start);
+    context.m_simp = m_enhanced_simp;
+    context.m_converter = m_enhanced_converter.c_str ();
+    m_pipeline.processCandidates (context);
 
+    fillLookupTable ();
     return TRUE;
 }
 
+/* fetch the rest of the current page and the next pages in idle,
+   while the user is looking at the lookup table. */
+void
+PhoneticEditor::prefetchCandidates (void)
+{
+    if (m_prefetch_source)
+        return;
+
+    m_prefetch_source = g_idle_add_full
+        (G_PRIORITY_LOW, PhoneticEditor::prefetchCallback, this, NULL);
+}
+
+gboolean
+PhoneticEditor::prefetchCallback (gpointer data)
+{
+    PhoneticEditor *self = static_cast<PhoneticEditor *> (data);
+    self->m_prefetch_source = 0;
+
+    if (self->m_instance == NULL || self->m_lookup_table.size () == 0)
+        return FALSE;
+
+    /* the panel learns the new next page. */
+    if (self->fetchCandidates (self->m_lookup_table.cursorPos ()))
+        self->updateLookupTableFast ();
+    return FALSE;
+}
+
+/* append the candidates which are not in lookup table yet. */
 gboolean
 PhoneticEditor::fillLookupTable (void)
 {
-    String word;
-    for (guint i = 0; i < m_candidates.size (); i++) {
+    TraceScope trace (TRACE_FILL_LOOKUP_TABLE);
+    for (guint i = m_lookup_table.size (); i < m_candidates.size (); i++) {
         EnhancedCandidate & candidate = m_candidates[i];
-        word = candidate.m_display_string;
 
-        Text text (word);
+        /* the lookup table only holds the text of the arena. */
+        StaticText text (m_candidate_arena.dup (candidate.m_display_string));
 
         /* show user candidate as blue. */
         if (CANDIDATE_USER == candidate.m_candidate_type)
@@ -268,6 +442,9 @@ PhoneticEditor::fillLookupTable (void)
 void
 PhoneticEditor::pageUp (void)
 {
+    checkoutInstance ();
+    flushUpdate ();
+
     if (G_LIKELY (m_lookup_table.pageUp ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -278,6 +455,11 @@ PhoneticEditor::pageUp (void)
 void
 PhoneticEditor::pageDown (void)
 {
+    checkoutInstance ();
+    flushUpdate ();
+
+    fetchCandidates (m_lookup_table.cursorPos () + m_lookup_table.pageSize ());
+
     if (G_LIKELY(m_lookup_table.pageDown ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -288,6 +470,9 @@ PhoneticEditor::pageDown (void)
 void
 PhoneticEditor::cursorUp (void)
 {
+    checkoutInstance ();
+    flushUpdate ();
+
     if (G_LIKELY (m_lookup_table.cursorUp ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -298,6 +483,11 @@ PhoneticEditor::cursorUp (void)
 void
 PhoneticEditor::cursorDown (void)
 {
+    checkoutInstance ();
+    flushUpdate ();
+
+    fetchCandidates (m_lookup_table.cursorPos () + 1);
+
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
         updateLookupTableFast ();
         updatePreeditText ();
@@ -308,16 +498,52 @@ PhoneticEditor::cursorDown (void)
 void
 PhoneticEditor::candidateClicked (guint index, guint button, guint state)
 {
+    checkoutInstance ();
     selectCandidateInPage (index);
 }
 
+void
+PhoneticEditor::focusIn (void)
+{
+    /* do not block the focus on the warming up context. */
+    if (contextReady (0))
+        checkoutInstance ();
+}
+
+void
+PhoneticEditor::focusOut (void)
+{
+    reset ();
+
+    /* idle editors hold no libpinyin instance. */
+    if (m_instance) {
+        freeInstance (m_instance);
+        m_instance = NULL;
+    }
+}
+
 void
 PhoneticEditor::reset (void)
 {
     m_pinyin_len = 0;
-    m_lookup_table.clear ();
+    clearLookupTable ();
+
+    if (m_update_source) {
+        g_source_remove (m_update_source);
+        m_update_source = 0;
+    }
+    if (m_prefetch_source) {
+        g_source_remove (m_prefetch_source);
+        m_prefetch_source = 0;
+    }
 
-    pinyin_reset (m_instance);
+    if (m_instance)
+        pinyin_reset (m_instance);
+    invalidateCandidates ();
+
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    m_cloud_candidates.reset ();
+#endif
 
     Editor::reset ();
 }
@@ -325,15 +551,98 @@ PhoneticEditor::reset (void)
 void
 PhoneticEditor::update (void)
 {
+    checkoutInstance ();
+
+    /* the keys are parsed again with the changed options. */
+    guint config_revision = m_config.revision ();
+    gboolean reparse = config_revision != m_guessed_config_revision;
+    if (G_UNLIKELY (reparse))
+        m_parsed_valid = FALSE;
+
+    /* run the deferred parse first. */
+    if (G_UNLIKELY (m_update_source || reparse)) {
+        if (m_update_source)
+            g_source_remove (m_update_source);
+        m_update_source = 0;
+        updatePinyin ();
+    }
+
     guint lookup_cursor = getLookupCursor ();
-    pinyin_guess_candidates (m_instance, lookup_cursor,
-                             m_config.sortOption ());
+    sort_option_t sort_option = m_config.sortOption ();
+
+    /* only guess candidates when the key is changed. */
+    if (!m_guessed_valid ||
+        lookup_cursor != m_guessed_lookup_cursor ||
+        sort_option != m_guessed_sort_option ||
+        config_revision != m_guessed_config_revision ||
+        m_text_revision != m_guessed_revision) {
+        TraceScope trace (TRACE_GUESS_CANDIDATES);
+        pinyin_guess_candidates (m_instance, lookup_cursor, sort_option);
+
+        m_guessed_valid = TRUE;
+        m_guessed_revision = m_text_revision;
+        m_guessed_lookup_cursor = lookup_cursor;
+        m_guessed_sort_option = sort_option;
+        m_guessed_config_revision = config_revision;
+        m_libpinyin_valid = FALSE;
+    }
 
     updateLookupTable ();
     updatePreeditText ();
     updateAuxiliaryText ();
 }
 
+/* the candidates are unchanged when the cursor is moved inside
+   the same syllable, only update the preedit and auxiliary text. */
+void
+PhoneticEditor::updateCursor (void)
+{
+    checkoutInstance ();
+
+    if (G_LIKELY (!m_update_source && m_guessed_valid &&
+                  m_guessed_revision == m_text_revision &&
+                  m_guessed_lookup_cursor == getLookupCursor () &&
+                  m_guessed_sort_option == m_config.sortOption () &&
+                  m_guessed_config_revision == m_config.revision ())) {
+        updatePreeditText ();
+        updateAuxiliaryText ();
+        return;
+    }
+
+    update ();
+}
+
+/* called after the text is changed by insert, the parse and guess are
+   deferred to an idle source when more key events are pending, only the
+   preedit text is echoed immediately. */
+void
+PhoneticEditor::updateDeferred (void)
+{
+    if (G_LIKELY (!g_main_context_pending (NULL))) {
+        /* update () runs the deferred parse. */
+        if (!m_update_source)
+            updatePinyin ();
+        update ();
+        return;
+    }
+
+    if (!m_update_source)
+        m_update_source = g_idle_add (PhoneticEditor::updateCallback, this);
+
+    updatePreeditText ();
+}
+
+gboolean
+PhoneticEditor::updateCallback (gpointer data)
+{
+    PhoneticEditor *self = (PhoneticEditor *) data;
+
+    self->m_update_source = 0;
+    self->updatePinyin ();
+    self->update ();
+    return FALSE;
+}
+
 guint
 PhoneticEditor::getPinyinCursor ()
 {
@@ -358,57 +667,13 @@ PhoneticEditor::getLookupCursor (void)
 int
 PhoneticEditor::selectCandidateInternal (EnhancedCandidate & candidate)
 {
-    switch (candidate.m_candidate_type) {
-    case CANDIDATE_NBEST_MATCH:
-    case CANDIDATE_NORMAL:
-    case CANDIDATE_USER:
-        return m_libpinyin_candidates.selectCandidate (candidate);
-
-    case CANDIDATE_TRADITIONAL_CHINESE:
-        return m_traditional_candidates.selectCandidate (candidate);
-
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    case CANDIDATE_LUA_TRIGGER:
-        return m_lua_trigger_candidates.selectCandidate (candidate);
-
-    case CANDIDATE_LUA_CONVERTER:
-        return m_lua_converter_candidates.selectCandidate (candidate);
-#endif
-
-    case CANDIDATE_EMOJI:
-        return m_emoji_candidates.selectCandidate (candidate);
-
-    default:
-        assert (FALSE);
-    }
+    return m_pipeline.selectCandidate (candidate);
 }
 
 gboolean
 PhoneticEditor::removeCandidateInternal (EnhancedCandidate & candidate)
 {
-    switch (candidate.m_candidate_type) {
-    case CANDIDATE_NBEST_MATCH:
-    case CANDIDATE_NORMAL:
-    case CANDIDATE_USER:
-        return m_libpinyin_candidates.removeCandidate (candidate);
-
-    case CANDIDATE_TRADITIONAL_CHINESE:
-        return m_traditional_candidates.removeCandidate (candidate);
-
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    case CANDIDATE_LUA_TRIGGER:
-        return m_lua_trigger_candidates.removeCandidate (candidate);
-
-    case CANDIDATE_LUA_CONVERTER:
-        return m_lua_converter_candidates.removeCandidate (candidate);
-#endif
-
-    case CANDIDATE_EMOJI:
-        return m_emoji_candidates.removeCandidate (candidate);
-
-    default:
-        assert (FALSE);
-    }
+    return m_pipeline.removeCandidate (candidate);
 }
 
 #if 0
@@ -463,12 +728,17 @@ PhoneticEditor::selectCandidate (guint i)
 gboolean
 PhoneticEditor::selectCandidate (guint index)
 {
+    flushUpdate ();
+
     if (G_UNLIKELY (index >= m_candidates.size ()))
         return FALSE;
 
     EnhancedCandidate & candidate = m_candidates[index];
     int action = selectCandidateInternal (candidate);
 
+    /* the libpinyin instance may be changed by the selection. */
+    invalidateCandidates ();
+
     if (action & SELECT_CANDIDATE_COMMIT)
         commit (candidate.m_display_string.c_str ());
 
@@ -481,6 +751,8 @@ PhoneticEditor::selectCandidate (guint index)
 gboolean
 PhoneticEditor::selectCandidateInPage (guint i)
 {
+    flushUpdate ();
+
     guint page_size = m_lookup_table.pageSize ();
     guint cursor_pos = m_lookup_table.cursorPos ();
 
@@ -499,6 +771,7 @@ PhoneticEditor::removeCharBefore (void)
 
     m_cursor --;
     m_text.erase (m_cursor, 1);
+    markChanged (m_cursor);
 
     updatePinyin ();
     update ();
@@ -513,6 +786,7 @@ PhoneticEditor::removeCharAfter (void)
         return FALSE;
 
     m_text.erase (m_cursor, 1);
+    markChanged (m_cursor);
 
     updatePinyin ();
     update ();
@@ -527,7 +801,7 @@ PhoneticEditor::moveCursorLeft (void)
         return FALSE;
 
     m_cursor --;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -538,7 +812,7 @@ PhoneticEditor::moveCursorRight (void)
         return FALSE;
 
     m_cursor ++;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -549,7 +823,7 @@ PhoneticEditor::moveCursorToBegin (void)
         return FALSE;
 
     m_cursor = 0;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -560,7 +834,7 @@ PhoneticEditor::moveCursorToEnd (void)
         return FALSE;
 
     m_cursor = m_text.length ();
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -570,6 +844,8 @@ PhoneticEditor::moveCursorToEnd (void)
 guint
 PhoneticEditor::getCursorLeftByWord (void)
 {
+    flushUpdate ();
+
     size_t offset = 0;
 
     pinyin_get_pinyin_offset (m_instance, m_cursor, &offset);
@@ -584,6 +860,8 @@ PhoneticEditor::getCursorLeftByWord (void)
 guint
 PhoneticEditor::getCursorRightByWord (void)
 {
+    flushUpdate ();
+
     size_t offset = 0;
 
     pinyin_get_pinyin_offset (m_instance, m_cursor, &offset);
@@ -604,6 +882,7 @@ PhoneticEditor::removeWordBefore (void)
     guint cursor = getCursorLeftByWord ();
     m_text.erase (cursor, m_cursor - cursor);
     m_cursor = cursor;
+    markChanged (m_cursor);
     updatePinyin ();
     update ();
     return TRUE;
@@ -617,6 +896,7 @@ PhoneticEditor::removeWordAfter (void)
 
     guint cursor = getCursorRightByWord ();
     m_text.erase (m_cursor, cursor - m_cursor);
+    markChanged (m_cursor);
     updatePinyin ();
     update ();
     return TRUE;
@@ -631,7 +911,7 @@ PhoneticEditor::moveCursorLeftByWord (void)
     guint cursor = getCursorLeftByWord ();
 
     m_cursor = cursor;
-    update ();
+    updateCursor ();
     return TRUE;
 }
 
@@ -644,6 +924,6 @@ PhoneticEditor::moveCursorRightByWord (void)
     guint cursor = getCursorRightByWord ();
 
     m_cursor = cursor;
-    update ();
+    updateCursor ();
     return TRUE;
 }
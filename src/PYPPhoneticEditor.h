@@ -27,7 +27,9 @@
 #include <vector>
 #include <pinyin.h>
 #include "PYLookupTable.h"
+#include "PYStringArena.h"
 #include "PYEditor.h"
+#include "PYReclaim.h"
 #include "PYPEnhancedCandidates.h"
 #include "PYPLibPinyinCandidates.h"
 #include "PYPTradCandidates.h"
@@ -39,11 +41,23 @@
 
 #include "PYPEmojiCandidates.h"
 
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+#include "PYPEnglishCandidates.h"
+#endif
+
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+#include "PYPCloudCandidates.h"
+#endif
+
 namespace PY {
 
-class PhoneticEditor : public Editor {
+class PhoneticEditor : public Editor, public Reclaimable {
     friend class LibPinyinCandidates;
 
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    friend class CloudCandidates;
+#endif
+
 public:
     PhoneticEditor (PinyinProperties & props, Config & config);
     virtual ~PhoneticEditor ();
@@ -57,6 +71,8 @@ public:
     virtual void update (void);
     virtual void reset (void);
     virtual void candidateClicked (guint index, guint button, guint state);
+    virtual void focusIn (void);
+    virtual void focusOut (void);
     virtual gboolean processKeyEvent (guint keyval, guint keycode, guint modifiers);
     virtual gboolean processSpace (guint keyval, guint keycode, guint modifiers);
     virtual gboolean processFunctionKey (guint keyval, guint keycode, guint modifiers);
@@ -64,7 +80,11 @@ public:
     virtual void updateLookupTableFast ();
     virtual gboolean updateCandidates ();
     virtual gboolean fillLookupTable ();
+    gboolean fetchCandidates (guint cursor);
+    void prefetchCandidates (void);
+    static gboolean prefetchCallback (gpointer data);
     virtual void commit (const gchar *str) = 0;
+    virtual void reclaim (void);
 
 #ifdef IBUS_BUILD_LUA_EXTENSION
     gboolean setLuaPlugin (IBusEnginePlugin *plugin);
@@ -81,6 +101,44 @@ protected:
     guint getPinyinCursor (void);
     guint getLookupCursor (void);
 
+    /* the libpinyin instance is checked out from LibPinyinBackEnd
+       when focused, and returned when unfocused. */
+    virtual pinyin_instance_t * allocInstance (void) = 0;
+    virtual void freeInstance (pinyin_instance_t *instance) = 0;
+    /* wait at most timeout microseconds for the warming up context. */
+    virtual gboolean contextReady (gint64 timeout) = 0;
+    void checkoutInstance (void)
+    {
+        if (G_UNLIKELY (m_instance == NULL))
+            m_instance = allocInstance ();
+    }
+
+    /* coalesce the parse and guess of bursty input. */
+    void updateDeferred (void);
+    void flushUpdate (void)
+    {
+        if (G_UNLIKELY (m_update_source))
+            update ();
+    }
+    static gboolean updateCallback (gpointer data);
+
+    /* record the earliest offset of m_text changed since the last parse. */
+    void markChanged (guint offset)
+    {
+        m_changed_offset = MIN (m_changed_offset, offset);
+        m_text_revision ++;
+    }
+
+    /* drop the cached candidates, the libpinyin instance is changed. */
+    void invalidateCandidates (void)
+    {
+        m_parsed_valid = FALSE;
+        m_guessed_valid = FALSE;
+        m_libpinyin_valid = FALSE;
+        m_enhanced_valid = FALSE;
+        m_instance_serial ++;
+    }
+
     /* inline functions */
 
     /* pure virtual functions */
@@ -95,6 +153,8 @@ protected:
     virtual gboolean moveCursorRightByWord (void);
     virtual gboolean moveCursorToBegin (void);
     virtual gboolean moveCursorToEnd (void);
+    /* update after the cursor is moved. */
+    void updateCursor (void);
     virtual void updateAuxiliaryText (void) = 0;
     virtual void updatePreeditText (void) = 0;
     virtual void updatePinyin (void) = 0;
@@ -102,9 +162,16 @@ protected:
     guint getCursorLeftByWord (void);
     guint getCursorRightByWord (void);
 
+    /* the candidate texts reference the arena, clear them together. */
+    void clearLookupTable (void)
+    {
+        m_lookup_table.clear ();
+        m_candidate_arena.clear ();
+    }
 
     /* varibles */
     guint                       m_pinyin_len;
+    StringArena                 m_candidate_arena;
     LookupTable                 m_lookup_table;
     String                      m_buffer;
 
@@ -114,6 +181,47 @@ protected:
     /* use EnhancedCandidates here. */
     std::vector<EnhancedCandidate> m_candidates;
 
+    /* the parsed keys and guessed sentence are of m_text before
+       m_changed_offset, used by the incremental parse. */
+    gboolean                    m_parsed_valid;
+    guint                       m_changed_offset;
+
+    /* bumped when the cached candidates are dropped. */
+    guint                       m_instance_serial;
+
+    /* the idle source of the deferred update. */
+    guint                       m_update_source;
+
+    /* the low priority idle source of the candidate prefetch. */
+    guint                       m_prefetch_source;
+
+    /* bumped when m_text is changed. */
+    guint                       m_text_revision;
+
+    /* guessed candidates, keyed by user input, lookup cursor, sort
+       option and the config revision, which is bumped when the fuzzy
+       pinyin flags or the double pinyin scheme are changed. */
+    gboolean                    m_guessed_valid;
+    guint                       m_guessed_revision;
+    guint                       m_guessed_lookup_cursor;
+    sort_option_t               m_guessed_sort_option;
+    guint                       m_guessed_config_revision;
+
+    /* output of libpinyin candidates, re-used by enhanced candidates. */
+    gboolean                    m_libpinyin_valid;
+    std::vector<EnhancedCandidate> m_libpinyin_cache;
+
+    /* the injected candidates of the current update. */
+    std::vector<EnhancedCandidate> m_injected_candidates;
+
+    /* enhanced candidates, keyed by their options. */
+    gboolean                    m_enhanced_valid;
+    gboolean                    m_enhanced_emoji;
+    gboolean                    m_enhanced_english;
+    gboolean                    m_enhanced_cloud;
+    gboolean                    m_enhanced_simp;
+    std::string                 m_enhanced_converter;
+
     /* several EnhancedCandidates providers. */
     LibPinyinCandidates m_libpinyin_candidates;
 
@@ -124,7 +232,34 @@ protected:
 
     EmojiCandidates m_emoji_candidates;
 
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+    EnglishCandidates m_english_candidates;
+#endif
+
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+    CloudCandidates m_cloud_candidates;
+#endif
+
     TraditionalCandidates m_traditional_candidates;
+
+    /* process, select and remove the candidates by their types,
+       in the order of the update. */
+    typedef CandidatePipeline<LibPinyinCandidates,
+                              EmojiCandidates,
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                              LuaTriggerCandidates,
+#endif
+#ifdef IBUS_BUILD_CLOUD_INPUT_MODE
+                              CloudCandidates,
+#endif
+#ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
+                              EnglishCandidates,
+#endif
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                              LuaConverterCandidates,
+#endif
+                              TraditionalCandidates> Pipeline;
+    Pipeline m_pipeline;
 };
 
 };
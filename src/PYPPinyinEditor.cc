@@ -30,10 +30,67 @@ using namespace PY;
 /* init static members*/
 PinyinEditor::PinyinEditor (PinyinProperties & props,
                                               Config & config)
-    : PhoneticEditor (props, config)
+    : PhoneticEditor (props, config),
+      m_preedit_pinyin_len (0),
+      /* the caches start invalid. */
+      m_preedit_serial (m_instance_serial - 1),
+      m_preedit_sentence (NULL),
+      m_preedit_cursor (0),
+      m_preedit_offset (0),
+      m_auxiliary_cursor (0),
+      m_auxiliary_serial (m_instance_serial - 1),
+      m_stable_keys (0),
+      m_stable_text_len (0)
 {
 }
 
+PinyinEditor::~PinyinEditor (void)
+{
+    g_free (m_preedit_sentence);
+}
+
+void
+PinyinEditor::reset (void)
+{
+    m_stable_head.clear ();
+    m_stable_keys = 0;
+    m_stable_text_len = 0;
+
+    PhoneticEditor::reset ();
+}
+
+gboolean
+PinyinEditor::auxiliaryTextCached (void)
+{
+    if (m_auxiliary_serial == m_instance_serial &&
+        m_auxiliary_cursor == m_cursor &&
+        m_auxiliary_text == m_text)
+        return TRUE;
+
+    m_auxiliary_serial = m_instance_serial;
+    m_auxiliary_cursor = m_cursor;
+    m_auxiliary_text = m_text;
+    return FALSE;
+}
+
+pinyin_instance_t *
+PinyinEditor::allocInstance (void)
+{
+    return LibPinyinBackEnd::instance ().allocPinyinInstance ();
+}
+
+void
+PinyinEditor::freeInstance (pinyin_instance_t *instance)
+{
+    LibPinyinBackEnd::instance ().freePinyinInstance (instance);
+}
+
+gboolean
+PinyinEditor::contextReady (gint64 timeout)
+{
+    return LibPinyinBackEnd::instance ().waitPinyinContext (timeout);
+}
+
 
 /**
  * process pinyin
@@ -178,6 +235,11 @@ PinyinEditor::processKeyEvent (guint keyval, guint keycode,
                   IBUS_META_MASK |
                   IBUS_LOCK_MASK);
 
+    /* pass the keys through while the context is warming up. */
+    if (G_UNLIKELY (m_instance == NULL) && !contextReady (WARM_UP_WAIT_TIME))
+        return FALSE;
+    checkoutInstance ();
+
     switch (keyval) {
     /* letters */
     case IBUS_a ... IBUS_z:
@@ -211,9 +273,7 @@ PinyinEditor::commit (const gchar *str)
     /* text after pinyin */
     const gchar *p = m_text.c_str() + m_pinyin_len;
     if (G_UNLIKELY (m_props.modeFull ())) {
-        while (*p != '\0') {
-            m_buffer.appendUnichar (HalfFullConverter::toFull (*p++));
-        }
+        HalfFullConverter::convertString (p, m_buffer);
     } else {
         m_buffer << p;
     }
@@ -224,6 +284,93 @@ PinyinEditor::commit (const gchar *str)
     reset();
 }
 
+gboolean
+PinyinEditor::commitStableHead (void)
+{
+    /* only track the typing at the end of the input. */
+    if (m_cursor != m_text.length () ||
+        m_text.length () <= m_stable_text_len) {
+        m_stable_head.clear ();
+        m_stable_keys = 0;
+        m_stable_text_len = m_text.length ();
+        return FALSE;
+    }
+    m_stable_text_len = m_text.length ();
+
+    gchar *sentence = NULL;
+    pinyin_get_sentence (m_instance, 0, &sentence);
+    if (sentence == NULL)
+        return FALSE;
+
+    /* the head is the sentence without the last characters. */
+    glong len = g_utf8_strlen (sentence, -1);
+    std::string head;
+    if (len > STABLE_HEAD_WINDOW)
+        head.assign (sentence, g_utf8_offset_to_pointer
+                     (sentence, len - STABLE_HEAD_WINDOW) - sentence);
+    g_free (sentence);
+
+    /* keep the common prefix of the heads, on the character boundary. */
+    size_t common = 0;
+    while (common < head.length () && common < m_stable_head.length () &&
+           head[common] == m_stable_head[common])
+        common ++;
+    while (common > 0 && common < m_stable_head.length () &&
+           (m_stable_head[common] & 0xc0) == 0x80)
+        common --;
+
+    if (common == 0) {
+        m_stable_head = head;
+        m_stable_keys = 0;
+    } else {
+        m_stable_head.resize (common);
+    }
+    m_stable_keys ++;
+
+    if (m_text.length () < LONG_PINYIN_LEN ||
+        m_stable_keys < STABLE_HEAD_KEYS || m_stable_head.empty ())
+        return FALSE;
+
+    std::string stable_head;
+    stable_head.swap (m_stable_head);
+    m_stable_keys = 0;
+
+    size_t end = 0;
+    if (!LibPinyinBackEnd::choosePhrase (m_instance, stable_head.c_str (),
+                                         m_pinyin_len, &end))
+        return FALSE;
+
+    /* keep the guessed sentence of the user as it was. */
+    if (end == 0 || end > m_text.length ()) {
+        pinyin_clear_constraints (m_instance);
+        pinyin_guess_sentence (m_instance);
+        return FALSE;
+    }
+
+    if (G_UNLIKELY (!m_props.modeSimp ())) {
+        m_buffer.clear ();
+        SimpTradConverter (m_config).simpToTrad (stable_head.c_str (),
+                                                 m_buffer);
+        stable_head = m_buffer;
+    }
+
+    Text text (stable_head);
+    commitText (text);
+
+    /* drop the committed pinyin and the following separators. */
+    while (end < m_text.length () && m_text[end] == '\'')
+        end ++;
+    m_text.erase (0, end);
+    m_cursor = m_text.length ();
+    m_stable_text_len = m_text.length ();
+
+    pinyin_reset (m_instance);
+    m_pinyin_len = 0;
+    invalidateCandidates ();
+    markChanged (0);
+    return TRUE;
+}
+
 void
 PinyinEditor::updatePreeditText ()
 {
@@ -239,34 +386,53 @@ PinyinEditor::updatePreeditText ()
         return;
     }
 
-    m_buffer.clear ();
-
     /* probe nbest match candidate */
     lookup_candidate_type_t type;
     lookup_candidate_t * candidate = NULL;
     pinyin_get_candidate (m_instance, 0, &candidate);
     pinyin_get_candidate_type (m_instance, candidate, &type);
 
-    gchar * sentence = NULL;
-    if (NBEST_MATCH_CANDIDATE == type) {
-        pinyin_get_sentence (m_instance, 0, &sentence);
-        m_buffer<<m_candidates[0].m_display_string;
+    static const String empty;
+    const String & nbest = NBEST_MATCH_CANDIDATE == type ?
+        m_candidates[0].m_display_string : empty;
+
+    if (m_preedit_serial != m_instance_serial ||
+        m_preedit_pinyin_len != m_pinyin_len ||
+        m_preedit_text != m_text ||
+        m_preedit_candidate != nbest) {
+        m_preedit_serial = m_instance_serial;
+        m_preedit_pinyin_len = m_pinyin_len;
+        m_preedit_text = m_text;
+        m_preedit_candidate = nbest;
+
+        g_free (m_preedit_sentence);
+        m_preedit_sentence = NULL;
+        if (NBEST_MATCH_CANDIDATE == type)
+            pinyin_get_sentence (m_instance, 0, &m_preedit_sentence);
+
+        m_preedit_buffer.clear ();
+        m_preedit_buffer << nbest;
+
+        /* append rest text */
+        const gchar *p = m_text.c_str () + m_pinyin_len;
+        m_preedit_buffer << p;
+
+        m_preedit_cursor = G_MAXUINT;
     }
 
-    /* append rest text */
-    const gchar *p = m_text.c_str () + m_pinyin_len;
-    m_buffer << p;
+    guint cursor = getPinyinCursor ();
+    if (cursor != m_preedit_cursor) {
+        m_preedit_offset = 0;
+        pinyin_get_character_offset (m_instance, m_preedit_sentence, cursor,
+                                     &m_preedit_offset);
+        m_preedit_cursor = cursor;
+    }
 
-    StaticText preedit_text (m_buffer);
+    StaticText preedit_text (m_preedit_buffer);
     /* underline */
     preedit_text.appendAttribute (IBUS_ATTR_TYPE_UNDERLINE, IBUS_ATTR_UNDERLINE_SINGLE, 0, -1);
 
-    size_t offset = 0;
-    guint cursor = getPinyinCursor ();
-    pinyin_get_character_offset(m_instance, sentence, cursor, &offset);
-    Editor::updatePreeditText (preedit_text, offset, TRUE);
-
-    g_free (sentence);
+    Editor::updatePreeditText (preedit_text, m_preedit_offset, TRUE);
 }
 
 #if 0
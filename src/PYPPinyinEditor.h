@@ -26,12 +26,21 @@ namespace PY {
 
 #define MAX_PINYIN_LEN 64
 
+/* the long input commits the head of the sentence, which is unchanged
+   for STABLE_HEAD_KEYS keys, except the last STABLE_HEAD_WINDOW
+   characters still re-guessed with the following pinyin. */
+#define LONG_PINYIN_LEN 48
+#define STABLE_HEAD_KEYS 4
+#define STABLE_HEAD_WINDOW 4
+
 class Config;
 
 class PinyinEditor : public PhoneticEditor {
 public:
     PinyinEditor (PinyinProperties & props, Config & config);
+    virtual ~PinyinEditor (void);
 
+    virtual void reset (void);
 
 protected:
     gboolean processPinyin (guint keyval, guint keycode, guint modifiers);
@@ -47,8 +56,40 @@ protected:
 
     virtual void updatePinyin (void) = 0;
     virtual void commit (const gchar *str);
+
+    virtual pinyin_instance_t * allocInstance (void);
+    virtual void freeInstance (pinyin_instance_t *instance);
+    virtual gboolean contextReady (gint64 timeout);
     using PhoneticEditor::commit;
 
+    /* return TRUE when m_auxiliary_buffer is still up to date,
+       otherwise record the current pinyin for the re-build. */
+    gboolean auxiliaryTextCached (void);
+
+    /* called after the sentence is guessed, return TRUE when the stable
+       head of the long input is committed and the rest needs parsing. */
+    gboolean commitStableHead (void);
+
+    /* the rendered texts, only re-built when the pinyin is changed,
+       cursor moves only re-compute the preedit offset. */
+    String                      m_preedit_buffer;
+    String                      m_preedit_text;
+    String                      m_preedit_candidate;
+    guint                       m_preedit_pinyin_len;
+    guint                       m_preedit_serial;
+    gchar                      *m_preedit_sentence;
+    guint                       m_preedit_cursor;
+    size_t                      m_preedit_offset;
+
+    String                      m_auxiliary_buffer;
+    String                      m_auxiliary_text;
+    guint                       m_auxiliary_cursor;
+    guint                       m_auxiliary_serial;
+
+    std::string                 m_stable_head;
+    guint                       m_stable_keys;
+    size_t                      m_stable_text_len;
+
 };
 
 };
@@ -23,10 +23,14 @@
 #include <assert.h>
 #include "PYConfig.h"
 #include "PYPConfig.h"
+#include "PYLibPinyin.h"
 #include "PYPunctEditor.h"
 #include "PYRawEditor.h"
 #ifdef IBUS_BUILD_LUA_EXTENSION
 #include "PYExtEditor.h"
+#include "PYChineseNumber.h"
+#include "PYHalfFullConverter.h"
+#include "PYSimpTradConverter.h"
 #endif
 #ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
 #include "PYEnglishEditor.h"
@@ -38,6 +42,7 @@
 #include "PYPDoublePinyinEditor.h"
 #include "PYFallbackEditor.h"
 #include "PYPSuggestionEditor.h"
+#include "PYStats.h"
 
 using namespace PY;
 
@@ -50,84 +55,170 @@ PinyinEngine::PinyinEngine (IBusEngine *engine)
       m_need_update (FALSE),
       m_fallback_editor (new FallbackEditor (m_props, PinyinConfig::instance ()))
 {
-    gint i;
-
 #ifdef IBUS_BUILD_LUA_EXTENSION
     initLuaPlugin ();
 #endif
 
     m_double_pinyin = PinyinConfig::instance ().doublePinyin ();
+    m_editors[MODE_INIT] = getPinyinEditor (m_double_pinyin);
 
-    if (m_double_pinyin) {
-        DoublePinyinEditor *editor = new DoublePinyinEditor
-            (m_props, PinyinConfig::instance ());
-        m_editors[MODE_INIT].reset (editor);
-#ifdef IBUS_BUILD_LUA_EXTENSION
-        editor->setLuaPlugin (m_lua_plugin);
-#endif
-    } else {
-        FullPinyinEditor *editor = new FullPinyinEditor
-            (m_props, PinyinConfig::instance ());
-        m_editors[MODE_INIT].reset (editor);
+    /* the other editors are created on the first mode entry. */
+
+    m_props.signalUpdateProperty ().connect
+        (std::bind (&PinyinEngine::updateProperty, this, _1));
+
+    connectEditorSignals (m_fallback_editor);
+}
+
+/* destructor */
+PinyinEngine::~PinyinEngine (void)
+{
+    Persistence::flush ();
+}
+
+/* both pinyin editors are kept once created, the switch of the scheme
+   only changes the editor of MODE_INIT. */
+EditorPtr &
+PinyinEngine::getPinyinEditor (gboolean double_pinyin)
+{
+    EditorPtr & editor = double_pinyin ?
+        m_double_pinyin_editor : m_full_pinyin_editor;
+    if (G_LIKELY (editor.get ()))
+        return editor;
+
+    PinyinEditor *pinyin = NULL;
+    if (double_pinyin)
+        pinyin = new DoublePinyinEditor (m_props, PinyinConfig::instance ());
+    else
+        pinyin = new FullPinyinEditor (m_props, PinyinConfig::instance ());
+    editor.reset (pinyin);
 #ifdef IBUS_BUILD_LUA_EXTENSION
-        editor->setLuaPlugin (m_lua_plugin);
+    pinyin->setLuaPlugin (m_lua_plugin);
 #endif
-    }
 
-    m_editors[MODE_PUNCT].reset
-        (new PunctEditor (m_props, PinyinConfig::instance ()));
-    m_editors[MODE_RAW].reset
-        (new RawEditor (m_props, PinyinConfig::instance ()));
+    connectEditorSignals (editor);
+    return editor;
+}
 
+/* create the secondary editors on demand. */
+EditorPtr &
+PinyinEngine::getEditor (gint mode)
+{
+    EditorPtr & editor = m_editors[mode];
+    if (G_LIKELY (editor.get ()))
+        return editor;
+
+    switch (mode) {
+    case MODE_PUNCT:
+        editor.reset (new PunctEditor (m_props, PinyinConfig::instance ()));
+        break;
+    case MODE_RAW:
+        editor.reset (new RawEditor (m_props, PinyinConfig::instance ()));
+        break;
+    case MODE_EXTENSION:
 #ifdef IBUS_BUILD_LUA_EXTENSION
-    {
-        ExtEditor *editor = new ExtEditor (m_props, PinyinConfig::instance ());
-        m_editors[MODE_EXTENSION].reset (editor);
-        editor->setLuaPlugin (m_lua_plugin);
-    }
+        {
+            ExtEditor *ext = new ExtEditor (m_props, PinyinConfig::instance ());
+            editor.reset (ext);
+            ext->setLuaPlugin (m_lua_plugin);
+        }
 #else
-    m_editors[MODE_EXTENSION].reset (new Editor (m_props, PinyinConfig::instance ()));
+        editor.reset (new Editor (m_props, PinyinConfig::instance ()));
 #endif
+        break;
+    case MODE_ENGLISH:
 #ifdef IBUS_BUILD_ENGLISH_INPUT_MODE
-    m_editors[MODE_ENGLISH].reset (new EnglishEditor (m_props, PinyinConfig::instance ()));
+        editor.reset (new EnglishEditor (m_props, PinyinConfig::instance ()));
 #else
-    m_editors[MODE_ENGLISH].reset (new Editor (m_props, PinyinConfig::instance ()));
+        editor.reset (new Editor (m_props, PinyinConfig::instance ()));
 #endif
+        break;
+    case MODE_STROKE:
 #ifdef IBUS_BUILD_STROKE_INPUT_MODE
-    m_editors[MODE_STROKE].reset (new StrokeEditor (m_props, PinyinConfig::instance ()));
+        editor.reset (new StrokeEditor (m_props, PinyinConfig::instance ()));
 #else
-    m_editors[MODE_STROKE].reset (new Editor (m_props, PinyinConfig::instance ()));
+        editor.reset (new Editor (m_props, PinyinConfig::instance ()));
 #endif
-
-    {
-        SuggestionEditor *editor = new SuggestionEditor
-            (m_props, PinyinConfig::instance ());
-        m_editors[MODE_SUGGESTION].reset (editor);
+        break;
+    case MODE_SUGGESTION:
+        {
+            SuggestionEditor *suggestion = new SuggestionEditor
+                (m_props, PinyinConfig::instance ());
+            editor.reset (suggestion);
 #ifdef IBUS_BUILD_LUA_EXTENSION
-        editor->setLuaPlugin (m_lua_plugin);
+            suggestion->setLuaPlugin (m_lua_plugin);
 #endif
+        }
+        break;
+    default:
+        g_assert_not_reached ();
     }
 
-    m_props.signalUpdateProperty ().connect
-        (std::bind (&PinyinEngine::updateProperty, this, _1));
+    connectEditorSignals (editor);
+    return editor;
+}
 
-    for (i = MODE_INIT; i < MODE_LAST; i++) {
-        connectEditorSignals (m_editors[i]);
-    }
+#ifdef IBUS_BUILD_LUA_EXTENSION
+/* the lua runtime is shared by the pinyin engines of the process. */
+static Pointer<IBusEnginePlugin> shared_lua_plugin;
 
-    connectEditorSignals (m_fallback_editor);
+/* the opencc converter of the profile, resolved on the main thread,
+   the lua worker thread reads no config. The converters are kept open
+   until exit, so the replaced one is still valid. */
+static gpointer lua_simp_trad_handle = NULL;
+
+static void
+lua_update_simp_trad (void)
+{
+    g_atomic_pointer_set (&lua_simp_trad_handle,
+                          SimpTradConverter (PinyinConfig::instance ()).acquire ());
 }
 
-/* destructor */
-PinyinEngine::~PinyinEngine (void)
+/* the native helpers of the ime module, they are also called from the
+   lua worker thread. */
+static gchar *
+lua_simp_to_trad (const char *str)
 {
+    String out;
+    SimpTradConverter::simpToTrad
+        (g_atomic_pointer_get (&lua_simp_trad_handle), str, out);
+    return g_strdup (out);
 }
 
-#ifdef IBUS_BUILD_LUA_EXTENSION
+static gchar *
+lua_half_to_full (const char *str)
+{
+    String out;
+    HalfFullConverter::convertString (str, out);
+    return g_strdup (out);
+}
+
+static gchar *
+lua_format_chinese_number (gint64 num, int style)
+{
+    gchar buffer[CHINESE_NUMBER_BUFFER_SIZE];
+    return g_strdup (ChineseNumber::format
+                     (num, (ChineseNumberStyle) style, buffer));
+}
+
+static const lua_native_helpers_t lua_native_helpers = {
+    lua_simp_to_trad,
+    lua_half_to_full,
+    lua_format_chinese_number,
+};
+
 gboolean
 PinyinEngine::initLuaPlugin (void)
 {
-    m_lua_plugin = ibus_engine_plugin_new ();
+    if (shared_lua_plugin) {
+        m_lua_plugin = shared_lua_plugin;
+        return TRUE;
+    }
+
+    lua_update_simp_trad ();
+    lua_plugin_set_native_helpers (&lua_native_helpers);
+    shared_lua_plugin = ibus_engine_plugin_new ();
+    m_lua_plugin = shared_lua_plugin;
 
     loadLuaScript ( ".." G_DIR_SEPARATOR_S "lua" G_DIR_SEPARATOR_S "base.lua")||
         loadLuaScript (PKGDATADIR G_DIR_SEPARATOR_S "base.lua");
@@ -140,10 +231,21 @@ PinyinEngine::initLuaPlugin (void)
     return TRUE;
 }
 
+/* the scripts are compiled once into the user cache directory. */
 gboolean
 PinyinEngine::loadLuaScript (const char * filename)
 {
-    return !ibus_engine_plugin_load_lua_script (m_lua_plugin, filename);
+    gchar * basename = g_path_get_basename (filename);
+    gchar * cachename = g_strconcat (basename, "c", NULL);
+    gchar * path = g_build_filename (g_get_user_cache_dir (),
+                                     "ibus", "libpinyin", "lua", cachename, NULL);
+    g_free (cachename);
+    g_free (basename);
+
+    gboolean retval = !ibus_engine_plugin_load_lua_script_cached
+        (m_lua_plugin, filename, path);
+    g_free (path);
+    return retval;
 }
 #endif
 
@@ -152,11 +254,12 @@ gboolean
 PinyinEngine::processAccelKeyEvent (guint keyval, guint keycode,
                                     guint modifiers)
 {
-    std::string accel;
-    pinyin_accelerator_name (keyval, modifiers, accel);
+    TraceScope trace (TRACE_PROCESS_ACCEL_KEY_EVENT);
+    const Config & config = PinyinConfig::instance ();
+    Accelerator accel = Accelerator::fromKeyEvent (keyval, modifiers);
 
     /* Safe Guard for empty key. */
-    if ("" == accel)
+    if (!accel.valid ())
         return FALSE;
 
     /* check Shift or Ctrl + Release hotkey,
@@ -167,7 +270,7 @@ PinyinEngine::processAccelKeyEvent (guint keyval, guint keycode,
         gboolean triggered = FALSE;
 
         if (m_prev_pressed_key == keyval) {
-            if (PinyinConfig::instance ().mainSwitch () == accel) {
+            if (config.mainSwitchKey () == accel) {
                 triggered = TRUE;
             }
         }
@@ -179,10 +282,12 @@ PinyinEngine::processAccelKeyEvent (guint keyval, guint keycode,
                 m_editors[MODE_INIT]->reset ();
             }
 
-            if (!m_editors[MODE_STROKE]->text ().empty ())
+            if (m_editors[MODE_STROKE] &&
+                !m_editors[MODE_STROKE]->text ().empty ())
                 m_editors[MODE_STROKE]->reset ();
 
-            if (!m_editors[MODE_SUGGESTION]->text ().empty ())
+            if (m_editors[MODE_SUGGESTION] &&
+                !m_editors[MODE_SUGGESTION]->text ().empty ())
                 m_editors[MODE_SUGGESTION]->reset ();
 
             if (m_input_mode != MODE_ENGLISH &&
@@ -204,21 +309,21 @@ PinyinEngine::processAccelKeyEvent (guint keyval, guint keycode,
     }
 
     /* Toggle full/half Letter Mode */
-    if (PinyinConfig::instance ().letterSwitch () == accel) {
+    if (config.letterSwitchKey () == accel) {
         m_props.toggleModeFull ();
         m_prev_pressed_key = keyval;
         return TRUE;
     }
 
     /* Toggle full/half Punct Mode */
-    if (PinyinConfig::instance ().punctSwitch () == accel) {
+    if (config.punctSwitchKey () == accel) {
         m_props.toggleModeFullPunct ();
         m_prev_pressed_key = keyval;
         return TRUE;
     }
 
     /* Toggle both full/half Mode */
-    if (PinyinConfig::instance ().bothSwitch () == accel) {
+    if (config.bothSwitchKey () == accel) {
         if (m_props.modeFull () != m_props.modeFullPunct ()) {
             m_props.toggleModeFull ();
             m_prev_pressed_key = keyval;
@@ -232,7 +337,7 @@ PinyinEngine::processAccelKeyEvent (guint keyval, guint keycode,
     }
 
     /* Toggle simp/trad Chinese Mode */
-    if (PinyinConfig::instance ().tradSwitch () == accel) {
+    if (config.tradSwitchKey () == accel) {
         m_props.toggleModeSimp ();
         m_prev_pressed_key = keyval;
         return TRUE;
@@ -261,19 +366,20 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
         if (m_input_mode == MODE_SUGGESTION) {
             /* only accept input to select candidate. */
             if (IBUS_Escape == keyval) {
-                m_editors[m_input_mode]->reset ();
+                getEditor (m_input_mode)->reset ();
                 m_input_mode = MODE_INIT;
-                m_editors[m_input_mode]->reset ();
+                getEditor (m_input_mode)->reset ();
                 /* m_editors[m_input_mode]->update ();*/
                 return TRUE;
             }
 
-            retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
+            Stats::add (STATS_KEYS_SUGGESTION);
+            retval = getEditor (m_input_mode)->processKeyEvent (keyval, keycode, modifiers);
 
             if (retval) {
                 goto out;
             } else {
-                m_editors[m_input_mode]->reset ();
+                getEditor (m_input_mode)->reset ();
                 m_input_mode = MODE_INIT;
             }
         }
@@ -335,10 +441,12 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
                 /* TODO: Unknown */
             }
         }
-        retval = m_editors[m_input_mode]->processKeyEvent (keyval, keycode, modifiers);
+        /* the keys counters are in the order of the modes. */
+        Stats::add ((StatsCounter) (STATS_KEYS_INIT + m_input_mode));
+        retval = getEditor (m_input_mode)->processKeyEvent (keyval, keycode, modifiers);
         if (G_UNLIKELY (retval &&
                         m_input_mode != MODE_INIT &&
-                        m_editors[m_input_mode]->text ().empty ()))
+                        getEditor (m_input_mode)->text ().empty ()))
             m_input_mode = MODE_INIT;
     }
 
@@ -346,9 +454,13 @@ PinyinEngine::processKeyEvent (guint keyval, guint keycode, guint modifiers)
         retval = m_fallback_editor->processKeyEvent (keyval, keycode, modifiers);
 
 out:
-    /* needed for SuggestionEditor */
+    /* needed for SuggestionEditor, predict after the commit is sent. */
     if (m_need_update) {
-        m_editors[m_input_mode]->update ();
+        if (m_input_mode == MODE_SUGGESTION)
+            static_cast<SuggestionEditor *> (getEditor (m_input_mode).get ())
+                ->updateDeferred ();
+        else
+            getEditor (m_input_mode)->update ();
         m_need_update = FALSE;
     }
     /* store ignored key event by editors */
@@ -360,31 +472,22 @@ out:
 void
 PinyinEngine::focusIn (void)
 {
-    /* TODO: check memory leak here,
-     *       or switch full/double pinyin when pinyin config is changed.*/
-    if (PinyinConfig::instance ().doublePinyin ()) {
-        if (!m_double_pinyin) {
-            DoublePinyinEditor *editor = new DoublePinyinEditor
-                (m_props, PinyinConfig::instance ());
-            m_editors[MODE_INIT].reset (editor);
-#ifdef IBUS_BUILD_LUA_EXTENSION
-            editor->setLuaPlugin (m_lua_plugin);
-#endif
-            connectEditorSignals (m_editors[MODE_INIT]);
-        }
-        m_double_pinyin = TRUE;
+    /* switch full/double pinyin when pinyin config is changed,
+       the editor of the other scheme holds no instance after focus out. */
+    gboolean double_pinyin = PinyinConfig::instance ().doublePinyin ();
+    if (double_pinyin != m_double_pinyin) {
+        m_editors[MODE_INIT] = getPinyinEditor (double_pinyin);
+        m_double_pinyin = double_pinyin;
     }
-    else {
-        if (m_double_pinyin) {
-            FullPinyinEditor *editor = new FullPinyinEditor
-                (m_props, PinyinConfig::instance ());
-            m_editors[MODE_INIT].reset (editor);
+
 #ifdef IBUS_BUILD_LUA_EXTENSION
-            editor->setLuaPlugin (m_lua_plugin);
+    /* follow the changed opencc profile. */
+    lua_update_simp_trad ();
 #endif
-            connectEditorSignals (m_editors[MODE_INIT]);
-        }
-        m_double_pinyin = FALSE;
+
+    for (gint i = 0; i < MODE_LAST; i++) {
+        if (m_editors[i])
+            m_editors[i]->focusIn ();
     }
 
     registerProperties (m_props.properties ());
@@ -396,6 +499,17 @@ PinyinEngine::focusOut (void)
     Engine::focusOut ();
 
     reset ();
+
+    /* return the libpinyin instances. */
+    for (gint i = 0; i < MODE_LAST; i++) {
+        if (m_editors[i])
+            m_editors[i]->focusOut ();
+    }
+
+    /* sync the trainings, the user databases are saved by the timer,
+       unless they are overdue. */
+    LibPinyinBackEnd::instance ().flush ();
+    Persistence::flushDue ();
 }
 
 void
@@ -404,7 +518,8 @@ PinyinEngine::reset (void)
     m_prev_pressed_key = IBUS_VoidSymbol;
     m_input_mode = MODE_INIT;
     for (gint i = 0; i < MODE_LAST; i++) {
-        m_editors[i]->reset ();
+        if (m_editors[i])
+            m_editors[i]->reset ();
     }
     m_fallback_editor->reset ();
 }
@@ -423,25 +538,25 @@ PinyinEngine::disable (void)
 void
 PinyinEngine::pageUp (void)
 {
-    m_editors[m_input_mode]->pageUp ();
+    getEditor (m_input_mode)->pageUp ();
 }
 
 void
 PinyinEngine::pageDown (void)
 {
-    m_editors[m_input_mode]->pageDown ();
+    getEditor (m_input_mode)->pageDown ();
 }
 
 void
 PinyinEngine::cursorUp (void)
 {
-    m_editors[m_input_mode]->cursorUp ();
+    getEditor (m_input_mode)->cursorUp ();
 }
 
 void
 PinyinEngine::cursorDown (void)
 {
-    m_editors[m_input_mode]->cursorDown ();
+    getEditor (m_input_mode)->cursorDown ();
 }
 
 inline void
@@ -468,7 +583,7 @@ PinyinEngine::propertyActivate (const char *prop_name, guint prop_state)
 void
 PinyinEngine::candidateClicked (guint index, guint button, guint state)
 {
-    m_editors[m_input_mode]->candidateClicked (index, button, state);
+    getEditor (m_input_mode)->candidateClicked (index, button, state);
 }
 
 void
@@ -480,7 +595,7 @@ PinyinEngine::commitText (Text & text)
         m_input_mode = MODE_INIT;
     } else if (PinyinConfig::instance ().showSuggestion ()) {
         m_input_mode = MODE_SUGGESTION;
-        m_editors[m_input_mode]->setText (text.text (), 0);
+        getEditor (m_input_mode)->setText (text.text (), 0);
         m_need_update = TRUE;
     } else {
         m_input_mode = MODE_INIT;
@@ -498,29 +613,6 @@ PinyinEngine::commitText (Text & text)
 void
 PinyinEngine::connectEditorSignals (EditorPtr editor)
 {
-    editor->signalCommitText ().connect (
-        std::bind (&PinyinEngine::commitText, this, _1));
-
-    editor->signalUpdatePreeditText ().connect (
-        std::bind (&PinyinEngine::updatePreeditText, this, _1, _2, _3));
-    editor->signalShowPreeditText ().connect (
-        std::bind (&PinyinEngine::showPreeditText, this));
-    editor->signalHidePreeditText ().connect (
-        std::bind (&PinyinEngine::hidePreeditText, this));
-
-    editor->signalUpdateAuxiliaryText ().connect (
-        std::bind (&PinyinEngine::updateAuxiliaryText, this, _1, _2));
-    editor->signalShowAuxiliaryText ().connect (
-        std::bind (&PinyinEngine::showAuxiliaryText, this));
-    editor->signalHideAuxiliaryText ().connect (
-        std::bind (&PinyinEngine::hideAuxiliaryText, this));
-
-    editor->signalUpdateLookupTable ().connect (
-        std::bind (&PinyinEngine::updateLookupTable, this, _1, _2));
-    editor->signalUpdateLookupTableFast ().connect (
-        std::bind (&PinyinEngine::updateLookupTableFast, this, _1, _2));
-    editor->signalShowLookupTable ().connect (
-        std::bind (&PinyinEngine::showLookupTable, this));
-    editor->signalHideLookupTable ().connect (
-        std::bind (&PinyinEngine::hideLookupTable, this));
+    /* the updates are called directly, not through the signals. */
+    editor->setSink (this);
 }
@@ -49,6 +49,7 @@ public:
     void cursorDown (void);
     gboolean propertyActivate (const gchar *prop_name, guint prop_state);
     void candidateClicked (guint index, guint button, guint state);
+    gint inputMode (void) const { return m_input_mode; }
 
 private:
 #ifdef IBUS_BUILD_LUA_EXTENSION
@@ -60,6 +61,8 @@ private:
 
     void showSetupDialog (void);
     void connectEditorSignals (EditorPtr editor);
+    EditorPtr & getEditor (gint mode);
+    EditorPtr & getPinyinEditor (gboolean double_pinyin);
 
     void commitText (Text & text);
 
@@ -86,6 +89,10 @@ private:
     EditorPtr m_editors[MODE_LAST];
     EditorPtr m_fallback_editor;
 
+    /* the editors of MODE_INIT for both schemes. */
+    EditorPtr m_full_pinyin_editor;
+    EditorPtr m_double_pinyin_editor;
+
 #ifdef IBUS_BUILD_LUA_EXTENSION
     Pointer<IBusEnginePlugin> m_lua_plugin;
 #endif
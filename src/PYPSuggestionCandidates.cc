@@ -22,18 +22,53 @@
 #include <assert.h>
 #include <pinyin.h>
 #include "PYPSuggestionEditor.h"
+#include "PYLibPinyin.h"
 
 using namespace PY;
 
-gboolean
-SuggestionCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+/* the longest phrase used by libpinyin to predict. */
+#define PREDICTION_PREFIX_LEN 16
+#define PREDICTION_CACHE_SIZE 64
+
+/* the modified serial is only valid in this process, the snapshot is
+   dropped when the user dictionary is changed, see snapshotFingerprint. */
+BoundedCache<SuggestionCandidates::Phrases>
+SuggestionCandidates::m_cache (PREDICTION_CACHE_SIZE,
+                               STATS_SUGGESTION_CACHE_HITS,
+                               "suggestion", TRUE);
+
+void
+SuggestionCandidates::predict (const gchar *prefix)
 {
     pinyin_instance_t *instance = m_editor->m_instance;
 
-    guint len = 0;
-    pinyin_get_n_candidate (instance, &len);
+    m_phrases.clear ();
+    m_guessed = FALSE;
+    if (G_UNLIKELY (NULL == instance))
+        return;
+
+    /* only the tail of the prefix is used by the prediction. */
+    glong len = g_utf8_strlen (prefix, -1);
+    if (len > PREDICTION_PREFIX_LEN)
+        prefix = g_utf8_offset_to_pointer
+            (prefix, len - PREDICTION_PREFIX_LEN);
+    m_prefix = prefix;
+
+    gchar tag[16];
+    g_snprintf (tag, sizeof (tag), "%u",
+                LibPinyinBackEnd::instance ().modifiedSerial ());
+    m_cache.setTag (tag);
+
+    if (m_cache.lookup (m_prefix, m_phrases))
+        return;
+
+    pinyin_guess_predicted_candidates (instance, m_prefix.c_str ());
+    m_guessed = TRUE;
 
-    for (guint i = 0; i < len; i++) {
+    guint n = 0;
+    pinyin_get_n_candidate (instance, &n);
+
+    for (guint i = 0; i < n; i++) {
         lookup_candidate_t * candidate = NULL;
         pinyin_get_candidate (instance, i, &candidate);
 
@@ -43,11 +78,20 @@ SuggestionCandidates::processCandidates (std::vector<EnhancedCandidate> & candid
 
         const gchar * phrase_string = NULL;
         pinyin_get_candidate_string (instance, candidate, &phrase_string);
+        m_phrases.push_back (phrase_string);
+    }
 
+    m_cache.insert (m_prefix, m_phrases);
+}
+
+gboolean
+SuggestionCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+{
+    for (guint i = 0; i < m_phrases.size (); i++) {
         EnhancedCandidate enhanced;
         enhanced.m_candidate_type = CANDIDATE_SUGGESTION;
         enhanced.m_candidate_id = i;
-        enhanced.m_display_string = phrase_string;
+        enhanced.m_display_string = m_phrases[i];
 
         candidates.push_back (enhanced);
     }
@@ -61,6 +105,12 @@ SuggestionCandidates::selectCandidate (EnhancedCandidate & enhanced)
     pinyin_instance_t * instance = m_editor->m_instance;
     assert (CANDIDATE_SUGGESTION == enhanced.m_candidate_type);
 
+    /* the phrases are cached, the same order as the guess. */
+    if (!m_guessed) {
+        pinyin_guess_predicted_candidates (instance, m_prefix.c_str ());
+        m_guessed = TRUE;
+    }
+
     guint len = 0;
     pinyin_get_n_candidate (instance, &len);
 
@@ -70,6 +120,7 @@ SuggestionCandidates::selectCandidate (EnhancedCandidate & enhanced)
     lookup_candidate_t * candidate = NULL;
     pinyin_get_candidate (instance, enhanced.m_candidate_id, &candidate);
     pinyin_choose_predicted_candidate (instance, candidate);
+    LibPinyinBackEnd::instance ().modified (instance);
 
     return SELECT_CANDIDATE_COMMIT;
 }
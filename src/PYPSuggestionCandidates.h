@@ -21,7 +21,10 @@
 #ifndef __PY_LIB_PINYIN_SUGGESTION_CANDIDATES_H_
 #define __PY_LIB_PINYIN_SUGGESTION_CANDIDATES_H_
 
+#include <string>
+#include <vector>
 #include "PYPEnhancedCandidates.h"
+#include "PYConversionCache.h"
 
 namespace PY {
 
@@ -31,12 +34,33 @@ class SuggestionCandidates : public EnhancedCandidates<SuggestionEditor> {
 public:
     SuggestionCandidates (SuggestionEditor *editor) {
         m_editor = editor;
+        m_guessed = FALSE;
     }
 
 public:
+    /* predict the phrases after the prefix. */
+    void predict (const gchar *prefix);
+
     gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
 
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_SUGGESTION == type;
+    }
+
     int selectCandidate (EnhancedCandidate & enhanced);
+
+private:
+    typedef std::vector<std::string> Phrases;
+
+    /* the predicted phrases of the prefix, when cached the
+       guess in libpinyin is deferred until one is selected. */
+    std::string m_prefix;
+    Phrases m_phrases;
+    gboolean m_guessed;
+
+    /* keyed by the tail of the prefix, cleared on training. */
+    static BoundedCache<Phrases> m_cache;
 };
 
 };
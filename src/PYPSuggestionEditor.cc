@@ -34,18 +34,30 @@ SuggestionEditor::SuggestionEditor (PinyinProperties &props,
       m_lua_trigger_candidates (this),
       m_lua_converter_candidates (this),
 #endif
-      m_traditional_candidates (this, config)
+      m_traditional_candidates (this, config),
+      m_pipeline (m_suggestion_candidates,
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                  m_lua_trigger_candidates,
+                  m_lua_converter_candidates,
+#endif
+                  m_traditional_candidates)
 {
     /* use m_text to store the prefix string. */
     m_text = "";
     m_cursor = 0;
 
-    m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
+    /* checked out from LibPinyinBackEnd when focused. */
+    m_instance = NULL;
+
+    m_update_source = 0;
 }
 
 SuggestionEditor::~SuggestionEditor (void)
 {
-    LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
+    cancelUpdate ();
+
+    if (m_instance)
+        LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
     m_instance = NULL;
 }
 
@@ -76,6 +88,17 @@ SuggestionEditor::processKeyEvent (guint keyval, guint keycode, guint modifiers)
     if (keyval == IBUS_Return)
         return FALSE;
 
+    // the prediction is pending, drop it when the user keeps typing.
+    if (G_UNLIKELY (m_update_source)) {
+        if ((keyval >= IBUS_a && keyval <= IBUS_z) ||
+            (keyval >= IBUS_A && keyval <= IBUS_Z)) {
+            cancelUpdate ();
+            return FALSE;
+        }
+        cancelUpdate ();
+        update ();
+    }
+
     // no suggestion candidates.
     if (m_lookup_table.size () == 0)
         return FALSE;
@@ -255,10 +278,29 @@ SuggestionEditor::cursorDown (void)
     }
 }
 
+void
+SuggestionEditor::focusIn (void)
+{
+    if (m_instance == NULL &&
+        LibPinyinBackEnd::instance ().waitPinyinContext (0))
+        m_instance = LibPinyinBackEnd::instance ().allocPinyinInstance ();
+}
+
+void
+SuggestionEditor::focusOut (void)
+{
+    reset ();
+
+    LibPinyinBackEnd::instance ().freePinyinInstance (m_instance);
+    m_instance = NULL;
+}
+
 void
 SuggestionEditor::update (void)
 {
-    pinyin_guess_predicted_candidates (m_instance, m_text);
+    focusIn ();
+
+    m_suggestion_candidates.predict (m_text);
 
     updateLookupTable ();
     updatePreeditText ();
@@ -268,10 +310,38 @@ SuggestionEditor::update (void)
 void
 SuggestionEditor::reset (void)
 {
+    cancelUpdate ();
     m_text = "";
     update ();
 }
 
+void
+SuggestionEditor::updateDeferred (void)
+{
+    cancelUpdate ();
+    m_update_source = g_idle_add (SuggestionEditor::updateCallback,
+                                  static_cast<gpointer> (this));
+}
+
+void
+SuggestionEditor::cancelUpdate (void)
+{
+    if (m_update_source) {
+        g_source_remove (m_update_source);
+        m_update_source = 0;
+    }
+}
+
+gboolean
+SuggestionEditor::updateCallback (gpointer data)
+{
+    SuggestionEditor *self = static_cast<SuggestionEditor *> (data);
+
+    self->m_update_source = 0;
+    self->update ();
+    return FALSE;
+}
+
 void
 SuggestionEditor::updateLookupTableFast (void)
 {
@@ -309,12 +379,11 @@ SuggestionEditor::updateCandidates (void)
 #ifdef IBUS_BUILD_LUA_EXTENSION
     m_lua_trigger_candidates.processCandidates (m_candidates);
 
-    std::string converter = m_config.luaConverter ();
+    const std::string & converter = m_config.luaConverter ();
 
-    if (!converter.empty ()) {
-        m_lua_converter_candidates.setConverter (converter.c_str ());
+    m_lua_converter_candidates.setConverter (converter.c_str ());
+    if (m_lua_converter_candidates.active ())
         m_lua_converter_candidates.processCandidates (m_candidates);
-    }
 #endif
 
     return TRUE;
@@ -340,24 +409,7 @@ SuggestionEditor::fillLookupTable ()
 int
 SuggestionEditor::selectCandidateInternal (EnhancedCandidate & candidate)
 {
-    switch (candidate.m_candidate_type) {
-    case CANDIDATE_SUGGESTION:
-        return m_suggestion_candidates.selectCandidate (candidate);
-
-    case CANDIDATE_TRADITIONAL_CHINESE:
-        return m_traditional_candidates.selectCandidate (candidate);
-
-#ifdef IBUS_BUILD_LUA_EXTENSION
-    case CANDIDATE_LUA_TRIGGER:
-        return m_lua_trigger_candidates.selectCandidate (candidate);
-
-    case CANDIDATE_LUA_CONVERTER:
-        return m_lua_converter_candidates.selectCandidate (candidate);
-#endif
-
-    default:
-        assert (FALSE);
-    }
+    return m_pipeline.selectCandidate (candidate);
 }
 
 void
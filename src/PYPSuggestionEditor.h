@@ -50,11 +50,16 @@ public:
     virtual void update (void);
     virtual void reset (void);
     virtual void candidateClicked (guint index, guint button, guint state);
+    virtual void focusIn (void);
+    virtual void focusOut (void);
 
 #ifdef IBUS_BUILD_LUA_EXTENSION
     gboolean setLuaPlugin (IBusEnginePlugin *plugin);
 #endif
 
+    /* predict in idle, cancelled when the user keeps typing. */
+    void updateDeferred (void);
+
 protected:
     virtual int selectCandidateInternal (EnhancedCandidate & candidate);
 
@@ -73,6 +78,9 @@ private:
     gboolean processLabelKey (guint keyval);
     gboolean processPageKey (guint keyval);
 
+    void cancelUpdate (void);
+    static gboolean updateCallback (gpointer data);
+
 private:
     /* variables */
     LookupTable m_lookup_table;
@@ -83,6 +91,9 @@ private:
     /* use LibPinyinBackEnd here. */
     pinyin_instance_t           *m_instance;
 
+    /* the pending prediction. */
+    guint                       m_update_source;
+
     /* use EnhancedCandidates here. */
     std::vector<EnhancedCandidate> m_candidates;
 
@@ -95,6 +106,15 @@ private:
 #endif
 
     TraditionalCandidates m_traditional_candidates;
+
+    /* select the candidates by their types. */
+    typedef CandidatePipeline<SuggestionCandidates,
+#ifdef IBUS_BUILD_LUA_EXTENSION
+                              LuaTriggerCandidates,
+                              LuaConverterCandidates,
+#endif
+                              TraditionalCandidates> Pipeline;
+    Pipeline m_pipeline;
 };
 
 };
@@ -22,31 +22,110 @@
 #include <assert.h>
 #include "PYString.h"
 #include "PYPPhoneticEditor.h"
+#include "PYStageExecutor.h"
+#include "PYTrace.h"
 
 using namespace PY;
 
-gboolean
-TraditionalCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates)
+#define CONVERSION_CACHE_SIZE 1024
+
+/* the candidates converted by one thread at a time. */
+#define CONVERSION_CHUNK_SIZE 16
+
+/* the threads only pay off for many misses, such as the pages
+   prefetched after the opencc profile is changed. */
+#define CONVERSION_PARALLEL_THRESHOLD (4 * CONVERSION_CHUNK_SIZE)
+
+/* tagged by the opencc config, saved in the cache snapshot. */
+ConversionCache TraditionalCandidates::m_cache (CONVERSION_CACHE_SIZE,
+                                                STATS_TRADITIONAL_CACHE_HITS,
+                                                "traditional");
+
+void
+TraditionalCandidates::convert (const std::string & in, std::string & out)
 {
-    m_candidates.clear ();
+    m_cache.setTag (m_config.openccConfig ());
+    if (m_cache.lookup (in, out))
+        return;
 
     String trad;
-    for (guint i = 0; i < candidates.size (); i++) {
+    m_converter.simpToTrad (in.c_str (), trad);
+    m_cache.insert (in, trad);
+    out = trad;
+}
+
+gboolean
+TraditionalCandidates::processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                          guint begin)
+{
+    if (0 == begin)
+        m_candidates.clear ();
+    assert (m_candidates.size () == begin);
+
+    m_cache.setTag (m_config.openccConfig ());
+    m_misses.clear ();
+
+    for (guint i = begin; i < candidates.size (); i++) {
         EnhancedCandidate & enhanced = candidates[i];
 
-        m_candidates.push_back (enhanced);
+        m_candidates.push_back (CandidateReference (enhanced));
 
         enhanced.m_candidate_type = CANDIDATE_TRADITIONAL_CHINESE;
         enhanced.m_candidate_id = i;
 
-        trad.truncate (0);
-        m_converter.simpToTrad (enhanced.m_display_string.c_str (), trad);
-        enhanced.m_display_string = trad;
+        /* converted in place. */
+        if (!m_cache.lookup (enhanced.m_display_string,
+                             enhanced.m_display_string))
+            m_misses.push_back (i);
+    }
+
+    /* the conversion is pure, convert the misses in parallel,
+       then update the cache in the order of the candidates. */
+    if (m_conversions.size () < m_misses.size ())
+        m_conversions.resize (m_misses.size ());
+    m_converted = &candidates;
+    m_handle = m_converter.acquire ();
+    if (m_misses.size () < CONVERSION_PARALLEL_THRESHOLD)
+        convertChunk (0, m_misses.size (), this);
+    else
+        StageExecutor::run (m_misses.size (), CONVERSION_CHUNK_SIZE,
+                            TraditionalCandidates::convertChunk, this);
+    m_converted = NULL;
+
+    for (guint i = 0; i < m_misses.size (); i++) {
+        std::string & display = candidates[m_misses[i]].m_display_string;
+        m_cache.insert (display, m_conversions[i]);
+        display.swap (m_conversions[i]);
     }
 
     return TRUE;
 }
 
+gboolean
+TraditionalCandidates::convertCandidates (CandidateContext & context)
+{
+    if (context.m_simp)
+        return FALSE;
+
+    TraceScope trace (TRACE_TRADITIONAL_CANDIDATES);
+    return processCandidates (context.m_candidates, context.m_begin);
+}
+
+void
+TraditionalCandidates::convertChunk (guint begin, guint end, gpointer data)
+{
+    TraditionalCandidates *self = static_cast<TraditionalCandidates *> (data);
+    std::vector<EnhancedCandidate> & candidates = *self->m_converted;
+
+    for (guint i = begin; i < end; i++) {
+        String & trad = self->m_conversions[i];
+        trad.clear ();
+        SimpTradConverter::simpToTrad
+            (self->m_handle,
+             candidates[self->m_misses[i]].m_display_string.c_str (), trad);
+    }
+}
+
 int
 TraditionalCandidates::selectCandidate (EnhancedCandidate & enhanced)
 {
@@ -56,13 +135,11 @@ TraditionalCandidates::selectCandidate (EnhancedCandidate & enhanced)
     if (G_UNLIKELY (id >= m_candidates.size ()))
         return SELECT_CANDIDATE_ALREADY_HANDLED;
 
-    int action = m_editor->selectCandidateInternal (m_candidates[id]);
+    EnhancedCandidate candidate = m_candidates[id].candidate ();
+    int action = m_editor->selectCandidateInternal (candidate);
 
     if (action & SELECT_CANDIDATE_MODIFY_IN_PLACE) {
-        String trad;
-        m_converter.simpToTrad
-            (m_candidates[id].m_display_string.c_str (), trad);
-        enhanced.m_display_string = trad;
+        convert (candidate.m_display_string, enhanced.m_display_string);
     }
 
     return action;
@@ -77,5 +154,6 @@ TraditionalCandidates::removeCandidate (EnhancedCandidate & enhanced)
     if (G_UNLIKELY (id >= m_candidates.size ()))
         return FALSE;
 
-    return m_editor->removeCandidateInternal (m_candidates[id]);
+    EnhancedCandidate candidate = m_candidates[id].candidate ();
+    return m_editor->removeCandidateInternal (candidate);
 }
@@ -25,6 +25,7 @@
 #include "PYPEnhancedCandidates.h"
 #include "PYConfig.h"
 #include "PYSimpTradConverter.h"
+#include "PYConversionCache.h"
 
 namespace PY {
 
@@ -32,19 +33,43 @@ class Editor;
 
 class TraditionalCandidates : public EnhancedCandidates<Editor> {
 public:
-    TraditionalCandidates (Editor *editor, Config & config) : m_converter(config) {
+    TraditionalCandidates (Editor *editor, Config & config) :
+        m_converter(config), m_config(config), m_converted(NULL),
+        m_handle(NULL) {
         m_editor = editor;
     }
 
 public:
-    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates);
+    /* convert the candidates from begin, which are appended since last call. */
+    gboolean processCandidates (std::vector<EnhancedCandidate> & candidates,
+                                guint begin = 0);
+    gboolean convertCandidates (CandidateContext & context);
+
+    static gboolean handles (CandidateType type)
+    {
+        return CANDIDATE_TRADITIONAL_CHINESE == type;
+    }
 
     int selectCandidate (EnhancedCandidate & enhanced);
     gboolean removeCandidate (EnhancedCandidate & enhanced);
 
 protected:
-    std::vector<EnhancedCandidate> m_candidates;
+    void convert (const std::string & in, std::string & out);
+    static void convertChunk (guint begin, guint end, gpointer data);
+
+    std::vector<CandidateReference> m_candidates;
     SimpTradConverter m_converter;
+    Config & m_config;
+
+    /* the indices of the candidates missed in the cache. */
+    std::vector<guint> m_misses;
+    std::vector<String> m_conversions;
+    std::vector<EnhancedCandidate> *m_converted;
+    /* the converter resolved on the calling thread. */
+    gpointer m_handle;
+
+    /* shared by all editors. */
+    static ConversionCache m_cache;
 };
 
 };
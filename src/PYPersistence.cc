@@ -0,0 +1,173 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPersistence.h"
+#include "PYStats.h"
+
+namespace PY {
+
+/* the stores due in 30 seconds are saved in the same wakeup. */
+#define PERSISTENCE_COALESCE_TIME (30)
+
+Persistence::Store Persistence::m_stores[STORE_LAST];
+guint Persistence::m_timeout_id = 0;
+gint64 Persistence::m_deadline = 0;
+
+void
+Persistence::add (PersistentStore store, guint delay,
+                  SaveFunc func, gpointer data)
+{
+    Store & entry = m_stores[store];
+    entry.delay = delay;
+    entry.func = func;
+    entry.data = data;
+    entry.first = entry.last = 0;
+}
+
+void
+Persistence::remove (PersistentStore store, gpointer data)
+{
+    Store & entry = m_stores[store];
+    if (entry.data != data)
+        return;
+
+    entry.func = NULL;
+    entry.data = NULL;
+    entry.first = entry.last = 0;
+    schedule ();
+}
+
+void
+Persistence::modified (PersistentStore store)
+{
+    Store & entry = m_stores[store];
+    if (G_UNLIKELY (NULL == entry.func))
+        return;
+
+    entry.last = g_get_monotonic_time ();
+    if (0 == entry.first)
+        entry.first = entry.last;
+    schedule ();
+}
+
+void
+Persistence::flush (void)
+{
+    for (guint i = 0; i < STORE_LAST; i++)
+        flush ((PersistentStore) i);
+}
+
+void
+Persistence::flush (PersistentStore store)
+{
+    if (isModified (store)) {
+        save (store);
+        schedule ();
+    }
+}
+
+void
+Persistence::flushDue (void)
+{
+    gint64 now = g_get_monotonic_time ();
+    gboolean saved = FALSE;
+    for (guint i = 0; i < STORE_LAST; i++) {
+        if (isModified ((PersistentStore) i) && deadline (m_stores[i]) <= now) {
+            save ((PersistentStore) i);
+            saved = TRUE;
+        }
+    }
+
+    if (saved)
+        schedule ();
+}
+
+gint64
+Persistence::deadline (const Store & store)
+{
+    return MIN (store.last + (gint64) store.delay * G_USEC_PER_SEC,
+                store.first + (gint64) PERSISTENCE_MAX_DELAY * G_USEC_PER_SEC);
+}
+
+void
+Persistence::save (PersistentStore store)
+{
+    Store & entry = m_stores[store];
+    gint64 first = entry.first;
+
+    /* the store may be modified again by the save. */
+    entry.first = entry.last = 0;
+    if (entry.func (entry.data))
+        return;
+
+    entry.last = g_get_monotonic_time ();
+    entry.first = first;
+}
+
+/* the timer is moved when the nearest deadline is changed, so the
+   typing only moves the timer without waking up the process. */
+void
+Persistence::schedule (void)
+{
+    gint64 nearest = G_MAXINT64;
+    for (guint i = 0; i < STORE_LAST; i++) {
+        if (isModified ((PersistentStore) i))
+            nearest = MIN (nearest, deadline (m_stores[i]));
+    }
+
+    if (m_timeout_id != 0) {
+        /* the later changes are saved in the coalesced wakeup. */
+        if (nearest >= m_deadline && nearest < m_deadline +
+            (gint64) PERSISTENCE_COALESCE_TIME * G_USEC_PER_SEC)
+            return;
+        g_source_remove (m_timeout_id);
+        m_timeout_id = 0;
+    }
+
+    if (G_MAXINT64 == nearest)
+        return;
+
+    gint64 now = g_get_monotonic_time ();
+    guint seconds = nearest > now ?
+        (nearest - now + G_USEC_PER_SEC - 1) / G_USEC_PER_SEC : 0;
+
+    m_deadline = nearest;
+    m_timeout_id = g_timeout_add_seconds (seconds,
+                                          Persistence::timeoutCallback, NULL);
+}
+
+gboolean
+Persistence::timeoutCallback (gpointer data)
+{
+    m_timeout_id = 0;
+    Stats::add (STATS_PERSISTENCE_WAKEUPS);
+
+    gint64 due = g_get_monotonic_time () +
+        (gint64) PERSISTENCE_COALESCE_TIME * G_USEC_PER_SEC;
+    for (guint i = 0; i < STORE_LAST; i++) {
+        if (isModified ((PersistentStore) i) && deadline (m_stores[i]) <= due)
+            save ((PersistentStore) i);
+    }
+
+    schedule ();
+    return FALSE;
+}
+
+};
@@ -0,0 +1,90 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_PERSISTENCE_H_
+#define __PY_PERSISTENCE_H_
+
+#include <glib.h>
+
+namespace PY {
+
+/* save the modified stores at most 15 minutes after the first change. */
+#define PERSISTENCE_MAX_DELAY (15 * 60)
+
+/* the stores saved by the scheduler. */
+enum PersistentStore {
+    STORE_PINYIN_CONTEXT = 0,
+    STORE_CHEWING_CONTEXT,
+    STORE_ENGLISH_USER_DB,
+    STORE_LAST
+};
+
+/* Save the modified stores with one wakeup at the nearest deadline,
+ * instead of a polling timer per store. A store is saved after it is
+ * not modified for its delay, at most PERSISTENCE_MAX_DELAY after the
+ * first modification, the stores due soon are saved in the same
+ * wakeup. On focus out only the overdue stores are saved, all the
+ * modified stores are saved when the engine is destroyed or exits. */
+class Persistence {
+public:
+    /* returns FALSE to retry after the delay. */
+    typedef gboolean (* SaveFunc) (gpointer data);
+
+    static void add (PersistentStore store, guint delay,
+                     SaveFunc func, gpointer data);
+    /* only removed by the owner added it, the modifications are dropped,
+       the owner saves them. */
+    static void remove (PersistentStore store, gpointer data);
+
+    static void modified (PersistentStore store);
+    static gboolean isModified (PersistentStore store)
+    {
+        return m_stores[store].first != 0;
+    }
+
+    /* save the modified stores now. */
+    static void flush (void);
+    static void flush (PersistentStore store);
+    /* save the stores past their deadlines, the timer may be late. */
+    static void flushDue (void);
+
+private:
+    struct Store {
+        guint delay;
+        SaveFunc func;
+        gpointer data;
+        /* the times of the first and the last modifications. */
+        gint64 first;
+        gint64 last;
+    };
+
+    static gint64 deadline (const Store & store);
+    static void save (PersistentStore store);
+    static void schedule (void);
+    static gboolean timeoutCallback (gpointer data);
+
+    static Store m_stores[STORE_LAST];
+    static guint m_timeout_id;
+    static gint64 m_deadline;
+};
+
+};
+
+#endif
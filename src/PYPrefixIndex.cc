@@ -0,0 +1,243 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYPrefixIndex.h"
+#include <string.h>
+
+namespace PY {
+
+#define PREFIX_INDEX_MAGIC "PYPFIDX1"
+
+/* All integers are stored in little endian, see data/prefix-index.py. */
+struct PrefixIndex::Header {
+    gchar magic[8];
+    guint32 n_words;
+    guint32 n_nodes;
+    guint32 n_items;
+    guint32 words_offset;
+    guint32 nodes_offset;
+    guint32 items_offset;
+    guint32 strings_offset;
+};
+
+struct PrefixIndex::WordEntry {
+    guint32 string_offset;
+    guint32 value;
+};
+
+struct PrefixIndex::Node {
+    guint32 ch;
+    guint32 first_child;
+    guint32 n_children;
+    guint32 items_begin;
+    guint32 n_items;
+};
+
+static inline gfloat
+le_to_float (guint32 value)
+{
+    union {
+        guint32 i;
+        gfloat f;
+    } u;
+    u.i = GUINT32_FROM_LE (value);
+    return u.f;
+}
+
+PrefixIndex::PrefixIndex ()
+    : m_file (NULL),
+      m_data (NULL),
+      m_length (0),
+      m_header (NULL),
+      m_words (NULL),
+      m_nodes (NULL),
+      m_items (NULL),
+      m_strings (NULL)
+{
+}
+
+PrefixIndex::~PrefixIndex ()
+{
+    unload ();
+}
+
+void
+PrefixIndex::unload (void)
+{
+    if (m_file)
+        g_mapped_file_unref (m_file);
+    m_file = NULL;
+    m_data = NULL;
+    m_length = 0;
+    m_header = NULL;
+    m_words = NULL;
+    m_nodes = NULL;
+    m_items = NULL;
+    m_strings = NULL;
+}
+
+gboolean
+PrefixIndex::load (const char *filename)
+{
+    unload ();
+
+    if (!g_file_test (filename, G_FILE_TEST_IS_REGULAR))
+        return FALSE;
+
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, NULL);
+    if (file == NULL)
+        return FALSE;
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize length = g_mapped_file_get_length (file);
+    const Header *header = (const Header *) data;
+
+    do {
+        if (length < sizeof (Header))
+            break;
+        if (memcmp (header->magic, PREFIX_INDEX_MAGIC, sizeof (header->magic)))
+            break;
+
+        guint32 n_words = GUINT32_FROM_LE (header->n_words);
+        guint32 n_nodes = GUINT32_FROM_LE (header->n_nodes);
+        guint32 n_items = GUINT32_FROM_LE (header->n_items);
+        guint32 words_offset = GUINT32_FROM_LE (header->words_offset);
+        guint32 nodes_offset = GUINT32_FROM_LE (header->nodes_offset);
+        guint32 items_offset = GUINT32_FROM_LE (header->items_offset);
+        guint32 strings_offset = GUINT32_FROM_LE (header->strings_offset);
+
+        /* check the sections are inside of the file, in order. */
+        if (n_nodes == 0)
+            break;
+        if (words_offset + (guint64) n_words * sizeof (WordEntry) > nodes_offset)
+            break;
+        if (nodes_offset + (guint64) n_nodes * sizeof (Node) > items_offset)
+            break;
+        if (items_offset + (guint64) n_items * sizeof (guint32) > strings_offset)
+            break;
+        if (strings_offset > length || data[length - 1] != '\0')
+            break;
+
+        m_file = file;
+        m_data = data;
+        m_length = length;
+        m_header = header;
+        m_words = (const WordEntry *) (data + words_offset);
+        m_nodes = (const Node *) (data + nodes_offset);
+        m_items = (const guint32 *) (data + items_offset);
+        m_strings = data + strings_offset;
+        return TRUE;
+    } while (0);
+
+    g_warning ("invalid prefix index: %s.\n", filename);
+    g_mapped_file_unref (file);
+    return FALSE;
+}
+
+const PrefixIndex::Node *
+PrefixIndex::findChild (const Node *node, guint32 ch) const
+{
+    guint32 n_nodes = GUINT32_FROM_LE (m_header->n_nodes);
+    guint32 begin = GUINT32_FROM_LE (node->first_child);
+    guint32 end = begin + GUINT32_FROM_LE (node->n_children);
+
+    if (end > n_nodes)
+        return NULL;
+
+    /* children are sorted by character. */
+    while (begin < end) {
+        guint32 middle = begin + (end - begin) / 2;
+        guint32 value = GUINT32_FROM_LE (m_nodes[middle].ch);
+        if (value == ch)
+            return m_nodes + middle;
+        if (value < ch)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return NULL;
+}
+
+gboolean
+PrefixIndex::lookup (const char *prefix, Range & range) const
+{
+    range.begin = range.end = 0;
+
+    if (!isLoaded ())
+        return FALSE;
+
+    const Node *node = m_nodes;
+    for (const char *p = prefix; *p && node; ++p)
+        node = findChild (node, (guchar) g_ascii_tolower (*p));
+
+    if (node == NULL)
+        return TRUE;
+
+    guint32 begin = GUINT32_FROM_LE (node->items_begin);
+    guint32 end = begin + GUINT32_FROM_LE (node->n_items);
+    if (end > GUINT32_FROM_LE (m_header->n_items))
+        return FALSE;
+
+    range.begin = begin;
+    range.end = end;
+    return TRUE;
+}
+
+gboolean
+PrefixIndex::getWord (const Range & range, guint index, Word & word) const
+{
+    if (index >= range.size ())
+        return FALSE;
+
+    guint32 n_words = GUINT32_FROM_LE (m_header->n_words);
+    guint32 word_index = GUINT32_FROM_LE (m_items[range.begin + index]);
+    if (word_index >= n_words)
+        return FALSE;
+
+    const WordEntry *entry = m_words + word_index;
+    guint32 offset = GUINT32_FROM_LE (entry->string_offset);
+    if (offset >= m_length - (m_strings - m_data))
+        return FALSE;
+
+    word.word = m_strings + offset;
+    word.value = le_to_float (entry->value);
+    return TRUE;
+}
+
+gboolean
+PrefixIndex::listWords (const char *prefix, std::vector<Word> & words) const
+{
+    words.clear ();
+
+    Range range;
+    if (!lookup (prefix, range))
+        return FALSE;
+
+    words.reserve (range.size ());
+    for (guint i = 0; i < range.size (); ++i) {
+        Word word;
+        if (!getWord (range, i, word))
+            return FALSE;
+        words.push_back (word);
+    }
+    return TRUE;
+}
+
+};
@@ -0,0 +1,80 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_PREFIX_INDEX_
+#define __PY_PREFIX_INDEX_
+
+#include <glib.h>
+#include <vector>
+
+namespace PY {
+
+/* Read only prefix index of the English word list or strokes table,
+ * generated by data/prefix-index.py and mapped into memory. */
+class PrefixIndex {
+public:
+    struct Word {
+        const char *word;
+        gfloat value;
+    };
+
+    /* The words of a prefix, in [begin, end) of the items. */
+    struct Range {
+        guint32 begin;
+        guint32 end;
+
+        guint size (void) const { return end - begin; }
+    };
+
+    PrefixIndex ();
+    ~PrefixIndex ();
+
+    gboolean load (const char *filename);
+    gboolean isLoaded (void) const { return m_file != NULL; }
+
+    /* Find the words of the prefix, keys are matched in lower case. */
+    gboolean lookup (const char *prefix, Range & range) const;
+    gboolean getWord (const Range & range, guint index, Word & word) const;
+
+    /* List the words of the prefix in value order. */
+    gboolean listWords (const char *prefix, std::vector<Word> & words) const;
+
+private:
+    struct Header;
+    struct WordEntry;
+    struct Node;
+
+    const Node *findChild (const Node *node, guint32 ch) const;
+    void unload (void);
+
+    GMappedFile *m_file;
+    const gchar *m_data;
+    gsize m_length;
+
+    const Header *m_header;
+    const WordEntry *m_words;
+    const Node *m_nodes;
+    const guint32 *m_items;
+    const gchar *m_strings;
+};
+
+};
+
+#endif
@@ -0,0 +1,201 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+#include "PYPreload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <glib/gstdio.h>
+
+namespace PY {
+
+/* merge the resident pages closer than 16 pages into one range. */
+#define PRELOAD_MERGE_PAGES (16)
+
+guint Preload::m_keys = 0;
+
+static gchar *
+preload_manifest_file (void)
+{
+    return g_build_filename (g_get_user_cache_dir (), "ibus", "libpinyin",
+                             "preload.manifest", NULL);
+}
+
+/* the data files read by the contexts and the editors. */
+static void
+preload_data_files (std::vector<std::string> & files)
+{
+    GDir *dir = g_dir_open (LIBPINYIN_DATADIR, 0, NULL);
+    if (dir) {
+        const gchar *name;
+        while ((name = g_dir_read_name (dir)) != NULL) {
+            gchar *path = g_build_filename (LIBPINYIN_DATADIR, name, NULL);
+            files.push_back (path);
+            g_free (path);
+        }
+        g_dir_close (dir);
+    }
+
+    files.push_back (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "english.db");
+    files.push_back (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "strokes.db");
+    files.push_back (PKGDATADIR G_DIR_SEPARATOR_S "network.txt");
+}
+
+/* append the resident ranges of the file to the manifest, the page
+   cache is shared, so the pages read by others are recorded too. */
+static void
+preload_record_file (const std::string & path, GString *manifest)
+{
+    int fd = g_open (path.c_str (), O_RDONLY, 0);
+    if (fd < 0)
+        return;
+
+    struct stat buf;
+    if (fstat (fd, &buf) != 0 || !S_ISREG (buf.st_mode) || 0 == buf.st_size) {
+        close (fd);
+        return;
+    }
+
+    void *addr = mmap (NULL, buf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close (fd);
+    if (MAP_FAILED == addr)
+        return;
+
+    gsize page = sysconf (_SC_PAGESIZE);
+    gsize pages = (buf.st_size + page - 1) / page;
+    std::vector<unsigned char> resident (pages);
+
+    if (0 == mincore (addr, buf.st_size, &resident[0])) {
+        gsize begin = 0, end = 0;
+        gboolean found = FALSE;
+        for (gsize i = 0; i < pages; ++i) {
+            if (!(resident[i] & 1))
+                continue;
+            if (found && i - end < PRELOAD_MERGE_PAGES) {
+                end = i + 1;
+                continue;
+            }
+            if (found)
+                g_string_append_printf (manifest, "%s\t%" G_GSIZE_FORMAT
+                                        "\t%" G_GSIZE_FORMAT "\n", path.c_str (),
+                                        begin * page, (end - begin) * page);
+            begin = i;
+            end = i + 1;
+            found = TRUE;
+        }
+        if (found)
+            g_string_append_printf (manifest, "%s\t%" G_GSIZE_FORMAT
+                                    "\t%" G_GSIZE_FORMAT "\n", path.c_str (),
+                                    begin * page, (end - begin) * page);
+    }
+
+    munmap (addr, buf.st_size);
+}
+
+void
+Preload::start (void)
+{
+    GThread *thread = g_thread_new ("preload", Preload::preloadThread, NULL);
+    g_thread_unref (thread);
+}
+
+void
+Preload::record (void)
+{
+    GThread *thread = g_thread_new ("preload", Preload::recordThread, NULL);
+    g_thread_unref (thread);
+}
+
+gpointer
+Preload::preloadThread (gpointer data)
+{
+    gchar *filename = preload_manifest_file ();
+    gchar *contents = NULL;
+    gboolean retval = g_file_get_contents (filename, &contents, NULL, NULL);
+    g_free (filename);
+    if (!retval)
+        return NULL;
+
+    /* the lines are "path\toffset\tlength", sorted by the offsets. */
+    std::string current;
+    int fd = -1;
+    gchar **lines = g_strsplit (contents, "\n", -1);
+    g_free (contents);
+
+    for (gchar **line = lines; *line; ++line) {
+        gchar **fields = g_strsplit (*line, "\t", 3);
+        if (g_strv_length (fields) != 3) {
+            g_strfreev (fields);
+            continue;
+        }
+
+        if (current != fields[0]) {
+            if (fd >= 0)
+                close (fd);
+            current = fields[0];
+            fd = g_open (fields[0], O_RDONLY, 0);
+        }
+
+        if (fd >= 0) {
+            off_t offset = g_ascii_strtoull (fields[1], NULL, 10);
+            off_t length = g_ascii_strtoull (fields[2], NULL, 10);
+            posix_fadvise (fd, offset, length, POSIX_FADV_WILLNEED);
+        }
+        g_strfreev (fields);
+    }
+
+    if (fd >= 0)
+        close (fd);
+    g_strfreev (lines);
+    return NULL;
+}
+
+gpointer
+Preload::recordThread (gpointer data)
+{
+    std::vector<std::string> files;
+    preload_data_files (files);
+
+    GString *manifest = g_string_new (NULL);
+    for (size_t i = 0; i < files.size (); ++i)
+        preload_record_file (files[i], manifest);
+
+    gchar *dirname = g_build_filename (g_get_user_cache_dir (),
+                                       "ibus", "libpinyin", NULL);
+    g_mkdir_with_parents (dirname, 0700);
+    g_free (dirname);
+
+    gchar *filename = preload_manifest_file ();
+    g_file_set_contents (filename, manifest->str, manifest->len, NULL);
+    g_free (filename);
+    g_string_free (manifest, TRUE);
+    return NULL;
+}
+
+};
@@ -0,0 +1,57 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_PRELOAD_H_
+#define __PY_PRELOAD_H_
+
+#include <glib.h>
+
+namespace PY {
+
+/* record the data pages after the first 50 keys. */
+#define PRELOAD_RECORD_KEYS (50)
+
+/* Read ahead the ranges of the data files, which were resident after
+ * the first keys at the last start, before the first key arrives. */
+class Preload {
+public:
+    /* issue the read ahead of the manifest in a thread. */
+    static void start (void);
+
+    static void keyPressed (void)
+    {
+        if (G_UNLIKELY (m_keys < PRELOAD_RECORD_KEYS) &&
+            ++m_keys == PRELOAD_RECORD_KEYS)
+            record ();
+    }
+
+private:
+    /* write the resident ranges into the manifest in a thread. */
+    static void record (void);
+
+    static gpointer preloadThread (gpointer data);
+    static gpointer recordThread (gpointer data);
+
+    static guint m_keys;
+};
+
+};
+
+#endif
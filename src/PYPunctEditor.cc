@@ -18,7 +18,6 @@
  *  You should have received a copy of the GNU General Public License
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-#include <algorithm>
 #include "PYConfig.h"
 #include "PYPunctEditor.h"
 
@@ -29,7 +28,9 @@ namespace PY {
 PunctEditor::PunctEditor (PinyinProperties & props, Config & config)
     : Editor (props, config),
       m_punct_mode (MODE_DISABLE),
-      m_lookup_table (m_config.pageSize ())
+      m_lookup_table (m_config.pageSize ()),
+      m_punct_begin (0),
+      m_punct_size (0)
 {
 }
 
@@ -45,7 +46,7 @@ PunctEditor::insert (gchar ch)
             m_punct_mode = MODE_INIT;
             updatePunctCandidates (0);
             m_selected_puncts.clear ();
-            m_selected_puncts.insert (m_selected_puncts.begin (), m_punct_candidates[0]);
+            m_selected_puncts.insert (m_selected_puncts.begin (), m_punct_begin);
             update ();
         }
         break;
@@ -60,8 +61,8 @@ PunctEditor::insert (gchar ch)
             m_text.insert (m_cursor, ch);
             updatePunctCandidates (ch);
             m_punct_mode = MODE_NORMAL;
-            if (m_punct_candidates.size () > 0) {
-                m_selected_puncts.insert (m_selected_puncts.begin () + m_cursor, m_punct_candidates[0]);
+            if (m_punct_size > 0) {
+                m_selected_puncts.insert (m_selected_puncts.begin () + m_cursor, m_punct_begin);
             }
             m_cursor ++;
             update ();
@@ -224,7 +225,7 @@ void
 PunctEditor::pageUp (void)
 {
     if (G_LIKELY (m_lookup_table.pageUp ())) {
-        m_selected_puncts[m_cursor - 1] = m_punct_candidates[m_lookup_table.cursorPos ()];
+        m_selected_puncts[m_cursor - 1] = m_punct_begin + m_lookup_table.cursorPos ();
         updateLookupTableFast (m_lookup_table, TRUE);
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -235,7 +236,7 @@ void
 PunctEditor::pageDown (void)
 {
     if (G_LIKELY (m_lookup_table.pageDown ())) {
-        m_selected_puncts[m_cursor - 1] = m_punct_candidates[m_lookup_table.cursorPos ()];
+        m_selected_puncts[m_cursor - 1] = m_punct_begin + m_lookup_table.cursorPos ();
         updateLookupTableFast (m_lookup_table, TRUE);
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -246,7 +247,7 @@ void
 PunctEditor::cursorUp (void)
 {
     if (G_LIKELY (m_lookup_table.cursorUp ())) {
-        m_selected_puncts[m_cursor - 1] = m_punct_candidates[m_lookup_table.cursorPos ()];
+        m_selected_puncts[m_cursor - 1] = m_punct_begin + m_lookup_table.cursorPos ();
         updateLookupTableFast (m_lookup_table, TRUE);
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -257,7 +258,7 @@ void
 PunctEditor::cursorDown (void)
 {
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
-        m_selected_puncts[m_cursor - 1] = m_punct_candidates[m_lookup_table.cursorPos ()];
+        m_selected_puncts[m_cursor - 1] = m_punct_begin + m_lookup_table.cursorPos ();
         updateLookupTableFast (m_lookup_table, TRUE);
         updatePreeditText ();
         updateAuxiliaryText ();
@@ -271,18 +272,13 @@ PunctEditor::moveCursorLeft (void)
         return FALSE;
     m_cursor --;
     if (m_cursor == 0)  {
-        m_punct_candidates.clear ();
+        clearPunctCandidates ();
         fillLookupTable ();
     }
     else {
         updatePunctCandidates (m_text[m_cursor - 1]);
         /* restore cursor pos */
-        std::vector<const gchar *>::iterator it;
-        it = std::find (m_punct_candidates.begin (),
-                        m_punct_candidates.end (),
-                        m_selected_puncts[m_cursor - 1]);
-        g_assert (it != m_punct_candidates.end ());
-        m_lookup_table.setCursorPos (it - m_punct_candidates.begin ());
+        m_lookup_table.setCursorPos (selectedPos ());
     }
     update();
     return TRUE;
@@ -297,12 +293,7 @@ PunctEditor::moveCursorRight (void)
     updatePunctCandidates (m_text[m_cursor - 1]);
 
     /* restore cursor pos */
-    std::vector<const gchar *>::iterator it;
-    it = std::find (m_punct_candidates.begin (),
-                    m_punct_candidates.end (),
-                    m_selected_puncts[m_cursor - 1]);
-    g_assert (it != m_punct_candidates.end ());
-    m_lookup_table.setCursorPos (it - m_punct_candidates.begin ());
+    m_lookup_table.setCursorPos (selectedPos ());
 
     update();
     return TRUE;
@@ -316,7 +307,7 @@ PunctEditor::moveCursorToBegin (void)
 
     g_assert (m_punct_mode == MODE_NORMAL);
     m_cursor = 0;
-    m_punct_candidates.clear ();
+    clearPunctCandidates ();
     fillLookupTable ();
     update ();
 
@@ -334,12 +325,7 @@ PunctEditor::moveCursorToEnd (void)
     updatePunctCandidates (m_text[m_cursor - 1]);
 
     /* restore cursor pos */
-    std::vector<const gchar *>::iterator it;
-    it = std::find (m_punct_candidates.begin (),
-                    m_punct_candidates.end (),
-                    m_selected_puncts[m_cursor - 1]);
-    g_assert (it != m_punct_candidates.end ());
-    m_lookup_table.setCursorPos (it - m_punct_candidates.begin ());
+    m_lookup_table.setCursorPos (selectedPos ());
 
     update();
     return TRUE;
@@ -362,15 +348,10 @@ PunctEditor::removeCharBefore (void)
 
             updatePunctCandidates (m_text[m_cursor - 1]);
             /* restore cursor pos */
-            std::vector<const gchar *>::iterator it;
-            it = std::find (m_punct_candidates.begin (),
-                            m_punct_candidates.end (),
-                            m_selected_puncts[m_cursor - 1]);
-            g_assert (it != m_punct_candidates.end ());
-            m_lookup_table.setCursorPos (it - m_punct_candidates.begin ());
+            m_lookup_table.setCursorPos (selectedPos ());
         }
         else {
-            m_punct_candidates.clear ();
+            clearPunctCandidates ();
             fillLookupTable ();
         }
     }
@@ -401,7 +382,7 @@ PunctEditor::reset (void)
 {
     m_punct_mode = MODE_DISABLE;
     m_selected_puncts.clear ();
-    m_punct_candidates.clear ();
+    clearPunctCandidates ();
     fillLookupTable ();
     Editor::reset ();
 }
@@ -424,9 +405,9 @@ void
 PunctEditor::commit (void)
 {
     m_buffer.clear ();
-    for (std::vector<const gchar *>::iterator it = m_selected_puncts.begin ();
+    for (std::vector<guint>::iterator it = m_selected_puncts.begin ();
          it != m_selected_puncts.end (); it++) {
-        m_buffer << *it;
+        m_buffer << punct_string (*it);
     }
 
     commit (m_buffer);
@@ -440,14 +421,14 @@ PunctEditor::selectCandidate (guint i)
         {
             g_assert (m_cursor == 1);
             m_lookup_table.setCursorPos (i);
-            m_selected_puncts[m_cursor - 1] = m_punct_candidates[i];
+            m_selected_puncts[m_cursor - 1] = m_punct_begin + i;
             commit ();
             return TRUE;
         }
     case MODE_NORMAL:
         {
             m_lookup_table.setCursorPos (i);
-            m_selected_puncts[m_cursor - 1] = m_punct_candidates[i];
+            m_selected_puncts[m_cursor - 1] = m_punct_begin + i;
 
             /* if it is the last punct, commit the result */
             if (m_cursor == m_text.length ()) {
@@ -494,9 +475,8 @@ PunctEditor::fillLookupTable (void)
     m_lookup_table.setPageSize (m_config.pageSize ());
     m_lookup_table.setOrientation (m_config.orientation ());
 
-    for (std::vector<const gchar *>::iterator it = m_punct_candidates.begin ();
-         it != m_punct_candidates.end (); it++) {
-        StaticText text (*it);
+    for (guint i = 0; i < m_punct_size; i++) {
+        StaticText text (punct_string (m_punct_begin + i));
         // text.appendAttribute (IBUS_ATTR_TYPE_FOREGROUND, 0x004466, 0, -1);
         m_lookup_table.appendCandidate (text);
     }
@@ -513,32 +493,14 @@ PunctEditor::updateLookupTable (void)
     }
 }
 
-static int
-punct_cmp (const void *p1, const void *p2)
-{
-    const gint s1 = (gint)(glong) p1;
-    const gchar *s2 = **(gchar ***) p2;
-    return s1 - s2[0];
-}
-
 void
 PunctEditor::updatePunctCandidates (gchar ch)
 {
-    const gchar *** brs;
-    const gchar ** res;
-
-    m_punct_candidates.clear();
-
-    brs = (const gchar ***) std::bsearch (reinterpret_cast<void *>(ch),
-                                          punct_table,
-                                          G_N_ELEMENTS (punct_table),
-                                          sizeof(punct_table[0]),
-                                          punct_cmp);
-    if (brs != NULL) {
-        for (res = (*brs) + 1; *res != NULL; ++res) {
-            m_punct_candidates.push_back (*res);
-        }
-    }
+    if (G_LIKELY ((guchar) ch < G_N_ELEMENTS (punct_index))) {
+        m_punct_begin = punct_index[(guchar) ch].begin;
+        m_punct_size = punct_index[(guchar) ch].size;
+    } else
+        clearPunctCandidates ();
     fillLookupTable ();
 }
 
@@ -590,7 +552,7 @@ PunctEditor::updatePreeditText (void)
         break;
     case MODE_INIT:
         {
-            m_buffer = m_punct_candidates[m_lookup_table.cursorPos ()];
+            m_buffer = punct_string (m_punct_begin + m_lookup_table.cursorPos ());
             StaticText preedit_text (m_buffer);
             /* underline */
             preedit_text.appendAttribute (IBUS_ATTR_TYPE_UNDERLINE, IBUS_ATTR_UNDERLINE_SINGLE, 0, -1);
@@ -600,9 +562,9 @@ PunctEditor::updatePreeditText (void)
     case MODE_NORMAL:
         {
             m_buffer.clear ();
-            for (std::vector<const gchar *>::iterator it = m_selected_puncts.begin ();
+            for (std::vector<guint>::iterator it = m_selected_puncts.begin ();
                  it != m_selected_puncts.end (); it++) {
-                m_buffer << *it;
+                m_buffer << punct_string (*it);
             }
             StaticText preedit_text (m_buffer);
             /* underline */
@@ -60,6 +60,11 @@ public:
 
     void fillLookupTable (void);
     void updatePunctCandidates (gchar ch);
+
+    void clearPunctCandidates (void) { m_punct_begin = m_punct_size = 0; }
+    /* the lookup table position of the punct selected before the cursor. */
+    guint selectedPos (void) const
+    { return m_selected_puncts[m_cursor - 1] - m_punct_begin; }
 protected:
     enum {
         MODE_DISABLE,
@@ -68,8 +73,11 @@ protected:
     } m_punct_mode;
     LookupTable m_lookup_table;
     String m_buffer;
-    std::vector<const gchar *> m_selected_puncts;
-    std::vector<const gchar *> m_punct_candidates;
+    /* the indices into puncts, the candidates of the current key
+       are puncts[m_punct_begin] ... puncts[m_punct_begin + m_punct_size - 1]. */
+    std::vector<guint> m_selected_puncts;
+    guint m_punct_begin;
+    guint m_punct_size;
 
 };
 
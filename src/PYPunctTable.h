@@ -1,197 +1,477 @@
-static const gchar * const
-puncts[] = {
-    "", "·", "，", "。", "「", "」", "、", "：", "；", "？", "！", NULL,
-    "!", "！", "﹗", "‼", "⁉", NULL,
-    "\"", "“", "”", "＂", NULL,
-    "#", "＃", "﹟", "♯", NULL,
-    "$", "＄", "€", "﹩", "￠", "￡", "￥", NULL,
-    "%", "％", "﹪", "‰", "‱", "㏙", "㏗", NULL,
-    "&", "＆", "﹠", NULL,
-    "'", "、", "‘", "’", NULL,
-    "(", "（", "︵", "﹙", NULL,
-    ")", "）", "︶", "﹚", NULL,
-    "*", "＊", "×", "※", "╳", "﹡", "⁎", "⁑", "⁂", "⌘", NULL,
-    "+", "＋", "±", "﹢", NULL,
-    ",", "，", "、", "﹐", "﹑", NULL,
-    "-", "…", "—", "－", "¯", "﹉", "￣", "﹊", "ˍ", "–", "‥", NULL,
-    ".", "。", "·", "‧", "﹒", "．", NULL,
-    "/", "／", "÷", "↗", "↙", "∕", NULL,
-    "0", "０", "0", NULL,
-    "1", "１", "1", NULL,
-    "2", "２", "2", NULL,
-    "3", "３", "3", NULL,
-    "4", "４", "4", NULL,
-    "5", "５", "5", NULL,
-    "6", "６", "6", NULL,
-    "7", "７", "7", NULL,
-    "8", "８", "8", NULL,
-    "9", "９", "9", NULL,
-    ":", "：", "︰", "﹕", NULL,
-    ";", "；", "﹔", NULL,
-    "<", "＜", "〈", "《", "︽", "︿", "﹤", NULL,
-    "=", "＝", "≒", "≠", "≡", "≦", "≧", "﹦", NULL,
-    ">", "＞", "〉", "》", "︾", "﹀", "﹥", NULL,
-    "?", "？", "﹖", "⁇", "⁈", NULL,
-    "@", "＠", "⊕", "⊙", "㊣", "﹫", "◉", "◎", NULL,
-    "A", "Ａ", "A", NULL,
-    "B", "Ｂ", "B", NULL,
-    "C", "Ｃ", "C", NULL,
-    "D", "Ｄ", "D", NULL,
-    "E", "Ｅ", "E", NULL,
-    "F", "Ｆ", "F", NULL,
-    "G", "Ｇ", "G", NULL,
-    "H", "Ｈ", "H", NULL,
-    "I", "Ｉ", "I", NULL,
-    "J", "Ｊ", "J", NULL,
-    "K", "Ｋ", "K", NULL,
-    "L", "Ｌ", "L", NULL,
-    "M", "Ｍ", "M", NULL,
-    "N", "Ｎ", "N", NULL,
-    "O", "Ｏ", "O", NULL,
-    "P", "Ｐ", "P", NULL,
-    "Q", "Ｑ", "Q", NULL,
-    "R", "Ｒ", "R", NULL,
-    "S", "Ｓ", "S", NULL,
-    "T", "Ｔ", "T", NULL,
-    "U", "Ｕ", "U", NULL,
-    "V", "Ｖ", "V", NULL,
-    "W", "Ｗ", "W", NULL,
-    "X", "Ｘ", "X", NULL,
-    "Y", "Ｙ", "Y", NULL,
-    "Z", "Ｚ", "Z", NULL,
-    "[", "「", "［", "『", "【", "｢", "︻", "﹁", "﹃", NULL,
-    "\\", "＼", "↖", "↘", "﹨", NULL,
-    "]", "」", "］", "』", "】", "｣", "︼", "﹂", "﹄", NULL,
-    "^", "︿", "〈", "《", "︽", "﹤", "＜", NULL,
-    "_", "＿", "╴", "←", "→", NULL,
-    "`", "‵", "′", NULL,
-    "a", "ａ", "a", NULL,
-    "b", "ｂ", "b", NULL,
-    "c", "ｃ", "c", NULL,
-    "d", "ｄ", "d", NULL,
-    "e", "ｅ", "e", NULL,
-    "f", "ｆ", "f", NULL,
-    "g", "ｇ", "g", NULL,
-    "h", "ｈ", "h", NULL,
-    "i", "ｉ", "i", NULL,
-    "j", "ｊ", "j", NULL,
-    "k", "ｋ", "k", NULL,
-    "l", "ｌ", "l", NULL,
-    "m", "ｍ", "m", NULL,
-    "n", "ｎ", "n", NULL,
-    "o", "ｏ", "o", NULL,
-    "p", "ｐ", "p", NULL,
-    "q", "ｑ", "q", NULL,
-    "r", "ｒ", "r", NULL,
-    "s", "ｓ", "s", NULL,
-    "t", "ｔ", "t", NULL,
-    "u", "ｕ", "u", NULL,
-    "v", "ｖ", "v", NULL,
-    "w", "ｗ", "w", NULL,
-    "x", "ｘ", "x", NULL,
-    "y", "ｙ", "y", NULL,
-    "z", "ｚ", "z", NULL,
-    "{", "｛", "︷", "﹛", "〔", "﹝", "︹", NULL,
-    "|", "｜", "↑", "↓", "∣", "∥", "︱", "︳", "︴", "￤", NULL,
-    "}", "｝", "︸", "﹜", "〕", "﹞", "︺", NULL,
-    "~", "～", "﹋", "﹌", NULL,
+static const gchar punct_strings[] =
+"·\0"
+"，\0"
+"。\0"
+"「\0"
+"」\0"
+"、\0"
+"：\0"
+"；\0"
+"？\0"
+"！\0"
+"！\0"
+"﹗\0"
+"‼\0"
+"⁉\0"
+"“\0"
+"”\0"
+"＂\0"
+"＃\0"
+"﹟\0"
+"♯\0"
+"＄\0"
+"€\0"
+"﹩\0"
+"￠\0"
+"￡\0"
+"￥\0"
+"％\0"
+"﹪\0"
+"‰\0"
+"‱\0"
+"㏙\0"
+"㏗\0"
+"＆\0"
+"﹠\0"
+"、\0"
+"‘\0"
+"’\0"
+"（\0"
+"︵\0"
+"﹙\0"
+"）\0"
+"︶\0"
+"﹚\0"
+"＊\0"
+"×\0"
+"※\0"
+"╳\0"
+"﹡\0"
+"⁎\0"
+"⁑\0"
+"⁂\0"
+"⌘\0"
+"＋\0"
+"±\0"
+"﹢\0"
+"，\0"
+"、\0"
+"﹐\0"
+"﹑\0"
+"…\0"
+"—\0"
+"－\0"
+"¯\0"
+"﹉\0"
+"￣\0"
+"﹊\0"
+"ˍ\0"
+"–\0"
+"‥\0"
+"。\0"
+"·\0"
+"‧\0"
+"﹒\0"
+"．\0"
+"／\0"
+"÷\0"
+"↗\0"
+"↙\0"
+"∕\0"
+"０\0"
+"0\0"
+"１\0"
+"1\0"
+"２\0"
+"2\0"
+"３\0"
+"3\0"
+"４\0"
+"4\0"
+"５\0"
+"5\0"
+"６\0"
+"6\0"
+"７\0"
+"7\0"
+"８\0"
+"8\0"
+"９\0"
+"9\0"
+"：\0"
+"︰\0"
+"﹕\0"
+"；\0"
+"﹔\0"
+"＜\0"
+"〈\0"
+"《\0"
+"︽\0"
+"︿\0"
+"﹤\0"
+"＝\0"
+"≒\0"
+"≠\0"
+"≡\0"
+"≦\0"
+"≧\0"
+"﹦\0"
+"＞\0"
+"〉\0"
+"》\0"
+"︾\0"
+"﹀\0"
+"﹥\0"
+"？\0"
+"﹖\0"
+"⁇\0"
+"⁈\0"
+"＠\0"
+"⊕\0"
+"⊙\0"
+"㊣\0"
+"﹫\0"
+"◉\0"
+"◎\0"
+"Ａ\0"
+"A\0"
+"Ｂ\0"
+"B\0"
+"Ｃ\0"
+"C\0"
+"Ｄ\0"
+"D\0"
+"Ｅ\0"
+"E\0"
+"Ｆ\0"
+"F\0"
+"Ｇ\0"
+"G\0"
+"Ｈ\0"
+"H\0"
+"Ｉ\0"
+"I\0"
+"Ｊ\0"
+"J\0"
+"Ｋ\0"
+"K\0"
+"Ｌ\0"
+"L\0"
+"Ｍ\0"
+"M\0"
+"Ｎ\0"
+"N\0"
+"Ｏ\0"
+"O\0"
+"Ｐ\0"
+"P\0"
+"Ｑ\0"
+"Q\0"
+"Ｒ\0"
+"R\0"
+"Ｓ\0"
+"S\0"
+"Ｔ\0"
+"T\0"
+"Ｕ\0"
+"U\0"
+"Ｖ\0"
+"V\0"
+"Ｗ\0"
+"W\0"
+"Ｘ\0"
+"X\0"
+"Ｙ\0"
+"Y\0"
+"Ｚ\0"
+"Z\0"
+"「\0"
+"［\0"
+"『\0"
+"【\0"
+"｢\0"
+"︻\0"
+"﹁\0"
+"﹃\0"
+"＼\0"
+"↖\0"
+"↘\0"
+"﹨\0"
+"」\0"
+"］\0"
+"』\0"
+"】\0"
+"｣\0"
+"︼\0"
+"﹂\0"
+"﹄\0"
+"︿\0"
+"〈\0"
+"《\0"
+"︽\0"
+"﹤\0"
+"＜\0"
+"＿\0"
+"╴\0"
+"←\0"
+"→\0"
+"‵\0"
+"′\0"
+"ａ\0"
+"a\0"
+"ｂ\0"
+"b\0"
+"ｃ\0"
+"c\0"
+"ｄ\0"
+"d\0"
+"ｅ\0"
+"e\0"
+"ｆ\0"
+"f\0"
+"ｇ\0"
+"g\0"
+"ｈ\0"
+"h\0"
+"ｉ\0"
+"i\0"
+"ｊ\0"
+"j\0"
+"ｋ\0"
+"k\0"
+"ｌ\0"
+"l\0"
+"ｍ\0"
+"m\0"
+"ｎ\0"
+"n\0"
+"ｏ\0"
+"o\0"
+"ｐ\0"
+"p\0"
+"ｑ\0"
+"q\0"
+"ｒ\0"
+"r\0"
+"ｓ\0"
+"s\0"
+"ｔ\0"
+"t\0"
+"ｕ\0"
+"u\0"
+"ｖ\0"
+"v\0"
+"ｗ\0"
+"w\0"
+"ｘ\0"
+"x\0"
+"ｙ\0"
+"y\0"
+"ｚ\0"
+"z\0"
+"｛\0"
+"︷\0"
+"﹛\0"
+"〔\0"
+"﹝\0"
+"︹\0"
+"｜\0"
+"↑\0"
+"↓\0"
+"∣\0"
+"∥\0"
+"︱\0"
+"︳\0"
+"︴\0"
+"￤\0"
+"｝\0"
+"︸\0"
+"﹜\0"
+"〕\0"
+"﹞\0"
+"︺\0"
+"～\0"
+"﹋\0"
+"﹌\0"
+;
+
+/* offsets of the punctuations in punct_strings. */
+static const guint16 punct_offsets[] = {
+    0, 3, 7, 11, 15, 19, 23, 27,
+    31, 35, 39, 43, 47, 51, 55, 59,
+    63, 67, 71, 75, 79, 83, 87, 91,
+    95, 99, 103, 107, 111, 115, 119, 123,
+    127, 131, 135, 139, 143, 147, 151, 155,
+    159, 163, 167, 171, 175, 178, 182, 186,
+    190, 194, 198, 202, 206, 210, 213, 217,
+    221, 225, 229, 233, 237, 241, 245, 248,
+    252, 256, 260, 263, 267, 271, 275, 278,
+    282, 286, 290, 294, 297, 301, 305, 309,
+    313, 315, 319, 321, 325, 327, 331, 333,
+    337, 339, 343, 345, 349, 351, 355, 357,
+    361, 363, 367, 369, 373, 377, 381, 385,
+    389, 393, 397, 401, 405, 409, 413, 417,
+    421, 425, 429, 433, 437, 441, 445, 449,
+    453, 457, 461, 465, 469, 473, 477, 481,
+    485, 489, 493, 497, 501, 505, 509, 513,
+    515, 519, 521, 525, 527, 531, 533, 537,
+    539, 543, 545, 549, 551, 555, 557, 561,
+    563, 567, 569, 573, 575, 579, 581, 585,
+    587, 591, 593, 597, 599, 603, 605, 609,
+    611, 615, 617, 621, 623, 627, 629, 633,
+    635, 639, 641, 645, 647, 651, 653, 657,
+    659, 663, 665, 669, 673, 677, 681, 685,
+    689, 693, 697, 701, 705, 709, 713, 717,
+    721, 725, 729, 733, 737, 741, 745, 749,
+    753, 757, 761, 765, 769, 773, 777, 781,
+    785, 789, 793, 797, 799, 803, 805, 809,
+    811, 815, 817, 821, 823, 827, 829, 833,
+    835, 839, 841, 845, 847, 851, 853, 857,
+    859, 863, 865, 869, 871, 875, 877, 881,
+    883, 887, 889, 893, 895, 899, 901, 905,
+    907, 911, 913, 917, 919, 923, 925, 929,
+    931, 935, 937, 941, 943, 947, 949, 953,
+    957, 961, 965, 969, 973, 977, 981, 985,
+    989, 993, 997, 1001, 1005, 1009, 1013, 1017,
+    1021, 1025, 1029, 1033, 1037, 1041,
 };
 
-static const gchar * const * const
-punct_table[] = {
-    &puncts[0],    // ""
-    &puncts[12],    // "!"
-    &puncts[18],    // "\""
-    &puncts[23],    // "#"
-    &puncts[28],    // "$"
-    &puncts[36],    // "%"
-    &puncts[44],    // "&"
-    &puncts[48],    // "'"
-    &puncts[53],    // "("
-    &puncts[58],    // ")"
-    &puncts[63],    // "*"
-    &puncts[74],    // "+"
-    &puncts[79],    // ","
-    &puncts[85],    // "-"
-    &puncts[97],    // "."
-    &puncts[104],    // "/"
-    &puncts[111],    // "0"
-    &puncts[115],    // "1"
-    &puncts[119],    // "2"
-    &puncts[123],    // "3"
-    &puncts[127],    // "4"
-    &puncts[131],    // "5"
-    &puncts[135],    // "6"
-    &puncts[139],    // "7"
-    &puncts[143],    // "8"
-    &puncts[147],    // "9"
-    &puncts[151],    // ":"
-    &puncts[156],    // ";"
-    &puncts[160],    // "<"
-    &puncts[168],    // "="
-    &puncts[177],    // ">"
-    &puncts[185],    // "?"
-    &puncts[191],    // "@"
-    &puncts[200],    // "A"
-    &puncts[204],    // "B"
-    &puncts[208],    // "C"
-    &puncts[212],    // "D"
-    &puncts[216],    // "E"
-    &puncts[220],    // "F"
-    &puncts[224],    // "G"
-    &puncts[228],    // "H"
-    &puncts[232],    // "I"
-    &puncts[236],    // "J"
-    &puncts[240],    // "K"
-    &puncts[244],    // "L"
-    &puncts[248],    // "M"
-    &puncts[252],    // "N"
-    &puncts[256],    // "O"
-    &puncts[260],    // "P"
-    &puncts[264],    // "Q"
-    &puncts[268],    // "R"
-    &puncts[272],    // "S"
-    &puncts[276],    // "T"
-    &puncts[280],    // "U"
-    &puncts[284],    // "V"
-    &puncts[288],    // "W"
-    &puncts[292],    // "X"
-    &puncts[296],    // "Y"
-    &puncts[300],    // "Z"
-    &puncts[304],    // "["
-    &puncts[314],    // "\\"
-    &puncts[320],    // "]"
-    &puncts[330],    // "^"
-    &puncts[338],    // "_"
-    &puncts[344],    // "`"
-    &puncts[348],    // "a"
-    &puncts[352],    // "b"
-    &puncts[356],    // "c"
-    &puncts[360],    // "d"
-    &puncts[364],    // "e"
-    &puncts[368],    // "f"
-    &puncts[372],    // "g"
-    &puncts[376],    // "h"
-    &puncts[380],    // "i"
-    &puncts[384],    // "j"
-    &puncts[388],    // "k"
-    &puncts[392],    // "l"
-    &puncts[396],    // "m"
-    &puncts[400],    // "n"
-    &puncts[404],    // "o"
-    &puncts[408],    // "p"
-    &puncts[412],    // "q"
-    &puncts[416],    // "r"
-    &puncts[420],    // "s"
-    &puncts[424],    // "t"
-    &puncts[428],    // "u"
-    &puncts[432],    // "v"
-    &puncts[436],    // "w"
-    &puncts[440],    // "x"
-    &puncts[444],    // "y"
-    &puncts[448],    // "z"
-    &puncts[452],    // "{"
-    &puncts[460],    // "|"
-    &puncts[471],    // "}"
-    &puncts[479],    // "~"
+static inline const gchar *
+punct_string (guint i)
+{
+    return punct_strings + punct_offsets[i];
+}
+
+static const struct {
+    guint16 begin;
+    guint16 size;
+} punct_index[128] = {
+    { 0, 10 },    // ""
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 10, 4 },    // "!"
+    { 14, 3 },    // "\""
+    { 17, 3 },    // "#"
+    { 20, 6 },    // "$"
+    { 26, 6 },    // "%"
+    { 32, 2 },    // "&"
+    { 34, 3 },    // "'"
+    { 37, 3 },    // "("
+    { 40, 3 },    // ")"
+    { 43, 9 },    // "*"
+    { 52, 3 },    // "+"
+    { 55, 4 },    // ","
+    { 59, 10 },    // "-"
+    { 69, 5 },    // "."
+    { 74, 5 },    // "/"
+    { 79, 2 },    // "0"
+    { 81, 2 },    // "1"
+    { 83, 2 },    // "2"
+    { 85, 2 },    // "3"
+    { 87, 2 },    // "4"
+    { 89, 2 },    // "5"
+    { 91, 2 },    // "6"
+    { 93, 2 },    // "7"
+    { 95, 2 },    // "8"
+    { 97, 2 },    // "9"
+    { 99, 3 },    // ":"
+    { 102, 2 },    // ";"
+    { 104, 6 },    // "<"
+    { 110, 7 },    // "="
+    { 117, 6 },    // ">"
+    { 123, 4 },    // "?"
+    { 127, 7 },    // "@"
+    { 134, 2 },    // "A"
+    { 136, 2 },    // "B"
+    { 138, 2 },    // "C"
+    { 140, 2 },    // "D"
+    { 142, 2 },    // "E"
+    { 144, 2 },    // "F"
+    { 146, 2 },    // "G"
+    { 148, 2 },    // "H"
+    { 150, 2 },    // "I"
+    { 152, 2 },    // "J"
+    { 154, 2 },    // "K"
+    { 156, 2 },    // "L"
+    { 158, 2 },    // "M"
+    { 160, 2 },    // "N"
+    { 162, 2 },    // "O"
+    { 164, 2 },    // "P"
+    { 166, 2 },    // "Q"
+    { 168, 2 },    // "R"
+    { 170, 2 },    // "S"
+    { 172, 2 },    // "T"
+    { 174, 2 },    // "U"
+    { 176, 2 },    // "V"
+    { 178, 2 },    // "W"
+    { 180, 2 },    // "X"
+    { 182, 2 },    // "Y"
+    { 184, 2 },    // "Z"
+    { 186, 8 },    // "["
+    { 194, 4 },    // "\\"
+    { 198, 8 },    // "]"
+    { 206, 6 },    // "^"
+    { 212, 4 },    // "_"
+    { 216, 2 },    // "`"
+    { 218, 2 },    // "a"
+    { 220, 2 },    // "b"
+    { 222, 2 },    // "c"
+    { 224, 2 },    // "d"
+    { 226, 2 },    // "e"
+    { 228, 2 },    // "f"
+    { 230, 2 },    // "g"
+    { 232, 2 },    // "h"
+    { 234, 2 },    // "i"
+    { 236, 2 },    // "j"
+    { 238, 2 },    // "k"
+    { 240, 2 },    // "l"
+    { 242, 2 },    // "m"
+    { 244, 2 },    // "n"
+    { 246, 2 },    // "o"
+    { 248, 2 },    // "p"
+    { 250, 2 },    // "q"
+    { 252, 2 },    // "r"
+    { 254, 2 },    // "s"
+    { 256, 2 },    // "t"
+    { 258, 2 },    // "u"
+    { 260, 2 },    // "v"
+    { 262, 2 },    // "w"
+    { 264, 2 },    // "x"
+    { 266, 2 },    // "y"
+    { 268, 2 },    // "z"
+    { 270, 6 },    // "{"
+    { 276, 9 },    // "|"
+    { 285, 6 },    // "}"
+    { 291, 3 },    // "~"
+    { 0, 0 },
 };
@@ -0,0 +1,132 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYReclaim.h"
+#include <stdio.h>
+#include <string.h>
+#include <set>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "PYStats.h"
+
+namespace PY {
+
+/* check the idle time every minute. */
+#define RECLAIM_CHECK_TIMEOUT (60)
+
+gint64 Reclaim::m_last_key = 0;
+gint64 Reclaim::m_last_reclaim = -1;
+
+/* constructed by the first reclaimable, as the caches are static. */
+static std::set<Reclaimable *> &
+reclaimables (void)
+{
+    static std::set<Reclaimable *> objects;
+    return objects;
+}
+
+Reclaimable::Reclaimable (void)
+{
+    reclaimables ().insert (this);
+}
+
+Reclaimable::~Reclaimable (void)
+{
+    reclaimables ().erase (this);
+}
+
+/* read the current and the peak resident size in KiB. */
+static gboolean
+reclaim_read_rss (guint64 & rss, guint64 & high_water)
+{
+    FILE *file = fopen ("/proc/self/status", "r");
+    if (file == NULL)
+        return FALSE;
+
+    char line[128];
+    rss = high_water = 0;
+    while (fgets (line, sizeof (line), file)) {
+        if (strncmp (line, "VmRSS:", 6) == 0)
+            rss = g_ascii_strtoull (line + 6, NULL, 10);
+        else if (strncmp (line, "VmHWM:", 6) == 0)
+            high_water = g_ascii_strtoull (line + 6, NULL, 10);
+    }
+    fclose (file);
+    return TRUE;
+}
+
+void
+Reclaim::start (void)
+{
+    m_last_key = g_get_monotonic_time ();
+    g_timeout_add_seconds (RECLAIM_CHECK_TIMEOUT,
+                           Reclaim::timeoutCallback, NULL);
+}
+
+void
+Reclaim::reclaim (void)
+{
+    StatsScope scope (STATS_RECLAIMS);
+
+    guint64 before = 0, after = 0, high_water = 0;
+    reclaim_read_rss (before, high_water);
+
+#if defined (__GLIBC__) && __GLIBC_PREREQ (2, 33)
+    struct mallinfo2 info = mallinfo2 ();
+    Stats::setMax (STATS_HEAP_HIGH_WATER, info.uordblks / 1024);
+#endif
+
+    std::set<Reclaimable *>::iterator iter;
+    for (iter = reclaimables ().begin (); iter != reclaimables ().end (); ++iter)
+        (*iter)->reclaim ();
+
+#ifdef __GLIBC__
+    malloc_trim (0);
+#endif
+
+    if (!reclaim_read_rss (after, high_water))
+        return;
+
+    Stats::set (STATS_RSS, after);
+    Stats::setMax (STATS_RSS_HIGH_WATER, high_water);
+    if (before > after)
+        Stats::add (STATS_RECLAIMED, before - after);
+
+    g_debug ("reclaimed %" G_GUINT64_FORMAT "KiB, rss %" G_GUINT64_FORMAT
+             "KiB, high water %" G_GUINT64_FORMAT "KiB",
+             before > after ? before - after : 0, after, high_water);
+}
+
+gboolean
+Reclaim::timeoutCallback (gpointer data)
+{
+    gint64 now = g_get_monotonic_time ();
+
+    /* reclaim once in each idle period. */
+    if (m_last_reclaim < m_last_key &&
+        now - m_last_key >= (gint64) RECLAIM_IDLE_TIME * G_USEC_PER_SEC) {
+        reclaim ();
+        m_last_reclaim = now;
+    }
+    return TRUE;
+}
+
+};
@@ -0,0 +1,64 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_RECLAIM_H_
+#define __PY_RECLAIM_H_
+
+#include <glib.h>
+
+namespace PY {
+
+/* reclaim the memory after 5 minutes without key events. */
+#define RECLAIM_IDLE_TIME (5 * 60)
+
+/* The objects holding the memory which can be rebuilt, such as the
+ * caches, registered while they are alive. */
+class Reclaimable {
+public:
+    Reclaimable (void);
+    virtual ~Reclaimable (void);
+
+    /* called in the main loop when the engine is idle. */
+    virtual void reclaim (void) = 0;
+};
+
+/* Shrink the caches and trim the heap when idle, the memory usage
+ * is recorded in the stats after each reclaim. */
+class Reclaim {
+public:
+    static void start (void);
+
+    static void keyPressed (void)
+    {
+        m_last_key = g_get_monotonic_time ();
+    }
+
+    static void reclaim (void);
+
+private:
+    static gboolean timeoutCallback (gpointer data);
+
+    static gint64 m_last_key;
+    static gint64 m_last_reclaim;
+};
+
+};
+
+#endif
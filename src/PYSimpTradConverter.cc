@@ -26,9 +26,8 @@
 
 #ifdef HAVE_OPENCC
 #  include <opencc.h>
-#else
-#  include <cstring>
-#  include <cstdlib>
+#  include <map>
+#  include <string>
 #endif
 
 #include "PYTypes.h"
@@ -38,124 +37,184 @@ namespace PY {
 
 #ifdef HAVE_OPENCC
 
-class opencc {
+#define OPENCC_INVALID ((opencc_t) -1)
+
+/* the opened converters of the profiles, shared by the pinyin and
+   bopomofo configs, the profile is opened on first use or preload. */
+static class OpenCCRegistry {
 public:
-    opencc (const char* configFileName)
+    OpenCCRegistry (void)
     {
-        m_cc = opencc_open (configFileName);
-        g_assert (m_cc != NULL);
+        g_mutex_init (&m_lock);
     }
 
-    ~opencc (void)
+    ~OpenCCRegistry (void)
     {
-        opencc_close(m_cc);
+        std::map<std::string, opencc_t>::iterator iter;
+        for (iter = m_converters.begin (); iter != m_converters.end (); ++iter) {
+            if (OPENCC_INVALID != iter->second)
+                opencc_close (iter->second);
+        }
+        g_mutex_clear (&m_lock);
     }
 
-    void convert (const gchar *in, String &out)
+    /* the lock is held while opening, so each profile is opened once. */
+    opencc_t acquire (const std::string & profile)
     {
-        char * converted = opencc_convert_utf8 (m_cc, in, -1);
-        g_assert (converted != NULL);
-        out = converted;
-        opencc_convert_utf8_free (converted);
+        g_mutex_lock (&m_lock);
+
+        opencc_t cc;
+        std::map<std::string, opencc_t>::iterator iter =
+            m_converters.find (profile);
+        if (iter != m_converters.end ()) {
+            cc = iter->second;
+        } else {
+            cc = opencc_open (profile.c_str ());
+            if (OPENCC_INVALID == cc)
+                g_warning ("can not open opencc config: %s", profile.c_str ());
+            m_converters[profile] = cc;
+        }
+
+        g_mutex_unlock (&m_lock);
+        return cc;
     }
+
 private:
-    opencc_t m_cc;
-};
+    GMutex m_lock;
+    std::map<std::string, opencc_t> m_converters;
+} opencc_registry;
+
+static gpointer
+preload_thread (gpointer data)
+{
+    gchar *profile = (gchar *) data;
+    opencc_registry.acquire (profile);
+    g_free (profile);
+    return NULL;
+}
 
 void
-SimpTradConverter::simpToTrad (const gchar *in, String &out)
+SimpTradConverter::preload (const std::string & profile)
 {
-    static opencc opencc(m_config.openccConfig().c_str());
-    opencc.convert (in, out);
+    g_thread_unref (g_thread_new ("opencc", preload_thread,
+                                  g_strdup (profile.c_str ())));
 }
 
-#else
+gpointer
+SimpTradConverter::acquire (void)
+{
+    /* follow the changed profile without restart. */
+    return (gpointer) opencc_registry.acquire (m_config.openccConfig ());
+}
 
-static gint _xcmp (const gchar *p1, const gchar *p2, const gchar *str)
+void
+SimpTradConverter::simpToTrad (const gchar *in, String &out)
 {
-    for (;;) {
-        // both reach end
-        if (p1 == p2 && *str == '\0')
-            return 0;
-        // p1 reaches end
-        if (p1 == p2)
-            return -1;
-        // str reaches end
-        if (*str == '\0')
-            return 1;
-
-        if (*p1 < *str)
-            return -1;
-        if (*p1 > *str)
-            return 1;
-
-        p1 ++; str ++;
-    };
+    simpToTrad (acquire (), in, out);
 }
 
-static gint _cmp (gconstpointer p1, gconstpointer p2)
+void
+SimpTradConverter::simpToTrad (gpointer handle, const gchar *in, String &out)
 {
-    const gchar **pp = (const gchar **) p1;
-    const gchar **s2 = (const gchar **) p2;
+    opencc_t cc = (opencc_t) handle;
+    if (G_UNLIKELY (OPENCC_INVALID == cc)) {
+        out = in;
+        return;
+    }
 
-    return _xcmp (pp[0], pp[1], s2[0]);
+    char * converted = opencc_convert_utf8 (cc, in, -1);
+    g_assert (converted != NULL);
+    out = converted;
+    opencc_convert_utf8_free (converted);
 }
 
+#else
+
 #include "PYSimpTradConverterTable.h"
+#include "PYSimpTradConverterTrie.h"
 
-void
-SimpTradConverter::simpToTrad (const gchar *in, String &out)
+static inline gint
+_find_child (gint node, gunichar ch)
 {
-    const gchar *pend;
-    const gchar *pp[2];
-    glong len;
-    glong begin;
+    gint begin = simp_to_trad_trie[node].first_child;
+    gint end = begin + simp_to_trad_trie[node].n_children;
+
+    /* children are sorted by character. */
+    while (begin < end) {
+        gint middle = begin + (end - begin) / 2;
+        gunichar value = simp_to_trad_trie[middle].ch;
+        if (value == ch)
+            return middle;
+        if (value < ch)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return -1;
+}
 
+static void
+_simp_to_trad (const gchar *in, String &out)
+{
     if (!g_utf8_validate (in, -1 , NULL)) {
         g_warning ("\%s\" is not an utf8 string!", in);
         g_assert_not_reached ();
     }
 
-    begin = 0;
-    pend = in + std::strlen (in);
-    len = g_utf8_strlen (in, -1);   // length in charactoers
-    pp[0] = in;
-
-    while (pp[0] != pend) {
-        glong slen  = std::min (len - begin, (glong) SIMP_TO_TRAD_MAX_LEN); // the length of sub string in character
-        pp[1] = g_utf8_offset_to_pointer (pp[0], slen);    // the end of sub string
-
-        for (;;) {
-            const gchar **result;
-            result = (const gchar **) std::bsearch (pp, simp_to_trad,
-                                            G_N_ELEMENTS (simp_to_trad), sizeof (simp_to_trad[0]),
-                                            _cmp);
-
-            if (result != NULL) {
-                // found item in table,
-                // append the trad to out and adjust pointers
-                out << result[1];
-                pp[0] = pp[1];
-                begin += slen;
-                break;
-            }
-
-            if (slen == 1) {
-                // if only one character left,
-                // append origin character to out and adjust pointers
-                out.append (pp[0], pp[1] - pp[0]);
-                pp[0] = pp[1];
-                begin += 1;
+    const gchar *p = in;
+    while (*p != '\0') {
+        /* walk down the trie, and remember the longest phrase. */
+        gint trad = -1;
+        const gchar *match_end = NULL;
+        const gchar *q = p;
+        gint node = 0;
+        for (gint len = 0; len < SIMP_TO_TRAD_MAX_LEN && *q != '\0'; len++) {
+            node = _find_child (node, g_utf8_get_char (q));
+            if (node < 0)
                 break;
+            q = g_utf8_next_char (q);
+            if (simp_to_trad_trie[node].trad >= 0) {
+                trad = simp_to_trad_trie[node].trad;
+                match_end = q;
             }
+        }
 
-            // if more than on characters left,
-            // adjust pp[1] to previous character
-            pp[1] = g_utf8_prev_char (pp[1]);
-            slen--;
+        if (trad >= 0) {
+            out << simp_to_trad_strings + simp_to_trad[trad][1];
+            p = match_end;
+        } else {
+            /* append origin character to out. */
+            q = g_utf8_next_char (p);
+            out.append (p, q - p);
+            p = q;
         }
     }
 }
+
+void
+SimpTradConverter::preload (const std::string & profile)
+{
+    /* the built-in table needs no loading. */
+}
+
+gpointer
+SimpTradConverter::acquire (void)
+{
+    return NULL;
+}
+
+void
+SimpTradConverter::simpToTrad (const gchar *in, String &out)
+{
+    _simp_to_trad (in, out);
+}
+
+void
+SimpTradConverter::simpToTrad (gpointer handle, const gchar *in, String &out)
+{
+    _simp_to_trad (in, out);
+}
+
 #endif
 
 }
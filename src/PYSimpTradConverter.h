@@ -31,6 +31,14 @@ class SimpTradConverter {
 public:
     SimpTradConverter(Config & config) : m_config(config) {}
     void simpToTrad (const gchar *in, String &out);
+
+    /* the converter of the current profile, the conversions by it
+       read no config and take no lock, so they run on any thread. */
+    gpointer acquire (void);
+    static void simpToTrad (gpointer handle, const gchar *in, String &out);
+
+    /* open the opencc profile in a worker thread ahead of use. */
+    static void preload (const std::string & profile);
 private:
     Config & m_config;
 };
@@ -1,7309 +1,21926 @@
-static const gchar *simp_to_trad[][2] = {
-    { "〇余", "〇餘" },
-    { "〇只", "〇隻" },
-    { "〇周后", "〇周後" },
-    { "一个", "一個" },
-    { "一个准", "一個準" },
-    { "一争两丑", "一爭兩醜" },
-    { "一伙", "一夥" },
-    { "一伙头", "一伙頭" },
-    { "一余", "一餘" },
-    { "一冲", "一衝" },
-    { "一准", "一準" },
-    { "一出剧", "一齣劇" },
-    { "一出喜剧", "一齣喜劇" },
-    { "一出好戏", "一齣好戲" },
-    { "一出子", "一齣子" },
-    { "一出悲剧", "一齣悲劇" },
-    { "一出戏", "一齣戲" },
-    { "一出电影", "一齣電影" },
-    { "一厘一毫", "一釐一毫" },
-    { "一发千钧", "一髮千鈞" },
-    { "一只", "一隻" },
-    { "一吊钱", "一吊錢" },
-    { "一周后", "一周後" },
-    { "一哄而散", "一鬨而散" },
-    { "一地里", "一地裡" },
-    { "一天后", "一天後" },
-    { "一天钟", "一天鐘" },
-    { "一干二净", "一乾二淨" },
-    { "一并", "一併" },
-    { "一扎", "一紮" },
-    { "一树百获", "一樹百穫" },
-    { "一物克一物", "一物剋一物" },
-    { "一碗面", "一碗麵" },
-    { "一锅面", "一鍋麵" },
-    { "丁丁当当", "丁丁當當" },
-    { "七个", "七個" },
-    { "七余", "七餘" },
-    { "七只", "七隻" },
-    { "七周后", "七周後" },
-    { "七天后", "七天後" },
-    { "七情六欲", "七情六慾" },
-    { "七扎", "七紮" },
-    { "万", "萬" },
-    { "万一只", "萬一只" },
-    { "万个", "萬個" },
-    { "万余", "萬餘" },
-    { "万历", "萬曆" },
-    { "万历史", "萬歷史" },
-    { "万只", "萬隻" },
-    { "万周后", "萬周後" },
-    { "万天后", "萬天後" },
-    { "万年历表", "萬年曆錶" },
-    { "万扎", "萬紮" },
-    { "万签插架", "萬籤插架" },
-    { "万象", "萬象" },
-    { "三个", "三個" },
-    { "三余", "三餘" },
-    { "三准", "三準" },
-    { "三出戏", "三齣戲" },
-    { "三只", "三隻" },
-    { "三周后", "三周後" },
-    { "三天后", "三天後" },
-    { "三征七辟", "三徵七辟" },
-    { "三扎", "三紮" },
-    { "三统历", "三統曆" },
-    { "三统历史", "三統歷史" },
-    { "上台面", "上檯面" },
-    { "上梁", "上樑" },
-    { "上签", "上籤" },
-    { "上签了", "上簽了" },
-    { "上签写", "上簽寫" },
-    { "上签发", "上簽發" },
-    { "上签名", "上簽名" },
-    { "上签字", "上簽字" },
-    { "上签定", "上簽定" },
-    { "上签收", "上簽收" },
-    { "上签约", "上簽約" },
-    { "上签署", "上簽署" },
-    { "上签订", "上簽訂" },
-    { "上签证", "上簽證" },
-    { "上系上", "上繫上" },
-    { "上课钟", "上課鐘" },
-    { "下文里", "下文裡" },
-    { "下梁", "下樑" },
-    { "下签", "下籤" },
-    { "下签了", "下簽了" },
-    { "下签写", "下簽寫" },
-    { "下签发", "下簽發" },
-    { "下签名", "下簽名" },
-    { "下签字", "下簽字" },
-    { "下签定", "下簽定" },
-    { "下签收", "下簽收" },
-    { "下签约", "下簽約" },
-    { "下签署", "下簽署" },
-    { "下签订", "下簽訂" },
-    { "下签证", "下簽證" },
-    { "下课钟", "下課鐘" },
-    { "不丑", "不醜" },
-    { "不卷", "不捲" },
-    { "不太准", "不太準" },
-    { "不好干预", "不好干預" },
-    { "不嫌母丑", "不嫌母醜" },
-    { "不寒而栗", "不寒而慄" },
-    { "不干不净", "不乾不淨" },
-    { "不干胶", "不乾膠" },
-    { "不托", "不託" },
-    { "不斗", "不鬥" },
-    { "不斗胆", "不斗膽" },
-    { "不断发", "不斷發" },
-    { "不谷", "不穀" },
-    { "不负所托", "不負所托" },
-    { "不通吊庆", "不通弔慶" },
-    { "不采", "不採" },
-    { "不采声", "不采聲" },
-    { "不锈钢", "不鏽鋼" },
-    { "不食干腊", "不食乾腊" },
-    { "与", "與" },
-    { "丑丑", "醜醜" },
-    { "丑丫头", "醜丫頭" },
-    { "丑事", "醜事" },
-    { "丑人", "醜人" },
-    { "丑侪", "醜儕" },
-    { "丑八怪", "醜八怪" },
-    { "丑剌剌", "醜剌剌" },
-    { "丑剧", "醜劇" },
-    { "丑化", "醜化" },
-    { "丑史", "醜史" },
-    { "丑名", "醜名" },
-    { "丑吒", "醜吒" },
-    { "丑地", "醜地" },
-    { "丑声", "醜聲" },
-    { "丑声远播", "醜聲遠播" },
-    { "丑头怪脸", "醜頭怪臉" },
-    { "丑夷", "醜夷" },
-    { "丑女", "醜女" },
-    { "丑女效颦", "醜女效顰" },
-    { "丑奴儿", "醜奴兒" },
-    { "丑妇", "醜婦" },
-    { "丑媳", "醜媳" },
-    { "丑媳妇", "醜媳婦" },
-    { "丑小鸭", "醜小鴨" },
-    { "丑巴怪", "醜巴怪" },
-    { "丑徒", "醜徒" },
-    { "丑态", "醜態" },
-    { "丑恶", "醜惡" },
-    { "丑时", "丑時" },
-    { "丑末", "醜末" },
-    { "丑杂", "醜雜" },
-    { "丑样", "醜樣" },
-    { "丑死", "醜死" },
-    { "丑比", "醜比" },
-    { "丑毙了", "醜斃了" },
-    { "丑沮", "醜沮" },
-    { "丑男", "醜男" },
-    { "丑类", "醜類" },
-    { "丑脸", "醜臉" },
-    { "丑虏", "醜虜" },
-    { "丑行", "醜行" },
-    { "丑言", "醜言" },
-    { "丑诋", "醜詆" },
-    { "丑话", "醜話" },
-    { "丑语", "醜語" },
-    { "丑贼生", "醜賊生" },
-    { "丑辞", "醜辭" },
-    { "丑辱", "醜辱" },
-    { "丑逆", "醜逆" },
-    { "丑闻", "醜聞" },
-    { "丑陋", "醜陋" },
-    { "专", "專" },
-    { "专辑里", "專輯裡" },
-    { "世界杯", "世界盃" },
-    { "世纪里", "世紀裡" },
-    { "世纪钟", "世紀鐘" },
-    { "世纪钟表", "世紀鐘錶" },
-    { "业", "業" },
-    { "业余", "業餘" },
-    { "丛", "叢" },
-    { "丛林里", "叢林裡" },
-    { "东", "東" },
-    { "东冲西突", "東衝西突" },
-    { "东周钟", "東周鐘" },
-    { "东岳", "東嶽" },
-    { "东游", "東遊" },
-    { "丝", "絲" },
-    { "丝制", "絲製" },
-    { "丝发", "絲髮" },
-    { "丝恩发怨", "絲恩髮怨" },
-    { "丢", "丟" },
-    { "丢丑", "丟醜" },
-    { "两", "兩" },
-    { "两个", "兩個" },
-    { "两余", "兩餘" },
-    { "两出", "兩齣" },
-    { "两只", "兩隻" },
-    { "两周后", "兩周後" },
-    { "两天后", "兩天後" },
-    { "两扎", "兩紮" },
-    { "两杆", "兩桿" },
-    { "两虎共斗", "兩虎共鬥" },
-    { "两鼠斗穴", "兩鼠鬥穴" },
-    { "严", "嚴" },
-    { "严云农", "嚴云農" },
-    { "丧", "喪" },
-    { "丧钟", "喪鐘" },
-    { "个", "個" },
-    { "个中原因", "箇中原因" },
-    { "个中奥", "箇中奧" },
-    { "个中好手", "箇中好手" },
-    { "个中强手", "箇中強手" },
-    { "个中滋味", "箇中滋味" },
-    { "个中玄机", "箇中玄機" },
-    { "个中理由", "箇中理由" },
-    { "个中翘楚", "箇中翹楚" },
-    { "个中道理", "箇中道理" },
-    { "个中高手", "箇中高手" },
-    { "个旧市", "箇舊市" },
-    { "个月里", "個月裡" },
-    { "个里", "個裡" },
-    { "个钟", "個鐘" },
-    { "个钟表", "個鐘錶" },
-    { "中型钟", "中型鐘" },
-    { "中型钟表", "中型鐘錶" },
-    { "中型钟表面", "中型鐘表面" },
-    { "中型钟面", "中型鐘面" },
-    { "中岳", "中嶽" },
-    { "中文里", "中文裡" },
-    { "中断发", "中斷發" },
-    { "中签", "中籤" },
-    { "中签了", "中簽了" },
-    { "中签写", "中簽寫" },
-    { "中签发", "中簽發" },
-    { "中签名", "中簽名" },
-    { "中签字", "中簽字" },
-    { "中签定", "中簽定" },
-    { "中签收", "中簽收" },
-    { "中签约", "中簽約" },
-    { "中签署", "中簽署" },
-    { "中签订", "中簽訂" },
-    { "中签证", "中簽證" },
-    { "中风后", "中風後" },
-    { "丰", "豐" },
-    { "丰仪", "丰儀" },
-    { "丰台", "豐臺" },
-    { "丰度", "豐度" },
-    { "丰标", "丰標" },
-    { "丰标不凡", "丰標不凡" },
-    { "丰滨", "豐濱" },
-    { "丰滨乡", "豐濱鄉" },
-    { "丰韵", "丰韻" },
-    { "临", "臨" },
-    { "临潼斗宝", "臨潼鬥寶" },
-    { "丹棱", "丹稜" },
-    { "为", "為" },
-    { "为准", "為準" },
-    { "为鉴", "為鑑" },
-    { "主仆", "主僕" },
-    { "主干", "主幹" },
-    { "主钟差", "主鐘差" },
-    { "主钟曲线", "主鐘曲線" },
-    { "丽", "麗" },
-    { "举", "舉" },
-    { "举手表", "舉手表" },
-    { "乃系", "乃係" },
-    { "么", "麼" },
-    { "义", "義" },
-    { "义仆", "義僕" },
-    { "之余", "之餘" },
-    { "之征", "之徵" },
-    { "之托", "之託" },
-    { "之鉴", "之鑑" },
-    { "之钟", "之鐘" },
-    { "乌", "烏" },
-    { "乌兹冲锋枪", "烏茲衝鋒槍" },
-    { "乌发", "烏髮" },
-    { "乌苏里", "烏蘇里" },
-    { "乌龙面", "烏龍麵" },
-    { "乐", "樂" },
-    { "乐器钟", "樂器鐘" },
-    { "乐游原", "樂遊原" },
-    { "乔", "喬" },
-    { "乔岳", "喬嶽" },
-    { "九世之仇", "九世之讎" },
-    { "九个", "九個" },
-    { "九余", "九餘" },
-    { "九只", "九隻" },
-    { "九周后", "九周後" },
-    { "九天后", "九天後" },
-    { "九扎", "九紮" },
-    { "九谷", "九穀" },
-    { "习", "習" },
-    { "乡", "鄉" },
-    { "乡愿", "鄉愿" },
-    { "书", "書" },
-    { "书签", "書籤" },
-    { "书面", "書面" },
-    { "买", "買" },
-    { "买凶", "買兇" },
-    { "买断发", "買斷發" },
-    { "乱", "亂" },
-    { "乱发", "亂髮" },
-    { "乱发生", "亂發生" },
-    { "乱发脾气", "亂發脾氣" },
-    { "乱哄哄", "亂鬨鬨" },
-    { "乱斗", "亂鬥" },
-    { "乾象历", "乾象曆" },
-    { "了望", "瞭望" },
-    { "了然", "瞭然" },
-    { "了然后", "了然後" },
-    { "了若指掌", "瞭若指掌" },
-    { "争", "爭" },
-    { "争奇斗妍", "爭奇鬥妍" },
-    { "争奇斗异", "爭奇鬥異" },
-    { "争奇斗艳", "爭奇鬥豔" },
-    { "争妍斗奇", "爭妍鬥奇" },
-    { "争妍斗艳", "爭妍鬥豔" },
-    { "争斗", "爭鬥" },
-    { "争红斗紫", "爭紅鬥紫" },
-    { "事有斗巧", "事有鬥巧" },
-    { "事里", "事裡" },
-    { "二不棱登", "二不稜登" },
-    { "二个", "二個" },
-    { "二余", "二餘" },
-    { "二只", "二隻" },
-    { "二周后", "二周後" },
-    { "二天后", "二天後" },
-    { "二缶钟惑", "二缶鐘惑" },
-    { "二虎相斗", "二虎相鬥" },
-    { "二里头", "二里頭" },
-    { "于", "於" },
-    { "于云鹤", "于雲鶴" },
-    { "于从濂", "于從濂" },
-    { "于会泳", "于會泳" },
-    { "于伟国", "于偉國" },
-    { "于余曲折", "于餘曲折" },
-    { "于光远", "于光遠" },
-    { "于冠华", "于冠華" },
-    { "于凤桐", "于鳳桐" },
-    { "于凤至", "于鳳至" },
-    { "于友泽", "于友澤" },
-    { "于双戈", "于雙戈" },
-    { "于台烟", "于台煙" },
-    { "于和伟", "于和偉" },
-    { "于国桢", "于國楨" },
-    { "于国治", "于國治" },
-    { "于坚", "于堅" },
-    { "于大宝", "于大寶" },
-    { "于天龙", "于天龍" },
-    { "于奇库杜克", "于奇庫杜克" },
-    { "于学忠", "于學忠" },
-    { "于宝轩", "于寶軒" },
-    { "于小伟", "于小偉" },
-    { "于尔岑", "于爾岑" },
-    { "于尔根", "于爾根" },
-    { "于尔里克", "于爾里克" },
-    { "于山东", "於山東" },
-    { "于山国", "于山國" },
-    { "于山西", "於山西" },
-    { "于帅", "于帥" },
-    { "于幼军", "于幼軍" },
-    { "于广洲", "于廣洲" },
-    { "于建嵘", "于建嶸" },
-    { "于归", "于歸" },
-    { "于志宁", "于志寧" },
-    { "于忠肃集", "于忠肅集" },
-    { "于成龙", "于成龍" },
-    { "于斯达尔", "于斯達爾" },
-    { "于明涛", "于明濤" },
-    { "于来山", "于來山" },
-    { "于枫", "于楓" },
-    { "于树洁", "于樹潔" },
-    { "于根伟", "于根偉" },
-    { "于汉超", "于漢超" },
-    { "于泽尔", "于澤爾" },
-    { "于洪区", "于洪區" },
-    { "于海上", "於海上" },
-    { "于海拔", "於海拔" },
-    { "于海边", "於海邊" },
-    { "于涛", "于濤" },
-    { "于湘兰", "于湘蘭" },
-    { "于荣光", "于榮光" },
-    { "于荫霖", "于蔭霖" },
-    { "于谦", "于謙" },
-    { "于谨", "于謹" },
-    { "于贝尔", "于貝爾" },
-    { "于赠", "于贈" },
-    { "于远伟", "于遠偉" },
-    { "于都县", "于都縣" },
-    { "于阗", "于闐" },
-    { "于震中", "於震中" },
-    { "于震前", "於震前" },
-    { "于震后", "於震後" },
-    { "于震环", "于震環" },
-    { "于非暗", "于非闇" },
-    { "于韦斯屈莱", "于韋斯屈萊" },
-    { "于风政", "于風政" },
-    { "于飞", "于飛" },
-    { "于默奥", "于默奧" },
-    { "亏", "虧" },
-    { "云", "雲" },
-    { "云为", "云為" },
-    { "云南个旧", "雲南箇舊" },
-    { "云吞", "雲吞" },
-    { "云吞面", "雲吞麵" },
-    { "云尔", "云爾" },
-    { "云游", "雲遊" },
-    { "云笈七签", "雲笈七籤" },
-    { "云里雾里", "雲裡霧裡" },
-    { "云须", "雲鬚" },
-    { "五个", "五個" },
-    { "五余", "五餘" },
-    { "五只", "五隻" },
-    { "五周后", "五周後" },
-    { "五天后", "五天後" },
-    { "五岳", "五嶽" },
-    { "五峰县", "五峯縣" },
-    { "五扎", "五紮" },
-    { "五脏", "五臟" },
-    { "五行生克", "五行生剋" },
-    { "五谷", "五穀" },
-    { "井干", "井幹" },
-    { "井里", "井裡" },
-    { "亚", "亞" },
-    { "交哄", "交鬨" },
-    { "交托", "交託" },
-    { "交游", "交遊" },
-    { "产", "產" },
-    { "亩", "畝" },
-    { "京沈", "京瀋" },
-    { "亮丑", "亮醜" },
-    { "亮钟", "亮鐘" },
-    { "亲", "親" },
-    { "亵", "褻" },
-    { "人发指", "人髮指" },
-    { "人干的", "人幹的" },
-    { "人数只", "人數只" },
-    { "人数里", "人數裡" },
-    { "人欲", "人慾" },
-    { "人物志", "人物誌" },
-    { "亿", "億" },
-    { "亿个", "億個" },
-    { "亿余", "億餘" },
-    { "亿只", "億隻" },
-    { "亿周后", "億周後" },
-    { "亿天后", "億天後" },
-    { "什锦面", "什錦麵" },
-    { "仁贵", "仁貴" },
-    { "仅", "僅" },
-    { "仅余", "僅餘" },
-    { "仆人", "僕人" },
-    { "仆仆", "僕僕" },
-    { "仆从", "僕從" },
-    { "仆使", "僕使" },
-    { "仆僮", "僕僮" },
-    { "仆吏", "僕吏" },
-    { "仆固怀恩", "僕固懷恩" },
-    { "仆夫", "僕夫" },
-    { "仆妇", "僕婦" },
-    { "仆姑", "僕姑" },
-    { "仆婢", "僕婢" },
-    { "仆射", "僕射" },
-    { "仆少", "僕少" },
-    { "仆役", "僕役" },
-    { "仆憎", "僕憎" },
-    { "仆欧", "僕歐" },
-    { "仆程", "僕程" },
-    { "仆虽罢驽", "僕雖罷駑" },
-    { "仇隙", "讎隙" },
-    { "介胄", "介冑" },
-    { "从", "從" },
-    { "从仆", "從僕" },
-    { "从图里", "從圖裡" },
-    { "从山里", "從山裡" },
-    { "从里到外", "從裡到外" },
-    { "从里向外", "從裡向外" },
-    { "仑", "侖" },
-    { "仓", "倉" },
-    { "他干的", "他幹的" },
-    { "付托", "付託" },
-    { "仙游", "仙遊" },
-    { "代数里", "代數裡" },
-    { "代理发行", "代理發行" },
-    { "代码表", "代碼表" },
-    { "仪", "儀" },
-    { "仪范", "儀範" },
-    { "们", "們" },
-    { "们干的", "們幹的" },
-    { "件钟", "件鐘" },
-    { "价", "價" },
-    { "任何钟", "任何鐘" },
-    { "任何钟表", "任何鐘錶" },
-    { "仿制", "仿製" },
-    { "伊东怜", "伊東怜" },
-    { "伊尔汗历表", "伊爾汗曆表" },
-    { "伊府面", "伊府麵" },
-    { "伊斯兰历", "伊斯蘭曆" },
-    { "伊斯兰历史", "伊斯蘭歷史" },
-    { "伊斯兰教历", "伊斯蘭教曆" },
-    { "伊斯兰教历史", "伊斯蘭教歷史" },
-    { "伊达里子", "伊達里子" },
-    { "伊适杰", "伊適杰" },
-    { "伊郁", "伊鬱" },
-    { "伐罪吊民", "伐罪弔民" },
-    { "休征", "休徵" },
-    { "众", "眾" },
-    { "优", "優" },
-    { "优游", "優遊" },
-    { "伙众", "夥眾" },
-    { "伙伴", "夥伴" },
-    { "伙友", "夥友" },
-    { "伙同", "夥同" },
-    { "伙头", "伙頭" },
-    { "伙计", "夥計" },
-    { "会", "會" },
-    { "会吊", "會弔" },
-    { "会干", "會幹" },
-    { "会干扰", "會干擾" },
-    { "会里", "會裡" },
-    { "伛", "傴" },
-    { "伞", "傘" },
-    { "伟", "偉" },
-    { "传", "傳" },
-    { "传位于四太子", "傳位于四太子" },
-    { "伤", "傷" },
-    { "伥", "倀" },
-    { "伦", "倫" },
-    { "伧", "傖" },
-    { "伪", "偽" },
-    { "伫", "佇" },
-    { "伴游", "伴遊" },
-    { "位准", "位準" },
-    { "住扎", "住紮" },
-    { "体", "體" },
-    { "体征", "體徵" },
-    { "体系", "體系" },
-    { "体范", "體範" },
-    { "体里", "體裡" },
-    { "余〇", "餘〇" },
-    { "余一", "餘一" },
-    { "余七", "餘七" },
-    { "余三", "餘三" },
-    { "余三胜", "余三勝" },
-    { "余下", "餘下" },
-    { "余业", "餘業" },
-    { "余九", "餘九" },
-    { "余事", "餘事" },
-    { "余二", "餘二" },
-    { "余五", "餘五" },
-    { "余人", "餘人" },
-    { "余众", "餘眾" },
-    { "余俗", "餘俗" },
-    { "余倍", "餘倍" },
-    { "余僇", "餘僇" },
-    { "余光", "餘光" },
-    { "余党", "餘黨" },
-    { "余八", "餘八" },
-    { "余六", "餘六" },
-    { "余兴", "餘興" },
-    { "余刃", "餘刃" },
-    { "余切", "餘切" },
-    { "余利", "餘利" },
-    { "余割", "餘割" },
-    { "余力", "餘力" },
-    { "余力为", "余力為" },
-    { "余勇", "餘勇" },
-    { "余十", "餘十" },
-    { "余味", "餘味" },
-    { "余响", "餘響" },
-    { "余喘", "餘喘" },
-    { "余四", "餘四" },
-    { "余地", "餘地" },
-    { "余墨", "餘墨" },
-    { "余声", "餘聲" },
-    { "余外", "餘外" },
-    { "余妙", "餘妙" },
-    { "余姚", "餘姚" },
-    { "余威", "餘威" },
-    { "余子", "餘子" },
-    { "余存", "餘存" },
-    { "余孽", "餘孽" },
-    { "余干", "餘干" },
-    { "余年", "餘年" },
-    { "余庆", "餘慶" },
-    { "余式", "餘式" },
-    { "余弦", "餘弦" },
-    { "余思", "餘思" },
-    { "余悸", "餘悸" },
-    { "余数", "餘數" },
-    { "余明", "餘明" },
-    { "余映", "餘映" },
-    { "余晖", "餘暉" },
-    { "余暇", "餘暇" },
-    { "余杭", "餘杭" },
-    { "余杯", "餘杯" },
-    { "余桃", "餘桃" },
-    { "余桶", "餘桶" },
-    { "余欢", "餘歡" },
-    { "余款", "餘款" },
-    { "余步", "餘步" },
-    { "余殃", "餘殃" },
-    { "余毒", "餘毒" },
-    { "余气", "餘氣" },
-    { "余江", "餘江" },
-    { "余沥", "餘瀝" },
-    { "余波", "餘波" },
-    { "余泽", "餘澤" },
-    { "余温", "餘溫" },
-    { "余烈", "餘烈" },
-    { "余烬", "餘燼" },
-    { "余热", "餘熱" },
-    { "余珍", "餘珍" },
-    { "余生", "餘生" },
-    { "余留", "餘留" },
-    { "余窍", "餘竅" },
-    { "余粮", "餘糧" },
-    { "余绪", "餘緒" },
-    { "余缺", "餘缺" },
-    { "余罪", "餘罪" },
-    { "余羡", "餘羨" },
-    { "余膏", "餘膏" },
-    { "余荫", "餘蔭" },
-    { "余蓄", "餘蓄" },
-    { "余裕", "餘裕" },
-    { "余角", "餘角" },
-    { "余论", "餘論" },
-    { "余貾", "餘貾" },
-    { "余责", "餘責" },
-    { "余辉", "餘輝" },
-    { "余辜", "餘辜" },
-    { "余部", "餘部" },
-    { "余酲", "餘酲" },
-    { "余量", "餘量" },
-    { "余闰", "餘閏" },
-    { "余闲", "餘閒" },
-    { "余零", "餘零" },
-    { "余震", "餘震" },
-    { "余霞", "餘霞" },
-    { "余音", "餘音" },
-    { "余韵", "餘韻" },
-    { "余项", "餘項" },
-    { "余额", "餘額" },
-    { "余风", "餘風" },
-    { "余食", "餘食" },
-    { "佛罗棱萨", "佛羅稜薩" },
-    { "佛钟", "佛鐘" },
-    { "作准", "作準" },
-    { "作品里", "作品裡" },
-    { "你夸", "你誇" },
-    { "佣", "傭" },
-    { "佣仆", "傭僕" },
-    { "佣钱", "佣錢" },
-    { "佣钿", "佣鈿" },
-    { "佥", "僉" },
-    { "使其斗", "使其鬥" },
-    { "侍仆", "侍僕" },
-    { "依依不舍", "依依不捨" },
-    { "依托", "依託" },
-    { "侠", "俠" },
-    { "侣", "侶" },
-    { "侥", "僥" },
-    { "侥幸", "僥倖" },
-    { "侦", "偵" },
-    { "侧", "側" },
-    { "侨", "僑" },
-    { "侩", "儈" },
-    { "侪", "儕" },
-    { "侬", "儂" },
-    { "侵并", "侵併" },
-    { "保险柜", "保險柜" },
-    { "信托", "信託" },
-    { "信托贸易", "信托貿易" },
-    { "俣", "俁" },
-    { "俦", "儔" },
-    { "俨", "儼" },
-    { "俩", "倆" },
-    { "俪", "儷" },
-    { "俭", "儉" },
-    { "俭仆", "儉僕" },
-    { "俭朴", "儉樸" },
-    { "俭确之教", "儉确之教" },
-    { "修筑前", "修築前" },
-    { "修筑后", "修築後" },
-    { "修胡刀", "修鬍刀" },
-    { "俯冲", "俯衝" },
-    { "候复", "候覆" },
-    { "倚闲", "倚閑" },
-    { "倛丑", "倛醜" },
-    { "借以", "藉以" },
-    { "借助", "藉助" },
-    { "借口", "藉口" },
-    { "借寇兵", "藉寇兵" },
-    { "借手", "藉手" },
-    { "借故", "藉故" },
-    { "借机", "藉機" },
-    { "借此", "藉此" },
-    { "借由", "藉由" },
-    { "借箸代筹", "藉箸代籌" },
-    { "借资", "藉資" },
-    { "借鉴", "借鑑" },
-    { "倦游", "倦遊" },
-    { "债", "債" },
-    { "债累累", "債纍纍" },
-    { "倾", "傾" },
-    { "假发", "假髮" },
-    { "假发票", "假發票" },
-    { "假托", "假託" },
-    { "假里", "假裡" },
-    { "偎干", "偎乾" },
-    { "停停当当", "停停當當" },
-    { "停制", "停製" },
-    { "停征", "停徵" },
-    { "偬", "傯" },
-    { "偻", "僂" },
-    { "偾", "僨" },
-    { "偿", "償" },
-    { "傥", "儻" },
-    { "傧", "儐" },
-    { "储", "儲" },
-    { "傩", "儺" },
-    { "催并", "催併" },
-    { "傲游", "傲遊" },
-    { "傲霜斗雪", "傲霜鬥雪" },
-    { "傻里傻气", "傻裡傻氣" },
-    { "像赞", "像讚" },
-    { "僮仆", "僮僕" },
-    { "僵尸", "殭屍" },
-    { "儒略历", "儒略曆" },
-    { "儒略历史", "儒略歷史" },
-    { "儒略改革历", "儒略改革曆" },
-    { "儒略改革历史", "儒略改革歷史" },
-    { "儿", "兒" },
-    { "兀术", "兀朮" },
-    { "元凶", "元兇" },
-    { "兆个", "兆個" },
-    { "兆余", "兆餘" },
-    { "先采", "先採" },
-    { "光致致", "光緻緻" },
-    { "克剥", "剋剝" },
-    { "克扣", "剋扣" },
-    { "克期", "剋期" },
-    { "克期间", "克期間" },
-    { "克死", "剋死" },
-    { "克薄", "剋薄" },
-    { "免征", "免徵" },
-    { "兑", "兌" },
-    { "兖", "兗" },
-    { "党", "黨" },
-    { "党怀英", "党懷英" },
-    { "党进", "党進" },
-    { "党项", "党項" },
-    { "全干", "全乾" },
-    { "八个", "八個" },
-    { "八余", "八餘" },
-    { "八只", "八隻" },
-    { "八周后", "八周後" },
-    { "八天后", "八天後" },
-    { "八字胡", "八字鬍" },
-    { "八扎", "八紮" },
-    { "公仆", "公僕" },
-    { "公仔面", "公仔麵" },
-    { "公余", "公餘" },
-    { "公历", "公曆" },
-    { "公历史", "公歷史" },
-    { "公孙丑", "公孫丑" },
-    { "公寓里", "公寓裡" },
-    { "公干", "公幹" },
-    { "六个", "六個" },
-    { "六余", "六餘" },
-    { "六冲", "六衝" },
-    { "六只", "六隻" },
-    { "六周后", "六周後" },
-    { "六天后", "六天後" },
-    { "六扎", "六紮" },
-    { "六楼后座", "六樓后座" },
-    { "六谷", "六穀" },
-    { "兰", "蘭" },
-    { "兰溪市", "蘭谿市" },
-    { "共和历", "共和曆" },
-    { "共和历史", "共和歷史" },
-    { "关", "關" },
-    { "关系", "關係" },
-    { "关系列", "關系列" },
-    { "关系所", "關系所" },
-    { "关系科", "關系科" },
-    { "关系统", "關系統" },
-    { "兴", "興" },
-    { "其余", "其餘" },
-    { "典范", "典範" },
-    { "兹", "茲" },
-    { "养", "養" },
-    { "养脏", "養臟" },
-    { "兼并", "兼併" },
-    { "兽", "獸" },
-    { "兽欲", "獸慾" },
-    { "冁", "囅" },
-    { "内", "內" },
-    { "内制", "內製" },
-    { "内哄", "內鬨" },
-    { "内斗", "內鬥" },
-    { "内脏", "內臟" },
-    { "内面包", "內面包" },
-    { "内面包的", "內面包的" },
-    { "冈", "岡" },
-    { "冉有仆", "冉有僕" },
-    { "册", "冊" },
-    { "冗余", "冗餘" },
-    { "写", "寫" },
-    { "写字台", "寫字檯" },
-    { "军", "軍" },
-    { "农", "農" },
-    { "农历", "農曆" },
-    { "农历史", "農歷史" },
-    { "农民历", "農民曆" },
-    { "农民历史", "農民歷史" },
-    { "冤仇", "冤讎" },
-    { "冥蒙", "冥濛" },
-    { "冬冬鼓", "鼕鼕鼓" },
-    { "冬游", "冬遊" },
-    { "冯", "馮" },
-    { "冰山里", "冰山裡" },
-    { "冲", "沖" },
-    { "冲上", "衝上" },
-    { "冲下", "衝下" },
-    { "冲倒", "衝倒" },
-    { "冲克", "衝剋" },
-    { "冲冠", "衝冠" },
-    { "冲冠发怒", "沖冠髮怒" },
-    { "冲决", "衝決" },
-    { "冲出", "衝出" },
-    { "冲击", "衝擊" },
-    { "冲到", "衝到" },
-    { "冲刺", "衝刺" },
-    { "冲力", "衝力" },
-    { "冲动", "衝動" },
-    { "冲劲", "衝勁" },
-    { "冲压", "衝壓" },
-    { "冲去", "衝去" },
-    { "冲口", "衝口" },
-    { "冲坚陷阵", "衝堅陷陣" },
-    { "冲垮", "衝垮" },
-    { "冲堂", "衝堂" },
-    { "冲天", "沖天" },
-    { "冲天炮", "衝天炮" },
-    { "冲头阵", "衝頭陣" },
-    { "冲州撞府", "衝州撞府" },
-    { "冲心", "衝心" },
-    { "冲掉", "衝掉" },
-    { "冲撞", "衝撞" },
-    { "冲散", "衝散" },
-    { "冲杀", "衝殺" },
-    { "冲来", "衝來" },
-    { "冲波", "衝波" },
-    { "冲浪", "衝浪" },
-    { "冲激", "衝激" },
-    { "冲然", "衝然" },
-    { "冲盹", "衝盹" },
-    { "冲着", "衝着" },
-    { "冲破", "衝破" },
-    { "冲程", "衝程" },
-    { "冲突", "衝突" },
-    { "冲线", "衝線" },
-    { "冲要", "衝要" },
-    { "冲起", "衝起" },
-    { "冲车", "衝車" },
-    { "冲过", "衝過" },
-    { "冲进", "衝進" },
-    { "冲量", "衝量" },
-    { "冲锋", "衝鋒" },
-    { "冲锋枪", "衝鋒鎗" },
-    { "冲陷", "衝陷" },
-    { "冲风", "衝風" },
-    { "决", "決" },
-    { "决斗", "決鬥" },
-    { "况", "況" },
-    { "冶游", "冶遊" },
-    { "冷面", "冷麵" },
-    { "冻", "凍" },
-    { "净", "淨" },
-    { "净余", "淨餘" },
-    { "净发", "淨髮" },
-    { "凄", "淒" },
-    { "凄厉", "悽厲" },
-    { "凄怆", "悽愴" },
-    { "凄怨", "悽怨" },
-    { "凄恻", "悽惻" },
-    { "凄惋", "悽惋" },
-    { "凄惨", "悽慘" },
-    { "凄惶", "悽惶" },
-    { "凄戾", "悽戾" },
-    { "凄然", "悽然" },
-    { "凄美", "悽美" },
-    { "凄苦", "悽苦" },
-    { "凄酸", "悽酸" },
-    { "准不准", "準不準" },
-    { "准会", "準會" },
-    { "准例", "準例" },
-    { "准保", "準保" },
-    { "准保护", "准保護" },
-    { "准保释", "准保釋" },
-    { "准儿", "準兒" },
-    { "准军事", "準軍事" },
-    { "准决赛", "準決賽" },
-    { "准分子", "準分子" },
-    { "准则", "準則" },
-    { "准噶尔", "準噶爾" },
-    { "准备", "準備" },
-    { "准头", "準頭" },
-    { "准定", "準定" },
-    { "准平原", "準平原" },
-    { "准度", "準度" },
-    { "准式", "準式" },
-    { "准拟", "準擬" },
-    { "准拿督", "準拿督" },
-    { "准据", "準據" },
-    { "准新娘", "準新娘" },
-    { "准新郎", "準新郎" },
-    { "准时", "準時" },
-    { "准星", "準星" },
-    { "准是", "準是" },
-    { "准点", "準點" },
-    { "准的", "準的" },
-    { "准直", "準直" },
-    { "准确", "準確" },
-    { "准线", "準線" },
-    { "准绳", "準繩" },
-    { "准话", "準話" },
-    { "准谱", "準譜" },
-    { "准货币", "準貨幣" },
-    { "凉", "涼" },
-    { "凉席", "涼蓆" },
-    { "凉面", "涼麵" },
-    { "凌蒙初", "凌濛初" },
-    { "减", "減" },
-    { "凑", "湊" },
-    { "凛", "凜" },
-    { "凝炼", "凝鍊" },
-    { "几", "幾" },
-    { "几个", "幾個" },
-    { "几净窗明", "几淨窗明" },
-    { "几出", "幾齣" },
-    { "几只", "幾隻" },
-    { "几周后", "幾周後" },
-    { "几天后", "幾天後" },
-    { "几进几出", "幾進幾出" },
-    { "凤", "鳳" },
-    { "凤梨干", "鳳梨乾" },
-    { "凫", "鳧" },
-    { "凭", "憑" },
-    { "凭借", "憑藉" },
-    { "凭准", "憑準" },
-    { "凭几", "憑几" },
-    { "凭吊", "憑弔" },
-    { "凭折", "憑摺" },
-    { "凭闲", "憑閑" },
-    { "凯", "凱" },
-    { "凶刀", "兇刀" },
-    { "凶器", "兇器" },
-    { "凶嫌", "兇嫌" },
-    { "凶巴巴", "兇巴巴" },
-    { "凶征", "凶徵" },
-    { "凶徒", "兇徒" },
-    { "凶恶", "兇惡" },
-    { "凶悍", "兇悍" },
-    { "凶手", "兇手" },
-    { "凶杀", "兇殺" },
-    { "凶枪", "兇槍" },
-    { "凶案", "兇案" },
-    { "凶横", "兇橫" },
-    { "凶残", "兇殘" },
-    { "凶犯", "兇犯" },
-    { "凶狠", "兇狠" },
-    { "凶猛", "兇猛" },
-    { "凶疑", "兇疑" },
-    { "凶相", "兇相" },
-    { "凶相毕露", "凶相畢露" },
-    { "凶险", "兇險" },
-    { "出丑", "出醜" },
-    { "出乖弄丑", "出乖弄醜" },
-    { "出乖露丑", "出乖露醜" },
-    { "出游", "出遊" },
-    { "击", "擊" },
-    { "击扑", "擊扑" },
-    { "击钟", "擊鐘" },
-    { "函数里", "函數裡" },
-    { "凿", "鑿" },
-    { "分半钟", "分半鐘" },
-    { "分多钟", "分多鐘" },
-    { "分子云", "分子雲" },
-    { "分子钟", "分子鐘" },
-    { "分钟", "分鐘" },
-    { "分钟里", "分鐘裡" },
-    { "刍", "芻" },
-    { "刑余", "刑餘" },
-    { "划", "劃" },
-    { "划一桨", "划一槳" },
-    { "划不来", "划不來" },
-    { "划为", "劃為" },
-    { "划了一会", "划了一會" },
-    { "划入", "劃入" },
-    { "划动", "划動" },
-    { "划得来", "划得來" },
-    { "划来划去", "划來划去" },
-    { "划桨", "划槳" },
-    { "划着独木舟", "划着獨木舟" },
-    { "划过", "划過" },
-    { "划进", "划進" },
-    { "划龙舟", "划龍舟" },
-    { "划龙船", "划龍船" },
-    { "刘", "劉" },
-    { "刘佳怜", "劉佳怜" },
-    { "刘芸后", "劉芸后" },
-    { "则", "則" },
-    { "刚", "剛" },
-    { "刚干", "剛乾" },
-    { "刚雇", "剛僱" },
-    { "创", "創" },
-    { "创制", "創製" },
-    { "创获", "創穫" },
-    { "删", "刪" },
-    { "判断发", "判斷發" },
-    { "利欲", "利慾" },
-    { "别", "別" },
-    { "别扭", "彆扭" },
-    { "别拗", "彆拗" },
-    { "别气", "彆氣" },
-    { "别辟", "別闢" },
-    { "刭", "剄" },
-    { "刮了", "颳了" },
-    { "刮倒", "颳倒" },
-    { "刮大风", "颳大風" },
-    { "刮得", "颳得" },
-    { "刮胡", "刮鬍" },
-    { "刮走", "颳走" },
-    { "刮起", "颳起" },
-    { "刮起来", "刮起來" },
-    { "刮雪", "颳雪" },
-    { "刮风", "颳風" },
-    { "刮风后", "颳風後" },
-    { "到山里", "到山裡" },
-    { "制件", "製件" },
-    { "制作", "製作" },
-    { "制做", "製做" },
-    { "制冰", "製冰" },
-    { "制冷", "製冷" },
-    { "制冷机", "制冷機" },
-    { "制剂", "製劑" },
-    { "制取", "製取" },
-    { "制品", "製品" },
-    { "制图", "製圖" },
-    { "制备", "製備" },
-    { "制得", "製得" },
-    { "制成", "製成" },
-    { "制毒", "製毒" },
-    { "制法", "製法" },
-    { "制浆", "製漿" },
-    { "制片", "製片" },
-    { "制版", "製版" },
-    { "制盐", "製鹽" },
-    { "制程", "製程" },
-    { "制签", "制籤" },
-    { "制糖", "製糖" },
-    { "制纸", "製紙" },
-    { "制药", "製藥" },
-    { "制衣", "製衣" },
-    { "制表键", "製表鍵" },
-    { "制贩", "製販" },
-    { "制造", "製造" },
-    { "制钟", "制鐘" },
-    { "制革", "製革" },
-    { "制鞋", "製鞋" },
-    { "刹", "剎" },
-    { "刻半钟", "刻半鐘" },
-    { "刻多钟", "刻多鐘" },
-    { "刻钟", "刻鐘" },
-    { "刽", "劊" },
-    { "刿", "劌" },
-    { "剀", "剴" },
-    { "剂", "劑" },
-    { "剃发", "剃髮" },
-    { "剃胡", "剃鬍" },
-    { "剃须", "剃鬚" },
-    { "削发", "削髮" },
-    { "削面", "削麵" },
-    { "剐", "剮" },
-    { "剑", "劍" },
-    { "剖厘", "剖釐" },
-    { "剥", "剝" },
-    { "剥制", "剝製" },
-    { "剧", "劇" },
-    { "剩余", "剩餘" },
-    { "剪其发", "剪其髮" },
-    { "剪发", "剪髮" },
-    { "割舍", "割捨" },
-    { "力争上游", "力爭上遊" },
-    { "劝", "勸" },
-    { "办", "辦" },
-    { "办公台", "辦公檯" },
-    { "功勋", "功勳" },
-    { "加氢精制", "加氫精制" },
-    { "务", "務" },
-    { "劢", "勱" },
-    { "动", "動" },
-    { "劫余", "劫餘" },
-    { "励", "勵" },
-    { "劲", "勁" },
-    { "劳", "勞" },
-    { "势", "勢" },
-    { "勃郁", "勃鬱" },
-    { "勋", "勛" },
-    { "勋业", "勳業" },
-    { "勋劳", "勳勞" },
-    { "勋爵", "勳爵" },
-    { "勋章", "勳章" },
-    { "勋绩", "勳績" },
-    { "勤仆", "勤僕" },
-    { "勤朴", "勤樸" },
-    { "勾干", "勾幹" },
-    { "勾心斗角", "勾心鬥角" },
-    { "勾魂荡魄", "勾魂蕩魄" },
-    { "匀", "勻" },
-    { "包准", "包準" },
-    { "包干", "包幹" },
-    { "包扎", "包紮" },
-    { "包谷", "包穀" },
-    { "匏系", "匏繫" },
-    { "北仑河", "北崙河" },
-    { "北回线", "北迴線" },
-    { "北回铁路", "北迴鐵路" },
-    { "北山索面", "北山索麵" },
-    { "北岳", "北嶽" },
-    { "匦", "匭" },
-    { "匪干", "匪幹" },
-    { "匮", "匱" },
-    { "区", "區" },
-    { "区里有", "區裡有" },
-    { "区里的", "區裡的" },
-    { "医", "醫" },
-    { "十个", "十個" },
-    { "十余", "十餘" },
-    { "十出", "十齣" },
-    { "十出击", "十出擊" },
-    { "十出头", "十出頭" },
-    { "十只", "十隻" },
-    { "十周后", "十周後" },
-    { "十天后", "十天後" },
-    { "十扎", "十紮" },
-    { "千个", "千個" },
-    { "千余", "千餘" },
-    { "千只", "千隻" },
-    { "千只够", "千只夠" },
-    { "千只足够", "千只足夠" },
-    { "千周后", "千周後" },
-    { "千回百折", "千迴百折" },
-    { "千回百转", "千迴百轉" },
-    { "千天后", "千天後" },
-    { "千扎", "千紮" },
-    { "千钧一发", "千鈞一髮" },
-    { "升州", "昇州" },
-    { "升平", "昇平" },
-    { "升阳", "昇陽" },
-    { "升高后", "升高後" },
-    { "半只", "半隻" },
-    { "半只够", "半只夠" },
-    { "华", "華" },
-    { "华严钟", "華嚴鐘" },
-    { "协", "協" },
-    { "协防", "協防" },
-    { "单", "單" },
-    { "单于", "單于" },
-    { "单单于", "單單於" },
-    { "单向", "單向" },
-    { "单干", "單幹" },
-    { "单打独斗", "單打獨鬥" },
-    { "卖", "賣" },
-    { "卖断发", "賣斷發" },
-    { "南京钟", "南京鐘" },
-    { "南京钟表", "南京鐘錶" },
-    { "南回线", "南迴線" },
-    { "南回铁路", "南迴鐵路" },
-    { "南宫适", "南宮适" },
-    { "南屏晚钟", "南屏晚鐘" },
-    { "南岳", "南嶽" },
-    { "南游", "南遊" },
-    { "博尔术", "博爾朮" },
-    { "博杰普尔", "博杰普爾" },
-    { "博采", "博採" },
-    { "占头筹", "佔頭籌" },
-    { "占毕", "佔畢" },
-    { "占高枝儿", "佔高枝兒" },
-    { "卢", "盧" },
-    { "卢棱伽", "盧稜伽" },
-    { "卤", "鹵" },
-    { "卤了", "滷了" },
-    { "卤五花", "滷五花" },
-    { "卤制", "滷製" },
-    { "卤味", "滷味" },
-    { "卤好", "滷好" },
-    { "卤子", "滷子" },
-    { "卤料", "滷料" },
-    { "卤水", "滷水" },
-    { "卤汁", "滷汁" },
-    { "卤湖", "滷湖" },
-    { "卤煮", "滷煮" },
-    { "卤牛", "滷牛" },
-    { "卤的", "滷的" },
-    { "卤肉", "滷肉" },
-    { "卤菜", "滷菜" },
-    { "卤虾", "滷蝦" },
-    { "卤蛋", "滷蛋" },
-    { "卤豆", "滷豆" },
-    { "卤面", "滷麵" },
-    { "卤鸡", "滷雞" },
-    { "卤鸭", "滷鴨" },
-    { "卤鹅", "滷鵝" },
-    { "卧", "臥" },
-    { "卧游", "臥遊" },
-    { "卫", "衛" },
-    { "卫后庄公", "衛後莊公" },
-    { "卫星钟", "衛星鐘" },
-    { "印制", "印製" },
-    { "印累绶若", "印纍綬若" },
-    { "印鉴", "印鑑" },
-    { "却", "卻" },
-    { "卵与石斗", "卵與石鬥" },
-    { "卷云", "捲雲" },
-    { "卷住", "捲住" },
-    { "卷儿", "捲兒" },
-    { "卷入", "捲入" },
-    { "卷动", "捲動" },
-    { "卷去", "捲去" },
-    { "卷发", "捲髮" },
-    { "卷叶蛾", "捲葉蛾" },
-    { "卷图", "捲圖" },
-    { "卷土重来", "捲土重來" },
-    { "卷地", "捲地" },
-    { "卷尺", "捲尺" },
-    { "卷尾猴", "捲尾猴" },
-    { "卷帘", "捲簾" },
-    { "卷心菜", "捲心菜" },
-    { "卷成", "捲成" },
-    { "卷曲", "捲曲" },
-    { "卷来", "捲來" },
-    { "卷款", "捲款" },
-    { "卷毛", "捲毛" },
-    { "卷烟", "捲菸" },
-    { "卷烟盒", "捲煙盒" },
-    { "卷瓣", "捲瓣" },
-    { "卷积云", "捲積雲" },
-    { "卷筒", "捲筒" },
-    { "卷纸", "捲紙" },
-    { "卷缩", "捲縮" },
-    { "卷舌", "捲舌" },
-    { "卷袖", "捲袖" },
-    { "卷走", "捲走" },
-    { "卷起", "捲起" },
-    { "卷轴", "捲軸" },
-    { "卷逃", "捲逃" },
-    { "卷铺盖", "捲鋪蓋" },
-    { "卷须", "卷鬚" },
-    { "卷风", "捲風" },
-    { "厂", "廠" },
-    { "厅", "廳" },
-    { "历", "歷" },
-    { "历书", "曆書" },
-    { "历元", "曆元" },
-    { "历史里", "歷史裡" },
-    { "历命", "曆命" },
-    { "历始", "曆始" },
-    { "历室", "曆室" },
-    { "历尾", "曆尾" },
-    { "历局", "曆局" },
-    { "历数书", "曆數書" },
-    { "历日", "曆日" },
-    { "历本", "曆本" },
-    { "历法", "曆法" },
-    { "历物之意", "厤物之意" },
-    { "历狱", "曆獄" },
-    { "历纪", "曆紀" },
-    { "历象", "曆象" },
-    { "厉", "厲" },
-    { "压", "壓" },
-    { "压制出", "壓製出" },
-    { "压制机", "壓製機" },
-    { "厌", "厭" },
-    { "厍", "厙" },
-    { "厕", "廁" },
-    { "厘改", "釐改" },
-    { "厘整", "釐整" },
-    { "厘正", "釐正" },
-    { "厘毫", "釐毫" },
-    { "厘清", "釐清" },
-    { "厘订", "釐訂" },
-    { "厘革", "釐革" },
-    { "原子钟", "原子鐘" },
-    { "原文里", "原文裡" },
-    { "原钟", "原鐘" },
-    { "厢", "廂" },
-    { "厣", "厴" },
-    { "厦", "廈" },
-    { "厨", "廚" },
-    { "厨余", "廚餘" },
-    { "厩", "廄" },
-    { "厮", "廝" },
-    { "厮斗", "廝鬥" },
-    { "去山里", "去山裡" },
-    { "县", "縣" },
-    { "县志", "縣誌" },
-    { "县里", "縣裡" },
-    { "参", "參" },
-    { "参数只", "參數只" },
-    { "参数里", "參數裡" },
-    { "参绥", "蔘綏" },
-    { "双", "雙" },
-    { "双折", "雙摺" },
-    { "双折射", "雙折射" },
-    { "双胜类", "雙胜類" },
-    { "双雕", "雙鵰" },
-    { "反冲", "反衝" },
-    { "反反复复", "反反覆覆" },
-    { "反复", "反覆" },
-    { "反复制", "反複製" },
-    { "反应制得", "反應製得" },
-    { "反朴", "反樸" },
-    { "发", "發" },
-    { "发上冲冠", "髮上沖冠" },
-    { "发上指冠", "髮上指冠" },
-    { "发丝", "髮絲" },
-    { "发为血之本", "髮為血之本" },
-    { "发乳", "髮乳" },
-    { "发光可鉴", "髮光可鑑" },
-    { "发匪", "髮匪" },
-    { "发卷", "髮捲" },
-    { "发及腰", "髮及腰" },
-    { "发型", "髮型" },
-    { "发夹", "髮夾" },
-    { "发妻", "髮妻" },
-    { "发屋", "髮屋" },
-    { "发已霜白", "髮已霜白" },
-    { "发带", "髮帶" },
-    { "发干", "發乾" },
-    { "发廊", "髮廊" },
-    { "发式", "髮式" },
-    { "发引千钧", "髮引千鈞" },
-    { "发披肩", "髮披肩" },
-    { "发松", "發鬆" },
-    { "发根", "髮根" },
-    { "发油", "髮油" },
-    { "发漂", "髮漂" },
-    { "发状", "髮狀" },
-    { "发状况", "發狀況" },
-    { "发状态", "發狀態" },
-    { "发癣", "髮癬" },
-    { "发短心长", "髮短心長" },
-    { "发禁", "髮禁" },
-    { "发笺", "髮箋" },
-    { "发签", "發籤" },
-    { "发簪", "髮簪" },
-    { "发纱", "髮紗" },
-    { "发结", "髮結" },
-    { "发网菌", "髮網菌" },
-    { "发肤", "髮膚" },
-    { "发胶", "髮膠" },
-    { "发脚", "髮腳" },
-    { "发菜", "髮菜" },
-    { "发蜡", "髮蠟" },
-    { "发踊冲冠", "髮踴沖冠" },
-    { "发辫", "髮辮" },
-    { "发钗", "髮釵" },
-    { "发长", "髮長" },
-    { "发际", "髮際" },
-    { "发雕", "髮雕" },
-    { "发霜", "髮霜" },
-    { "发面", "發麵" },
-    { "发饰", "髮飾" },
-    { "发髻", "髮髻" },
-    { "发鬓", "髮鬢" },
-    { "取舍", "取捨" },
-    { "受托", "受託" },
-    { "受雇", "受僱" },
-    { "变", "變" },
-    { "变丑", "變醜" },
-    { "变征", "變徵" },
-    { "叙", "敘" },
-    { "叠", "疊" },
-    { "叠席", "疊蓆" },
-    { "口干", "口乾" },
-    { "口干预", "口干預" },
-    { "口燥唇干", "口燥唇乾" },
-    { "口腹之欲", "口腹之慾" },
-    { "口里", "口裡" },
-    { "口钟", "口鐘" },
-    { "古书云", "古書云" },
-    { "古文里", "古文裡" },
-    { "古朴", "古樸" },
-    { "古柯咸", "古柯鹹" },
-    { "古语云", "古語云" },
-    { "古迹", "古蹟" },
-    { "古钟", "古鐘" },
-    { "古钟表", "古鐘錶" },
-    { "另辟", "另闢" },
-    { "叩钟", "叩鐘" },
-    { "只冲", "只衝" },
-    { "只占神问卜", "只占神問卜" },
-    { "只字", "隻字" },
-    { "只影", "隻影" },
-    { "只影响", "只影響" },
-    { "只手遮天", "隻手遮天" },
-    { "只眼", "隻眼" },
-    { "只言片语", "隻言片語" },
-    { "只身", "隻身" },
-    { "只身上无", "只身上無" },
-    { "只身上没", "只身上沒" },
-    { "只身为", "只身為" },
-    { "只身体", "只身體" },
-    { "只身后", "只身後" },
-    { "只身边", "只身邊" },
-    { "只采", "只採" },
-    { "只采声", "只采聲" },
-    { "叮叮当当", "叮叮噹噹" },
-    { "叮当", "叮噹" },
-    { "可紧可松", "可緊可鬆" },
-    { "可鉴", "可鑑" },
-    { "台佟", "臺佟" },
-    { "台历", "檯曆" },
-    { "台历史", "台歷史" },
-    { "台子孙", "台子孫" },
-    { "台灯", "檯燈" },
-    { "台球", "檯球" },
-    { "台钟", "台鐘" },
-    { "台静农", "臺靜農" },
-    { "台面上", "檯面上" },
-    { "台面化", "檯面化" },
-    { "台风", "颱風" },
-    { "台风后", "颱風後" },
-    { "台风奖", "台風獎" },
-    { "台风稳健", "台風穩健" },
-    { "史鉴", "史鑑" },
-    { "叶", "葉" },
-    { "叶叶琴", "葉叶琴" },
-    { "叶阳后", "葉陽后" },
-    { "叶韵", "叶韻" },
-    { "号", "號" },
-    { "号志", "號誌" },
-    { "叹", "嘆" },
-    { "叽", "嘰" },
-    { "吁天", "籲天" },
-    { "吁求", "籲求" },
-    { "吁请", "籲請" },
-    { "吃姜", "吃薑" },
-    { "吃板刀面", "吃板刀麵" },
-    { "吃碗面", "吃碗麵" },
-    { "吃里扒外", "吃裡扒外" },
-    { "吃里爬外", "吃裡爬外" },
-    { "吃面", "吃麵" },
-    { "各类钟", "各類鐘" },
-    { "各辟", "各闢" },
-    { "合伙", "合夥" },
-    { "合准", "合準" },
-    { "合历", "合曆" },
-    { "合历史", "合歷史" },
-    { "合并", "合併" },
-    { "合采", "合採" },
-    { "吉凶庆吊", "吉凶慶弔" },
-    { "吉征", "吉徵" },
-    { "吊丧", "弔喪" },
-    { "吊卷", "弔卷" },
-    { "吊取", "弔取" },
-    { "吊古", "弔古" },
-    { "吊唁", "弔唁" },
-    { "吊喉", "弔喉" },
-    { "吊喭", "弔喭" },
-    { "吊头", "弔頭" },
-    { "吊奠", "弔奠" },
-    { "吊孝", "弔孝" },
-    { "吊客", "弔客" },
-    { "吊宴", "弔宴" },
-    { "吊影", "弔影" },
-    { "吊恤", "弔恤" },
-    { "吊慰", "弔慰" },
-    { "吊扣", "弔扣" },
-    { "吊拷", "弔拷" },
-    { "吊撒", "弔撒" },
-    { "吊文", "弔文" },
-    { "吊旗", "弔旗" },
-    { "吊民", "弔民" },
-    { "吊祭", "弔祭" },
-    { "吊纸", "弔紙" },
-    { "吊者大悦", "弔者大悅" },
-    { "吊脚儿事", "弔腳兒事" },
-    { "吊腰撒跨", "弔腰撒跨" },
-    { "吊膀子", "弔膀子" },
-    { "吊词", "弔詞" },
-    { "吊诡", "弔詭" },
-    { "吊谎", "弔謊" },
-    { "吊贺迎送", "弔賀迎送" },
-    { "吊钟", "吊鐘" },
-    { "吊问", "弔問" },
-    { "吊鹤", "弔鶴" },
-    { "同人志", "同人誌" },
-    { "同伙", "同夥" },
-    { "同余", "同餘" },
-    { "名单于", "名單於" },
-    { "后", "後" },
-    { "后丰", "后豐" },
-    { "后印", "後印" },
-    { "后发座", "后髮座" },
-    { "后发星系团", "后髮星系團" },
-    { "后台老板", "後台老板" },
-    { "后天", "後天" },
-    { "后海湾", "后海灣" },
-    { "后苍", "后蒼" },
-    { "后面店", "後面店" },
-    { "吐哺捉发", "吐哺捉髮" },
-    { "吐哺握发", "吐哺握髮" },
-    { "向导", "嚮導" },
-    { "向往", "嚮往" },
-    { "向往时", "向往時" },
-    { "向往来", "向往來" },
-    { "向慕", "嚮慕" },
-    { "向迩", "嚮邇" },
-    { "吓", "嚇" },
-    { "吕", "呂" },
-    { "吕后", "呂后" },
-    { "吗", "嗎" },
-    { "吞并", "吞併" },
-    { "吟游", "吟遊" },
-    { "吣", "唚" },
-    { "吧台", "吧檯" },
-    { "吨", "噸" },
-    { "含齿戴发", "含齒戴髮" },
-    { "听", "聽" },
-    { "启", "啟" },
-    { "启发式", "啟發式" },
-    { "吴", "吳" },
-    { "吸干", "吸乾" },
-    { "吹发", "吹髮" },
-    { "吹干", "吹乾" },
-    { "呆致致", "呆緻緻" },
-    { "呆里呆气", "呆裡呆氣" },
-    { "告札", "告劄" },
-    { "告里", "告裡" },
-    { "呐", "吶" },
-    { "呒", "嘸" },
-    { "呓", "囈" },
-    { "呕", "嘔" },
-    { "呖", "嚦" },
-    { "呗", "唄" },
-    { "呗赞", "唄讚" },
-    { "员", "員" },
-    { "呙", "咼" },
-    { "呛", "嗆" },
-    { "呜", "嗚" },
-    { "周历", "周曆" },
-    { "周历史", "周歷史" },
-    { "周游", "週遊" },
-    { "周游列国", "周遊列國" },
-    { "呼吁", "呼籲" },
-    { "和制汉", "和製漢" },
-    { "和制英语", "和製英語" },
-    { "和奸", "和姦" },
-    { "咎征", "咎徵" },
-    { "咏", "詠" },
-    { "咕咕钟", "咕咕鐘" },
-    { "咙", "嚨" },
-    { "咚咚鼓", "鼕鼕鼓" },
-    { "咛", "嚀" },
-    { "咨询", "諮詢" },
-    { "咪表", "咪錶" },
-    { "咬姜呷醋", "咬薑呷醋" },
-    { "咯当", "咯噹" },
-    { "咸卤", "鹹鹵" },
-    { "咸味", "鹹味" },
-    { "咸咸", "鹹鹹" },
-    { "咸嘴淡舌", "鹹嘴淡舌" },
-    { "咸土", "鹹土" },
-    { "咸度", "鹹度" },
-    { "咸得", "鹹得" },
-    { "咸批", "鹹批" },
-    { "咸水", "鹹水" },
-    { "咸汤", "鹹湯" },
-    { "咸派", "鹹派" },
-    { "咸海", "鹹海" },
-    { "咸淡", "鹹淡" },
-    { "咸湖", "鹹湖" },
-    { "咸湿", "鹹濕" },
-    { "咸潟", "鹹潟" },
-    { "咸猪", "鹹豬" },
-    { "咸甜", "鹹甜" },
-    { "咸的", "鹹的" },
-    { "咸类", "鹹類" },
-    { "咸粥", "鹹粥" },
-    { "咸肉", "鹹肉" },
-    { "咸菜", "鹹菜" },
-    { "咸菜干", "鹹菜乾" },
-    { "咸蛋", "鹹蛋" },
-    { "咸食", "鹹食" },
-    { "咸鱼", "鹹魚" },
-    { "咸鸭蛋", "鹹鴨蛋" },
-    { "哀吊", "哀弔" },
-    { "哀挽", "哀輓" },
-    { "品鉴", "品鑑" },
-    { "哄动", "鬨動" },
-    { "哄堂", "鬨堂" },
-    { "哄笑", "鬨笑" },
-    { "响", "響" },
-    { "响钟", "響鐘" },
-    { "哑", "啞" },
-    { "哒", "噠" },
-    { "哓", "嘵" },
-    { "哔", "嗶" },
-    { "哕", "噦" },
-    { "哗", "嘩" },
-    { "哗众", "譁眾" },
-    { "哗变", "譁變" },
-    { "哗噪", "譁噪" },
-    { "哗嚣", "譁囂" },
-    { "哗然", "譁然" },
-    { "哗笑", "譁笑" },
-    { "哙", "噲" },
-    { "哜", "嚌" },
-    { "哝", "噥" },
-    { "哟", "喲" },
-    { "哟喂", "喲喂" },
-    { "哪里", "哪裡" },
-    { "唁吊", "唁弔" },
-    { "唇干", "唇乾" },
-    { "唛", "嘜" },
-    { "唠", "嘮" },
-    { "唢", "嗩" },
-    { "唤", "喚" },
-    { "唱游", "唱遊" },
-    { "唾余", "唾餘" },
-    { "唾面自干", "唾面自乾" },
-    { "商历", "商曆" },
-    { "商历史", "商歷史" },
-    { "商标准许", "商標准許" },
-    { "啧", "嘖" },
-    { "啬", "嗇" },
-    { "啭", "囀" },
-    { "啮", "齧" },
-    { "啮合", "嚙合" },
-    { "啮虫", "囓蟲" },
-    { "啮齿类", "嚙齒類" },
-    { "啷当", "啷噹" },
-    { "啸", "嘯" },
-    { "喂", "餵" },
-    { "喂了一声", "喂了一聲" },
-    { "喂哟", "喂喲" },
-    { "喜欢表", "喜歡錶" },
-    { "喜欢钟", "喜歡鐘" },
-    { "喜欢钟表", "喜歡鐘錶" },
-    { "喝干", "喝乾" },
-    { "喧哄", "喧鬨" },
-    { "喧哗", "喧譁" },
-    { "喷", "噴" },
-    { "喽", "嘍" },
-    { "喾", "嚳" },
-    { "嗫", "囁" },
-    { "嗳", "噯" },
-    { "嘉谷", "嘉穀" },
-    { "嘘", "噓" },
-    { "嘤", "嚶" },
-    { "嘱", "囑" },
-    { "嘱托", "囑託" },
-    { "嘴里", "嘴裡" },
-    { "噙齿戴发", "噙齒戴髮" },
-    { "噜", "嚕" },
-    { "噜苏", "嚕囌" },
-    { "噪诈", "譟詐" },
-    { "嚣", "囂" },
-    { "嚼谷", "嚼穀" },
-    { "四个", "四個" },
-    { "四余", "四餘" },
-    { "四出征收", "四出徵收" },
-    { "四分历", "四分曆" },
-    { "四分历史", "四分歷史" },
-    { "四只", "四隻" },
-    { "四周后", "四周後" },
-    { "四天后", "四天後" },
-    { "四扎", "四紮" },
-    { "四杆铁笔", "四桿鐵筆" },
-    { "四舍五入", "四捨五入" },
-    { "四舍六入", "四捨六入" },
-    { "四面钟", "四面鐘" },
-    { "回光返照", "迴光返照" },
-    { "回历", "回曆" },
-    { "回历史", "回歷史" },
-    { "回响", "迴響" },
-    { "回圈", "迴圈" },
-    { "回复中", "回覆中" },
-    { "回复你", "回覆你" },
-    { "回复帖子", "回覆帖子" },
-    { "回复意见", "回覆意見" },
-    { "回复说", "回覆說" },
-    { "回复邮件", "回覆郵件" },
-    { "回廊", "迴廊" },
-    { "回形夹", "迴形夾" },
-    { "回文序列", "迴文序列" },
-    { "回文数", "迴文數" },
-    { "回文构词", "迴文構詞" },
-    { "回文结构", "迴文結構" },
-    { "回文联", "迴文聯" },
-    { "回文诗", "迴文詩" },
-    { "回文锦", "迴文錦" },
-    { "回旋", "迴旋" },
-    { "回游", "回遊" },
-    { "回环", "迴環" },
-    { "回纹针", "迴紋針" },
-    { "回绕", "迴繞" },
-    { "回翔", "迴翔" },
-    { "回肠", "迴腸" },
-    { "回肠荡气", "迴腸盪氣" },
-    { "回荡", "迴蕩" },
-    { "回诵", "迴誦" },
-    { "回路", "迴路" },
-    { "回转", "迴轉" },
-    { "回递性", "迴遞性" },
-    { "回避", "迴避" },
-    { "回采", "回採" },
-    { "回銮", "迴鑾" },
-    { "回风", "迴風" },
-    { "团", "團" },
-    { "团子", "糰子" },
-    { "园", "園" },
-    { "园游会", "園遊會" },
-    { "园里", "園裡" },
-    { "困乏", "睏乏" },
-    { "困倦", "睏倦" },
-    { "困倦起来", "困倦起來" },
-    { "困兽之斗", "困獸之鬥" },
-    { "困兽犹斗", "困獸猶鬥" },
-    { "困斗", "困鬥" },
-    { "困觉", "睏覺" },
-    { "囱", "囪" },
-    { "围", "圍" },
-    { "囵", "圇" },
-    { "固征", "固徵" },
-    { "国", "國" },
-    { "国之桢干", "國之楨榦" },
-    { "国仇", "國讎" },
-    { "国历", "國曆" },
-    { "国历代", "國歷代" },
-    { "国历任", "國歷任" },
-    { "国历史", "國歷史" },
-    { "国历届", "國歷屆" },
-    { "国历来", "國歷來" },
-    { "国历经", "國歷經" },
-    { "图", "圖" },
-    { "图里的", "圖裡的" },
-    { "图鉴", "圖鑑" },
-    { "圆", "圓" },
-    { "圈梁", "圈樑" },
-    { "圈里", "圈裡" },
-    { "土制", "土製" },
-    { "土索面", "土索麵" },
-    { "土里", "土裡" },
-    { "圣", "聖" },
-    { "圣人历", "聖人曆" },
-    { "圣后", "聖后" },
-    { "圣马尔谷日", "聖馬爾谷日" },
-    { "在山里", "在山裡" },
-    { "地丑德齐", "地醜德齊" },
-    { "地图里", "地圖裡" },
-    { "地心历表", "地心曆表" },
-    { "地志", "地誌" },
-    { "圹", "壙" },
-    { "场", "場" },
-    { "场里", "場裡" },
-    { "坏", "壞" },
-    { "坐台", "坐檯" },
-    { "坐台铁", "坐台鐵" },
-    { "坐如钟", "坐如鐘" },
-    { "坐钟", "坐鐘" },
-    { "坑里", "坑裡" },
-    { "块", "塊" },
-    { "坚", "堅" },
-    { "坚致", "堅緻" },
-    { "坛", "壇" },
-    { "坛坛罐罐", "罈罈罐罐" },
-    { "坛子", "罈子" },
-    { "坜", "壢" },
-    { "坝", "壩" },
-    { "坞", "塢" },
-    { "坟", "墳" },
-    { "坠", "墜" },
-    { "坤范", "坤範" },
-    { "坦荡", "坦蕩" },
-    { "坦荡荡", "坦蕩蕩" },
-    { "坱郁", "坱鬱" },
-    { "垂发", "垂髮" },
-    { "垂范", "垂範" },
-    { "垄", "壟" },
-    { "垆", "壚" },
-    { "型范", "型範" },
-    { "垒", "壘" },
-    { "垦", "墾" },
-    { "垦辟", "墾闢" },
-    { "垩", "堊" },
-    { "垫", "墊" },
-    { "垭", "埡" },
-    { "垲", "塏" },
-    { "埃及历", "埃及曆" },
-    { "埃及历史", "埃及歷史" },
-    { "埃及艳后", "埃及豔后" },
-    { "埃荣冲", "埃榮衝" },
-    { "城市里", "城市裡" },
-    { "城里", "城裡" },
-    { "埔里社", "埔裏社" },
-    { "埘", "塒" },
-    { "埙", "塤" },
-    { "埚", "堝" },
-    { "域里", "域裡" },
-    { "基准", "基準" },
-    { "基干", "基幹" },
-    { "堑", "塹" },
-    { "堕", "墮" },
-    { "堙淀", "堙澱" },
-    { "塞耳盗钟", "塞耳盜鐘" },
-    { "境里", "境裡" },
-    { "墓志", "墓誌" },
-    { "墓志铭", "墓志銘" },
-    { "墙", "牆" },
-    { "墙里", "牆裡" },
-    { "增辟", "增闢" },
-    { "墨沈", "墨瀋" },
-    { "壮", "壯" },
-    { "壮游", "壯遊" },
-    { "壮面", "壯麵" },
-    { "声", "聲" },
-    { "声母后", "聲母後" },
-    { "壳", "殼" },
-    { "壳里", "殼裡" },
-    { "壶", "壺" },
-    { "壶里", "壺裡" },
-    { "壹郁", "壹鬱" },
-    { "处", "處" },
-    { "备", "備" },
-    { "备注", "備註" },
-    { "复", "復" },
-    { "复习", "複習" },
-    { "复信", "覆信" },
-    { "复元音", "複元音" },
-    { "复写", "複寫" },
-    { "复决", "複決" },
-    { "复函数", "複函數" },
-    { "复分数", "複分數" },
-    { "复分析", "複分析" },
-    { "复分解", "複分解" },
-    { "复列", "複列" },
-    { "复利", "複利" },
-    { "复制", "複製" },
-    { "复印", "複印" },
-    { "复变函数", "複變函數" },
-    { "复句", "複句" },
-    { "复叶", "複葉" },
-    { "复合", "複合" },
-    { "复壁", "複壁" },
-    { "复始", "復始" },
-    { "复姓", "複姓" },
-    { "复字键", "複字鍵" },
-    { "复审", "複審" },
-    { "复对数", "複對數" },
-    { "复平面", "複平面" },
-    { "复式", "複式" },
-    { "复数", "複數" },
-    { "复方", "複方" },
-    { "复本", "複本" },
-    { "复杂", "複雜" },
-    { "复查", "複查" },
-    { "复核", "覆核" },
-    { "复次", "複次" },
-    { "复比", "複比" },
-    { "复活节历表", "復活節曆表" },
-    { "复流", "複流" },
-    { "复测", "複測" },
-    { "复目", "複目" },
-    { "复眼", "複眼" },
-    { "复种", "複種" },
-    { "复穗", "複穗" },
-    { "复线", "複線" },
-    { "复色", "複色" },
-    { "复苏", "復甦" },
-    { "复议", "複議" },
-    { "复评", "複評" },
-    { "复诊", "複診" },
-    { "复词", "複詞" },
-    { "复试", "複試" },
-    { "复课", "複課" },
-    { "复赛", "複賽" },
-    { "复辅音", "複輔音" },
-    { "复述", "複述" },
-    { "复选", "複選" },
-    { "复钱", "複錢" },
-    { "复阅", "複閱" },
-    { "复音", "複音" },
-    { "复韵", "複韻" },
-    { "夏于乔", "夏于喬" },
-    { "夏历", "夏曆" },
-    { "夏历史", "夏歷史" },
-    { "夏游", "夏遊" },
-    { "外制", "外製" },
-    { "外强中干", "外強中乾" },
-    { "多丑", "多醜" },
-    { "多余", "多餘" },
-    { "多冲", "多衝" },
-    { "多出电影", "多齣電影" },
-    { "多只", "多隻" },
-    { "多只会", "多只會" },
-    { "多只须", "多只須" },
-    { "多周后", "多周後" },
-    { "多天后", "多天後" },
-    { "夜晚里", "夜晚裡" },
-    { "夜游", "夜遊" },
-    { "夜里", "夜裡" },
-    { "够", "夠" },
-    { "大丑", "大醜" },
-    { "大伙", "大夥" },
-    { "大伙儿", "大伙兒" },
-    { "大历", "大曆" },
-    { "大历史", "大歷史" },
-    { "大历险", "大歷險" },
-    { "大只", "大隻" },
-    { "大只会", "大只會" },
-    { "大周折", "大週摺" },
-    { "大型钟", "大型鐘" },
-    { "大型钟表", "大型鐘錶" },
-    { "大型钟表面", "大型鐘表面" },
-    { "大型钟面", "大型鐘面" },
-    { "大夸", "大誇" },
-    { "大干", "大幹" },
-    { "大批涌到", "大批湧到" },
-    { "大折儿", "大摺兒" },
-    { "大明历", "大明曆" },
-    { "大明历史", "大明歷史" },
-    { "大本钟", "大本鐘" },
-    { "大病初愈", "大病初癒" },
-    { "大目干连", "大目乾連" },
-    { "大笨钟", "大笨鐘" },
-    { "大衍历", "大衍曆" },
-    { "大衍历史", "大衍歷史" },
-    { "大赞", "大讚" },
-    { "大金发苔", "大金髮苔" },
-    { "大钟", "大鐘" },
-    { "大风后", "大風後" },
-    { "天克地冲", "天克地衝" },
-    { "天历", "天曆" },
-    { "天历史", "天歷史" },
-    { "天后半", "天後半" },
-    { "天后天", "天後天" },
-    { "天后宫", "天后宮" },
-    { "天后来", "天後來" },
-    { "天地为范", "天地為範" },
-    { "天文历表", "天文曆表" },
-    { "天文学钟", "天文學鐘" },
-    { "天文钟", "天文鐘" },
-    { "天里", "天裡" },
-    { "太丑", "太醜" },
-    { "太仆", "太僕" },
-    { "太凶", "太兇" },
-    { "太初历", "太初曆" },
-    { "太初历史", "太初歷史" },
-    { "太阁", "太閤" },
-    { "头", "頭" },
-    { "头发", "頭髮" },
-    { "头发现", "頭發現" },
-    { "头里", "頭裡" },
-    { "头长发", "頭長髮" },
-    { "夸下海口", "誇下海口" },
-    { "夸丽", "誇麗" },
-    { "夸了", "誇了" },
-    { "夸人", "誇人" },
-    { "夸他", "誇他" },
-    { "夸你", "誇你" },
-    { "夸别", "誇別" },
-    { "夸功", "誇功" },
-    { "夸口", "誇口" },
-    { "夸嘴", "誇嘴" },
-    { "夸多斗靡", "誇多鬥靡" },
-    { "夸大", "誇大" },
-    { "夸夸", "誇誇" },
-    { "夸夸其谈", "誇誇其談" },
-    { "夸奖", "誇獎" },
-    { "夸她", "誇她" },
-    { "夸姣", "誇姣" },
-    { "夸官", "誇官" },
-    { "夸容", "誇容" },
-    { "夸张", "誇張" },
-    { "夸强说会", "誇強說會" },
-    { "夸得", "誇得" },
-    { "夸成", "誇成" },
-    { "夸我", "誇我" },
-    { "夸才", "誇才" },
-    { "夸来夸去", "誇來誇去" },
-    { "夸毗", "誇毗" },
-    { "夸海口", "誇海口" },
-    { "夸示", "誇示" },
-    { "夸称", "誇稱" },
-    { "夸耀", "誇耀" },
-    { "夸胜道强", "誇勝道強" },
-    { "夸能", "誇能" },
-    { "夸能斗智", "誇能鬥智" },
-    { "夸脱", "夸脫" },
-    { "夸诞", "誇誕" },
-    { "夸诩", "誇詡" },
-    { "夸说", "誇說" },
-    { "夸赞", "誇讚" },
-    { "夸起", "誇起" },
-    { "夸辩", "誇辯" },
-    { "夸过", "誇過" },
-    { "夸饰", "誇飾" },
-    { "夹", "夾" },
-    { "夹衣", "袷衣" },
-    { "夹裙", "袷裙" },
-    { "夺", "奪" },
-    { "夺斗", "奪鬥" },
-    { "奁", "奩" },
-    { "奂", "奐" },
-    { "奇丑", "奇醜" },
-    { "奇勋", "奇勳" },
-    { "奇迹", "奇蹟" },
-    { "奋", "奮" },
-    { "奋斗", "奮鬥" },
-    { "奏折", "奏摺" },
-    { "奖", "獎" },
-    { "奖杯", "獎盃" },
-    { "奥", "奧" },
-    { "女仆", "女僕" },
-    { "奴仆", "奴僕" },
-    { "奸夫", "姦夫" },
-    { "奸妇", "姦婦" },
-    { "奸情", "姦情" },
-    { "奸杀", "姦殺" },
-    { "奸污", "姦污" },
-    { "奸淫", "姦淫" },
-    { "奸淫掳掠", "奸淫擄掠" },
-    { "好丑", "好醜" },
-    { "好凶", "好兇" },
-    { "好勇斗狠", "好勇鬥狠" },
-    { "好困", "好睏" },
-    { "好家伙", "好傢夥" },
-    { "好斗", "好鬥" },
-    { "好斗胆", "好斗膽" },
-    { "好签", "好籤" },
-    { "如果干", "如果幹" },
-    { "如饥似渴", "如饑似渴" },
-    { "妆", "妝" },
-    { "妆台", "妝檯" },
-    { "妇", "婦" },
-    { "妈", "媽" },
-    { "妖气冲天", "妖氣衝天" },
-    { "妩", "嫵" },
-    { "妪", "嫗" },
-    { "妫", "媯" },
-    { "委托", "委託" },
-    { "委托书", "委託書" },
-    { "姗", "姍" },
-    { "姜丝", "薑絲" },
-    { "姜啤", "薑啤" },
-    { "姜是老的辣", "薑是老的辣" },
-    { "姜末", "薑末" },
-    { "姜桂", "薑桂" },
-    { "姜母", "薑母" },
-    { "姜汁", "薑汁" },
-    { "姜汤", "薑湯" },
-    { "姜片", "薑片" },
-    { "姜糖", "薑糖" },
-    { "姜老辣", "薑老辣" },
-    { "姜茶", "薑茶" },
-    { "姜蓉", "薑蓉" },
-    { "姜还是老的辣", "薑還是老的辣" },
-    { "姜酮", "薑酮" },
-    { "姜饼", "薑餅" },
-    { "姜黄", "薑黃" },
-    { "姹", "奼" },
-    { "威棱", "威稜" },
-    { "娄", "婁" },
-    { "娅", "婭" },
-    { "娆", "嬈" },
-    { "娇", "嬌" },
-    { "娈", "孌" },
-    { "娱", "娛" },
-    { "娲", "媧" },
-    { "娴", "嫻" },
-    { "婢仆", "婢僕" },
-    { "婴", "嬰" },
-    { "婵", "嬋" },
-    { "婶", "嬸" },
-    { "媪", "媼" },
-    { "嫌凶", "嫌兇" },
-    { "嫌好道丑", "嫌好道醜" },
-    { "嫒", "嬡" },
-    { "嫔", "嬪" },
-    { "嫩姜", "嫩薑" },
-    { "嫱", "嬙" },
-    { "嬉游", "嬉遊" },
-    { "嬖幸", "嬖倖" },
-    { "嬴余", "嬴餘" },
-    { "嬷", "嬤" },
-    { "子里", "子裡" },
-    { "字母后", "字母後" },
-    { "字汇", "字彙" },
-    { "字码表", "字碼表" },
-    { "字里行间", "字裡行間" },
-    { "存折", "存摺" },
-    { "孙", "孫" },
-    { "孙杰", "孫杰" },
-    { "学", "學" },
-    { "学家", "學家" },
-    { "学里", "學裡" },
-    { "孪", "孿" },
-    { "宁", "寧" },
-    { "宇宙志", "宇宙誌" },
-    { "安沈铁路", "安瀋鐵路" },
-    { "宋王台", "宋王臺" },
-    { "宗周钟", "宗周鐘" },
-    { "官历", "官曆" },
-    { "官历史", "官歷史" },
-    { "官地为采", "官地為寀" },
-    { "定准", "定準" },
-    { "定制", "定製" },
-    { "宝", "寶" },
-    { "宝历", "寶曆" },
-    { "宝历史", "寶歷史" },
-    { "宝里宝气", "寶裡寶氣" },
-    { "宝鉴", "寶鑑" },
-    { "实", "實" },
-    { "实干", "實幹" },
-    { "实累累", "實纍纍" },
-    { "实验里", "實驗裡" },
-    { "宠", "寵" },
-    { "审", "審" },
-    { "宣泄", "宣洩" },
-    { "宦游", "宦遊" },
-    { "宪", "憲" },
-    { "宪法里", "憲法裡" },
-    { "宫", "宮" },
-    { "宫里", "宮裡" },
-    { "宴游", "宴遊" },
-    { "家丑", "家醜" },
-    { "家仆", "家僕" },
-    { "家伙", "傢伙" },
-    { "家里", "家裡" },
-    { "容范", "容範" },
-    { "宽", "寬" },
-    { "宽余", "寬餘" },
-    { "宽松", "寬鬆" },
-    { "宽松松", "寬鬆鬆" },
-    { "宾", "賓" },
-    { "寄托", "寄託" },
-    { "密致", "密緻" },
-    { "寇仇", "寇讎" },
-    { "寇准", "寇準" },
-    { "富余", "富餘" },
-    { "寒栗", "寒慄" },
-    { "寓禁于征", "寓禁於徵" },
-    { "寝", "寢" },
-    { "寡欲", "寡慾" },
-    { "寮采", "寮寀" },
-    { "寸发千金", "寸髮千金" },
-    { "对", "對" },
-    { "对不准", "對不準" },
-    { "对准", "對準" },
-    { "对准表", "對準錶" },
-    { "对准钟", "對準鐘" },
-    { "对准钟表", "對準鐘錶" },
-    { "对华发", "對華發" },
-    { "对折", "對摺" },
-    { "对着干", "對着幹" },
-    { "对表中", "對表中" },
-    { "对表扬", "對表揚" },
-    { "对表明", "對表明" },
-    { "对表演", "對表演" },
-    { "对表现", "對表現" },
-    { "对表达", "對表達" },
-    { "寺钟", "寺鐘" },
-    { "寻", "尋" },
-    { "导", "導" },
-    { "导游", "導遊" },
-    { "寿", "壽" },
-    { "寿面", "壽麵" },
-    { "封为后", "封為后" },
-    { "封面里", "封面裡" },
-    { "射雕", "射鵰" },
-    { "将", "將" },
-    { "小仆", "小僕" },
-    { "小只", "小隻" },
-    { "小只会", "小只會" },
-    { "小型钟", "小型鐘" },
-    { "小型钟表", "小型鐘錶" },
-    { "小型钟表面", "小型鐘表面" },
-    { "小型钟面", "小型鐘面" },
-    { "小时里", "小時裡" },
-    { "小米面", "小米麵" },
-    { "少采", "少採" },
-    { "尔", "爾" },
-    { "尔冬升", "爾冬陞" },
-    { "尘", "塵" },
-    { "尝", "嘗" },
-    { "尧", "堯" },
-    { "就范", "就範" },
-    { "就里", "就裡" },
-    { "尴", "尷" },
-    { "尸", "屍" },
-    { "尸居余气", "尸居餘氣" },
-    { "尸弃佛", "尸棄佛" },
-    { "尸禄", "尸祿" },
-    { "尸罗", "尸羅" },
-    { "尸罗精舍", "尸羅精舍" },
-    { "尸谏", "尸諫" },
-    { "尸鸠", "尸鳩" },
-    { "尽", "盡" },
-    { "尽先", "儘先" },
-    { "尽其所有", "儘其所有" },
-    { "尽可能", "儘可能" },
-    { "尽尽", "儘儘" },
-    { "尽快", "儘快" },
-    { "尽早", "儘早" },
-    { "尽是", "儘是" },
-    { "尽管", "儘管" },
-    { "尽自", "儘自" },
-    { "尽速", "儘速" },
-    { "尽量", "儘量" },
-    { "局促", "侷促" },
-    { "局蹐", "跼蹐" },
-    { "局躅", "跼躅" },
-    { "局里", "局裡" },
-    { "层", "層" },
-    { "屉", "屜" },
-    { "届", "屆" },
-    { "屋梁", "屋樑" },
-    { "屋里", "屋裡" },
-    { "屏风后", "屏風後" },
-    { "属", "屬" },
-    { "属托", "屬託" },
-    { "屡", "屢" },
-    { "屡顾尔仆", "屢顧爾僕" },
-    { "屦", "屨" },
-    { "屯扎", "屯紮" },
-    { "屯里", "屯裡" },
-    { "山岳", "山嶽" },
-    { "山崩钟应", "山崩鐘應" },
-    { "山梁", "山樑" },
-    { "山棱", "山稜" },
-    { "山羊胡", "山羊鬍" },
-    { "山里有", "山裡有" },
-    { "山里的", "山裡的" },
-    { "山重水复", "山重水複" },
-    { "屿", "嶼" },
-    { "岁", "歲" },
-    { "岁聿云暮", "歲聿云暮" },
-    { "岂", "豈" },
-    { "岖", "嶇" },
-    { "岗", "崗" },
-    { "岘", "峴" },
-    { "岚", "嵐" },
-    { "岛", "島" },
-    { "岫岩", "岫巖" },
-    { "岭", "嶺" },
-    { "岱岳", "岱嶽" },
-    { "岳岳", "嶽嶽" },
-    { "岳麓", "嶽麓" },
-    { "岿", "巋" },
-    { "峄", "嶧" },
-    { "峡", "峽" },
-    { "峤", "嶠" },
-    { "峥", "崢" },
-    { "峦", "巒" },
-    { "峰回", "峰迴" },
-    { "崂", "嶗" },
-    { "崃", "崍" },
-    { "崭", "嶄" },
-    { "嵘", "嶸" },
-    { "嵝", "嶁" },
-    { "嶒棱", "嶒稜" },
-    { "巅", "巔" },
-    { "巡回", "巡迴" },
-    { "巡回医疗", "巡回醫療" },
-    { "巡游", "巡遊" },
-    { "工作台", "工作檯" },
-    { "左冲右突", "左衝右突" },
-    { "巧历", "巧曆" },
-    { "巧历史", "巧歷史" },
-    { "巧干", "巧幹" },
-    { "巨制", "巨製" },
-    { "巩", "鞏" },
-    { "巯", "巰" },
-    { "巴尔干", "巴爾幹" },
-    { "巴而术", "巴而朮" },
-    { "巷里", "巷裡" },
-    { "币", "幣" },
-    { "市里的", "市裡的" },
-    { "布谷", "布穀" },
-    { "布谷鸟", "布穀鳥" },
-    { "布谷鸟钟", "布穀鳥鐘" },
-    { "帅", "帥" },
-    { "师", "師" },
-    { "师范", "師範" },
-    { "希伯来历", "希伯來曆" },
-    { "希伯来历史", "希伯來歷史" },
-    { "帏", "幃" },
-    { "帐", "帳" },
-    { "帘", "簾" },
-    { "帜", "幟" },
-    { "帝后台", "帝后臺" },
-    { "带", "帶" },
-    { "带余", "帶餘" },
-    { "带发修行", "帶髮修行" },
-    { "带征", "帶徵" },
-    { "帧", "幀" },
-    { "席卷", "席捲" },
-    { "席子", "蓆子" },
-    { "帮", "幫" },
-    { "帱", "幬" },
-    { "帻", "幘" },
-    { "帼", "幗" },
-    { "幂", "冪" },
-    { "幅图里", "幅圖裡" },
-    { "干上", "幹上" },
-    { "干下去", "幹下去" },
-    { "干不了", "幹不了" },
-    { "干不成", "幹不成" },
-    { "干丝", "乾絲" },
-    { "干个", "幹個" },
-    { "干个够", "乾個夠" },
-    { "干么", "幹麼" },
-    { "干乔", "乾喬" },
-    { "干了", "幹了" },
-    { "干事", "幹事" },
-    { "干井", "乾井" },
-    { "干些", "幹些" },
-    { "干产", "乾產" },
-    { "干亲", "乾親" },
-    { "干什么", "幹什麼" },
-    { "干仗", "幹仗" },
-    { "干儿", "乾兒" },
-    { "干冰", "乾冰" },
-    { "干冷", "乾冷" },
-    { "干净", "乾淨" },
-    { "干凉", "乾涼" },
-    { "干刍", "乾芻" },
-    { "干刻版", "乾刻版" },
-    { "干剥剥", "乾剝剝" },
-    { "干办", "幹辦" },
-    { "干劲", "幹勁" },
-    { "干卦", "乾卦" },
-    { "干号", "乾號" },
-    { "干吏", "幹吏" },
-    { "干吗", "幹嗎" },
-    { "干呕", "乾嘔" },
-    { "干员", "幹員" },
-    { "干咳", "乾咳" },
-    { "干咽", "乾咽" },
-    { "干哕", "乾噦" },
-    { "干哥", "乾哥" },
-    { "干哭", "乾哭" },
-    { "干唱", "乾唱" },
-    { "干啥", "幹啥" },
-    { "干啼", "乾啼" },
-    { "干嘛", "幹嘛" },
-    { "干嚎", "乾嚎" },
-    { "干回付", "乾回付" },
-    { "干圆洁净", "乾圓潔淨" },
-    { "干坏事", "幹壞事" },
-    { "干坞", "乾塢" },
-    { "干大事", "幹大事" },
-    { "干头", "幹頭" },
-    { "干女", "乾女" },
-    { "干奴才", "乾奴才" },
-    { "干妈", "乾媽" },
-    { "干妹", "乾妹" },
-    { "干姊", "乾姊" },
-    { "干姐", "乾姐" },
-    { "干姜", "乾薑" },
-    { "干娘", "乾娘" },
-    { "干子", "乾子" },
-    { "干季", "乾季" },
-    { "干完", "幹完" },
-    { "干家", "幹家" },
-    { "干尸", "乾屍" },
-    { "干屎橛", "乾屎橛" },
-    { "干巴", "乾巴" },
-    { "干干", "乾乾" },
-    { "干干净净", "乾乾淨淨" },
-    { "干式", "乾式" },
-    { "干弟", "乾弟" },
-    { "干当", "幹當" },
-    { "干得", "幹得" },
-    { "干急", "乾急" },
-    { "干性", "乾性" },
-    { "干性油", "幹性油" },
-    { "干才", "幹才" },
-    { "干打雷", "乾打雷" },
-    { "干折", "乾折" },
-    { "干拌面", "乾拌麵" },
-    { "干掉", "幹掉" },
-    { "干探", "幹探" },
-    { "干撂台", "乾撂台" },
-    { "干撇下", "乾撇下" },
-    { "干擦", "乾擦" },
-    { "干支剌", "乾支剌" },
-    { "干支支", "乾支支" },
-    { "干料", "乾料" },
-    { "干旱", "乾旱" },
-    { "干暖", "乾暖" },
-    { "干材", "乾材" },
-    { "干村沙", "乾村沙" },
-    { "干杯", "乾杯" },
-    { "干果", "乾果" },
-    { "干枯", "乾枯" },
-    { "干柴", "乾柴" },
-    { "干柴烈火", "乾柴烈火" },
-    { "干校", "幹校" },
-    { "干梅", "乾梅" },
-    { "干死", "乾死" },
-    { "干池", "乾池" },
-    { "干沟", "乾溝" },
-    { "干没", "乾沒" },
-    { "干洗", "乾洗" },
-    { "干活", "幹活" },
-    { "干流", "幹流" },
-    { "干济", "幹濟" },
-    { "干涩", "乾澀" },
-    { "干涸", "乾涸" },
-    { "干渠", "乾渠" },
-    { "干渴", "乾渴" },
-    { "干湿", "乾濕" },
-    { "干漆", "乾漆" },
-    { "干灯盏", "乾燈盞" },
-    { "干热", "乾熱" },
-    { "干熬", "乾熬" },
-    { "干燥", "乾燥" },
-    { "干父之蛊", "幹父之蠱" },
-    { "干爸", "乾爸" },
-    { "干爹", "乾爹" },
-    { "干爽", "乾爽" },
-    { "干片", "乾片" },
-    { "干物", "乾物" },
-    { "干球温度", "幹球溫度" },
-    { "干甚么", "幹甚麼" },
-    { "干生受", "乾生受" },
-    { "干生子", "乾生子" },
-    { "干田", "乾田" },
-    { "干电", "乾電" },
-    { "干略", "幹略" },
-    { "干疥", "乾疥" },
-    { "干瘦", "乾瘦" },
-    { "干瘪", "乾癟" },
-    { "干瘾", "乾癮" },
-    { "干癣", "乾癬" },
-    { "干白儿", "乾白兒" },
-    { "干白葡萄酒", "乾白葡萄酒" },
-    { "干的", "乾的" },
-    { "干的事", "幹的事" },
-    { "干的好事", "幹的好事" },
-    { "干眼", "乾眼" },
-    { "干瞪眼", "乾瞪眼" },
-    { "干礼", "乾禮" },
-    { "干稿", "乾稿" },
-    { "干笑", "乾笑" },
-    { "干等", "乾等" },
-    { "干篾片", "乾篾片" },
-    { "干粉", "乾粉" },
-    { "干粮", "乾糧" },
-    { "干糇", "乾餱" },
-    { "干系", "干係" },
-    { "干红葡萄酒", "乾紅葡萄酒" },
-    { "干纲", "乾綱" },
-    { "干线", "幹線" },
-    { "干练", "幹練" },
-    { "干细胞", "幹細胞" },
-    { "干结", "乾結" },
-    { "干绷", "乾繃" },
-    { "干缺", "幹缺" },
-    { "干群关系", "幹群關係" },
-    { "干耗", "乾耗" },
-    { "干肉片", "乾肉片" },
-    { "干股", "乾股" },
-    { "干肥", "乾肥" },
-    { "干脆", "乾脆" },
-    { "干脆面", "乾脆麵" },
-    { "干花", "乾花" },
-    { "干苔", "乾苔" },
-    { "干茨腊", "乾茨臘" },
-    { "干茶钱", "乾茶錢" },
-    { "干草", "乾草" },
-    { "干菜", "乾菜" },
-    { "干营生", "幹營生" },
-    { "干落", "乾落" },
-    { "干薪", "乾薪" },
-    { "干虔", "乾虔" },
-    { "干蛊", "幹蠱" },
-    { "干血浆", "乾血漿" },
-    { "干衣", "乾衣" },
-    { "干裂", "乾裂" },
-    { "干警", "幹警" },
-    { "干贝", "乾貝" },
-    { "干货", "乾貨" },
-    { "干起来", "幹起來" },
-    { "干路", "幹路" },
-    { "干躁", "乾躁" },
-    { "干这", "幹這" },
-    { "干逼", "乾逼" },
-    { "干道", "幹道" },
-    { "干部", "幹部" },
-    { "干酪", "乾酪" },
-    { "干酵母", "乾酵母" },
-    { "干醋", "乾醋" },
-    { "干重", "乾重" },
-    { "干量", "乾量" },
-    { "干锅", "乾鍋" },
-    { "干阿奶", "乾阿奶" },
-    { "干雷", "乾雷" },
-    { "干霍乱", "乾霍亂" },
-    { "干面", "乾麵" },
-    { "干革命", "幹革命" },
-    { "干颡", "乾顙" },
-    { "干食", "乾食" },
-    { "干饭", "乾飯" },
-    { "干馆", "乾館" },
-    { "干馏", "乾餾" },
-    { "干鱼", "乾魚" },
-    { "干鲜", "乾鮮" },
-    { "平准", "平準" },
-    { "平平当当", "平平當當" },
-    { "年代里", "年代裡" },
-    { "年历", "年曆" },
-    { "年历史", "年歷史" },
-    { "年历次", "年歷次" },
-    { "年谷", "年穀" },
-    { "年里", "年裡" },
-    { "年鉴", "年鑑" },
-    { "并", "並" },
-    { "并一不二", "併一不二" },
-    { "并为一体", "併為一體" },
-    { "并为一家", "併為一家" },
-    { "并入", "併入" },
-    { "并兼", "併兼" },
-    { "并到", "併到" },
-    { "并力", "併力" },
-    { "并发动", "並發動" },
-    { "并发型模式", "併發型模式" },
-    { "并发展", "並發展" },
-    { "并发布", "並發布" },
-    { "并发模式", "併發模式" },
-    { "并发现", "並發現" },
-    { "并发症", "併發症" },
-    { "并发表", "並發表" },
-    { "并发重症", "併發重症" },
-    { "并叠", "併疊" },
-    { "并合", "併合" },
-    { "并名", "併名" },
-    { "并吞", "併吞" },
-    { "并吞下", "並吞下" },
-    { "并拢", "併攏" },
-    { "并曰入淀", "並曰入澱" },
-    { "并案", "併案" },
-    { "并科", "併科" },
-    { "并线", "併線" },
-    { "并网", "併網" },
-    { "并肩子", "併肩子" },
-    { "并行", "並行" },
-    { "并购", "併購" },
-    { "并骨", "併骨" },
-    { "幸免", "倖免" },
-    { "幸存", "倖存" },
-    { "幸幸", "倖幸" },
-    { "幸运胡", "幸運鬍" },
-    { "广", "廣" },
-    { "广征", "廣徵" },
-    { "广播里", "廣播裡" },
-    { "广舍", "廣捨" },
-    { "庄", "莊" },
-    { "庄内地方", "庄內地方" },
-    { "庄里", "莊裡" },
-    { "庆", "慶" },
-    { "庆历", "慶曆" },
-    { "庆历史", "慶歷史" },
-    { "庆吊", "慶弔" },
-    { "床席", "床蓆" },
-    { "庐", "廬" },
-    { "庑", "廡" },
-    { "库", "庫" },
-    { "应", "應" },
-    { "应制得", "應制得" },
-    { "应征", "應徵" },
-    { "应钟", "應鐘" },
-    { "店里", "店裡" },
-    { "庙", "廟" },
-    { "庙里", "廟裡" },
-    { "府干", "府幹" },
-    { "府干扰", "府干擾" },
-    { "府干预", "府干預" },
-    { "庞", "龐" },
-    { "废", "廢" },
-    { "废后", "廢后" },
-    { "座钟", "座鐘" },
-    { "廪", "廩" },
-    { "延历", "延曆" },
-    { "建筑前", "建築前" },
-    { "建筑后", "建築後" },
-    { "开", "開" },
-    { "开发", "開發" },
-    { "开吊", "開弔" },
-    { "开哄", "開鬨" },
-    { "开山辟谷", "開山闢谷" },
-    { "开征", "開徵" },
-    { "开辟", "開闢" },
-    { "开采", "開採" },
-    { "异", "異" },
-    { "弃", "棄" },
-    { "弃舍", "棄捨" },
-    { "弄丑", "弄醜" },
-    { "弄干", "弄乾" },
-    { "弄松", "弄鬆" },
-    { "弄脏胸", "弄髒胸" },
-    { "弄鬼吊猴", "弄鬼弔猴" },
-    { "弑", "弒" },
-    { "引发", "引發" },
-    { "引斗", "引鬥" },
-    { "弘历", "弘曆" },
-    { "弘历史", "弘歷史" },
-    { "张", "張" },
-    { "张三丰", "張三丰" },
-    { "张乐于张徐", "張樂于張徐" },
-    { "张勋", "張勳" },
-    { "张杰", "張杰" },
-    { "张柏芝", "張栢芝" },
-    { "弥", "彌" },
-    { "弥山遍野", "瀰山遍野" },
-    { "弥弥", "瀰瀰" },
-    { "弥漫", "瀰漫" },
-    { "弪", "弳" },
-    { "弯", "彎" },
-    { "弹", "彈" },
-    { "弹子台", "彈子檯" },
-    { "弹珠台", "彈珠檯" },
-    { "强", "強" },
-    { "强制", "強制" },
-    { "强制作用", "強制作用" },
-    { "强奸", "強姦" },
-    { "强干", "強幹" },
-    { "归", "歸" },
-    { "归余", "歸餘" },
-    { "归并", "歸併" },
-    { "当", "當" },
-    { "当准", "當準" },
-    { "当啷", "噹啷" },
-    { "当当", "噹噹" },
-    { "当当丁丁", "當當丁丁" },
-    { "当当网", "當當網" },
-    { "录", "錄" },
-    { "录制", "錄製" },
-    { "形单影只", "形單影隻" },
-    { "彦", "彥" },
-    { "影相吊", "影相弔" },
-    { "彻", "徹" },
-    { "往复式", "往復式" },
-    { "往日无仇", "往日無讎" },
-    { "往里", "往裡" },
-    { "征令", "徵令" },
-    { "征信", "徵信" },
-    { "征候", "徵候" },
-    { "征兆", "徵兆" },
-    { "征兵", "徵兵" },
-    { "征到", "徵到" },
-    { "征募", "徵募" },
-    { "征友", "徵友" },
-    { "征发", "徵發" },
-    { "征召", "徵召" },
-    { "征名责实", "徵名責實" },
-    { "征吏", "徵吏" },
-    { "征启", "徵啟" },
-    { "征咎", "徵咎" },
-    { "征圣", "徵聖" },
-    { "征士", "徵士" },
-    { "征婚", "徵婚" },
-    { "征实", "徵實" },
-    { "征庸", "徵庸" },
-    { "征引", "徵引" },
-    { "征得", "徵得" },
-    { "征怪", "徵怪" },
-    { "征才", "徵才" },
-    { "征招", "徵招" },
-    { "征收", "徵收" },
-    { "征效", "徵效" },
-    { "征文", "徵文" },
-    { "征求", "徵求" },
-    { "征状", "徵狀" },
-    { "征用", "徵用" },
-    { "征税", "徵稅" },
-    { "征稿", "徵稿" },
-    { "征答", "徵答" },
-    { "征结", "徵結" },
-    { "征聘", "徵聘" },
-    { "征训", "徵訓" },
-    { "征询", "徵詢" },
-    { "征调", "徵調" },
-    { "征象", "徵象" },
-    { "征购", "徵購" },
-    { "征车", "徵車" },
-    { "征辟", "徵辟" },
-    { "征迹", "徵跡" },
-    { "征选", "徵選" },
-    { "征逐", "徵逐" },
-    { "征集", "徵集" },
-    { "征风召雨", "徵風召雨" },
-    { "征验", "徵驗" },
-    { "径", "徑" },
-    { "待复", "待覆" },
-    { "很丑", "很醜" },
-    { "很准", "很準" },
-    { "很凶", "很兇" },
-    { "很干", "很乾" },
-    { "很松", "很鬆" },
-    { "律历志", "律曆志" },
-    { "徐干", "徐幹" },
-    { "徒托空言", "徒託空言" },
-    { "徕", "徠" },
-    { "得到回复", "得到回覆" },
-    { "得力干将", "得力幹將" },
-    { "御侮", "禦侮" },
-    { "御制", "御製" },
-    { "御寇", "禦寇" },
-    { "御寒", "禦寒" },
-    { "御岳山", "御嶽山" },
-    { "御敌", "禦敵" },
-    { "心余", "心餘" },
-    { "心系一", "心繫一" },
-    { "心系万", "心繫萬" },
-    { "心系世", "心繫世" },
-    { "心系东", "心繫東" },
-    { "心系两", "心繫兩" },
-    { "心系中", "心繫中" },
-    { "心系乔", "心繫喬" },
-    { "心系五", "心繫五" },
-    { "心系京", "心繫京" },
-    { "心系人", "心繫人" },
-    { "心系他", "心繫他" },
-    { "心系伊", "心繫伊" },
-    { "心系众", "心繫眾" },
-    { "心系传", "心繫傳" },
-    { "心系何", "心繫何" },
-    { "心系你", "心繫你" },
-    { "心系健", "心繫健" },
-    { "心系全", "心繫全" },
-    { "心系兰", "心繫蘭" },
-    { "心系农", "心繫农" },
-    { "心系功", "心繫功" },
-    { "心系动", "心繫動" },
-    { "心系募", "心繫募" },
-    { "心系北", "心繫北" },
-    { "心系十", "心繫十" },
-    { "心系千", "心繫千" },
-    { "心系南", "心繫南" },
-    { "心系台", "心繫台" },
-    { "心系和", "心繫和" },
-    { "心系哪", "心繫哪" },
-    { "心系唐", "心繫唐" },
-    { "心系嘱", "心繫囑" },
-    { "心系四", "心繫四" },
-    { "心系困", "心繫困" },
-    { "心系国", "心繫國" },
-    { "心系在", "心繫在" },
-    { "心系地", "心繫地" },
-    { "心系大", "心繫大" },
-    { "心系天", "心繫天" },
-    { "心系夫", "心繫夫" },
-    { "心系奥", "心繫奧" },
-    { "心系女", "心繫女" },
-    { "心系她", "心繫她" },
-    { "心系妇", "心繫婦" },
-    { "心系妻", "心繫妻" },
-    { "心系子", "心繫子" },
-    { "心系它", "心繫它" },
-    { "心系宣", "心繫宣" },
-    { "心系家", "心繫家" },
-    { "心系富", "心繫富" },
-    { "心系小", "心繫小" },
-    { "心系山", "心繫山" },
-    { "心系川", "心繫川" },
-    { "心系幼", "心繫幼" },
-    { "心系广", "心繫廣" },
-    { "心系彼", "心繫彼" },
-    { "心系德", "心繫德" },
-    { "心系您", "心繫您" },
-    { "心系慈", "心繫慈" },
-    { "心系我", "心繫我" },
-    { "心系摩", "心繫摩" },
-    { "心系故", "心繫故" },
-    { "心系新", "心繫新" },
-    { "心系日", "心繫日" },
-    { "心系昌", "心繫昌" },
-    { "心系晓", "心繫曉" },
-    { "心系曼", "心繫曼" },
-    { "心系林", "心繫林" },
-    { "心系母", "心繫母" },
-    { "心系民", "心繫民" },
-    { "心系江", "心繫江" },
-    { "心系汶", "心繫汶" },
-    { "心系沈", "心繫沈" },
-    { "心系沙", "心繫沙" },
-    { "心系泰", "心繫泰" },
-    { "心系浙", "心繫浙" },
-    { "心系港", "心繫港" },
-    { "心系湖", "心繫湖" },
-    { "心系澳", "心繫澳" },
-    { "心系灾", "心繫災" },
-    { "心系父", "心繫父" },
-    { "心系生", "心繫生" },
-    { "心系病", "心繫病" },
-    { "心系百", "心繫百" },
-    { "心系的", "心繫的" },
-    { "心系社", "心繫社" },
-    { "心系祖", "心繫祖" },
-    { "心系神", "心繫神" },
-    { "心系红", "心繫紅" },
-    { "心系美", "心繫美" },
-    { "心系群", "心繫群" },
-    { "心系老", "心繫老" },
-    { "心系舞", "心繫舞" },
-    { "心系英", "心繫英" },
-    { "心系茶", "心繫茶" },
-    { "心系西", "心繫西" },
-    { "心系贫", "心繫貧" },
-    { "心系输", "心繫輸" },
-    { "心系近", "心繫近" },
-    { "心系远", "心繫遠" },
-    { "心系选", "心繫選" },
-    { "心系重", "心繫重" },
-    { "心系长", "心繫長" },
-    { "心系阮", "心繫阮" },
-    { "心系震", "心繫震" },
-    { "心系非", "心繫非" },
-    { "心系风", "心繫風" },
-    { "心系香", "心繫香" },
-    { "心系高", "心繫高" },
-    { "心系麦", "心繫麥" },
-    { "心系黄", "心繫黃" },
-    { "心细如发", "心細如髮" },
-    { "心脏", "心臟" },
-    { "心脏痳痹", "心臟痲痺" },
-    { "心荡", "心蕩" },
-    { "心里", "心裡" },
-    { "心里面", "心裏面" },
-    { "心长发短", "心長髮短" },
-    { "必须", "必須" },
-    { "忆", "憶" },
-    { "忏", "懺" },
-    { "志哀", "誌哀" },
-    { "志喜", "誌喜" },
-    { "志庆", "誌慶" },
-    { "志异", "誌異" },
-    { "忙里", "忙裡" },
-    { "忙里偷闲", "忙裡偷閒" },
-    { "忠仆", "忠僕" },
-    { "忧", "憂" },
-    { "忧郁", "憂鬱" },
-    { "快冲", "快衝" },
-    { "快快当当", "快快當當" },
-    { "忾", "愾" },
-    { "怀", "懷" },
-    { "怀里", "懷裡" },
-    { "怀钟", "懷鐘" },
-    { "态", "態" },
-    { "怂", "慫" },
-    { "怃", "憮" },
-    { "怄", "慪" },
-    { "怅", "悵" },
-    { "怆", "愴" },
-    { "怎么干", "怎麼幹" },
-    { "怒发冲冠", "怒髮衝冠" },
-    { "怒气冲天", "怒氣衝天" },
-    { "怒火冲天", "怒火衝天" },
-    { "怜", "憐" },
-    { "思如泉涌", "思如泉湧" },
-    { "急冲而下", "急衝而下" },
-    { "性别扭曲", "性別扭曲" },
-    { "性征", "性徵" },
-    { "性欲", "性慾" },
-    { "怨气冲天", "怨氣衝天" },
-    { "怪里怪气", "怪裡怪氣" },
-    { "怫郁", "怫鬱" },
-    { "总", "總" },
-    { "总数只", "總數只" },
-    { "总数里", "總數裡" },
-    { "总裁制", "總裁制" },
-    { "怼", "懟" },
-    { "怿", "懌" },
-    { "恂栗", "恂慄" },
-    { "恋", "戀" },
-    { "恋恋不舍", "戀戀不捨" },
-    { "恒", "恆" },
-    { "息交绝游", "息交絕遊" },
-    { "息谷", "息穀" },
-    { "恳", "懇" },
-    { "恳托", "懇託" },
-    { "恶", "惡" },
-    { "恶仆", "惡僕" },
-    { "恶心", "噁心" },
-    { "恶斗", "惡鬥" },
-    { "恶直丑正", "惡直醜正" },
-    { "恸", "慟" },
-    { "恹", "懨" },
-    { "恺", "愷" },
-    { "恻", "惻" },
-    { "恼", "惱" },
-    { "恽", "惲" },
-    { "悒郁", "悒鬱" },
-    { "悠悠荡荡", "悠悠蕩蕩" },
-    { "悠游", "悠遊" },
-    { "悠荡", "悠蕩" },
-    { "悦", "悅" },
-    { "悫", "愨" },
-    { "悬", "懸" },
-    { "悬挂", "懸掛" },
-    { "悬梁", "懸樑" },
-    { "悬臂梁", "懸臂樑" },
-    { "悬钟", "懸鐘" },
-    { "悭", "慳" },
-    { "悯", "憫" },
-    { "悲凄", "悲悽" },
-    { "悲郁", "悲鬱" },
-    { "悸栗", "悸慄" },
-    { "情欲", "情慾" },
-    { "惇朴", "惇樸" },
-    { "惊", "驚" },
-    { "惊栗", "驚慄" },
-    { "惊赞", "驚讚" },
-    { "惊钟", "驚鐘" },
-    { "惧", "懼" },
-    { "惨", "慘" },
-    { "惨淡", "慘澹" },
-    { "惩", "懲" },
-    { "惩忿窒欲", "懲忿窒欲" },
-    { "惫", "憊" },
-    { "惬", "愜" },
-    { "惭", "慚" },
-    { "惮", "憚" },
-    { "惯", "慣" },
-    { "惴栗", "惴慄" },
-    { "愈合", "癒合" },
-    { "意大利面", "意大利麵" },
-    { "愠", "慍" },
-    { "愤", "憤" },
-    { "愦", "憒" },
-    { "愿", "願" },
-    { "愿朴", "愿樸" },
-    { "慈溪", "慈谿" },
-    { "慌里慌张", "慌裡慌張" },
-    { "慑", "懾" },
-    { "懈松", "懈鬆" },
-    { "懑", "懣" },
-    { "懒", "懶" },
-    { "懔", "懍" },
-    { "懔栗", "懍慄" },
-    { "懿范", "懿範" },
-    { "戆", "戇" },
-    { "戋", "戔" },
-    { "戏", "戲" },
-    { "戏里", "戲裡" },
-    { "成于思", "成於思" },
-    { "戗", "戧" },
-    { "战", "戰" },
-    { "战天斗地", "戰天鬥地" },
-    { "战斗", "戰鬥" },
-    { "战栗", "戰慄" },
-    { "戬", "戩" },
-    { "戬谷", "戩穀" },
-    { "戯", "戱" },
-    { "戴发含齿", "戴髮含齒" },
-    { "户", "戶" },
-    { "房里", "房裡" },
-    { "所托", "所託" },
-    { "扁拟谷盗虫", "扁擬穀盜蟲" },
-    { "手冢治虫", "手塚治虫" },
-    { "手折", "手摺" },
-    { "手松", "手鬆" },
-    { "手游", "手遊" },
-    { "手表", "手錶" },
-    { "手表决", "手表決" },
-    { "手表态", "手表態" },
-    { "手表现", "手表現" },
-    { "手表达", "手表達" },
-    { "手里", "手裡" },
-    { "手里剑", "手裏劍" },
-    { "手链", "手鍊" },
-    { "才干", "才幹" },
-    { "才干扰", "才干擾" },
-    { "才干预", "才干預" },
-    { "扎上", "紮上" },
-    { "扎下", "紮下" },
-    { "扎囮", "紮囮" },
-    { "扎好", "紮好" },
-    { "扎实", "紮實" },
-    { "扎寨", "紮寨" },
-    { "扎带子", "紮帶子" },
-    { "扎成", "紮成" },
-    { "扎根", "紮根" },
-    { "扎紧", "紮緊" },
-    { "扎脚", "紮腳" },
-    { "扎营", "紮營" },
-    { "扎裹", "紮裹" },
-    { "扎诈", "紮詐" },
-    { "扎起", "紮起" },
-    { "扎铁", "紮鐵" },
-    { "扑", "撲" },
-    { "扑冬", "撲鼕" },
-    { "扑咚", "撲鼕" },
-    { "扑咚咚", "撲鼕鼕" },
-    { "扑挞", "扑撻" },
-    { "打出吊入", "打出弔入" },
-    { "打卡钟", "打卡鐘" },
-    { "打卤", "打滷" },
-    { "打干", "打幹" },
-    { "打干哕", "打乾噦" },
-    { "打斗", "打鬥" },
-    { "打断发", "打斷發" },
-    { "打谷", "打穀" },
-    { "打钟", "打鐘" },
-    { "打风后", "打風後" },
-    { "托买", "託買" },
-    { "托了", "託了" },
-    { "托事", "託事" },
-    { "托交", "託交" },
-    { "托付", "託付" },
-    { "托儿", "託兒" },
-    { "托克逊", "託克遜" },
-    { "托卖", "託賣" },
-    { "托古讽今", "託古諷今" },
-    { "托名", "託名" },
-    { "托命", "託命" },
-    { "托咎", "託咎" },
-    { "托孤", "託孤" },
-    { "托庇", "託庇" },
-    { "托故", "託故" },
-    { "托梦", "託夢" },
-    { "托疾", "託疾" },
-    { "托病", "託病" },
-    { "托管", "託管" },
-    { "托管国", "托管國" },
-    { "托言", "託言" },
-    { "托词", "託詞" },
-    { "托身", "託身" },
-    { "托辞", "託辭" },
-    { "托过", "託過" },
-    { "托运", "託運" },
-    { "托里县", "託里縣" },
-    { "托附", "託附" },
-    { "扛大梁", "扛大樑" },
-    { "执", "執" },
-    { "扩", "擴" },
-    { "扪", "捫" },
-    { "扫", "掃" },
-    { "扫荡", "掃蕩" },
-    { "扬", "揚" },
-    { "扯面", "扯麵" },
-    { "扰", "擾" },
-    { "扶余", "扶餘" },
-    { "批准确定", "批准確定" },
-    { "批复", "批覆" },
-    { "批斗", "批鬥" },
-    { "批注", "批註" },
-    { "扼肮", "搤肮" },
-    { "扼肮拊背", "搤肮拊背" },
-    { "抑郁", "抑鬱" },
-    { "抓奸", "抓姦" },
-    { "抓斗", "抓鬥" },
-    { "抗御", "抗禦" },
-    { "折冲", "折衝" },
-    { "折叠", "摺疊" },
-    { "折台", "摺檯" },
-    { "折奏", "摺奏" },
-    { "折子", "摺子" },
-    { "折子戏", "折子戲" },
-    { "折尺", "摺尺" },
-    { "折扇", "摺扇" },
-    { "折梯", "摺梯" },
-    { "折椅", "摺椅" },
-    { "折痕", "摺痕" },
-    { "折篷", "摺篷" },
-    { "折纸", "摺紙" },
-    { "折裙", "摺裙" },
-    { "抚", "撫" },
-    { "抛", "拋" },
-    { "抟", "摶" },
-    { "抠", "摳" },
-    { "抡", "掄" },
-    { "抢", "搶" },
-    { "护", "護" },
-    { "护发", "護髮" },
-    { "报", "報" },
-    { "披发", "披髮" },
-    { "披头散发", "披頭散髮" },
-    { "披榛采兰", "披榛採蘭" },
-    { "抱朴而长吟兮", "抱朴而長吟兮" },
-    { "抱素怀朴", "抱素懷樸" },
-    { "抵御", "抵禦" },
-    { "抵牾", "牴牾" },
-    { "抵触", "牴觸" },
-    { "抹干", "抹乾" },
-    { "抽公签", "抽公籤" },
-    { "抽干", "抽乾" },
-    { "抽签", "抽籤" },
-    { "抿发", "抿髮" },
-    { "拂钟无声", "拂鐘無聲" },
-    { "担", "擔" },
-    { "担仔面", "擔仔麵" },
-    { "担担面", "擔擔麵" },
-    { "拆伙", "拆夥" },
-    { "拈须", "拈鬚" },
-    { "拉克施尔德钟", "拉克施爾德鐘" },
-    { "拉纤", "拉縴" },
-    { "拉面", "拉麵" },
-    { "拉面无", "拉面無" },
-    { "拌面", "拌麵" },
-    { "拓朴", "拓樸" },
-    { "拔发", "拔髮" },
-    { "拔须", "拔鬚" },
-    { "拗别", "拗彆" },
-    { "拙朴", "拙樸" },
-    { "拚舍", "拚捨" },
-    { "拜托", "拜託" },
-    { "拟", "擬" },
-    { "拢", "攏" },
-    { "拣", "揀" },
-    { "拥", "擁" },
-    { "拦", "攔" },
-    { "拧", "擰" },
-    { "拧干", "擰乾" },
-    { "拨", "撥" },
-    { "拨谷", "撥穀" },
-    { "择", "擇" },
-    { "括发", "括髮" },
-    { "拭干", "拭乾" },
-    { "拳局", "拳跼" },
-    { "拼斗", "拼鬥" },
-    { "拾沈", "拾瀋" },
-    { "拿准", "拿準" },
-    { "拿破仑", "拿破崙" },
-    { "挂", "掛" },
-    { "挂历", "掛曆" },
-    { "挂名", "掛名" },
-    { "挂钩", "掛鈎" },
-    { "挂面", "掛麵" },
-    { "挌斗", "挌鬥" },
-    { "挑大梁", "挑大樑" },
-    { "挑斗", "挑鬥" },
-    { "挚", "摯" },
-    { "挛", "攣" },
-    { "挝", "撾" },
-    { "挞", "撻" },
-    { "挟", "挾" },
-    { "挠", "撓" },
-    { "挡", "擋" },
-    { "挢", "撟" },
-    { "挣", "掙" },
-    { "挤", "擠" },
-    { "挥", "揮" },
-    { "挥手表", "揮手表" },
-    { "挽曲", "輓曲" },
-    { "挽歌", "輓歌" },
-    { "挽联", "輓聯" },
-    { "挽词", "輓詞" },
-    { "挽诗", "輓詩" },
-    { "挽车", "輓車" },
-    { "挽输", "輓輸" },
-    { "挽辞", "輓辭" },
-    { "捆扎", "綑紮" },
-    { "捉发", "捉髮" },
-    { "捉奸", "捉姦" },
-    { "捉奸党", "捉奸黨" },
-    { "捉奸细", "捉奸細" },
-    { "捉奸贼", "捉奸賊" },
-    { "捍御", "捍禦" },
-    { "捏面人", "捏麵人" },
-    { "捞", "撈" },
-    { "捞干", "撈乾" },
-    { "捞面", "撈麵" },
-    { "损", "損" },
-    { "捡", "撿" },
-    { "换", "換" },
-    { "换只", "換隻" },
-    { "换签", "換籤" },
-    { "捣", "搗" },
-    { "捣鬼吊白", "搗鬼弔白" },
-    { "据", "據" },
-    { "据云", "據云" },
-    { "捵面", "捵麵" },
-    { "捶炼", "捶鍊" },
-    { "授勋", "授勳" },
-    { "授时历", "授時曆" },
-    { "排干", "排乾" },
-    { "排干部", "排幹部" },
-    { "排骨面", "排骨麵" },
-    { "掣签", "掣籤" },
-    { "推情准理", "推情準理" },
-    { "推托", "推託" },
-    { "推托之词", "推托之詞" },
-    { "掳", "擄" },
-    { "掴", "摑" },
-    { "掷", "擲" },
-    { "掸", "撣" },
-    { "掺", "摻" },
-    { "掼", "摜" },
-    { "提子干", "提子乾" },
-    { "提心吊胆", "提心弔膽" },
-    { "提摩太后书", "提摩太後書" },
-    { "提高后", "提高後" },
-    { "握发", "握髮" },
-    { "揩干", "揩乾" },
-    { "揪发", "揪髮" },
-    { "揪采", "揪採" },
-    { "揪须", "揪鬚" },
-    { "揭丑", "揭醜" },
-    { "揽", "攬" },
-    { "揿", "撳" },
-    { "搀", "攙" },
-    { "搁", "擱" },
-    { "搂", "摟" },
-    { "搅", "攪" },
-    { "搋面", "搋麵" },
-    { "搏斗", "搏鬥" },
-    { "搬斗", "搬鬥" },
-    { "搭伙", "搭夥" },
-    { "搭干铺", "搭乾鋪" },
-    { "携", "攜" },
-    { "摄", "攝" },
-    { "摄制", "攝製" },
-    { "摅", "攄" },
-    { "摆", "擺" },
-    { "摆钟", "擺鐘" },
-    { "摇", "搖" },
-    { "摈", "擯" },
-    { "摊", "攤" },
-    { "摧坚获丑", "摧堅獲醜" },
-    { "摭采", "摭採" },
-    { "摸棱", "摸稜" },
-    { "摸钟", "摸鐘" },
-    { "撄", "攖" },
-    { "撇吊", "撇弔" },
-    { "撑", "撐" },
-    { "撚须", "撚鬚" },
-    { "撞钟", "撞鐘" },
-    { "撞阵冲军", "撞陣衝軍" },
-    { "撤并", "撤併" },
-    { "撩斗", "撩鬥" },
-    { "撵", "攆" },
-    { "撷", "擷" },
-    { "撸", "擼" },
-    { "撺", "攛" },
-    { "擀面", "擀麵" },
-    { "操作钟", "操作鐘" },
-    { "擞", "擻" },
-    { "擢发", "擢髮" },
-    { "擦干", "擦乾" },
-    { "攒", "攢" },
-    { "支干", "支幹" },
-    { "支配欲", "支配慾" },
-    { "收获", "收穫" },
-    { "改征", "改徵" },
-    { "改采", "改採" },
-    { "放懞挣", "放懞掙" },
-    { "放松", "放鬆" },
-    { "放荡", "放蕩" },
-    { "政斗", "政鬥" },
-    { "敌", "敵" },
-    { "敌忾同仇", "敵愾同讎" },
-    { "教学钟", "教學鐘" },
-    { "教范", "教範" },
-    { "敛", "斂" },
-    { "敢干", "敢幹" },
-    { "敢斗了胆", "敢斗了膽" },
-    { "散伙", "散夥" },
-    { "散荡", "散蕩" },
-    { "敦朴", "敦樸" },
-    { "敬挽", "敬輓" },
-    { "数", "數" },
-    { "数只", "數隻" },
-    { "数只会", "數只會" },
-    { "数只包括", "數只包括" },
-    { "数只可", "數只可" },
-    { "数只含", "數只含" },
-    { "数只在", "數只在" },
-    { "数只应", "數只應" },
-    { "数只是", "數只是" },
-    { "数只有", "數只有" },
-    { "数只比", "數只比" },
-    { "数只能", "數只能" },
-    { "数只限", "數只限" },
-    { "数只需", "數只需" },
-    { "数只须", "數只須" },
-    { "数天后", "數天後" },
-    { "数字钟", "數字鐘" },
-    { "数字钟表", "數字鐘錶" },
-    { "数罪并罚", "數罪併罰" },
-    { "敲钟", "敲鐘" },
-    { "整出剧", "整齣劇" },
-    { "整出戏", "整齣戲" },
-    { "整出电影", "整齣電影" },
-    { "整发用品", "整髮用品" },
-    { "整只", "整隻" },
-    { "整风后", "整風後" },
-    { "文学志", "文學誌" },
-    { "文征明", "文徵明" },
-    { "文思泉涌", "文思泉湧" },
-    { "斋", "齋" },
-    { "斓", "斕" },
-    { "斗不过", "鬥不過" },
-    { "斗丽", "鬥麗" },
-    { "斗了", "鬥了" },
-    { "斗争", "鬥爭" },
-    { "斗争斗合", "鬥爭鬥合" },
-    { "斗倒", "鬥倒" },
-    { "斗兽", "鬥獸" },
-    { "斗分子", "鬥分子" },
-    { "斗别气", "鬥彆氣" },
-    { "斗剑", "鬥劍" },
-    { "斗力", "鬥力" },
-    { "斗劲", "鬥勁" },
-    { "斗勇", "鬥勇" },
-    { "斗叠", "鬥疊" },
-    { "斗叶儿", "鬥葉兒" },
-    { "斗叶子", "鬥葉子" },
-    { "斗合", "鬥合" },
-    { "斗哄", "鬥鬨" },
-    { "斗嘴", "鬥嘴" },
-    { "斗地主", "鬥地主" },
-    { "斗垮", "鬥垮" },
-    { "斗士", "鬥士" },
-    { "斗头", "鬥頭" },
-    { "斗富", "鬥富" },
-    { "斗巧", "鬥巧" },
-    { "斗幌子", "鬥幌子" },
-    { "斗弄", "鬥弄" },
-    { "斗引", "鬥引" },
-    { "斗彩", "鬥彩" },
-    { "斗心眼", "鬥心眼" },
-    { "斗志", "鬥志" },
-    { "斗成", "鬥成" },
-    { "斗战", "鬥戰" },
-    { "斗打", "鬥打" },
-    { "斗批改", "鬥批改" },
-    { "斗技", "鬥技" },
-    { "斗文", "鬥文" },
-    { "斗斗", "鬥鬥" },
-    { "斗智", "鬥智" },
-    { "斗暴", "鬥暴" },
-    { "斗来斗去", "鬥來鬥去" },
-    { "斗武", "鬥武" },
-    { "斗殴", "鬥毆" },
-    { "斗气", "鬥氣" },
-    { "斗法", "鬥法" },
-    { "斗牌", "鬥牌" },
-    { "斗牙拌齿", "鬥牙拌齒" },
-    { "斗牙斗齿", "鬥牙鬥齒" },
-    { "斗牛", "鬥牛" },
-    { "斗犀台", "鬥犀臺" },
-    { "斗犬", "鬥犬" },
-    { "斗狗", "鬥狗" },
-    { "斗狠", "鬥狠" },
-    { "斗百草", "鬥百草" },
-    { "斗眼", "鬥眼" },
-    { "斗私批修", "鬥私批修" },
-    { "斗而铸兵", "鬥而鑄兵" },
-    { "斗而铸锥", "鬥而鑄錐" },
-    { "斗胜", "鬥勝" },
-    { "斗脚", "鬥腳" },
-    { "斗舰", "鬥艦" },
-    { "斗艳", "鬥豔" },
-    { "斗茶", "鬥茶" },
-    { "斗草", "鬥草" },
-    { "斗蛐", "鬥蛐" },
-    { "斗蟋蟀", "鬥蟋蟀" },
-    { "斗话", "鬥話" },
-    { "斗败", "鬥敗" },
-    { "斗起", "鬥起" },
-    { "斗趣", "鬥趣" },
-    { "斗闲气", "鬥閒氣" },
-    { "斗闷", "鬥悶" },
-    { "斗雪红", "鬥雪紅" },
-    { "斗风", "鬥風" },
-    { "斗鱼", "鬥魚" },
-    { "斗鸡", "鬥雞" },
-    { "斗鸭", "鬥鴨" },
-    { "斗鹌鹑", "鬥鵪鶉" },
-    { "斗龙", "鬥龍" },
-    { "斩", "斬" },
-    { "斫雕为朴", "斫雕為樸" },
-    { "断", "斷" },
-    { "断发", "斷髮" },
-    { "断发文身", "斷髮文身" },
-    { "新历", "新曆" },
-    { "新历史", "新歷史" },
-    { "新干县", "新幹縣" },
-    { "新扎", "新紮" },
-    { "斲雕为朴", "斲雕為樸" },
-    { "方便面", "方便麵" },
-    { "方法里", "方法裡" },
-    { "施舍", "施捨" },
-    { "旁征博引", "旁徵博引" },
-    { "旁注", "旁註" },
-    { "旅游", "旅遊" },
-    { "旋回", "旋迴" },
-    { "旋松", "旋鬆" },
-    { "族里", "族裡" },
-    { "无", "無" },
-    { "无业游民", "無業游民" },
-    { "无余", "無餘" },
-    { "无征不信", "無徵不信" },
-    { "无梁楼盖", "無樑樓蓋" },
-    { "日历", "日曆" },
-    { "日历史", "日歷史" },
-    { "日心历表", "日心曆表" },
-    { "日志", "日誌" },
-    { "日里", "日裡" },
-    { "旧", "舊" },
-    { "旧历", "舊曆" },
-    { "旧历史", "舊歷史" },
-    { "旧游", "舊遊" },
-    { "旧表", "舊錶" },
-    { "旧钟", "舊鐘" },
-    { "旧钟表", "舊鐘錶" },
-    { "旱干", "旱乾" },
-    { "时", "時" },
-    { "时钟", "時鐘" },
-    { "时间不准", "時間不準" },
-    { "旷", "曠" },
-    { "昆仑", "崑崙" },
-    { "昆冈", "崑岡" },
-    { "昆剧", "崑劇" },
-    { "昆山", "崑山" },
-    { "昆嵛", "崑嵛" },
-    { "昆承湖", "崑承湖" },
-    { "昆曲", "崑曲" },
-    { "昆腔", "崑腔" },
-    { "昆苏", "崑蘇" },
-    { "昆调", "崑調" },
-    { "昊天不吊", "昊天不弔" },
-    { "明征", "明徵" },
-    { "明目张胆", "明目張胆" },
-    { "明窗净几", "明窗淨几" },
-    { "明范", "明範" },
-    { "明鉴", "明鑑" },
-    { "昙", "曇" },
-    { "星历", "星曆" },
-    { "星历史", "星歷史" },
-    { "星期后", "星期後" },
-    { "星露谷物语", "星露谷物語" },
-    { "春游", "春遊" },
-    { "春香斗学", "春香鬥學" },
-    { "是发小", "是髮小" },
-    { "昵称", "暱稱" },
-    { "昼", "晝" },
-    { "显", "顯" },
-    { "显示表", "顯示錶" },
-    { "显示表头", "顯示表頭" },
-    { "显示表明", "顯示表明" },
-    { "显示表格", "顯示表格" },
-    { "显示表现", "顯示表現" },
-    { "显示表示", "顯示表示" },
-    { "显示表达", "顯示表達" },
-    { "显示表面", "顯示表面" },
-    { "显示钟", "顯示鐘" },
-    { "显示钟表", "顯示鐘錶" },
-    { "晃荡", "晃蕩" },
-    { "晋", "晉" },
-    { "晒", "曬" },
-    { "晒干", "曬乾" },
-    { "晒谷", "曬穀" },
-    { "晓", "曉" },
-    { "晔", "曄" },
-    { "晕", "暈" },
-    { "晖", "暉" },
-    { "晚钟", "晚鐘" },
-    { "晞发", "晞髮" },
-    { "晨钟", "晨鐘" },
-    { "普咚咚", "普鼕鼕" },
-    { "晾干", "晾乾" },
-    { "暂", "暫" },
-    { "暗地里", "暗地裡" },
-    { "暗斗", "暗鬥" },
-    { "暗沟里", "暗溝裡" },
-    { "暗里", "暗裡" },
-    { "暧", "曖" },
-    { "暴敛横征", "暴斂橫徵" },
-    { "曲尘", "麴塵" },
-    { "曲櫱", "麴櫱" },
-    { "曲秀才", "麴秀才" },
-    { "曲车", "麴車" },
-    { "曲道士", "麴道士" },
-    { "曲钱", "麴錢" },
-    { "曲霉", "麴黴" },
-    { "更仆难数", "更僕難數" },
-    { "更签", "更籤" },
-    { "更钟", "更鐘" },
-    { "曾朴", "曾樸" },
-    { "月历", "月曆" },
-    { "月历史", "月歷史" },
-    { "月球历表", "月球曆表" },
-    { "月里来", "月裡來" },
-    { "有事之无范", "有事之無範" },
-    { "有仆", "有僕" },
-    { "有余", "有餘" },
-    { "有准", "有準" },
-    { "有发头陀寺", "有髮頭陀寺" },
-    { "有只", "有隻" },
-    { "有只采", "有只採" },
-    { "有回复", "有回覆" },
-    { "有够赞", "有夠讚" },
-    { "有征", "有徵" },
-    { "有征战", "有征戰" },
-    { "有征讨", "有征討" },
-    { "有棱有角", "有稜有角" },
-    { "朝钟", "朝鐘" },
-    { "朝鲜于", "朝鮮於" },
-    { "朦胧", "朦朧" },
-    { "木偶戏扎", "木偶戲紮" },
-    { "木制", "木製" },
-    { "木材干馏", "木材乾餾" },
-    { "木梁", "木樑" },
-    { "木签", "木籤" },
-    { "木钟", "木鐘" },
-    { "未干", "未乾" },
-    { "未干预", "未干預" },
-    { "本出戏", "本齣戲" },
-    { "本征", "本徵" },
-    { "术", "術" },
-    { "术虎高", "朮虎高" },
-    { "术赤", "朮赤" },
-    { "朱庆余", "朱慶餘" },
-    { "朱理安历", "朱理安曆" },
-    { "朱理安历史", "朱理安歷史" },
-    { "朱砂", "硃砂" },
-    { "朴修斯", "樸修斯" },
-    { "朴厚", "樸厚" },
-    { "朴学", "樸學" },
-    { "朴实", "樸實" },
-    { "朴念仁", "樸念仁" },
-    { "朴拙", "樸拙" },
-    { "朴樕", "樸樕" },
-    { "朴父", "樸父" },
-    { "朴直", "樸直" },
-    { "朴素", "樸素" },
-    { "朴讷", "樸訥" },
-    { "朴质", "樸質" },
-    { "朴鄙", "樸鄙" },
-    { "朴重", "樸重" },
-    { "朴野", "樸野" },
-    { "朴钝", "樸鈍" },
-    { "朴陋", "樸陋" },
-    { "朴马", "樸馬" },
-    { "朴鲁", "樸魯" },
-    { "机", "機" },
-    { "机械系", "機械系" },
-    { "机械表", "機械錶" },
-    { "机械钟", "機械鐘" },
-    { "机械钟表", "機械鐘錶" },
-    { "杀", "殺" },
-    { "杂", "雜" },
-    { "杂合面儿", "雜合麵兒" },
-    { "杂志", "雜誌" },
-    { "杂面", "雜麵" },
-    { "权", "權" },
-    { "杆枪", "桿槍" },
-    { "杆秤", "桿秤" },
-    { "杆菌", "桿菌" },
-    { "李连杰", "李連杰" },
-    { "材干", "材幹" },
-    { "村落发", "村落發" },
-    { "村里有", "村裡有" },
-    { "村里的", "村裡的" },
-    { "杜琪峰", "杜琪峯" },
-    { "杜老志道", "杜老誌道" },
-    { "杞宋无征", "杞宋無徵" },
-    { "束发", "束髮" },
-    { "杠", "槓" },
-    { "杠杆", "槓桿" },
-    { "杠毂", "杠轂" },
-    { "条", "條" },
-    { "条文里", "條文裡" },
-    { "来", "來" },
-    { "杨", "楊" },
-    { "杨雅筑", "楊雅筑" },
-    { "杩", "榪" },
-    { "杯干", "杯乾" },
-    { "杯面", "杯麵" },
-    { "杰", "傑" },
-    { "杰伦", "杰倫" },
-    { "杰威尔", "杰威爾" },
-    { "松一口气", "鬆一口氣" },
-    { "松了", "鬆了" },
-    { "松些", "鬆些" },
-    { "松元音", "鬆元音" },
-    { "松动", "鬆動" },
-    { "松劲", "鬆勁" },
-    { "松化", "鬆化" },
-    { "松口", "鬆口" },
-    { "松口镇", "松口鎮" },
-    { "松喉", "鬆喉" },
-    { "松土", "鬆土" },
-    { "松宽", "鬆寬" },
-    { "松开", "鬆開" },
-    { "松弛", "鬆弛" },
-    { "松快", "鬆快" },
-    { "松懈", "鬆懈" },
-    { "松手", "鬆手" },
-    { "松掉", "鬆掉" },
-    { "松散", "鬆散" },
-    { "松松地", "鬆鬆地" },
-    { "松柔", "鬆柔" },
-    { "松气", "鬆氣" },
-    { "松浮", "鬆浮" },
-    { "松溪县", "松谿縣" },
-    { "松紧", "鬆緊" },
-    { "松绑", "鬆綁" },
-    { "松缓", "鬆緩" },
-    { "松耦合", "鬆耦合" },
-    { "松脆", "鬆脆" },
-    { "松脱", "鬆脫" },
-    { "松蛋", "鬆蛋" },
-    { "松软", "鬆軟" },
-    { "松通", "鬆通" },
-    { "松饼", "鬆餅" },
-    { "板荡", "板蕩" },
-    { "极", "極" },
-    { "构", "構" },
-    { "林宏岳", "林宏嶽" },
-    { "林钟", "林鐘" },
-    { "林鹅峰", "林鵞峰" },
-    { "果子干", "果子乾" },
-    { "果干", "果乾" },
-    { "果累累", "果纍纍" },
-    { "枝干", "枝幹" },
-    { "枞", "樅" },
-    { "枢", "樞" },
-    { "枣", "棗" },
-    { "枥", "櫪" },
-    { "枨", "棖" },
-    { "枪", "槍" },
-    { "枪杆", "槍桿" },
-    { "枫", "楓" },
-    { "枭", "梟" },
-    { "枯干", "枯乾" },
-    { "架钟", "架鐘" },
-    { "某只", "某隻" },
-    { "染发", "染髮" },
-    { "染发生", "染發生" },
-    { "柜", "櫃" },
-    { "柜台", "櫃檯" },
-    { "柜里", "櫃裡" },
-    { "柠", "檸" },
-    { "查封后", "查封後" },
-    { "柱梁", "柱樑" },
-    { "柳诒征", "柳詒徵" },
-    { "柽", "檉" },
-    { "栀", "梔" },
-    { "栅", "柵" },
-    { "标", "標" },
-    { "标准", "標準" },
-    { "标志", "標誌" },
-    { "标标致致", "標標致致" },
-    { "标注", "標註" },
-    { "标签", "標籤" },
-    { "标致", "標緻" },
-    { "栈", "棧" },
-    { "栉", "櫛" },
-    { "栉发工", "櫛髮工" },
-    { "栊", "櫳" },
-    { "栋", "棟" },
-    { "栋梁", "棟樑" },
-    { "栌", "櫨" },
-    { "栎", "櫟" },
-    { "栏", "欄" },
-    { "树", "樹" },
-    { "树干", "樹幹" },
-    { "树林里", "樹林裡" },
-    { "树梁", "樹樑" },
-    { "栖", "棲" },
-    { "栗冽", "慄冽" },
-    { "栗栗", "慄慄" },
-    { "校准", "校準" },
-    { "样", "樣" },
-    { "样范", "樣範" },
-    { "格斗", "格鬥" },
-    { "格范", "格範" },
-    { "格里历", "格里曆" },
-    { "格里高利历", "格里高利曆" },
-    { "栾", "欒" },
-    { "桂圆干", "桂圓乾" },
-    { "框里", "框裡" },
-    { "桌历", "桌曆" },
-    { "桌历史", "桌歷史" },
-    { "桌游", "桌遊" },
-    { "桑干", "桑乾" },
-    { "桠", "椏" },
-    { "桡", "橈" },
-    { "桢", "楨" },
-    { "桢干", "楨幹" },
-    { "档", "檔" },
-    { "桤", "榿" },
-    { "桥", "橋" },
-    { "桥梁", "橋樑" },
-    { "桦", "樺" },
-    { "桧", "檜" },
-    { "桨", "槳" },
-    { "桩", "樁" },
-    { "梁上", "樑上" },
-    { "梁启超", "梁啓超" },
-    { "梁柱", "樑柱" },
-    { "梦", "夢" },
-    { "梦游", "夢遊" },
-    { "梦里", "夢裡" },
-    { "梨干", "梨乾" },
-    { "梯冲", "梯衝" },
-    { "械斗", "械鬥" },
-    { "械系", "械繫" },
-    { "梼", "檮" },
-    { "检", "檢" },
-    { "棂", "欞" },
-    { "棉制", "棉製" },
-    { "棉里", "棉裡" },
-    { "棒子面", "棒子麵" },
-    { "棫朴", "棫樸" },
-    { "森林里", "森林裡" },
-    { "棱体", "稜體" },
-    { "棱台", "稜台" },
-    { "棱子", "稜子" },
-    { "棱层", "稜層" },
-    { "棱柱", "稜柱" },
-    { "棱棱", "稜稜" },
-    { "棱登", "稜登" },
-    { "棱等登", "稜等登" },
-    { "棱线", "稜線" },
-    { "棱缝", "稜縫" },
-    { "棱角", "稜角" },
-    { "棱锥", "稜錐" },
-    { "棱镜", "稜鏡" },
-    { "棺材里", "棺材裡" },
-    { "椁", "槨" },
-    { "植发", "植髮" },
-    { "椒面", "椒麵" },
-    { "椟", "櫝" },
-    { "椠", "槧" },
-    { "椢", "槶" },
-    { "椤", "欏" },
-    { "椭", "橢" },
-    { "椰枣干", "椰棗乾" },
-    { "楼", "樓" },
-    { "榄", "欖" },
-    { "榇", "櫬" },
-    { "榈", "櫚" },
-    { "榉", "櫸" },
-    { "榨干", "榨乾" },
-    { "槛", "檻" },
-    { "槟", "檳" },
-    { "槠", "櫧" },
-    { "模制", "模製" },
-    { "模棱", "模稜" },
-    { "模范", "模範" },
-    { "模范三军", "模范三軍" },
-    { "横", "橫" },
-    { "横冲", "橫衝" },
-    { "横峰县", "橫峯縣" },
-    { "横征暴敛", "橫徵暴斂" },
-    { "横梁", "橫樑" },
-    { "樯", "檣" },
-    { "樱", "櫻" },
-    { "樵采", "樵採" },
-    { "橥", "櫫" },
-    { "橱", "櫥" },
-    { "橹", "櫓" },
-    { "橼", "櫞" },
-    { "檩", "檁" },
-    { "欢", "歡" },
-    { "欤", "歟" },
-    { "欧", "歐" },
-    { "欧游", "歐遊" },
-    { "欲令智昏", "慾令智昏" },
-    { "欲壑难填", "慾壑難填" },
-    { "欲念", "慾念" },
-    { "欲海", "慾海" },
-    { "欲海难填", "欲海難填" },
-    { "欲火", "慾火" },
-    { "欲障", "慾障" },
-    { "欺蒙", "欺矇" },
-    { "歌钟", "歌鐘" },
-    { "正文里", "正文裡" },
-    { "武斗", "武鬥" },
-    { "歹斗", "歹鬥" },
-    { "死里求生", "死裡求生" },
-    { "死里逃生", "死裡逃生" },
-    { "歼", "殲" },
-    { "殁", "歿" },
-    { "殇", "殤" },
-    { "残", "殘" },
-    { "残余", "殘餘" },
-    { "残肴", "殘肴" },
-    { "殒", "殞" },
-    { "殓", "殮" },
-    { "殖谷", "殖穀" },
-    { "殚", "殫" },
-    { "殡", "殯" },
-    { "殴", "毆" },
-    { "殴斗", "毆鬥" },
-    { "殷师牛斗", "殷師牛鬥" },
-    { "殷鉴", "殷鑑" },
-    { "殿里", "殿裡" },
-    { "殿钟自鸣", "殿鐘自鳴" },
-    { "毁", "毀" },
-    { "毁钟为铎", "毀鐘為鐸" },
-    { "毂", "轂" },
-    { "母丑", "母醜" },
-    { "母范", "母範" },
-    { "每只", "每隻" },
-    { "毕", "畢" },
-    { "毕生发展", "畢生發展" },
-    { "毙", "斃" },
-    { "毛发", "毛髮" },
-    { "毛姜", "毛薑" },
-    { "毡", "氈" },
-    { "毫厘", "毫釐" },
-    { "毫发", "毫髮" },
-    { "毵", "毿" },
-    { "氇", "氌" },
-    { "气", "氣" },
-    { "气冲斗牛", "氣沖斗牛" },
-    { "气郁", "氣鬱" },
-    { "氢", "氫" },
-    { "氤郁", "氤鬱" },
-    { "氩", "氬" },
-    { "氲", "氳" },
-    { "水准", "水準" },
-    { "水并流", "水併流" },
-    { "水来汤里去", "水來湯裡去" },
-    { "水表", "水錶" },
-    { "水里", "水裡" },
-    { "永历", "永曆" },
-    { "永历史", "永歷史" },
-    { "永志不忘", "永誌不忘" },
-    { "求知欲", "求知慾" },
-    { "求签", "求籤" },
-    { "汇", "匯" },
-    { "汇刊", "彙刊" },
-    { "汇算", "彙算" },
-    { "汇纂", "彙纂" },
-    { "汇辑", "彙輯" },
-    { "汉", "漢" },
-    { "汉弥登钟", "漢彌登鐘" },
-    { "江并流", "江併流" },
-    { "池里", "池裡" },
-    { "污蔑", "污衊" },
-    { "汤", "湯" },
-    { "汤下面", "湯下麵" },
-    { "汤卤", "汤滷" },
-    { "汤团", "湯糰" },
-    { "汤面", "湯麵" },
-    { "汹", "洶" },
-    { "汹涌", "洶湧" },
-    { "沈丹客运", "瀋丹客運" },
-    { "沈丹线", "瀋丹線" },
-    { "沈丹铁路", "瀋丹鐵路" },
-    { "沈丹高", "瀋丹高" },
-    { "沈北", "瀋北" },
-    { "沈吉", "瀋吉" },
-    { "沈大线", "瀋大線" },
-    { "沈大铁路", "瀋大鐵路" },
-    { "沈大高速", "瀋大高速" },
-    { "沈山线", "瀋山線" },
-    { "沈山铁路", "瀋山鐵路" },
-    { "沈州", "瀋州" },
-    { "沈抚", "瀋撫" },
-    { "沈水", "瀋水" },
-    { "沈河", "瀋河" },
-    { "沈海铁路", "瀋海鐵路" },
-    { "沈海高速", "瀋海高速" },
-    { "沈淀", "沈澱" },
-    { "沈郁", "沈鬱" },
-    { "沈阳", "瀋陽" },
-    { "沉淀", "沉澱" },
-    { "沉郁", "沉鬱" },
-    { "沙琅", "沙瑯" },
-    { "沙里淘金", "沙裡淘金" },
-    { "沟", "溝" },
-    { "沟谷", "溝谷" },
-    { "没", "沒" },
-    { "没事干", "沒事幹" },
-    { "没准", "沒準" },
-    { "没干", "沒幹" },
-    { "没干没净", "沒乾沒淨" },
-    { "没折至", "沒摺至" },
-    { "没样范", "沒樣範" },
-    { "沣", "灃" },
-    { "沤", "漚" },
-    { "沤郁", "漚鬱" },
-    { "沥", "瀝" },
-    { "沥干", "瀝乾" },
-    { "沦", "淪" },
-    { "沧", "滄" },
-    { "沩", "溈" },
-    { "沪", "滬" },
-    { "河岳", "河嶽" },
-    { "河里", "河裡" },
-    { "油斗", "油鬥" },
-    { "油泼面", "油潑麵" },
-    { "油面", "油麵" },
-    { "治愈", "治癒" },
-    { "沾化", "霑化" },
-    { "沾益", "霑益" },
-    { "沿溯", "沿泝" },
-    { "泄欲", "洩慾" },
-    { "泛游", "泛遊" },
-    { "泞", "濘" },
-    { "泡制", "泡製" },
-    { "泡面", "泡麵" },
-    { "波发藻", "波髮藻" },
-    { "波棱菜", "波稜菜" },
-    { "注上", "註上" },
-    { "注册", "註冊" },
-    { "注失", "註失" },
-    { "注定", "註定" },
-    { "注明", "註明" },
-    { "注标", "註標" },
-    { "注生娘娘", "註生娘娘" },
-    { "注疏", "註疏" },
-    { "注脚", "註腳" },
-    { "注解", "註解" },
-    { "注记", "註記" },
-    { "注译", "註譯" },
-    { "注释", "注釋" },
-    { "注里", "註裡" },
-    { "注销", "註銷" },
-    { "泪", "淚" },
-    { "泪如泉涌", "淚如泉湧" },
-    { "泪干", "淚乾" },
-    { "泱郁", "泱鬱" },
-    { "泳气钟", "泳氣鐘" },
-    { "泶", "澩" },
-    { "泷", "瀧" },
-    { "泸", "瀘" },
-    { "泺", "濼" },
-    { "泻", "瀉" },
-    { "泼", "潑" },
-    { "泽", "澤" },
-    { "泾", "涇" },
-    { "洁", "潔" },
-    { "洒", "灑" },
-    { "洗发", "洗髮" },
-    { "洗炼", "洗鍊" },
-    { "洗练", "洗鍊" },
-    { "洛钟东应", "洛鐘東應" },
-    { "洞里", "洞裡" },
-    { "洞里萨", "洞里薩" },
-    { "洪范", "洪範" },
-    { "洪钟", "洪鐘" },
-    { "洼", "窪" },
-    { "流征", "流徵" },
-    { "流荡", "流蕩" },
-    { "流风余俗", "流風餘俗" },
-    { "流风余韵", "流風餘韻" },
-    { "浃", "浹" },
-    { "浅", "淺" },
-    { "浅淀", "淺澱" },
-    { "浆", "漿" },
-    { "浇", "澆" },
-    { "浈", "湞" },
-    { "浊", "濁" },
-    { "测", "測" },
-    { "测不准", "測不準" },
-    { "浍", "澮" },
-    { "济", "濟" },
-    { "浏", "瀏" },
-    { "浑", "渾" },
-    { "浑个", "渾箇" },
-    { "浑朴", "渾樸" },
-    { "浒", "滸" },
-    { "浓", "濃" },
-    { "浓发", "濃髮" },
-    { "浔", "潯" },
-    { "浚县", "濬縣" },
-    { "浚州", "濬州" },
-    { "浩浩荡荡", "浩浩蕩蕩" },
-    { "浩荡", "浩蕩" },
-    { "浪游", "浪遊" },
-    { "浪荡", "浪蕩" },
-    { "浮夸", "浮誇" },
-    { "浮松", "浮鬆" },
-    { "浮荡", "浮蕩" },
-    { "海干", "海乾" },
-    { "海淀山后", "海淀山後" },
-    { "浸卤", "浸滷" },
-    { "涂", "塗" },
-    { "涂壮勋", "涂壯勳" },
-    { "涂尔干", "涂爾幹" },
-    { "涂敏恒", "涂敏恆" },
-    { "涂泽民", "涂澤民" },
-    { "涂绍煃", "涂紹煃" },
-    { "涂谨申", "涂謹申" },
-    { "涂长望", "涂長望" },
-    { "涂鸿钦", "涂鴻欽" },
-    { "涌上", "湧上" },
-    { "涌入", "湧入" },
-    { "涌出", "湧出" },
-    { "涌向", "湧向" },
-    { "涌来", "湧來" },
-    { "涌水", "湧水" },
-    { "涌泉", "湧泉" },
-    { "涌现", "湧現" },
-    { "涌起", "湧起" },
-    { "涌进", "湧進" },
-    { "涛", "濤" },
-    { "涝", "澇" },
-    { "涞", "淶" },
-    { "涟", "漣" },
-    { "涠", "潿" },
-    { "涡", "渦" },
-    { "涣", "渙" },
-    { "涤", "滌" },
-    { "润", "潤" },
-    { "涧", "澗" },
-    { "涨", "漲" },
-    { "涩", "澀" },
-    { "涩谷区", "澀谷區" },
-    { "涳蒙", "涳濛" },
-    { "涸干", "涸乾" },
-    { "淀乃不耕之地", "澱乃不耕之地" },
-    { "淀北片", "澱北片" },
-    { "淀山", "澱山" },
-    { "淀淀", "澱澱" },
-    { "淀积", "澱積" },
-    { "淀粉", "澱粉" },
-    { "淀解物", "澱解物" },
-    { "淀谓之滓", "澱謂之滓" },
-    { "淋余土", "淋餘土" },
-    { "淑范", "淑範" },
-    { "淡蒙蒙", "淡濛濛" },
-    { "淫欲", "淫慾" },
-    { "淫荡", "淫蕩" },
-    { "淬炼", "淬鍊" },
-    { "深山何处钟", "深山何處鐘" },
-    { "深山里", "深山裡" },
-    { "淳朴", "淳樸" },
-    { "渊", "淵" },
-    { "渊淳岳峙", "淵淳嶽峙" },
-    { "渊里", "淵裡" },
-    { "渌", "淥" },
-    { "渍", "漬" },
-    { "渎", "瀆" },
-    { "渐", "漸" },
-    { "渑", "澠" },
-    { "渔", "漁" },
-    { "渖", "瀋" },
-    { "渗", "滲" },
-    { "渗漓", "滲灕" },
-    { "渠冲", "渠衝" },
-    { "温", "溫" },
-    { "温洛克期", "溫洛克期" },
-    { "港制", "港製" },
-    { "游丝", "遊絲" },
-    { "游乐", "遊樂" },
-    { "游了", "遊了" },
-    { "游人", "遊人" },
-    { "游仙", "遊仙" },
-    { "游伴", "遊伴" },
-    { "游侠", "遊俠" },
-    { "游兴", "遊興" },
-    { "游冶", "遊冶" },
-    { "游刃", "遊刃" },
-    { "游动", "遊動" },
-    { "游历", "遊歷" },
-    { "游园", "遊園" },
-    { "游子", "遊子" },
-    { "游学", "遊學" },
-    { "游客", "遊客" },
-    { "游宦", "遊宦" },
-    { "游山玩水", "遊山玩水" },
-    { "游廊", "遊廊" },
-    { "游必有方", "遊必有方" },
-    { "游憩", "遊憩" },
-    { "游戏", "遊戲" },
-    { "游戏里", "遊戲裡" },
-    { "游手好闲", "遊手好閒" },
-    { "游方", "遊方" },
-    { "游星", "遊星" },
-    { "游春", "遊春" },
-    { "游标卡尺", "遊標卡尺" },
-    { "游民", "遊民" },
-    { "游河", "遊河" },
-    { "游牧", "遊牧" },
-    { "游猎", "遊獵" },
-    { "游玩", "遊玩" },
-    { "游目骋怀", "遊目騁懷" },
-    { "游离", "游離" },
-    { "游程", "遊程" },
-    { "游美学务", "遊美學務" },
-    { "游船", "遊船" },
-    { "游艇", "遊艇" },
-    { "游艺", "遊藝" },
-    { "游荡", "遊蕩" },
-    { "游行", "遊行" },
-    { "游街", "遊街" },
-    { "游览", "遊覽" },
-    { "游记", "遊記" },
-    { "游说", "遊說" },
-    { "游资", "遊資" },
-    { "游走", "遊走" },
-    { "游踪", "遊蹤" },
-    { "游轮", "遊輪" },
-    { "游逛", "遊逛" },
-    { "游错", "遊錯" },
-    { "游骑兵", "遊騎兵" },
-    { "游魂", "遊魂" },
-    { "湖里", "湖裡" },
-    { "湘累", "湘纍" },
-    { "湮郁", "湮鬱" },
-    { "湾", "灣" },
-    { "湿", "濕" },
-    { "溃", "潰" },
-    { "溅", "濺" },
-    { "溆", "漵" },
-    { "溟蒙", "溟濛" },
-    { "溲面", "溲麵" },
-    { "滃郁", "滃鬱" },
-    { "滑借", "滑藉" },
-    { "滗", "潷" },
-    { "滚", "滾" },
-    { "滞", "滯" },
-    { "滟", "灩" },
-    { "滠", "灄" },
-    { "满", "滿" },
-    { "满头洋发", "滿頭洋髮" },
-    { "满满当当", "滿滿當當" },
-    { "滢", "瀅" },
-    { "滤", "濾" },
-    { "滥", "濫" },
-    { "滦", "灤" },
-    { "滨", "濱" },
-    { "滨田里佳子", "濱田里佳子" },
-    { "滩", "灘" },
-    { "滩席", "灘蓆" },
-    { "滩涂", "灘涂" },
-    { "漂荡", "漂蕩" },
-    { "漓水", "灕水" },
-    { "漓江", "灕江" },
-    { "漓湘", "灕湘" },
-    { "漓然", "灕然" },
-    { "漕挽", "漕輓" },
-    { "漠里", "漠裡" },
-    { "漤", "灠" },
-    { "漫卷", "漫捲" },
-    { "漫游", "漫遊" },
-    { "潆", "瀠" },
-    { "潇", "瀟" },
-    { "潋", "瀲" },
-    { "潍", "濰" },
-    { "潜", "潛" },
-    { "潜意识里", "潛意識裡" },
-    { "潜水表", "潛水錶" },
-    { "潜水钟", "潛水鐘" },
-    { "潜水钟表", "潛水鐘錶" },
-    { "潭里", "潭裡" },
-    { "潮涌", "潮湧" },
-    { "潴", "瀦" },
-    { "澄江县", "澂江縣" },
-    { "澒蒙", "澒濛" },
-    { "澜", "瀾" },
-    { "澹台", "澹臺" },
-    { "澹荡", "澹蕩" },
-    { "激斗", "激鬥" },
-    { "濑", "瀨" },
-    { "濒", "瀕" },
-    { "灏", "灝" },
-    { "火山里", "火山裡" },
-    { "火并", "火併" },
-    { "火并非", "火並非" },
-    { "火折子", "火摺子" },
-    { "火签", "火籤" },
-    { "灭", "滅" },
-    { "灯", "燈" },
-    { "灰蒙", "灰濛" },
-    { "灰蒙蒙", "灰濛濛" },
-    { "灵", "靈" },
-    { "灵昆", "靈崑" },
-    { "灾", "災" },
-    { "灿", "燦" },
-    { "炀", "煬" },
-    { "炆面", "炆麵" },
-    { "炉", "爐" },
-    { "炒面", "炒麵" },
-    { "炖", "燉" },
-    { "炖制", "燉製" },
-    { "炜", "煒" },
-    { "炝", "熗" },
-    { "炮制", "炮製" },
-    { "炸酱面", "炸醬麵" },
-    { "点", "點" },
-    { "点个赞", "點個讚" },
-    { "点半钟", "點半鐘" },
-    { "点多钟", "點多鐘" },
-    { "点札", "點劄" },
-    { "点赞", "點讚" },
-    { "点里", "點裡" },
-    { "点里程", "點里程" },
-    { "点钟", "點鐘" },
-    { "炼", "煉" },
-    { "炼冶", "鍊冶" },
-    { "炼制", "煉製" },
-    { "炼句", "鍊句" },
-    { "炼字", "鍊字" },
-    { "炼师", "鍊師" },
-    { "炼度", "鍊度" },
-    { "炼形", "鍊形" },
-    { "炼气", "鍊氣" },
-    { "炼汞", "鍊汞" },
-    { "炼石", "鍊石" },
-    { "炼贫", "鍊貧" },
-    { "炼金术", "鍊金術" },
-    { "炽", "熾" },
-    { "烁", "爍" },
-    { "烂", "爛" },
-    { "烃", "烴" },
-    { "烘制", "烘製" },
-    { "烘干", "烘乾" },
-    { "烛", "燭" },
-    { "烟", "煙" },
-    { "烟卷", "煙捲" },
-    { "烟台", "煙臺" },
-    { "烤卤", "烤滷" },
-    { "烤干", "烤乾" },
-    { "烦", "煩" },
-    { "烧", "燒" },
-    { "烧干", "燒乾" },
-    { "烨", "燁" },
-    { "烩", "燴" },
-    { "烩面", "燴麵" },
-    { "烫", "燙" },
-    { "烫一个发", "燙一個髮" },
-    { "烫一次发", "燙一次髮" },
-    { "烫个发", "燙個髮" },
-    { "烫发", "燙髮" },
-    { "烫完发", "燙完髮" },
-    { "烫次发", "燙次髮" },
-    { "烫面", "燙麵" },
-    { "烬", "燼" },
-    { "烬余", "燼餘" },
-    { "热", "熱" },
-    { "烹制", "烹製" },
-    { "焕", "煥" },
-    { "焖", "燜" },
-    { "焘", "燾" },
-    { "焙干", "焙乾" },
-    { "煎面", "煎麵" },
-    { "照入签", "照入籤" },
-    { "照相干片", "照相乾片" },
-    { "煨干", "煨乾" },
-    { "煮制", "煮製" },
-    { "煮面", "煮麵" },
-    { "熏习", "薰習" },
-    { "熏心", "薰心" },
-    { "熏染", "薰染" },
-    { "熏沐", "薰沐" },
-    { "熏陶", "薰陶" },
-    { "熏风", "薰風" },
-    { "熏香", "薰香" },
-    { "熬制", "熬製" },
-    { "燎发", "燎髮" },
-    { "燕游", "燕遊" },
-    { "爆发", "爆發" },
-    { "爰定祥历", "爰定祥厤" },
-    { "爱", "愛" },
-    { "爱困", "愛睏" },
-    { "爱河里花子", "愛河里花子" },
-    { "爷", "爺" },
-    { "爽荡", "爽蕩" },
-    { "片言只语", "片言隻語" },
-    { "片里", "片裡" },
-    { "版图里", "版圖裡" },
-    { "牍", "牘" },
-    { "牙签", "牙籤" },
-    { "牛只", "牛隻" },
-    { "牦", "氂" },
-    { "物欲", "物慾" },
-    { "牵", "牽" },
-    { "牵一发", "牽一髮" },
-    { "牵系", "牽繫" },
-    { "特制", "特製" },
-    { "特制订", "特制訂" },
-    { "特征", "特徵" },
-    { "牺", "犧" },
-    { "犊", "犢" },
-    { "状", "狀" },
-    { "犷", "獷" },
-    { "犹", "猶" },
-    { "犹如表", "猶如錶" },
-    { "犹如钟", "猶如鐘" },
-    { "犹如钟表", "猶如鐘錶" },
-    { "狂并潮", "狂併潮" },
-    { "狈", "狽" },
-    { "狐借虎威", "狐藉虎威" },
-    { "狞", "獰" },
-    { "独", "獨" },
-    { "独裁制", "獨裁制" },
-    { "独辟蹊径", "獨闢蹊徑" },
-    { "狭", "狹" },
-    { "狮", "獅" },
-    { "狯", "獪" },
-    { "狰", "猙" },
-    { "狱", "獄" },
-    { "狱里", "獄裡" },
-    { "狲", "猻" },
-    { "猃", "獫" },
-    { "猎", "獵" },
-    { "猕", "獼" },
-    { "猛冲", "猛衝" },
-    { "猡", "玀" },
-    { "猪", "豬" },
-    { "猫", "貓" },
-    { "猬", "蝟" },
-    { "献", "獻" },
-    { "献丑", "獻醜" },
-    { "獭", "獺" },
-    { "玉历", "玉曆" },
-    { "玉历史", "玉歷史" },
-    { "王余鱼", "王餘魚" },
-    { "王鉴", "王鑑" },
-    { "玑", "璣" },
-    { "玛", "瑪" },
-    { "玮", "瑋" },
-    { "环", "環" },
-    { "环游", "環遊" },
-    { "现", "現" },
-    { "玺", "璽" },
-    { "珍肴异馔", "珍肴異饌" },
-    { "珐", "琺" },
-    { "珐琅", "琺瑯" },
-    { "珑", "瓏" },
-    { "班里", "班裡" },
-    { "珲", "琿" },
-    { "球台", "球檯" },
-    { "理一个发", "理一個髮" },
-    { "理一次发", "理一次髮" },
-    { "理个发", "理個髮" },
-    { "理发", "理髮" },
-    { "理完发", "理完髮" },
-    { "理次发", "理次髮" },
-    { "琏", "璉" },
-    { "琐", "瑣" },
-    { "琴钟", "琴鐘" },
-    { "琼", "瓊" },
-    { "瑞征", "瑞徵" },
-    { "瑶", "瑤" },
-    { "瑶签", "瑤籤" },
-    { "瑷", "璦" },
-    { "璎", "瓔" },
-    { "瓒", "瓚" },
-    { "瓮安", "甕安" },
-    { "瓯", "甌" },
-    { "瓷制", "瓷製" },
-    { "甜咸", "甜鹹" },
-    { "甜水面", "甜水麵" },
-    { "甜面酱", "甜麵醬" },
-    { "生力面", "生力麵" },
-    { "生华发", "生華髮" },
-    { "生发", "生髮" },
-    { "生发生", "生發生" },
-    { "生姜", "生薑" },
-    { "生物钟", "生物鐘" },
-    { "生锈", "生鏽" },
-    { "用法里", "用法裡" },
-    { "甩发", "甩髮" },
-    { "田里", "田裡" },
-    { "甲胄", "甲冑" },
-    { "电", "電" },
-    { "电冲", "電衝" },
-    { "电子制表", "電子製表" },
-    { "电子表格", "電子表格" },
-    { "电子钟", "電子鐘" },
-    { "电子钟表", "電子鐘錶" },
-    { "电影后", "電影後" },
-    { "电影里", "電影裡" },
-    { "电梯里", "電梯裡" },
-    { "电波钟", "電波鐘" },
-    { "电码表", "電碼表" },
-    { "电表", "電錶" },
-    { "电视台风", "電視台風" },
-    { "电视里", "電視裡" },
-    { "电钟", "電鐘" },
-    { "男仆", "男僕" },
-    { "画", "畫" },
-    { "画里", "畫裡" },
-    { "畅", "暢" },
-    { "畅游", "暢遊" },
-    { "界里", "界裡" },
-    { "留发", "留髮" },
-    { "留发展", "留發展" },
-    { "留发生", "留發生" },
-    { "留发行", "留發行" },
-    { "留长发", "留長髮" },
-    { "畴", "疇" },
-    { "疏松", "疏鬆" },
-    { "疑凶", "疑兇" },
-    { "疑系", "疑係" },
-    { "疖", "癤" },
-    { "疗", "療" },
-    { "疟", "瘧" },
-    { "疠", "癘" },
-    { "疡", "瘍" },
-    { "疬", "癧" },
-    { "疮", "瘡" },
-    { "疯", "瘋" },
-    { "疱", "皰" },
-    { "疲困", "疲睏" },
-    { "病余", "病餘" },
-    { "病征", "病徵" },
-    { "病愈", "病癒" },
-    { "症结", "癥結" },
-    { "痈", "癰" },
-    { "痉", "痙" },
-    { "痊愈", "痊癒" },
-    { "痒", "癢" },
-    { "痨", "癆" },
-    { "痪", "瘓" },
-    { "痫", "癇" },
-    { "痳", "痲" },
-    { "痳疯", "痳瘋" },
-    { "痳痹", "痳痺" },
-    { "瘅", "癉" },
-    { "瘗", "瘞" },
-    { "瘘", "瘺" },
-    { "瘪", "癟" },
-    { "瘫", "癱" },
-    { "瘾", "癮" },
-    { "瘿", "癭" },
-    { "癞", "癩" },
-    { "癣", "癬" },
-    { "癫", "癲" },
-    { "白净面皮", "白淨面皮" },
-    { "白发", "白髮" },
-    { "白发其事", "白發其事" },
-    { "白干儿", "白乾兒" },
-    { "白术", "白朮" },
-    { "白朴", "白樸" },
-    { "白粉面", "白粉麵" },
-    { "白里透红", "白裡透紅" },
-    { "白霉", "白黴" },
-    { "百个", "百個" },
-    { "百余", "百餘" },
-    { "百只", "百隻" },
-    { "百只够", "百只夠" },
-    { "百只足够", "百只足夠" },
-    { "百周后", "百周後" },
-    { "百天后", "百天後" },
-    { "百扎", "百紮" },
-    { "百拙千丑", "百拙千醜" },
-    { "百炼", "百鍊" },
-    { "百科里", "百科裡" },
-    { "百花历", "百花曆" },
-    { "百花历史", "百花歷史" },
-    { "百谷", "百穀" },
-    { "的个中", "的箇中" },
-    { "的发小", "的髮小" },
-    { "的回复", "的回覆" },
-    { "的图里", "的圖裡" },
-    { "的山里", "的山裡" },
-    { "的干将", "的幹將" },
-    { "的钟", "的鐘" },
-    { "的长发", "的長髮" },
-    { "皆准", "皆準" },
-    { "皆可作淀", "皆可作澱" },
-    { "皇历", "皇曆" },
-    { "皇历史", "皇歷史" },
-    { "皇极历", "皇極曆" },
-    { "皇极历史", "皇極歷史" },
-    { "皑", "皚" },
-    { "皓发", "皓髮" },
-    { "皮制", "皮製" },
-    { "皮松", "皮鬆" },
-    { "皮肤", "皮膚" },
-    { "皮里春秋", "皮裡春秋" },
-    { "皮里阳秋", "皮裡陽秋" },
-    { "皱", "皺" },
-    { "皱折", "皺摺" },
-    { "皲", "皸" },
-    { "盆吊", "盆弔" },
-    { "盈余", "盈餘" },
-    { "盏", "盞" },
-    { "盐", "鹽" },
-    { "盐余", "鹽餘" },
-    { "盐卤", "鹽滷" },
-    { "盐打怎么咸", "鹽打怎麼鹹" },
-    { "监", "監" },
-    { "监制", "監製" },
-    { "盒里", "盒裡" },
-    { "盖", "蓋" },
-    { "盗", "盜" },
-    { "盗采", "盜採" },
-    { "盗钟", "盜鐘" },
-    { "盘", "盤" },
-    { "盘回", "盤迴" },
-    { "盘里", "盤裡" },
-    { "盛赞", "盛讚" },
-    { "盲干", "盲幹" },
-    { "直冲", "直衝" },
-    { "相克", "相剋" },
-    { "相冲", "相衝" },
-    { "相并", "相併" },
-    { "相斗", "相鬥" },
-    { "看准", "看準" },
-    { "看法里", "看法裡" },
-    { "看表", "看錶" },
-    { "看钟", "看鐘" },
-    { "真丑", "真醜" },
-    { "真个", "真箇" },
-    { "真凶", "真兇" },
-    { "眦", "眥" },
-    { "眼干", "眼乾" },
-    { "眼眶里", "眼眶裡" },
-    { "眼睛里", "眼睛裡" },
-    { "眼里", "眼裡" },
-    { "睁", "睜" },
-    { "睐", "睞" },
-    { "睑", "瞼" },
-    { "睡游病", "睡遊病" },
-    { "瞄准", "瞄準" },
-    { "瞎蒙", "瞎矇" },
-    { "瞒", "瞞" },
-    { "瞩", "矚" },
-    { "瞩托", "矚託" },
-    { "瞳蒙", "瞳矇" },
-    { "矜夸", "矜誇" },
-    { "矫", "矯" },
-    { "短发", "短髮" },
-    { "短发生", "短發生" },
-    { "石梁", "石樑" },
-    { "石英钟", "石英鐘" },
-    { "石英钟表", "石英鐘錶" },
-    { "石钟", "石鐘" },
-    { "矶", "磯" },
-    { "矾", "礬" },
-    { "矿", "礦" },
-    { "砀", "碭" },
-    { "码", "碼" },
-    { "码码表", "碼碼表" },
-    { "码表", "碼錶" },
-    { "码表示", "碼表示" },
-    { "研制", "研製" },
-    { "砖", "磚" },
-    { "砗", "硨" },
-    { "砚", "硯" },
-    { "砰当", "砰噹" },
-    { "破鉴", "破鑑" },
-    { "砺", "礪" },
-    { "砻", "礱" },
-    { "砻谷", "礱穀" },
-    { "砾", "礫" },
-    { "础", "礎" },
-    { "硕", "碩" },
-    { "硖", "硤" },
-    { "硗", "磽" },
-    { "硗确", "磽确" },
-    { "硬干", "硬幹" },
-    { "确", "確" },
-    { "确系", "確係" },
-    { "硷", "鹼" },
-    { "碍", "礙" },
-    { "碑志", "碑誌" },
-    { "碗里", "碗裡" },
-    { "碛", "磧" },
-    { "碜", "磣" },
-    { "碰钟", "碰鐘" },
-    { "碱", "鹼" },
-    { "磁制", "磁製" },
-    { "磨制", "磨製" },
-    { "磨炼", "磨鍊" },
-    { "磨面", "磨麵" },
-    { "磬钟", "磬鐘" },
-    { "示范", "示範" },
-    { "礼", "禮" },
-    { "礼赞", "禮讚" },
-    { "社里", "社裡" },
-    { "祝发", "祝髮" },
-    { "祝赞", "祝讚" },
-    { "神游", "神遊" },
-    { "神荼郁垒", "神荼鬱壘" },
-    { "神雕", "神鵰" },
-    { "祢", "禰" },
-    { "祭吊", "祭弔" },
-    { "祯", "禎" },
-    { "祷", "禱" },
-    { "祸", "禍" },
-    { "禀", "稟" },
-    { "禁欲", "禁慾" },
-    { "禁欲主义", "禁欲主義" },
-    { "禄", "祿" },
-    { "禅", "禪" },
-    { "离", "離" },
-    { "禾谷", "禾穀" },
-    { "秀发", "秀髮" },
-    { "秀发动", "秀發動" },
-    { "秀发展", "秀發展" },
-    { "秀发布", "秀發布" },
-    { "秀发村", "秀發村" },
-    { "秀发现", "秀發現" },
-    { "秀发生", "秀發生" },
-    { "秀发表", "秀發表" },
-    { "秀发起", "秀發起" },
-    { "私下里", "私下裡" },
-    { "私斗", "私鬥" },
-    { "私欲", "私慾" },
-    { "秃", "禿" },
-    { "秃发", "禿髮" },
-    { "秃妃之发", "禿妃之髮" },
-    { "秆", "稈" },
-    { "秋千", "鞦韆" },
-    { "秋游", "秋遊" },
-    { "种", "種" },
-    { "种师中", "种師中" },
-    { "种师道", "种師道" },
-    { "种谷", "種穀" },
-    { "科尼亚克期", "科尼亞克期" },
-    { "科范", "科範" },
-    { "秒钟", "秒鐘" },
-    { "秤杆", "秤桿" },
-    { "秦沈客运", "秦瀋客運" },
-    { "积", "積" },
-    { "积淀", "積澱" },
-    { "积谷", "積穀" },
-    { "积谷防饥", "積穀防饑" },
-    { "积郁", "積鬱" },
-    { "称", "稱" },
-    { "称赞", "稱讚" },
-    { "秽", "穢" },
-    { "稀松", "稀鬆" },
-    { "稆", "穭" },
-    { "程十发", "程十髮" },
-    { "税", "稅" },
-    { "稣", "穌" },
-    { "稳", "穩" },
-    { "稳健的台风", "穩健的台風" },
-    { "稳扎", "穩紮" },
-    { "稻谷", "稻穀" },
-    { "稽征", "稽徵" },
-    { "穆棱", "穆稜" },
-    { "穆罕默德历", "穆罕默德曆" },
-    { "穆罕默德历史", "穆罕默德歷史" },
-    { "穑", "穡" },
-    { "穷", "窮" },
-    { "穷发", "窮髮" },
-    { "穷追不舍", "窮追不捨" },
-    { "空余", "空餘" },
-    { "空荡", "空蕩" },
-    { "空荡荡", "空蕩蕩" },
-    { "空蒙", "空濛" },
-    { "空钟", "空鐘" },
-    { "窃", "竊" },
-    { "窃钟掩耳", "竊鐘掩耳" },
-    { "窍", "竅" },
-    { "窑", "窯" },
-    { "窒欲", "窒慾" },
-    { "窗帘", "窗簾" },
-    { "窗明几净", "窗明几淨" },
-    { "窜", "竄" },
-    { "窝", "窩" },
-    { "窝里", "窩裡" },
-    { "窝里斗", "窩裡鬥" },
-    { "窥", "窺" },
-    { "窦", "竇" },
-    { "窭", "窶" },
-    { "立范", "立範" },
-    { "竖", "豎" },
-    { "竖起脊梁", "豎起脊梁" },
-    { "竞", "競" },
-    { "竞斗", "競鬥" },
-    { "童仆", "童僕" },
-    { "竹制", "竹製" },
-    { "竹席", "竹蓆" },
-    { "竹林之游", "竹林之遊" },
-    { "竹溪县", "竹谿縣" },
-    { "竹签", "竹籤" },
-    { "笃", "篤" },
-    { "笋", "筍" },
-    { "笋干", "筍乾" },
-    { "笑里藏刀", "笑裡藏刀" },
-    { "笔", "筆" },
-    { "笔杆", "筆桿" },
-    { "笔秃墨干", "筆禿墨乾" },
-    { "笕", "筧" },
-    { "笺", "箋" },
-    { "笼", "籠" },
-    { "笾", "籩" },
-    { "筑", "築" },
-    { "筑后", "筑後" },
-    { "筑阳", "筑陽" },
-    { "答复", "答覆" },
-    { "筚", "篳" },
-    { "筛", "篩" },
-    { "筝", "箏" },
-    { "筹", "籌" },
-    { "签", "簽" },
-    { "签押", "籤押" },
-    { "签条", "籤條" },
-    { "签诗", "籤詩" },
-    { "简", "簡" },
-    { "简并", "簡併" },
-    { "简朴", "簡樸" },
-    { "简短发", "簡短發" },
-    { "简筑翎", "簡筑翎" },
-    { "算准", "算準" },
-    { "算历", "算曆" },
-    { "算历史", "算歷史" },
-    { "管干", "管幹" },
-    { "箦", "簀" },
-    { "箧", "篋" },
-    { "箨", "籜" },
-    { "箩", "籮" },
-    { "箪", "簞" },
-    { "箫", "簫" },
-    { "箱里", "箱裡" },
-    { "篑", "簣" },
-    { "篓", "簍" },
-    { "篮", "籃" },
-    { "篱", "籬" },
-    { "簖", "籪" },
-    { "簸荡", "簸蕩" },
-    { "籁", "籟" },
-    { "米余", "米餘" },
-    { "米团", "米糰" },
-    { "米沈", "米瀋" },
-    { "米面", "米麵" },
-    { "籴", "糴" },
-    { "类", "類" },
-    { "籼", "秈" },
-    { "粉签子", "粉籤子" },
-    { "粗制", "粗製" },
-    { "粜", "糶" },
-    { "粝", "糲" },
-    { "粤", "粵" },
-    { "粪", "糞" },
-    { "粪秽蔑面", "糞穢衊面" },
-    { "粮", "糧" },
-    { "精准", "精準" },
-    { "精制", "精製" },
-    { "精干", "精幹" },
-    { "精松", "精鬆" },
-    { "精致", "精緻" },
-    { "精辟", "精闢" },
-    { "糁", "糝" },
-    { "糇", "餱" },
-    { "糊里糊涂", "糊裡糊塗" },
-    { "糕干", "糕乾" },
-    { "系上丝", "繫上絲" },
-    { "系上了", "繫上了" },
-    { "系上头", "繫上頭" },
-    { "系上安全", "繫上安全" },
-    { "系上红", "繫上紅" },
-    { "系上绳", "繫上繩" },
-    { "系上黑", "繫上黑" },
-    { "系为", "係為" },
-    { "系于", "繫於" },
-    { "系于一发", "繫於一髮" },
-    { "系列里", "系列裡" },
-    { "系到", "繫到" },
-    { "系囚", "繫囚" },
-    { "系心", "繫心" },
-    { "系念", "繫念" },
-    { "系怀", "繫懷" },
-    { "系恋", "繫戀" },
-    { "系数", "係數" },
-    { "系着", "繫着" },
-    { "系紧", "繫緊" },
-    { "系累", "繫纍" },
-    { "系结", "繫結" },
-    { "系绳", "繫繩" },
-    { "系膜", "繫膜" },
-    { "系舟", "繫舟" },
-    { "系船", "繫船" },
-    { "系辞", "繫辭" },
-    { "系里", "系裡" },
-    { "系鞋带", "繫鞋帶" },
-    { "系风捕影", "繫風捕影" },
-    { "素发", "素髮" },
-    { "素数里", "素數裡" },
-    { "素朴", "素樸" },
-    { "素面", "素麵" },
-    { "索面", "索麵" },
-    { "索马里", "索馬里" },
-    { "紧", "緊" },
-    { "紧致", "緊緻" },
-    { "紧追不舍", "緊追不捨" },
-    { "紫姜", "紫薑" },
-    { "累囚", "纍囚" },
-    { "累堆", "纍堆" },
-    { "累瓦结绳", "纍瓦結繩" },
-    { "累绁", "纍紲" },
-    { "累臣", "纍臣" },
-    { "絷", "縶" },
-    { "繁复", "繁複" },
-    { "繁钟", "繁鐘" },
-    { "纠", "糾" },
-    { "纡", "紆" },
-    { "纡余", "紆餘" },
-    { "纡回", "紆迴" },
-    { "纡郁", "紆鬱" },
-    { "红", "紅" },
-    { "红发", "紅髮" },
-    { "红后假说", "紅后假說" },
-    { "红绳系足", "紅繩繫足" },
-    { "红钟", "紅鐘" },
-    { "纣", "紂" },
-    { "纤", "纖" },
-    { "纤夫", "縴夫" },
-    { "纤手", "縴手" },
-    { "纤绳", "縴繩" },
-    { "纥", "紇" },
-    { "约", "約" },
-    { "级", "級" },
-    { "纨", "紈" },
-    { "纩", "纊" },
-    { "纪", "紀" },
-    { "纪历", "紀曆" },
-    { "纪历史", "紀歷史" },
-    { "纫", "紉" },
-    { "纬", "緯" },
-    { "纭", "紜" },
-    { "纯", "純" },
-    { "纯朴", "純樸" },
-    { "纰", "紕" },
-    { "纱", "紗" },
-    { "纲", "綱" },
-    { "纲鉴", "綱鑑" },
-    { "纳", "納" },
-    { "纳征", "納徵" },
-    { "纵", "縱" },
-    { "纵欲", "縱慾" },
-    { "纶", "綸" },
-    { "纷", "紛" },
-    { "纸", "紙" },
-    { "纸扎", "紙紮" },
-    { "纹", "紋" },
-    { "纺", "紡" },
-    { "纽", "紐" },
-    { "纾", "紓" },
-    { "线", "線" },
-    { "线图里", "線圖裡" },
-    { "绀", "紺" },
-    { "绁", "紲" },
-    { "绂", "紱" },
-    { "练", "練" },
-    { "组", "組" },
-    { "组里", "組裡" },
-    { "绅", "紳" },
-    { "细", "細" },
-    { "细不容发", "細不容髮" },
-    { "细如发", "細如髮" },
-    { "细炼", "細鍊" },
-    { "细致", "細緻" },
-    { "织", "織" },
-    { "终", "終" },
-    { "绉", "縐" },
-    { "绊", "絆" },
-    { "绋", "紼" },
-    { "绌", "絀" },
-    { "绍", "紹" },
-    { "绎", "繹" },
-    { "经", "經" },
-    { "经文里", "經文裡" },
-    { "经有云", "經有云" },
-    { "绐", "紿" },
-    { "绑", "綁" },
-    { "绑扎", "綁紮" },
-    { "绒", "絨" },
-    { "结", "結" },
-    { "结伙", "結夥" },
-    { "结伴同游", "結伴同遊" },
-    { "结余", "結餘" },
-    { "结发", "結髮" },
-    { "结扎", "結紮" },
-    { "绕", "繞" },
-    { "绕梁", "繞樑" },
-    { "绗", "絎" },
-    { "绘", "繪" },
-    { "绘制", "繪製" },
-    { "给", "給" },
-    { "绚", "絢" },
-    { "绛", "絳" },
-    { "络", "絡" },
-    { "络腮胡", "絡腮鬍" },
-    { "绝", "絕" },
-    { "绞", "絞" },
-    { "绞干", "絞乾" },
-    { "统", "統" },
-    { "绠", "綆" },
-    { "绡", "綃" },
-    { "绢", "絹" },
-    { "绣", "繡" },
-    { "绥", "綏" },
-    { "绥棱", "綏稜" },
-    { "绦", "絛" },
-    { "继", "繼" },
-    { "绨", "綈" },
-    { "绩", "績" },
-    { "绪", "緒" },
-    { "绪余", "緒餘" },
-    { "绫", "綾" },
-    { "续", "續" },
-    { "绮", "綺" },
-    { "绯", "緋" },
-    { "绰", "綽" },
-    { "绱", "鞝" },
-    { "绲", "緄" },
-    { "绳", "繩" },
-    { "维", "維" },
-    { "维系", "維繫" },
-    { "维系统", "維系統" },
-    { "绵", "綿" },
-    { "绶", "綬" },
-    { "绷", "繃" },
-    { "绷扒吊拷", "繃扒弔拷" },
-    { "绸", "綢" },
-    { "绺", "綹" },
-    { "绻", "綣" },
-    { "综", "綜" },
-    { "综合征", "綜合徵" },
-    { "绽", "綻" },
-    { "绾", "綰" },
-    { "绾发", "綰髮" },
-    { "绿", "綠" },
-    { "绿发", "綠髮" },
-    { "缀", "綴" },
-    { "缁", "緇" },
-    { "缂", "緙" },
-    { "缃", "緗" },
-    { "缄", "緘" },
-    { "缅", "緬" },
-    { "缆", "纜" },
-    { "缇", "緹" },
-    { "缈", "緲" },
-    { "缉", "緝" },
-    { "缉凶", "緝兇" },
-    { "缋", "繢" },
-    { "缌", "緦" },
-    { "缍", "綞" },
-    { "缎", "緞" },
-    { "缏", "緶" },
-    { "缑", "緱" },
-    { "缒", "縋" },
-    { "缓", "緩" },
-    { "缓冲", "緩衝" },
-    { "缓征", "緩徵" },
-    { "缔", "締" },
-    { "缕", "縷" },
-    { "编", "編" },
-    { "编余", "編餘" },
-    { "编制法", "編制法" },
-    { "编码表", "編碼表" },
-    { "编采", "編採" },
-    { "编钟", "編鐘" },
-    { "缗", "緡" },
-    { "缘", "緣" },
-    { "缙", "縉" },
-    { "缚", "縛" },
-    { "缛", "縟" },
-    { "缜", "縝" },
-    { "缜致", "縝緻" },
-    { "缝", "縫" },
-    { "缝制", "縫製" },
-    { "缝里", "縫裡" },
-    { "缟", "縞" },
-    { "缠", "纏" },
-    { "缠斗", "纏鬥" },
-    { "缡", "縭" },
-    { "缢", "縊" },
-    { "缣", "縑" },
-    { "缤", "繽" },
-    { "缥", "縹" },
-    { "缦", "縵" },
-    { "缧", "縲" },
-    { "缨", "纓" },
-    { "缩", "縮" },
-    { "缩栗", "縮慄" },
-    { "缩短发", "縮短發" },
-    { "缪", "繆" },
-    { "缫", "繅" },
-    { "缬", "纈" },
-    { "缭", "繚" },
-    { "缮", "繕" },
-    { "缯", "繒" },
-    { "缰", "韁" },
-    { "缱", "繾" },
-    { "缲", "繰" },
-    { "缳", "繯" },
-    { "缴", "繳" },
-    { "缵", "纘" },
-    { "罂", "罌" },
-    { "网", "網" },
-    { "网志", "網誌" },
-    { "网游", "網遊" },
-    { "网球台", "網球台" },
-    { "网站里", "網站裡" },
-    { "网里", "網裡" },
-    { "罗", "羅" },
-    { "罗马历", "羅馬曆" },
-    { "罗马历代", "羅馬歷代" },
-    { "罗马历史", "羅馬歷史" },
-    { "罚", "罰" },
-    { "罢", "罷" },
-    { "置言成范", "置言成範" },
-    { "罴", "羆" },
-    { "羁", "羈" },
-    { "羁系", "羈繫" },
-    { "美丑", "美醜" },
-    { "美发业", "美髮業" },
-    { "美发学", "美髮學" },
-    { "美发师", "美髮師" },
-    { "美发店", "美髮店" },
-    { "美发沙龙", "美髮沙龍" },
-    { "美发馆", "美髮館" },
-    { "美容美发", "美容美髮" },
-    { "羟", "羥" },
-    { "羡", "羨" },
-    { "羡余", "羨餘" },
-    { "群丑", "群醜" },
-    { "翕辟", "翕闢" },
-    { "翘", "翹" },
-    { "翱游", "翱遊" },
-    { "翻松", "翻鬆" },
-    { "翻涌", "翻湧" },
-    { "老仆", "老僕" },
-    { "老姜", "老薑" },
-    { "老干", "老乾" },
-    { "老干部", "老幹部" },
-    { "老板", "老闆" },
-    { "老爷钟", "老爺鐘" },
-    { "老白干", "老白乾" },
-    { "考征", "考徵" },
-    { "考试制度", "考試制度" },
-    { "耍斗", "耍鬥" },
-    { "耕获", "耕穫" },
-    { "耧", "耬" },
-    { "耳余", "耳餘" },
-    { "耶律术烈", "耶律朮烈" },
-    { "耸", "聳" },
-    { "耻", "恥" },
-    { "聂", "聶" },
-    { "聊斋志异", "聊齋志異" },
-    { "聋", "聾" },
-    { "职", "職" },
-    { "聍", "聹" },
-    { "联", "聯" },
-    { "联系", "聯繫" },
-    { "聘雇", "聘僱" },
-    { "聚药雄蕊", "聚葯雄蕊" },
-    { "聩", "聵" },
-    { "聪", "聰" },
-    { "肃", "肅" },
-    { "肉丝面", "肉絲麵" },
-    { "肉干", "肉乾" },
-    { "肉松", "肉鬆" },
-    { "肉欲", "肉慾" },
-    { "肉羹面", "肉羹麵" },
-    { "肉面", "肉麵" },
-    { "肚里", "肚裡" },
-    { "肝脏", "肝臟" },
-    { "肝郁", "肝鬱" },
-    { "肠", "腸" },
-    { "肠脏", "腸臟" },
-    { "股栗", "股慄" },
-    { "肤", "膚" },
-    { "肮", "骯" },
-    { "肴", "餚" },
-    { "肴馔", "肴饌" },
-    { "肺脏", "肺臟" },
-    { "肾", "腎" },
-    { "肾脏", "腎臟" },
-    { "肿", "腫" },
-    { "胀", "脹" },
-    { "胁", "脅" },
-    { "胃脏", "胃臟" },
-    { "胃里", "胃裡" },
-    { "胆", "膽" },
-    { "背地里", "背地裡" },
-    { "胎发", "胎髮" },
-    { "胜", "勝" },
-    { "胜键", "胜鍵" },
-    { "胡子", "鬍子" },
-    { "胡子婴", "胡子嬰" },
-    { "胡朴安", "胡樸安" },
-    { "胡梢", "鬍梢" },
-    { "胡渣", "鬍渣" },
-    { "胡里胡涂", "胡裡胡塗" },
-    { "胡须", "鬍鬚" },
-    { "胡髭", "鬍髭" },
-    { "胡髯", "鬍髯" },
-    { "胧", "朧" },
-    { "胪", "臚" },
-    { "胫", "脛" },
-    { "胰脏", "胰臟" },
-    { "胶", "膠" },
-    { "胶卷", "膠捲" },
-    { "能干", "能幹" },
-    { "能干扰", "能干擾" },
-    { "能干预", "能干預" },
-    { "脉", "脈" },
-    { "脉冲", "脈衝" },
-    { "脊梁", "脊樑" },
-    { "脍", "膾" },
-    { "脏", "髒" },
-    { "脏器", "臟器" },
-    { "脏胸", "臟胸" },
-    { "脏腑", "臟腑" },
-    { "脐", "臍" },
-    { "脑", "腦" },
-    { "脑干", "腦幹" },
-    { "脓", "膿" },
-    { "脔", "臠" },
-    { "脚", "腳" },
-    { "脚注", "腳註" },
-    { "脱", "脫" },
-    { "脱发", "脫髮" },
-    { "脱谷机", "脫穀機" },
-    { "脶", "腡" },
-    { "脸", "臉" },
-    { "脺脏", "脺臟" },
-    { "脾脏", "脾臟" },
-    { "腊", "臘" },
-    { "腊笔", "腊筆" },
-    { "腌", "醃" },
-    { "腌制", "醃製" },
-    { "腐余", "腐餘" },
-    { "腐干", "腐乾" },
-    { "腑脏", "腑臟" },
-    { "腕表", "腕錶" },
-    { "腭", "齶" },
-    { "腰里", "腰裡" },
-    { "腻", "膩" },
-    { "腼", "靦" },
-    { "腽", "膃" },
-    { "腾", "騰" },
-    { "腾冲", "騰衝" },
-    { "腾格里", "騰格里" },
-    { "腾涌", "騰湧" },
-    { "膑", "臏" },
-    { "膨松", "膨鬆" },
-    { "膵脏", "膵臟" },
-    { "臊子面", "臊子麵" },
-    { "臣仆", "臣僕" },
-    { "臧谷亡羊", "臧穀亡羊" },
-    { "自制", "自製" },
-    { "自制下来", "自制下來" },
-    { "自夸", "自誇" },
-    { "自干五", "自乾五" },
-    { "自然数里", "自然數裡" },
-    { "自由钟", "自由鐘" },
-    { "自觉自愿", "自覺自愿" },
-    { "臭气冲天", "臭氣衝天" },
-    { "致密", "緻密" },
-    { "舂谷", "舂穀" },
-    { "舆", "輿" },
-    { "舌干唇焦", "舌乾唇焦" },
-    { "舍不得", "捨不得" },
-    { "舍入", "捨入" },
-    { "舍出", "捨出" },
-    { "舍去", "捨去" },
-    { "舍命", "捨命" },
-    { "舍堕", "捨墮" },
-    { "舍安就危", "捨安就危" },
-    { "舍实", "捨實" },
-    { "舍己为人", "捨己為人" },
-    { "舍己为公", "捨己為公" },
-    { "舍己为国", "捨己為國" },
-    { "舍己从人", "捨己從人" },
-    { "舍己救人", "捨己救人" },
-    { "舍弃", "捨棄" },
-    { "舍得", "捨得" },
-    { "舍我其谁", "捨我其誰" },
-    { "舍本逐末", "捨本逐末" },
-    { "舍死忘生", "捨死忘生" },
-    { "舍生", "捨生" },
-    { "舍短取长", "捨短取長" },
-    { "舍身", "捨身" },
-    { "舍车保帅", "捨車保帥" },
-    { "舍近求远", "捨近求遠" },
-    { "舒卷", "舒捲" },
-    { "舞台风格", "舞台風格" },
-    { "舣", "艤" },
-    { "航海历", "航海曆" },
-    { "航海历史", "航海歷史" },
-    { "舰", "艦" },
-    { "舰只", "艦隻" },
-    { "舱", "艙" },
-    { "船只", "船隻" },
-    { "船钟", "船鐘" },
-    { "舻", "艫" },
-    { "艰", "艱" },
-    { "色欲", "色慾" },
-    { "色长发", "色長髮" },
-    { "艳", "艷" },
-    { "艳后", "艷后" },
-    { "艺", "藝" },
-    { "节", "節" },
-    { "节余", "節餘" },
-    { "节欲", "節慾" },
-    { "节目里", "節目裡" },
-    { "芈", "羋" },
-    { "芒果干", "芒果乾" },
-    { "芗", "薌" },
-    { "芜", "蕪" },
-    { "芦", "蘆" },
-    { "花不要采", "花不要採" },
-    { "花哄", "花鬨" },
-    { "花盆里", "花盆裡" },
-    { "花药", "花葯" },
-    { "花菴词选", "花菴詞選" },
-    { "花钟", "花鐘" },
-    { "花马吊嘴", "花馬弔嘴" },
-    { "芸薹", "蕓薹" },
-    { "苁", "蓯" },
-    { "苇", "葦" },
-    { "苈", "藶" },
-    { "苋", "莧" },
-    { "苌", "萇" },
-    { "苍", "蒼" },
-    { "苍发", "蒼髮" },
-    { "苍术", "蒼朮" },
-    { "苍郁", "蒼鬱" },
-    { "苎", "苧" },
-    { "苏", "蘇" },
-    { "苏昆", "蘇崑" },
-    { "苏醒", "甦醒" },
-    { "苑里", "苑裡" },
-    { "苦干", "苦幹" },
-    { "苦斗", "苦鬥" },
-    { "苦里", "苦裡" },
-    { "苧", "薴" },
-    { "苧悴", "薴悴" },
-    { "苧烯", "薴烯" },
-    { "英文里", "英文裡" },
-    { "苹婆", "蘋婆" },
-    { "苹果", "蘋果" },
-    { "苹果干", "蘋果乾" },
-    { "茂都淀", "茂都澱" },
-    { "范亭", "範亭" },
-    { "范例", "範例" },
-    { "范围", "範圍" },
-    { "范字", "範字" },
-    { "范式", "範式" },
-    { "范性形变", "範性形變" },
-    { "范数", "範數" },
-    { "范文", "範文" },
-    { "范文澜", "范文瀾" },
-    { "范本", "範本" },
-    { "范畴", "範疇" },
-    { "范贤惠", "范賢惠" },
-    { "范金", "範金" },
-    { "茅于轼", "茅于軾" },
-    { "茎", "莖" },
-    { "茎干", "莖幹" },
-    { "茏", "蘢" },
-    { "茑", "蔦" },
-    { "茔", "塋" },
-    { "茕", "煢" },
-    { "茧", "繭" },
-    { "茶余", "茶餘" },
-    { "茶面", "茶麵" },
-    { "荆", "荊" },
-    { "草丛里", "草叢裡" },
-    { "草席", "草蓆" },
-    { "荐", "薦" },
-    { "荐饥", "荐饑" },
-    { "荚", "莢" },
-    { "荛", "蕘" },
-    { "荜", "蓽" },
-    { "荞", "蕎" },
-    { "荞麦面", "蕎麥麵" },
-    { "荟", "薈" },
-    { "荠", "薺" },
-    { "荡", "盪" },
-    { "荡产", "蕩產" },
-    { "荡女", "蕩女" },
-    { "荡妇", "蕩婦" },
-    { "荡寇", "蕩寇" },
-    { "荡平", "蕩平" },
-    { "荡来荡去", "蕩來蕩去" },
-    { "荡气", "蕩氣" },
-    { "荡气回肠", "盪氣迴腸" },
-    { "荡涤", "蕩滌" },
-    { "荡漾", "蕩漾" },
-    { "荡然", "蕩然" },
-    { "荡舟", "蕩舟" },
-    { "荡船", "蕩船" },
-    { "荡荡", "蕩蕩" },
-    { "荣", "榮" },
-    { "荤", "葷" },
-    { "荥", "滎" },
-    { "荦", "犖" },
-    { "荦确", "犖确" },
-    { "荧", "熒" },
-    { "荧郁", "熒鬱" },
-    { "荨", "蕁" },
-    { "荩", "藎" },
-    { "荪", "蓀" },
-    { "荫", "蔭" },
-    { "荭", "葒" },
-    { "药", "藥" },
-    { "药签", "藥籤" },
-    { "药面儿", "藥麵兒" },
-    { "荷花淀", "荷花澱" },
-    { "莅", "蒞" },
-    { "莜面", "莜麵" },
-    { "莪术", "莪朮" },
-    { "莱", "萊" },
-    { "莲", "蓮" },
-    { "莳", "蒔" },
-    { "莴", "萵" },
-    { "莶", "薟" },
-    { "获", "獲" },
-    { "获匪其丑", "獲匪其醜" },
-    { "莸", "蕕" },
-    { "莹", "瑩" },
-    { "莺", "鶯" },
-    { "莼", "蓴" },
-    { "莽荡", "莽蕩" },
-    { "菜坛", "菜罈" },
-    { "菜干", "菜乾" },
-    { "菜肴", "菜餚" },
-    { "菠棱菜", "菠稜菜" },
-    { "菠萝干", "菠蘿乾" },
-    { "萝", "蘿" },
-    { "萝卜", "蘿蔔" },
-    { "萝卜干", "蘿蔔乾" },
-    { "萤", "螢" },
-    { "营", "營" },
-    { "营干", "營幹" },
-    { "萦", "縈" },
-    { "萦回", "縈迴" },
-    { "萧", "蕭" },
-    { "萧参", "蕭蔘" },
-    { "萨", "薩" },
-    { "落发", "落髮" },
-    { "落腮胡", "落腮鬍" },
-    { "葡萄干", "葡萄乾" },
-    { "董氏封发", "董氏封髮" },
-    { "葱", "蔥" },
-    { "葱郁", "蔥鬱" },
-    { "蒇", "蕆" },
-    { "蒉", "蕢" },
-    { "蒋", "蔣" },
-    { "蒌", "蔞" },
-    { "蒙事", "矇事" },
-    { "蒙头转", "矇頭轉" },
-    { "蒙昧无知", "矇昧無知" },
-    { "蒙松雨", "矇松雨" },
-    { "蒙汜", "濛汜" },
-    { "蒙混", "矇混" },
-    { "蒙瞍", "矇瞍" },
-    { "蒙聩", "矇聵" },
-    { "蒙胧", "朦朧" },
-    { "蒙蒙细雨", "濛濛細雨" },
-    { "蒙雾", "濛霧" },
-    { "蒙雾露", "蒙霧露" },
-    { "蒙骗", "矇騙" },
-    { "蒙鸿", "濛鴻" },
-    { "蒜发", "蒜髮" },
-    { "蒲席", "蒲蓆" },
-    { "蒸制", "蒸製" },
-    { "蒸干", "蒸乾" },
-    { "蓄发", "蓄髮" },
-    { "蓄胡", "蓄鬍" },
-    { "蓄须", "蓄鬚" },
-    { "蓊郁", "蓊鬱" },
-    { "蓝", "藍" },
-    { "蓝淀", "藍澱" },
-    { "蓟", "薊" },
-    { "蓠", "蘺" },
-    { "蓣", "蕷" },
-    { "蓥", "鎣" },
-    { "蓦", "驀" },
-    { "蓬发", "蓬髮" },
-    { "蓬松", "蓬鬆" },
-    { "蓬松松", "蓬鬆鬆" },
-    { "蔂", "虆" },
-    { "蔷", "薔" },
-    { "蔹", "蘞" },
-    { "蔺", "藺" },
-    { "蔼", "藹" },
-    { "蕲", "蘄" },
-    { "蕴", "蘊" },
-    { "薄干", "薄幹" },
-    { "薄幸", "薄倖" },
-    { "薙发", "薙髮" },
-    { "薝卜", "薝蔔" },
-    { "薮", "藪" },
-    { "藏历", "藏曆" },
-    { "藏历史", "藏歷史" },
-    { "藏蒙歌儿", "藏矇歌兒" },
-    { "藓", "蘚" },
-    { "藤制", "藤製" },
-    { "藤席", "藤蓆" },
-    { "蘖", "櫱" },
-    { "虎斗", "虎鬥" },
-    { "虎须", "虎鬚" },
-    { "虏", "虜" },
-    { "虑", "慮" },
-    { "虚", "虛" },
-    { "虚夸", "虛誇" },
-    { "虫", "蟲" },
-    { "虮", "蟣" },
-    { "虮虱相吊", "蟣蝨相弔" },
-    { "虽", "雖" },
-    { "虾", "蝦" },
-    { "虾面", "蝦麵" },
-    { "虿", "蠆" },
-    { "蚀", "蝕" },
-    { "蚁", "蟻" },
-    { "蚁后", "蟻后" },
-    { "蚂", "螞" },
-    { "蚊动牛斗", "蚊動牛鬥" },
-    { "蚕", "蠶" },
-    { "蚬", "蜆" },
-    { "蛇发女妖", "蛇髮女妖" },
-    { "蛊", "蠱" },
-    { "蛋白发", "蛋白發" },
-    { "蛎", "蠣" },
-    { "蛏", "蟶" },
-    { "蛏干", "蟶乾" },
-    { "蛮", "蠻" },
-    { "蛮干", "蠻幹" },
-    { "蛰", "蟄" },
-    { "蛱", "蛺" },
-    { "蛲", "蟯" },
-    { "蛳", "螄" },
-    { "蛴", "蠐" },
-    { "蜂准", "蜂準" },
-    { "蜂涌", "蜂湧" },
-    { "蜕", "蛻" },
-    { "蜗", "蝸" },
-    { "蜜里调油", "蜜裡調油" },
-    { "蜡", "蠟" },
-    { "蝇", "蠅" },
-    { "蝈", "蟈" },
-    { "蝉", "蟬" },
-    { "蝎", "蠍" },
-    { "蝎谮", "蝎譖" },
-    { "蝼", "螻" },
-    { "蝾", "蠑" },
-    { "血余", "血餘" },
-    { "衅", "釁" },
-    { "衅钟", "釁鐘" },
-    { "行事历", "行事曆" },
-    { "行事历史", "行事歷史" },
-    { "行凶", "行兇" },
-    { "行家里手", "行家裡手" },
-    { "衔", "銜" },
-    { "衡鉴", "衡鑑" },
-    { "补", "補" },
-    { "补注", "補註" },
-    { "表停", "錶停" },
-    { "表冠", "錶冠" },
-    { "表带", "錶帶" },
-    { "表征", "表徵" },
-    { "表快", "錶快" },
-    { "表慢", "錶慢" },
-    { "表板", "錶板" },
-    { "表王", "錶王" },
-    { "表盘", "錶盤" },
-    { "表蒙子", "錶蒙子" },
-    { "表转", "錶轉" },
-    { "表速", "錶速" },
-    { "表针", "錶針" },
-    { "衬", "襯" },
-    { "衬里", "襯裡" },
-    { "衮", "袞" },
-    { "袄", "襖" },
-    { "袅", "裊" },
-    { "袋杆", "袋桿" },
-    { "袋表", "袋錶" },
-    { "袋里", "袋裡" },
-    { "袖里", "袖裡" },
-    { "袜", "襪" },
-    { "被发佯狂", "被髮佯狂" },
-    { "被发入山", "被髮入山" },
-    { "被发左衽", "被髮左衽" },
-    { "被发缨冠", "被髮纓冠" },
-    { "被发阳狂", "被髮陽狂" },
-    { "被夸", "被誇" },
-    { "被废后", "被廢後" },
-    { "被系上", "被繫上" },
-    { "被里", "被裡" },
-    { "袭", "襲" },
-    { "裁制", "裁製" },
-    { "裁并", "裁併" },
-    { "装", "裝" },
-    { "装折", "裝摺" },
-    { "裆", "襠" },
-    { "裢", "褳" },
-    { "裣", "襝" },
-    { "裤", "褲" },
-    { "裥", "襉" },
-    { "褒赞", "褒讚" },
-    { "褛", "褸" },
-    { "褴", "襤" },
-    { "西历", "西曆" },
-    { "西历代", "西歷代" },
-    { "西历任", "西歷任" },
-    { "西历史", "西歷史" },
-    { "西历次", "西歷次" },
-    { "西周钟", "西周鐘" },
-    { "西岳", "西嶽" },
-    { "西昆", "西崑" },
-    { "西游", "西遊" },
-    { "要冲", "要衝" },
-    { "见", "見" },
-    { "见棱见角", "見稜見角" },
-    { "见素抱朴", "見素抱樸" },
-    { "见钟不打", "見鐘不打" },
-    { "观", "觀" },
-    { "观采", "觀採" },
-    { "规", "規" },
-    { "规范", "規範" },
-    { "觅", "覓" },
-    { "视", "視" },
-    { "觇", "覘" },
-    { "览", "覽" },
-    { "觉", "覺" },
-    { "觊", "覬" },
-    { "觋", "覡" },
-    { "觌", "覿" },
-    { "觎", "覦" },
-    { "觏", "覯" },
-    { "觐", "覲" },
-    { "觑", "覷" },
-    { "角抵", "角牴" },
-    { "角落发", "角落發" },
-    { "角落里", "角落裡" },
-    { "觚棱", "觚稜" },
-    { "觞", "觴" },
-    { "解发佯狂", "解髮佯狂" },
-    { "解封后", "解封後" },
-    { "解雇", "解僱" },
-    { "触", "觸" },
-    { "触须", "觸鬚" },
-    { "觯", "觶" },
-    { "言里", "言裡" },
-    { "誉", "譽" },
-    { "誊", "謄" },
-    { "謷丑", "謷醜" },
-    { "警世钟", "警世鐘" },
-    { "警报钟", "警報鐘" },
-    { "警示钟", "警示鐘" },
-    { "警钟", "警鐘" },
-    { "计", "計" },
-    { "计划", "計劃" },
-    { "计时表", "計時錶" },
-    { "订", "訂" },
-    { "订制", "訂製" },
-    { "讣", "訃" },
-    { "认", "認" },
-    { "认准", "認準" },
-    { "讥", "譏" },
-    { "讦", "訐" },
-    { "讧", "訌" },
-    { "讨", "討" },
-    { "让", "讓" },
-    { "讪", "訕" },
-    { "讫", "訖" },
-    { "训", "訓" },
-    { "议", "議" },
-    { "讯", "訊" },
-    { "记", "記" },
-    { "讲", "講" },
-    { "讳", "諱" },
-    { "讴", "謳" },
-    { "讵", "詎" },
-    { "讶", "訝" },
-    { "讷", "訥" },
-    { "许", "許" },
-    { "许愿起经", "許愿起經" },
-    { "讹", "訛" },
-    { "论", "論" },
-    { "论文里", "論文裡" },
-    { "讼", "訟" },
-    { "讽", "諷" },
-    { "设", "設" },
-    { "访", "訪" },
-    { "诀", "訣" },
-    { "证", "證" },
-    { "证谏", "証諫" },
-    { "诂", "詁" },
-    { "诃", "訶" },
-    { "评", "評" },
-    { "评断发", "評斷發" },
-    { "评注", "評註" },
-    { "评鉴", "評鑑" },
-    { "诅", "詛" },
-    { "识", "識" },
-    { "诈", "詐" },
-    { "诉", "訴" },
-    { "诊", "診" },
-    { "诋", "詆" },
-    { "诌", "謅" },
-    { "词", "詞" },
-    { "词余", "詞餘" },
-    { "词干", "詞幹" },
-    { "词汇", "詞彙" },
-    { "诎", "詘" },
-    { "诏", "詔" },
-    { "译", "譯" },
-    { "译制", "譯製" },
-    { "译文里", "譯文裡" },
-    { "译注", "譯註" },
-    { "诒", "詒" },
-    { "诓", "誆" },
-    { "诔", "誄" },
-    { "诔赞", "誄讚" },
-    { "试", "試" },
-    { "试制", "試製" },
-    { "诖", "詿" },
-    { "诗", "詩" },
-    { "诗云", "詩云" },
-    { "诗余", "詩餘" },
-    { "诗赞", "詩讚" },
-    { "诗钟", "詩鐘" },
-    { "诘", "詰" },
-    { "诙", "詼" },
-    { "诚", "誠" },
-    { "诚征", "誠徵" },
-    { "诚朴", "誠樸" },
-    { "诛", "誅" },
-    { "诜", "詵" },
-    { "话", "話" },
-    { "话里有话", "話裡有話" },
-    { "诞", "誕" },
-    { "诟", "詬" },
-    { "诠", "詮" },
-    { "诡", "詭" },
-    { "询", "詢" },
-    { "诣", "詣" },
-    { "诤", "諍" },
-    { "该", "該" },
-    { "该钟", "該鐘" },
-    { "详", "詳" },
-    { "详征博引", "詳徵博引" },
-    { "详注", "詳註" },
-    { "诧", "詫" },
-    { "诨", "諢" },
-    { "诩", "詡" },
-    { "诫", "誡" },
-    { "诬", "誣" },
-    { "诬蔑", "誣衊" },
-    { "语", "語" },
-    { "语云", "語云" },
-    { "语有云", "語有云" },
-    { "语汇", "語彙" },
-    { "语法里", "語法裡" },
-    { "语里", "語裡" },
-    { "诮", "誚" },
-    { "误", "誤" },
-    { "诰", "誥" },
-    { "诱", "誘" },
-    { "诱奸", "誘姦" },
-    { "诲", "誨" },
-    { "诳", "誑" },
-    { "说", "說" },
-    { "说不准", "說不準" },
-    { "诵", "誦" },
-    { "诶", "誒" },
-    { "请", "請" },
-    { "请君入瓮", "請君入甕" },
-    { "请托", "請託" },
-    { "诸", "諸" },
-    { "诸余", "諸餘" },
-    { "诹", "諏" },
-    { "诺", "諾" },
-    { "读", "讀" },
-    { "诼", "諑" },
-    { "诽", "誹" },
-    { "课", "課" },
-    { "课余", "課餘" },
-    { "课征", "課徵" },
-    { "诿", "諉" },
-    { "谀", "諛" },
-    { "谁", "誰" },
-    { "谁干的", "誰幹的" },
-    { "谂", "諗" },
-    { "调", "調" },
-    { "调准", "調準" },
-    { "调制", "調製" },
-    { "调表", "調錶" },
-    { "调钟表", "調鐘錶" },
-    { "谄", "諂" },
-    { "谅", "諒" },
-    { "谆", "諄" },
-    { "谇", "誶" },
-    { "谈", "談" },
-    { "谈征", "談徵" },
-    { "谊", "誼" },
-    { "谋", "謀" },
-    { "谋干", "謀幹" },
-    { "谌", "諶" },
-    { "谍", "諜" },
-    { "谎", "謊" },
-    { "谏", "諫" },
-    { "谐", "諧" },
-    { "谑", "謔" },
-    { "谒", "謁" },
-    { "谓", "謂" },
-    { "谔", "諤" },
-    { "谕", "諭" },
-    { "谖", "諼" },
-    { "谗", "讒" },
-    { "谘", "諮" },
-    { "谙", "諳" },
-    { "谚", "諺" },
-    { "谛", "諦" },
-    { "谜", "謎" },
-    { "谝", "諞" },
-    { "谟", "謨" },
-    { "谠", "讜" },
-    { "谡", "謖" },
-    { "谢", "謝" },
-    { "谢华后", "謝華后" },
-    { "谢杰", "謝杰" },
-    { "谣", "謠" },
-    { "谤", "謗" },
-    { "谥", "諡" },
-    { "谦", "謙" },
-    { "谧", "謐" },
-    { "谨", "謹" },
-    { "谨愿", "謹愿" },
-    { "谩", "謾" },
-    { "谪", "謫" },
-    { "谫", "譾" },
-    { "谬", "謬" },
-    { "谬赞", "謬讚" },
-    { "谬采虚声", "謬採虛聲" },
-    { "谭", "譚" },
-    { "谮", "譖" },
-    { "谯", "譙" },
-    { "谰", "讕" },
-    { "谱", "譜" },
-    { "谲", "譎" },
-    { "谳", "讞" },
-    { "谴", "譴" },
-    { "谵", "譫" },
-    { "谶", "讖" },
-    { "谷人", "穀人" },
-    { "谷仓", "穀倉" },
-    { "谷保家商", "穀保家商" },
-    { "谷圭", "穀圭" },
-    { "谷场", "穀場" },
-    { "谷城县", "穀城縣" },
-    { "谷壳", "穀殼" },
-    { "谷子", "穀子" },
-    { "谷日", "穀日" },
-    { "谷旦", "穀旦" },
-    { "谷梁", "穀梁" },
-    { "谷氨", "穀氨" },
-    { "谷物", "穀物" },
-    { "谷皮", "穀皮" },
-    { "谷神", "穀神" },
-    { "谷禄", "穀祿" },
-    { "谷米", "穀米" },
-    { "谷类", "穀類" },
-    { "谷粒", "穀粒" },
-    { "谷胱", "穀胱" },
-    { "谷舱", "穀艙" },
-    { "谷苗", "穀苗" },
-    { "谷草", "穀草" },
-    { "谷谷", "穀穀" },
-    { "谷贱伤农", "穀賤傷農" },
-    { "谷贵饿农", "穀貴餓農" },
-    { "谷雨", "穀雨" },
-    { "谷食", "穀食" },
-    { "豆干", "豆乾" },
-    { "豆腐干", "豆腐乾" },
-    { "象征", "象徵" },
-    { "贝", "貝" },
-    { "贞", "貞" },
-    { "负", "負" },
-    { "贡", "貢" },
-    { "财", "財" },
-    { "责", "責" },
-    { "贤", "賢" },
-    { "贤后", "賢后" },
-    { "败", "敗" },
-    { "账", "賬" },
-    { "货", "貨" },
-    { "质", "質" },
-    { "质数里", "質數裡" },
-    { "质朴", "質樸" },
-    { "贩", "販" },
-    { "贪", "貪" },
-    { "贪欲", "貪慾" },
-    { "贫", "貧" },
-    { "贬", "貶" },
-    { "购", "購" },
-    { "购买欲", "購買慾" },
-    { "购并", "購併" },
-    { "贮", "貯" },
-    { "贯", "貫" },
-    { "贰", "貳" },
-    { "贱", "賤" },
-    { "贲", "賁" },
-    { "贳", "貰" },
-    { "贴", "貼" },
-    { "贵", "貴" },
-    { "贵价", "貴价" },
-    { "贵干", "貴幹" },
-    { "贵征", "貴徵" },
-    { "贶", "貺" },
-    { "贷", "貸" },
-    { "贸", "貿" },
-    { "费", "費" },
-    { "费米面", "費米面" },
-    { "贺", "賀" },
-    { "贻", "貽" },
-    { "贻范", "貽範" },
-    { "贼", "賊" },
-    { "贽", "贄" },
-    { "贾", "賈" },
-    { "贾后", "賈后" },
-    { "贿", "賄" },
-    { "赀", "貲" },
-    { "赁", "賃" },
-    { "赂", "賂" },
-    { "赃", "贓" },
-    { "资", "資" },
-    { "赅", "賅" },
-    { "赆", "贐" },
-    { "赇", "賕" },
-    { "赈", "賑" },
-    { "赈饥", "賑饑" },
-    { "赉", "賚" },
-    { "赊", "賒" },
-    { "赋", "賦" },
-    { "赋范", "賦范" },
-    { "赌", "賭" },
-    { "赌台", "賭檯" },
-    { "赌后", "賭后" },
-    { "赌斗", "賭鬥" },
-    { "赍", "齎" },
-    { "赎", "贖" },
-    { "赏", "賞" },
-    { "赏赞", "賞讚" },
-    { "赐", "賜" },
-    { "赓", "賡" },
-    { "赔", "賠" },
-    { "赕", "賧" },
-    { "赖", "賴" },
-    { "赘", "贅" },
-    { "赙", "賻" },
-    { "赚", "賺" },
-    { "赛", "賽" },
-    { "赜", "賾" },
-    { "赝", "贗" },
-    { "赞", "贊" },
-    { "赞一个", "讚一個" },
-    { "赞不绝口", "讚不絕口" },
-    { "赞乐", "讚樂" },
-    { "赞佩", "讚佩" },
-    { "赞叹", "讚嘆" },
-    { "赞呗", "讚唄" },
-    { "赞扬", "讚揚" },
-    { "赞歌", "讚歌" },
-    { "赞美", "讚美" },
-    { "赞羡", "讚羨" },
-    { "赞誉", "讚譽" },
-    { "赞许", "讚許" },
-    { "赞词", "讚詞" },
-    { "赞赏", "讚賞" },
-    { "赞辞", "讚辭" },
-    { "赞颂", "讚頌" },
-    { "赠", "贈" },
-    { "赡", "贍" },
-    { "赢", "贏" },
-    { "赢余", "贏餘" },
-    { "赣", "贛" },
-    { "赤术", "赤朮" },
-    { "赤绳系足", "赤繩繫足" },
-    { "赵", "趙" },
-    { "赵威后", "趙威后" },
-    { "赵惠后", "趙惠后" },
-    { "赵治勋", "趙治勳" },
-    { "赶", "趕" },
-    { "赶制", "趕製" },
-    { "赶面棍", "趕麵棍" },
-    { "起哄", "起鬨" },
-    { "超级杯", "超級盃" },
-    { "超赞", "超讚" },
-    { "趋", "趨" },
-    { "趱", "趲" },
-    { "趱干", "趲幹" },
-    { "趸", "躉" },
-    { "跃", "躍" },
-    { "跄", "蹌" },
-    { "跞", "躒" },
-    { "路图里", "路圖裡" },
-    { "路签", "路籤" },
-    { "跳梁小丑", "跳樑小丑" },
-    { "跳荡", "跳蕩" },
-    { "践", "踐" },
-    { "跷", "蹺" },
-    { "跸", "蹕" },
-    { "跹", "躚" },
-    { "跻", "躋" },
-    { "踊", "踴" },
-    { "踌", "躊" },
-    { "踡局", "踡跼" },
-    { "踪", "蹤" },
-    { "踬", "躓" },
-    { "踯", "躑" },
-    { "蹑", "躡" },
-    { "蹒", "蹣" },
-    { "蹒局", "蹣跼" },
-    { "蹭棱子", "蹭稜子" },
-    { "蹰", "躕" },
-    { "蹿", "躥" },
-    { "躁郁", "躁鬱" },
-    { "躏", "躪" },
-    { "躜", "躦" },
-    { "身体发肤", "身體髮膚" },
-    { "躯", "軀" },
-    { "躯干", "軀幹" },
-    { "车", "車" },
-    { "车库里", "車庫裡" },
-    { "车站里", "車站裡" },
-    { "车里", "車裡" },
-    { "车里雅宾斯克", "車里雅賓斯克" },
-    { "轧", "軋" },
-    { "轨", "軌" },
-    { "轨范", "軌範" },
-    { "轩", "軒" },
-    { "轩辟", "軒闢" },
-    { "轫", "軔" },
-    { "转", "轉" },
-    { "转向", "轉向" },
-    { "转托", "轉託" },
-    { "转斗千里", "轉鬥千里" },
-    { "轭", "軛" },
-    { "轮", "輪" },
-    { "轮回", "輪迴" },
-    { "轮奸", "輪姦" },
-    { "软", "軟" },
-    { "轰", "轟" },
-    { "轲", "軻" },
-    { "轳", "轤" },
-    { "轴", "軸" },
-    { "轵", "軹" },
-    { "轶", "軼" },
-    { "轸", "軫" },
-    { "轹", "轢" },
-    { "轺", "軺" },
-    { "轻", "輕" },
-    { "轻松", "輕鬆" },
-    { "轻松松", "輕鬆鬆" },
-    { "轼", "軾" },
-    { "载", "載" },
-    { "轾", "輊" },
-    { "轿", "轎" },
-    { "辁", "輇" },
-    { "辂", "輅" },
-    { "较", "較" },
-    { "辄", "輒" },
-    { "辅", "輔" },
-    { "辆", "輛" },
-    { "辇", "輦" },
-    { "辈", "輩" },
-    { "辉", "輝" },
-    { "辊", "輥" },
-    { "辋", "輞" },
-    { "辍", "輟" },
-    { "辎", "輜" },
-    { "辏", "輳" },
-    { "辐", "輻" },
-    { "辑", "輯" },
-    { "输", "輸" },
-    { "辔", "轡" },
-    { "辕", "轅" },
-    { "辖", "轄" },
-    { "辗", "輾" },
-    { "辘", "轆" },
-    { "辙", "轍" },
-    { "辚", "轔" },
-    { "辞", "辭" },
-    { "辞汇", "辭彙" },
-    { "辟为", "闢為" },
-    { "辟佛", "闢佛" },
-    { "辟作", "闢作" },
-    { "辟划", "闢劃" },
-    { "辟土", "闢土" },
-    { "辟地", "闢地" },
-    { "辟室", "闢室" },
-    { "辟建", "闢建" },
-    { "辟田", "闢田" },
-    { "辟筑", "闢築" },
-    { "辟谣", "闢謠" },
-    { "辟谷", "辟穀" },
-    { "辟辟", "闢辟" },
-    { "辟邪以律", "闢邪以律" },
-    { "辣面", "辣麵" },
-    { "辩", "辯" },
-    { "辩斗", "辯鬥" },
-    { "辫", "辮" },
-    { "辫发", "辮髮" },
-    { "辰溪县", "辰谿縣" },
-    { "边", "邊" },
-    { "辽", "遼" },
-    { "辽沈", "遼瀋" },
-    { "达", "達" },
-    { "迁", "遷" },
-    { "迂回", "迂迴" },
-    { "过", "過" },
-    { "过水面", "過水麵" },
-    { "迈", "邁" },
-    { "运", "運" },
-    { "近日无仇", "近日無讎" },
-    { "返朴", "返樸" },
-    { "还", "還" },
-    { "还冲", "還衝" },
-    { "还采", "還採" },
-    { "这", "這" },
-    { "这么干", "這麼幹" },
-    { "这伙人", "這夥人" },
-    { "这出", "這齣" },
-    { "这出世", "這出世" },
-    { "这出乎", "這出乎" },
-    { "这出人", "這出人" },
-    { "这出版", "這出版" },
-    { "这出现", "這出現" },
-    { "这出生", "這出生" },
-    { "这出色", "這出色" },
-    { "这出身", "這出身" },
-    { "这出道", "這出道" },
-    { "这只", "這隻" },
-    { "这只不", "這只不" },
-    { "这只不过", "這只不過" },
-    { "这只会", "這只會" },
-    { "这只允", "這只允" },
-    { "这只包括", "這只包括" },
-    { "这只可", "這只可" },
-    { "这只在", "這只在" },
-    { "这只容", "這只容" },
-    { "这只应", "這只應" },
-    { "这只是", "這只是" },
-    { "这只比", "這只比" },
-    { "这只用", "這只用" },
-    { "这只能", "這只能" },
-    { "这只采", "這只採" },
-    { "这只限", "這只限" },
-    { "这只需", "這只需" },
-    { "这只须", "這只須" },
-    { "这里", "這裡" },
-    { "这钟", "這鐘" },
-    { "进", "進" },
-    { "进两出", "進兩出" },
-    { "进制", "進制" },
-    { "远", "遠" },
-    { "远游", "遠遊" },
-    { "违", "違" },
-    { "连", "連" },
-    { "连三并四", "連三併四" },
-    { "连发式", "連發式" },
-    { "连系", "連繫" },
-    { "连采", "連採" },
-    { "迟", "遲" },
-    { "迥然回异", "迥然迴異" },
-    { "迩", "邇" },
-    { "迳", "逕" },
-    { "迷蒙", "迷濛" },
-    { "迹", "跡" },
-    { "追凶", "追兇" },
-    { "退伙", "退夥" },
-    { "适", "適" },
-    { "逆钟", "逆鐘" },
-    { "逆钟向", "逆鐘向" },
-    { "逆风后", "逆風後" },
-    { "选", "選" },
-    { "选手表决", "選手表決" },
-    { "选手表明", "選手表明" },
-    { "选手表现", "選手表現" },
-    { "选手表示", "選手表示" },
-    { "选手表达", "選手表達" },
-    { "逊", "遜" },
-    { "逋发", "逋髮" },
-    { "逍遥游", "逍遙遊" },
-    { "透辟", "透闢" },
-    { "递", "遞" },
-    { "递回", "遞迴" },
-    { "通历", "通曆" },
-    { "通历史", "通歷史" },
-    { "通奸", "通姦" },
-    { "通心面", "通心麵" },
-    { "通鉴", "通鑑" },
-    { "逞凶斗狠", "逞兇鬥狠" },
-    { "造钟", "造鐘" },
-    { "逦", "邐" },
-    { "逻", "邏" },
-    { "逼并", "逼併" },
-    { "逾闲", "踰閑" },
-    { "遇风后", "遇風後" },
-    { "道范", "道範" },
-    { "遗", "遺" },
-    { "遗传钟", "遺傳鐘" },
-    { "遗范", "遺範" },
-    { "遗迹", "遺蹟" },
-    { "遥", "遙" },
-    { "遨游", "遨遊" },
-    { "遮丑", "遮醜" },
-    { "邀天之幸", "邀天之倖" },
-    { "邋里邋遢", "邋裡邋遢" },
-    { "邓", "鄧" },
-    { "邝", "鄺" },
-    { "那卷", "那捲" },
-    { "那只", "那隻" },
-    { "那只不过", "那只不過" },
-    { "那只会", "那只會" },
-    { "那只应", "那只應" },
-    { "那只须", "那只須" },
-    { "那里", "那裡" },
-    { "邬", "鄔" },
-    { "邮", "郵" },
-    { "邹", "鄒" },
-    { "邺", "鄴" },
-    { "邻", "鄰" },
-    { "郁伊", "鬱伊" },
-    { "郁勃", "鬱勃" },
-    { "郁卒", "鬱卒" },
-    { "郁南", "鬱南" },
-    { "郁垒", "鬱壘" },
-    { "郁堙不偶", "鬱堙不偶" },
-    { "郁塞", "鬱塞" },
-    { "郁律", "鬱律" },
-    { "郁悒", "鬱悒" },
-    { "郁愤", "鬱憤" },
-    { "郁抑", "鬱抑" },
-    { "郁挹", "鬱挹" },
-    { "郁朴", "郁樸" },
-    { "郁林", "鬱林" },
-    { "郁气", "鬱氣" },
-    { "郁江", "鬱江" },
-    { "郁沉沉", "鬱沉沉" },
-    { "郁泱", "鬱泱" },
-    { "郁火", "鬱火" },
-    { "郁热", "鬱熱" },
-    { "郁燠", "鬱燠" },
-    { "郁症", "鬱症" },
-    { "郁积", "鬱積" },
-    { "郁纡", "鬱紆" },
-    { "郁结", "鬱結" },
-    { "郁蒸", "鬱蒸" },
-    { "郁蓊", "鬱蓊" },
-    { "郁血", "鬱血" },
-    { "郁邑", "鬱邑" },
-    { "郁郁", "鬱郁" },
-    { "郁郁不乐", "鬱鬱不樂" },
-    { "郁郁不平", "鬱鬱不平" },
-    { "郁郁寡欢", "鬱鬱寡歡" },
-    { "郁郁而终", "鬱鬱而終" },
-    { "郁郁苍苍", "鬱鬱蒼蒼" },
-    { "郁郁葱葱", "鬱鬱蔥蔥" },
-    { "郁金", "鬱金" },
-    { "郁闭", "鬱閉" },
-    { "郁闷", "鬱悶" },
-    { "郁陶", "鬱陶" },
-    { "郁黑", "鬱黑" },
-    { "郊游", "郊遊" },
-    { "郏", "郟" },
-    { "郐", "鄶" },
-    { "郑", "鄭" },
-    { "郑凯云", "鄭凱云" },
-    { "郓", "鄆" },
-    { "郘钟", "郘鐘" },
-    { "郦", "酈" },
-    { "郧", "鄖" },
-    { "部落发", "部落發" },
-    { "郸", "鄲" },
-    { "都市里", "都市裡" },
-    { "配制", "配製" },
-    { "配制饲料", "配制飼料" },
-    { "配图里", "配圖裡" },
-    { "酒坛", "酒罈" },
-    { "酒曲", "酒麴" },
-    { "酒气冲天", "酒氣衝天" },
-    { "酒麹", "酒麴" },
-    { "酝", "醞" },
-    { "酥松", "酥鬆" },
-    { "酱", "醬" },
-    { "酸姜", "酸薑" },
-    { "酽", "釅" },
-    { "酾", "釃" },
-    { "酿", "釀" },
-    { "酿制", "釀製" },
-    { "醇朴", "醇樸" },
-    { "醋坛", "醋罈" },
-    { "采下", "採下" },
-    { "采为", "採為" },
-    { "采买", "採買" },
-    { "采伐", "採伐" },
-    { "采住", "採住" },
-    { "采信", "採信" },
-    { "采光", "採光" },
-    { "采到", "採到" },
-    { "采制", "採制" },
-    { "采办", "採辦" },
-    { "采区", "採區" },
-    { "采去", "採去" },
-    { "采取", "採取" },
-    { "采回", "採回" },
-    { "采在", "採在" },
-    { "采好", "採好" },
-    { "采录", "採錄" },
-    { "采得", "採得" },
-    { "采择", "採擇" },
-    { "采拾", "採拾" },
-    { "采挖", "採挖" },
-    { "采掘", "採掘" },
-    { "采摘", "採摘" },
-    { "采摭", "採摭" },
-    { "采撷", "採擷" },
-    { "采收", "採收" },
-    { "采料", "採料" },
-    { "采暖", "採暖" },
-    { "采树种", "採樹種" },
-    { "采样", "採樣" },
-    { "采桑", "採桑" },
-    { "采樵人", "採樵人" },
-    { "采气", "採氣" },
-    { "采油", "採油" },
-    { "采煤", "採煤" },
-    { "采猎", "採獵" },
-    { "采珠", "採珠" },
-    { "采生折割", "採生折割" },
-    { "采用", "採用" },
-    { "采盐", "採鹽" },
-    { "采石", "採石" },
-    { "采石之战", "采石之戰" },
-    { "采石矶", "采石磯" },
-    { "采矿", "採礦" },
-    { "采砂场", "採砂場" },
-    { "采种", "採種" },
-    { "采空区", "採空區" },
-    { "采空采穗", "採空採穗" },
-    { "采納", "採納" },
-    { "采纳", "採納" },
-    { "采给", "採給" },
-    { "采花", "採花" },
-    { "采芹人", "採芹人" },
-    { "采茶", "採茶" },
-    { "采药", "採藥" },
-    { "采莲", "採蓮" },
-    { "采获", "採獲" },
-    { "采菊", "採菊" },
-    { "采薇", "採薇" },
-    { "采薪", "採薪" },
-    { "采血", "採血" },
-    { "采行", "採行" },
-    { "采补", "採補" },
-    { "采访", "採訪" },
-    { "采证", "採證" },
-    { "采购", "採購" },
-    { "采过", "採過" },
-    { "采运", "採運" },
-    { "采选", "採選" },
-    { "采金", "採金" },
-    { "采铁", "採鐵" },
-    { "采集", "採集" },
-    { "采风", "採風" },
-    { "采风问俗", "採風問俗" },
-    { "采食", "採食" },
-    { "释", "釋" },
-    { "里勾外连", "裡勾外連" },
-    { "里头", "裡頭" },
-    { "里层", "裡層" },
-    { "里屋", "裡屋" },
-    { "里带", "裡帶" },
-    { "里应外合", "裡應外合" },
-    { "里弦", "裡弦" },
-    { "里水镇", "裏水鎮" },
-    { "里海", "裏海" },
-    { "里海大学", "里海大學" },
-    { "里白", "裏白" },
-    { "里脊", "裡脊" },
-    { "里衣", "裡衣" },
-    { "里边", "裡邊" },
-    { "里运河", "裏運河" },
-    { "里通外国", "裡通外國" },
-    { "里通外敌", "裡通外敵" },
-    { "里铺", "里舖" },
-    { "里间", "裡間" },
-    { "里面", "裡面" },
-    { "里面包", "裡面包" },
-    { "重制", "重製" },
-    { "重复", "重複" },
-    { "重托", "重託" },
-    { "重游", "重遊" },
-    { "重罗面", "重羅麵" },
-    { "野姜", "野薑" },
-    { "野游", "野遊" },
-    { "量不准", "量不準" },
-    { "金仆姑", "金僕姑" },
-    { "金发", "金髮" },
-    { "金圣叹", "金聖歎" },
-    { "金溪县", "金谿縣" },
-    { "金范", "金範" },
-    { "金表态", "金表態" },
-    { "金表扬", "金表揚" },
-    { "金表现", "金表現" },
-    { "金表达", "金表達" },
-    { "金装玉里", "金裝玉裡" },
-    { "金钟", "金鐘" },
-    { "金链", "金鍊" },
-    { "鉴", "鑒" },
-    { "鉴于", "鑑於" },
-    { "鉴别", "鑑別" },
-    { "鉴古", "鑑古" },
-    { "鉴定", "鑑定" },
-    { "鉴察", "鑑察" },
-    { "鉴往知来", "鑑往知來" },
-    { "鉴戒", "鑑戒" },
-    { "鉴湖", "鑑湖" },
-    { "鉴藏", "鑑藏" },
-    { "鉴证", "鑑證" },
-    { "鉴识", "鑑識" },
-    { "鉴谅", "鑑諒" },
-    { "鉴赏", "鑑賞" },
-    { "銮", "鑾" },
-    { "錾", "鏨" },
-    { "钆", "釓" },
-    { "钇", "釔" },
-    { "针", "針" },
-    { "钉", "釘" },
-    { "钊", "釗" },
-    { "钋", "釙" },
-    { "钌", "釕" },
-    { "钍", "釷" },
-    { "钏", "釧" },
-    { "钐", "釤" },
-    { "钒", "釩" },
-    { "钓", "釣" },
-    { "钔", "鍆" },
-    { "钕", "釹" },
-    { "钗", "釵" },
-    { "钙", "鈣" },
-    { "钛", "鈦" },
-    { "钜", "鉅" },
-    { "钝", "鈍" },
-    { "钞", "鈔" },
-    { "钟", "鍾" },
-    { "钟上", "鐘上" },
-    { "钟下", "鐘下" },
-    { "钟不", "鐘不" },
-    { "钟不扣不鸣", "鐘不扣不鳴" },
-    { "钟不撞不鸣", "鐘不撞不鳴" },
-    { "钟不敲不响", "鐘不敲不響" },
-    { "钟不空则哑", "鐘不空則啞" },
-    { "钟乳洞", "鐘乳洞" },
-    { "钟乳石", "鐘乳石" },
-    { "钟体", "鐘體" },
-    { "钟停", "鐘停" },
-    { "钟关", "鐘關" },
-    { "钟匠", "鐘匠" },
-    { "钟发音", "鐘發音" },
-    { "钟口", "鐘口" },
-    { "钟响", "鐘響" },
-    { "钟在寺里", "鐘在寺裡" },
-    { "钟塔", "鐘塔" },
-    { "钟壁", "鐘壁" },
-    { "钟声", "鐘聲" },
-    { "钟太", "鐘太" },
-    { "钟头", "鐘頭" },
-    { "钟好", "鐘好" },
-    { "钟山", "鐘山" },
-    { "钟左右", "鐘左右" },
-    { "钟差", "鐘差" },
-    { "钟座", "鐘座" },
-    { "钟形", "鐘形" },
-    { "钟形虫", "鐘形蟲" },
-    { "钟律", "鐘律" },
-    { "钟快", "鐘快" },
-    { "钟慢", "鐘慢" },
-    { "钟摆", "鐘擺" },
-    { "钟敲", "鐘敲" },
-    { "钟有", "鐘有" },
-    { "钟楼", "鐘樓" },
-    { "钟模", "鐘模" },
-    { "钟没", "鐘沒" },
-    { "钟漏", "鐘漏" },
-    { "钟点", "鐘點" },
-    { "钟王", "鐘王" },
-    { "钟琴", "鐘琴" },
-    { "钟的", "鐘的" },
-    { "钟盘", "鐘盤" },
-    { "钟相", "鐘相" },
-    { "钟磬", "鐘磬" },
-    { "钟纽", "鐘紐" },
-    { "钟罩", "鐘罩" },
-    { "钟腰", "鐘腰" },
-    { "钟花", "鐘花" },
-    { "钟螺", "鐘螺" },
-    { "钟行", "鐘行" },
-    { "钟表", "鐘錶" },
-    { "钟表停", "鐘錶停" },
-    { "钟表快", "鐘錶快" },
-    { "钟表慢", "鐘錶慢" },
-    { "钟表王", "鐘錶王" },
-    { "钟表盘", "鐘錶盤" },
-    { "钟表速", "鐘錶速" },
-    { "钟表面", "鐘表面" },
-    { "钟被", "鐘被" },
-    { "钟调", "鐘調" },
-    { "钟身", "鐘身" },
-    { "钟速", "鐘速" },
-    { "钟陈列", "鐘陳列" },
-    { "钟面", "鐘面" },
-    { "钟顶", "鐘頂" },
-    { "钟鸣", "鐘鳴" },
-    { "钟鼎", "鐘鼎" },
-    { "钟鼓", "鐘鼓" },
-    { "钠", "鈉" },
-    { "钡", "鋇" },
-    { "钢", "鋼" },
-    { "钢之炼金术师", "鋼之鍊金術師" },
-    { "钢制", "鋼製" },
-    { "钢梁", "鋼樑" },
-    { "钣", "鈑" },
-    { "钤", "鈐" },
-    { "钥", "鑰" },
-    { "钦", "欽" },
-    { "钧", "鈞" },
-    { "钨", "鎢" },
-    { "钩", "鈎" },
-    { "钩心斗角", "鈎心鬥角" },
-    { "钪", "鈧" },
-    { "钫", "鈁" },
-    { "钬", "鈥" },
-    { "钭", "鈄" },
-    { "钮", "鈕" },
-    { "钯", "鈀" },
-    { "钰", "鈺" },
-    { "钱", "錢" },
-    { "钱范", "錢範" },
-    { "钱谷", "錢穀" },
-    { "钲", "鉦" },
-    { "钳", "鉗" },
-    { "钴", "鈷" },
-    { "钵", "缽" },
-    { "钶", "鈳" },
-    { "钸", "鈽" },
-    { "钹", "鈸" },
-    { "钺", "鉞" },
-    { "钻", "鑽" },
-    { "钼", "鉬" },
-    { "钽", "鉭" },
-    { "钾", "鉀" },
-    { "钿", "鈿" },
-    { "铀", "鈾" },
-    { "铁", "鐵" },
-    { "铁制", "鐵製" },
-    { "铁钟", "鐵鐘" },
-    { "铁锈", "鐵鏽" },
-    { "铂", "鉑" },
-    { "铃", "鈴" },
-    { "铄", "鑠" },
-    { "铅", "鉛" },
-    { "铆", "鉚" },
-    { "铈", "鈰" },
-    { "铉", "鉉" },
-    { "铊", "鉈" },
-    { "铋", "鉍" },
-    { "铌", "鈮" },
-    { "铍", "鈹" },
-    { "铎", "鐸" },
-    { "铐", "銬" },
-    { "铑", "銠" },
-    { "铒", "鉺" },
-    { "铕", "銪" },
-    { "铖", "鋮" },
-    { "铗", "鋏" },
-    { "铙", "鐃" },
-    { "铛", "鐺" },
-    { "铜", "銅" },
-    { "铜制", "銅製" },
-    { "铜范", "銅範" },
-    { "铜钟", "銅鐘" },
-    { "铝", "鋁" },
-    { "铝制", "鋁製" },
-    { "铟", "銦" },
-    { "铠", "鎧" },
-    { "铡", "鍘" },
-    { "铢", "銖" },
-    { "铣", "銑" },
-    { "铤", "鋌" },
-    { "铥", "銩" },
-    { "铧", "鏵" },
-    { "铨", "銓" },
-    { "铩", "鎩" },
-    { "铪", "鉿" },
-    { "铫", "銚" },
-    { "铬", "鉻" },
-    { "铭", "銘" },
-    { "铮", "錚" },
-    { "铯", "銫" },
-    { "铯钟", "銫鐘" },
-    { "铰", "鉸" },
-    { "铱", "銥" },
-    { "铲", "鏟" },
-    { "铲出", "剷出" },
-    { "铲刈", "剷刈" },
-    { "铲头", "剷頭" },
-    { "铲平", "剷平" },
-    { "铲除", "剷除" },
-    { "铳", "銃" },
-    { "铴", "鐋" },
-    { "铵", "銨" },
-    { "银", "銀" },
-    { "银发", "銀髮" },
-    { "银朱", "銀硃" },
-    { "铷", "銣" },
-    { "铸", "鑄" },
-    { "铸钟", "鑄鐘" },
-    { "铹", "鐒" },
-    { "铺", "鋪" },
-    { "铼", "錸" },
-    { "铽", "鋱" },
-    { "链", "鏈" },
-    { "链表", "鍊表" },
-    { "铿", "鏗" },
-    { "销", "銷" },
-    { "锁", "鎖" },
-    { "锂", "鋰" },
-    { "锄", "鋤" },
-    { "锅", "鍋" },
-    { "锆", "鋯" },
-    { "锇", "鋨" },
-    { "锈", "銹" },
-    { "锈病", "鏽病" },
-    { "锈菌", "鏽菌" },
-    { "锈蚀", "鏽蝕" },
-    { "锉", "銼" },
-    { "锊", "鋝" },
-    { "锋", "鋒" },
-    { "锌", "鋅" },
-    { "锌制", "鋅製" },
-    { "锐", "銳" },
-    { "锑", "銻" },
-    { "锒", "鋃" },
-    { "锓", "鋟" },
-    { "锔", "鋦" },
-    { "锕", "錒" },
-    { "锖", "錆" },
-    { "锗", "鍺" },
-    { "错", "錯" },
-    { "锚", "錨" },
-    { "锛", "錛" },
-    { "锞", "錁" },
-    { "锟", "錕" },
-    { "锡", "錫" },
-    { "锢", "錮" },
-    { "锣", "鑼" },
-    { "锤", "錘" },
-    { "锤炼", "錘鍊" },
-    { "锥", "錐" },
-    { "锦", "錦" },
-    { "锦卤", "錦滷" },
-    { "锦绣花园", "錦綉花園" },
-    { "锨", "杴" },
-    { "锩", "錈" },
-    { "锬", "錟" },
-    { "锭", "錠" },
-    { "键", "鍵" },
-    { "锯", "鋸" },
-    { "锰", "錳" },
-    { "锱", "錙" },
-    { "锲", "鍥" },
-    { "锲而不舍", "鍥而不捨" },
-    { "锴", "鍇" },
-    { "锵", "鏘" },
-    { "锶", "鍶" },
-    { "锷", "鍔" },
-    { "锸", "鍤" },
-    { "锹", "鍬" },
-    { "锺", "鍾" },
-    { "锻", "鍛" },
-    { "锼", "鎪" },
-    { "锾", "鍰" },
-    { "镀", "鍍" },
-    { "镁", "鎂" },
-    { "镂", "鏤" },
-    { "镄", "鐨" },
-    { "镆", "鏌" },
-    { "镇", "鎮" },
-    { "镇里", "鎮裡" },
-    { "镉", "鎘" },
-    { "镊", "鑷" },
-    { "镌", "鐫" },
-    { "镍", "鎳" },
-    { "镏", "鎦" },
-    { "镐", "鎬" },
-    { "镑", "鎊" },
-    { "镒", "鎰" },
-    { "镓", "鎵" },
-    { "镔", "鑌" },
-    { "镖", "鏢" },
-    { "镗", "鏜" },
-    { "镘", "鏝" },
-    { "镙", "鏍" },
-    { "镛", "鏞" },
-    { "镜", "鏡" },
-    { "镜图里", "鏡圖裡" },
-    { "镝", "鏑" },
-    { "镞", "鏃" },
-    { "镟", "鏇" },
-    { "镡", "鐔" },
-    { "镢", "钁" },
-    { "镣", "鐐" },
-    { "镤", "鏷" },
-    { "镦", "鐓" },
-    { "镧", "鑭" },
-    { "镨", "鐠" },
-    { "镪", "鏹" },
-    { "镫", "鐙" },
-    { "镬", "鑊" },
-    { "镭", "鐳" },
-    { "镯", "鐲" },
-    { "镰", "鐮" },
-    { "镰仓", "鎌倉" },
-    { "镱", "鐿" },
-    { "镳", "鑣" },
-    { "镶", "鑲" },
-    { "长", "長" },
-    { "长几", "長几" },
-    { "长历", "長曆" },
-    { "长历史", "長歷史" },
-    { "长发公主", "長髮公主" },
-    { "长发妹", "長髮妹" },
-    { "长发姑娘", "長髮姑娘" },
-    { "长得丑", "長得醜" },
-    { "门", "門" },
-    { "门吊儿", "門弔兒" },
-    { "门帘", "門帘" },
-    { "门里", "門裡" },
-    { "闩", "閂" },
-    { "闪", "閃" },
-    { "闫", "閆" },
-    { "闫怀礼", "閆懷禮" },
-    { "闭", "閉" },
-    { "问", "問" },
-    { "闯", "闖" },
-    { "闯炼", "闖鍊" },
-    { "闯荡", "闖蕩" },
-    { "闰", "閏" },
-    { "闱", "闈" },
-    { "闲", "閒" },
-    { "闲情逸致", "閒情逸緻" },
-    { "闲游", "閒遊" },
-    { "闲荡", "閒蕩" },
-    { "闲邪", "閑邪" },
-    { "闳", "閎" },
-    { "间", "間" },
-    { "间不容发", "間不容髮" },
-    { "间里", "間裡" },
-    { "闵", "閔" },
-    { "闵采尔", "閔採爾" },
-    { "闶", "閌" },
-    { "闷", "悶" },
-    { "闸", "閘" },
-    { "闹", "鬧" },
-    { "闹表", "鬧錶" },
-    { "闹钟", "鬧鐘" },
-    { "闺", "閨" },
-    { "闺范", "閨範" },
-    { "闻", "聞" },
-    { "闻风后", "聞風後" },
-    { "闼", "闥" },
-    { "闽", "閩" },
-    { "闾", "閭" },
-    { "阀", "閥" },
-    { "阁", "閣" },
-    { "阁府", "閤府" },
-    { "阂", "閡" },
-    { "阃", "閫" },
-    { "阃范", "閫範" },
-    { "阄", "鬮" },
-    { "阅", "閱" },
-    { "阆", "閬" },
-    { "阈", "閾" },
-    { "阉", "閹" },
-    { "阊", "閶" },
-    { "阋", "鬩" },
-    { "阌", "閿" },
-    { "阍", "閽" },
-    { "阎", "閻" },
-    { "阏", "閼" },
-    { "阐", "闡" },
-    { "阑", "闌" },
-    { "阒", "闃" },
-    { "阔", "闊" },
-    { "阕", "闋" },
-    { "阖", "闔" },
-    { "阗", "闐" },
-    { "阙", "闕" },
-    { "阚", "闞" },
-    { "队", "隊" },
-    { "队里", "隊裡" },
-    { "防御", "防禦" },
-    { "防水表", "防水錶" },
-    { "防范", "防範" },
-    { "防锈", "防鏽" },
-    { "阳", "陽" },
-    { "阳历", "陽曆" },
-    { "阳历史", "陽歷史" },
-    { "阳春面", "陽春麵" },
-    { "阳谷", "陽穀" },
-    { "阴", "陰" },
-    { "阴历", "陰曆" },
-    { "阴历史", "陰歷史" },
-    { "阴干", "陰乾" },
-    { "阴沟里翻船", "陰溝裡翻船" },
-    { "阴郁", "陰鬱" },
-    { "阵", "陣" },
-    { "阶", "階" },
-    { "附注", "附註" },
-    { "际", "際" },
-    { "陆", "陸" },
-    { "陇", "隴" },
-    { "陈", "陳" },
-    { "陈升", "陳昇" },
-    { "陈有后", "陳有后" },
-    { "陈杰", "陳杰" },
-    { "陈炼", "陳鍊" },
-    { "陉", "陘" },
-    { "陕", "陝" },
-    { "院里", "院裡" },
-    { "陧", "隉" },
-    { "陨", "隕" },
-    { "险", "險" },
-    { "陪吊", "陪弔" },
-    { "陶制", "陶製" },
-    { "隆准", "隆準" },
-    { "隆准许", "隆准許" },
-    { "随", "隨" },
-    { "隐", "隱" },
-    { "隐几", "隱几" },
-    { "隐占", "隱佔" },
-    { "隶", "隸" },
-    { "隽", "雋" },
-    { "难", "難" },
-    { "难舍", "難捨" },
-    { "雅范", "雅範" },
-    { "集团", "集團" },
-    { "集数里", "集數裡" },
-    { "集游法", "集遊法" },
-    { "集里", "集裡" },
-    { "雇主", "僱主" },
-    { "雇人", "僱人" },
-    { "雇佣", "僱傭" },
-    { "雇农", "僱農" },
-    { "雇到", "僱到" },
-    { "雇工", "僱工" },
-    { "雇船", "僱船" },
-    { "雇请", "僱請" },
-    { "雇车", "僱車" },
-    { "雏", "雛" },
-    { "雕心雁爪", "鵰心雁爪" },
-    { "雕悍", "鵰悍" },
-    { "雕梁画栋", "雕樑畫棟" },
-    { "雕翎", "鵰翎" },
-    { "雕鹗", "鵰鶚" },
-    { "雠", "讎" },
-    { "雨蒙蒙", "雨濛濛" },
-    { "雪窗萤几", "雪窗螢几" },
-    { "雪里", "雪裡" },
-    { "雪里红", "雪裡紅" },
-    { "雪里蕻", "雪裡蕻" },
-    { "雳", "靂" },
-    { "零个", "零個" },
-    { "零余", "零餘" },
-    { "零只", "零隻" },
-    { "零周后", "零周後" },
-    { "零天后", "零天後" },
-    { "雾", "霧" },
-    { "雾里", "霧裡" },
-    { "霁", "霽" },
-    { "霁范", "霽範" },
-    { "震栗", "震慄" },
-    { "霉毒", "黴毒" },
-    { "霉气冲天", "霉氣衝天" },
-    { "霉素", "黴素" },
-    { "霉菌", "黴菌" },
-    { "霉黑", "黴黑" },
-    { "霉黧", "黴黧" },
-    { "霭", "靄" },
-    { "露丑", "露醜" },
-    { "青山一发", "青山一髮" },
-    { "青霉", "青黴" },
-    { "靓", "靚" },
-    { "静", "靜" },
-    { "非常准", "非常準" },
-    { "面人儿", "麵人兒" },
-    { "面制品", "麵製品" },
-    { "面包", "麵包" },
-    { "面包办", "面包辦" },
-    { "面包厢", "面包廂" },
-    { "面包围", "面包圍" },
-    { "面包扎", "面包紮" },
-    { "面包揽", "面包攬" },
-    { "面包着", "面包著" },
-    { "面包罗", "面包羅" },
-    { "面包装", "面包裝" },
-    { "面厂", "麵廠" },
-    { "面团", "麵團" },
-    { "面坊", "麵坊" },
-    { "面坯儿", "麵坯兒" },
-    { "面塑", "麵塑" },
-    { "面店", "麵店" },
-    { "面店铺", "面店鋪" },
-    { "面摊", "麵攤" },
-    { "面杖", "麵杖" },
-    { "面条", "麵條" },
-    { "面条目", "面條目" },
-    { "面汤", "麵湯" },
-    { "面浆", "麵漿" },
-    { "面点师", "麵點師" },
-    { "面疙瘩", "麵疙瘩" },
-    { "面皮", "麵皮" },
-    { "面码儿", "麵碼兒" },
-    { "面筋", "麵筋" },
-    { "面粉", "麵粉" },
-    { "面粉红", "面粉紅" },
-    { "面糊", "麵糊" },
-    { "面缸", "麵缸" },
-    { "面茶", "麵茶" },
-    { "面食", "麵食" },
-    { "面食饭", "面食飯" },
-    { "面饺", "麵餃" },
-    { "面饼", "麵餅" },
-    { "面馆", "麵館" },
-    { "靥", "靨" },
-    { "鞋里", "鞋裡" },
-    { "鞑", "韃" },
-    { "鞣制", "鞣製" },
-    { "鞭辟入里", "鞭辟入裡" },
-    { "鞯", "韉" },
-    { "韦", "韋" },
-    { "韦席", "韋蓆" },
-    { "韧", "韌" },
-    { "韩", "韓" },
-    { "韩制", "韓製" },
-    { "韩国制", "韓國製" },
-    { "韪", "韙" },
-    { "韫", "韞" },
-    { "韬", "韜" },
-    { "音不准", "音不準" },
-    { "音准", "音準" },
-    { "音声如钟", "音聲如鐘" },
-    { "韵", "韻" },
-    { "韶山冲", "韶山沖" },
-    { "页", "頁" },
-    { "页面", "頁面" },
-    { "顶", "頂" },
-    { "顶凶", "頂兇" },
-    { "顶多", "頂多" },
-    { "顷", "頃" },
-    { "顸", "頇" },
-    { "项", "項" },
-    { "项链", "項鍊" },
-    { "顺", "順" },
-    { "顺钟向", "順鐘向" },
-    { "顺风后", "順風後" },
-    { "须", "須" },
-    { "须发", "鬚髮" },
-    { "须根", "鬚根" },
-    { "须根据", "須根據" },
-    { "须毛", "鬚毛" },
-    { "须生", "鬚生" },
-    { "须眉", "鬚眉" },
-    { "须胡", "鬚鬍" },
-    { "须须", "鬚鬚" },
-    { "须鲨", "鬚鯊" },
-    { "须鲸", "鬚鯨" },
-    { "顼", "頊" },
-    { "顽", "頑" },
-    { "顾", "顧" },
-    { "顿", "頓" },
-    { "颀", "頎" },
-    { "颁", "頒" },
-    { "颂", "頌" },
-    { "颂系", "頌繫" },
-    { "颂赞", "頌讚" },
-    { "颃", "頏" },
-    { "预", "預" },
-    { "预制", "預製" },
-    { "预报不准", "預報不準" },
-    { "颅", "顱" },
-    { "领", "領" },
-    { "领袖欲", "領袖慾" },
-    { "颇", "頗" },
-    { "颈", "頸" },
-    { "颉", "頡" },
-    { "颊", "頰" },
-    { "颊须", "頰鬚" },
-    { "颌", "頜" },
-    { "颍", "潁" },
-    { "颏", "頦" },
-    { "颐", "頤" },
-    { "频", "頻" },
-    { "颓", "頹" },
-    { "颔", "頷" },
-    { "颖", "穎" },
-    { "颗", "顆" },
-    { "题", "題" },
-    { "颚", "顎" },
-    { "颛", "顓" },
-    { "颛顼历", "顓頊曆" },
-    { "颜", "顏" },
-    { "颜范", "顏範" },
-    { "额", "額" },
-    { "额征", "額徵" },
-    { "额我略历", "額我略曆" },
-    { "额我略历史", "額我略歷史" },
-    { "颞", "顳" },
-    { "颟", "顢" },
-    { "颠", "顛" },
-    { "颠干倒坤", "顛乾倒坤" },
-    { "颠颠仆仆", "顛顛仆仆" },
-    { "颡", "顙" },
-    { "颢", "顥" },
-    { "颤", "顫" },
-    { "颤栗", "顫慄" },
-    { "颦", "顰" },
-    { "颧", "顴" },
-    { "风", "風" },
-    { "风刮", "風颳" },
-    { "风卷残云", "風捲殘雲" },
-    { "风后", "風后" },
-    { "风土志", "風土誌" },
-    { "风干", "風乾" },
-    { "风物志", "風物誌" },
-    { "风范", "風範" },
-    { "风起云涌", "風起雲湧" },
-    { "风采", "風采" },
-    { "风里", "風裡" },
-    { "飑", "颮" },
-    { "飒", "颯" },
-    { "飓", "颶" },
-    { "飕", "颼" },
-    { "飘", "飄" },
-    { "飘发自由女神", "飄髮自由女神" },
-    { "飘游", "飄遊" },
-    { "飘荡", "飄蕩" },
-    { "飘飘荡荡", "飄飄蕩蕩" },
-    { "飙", "飆" },
-    { "飞", "飛" },
-    { "飞刍挽粟", "飛芻輓粟" },
-    { "飞扎", "飛紮" },
-    { "飞行钟", "飛行鐘" },
-    { "食欲", "食慾" },
-    { "食面", "食麵" },
-    { "飨", "饗" },
-    { "餍", "饜" },
-    { "餐台", "餐檯" },
-    { "饥", "飢" },
-    { "饥寒", "饑寒" },
-    { "饥民", "饑民" },
-    { "饥渴", "饑渴" },
-    { "饥溺", "饑溺" },
-    { "饥荒", "饑荒" },
-    { "饥饱", "饑飽" },
-    { "饥馑", "饑饉" },
-    { "饧", "餳" },
-    { "饨", "飩" },
-    { "饩", "餼" },
-    { "饪", "飪" },
-    { "饫", "飫" },
-    { "饬", "飭" },
-    { "饭", "飯" },
-    { "饭后钟", "飯後鐘" },
-    { "饭团", "飯糰" },
-    { "饮", "飲" },
-    { "饯", "餞" },
-    { "饰", "飾" },
-    { "饱", "飽" },
-    { "饲", "飼" },
-    { "饴", "飴" },
-    { "饵", "餌" },
-    { "饶", "饒" },
-    { "饷", "餉" },
-    { "饺", "餃" },
-    { "饼", "餅" },
-    { "饼干", "餅乾" },
-    { "饽", "餑" },
-    { "饿", "餓" },
-    { "馀", "餘" },
-    { "馁", "餒" },
-    { "馄", "餛" },
-    { "馄饨面", "餛飩麵" },
-    { "馅", "餡" },
-    { "馆", "館" },
-    { "馆谷", "館穀" },
-    { "馆里", "館裡" },
-    { "馈", "饋" },
-    { "馊", "餿" },
-    { "馋", "饞" },
-    { "馍", "饃" },
-    { "馏", "餾" },
-    { "馐", "饈" },
-    { "馑", "饉" },
-    { "馒", "饅" },
-    { "馔", "饌" },
-    { "首出电影", "首齣電影" },
-    { "首发", "首發" },
-    { "首只", "首隻" },
-    { "首当其冲", "首當其衝" },
-    { "香干", "香乾" },
-    { "马", "馬" },
-    { "马干", "馬乾" },
-    { "马德钟", "馬德鐘" },
-    { "马斯垂克期", "馬斯垂克期" },
-    { "马格里布", "馬格里布" },
-    { "驭", "馭" },
-    { "驮", "馱" },
-    { "驯", "馴" },
-    { "驰", "馳" },
-    { "驱", "驅" },
-    { "驳", "駁" },
-    { "驴", "驢" },
-    { "驵", "駔" },
-    { "驶", "駛" },
-    { "驷", "駟" },
-    { "驸", "駙" },
-    { "驹", "駒" },
-    { "驺", "騶" },
-    { "驻", "駐" },
-    { "驻扎", "駐紮" },
-    { "驼", "駝" },
-    { "驽", "駑" },
-    { "驾", "駕" },
-    { "驿", "驛" },
-    { "骀", "駘" },
-    { "骀荡", "駘蕩" },
-    { "骁", "驍" },
-    { "骂", "罵" },
-    { "骄", "驕" },
-    { "骅", "驊" },
-    { "骆", "駱" },
-    { "骇", "駭" },
-    { "骈", "駢" },
-    { "骊", "驪" },
-    { "骋", "騁" },
-    { "验", "驗" },
-    { "骏", "駿" },
-    { "骐", "騏" },
-    { "骑", "騎" },
-    { "骒", "騍" },
-    { "骓", "騅" },
-    { "骖", "驂" },
-    { "骗", "騙" },
-    { "骘", "騭" },
-    { "骚", "騷" },
-    { "骛", "騖" },
-    { "骜", "驁" },
-    { "骝", "騮" },
-    { "骞", "騫" },
-    { "骟", "騸" },
-    { "骠", "驃" },
-    { "骡", "騾" },
-    { "骢", "驄" },
-    { "骣", "驏" },
-    { "骤", "驟" },
-    { "骥", "驥" },
-    { "骧", "驤" },
-    { "骨坛", "骨罈" },
-    { "骨干", "骨幹" },
-    { "骨灰坛", "骨灰罈" },
-    { "髅", "髏" },
-    { "髋", "髖" },
-    { "髌", "髕" },
-    { "高干", "高幹" },
-    { "高干扰", "高干擾" },
-    { "高干预", "高干預" },
-    { "髡发", "髡髮" },
-    { "髭胡", "髭鬍" },
-    { "髭须", "髭鬚" },
-    { "髯胡", "髯鬍" },
-    { "髼松", "髼鬆" },
-    { "鬅松", "鬅鬆" },
-    { "鬈发", "鬈髮" },
-    { "鬒发", "鬒髮" },
-    { "鬓", "鬢" },
-    { "鬓发", "鬢髮" },
-    { "鬼气冲天", "鬼氣衝天" },
-    { "魂牵梦系", "魂牽夢繫" },
-    { "魇", "魘" },
-    { "魉", "魎" },
-    { "魏征", "魏徵" },
-    { "魔表", "魔錶" },
-    { "鱼", "魚" },
-    { "鱼干", "魚乾" },
-    { "鱼松", "魚鬆" },
-    { "鱿", "魷" },
-    { "鲁", "魯" },
-    { "鲂", "魴" },
-    { "鲆", "鮃" },
-    { "鲇", "鯰" },
-    { "鲈", "鱸" },
-    { "鲋", "鮒" },
-    { "鲍", "鮑" },
-    { "鲎", "鱟" },
-    { "鲐", "鮐" },
-    { "鲑", "鮭" },
-    { "鲒", "鮚" },
-    { "鲔", "鮪" },
-    { "鲕", "鮞" },
-    { "鲚", "鱭" },
-    { "鲛", "鮫" },
-    { "鲜", "鮮" },
-    { "鲜于", "鮮于" },
-    { "鲞", "鯗" },
-    { "鲟", "鱘" },
-    { "鲠", "鯁" },
-    { "鲡", "鱺" },
-    { "鲢", "鰱" },
-    { "鲣", "鰹" },
-    { "鲤", "鯉" },
-    { "鲥", "鰣" },
-    { "鲦", "鰷" },
-    { "鲧", "鯀" },
-    { "鲨", "鯊" },
-    { "鲩", "鯇" },
-    { "鲫", "鯽" },
-    { "鲭", "鯖" },
-    { "鲮", "鯪" },
-    { "鲰", "鯫" },
-    { "鲱", "鯡" },
-    { "鲲", "鯤" },
-    { "鲳", "鯧" },
-    { "鲵", "鯢" },
-    { "鲷", "鯛" },
-    { "鲸", "鯨" },
-    { "鲸须", "鯨鬚" },
-    { "鲻", "鯔" },
-    { "鲽", "鰈" },
-    { "鳃", "鰓" },
-    { "鳄", "鱷" },
-    { "鳅", "鰍" },
-    { "鳆", "鰒" },
-    { "鳇", "鰉" },
-    { "鳌", "鰲" },
-    { "鳍", "鰭" },
-    { "鳎", "鰨" },
-    { "鳏", "鰥" },
-    { "鳐", "鰩" },
-    { "鳓", "鰳" },
-    { "鳔", "鰾" },
-    { "鳕", "鱈" },
-    { "鳖", "鱉" },
-    { "鳗", "鰻" },
-    { "鳜", "鱖" },
-    { "鳝", "鱔" },
-    { "鳞", "鱗" },
-    { "鳟", "鱒" },
-    { "鳢", "鱧" },
-    { "鸟", "鳥" },
-    { "鸟栖市", "鳥栖市" },
-    { "鸠", "鳩" },
-    { "鸡", "雞" },
-    { "鸡丝", "雞絲" },
-    { "鸡丝面", "雞絲麵" },
-    { "鸡争鹅斗", "雞爭鵝鬥" },
-    { "鸡只", "雞隻" },
-    { "鸡吵鹅斗", "雞吵鵝鬥" },
-    { "鸡奸", "雞姦" },
-    { "鸡腿面", "雞腿麵" },
-    { "鸡蛋里挑骨头", "雞蛋裡挑骨頭" },
-    { "鸢", "鳶" },
-    { "鸣", "鳴" },
-    { "鸣钟", "鳴鐘" },
-    { "鸥", "鷗" },
-    { "鸦", "鴉" },
-    { "鸨", "鴇" },
-    { "鸩", "鴆" },
-    { "鸪", "鴣" },
-    { "鸫", "鶇" },
-    { "鸬", "鸕" },
-    { "鸭", "鴨" },
-    { "鸯", "鴦" },
-    { "鸱", "鴟" },
-    { "鸲", "鴝" },
-    { "鸳", "鴛" },
-    { "鸵", "鴕" },
-    { "鸶", "鷥" },
-    { "鸷", "鷙" },
-    { "鸸", "鴯" },
-    { "鸹", "鴰" },
-    { "鸺", "鵂" },
-    { "鸽", "鴿" },
-    { "鸾", "鸞" },
-    { "鸾鉴", "鸞鑑" },
-    { "鸿", "鴻" },
-    { "鸿范", "鴻範" },
-    { "鹁", "鵓" },
-    { "鹂", "鸝" },
-    { "鹃", "鵑" },
-    { "鹄", "鵠" },
-    { "鹄发", "鵠髮" },
-    { "鹅", "鵝" },
-    { "鹅准", "鵝準" },
-    { "鹆", "鵒" },
-    { "鹇", "鷳" },
-    { "鹈", "鵜" },
-    { "鹉", "鵡" },
-    { "鹊", "鵲" },
-    { "鹌", "鵪" },
-    { "鹎", "鵯" },
-    { "鹏", "鵬" },
-    { "鹑", "鶉" },
-    { "鹕", "鶘" },
-    { "鹗", "鶚" },
-    { "鹘", "鶻" },
-    { "鹚", "鶿" },
-    { "鹜", "鶩" },
-    { "鹞", "鷂" },
-    { "鹣", "鶼" },
-    { "鹤", "鶴" },
-    { "鹤发", "鶴髮" },
-    { "鹤吊", "鶴弔" },
-    { "鹤峰县", "鶴峯縣" },
-    { "鹦", "鸚" },
-    { "鹧", "鷓" },
-    { "鹨", "鷚" },
-    { "鹩", "鷯" },
-    { "鹪", "鷦" },
-    { "鹫", "鷲" },
-    { "鹬", "鷸" },
-    { "鹭", "鷺" },
-    { "鹰", "鷹" },
-    { "鹰雕", "鹰鵰" },
-    { "鹳", "鸛" },
-    { "鹾", "鹺" },
-    { "麟游", "麟遊" },
-    { "麦", "麥" },
-    { "麸", "麩" },
-    { "麹", "麴" },
-    { "麹霉", "麴黴" },
-    { "麻将席", "麻將蓆" },
-    { "麻酱面", "麻醬麵" },
-    { "黄", "黃" },
-    { "黄历", "黃曆" },
-    { "黄历史", "黃歷史" },
-    { "黄发", "黃髮" },
-    { "黄岩区", "黃巖區" },
-    { "黄岩县", "黃巖縣" },
-    { "黄干黑瘦", "黃乾黑瘦" },
-    { "黄曲毒素", "黃麴毒素" },
-    { "黄杰", "黃杰" },
-    { "黄白术", "黃白術" },
-    { "黄诗杰", "黃詩杰" },
-    { "黄金表", "黃金表" },
-    { "黄钟", "黃鐘" },
-    { "黄钰筑", "黃鈺筑" },
-    { "黉", "黌" },
-    { "黎吉云", "黎吉雲" },
-    { "黑发", "黑髮" },
-    { "黑奴吁天录", "黑奴籲天錄" },
-    { "黑干将", "黑幹將" },
-    { "黑长发", "黑長髮" },
-    { "黩", "黷" },
-    { "黪", "黲" },
-    { "黾", "黽" },
-    { "鼋", "黿" },
-    { "鼍", "鼉" },
-    { "鼓噪", "鼓譟" },
-    { "鼓里", "鼓裡" },
-    { "鼗", "鞀" },
-    { "鼠曲草", "鼠麴草" },
-    { "鼹", "鼴" },
-    { "鼻准", "鼻準" },
-    { "鼻梁", "鼻樑" },
-    { "鼻梁儿", "鼻梁兒" },
-    { "齐", "齊" },
-    { "齐王舍牛", "齊王捨牛" },
-    { "齑", "齏" },
-    { "齿", "齒" },
-    { "齿危发秀", "齒危髮秀" },
-    { "齿发", "齒髮" },
-    { "齿落发白", "齒落髮白" },
-    { "龀", "齔" },
-    { "龃", "齟" },
-    { "龄", "齡" },
-    { "龅", "齙" },
-    { "龆", "齠" },
-    { "龇", "齜" },
-    { "龈", "齦" },
-    { "龉", "齬" },
-    { "龊", "齪" },
-    { "龋", "齲" },
-    { "龌", "齷" },
-    { "龙", "龍" },
-    { "龙卷", "龍捲" },
-    { "龙岩", "龍巖" },
-    { "龙斗虎伤", "龍鬥虎傷" },
-    { "龙眼干", "龍眼乾" },
-    { "龙须", "龍鬚" },
-    { "龙须面", "龍鬚麵" },
-    { "龚", "龔" },
-    { "龛", "龕" },
-    { "龟", "龜" },
-    { "龟鉴", "龜鑑" },
+static const gchar simp_to_trad_strings[] =
+"〇余\0"
+"〇餘\0"
+"〇只\0"
+"〇隻\0"
+"〇周后\0"
+"〇周後\0"
+"一个\0"
+"一個\0"
+"一个准\0"
+"一個準\0"
+"一争两丑\0"
+"一爭兩醜\0"
+"一伙\0"
+"一夥\0"
+"一伙头\0"
+"一伙頭\0"
+"一余\0"
+"一餘\0"
+"一冲\0"
+"一衝\0"
+"一准\0"
+"一準\0"
+"一出剧\0"
+"一齣劇\0"
+"一出喜剧\0"
+"一齣喜劇\0"
+"一出好戏\0"
+"一齣好戲\0"
+"一出子\0"
+"一齣子\0"
+"一出悲剧\0"
+"一齣悲劇\0"
+"一出戏\0"
+"一齣戲\0"
+"一出电影\0"
+"一齣電影\0"
+"一厘一毫\0"
+"一釐一毫\0"
+"一发千钧\0"
+"一髮千鈞\0"
+"一只\0"
+"一隻\0"
+"一吊钱\0"
+"一吊錢\0"
+"一周后\0"
+"一周後\0"
+"一哄而散\0"
+"一鬨而散\0"
+"一地里\0"
+"一地裡\0"
+"一天后\0"
+"一天後\0"
+"一天钟\0"
+"一天鐘\0"
+"一干二净\0"
+"一乾二淨\0"
+"一并\0"
+"一併\0"
+"一扎\0"
+"一紮\0"
+"一树百获\0"
+"一樹百穫\0"
+"一物克一物\0"
+"一物剋一物\0"
+"一碗面\0"
+"一碗麵\0"
+"一锅面\0"
+"一鍋麵\0"
+"丁丁当当\0"
+"丁丁當當\0"
+"七个\0"
+"七個\0"
+"七余\0"
+"七餘\0"
+"七只\0"
+"七隻\0"
+"七周后\0"
+"七周後\0"
+"七天后\0"
+"七天後\0"
+"七情六欲\0"
+"七情六慾\0"
+"七扎\0"
+"七紮\0"
+"万\0"
+"萬\0"
+"万一只\0"
+"萬一只\0"
+"万个\0"
+"萬個\0"
+"万余\0"
+"萬餘\0"
+"万历\0"
+"萬曆\0"
+"万历史\0"
+"萬歷史\0"
+"万只\0"
+"萬隻\0"
+"万周后\0"
+"萬周後\0"
+"万天后\0"
+"萬天後\0"
+"万年历表\0"
+"萬年曆錶\0"
+"万扎\0"
+"萬紮\0"
+"万签插架\0"
+"萬籤插架\0"
+"万象\0"
+"萬象\0"
+"三个\0"
+"三個\0"
+"三余\0"
+"三餘\0"
+"三准\0"
+"三準\0"
+"三出戏\0"
+"三齣戲\0"
+"三只\0"
+"三隻\0"
+"三周后\0"
+"三周後\0"
+"三天后\0"
+"三天後\0"
+"三征七辟\0"
+"三徵七辟\0"
+"三扎\0"
+"三紮\0"
+"三统历\0"
+"三統曆\0"
+"三统历史\0"
+"三統歷史\0"
+"上台面\0"
+"上檯面\0"
+"上梁\0"
+"上樑\0"
+"上签\0"
+"上籤\0"
+"上签了\0"
+"上簽了\0"
+"上签写\0"
+"上簽寫\0"
+"上签发\0"
+"上簽發\0"
+"上签名\0"
+"上簽名\0"
+"上签字\0"
+"上簽字\0"
+"上签定\0"
+"上簽定\0"
+"上签收\0"
+"上簽收\0"
+"上签约\0"
+"上簽約\0"
+"上签署\0"
+"上簽署\0"
+"上签订\0"
+"上簽訂\0"
+"上签证\0"
+"上簽證\0"
+"上系上\0"
+"上繫上\0"
+"上课钟\0"
+"上課鐘\0"
+"下文里\0"
+"下文裡\0"
+"下梁\0"
+"下樑\0"
+"下签\0"
+"下籤\0"
+"下签了\0"
+"下簽了\0"
+"下签写\0"
+"下簽寫\0"
+"下签发\0"
+"下簽發\0"
+"下签名\0"
+"下簽名\0"
+"下签字\0"
+"下簽字\0"
+"下签定\0"
+"下簽定\0"
+"下签收\0"
+"下簽收\0"
+"下签约\0"
+"下簽約\0"
+"下签署\0"
+"下簽署\0"
+"下签订\0"
+"下簽訂\0"
+"下签证\0"
+"下簽證\0"
+"下课钟\0"
+"下課鐘\0"
+"不丑\0"
+"不醜\0"
+"不卷\0"
+"不捲\0"
+"不太准\0"
+"不太準\0"
+"不好干预\0"
+"不好干預\0"
+"不嫌母丑\0"
+"不嫌母醜\0"
+"不寒而栗\0"
+"不寒而慄\0"
+"不干不净\0"
+"不乾不淨\0"
+"不干胶\0"
+"不乾膠\0"
+"不托\0"
+"不託\0"
+"不斗\0"
+"不鬥\0"
+"不斗胆\0"
+"不斗膽\0"
+"不断发\0"
+"不斷發\0"
+"不谷\0"
+"不穀\0"
+"不负所托\0"
+"不負所托\0"
+"不通吊庆\0"
+"不通弔慶\0"
+"不采\0"
+"不採\0"
+"不采声\0"
+"不采聲\0"
+"不锈钢\0"
+"不鏽鋼\0"
+"不食干腊\0"
+"不食乾腊\0"
+"与\0"
+"與\0"
+"丑丑\0"
+"醜醜\0"
+"丑丫头\0"
+"醜丫頭\0"
+"丑事\0"
+"醜事\0"
+"丑人\0"
+"醜人\0"
+"丑侪\0"
+"醜儕\0"
+"丑八怪\0"
+"醜八怪\0"
+"丑剌剌\0"
+"醜剌剌\0"
+"丑剧\0"
+"醜劇\0"
+"丑化\0"
+"醜化\0"
+"丑史\0"
+"醜史\0"
+"丑名\0"
+"醜名\0"
+"丑吒\0"
+"醜吒\0"
+"丑地\0"
+"醜地\0"
+"丑声\0"
+"醜聲\0"
+"丑声远播\0"
+"醜聲遠播\0"
+"丑头怪脸\0"
+"醜頭怪臉\0"
+"丑夷\0"
+"醜夷\0"
+"丑女\0"
+"醜女\0"
+"丑女效颦\0"
+"醜女效顰\0"
+"丑奴儿\0"
+"醜奴兒\0"
+"丑妇\0"
+"醜婦\0"
+"丑媳\0"
+"醜媳\0"
+"丑媳妇\0"
+"醜媳婦\0"
+"丑小鸭\0"
+"醜小鴨\0"
+"丑巴怪\0"
+"醜巴怪\0"
+"丑徒\0"
+"醜徒\0"
+"丑态\0"
+"醜態\0"
+"丑恶\0"
+"醜惡\0"
+"丑时\0"
+"丑時\0"
+"丑末\0"
+"醜末\0"
+"丑杂\0"
+"醜雜\0"
+"丑样\0"
+"醜樣\0"
+"丑死\0"
+"醜死\0"
+"丑比\0"
+"醜比\0"
+"丑毙了\0"
+"醜斃了\0"
+"丑沮\0"
+"醜沮\0"
+"丑男\0"
+"醜男\0"
+"丑类\0"
+"醜類\0"
+"丑脸\0"
+"醜臉\0"
+"丑虏\0"
+"醜虜\0"
+"丑行\0"
+"醜行\0"
+"丑言\0"
+"醜言\0"
+"丑诋\0"
+"醜詆\0"
+"丑话\0"
+"醜話\0"
+"丑语\0"
+"醜語\0"
+"丑贼生\0"
+"醜賊生\0"
+"丑辞\0"
+"醜辭\0"
+"丑辱\0"
+"醜辱\0"
+"丑逆\0"
+"醜逆\0"
+"丑闻\0"
+"醜聞\0"
+"丑陋\0"
+"醜陋\0"
+"专\0"
+"專\0"
+"专辑里\0"
+"專輯裡\0"
+"世界杯\0"
+"世界盃\0"
+"世纪里\0"
+"世紀裡\0"
+"世纪钟\0"
+"世紀鐘\0"
+"世纪钟表\0"
+"世紀鐘錶\0"
+"业\0"
+"業\0"
+"业余\0"
+"業餘\0"
+"丛\0"
+"叢\0"
+"丛林里\0"
+"叢林裡\0"
+"东\0"
+"東\0"
+"东冲西突\0"
+"東衝西突\0"
+"东周钟\0"
+"東周鐘\0"
+"东岳\0"
+"東嶽\0"
+"东游\0"
+"東遊\0"
+"丝\0"
+"絲\0"
+"丝制\0"
+"絲製\0"
+"丝发\0"
+"絲髮\0"
+"丝恩发怨\0"
+"絲恩髮怨\0"
+"丢\0"
+"丟\0"
+"丢丑\0"
+"丟醜\0"
+"两\0"
+"兩\0"
+"两个\0"
+"兩個\0"
+"两余\0"
+"兩餘\0"
+"两出\0"
+"兩齣\0"
+"两只\0"
+"兩隻\0"
+"两周后\0"
+"兩周後\0"
+"两天后\0"
+"兩天後\0"
+"两扎\0"
+"兩紮\0"
+"两杆\0"
+"兩桿\0"
+"两虎共斗\0"
+"兩虎共鬥\0"
+"两鼠斗穴\0"
+"兩鼠鬥穴\0"
+"严\0"
+"嚴\0"
+"严云农\0"
+"嚴云農\0"
+"丧\0"
+"喪\0"
+"丧钟\0"
+"喪鐘\0"
+"个\0"
+"個\0"
+"个中原因\0"
+"箇中原因\0"
+"个中奥\0"
+"箇中奧\0"
+"个中好手\0"
+"箇中好手\0"
+"个中强手\0"
+"箇中強手\0"
+"个中滋味\0"
+"箇中滋味\0"
+"个中玄机\0"
+"箇中玄機\0"
+"个中理由\0"
+"箇中理由\0"
+"个中翘楚\0"
+"箇中翹楚\0"
+"个中道理\0"
+"箇中道理\0"
+"个中高手\0"
+"箇中高手\0"
+"个旧市\0"
+"箇舊市\0"
+"个月里\0"
+"個月裡\0"
+"个里\0"
+"個裡\0"
+"个钟\0"
+"個鐘\0"
+"个钟表\0"
+"個鐘錶\0"
+"中型钟\0"
+"中型鐘\0"
+"中型钟表\0"
+"中型鐘錶\0"
+"中型钟表面\0"
+"中型鐘表面\0"
+"中型钟面\0"
+"中型鐘面\0"
+"中岳\0"
+"中嶽\0"
+"中文里\0"
+"中文裡\0"
+"中断发\0"
+"中斷發\0"
+"中签\0"
+"中籤\0"
+"中签了\0"
+"中簽了\0"
+"中签写\0"
+"中簽寫\0"
+"中签发\0"
+"中簽發\0"
+"中签名\0"
+"中簽名\0"
+"中签字\0"
+"中簽字\0"
+"中签定\0"
+"中簽定\0"
+"中签收\0"
+"中簽收\0"
+"中签约\0"
+"中簽約\0"
+"中签署\0"
+"中簽署\0"
+"中签订\0"
+"中簽訂\0"
+"中签证\0"
+"中簽證\0"
+"中风后\0"
+"中風後\0"
+"丰\0"
+"豐\0"
+"丰仪\0"
+"丰儀\0"
+"丰台\0"
+"豐臺\0"
+"丰度\0"
+"豐度\0"
+"丰标\0"
+"丰標\0"
+"丰标不凡\0"
+"丰標不凡\0"
+"丰滨\0"
+"豐濱\0"
+"丰滨乡\0"
+"豐濱鄉\0"
+"丰韵\0"
+"丰韻\0"
+"临\0"
+"臨\0"
+"临潼斗宝\0"
+"臨潼鬥寶\0"
+"丹棱\0"
+"丹稜\0"
+"为\0"
+"為\0"
+"为准\0"
+"為準\0"
+"为鉴\0"
+"為鑑\0"
+"主仆\0"
+"主僕\0"
+"主干\0"
+"主幹\0"
+"主钟差\0"
+"主鐘差\0"
+"主钟曲线\0"
+"主鐘曲線\0"
+"丽\0"
+"麗\0"
+"举\0"
+"舉\0"
+"举手表\0"
+"舉手表\0"
+"乃系\0"
+"乃係\0"
+"么\0"
+"麼\0"
+"义\0"
+"義\0"
+"义仆\0"
+"義僕\0"
+"之余\0"
+"之餘\0"
+"之征\0"
+"之徵\0"
+"之托\0"
+"之託\0"
+"之鉴\0"
+"之鑑\0"
+"之钟\0"
+"之鐘\0"
+"乌\0"
+"烏\0"
+"乌兹冲锋枪\0"
+"烏茲衝鋒槍\0"
+"乌发\0"
+"烏髮\0"
+"乌苏里\0"
+"烏蘇里\0"
+"乌龙面\0"
+"烏龍麵\0"
+"乐\0"
+"樂\0"
+"乐器钟\0"
+"樂器鐘\0"
+"乐游原\0"
+"樂遊原\0"
+"乔\0"
+"喬\0"
+"乔岳\0"
+"喬嶽\0"
+"九世之仇\0"
+"九世之讎\0"
+"九个\0"
+"九個\0"
+"九余\0"
+"九餘\0"
+"九只\0"
+"九隻\0"
+"九周后\0"
+"九周後\0"
+"九天后\0"
+"九天後\0"
+"九扎\0"
+"九紮\0"
+"九谷\0"
+"九穀\0"
+"习\0"
+"習\0"
+"乡\0"
+"鄉\0"
+"乡愿\0"
+"鄉愿\0"
+"书\0"
+"書\0"
+"书签\0"
+"書籤\0"
+"书面\0"
+"書面\0"
+"买\0"
+"買\0"
+"买凶\0"
+"買兇\0"
+"买断发\0"
+"買斷發\0"
+"乱\0"
+"亂\0"
+"乱发\0"
+"亂髮\0"
+"乱发生\0"
+"亂發生\0"
+"乱发脾气\0"
+"亂發脾氣\0"
+"乱哄哄\0"
+"亂鬨鬨\0"
+"乱斗\0"
+"亂鬥\0"
+"乾象历\0"
+"乾象曆\0"
+"了望\0"
+"瞭望\0"
+"了然\0"
+"瞭然\0"
+"了然后\0"
+"了然後\0"
+"了若指掌\0"
+"瞭若指掌\0"
+"争\0"
+"爭\0"
+"争奇斗妍\0"
+"爭奇鬥妍\0"
+"争奇斗异\0"
+"爭奇鬥異\0"
+"争奇斗艳\0"
+"爭奇鬥豔\0"
+"争妍斗奇\0"
+"爭妍鬥奇\0"
+"争妍斗艳\0"
+"爭妍鬥豔\0"
+"争斗\0"
+"爭鬥\0"
+"争红斗紫\0"
+"爭紅鬥紫\0"
+"事有斗巧\0"
+"事有鬥巧\0"
+"事里\0"
+"事裡\0"
+"二不棱登\0"
+"二不稜登\0"
+"二个\0"
+"二個\0"
+"二余\0"
+"二餘\0"
+"二只\0"
+"二隻\0"
+"二周后\0"
+"二周後\0"
+"二天后\0"
+"二天後\0"
+"二缶钟惑\0"
+"二缶鐘惑\0"
+"二虎相斗\0"
+"二虎相鬥\0"
+"二里头\0"
+"二里頭\0"
+"于\0"
+"於\0"
+"于云鹤\0"
+"于雲鶴\0"
+"于从濂\0"
+"于從濂\0"
+"于会泳\0"
+"于會泳\0"
+"于伟国\0"
+"于偉國\0"
+"于余曲折\0"
+"于餘曲折\0"
+"于光远\0"
+"于光遠\0"
+"于冠华\0"
+"于冠華\0"
+"于凤桐\0"
+"于鳳桐\0"
+"于凤至\0"
+"于鳳至\0"
+"于友泽\0"
+"于友澤\0"
+"于双戈\0"
+"于雙戈\0"
+"于台烟\0"
+"于台煙\0"
+"于和伟\0"
+"于和偉\0"
+"于国桢\0"
+"于國楨\0"
+"于国治\0"
+"于國治\0"
+"于坚\0"
+"于堅\0"
+"于大宝\0"
+"于大寶\0"
+"于天龙\0"
+"于天龍\0"
+"于奇库杜克\0"
+"于奇庫杜克\0"
+"于学忠\0"
+"于學忠\0"
+"于宝轩\0"
+"于寶軒\0"
+"于小伟\0"
+"于小偉\0"
+"于尔岑\0"
+"于爾岑\0"
+"于尔根\0"
+"于爾根\0"
+"于尔里克\0"
+"于爾里克\0"
+"于山东\0"
+"於山東\0"
+"于山国\0"
+"于山國\0"
+"于山西\0"
+"於山西\0"
+"于帅\0"
+"于帥\0"
+"于幼军\0"
+"于幼軍\0"
+"于广洲\0"
+"于廣洲\0"
+"于建嵘\0"
+"于建嶸\0"
+"于归\0"
+"于歸\0"
+"于志宁\0"
+"于志寧\0"
+"于忠肃集\0"
+"于忠肅集\0"
+"于成龙\0"
+"于成龍\0"
+"于斯达尔\0"
+"于斯達爾\0"
+"于明涛\0"
+"于明濤\0"
+"于来山\0"
+"于來山\0"
+"于枫\0"
+"于楓\0"
+"于树洁\0"
+"于樹潔\0"
+"于根伟\0"
+"于根偉\0"
+"于汉超\0"
+"于漢超\0"
+"于泽尔\0"
+"于澤爾\0"
+"于洪区\0"
+"于洪區\0"
+"于海上\0"
+"於海上\0"
+"于海拔\0"
+"於海拔\0"
+"于海边\0"
+"於海邊\0"
+"于涛\0"
+"于濤\0"
+"于湘兰\0"
+"于湘蘭\0"
+"于荣光\0"
+"于榮光\0"
+"于荫霖\0"
+"于蔭霖\0"
+"于谦\0"
+"于謙\0"
+"于谨\0"
+"于謹\0"
+"于贝尔\0"
+"于貝爾\0"
+"于赠\0"
+"于贈\0"
+"于远伟\0"
+"于遠偉\0"
+"于都县\0"
+"于都縣\0"
+"于阗\0"
+"于闐\0"
+"于震中\0"
+"於震中\0"
+"于震前\0"
+"於震前\0"
+"于震后\0"
+"於震後\0"
+"于震环\0"
+"于震環\0"
+"于非暗\0"
+"于非闇\0"
+"于韦斯屈莱\0"
+"于韋斯屈萊\0"
+"于风政\0"
+"于風政\0"
+"于飞\0"
+"于飛\0"
+"于默奥\0"
+"于默奧\0"
+"亏\0"
+"虧\0"
+"云\0"
+"雲\0"
+"云为\0"
+"云為\0"
+"云南个旧\0"
+"雲南箇舊\0"
+"云吞\0"
+"雲吞\0"
+"云吞面\0"
+"雲吞麵\0"
+"云尔\0"
+"云爾\0"
+"云游\0"
+"雲遊\0"
+"云笈七签\0"
+"雲笈七籤\0"
+"云里雾里\0"
+"雲裡霧裡\0"
+"云须\0"
+"雲鬚\0"
+"五个\0"
+"五個\0"
+"五余\0"
+"五餘\0"
+"五只\0"
+"五隻\0"
+"五周后\0"
+"五周後\0"
+"五天后\0"
+"五天後\0"
+"五岳\0"
+"五嶽\0"
+"五峰县\0"
+"五峯縣\0"
+"五扎\0"
+"五紮\0"
+"五脏\0"
+"五臟\0"
+"五行生克\0"
+"五行生剋\0"
+"五谷\0"
+"五穀\0"
+"井干\0"
+"井幹\0"
+"井里\0"
+"井裡\0"
+"亚\0"
+"亞\0"
+"交哄\0"
+"交鬨\0"
+"交托\0"
+"交託\0"
+"交游\0"
+"交遊\0"
+"产\0"
+"產\0"
+"亩\0"
+"畝\0"
+"京沈\0"
+"京瀋\0"
+"亮丑\0"
+"亮醜\0"
+"亮钟\0"
+"亮鐘\0"
+"亲\0"
+"親\0"
+"亵\0"
+"褻\0"
+"人发指\0"
+"人髮指\0"
+"人干的\0"
+"人幹的\0"
+"人数只\0"
+"人數只\0"
+"人数里\0"
+"人數裡\0"
+"人欲\0"
+"人慾\0"
+"人物志\0"
+"人物誌\0"
+"亿\0"
+"億\0"
+"亿个\0"
+"億個\0"
+"亿余\0"
+"億餘\0"
+"亿只\0"
+"億隻\0"
+"亿周后\0"
+"億周後\0"
+"亿天后\0"
+"億天後\0"
+"什锦面\0"
+"什錦麵\0"
+"仁贵\0"
+"仁貴\0"
+"仅\0"
+"僅\0"
+"仅余\0"
+"僅餘\0"
+"仆人\0"
+"僕人\0"
+"仆仆\0"
+"僕僕\0"
+"仆从\0"
+"僕從\0"
+"仆使\0"
+"僕使\0"
+"仆僮\0"
+"僕僮\0"
+"仆吏\0"
+"僕吏\0"
+"仆固怀恩\0"
+"僕固懷恩\0"
+"仆夫\0"
+"僕夫\0"
+"仆妇\0"
+"僕婦\0"
+"仆姑\0"
+"僕姑\0"
+"仆婢\0"
+"僕婢\0"
+"仆射\0"
+"僕射\0"
+"仆少\0"
+"僕少\0"
+"仆役\0"
+"僕役\0"
+"仆憎\0"
+"僕憎\0"
+"仆欧\0"
+"僕歐\0"
+"仆程\0"
+"僕程\0"
+"仆虽罢驽\0"
+"僕雖罷駑\0"
+"仇隙\0"
+"讎隙\0"
+"介胄\0"
+"介冑\0"
+"从\0"
+"從\0"
+"从仆\0"
+"從僕\0"
+"从图里\0"
+"從圖裡\0"
+"从山里\0"
+"從山裡\0"
+"从里到外\0"
+"從裡到外\0"
+"从里向外\0"
+"從裡向外\0"
+"仑\0"
+"侖\0"
+"仓\0"
+"倉\0"
+"他干的\0"
+"他幹的\0"
+"付托\0"
+"付託\0"
+"仙游\0"
+"仙遊\0"
+"代数里\0"
+"代數裡\0"
+"代理发行\0"
+"代理發行\0"
+"代码表\0"
+"代碼表\0"
+"仪\0"
+"儀\0"
+"仪范\0"
+"儀範\0"
+"们\0"
+"們\0"
+"们干的\0"
+"們幹的\0"
+"件钟\0"
+"件鐘\0"
+"价\0"
+"價\0"
+"任何钟\0"
+"任何鐘\0"
+"任何钟表\0"
+"任何鐘錶\0"
+"仿制\0"
+"仿製\0"
+"伊东怜\0"
+"伊東怜\0"
+"伊尔汗历表\0"
+"伊爾汗曆表\0"
+"伊府面\0"
+"伊府麵\0"
+"伊斯兰历\0"
+"伊斯蘭曆\0"
+"伊斯兰历史\0"
+"伊斯蘭歷史\0"
+"伊斯兰教历\0"
+"伊斯蘭教曆\0"
+"伊斯兰教历史\0"
+"伊斯蘭教歷史\0"
+"伊达里子\0"
+"伊達里子\0"
+"伊适杰\0"
+"伊適杰\0"
+"伊郁\0"
+"伊鬱\0"
+"伐罪吊民\0"
+"伐罪弔民\0"
+"休征\0"
+"休徵\0"
+"众\0"
+"眾\0"
+"优\0"
+"優\0"
+"优游\0"
+"優遊\0"
+"伙众\0"
+"夥眾\0"
+"伙伴\0"
+"夥伴\0"
+"伙友\0"
+"夥友\0"
+"伙同\0"
+"夥同\0"
+"伙头\0"
+"伙頭\0"
+"伙计\0"
+"夥計\0"
+"会\0"
+"會\0"
+"会吊\0"
+"會弔\0"
+"会干\0"
+"會幹\0"
+"会干扰\0"
+"會干擾\0"
+"会里\0"
+"會裡\0"
+"伛\0"
+"傴\0"
+"伞\0"
+"傘\0"
+"伟\0"
+"偉\0"
+"传\0"
+"傳\0"
+"传位于四太子\0"
+"傳位于四太子\0"
+"伤\0"
+"傷\0"
+"伥\0"
+"倀\0"
+"伦\0"
+"倫\0"
+"伧\0"
+"傖\0"
+"伪\0"
+"偽\0"
+"伫\0"
+"佇\0"
+"伴游\0"
+"伴遊\0"
+"位准\0"
+"位準\0"
+"住扎\0"
+"住紮\0"
+"体\0"
+"體\0"
+"体征\0"
+"體徵\0"
+"体系\0"
+"體系\0"
+"体范\0"
+"體範\0"
+"体里\0"
+"體裡\0"
+"余〇\0"
+"餘〇\0"
+"余一\0"
+"餘一\0"
+"余七\0"
+"餘七\0"
+"余三\0"
+"餘三\0"
+"余三胜\0"
+"余三勝\0"
+"余下\0"
+"餘下\0"
+"余业\0"
+"餘業\0"
+"余九\0"
+"餘九\0"
+"余事\0"
+"餘事\0"
+"余二\0"
+"餘二\0"
+"余五\0"
+"餘五\0"
+"余人\0"
+"餘人\0"
+"余众\0"
+"餘眾\0"
+"余俗\0"
+"餘俗\0"
+"余倍\0"
+"餘倍\0"
+"余僇\0"
+"餘僇\0"
+"余光\0"
+"餘光\0"
+"余党\0"
+"餘黨\0"
+"余八\0"
+"餘八\0"
+"余六\0"
+"餘六\0"
+"余兴\0"
+"餘興\0"
+"余刃\0"
+"餘刃\0"
+"余切\0"
+"餘切\0"
+"余利\0"
+"餘利\0"
+"余割\0"
+"餘割\0"
+"余力\0"
+"餘力\0"
+"余力为\0"
+"余力為\0"
+"余勇\0"
+"餘勇\0"
+"余十\0"
+"餘十\0"
+"余味\0"
+"餘味\0"
+"余响\0"
+"餘響\0"
+"余喘\0"
+"餘喘\0"
+"余四\0"
+"餘四\0"
+"余地\0"
+"餘地\0"
+"余墨\0"
+"餘墨\0"
+"余声\0"
+"餘聲\0"
+"余外\0"
+"餘外\0"
+"余妙\0"
+"餘妙\0"
+"余姚\0"
+"餘姚\0"
+"余威\0"
+"餘威\0"
+"余子\0"
+"餘子\0"
+"余存\0"
+"餘存\0"
+"余孽\0"
+"餘孽\0"
+"余干\0"
+"餘干\0"
+"余年\0"
+"餘年\0"
+"余庆\0"
+"餘慶\0"
+"余式\0"
+"餘式\0"
+"余弦\0"
+"餘弦\0"
+"余思\0"
+"餘思\0"
+"余悸\0"
+"餘悸\0"
+"余数\0"
+"餘數\0"
+"余明\0"
+"餘明\0"
+"余映\0"
+"餘映\0"
+"余晖\0"
+"餘暉\0"
+"余暇\0"
+"餘暇\0"
+"余杭\0"
+"餘杭\0"
+"余杯\0"
+"餘杯\0"
+"余桃\0"
+"餘桃\0"
+"余桶\0"
+"餘桶\0"
+"余欢\0"
+"餘歡\0"
+"余款\0"
+"餘款\0"
+"余步\0"
+"餘步\0"
+"余殃\0"
+"餘殃\0"
+"余毒\0"
+"餘毒\0"
+"余气\0"
+"餘氣\0"
+"余江\0"
+"餘江\0"
+"余沥\0"
+"餘瀝\0"
+"余波\0"
+"餘波\0"
+"余泽\0"
+"餘澤\0"
+"余温\0"
+"餘溫\0"
+"余烈\0"
+"餘烈\0"
+"余烬\0"
+"餘燼\0"
+"余热\0"
+"餘熱\0"
+"余珍\0"
+"餘珍\0"
+"余生\0"
+"餘生\0"
+"余留\0"
+"餘留\0"
+"余窍\0"
+"餘竅\0"
+"余粮\0"
+"餘糧\0"
+"余绪\0"
+"餘緒\0"
+"余缺\0"
+"餘缺\0"
+"余罪\0"
+"餘罪\0"
+"余羡\0"
+"餘羨\0"
+"余膏\0"
+"餘膏\0"
+"余荫\0"
+"餘蔭\0"
+"余蓄\0"
+"餘蓄\0"
+"余裕\0"
+"餘裕\0"
+"余角\0"
+"餘角\0"
+"余论\0"
+"餘論\0"
+"余貾\0"
+"餘貾\0"
+"余责\0"
+"餘責\0"
+"余辉\0"
+"餘輝\0"
+"余辜\0"
+"餘辜\0"
+"余部\0"
+"餘部\0"
+"余酲\0"
+"餘酲\0"
+"余量\0"
+"餘量\0"
+"余闰\0"
+"餘閏\0"
+"余闲\0"
+"餘閒\0"
+"余零\0"
+"餘零\0"
+"余震\0"
+"餘震\0"
+"余霞\0"
+"餘霞\0"
+"余音\0"
+"餘音\0"
+"余韵\0"
+"餘韻\0"
+"余项\0"
+"餘項\0"
+"余额\0"
+"餘額\0"
+"余风\0"
+"餘風\0"
+"余食\0"
+"餘食\0"
+"佛罗棱萨\0"
+"佛羅稜薩\0"
+"佛钟\0"
+"佛鐘\0"
+"作准\0"
+"作準\0"
+"作品里\0"
+"作品裡\0"
+"你夸\0"
+"你誇\0"
+"佣\0"
+"傭\0"
+"佣仆\0"
+"傭僕\0"
+"佣钱\0"
+"佣錢\0"
+"佣钿\0"
+"佣鈿\0"
+"佥\0"
+"僉\0"
+"使其斗\0"
+"使其鬥\0"
+"侍仆\0"
+"侍僕\0"
+"依依不舍\0"
+"依依不捨\0"
+"依托\0"
+"依託\0"
+"侠\0"
+"俠\0"
+"侣\0"
+"侶\0"
+"侥\0"
+"僥\0"
+"侥幸\0"
+"僥倖\0"
+"侦\0"
+"偵\0"
+"侧\0"
+"側\0"
+"侨\0"
+"僑\0"
+"侩\0"
+"儈\0"
+"侪\0"
+"儕\0"
+"侬\0"
+"儂\0"
+"侵并\0"
+"侵併\0"
+"保险柜\0"
+"保險柜\0"
+"信托\0"
+"信託\0"
+"信托贸易\0"
+"信托貿易\0"
+"俣\0"
+"俁\0"
+"俦\0"
+"儔\0"
+"俨\0"
+"儼\0"
+"俩\0"
+"倆\0"
+"俪\0"
+"儷\0"
+"俭\0"
+"儉\0"
+"俭仆\0"
+"儉僕\0"
+"俭朴\0"
+"儉樸\0"
+"俭确之教\0"
+"儉确之教\0"
+"修筑前\0"
+"修築前\0"
+"修筑后\0"
+"修築後\0"
+"修胡刀\0"
+"修鬍刀\0"
+"俯冲\0"
+"俯衝\0"
+"候复\0"
+"候覆\0"
+"倚闲\0"
+"倚閑\0"
+"倛丑\0"
+"倛醜\0"
+"借以\0"
+"藉以\0"
+"借助\0"
+"藉助\0"
+"借口\0"
+"藉口\0"
+"借寇兵\0"
+"藉寇兵\0"
+"借手\0"
+"藉手\0"
+"借故\0"
+"藉故\0"
+"借机\0"
+"藉機\0"
+"借此\0"
+"藉此\0"
+"借由\0"
+"藉由\0"
+"借箸代筹\0"
+"藉箸代籌\0"
+"借资\0"
+"藉資\0"
+"借鉴\0"
+"借鑑\0"
+"倦游\0"
+"倦遊\0"
+"债\0"
+"債\0"
+"债累累\0"
+"債纍纍\0"
+"倾\0"
+"傾\0"
+"假发\0"
+"假髮\0"
+"假发票\0"
+"假發票\0"
+"假托\0"
+"假託\0"
+"假里\0"
+"假裡\0"
+"偎干\0"
+"偎乾\0"
+"停停当当\0"
+"停停當當\0"
+"停制\0"
+"停製\0"
+"停征\0"
+"停徵\0"
+"偬\0"
+"傯\0"
+"偻\0"
+"僂\0"
+"偾\0"
+"僨\0"
+"偿\0"
+"償\0"
+"傥\0"
+"儻\0"
+"傧\0"
+"儐\0"
+"储\0"
+"儲\0"
+"傩\0"
+"儺\0"
+"催并\0"
+"催併\0"
+"傲游\0"
+"傲遊\0"
+"傲霜斗雪\0"
+"傲霜鬥雪\0"
+"傻里傻气\0"
+"傻裡傻氣\0"
+"像赞\0"
+"像讚\0"
+"僮仆\0"
+"僮僕\0"
+"僵尸\0"
+"殭屍\0"
+"儒略历\0"
+"儒略曆\0"
+"儒略历史\0"
+"儒略歷史\0"
+"儒略改革历\0"
+"儒略改革曆\0"
+"儒略改革历史\0"
+"儒略改革歷史\0"
+"儿\0"
+"兒\0"
+"兀术\0"
+"兀朮\0"
+"元凶\0"
+"元兇\0"
+"兆个\0"
+"兆個\0"
+"兆余\0"
+"兆餘\0"
+"先采\0"
+"先採\0"
+"光致致\0"
+"光緻緻\0"
+"克剥\0"
+"剋剝\0"
+"克扣\0"
+"剋扣\0"
+"克期\0"
+"剋期\0"
+"克期间\0"
+"克期間\0"
+"克死\0"
+"剋死\0"
+"克薄\0"
+"剋薄\0"
+"免征\0"
+"免徵\0"
+"兑\0"
+"兌\0"
+"兖\0"
+"兗\0"
+"党\0"
+"黨\0"
+"党怀英\0"
+"党懷英\0"
+"党进\0"
+"党進\0"
+"党项\0"
+"党項\0"
+"全干\0"
+"全乾\0"
+"八个\0"
+"八個\0"
+"八余\0"
+"八餘\0"
+"八只\0"
+"八隻\0"
+"八周后\0"
+"八周後\0"
+"八天后\0"
+"八天後\0"
+"八字胡\0"
+"八字鬍\0"
+"八扎\0"
+"八紮\0"
+"公仆\0"
+"公僕\0"
+"公仔面\0"
+"公仔麵\0"
+"公余\0"
+"公餘\0"
+"公历\0"
+"公曆\0"
+"公历史\0"
+"公歷史\0"
+"公孙丑\0"
+"公孫丑\0"
+"公寓里\0"
+"公寓裡\0"
+"公干\0"
+"公幹\0"
+"六个\0"
+"六個\0"
+"六余\0"
+"六餘\0"
+"六冲\0"
+"六衝\0"
+"六只\0"
+"六隻\0"
+"六周后\0"
+"六周後\0"
+"六天后\0"
+"六天後\0"
+"六扎\0"
+"六紮\0"
+"六楼后座\0"
+"六樓后座\0"
+"六谷\0"
+"六穀\0"
+"兰\0"
+"蘭\0"
+"兰溪市\0"
+"蘭谿市\0"
+"共和历\0"
+"共和曆\0"
+"共和历史\0"
+"共和歷史\0"
+"关\0"
+"關\0"
+"关系\0"
+"關係\0"
+"关系列\0"
+"關系列\0"
+"关系所\0"
+"關系所\0"
+"关系科\0"
+"關系科\0"
+"关系统\0"
+"關系統\0"
+"兴\0"
+"興\0"
+"其余\0"
+"其餘\0"
+"典范\0"
+"典範\0"
+"兹\0"
+"茲\0"
+"养\0"
+"養\0"
+"养脏\0"
+"養臟\0"
+"兼并\0"
+"兼併\0"
+"兽\0"
+"獸\0"
+"兽欲\0"
+"獸慾\0"
+"冁\0"
+"囅\0"
+"内\0"
+"內\0"
+"内制\0"
+"內製\0"
+"内哄\0"
+"內鬨\0"
+"内斗\0"
+"內鬥\0"
+"内脏\0"
+"內臟\0"
+"内面包\0"
+"內面包\0"
+"内面包的\0"
+"內面包的\0"
+"冈\0"
+"岡\0"
+"冉有仆\0"
+"冉有僕\0"
+"册\0"
+"冊\0"
+"冗余\0"
+"冗餘\0"
+"写\0"
+"寫\0"
+"写字台\0"
+"寫字檯\0"
+"军\0"
+"軍\0"
+"农\0"
+"農\0"
+"农历\0"
+"農曆\0"
+"农历史\0"
+"農歷史\0"
+"农民历\0"
+"農民曆\0"
+"农民历史\0"
+"農民歷史\0"
+"冤仇\0"
+"冤讎\0"
+"冥蒙\0"
+"冥濛\0"
+"冬冬鼓\0"
+"鼕鼕鼓\0"
+"冬游\0"
+"冬遊\0"
+"冯\0"
+"馮\0"
+"冰山里\0"
+"冰山裡\0"
+"冲\0"
+"沖\0"
+"冲上\0"
+"衝上\0"
+"冲下\0"
+"衝下\0"
+"冲倒\0"
+"衝倒\0"
+"冲克\0"
+"衝剋\0"
+"冲冠\0"
+"衝冠\0"
+"冲冠发怒\0"
+"沖冠髮怒\0"
+"冲决\0"
+"衝決\0"
+"冲出\0"
+"衝出\0"
+"冲击\0"
+"衝擊\0"
+"冲到\0"
+"衝到\0"
+"冲刺\0"
+"衝刺\0"
+"冲力\0"
+"衝力\0"
+"冲动\0"
+"衝動\0"
+"冲劲\0"
+"衝勁\0"
+"冲压\0"
+"衝壓\0"
+"冲去\0"
+"衝去\0"
+"冲口\0"
+"衝口\0"
+"冲坚陷阵\0"
+"衝堅陷陣\0"
+"冲垮\0"
+"衝垮\0"
+"冲堂\0"
+"衝堂\0"
+"冲天\0"
+"沖天\0"
+"冲天炮\0"
+"衝天炮\0"
+"冲头阵\0"
+"衝頭陣\0"
+"冲州撞府\0"
+"衝州撞府\0"
+"冲心\0"
+"衝心\0"
+"冲掉\0"
+"衝掉\0"
+"冲撞\0"
+"衝撞\0"
+"冲散\0"
+"衝散\0"
+"冲杀\0"
+"衝殺\0"
+"冲来\0"
+"衝來\0"
+"冲波\0"
+"衝波\0"
+"冲浪\0"
+"衝浪\0"
+"冲激\0"
+"衝激\0"
+"冲然\0"
+"衝然\0"
+"冲盹\0"
+"衝盹\0"
+"冲着\0"
+"衝着\0"
+"冲破\0"
+"衝破\0"
+"冲程\0"
+"衝程\0"
+"冲突\0"
+"衝突\0"
+"冲线\0"
+"衝線\0"
+"冲要\0"
+"衝要\0"
+"冲起\0"
+"衝起\0"
+"冲车\0"
+"衝車\0"
+"冲过\0"
+"衝過\0"
+"冲进\0"
+"衝進\0"
+"冲量\0"
+"衝量\0"
+"冲锋\0"
+"衝鋒\0"
+"冲锋枪\0"
+"衝鋒鎗\0"
+"冲陷\0"
+"衝陷\0"
+"冲风\0"
+"衝風\0"
+"决\0"
+"決\0"
+"决斗\0"
+"決鬥\0"
+"况\0"
+"況\0"
+"冶游\0"
+"冶遊\0"
+"冷面\0"
+"冷麵\0"
+"冻\0"
+"凍\0"
+"净\0"
+"淨\0"
+"净余\0"
+"淨餘\0"
+"净发\0"
+"淨髮\0"
+"凄\0"
+"淒\0"
+"凄厉\0"
+"悽厲\0"
+"凄怆\0"
+"悽愴\0"
+"凄怨\0"
+"悽怨\0"
+"凄恻\0"
+"悽惻\0"
+"凄惋\0"
+"悽惋\0"
+"凄惨\0"
+"悽慘\0"
+"凄惶\0"
+"悽惶\0"
+"凄戾\0"
+"悽戾\0"
+"凄然\0"
+"悽然\0"
+"凄美\0"
+"悽美\0"
+"凄苦\0"
+"悽苦\0"
+"凄酸\0"
+"悽酸\0"
+"准不准\0"
+"準不準\0"
+"准会\0"
+"準會\0"
+"准例\0"
+"準例\0"
+"准保\0"
+"準保\0"
+"准保护\0"
+"准保護\0"
+"准保释\0"
+"准保釋\0"
+"准儿\0"
+"準兒\0"
+"准军事\0"
+"準軍事\0"
+"准决赛\0"
+"準決賽\0"
+"准分子\0"
+"準分子\0"
+"准则\0"
+"準則\0"
+"准噶尔\0"
+"準噶爾\0"
+"准备\0"
+"準備\0"
+"准头\0"
+"準頭\0"
+"准定\0"
+"準定\0"
+"准平原\0"
+"準平原\0"
+"准度\0"
+"準度\0"
+"准式\0"
+"準式\0"
+"准拟\0"
+"準擬\0"
+"准拿督\0"
+"準拿督\0"
+"准据\0"
+"準據\0"
+"准新娘\0"
+"準新娘\0"
+"准新郎\0"
+"準新郎\0"
+"准时\0"
+"準時\0"
+"准星\0"
+"準星\0"
+"准是\0"
+"準是\0"
+"准点\0"
+"準點\0"
+"准的\0"
+"準的\0"
+"准直\0"
+"準直\0"
+"准确\0"
+"準確\0"
+"准线\0"
+"準線\0"
+"准绳\0"
+"準繩\0"
+"准话\0"
+"準話\0"
+"准谱\0"
+"準譜\0"
+"准货币\0"
+"準貨幣\0"
+"凉\0"
+"涼\0"
+"凉席\0"
+"涼蓆\0"
+"凉面\0"
+"涼麵\0"
+"凌蒙初\0"
+"凌濛初\0"
+"减\0"
+"減\0"
+"凑\0"
+"湊\0"
+"凛\0"
+"凜\0"
+"凝炼\0"
+"凝鍊\0"
+"几\0"
+"幾\0"
+"几个\0"
+"幾個\0"
+"几净窗明\0"
+"几淨窗明\0"
+"几出\0"
+"幾齣\0"
+"几只\0"
+"幾隻\0"
+"几周后\0"
+"幾周後\0"
+"几天后\0"
+"幾天後\0"
+"几进几出\0"
+"幾進幾出\0"
+"凤\0"
+"鳳\0"
+"凤梨干\0"
+"鳳梨乾\0"
+"凫\0"
+"鳧\0"
+"凭\0"
+"憑\0"
+"凭借\0"
+"憑藉\0"
+"凭准\0"
+"憑準\0"
+"凭几\0"
+"憑几\0"
+"凭吊\0"
+"憑弔\0"
+"凭折\0"
+"憑摺\0"
+"凭闲\0"
+"憑閑\0"
+"凯\0"
+"凱\0"
+"凶刀\0"
+"兇刀\0"
+"凶器\0"
+"兇器\0"
+"凶嫌\0"
+"兇嫌\0"
+"凶巴巴\0"
+"兇巴巴\0"
+"凶征\0"
+"凶徵\0"
+"凶徒\0"
+"兇徒\0"
+"凶恶\0"
+"兇惡\0"
+"凶悍\0"
+"兇悍\0"
+"凶手\0"
+"兇手\0"
+"凶杀\0"
+"兇殺\0"
+"凶枪\0"
+"兇槍\0"
+"凶案\0"
+"兇案\0"
+"凶横\0"
+"兇橫\0"
+"凶残\0"
+"兇殘\0"
+"凶犯\0"
+"兇犯\0"
+"凶狠\0"
+"兇狠\0"
+"凶猛\0"
+"兇猛\0"
+"凶疑\0"
+"兇疑\0"
+"凶相\0"
+"兇相\0"
+"凶相毕露\0"
+"凶相畢露\0"
+"凶险\0"
+"兇險\0"
+"出丑\0"
+"出醜\0"
+"出乖弄丑\0"
+"出乖弄醜\0"
+"出乖露丑\0"
+"出乖露醜\0"
+"出游\0"
+"出遊\0"
+"击\0"
+"擊\0"
+"击扑\0"
+"擊扑\0"
+"击钟\0"
+"擊鐘\0"
+"函数里\0"
+"函數裡\0"
+"凿\0"
+"鑿\0"
+"分半钟\0"
+"分半鐘\0"
+"分多钟\0"
+"分多鐘\0"
+"分子云\0"
+"分子雲\0"
+"分子钟\0"
+"分子鐘\0"
+"分钟\0"
+"分鐘\0"
+"分钟里\0"
+"分鐘裡\0"
+"刍\0"
+"芻\0"
+"刑余\0"
+"刑餘\0"
+"划\0"
+"劃\0"
+"划一桨\0"
+"划一槳\0"
+"划不来\0"
+"划不來\0"
+"划为\0"
+"劃為\0"
+"划了一会\0"
+"划了一會\0"
+"划入\0"
+"劃入\0"
+"划动\0"
+"划動\0"
+"划得来\0"
+"划得來\0"
+"划来划去\0"
+"划來划去\0"
+"划桨\0"
+"划槳\0"
+"划着独木舟\0"
+"划着獨木舟\0"
+"划过\0"
+"划過\0"
+"划进\0"
+"划進\0"
+"划龙舟\0"
+"划龍舟\0"
+"划龙船\0"
+"划龍船\0"
+"刘\0"
+"劉\0"
+"刘佳怜\0"
+"劉佳怜\0"
+"刘芸后\0"
+"劉芸后\0"
+"则\0"
+"則\0"
+"刚\0"
+"剛\0"
+"刚干\0"
+"剛乾\0"
+"刚雇\0"
+"剛僱\0"
+"创\0"
+"創\0"
+"创制\0"
+"創製\0"
+"创获\0"
+"創穫\0"
+"删\0"
+"刪\0"
+"判断发\0"
+"判斷發\0"
+"利欲\0"
+"利慾\0"
+"别\0"
+"別\0"
+"别扭\0"
+"彆扭\0"
+"别拗\0"
+"彆拗\0"
+"别气\0"
+"彆氣\0"
+"别辟\0"
+"別闢\0"
+"刭\0"
+"剄\0"
+"刮了\0"
+"颳了\0"
+"刮倒\0"
+"颳倒\0"
+"刮大风\0"
+"颳大風\0"
+"刮得\0"
+"颳得\0"
+"刮胡\0"
+"刮鬍\0"
+"刮走\0"
+"颳走\0"
+"刮起\0"
+"颳起\0"
+"刮起来\0"
+"刮起來\0"
+"刮雪\0"
+"颳雪\0"
+"刮风\0"
+"颳風\0"
+"刮风后\0"
+"颳風後\0"
+"到山里\0"
+"到山裡\0"
+"制件\0"
+"製件\0"
+"制作\0"
+"製作\0"
+"制做\0"
+"製做\0"
+"制冰\0"
+"製冰\0"
+"制冷\0"
+"製冷\0"
+"制冷机\0"
+"制冷機\0"
+"制剂\0"
+"製劑\0"
+"制取\0"
+"製取\0"
+"制品\0"
+"製品\0"
+"制图\0"
+"製圖\0"
+"制备\0"
+"製備\0"
+"制得\0"
+"製得\0"
+"制成\0"
+"製成\0"
+"制毒\0"
+"製毒\0"
+"制法\0"
+"製法\0"
+"制浆\0"
+"製漿\0"
+"制片\0"
+"製片\0"
+"制版\0"
+"製版\0"
+"制盐\0"
+"製鹽\0"
+"制程\0"
+"製程\0"
+"制签\0"
+"制籤\0"
+"制糖\0"
+"製糖\0"
+"制纸\0"
+"製紙\0"
+"制药\0"
+"製藥\0"
+"制衣\0"
+"製衣\0"
+"制表键\0"
+"製表鍵\0"
+"制贩\0"
+"製販\0"
+"制造\0"
+"製造\0"
+"制钟\0"
+"制鐘\0"
+"制革\0"
+"製革\0"
+"制鞋\0"
+"製鞋\0"
+"刹\0"
+"剎\0"
+"刻半钟\0"
+"刻半鐘\0"
+"刻多钟\0"
+"刻多鐘\0"
+"刻钟\0"
+"刻鐘\0"
+"刽\0"
+"劊\0"
+"刿\0"
+"劌\0"
+"剀\0"
+"剴\0"
+"剂\0"
+"劑\0"
+"剃发\0"
+"剃髮\0"
+"剃胡\0"
+"剃鬍\0"
+"剃须\0"
+"剃鬚\0"
+"削发\0"
+"削髮\0"
+"削面\0"
+"削麵\0"
+"剐\0"
+"剮\0"
+"剑\0"
+"劍\0"
+"剖厘\0"
+"剖釐\0"
+"剥\0"
+"剝\0"
+"剥制\0"
+"剝製\0"
+"剧\0"
+"劇\0"
+"剩余\0"
+"剩餘\0"
+"剪其发\0"
+"剪其髮\0"
+"剪发\0"
+"剪髮\0"
+"割舍\0"
+"割捨\0"
+"力争上游\0"
+"力爭上遊\0"
+"劝\0"
+"勸\0"
+"办\0"
+"辦\0"
+"办公台\0"
+"辦公檯\0"
+"功勋\0"
+"功勳\0"
+"加氢精制\0"
+"加氫精制\0"
+"务\0"
+"務\0"
+"劢\0"
+"勱\0"
+"动\0"
+"動\0"
+"劫余\0"
+"劫餘\0"
+"励\0"
+"勵\0"
+"劲\0"
+"勁\0"
+"劳\0"
+"勞\0"
+"势\0"
+"勢\0"
+"勃郁\0"
+"勃鬱\0"
+"勋\0"
+"勛\0"
+"勋业\0"
+"勳業\0"
+"勋劳\0"
+"勳勞\0"
+"勋爵\0"
+"勳爵\0"
+"勋章\0"
+"勳章\0"
+"勋绩\0"
+"勳績\0"
+"勤仆\0"
+"勤僕\0"
+"勤朴\0"
+"勤樸\0"
+"勾干\0"
+"勾幹\0"
+"勾心斗角\0"
+"勾心鬥角\0"
+"勾魂荡魄\0"
+"勾魂蕩魄\0"
+"匀\0"
+"勻\0"
+"包准\0"
+"包準\0"
+"包干\0"
+"包幹\0"
+"包扎\0"
+"包紮\0"
+"包谷\0"
+"包穀\0"
+"匏系\0"
+"匏繫\0"
+"北仑河\0"
+"北崙河\0"
+"北回线\0"
+"北迴線\0"
+"北回铁路\0"
+"北迴鐵路\0"
+"北山索面\0"
+"北山索麵\0"
+"北岳\0"
+"北嶽\0"
+"匦\0"
+"匭\0"
+"匪干\0"
+"匪幹\0"
+"匮\0"
+"匱\0"
+"区\0"
+"區\0"
+"区里有\0"
+"區裡有\0"
+"区里的\0"
+"區裡的\0"
+"医\0"
+"醫\0"
+"十个\0"
+"十個\0"
+"十余\0"
+"十餘\0"
+"十出\0"
+"十齣\0"
+"十出击\0"
+"十出擊\0"
+"十出头\0"
+"十出頭\0"
+"十只\0"
+"十隻\0"
+"十周后\0"
+"十周後\0"
+"十天后\0"
+"十天後\0"
+"十扎\0"
+"十紮\0"
+"千个\0"
+"千個\0"
+"千余\0"
+"千餘\0"
+"千只\0"
+"千隻\0"
+"千只够\0"
+"千只夠\0"
+"千只足够\0"
+"千只足夠\0"
+"千周后\0"
+"千周後\0"
+"千回百折\0"
+"千迴百折\0"
+"千回百转\0"
+"千迴百轉\0"
+"千天后\0"
+"千天後\0"
+"千扎\0"
+"千紮\0"
+"千钧一发\0"
+"千鈞一髮\0"
+"升州\0"
+"昇州\0"
+"升平\0"
+"昇平\0"
+"升阳\0"
+"昇陽\0"
+"升高后\0"
+"升高後\0"
+"半只\0"
+"半隻\0"
+"半只够\0"
+"半只夠\0"
+"华\0"
+"華\0"
+"华严钟\0"
+"華嚴鐘\0"
+"协\0"
+"協\0"
+"协防\0"
+"協防\0"
+"单\0"
+"單\0"
+"单于\0"
+"單于\0"
+"单单于\0"
+"單單於\0"
+"单向\0"
+"單向\0"
+"单干\0"
+"單幹\0"
+"单打独斗\0"
+"單打獨鬥\0"
+"卖\0"
+"賣\0"
+"卖断发\0"
+"賣斷發\0"
+"南京钟\0"
+"南京鐘\0"
+"南京钟表\0"
+"南京鐘錶\0"
+"南回线\0"
+"南迴線\0"
+"南回铁路\0"
+"南迴鐵路\0"
+"南宫适\0"
+"南宮适\0"
+"南屏晚钟\0"
+"南屏晚鐘\0"
+"南岳\0"
+"南嶽\0"
+"南游\0"
+"南遊\0"
+"博尔术\0"
+"博爾朮\0"
+"博杰普尔\0"
+"博杰普爾\0"
+"博采\0"
+"博採\0"
+"占头筹\0"
+"佔頭籌\0"
+"占毕\0"
+"佔畢\0"
+"占高枝儿\0"
+"佔高枝兒\0"
+"卢\0"
+"盧\0"
+"卢棱伽\0"
+"盧稜伽\0"
+"卤\0"
+"鹵\0"
+"卤了\0"
+"滷了\0"
+"卤五花\0"
+"滷五花\0"
+"卤制\0"
+"滷製\0"
+"卤味\0"
+"滷味\0"
+"卤好\0"
+"滷好\0"
+"卤子\0"
+"滷子\0"
+"卤料\0"
+"滷料\0"
+"卤水\0"
+"滷水\0"
+"卤汁\0"
+"滷汁\0"
+"卤湖\0"
+"滷湖\0"
+"卤煮\0"
+"滷煮\0"
+"卤牛\0"
+"滷牛\0"
+"卤的\0"
+"滷的\0"
+"卤肉\0"
+"滷肉\0"
+"卤菜\0"
+"滷菜\0"
+"卤虾\0"
+"滷蝦\0"
+"卤蛋\0"
+"滷蛋\0"
+"卤豆\0"
+"滷豆\0"
+"卤面\0"
+"滷麵\0"
+"卤鸡\0"
+"滷雞\0"
+"卤鸭\0"
+"滷鴨\0"
+"卤鹅\0"
+"滷鵝\0"
+"卧\0"
+"臥\0"
+"卧游\0"
+"臥遊\0"
+"卫\0"
+"衛\0"
+"卫后庄公\0"
+"衛後莊公\0"
+"卫星钟\0"
+"衛星鐘\0"
+"印制\0"
+"印製\0"
+"印累绶若\0"
+"印纍綬若\0"
+"印鉴\0"
+"印鑑\0"
+"却\0"
+"卻\0"
+"卵与石斗\0"
+"卵與石鬥\0"
+"卷云\0"
+"捲雲\0"
+"卷住\0"
+"捲住\0"
+"卷儿\0"
+"捲兒\0"
+"卷入\0"
+"捲入\0"
+"卷动\0"
+"捲動\0"
+"卷去\0"
+"捲去\0"
+"卷发\0"
+"捲髮\0"
+"卷叶蛾\0"
+"捲葉蛾\0"
+"卷图\0"
+"捲圖\0"
+"卷土重来\0"
+"捲土重來\0"
+"卷地\0"
+"捲地\0"
+"卷尺\0"
+"捲尺\0"
+"卷尾猴\0"
+"捲尾猴\0"
+"卷帘\0"
+"捲簾\0"
+"卷心菜\0"
+"捲心菜\0"
+"卷成\0"
+"捲成\0"
+"卷曲\0"
+"捲曲\0"
+"卷来\0"
+"捲來\0"
+"卷款\0"
+"捲款\0"
+"卷毛\0"
+"捲毛\0"
+"卷烟\0"
+"捲菸\0"
+"卷烟盒\0"
+"捲煙盒\0"
+"卷瓣\0"
+"捲瓣\0"
+"卷积云\0"
+"捲積雲\0"
+"卷筒\0"
+"捲筒\0"
+"卷纸\0"
+"捲紙\0"
+"卷缩\0"
+"捲縮\0"
+"卷舌\0"
+"捲舌\0"
+"卷袖\0"
+"捲袖\0"
+"卷走\0"
+"捲走\0"
+"卷起\0"
+"捲起\0"
+"卷轴\0"
+"捲軸\0"
+"卷逃\0"
+"捲逃\0"
+"卷铺盖\0"
+"捲鋪蓋\0"
+"卷须\0"
+"卷鬚\0"
+"卷风\0"
+"捲風\0"
+"厂\0"
+"廠\0"
+"厅\0"
+"廳\0"
+"历\0"
+"歷\0"
+"历书\0"
+"曆書\0"
+"历元\0"
+"曆元\0"
+"历史里\0"
+"歷史裡\0"
+"历命\0"
+"曆命\0"
+"历始\0"
+"曆始\0"
+"历室\0"
+"曆室\0"
+"历尾\0"
+"曆尾\0"
+"历局\0"
+"曆局\0"
+"历数书\0"
+"曆數書\0"
+"历日\0"
+"曆日\0"
+"历本\0"
+"曆本\0"
+"历法\0"
+"曆法\0"
+"历物之意\0"
+"厤物之意\0"
+"历狱\0"
+"曆獄\0"
+"历纪\0"
+"曆紀\0"
+"历象\0"
+"曆象\0"
+"厉\0"
+"厲\0"
+"压\0"
+"壓\0"
+"压制出\0"
+"壓製出\0"
+"压制机\0"
+"壓製機\0"
+"厌\0"
+"厭\0"
+"厍\0"
+"厙\0"
+"厕\0"
+"廁\0"
+"厘改\0"
+"釐改\0"
+"厘整\0"
+"釐整\0"
+"厘正\0"
+"釐正\0"
+"厘毫\0"
+"釐毫\0"
+"厘清\0"
+"釐清\0"
+"厘订\0"
+"釐訂\0"
+"厘革\0"
+"釐革\0"
+"原子钟\0"
+"原子鐘\0"
+"原文里\0"
+"原文裡\0"
+"原钟\0"
+"原鐘\0"
+"厢\0"
+"廂\0"
+"厣\0"
+"厴\0"
+"厦\0"
+"廈\0"
+"厨\0"
+"廚\0"
+"厨余\0"
+"廚餘\0"
+"厩\0"
+"廄\0"
+"厮\0"
+"廝\0"
+"厮斗\0"
+"廝鬥\0"
+"去山里\0"
+"去山裡\0"
+"县\0"
+"縣\0"
+"县志\0"
+"縣誌\0"
+"县里\0"
+"縣裡\0"
+"参\0"
+"參\0"
+"参数只\0"
+"參數只\0"
+"参数里\0"
+"參數裡\0"
+"参绥\0"
+"蔘綏\0"
+"双\0"
+"雙\0"
+"双折\0"
+"雙摺\0"
+"双折射\0"
+"雙折射\0"
+"双胜类\0"
+"雙胜類\0"
+"双雕\0"
+"雙鵰\0"
+"反冲\0"
+"反衝\0"
+"反反复复\0"
+"反反覆覆\0"
+"反复\0"
+"反覆\0"
+"反复制\0"
+"反複製\0"
+"反应制得\0"
+"反應製得\0"
+"反朴\0"
+"反樸\0"
+"发\0"
+"發\0"
+"发上冲冠\0"
+"髮上沖冠\0"
+"发上指冠\0"
+"髮上指冠\0"
+"发丝\0"
+"髮絲\0"
+"发为血之本\0"
+"髮為血之本\0"
+"发乳\0"
+"髮乳\0"
+"发光可鉴\0"
+"髮光可鑑\0"
+"发匪\0"
+"髮匪\0"
+"发卷\0"
+"髮捲\0"
+"发及腰\0"
+"髮及腰\0"
+"发型\0"
+"髮型\0"
+"发夹\0"
+"髮夾\0"
+"发妻\0"
+"髮妻\0"
+"发屋\0"
+"髮屋\0"
+"发已霜白\0"
+"髮已霜白\0"
+"发带\0"
+"髮帶\0"
+"发干\0"
+"發乾\0"
+"发廊\0"
+"髮廊\0"
+"发式\0"
+"髮式\0"
+"发引千钧\0"
+"髮引千鈞\0"
+"发披肩\0"
+"髮披肩\0"
+"发松\0"
+"發鬆\0"
+"发根\0"
+"髮根\0"
+"发油\0"
+"髮油\0"
+"发漂\0"
+"髮漂\0"
+"发状\0"
+"髮狀\0"
+"发状况\0"
+"發狀況\0"
+"发状态\0"
+"發狀態\0"
+"发癣\0"
+"髮癬\0"
+"发短心长\0"
+"髮短心長\0"
+"发禁\0"
+"髮禁\0"
+"发笺\0"
+"髮箋\0"
+"发签\0"
+"發籤\0"
+"发簪\0"
+"髮簪\0"
+"发纱\0"
+"髮紗\0"
+"发结\0"
+"髮結\0"
+"发网菌\0"
+"髮網菌\0"
+"发肤\0"
+"髮膚\0"
+"发胶\0"
+"髮膠\0"
+"发脚\0"
+"髮腳\0"
+"发菜\0"
+"髮菜\0"
+"发蜡\0"
+"髮蠟\0"
+"发踊冲冠\0"
+"髮踴沖冠\0"
+"发辫\0"
+"髮辮\0"
+"发钗\0"
+"髮釵\0"
+"发长\0"
+"髮長\0"
+"发际\0"
+"髮際\0"
+"发雕\0"
+"髮雕\0"
+"发霜\0"
+"髮霜\0"
+"发面\0"
+"發麵\0"
+"发饰\0"
+"髮飾\0"
+"发髻\0"
+"髮髻\0"
+"发鬓\0"
+"髮鬢\0"
+"取舍\0"
+"取捨\0"
+"受托\0"
+"受託\0"
+"受雇\0"
+"受僱\0"
+"变\0"
+"變\0"
+"变丑\0"
+"變醜\0"
+"变征\0"
+"變徵\0"
+"叙\0"
+"敘\0"
+"叠\0"
+"疊\0"
+"叠席\0"
+"疊蓆\0"
+"口干\0"
+"口乾\0"
+"口干预\0"
+"口干預\0"
+"口燥唇干\0"
+"口燥唇乾\0"
+"口腹之欲\0"
+"口腹之慾\0"
+"口里\0"
+"口裡\0"
+"口钟\0"
+"口鐘\0"
+"古书云\0"
+"古書云\0"
+"古文里\0"
+"古文裡\0"
+"古朴\0"
+"古樸\0"
+"古柯咸\0"
+"古柯鹹\0"
+"古语云\0"
+"古語云\0"
+"古迹\0"
+"古蹟\0"
+"古钟\0"
+"古鐘\0"
+"古钟表\0"
+"古鐘錶\0"
+"另辟\0"
+"另闢\0"
+"叩钟\0"
+"叩鐘\0"
+"只冲\0"
+"只衝\0"
+"只占神问卜\0"
+"只占神問卜\0"
+"只字\0"
+"隻字\0"
+"只影\0"
+"隻影\0"
+"只影响\0"
+"只影響\0"
+"只手遮天\0"
+"隻手遮天\0"
+"只眼\0"
+"隻眼\0"
+"只言片语\0"
+"隻言片語\0"
+"只身\0"
+"隻身\0"
+"只身上无\0"
+"只身上無\0"
+"只身上没\0"
+"只身上沒\0"
+"只身为\0"
+"只身為\0"
+"只身体\0"
+"只身體\0"
+"只身后\0"
+"只身後\0"
+"只身边\0"
+"只身邊\0"
+"只采\0"
+"只採\0"
+"只采声\0"
+"只采聲\0"
+"叮叮当当\0"
+"叮叮噹噹\0"
+"叮当\0"
+"叮噹\0"
+"可紧可松\0"
+"可緊可鬆\0"
+"可鉴\0"
+"可鑑\0"
+"台佟\0"
+"臺佟\0"
+"台历\0"
+"檯曆\0"
+"台历史\0"
+"台歷史\0"
+"台子孙\0"
+"台子孫\0"
+"台灯\0"
+"檯燈\0"
+"台球\0"
+"檯球\0"
+"台钟\0"
+"台鐘\0"
+"台静农\0"
+"臺靜農\0"
+"台面上\0"
+"檯面上\0"
+"台面化\0"
+"檯面化\0"
+"台风\0"
+"颱風\0"
+"台风后\0"
+"颱風後\0"
+"台风奖\0"
+"台風獎\0"
+"台风稳健\0"
+"台風穩健\0"
+"史鉴\0"
+"史鑑\0"
+"叶\0"
+"葉\0"
+"叶叶琴\0"
+"葉叶琴\0"
+"叶阳后\0"
+"葉陽后\0"
+"叶韵\0"
+"叶韻\0"
+"号\0"
+"號\0"
+"号志\0"
+"號誌\0"
+"叹\0"
+"嘆\0"
+"叽\0"
+"嘰\0"
+"吁天\0"
+"籲天\0"
+"吁求\0"
+"籲求\0"
+"吁请\0"
+"籲請\0"
+"吃姜\0"
+"吃薑\0"
+"吃板刀面\0"
+"吃板刀麵\0"
+"吃碗面\0"
+"吃碗麵\0"
+"吃里扒外\0"
+"吃裡扒外\0"
+"吃里爬外\0"
+"吃裡爬外\0"
+"吃面\0"
+"吃麵\0"
+"各类钟\0"
+"各類鐘\0"
+"各辟\0"
+"各闢\0"
+"合伙\0"
+"合夥\0"
+"合准\0"
+"合準\0"
+"合历\0"
+"合曆\0"
+"合历史\0"
+"合歷史\0"
+"合并\0"
+"合併\0"
+"合采\0"
+"合採\0"
+"吉凶庆吊\0"
+"吉凶慶弔\0"
+"吉征\0"
+"吉徵\0"
+"吊丧\0"
+"弔喪\0"
+"吊卷\0"
+"弔卷\0"
+"吊取\0"
+"弔取\0"
+"吊古\0"
+"弔古\0"
+"吊唁\0"
+"弔唁\0"
+"吊喉\0"
+"弔喉\0"
+"吊喭\0"
+"弔喭\0"
+"吊头\0"
+"弔頭\0"
+"吊奠\0"
+"弔奠\0"
+"吊孝\0"
+"弔孝\0"
+"吊客\0"
+"弔客\0"
+"吊宴\0"
+"弔宴\0"
+"吊影\0"
+"弔影\0"
+"吊恤\0"
+"弔恤\0"
+"吊慰\0"
+"弔慰\0"
+"吊扣\0"
+"弔扣\0"
+"吊拷\0"
+"弔拷\0"
+"吊撒\0"
+"弔撒\0"
+"吊文\0"
+"弔文\0"
+"吊旗\0"
+"弔旗\0"
+"吊民\0"
+"弔民\0"
+"吊祭\0"
+"弔祭\0"
+"吊纸\0"
+"弔紙\0"
+"吊者大悦\0"
+"弔者大悅\0"
+"吊脚儿事\0"
+"弔腳兒事\0"
+"吊腰撒跨\0"
+"弔腰撒跨\0"
+"吊膀子\0"
+"弔膀子\0"
+"吊词\0"
+"弔詞\0"
+"吊诡\0"
+"弔詭\0"
+"吊谎\0"
+"弔謊\0"
+"吊贺迎送\0"
+"弔賀迎送\0"
+"吊钟\0"
+"吊鐘\0"
+"吊问\0"
+"弔問\0"
+"吊鹤\0"
+"弔鶴\0"
+"同人志\0"
+"同人誌\0"
+"同伙\0"
+"同夥\0"
+"同余\0"
+"同餘\0"
+"名单于\0"
+"名單於\0"
+"后\0"
+"後\0"
+"后丰\0"
+"后豐\0"
+"后印\0"
+"後印\0"
+"后发座\0"
+"后髮座\0"
+"后发星系团\0"
+"后髮星系團\0"
+"后台老板\0"
+"後台老板\0"
+"后天\0"
+"後天\0"
+"后海湾\0"
+"后海灣\0"
+"后苍\0"
+"后蒼\0"
+"后面店\0"
+"後面店\0"
+"吐哺捉发\0"
+"吐哺捉髮\0"
+"吐哺握发\0"
+"吐哺握髮\0"
+"向导\0"
+"嚮導\0"
+"向往\0"
+"嚮往\0"
+"向往时\0"
+"向往時\0"
+"向往来\0"
+"向往來\0"
+"向慕\0"
+"嚮慕\0"
+"向迩\0"
+"嚮邇\0"
+"吓\0"
+"嚇\0"
+"吕\0"
+"呂\0"
+"吕后\0"
+"呂后\0"
+"吗\0"
+"嗎\0"
+"吞并\0"
+"吞併\0"
+"吟游\0"
+"吟遊\0"
+"吣\0"
+"唚\0"
+"吧台\0"
+"吧檯\0"
+"吨\0"
+"噸\0"
+"含齿戴发\0"
+"含齒戴髮\0"
+"听\0"
+"聽\0"
+"启\0"
+"啟\0"
+"启发式\0"
+"啟發式\0"
+"吴\0"
+"吳\0"
+"吸干\0"
+"吸乾\0"
+"吹发\0"
+"吹髮\0"
+"吹干\0"
+"吹乾\0"
+"呆致致\0"
+"呆緻緻\0"
+"呆里呆气\0"
+"呆裡呆氣\0"
+"告札\0"
+"告劄\0"
+"告里\0"
+"告裡\0"
+"呐\0"
+"吶\0"
+"呒\0"
+"嘸\0"
+"呓\0"
+"囈\0"
+"呕\0"
+"嘔\0"
+"呖\0"
+"嚦\0"
+"呗\0"
+"唄\0"
+"呗赞\0"
+"唄讚\0"
+"员\0"
+"員\0"
+"呙\0"
+"咼\0"
+"呛\0"
+"嗆\0"
+"呜\0"
+"嗚\0"
+"周历\0"
+"周曆\0"
+"周历史\0"
+"周歷史\0"
+"周游\0"
+"週遊\0"
+"周游列国\0"
+"周遊列國\0"
+"呼吁\0"
+"呼籲\0"
+"和制汉\0"
+"和製漢\0"
+"和制英语\0"
+"和製英語\0"
+"和奸\0"
+"和姦\0"
+"咎征\0"
+"咎徵\0"
+"咏\0"
+"詠\0"
+"咕咕钟\0"
+"咕咕鐘\0"
+"咙\0"
+"嚨\0"
+"咚咚鼓\0"
+"鼕鼕鼓\0"
+"咛\0"
+"嚀\0"
+"咨询\0"
+"諮詢\0"
+"咪表\0"
+"咪錶\0"
+"咬姜呷醋\0"
+"咬薑呷醋\0"
+"咯当\0"
+"咯噹\0"
+"咸卤\0"
+"鹹鹵\0"
+"咸味\0"
+"鹹味\0"
+"咸咸\0"
+"鹹鹹\0"
+"咸嘴淡舌\0"
+"鹹嘴淡舌\0"
+"咸土\0"
+"鹹土\0"
+"咸度\0"
+"鹹度\0"
+"咸得\0"
+"鹹得\0"
+"咸批\0"
+"鹹批\0"
+"咸水\0"
+"鹹水\0"
+"咸汤\0"
+"鹹湯\0"
+"咸派\0"
+"鹹派\0"
+"咸海\0"
+"鹹海\0"
+"咸淡\0"
+"鹹淡\0"
+"咸湖\0"
+"鹹湖\0"
+"咸湿\0"
+"鹹濕\0"
+"咸潟\0"
+"鹹潟\0"
+"咸猪\0"
+"鹹豬\0"
+"咸甜\0"
+"鹹甜\0"
+"咸的\0"
+"鹹的\0"
+"咸类\0"
+"鹹類\0"
+"咸粥\0"
+"鹹粥\0"
+"咸肉\0"
+"鹹肉\0"
+"咸菜\0"
+"鹹菜\0"
+"咸菜干\0"
+"鹹菜乾\0"
+"咸蛋\0"
+"鹹蛋\0"
+"咸食\0"
+"鹹食\0"
+"咸鱼\0"
+"鹹魚\0"
+"咸鸭蛋\0"
+"鹹鴨蛋\0"
+"哀吊\0"
+"哀弔\0"
+"哀挽\0"
+"哀輓\0"
+"品鉴\0"
+"品鑑\0"
+"哄动\0"
+"鬨動\0"
+"哄堂\0"
+"鬨堂\0"
+"哄笑\0"
+"鬨笑\0"
+"响\0"
+"響\0"
+"响钟\0"
+"響鐘\0"
+"哑\0"
+"啞\0"
+"哒\0"
+"噠\0"
+"哓\0"
+"嘵\0"
+"哔\0"
+"嗶\0"
+"哕\0"
+"噦\0"
+"哗\0"
+"嘩\0"
+"哗众\0"
+"譁眾\0"
+"哗变\0"
+"譁變\0"
+"哗噪\0"
+"譁噪\0"
+"哗嚣\0"
+"譁囂\0"
+"哗然\0"
+"譁然\0"
+"哗笑\0"
+"譁笑\0"
+"哙\0"
+"噲\0"
+"哜\0"
+"嚌\0"
+"哝\0"
+"噥\0"
+"哟\0"
+"喲\0"
+"哟喂\0"
+"喲喂\0"
+"哪里\0"
+"哪裡\0"
+"唁吊\0"
+"唁弔\0"
+"唇干\0"
+"唇乾\0"
+"唛\0"
+"嘜\0"
+"唠\0"
+"嘮\0"
+"唢\0"
+"嗩\0"
+"唤\0"
+"喚\0"
+"唱游\0"
+"唱遊\0"
+"唾余\0"
+"唾餘\0"
+"唾面自干\0"
+"唾面自乾\0"
+"商历\0"
+"商曆\0"
+"商历史\0"
+"商歷史\0"
+"商标准许\0"
+"商標准許\0"
+"啧\0"
+"嘖\0"
+"啬\0"
+"嗇\0"
+"啭\0"
+"囀\0"
+"啮\0"
+"齧\0"
+"啮合\0"
+"嚙合\0"
+"啮虫\0"
+"囓蟲\0"
+"啮齿类\0"
+"嚙齒類\0"
+"啷当\0"
+"啷噹\0"
+"啸\0"
+"嘯\0"
+"喂\0"
+"餵\0"
+"喂了一声\0"
+"喂了一聲\0"
+"喂哟\0"
+"喂喲\0"
+"喜欢表\0"
+"喜歡錶\0"
+"喜欢钟\0"
+"喜歡鐘\0"
+"喜欢钟表\0"
+"喜歡鐘錶\0"
+"喝干\0"
+"喝乾\0"
+"喧哄\0"
+"喧鬨\0"
+"喧哗\0"
+"喧譁\0"
+"喷\0"
+"噴\0"
+"喽\0"
+"嘍\0"
+"喾\0"
+"嚳\0"
+"嗫\0"
+"囁\0"
+"嗳\0"
+"噯\0"
+"嘉谷\0"
+"嘉穀\0"
+"嘘\0"
+"噓\0"
+"嘤\0"
+"嚶\0"
+"嘱\0"
+"囑\0"
+"嘱托\0"
+"囑託\0"
+"嘴里\0"
+"嘴裡\0"
+"噙齿戴发\0"
+"噙齒戴髮\0"
+"噜\0"
+"嚕\0"
+"噜苏\0"
+"嚕囌\0"
+"噪诈\0"
+"譟詐\0"
+"嚣\0"
+"囂\0"
+"嚼谷\0"
+"嚼穀\0"
+"四个\0"
+"四個\0"
+"四余\0"
+"四餘\0"
+"四出征收\0"
+"四出徵收\0"
+"四分历\0"
+"四分曆\0"
+"四分历史\0"
+"四分歷史\0"
+"四只\0"
+"四隻\0"
+"四周后\0"
+"四周後\0"
+"四天后\0"
+"四天後\0"
+"四扎\0"
+"四紮\0"
+"四杆铁笔\0"
+"四桿鐵筆\0"
+"四舍五入\0"
+"四捨五入\0"
+"四舍六入\0"
+"四捨六入\0"
+"四面钟\0"
+"四面鐘\0"
+"回光返照\0"
+"迴光返照\0"
+"回历\0"
+"回曆\0"
+"回历史\0"
+"回歷史\0"
+"回响\0"
+"迴響\0"
+"回圈\0"
+"迴圈\0"
+"回复中\0"
+"回覆中\0"
+"回复你\0"
+"回覆你\0"
+"回复帖子\0"
+"回覆帖子\0"
+"回复意见\0"
+"回覆意見\0"
+"回复说\0"
+"回覆說\0"
+"回复邮件\0"
+"回覆郵件\0"
+"回廊\0"
+"迴廊\0"
+"回形夹\0"
+"迴形夾\0"
+"回文序列\0"
+"迴文序列\0"
+"回文数\0"
+"迴文數\0"
+"回文构词\0"
+"迴文構詞\0"
+"回文结构\0"
+"迴文結構\0"
+"回文联\0"
+"迴文聯\0"
+"回文诗\0"
+"迴文詩\0"
+"回文锦\0"
+"迴文錦\0"
+"回旋\0"
+"迴旋\0"
+"回游\0"
+"回遊\0"
+"回环\0"
+"迴環\0"
+"回纹针\0"
+"迴紋針\0"
+"回绕\0"
+"迴繞\0"
+"回翔\0"
+"迴翔\0"
+"回肠\0"
+"迴腸\0"
+"回肠荡气\0"
+"迴腸盪氣\0"
+"回荡\0"
+"迴蕩\0"
+"回诵\0"
+"迴誦\0"
+"回路\0"
+"迴路\0"
+"回转\0"
+"迴轉\0"
+"回递性\0"
+"迴遞性\0"
+"回避\0"
+"迴避\0"
+"回采\0"
+"回採\0"
+"回銮\0"
+"迴鑾\0"
+"回风\0"
+"迴風\0"
+"团\0"
+"團\0"
+"团子\0"
+"糰子\0"
+"园\0"
+"園\0"
+"园游会\0"
+"園遊會\0"
+"园里\0"
+"園裡\0"
+"困乏\0"
+"睏乏\0"
+"困倦\0"
+"睏倦\0"
+"困倦起来\0"
+"困倦起來\0"
+"困兽之斗\0"
+"困獸之鬥\0"
+"困兽犹斗\0"
+"困獸猶鬥\0"
+"困斗\0"
+"困鬥\0"
+"困觉\0"
+"睏覺\0"
+"囱\0"
+"囪\0"
+"围\0"
+"圍\0"
+"囵\0"
+"圇\0"
+"固征\0"
+"固徵\0"
+"国\0"
+"國\0"
+"国之桢干\0"
+"國之楨榦\0"
+"国仇\0"
+"國讎\0"
+"国历\0"
+"國曆\0"
+"国历代\0"
+"國歷代\0"
+"国历任\0"
+"國歷任\0"
+"国历史\0"
+"國歷史\0"
+"国历届\0"
+"國歷屆\0"
+"国历来\0"
+"國歷來\0"
+"国历经\0"
+"國歷經\0"
+"图\0"
+"圖\0"
+"图里的\0"
+"圖裡的\0"
+"图鉴\0"
+"圖鑑\0"
+"圆\0"
+"圓\0"
+"圈梁\0"
+"圈樑\0"
+"圈里\0"
+"圈裡\0"
+"土制\0"
+"土製\0"
+"土索面\0"
+"土索麵\0"
+"土里\0"
+"土裡\0"
+"圣\0"
+"聖\0"
+"圣人历\0"
+"聖人曆\0"
+"圣后\0"
+"聖后\0"
+"圣马尔谷日\0"
+"聖馬爾谷日\0"
+"在山里\0"
+"在山裡\0"
+"地丑德齐\0"
+"地醜德齊\0"
+"地图里\0"
+"地圖裡\0"
+"地心历表\0"
+"地心曆表\0"
+"地志\0"
+"地誌\0"
+"圹\0"
+"壙\0"
+"场\0"
+"場\0"
+"场里\0"
+"場裡\0"
+"坏\0"
+"壞\0"
+"坐台\0"
+"坐檯\0"
+"坐台铁\0"
+"坐台鐵\0"
+"坐如钟\0"
+"坐如鐘\0"
+"坐钟\0"
+"坐鐘\0"
+"坑里\0"
+"坑裡\0"
+"块\0"
+"塊\0"
+"坚\0"
+"堅\0"
+"坚致\0"
+"堅緻\0"
+"坛\0"
+"壇\0"
+"坛坛罐罐\0"
+"罈罈罐罐\0"
+"坛子\0"
+"罈子\0"
+"坜\0"
+"壢\0"
+"坝\0"
+"壩\0"
+"坞\0"
+"塢\0"
+"坟\0"
+"墳\0"
+"坠\0"
+"墜\0"
+"坤范\0"
+"坤範\0"
+"坦荡\0"
+"坦蕩\0"
+"坦荡荡\0"
+"坦蕩蕩\0"
+"坱郁\0"
+"坱鬱\0"
+"垂发\0"
+"垂髮\0"
+"垂范\0"
+"垂範\0"
+"垄\0"
+"壟\0"
+"垆\0"
+"壚\0"
+"型范\0"
+"型範\0"
+"垒\0"
+"壘\0"
+"垦\0"
+"墾\0"
+"垦辟\0"
+"墾闢\0"
+"垩\0"
+"堊\0"
+"垫\0"
+"墊\0"
+"垭\0"
+"埡\0"
+"垲\0"
+"塏\0"
+"埃及历\0"
+"埃及曆\0"
+"埃及历史\0"
+"埃及歷史\0"
+"埃及艳后\0"
+"埃及豔后\0"
+"埃荣冲\0"
+"埃榮衝\0"
+"城市里\0"
+"城市裡\0"
+"城里\0"
+"城裡\0"
+"埔里社\0"
+"埔裏社\0"
+"埘\0"
+"塒\0"
+"埙\0"
+"塤\0"
+"埚\0"
+"堝\0"
+"域里\0"
+"域裡\0"
+"基准\0"
+"基準\0"
+"基干\0"
+"基幹\0"
+"堑\0"
+"塹\0"
+"堕\0"
+"墮\0"
+"堙淀\0"
+"堙澱\0"
+"塞耳盗钟\0"
+"塞耳盜鐘\0"
+"境里\0"
+"境裡\0"
+"墓志\0"
+"墓誌\0"
+"墓志铭\0"
+"墓志銘\0"
+"墙\0"
+"牆\0"
+"墙里\0"
+"牆裡\0"
+"增辟\0"
+"增闢\0"
+"墨沈\0"
+"墨瀋\0"
+"壮\0"
+"壯\0"
+"壮游\0"
+"壯遊\0"
+"壮面\0"
+"壯麵\0"
+"声\0"
+"聲\0"
+"声母后\0"
+"聲母後\0"
+"壳\0"
+"殼\0"
+"壳里\0"
+"殼裡\0"
+"壶\0"
+"壺\0"
+"壶里\0"
+"壺裡\0"
+"壹郁\0"
+"壹鬱\0"
+"处\0"
+"處\0"
+"备\0"
+"備\0"
+"备注\0"
+"備註\0"
+"复\0"
+"復\0"
+"复习\0"
+"複習\0"
+"复信\0"
+"覆信\0"
+"复元音\0"
+"複元音\0"
+"复写\0"
+"複寫\0"
+"复决\0"
+"複決\0"
+"复函数\0"
+"複函數\0"
+"复分数\0"
+"複分數\0"
+"复分析\0"
+"複分析\0"
+"复分解\0"
+"複分解\0"
+"复列\0"
+"複列\0"
+"复利\0"
+"複利\0"
+"复制\0"
+"複製\0"
+"复印\0"
+"複印\0"
+"复变函数\0"
+"複變函數\0"
+"复句\0"
+"複句\0"
+"复叶\0"
+"複葉\0"
+"复合\0"
+"複合\0"
+"复壁\0"
+"複壁\0"
+"复始\0"
+"復始\0"
+"复姓\0"
+"複姓\0"
+"复字键\0"
+"複字鍵\0"
+"复审\0"
+"複審\0"
+"复对数\0"
+"複對數\0"
+"复平面\0"
+"複平面\0"
+"复式\0"
+"複式\0"
+"复数\0"
+"複數\0"
+"复方\0"
+"複方\0"
+"复本\0"
+"複本\0"
+"复杂\0"
+"複雜\0"
+"复查\0"
+"複查\0"
+"复核\0"
+"覆核\0"
+"复次\0"
+"複次\0"
+"复比\0"
+"複比\0"
+"复活节历表\0"
+"復活節曆表\0"
+"复流\0"
+"複流\0"
+"复测\0"
+"複測\0"
+"复目\0"
+"複目\0"
+"复眼\0"
+"複眼\0"
+"复种\0"
+"複種\0"
+"复穗\0"
+"複穗\0"
+"复线\0"
+"複線\0"
+"复色\0"
+"複色\0"
+"复苏\0"
+"復甦\0"
+"复议\0"
+"複議\0"
+"复评\0"
+"複評\0"
+"复诊\0"
+"複診\0"
+"复词\0"
+"複詞\0"
+"复试\0"
+"複試\0"
+"复课\0"
+"複課\0"
+"复赛\0"
+"複賽\0"
+"复辅音\0"
+"複輔音\0"
+"复述\0"
+"複述\0"
+"复选\0"
+"複選\0"
+"复钱\0"
+"複錢\0"
+"复阅\0"
+"複閱\0"
+"复音\0"
+"複音\0"
+"复韵\0"
+"複韻\0"
+"夏于乔\0"
+"夏于喬\0"
+"夏历\0"
+"夏曆\0"
+"夏历史\0"
+"夏歷史\0"
+"夏游\0"
+"夏遊\0"
+"外制\0"
+"外製\0"
+"外强中干\0"
+"外強中乾\0"
+"多丑\0"
+"多醜\0"
+"多余\0"
+"多餘\0"
+"多冲\0"
+"多衝\0"
+"多出电影\0"
+"多齣電影\0"
+"多只\0"
+"多隻\0"
+"多只会\0"
+"多只會\0"
+"多只须\0"
+"多只須\0"
+"多周后\0"
+"多周後\0"
+"多天后\0"
+"多天後\0"
+"夜晚里\0"
+"夜晚裡\0"
+"夜游\0"
+"夜遊\0"
+"夜里\0"
+"夜裡\0"
+"够\0"
+"夠\0"
+"大丑\0"
+"大醜\0"
+"大伙\0"
+"大夥\0"
+"大伙儿\0"
+"大伙兒\0"
+"大历\0"
+"大曆\0"
+"大历史\0"
+"大歷史\0"
+"大历险\0"
+"大歷險\0"
+"大只\0"
+"大隻\0"
+"大只会\0"
+"大只會\0"
+"大周折\0"
+"大週摺\0"
+"大型钟\0"
+"大型鐘\0"
+"大型钟表\0"
+"大型鐘錶\0"
+"大型钟表面\0"
+"大型鐘表面\0"
+"大型钟面\0"
+"大型鐘面\0"
+"大夸\0"
+"大誇\0"
+"大干\0"
+"大幹\0"
+"大批涌到\0"
+"大批湧到\0"
+"大折儿\0"
+"大摺兒\0"
+"大明历\0"
+"大明曆\0"
+"大明历史\0"
+"大明歷史\0"
+"大本钟\0"
+"大本鐘\0"
+"大病初愈\0"
+"大病初癒\0"
+"大目干连\0"
+"大目乾連\0"
+"大笨钟\0"
+"大笨鐘\0"
+"大衍历\0"
+"大衍曆\0"
+"大衍历史\0"
+"大衍歷史\0"
+"大赞\0"
+"大讚\0"
+"大金发苔\0"
+"大金髮苔\0"
+"大钟\0"
+"大鐘\0"
+"大风后\0"
+"大風後\0"
+"天克地冲\0"
+"天克地衝\0"
+"天历\0"
+"天曆\0"
+"天历史\0"
+"天歷史\0"
+"天后半\0"
+"天後半\0"
+"天后天\0"
+"天後天\0"
+"天后宫\0"
+"天后宮\0"
+"天后来\0"
+"天後來\0"
+"天地为范\0"
+"天地為範\0"
+"天文历表\0"
+"天文曆表\0"
+"天文学钟\0"
+"天文學鐘\0"
+"天文钟\0"
+"天文鐘\0"
+"天里\0"
+"天裡\0"
+"太丑\0"
+"太醜\0"
+"太仆\0"
+"太僕\0"
+"太凶\0"
+"太兇\0"
+"太初历\0"
+"太初曆\0"
+"太初历史\0"
+"太初歷史\0"
+"太阁\0"
+"太閤\0"
+"头\0"
+"頭\0"
+"头发\0"
+"頭髮\0"
+"头发现\0"
+"頭發現\0"
+"头里\0"
+"頭裡\0"
+"头长发\0"
+"頭長髮\0"
+"夸下海口\0"
+"誇下海口\0"
+"夸丽\0"
+"誇麗\0"
+"夸了\0"
+"誇了\0"
+"夸人\0"
+"誇人\0"
+"夸他\0"
+"誇他\0"
+"夸你\0"
+"誇你\0"
+"夸别\0"
+"誇別\0"
+"夸功\0"
+"誇功\0"
+"夸口\0"
+"誇口\0"
+"夸嘴\0"
+"誇嘴\0"
+"夸多斗靡\0"
+"誇多鬥靡\0"
+"夸大\0"
+"誇大\0"
+"夸夸\0"
+"誇誇\0"
+"夸夸其谈\0"
+"誇誇其談\0"
+"夸奖\0"
+"誇獎\0"
+"夸她\0"
+"誇她\0"
+"夸姣\0"
+"誇姣\0"
+"夸官\0"
+"誇官\0"
+"夸容\0"
+"誇容\0"
+"夸张\0"
+"誇張\0"
+"夸强说会\0"
+"誇強說會\0"
+"夸得\0"
+"誇得\0"
+"夸成\0"
+"誇成\0"
+"夸我\0"
+"誇我\0"
+"夸才\0"
+"誇才\0"
+"夸来夸去\0"
+"誇來誇去\0"
+"夸毗\0"
+"誇毗\0"
+"夸海口\0"
+"誇海口\0"
+"夸示\0"
+"誇示\0"
+"夸称\0"
+"誇稱\0"
+"夸耀\0"
+"誇耀\0"
+"夸胜道强\0"
+"誇勝道強\0"
+"夸能\0"
+"誇能\0"
+"夸能斗智\0"
+"誇能鬥智\0"
+"夸脱\0"
+"夸脫\0"
+"夸诞\0"
+"誇誕\0"
+"夸诩\0"
+"誇詡\0"
+"夸说\0"
+"誇說\0"
+"夸赞\0"
+"誇讚\0"
+"夸起\0"
+"誇起\0"
+"夸辩\0"
+"誇辯\0"
+"夸过\0"
+"誇過\0"
+"夸饰\0"
+"誇飾\0"
+"夹\0"
+"夾\0"
+"夹衣\0"
+"袷衣\0"
+"夹裙\0"
+"袷裙\0"
+"夺\0"
+"奪\0"
+"夺斗\0"
+"奪鬥\0"
+"奁\0"
+"奩\0"
+"奂\0"
+"奐\0"
+"奇丑\0"
+"奇醜\0"
+"奇勋\0"
+"奇勳\0"
+"奇迹\0"
+"奇蹟\0"
+"奋\0"
+"奮\0"
+"奋斗\0"
+"奮鬥\0"
+"奏折\0"
+"奏摺\0"
+"奖\0"
+"獎\0"
+"奖杯\0"
+"獎盃\0"
+"奥\0"
+"奧\0"
+"女仆\0"
+"女僕\0"
+"奴仆\0"
+"奴僕\0"
+"奸夫\0"
+"姦夫\0"
+"奸妇\0"
+"姦婦\0"
+"奸情\0"
+"姦情\0"
+"奸杀\0"
+"姦殺\0"
+"奸污\0"
+"姦污\0"
+"奸淫\0"
+"姦淫\0"
+"奸淫掳掠\0"
+"奸淫擄掠\0"
+"好丑\0"
+"好醜\0"
+"好凶\0"
+"好兇\0"
+"好勇斗狠\0"
+"好勇鬥狠\0"
+"好困\0"
+"好睏\0"
+"好家伙\0"
+"好傢夥\0"
+"好斗\0"
+"好鬥\0"
+"好斗胆\0"
+"好斗膽\0"
+"好签\0"
+"好籤\0"
+"如果干\0"
+"如果幹\0"
+"如饥似渴\0"
+"如饑似渴\0"
+"妆\0"
+"妝\0"
+"妆台\0"
+"妝檯\0"
+"妇\0"
+"婦\0"
+"妈\0"
+"媽\0"
+"妖气冲天\0"
+"妖氣衝天\0"
+"妩\0"
+"嫵\0"
+"妪\0"
+"嫗\0"
+"妫\0"
+"媯\0"
+"委托\0"
+"委託\0"
+"委托书\0"
+"委託書\0"
+"姗\0"
+"姍\0"
+"姜丝\0"
+"薑絲\0"
+"姜啤\0"
+"薑啤\0"
+"姜是老的辣\0"
+"薑是老的辣\0"
+"姜末\0"
+"薑末\0"
+"姜桂\0"
+"薑桂\0"
+"姜母\0"
+"薑母\0"
+"姜汁\0"
+"薑汁\0"
+"姜汤\0"
+"薑湯\0"
+"姜片\0"
+"薑片\0"
+"姜糖\0"
+"薑糖\0"
+"姜老辣\0"
+"薑老辣\0"
+"姜茶\0"
+"薑茶\0"
+"姜蓉\0"
+"薑蓉\0"
+"姜还是老的辣\0"
+"薑還是老的辣\0"
+"姜酮\0"
+"薑酮\0"
+"姜饼\0"
+"薑餅\0"
+"姜黄\0"
+"薑黃\0"
+"姹\0"
+"奼\0"
+"威棱\0"
+"威稜\0"
+"娄\0"
+"婁\0"
+"娅\0"
+"婭\0"
+"娆\0"
+"嬈\0"
+"娇\0"
+"嬌\0"
+"娈\0"
+"孌\0"
+"娱\0"
+"娛\0"
+"娲\0"
+"媧\0"
+"娴\0"
+"嫻\0"
+"婢仆\0"
+"婢僕\0"
+"婴\0"
+"嬰\0"
+"婵\0"
+"嬋\0"
+"婶\0"
+"嬸\0"
+"媪\0"
+"媼\0"
+"嫌凶\0"
+"嫌兇\0"
+"嫌好道丑\0"
+"嫌好道醜\0"
+"嫒\0"
+"嬡\0"
+"嫔\0"
+"嬪\0"
+"嫩姜\0"
+"嫩薑\0"
+"嫱\0"
+"嬙\0"
+"嬉游\0"
+"嬉遊\0"
+"嬖幸\0"
+"嬖倖\0"
+"嬴余\0"
+"嬴餘\0"
+"嬷\0"
+"嬤\0"
+"子里\0"
+"子裡\0"
+"字母后\0"
+"字母後\0"
+"字汇\0"
+"字彙\0"
+"字码表\0"
+"字碼表\0"
+"字里行间\0"
+"字裡行間\0"
+"存折\0"
+"存摺\0"
+"孙\0"
+"孫\0"
+"孙杰\0"
+"孫杰\0"
+"学\0"
+"學\0"
+"学家\0"
+"學家\0"
+"学里\0"
+"學裡\0"
+"孪\0"
+"孿\0"
+"宁\0"
+"寧\0"
+"宇宙志\0"
+"宇宙誌\0"
+"安沈铁路\0"
+"安瀋鐵路\0"
+"宋王台\0"
+"宋王臺\0"
+"宗周钟\0"
+"宗周鐘\0"
+"官历\0"
+"官曆\0"
+"官历史\0"
+"官歷史\0"
+"官地为采\0"
+"官地為寀\0"
+"定准\0"
+"定準\0"
+"定制\0"
+"定製\0"
+"宝\0"
+"寶\0"
+"宝历\0"
+"寶曆\0"
+"宝历史\0"
+"寶歷史\0"
+"宝里宝气\0"
+"寶裡寶氣\0"
+"宝鉴\0"
+"寶鑑\0"
+"实\0"
+"實\0"
+"实干\0"
+"實幹\0"
+"实累累\0"
+"實纍纍\0"
+"实验里\0"
+"實驗裡\0"
+"宠\0"
+"寵\0"
+"审\0"
+"審\0"
+"宣泄\0"
+"宣洩\0"
+"宦游\0"
+"宦遊\0"
+"宪\0"
+"憲\0"
+"宪法里\0"
+"憲法裡\0"
+"宫\0"
+"宮\0"
+"宫里\0"
+"宮裡\0"
+"宴游\0"
+"宴遊\0"
+"家丑\0"
+"家醜\0"
+"家仆\0"
+"家僕\0"
+"家伙\0"
+"傢伙\0"
+"家里\0"
+"家裡\0"
+"容范\0"
+"容範\0"
+"宽\0"
+"寬\0"
+"宽余\0"
+"寬餘\0"
+"宽松\0"
+"寬鬆\0"
+"宽松松\0"
+"寬鬆鬆\0"
+"宾\0"
+"賓\0"
+"寄托\0"
+"寄託\0"
+"密致\0"
+"密緻\0"
+"寇仇\0"
+"寇讎\0"
+"寇准\0"
+"寇準\0"
+"富余\0"
+"富餘\0"
+"寒栗\0"
+"寒慄\0"
+"寓禁于征\0"
+"寓禁於徵\0"
+"寝\0"
+"寢\0"
+"寡欲\0"
+"寡慾\0"
+"寮采\0"
+"寮寀\0"
+"寸发千金\0"
+"寸髮千金\0"
+"对\0"
+"對\0"
+"对不准\0"
+"對不準\0"
+"对准\0"
+"對準\0"
+"对准表\0"
+"對準錶\0"
+"对准钟\0"
+"對準鐘\0"
+"对准钟表\0"
+"對準鐘錶\0"
+"对华发\0"
+"對華發\0"
+"对折\0"
+"對摺\0"
+"对着干\0"
+"對着幹\0"
+"对表中\0"
+"對表中\0"
+"对表扬\0"
+"對表揚\0"
+"对表明\0"
+"對表明\0"
+"对表演\0"
+"對表演\0"
+"对表现\0"
+"對表現\0"
+"对表达\0"
+"對表達\0"
+"寺钟\0"
+"寺鐘\0"
+"寻\0"
+"尋\0"
+"导\0"
+"導\0"
+"导游\0"
+"導遊\0"
+"寿\0"
+"壽\0"
+"寿面\0"
+"壽麵\0"
+"封为后\0"
+"封為后\0"
+"封面里\0"
+"封面裡\0"
+"射雕\0"
+"射鵰\0"
+"将\0"
+"將\0"
+"小仆\0"
+"小僕\0"
+"小只\0"
+"小隻\0"
+"小只会\0"
+"小只會\0"
+"小型钟\0"
+"小型鐘\0"
+"小型钟表\0"
+"小型鐘錶\0"
+"小型钟表面\0"
+"小型鐘表面\0"
+"小型钟面\0"
+"小型鐘面\0"
+"小时里\0"
+"小時裡\0"
+"小米面\0"
+"小米麵\0"
+"少采\0"
+"少採\0"
+"尔\0"
+"爾\0"
+"尔冬升\0"
+"爾冬陞\0"
+"尘\0"
+"塵\0"
+"尝\0"
+"嘗\0"
+"尧\0"
+"堯\0"
+"就范\0"
+"就範\0"
+"就里\0"
+"就裡\0"
+"尴\0"
+"尷\0"
+"尸\0"
+"屍\0"
+"尸居余气\0"
+"尸居餘氣\0"
+"尸弃佛\0"
+"尸棄佛\0"
+"尸禄\0"
+"尸祿\0"
+"尸罗\0"
+"尸羅\0"
+"尸罗精舍\0"
+"尸羅精舍\0"
+"尸谏\0"
+"尸諫\0"
+"尸鸠\0"
+"尸鳩\0"
+"尽\0"
+"盡\0"
+"尽先\0"
+"儘先\0"
+"尽其所有\0"
+"儘其所有\0"
+"尽可能\0"
+"儘可能\0"
+"尽尽\0"
+"儘儘\0"
+"尽快\0"
+"儘快\0"
+"尽早\0"
+"儘早\0"
+"尽是\0"
+"儘是\0"
+"尽管\0"
+"儘管\0"
+"尽自\0"
+"儘自\0"
+"尽速\0"
+"儘速\0"
+"尽量\0"
+"儘量\0"
+"局促\0"
+"侷促\0"
+"局蹐\0"
+"跼蹐\0"
+"局躅\0"
+"跼躅\0"
+"局里\0"
+"局裡\0"
+"层\0"
+"層\0"
+"屉\0"
+"屜\0"
+"届\0"
+"屆\0"
+"屋梁\0"
+"屋樑\0"
+"屋里\0"
+"屋裡\0"
+"屏风后\0"
+"屏風後\0"
+"属\0"
+"屬\0"
+"属托\0"
+"屬託\0"
+"屡\0"
+"屢\0"
+"屡顾尔仆\0"
+"屢顧爾僕\0"
+"屦\0"
+"屨\0"
+"屯扎\0"
+"屯紮\0"
+"屯里\0"
+"屯裡\0"
+"山岳\0"
+"山嶽\0"
+"山崩钟应\0"
+"山崩鐘應\0"
+"山梁\0"
+"山樑\0"
+"山棱\0"
+"山稜\0"
+"山羊胡\0"
+"山羊鬍\0"
+"山里有\0"
+"山裡有\0"
+"山里的\0"
+"山裡的\0"
+"山重水复\0"
+"山重水複\0"
+"屿\0"
+"嶼\0"
+"岁\0"
+"歲\0"
+"岁聿云暮\0"
+"歲聿云暮\0"
+"岂\0"
+"豈\0"
+"岖\0"
+"嶇\0"
+"岗\0"
+"崗\0"
+"岘\0"
+"峴\0"
+"岚\0"
+"嵐\0"
+"岛\0"
+"島\0"
+"岫岩\0"
+"岫巖\0"
+"岭\0"
+"嶺\0"
+"岱岳\0"
+"岱嶽\0"
+"岳岳\0"
+"嶽嶽\0"
+"岳麓\0"
+"嶽麓\0"
+"岿\0"
+"巋\0"
+"峄\0"
+"嶧\0"
+"峡\0"
+"峽\0"
+"峤\0"
+"嶠\0"
+"峥\0"
+"崢\0"
+"峦\0"
+"巒\0"
+"峰回\0"
+"峰迴\0"
+"崂\0"
+"嶗\0"
+"崃\0"
+"崍\0"
+"崭\0"
+"嶄\0"
+"嵘\0"
+"嶸\0"
+"嵝\0"
+"嶁\0"
+"嶒棱\0"
+"嶒稜\0"
+"巅\0"
+"巔\0"
+"巡回\0"
+"巡迴\0"
+"巡回医疗\0"
+"巡回醫療\0"
+"巡游\0"
+"巡遊\0"
+"工作台\0"
+"工作檯\0"
+"左冲右突\0"
+"左衝右突\0"
+"巧历\0"
+"巧曆\0"
+"巧历史\0"
+"巧歷史\0"
+"巧干\0"
+"巧幹\0"
+"巨制\0"
+"巨製\0"
+"巩\0"
+"鞏\0"
+"巯\0"
+"巰\0"
+"巴尔干\0"
+"巴爾幹\0"
+"巴而术\0"
+"巴而朮\0"
+"巷里\0"
+"巷裡\0"
+"币\0"
+"幣\0"
+"市里的\0"
+"市裡的\0"
+"布谷\0"
+"布穀\0"
+"布谷鸟\0"
+"布穀鳥\0"
+"布谷鸟钟\0"
+"布穀鳥鐘\0"
+"帅\0"
+"帥\0"
+"师\0"
+"師\0"
+"师范\0"
+"師範\0"
+"希伯来历\0"
+"希伯來曆\0"
+"希伯来历史\0"
+"希伯來歷史\0"
+"帏\0"
+"幃\0"
+"帐\0"
+"帳\0"
+"帘\0"
+"簾\0"
+"帜\0"
+"幟\0"
+"帝后台\0"
+"帝后臺\0"
+"带\0"
+"帶\0"
+"带余\0"
+"帶餘\0"
+"带发修行\0"
+"帶髮修行\0"
+"带征\0"
+"帶徵\0"
+"帧\0"
+"幀\0"
+"席卷\0"
+"席捲\0"
+"席子\0"
+"蓆子\0"
+"帮\0"
+"幫\0"
+"帱\0"
+"幬\0"
+"帻\0"
+"幘\0"
+"帼\0"
+"幗\0"
+"幂\0"
+"冪\0"
+"幅图里\0"
+"幅圖裡\0"
+"干上\0"
+"幹上\0"
+"干下去\0"
+"幹下去\0"
+"干不了\0"
+"幹不了\0"
+"干不成\0"
+"幹不成\0"
+"干丝\0"
+"乾絲\0"
+"干个\0"
+"幹個\0"
+"干个够\0"
+"乾個夠\0"
+"干么\0"
+"幹麼\0"
+"干乔\0"
+"乾喬\0"
+"干了\0"
+"幹了\0"
+"干事\0"
+"幹事\0"
+"干井\0"
+"乾井\0"
+"干些\0"
+"幹些\0"
+"干产\0"
+"乾產\0"
+"干亲\0"
+"乾親\0"
+"干什么\0"
+"幹什麼\0"
+"干仗\0"
+"幹仗\0"
+"干儿\0"
+"乾兒\0"
+"干冰\0"
+"乾冰\0"
+"干冷\0"
+"乾冷\0"
+"干净\0"
+"乾淨\0"
+"干凉\0"
+"乾涼\0"
+"干刍\0"
+"乾芻\0"
+"干刻版\0"
+"乾刻版\0"
+"干剥剥\0"
+"乾剝剝\0"
+"干办\0"
+"幹辦\0"
+"干劲\0"
+"幹勁\0"
+"干卦\0"
+"乾卦\0"
+"干号\0"
+"乾號\0"
+"干吏\0"
+"幹吏\0"
+"干吗\0"
+"幹嗎\0"
+"干呕\0"
+"乾嘔\0"
+"干员\0"
+"幹員\0"
+"干咳\0"
+"乾咳\0"
+"干咽\0"
+"乾咽\0"
+"干哕\0"
+"乾噦\0"
+"干哥\0"
+"乾哥\0"
+"干哭\0"
+"乾哭\0"
+"干唱\0"
+"乾唱\0"
+"干啥\0"
+"幹啥\0"
+"干啼\0"
+"乾啼\0"
+"干嘛\0"
+"幹嘛\0"
+"干嚎\0"
+"乾嚎\0"
+"干回付\0"
+"乾回付\0"
+"干圆洁净\0"
+"乾圓潔淨\0"
+"干坏事\0"
+"幹壞事\0"
+"干坞\0"
+"乾塢\0"
+"干大事\0"
+"幹大事\0"
+"干头\0"
+"幹頭\0"
+"干女\0"
+"乾女\0"
+"干奴才\0"
+"乾奴才\0"
+"干妈\0"
+"乾媽\0"
+"干妹\0"
+"乾妹\0"
+"干姊\0"
+"乾姊\0"
+"干姐\0"
+"乾姐\0"
+"干姜\0"
+"乾薑\0"
+"干娘\0"
+"乾娘\0"
+"干子\0"
+"乾子\0"
+"干季\0"
+"乾季\0"
+"干完\0"
+"幹完\0"
+"干家\0"
+"幹家\0"
+"干尸\0"
+"乾屍\0"
+"干屎橛\0"
+"乾屎橛\0"
+"干巴\0"
+"乾巴\0"
+"干干\0"
+"乾乾\0"
+"干干净净\0"
+"乾乾淨淨\0"
+"干式\0"
+"乾式\0"
+"干弟\0"
+"乾弟\0"
+"干当\0"
+"幹當\0"
+"干得\0"
+"幹得\0"
+"干急\0"
+"乾急\0"
+"干性\0"
+"乾性\0"
+"干性油\0"
+"幹性油\0"
+"干才\0"
+"幹才\0"
+"干打雷\0"
+"乾打雷\0"
+"干折\0"
+"乾折\0"
+"干拌面\0"
+"乾拌麵\0"
+"干掉\0"
+"幹掉\0"
+"干探\0"
+"幹探\0"
+"干撂台\0"
+"乾撂台\0"
+"干撇下\0"
+"乾撇下\0"
+"干擦\0"
+"乾擦\0"
+"干支剌\0"
+"乾支剌\0"
+"干支支\0"
+"乾支支\0"
+"干料\0"
+"乾料\0"
+"干旱\0"
+"乾旱\0"
+"干暖\0"
+"乾暖\0"
+"干材\0"
+"乾材\0"
+"干村沙\0"
+"乾村沙\0"
+"干杯\0"
+"乾杯\0"
+"干果\0"
+"乾果\0"
+"干枯\0"
+"乾枯\0"
+"干柴\0"
+"乾柴\0"
+"干柴烈火\0"
+"乾柴烈火\0"
+"干校\0"
+"幹校\0"
+"干梅\0"
+"乾梅\0"
+"干死\0"
+"乾死\0"
+"干池\0"
+"乾池\0"
+"干沟\0"
+"乾溝\0"
+"干没\0"
+"乾沒\0"
+"干洗\0"
+"乾洗\0"
+"干活\0"
+"幹活\0"
+"干流\0"
+"幹流\0"
+"干济\0"
+"幹濟\0"
+"干涩\0"
+"乾澀\0"
+"干涸\0"
+"乾涸\0"
+"干渠\0"
+"乾渠\0"
+"干渴\0"
+"乾渴\0"
+"干湿\0"
+"乾濕\0"
+"干漆\0"
+"乾漆\0"
+"干灯盏\0"
+"乾燈盞\0"
+"干热\0"
+"乾熱\0"
+"干熬\0"
+"乾熬\0"
+"干燥\0"
+"乾燥\0"
+"干父之蛊\0"
+"幹父之蠱\0"
+"干爸\0"
+"乾爸\0"
+"干爹\0"
+"乾爹\0"
+"干爽\0"
+"乾爽\0"
+"干片\0"
+"乾片\0"
+"干物\0"
+"乾物\0"
+"干球温度\0"
+"幹球溫度\0"
+"干甚么\0"
+"幹甚麼\0"
+"干生受\0"
+"乾生受\0"
+"干生子\0"
+"乾生子\0"
+"干田\0"
+"乾田\0"
+"干电\0"
+"乾電\0"
+"干略\0"
+"幹略\0"
+"干疥\0"
+"乾疥\0"
+"干瘦\0"
+"乾瘦\0"
+"干瘪\0"
+"乾癟\0"
+"干瘾\0"
+"乾癮\0"
+"干癣\0"
+"乾癬\0"
+"干白儿\0"
+"乾白兒\0"
+"干白葡萄酒\0"
+"乾白葡萄酒\0"
+"干的\0"
+"乾的\0"
+"干的事\0"
+"幹的事\0"
+"干的好事\0"
+"幹的好事\0"
+"干眼\0"
+"乾眼\0"
+"干瞪眼\0"
+"乾瞪眼\0"
+"干礼\0"
+"乾禮\0"
+"干稿\0"
+"乾稿\0"
+"干笑\0"
+"乾笑\0"
+"干等\0"
+"乾等\0"
+"干篾片\0"
+"乾篾片\0"
+"干粉\0"
+"乾粉\0"
+"干粮\0"
+"乾糧\0"
+"干糇\0"
+"乾餱\0"
+"干系\0"
+"干係\0"
+"干红葡萄酒\0"
+"乾紅葡萄酒\0"
+"干纲\0"
+"乾綱\0"
+"干线\0"
+"幹線\0"
+"干练\0"
+"幹練\0"
+"干细胞\0"
+"幹細胞\0"
+"干结\0"
+"乾結\0"
+"干绷\0"
+"乾繃\0"
+"干缺\0"
+"幹缺\0"
+"干群关系\0"
+"幹群關係\0"
+"干耗\0"
+"乾耗\0"
+"干肉片\0"
+"乾肉片\0"
+"干股\0"
+"乾股\0"
+"干肥\0"
+"乾肥\0"
+"干脆\0"
+"乾脆\0"
+"干脆面\0"
+"乾脆麵\0"
+"干花\0"
+"乾花\0"
+"干苔\0"
+"乾苔\0"
+"干茨腊\0"
+"乾茨臘\0"
+"干茶钱\0"
+"乾茶錢\0"
+"干草\0"
+"乾草\0"
+"干菜\0"
+"乾菜\0"
+"干营生\0"
+"幹營生\0"
+"干落\0"
+"乾落\0"
+"干薪\0"
+"乾薪\0"
+"干虔\0"
+"乾虔\0"
+"干蛊\0"
+"幹蠱\0"
+"干血浆\0"
+"乾血漿\0"
+"干衣\0"
+"乾衣\0"
+"干裂\0"
+"乾裂\0"
+"干警\0"
+"幹警\0"
+"干贝\0"
+"乾貝\0"
+"干货\0"
+"乾貨\0"
+"干起来\0"
+"幹起來\0"
+"干路\0"
+"幹路\0"
+"干躁\0"
+"乾躁\0"
+"干这\0"
+"幹這\0"
+"干逼\0"
+"乾逼\0"
+"干道\0"
+"幹道\0"
+"干部\0"
+"幹部\0"
+"干酪\0"
+"乾酪\0"
+"干酵母\0"
+"乾酵母\0"
+"干醋\0"
+"乾醋\0"
+"干重\0"
+"乾重\0"
+"干量\0"
+"乾量\0"
+"干锅\0"
+"乾鍋\0"
+"干阿奶\0"
+"乾阿奶\0"
+"干雷\0"
+"乾雷\0"
+"干霍乱\0"
+"乾霍亂\0"
+"干面\0"
+"乾麵\0"
+"干革命\0"
+"幹革命\0"
+"干颡\0"
+"乾顙\0"
+"干食\0"
+"乾食\0"
+"干饭\0"
+"乾飯\0"
+"干馆\0"
+"乾館\0"
+"干馏\0"
+"乾餾\0"
+"干鱼\0"
+"乾魚\0"
+"干鲜\0"
+"乾鮮\0"
+"平准\0"
+"平準\0"
+"平平当当\0"
+"平平當當\0"
+"年代里\0"
+"年代裡\0"
+"年历\0"
+"年曆\0"
+"年历史\0"
+"年歷史\0"
+"年历次\0"
+"年歷次\0"
+"年谷\0"
+"年穀\0"
+"年里\0"
+"年裡\0"
+"年鉴\0"
+"年鑑\0"
+"并\0"
+"並\0"
+"并一不二\0"
+"併一不二\0"
+"并为一体\0"
+"併為一體\0"
+"并为一家\0"
+"併為一家\0"
+"并入\0"
+"併入\0"
+"并兼\0"
+"併兼\0"
+"并到\0"
+"併到\0"
+"并力\0"
+"併力\0"
+"并发动\0"
+"並發動\0"
+"并发型模式\0"
+"併發型模式\0"
+"并发展\0"
+"並發展\0"
+"并发布\0"
+"並發布\0"
+"并发模式\0"
+"併發模式\0"
+"并发现\0"
+"並發現\0"
+"并发症\0"
+"併發症\0"
+"并发表\0"
+"並發表\0"
+"并发重症\0"
+"併發重症\0"
+"并叠\0"
+"併疊\0"
+"并合\0"
+"併合\0"
+"并名\0"
+"併名\0"
+"并吞\0"
+"併吞\0"
+"并吞下\0"
+"並吞下\0"
+"并拢\0"
+"併攏\0"
+"并曰入淀\0"
+"並曰入澱\0"
+"并案\0"
+"併案\0"
+"并科\0"
+"併科\0"
+"并线\0"
+"併線\0"
+"并网\0"
+"併網\0"
+"并肩子\0"
+"併肩子\0"
+"并行\0"
+"並行\0"
+"并购\0"
+"併購\0"
+"并骨\0"
+"併骨\0"
+"幸免\0"
+"倖免\0"
+"幸存\0"
+"倖存\0"
+"幸幸\0"
+"倖幸\0"
+"幸运胡\0"
+"幸運鬍\0"
+"广\0"
+"廣\0"
+"广征\0"
+"廣徵\0"
+"广播里\0"
+"廣播裡\0"
+"广舍\0"
+"廣捨\0"
+"庄\0"
+"莊\0"
+"庄内地方\0"
+"庄內地方\0"
+"庄里\0"
+"莊裡\0"
+"庆\0"
+"慶\0"
+"庆历\0"
+"慶曆\0"
+"庆历史\0"
+"慶歷史\0"
+"庆吊\0"
+"慶弔\0"
+"床席\0"
+"床蓆\0"
+"庐\0"
+"廬\0"
+"庑\0"
+"廡\0"
+"库\0"
+"庫\0"
+"应\0"
+"應\0"
+"应制得\0"
+"應制得\0"
+"应征\0"
+"應徵\0"
+"应钟\0"
+"應鐘\0"
+"店里\0"
+"店裡\0"
+"庙\0"
+"廟\0"
+"庙里\0"
+"廟裡\0"
+"府干\0"
+"府幹\0"
+"府干扰\0"
+"府干擾\0"
+"府干预\0"
+"府干預\0"
+"庞\0"
+"龐\0"
+"废\0"
+"廢\0"
+"废后\0"
+"廢后\0"
+"座钟\0"
+"座鐘\0"
+"廪\0"
+"廩\0"
+"延历\0"
+"延曆\0"
+"建筑前\0"
+"建築前\0"
+"建筑后\0"
+"建築後\0"
+"开\0"
+"開\0"
+"开发\0"
+"開發\0"
+"开吊\0"
+"開弔\0"
+"开哄\0"
+"開鬨\0"
+"开山辟谷\0"
+"開山闢谷\0"
+"开征\0"
+"開徵\0"
+"开辟\0"
+"開闢\0"
+"开采\0"
+"開採\0"
+"异\0"
+"異\0"
+"弃\0"
+"棄\0"
+"弃舍\0"
+"棄捨\0"
+"弄丑\0"
+"弄醜\0"
+"弄干\0"
+"弄乾\0"
+"弄松\0"
+"弄鬆\0"
+"弄脏胸\0"
+"弄髒胸\0"
+"弄鬼吊猴\0"
+"弄鬼弔猴\0"
+"弑\0"
+"弒\0"
+"引发\0"
+"引發\0"
+"引斗\0"
+"引鬥\0"
+"弘历\0"
+"弘曆\0"
+"弘历史\0"
+"弘歷史\0"
+"张\0"
+"張\0"
+"张三丰\0"
+"張三丰\0"
+"张乐于张徐\0"
+"張樂于張徐\0"
+"张勋\0"
+"張勳\0"
+"张杰\0"
+"張杰\0"
+"张柏芝\0"
+"張栢芝\0"
+"弥\0"
+"彌\0"
+"弥山遍野\0"
+"瀰山遍野\0"
+"弥弥\0"
+"瀰瀰\0"
+"弥漫\0"
+"瀰漫\0"
+"弪\0"
+"弳\0"
+"弯\0"
+"彎\0"
+"弹\0"
+"彈\0"
+"弹子台\0"
+"彈子檯\0"
+"弹珠台\0"
+"彈珠檯\0"
+"强\0"
+"強\0"
+"强制\0"
+"強制\0"
+"强制作用\0"
+"強制作用\0"
+"强奸\0"
+"強姦\0"
+"强干\0"
+"強幹\0"
+"归\0"
+"歸\0"
+"归余\0"
+"歸餘\0"
+"归并\0"
+"歸併\0"
+"当\0"
+"當\0"
+"当准\0"
+"當準\0"
+"当啷\0"
+"噹啷\0"
+"当当\0"
+"噹噹\0"
+"当当丁丁\0"
+"當當丁丁\0"
+"当当网\0"
+"當當網\0"
+"录\0"
+"錄\0"
+"录制\0"
+"錄製\0"
+"形单影只\0"
+"形單影隻\0"
+"彦\0"
+"彥\0"
+"影相吊\0"
+"影相弔\0"
+"彻\0"
+"徹\0"
+"往复式\0"
+"往復式\0"
+"往日无仇\0"
+"往日無讎\0"
+"往里\0"
+"往裡\0"
+"征令\0"
+"徵令\0"
+"征信\0"
+"徵信\0"
+"征候\0"
+"徵候\0"
+"征兆\0"
+"徵兆\0"
+"征兵\0"
+"徵兵\0"
+"征到\0"
+"徵到\0"
+"征募\0"
+"徵募\0"
+"征友\0"
+"徵友\0"
+"征发\0"
+"徵發\0"
+"征召\0"
+"徵召\0"
+"征名责实\0"
+"徵名責實\0"
+"征吏\0"
+"徵吏\0"
+"征启\0"
+"徵啟\0"
+"征咎\0"
+"徵咎\0"
+"征圣\0"
+"徵聖\0"
+"征士\0"
+"徵士\0"
+"征婚\0"
+"徵婚\0"
+"征实\0"
+"徵實\0"
+"征庸\0"
+"徵庸\0"
+"征引\0"
+"徵引\0"
+"征得\0"
+"徵得\0"
+"征怪\0"
+"徵怪\0"
+"征才\0"
+"徵才\0"
+"征招\0"
+"徵招\0"
+"征收\0"
+"徵收\0"
+"征效\0"
+"徵效\0"
+"征文\0"
+"徵文\0"
+"征求\0"
+"徵求\0"
+"征状\0"
+"徵狀\0"
+"征用\0"
+"徵用\0"
+"征税\0"
+"徵稅\0"
+"征稿\0"
+"徵稿\0"
+"征答\0"
+"徵答\0"
+"征结\0"
+"徵結\0"
+"征聘\0"
+"徵聘\0"
+"征训\0"
+"徵訓\0"
+"征询\0"
+"徵詢\0"
+"征调\0"
+"徵調\0"
+"征象\0"
+"徵象\0"
+"征购\0"
+"徵購\0"
+"征车\0"
+"徵車\0"
+"征辟\0"
+"徵辟\0"
+"征迹\0"
+"徵跡\0"
+"征选\0"
+"徵選\0"
+"征逐\0"
+"徵逐\0"
+"征集\0"
+"徵集\0"
+"征风召雨\0"
+"徵風召雨\0"
+"征验\0"
+"徵驗\0"
+"径\0"
+"徑\0"
+"待复\0"
+"待覆\0"
+"很丑\0"
+"很醜\0"
+"很准\0"
+"很準\0"
+"很凶\0"
+"很兇\0"
+"很干\0"
+"很乾\0"
+"很松\0"
+"很鬆\0"
+"律历志\0"
+"律曆志\0"
+"徐干\0"
+"徐幹\0"
+"徒托空言\0"
+"徒託空言\0"
+"徕\0"
+"徠\0"
+"得到回复\0"
+"得到回覆\0"
+"得力干将\0"
+"得力幹將\0"
+"御侮\0"
+"禦侮\0"
+"御制\0"
+"御製\0"
+"御寇\0"
+"禦寇\0"
+"御寒\0"
+"禦寒\0"
+"御岳山\0"
+"御嶽山\0"
+"御敌\0"
+"禦敵\0"
+"心余\0"
+"心餘\0"
+"心系一\0"
+"心繫一\0"
+"心系万\0"
+"心繫萬\0"
+"心系世\0"
+"心繫世\0"
+"心系东\0"
+"心繫東\0"
+"心系两\0"
+"心繫兩\0"
+"心系中\0"
+"心繫中\0"
+"心系乔\0"
+"心繫喬\0"
+"心系五\0"
+"心繫五\0"
+"心系京\0"
+"心繫京\0"
+"心系人\0"
+"心繫人\0"
+"心系他\0"
+"心繫他\0"
+"心系伊\0"
+"心繫伊\0"
+"心系众\0"
+"心繫眾\0"
+"心系传\0"
+"心繫傳\0"
+"心系何\0"
+"心繫何\0"
+"心系你\0"
+"心繫你\0"
+"心系健\0"
+"心繫健\0"
+"心系全\0"
+"心繫全\0"
+"心系兰\0"
+"心繫蘭\0"
+"心系农\0"
+"心繫农\0"
+"心系功\0"
+"心繫功\0"
+"心系动\0"
+"心繫動\0"
+"心系募\0"
+"心繫募\0"
+"心系北\0"
+"心繫北\0"
+"心系十\0"
+"心繫十\0"
+"心系千\0"
+"心繫千\0"
+"心系南\0"
+"心繫南\0"
+"心系台\0"
+"心繫台\0"
+"心系和\0"
+"心繫和\0"
+"心系哪\0"
+"心繫哪\0"
+"心系唐\0"
+"心繫唐\0"
+"心系嘱\0"
+"心繫囑\0"
+"心系四\0"
+"心繫四\0"
+"心系困\0"
+"心繫困\0"
+"心系国\0"
+"心繫國\0"
+"心系在\0"
+"心繫在\0"
+"心系地\0"
+"心繫地\0"
+"心系大\0"
+"心繫大\0"
+"心系天\0"
+"心繫天\0"
+"心系夫\0"
+"心繫夫\0"
+"心系奥\0"
+"心繫奧\0"
+"心系女\0"
+"心繫女\0"
+"心系她\0"
+"心繫她\0"
+"心系妇\0"
+"心繫婦\0"
+"心系妻\0"
+"心繫妻\0"
+"心系子\0"
+"心繫子\0"
+"心系它\0"
+"心繫它\0"
+"心系宣\0"
+"心繫宣\0"
+"心系家\0"
+"心繫家\0"
+"心系富\0"
+"心繫富\0"
+"心系小\0"
+"心繫小\0"
+"心系山\0"
+"心繫山\0"
+"心系川\0"
+"心繫川\0"
+"心系幼\0"
+"心繫幼\0"
+"心系广\0"
+"心繫廣\0"
+"心系彼\0"
+"心繫彼\0"
+"心系德\0"
+"心繫德\0"
+"心系您\0"
+"心繫您\0"
+"心系慈\0"
+"心繫慈\0"
+"心系我\0"
+"心繫我\0"
+"心系摩\0"
+"心繫摩\0"
+"心系故\0"
+"心繫故\0"
+"心系新\0"
+"心繫新\0"
+"心系日\0"
+"心繫日\0"
+"心系昌\0"
+"心繫昌\0"
+"心系晓\0"
+"心繫曉\0"
+"心系曼\0"
+"心繫曼\0"
+"心系林\0"
+"心繫林\0"
+"心系母\0"
+"心繫母\0"
+"心系民\0"
+"心繫民\0"
+"心系江\0"
+"心繫江\0"
+"心系汶\0"
+"心繫汶\0"
+"心系沈\0"
+"心繫沈\0"
+"心系沙\0"
+"心繫沙\0"
+"心系泰\0"
+"心繫泰\0"
+"心系浙\0"
+"心繫浙\0"
+"心系港\0"
+"心繫港\0"
+"心系湖\0"
+"心繫湖\0"
+"心系澳\0"
+"心繫澳\0"
+"心系灾\0"
+"心繫災\0"
+"心系父\0"
+"心繫父\0"
+"心系生\0"
+"心繫生\0"
+"心系病\0"
+"心繫病\0"
+"心系百\0"
+"心繫百\0"
+"心系的\0"
+"心繫的\0"
+"心系社\0"
+"心繫社\0"
+"心系祖\0"
+"心繫祖\0"
+"心系神\0"
+"心繫神\0"
+"心系红\0"
+"心繫紅\0"
+"心系美\0"
+"心繫美\0"
+"心系群\0"
+"心繫群\0"
+"心系老\0"
+"心繫老\0"
+"心系舞\0"
+"心繫舞\0"
+"心系英\0"
+"心繫英\0"
+"心系茶\0"
+"心繫茶\0"
+"心系西\0"
+"心繫西\0"
+"心系贫\0"
+"心繫貧\0"
+"心系输\0"
+"心繫輸\0"
+"心系近\0"
+"心繫近\0"
+"心系远\0"
+"心繫遠\0"
+"心系选\0"
+"心繫選\0"
+"心系重\0"
+"心繫重\0"
+"心系长\0"
+"心繫長\0"
+"心系阮\0"
+"心繫阮\0"
+"心系震\0"
+"心繫震\0"
+"心系非\0"
+"心繫非\0"
+"心系风\0"
+"心繫風\0"
+"心系香\0"
+"心繫香\0"
+"心系高\0"
+"心繫高\0"
+"心系麦\0"
+"心繫麥\0"
+"心系黄\0"
+"心繫黃\0"
+"心细如发\0"
+"心細如髮\0"
+"心脏\0"
+"心臟\0"
+"心脏痳痹\0"
+"心臟痲痺\0"
+"心荡\0"
+"心蕩\0"
+"心里\0"
+"心裡\0"
+"心里面\0"
+"心裏面\0"
+"心长发短\0"
+"心長髮短\0"
+"必须\0"
+"必須\0"
+"忆\0"
+"憶\0"
+"忏\0"
+"懺\0"
+"志哀\0"
+"誌哀\0"
+"志喜\0"
+"誌喜\0"
+"志庆\0"
+"誌慶\0"
+"志异\0"
+"誌異\0"
+"忙里\0"
+"忙裡\0"
+"忙里偷闲\0"
+"忙裡偷閒\0"
+"忠仆\0"
+"忠僕\0"
+"忧\0"
+"憂\0"
+"忧郁\0"
+"憂鬱\0"
+"快冲\0"
+"快衝\0"
+"快快当当\0"
+"快快當當\0"
+"忾\0"
+"愾\0"
+"怀\0"
+"懷\0"
+"怀里\0"
+"懷裡\0"
+"怀钟\0"
+"懷鐘\0"
+"态\0"
+"態\0"
+"怂\0"
+"慫\0"
+"怃\0"
+"憮\0"
+"怄\0"
+"慪\0"
+"怅\0"
+"悵\0"
+"怆\0"
+"愴\0"
+"怎么干\0"
+"怎麼幹\0"
+"怒发冲冠\0"
+"怒髮衝冠\0"
+"怒气冲天\0"
+"怒氣衝天\0"
+"怒火冲天\0"
+"怒火衝天\0"
+"怜\0"
+"憐\0"
+"思如泉涌\0"
+"思如泉湧\0"
+"急冲而下\0"
+"急衝而下\0"
+"性别扭曲\0"
+"性別扭曲\0"
+"性征\0"
+"性徵\0"
+"性欲\0"
+"性慾\0"
+"怨气冲天\0"
+"怨氣衝天\0"
+"怪里怪气\0"
+"怪裡怪氣\0"
+"怫郁\0"
+"怫鬱\0"
+"总\0"
+"總\0"
+"总数只\0"
+"總數只\0"
+"总数里\0"
+"總數裡\0"
+"总裁制\0"
+"總裁制\0"
+"怼\0"
+"懟\0"
+"怿\0"
+"懌\0"
+"恂栗\0"
+"恂慄\0"
+"恋\0"
+"戀\0"
+"恋恋不舍\0"
+"戀戀不捨\0"
+"恒\0"
+"恆\0"
+"息交绝游\0"
+"息交絕遊\0"
+"息谷\0"
+"息穀\0"
+"恳\0"
+"懇\0"
+"恳托\0"
+"懇託\0"
+"恶\0"
+"惡\0"
+"恶仆\0"
+"惡僕\0"
+"恶心\0"
+"噁心\0"
+"恶斗\0"
+"惡鬥\0"
+"恶直丑正\0"
+"惡直醜正\0"
+"恸\0"
+"慟\0"
+"恹\0"
+"懨\0"
+"恺\0"
+"愷\0"
+"恻\0"
+"惻\0"
+"恼\0"
+"惱\0"
+"恽\0"
+"惲\0"
+"悒郁\0"
+"悒鬱\0"
+"悠悠荡荡\0"
+"悠悠蕩蕩\0"
+"悠游\0"
+"悠遊\0"
+"悠荡\0"
+"悠蕩\0"
+"悦\0"
+"悅\0"
+"悫\0"
+"愨\0"
+"悬\0"
+"懸\0"
+"悬挂\0"
+"懸掛\0"
+"悬梁\0"
+"懸樑\0"
+"悬臂梁\0"
+"懸臂樑\0"
+"悬钟\0"
+"懸鐘\0"
+"悭\0"
+"慳\0"
+"悯\0"
+"憫\0"
+"悲凄\0"
+"悲悽\0"
+"悲郁\0"
+"悲鬱\0"
+"悸栗\0"
+"悸慄\0"
+"情欲\0"
+"情慾\0"
+"惇朴\0"
+"惇樸\0"
+"惊\0"
+"驚\0"
+"惊栗\0"
+"驚慄\0"
+"惊赞\0"
+"驚讚\0"
+"惊钟\0"
+"驚鐘\0"
+"惧\0"
+"懼\0"
+"惨\0"
+"慘\0"
+"惨淡\0"
+"慘澹\0"
+"惩\0"
+"懲\0"
+"惩忿窒欲\0"
+"懲忿窒欲\0"
+"惫\0"
+"憊\0"
+"惬\0"
+"愜\0"
+"惭\0"
+"慚\0"
+"惮\0"
+"憚\0"
+"惯\0"
+"慣\0"
+"惴栗\0"
+"惴慄\0"
+"愈合\0"
+"癒合\0"
+"意大利面\0"
+"意大利麵\0"
+"愠\0"
+"慍\0"
+"愤\0"
+"憤\0"
+"愦\0"
+"憒\0"
+"愿\0"
+"願\0"
+"愿朴\0"
+"愿樸\0"
+"慈溪\0"
+"慈谿\0"
+"慌里慌张\0"
+"慌裡慌張\0"
+"慑\0"
+"懾\0"
+"懈松\0"
+"懈鬆\0"
+"懑\0"
+"懣\0"
+"懒\0"
+"懶\0"
+"懔\0"
+"懍\0"
+"懔栗\0"
+"懍慄\0"
+"懿范\0"
+"懿範\0"
+"戆\0"
+"戇\0"
+"戋\0"
+"戔\0"
+"戏\0"
+"戲\0"
+"戏里\0"
+"戲裡\0"
+"成于思\0"
+"成於思\0"
+"戗\0"
+"戧\0"
+"战\0"
+"戰\0"
+"战天斗地\0"
+"戰天鬥地\0"
+"战斗\0"
+"戰鬥\0"
+"战栗\0"
+"戰慄\0"
+"戬\0"
+"戩\0"
+"戬谷\0"
+"戩穀\0"
+"戯\0"
+"戱\0"
+"戴发含齿\0"
+"戴髮含齒\0"
+"户\0"
+"戶\0"
+"房里\0"
+"房裡\0"
+"所托\0"
+"所託\0"
+"扁拟谷盗虫\0"
+"扁擬穀盜蟲\0"
+"手冢治虫\0"
+"手塚治虫\0"
+"手折\0"
+"手摺\0"
+"手松\0"
+"手鬆\0"
+"手游\0"
+"手遊\0"
+"手表\0"
+"手錶\0"
+"手表决\0"
+"手表決\0"
+"手表态\0"
+"手表態\0"
+"手表现\0"
+"手表現\0"
+"手表达\0"
+"手表達\0"
+"手里\0"
+"手裡\0"
+"手里剑\0"
+"手裏劍\0"
+"手链\0"
+"手鍊\0"
+"才干\0"
+"才幹\0"
+"才干扰\0"
+"才干擾\0"
+"才干预\0"
+"才干預\0"
+"扎上\0"
+"紮上\0"
+"扎下\0"
+"紮下\0"
+"扎囮\0"
+"紮囮\0"
+"扎好\0"
+"紮好\0"
+"扎实\0"
+"紮實\0"
+"扎寨\0"
+"紮寨\0"
+"扎带子\0"
+"紮帶子\0"
+"扎成\0"
+"紮成\0"
+"扎根\0"
+"紮根\0"
+"扎紧\0"
+"紮緊\0"
+"扎脚\0"
+"紮腳\0"
+"扎营\0"
+"紮營\0"
+"扎裹\0"
+"紮裹\0"
+"扎诈\0"
+"紮詐\0"
+"扎起\0"
+"紮起\0"
+"扎铁\0"
+"紮鐵\0"
+"扑\0"
+"撲\0"
+"扑冬\0"
+"撲鼕\0"
+"扑咚\0"
+"撲鼕\0"
+"扑咚咚\0"
+"撲鼕鼕\0"
+"扑挞\0"
+"扑撻\0"
+"打出吊入\0"
+"打出弔入\0"
+"打卡钟\0"
+"打卡鐘\0"
+"打卤\0"
+"打滷\0"
+"打干\0"
+"打幹\0"
+"打干哕\0"
+"打乾噦\0"
+"打斗\0"
+"打鬥\0"
+"打断发\0"
+"打斷發\0"
+"打谷\0"
+"打穀\0"
+"打钟\0"
+"打鐘\0"
+"打风后\0"
+"打風後\0"
+"托买\0"
+"託買\0"
+"托了\0"
+"託了\0"
+"托事\0"
+"託事\0"
+"托交\0"
+"託交\0"
+"托付\0"
+"託付\0"
+"托儿\0"
+"託兒\0"
+"托克逊\0"
+"託克遜\0"
+"托卖\0"
+"託賣\0"
+"托古讽今\0"
+"託古諷今\0"
+"托名\0"
+"託名\0"
+"托命\0"
+"託命\0"
+"托咎\0"
+"託咎\0"
+"托孤\0"
+"託孤\0"
+"托庇\0"
+"託庇\0"
+"托故\0"
+"託故\0"
+"托梦\0"
+"託夢\0"
+"托疾\0"
+"託疾\0"
+"托病\0"
+"託病\0"
+"托管\0"
+"託管\0"
+"托管国\0"
+"托管國\0"
+"托言\0"
+"託言\0"
+"托词\0"
+"託詞\0"
+"托身\0"
+"託身\0"
+"托辞\0"
+"託辭\0"
+"托过\0"
+"託過\0"
+"托运\0"
+"託運\0"
+"托里县\0"
+"託里縣\0"
+"托附\0"
+"託附\0"
+"扛大梁\0"
+"扛大樑\0"
+"执\0"
+"執\0"
+"扩\0"
+"擴\0"
+"扪\0"
+"捫\0"
+"扫\0"
+"掃\0"
+"扫荡\0"
+"掃蕩\0"
+"扬\0"
+"揚\0"
+"扯面\0"
+"扯麵\0"
+"扰\0"
+"擾\0"
+"扶余\0"
+"扶餘\0"
+"批准确定\0"
+"批准確定\0"
+"批复\0"
+"批覆\0"
+"批斗\0"
+"批鬥\0"
+"批注\0"
+"批註\0"
+"扼肮\0"
+"搤肮\0"
+"扼肮拊背\0"
+"搤肮拊背\0"
+"抑郁\0"
+"抑鬱\0"
+"抓奸\0"
+"抓姦\0"
+"抓斗\0"
+"抓鬥\0"
+"抗御\0"
+"抗禦\0"
+"折冲\0"
+"折衝\0"
+"折叠\0"
+"摺疊\0"
+"折台\0"
+"摺檯\0"
+"折奏\0"
+"摺奏\0"
+"折子\0"
+"摺子\0"
+"折子戏\0"
+"折子戲\0"
+"折尺\0"
+"摺尺\0"
+"折扇\0"
+"摺扇\0"
+"折梯\0"
+"摺梯\0"
+"折椅\0"
+"摺椅\0"
+"折痕\0"
+"摺痕\0"
+"折篷\0"
+"摺篷\0"
+"折纸\0"
+"摺紙\0"
+"折裙\0"
+"摺裙\0"
+"抚\0"
+"撫\0"
+"抛\0"
+"拋\0"
+"抟\0"
+"摶\0"
+"抠\0"
+"摳\0"
+"抡\0"
+"掄\0"
+"抢\0"
+"搶\0"
+"护\0"
+"護\0"
+"护发\0"
+"護髮\0"
+"报\0"
+"報\0"
+"披发\0"
+"披髮\0"
+"披头散发\0"
+"披頭散髮\0"
+"披榛采兰\0"
+"披榛採蘭\0"
+"抱朴而长吟兮\0"
+"抱朴而長吟兮\0"
+"抱素怀朴\0"
+"抱素懷樸\0"
+"抵御\0"
+"抵禦\0"
+"抵牾\0"
+"牴牾\0"
+"抵触\0"
+"牴觸\0"
+"抹干\0"
+"抹乾\0"
+"抽公签\0"
+"抽公籤\0"
+"抽干\0"
+"抽乾\0"
+"抽签\0"
+"抽籤\0"
+"抿发\0"
+"抿髮\0"
+"拂钟无声\0"
+"拂鐘無聲\0"
+"担\0"
+"擔\0"
+"担仔面\0"
+"擔仔麵\0"
+"担担面\0"
+"擔擔麵\0"
+"拆伙\0"
+"拆夥\0"
+"拈须\0"
+"拈鬚\0"
+"拉克施尔德钟\0"
+"拉克施爾德鐘\0"
+"拉纤\0"
+"拉縴\0"
+"拉面\0"
+"拉麵\0"
+"拉面无\0"
+"拉面無\0"
+"拌面\0"
+"拌麵\0"
+"拓朴\0"
+"拓樸\0"
+"拔发\0"
+"拔髮\0"
+"拔须\0"
+"拔鬚\0"
+"拗别\0"
+"拗彆\0"
+"拙朴\0"
+"拙樸\0"
+"拚舍\0"
+"拚捨\0"
+"拜托\0"
+"拜託\0"
+"拟\0"
+"擬\0"
+"拢\0"
+"攏\0"
+"拣\0"
+"揀\0"
+"拥\0"
+"擁\0"
+"拦\0"
+"攔\0"
+"拧\0"
+"擰\0"
+"拧干\0"
+"擰乾\0"
+"拨\0"
+"撥\0"
+"拨谷\0"
+"撥穀\0"
+"择\0"
+"擇\0"
+"括发\0"
+"括髮\0"
+"拭干\0"
+"拭乾\0"
+"拳局\0"
+"拳跼\0"
+"拼斗\0"
+"拼鬥\0"
+"拾沈\0"
+"拾瀋\0"
+"拿准\0"
+"拿準\0"
+"拿破仑\0"
+"拿破崙\0"
+"挂\0"
+"掛\0"
+"挂历\0"
+"掛曆\0"
+"挂名\0"
+"掛名\0"
+"挂钩\0"
+"掛鈎\0"
+"挂面\0"
+"掛麵\0"
+"挌斗\0"
+"挌鬥\0"
+"挑大梁\0"
+"挑大樑\0"
+"挑斗\0"
+"挑鬥\0"
+"挚\0"
+"摯\0"
+"挛\0"
+"攣\0"
+"挝\0"
+"撾\0"
+"挞\0"
+"撻\0"
+"挟\0"
+"挾\0"
+"挠\0"
+"撓\0"
+"挡\0"
+"擋\0"
+"挢\0"
+"撟\0"
+"挣\0"
+"掙\0"
+"挤\0"
+"擠\0"
+"挥\0"
+"揮\0"
+"挥手表\0"
+"揮手表\0"
+"挽曲\0"
+"輓曲\0"
+"挽歌\0"
+"輓歌\0"
+"挽联\0"
+"輓聯\0"
+"挽词\0"
+"輓詞\0"
+"挽诗\0"
+"輓詩\0"
+"挽车\0"
+"輓車\0"
+"挽输\0"
+"輓輸\0"
+"挽辞\0"
+"輓辭\0"
+"捆扎\0"
+"綑紮\0"
+"捉发\0"
+"捉髮\0"
+"捉奸\0"
+"捉姦\0"
+"捉奸党\0"
+"捉奸黨\0"
+"捉奸细\0"
+"捉奸細\0"
+"捉奸贼\0"
+"捉奸賊\0"
+"捍御\0"
+"捍禦\0"
+"捏面人\0"
+"捏麵人\0"
+"捞\0"
+"撈\0"
+"捞干\0"
+"撈乾\0"
+"捞面\0"
+"撈麵\0"
+"损\0"
+"損\0"
+"捡\0"
+"撿\0"
+"换\0"
+"換\0"
+"换只\0"
+"換隻\0"
+"换签\0"
+"換籤\0"
+"捣\0"
+"搗\0"
+"捣鬼吊白\0"
+"搗鬼弔白\0"
+"据\0"
+"據\0"
+"据云\0"
+"據云\0"
+"捵面\0"
+"捵麵\0"
+"捶炼\0"
+"捶鍊\0"
+"授勋\0"
+"授勳\0"
+"授时历\0"
+"授時曆\0"
+"排干\0"
+"排乾\0"
+"排干部\0"
+"排幹部\0"
+"排骨面\0"
+"排骨麵\0"
+"掣签\0"
+"掣籤\0"
+"推情准理\0"
+"推情準理\0"
+"推托\0"
+"推託\0"
+"推托之词\0"
+"推托之詞\0"
+"掳\0"
+"擄\0"
+"掴\0"
+"摑\0"
+"掷\0"
+"擲\0"
+"掸\0"
+"撣\0"
+"掺\0"
+"摻\0"
+"掼\0"
+"摜\0"
+"提子干\0"
+"提子乾\0"
+"提心吊胆\0"
+"提心弔膽\0"
+"提摩太后书\0"
+"提摩太後書\0"
+"提高后\0"
+"提高後\0"
+"握发\0"
+"握髮\0"
+"揩干\0"
+"揩乾\0"
+"揪发\0"
+"揪髮\0"
+"揪采\0"
+"揪採\0"
+"揪须\0"
+"揪鬚\0"
+"揭丑\0"
+"揭醜\0"
+"揽\0"
+"攬\0"
+"揿\0"
+"撳\0"
+"搀\0"
+"攙\0"
+"搁\0"
+"擱\0"
+"搂\0"
+"摟\0"
+"搅\0"
+"攪\0"
+"搋面\0"
+"搋麵\0"
+"搏斗\0"
+"搏鬥\0"
+"搬斗\0"
+"搬鬥\0"
+"搭伙\0"
+"搭夥\0"
+"搭干铺\0"
+"搭乾鋪\0"
+"携\0"
+"攜\0"
+"摄\0"
+"攝\0"
+"摄制\0"
+"攝製\0"
+"摅\0"
+"攄\0"
+"摆\0"
+"擺\0"
+"摆钟\0"
+"擺鐘\0"
+"摇\0"
+"搖\0"
+"摈\0"
+"擯\0"
+"摊\0"
+"攤\0"
+"摧坚获丑\0"
+"摧堅獲醜\0"
+"摭采\0"
+"摭採\0"
+"摸棱\0"
+"摸稜\0"
+"摸钟\0"
+"摸鐘\0"
+"撄\0"
+"攖\0"
+"撇吊\0"
+"撇弔\0"
+"撑\0"
+"撐\0"
+"撚须\0"
+"撚鬚\0"
+"撞钟\0"
+"撞鐘\0"
+"撞阵冲军\0"
+"撞陣衝軍\0"
+"撤并\0"
+"撤併\0"
+"撩斗\0"
+"撩鬥\0"
+"撵\0"
+"攆\0"
+"撷\0"
+"擷\0"
+"撸\0"
+"擼\0"
+"撺\0"
+"攛\0"
+"擀面\0"
+"擀麵\0"
+"操作钟\0"
+"操作鐘\0"
+"擞\0"
+"擻\0"
+"擢发\0"
+"擢髮\0"
+"擦干\0"
+"擦乾\0"
+"攒\0"
+"攢\0"
+"支干\0"
+"支幹\0"
+"支配欲\0"
+"支配慾\0"
+"收获\0"
+"收穫\0"
+"改征\0"
+"改徵\0"
+"改采\0"
+"改採\0"
+"放懞挣\0"
+"放懞掙\0"
+"放松\0"
+"放鬆\0"
+"放荡\0"
+"放蕩\0"
+"政斗\0"
+"政鬥\0"
+"敌\0"
+"敵\0"
+"敌忾同仇\0"
+"敵愾同讎\0"
+"教学钟\0"
+"教學鐘\0"
+"教范\0"
+"教範\0"
+"敛\0"
+"斂\0"
+"敢干\0"
+"敢幹\0"
+"敢斗了胆\0"
+"敢斗了膽\0"
+"散伙\0"
+"散夥\0"
+"散荡\0"
+"散蕩\0"
+"敦朴\0"
+"敦樸\0"
+"敬挽\0"
+"敬輓\0"
+"数\0"
+"數\0"
+"数只\0"
+"數隻\0"
+"数只会\0"
+"數只會\0"
+"数只包括\0"
+"數只包括\0"
+"数只可\0"
+"數只可\0"
+"数只含\0"
+"數只含\0"
+"数只在\0"
+"數只在\0"
+"数只应\0"
+"數只應\0"
+"数只是\0"
+"數只是\0"
+"数只有\0"
+"數只有\0"
+"数只比\0"
+"數只比\0"
+"数只能\0"
+"數只能\0"
+"数只限\0"
+"數只限\0"
+"数只需\0"
+"數只需\0"
+"数只须\0"
+"數只須\0"
+"数天后\0"
+"數天後\0"
+"数字钟\0"
+"數字鐘\0"
+"数字钟表\0"
+"數字鐘錶\0"
+"数罪并罚\0"
+"數罪併罰\0"
+"敲钟\0"
+"敲鐘\0"
+"整出剧\0"
+"整齣劇\0"
+"整出戏\0"
+"整齣戲\0"
+"整出电影\0"
+"整齣電影\0"
+"整发用品\0"
+"整髮用品\0"
+"整只\0"
+"整隻\0"
+"整风后\0"
+"整風後\0"
+"文学志\0"
+"文學誌\0"
+"文征明\0"
+"文徵明\0"
+"文思泉涌\0"
+"文思泉湧\0"
+"斋\0"
+"齋\0"
+"斓\0"
+"斕\0"
+"斗不过\0"
+"鬥不過\0"
+"斗丽\0"
+"鬥麗\0"
+"斗了\0"
+"鬥了\0"
+"斗争\0"
+"鬥爭\0"
+"斗争斗合\0"
+"鬥爭鬥合\0"
+"斗倒\0"
+"鬥倒\0"
+"斗兽\0"
+"鬥獸\0"
+"斗分子\0"
+"鬥分子\0"
+"斗别气\0"
+"鬥彆氣\0"
+"斗剑\0"
+"鬥劍\0"
+"斗力\0"
+"鬥力\0"
+"斗劲\0"
+"鬥勁\0"
+"斗勇\0"
+"鬥勇\0"
+"斗叠\0"
+"鬥疊\0"
+"斗叶儿\0"
+"鬥葉兒\0"
+"斗叶子\0"
+"鬥葉子\0"
+"斗合\0"
+"鬥合\0"
+"斗哄\0"
+"鬥鬨\0"
+"斗嘴\0"
+"鬥嘴\0"
+"斗地主\0"
+"鬥地主\0"
+"斗垮\0"
+"鬥垮\0"
+"斗士\0"
+"鬥士\0"
+"斗头\0"
+"鬥頭\0"
+"斗富\0"
+"鬥富\0"
+"斗巧\0"
+"鬥巧\0"
+"斗幌子\0"
+"鬥幌子\0"
+"斗弄\0"
+"鬥弄\0"
+"斗引\0"
+"鬥引\0"
+"斗彩\0"
+"鬥彩\0"
+"斗心眼\0"
+"鬥心眼\0"
+"斗志\0"
+"鬥志\0"
+"斗成\0"
+"鬥成\0"
+"斗战\0"
+"鬥戰\0"
+"斗打\0"
+"鬥打\0"
+"斗批改\0"
+"鬥批改\0"
+"斗技\0"
+"鬥技\0"
+"斗文\0"
+"鬥文\0"
+"斗斗\0"
+"鬥鬥\0"
+"斗智\0"
+"鬥智\0"
+"斗暴\0"
+"鬥暴\0"
+"斗来斗去\0"
+"鬥來鬥去\0"
+"斗武\0"
+"鬥武\0"
+"斗殴\0"
+"鬥毆\0"
+"斗气\0"
+"鬥氣\0"
+"斗法\0"
+"鬥法\0"
+"斗牌\0"
+"鬥牌\0"
+"斗牙拌齿\0"
+"鬥牙拌齒\0"
+"斗牙斗齿\0"
+"鬥牙鬥齒\0"
+"斗牛\0"
+"鬥牛\0"
+"斗犀台\0"
+"鬥犀臺\0"
+"斗犬\0"
+"鬥犬\0"
+"斗狗\0"
+"鬥狗\0"
+"斗狠\0"
+"鬥狠\0"
+"斗百草\0"
+"鬥百草\0"
+"斗眼\0"
+"鬥眼\0"
+"斗私批修\0"
+"鬥私批修\0"
+"斗而铸兵\0"
+"鬥而鑄兵\0"
+"斗而铸锥\0"
+"鬥而鑄錐\0"
+"斗胜\0"
+"鬥勝\0"
+"斗脚\0"
+"鬥腳\0"
+"斗舰\0"
+"鬥艦\0"
+"斗艳\0"
+"鬥豔\0"
+"斗茶\0"
+"鬥茶\0"
+"斗草\0"
+"鬥草\0"
+"斗蛐\0"
+"鬥蛐\0"
+"斗蟋蟀\0"
+"鬥蟋蟀\0"
+"斗话\0"
+"鬥話\0"
+"斗败\0"
+"鬥敗\0"
+"斗起\0"
+"鬥起\0"
+"斗趣\0"
+"鬥趣\0"
+"斗闲气\0"
+"鬥閒氣\0"
+"斗闷\0"
+"鬥悶\0"
+"斗雪红\0"
+"鬥雪紅\0"
+"斗风\0"
+"鬥風\0"
+"斗鱼\0"
+"鬥魚\0"
+"斗鸡\0"
+"鬥雞\0"
+"斗鸭\0"
+"鬥鴨\0"
+"斗鹌鹑\0"
+"鬥鵪鶉\0"
+"斗龙\0"
+"鬥龍\0"
+"斩\0"
+"斬\0"
+"斫雕为朴\0"
+"斫雕為樸\0"
+"断\0"
+"斷\0"
+"断发\0"
+"斷髮\0"
+"断发文身\0"
+"斷髮文身\0"
+"新历\0"
+"新曆\0"
+"新历史\0"
+"新歷史\0"
+"新干县\0"
+"新幹縣\0"
+"新扎\0"
+"新紮\0"
+"斲雕为朴\0"
+"斲雕為樸\0"
+"方便面\0"
+"方便麵\0"
+"方法里\0"
+"方法裡\0"
+"施舍\0"
+"施捨\0"
+"旁征博引\0"
+"旁徵博引\0"
+"旁注\0"
+"旁註\0"
+"旅游\0"
+"旅遊\0"
+"旋回\0"
+"旋迴\0"
+"旋松\0"
+"旋鬆\0"
+"族里\0"
+"族裡\0"
+"无\0"
+"無\0"
+"无业游民\0"
+"無業游民\0"
+"无余\0"
+"無餘\0"
+"无征不信\0"
+"無徵不信\0"
+"无梁楼盖\0"
+"無樑樓蓋\0"
+"日历\0"
+"日曆\0"
+"日历史\0"
+"日歷史\0"
+"日心历表\0"
+"日心曆表\0"
+"日志\0"
+"日誌\0"
+"日里\0"
+"日裡\0"
+"旧\0"
+"舊\0"
+"旧历\0"
+"舊曆\0"
+"旧历史\0"
+"舊歷史\0"
+"旧游\0"
+"舊遊\0"
+"旧表\0"
+"舊錶\0"
+"旧钟\0"
+"舊鐘\0"
+"旧钟表\0"
+"舊鐘錶\0"
+"旱干\0"
+"旱乾\0"
+"时\0"
+"時\0"
+"时钟\0"
+"時鐘\0"
+"时间不准\0"
+"時間不準\0"
+"旷\0"
+"曠\0"
+"昆仑\0"
+"崑崙\0"
+"昆冈\0"
+"崑岡\0"
+"昆剧\0"
+"崑劇\0"
+"昆山\0"
+"崑山\0"
+"昆嵛\0"
+"崑嵛\0"
+"昆承湖\0"
+"崑承湖\0"
+"昆曲\0"
+"崑曲\0"
+"昆腔\0"
+"崑腔\0"
+"昆苏\0"
+"崑蘇\0"
+"昆调\0"
+"崑調\0"
+"昊天不吊\0"
+"昊天不弔\0"
+"明征\0"
+"明徵\0"
+"明目张胆\0"
+"明目張胆\0"
+"明窗净几\0"
+"明窗淨几\0"
+"明范\0"
+"明範\0"
+"明鉴\0"
+"明鑑\0"
+"昙\0"
+"曇\0"
+"星历\0"
+"星曆\0"
+"星历史\0"
+"星歷史\0"
+"星期后\0"
+"星期後\0"
+"星露谷物语\0"
+"星露谷物語\0"
+"春游\0"
+"春遊\0"
+"春香斗学\0"
+"春香鬥學\0"
+"是发小\0"
+"是髮小\0"
+"昵称\0"
+"暱稱\0"
+"昼\0"
+"晝\0"
+"显\0"
+"顯\0"
+"显示表\0"
+"顯示錶\0"
+"显示表头\0"
+"顯示表頭\0"
+"显示表明\0"
+"顯示表明\0"
+"显示表格\0"
+"顯示表格\0"
+"显示表现\0"
+"顯示表現\0"
+"显示表示\0"
+"顯示表示\0"
+"显示表达\0"
+"顯示表達\0"
+"显示表面\0"
+"顯示表面\0"
+"显示钟\0"
+"顯示鐘\0"
+"显示钟表\0"
+"顯示鐘錶\0"
+"晃荡\0"
+"晃蕩\0"
+"晋\0"
+"晉\0"
+"晒\0"
+"曬\0"
+"晒干\0"
+"曬乾\0"
+"晒谷\0"
+"曬穀\0"
+"晓\0"
+"曉\0"
+"晔\0"
+"曄\0"
+"晕\0"
+"暈\0"
+"晖\0"
+"暉\0"
+"晚钟\0"
+"晚鐘\0"
+"晞发\0"
+"晞髮\0"
+"晨钟\0"
+"晨鐘\0"
+"普咚咚\0"
+"普鼕鼕\0"
+"晾干\0"
+"晾乾\0"
+"暂\0"
+"暫\0"
+"暗地里\0"
+"暗地裡\0"
+"暗斗\0"
+"暗鬥\0"
+"暗沟里\0"
+"暗溝裡\0"
+"暗里\0"
+"暗裡\0"
+"暧\0"
+"曖\0"
+"暴敛横征\0"
+"暴斂橫徵\0"
+"曲尘\0"
+"麴塵\0"
+"曲櫱\0"
+"麴櫱\0"
+"曲秀才\0"
+"麴秀才\0"
+"曲车\0"
+"麴車\0"
+"曲道士\0"
+"麴道士\0"
+"曲钱\0"
+"麴錢\0"
+"曲霉\0"
+"麴黴\0"
+"更仆难数\0"
+"更僕難數\0"
+"更签\0"
+"更籤\0"
+"更钟\0"
+"更鐘\0"
+"曾朴\0"
+"曾樸\0"
+"月历\0"
+"月曆\0"
+"月历史\0"
+"月歷史\0"
+"月球历表\0"
+"月球曆表\0"
+"月里来\0"
+"月裡來\0"
+"有事之无范\0"
+"有事之無範\0"
+"有仆\0"
+"有僕\0"
+"有余\0"
+"有餘\0"
+"有准\0"
+"有準\0"
+"有发头陀寺\0"
+"有髮頭陀寺\0"
+"有只\0"
+"有隻\0"
+"有只采\0"
+"有只採\0"
+"有回复\0"
+"有回覆\0"
+"有够赞\0"
+"有夠讚\0"
+"有征\0"
+"有徵\0"
+"有征战\0"
+"有征戰\0"
+"有征讨\0"
+"有征討\0"
+"有棱有角\0"
+"有稜有角\0"
+"朝钟\0"
+"朝鐘\0"
+"朝鲜于\0"
+"朝鮮於\0"
+"朦胧\0"
+"朦朧\0"
+"木偶戏扎\0"
+"木偶戲紮\0"
+"木制\0"
+"木製\0"
+"木材干馏\0"
+"木材乾餾\0"
+"木梁\0"
+"木樑\0"
+"木签\0"
+"木籤\0"
+"木钟\0"
+"木鐘\0"
+"未干\0"
+"未乾\0"
+"未干预\0"
+"未干預\0"
+"本出戏\0"
+"本齣戲\0"
+"本征\0"
+"本徵\0"
+"术\0"
+"術\0"
+"术虎高\0"
+"朮虎高\0"
+"术赤\0"
+"朮赤\0"
+"朱庆余\0"
+"朱慶餘\0"
+"朱理安历\0"
+"朱理安曆\0"
+"朱理安历史\0"
+"朱理安歷史\0"
+"朱砂\0"
+"硃砂\0"
+"朴修斯\0"
+"樸修斯\0"
+"朴厚\0"
+"樸厚\0"
+"朴学\0"
+"樸學\0"
+"朴实\0"
+"樸實\0"
+"朴念仁\0"
+"樸念仁\0"
+"朴拙\0"
+"樸拙\0"
+"朴樕\0"
+"樸樕\0"
+"朴父\0"
+"樸父\0"
+"朴直\0"
+"樸直\0"
+"朴素\0"
+"樸素\0"
+"朴讷\0"
+"樸訥\0"
+"朴质\0"
+"樸質\0"
+"朴鄙\0"
+"樸鄙\0"
+"朴重\0"
+"樸重\0"
+"朴野\0"
+"樸野\0"
+"朴钝\0"
+"樸鈍\0"
+"朴陋\0"
+"樸陋\0"
+"朴马\0"
+"樸馬\0"
+"朴鲁\0"
+"樸魯\0"
+"机\0"
+"機\0"
+"机械系\0"
+"機械系\0"
+"机械表\0"
+"機械錶\0"
+"机械钟\0"
+"機械鐘\0"
+"机械钟表\0"
+"機械鐘錶\0"
+"杀\0"
+"殺\0"
+"杂\0"
+"雜\0"
+"杂合面儿\0"
+"雜合麵兒\0"
+"杂志\0"
+"雜誌\0"
+"杂面\0"
+"雜麵\0"
+"权\0"
+"權\0"
+"杆枪\0"
+"桿槍\0"
+"杆秤\0"
+"桿秤\0"
+"杆菌\0"
+"桿菌\0"
+"李连杰\0"
+"李連杰\0"
+"材干\0"
+"材幹\0"
+"村落发\0"
+"村落發\0"
+"村里有\0"
+"村裡有\0"
+"村里的\0"
+"村裡的\0"
+"杜琪峰\0"
+"杜琪峯\0"
+"杜老志道\0"
+"杜老誌道\0"
+"杞宋无征\0"
+"杞宋無徵\0"
+"束发\0"
+"束髮\0"
+"杠\0"
+"槓\0"
+"杠杆\0"
+"槓桿\0"
+"杠毂\0"
+"杠轂\0"
+"条\0"
+"條\0"
+"条文里\0"
+"條文裡\0"
+"来\0"
+"來\0"
+"杨\0"
+"楊\0"
+"杨雅筑\0"
+"楊雅筑\0"
+"杩\0"
+"榪\0"
+"杯干\0"
+"杯乾\0"
+"杯面\0"
+"杯麵\0"
+"杰\0"
+"傑\0"
+"杰伦\0"
+"杰倫\0"
+"杰威尔\0"
+"杰威爾\0"
+"松一口气\0"
+"鬆一口氣\0"
+"松了\0"
+"鬆了\0"
+"松些\0"
+"鬆些\0"
+"松元音\0"
+"鬆元音\0"
+"松动\0"
+"鬆動\0"
+"松劲\0"
+"鬆勁\0"
+"松化\0"
+"鬆化\0"
+"松口\0"
+"鬆口\0"
+"松口镇\0"
+"松口鎮\0"
+"松喉\0"
+"鬆喉\0"
+"松土\0"
+"鬆土\0"
+"松宽\0"
+"鬆寬\0"
+"松开\0"
+"鬆開\0"
+"松弛\0"
+"鬆弛\0"
+"松快\0"
+"鬆快\0"
+"松懈\0"
+"鬆懈\0"
+"松手\0"
+"鬆手\0"
+"松掉\0"
+"鬆掉\0"
+"松散\0"
+"鬆散\0"
+"松松地\0"
+"鬆鬆地\0"
+"松柔\0"
+"鬆柔\0"
+"松气\0"
+"鬆氣\0"
+"松浮\0"
+"鬆浮\0"
+"松溪县\0"
+"松谿縣\0"
+"松紧\0"
+"鬆緊\0"
+"松绑\0"
+"鬆綁\0"
+"松缓\0"
+"鬆緩\0"
+"松耦合\0"
+"鬆耦合\0"
+"松脆\0"
+"鬆脆\0"
+"松脱\0"
+"鬆脫\0"
+"松蛋\0"
+"鬆蛋\0"
+"松软\0"
+"鬆軟\0"
+"松通\0"
+"鬆通\0"
+"松饼\0"
+"鬆餅\0"
+"板荡\0"
+"板蕩\0"
+"极\0"
+"極\0"
+"构\0"
+"構\0"
+"林宏岳\0"
+"林宏嶽\0"
+"林钟\0"
+"林鐘\0"
+"林鹅峰\0"
+"林鵞峰\0"
+"果子干\0"
+"果子乾\0"
+"果干\0"
+"果乾\0"
+"果累累\0"
+"果纍纍\0"
+"枝干\0"
+"枝幹\0"
+"枞\0"
+"樅\0"
+"枢\0"
+"樞\0"
+"枣\0"
+"棗\0"
+"枥\0"
+"櫪\0"
+"枨\0"
+"棖\0"
+"枪\0"
+"槍\0"
+"枪杆\0"
+"槍桿\0"
+"枫\0"
+"楓\0"
+"枭\0"
+"梟\0"
+"枯干\0"
+"枯乾\0"
+"架钟\0"
+"架鐘\0"
+"某只\0"
+"某隻\0"
+"染发\0"
+"染髮\0"
+"染发生\0"
+"染發生\0"
+"柜\0"
+"櫃\0"
+"柜台\0"
+"櫃檯\0"
+"柜里\0"
+"櫃裡\0"
+"柠\0"
+"檸\0"
+"查封后\0"
+"查封後\0"
+"柱梁\0"
+"柱樑\0"
+"柳诒征\0"
+"柳詒徵\0"
+"柽\0"
+"檉\0"
+"栀\0"
+"梔\0"
+"栅\0"
+"柵\0"
+"标\0"
+"標\0"
+"标准\0"
+"標準\0"
+"标志\0"
+"標誌\0"
+"标标致致\0"
+"標標致致\0"
+"标注\0"
+"標註\0"
+"标签\0"
+"標籤\0"
+"标致\0"
+"標緻\0"
+"栈\0"
+"棧\0"
+"栉\0"
+"櫛\0"
+"栉发工\0"
+"櫛髮工\0"
+"栊\0"
+"櫳\0"
+"栋\0"
+"棟\0"
+"栋梁\0"
+"棟樑\0"
+"栌\0"
+"櫨\0"
+"栎\0"
+"櫟\0"
+"栏\0"
+"欄\0"
+"树\0"
+"樹\0"
+"树干\0"
+"樹幹\0"
+"树林里\0"
+"樹林裡\0"
+"树梁\0"
+"樹樑\0"
+"栖\0"
+"棲\0"
+"栗冽\0"
+"慄冽\0"
+"栗栗\0"
+"慄慄\0"
+"校准\0"
+"校準\0"
+"样\0"
+"樣\0"
+"样范\0"
+"樣範\0"
+"格斗\0"
+"格鬥\0"
+"格范\0"
+"格範\0"
+"格里历\0"
+"格里曆\0"
+"格里高利历\0"
+"格里高利曆\0"
+"栾\0"
+"欒\0"
+"桂圆干\0"
+"桂圓乾\0"
+"框里\0"
+"框裡\0"
+"桌历\0"
+"桌曆\0"
+"桌历史\0"
+"桌歷史\0"
+"桌游\0"
+"桌遊\0"
+"桑干\0"
+"桑乾\0"
+"桠\0"
+"椏\0"
+"桡\0"
+"橈\0"
+"桢\0"
+"楨\0"
+"桢干\0"
+"楨幹\0"
+"档\0"
+"檔\0"
+"桤\0"
+"榿\0"
+"桥\0"
+"橋\0"
+"桥梁\0"
+"橋樑\0"
+"桦\0"
+"樺\0"
+"桧\0"
+"檜\0"
+"桨\0"
+"槳\0"
+"桩\0"
+"樁\0"
+"梁上\0"
+"樑上\0"
+"梁启超\0"
+"梁啓超\0"
+"梁柱\0"
+"樑柱\0"
+"梦\0"
+"夢\0"
+"梦游\0"
+"夢遊\0"
+"梦里\0"
+"夢裡\0"
+"梨干\0"
+"梨乾\0"
+"梯冲\0"
+"梯衝\0"
+"械斗\0"
+"械鬥\0"
+"械系\0"
+"械繫\0"
+"梼\0"
+"檮\0"
+"检\0"
+"檢\0"
+"棂\0"
+"欞\0"
+"棉制\0"
+"棉製\0"
+"棉里\0"
+"棉裡\0"
+"棒子面\0"
+"棒子麵\0"
+"棫朴\0"
+"棫樸\0"
+"森林里\0"
+"森林裡\0"
+"棱体\0"
+"稜體\0"
+"棱台\0"
+"稜台\0"
+"棱子\0"
+"稜子\0"
+"棱层\0"
+"稜層\0"
+"棱柱\0"
+"稜柱\0"
+"棱棱\0"
+"稜稜\0"
+"棱登\0"
+"稜登\0"
+"棱等登\0"
+"稜等登\0"
+"棱线\0"
+"稜線\0"
+"棱缝\0"
+"稜縫\0"
+"棱角\0"
+"稜角\0"
+"棱锥\0"
+"稜錐\0"
+"棱镜\0"
+"稜鏡\0"
+"棺材里\0"
+"棺材裡\0"
+"椁\0"
+"槨\0"
+"植发\0"
+"植髮\0"
+"椒面\0"
+"椒麵\0"
+"椟\0"
+"櫝\0"
+"椠\0"
+"槧\0"
+"椢\0"
+"槶\0"
+"椤\0"
+"欏\0"
+"椭\0"
+"橢\0"
+"椰枣干\0"
+"椰棗乾\0"
+"楼\0"
+"樓\0"
+"榄\0"
+"欖\0"
+"榇\0"
+"櫬\0"
+"榈\0"
+"櫚\0"
+"榉\0"
+"櫸\0"
+"榨干\0"
+"榨乾\0"
+"槛\0"
+"檻\0"
+"槟\0"
+"檳\0"
+"槠\0"
+"櫧\0"
+"模制\0"
+"模製\0"
+"模棱\0"
+"模稜\0"
+"模范\0"
+"模範\0"
+"模范三军\0"
+"模范三軍\0"
+"横\0"
+"橫\0"
+"横冲\0"
+"橫衝\0"
+"横峰县\0"
+"橫峯縣\0"
+"横征暴敛\0"
+"橫徵暴斂\0"
+"横梁\0"
+"橫樑\0"
+"樯\0"
+"檣\0"
+"樱\0"
+"櫻\0"
+"樵采\0"
+"樵採\0"
+"橥\0"
+"櫫\0"
+"橱\0"
+"櫥\0"
+"橹\0"
+"櫓\0"
+"橼\0"
+"櫞\0"
+"檩\0"
+"檁\0"
+"欢\0"
+"歡\0"
+"欤\0"
+"歟\0"
+"欧\0"
+"歐\0"
+"欧游\0"
+"歐遊\0"
+"欲令智昏\0"
+"慾令智昏\0"
+"欲壑难填\0"
+"慾壑難填\0"
+"欲念\0"
+"慾念\0"
+"欲海\0"
+"慾海\0"
+"欲海难填\0"
+"欲海難填\0"
+"欲火\0"
+"慾火\0"
+"欲障\0"
+"慾障\0"
+"欺蒙\0"
+"欺矇\0"
+"歌钟\0"
+"歌鐘\0"
+"正文里\0"
+"正文裡\0"
+"武斗\0"
+"武鬥\0"
+"歹斗\0"
+"歹鬥\0"
+"死里求生\0"
+"死裡求生\0"
+"死里逃生\0"
+"死裡逃生\0"
+"歼\0"
+"殲\0"
+"殁\0"
+"歿\0"
+"殇\0"
+"殤\0"
+"残\0"
+"殘\0"
+"残余\0"
+"殘餘\0"
+"残肴\0"
+"殘肴\0"
+"殒\0"
+"殞\0"
+"殓\0"
+"殮\0"
+"殖谷\0"
+"殖穀\0"
+"殚\0"
+"殫\0"
+"殡\0"
+"殯\0"
+"殴\0"
+"毆\0"
+"殴斗\0"
+"毆鬥\0"
+"殷师牛斗\0"
+"殷師牛鬥\0"
+"殷鉴\0"
+"殷鑑\0"
+"殿里\0"
+"殿裡\0"
+"殿钟自鸣\0"
+"殿鐘自鳴\0"
+"毁\0"
+"毀\0"
+"毁钟为铎\0"
+"毀鐘為鐸\0"
+"毂\0"
+"轂\0"
+"母丑\0"
+"母醜\0"
+"母范\0"
+"母範\0"
+"每只\0"
+"每隻\0"
+"毕\0"
+"畢\0"
+"毕生发展\0"
+"畢生發展\0"
+"毙\0"
+"斃\0"
+"毛发\0"
+"毛髮\0"
+"毛姜\0"
+"毛薑\0"
+"毡\0"
+"氈\0"
+"毫厘\0"
+"毫釐\0"
+"毫发\0"
+"毫髮\0"
+"毵\0"
+"毿\0"
+"氇\0"
+"氌\0"
+"气\0"
+"氣\0"
+"气冲斗牛\0"
+"氣沖斗牛\0"
+"气郁\0"
+"氣鬱\0"
+"氢\0"
+"氫\0"
+"氤郁\0"
+"氤鬱\0"
+"氩\0"
+"氬\0"
+"氲\0"
+"氳\0"
+"水准\0"
+"水準\0"
+"水并流\0"
+"水併流\0"
+"水来汤里去\0"
+"水來湯裡去\0"
+"水表\0"
+"水錶\0"
+"水里\0"
+"水裡\0"
+"永历\0"
+"永曆\0"
+"永历史\0"
+"永歷史\0"
+"永志不忘\0"
+"永誌不忘\0"
+"求知欲\0"
+"求知慾\0"
+"求签\0"
+"求籤\0"
+"汇\0"
+"匯\0"
+"汇刊\0"
+"彙刊\0"
+"汇算\0"
+"彙算\0"
+"汇纂\0"
+"彙纂\0"
+"汇辑\0"
+"彙輯\0"
+"汉\0"
+"漢\0"
+"汉弥登钟\0"
+"漢彌登鐘\0"
+"江并流\0"
+"江併流\0"
+"池里\0"
+"池裡\0"
+"污蔑\0"
+"污衊\0"
+"汤\0"
+"湯\0"
+"汤下面\0"
+"湯下麵\0"
+"汤卤\0"
+"汤滷\0"
+"汤团\0"
+"湯糰\0"
+"汤面\0"
+"湯麵\0"
+"汹\0"
+"洶\0"
+"汹涌\0"
+"洶湧\0"
+"沈丹客运\0"
+"瀋丹客運\0"
+"沈丹线\0"
+"瀋丹線\0"
+"沈丹铁路\0"
+"瀋丹鐵路\0"
+"沈丹高\0"
+"瀋丹高\0"
+"沈北\0"
+"瀋北\0"
+"沈吉\0"
+"瀋吉\0"
+"沈大线\0"
+"瀋大線\0"
+"沈大铁路\0"
+"瀋大鐵路\0"
+"沈大高速\0"
+"瀋大高速\0"
+"沈山线\0"
+"瀋山線\0"
+"沈山铁路\0"
+"瀋山鐵路\0"
+"沈州\0"
+"瀋州\0"
+"沈抚\0"
+"瀋撫\0"
+"沈水\0"
+"瀋水\0"
+"沈河\0"
+"瀋河\0"
+"沈海铁路\0"
+"瀋海鐵路\0"
+"沈海高速\0"
+"瀋海高速\0"
+"沈淀\0"
+"沈澱\0"
+"沈郁\0"
+"沈鬱\0"
+"沈阳\0"
+"瀋陽\0"
+"沉淀\0"
+"沉澱\0"
+"沉郁\0"
+"沉鬱\0"
+"沙琅\0"
+"沙瑯\0"
+"沙里淘金\0"
+"沙裡淘金\0"
+"沟\0"
+"溝\0"
+"沟谷\0"
+"溝谷\0"
+"没\0"
+"沒\0"
+"没事干\0"
+"沒事幹\0"
+"没准\0"
+"沒準\0"
+"没干\0"
+"沒幹\0"
+"没干没净\0"
+"沒乾沒淨\0"
+"没折至\0"
+"沒摺至\0"
+"没样范\0"
+"沒樣範\0"
+"沣\0"
+"灃\0"
+"沤\0"
+"漚\0"
+"沤郁\0"
+"漚鬱\0"
+"沥\0"
+"瀝\0"
+"沥干\0"
+"瀝乾\0"
+"沦\0"
+"淪\0"
+"沧\0"
+"滄\0"
+"沩\0"
+"溈\0"
+"沪\0"
+"滬\0"
+"河岳\0"
+"河嶽\0"
+"河里\0"
+"河裡\0"
+"油斗\0"
+"油鬥\0"
+"油泼面\0"
+"油潑麵\0"
+"油面\0"
+"油麵\0"
+"治愈\0"
+"治癒\0"
+"沾化\0"
+"霑化\0"
+"沾益\0"
+"霑益\0"
+"沿溯\0"
+"沿泝\0"
+"泄欲\0"
+"洩慾\0"
+"泛游\0"
+"泛遊\0"
+"泞\0"
+"濘\0"
+"泡制\0"
+"泡製\0"
+"泡面\0"
+"泡麵\0"
+"波发藻\0"
+"波髮藻\0"
+"波棱菜\0"
+"波稜菜\0"
+"注上\0"
+"註上\0"
+"注册\0"
+"註冊\0"
+"注失\0"
+"註失\0"
+"注定\0"
+"註定\0"
+"注明\0"
+"註明\0"
+"注标\0"
+"註標\0"
+"注生娘娘\0"
+"註生娘娘\0"
+"注疏\0"
+"註疏\0"
+"注脚\0"
+"註腳\0"
+"注解\0"
+"註解\0"
+"注记\0"
+"註記\0"
+"注译\0"
+"註譯\0"
+"注释\0"
+"注釋\0"
+"注里\0"
+"註裡\0"
+"注销\0"
+"註銷\0"
+"泪\0"
+"淚\0"
+"泪如泉涌\0"
+"淚如泉湧\0"
+"泪干\0"
+"淚乾\0"
+"泱郁\0"
+"泱鬱\0"
+"泳气钟\0"
+"泳氣鐘\0"
+"泶\0"
+"澩\0"
+"泷\0"
+"瀧\0"
+"泸\0"
+"瀘\0"
+"泺\0"
+"濼\0"
+"泻\0"
+"瀉\0"
+"泼\0"
+"潑\0"
+"泽\0"
+"澤\0"
+"泾\0"
+"涇\0"
+"洁\0"
+"潔\0"
+"洒\0"
+"灑\0"
+"洗发\0"
+"洗髮\0"
+"洗炼\0"
+"洗鍊\0"
+"洗练\0"
+"洗鍊\0"
+"洛钟东应\0"
+"洛鐘東應\0"
+"洞里\0"
+"洞裡\0"
+"洞里萨\0"
+"洞里薩\0"
+"洪范\0"
+"洪範\0"
+"洪钟\0"
+"洪鐘\0"
+"洼\0"
+"窪\0"
+"流征\0"
+"流徵\0"
+"流荡\0"
+"流蕩\0"
+"流风余俗\0"
+"流風餘俗\0"
+"流风余韵\0"
+"流風餘韻\0"
+"浃\0"
+"浹\0"
+"浅\0"
+"淺\0"
+"浅淀\0"
+"淺澱\0"
+"浆\0"
+"漿\0"
+"浇\0"
+"澆\0"
+"浈\0"
+"湞\0"
+"浊\0"
+"濁\0"
+"测\0"
+"測\0"
+"测不准\0"
+"測不準\0"
+"浍\0"
+"澮\0"
+"济\0"
+"濟\0"
+"浏\0"
+"瀏\0"
+"浑\0"
+"渾\0"
+"浑个\0"
+"渾箇\0"
+"浑朴\0"
+"渾樸\0"
+"浒\0"
+"滸\0"
+"浓\0"
+"濃\0"
+"浓发\0"
+"濃髮\0"
+"浔\0"
+"潯\0"
+"浚县\0"
+"濬縣\0"
+"浚州\0"
+"濬州\0"
+"浩浩荡荡\0"
+"浩浩蕩蕩\0"
+"浩荡\0"
+"浩蕩\0"
+"浪游\0"
+"浪遊\0"
+"浪荡\0"
+"浪蕩\0"
+"浮夸\0"
+"浮誇\0"
+"浮松\0"
+"浮鬆\0"
+"浮荡\0"
+"浮蕩\0"
+"海干\0"
+"海乾\0"
+"海淀山后\0"
+"海淀山後\0"
+"浸卤\0"
+"浸滷\0"
+"涂\0"
+"塗\0"
+"涂壮勋\0"
+"涂壯勳\0"
+"涂尔干\0"
+"涂爾幹\0"
+"涂敏恒\0"
+"涂敏恆\0"
+"涂泽民\0"
+"涂澤民\0"
+"涂绍煃\0"
+"涂紹煃\0"
+"涂谨申\0"
+"涂謹申\0"
+"涂长望\0"
+"涂長望\0"
+"涂鸿钦\0"
+"涂鴻欽\0"
+"涌上\0"
+"湧上\0"
+"涌入\0"
+"湧入\0"
+"涌出\0"
+"湧出\0"
+"涌向\0"
+"湧向\0"
+"涌来\0"
+"湧來\0"
+"涌水\0"
+"湧水\0"
+"涌泉\0"
+"湧泉\0"
+"涌现\0"
+"湧現\0"
+"涌起\0"
+"湧起\0"
+"涌进\0"
+"湧進\0"
+"涛\0"
+"濤\0"
+"涝\0"
+"澇\0"
+"涞\0"
+"淶\0"
+"涟\0"
+"漣\0"
+"涠\0"
+"潿\0"
+"涡\0"
+"渦\0"
+"涣\0"
+"渙\0"
+"涤\0"
+"滌\0"
+"润\0"
+"潤\0"
+"涧\0"
+"澗\0"
+"涨\0"
+"漲\0"
+"涩\0"
+"澀\0"
+"涩谷区\0"
+"澀谷區\0"
+"涳蒙\0"
+"涳濛\0"
+"涸干\0"
+"涸乾\0"
+"淀乃不耕之地\0"
+"澱乃不耕之地\0"
+"淀北片\0"
+"澱北片\0"
+"淀山\0"
+"澱山\0"
+"淀淀\0"
+"澱澱\0"
+"淀积\0"
+"澱積\0"
+"淀粉\0"
+"澱粉\0"
+"淀解物\0"
+"澱解物\0"
+"淀谓之滓\0"
+"澱謂之滓\0"
+"淋余土\0"
+"淋餘土\0"
+"淑范\0"
+"淑範\0"
+"淡蒙蒙\0"
+"淡濛濛\0"
+"淫欲\0"
+"淫慾\0"
+"淫荡\0"
+"淫蕩\0"
+"淬炼\0"
+"淬鍊\0"
+"深山何处钟\0"
+"深山何處鐘\0"
+"深山里\0"
+"深山裡\0"
+"淳朴\0"
+"淳樸\0"
+"渊\0"
+"淵\0"
+"渊淳岳峙\0"
+"淵淳嶽峙\0"
+"渊里\0"
+"淵裡\0"
+"渌\0"
+"淥\0"
+"渍\0"
+"漬\0"
+"渎\0"
+"瀆\0"
+"渐\0"
+"漸\0"
+"渑\0"
+"澠\0"
+"渔\0"
+"漁\0"
+"渖\0"
+"瀋\0"
+"渗\0"
+"滲\0"
+"渗漓\0"
+"滲灕\0"
+"渠冲\0"
+"渠衝\0"
+"温\0"
+"溫\0"
+"温洛克期\0"
+"溫洛克期\0"
+"港制\0"
+"港製\0"
+"游丝\0"
+"遊絲\0"
+"游乐\0"
+"遊樂\0"
+"游了\0"
+"遊了\0"
+"游人\0"
+"遊人\0"
+"游仙\0"
+"遊仙\0"
+"游伴\0"
+"遊伴\0"
+"游侠\0"
+"遊俠\0"
+"游兴\0"
+"遊興\0"
+"游冶\0"
+"遊冶\0"
+"游刃\0"
+"遊刃\0"
+"游动\0"
+"遊動\0"
+"游历\0"
+"遊歷\0"
+"游园\0"
+"遊園\0"
+"游子\0"
+"遊子\0"
+"游学\0"
+"遊學\0"
+"游客\0"
+"遊客\0"
+"游宦\0"
+"遊宦\0"
+"游山玩水\0"
+"遊山玩水\0"
+"游廊\0"
+"遊廊\0"
+"游必有方\0"
+"遊必有方\0"
+"游憩\0"
+"遊憩\0"
+"游戏\0"
+"遊戲\0"
+"游戏里\0"
+"遊戲裡\0"
+"游手好闲\0"
+"遊手好閒\0"
+"游方\0"
+"遊方\0"
+"游星\0"
+"遊星\0"
+"游春\0"
+"遊春\0"
+"游标卡尺\0"
+"遊標卡尺\0"
+"游民\0"
+"遊民\0"
+"游河\0"
+"遊河\0"
+"游牧\0"
+"遊牧\0"
+"游猎\0"
+"遊獵\0"
+"游玩\0"
+"遊玩\0"
+"游目骋怀\0"
+"遊目騁懷\0"
+"游离\0"
+"游離\0"
+"游程\0"
+"遊程\0"
+"游美学务\0"
+"遊美學務\0"
+"游船\0"
+"遊船\0"
+"游艇\0"
+"遊艇\0"
+"游艺\0"
+"遊藝\0"
+"游荡\0"
+"遊蕩\0"
+"游行\0"
+"遊行\0"
+"游街\0"
+"遊街\0"
+"游览\0"
+"遊覽\0"
+"游记\0"
+"遊記\0"
+"游说\0"
+"遊說\0"
+"游资\0"
+"遊資\0"
+"游走\0"
+"遊走\0"
+"游踪\0"
+"遊蹤\0"
+"游轮\0"
+"遊輪\0"
+"游逛\0"
+"遊逛\0"
+"游错\0"
+"遊錯\0"
+"游骑兵\0"
+"遊騎兵\0"
+"游魂\0"
+"遊魂\0"
+"湖里\0"
+"湖裡\0"
+"湘累\0"
+"湘纍\0"
+"湮郁\0"
+"湮鬱\0"
+"湾\0"
+"灣\0"
+"湿\0"
+"濕\0"
+"溃\0"
+"潰\0"
+"溅\0"
+"濺\0"
+"溆\0"
+"漵\0"
+"溟蒙\0"
+"溟濛\0"
+"溲面\0"
+"溲麵\0"
+"滃郁\0"
+"滃鬱\0"
+"滑借\0"
+"滑藉\0"
+"滗\0"
+"潷\0"
+"滚\0"
+"滾\0"
+"滞\0"
+"滯\0"
+"滟\0"
+"灩\0"
+"滠\0"
+"灄\0"
+"满\0"
+"滿\0"
+"满头洋发\0"
+"滿頭洋髮\0"
+"满满当当\0"
+"滿滿當當\0"
+"滢\0"
+"瀅\0"
+"滤\0"
+"濾\0"
+"滥\0"
+"濫\0"
+"滦\0"
+"灤\0"
+"滨\0"
+"濱\0"
+"滨田里佳子\0"
+"濱田里佳子\0"
+"滩\0"
+"灘\0"
+"滩席\0"
+"灘蓆\0"
+"滩涂\0"
+"灘涂\0"
+"漂荡\0"
+"漂蕩\0"
+"漓水\0"
+"灕水\0"
+"漓江\0"
+"灕江\0"
+"漓湘\0"
+"灕湘\0"
+"漓然\0"
+"灕然\0"
+"漕挽\0"
+"漕輓\0"
+"漠里\0"
+"漠裡\0"
+"漤\0"
+"灠\0"
+"漫卷\0"
+"漫捲\0"
+"漫游\0"
+"漫遊\0"
+"潆\0"
+"瀠\0"
+"潇\0"
+"瀟\0"
+"潋\0"
+"瀲\0"
+"潍\0"
+"濰\0"
+"潜\0"
+"潛\0"
+"潜意识里\0"
+"潛意識裡\0"
+"潜水表\0"
+"潛水錶\0"
+"潜水钟\0"
+"潛水鐘\0"
+"潜水钟表\0"
+"潛水鐘錶\0"
+"潭里\0"
+"潭裡\0"
+"潮涌\0"
+"潮湧\0"
+"潴\0"
+"瀦\0"
+"澄江县\0"
+"澂江縣\0"
+"澒蒙\0"
+"澒濛\0"
+"澜\0"
+"瀾\0"
+"澹台\0"
+"澹臺\0"
+"澹荡\0"
+"澹蕩\0"
+"激斗\0"
+"激鬥\0"
+"濑\0"
+"瀨\0"
+"濒\0"
+"瀕\0"
+"灏\0"
+"灝\0"
+"火山里\0"
+"火山裡\0"
+"火并\0"
+"火併\0"
+"火并非\0"
+"火並非\0"
+"火折子\0"
+"火摺子\0"
+"火签\0"
+"火籤\0"
+"灭\0"
+"滅\0"
+"灯\0"
+"燈\0"
+"灰蒙\0"
+"灰濛\0"
+"灰蒙蒙\0"
+"灰濛濛\0"
+"灵\0"
+"靈\0"
+"灵昆\0"
+"靈崑\0"
+"灾\0"
+"災\0"
+"灿\0"
+"燦\0"
+"炀\0"
+"煬\0"
+"炆面\0"
+"炆麵\0"
+"炉\0"
+"爐\0"
+"炒面\0"
+"炒麵\0"
+"炖\0"
+"燉\0"
+"炖制\0"
+"燉製\0"
+"炜\0"
+"煒\0"
+"炝\0"
+"熗\0"
+"炮制\0"
+"炮製\0"
+"炸酱面\0"
+"炸醬麵\0"
+"点\0"
+"點\0"
+"点个赞\0"
+"點個讚\0"
+"点半钟\0"
+"點半鐘\0"
+"点多钟\0"
+"點多鐘\0"
+"点札\0"
+"點劄\0"
+"点赞\0"
+"點讚\0"
+"点里\0"
+"點裡\0"
+"点里程\0"
+"點里程\0"
+"点钟\0"
+"點鐘\0"
+"炼\0"
+"煉\0"
+"炼冶\0"
+"鍊冶\0"
+"炼制\0"
+"煉製\0"
+"炼句\0"
+"鍊句\0"
+"炼字\0"
+"鍊字\0"
+"炼师\0"
+"鍊師\0"
+"炼度\0"
+"鍊度\0"
+"炼形\0"
+"鍊形\0"
+"炼气\0"
+"鍊氣\0"
+"炼汞\0"
+"鍊汞\0"
+"炼石\0"
+"鍊石\0"
+"炼贫\0"
+"鍊貧\0"
+"炼金术\0"
+"鍊金術\0"
+"炽\0"
+"熾\0"
+"烁\0"
+"爍\0"
+"烂\0"
+"爛\0"
+"烃\0"
+"烴\0"
+"烘制\0"
+"烘製\0"
+"烘干\0"
+"烘乾\0"
+"烛\0"
+"燭\0"
+"烟\0"
+"煙\0"
+"烟卷\0"
+"煙捲\0"
+"烟台\0"
+"煙臺\0"
+"烤卤\0"
+"烤滷\0"
+"烤干\0"
+"烤乾\0"
+"烦\0"
+"煩\0"
+"烧\0"
+"燒\0"
+"烧干\0"
+"燒乾\0"
+"烨\0"
+"燁\0"
+"烩\0"
+"燴\0"
+"烩面\0"
+"燴麵\0"
+"烫\0"
+"燙\0"
+"烫一个发\0"
+"燙一個髮\0"
+"烫一次发\0"
+"燙一次髮\0"
+"烫个发\0"
+"燙個髮\0"
+"烫发\0"
+"燙髮\0"
+"烫完发\0"
+"燙完髮\0"
+"烫次发\0"
+"燙次髮\0"
+"烫面\0"
+"燙麵\0"
+"烬\0"
+"燼\0"
+"烬余\0"
+"燼餘\0"
+"热\0"
+"熱\0"
+"烹制\0"
+"烹製\0"
+"焕\0"
+"煥\0"
+"焖\0"
+"燜\0"
+"焘\0"
+"燾\0"
+"焙干\0"
+"焙乾\0"
+"煎面\0"
+"煎麵\0"
+"照入签\0"
+"照入籤\0"
+"照相干片\0"
+"照相乾片\0"
+"煨干\0"
+"煨乾\0"
+"煮制\0"
+"煮製\0"
+"煮面\0"
+"煮麵\0"
+"熏习\0"
+"薰習\0"
+"熏心\0"
+"薰心\0"
+"熏染\0"
+"薰染\0"
+"熏沐\0"
+"薰沐\0"
+"熏陶\0"
+"薰陶\0"
+"熏风\0"
+"薰風\0"
+"熏香\0"
+"薰香\0"
+"熬制\0"
+"熬製\0"
+"燎发\0"
+"燎髮\0"
+"燕游\0"
+"燕遊\0"
+"爆发\0"
+"爆發\0"
+"爰定祥历\0"
+"爰定祥厤\0"
+"爱\0"
+"愛\0"
+"爱困\0"
+"愛睏\0"
+"爱河里花子\0"
+"愛河里花子\0"
+"爷\0"
+"爺\0"
+"爽荡\0"
+"爽蕩\0"
+"片言只语\0"
+"片言隻語\0"
+"片里\0"
+"片裡\0"
+"版图里\0"
+"版圖裡\0"
+"牍\0"
+"牘\0"
+"牙签\0"
+"牙籤\0"
+"牛只\0"
+"牛隻\0"
+"牦\0"
+"氂\0"
+"物欲\0"
+"物慾\0"
+"牵\0"
+"牽\0"
+"牵一发\0"
+"牽一髮\0"
+"牵系\0"
+"牽繫\0"
+"特制\0"
+"特製\0"
+"特制订\0"
+"特制訂\0"
+"特征\0"
+"特徵\0"
+"牺\0"
+"犧\0"
+"犊\0"
+"犢\0"
+"状\0"
+"狀\0"
+"犷\0"
+"獷\0"
+"犹\0"
+"猶\0"
+"犹如表\0"
+"猶如錶\0"
+"犹如钟\0"
+"猶如鐘\0"
+"犹如钟表\0"
+"猶如鐘錶\0"
+"狂并潮\0"
+"狂併潮\0"
+"狈\0"
+"狽\0"
+"狐借虎威\0"
+"狐藉虎威\0"
+"狞\0"
+"獰\0"
+"独\0"
+"獨\0"
+"独裁制\0"
+"獨裁制\0"
+"独辟蹊径\0"
+"獨闢蹊徑\0"
+"狭\0"
+"狹\0"
+"狮\0"
+"獅\0"
+"狯\0"
+"獪\0"
+"狰\0"
+"猙\0"
+"狱\0"
+"獄\0"
+"狱里\0"
+"獄裡\0"
+"狲\0"
+"猻\0"
+"猃\0"
+"獫\0"
+"猎\0"
+"獵\0"
+"猕\0"
+"獼\0"
+"猛冲\0"
+"猛衝\0"
+"猡\0"
+"玀\0"
+"猪\0"
+"豬\0"
+"猫\0"
+"貓\0"
+"猬\0"
+"蝟\0"
+"献\0"
+"獻\0"
+"献丑\0"
+"獻醜\0"
+"獭\0"
+"獺\0"
+"玉历\0"
+"玉曆\0"
+"玉历史\0"
+"玉歷史\0"
+"王余鱼\0"
+"王餘魚\0"
+"王鉴\0"
+"王鑑\0"
+"玑\0"
+"璣\0"
+"玛\0"
+"瑪\0"
+"玮\0"
+"瑋\0"
+"环\0"
+"環\0"
+"环游\0"
+"環遊\0"
+"现\0"
+"現\0"
+"玺\0"
+"璽\0"
+"珍肴异馔\0"
+"珍肴異饌\0"
+"珐\0"
+"琺\0"
+"珐琅\0"
+"琺瑯\0"
+"珑\0"
+"瓏\0"
+"班里\0"
+"班裡\0"
+"珲\0"
+"琿\0"
+"球台\0"
+"球檯\0"
+"理一个发\0"
+"理一個髮\0"
+"理一次发\0"
+"理一次髮\0"
+"理个发\0"
+"理個髮\0"
+"理发\0"
+"理髮\0"
+"理完发\0"
+"理完髮\0"
+"理次发\0"
+"理次髮\0"
+"琏\0"
+"璉\0"
+"琐\0"
+"瑣\0"
+"琴钟\0"
+"琴鐘\0"
+"琼\0"
+"瓊\0"
+"瑞征\0"
+"瑞徵\0"
+"瑶\0"
+"瑤\0"
+"瑶签\0"
+"瑤籤\0"
+"瑷\0"
+"璦\0"
+"璎\0"
+"瓔\0"
+"瓒\0"
+"瓚\0"
+"瓮安\0"
+"甕安\0"
+"瓯\0"
+"甌\0"
+"瓷制\0"
+"瓷製\0"
+"甜咸\0"
+"甜鹹\0"
+"甜水面\0"
+"甜水麵\0"
+"甜面酱\0"
+"甜麵醬\0"
+"生力面\0"
+"生力麵\0"
+"生华发\0"
+"生華髮\0"
+"生发\0"
+"生髮\0"
+"生发生\0"
+"生發生\0"
+"生姜\0"
+"生薑\0"
+"生物钟\0"
+"生物鐘\0"
+"生锈\0"
+"生鏽\0"
+"用法里\0"
+"用法裡\0"
+"甩发\0"
+"甩髮\0"
+"田里\0"
+"田裡\0"
+"甲胄\0"
+"甲冑\0"
+"电\0"
+"電\0"
+"电冲\0"
+"電衝\0"
+"电子制表\0"
+"電子製表\0"
+"电子表格\0"
+"電子表格\0"
+"电子钟\0"
+"電子鐘\0"
+"电子钟表\0"
+"電子鐘錶\0"
+"电影后\0"
+"電影後\0"
+"电影里\0"
+"電影裡\0"
+"电梯里\0"
+"電梯裡\0"
+"电波钟\0"
+"電波鐘\0"
+"电码表\0"
+"電碼表\0"
+"电表\0"
+"電錶\0"
+"电视台风\0"
+"電視台風\0"
+"电视里\0"
+"電視裡\0"
+"电钟\0"
+"電鐘\0"
+"男仆\0"
+"男僕\0"
+"画\0"
+"畫\0"
+"画里\0"
+"畫裡\0"
+"畅\0"
+"暢\0"
+"畅游\0"
+"暢遊\0"
+"界里\0"
+"界裡\0"
+"留发\0"
+"留髮\0"
+"留发展\0"
+"留發展\0"
+"留发生\0"
+"留發生\0"
+"留发行\0"
+"留發行\0"
+"留长发\0"
+"留長髮\0"
+"畴\0"
+"疇\0"
+"疏松\0"
+"疏鬆\0"
+"疑凶\0"
+"疑兇\0"
+"疑系\0"
+"疑係\0"
+"疖\0"
+"癤\0"
+"疗\0"
+"療\0"
+"疟\0"
+"瘧\0"
+"疠\0"
+"癘\0"
+"疡\0"
+"瘍\0"
+"疬\0"
+"癧\0"
+"疮\0"
+"瘡\0"
+"疯\0"
+"瘋\0"
+"疱\0"
+"皰\0"
+"疲困\0"
+"疲睏\0"
+"病余\0"
+"病餘\0"
+"病征\0"
+"病徵\0"
+"病愈\0"
+"病癒\0"
+"症结\0"
+"癥結\0"
+"痈\0"
+"癰\0"
+"痉\0"
+"痙\0"
+"痊愈\0"
+"痊癒\0"
+"痒\0"
+"癢\0"
+"痨\0"
+"癆\0"
+"痪\0"
+"瘓\0"
+"痫\0"
+"癇\0"
+"痳\0"
+"痲\0"
+"痳疯\0"
+"痳瘋\0"
+"痳痹\0"
+"痳痺\0"
+"瘅\0"
+"癉\0"
+"瘗\0"
+"瘞\0"
+"瘘\0"
+"瘺\0"
+"瘪\0"
+"癟\0"
+"瘫\0"
+"癱\0"
+"瘾\0"
+"癮\0"
+"瘿\0"
+"癭\0"
+"癞\0"
+"癩\0"
+"癣\0"
+"癬\0"
+"癫\0"
+"癲\0"
+"白净面皮\0"
+"白淨面皮\0"
+"白发\0"
+"白髮\0"
+"白发其事\0"
+"白發其事\0"
+"白干儿\0"
+"白乾兒\0"
+"白术\0"
+"白朮\0"
+"白朴\0"
+"白樸\0"
+"白粉面\0"
+"白粉麵\0"
+"白里透红\0"
+"白裡透紅\0"
+"白霉\0"
+"白黴\0"
+"百个\0"
+"百個\0"
+"百余\0"
+"百餘\0"
+"百只\0"
+"百隻\0"
+"百只够\0"
+"百只夠\0"
+"百只足够\0"
+"百只足夠\0"
+"百周后\0"
+"百周後\0"
+"百天后\0"
+"百天後\0"
+"百扎\0"
+"百紮\0"
+"百拙千丑\0"
+"百拙千醜\0"
+"百炼\0"
+"百鍊\0"
+"百科里\0"
+"百科裡\0"
+"百花历\0"
+"百花曆\0"
+"百花历史\0"
+"百花歷史\0"
+"百谷\0"
+"百穀\0"
+"的个中\0"
+"的箇中\0"
+"的发小\0"
+"的髮小\0"
+"的回复\0"
+"的回覆\0"
+"的图里\0"
+"的圖裡\0"
+"的山里\0"
+"的山裡\0"
+"的干将\0"
+"的幹將\0"
+"的钟\0"
+"的鐘\0"
+"的长发\0"
+"的長髮\0"
+"皆准\0"
+"皆準\0"
+"皆可作淀\0"
+"皆可作澱\0"
+"皇历\0"
+"皇曆\0"
+"皇历史\0"
+"皇歷史\0"
+"皇极历\0"
+"皇極曆\0"
+"皇极历史\0"
+"皇極歷史\0"
+"皑\0"
+"皚\0"
+"皓发\0"
+"皓髮\0"
+"皮制\0"
+"皮製\0"
+"皮松\0"
+"皮鬆\0"
+"皮肤\0"
+"皮膚\0"
+"皮里春秋\0"
+"皮裡春秋\0"
+"皮里阳秋\0"
+"皮裡陽秋\0"
+"皱\0"
+"皺\0"
+"皱折\0"
+"皺摺\0"
+"皲\0"
+"皸\0"
+"盆吊\0"
+"盆弔\0"
+"盈余\0"
+"盈餘\0"
+"盏\0"
+"盞\0"
+"盐\0"
+"鹽\0"
+"盐余\0"
+"鹽餘\0"
+"盐卤\0"
+"鹽滷\0"
+"盐打怎么咸\0"
+"鹽打怎麼鹹\0"
+"监\0"
+"監\0"
+"监制\0"
+"監製\0"
+"盒里\0"
+"盒裡\0"
+"盖\0"
+"蓋\0"
+"盗\0"
+"盜\0"
+"盗采\0"
+"盜採\0"
+"盗钟\0"
+"盜鐘\0"
+"盘\0"
+"盤\0"
+"盘回\0"
+"盤迴\0"
+"盘里\0"
+"盤裡\0"
+"盛赞\0"
+"盛讚\0"
+"盲干\0"
+"盲幹\0"
+"直冲\0"
+"直衝\0"
+"相克\0"
+"相剋\0"
+"相冲\0"
+"相衝\0"
+"相并\0"
+"相併\0"
+"相斗\0"
+"相鬥\0"
+"看准\0"
+"看準\0"
+"看法里\0"
+"看法裡\0"
+"看表\0"
+"看錶\0"
+"看钟\0"
+"看鐘\0"
+"真丑\0"
+"真醜\0"
+"真个\0"
+"真箇\0"
+"真凶\0"
+"真兇\0"
+"眦\0"
+"眥\0"
+"眼干\0"
+"眼乾\0"
+"眼眶里\0"
+"眼眶裡\0"
+"眼睛里\0"
+"眼睛裡\0"
+"眼里\0"
+"眼裡\0"
+"睁\0"
+"睜\0"
+"睐\0"
+"睞\0"
+"睑\0"
+"瞼\0"
+"睡游病\0"
+"睡遊病\0"
+"瞄准\0"
+"瞄準\0"
+"瞎蒙\0"
+"瞎矇\0"
+"瞒\0"
+"瞞\0"
+"瞩\0"
+"矚\0"
+"瞩托\0"
+"矚託\0"
+"瞳蒙\0"
+"瞳矇\0"
+"矜夸\0"
+"矜誇\0"
+"矫\0"
+"矯\0"
+"短发\0"
+"短髮\0"
+"短发生\0"
+"短發生\0"
+"石梁\0"
+"石樑\0"
+"石英钟\0"
+"石英鐘\0"
+"石英钟表\0"
+"石英鐘錶\0"
+"石钟\0"
+"石鐘\0"
+"矶\0"
+"磯\0"
+"矾\0"
+"礬\0"
+"矿\0"
+"礦\0"
+"砀\0"
+"碭\0"
+"码\0"
+"碼\0"
+"码码表\0"
+"碼碼表\0"
+"码表\0"
+"碼錶\0"
+"码表示\0"
+"碼表示\0"
+"研制\0"
+"研製\0"
+"砖\0"
+"磚\0"
+"砗\0"
+"硨\0"
+"砚\0"
+"硯\0"
+"砰当\0"
+"砰噹\0"
+"破鉴\0"
+"破鑑\0"
+"砺\0"
+"礪\0"
+"砻\0"
+"礱\0"
+"砻谷\0"
+"礱穀\0"
+"砾\0"
+"礫\0"
+"础\0"
+"礎\0"
+"硕\0"
+"碩\0"
+"硖\0"
+"硤\0"
+"硗\0"
+"磽\0"
+"硗确\0"
+"磽确\0"
+"硬干\0"
+"硬幹\0"
+"确\0"
+"確\0"
+"确系\0"
+"確係\0"
+"硷\0"
+"鹼\0"
+"碍\0"
+"礙\0"
+"碑志\0"
+"碑誌\0"
+"碗里\0"
+"碗裡\0"
+"碛\0"
+"磧\0"
+"碜\0"
+"磣\0"
+"碰钟\0"
+"碰鐘\0"
+"碱\0"
+"鹼\0"
+"磁制\0"
+"磁製\0"
+"磨制\0"
+"磨製\0"
+"磨炼\0"
+"磨鍊\0"
+"磨面\0"
+"磨麵\0"
+"磬钟\0"
+"磬鐘\0"
+"示范\0"
+"示範\0"
+"礼\0"
+"禮\0"
+"礼赞\0"
+"禮讚\0"
+"社里\0"
+"社裡\0"
+"祝发\0"
+"祝髮\0"
+"祝赞\0"
+"祝讚\0"
+"神游\0"
+"神遊\0"
+"神荼郁垒\0"
+"神荼鬱壘\0"
+"神雕\0"
+"神鵰\0"
+"祢\0"
+"禰\0"
+"祭吊\0"
+"祭弔\0"
+"祯\0"
+"禎\0"
+"祷\0"
+"禱\0"
+"祸\0"
+"禍\0"
+"禀\0"
+"稟\0"
+"禁欲\0"
+"禁慾\0"
+"禁欲主义\0"
+"禁欲主義\0"
+"禄\0"
+"祿\0"
+"禅\0"
+"禪\0"
+"离\0"
+"離\0"
+"禾谷\0"
+"禾穀\0"
+"秀发\0"
+"秀髮\0"
+"秀发动\0"
+"秀發動\0"
+"秀发展\0"
+"秀發展\0"
+"秀发布\0"
+"秀發布\0"
+"秀发村\0"
+"秀發村\0"
+"秀发现\0"
+"秀發現\0"
+"秀发生\0"
+"秀發生\0"
+"秀发表\0"
+"秀發表\0"
+"秀发起\0"
+"秀發起\0"
+"私下里\0"
+"私下裡\0"
+"私斗\0"
+"私鬥\0"
+"私欲\0"
+"私慾\0"
+"秃\0"
+"禿\0"
+"秃发\0"
+"禿髮\0"
+"秃妃之发\0"
+"禿妃之髮\0"
+"秆\0"
+"稈\0"
+"秋千\0"
+"鞦韆\0"
+"秋游\0"
+"秋遊\0"
+"种\0"
+"種\0"
+"种师中\0"
+"种師中\0"
+"种师道\0"
+"种師道\0"
+"种谷\0"
+"種穀\0"
+"科尼亚克期\0"
+"科尼亞克期\0"
+"科范\0"
+"科範\0"
+"秒钟\0"
+"秒鐘\0"
+"秤杆\0"
+"秤桿\0"
+"秦沈客运\0"
+"秦瀋客運\0"
+"积\0"
+"積\0"
+"积淀\0"
+"積澱\0"
+"积谷\0"
+"積穀\0"
+"积谷防饥\0"
+"積穀防饑\0"
+"积郁\0"
+"積鬱\0"
+"称\0"
+"稱\0"
+"称赞\0"
+"稱讚\0"
+"秽\0"
+"穢\0"
+"稀松\0"
+"稀鬆\0"
+"稆\0"
+"穭\0"
+"程十发\0"
+"程十髮\0"
+"税\0"
+"稅\0"
+"稣\0"
+"穌\0"
+"稳\0"
+"穩\0"
+"稳健的台风\0"
+"穩健的台風\0"
+"稳扎\0"
+"穩紮\0"
+"稻谷\0"
+"稻穀\0"
+"稽征\0"
+"稽徵\0"
+"穆棱\0"
+"穆稜\0"
+"穆罕默德历\0"
+"穆罕默德曆\0"
+"穆罕默德历史\0"
+"穆罕默德歷史\0"
+"穑\0"
+"穡\0"
+"穷\0"
+"窮\0"
+"穷发\0"
+"窮髮\0"
+"穷追不舍\0"
+"窮追不捨\0"
+"空余\0"
+"空餘\0"
+"空荡\0"
+"空蕩\0"
+"空荡荡\0"
+"空蕩蕩\0"
+"空蒙\0"
+"空濛\0"
+"空钟\0"
+"空鐘\0"
+"窃\0"
+"竊\0"
+"窃钟掩耳\0"
+"竊鐘掩耳\0"
+"窍\0"
+"竅\0"
+"窑\0"
+"窯\0"
+"窒欲\0"
+"窒慾\0"
+"窗帘\0"
+"窗簾\0"
+"窗明几净\0"
+"窗明几淨\0"
+"窜\0"
+"竄\0"
+"窝\0"
+"窩\0"
+"窝里\0"
+"窩裡\0"
+"窝里斗\0"
+"窩裡鬥\0"
+"窥\0"
+"窺\0"
+"窦\0"
+"竇\0"
+"窭\0"
+"窶\0"
+"立范\0"
+"立範\0"
+"竖\0"
+"豎\0"
+"竖起脊梁\0"
+"豎起脊梁\0"
+"竞\0"
+"競\0"
+"竞斗\0"
+"競鬥\0"
+"童仆\0"
+"童僕\0"
+"竹制\0"
+"竹製\0"
+"竹席\0"
+"竹蓆\0"
+"竹林之游\0"
+"竹林之遊\0"
+"竹溪县\0"
+"竹谿縣\0"
+"竹签\0"
+"竹籤\0"
+"笃\0"
+"篤\0"
+"笋\0"
+"筍\0"
+"笋干\0"
+"筍乾\0"
+"笑里藏刀\0"
+"笑裡藏刀\0"
+"笔\0"
+"筆\0"
+"笔杆\0"
+"筆桿\0"
+"笔秃墨干\0"
+"筆禿墨乾\0"
+"笕\0"
+"筧\0"
+"笺\0"
+"箋\0"
+"笼\0"
+"籠\0"
+"笾\0"
+"籩\0"
+"筑\0"
+"築\0"
+"筑后\0"
+"筑後\0"
+"筑阳\0"
+"筑陽\0"
+"答复\0"
+"答覆\0"
+"筚\0"
+"篳\0"
+"筛\0"
+"篩\0"
+"筝\0"
+"箏\0"
+"筹\0"
+"籌\0"
+"签\0"
+"簽\0"
+"签押\0"
+"籤押\0"
+"签条\0"
+"籤條\0"
+"签诗\0"
+"籤詩\0"
+"简\0"
+"簡\0"
+"简并\0"
+"簡併\0"
+"简朴\0"
+"簡樸\0"
+"简短发\0"
+"簡短發\0"
+"简筑翎\0"
+"簡筑翎\0"
+"算准\0"
+"算準\0"
+"算历\0"
+"算曆\0"
+"算历史\0"
+"算歷史\0"
+"管干\0"
+"管幹\0"
+"箦\0"
+"簀\0"
+"箧\0"
+"篋\0"
+"箨\0"
+"籜\0"
+"箩\0"
+"籮\0"
+"箪\0"
+"簞\0"
+"箫\0"
+"簫\0"
+"箱里\0"
+"箱裡\0"
+"篑\0"
+"簣\0"
+"篓\0"
+"簍\0"
+"篮\0"
+"籃\0"
+"篱\0"
+"籬\0"
+"簖\0"
+"籪\0"
+"簸荡\0"
+"簸蕩\0"
+"籁\0"
+"籟\0"
+"米余\0"
+"米餘\0"
+"米团\0"
+"米糰\0"
+"米沈\0"
+"米瀋\0"
+"米面\0"
+"米麵\0"
+"籴\0"
+"糴\0"
+"类\0"
+"類\0"
+"籼\0"
+"秈\0"
+"粉签子\0"
+"粉籤子\0"
+"粗制\0"
+"粗製\0"
+"粜\0"
+"糶\0"
+"粝\0"
+"糲\0"
+"粤\0"
+"粵\0"
+"粪\0"
+"糞\0"
+"粪秽蔑面\0"
+"糞穢衊面\0"
+"粮\0"
+"糧\0"
+"精准\0"
+"精準\0"
+"精制\0"
+"精製\0"
+"精干\0"
+"精幹\0"
+"精松\0"
+"精鬆\0"
+"精致\0"
+"精緻\0"
+"精辟\0"
+"精闢\0"
+"糁\0"
+"糝\0"
+"糇\0"
+"餱\0"
+"糊里糊涂\0"
+"糊裡糊塗\0"
+"糕干\0"
+"糕乾\0"
+"系上丝\0"
+"繫上絲\0"
+"系上了\0"
+"繫上了\0"
+"系上头\0"
+"繫上頭\0"
+"系上安全\0"
+"繫上安全\0"
+"系上红\0"
+"繫上紅\0"
+"系上绳\0"
+"繫上繩\0"
+"系上黑\0"
+"繫上黑\0"
+"系为\0"
+"係為\0"
+"系于\0"
+"繫於\0"
+"系于一发\0"
+"繫於一髮\0"
+"系列里\0"
+"系列裡\0"
+"系到\0"
+"繫到\0"
+"系囚\0"
+"繫囚\0"
+"系心\0"
+"繫心\0"
+"系念\0"
+"繫念\0"
+"系怀\0"
+"繫懷\0"
+"系恋\0"
+"繫戀\0"
+"系数\0"
+"係數\0"
+"系着\0"
+"繫着\0"
+"系紧\0"
+"繫緊\0"
+"系累\0"
+"繫纍\0"
+"系结\0"
+"繫結\0"
+"系绳\0"
+"繫繩\0"
+"系膜\0"
+"繫膜\0"
+"系舟\0"
+"繫舟\0"
+"系船\0"
+"繫船\0"
+"系辞\0"
+"繫辭\0"
+"系里\0"
+"系裡\0"
+"系鞋带\0"
+"繫鞋帶\0"
+"系风捕影\0"
+"繫風捕影\0"
+"素发\0"
+"素髮\0"
+"素数里\0"
+"素數裡\0"
+"素朴\0"
+"素樸\0"
+"素面\0"
+"素麵\0"
+"索面\0"
+"索麵\0"
+"索马里\0"
+"索馬里\0"
+"紧\0"
+"緊\0"
+"紧致\0"
+"緊緻\0"
+"紧追不舍\0"
+"緊追不捨\0"
+"紫姜\0"
+"紫薑\0"
+"累囚\0"
+"纍囚\0"
+"累堆\0"
+"纍堆\0"
+"累瓦结绳\0"
+"纍瓦結繩\0"
+"累绁\0"
+"纍紲\0"
+"累臣\0"
+"纍臣\0"
+"絷\0"
+"縶\0"
+"繁复\0"
+"繁複\0"
+"繁钟\0"
+"繁鐘\0"
+"纠\0"
+"糾\0"
+"纡\0"
+"紆\0"
+"纡余\0"
+"紆餘\0"
+"纡回\0"
+"紆迴\0"
+"纡郁\0"
+"紆鬱\0"
+"红\0"
+"紅\0"
+"红发\0"
+"紅髮\0"
+"红后假说\0"
+"紅后假說\0"
+"红绳系足\0"
+"紅繩繫足\0"
+"红钟\0"
+"紅鐘\0"
+"纣\0"
+"紂\0"
+"纤\0"
+"纖\0"
+"纤夫\0"
+"縴夫\0"
+"纤手\0"
+"縴手\0"
+"纤绳\0"
+"縴繩\0"
+"纥\0"
+"紇\0"
+"约\0"
+"約\0"
+"级\0"
+"級\0"
+"纨\0"
+"紈\0"
+"纩\0"
+"纊\0"
+"纪\0"
+"紀\0"
+"纪历\0"
+"紀曆\0"
+"纪历史\0"
+"紀歷史\0"
+"纫\0"
+"紉\0"
+"纬\0"
+"緯\0"
+"纭\0"
+"紜\0"
+"纯\0"
+"純\0"
+"纯朴\0"
+"純樸\0"
+"纰\0"
+"紕\0"
+"纱\0"
+"紗\0"
+"纲\0"
+"綱\0"
+"纲鉴\0"
+"綱鑑\0"
+"纳\0"
+"納\0"
+"纳征\0"
+"納徵\0"
+"纵\0"
+"縱\0"
+"纵欲\0"
+"縱慾\0"
+"纶\0"
+"綸\0"
+"纷\0"
+"紛\0"
+"纸\0"
+"紙\0"
+"纸扎\0"
+"紙紮\0"
+"纹\0"
+"紋\0"
+"纺\0"
+"紡\0"
+"纽\0"
+"紐\0"
+"纾\0"
+"紓\0"
+"线\0"
+"線\0"
+"线图里\0"
+"線圖裡\0"
+"绀\0"
+"紺\0"
+"绁\0"
+"紲\0"
+"绂\0"
+"紱\0"
+"练\0"
+"練\0"
+"组\0"
+"組\0"
+"组里\0"
+"組裡\0"
+"绅\0"
+"紳\0"
+"细\0"
+"細\0"
+"细不容发\0"
+"細不容髮\0"
+"细如发\0"
+"細如髮\0"
+"细炼\0"
+"細鍊\0"
+"细致\0"
+"細緻\0"
+"织\0"
+"織\0"
+"终\0"
+"終\0"
+"绉\0"
+"縐\0"
+"绊\0"
+"絆\0"
+"绋\0"
+"紼\0"
+"绌\0"
+"絀\0"
+"绍\0"
+"紹\0"
+"绎\0"
+"繹\0"
+"经\0"
+"經\0"
+"经文里\0"
+"經文裡\0"
+"经有云\0"
+"經有云\0"
+"绐\0"
+"紿\0"
+"绑\0"
+"綁\0"
+"绑扎\0"
+"綁紮\0"
+"绒\0"
+"絨\0"
+"结\0"
+"結\0"
+"结伙\0"
+"結夥\0"
+"结伴同游\0"
+"結伴同遊\0"
+"结余\0"
+"結餘\0"
+"结发\0"
+"結髮\0"
+"结扎\0"
+"結紮\0"
+"绕\0"
+"繞\0"
+"绕梁\0"
+"繞樑\0"
+"绗\0"
+"絎\0"
+"绘\0"
+"繪\0"
+"绘制\0"
+"繪製\0"
+"给\0"
+"給\0"
+"绚\0"
+"絢\0"
+"绛\0"
+"絳\0"
+"络\0"
+"絡\0"
+"络腮胡\0"
+"絡腮鬍\0"
+"绝\0"
+"絕\0"
+"绞\0"
+"絞\0"
+"绞干\0"
+"絞乾\0"
+"统\0"
+"統\0"
+"绠\0"
+"綆\0"
+"绡\0"
+"綃\0"
+"绢\0"
+"絹\0"
+"绣\0"
+"繡\0"
+"绥\0"
+"綏\0"
+"绥棱\0"
+"綏稜\0"
+"绦\0"
+"絛\0"
+"继\0"
+"繼\0"
+"绨\0"
+"綈\0"
+"绩\0"
+"績\0"
+"绪\0"
+"緒\0"
+"绪余\0"
+"緒餘\0"
+"绫\0"
+"綾\0"
+"续\0"
+"續\0"
+"绮\0"
+"綺\0"
+"绯\0"
+"緋\0"
+"绰\0"
+"綽\0"
+"绱\0"
+"鞝\0"
+"绲\0"
+"緄\0"
+"绳\0"
+"繩\0"
+"维\0"
+"維\0"
+"维系\0"
+"維繫\0"
+"维系统\0"
+"維系統\0"
+"绵\0"
+"綿\0"
+"绶\0"
+"綬\0"
+"绷\0"
+"繃\0"
+"绷扒吊拷\0"
+"繃扒弔拷\0"
+"绸\0"
+"綢\0"
+"绺\0"
+"綹\0"
+"绻\0"
+"綣\0"
+"综\0"
+"綜\0"
+"综合征\0"
+"綜合徵\0"
+"绽\0"
+"綻\0"
+"绾\0"
+"綰\0"
+"绾发\0"
+"綰髮\0"
+"绿\0"
+"綠\0"
+"绿发\0"
+"綠髮\0"
+"缀\0"
+"綴\0"
+"缁\0"
+"緇\0"
+"缂\0"
+"緙\0"
+"缃\0"
+"緗\0"
+"缄\0"
+"緘\0"
+"缅\0"
+"緬\0"
+"缆\0"
+"纜\0"
+"缇\0"
+"緹\0"
+"缈\0"
+"緲\0"
+"缉\0"
+"緝\0"
+"缉凶\0"
+"緝兇\0"
+"缋\0"
+"繢\0"
+"缌\0"
+"緦\0"
+"缍\0"
+"綞\0"
+"缎\0"
+"緞\0"
+"缏\0"
+"緶\0"
+"缑\0"
+"緱\0"
+"缒\0"
+"縋\0"
+"缓\0"
+"緩\0"
+"缓冲\0"
+"緩衝\0"
+"缓征\0"
+"緩徵\0"
+"缔\0"
+"締\0"
+"缕\0"
+"縷\0"
+"编\0"
+"編\0"
+"编余\0"
+"編餘\0"
+"编制法\0"
+"編制法\0"
+"编码表\0"
+"編碼表\0"
+"编采\0"
+"編採\0"
+"编钟\0"
+"編鐘\0"
+"缗\0"
+"緡\0"
+"缘\0"
+"緣\0"
+"缙\0"
+"縉\0"
+"缚\0"
+"縛\0"
+"缛\0"
+"縟\0"
+"缜\0"
+"縝\0"
+"缜致\0"
+"縝緻\0"
+"缝\0"
+"縫\0"
+"缝制\0"
+"縫製\0"
+"缝里\0"
+"縫裡\0"
+"缟\0"
+"縞\0"
+"缠\0"
+"纏\0"
+"缠斗\0"
+"纏鬥\0"
+"缡\0"
+"縭\0"
+"缢\0"
+"縊\0"
+"缣\0"
+"縑\0"
+"缤\0"
+"繽\0"
+"缥\0"
+"縹\0"
+"缦\0"
+"縵\0"
+"缧\0"
+"縲\0"
+"缨\0"
+"纓\0"
+"缩\0"
+"縮\0"
+"缩栗\0"
+"縮慄\0"
+"缩短发\0"
+"縮短發\0"
+"缪\0"
+"繆\0"
+"缫\0"
+"繅\0"
+"缬\0"
+"纈\0"
+"缭\0"
+"繚\0"
+"缮\0"
+"繕\0"
+"缯\0"
+"繒\0"
+"缰\0"
+"韁\0"
+"缱\0"
+"繾\0"
+"缲\0"
+"繰\0"
+"缳\0"
+"繯\0"
+"缴\0"
+"繳\0"
+"缵\0"
+"纘\0"
+"罂\0"
+"罌\0"
+"网\0"
+"網\0"
+"网志\0"
+"網誌\0"
+"网游\0"
+"網遊\0"
+"网球台\0"
+"網球台\0"
+"网站里\0"
+"網站裡\0"
+"网里\0"
+"網裡\0"
+"罗\0"
+"羅\0"
+"罗马历\0"
+"羅馬曆\0"
+"罗马历代\0"
+"羅馬歷代\0"
+"罗马历史\0"
+"羅馬歷史\0"
+"罚\0"
+"罰\0"
+"罢\0"
+"罷\0"
+"置言成范\0"
+"置言成範\0"
+"罴\0"
+"羆\0"
+"羁\0"
+"羈\0"
+"羁系\0"
+"羈繫\0"
+"美丑\0"
+"美醜\0"
+"美发业\0"
+"美髮業\0"
+"美发学\0"
+"美髮學\0"
+"美发师\0"
+"美髮師\0"
+"美发店\0"
+"美髮店\0"
+"美发沙龙\0"
+"美髮沙龍\0"
+"美发馆\0"
+"美髮館\0"
+"美容美发\0"
+"美容美髮\0"
+"羟\0"
+"羥\0"
+"羡\0"
+"羨\0"
+"羡余\0"
+"羨餘\0"
+"群丑\0"
+"群醜\0"
+"翕辟\0"
+"翕闢\0"
+"翘\0"
+"翹\0"
+"翱游\0"
+"翱遊\0"
+"翻松\0"
+"翻鬆\0"
+"翻涌\0"
+"翻湧\0"
+"老仆\0"
+"老僕\0"
+"老姜\0"
+"老薑\0"
+"老干\0"
+"老乾\0"
+"老干部\0"
+"老幹部\0"
+"老板\0"
+"老闆\0"
+"老爷钟\0"
+"老爺鐘\0"
+"老白干\0"
+"老白乾\0"
+"考征\0"
+"考徵\0"
+"考试制度\0"
+"考試制度\0"
+"耍斗\0"
+"耍鬥\0"
+"耕获\0"
+"耕穫\0"
+"耧\0"
+"耬\0"
+"耳余\0"
+"耳餘\0"
+"耶律术烈\0"
+"耶律朮烈\0"
+"耸\0"
+"聳\0"
+"耻\0"
+"恥\0"
+"聂\0"
+"聶\0"
+"聊斋志异\0"
+"聊齋志異\0"
+"聋\0"
+"聾\0"
+"职\0"
+"職\0"
+"聍\0"
+"聹\0"
+"联\0"
+"聯\0"
+"联系\0"
+"聯繫\0"
+"聘雇\0"
+"聘僱\0"
+"聚药雄蕊\0"
+"聚葯雄蕊\0"
+"聩\0"
+"聵\0"
+"聪\0"
+"聰\0"
+"肃\0"
+"肅\0"
+"肉丝面\0"
+"肉絲麵\0"
+"肉干\0"
+"肉乾\0"
+"肉松\0"
+"肉鬆\0"
+"肉欲\0"
+"肉慾\0"
+"肉羹面\0"
+"肉羹麵\0"
+"肉面\0"
+"肉麵\0"
+"肚里\0"
+"肚裡\0"
+"肝脏\0"
+"肝臟\0"
+"肝郁\0"
+"肝鬱\0"
+"肠\0"
+"腸\0"
+"肠脏\0"
+"腸臟\0"
+"股栗\0"
+"股慄\0"
+"肤\0"
+"膚\0"
+"肮\0"
+"骯\0"
+"肴\0"
+"餚\0"
+"肴馔\0"
+"肴饌\0"
+"肺脏\0"
+"肺臟\0"
+"肾\0"
+"腎\0"
+"肾脏\0"
+"腎臟\0"
+"肿\0"
+"腫\0"
+"胀\0"
+"脹\0"
+"胁\0"
+"脅\0"
+"胃脏\0"
+"胃臟\0"
+"胃里\0"
+"胃裡\0"
+"胆\0"
+"膽\0"
+"背地里\0"
+"背地裡\0"
+"胎发\0"
+"胎髮\0"
+"胜\0"
+"勝\0"
+"胜键\0"
+"胜鍵\0"
+"胡子\0"
+"鬍子\0"
+"胡子婴\0"
+"胡子嬰\0"
+"胡朴安\0"
+"胡樸安\0"
+"胡梢\0"
+"鬍梢\0"
+"胡渣\0"
+"鬍渣\0"
+"胡里胡涂\0"
+"胡裡胡塗\0"
+"胡须\0"
+"鬍鬚\0"
+"胡髭\0"
+"鬍髭\0"
+"胡髯\0"
+"鬍髯\0"
+"胧\0"
+"朧\0"
+"胪\0"
+"臚\0"
+"胫\0"
+"脛\0"
+"胰脏\0"
+"胰臟\0"
+"胶\0"
+"膠\0"
+"胶卷\0"
+"膠捲\0"
+"能干\0"
+"能幹\0"
+"能干扰\0"
+"能干擾\0"
+"能干预\0"
+"能干預\0"
+"脉\0"
+"脈\0"
+"脉冲\0"
+"脈衝\0"
+"脊梁\0"
+"脊樑\0"
+"脍\0"
+"膾\0"
+"脏\0"
+"髒\0"
+"脏器\0"
+"臟器\0"
+"脏胸\0"
+"臟胸\0"
+"脏腑\0"
+"臟腑\0"
+"脐\0"
+"臍\0"
+"脑\0"
+"腦\0"
+"脑干\0"
+"腦幹\0"
+"脓\0"
+"膿\0"
+"脔\0"
+"臠\0"
+"脚\0"
+"腳\0"
+"脚注\0"
+"腳註\0"
+"脱\0"
+"脫\0"
+"脱发\0"
+"脫髮\0"
+"脱谷机\0"
+"脫穀機\0"
+"脶\0"
+"腡\0"
+"脸\0"
+"臉\0"
+"脺脏\0"
+"脺臟\0"
+"脾脏\0"
+"脾臟\0"
+"腊\0"
+"臘\0"
+"腊笔\0"
+"腊筆\0"
+"腌\0"
+"醃\0"
+"腌制\0"
+"醃製\0"
+"腐余\0"
+"腐餘\0"
+"腐干\0"
+"腐乾\0"
+"腑脏\0"
+"腑臟\0"
+"腕表\0"
+"腕錶\0"
+"腭\0"
+"齶\0"
+"腰里\0"
+"腰裡\0"
+"腻\0"
+"膩\0"
+"腼\0"
+"靦\0"
+"腽\0"
+"膃\0"
+"腾\0"
+"騰\0"
+"腾冲\0"
+"騰衝\0"
+"腾格里\0"
+"騰格里\0"
+"腾涌\0"
+"騰湧\0"
+"膑\0"
+"臏\0"
+"膨松\0"
+"膨鬆\0"
+"膵脏\0"
+"膵臟\0"
+"臊子面\0"
+"臊子麵\0"
+"臣仆\0"
+"臣僕\0"
+"臧谷亡羊\0"
+"臧穀亡羊\0"
+"自制\0"
+"自製\0"
+"自制下来\0"
+"自制下來\0"
+"自夸\0"
+"自誇\0"
+"自干五\0"
+"自乾五\0"
+"自然数里\0"
+"自然數裡\0"
+"自由钟\0"
+"自由鐘\0"
+"自觉自愿\0"
+"自覺自愿\0"
+"臭气冲天\0"
+"臭氣衝天\0"
+"致密\0"
+"緻密\0"
+"舂谷\0"
+"舂穀\0"
+"舆\0"
+"輿\0"
+"舌干唇焦\0"
+"舌乾唇焦\0"
+"舍不得\0"
+"捨不得\0"
+"舍入\0"
+"捨入\0"
+"舍出\0"
+"捨出\0"
+"舍去\0"
+"捨去\0"
+"舍命\0"
+"捨命\0"
+"舍堕\0"
+"捨墮\0"
+"舍安就危\0"
+"捨安就危\0"
+"舍实\0"
+"捨實\0"
+"舍己为人\0"
+"捨己為人\0"
+"舍己为公\0"
+"捨己為公\0"
+"舍己为国\0"
+"捨己為國\0"
+"舍己从人\0"
+"捨己從人\0"
+"舍己救人\0"
+"捨己救人\0"
+"舍弃\0"
+"捨棄\0"
+"舍得\0"
+"捨得\0"
+"舍我其谁\0"
+"捨我其誰\0"
+"舍本逐末\0"
+"捨本逐末\0"
+"舍死忘生\0"
+"捨死忘生\0"
+"舍生\0"
+"捨生\0"
+"舍短取长\0"
+"捨短取長\0"
+"舍身\0"
+"捨身\0"
+"舍车保帅\0"
+"捨車保帥\0"
+"舍近求远\0"
+"捨近求遠\0"
+"舒卷\0"
+"舒捲\0"
+"舞台风格\0"
+"舞台風格\0"
+"舣\0"
+"艤\0"
+"航海历\0"
+"航海曆\0"
+"航海历史\0"
+"航海歷史\0"
+"舰\0"
+"艦\0"
+"舰只\0"
+"艦隻\0"
+"舱\0"
+"艙\0"
+"船只\0"
+"船隻\0"
+"船钟\0"
+"船鐘\0"
+"舻\0"
+"艫\0"
+"艰\0"
+"艱\0"
+"色欲\0"
+"色慾\0"
+"色长发\0"
+"色長髮\0"
+"艳\0"
+"艷\0"
+"艳后\0"
+"艷后\0"
+"艺\0"
+"藝\0"
+"节\0"
+"節\0"
+"节余\0"
+"節餘\0"
+"节欲\0"
+"節慾\0"
+"节目里\0"
+"節目裡\0"
+"芈\0"
+"羋\0"
+"芒果干\0"
+"芒果乾\0"
+"芗\0"
+"薌\0"
+"芜\0"
+"蕪\0"
+"芦\0"
+"蘆\0"
+"花不要采\0"
+"花不要採\0"
+"花哄\0"
+"花鬨\0"
+"花盆里\0"
+"花盆裡\0"
+"花药\0"
+"花葯\0"
+"花菴词选\0"
+"花菴詞選\0"
+"花钟\0"
+"花鐘\0"
+"花马吊嘴\0"
+"花馬弔嘴\0"
+"芸薹\0"
+"蕓薹\0"
+"苁\0"
+"蓯\0"
+"苇\0"
+"葦\0"
+"苈\0"
+"藶\0"
+"苋\0"
+"莧\0"
+"苌\0"
+"萇\0"
+"苍\0"
+"蒼\0"
+"苍发\0"
+"蒼髮\0"
+"苍术\0"
+"蒼朮\0"
+"苍郁\0"
+"蒼鬱\0"
+"苎\0"
+"苧\0"
+"苏\0"
+"蘇\0"
+"苏昆\0"
+"蘇崑\0"
+"苏醒\0"
+"甦醒\0"
+"苑里\0"
+"苑裡\0"
+"苦干\0"
+"苦幹\0"
+"苦斗\0"
+"苦鬥\0"
+"苦里\0"
+"苦裡\0"
+"苧\0"
+"薴\0"
+"苧悴\0"
+"薴悴\0"
+"苧烯\0"
+"薴烯\0"
+"英文里\0"
+"英文裡\0"
+"苹婆\0"
+"蘋婆\0"
+"苹果\0"
+"蘋果\0"
+"苹果干\0"
+"蘋果乾\0"
+"茂都淀\0"
+"茂都澱\0"
+"范亭\0"
+"範亭\0"
+"范例\0"
+"範例\0"
+"范围\0"
+"範圍\0"
+"范字\0"
+"範字\0"
+"范式\0"
+"範式\0"
+"范性形变\0"
+"範性形變\0"
+"范数\0"
+"範數\0"
+"范文\0"
+"範文\0"
+"范文澜\0"
+"范文瀾\0"
+"范本\0"
+"範本\0"
+"范畴\0"
+"範疇\0"
+"范贤惠\0"
+"范賢惠\0"
+"范金\0"
+"範金\0"
+"茅于轼\0"
+"茅于軾\0"
+"茎\0"
+"莖\0"
+"茎干\0"
+"莖幹\0"
+"茏\0"
+"蘢\0"
+"茑\0"
+"蔦\0"
+"茔\0"
+"塋\0"
+"茕\0"
+"煢\0"
+"茧\0"
+"繭\0"
+"茶余\0"
+"茶餘\0"
+"茶面\0"
+"茶麵\0"
+"荆\0"
+"荊\0"
+"草丛里\0"
+"草叢裡\0"
+"草席\0"
+"草蓆\0"
+"荐\0"
+"薦\0"
+"荐饥\0"
+"荐饑\0"
+"荚\0"
+"莢\0"
+"荛\0"
+"蕘\0"
+"荜\0"
+"蓽\0"
+"荞\0"
+"蕎\0"
+"荞麦面\0"
+"蕎麥麵\0"
+"荟\0"
+"薈\0"
+"荠\0"
+"薺\0"
+"荡\0"
+"盪\0"
+"荡产\0"
+"蕩產\0"
+"荡女\0"
+"蕩女\0"
+"荡妇\0"
+"蕩婦\0"
+"荡寇\0"
+"蕩寇\0"
+"荡平\0"
+"蕩平\0"
+"荡来荡去\0"
+"蕩來蕩去\0"
+"荡气\0"
+"蕩氣\0"
+"荡气回肠\0"
+"盪氣迴腸\0"
+"荡涤\0"
+"蕩滌\0"
+"荡漾\0"
+"蕩漾\0"
+"荡然\0"
+"蕩然\0"
+"荡舟\0"
+"蕩舟\0"
+"荡船\0"
+"蕩船\0"
+"荡荡\0"
+"蕩蕩\0"
+"荣\0"
+"榮\0"
+"荤\0"
+"葷\0"
+"荥\0"
+"滎\0"
+"荦\0"
+"犖\0"
+"荦确\0"
+"犖确\0"
+"荧\0"
+"熒\0"
+"荧郁\0"
+"熒鬱\0"
+"荨\0"
+"蕁\0"
+"荩\0"
+"藎\0"
+"荪\0"
+"蓀\0"
+"荫\0"
+"蔭\0"
+"荭\0"
+"葒\0"
+"药\0"
+"藥\0"
+"药签\0"
+"藥籤\0"
+"药面儿\0"
+"藥麵兒\0"
+"荷花淀\0"
+"荷花澱\0"
+"莅\0"
+"蒞\0"
+"莜面\0"
+"莜麵\0"
+"莪术\0"
+"莪朮\0"
+"莱\0"
+"萊\0"
+"莲\0"
+"蓮\0"
+"莳\0"
+"蒔\0"
+"莴\0"
+"萵\0"
+"莶\0"
+"薟\0"
+"获\0"
+"獲\0"
+"获匪其丑\0"
+"獲匪其醜\0"
+"莸\0"
+"蕕\0"
+"莹\0"
+"瑩\0"
+"莺\0"
+"鶯\0"
+"莼\0"
+"蓴\0"
+"莽荡\0"
+"莽蕩\0"
+"菜坛\0"
+"菜罈\0"
+"菜干\0"
+"菜乾\0"
+"菜肴\0"
+"菜餚\0"
+"菠棱菜\0"
+"菠稜菜\0"
+"菠萝干\0"
+"菠蘿乾\0"
+"萝\0"
+"蘿\0"
+"萝卜\0"
+"蘿蔔\0"
+"萝卜干\0"
+"蘿蔔乾\0"
+"萤\0"
+"螢\0"
+"营\0"
+"營\0"
+"营干\0"
+"營幹\0"
+"萦\0"
+"縈\0"
+"萦回\0"
+"縈迴\0"
+"萧\0"
+"蕭\0"
+"萧参\0"
+"蕭蔘\0"
+"萨\0"
+"薩\0"
+"落发\0"
+"落髮\0"
+"落腮胡\0"
+"落腮鬍\0"
+"葡萄干\0"
+"葡萄乾\0"
+"董氏封发\0"
+"董氏封髮\0"
+"葱\0"
+"蔥\0"
+"葱郁\0"
+"蔥鬱\0"
+"蒇\0"
+"蕆\0"
+"蒉\0"
+"蕢\0"
+"蒋\0"
+"蔣\0"
+"蒌\0"
+"蔞\0"
+"蒙事\0"
+"矇事\0"
+"蒙头转\0"
+"矇頭轉\0"
+"蒙昧无知\0"
+"矇昧無知\0"
+"蒙松雨\0"
+"矇松雨\0"
+"蒙汜\0"
+"濛汜\0"
+"蒙混\0"
+"矇混\0"
+"蒙瞍\0"
+"矇瞍\0"
+"蒙聩\0"
+"矇聵\0"
+"蒙胧\0"
+"朦朧\0"
+"蒙蒙细雨\0"
+"濛濛細雨\0"
+"蒙雾\0"
+"濛霧\0"
+"蒙雾露\0"
+"蒙霧露\0"
+"蒙骗\0"
+"矇騙\0"
+"蒙鸿\0"
+"濛鴻\0"
+"蒜发\0"
+"蒜髮\0"
+"蒲席\0"
+"蒲蓆\0"
+"蒸制\0"
+"蒸製\0"
+"蒸干\0"
+"蒸乾\0"
+"蓄发\0"
+"蓄髮\0"
+"蓄胡\0"
+"蓄鬍\0"
+"蓄须\0"
+"蓄鬚\0"
+"蓊郁\0"
+"蓊鬱\0"
+"蓝\0"
+"藍\0"
+"蓝淀\0"
+"藍澱\0"
+"蓟\0"
+"薊\0"
+"蓠\0"
+"蘺\0"
+"蓣\0"
+"蕷\0"
+"蓥\0"
+"鎣\0"
+"蓦\0"
+"驀\0"
+"蓬发\0"
+"蓬髮\0"
+"蓬松\0"
+"蓬鬆\0"
+"蓬松松\0"
+"蓬鬆鬆\0"
+"蔂\0"
+"虆\0"
+"蔷\0"
+"薔\0"
+"蔹\0"
+"蘞\0"
+"蔺\0"
+"藺\0"
+"蔼\0"
+"藹\0"
+"蕲\0"
+"蘄\0"
+"蕴\0"
+"蘊\0"
+"薄干\0"
+"薄幹\0"
+"薄幸\0"
+"薄倖\0"
+"薙发\0"
+"薙髮\0"
+"薝卜\0"
+"薝蔔\0"
+"薮\0"
+"藪\0"
+"藏历\0"
+"藏曆\0"
+"藏历史\0"
+"藏歷史\0"
+"藏蒙歌儿\0"
+"藏矇歌兒\0"
+"藓\0"
+"蘚\0"
+"藤制\0"
+"藤製\0"
+"藤席\0"
+"藤蓆\0"
+"蘖\0"
+"櫱\0"
+"虎斗\0"
+"虎鬥\0"
+"虎须\0"
+"虎鬚\0"
+"虏\0"
+"虜\0"
+"虑\0"
+"慮\0"
+"虚\0"
+"虛\0"
+"虚夸\0"
+"虛誇\0"
+"虫\0"
+"蟲\0"
+"虮\0"
+"蟣\0"
+"虮虱相吊\0"
+"蟣蝨相弔\0"
+"虽\0"
+"雖\0"
+"虾\0"
+"蝦\0"
+"虾面\0"
+"蝦麵\0"
+"虿\0"
+"蠆\0"
+"蚀\0"
+"蝕\0"
+"蚁\0"
+"蟻\0"
+"蚁后\0"
+"蟻后\0"
+"蚂\0"
+"螞\0"
+"蚊动牛斗\0"
+"蚊動牛鬥\0"
+"蚕\0"
+"蠶\0"
+"蚬\0"
+"蜆\0"
+"蛇发女妖\0"
+"蛇髮女妖\0"
+"蛊\0"
+"蠱\0"
+"蛋白发\0"
+"蛋白發\0"
+"蛎\0"
+"蠣\0"
+"蛏\0"
+"蟶\0"
+"蛏干\0"
+"蟶乾\0"
+"蛮\0"
+"蠻\0"
+"蛮干\0"
+"蠻幹\0"
+"蛰\0"
+"蟄\0"
+"蛱\0"
+"蛺\0"
+"蛲\0"
+"蟯\0"
+"蛳\0"
+"螄\0"
+"蛴\0"
+"蠐\0"
+"蜂准\0"
+"蜂準\0"
+"蜂涌\0"
+"蜂湧\0"
+"蜕\0"
+"蛻\0"
+"蜗\0"
+"蝸\0"
+"蜜里调油\0"
+"蜜裡調油\0"
+"蜡\0"
+"蠟\0"
+"蝇\0"
+"蠅\0"
+"蝈\0"
+"蟈\0"
+"蝉\0"
+"蟬\0"
+"蝎\0"
+"蠍\0"
+"蝎谮\0"
+"蝎譖\0"
+"蝼\0"
+"螻\0"
+"蝾\0"
+"蠑\0"
+"血余\0"
+"血餘\0"
+"衅\0"
+"釁\0"
+"衅钟\0"
+"釁鐘\0"
+"行事历\0"
+"行事曆\0"
+"行事历史\0"
+"行事歷史\0"
+"行凶\0"
+"行兇\0"
+"行家里手\0"
+"行家裡手\0"
+"衔\0"
+"銜\0"
+"衡鉴\0"
+"衡鑑\0"
+"补\0"
+"補\0"
+"补注\0"
+"補註\0"
+"表停\0"
+"錶停\0"
+"表冠\0"
+"錶冠\0"
+"表带\0"
+"錶帶\0"
+"表征\0"
+"表徵\0"
+"表快\0"
+"錶快\0"
+"表慢\0"
+"錶慢\0"
+"表板\0"
+"錶板\0"
+"表王\0"
+"錶王\0"
+"表盘\0"
+"錶盤\0"
+"表蒙子\0"
+"錶蒙子\0"
+"表转\0"
+"錶轉\0"
+"表速\0"
+"錶速\0"
+"表针\0"
+"錶針\0"
+"衬\0"
+"襯\0"
+"衬里\0"
+"襯裡\0"
+"衮\0"
+"袞\0"
+"袄\0"
+"襖\0"
+"袅\0"
+"裊\0"
+"袋杆\0"
+"袋桿\0"
+"袋表\0"
+"袋錶\0"
+"袋里\0"
+"袋裡\0"
+"袖里\0"
+"袖裡\0"
+"袜\0"
+"襪\0"
+"被发佯狂\0"
+"被髮佯狂\0"
+"被发入山\0"
+"被髮入山\0"
+"被发左衽\0"
+"被髮左衽\0"
+"被发缨冠\0"
+"被髮纓冠\0"
+"被发阳狂\0"
+"被髮陽狂\0"
+"被夸\0"
+"被誇\0"
+"被废后\0"
+"被廢後\0"
+"被系上\0"
+"被繫上\0"
+"被里\0"
+"被裡\0"
+"袭\0"
+"襲\0"
+"裁制\0"
+"裁製\0"
+"裁并\0"
+"裁併\0"
+"装\0"
+"裝\0"
+"装折\0"
+"裝摺\0"
+"裆\0"
+"襠\0"
+"裢\0"
+"褳\0"
+"裣\0"
+"襝\0"
+"裤\0"
+"褲\0"
+"裥\0"
+"襉\0"
+"褒赞\0"
+"褒讚\0"
+"褛\0"
+"褸\0"
+"褴\0"
+"襤\0"
+"西历\0"
+"西曆\0"
+"西历代\0"
+"西歷代\0"
+"西历任\0"
+"西歷任\0"
+"西历史\0"
+"西歷史\0"
+"西历次\0"
+"西歷次\0"
+"西周钟\0"
+"西周鐘\0"
+"西岳\0"
+"西嶽\0"
+"西昆\0"
+"西崑\0"
+"西游\0"
+"西遊\0"
+"要冲\0"
+"要衝\0"
+"见\0"
+"見\0"
+"见棱见角\0"
+"見稜見角\0"
+"见素抱朴\0"
+"見素抱樸\0"
+"见钟不打\0"
+"見鐘不打\0"
+"观\0"
+"觀\0"
+"观采\0"
+"觀採\0"
+"规\0"
+"規\0"
+"规范\0"
+"規範\0"
+"觅\0"
+"覓\0"
+"视\0"
+"視\0"
+"觇\0"
+"覘\0"
+"览\0"
+"覽\0"
+"觉\0"
+"覺\0"
+"觊\0"
+"覬\0"
+"觋\0"
+"覡\0"
+"觌\0"
+"覿\0"
+"觎\0"
+"覦\0"
+"觏\0"
+"覯\0"
+"觐\0"
+"覲\0"
+"觑\0"
+"覷\0"
+"角抵\0"
+"角牴\0"
+"角落发\0"
+"角落發\0"
+"角落里\0"
+"角落裡\0"
+"觚棱\0"
+"觚稜\0"
+"觞\0"
+"觴\0"
+"解发佯狂\0"
+"解髮佯狂\0"
+"解封后\0"
+"解封後\0"
+"解雇\0"
+"解僱\0"
+"触\0"
+"觸\0"
+"触须\0"
+"觸鬚\0"
+"觯\0"
+"觶\0"
+"言里\0"
+"言裡\0"
+"誉\0"
+"譽\0"
+"誊\0"
+"謄\0"
+"謷丑\0"
+"謷醜\0"
+"警世钟\0"
+"警世鐘\0"
+"警报钟\0"
+"警報鐘\0"
+"警示钟\0"
+"警示鐘\0"
+"警钟\0"
+"警鐘\0"
+"计\0"
+"計\0"
+"计划\0"
+"計劃\0"
+"计时表\0"
+"計時錶\0"
+"订\0"
+"訂\0"
+"订制\0"
+"訂製\0"
+"讣\0"
+"訃\0"
+"认\0"
+"認\0"
+"认准\0"
+"認準\0"
+"讥\0"
+"譏\0"
+"讦\0"
+"訐\0"
+"讧\0"
+"訌\0"
+"讨\0"
+"討\0"
+"让\0"
+"讓\0"
+"讪\0"
+"訕\0"
+"讫\0"
+"訖\0"
+"训\0"
+"訓\0"
+"议\0"
+"議\0"
+"讯\0"
+"訊\0"
+"记\0"
+"記\0"
+"讲\0"
+"講\0"
+"讳\0"
+"諱\0"
+"讴\0"
+"謳\0"
+"讵\0"
+"詎\0"
+"讶\0"
+"訝\0"
+"讷\0"
+"訥\0"
+"许\0"
+"許\0"
+"许愿起经\0"
+"許愿起經\0"
+"讹\0"
+"訛\0"
+"论\0"
+"論\0"
+"论文里\0"
+"論文裡\0"
+"讼\0"
+"訟\0"
+"讽\0"
+"諷\0"
+"设\0"
+"設\0"
+"访\0"
+"訪\0"
+"诀\0"
+"訣\0"
+"证\0"
+"證\0"
+"证谏\0"
+"証諫\0"
+"诂\0"
+"詁\0"
+"诃\0"
+"訶\0"
+"评\0"
+"評\0"
+"评断发\0"
+"評斷發\0"
+"评注\0"
+"評註\0"
+"评鉴\0"
+"評鑑\0"
+"诅\0"
+"詛\0"
+"识\0"
+"識\0"
+"诈\0"
+"詐\0"
+"诉\0"
+"訴\0"
+"诊\0"
+"診\0"
+"诋\0"
+"詆\0"
+"诌\0"
+"謅\0"
+"词\0"
+"詞\0"
+"词余\0"
+"詞餘\0"
+"词干\0"
+"詞幹\0"
+"词汇\0"
+"詞彙\0"
+"诎\0"
+"詘\0"
+"诏\0"
+"詔\0"
+"译\0"
+"譯\0"
+"译制\0"
+"譯製\0"
+"译文里\0"
+"譯文裡\0"
+"译注\0"
+"譯註\0"
+"诒\0"
+"詒\0"
+"诓\0"
+"誆\0"
+"诔\0"
+"誄\0"
+"诔赞\0"
+"誄讚\0"
+"试\0"
+"試\0"
+"试制\0"
+"試製\0"
+"诖\0"
+"詿\0"
+"诗\0"
+"詩\0"
+"诗云\0"
+"詩云\0"
+"诗余\0"
+"詩餘\0"
+"诗赞\0"
+"詩讚\0"
+"诗钟\0"
+"詩鐘\0"
+"诘\0"
+"詰\0"
+"诙\0"
+"詼\0"
+"诚\0"
+"誠\0"
+"诚征\0"
+"誠徵\0"
+"诚朴\0"
+"誠樸\0"
+"诛\0"
+"誅\0"
+"诜\0"
+"詵\0"
+"话\0"
+"話\0"
+"话里有话\0"
+"話裡有話\0"
+"诞\0"
+"誕\0"
+"诟\0"
+"詬\0"
+"诠\0"
+"詮\0"
+"诡\0"
+"詭\0"
+"询\0"
+"詢\0"
+"诣\0"
+"詣\0"
+"诤\0"
+"諍\0"
+"该\0"
+"該\0"
+"该钟\0"
+"該鐘\0"
+"详\0"
+"詳\0"
+"详征博引\0"
+"詳徵博引\0"
+"详注\0"
+"詳註\0"
+"诧\0"
+"詫\0"
+"诨\0"
+"諢\0"
+"诩\0"
+"詡\0"
+"诫\0"
+"誡\0"
+"诬\0"
+"誣\0"
+"诬蔑\0"
+"誣衊\0"
+"语\0"
+"語\0"
+"语云\0"
+"語云\0"
+"语有云\0"
+"語有云\0"
+"语汇\0"
+"語彙\0"
+"语法里\0"
+"語法裡\0"
+"语里\0"
+"語裡\0"
+"诮\0"
+"誚\0"
+"误\0"
+"誤\0"
+"诰\0"
+"誥\0"
+"诱\0"
+"誘\0"
+"诱奸\0"
+"誘姦\0"
+"诲\0"
+"誨\0"
+"诳\0"
+"誑\0"
+"说\0"
+"說\0"
+"说不准\0"
+"說不準\0"
+"诵\0"
+"誦\0"
+"诶\0"
+"誒\0"
+"请\0"
+"請\0"
+"请君入瓮\0"
+"請君入甕\0"
+"请托\0"
+"請託\0"
+"诸\0"
+"諸\0"
+"诸余\0"
+"諸餘\0"
+"诹\0"
+"諏\0"
+"诺\0"
+"諾\0"
+"读\0"
+"讀\0"
+"诼\0"
+"諑\0"
+"诽\0"
+"誹\0"
+"课\0"
+"課\0"
+"课余\0"
+"課餘\0"
+"课征\0"
+"課徵\0"
+"诿\0"
+"諉\0"
+"谀\0"
+"諛\0"
+"谁\0"
+"誰\0"
+"谁干的\0"
+"誰幹的\0"
+"谂\0"
+"諗\0"
+"调\0"
+"調\0"
+"调准\0"
+"調準\0"
+"调制\0"
+"調製\0"
+"调表\0"
+"調錶\0"
+"调钟表\0"
+"調鐘錶\0"
+"谄\0"
+"諂\0"
+"谅\0"
+"諒\0"
+"谆\0"
+"諄\0"
+"谇\0"
+"誶\0"
+"谈\0"
+"談\0"
+"谈征\0"
+"談徵\0"
+"谊\0"
+"誼\0"
+"谋\0"
+"謀\0"
+"谋干\0"
+"謀幹\0"
+"谌\0"
+"諶\0"
+"谍\0"
+"諜\0"
+"谎\0"
+"謊\0"
+"谏\0"
+"諫\0"
+"谐\0"
+"諧\0"
+"谑\0"
+"謔\0"
+"谒\0"
+"謁\0"
+"谓\0"
+"謂\0"
+"谔\0"
+"諤\0"
+"谕\0"
+"諭\0"
+"谖\0"
+"諼\0"
+"谗\0"
+"讒\0"
+"谘\0"
+"諮\0"
+"谙\0"
+"諳\0"
+"谚\0"
+"諺\0"
+"谛\0"
+"諦\0"
+"谜\0"
+"謎\0"
+"谝\0"
+"諞\0"
+"谟\0"
+"謨\0"
+"谠\0"
+"讜\0"
+"谡\0"
+"謖\0"
+"谢\0"
+"謝\0"
+"谢华后\0"
+"謝華后\0"
+"谢杰\0"
+"謝杰\0"
+"谣\0"
+"謠\0"
+"谤\0"
+"謗\0"
+"谥\0"
+"諡\0"
+"谦\0"
+"謙\0"
+"谧\0"
+"謐\0"
+"谨\0"
+"謹\0"
+"谨愿\0"
+"謹愿\0"
+"谩\0"
+"謾\0"
+"谪\0"
+"謫\0"
+"谫\0"
+"譾\0"
+"谬\0"
+"謬\0"
+"谬赞\0"
+"謬讚\0"
+"谬采虚声\0"
+"謬採虛聲\0"
+"谭\0"
+"譚\0"
+"谮\0"
+"譖\0"
+"谯\0"
+"譙\0"
+"谰\0"
+"讕\0"
+"谱\0"
+"譜\0"
+"谲\0"
+"譎\0"
+"谳\0"
+"讞\0"
+"谴\0"
+"譴\0"
+"谵\0"
+"譫\0"
+"谶\0"
+"讖\0"
+"谷人\0"
+"穀人\0"
+"谷仓\0"
+"穀倉\0"
+"谷保家商\0"
+"穀保家商\0"
+"谷圭\0"
+"穀圭\0"
+"谷场\0"
+"穀場\0"
+"谷城县\0"
+"穀城縣\0"
+"谷壳\0"
+"穀殼\0"
+"谷子\0"
+"穀子\0"
+"谷日\0"
+"穀日\0"
+"谷旦\0"
+"穀旦\0"
+"谷梁\0"
+"穀梁\0"
+"谷氨\0"
+"穀氨\0"
+"谷物\0"
+"穀物\0"
+"谷皮\0"
+"穀皮\0"
+"谷神\0"
+"穀神\0"
+"谷禄\0"
+"穀祿\0"
+"谷米\0"
+"穀米\0"
+"谷类\0"
+"穀類\0"
+"谷粒\0"
+"穀粒\0"
+"谷胱\0"
+"穀胱\0"
+"谷舱\0"
+"穀艙\0"
+"谷苗\0"
+"穀苗\0"
+"谷草\0"
+"穀草\0"
+"谷谷\0"
+"穀穀\0"
+"谷贱伤农\0"
+"穀賤傷農\0"
+"谷贵饿农\0"
+"穀貴餓農\0"
+"谷雨\0"
+"穀雨\0"
+"谷食\0"
+"穀食\0"
+"豆干\0"
+"豆乾\0"
+"豆腐干\0"
+"豆腐乾\0"
+"象征\0"
+"象徵\0"
+"贝\0"
+"貝\0"
+"贞\0"
+"貞\0"
+"负\0"
+"負\0"
+"贡\0"
+"貢\0"
+"财\0"
+"財\0"
+"责\0"
+"責\0"
+"贤\0"
+"賢\0"
+"贤后\0"
+"賢后\0"
+"败\0"
+"敗\0"
+"账\0"
+"賬\0"
+"货\0"
+"貨\0"
+"质\0"
+"質\0"
+"质数里\0"
+"質數裡\0"
+"质朴\0"
+"質樸\0"
+"贩\0"
+"販\0"
+"贪\0"
+"貪\0"
+"贪欲\0"
+"貪慾\0"
+"贫\0"
+"貧\0"
+"贬\0"
+"貶\0"
+"购\0"
+"購\0"
+"购买欲\0"
+"購買慾\0"
+"购并\0"
+"購併\0"
+"贮\0"
+"貯\0"
+"贯\0"
+"貫\0"
+"贰\0"
+"貳\0"
+"贱\0"
+"賤\0"
+"贲\0"
+"賁\0"
+"贳\0"
+"貰\0"
+"贴\0"
+"貼\0"
+"贵\0"
+"貴\0"
+"贵价\0"
+"貴价\0"
+"贵干\0"
+"貴幹\0"
+"贵征\0"
+"貴徵\0"
+"贶\0"
+"貺\0"
+"贷\0"
+"貸\0"
+"贸\0"
+"貿\0"
+"费\0"
+"費\0"
+"费米面\0"
+"費米面\0"
+"贺\0"
+"賀\0"
+"贻\0"
+"貽\0"
+"贻范\0"
+"貽範\0"
+"贼\0"
+"賊\0"
+"贽\0"
+"贄\0"
+"贾\0"
+"賈\0"
+"贾后\0"
+"賈后\0"
+"贿\0"
+"賄\0"
+"赀\0"
+"貲\0"
+"赁\0"
+"賃\0"
+"赂\0"
+"賂\0"
+"赃\0"
+"贓\0"
+"资\0"
+"資\0"
+"赅\0"
+"賅\0"
+"赆\0"
+"贐\0"
+"赇\0"
+"賕\0"
+"赈\0"
+"賑\0"
+"赈饥\0"
+"賑饑\0"
+"赉\0"
+"賚\0"
+"赊\0"
+"賒\0"
+"赋\0"
+"賦\0"
+"赋范\0"
+"賦范\0"
+"赌\0"
+"賭\0"
+"赌台\0"
+"賭檯\0"
+"赌后\0"
+"賭后\0"
+"赌斗\0"
+"賭鬥\0"
+"赍\0"
+"齎\0"
+"赎\0"
+"贖\0"
+"赏\0"
+"賞\0"
+"赏赞\0"
+"賞讚\0"
+"赐\0"
+"賜\0"
+"赓\0"
+"賡\0"
+"赔\0"
+"賠\0"
+"赕\0"
+"賧\0"
+"赖\0"
+"賴\0"
+"赘\0"
+"贅\0"
+"赙\0"
+"賻\0"
+"赚\0"
+"賺\0"
+"赛\0"
+"賽\0"
+"赜\0"
+"賾\0"
+"赝\0"
+"贗\0"
+"赞\0"
+"贊\0"
+"赞一个\0"
+"讚一個\0"
+"赞不绝口\0"
+"讚不絕口\0"
+"赞乐\0"
+"讚樂\0"
+"赞佩\0"
+"讚佩\0"
+"赞叹\0"
+"讚嘆\0"
+"赞呗\0"
+"讚唄\0"
+"赞扬\0"
+"讚揚\0"
+"赞歌\0"
+"讚歌\0"
+"赞美\0"
+"讚美\0"
+"赞羡\0"
+"讚羨\0"
+"赞誉\0"
+"讚譽\0"
+"赞许\0"
+"讚許\0"
+"赞词\0"
+"讚詞\0"
+"赞赏\0"
+"讚賞\0"
+"赞辞\0"
+"讚辭\0"
+"赞颂\0"
+"讚頌\0"
+"赠\0"
+"贈\0"
+"赡\0"
+"贍\0"
+"赢\0"
+"贏\0"
+"赢余\0"
+"贏餘\0"
+"赣\0"
+"贛\0"
+"赤术\0"
+"赤朮\0"
+"赤绳系足\0"
+"赤繩繫足\0"
+"赵\0"
+"趙\0"
+"赵威后\0"
+"趙威后\0"
+"赵惠后\0"
+"趙惠后\0"
+"赵治勋\0"
+"趙治勳\0"
+"赶\0"
+"趕\0"
+"赶制\0"
+"趕製\0"
+"赶面棍\0"
+"趕麵棍\0"
+"起哄\0"
+"起鬨\0"
+"超级杯\0"
+"超級盃\0"
+"超赞\0"
+"超讚\0"
+"趋\0"
+"趨\0"
+"趱\0"
+"趲\0"
+"趱干\0"
+"趲幹\0"
+"趸\0"
+"躉\0"
+"跃\0"
+"躍\0"
+"跄\0"
+"蹌\0"
+"跞\0"
+"躒\0"
+"路图里\0"
+"路圖裡\0"
+"路签\0"
+"路籤\0"
+"跳梁小丑\0"
+"跳樑小丑\0"
+"跳荡\0"
+"跳蕩\0"
+"践\0"
+"踐\0"
+"跷\0"
+"蹺\0"
+"跸\0"
+"蹕\0"
+"跹\0"
+"躚\0"
+"跻\0"
+"躋\0"
+"踊\0"
+"踴\0"
+"踌\0"
+"躊\0"
+"踡局\0"
+"踡跼\0"
+"踪\0"
+"蹤\0"
+"踬\0"
+"躓\0"
+"踯\0"
+"躑\0"
+"蹑\0"
+"躡\0"
+"蹒\0"
+"蹣\0"
+"蹒局\0"
+"蹣跼\0"
+"蹭棱子\0"
+"蹭稜子\0"
+"蹰\0"
+"躕\0"
+"蹿\0"
+"躥\0"
+"躁郁\0"
+"躁鬱\0"
+"躏\0"
+"躪\0"
+"躜\0"
+"躦\0"
+"身体发肤\0"
+"身體髮膚\0"
+"躯\0"
+"軀\0"
+"躯干\0"
+"軀幹\0"
+"车\0"
+"車\0"
+"车库里\0"
+"車庫裡\0"
+"车站里\0"
+"車站裡\0"
+"车里\0"
+"車裡\0"
+"车里雅宾斯克\0"
+"車里雅賓斯克\0"
+"轧\0"
+"軋\0"
+"轨\0"
+"軌\0"
+"轨范\0"
+"軌範\0"
+"轩\0"
+"軒\0"
+"轩辟\0"
+"軒闢\0"
+"轫\0"
+"軔\0"
+"转\0"
+"轉\0"
+"转向\0"
+"轉向\0"
+"转托\0"
+"轉託\0"
+"转斗千里\0"
+"轉鬥千里\0"
+"轭\0"
+"軛\0"
+"轮\0"
+"輪\0"
+"轮回\0"
+"輪迴\0"
+"轮奸\0"
+"輪姦\0"
+"软\0"
+"軟\0"
+"轰\0"
+"轟\0"
+"轲\0"
+"軻\0"
+"轳\0"
+"轤\0"
+"轴\0"
+"軸\0"
+"轵\0"
+"軹\0"
+"轶\0"
+"軼\0"
+"轸\0"
+"軫\0"
+"轹\0"
+"轢\0"
+"轺\0"
+"軺\0"
+"轻\0"
+"輕\0"
+"轻松\0"
+"輕鬆\0"
+"轻松松\0"
+"輕鬆鬆\0"
+"轼\0"
+"軾\0"
+"载\0"
+"載\0"
+"轾\0"
+"輊\0"
+"轿\0"
+"轎\0"
+"辁\0"
+"輇\0"
+"辂\0"
+"輅\0"
+"较\0"
+"較\0"
+"辄\0"
+"輒\0"
+"辅\0"
+"輔\0"
+"辆\0"
+"輛\0"
+"辇\0"
+"輦\0"
+"辈\0"
+"輩\0"
+"辉\0"
+"輝\0"
+"辊\0"
+"輥\0"
+"辋\0"
+"輞\0"
+"辍\0"
+"輟\0"
+"辎\0"
+"輜\0"
+"辏\0"
+"輳\0"
+"辐\0"
+"輻\0"
+"辑\0"
+"輯\0"
+"输\0"
+"輸\0"
+"辔\0"
+"轡\0"
+"辕\0"
+"轅\0"
+"辖\0"
+"轄\0"
+"辗\0"
+"輾\0"
+"辘\0"
+"轆\0"
+"辙\0"
+"轍\0"
+"辚\0"
+"轔\0"
+"辞\0"
+"辭\0"
+"辞汇\0"
+"辭彙\0"
+"辟为\0"
+"闢為\0"
+"辟佛\0"
+"闢佛\0"
+"辟作\0"
+"闢作\0"
+"辟划\0"
+"闢劃\0"
+"辟土\0"
+"闢土\0"
+"辟地\0"
+"闢地\0"
+"辟室\0"
+"闢室\0"
+"辟建\0"
+"闢建\0"
+"辟田\0"
+"闢田\0"
+"辟筑\0"
+"闢築\0"
+"辟谣\0"
+"闢謠\0"
+"辟谷\0"
+"辟穀\0"
+"辟辟\0"
+"闢辟\0"
+"辟邪以律\0"
+"闢邪以律\0"
+"辣面\0"
+"辣麵\0"
+"辩\0"
+"辯\0"
+"辩斗\0"
+"辯鬥\0"
+"辫\0"
+"辮\0"
+"辫发\0"
+"辮髮\0"
+"辰溪县\0"
+"辰谿縣\0"
+"边\0"
+"邊\0"
+"辽\0"
+"遼\0"
+"辽沈\0"
+"遼瀋\0"
+"达\0"
+"達\0"
+"迁\0"
+"遷\0"
+"迂回\0"
+"迂迴\0"
+"过\0"
+"過\0"
+"过水面\0"
+"過水麵\0"
+"迈\0"
+"邁\0"
+"运\0"
+"運\0"
+"近日无仇\0"
+"近日無讎\0"
+"返朴\0"
+"返樸\0"
+"还\0"
+"還\0"
+"还冲\0"
+"還衝\0"
+"还采\0"
+"還採\0"
+"这\0"
+"這\0"
+"这么干\0"
+"這麼幹\0"
+"这伙人\0"
+"這夥人\0"
+"这出\0"
+"這齣\0"
+"这出世\0"
+"這出世\0"
+"这出乎\0"
+"這出乎\0"
+"这出人\0"
+"這出人\0"
+"这出版\0"
+"這出版\0"
+"这出现\0"
+"這出現\0"
+"这出生\0"
+"這出生\0"
+"这出色\0"
+"這出色\0"
+"这出身\0"
+"這出身\0"
+"这出道\0"
+"這出道\0"
+"这只\0"
+"這隻\0"
+"这只不\0"
+"這只不\0"
+"这只不过\0"
+"這只不過\0"
+"这只会\0"
+"這只會\0"
+"这只允\0"
+"這只允\0"
+"这只包括\0"
+"這只包括\0"
+"这只可\0"
+"這只可\0"
+"这只在\0"
+"這只在\0"
+"这只容\0"
+"這只容\0"
+"这只应\0"
+"這只應\0"
+"这只是\0"
+"這只是\0"
+"这只比\0"
+"這只比\0"
+"这只用\0"
+"這只用\0"
+"这只能\0"
+"這只能\0"
+"这只采\0"
+"這只採\0"
+"这只限\0"
+"這只限\0"
+"这只需\0"
+"這只需\0"
+"这只须\0"
+"這只須\0"
+"这里\0"
+"這裡\0"
+"这钟\0"
+"這鐘\0"
+"进\0"
+"進\0"
+"进两出\0"
+"進兩出\0"
+"进制\0"
+"進制\0"
+"远\0"
+"遠\0"
+"远游\0"
+"遠遊\0"
+"违\0"
+"違\0"
+"连\0"
+"連\0"
+"连三并四\0"
+"連三併四\0"
+"连发式\0"
+"連發式\0"
+"连系\0"
+"連繫\0"
+"连采\0"
+"連採\0"
+"迟\0"
+"遲\0"
+"迥然回异\0"
+"迥然迴異\0"
+"迩\0"
+"邇\0"
+"迳\0"
+"逕\0"
+"迷蒙\0"
+"迷濛\0"
+"迹\0"
+"跡\0"
+"追凶\0"
+"追兇\0"
+"退伙\0"
+"退夥\0"
+"适\0"
+"適\0"
+"逆钟\0"
+"逆鐘\0"
+"逆钟向\0"
+"逆鐘向\0"
+"逆风后\0"
+"逆風後\0"
+"选\0"
+"選\0"
+"选手表决\0"
+"選手表決\0"
+"选手表明\0"
+"選手表明\0"
+"选手表现\0"
+"選手表現\0"
+"选手表示\0"
+"選手表示\0"
+"选手表达\0"
+"選手表達\0"
+"逊\0"
+"遜\0"
+"逋发\0"
+"逋髮\0"
+"逍遥游\0"
+"逍遙遊\0"
+"透辟\0"
+"透闢\0"
+"递\0"
+"遞\0"
+"递回\0"
+"遞迴\0"
+"通历\0"
+"通曆\0"
+"通历史\0"
+"通歷史\0"
+"通奸\0"
+"通姦\0"
+"通心面\0"
+"通心麵\0"
+"通鉴\0"
+"通鑑\0"
+"逞凶斗狠\0"
+"逞兇鬥狠\0"
+"造钟\0"
+"造鐘\0"
+"逦\0"
+"邐\0"
+"逻\0"
+"邏\0"
+"逼并\0"
+"逼併\0"
+"逾闲\0"
+"踰閑\0"
+"遇风后\0"
+"遇風後\0"
+"道范\0"
+"道範\0"
+"遗\0"
+"遺\0"
+"遗传钟\0"
+"遺傳鐘\0"
+"遗范\0"
+"遺範\0"
+"遗迹\0"
+"遺蹟\0"
+"遥\0"
+"遙\0"
+"遨游\0"
+"遨遊\0"
+"遮丑\0"
+"遮醜\0"
+"邀天之幸\0"
+"邀天之倖\0"
+"邋里邋遢\0"
+"邋裡邋遢\0"
+"邓\0"
+"鄧\0"
+"邝\0"
+"鄺\0"
+"那卷\0"
+"那捲\0"
+"那只\0"
+"那隻\0"
+"那只不过\0"
+"那只不過\0"
+"那只会\0"
+"那只會\0"
+"那只应\0"
+"那只應\0"
+"那只须\0"
+"那只須\0"
+"那里\0"
+"那裡\0"
+"邬\0"
+"鄔\0"
+"邮\0"
+"郵\0"
+"邹\0"
+"鄒\0"
+"邺\0"
+"鄴\0"
+"邻\0"
+"鄰\0"
+"郁伊\0"
+"鬱伊\0"
+"郁勃\0"
+"鬱勃\0"
+"郁卒\0"
+"鬱卒\0"
+"郁南\0"
+"鬱南\0"
+"郁垒\0"
+"鬱壘\0"
+"郁堙不偶\0"
+"鬱堙不偶\0"
+"郁塞\0"
+"鬱塞\0"
+"郁律\0"
+"鬱律\0"
+"郁悒\0"
+"鬱悒\0"
+"郁愤\0"
+"鬱憤\0"
+"郁抑\0"
+"鬱抑\0"
+"郁挹\0"
+"鬱挹\0"
+"郁朴\0"
+"郁樸\0"
+"郁林\0"
+"鬱林\0"
+"郁气\0"
+"鬱氣\0"
+"郁江\0"
+"鬱江\0"
+"郁沉沉\0"
+"鬱沉沉\0"
+"郁泱\0"
+"鬱泱\0"
+"郁火\0"
+"鬱火\0"
+"郁热\0"
+"鬱熱\0"
+"郁燠\0"
+"鬱燠\0"
+"郁症\0"
+"鬱症\0"
+"郁积\0"
+"鬱積\0"
+"郁纡\0"
+"鬱紆\0"
+"郁结\0"
+"鬱結\0"
+"郁蒸\0"
+"鬱蒸\0"
+"郁蓊\0"
+"鬱蓊\0"
+"郁血\0"
+"鬱血\0"
+"郁邑\0"
+"鬱邑\0"
+"郁郁\0"
+"鬱郁\0"
+"郁郁不乐\0"
+"鬱鬱不樂\0"
+"郁郁不平\0"
+"鬱鬱不平\0"
+"郁郁寡欢\0"
+"鬱鬱寡歡\0"
+"郁郁而终\0"
+"鬱鬱而終\0"
+"郁郁苍苍\0"
+"鬱鬱蒼蒼\0"
+"郁郁葱葱\0"
+"鬱鬱蔥蔥\0"
+"郁金\0"
+"鬱金\0"
+"郁闭\0"
+"鬱閉\0"
+"郁闷\0"
+"鬱悶\0"
+"郁陶\0"
+"鬱陶\0"
+"郁黑\0"
+"鬱黑\0"
+"郊游\0"
+"郊遊\0"
+"郏\0"
+"郟\0"
+"郐\0"
+"鄶\0"
+"郑\0"
+"鄭\0"
+"郑凯云\0"
+"鄭凱云\0"
+"郓\0"
+"鄆\0"
+"郘钟\0"
+"郘鐘\0"
+"郦\0"
+"酈\0"
+"郧\0"
+"鄖\0"
+"部落发\0"
+"部落發\0"
+"郸\0"
+"鄲\0"
+"都市里\0"
+"都市裡\0"
+"配制\0"
+"配製\0"
+"配制饲料\0"
+"配制飼料\0"
+"配图里\0"
+"配圖裡\0"
+"酒坛\0"
+"酒罈\0"
+"酒曲\0"
+"酒麴\0"
+"酒气冲天\0"
+"酒氣衝天\0"
+"酒麹\0"
+"酒麴\0"
+"酝\0"
+"醞\0"
+"酥松\0"
+"酥鬆\0"
+"酱\0"
+"醬\0"
+"酸姜\0"
+"酸薑\0"
+"酽\0"
+"釅\0"
+"酾\0"
+"釃\0"
+"酿\0"
+"釀\0"
+"酿制\0"
+"釀製\0"
+"醇朴\0"
+"醇樸\0"
+"醋坛\0"
+"醋罈\0"
+"采下\0"
+"採下\0"
+"采为\0"
+"採為\0"
+"采买\0"
+"採買\0"
+"采伐\0"
+"採伐\0"
+"采住\0"
+"採住\0"
+"采信\0"
+"採信\0"
+"采光\0"
+"採光\0"
+"采到\0"
+"採到\0"
+"采制\0"
+"採制\0"
+"采办\0"
+"採辦\0"
+"采区\0"
+"採區\0"
+"采去\0"
+"採去\0"
+"采取\0"
+"採取\0"
+"采回\0"
+"採回\0"
+"采在\0"
+"採在\0"
+"采好\0"
+"採好\0"
+"采录\0"
+"採錄\0"
+"采得\0"
+"採得\0"
+"采择\0"
+"採擇\0"
+"采拾\0"
+"採拾\0"
+"采挖\0"
+"採挖\0"
+"采掘\0"
+"採掘\0"
+"采摘\0"
+"採摘\0"
+"采摭\0"
+"採摭\0"
+"采撷\0"
+"採擷\0"
+"采收\0"
+"採收\0"
+"采料\0"
+"採料\0"
+"采暖\0"
+"採暖\0"
+"采树种\0"
+"採樹種\0"
+"采样\0"
+"採樣\0"
+"采桑\0"
+"採桑\0"
+"采樵人\0"
+"採樵人\0"
+"采气\0"
+"採氣\0"
+"采油\0"
+"採油\0"
+"采煤\0"
+"採煤\0"
+"采猎\0"
+"採獵\0"
+"采珠\0"
+"採珠\0"
+"采生折割\0"
+"採生折割\0"
+"采用\0"
+"採用\0"
+"采盐\0"
+"採鹽\0"
+"采石\0"
+"採石\0"
+"采石之战\0"
+"采石之戰\0"
+"采石矶\0"
+"采石磯\0"
+"采矿\0"
+"採礦\0"
+"采砂场\0"
+"採砂場\0"
+"采种\0"
+"採種\0"
+"采空区\0"
+"採空區\0"
+"采空采穗\0"
+"採空採穗\0"
+"采納\0"
+"採納\0"
+"采纳\0"
+"採納\0"
+"采给\0"
+"採給\0"
+"采花\0"
+"採花\0"
+"采芹人\0"
+"採芹人\0"
+"采茶\0"
+"採茶\0"
+"采药\0"
+"採藥\0"
+"采莲\0"
+"採蓮\0"
+"采获\0"
+"採獲\0"
+"采菊\0"
+"採菊\0"
+"采薇\0"
+"採薇\0"
+"采薪\0"
+"採薪\0"
+"采血\0"
+"採血\0"
+"采行\0"
+"採行\0"
+"采补\0"
+"採補\0"
+"采访\0"
+"採訪\0"
+"采证\0"
+"採證\0"
+"采购\0"
+"採購\0"
+"采过\0"
+"採過\0"
+"采运\0"
+"採運\0"
+"采选\0"
+"採選\0"
+"采金\0"
+"採金\0"
+"采铁\0"
+"採鐵\0"
+"采集\0"
+"採集\0"
+"采风\0"
+"採風\0"
+"采风问俗\0"
+"採風問俗\0"
+"采食\0"
+"採食\0"
+"释\0"
+"釋\0"
+"里勾外连\0"
+"裡勾外連\0"
+"里头\0"
+"裡頭\0"
+"里层\0"
+"裡層\0"
+"里屋\0"
+"裡屋\0"
+"里带\0"
+"裡帶\0"
+"里应外合\0"
+"裡應外合\0"
+"里弦\0"
+"裡弦\0"
+"里水镇\0"
+"裏水鎮\0"
+"里海\0"
+"裏海\0"
+"里海大学\0"
+"里海大學\0"
+"里白\0"
+"裏白\0"
+"里脊\0"
+"裡脊\0"
+"里衣\0"
+"裡衣\0"
+"里边\0"
+"裡邊\0"
+"里运河\0"
+"裏運河\0"
+"里通外国\0"
+"裡通外國\0"
+"里通外敌\0"
+"裡通外敵\0"
+"里铺\0"
+"里舖\0"
+"里间\0"
+"裡間\0"
+"里面\0"
+"裡面\0"
+"里面包\0"
+"裡面包\0"
+"重制\0"
+"重製\0"
+"重复\0"
+"重複\0"
+"重托\0"
+"重託\0"
+"重游\0"
+"重遊\0"
+"重罗面\0"
+"重羅麵\0"
+"野姜\0"
+"野薑\0"
+"野游\0"
+"野遊\0"
+"量不准\0"
+"量不準\0"
+"金仆姑\0"
+"金僕姑\0"
+"金发\0"
+"金髮\0"
+"金圣叹\0"
+"金聖歎\0"
+"金溪县\0"
+"金谿縣\0"
+"金范\0"
+"金範\0"
+"金表态\0"
+"金表態\0"
+"金表扬\0"
+"金表揚\0"
+"金表现\0"
+"金表現\0"
+"金表达\0"
+"金表達\0"
+"金装玉里\0"
+"金裝玉裡\0"
+"金钟\0"
+"金鐘\0"
+"金链\0"
+"金鍊\0"
+"鉴\0"
+"鑒\0"
+"鉴于\0"
+"鑑於\0"
+"鉴别\0"
+"鑑別\0"
+"鉴古\0"
+"鑑古\0"
+"鉴定\0"
+"鑑定\0"
+"鉴察\0"
+"鑑察\0"
+"鉴往知来\0"
+"鑑往知來\0"
+"鉴戒\0"
+"鑑戒\0"
+"鉴湖\0"
+"鑑湖\0"
+"鉴藏\0"
+"鑑藏\0"
+"鉴证\0"
+"鑑證\0"
+"鉴识\0"
+"鑑識\0"
+"鉴谅\0"
+"鑑諒\0"
+"鉴赏\0"
+"鑑賞\0"
+"銮\0"
+"鑾\0"
+"錾\0"
+"鏨\0"
+"钆\0"
+"釓\0"
+"钇\0"
+"釔\0"
+"针\0"
+"針\0"
+"钉\0"
+"釘\0"
+"钊\0"
+"釗\0"
+"钋\0"
+"釙\0"
+"钌\0"
+"釕\0"
+"钍\0"
+"釷\0"
+"钏\0"
+"釧\0"
+"钐\0"
+"釤\0"
+"钒\0"
+"釩\0"
+"钓\0"
+"釣\0"
+"钔\0"
+"鍆\0"
+"钕\0"
+"釹\0"
+"钗\0"
+"釵\0"
+"钙\0"
+"鈣\0"
+"钛\0"
+"鈦\0"
+"钜\0"
+"鉅\0"
+"钝\0"
+"鈍\0"
+"钞\0"
+"鈔\0"
+"钟\0"
+"鍾\0"
+"钟上\0"
+"鐘上\0"
+"钟下\0"
+"鐘下\0"
+"钟不\0"
+"鐘不\0"
+"钟不扣不鸣\0"
+"鐘不扣不鳴\0"
+"钟不撞不鸣\0"
+"鐘不撞不鳴\0"
+"钟不敲不响\0"
+"鐘不敲不響\0"
+"钟不空则哑\0"
+"鐘不空則啞\0"
+"钟乳洞\0"
+"鐘乳洞\0"
+"钟乳石\0"
+"鐘乳石\0"
+"钟体\0"
+"鐘體\0"
+"钟停\0"
+"鐘停\0"
+"钟关\0"
+"鐘關\0"
+"钟匠\0"
+"鐘匠\0"
+"钟发音\0"
+"鐘發音\0"
+"钟口\0"
+"鐘口\0"
+"钟响\0"
+"鐘響\0"
+"钟在寺里\0"
+"鐘在寺裡\0"
+"钟塔\0"
+"鐘塔\0"
+"钟壁\0"
+"鐘壁\0"
+"钟声\0"
+"鐘聲\0"
+"钟太\0"
+"鐘太\0"
+"钟头\0"
+"鐘頭\0"
+"钟好\0"
+"鐘好\0"
+"钟山\0"
+"鐘山\0"
+"钟左右\0"
+"鐘左右\0"
+"钟差\0"
+"鐘差\0"
+"钟座\0"
+"鐘座\0"
+"钟形\0"
+"鐘形\0"
+"钟形虫\0"
+"鐘形蟲\0"
+"钟律\0"
+"鐘律\0"
+"钟快\0"
+"鐘快\0"
+"钟慢\0"
+"鐘慢\0"
+"钟摆\0"
+"鐘擺\0"
+"钟敲\0"
+"鐘敲\0"
+"钟有\0"
+"鐘有\0"
+"钟楼\0"
+"鐘樓\0"
+"钟模\0"
+"鐘模\0"
+"钟没\0"
+"鐘沒\0"
+"钟漏\0"
+"鐘漏\0"
+"钟点\0"
+"鐘點\0"
+"钟王\0"
+"鐘王\0"
+"钟琴\0"
+"鐘琴\0"
+"钟的\0"
+"鐘的\0"
+"钟盘\0"
+"鐘盤\0"
+"钟相\0"
+"鐘相\0"
+"钟磬\0"
+"鐘磬\0"
+"钟纽\0"
+"鐘紐\0"
+"钟罩\0"
+"鐘罩\0"
+"钟腰\0"
+"鐘腰\0"
+"钟花\0"
+"鐘花\0"
+"钟螺\0"
+"鐘螺\0"
+"钟行\0"
+"鐘行\0"
+"钟表\0"
+"鐘錶\0"
+"钟表停\0"
+"鐘錶停\0"
+"钟表快\0"
+"鐘錶快\0"
+"钟表慢\0"
+"鐘錶慢\0"
+"钟表王\0"
+"鐘錶王\0"
+"钟表盘\0"
+"鐘錶盤\0"
+"钟表速\0"
+"鐘錶速\0"
+"钟表面\0"
+"鐘表面\0"
+"钟被\0"
+"鐘被\0"
+"钟调\0"
+"鐘調\0"
+"钟身\0"
+"鐘身\0"
+"钟速\0"
+"鐘速\0"
+"钟陈列\0"
+"鐘陳列\0"
+"钟面\0"
+"鐘面\0"
+"钟顶\0"
+"鐘頂\0"
+"钟鸣\0"
+"鐘鳴\0"
+"钟鼎\0"
+"鐘鼎\0"
+"钟鼓\0"
+"鐘鼓\0"
+"钠\0"
+"鈉\0"
+"钡\0"
+"鋇\0"
+"钢\0"
+"鋼\0"
+"钢之炼金术师\0"
+"鋼之鍊金術師\0"
+"钢制\0"
+"鋼製\0"
+"钢梁\0"
+"鋼樑\0"
+"钣\0"
+"鈑\0"
+"钤\0"
+"鈐\0"
+"钥\0"
+"鑰\0"
+"钦\0"
+"欽\0"
+"钧\0"
+"鈞\0"
+"钨\0"
+"鎢\0"
+"钩\0"
+"鈎\0"
+"钩心斗角\0"
+"鈎心鬥角\0"
+"钪\0"
+"鈧\0"
+"钫\0"
+"鈁\0"
+"钬\0"
+"鈥\0"
+"钭\0"
+"鈄\0"
+"钮\0"
+"鈕\0"
+"钯\0"
+"鈀\0"
+"钰\0"
+"鈺\0"
+"钱\0"
+"錢\0"
+"钱范\0"
+"錢範\0"
+"钱谷\0"
+"錢穀\0"
+"钲\0"
+"鉦\0"
+"钳\0"
+"鉗\0"
+"钴\0"
+"鈷\0"
+"钵\0"
+"缽\0"
+"钶\0"
+"鈳\0"
+"钸\0"
+"鈽\0"
+"钹\0"
+"鈸\0"
+"钺\0"
+"鉞\0"
+"钻\0"
+"鑽\0"
+"钼\0"
+"鉬\0"
+"钽\0"
+"鉭\0"
+"钾\0"
+"鉀\0"
+"钿\0"
+"鈿\0"
+"铀\0"
+"鈾\0"
+"铁\0"
+"鐵\0"
+"铁制\0"
+"鐵製\0"
+"铁钟\0"
+"鐵鐘\0"
+"铁锈\0"
+"鐵鏽\0"
+"铂\0"
+"鉑\0"
+"铃\0"
+"鈴\0"
+"铄\0"
+"鑠\0"
+"铅\0"
+"鉛\0"
+"铆\0"
+"鉚\0"
+"铈\0"
+"鈰\0"
+"铉\0"
+"鉉\0"
+"铊\0"
+"鉈\0"
+"铋\0"
+"鉍\0"
+"铌\0"
+"鈮\0"
+"铍\0"
+"鈹\0"
+"铎\0"
+"鐸\0"
+"铐\0"
+"銬\0"
+"铑\0"
+"銠\0"
+"铒\0"
+"鉺\0"
+"铕\0"
+"銪\0"
+"铖\0"
+"鋮\0"
+"铗\0"
+"鋏\0"
+"铙\0"
+"鐃\0"
+"铛\0"
+"鐺\0"
+"铜\0"
+"銅\0"
+"铜制\0"
+"銅製\0"
+"铜范\0"
+"銅範\0"
+"铜钟\0"
+"銅鐘\0"
+"铝\0"
+"鋁\0"
+"铝制\0"
+"鋁製\0"
+"铟\0"
+"銦\0"
+"铠\0"
+"鎧\0"
+"铡\0"
+"鍘\0"
+"铢\0"
+"銖\0"
+"铣\0"
+"銑\0"
+"铤\0"
+"鋌\0"
+"铥\0"
+"銩\0"
+"铧\0"
+"鏵\0"
+"铨\0"
+"銓\0"
+"铩\0"
+"鎩\0"
+"铪\0"
+"鉿\0"
+"铫\0"
+"銚\0"
+"铬\0"
+"鉻\0"
+"铭\0"
+"銘\0"
+"铮\0"
+"錚\0"
+"铯\0"
+"銫\0"
+"铯钟\0"
+"銫鐘\0"
+"铰\0"
+"鉸\0"
+"铱\0"
+"銥\0"
+"铲\0"
+"鏟\0"
+"铲出\0"
+"剷出\0"
+"铲刈\0"
+"剷刈\0"
+"铲头\0"
+"剷頭\0"
+"铲平\0"
+"剷平\0"
+"铲除\0"
+"剷除\0"
+"铳\0"
+"銃\0"
+"铴\0"
+"鐋\0"
+"铵\0"
+"銨\0"
+"银\0"
+"銀\0"
+"银发\0"
+"銀髮\0"
+"银朱\0"
+"銀硃\0"
+"铷\0"
+"銣\0"
+"铸\0"
+"鑄\0"
+"铸钟\0"
+"鑄鐘\0"
+"铹\0"
+"鐒\0"
+"铺\0"
+"鋪\0"
+"铼\0"
+"錸\0"
+"铽\0"
+"鋱\0"
+"链\0"
+"鏈\0"
+"链表\0"
+"鍊表\0"
+"铿\0"
+"鏗\0"
+"销\0"
+"銷\0"
+"锁\0"
+"鎖\0"
+"锂\0"
+"鋰\0"
+"锄\0"
+"鋤\0"
+"锅\0"
+"鍋\0"
+"锆\0"
+"鋯\0"
+"锇\0"
+"鋨\0"
+"锈\0"
+"銹\0"
+"锈病\0"
+"鏽病\0"
+"锈菌\0"
+"鏽菌\0"
+"锈蚀\0"
+"鏽蝕\0"
+"锉\0"
+"銼\0"
+"锊\0"
+"鋝\0"
+"锋\0"
+"鋒\0"
+"锌\0"
+"鋅\0"
+"锌制\0"
+"鋅製\0"
+"锐\0"
+"銳\0"
+"锑\0"
+"銻\0"
+"锒\0"
+"鋃\0"
+"锓\0"
+"鋟\0"
+"锔\0"
+"鋦\0"
+"锕\0"
+"錒\0"
+"锖\0"
+"錆\0"
+"锗\0"
+"鍺\0"
+"错\0"
+"錯\0"
+"锚\0"
+"錨\0"
+"锛\0"
+"錛\0"
+"锞\0"
+"錁\0"
+"锟\0"
+"錕\0"
+"锡\0"
+"錫\0"
+"锢\0"
+"錮\0"
+"锣\0"
+"鑼\0"
+"锤\0"
+"錘\0"
+"锤炼\0"
+"錘鍊\0"
+"锥\0"
+"錐\0"
+"锦\0"
+"錦\0"
+"锦卤\0"
+"錦滷\0"
+"锦绣花园\0"
+"錦綉花園\0"
+"锨\0"
+"杴\0"
+"锩\0"
+"錈\0"
+"锬\0"
+"錟\0"
+"锭\0"
+"錠\0"
+"键\0"
+"鍵\0"
+"锯\0"
+"鋸\0"
+"锰\0"
+"錳\0"
+"锱\0"
+"錙\0"
+"锲\0"
+"鍥\0"
+"锲而不舍\0"
+"鍥而不捨\0"
+"锴\0"
+"鍇\0"
+"锵\0"
+"鏘\0"
+"锶\0"
+"鍶\0"
+"锷\0"
+"鍔\0"
+"锸\0"
+"鍤\0"
+"锹\0"
+"鍬\0"
+"锺\0"
+"鍾\0"
+"锻\0"
+"鍛\0"
+"锼\0"
+"鎪\0"
+"锾\0"
+"鍰\0"
+"镀\0"
+"鍍\0"
+"镁\0"
+"鎂\0"
+"镂\0"
+"鏤\0"
+"镄\0"
+"鐨\0"
+"镆\0"
+"鏌\0"
+"镇\0"
+"鎮\0"
+"镇里\0"
+"鎮裡\0"
+"镉\0"
+"鎘\0"
+"镊\0"
+"鑷\0"
+"镌\0"
+"鐫\0"
+"镍\0"
+"鎳\0"
+"镏\0"
+"鎦\0"
+"镐\0"
+"鎬\0"
+"镑\0"
+"鎊\0"
+"镒\0"
+"鎰\0"
+"镓\0"
+"鎵\0"
+"镔\0"
+"鑌\0"
+"镖\0"
+"鏢\0"
+"镗\0"
+"鏜\0"
+"镘\0"
+"鏝\0"
+"镙\0"
+"鏍\0"
+"镛\0"
+"鏞\0"
+"镜\0"
+"鏡\0"
+"镜图里\0"
+"鏡圖裡\0"
+"镝\0"
+"鏑\0"
+"镞\0"
+"鏃\0"
+"镟\0"
+"鏇\0"
+"镡\0"
+"鐔\0"
+"镢\0"
+"钁\0"
+"镣\0"
+"鐐\0"
+"镤\0"
+"鏷\0"
+"镦\0"
+"鐓\0"
+"镧\0"
+"鑭\0"
+"镨\0"
+"鐠\0"
+"镪\0"
+"鏹\0"
+"镫\0"
+"鐙\0"
+"镬\0"
+"鑊\0"
+"镭\0"
+"鐳\0"
+"镯\0"
+"鐲\0"
+"镰\0"
+"鐮\0"
+"镰仓\0"
+"鎌倉\0"
+"镱\0"
+"鐿\0"
+"镳\0"
+"鑣\0"
+"镶\0"
+"鑲\0"
+"长\0"
+"長\0"
+"长几\0"
+"長几\0"
+"长历\0"
+"長曆\0"
+"长历史\0"
+"長歷史\0"
+"长发公主\0"
+"長髮公主\0"
+"长发妹\0"
+"長髮妹\0"
+"长发姑娘\0"
+"長髮姑娘\0"
+"长得丑\0"
+"長得醜\0"
+"门\0"
+"門\0"
+"门吊儿\0"
+"門弔兒\0"
+"门帘\0"
+"門帘\0"
+"门里\0"
+"門裡\0"
+"闩\0"
+"閂\0"
+"闪\0"
+"閃\0"
+"闫\0"
+"閆\0"
+"闫怀礼\0"
+"閆懷禮\0"
+"闭\0"
+"閉\0"
+"问\0"
+"問\0"
+"闯\0"
+"闖\0"
+"闯炼\0"
+"闖鍊\0"
+"闯荡\0"
+"闖蕩\0"
+"闰\0"
+"閏\0"
+"闱\0"
+"闈\0"
+"闲\0"
+"閒\0"
+"闲情逸致\0"
+"閒情逸緻\0"
+"闲游\0"
+"閒遊\0"
+"闲荡\0"
+"閒蕩\0"
+"闲邪\0"
+"閑邪\0"
+"闳\0"
+"閎\0"
+"间\0"
+"間\0"
+"间不容发\0"
+"間不容髮\0"
+"间里\0"
+"間裡\0"
+"闵\0"
+"閔\0"
+"闵采尔\0"
+"閔採爾\0"
+"闶\0"
+"閌\0"
+"闷\0"
+"悶\0"
+"闸\0"
+"閘\0"
+"闹\0"
+"鬧\0"
+"闹表\0"
+"鬧錶\0"
+"闹钟\0"
+"鬧鐘\0"
+"闺\0"
+"閨\0"
+"闺范\0"
+"閨範\0"
+"闻\0"
+"聞\0"
+"闻风后\0"
+"聞風後\0"
+"闼\0"
+"闥\0"
+"闽\0"
+"閩\0"
+"闾\0"
+"閭\0"
+"阀\0"
+"閥\0"
+"阁\0"
+"閣\0"
+"阁府\0"
+"閤府\0"
+"阂\0"
+"閡\0"
+"阃\0"
+"閫\0"
+"阃范\0"
+"閫範\0"
+"阄\0"
+"鬮\0"
+"阅\0"
+"閱\0"
+"阆\0"
+"閬\0"
+"阈\0"
+"閾\0"
+"阉\0"
+"閹\0"
+"阊\0"
+"閶\0"
+"阋\0"
+"鬩\0"
+"阌\0"
+"閿\0"
+"阍\0"
+"閽\0"
+"阎\0"
+"閻\0"
+"阏\0"
+"閼\0"
+"阐\0"
+"闡\0"
+"阑\0"
+"闌\0"
+"阒\0"
+"闃\0"
+"阔\0"
+"闊\0"
+"阕\0"
+"闋\0"
+"阖\0"
+"闔\0"
+"阗\0"
+"闐\0"
+"阙\0"
+"闕\0"
+"阚\0"
+"闞\0"
+"队\0"
+"隊\0"
+"队里\0"
+"隊裡\0"
+"防御\0"
+"防禦\0"
+"防水表\0"
+"防水錶\0"
+"防范\0"
+"防範\0"
+"防锈\0"
+"防鏽\0"
+"阳\0"
+"陽\0"
+"阳历\0"
+"陽曆\0"
+"阳历史\0"
+"陽歷史\0"
+"阳春面\0"
+"陽春麵\0"
+"阳谷\0"
+"陽穀\0"
+"阴\0"
+"陰\0"
+"阴历\0"
+"陰曆\0"
+"阴历史\0"
+"陰歷史\0"
+"阴干\0"
+"陰乾\0"
+"阴沟里翻船\0"
+"陰溝裡翻船\0"
+"阴郁\0"
+"陰鬱\0"
+"阵\0"
+"陣\0"
+"阶\0"
+"階\0"
+"附注\0"
+"附註\0"
+"际\0"
+"際\0"
+"陆\0"
+"陸\0"
+"陇\0"
+"隴\0"
+"陈\0"
+"陳\0"
+"陈升\0"
+"陳昇\0"
+"陈有后\0"
+"陳有后\0"
+"陈杰\0"
+"陳杰\0"
+"陈炼\0"
+"陳鍊\0"
+"陉\0"
+"陘\0"
+"陕\0"
+"陝\0"
+"院里\0"
+"院裡\0"
+"陧\0"
+"隉\0"
+"陨\0"
+"隕\0"
+"险\0"
+"險\0"
+"陪吊\0"
+"陪弔\0"
+"陶制\0"
+"陶製\0"
+"隆准\0"
+"隆準\0"
+"隆准许\0"
+"隆准許\0"
+"随\0"
+"隨\0"
+"隐\0"
+"隱\0"
+"隐几\0"
+"隱几\0"
+"隐占\0"
+"隱佔\0"
+"隶\0"
+"隸\0"
+"隽\0"
+"雋\0"
+"难\0"
+"難\0"
+"难舍\0"
+"難捨\0"
+"雅范\0"
+"雅範\0"
+"集团\0"
+"集團\0"
+"集数里\0"
+"集數裡\0"
+"集游法\0"
+"集遊法\0"
+"集里\0"
+"集裡\0"
+"雇主\0"
+"僱主\0"
+"雇人\0"
+"僱人\0"
+"雇佣\0"
+"僱傭\0"
+"雇农\0"
+"僱農\0"
+"雇到\0"
+"僱到\0"
+"雇工\0"
+"僱工\0"
+"雇船\0"
+"僱船\0"
+"雇请\0"
+"僱請\0"
+"雇车\0"
+"僱車\0"
+"雏\0"
+"雛\0"
+"雕心雁爪\0"
+"鵰心雁爪\0"
+"雕悍\0"
+"鵰悍\0"
+"雕梁画栋\0"
+"雕樑畫棟\0"
+"雕翎\0"
+"鵰翎\0"
+"雕鹗\0"
+"鵰鶚\0"
+"雠\0"
+"讎\0"
+"雨蒙蒙\0"
+"雨濛濛\0"
+"雪窗萤几\0"
+"雪窗螢几\0"
+"雪里\0"
+"雪裡\0"
+"雪里红\0"
+"雪裡紅\0"
+"雪里蕻\0"
+"雪裡蕻\0"
+"雳\0"
+"靂\0"
+"零个\0"
+"零個\0"
+"零余\0"
+"零餘\0"
+"零只\0"
+"零隻\0"
+"零周后\0"
+"零周後\0"
+"零天后\0"
+"零天後\0"
+"雾\0"
+"霧\0"
+"雾里\0"
+"霧裡\0"
+"霁\0"
+"霽\0"
+"霁范\0"
+"霽範\0"
+"震栗\0"
+"震慄\0"
+"霉毒\0"
+"黴毒\0"
+"霉气冲天\0"
+"霉氣衝天\0"
+"霉素\0"
+"黴素\0"
+"霉菌\0"
+"黴菌\0"
+"霉黑\0"
+"黴黑\0"
+"霉黧\0"
+"黴黧\0"
+"霭\0"
+"靄\0"
+"露丑\0"
+"露醜\0"
+"青山一发\0"
+"青山一髮\0"
+"青霉\0"
+"青黴\0"
+"靓\0"
+"靚\0"
+"静\0"
+"靜\0"
+"非常准\0"
+"非常準\0"
+"面人儿\0"
+"麵人兒\0"
+"面制品\0"
+"麵製品\0"
+"面包\0"
+"麵包\0"
+"面包办\0"
+"面包辦\0"
+"面包厢\0"
+"面包廂\0"
+"面包围\0"
+"面包圍\0"
+"面包扎\0"
+"面包紮\0"
+"面包揽\0"
+"面包攬\0"
+"面包着\0"
+"面包著\0"
+"面包罗\0"
+"面包羅\0"
+"面包装\0"
+"面包裝\0"
+"面厂\0"
+"麵廠\0"
+"面团\0"
+"麵團\0"
+"面坊\0"
+"麵坊\0"
+"面坯儿\0"
+"麵坯兒\0"
+"面塑\0"
+"麵塑\0"
+"面店\0"
+"麵店\0"
+"面店铺\0"
+"面店鋪\0"
+"面摊\0"
+"麵攤\0"
+"面杖\0"
+"麵杖\0"
+"面条\0"
+"麵條\0"
+"面条目\0"
+"面條目\0"
+"面汤\0"
+"麵湯\0"
+"面浆\0"
+"麵漿\0"
+"面点师\0"
+"麵點師\0"
+"面疙瘩\0"
+"麵疙瘩\0"
+"面皮\0"
+"麵皮\0"
+"面码儿\0"
+"麵碼兒\0"
+"面筋\0"
+"麵筋\0"
+"面粉\0"
+"麵粉\0"
+"面粉红\0"
+"面粉紅\0"
+"面糊\0"
+"麵糊\0"
+"面缸\0"
+"麵缸\0"
+"面茶\0"
+"麵茶\0"
+"面食\0"
+"麵食\0"
+"面食饭\0"
+"面食飯\0"
+"面饺\0"
+"麵餃\0"
+"面饼\0"
+"麵餅\0"
+"面馆\0"
+"麵館\0"
+"靥\0"
+"靨\0"
+"鞋里\0"
+"鞋裡\0"
+"鞑\0"
+"韃\0"
+"鞣制\0"
+"鞣製\0"
+"鞭辟入里\0"
+"鞭辟入裡\0"
+"鞯\0"
+"韉\0"
+"韦\0"
+"韋\0"
+"韦席\0"
+"韋蓆\0"
+"韧\0"
+"韌\0"
+"韩\0"
+"韓\0"
+"韩制\0"
+"韓製\0"
+"韩国制\0"
+"韓國製\0"
+"韪\0"
+"韙\0"
+"韫\0"
+"韞\0"
+"韬\0"
+"韜\0"
+"音不准\0"
+"音不準\0"
+"音准\0"
+"音準\0"
+"音声如钟\0"
+"音聲如鐘\0"
+"韵\0"
+"韻\0"
+"韶山冲\0"
+"韶山沖\0"
+"页\0"
+"頁\0"
+"页面\0"
+"頁面\0"
+"顶\0"
+"頂\0"
+"顶凶\0"
+"頂兇\0"
+"顶多\0"
+"頂多\0"
+"顷\0"
+"頃\0"
+"顸\0"
+"頇\0"
+"项\0"
+"項\0"
+"项链\0"
+"項鍊\0"
+"顺\0"
+"順\0"
+"顺钟向\0"
+"順鐘向\0"
+"顺风后\0"
+"順風後\0"
+"须\0"
+"須\0"
+"须发\0"
+"鬚髮\0"
+"须根\0"
+"鬚根\0"
+"须根据\0"
+"須根據\0"
+"须毛\0"
+"鬚毛\0"
+"须生\0"
+"鬚生\0"
+"须眉\0"
+"鬚眉\0"
+"须胡\0"
+"鬚鬍\0"
+"须须\0"
+"鬚鬚\0"
+"须鲨\0"
+"鬚鯊\0"
+"须鲸\0"
+"鬚鯨\0"
+"顼\0"
+"頊\0"
+"顽\0"
+"頑\0"
+"顾\0"
+"顧\0"
+"顿\0"
+"頓\0"
+"颀\0"
+"頎\0"
+"颁\0"
+"頒\0"
+"颂\0"
+"頌\0"
+"颂系\0"
+"頌繫\0"
+"颂赞\0"
+"頌讚\0"
+"颃\0"
+"頏\0"
+"预\0"
+"預\0"
+"预制\0"
+"預製\0"
+"预报不准\0"
+"預報不準\0"
+"颅\0"
+"顱\0"
+"领\0"
+"領\0"
+"领袖欲\0"
+"領袖慾\0"
+"颇\0"
+"頗\0"
+"颈\0"
+"頸\0"
+"颉\0"
+"頡\0"
+"颊\0"
+"頰\0"
+"颊须\0"
+"頰鬚\0"
+"颌\0"
+"頜\0"
+"颍\0"
+"潁\0"
+"颏\0"
+"頦\0"
+"颐\0"
+"頤\0"
+"频\0"
+"頻\0"
+"颓\0"
+"頹\0"
+"颔\0"
+"頷\0"
+"颖\0"
+"穎\0"
+"颗\0"
+"顆\0"
+"题\0"
+"題\0"
+"颚\0"
+"顎\0"
+"颛\0"
+"顓\0"
+"颛顼历\0"
+"顓頊曆\0"
+"颜\0"
+"顏\0"
+"颜范\0"
+"顏範\0"
+"额\0"
+"額\0"
+"额征\0"
+"額徵\0"
+"额我略历\0"
+"額我略曆\0"
+"额我略历史\0"
+"額我略歷史\0"
+"颞\0"
+"顳\0"
+"颟\0"
+"顢\0"
+"颠\0"
+"顛\0"
+"颠干倒坤\0"
+"顛乾倒坤\0"
+"颠颠仆仆\0"
+"顛顛仆仆\0"
+"颡\0"
+"顙\0"
+"颢\0"
+"顥\0"
+"颤\0"
+"顫\0"
+"颤栗\0"
+"顫慄\0"
+"颦\0"
+"顰\0"
+"颧\0"
+"顴\0"
+"风\0"
+"風\0"
+"风刮\0"
+"風颳\0"
+"风卷残云\0"
+"風捲殘雲\0"
+"风后\0"
+"風后\0"
+"风土志\0"
+"風土誌\0"
+"风干\0"
+"風乾\0"
+"风物志\0"
+"風物誌\0"
+"风范\0"
+"風範\0"
+"风起云涌\0"
+"風起雲湧\0"
+"风采\0"
+"風采\0"
+"风里\0"
+"風裡\0"
+"飑\0"
+"颮\0"
+"飒\0"
+"颯\0"
+"飓\0"
+"颶\0"
+"飕\0"
+"颼\0"
+"飘\0"
+"飄\0"
+"飘发自由女神\0"
+"飄髮自由女神\0"
+"飘游\0"
+"飄遊\0"
+"飘荡\0"
+"飄蕩\0"
+"飘飘荡荡\0"
+"飄飄蕩蕩\0"
+"飙\0"
+"飆\0"
+"飞\0"
+"飛\0"
+"飞刍挽粟\0"
+"飛芻輓粟\0"
+"飞扎\0"
+"飛紮\0"
+"飞行钟\0"
+"飛行鐘\0"
+"食欲\0"
+"食慾\0"
+"食面\0"
+"食麵\0"
+"飨\0"
+"饗\0"
+"餍\0"
+"饜\0"
+"餐台\0"
+"餐檯\0"
+"饥\0"
+"飢\0"
+"饥寒\0"
+"饑寒\0"
+"饥民\0"
+"饑民\0"
+"饥渴\0"
+"饑渴\0"
+"饥溺\0"
+"饑溺\0"
+"饥荒\0"
+"饑荒\0"
+"饥饱\0"
+"饑飽\0"
+"饥馑\0"
+"饑饉\0"
+"饧\0"
+"餳\0"
+"饨\0"
+"飩\0"
+"饩\0"
+"餼\0"
+"饪\0"
+"飪\0"
+"饫\0"
+"飫\0"
+"饬\0"
+"飭\0"
+"饭\0"
+"飯\0"
+"饭后钟\0"
+"飯後鐘\0"
+"饭团\0"
+"飯糰\0"
+"饮\0"
+"飲\0"
+"饯\0"
+"餞\0"
+"饰\0"
+"飾\0"
+"饱\0"
+"飽\0"
+"饲\0"
+"飼\0"
+"饴\0"
+"飴\0"
+"饵\0"
+"餌\0"
+"饶\0"
+"饒\0"
+"饷\0"
+"餉\0"
+"饺\0"
+"餃\0"
+"饼\0"
+"餅\0"
+"饼干\0"
+"餅乾\0"
+"饽\0"
+"餑\0"
+"饿\0"
+"餓\0"
+"馀\0"
+"餘\0"
+"馁\0"
+"餒\0"
+"馄\0"
+"餛\0"
+"馄饨面\0"
+"餛飩麵\0"
+"馅\0"
+"餡\0"
+"馆\0"
+"館\0"
+"馆谷\0"
+"館穀\0"
+"馆里\0"
+"館裡\0"
+"馈\0"
+"饋\0"
+"馊\0"
+"餿\0"
+"馋\0"
+"饞\0"
+"馍\0"
+"饃\0"
+"馏\0"
+"餾\0"
+"馐\0"
+"饈\0"
+"馑\0"
+"饉\0"
+"馒\0"
+"饅\0"
+"馔\0"
+"饌\0"
+"首出电影\0"
+"首齣電影\0"
+"首发\0"
+"首發\0"
+"首只\0"
+"首隻\0"
+"首当其冲\0"
+"首當其衝\0"
+"香干\0"
+"香乾\0"
+"马\0"
+"馬\0"
+"马干\0"
+"馬乾\0"
+"马德钟\0"
+"馬德鐘\0"
+"马斯垂克期\0"
+"馬斯垂克期\0"
+"马格里布\0"
+"馬格里布\0"
+"驭\0"
+"馭\0"
+"驮\0"
+"馱\0"
+"驯\0"
+"馴\0"
+"驰\0"
+"馳\0"
+"驱\0"
+"驅\0"
+"驳\0"
+"駁\0"
+"驴\0"
+"驢\0"
+"驵\0"
+"駔\0"
+"驶\0"
+"駛\0"
+"驷\0"
+"駟\0"
+"驸\0"
+"駙\0"
+"驹\0"
+"駒\0"
+"驺\0"
+"騶\0"
+"驻\0"
+"駐\0"
+"驻扎\0"
+"駐紮\0"
+"驼\0"
+"駝\0"
+"驽\0"
+"駑\0"
+"驾\0"
+"駕\0"
+"驿\0"
+"驛\0"
+"骀\0"
+"駘\0"
+"骀荡\0"
+"駘蕩\0"
+"骁\0"
+"驍\0"
+"骂\0"
+"罵\0"
+"骄\0"
+"驕\0"
+"骅\0"
+"驊\0"
+"骆\0"
+"駱\0"
+"骇\0"
+"駭\0"
+"骈\0"
+"駢\0"
+"骊\0"
+"驪\0"
+"骋\0"
+"騁\0"
+"验\0"
+"驗\0"
+"骏\0"
+"駿\0"
+"骐\0"
+"騏\0"
+"骑\0"
+"騎\0"
+"骒\0"
+"騍\0"
+"骓\0"
+"騅\0"
+"骖\0"
+"驂\0"
+"骗\0"
+"騙\0"
+"骘\0"
+"騭\0"
+"骚\0"
+"騷\0"
+"骛\0"
+"騖\0"
+"骜\0"
+"驁\0"
+"骝\0"
+"騮\0"
+"骞\0"
+"騫\0"
+"骟\0"
+"騸\0"
+"骠\0"
+"驃\0"
+"骡\0"
+"騾\0"
+"骢\0"
+"驄\0"
+"骣\0"
+"驏\0"
+"骤\0"
+"驟\0"
+"骥\0"
+"驥\0"
+"骧\0"
+"驤\0"
+"骨坛\0"
+"骨罈\0"
+"骨干\0"
+"骨幹\0"
+"骨灰坛\0"
+"骨灰罈\0"
+"髅\0"
+"髏\0"
+"髋\0"
+"髖\0"
+"髌\0"
+"髕\0"
+"高干\0"
+"高幹\0"
+"高干扰\0"
+"高干擾\0"
+"高干预\0"
+"高干預\0"
+"髡发\0"
+"髡髮\0"
+"髭胡\0"
+"髭鬍\0"
+"髭须\0"
+"髭鬚\0"
+"髯胡\0"
+"髯鬍\0"
+"髼松\0"
+"髼鬆\0"
+"鬅松\0"
+"鬅鬆\0"
+"鬈发\0"
+"鬈髮\0"
+"鬒发\0"
+"鬒髮\0"
+"鬓\0"
+"鬢\0"
+"鬓发\0"
+"鬢髮\0"
+"鬼气冲天\0"
+"鬼氣衝天\0"
+"魂牵梦系\0"
+"魂牽夢繫\0"
+"魇\0"
+"魘\0"
+"魉\0"
+"魎\0"
+"魏征\0"
+"魏徵\0"
+"魔表\0"
+"魔錶\0"
+"鱼\0"
+"魚\0"
+"鱼干\0"
+"魚乾\0"
+"鱼松\0"
+"魚鬆\0"
+"鱿\0"
+"魷\0"
+"鲁\0"
+"魯\0"
+"鲂\0"
+"魴\0"
+"鲆\0"
+"鮃\0"
+"鲇\0"
+"鯰\0"
+"鲈\0"
+"鱸\0"
+"鲋\0"
+"鮒\0"
+"鲍\0"
+"鮑\0"
+"鲎\0"
+"鱟\0"
+"鲐\0"
+"鮐\0"
+"鲑\0"
+"鮭\0"
+"鲒\0"
+"鮚\0"
+"鲔\0"
+"鮪\0"
+"鲕\0"
+"鮞\0"
+"鲚\0"
+"鱭\0"
+"鲛\0"
+"鮫\0"
+"鲜\0"
+"鮮\0"
+"鲜于\0"
+"鮮于\0"
+"鲞\0"
+"鯗\0"
+"鲟\0"
+"鱘\0"
+"鲠\0"
+"鯁\0"
+"鲡\0"
+"鱺\0"
+"鲢\0"
+"鰱\0"
+"鲣\0"
+"鰹\0"
+"鲤\0"
+"鯉\0"
+"鲥\0"
+"鰣\0"
+"鲦\0"
+"鰷\0"
+"鲧\0"
+"鯀\0"
+"鲨\0"
+"鯊\0"
+"鲩\0"
+"鯇\0"
+"鲫\0"
+"鯽\0"
+"鲭\0"
+"鯖\0"
+"鲮\0"
+"鯪\0"
+"鲰\0"
+"鯫\0"
+"鲱\0"
+"鯡\0"
+"鲲\0"
+"鯤\0"
+"鲳\0"
+"鯧\0"
+"鲵\0"
+"鯢\0"
+"鲷\0"
+"鯛\0"
+"鲸\0"
+"鯨\0"
+"鲸须\0"
+"鯨鬚\0"
+"鲻\0"
+"鯔\0"
+"鲽\0"
+"鰈\0"
+"鳃\0"
+"鰓\0"
+"鳄\0"
+"鱷\0"
+"鳅\0"
+"鰍\0"
+"鳆\0"
+"鰒\0"
+"鳇\0"
+"鰉\0"
+"鳌\0"
+"鰲\0"
+"鳍\0"
+"鰭\0"
+"鳎\0"
+"鰨\0"
+"鳏\0"
+"鰥\0"
+"鳐\0"
+"鰩\0"
+"鳓\0"
+"鰳\0"
+"鳔\0"
+"鰾\0"
+"鳕\0"
+"鱈\0"
+"鳖\0"
+"鱉\0"
+"鳗\0"
+"鰻\0"
+"鳜\0"
+"鱖\0"
+"鳝\0"
+"鱔\0"
+"鳞\0"
+"鱗\0"
+"鳟\0"
+"鱒\0"
+"鳢\0"
+"鱧\0"
+"鸟\0"
+"鳥\0"
+"鸟栖市\0"
+"鳥栖市\0"
+"鸠\0"
+"鳩\0"
+"鸡\0"
+"雞\0"
+"鸡丝\0"
+"雞絲\0"
+"鸡丝面\0"
+"雞絲麵\0"
+"鸡争鹅斗\0"
+"雞爭鵝鬥\0"
+"鸡只\0"
+"雞隻\0"
+"鸡吵鹅斗\0"
+"雞吵鵝鬥\0"
+"鸡奸\0"
+"雞姦\0"
+"鸡腿面\0"
+"雞腿麵\0"
+"鸡蛋里挑骨头\0"
+"雞蛋裡挑骨頭\0"
+"鸢\0"
+"鳶\0"
+"鸣\0"
+"鳴\0"
+"鸣钟\0"
+"鳴鐘\0"
+"鸥\0"
+"鷗\0"
+"鸦\0"
+"鴉\0"
+"鸨\0"
+"鴇\0"
+"鸩\0"
+"鴆\0"
+"鸪\0"
+"鴣\0"
+"鸫\0"
+"鶇\0"
+"鸬\0"
+"鸕\0"
+"鸭\0"
+"鴨\0"
+"鸯\0"
+"鴦\0"
+"鸱\0"
+"鴟\0"
+"鸲\0"
+"鴝\0"
+"鸳\0"
+"鴛\0"
+"鸵\0"
+"鴕\0"
+"鸶\0"
+"鷥\0"
+"鸷\0"
+"鷙\0"
+"鸸\0"
+"鴯\0"
+"鸹\0"
+"鴰\0"
+"鸺\0"
+"鵂\0"
+"鸽\0"
+"鴿\0"
+"鸾\0"
+"鸞\0"
+"鸾鉴\0"
+"鸞鑑\0"
+"鸿\0"
+"鴻\0"
+"鸿范\0"
+"鴻範\0"
+"鹁\0"
+"鵓\0"
+"鹂\0"
+"鸝\0"
+"鹃\0"
+"鵑\0"
+"鹄\0"
+"鵠\0"
+"鹄发\0"
+"鵠髮\0"
+"鹅\0"
+"鵝\0"
+"鹅准\0"
+"鵝準\0"
+"鹆\0"
+"鵒\0"
+"鹇\0"
+"鷳\0"
+"鹈\0"
+"鵜\0"
+"鹉\0"
+"鵡\0"
+"鹊\0"
+"鵲\0"
+"鹌\0"
+"鵪\0"
+"鹎\0"
+"鵯\0"
+"鹏\0"
+"鵬\0"
+"鹑\0"
+"鶉\0"
+"鹕\0"
+"鶘\0"
+"鹗\0"
+"鶚\0"
+"鹘\0"
+"鶻\0"
+"鹚\0"
+"鶿\0"
+"鹜\0"
+"鶩\0"
+"鹞\0"
+"鷂\0"
+"鹣\0"
+"鶼\0"
+"鹤\0"
+"鶴\0"
+"鹤发\0"
+"鶴髮\0"
+"鹤吊\0"
+"鶴弔\0"
+"鹤峰县\0"
+"鶴峯縣\0"
+"鹦\0"
+"鸚\0"
+"鹧\0"
+"鷓\0"
+"鹨\0"
+"鷚\0"
+"鹩\0"
+"鷯\0"
+"鹪\0"
+"鷦\0"
+"鹫\0"
+"鷲\0"
+"鹬\0"
+"鷸\0"
+"鹭\0"
+"鷺\0"
+"鹰\0"
+"鷹\0"
+"鹰雕\0"
+"鹰鵰\0"
+"鹳\0"
+"鸛\0"
+"鹾\0"
+"鹺\0"
+"麟游\0"
+"麟遊\0"
+"麦\0"
+"麥\0"
+"麸\0"
+"麩\0"
+"麹\0"
+"麴\0"
+"麹霉\0"
+"麴黴\0"
+"麻将席\0"
+"麻將蓆\0"
+"麻酱面\0"
+"麻醬麵\0"
+"黄\0"
+"黃\0"
+"黄历\0"
+"黃曆\0"
+"黄历史\0"
+"黃歷史\0"
+"黄发\0"
+"黃髮\0"
+"黄岩区\0"
+"黃巖區\0"
+"黄岩县\0"
+"黃巖縣\0"
+"黄干黑瘦\0"
+"黃乾黑瘦\0"
+"黄曲毒素\0"
+"黃麴毒素\0"
+"黄杰\0"
+"黃杰\0"
+"黄白术\0"
+"黃白術\0"
+"黄诗杰\0"
+"黃詩杰\0"
+"黄金表\0"
+"黃金表\0"
+"黄钟\0"
+"黃鐘\0"
+"黄钰筑\0"
+"黃鈺筑\0"
+"黉\0"
+"黌\0"
+"黎吉云\0"
+"黎吉雲\0"
+"黑发\0"
+"黑髮\0"
+"黑奴吁天录\0"
+"黑奴籲天錄\0"
+"黑干将\0"
+"黑幹將\0"
+"黑长发\0"
+"黑長髮\0"
+"黩\0"
+"黷\0"
+"黪\0"
+"黲\0"
+"黾\0"
+"黽\0"
+"鼋\0"
+"黿\0"
+"鼍\0"
+"鼉\0"
+"鼓噪\0"
+"鼓譟\0"
+"鼓里\0"
+"鼓裡\0"
+"鼗\0"
+"鞀\0"
+"鼠曲草\0"
+"鼠麴草\0"
+"鼹\0"
+"鼴\0"
+"鼻准\0"
+"鼻準\0"
+"鼻梁\0"
+"鼻樑\0"
+"鼻梁儿\0"
+"鼻梁兒\0"
+"齐\0"
+"齊\0"
+"齐王舍牛\0"
+"齊王捨牛\0"
+"齑\0"
+"齏\0"
+"齿\0"
+"齒\0"
+"齿危发秀\0"
+"齒危髮秀\0"
+"齿发\0"
+"齒髮\0"
+"齿落发白\0"
+"齒落髮白\0"
+"龀\0"
+"齔\0"
+"龃\0"
+"齟\0"
+"龄\0"
+"齡\0"
+"龅\0"
+"齙\0"
+"龆\0"
+"齠\0"
+"龇\0"
+"齜\0"
+"龈\0"
+"齦\0"
+"龉\0"
+"齬\0"
+"龊\0"
+"齪\0"
+"龋\0"
+"齲\0"
+"龌\0"
+"齷\0"
+"龙\0"
+"龍\0"
+"龙卷\0"
+"龍捲\0"
+"龙岩\0"
+"龍巖\0"
+"龙斗虎伤\0"
+"龍鬥虎傷\0"
+"龙眼干\0"
+"龍眼乾\0"
+"龙须\0"
+"龍鬚\0"
+"龙须面\0"
+"龍鬚麵\0"
+"龚\0"
+"龔\0"
+"龛\0"
+"龕\0"
+"龟\0"
+"龜\0"
+"龟鉴\0"
+"龜鑑\0"
+;
+
+/* offsets of the simp and trad phrases in simp_to_trad_strings,
+   sorted by the simp phrase. */
+static const guint32 simp_to_trad[][2] = {
+    { 0, 7 },
+    { 14, 21 },
+    { 28, 38 },
+    { 48, 55 },
+    { 62, 72 },
+    { 82, 95 },
+    { 108, 115 },
+    { 122, 132 },
+    { 142, 149 },
+    { 156, 163 },
+    { 170, 177 },
+    { 184, 194 },
+    { 204, 217 },
+    { 230, 243 },
+    { 256, 266 },
+    { 276, 289 },
+    { 302, 312 },
+    { 322, 335 },
+    { 348, 361 },
+    { 374, 387 },
+    { 400, 407 },
+    { 414, 424 },
+    { 434, 444 },
+    { 454, 467 },
+    { 480, 490 },
+    { 500, 510 },
+    { 520, 530 },
+    { 540, 553 },
+    { 566, 573 },
+    { 580, 587 },
+    { 594, 607 },
+    { 620, 636 },
+    { 652, 662 },
+    { 672, 682 },
+    { 692, 705 },
+    { 718, 725 },
+    { 732, 739 },
+    { 746, 753 },
+    { 760, 770 },
+    { 780, 790 },
+    { 800, 813 },
+    { 826, 833 },
+    { 840, 844 },
+    { 848, 858 },
+    { 868, 875 },
+    { 882, 889 },
+    { 896, 903 },
+    { 910, 920 },
+    { 930, 937 },
+    { 944, 954 },
+    { 964, 974 },
+    { 984, 997 },
+    { 1010, 1017 },
+    { 1024, 1037 },
+    { 1050, 1057 },
+    { 1064, 1071 },
+    { 1078, 1085 },
+    { 1092, 1099 },
+    { 1106, 1116 },
+    { 1126, 1133 },
+    { 1140, 1150 },
+    { 1160, 1170 },
+    { 1180, 1193 },
+    { 1206, 1213 },
+    { 1220, 1230 },
+    { 1240, 1253 },
+    { 1266, 1276 },
+    { 1286, 1293 },
+    { 1300, 1307 },
+    { 1314, 1324 },
+    { 1334, 1344 },
+    { 1354, 1364 },
+    { 1374, 1384 },
+    { 1394, 1404 },
+    { 1414, 1424 },
+    { 1434, 1444 },
+    { 1454, 1464 },
+    { 1474, 1484 },
+    { 1494, 1504 },
+    { 1514, 1524 },
+    { 1534, 1544 },
+    { 1554, 1564 },
+    { 1574, 1584 },
+    { 1594, 1601 },
+    { 1608, 1615 },
+    { 1622, 1632 },
+    { 1642, 1652 },
+    { 1662, 1672 },
+    { 1682, 1692 },
+    { 1702, 1712 },
+    { 1722, 1732 },
+    { 1742, 1752 },
+    { 1762, 1772 },
+    { 1782, 1792 },
+    { 1802, 1812 },
+    { 1822, 1832 },
+    { 1842, 1852 },
+    { 1862, 1869 },
+    { 1876, 1883 },
+    { 1890, 1900 },
+    { 1910, 1923 },
+    { 1936, 1949 },
+    { 1962, 1975 },
+    { 1988, 2001 },
+    { 2014, 2024 },
+    { 2034, 2041 },
+    { 2048, 2055 },
+    { 2062, 2072 },
+    { 2082, 2092 },
+    { 2102, 2109 },
+    { 2116, 2129 },
+    { 2142, 2155 },
+    { 2168, 2175 },
+    { 2182, 2192 },
+    { 2202, 2212 },
+    { 2222, 2235 },
+    { 2248, 2252 },
+    { 2256, 2263 },
+    { 2270, 2280 },
+    { 2290, 2297 },
+    { 2304, 2311 },
+    { 2318, 2325 },
+    { 2332, 2342 },
+    { 2352, 2362 },
+    { 2372, 2379 },
+    { 2386, 2393 },
+    { 2400, 2407 },
+    { 2414, 2421 },
+    { 2428, 2435 },
+    { 2442, 2449 },
+    { 2456, 2463 },
+    { 2470, 2483 },
+    { 2496, 2509 },
+    { 2522, 2529 },
+    { 2536, 2543 },
+    { 2550, 2563 },
+    { 2576, 2586 },
+    { 2596, 2603 },
+    { 2610, 2617 },
+    { 2624, 2634 },
+    { 2644, 2654 },
+    { 2664, 2674 },
+    { 2684, 2691 },
+    { 2698, 2705 },
+    { 2712, 2719 },
+    { 2726, 2733 },
+    { 2740, 2747 },
+    { 2754, 2761 },
+    { 2768, 2775 },
+    { 2782, 2789 },
+    { 2796, 2803 },
+    { 2810, 2820 },
+    { 2830, 2837 },
+    { 2844, 2851 },
+    { 2858, 2865 },
+    { 2872, 2879 },
+    { 2886, 2893 },
+    { 2900, 2907 },
+    { 2914, 2921 },
+    { 2928, 2935 },
+    { 2942, 2949 },
+    { 2956, 2963 },
+    { 2970, 2980 },
+    { 2990, 2997 },
+    { 3004, 3011 },
+    { 3018, 3025 },
+    { 3032, 3039 },
+    { 3046, 3053 },
+    { 3060, 3064 },
+    { 3068, 3078 },
+    { 3088, 3098 },
+    { 3108, 3118 },
+    { 3128, 3138 },
+    { 3148, 3161 },
+    { 3174, 3178 },
+    { 3182, 3189 },
+    { 3196, 3200 },
+    { 3204, 3214 },
+    { 3224, 3228 },
+    { 3232, 3245 },
+    { 3258, 3268 },
+    { 3278, 3285 },
+    { 3292, 3299 },
+    { 3306, 3310 },
+    { 3314, 3321 },
+    { 3328, 3335 },
+    { 3342, 3355 },
+    { 3368, 3372 },
+    { 3376, 3383 },
+    { 3390, 3394 },
+    { 3398, 3405 },
+    { 3412, 3419 },
+    { 3426, 3433 },
+    { 3440, 3447 },
+    { 3454, 3464 },
+    { 3474, 3484 },
+    { 3494, 3501 },
+    { 3508, 3515 },
+    { 3522, 3535 },
+    { 3548, 3561 },
+    { 3574, 3578 },
+    { 3582, 3592 },
+    { 3602, 3606 },
+    { 3610, 3617 },
+    { 3624, 3628 },
+    { 3632, 3645 },
+    { 3658, 3668 },
+    { 3678, 3691 },
+    { 3704, 3717 },
+    { 3730, 3743 },
+    { 3756, 3769 },
+    { 3782, 3795 },
+    { 3808, 3821 },
+    { 3834, 3847 },
+    { 3860, 3873 },
+    { 3886, 3896 },
+    { 3906, 3916 },
+    { 3926, 3933 },
+    { 3940, 3947 },
+    { 3954, 3964 },
+    { 3974, 3984 },
+    { 3994, 4007 },
+    { 4020, 4036 },
+    { 4052, 4065 },
+    { 4078, 4085 },
+    { 4092, 4102 },
+    { 4112, 4122 },
+    { 4132, 4139 },
+    { 4146, 4156 },
+    { 4166, 4176 },
+    { 4186, 4196 },
+    { 4206, 4216 },
+    { 4226, 4236 },
+    { 4246, 4256 },
+    { 4266, 4276 },
+    { 4286, 4296 },
+    { 4306, 4316 },
+    { 4326, 4336 },
+    { 4346, 4356 },
+    { 4366, 4376 },
+    { 4386, 4390 },
+    { 4394, 4401 },
+    { 4408, 4415 },
+    { 4422, 4429 },
+    { 4436, 4443 },
+    { 4450, 4463 },
+    { 4476, 4483 },
+    { 4490, 4500 },
+    { 4510, 4517 },
+    { 4524, 4528 },
+    { 4532, 4545 },
+    { 4558, 4565 },
+    { 4572, 4576 },
+    { 4580, 4587 },
+    { 4594, 4601 },
+    { 4608, 4615 },
+    { 4622, 4629 },
+    { 4636, 4646 },
+    { 4656, 4669 },
+    { 4682, 4686 },
+    { 4690, 4694 },
+    { 4698, 4708 },
+    { 4718, 4725 },
+    { 4732, 4736 },
+    { 4740, 4744 },
+    { 4748, 4755 },
+    { 4762, 4769 },
+    { 4776, 4783 },
+    { 4790, 4797 },
+    { 4804, 4811 },
+    { 4818, 4825 },
+    { 4832, 4836 },
+    { 4840, 4856 },
+    { 4872, 4879 },
+    { 4886, 4896 },
+    { 4906, 4916 },
+    { 4926, 4930 },
+    { 4934, 4944 },
+    { 4954, 4964 },
+    { 4974, 4978 },
+    { 4982, 4989 },
+    { 4996, 5009 },
+    { 5022, 5029 },
+    { 5036, 5043 },
+    { 5050, 5057 },
+    { 5064, 5074 },
+    { 5084, 5094 },
+    { 5104, 5111 },
+    { 5118, 5125 },
+    { 5132, 5136 },
+    { 5140, 5144 },
+    { 5148, 5155 },
+    { 5162, 5166 },
+    { 5170, 5177 },
+    { 5184, 5191 },
+    { 5198, 5202 },
+    { 5206, 5213 },
+    { 5220, 5230 },
+    { 5240, 5244 },
+    { 5248, 5255 },
+    { 5262, 5272 },
+    { 5282, 5295 },
+    { 5308, 5318 },
+    { 5328, 5335 },
+    { 5342, 5352 },
+    { 5362, 5369 },
+    { 5376, 5383 },
+    { 5390, 5400 },
+    { 5410, 5423 },
+    { 5436, 5440 },
+    { 5444, 5457 },
+    { 5470, 5483 },
+    { 5496, 5509 },
+    { 5522, 5535 },
+    { 5548, 5561 },
+    { 5574, 5581 },
+    { 5588, 5601 },
+    { 5614, 5627 },
+    { 5640, 5647 },
+    { 5654, 5667 },
+    { 5680, 5687 },
+    { 5694, 5701 },
+    { 5708, 5715 },
+    { 5722, 5732 },
+    { 5742, 5752 },
+    { 5762, 5775 },
+    { 5788, 5801 },
+    { 5814, 5824 },
+    { 5834, 5838 },
+    { 5842, 5852 },
+    { 5862, 5872 },
+    { 5882, 5892 },
+    { 5902, 5912 },
+    { 5922, 5935 },
+    { 5948, 5958 },
+    { 5968, 5978 },
+    { 5988, 5998 },
+    { 6008, 6018 },
+    { 6028, 6038 },
+    { 6048, 6058 },
+    { 6068, 6078 },
+    { 6088, 6098 },
+    { 6108, 6118 },
+    { 6128, 6138 },
+    { 6148, 6155 },
+    { 6162, 6172 },
+    { 6182, 6192 },
+    { 6202, 6218 },
+    { 6234, 6244 },
+    { 6254, 6264 },
+    { 6274, 6284 },
+    { 6294, 6304 },
+    { 6314, 6324 },
+    { 6334, 6347 },
+    { 6360, 6370 },
+    { 6380, 6390 },
+    { 6400, 6410 },
+    { 6420, 6427 },
+    { 6434, 6444 },
+    { 6454, 6464 },
+    { 6474, 6484 },
+    { 6494, 6501 },
+    { 6508, 6518 },
+    { 6528, 6541 },
+    { 6554, 6564 },
+    { 6574, 6587 },
+    { 6600, 6610 },
+    { 6620, 6630 },
+    { 6640, 6647 },
+    { 6654, 6664 },
+    { 6674, 6684 },
+    { 6694, 6704 },
+    { 6714, 6724 },
+    { 6734, 6744 },
+    { 6754, 6764 },
+    { 6774, 6784 },
+    { 6794, 6804 },
+    { 6814, 6821 },
+    { 6828, 6838 },
+    { 6848, 6858 },
+    { 6868, 6878 },
+    { 6888, 6895 },
+    { 6902, 6909 },
+    { 6916, 6926 },
+    { 6936, 6943 },
+    { 6950, 6960 },
+    { 6970, 6980 },
+    { 6990, 6997 },
+    { 7004, 7014 },
+    { 7024, 7034 },
+    { 7044, 7054 },
+    { 7064, 7074 },
+    { 7084, 7094 },
+    { 7104, 7120 },
+    { 7136, 7146 },
+    { 7156, 7163 },
+    { 7170, 7180 },
+    { 7190, 7194 },
+    { 7198, 7202 },
+    { 7206, 7213 },
+    { 7220, 7233 },
+    { 7246, 7253 },
+    { 7260, 7270 },
+    { 7280, 7287 },
+    { 7294, 7301 },
+    { 7308, 7321 },
+    { 7334, 7347 },
+    { 7360, 7367 },
+    { 7374, 7381 },
+    { 7388, 7395 },
+    { 7402, 7409 },
+    { 7416, 7426 },
+    { 7436, 7446 },
+    { 7456, 7463 },
+    { 7470, 7480 },
+    { 7490, 7497 },
+    { 7504, 7511 },
+    { 7518, 7531 },
+    { 7544, 7551 },
+    { 7558, 7565 },
+    { 7572, 7579 },
+    { 7586, 7590 },
+    { 7594, 7601 },
+    { 7608, 7615 },
+    { 7622, 7629 },
+    { 7636, 7640 },
+    { 7644, 7648 },
+    { 7652, 7659 },
+    { 7666, 7673 },
+    { 7680, 7687 },
+    { 7694, 7698 },
+    { 7702, 7706 },
+    { 7710, 7720 },
+    { 7730, 7740 },
+    { 7750, 7760 },
+    { 7770, 7780 },
+    { 7790, 7797 },
+    { 7804, 7814 },
+    { 7824, 7828 },
+    { 7832, 7839 },
+    { 7846, 7853 },
+    { 7860, 7867 },
+    { 7874, 7884 },
+    { 7894, 7904 },
+    { 7914, 7924 },
+    { 7934, 7941 },
+    { 7948, 7952 },
+    { 7956, 7963 },
+    { 7970, 7977 },
+    { 7984, 7991 },
+    { 7998, 8005 },
+    { 8012, 8019 },
+    { 8026, 8033 },
+    { 8040, 8047 },
+    { 8054, 8067 },
+    { 8080, 8087 },
+    { 8094, 8101 },
+    { 8108, 8115 },
+    { 8122, 8129 },
+    { 8136, 8143 },
+    { 8150, 8157 },
+    { 8164, 8171 },
+    { 8178, 8185 },
+    { 8192, 8199 },
+    { 8206, 8213 },
+    { 8220, 8233 },
+    { 8246, 8253 },
+    { 8260, 8267 },
+    { 8274, 8278 },
+    { 8282, 8289 },
+    { 8296, 8306 },
+    { 8316, 8326 },
+    { 8336, 8349 },
+    { 8362, 8375 },
+    { 8388, 8392 },
+    { 8396, 8400 },
+    { 8404, 8414 },
+    { 8424, 8431 },
+    { 8438, 8445 },
+    { 8452, 8462 },
+    { 8472, 8485 },
+    { 8498, 8508 },
+    { 8518, 8522 },
+    { 8526, 8533 },
+    { 8540, 8544 },
+    { 8548, 8558 },
+    { 8568, 8575 },
+    { 8582, 8586 },
+    { 8590, 8600 },
+    { 8610, 8623 },
+    { 8636, 8643 },
+    { 8650, 8660 },
+    { 8670, 8686 },
+    { 8702, 8712 },
+    { 8722, 8735 },
+    { 8748, 8764 },
+    { 8780, 8796 },
+    { 8812, 8831 },
+    { 8850, 8863 },
+    { 8876, 8886 },
+    { 8896, 8903 },
+    { 8910, 8923 },
+    { 8936, 8943 },
+    { 8950, 8954 },
+    { 8958, 8962 },
+    { 8966, 8973 },
+    { 8980, 8987 },
+    { 8994, 9001 },
+    { 9008, 9015 },
+    { 9022, 9029 },
+    { 9036, 9043 },
+    { 9050, 9057 },
+    { 9064, 9068 },
+    { 9072, 9079 },
+    { 9086, 9093 },
+    { 9100, 9110 },
+    { 9120, 9127 },
+    { 9134, 9138 },
+    { 9142, 9146 },
+    { 9150, 9154 },
+    { 9158, 9162 },
+    { 9166, 9185 },
+    { 9204, 9208 },
+    { 9212, 9216 },
+    { 9220, 9224 },
+    { 9228, 9232 },
+    { 9236, 9240 },
+    { 9244, 9248 },
+    { 9252, 9259 },
+    { 9266, 9273 },
+    { 9280, 9287 },
+    { 9294, 9298 },
+    { 9302, 9309 },
+    { 9316, 9323 },
+    { 9330, 9337 },
+    { 9344, 9351 },
+    { 9358, 9365 },
+    { 9372, 9379 },
+    { 9386, 9393 },
+    { 9400, 9407 },
+    { 9414, 9424 },
+    { 9434, 9441 },
+    { 9448, 9455 },
+    { 9462, 9469 },
+    { 9476, 9483 },
+    { 9490, 9497 },
+    { 9504, 9511 },
+    { 9518, 9525 },
+    { 9532, 9539 },
+    { 9546, 9553 },
+    { 9560, 9567 },
+    { 9574, 9581 },
+    { 9588, 9595 },
+    { 9602, 9609 },
+    { 9616, 9623 },
+    { 9630, 9637 },
+    { 9644, 9651 },
+    { 9658, 9665 },
+    { 9672, 9679 },
+    { 9686, 9693 },
+    { 9700, 9707 },
+    { 9714, 9721 },
+    { 9728, 9738 },
+    { 9748, 9755 },
+    { 9762, 9769 },
+    { 9776, 9783 },
+    { 9790, 9797 },
+    { 9804, 9811 },
+    { 9818, 9825 },
+    { 9832, 9839 },
+    { 9846, 9853 },
+    { 9860, 9867 },
+    { 9874, 9881 },
+    { 9888, 9895 },
+    { 9902, 9909 },
+    { 9916, 9923 },
+    { 9930, 9937 },
+    { 9944, 9951 },
+    { 9958, 9965 },
+    { 9972, 9979 },
+    { 9986, 9993 },
+    { 10000, 10007 },
+    { 10014, 10021 },
+    { 10028, 10035 },
+    { 10042, 10049 },
+    { 10056, 10063 },
+    { 10070, 10077 },
+    { 10084, 10091 },
+    { 10098, 10105 },
+    { 10112, 10119 },
+    { 10126, 10133 },
+    { 10140, 10147 },
+    { 10154, 10161 },
+    { 10168, 10175 },
+    { 10182, 10189 },
+    { 10196, 10203 },
+    { 10210, 10217 },
+    { 10224, 10231 },
+    { 10238, 10245 },
+    { 10252, 10259 },
+    { 10266, 10273 },
+    { 10280, 10287 },
+    { 10294, 10301 },
+    { 10308, 10315 },
+    { 10322, 10329 },
+    { 10336, 10343 },
+    { 10350, 10357 },
+    { 10364, 10371 },
+    { 10378, 10385 },
+    { 10392, 10399 },
+    { 10406, 10413 },
+    { 10420, 10427 },
+    { 10434, 10441 },
+    { 10448, 10455 },
+    { 10462, 10469 },
+    { 10476, 10483 },
+    { 10490, 10497 },
+    { 10504, 10511 },
+    { 10518, 10525 },
+    { 10532, 10539 },
+    { 10546, 10553 },
+    { 10560, 10567 },
+    { 10574, 10581 },
+    { 10588, 10595 },
+    { 10602, 10609 },
+    { 10616, 10623 },
+    { 10630, 10637 },
+    { 10644, 10651 },
+    { 10658, 10665 },
+    { 10672, 10679 },
+    { 10686, 10693 },
+    { 10700, 10707 },
+    { 10714, 10721 },
+    { 10728, 10735 },
+    { 10742, 10749 },
+    { 10756, 10763 },
+    { 10770, 10777 },
+    { 10784, 10791 },
+    { 10798, 10805 },
+    { 10812, 10819 },
+    { 10826, 10833 },
+    { 10840, 10847 },
+    { 10854, 10867 },
+    { 10880, 10887 },
+    { 10894, 10901 },
+    { 10908, 10918 },
+    { 10928, 10935 },
+    { 10942, 10946 },
+    { 10950, 10957 },
+    { 10964, 10971 },
+    { 10978, 10985 },
+    { 10992, 10996 },
+    { 11000, 11010 },
+    { 11020, 11027 },
+    { 11034, 11047 },
+    { 11060, 11067 },
+    { 11074, 11078 },
+    { 11082, 11086 },
+    { 11090, 11094 },
+    { 11098, 11105 },
+    { 11112, 11116 },
+    { 11120, 11124 },
+    { 11128, 11132 },
+    { 11136, 11140 },
+    { 11144, 11148 },
+    { 11152, 11156 },
+    { 11160, 11167 },
+    { 11174, 11184 },
+    { 11194, 11201 },
+    { 11208, 11221 },
+    { 11234, 11238 },
+    { 11242, 11246 },
+    { 11250, 11254 },
+    { 11258, 11262 },
+    { 11266, 11270 },
+    { 11274, 11278 },
+    { 11282, 11289 },
+    { 11296, 11303 },
+    { 11310, 11323 },
+    { 11336, 11346 },
+    { 11356, 11366 },
+    { 11376, 11386 },
+    { 11396, 11403 },
+    { 11410, 11417 },
+    { 11424, 11431 },
+    { 11438, 11445 },
+    { 11452, 11459 },
+    { 11466, 11473 },
+    { 11480, 11487 },
+    { 11494, 11504 },
+    { 11514, 11521 },
+    { 11528, 11535 },
+    { 11542, 11549 },
+    { 11556, 11563 },
+    { 11570, 11577 },
+    { 11584, 11597 },
+    { 11610, 11617 },
+    { 11624, 11631 },
+    { 11638, 11645 },
+    { 11652, 11656 },
+    { 11660, 11670 },
+    { 11680, 11684 },
+    { 11688, 11695 },
+    { 11702, 11712 },
+    { 11722, 11729 },
+    { 11736, 11743 },
+    { 11750, 11757 },
+    { 11764, 11777 },
+    { 11790, 11797 },
+    { 11804, 11811 },
+    { 11818, 11822 },
+    { 11826, 11830 },
+    { 11834, 11838 },
+    { 11842, 11846 },
+    { 11850, 11854 },
+    { 11858, 11862 },
+    { 11866, 11870 },
+    { 11874, 11878 },
+    { 11882, 11889 },
+    { 11896, 11903 },
+    { 11910, 11923 },
+    { 11936, 11949 },
+    { 11962, 11969 },
+    { 11976, 11983 },
+    { 11990, 11997 },
+    { 12004, 12014 },
+    { 12024, 12037 },
+    { 12050, 12066 },
+    { 12082, 12101 },
+    { 12120, 12124 },
+    { 12128, 12135 },
+    { 12142, 12149 },
+    { 12156, 12163 },
+    { 12170, 12177 },
+    { 12184, 12191 },
+    { 12198, 12208 },
+    { 12218, 12225 },
+    { 12232, 12239 },
+    { 12246, 12253 },
+    { 12260, 12270 },
+    { 12280, 12287 },
+    { 12294, 12301 },
+    { 12308, 12315 },
+    { 12322, 12326 },
+    { 12330, 12334 },
+    { 12338, 12342 },
+    { 12346, 12356 },
+    { 12366, 12373 },
+    { 12380, 12387 },
+    { 12394, 12401 },
+    { 12408, 12415 },
+    { 12422, 12429 },
+    { 12436, 12443 },
+    { 12450, 12460 },
+    { 12470, 12480 },
+    { 12490, 12500 },
+    { 12510, 12517 },
+    { 12524, 12531 },
+    { 12538, 12548 },
+    { 12558, 12565 },
+    { 12572, 12579 },
+    { 12586, 12596 },
+    { 12606, 12616 },
+    { 12626, 12636 },
+    { 12646, 12653 },
+    { 12660, 12667 },
+    { 12674, 12681 },
+    { 12688, 12695 },
+    { 12702, 12709 },
+    { 12716, 12726 },
+    { 12736, 12746 },
+    { 12756, 12763 },
+    { 12770, 12783 },
+    { 12796, 12803 },
+    { 12810, 12814 },
+    { 12818, 12828 },
+    { 12838, 12848 },
+    { 12858, 12871 },
+    { 12884, 12888 },
+    { 12892, 12899 },
+    { 12906, 12916 },
+    { 12926, 12936 },
+    { 12946, 12956 },
+    { 12966, 12976 },
+    { 12986, 12990 },
+    { 12994, 13001 },
+    { 13008, 13015 },
+    { 13022, 13026 },
+    { 13030, 13034 },
+    { 13038, 13045 },
+    { 13052, 13059 },
+    { 13066, 13070 },
+    { 13074, 13081 },
+    { 13088, 13092 },
+    { 13096, 13100 },
+    { 13104, 13111 },
+    { 13118, 13125 },
+    { 13132, 13139 },
+    { 13146, 13153 },
+    { 13160, 13170 },
+    { 13180, 13193 },
+    { 13206, 13210 },
+    { 13214, 13224 },
+    { 13234, 13238 },
+    { 13242, 13249 },
+    { 13256, 13260 },
+    { 13264, 13274 },
+    { 13284, 13288 },
+    { 13292, 13296 },
+    { 13300, 13307 },
+    { 13314, 13324 },
+    { 13334, 13344 },
+    { 13354, 13367 },
+    { 13380, 13387 },
+    { 13394, 13401 },
+    { 13408, 13418 },
+    { 13428, 13435 },
+    { 13442, 13446 },
+    { 13450, 13460 },
+    { 13470, 13474 },
+    { 13478, 13485 },
+    { 13492, 13499 },
+    { 13506, 13513 },
+    { 13520, 13527 },
+    { 13534, 13541 },
+    { 13548, 13561 },
+    { 13574, 13581 },
+    { 13588, 13595 },
+    { 13602, 13609 },
+    { 13616, 13623 },
+    { 13630, 13637 },
+    { 13644, 13651 },
+    { 13658, 13665 },
+    { 13672, 13679 },
+    { 13686, 13693 },
+    { 13700, 13707 },
+    { 13714, 13721 },
+    { 13728, 13741 },
+    { 13754, 13761 },
+    { 13768, 13775 },
+    { 13782, 13789 },
+    { 13796, 13806 },
+    { 13816, 13826 },
+    { 13836, 13849 },
+    { 13862, 13869 },
+    { 13876, 13883 },
+    { 13890, 13897 },
+    { 13904, 13911 },
+    { 13918, 13925 },
+    { 13932, 13939 },
+    { 13946, 13953 },
+    { 13960, 13967 },
+    { 13974, 13981 },
+    { 13988, 13995 },
+    { 14002, 14009 },
+    { 14016, 14023 },
+    { 14030, 14037 },
+    { 14044, 14051 },
+    { 14058, 14065 },
+    { 14072, 14079 },
+    { 14086, 14093 },
+    { 14100, 14107 },
+    { 14114, 14121 },
+    { 14128, 14135 },
+    { 14142, 14149 },
+    { 14156, 14163 },
+    { 14170, 14177 },
+    { 14184, 14194 },
+    { 14204, 14211 },
+    { 14218, 14225 },
+    { 14232, 14236 },
+    { 14240, 14247 },
+    { 14254, 14258 },
+    { 14262, 14269 },
+    { 14276, 14283 },
+    { 14290, 14294 },
+    { 14298, 14302 },
+    { 14306, 14313 },
+    { 14320, 14327 },
+    { 14334, 14338 },
+    { 14342, 14349 },
+    { 14356, 14363 },
+    { 14370, 14377 },
+    { 14384, 14391 },
+    { 14398, 14405 },
+    { 14412, 14419 },
+    { 14426, 14433 },
+    { 14440, 14447 },
+    { 14454, 14461 },
+    { 14468, 14475 },
+    { 14482, 14489 },
+    { 14496, 14503 },
+    { 14510, 14520 },
+    { 14530, 14537 },
+    { 14544, 14551 },
+    { 14558, 14565 },
+    { 14572, 14582 },
+    { 14592, 14602 },
+    { 14612, 14619 },
+    { 14626, 14636 },
+    { 14646, 14656 },
+    { 14666, 14676 },
+    { 14686, 14693 },
+    { 14700, 14710 },
+    { 14720, 14727 },
+    { 14734, 14741 },
+    { 14748, 14755 },
+    { 14762, 14772 },
+    { 14782, 14789 },
+    { 14796, 14803 },
+    { 14810, 14817 },
+    { 14824, 14834 },
+    { 14844, 14851 },
+    { 14858, 14868 },
+    { 14878, 14888 },
+    { 14898, 14905 },
+    { 14912, 14919 },
+    { 14926, 14933 },
+    { 14940, 14947 },
+    { 14954, 14961 },
+    { 14968, 14975 },
+    { 14982, 14989 },
+    { 14996, 15003 },
+    { 15010, 15017 },
+    { 15024, 15031 },
+    { 15038, 15045 },
+    { 15052, 15062 },
+    { 15072, 15076 },
+    { 15080, 15087 },
+    { 15094, 15101 },
+    { 15108, 15118 },
+    { 15128, 15132 },
+    { 15136, 15140 },
+    { 15144, 15148 },
+    { 15152, 15159 },
+    { 15166, 15170 },
+    { 15174, 15181 },
+    { 15188, 15201 },
+    { 15214, 15221 },
+    { 15228, 15235 },
+    { 15242, 15252 },
+    { 15262, 15272 },
+    { 15282, 15295 },
+    { 15308, 15312 },
+    { 15316, 15326 },
+    { 15336, 15340 },
+    { 15344, 15348 },
+    { 15352, 15359 },
+    { 15366, 15373 },
+    { 15380, 15387 },
+    { 15394, 15401 },
+    { 15408, 15415 },
+    { 15422, 15429 },
+    { 15436, 15440 },
+    { 15444, 15451 },
+    { 15458, 15465 },
+    { 15472, 15479 },
+    { 15486, 15496 },
+    { 15506, 15513 },
+    { 15520, 15527 },
+    { 15534, 15541 },
+    { 15548, 15555 },
+    { 15562, 15569 },
+    { 15576, 15583 },
+    { 15590, 15597 },
+    { 15604, 15611 },
+    { 15618, 15625 },
+    { 15632, 15639 },
+    { 15646, 15653 },
+    { 15660, 15667 },
+    { 15674, 15681 },
+    { 15688, 15695 },
+    { 15702, 15709 },
+    { 15716, 15729 },
+    { 15742, 15749 },
+    { 15756, 15763 },
+    { 15770, 15783 },
+    { 15796, 15809 },
+    { 15822, 15829 },
+    { 15836, 15840 },
+    { 15844, 15851 },
+    { 15858, 15865 },
+    { 15872, 15882 },
+    { 15892, 15896 },
+    { 15900, 15910 },
+    { 15920, 15930 },
+    { 15940, 15950 },
+    { 15960, 15970 },
+    { 15980, 15987 },
+    { 15994, 16004 },
+    { 16014, 16018 },
+    { 16022, 16029 },
+    { 16036, 16040 },
+    { 16044, 16054 },
+    { 16064, 16074 },
+    { 16084, 16091 },
+    { 16098, 16111 },
+    { 16124, 16131 },
+    { 16138, 16145 },
+    { 16152, 16162 },
+    { 16172, 16185 },
+    { 16198, 16205 },
+    { 16212, 16228 },
+    { 16244, 16251 },
+    { 16258, 16265 },
+    { 16272, 16282 },
+    { 16292, 16302 },
+    { 16312, 16316 },
+    { 16320, 16330 },
+    { 16340, 16350 },
+    { 16360, 16364 },
+    { 16368, 16372 },
+    { 16376, 16383 },
+    { 16390, 16397 },
+    { 16404, 16408 },
+    { 16412, 16419 },
+    { 16426, 16433 },
+    { 16440, 16444 },
+    { 16448, 16458 },
+    { 16468, 16475 },
+    { 16482, 16486 },
+    { 16490, 16497 },
+    { 16504, 16511 },
+    { 16518, 16525 },
+    { 16532, 16539 },
+    { 16546, 16550 },
+    { 16554, 16561 },
+    { 16568, 16575 },
+    { 16582, 16592 },
+    { 16602, 16609 },
+    { 16616, 16623 },
+    { 16630, 16637 },
+    { 16644, 16651 },
+    { 16658, 16668 },
+    { 16678, 16685 },
+    { 16692, 16699 },
+    { 16706, 16716 },
+    { 16726, 16736 },
+    { 16746, 16753 },
+    { 16760, 16767 },
+    { 16774, 16781 },
+    { 16788, 16795 },
+    { 16802, 16809 },
+    { 16816, 16826 },
+    { 16836, 16843 },
+    { 16850, 16857 },
+    { 16864, 16871 },
+    { 16878, 16885 },
+    { 16892, 16899 },
+    { 16906, 16913 },
+    { 16920, 16927 },
+    { 16934, 16941 },
+    { 16948, 16955 },
+    { 16962, 16969 },
+    { 16976, 16983 },
+    { 16990, 16997 },
+    { 17004, 17011 },
+    { 17018, 17025 },
+    { 17032, 17039 },
+    { 17046, 17053 },
+    { 17060, 17067 },
+    { 17074, 17081 },
+    { 17088, 17095 },
+    { 17102, 17112 },
+    { 17122, 17129 },
+    { 17136, 17143 },
+    { 17150, 17157 },
+    { 17164, 17171 },
+    { 17178, 17185 },
+    { 17192, 17196 },
+    { 17200, 17210 },
+    { 17220, 17230 },
+    { 17240, 17247 },
+    { 17254, 17258 },
+    { 17262, 17266 },
+    { 17270, 17274 },
+    { 17278, 17282 },
+    { 17286, 17293 },
+    { 17300, 17307 },
+    { 17314, 17321 },
+    { 17328, 17335 },
+    { 17342, 17349 },
+    { 17356, 17360 },
+    { 17364, 17368 },
+    { 17372, 17379 },
+    { 17386, 17390 },
+    { 17394, 17401 },
+    { 17408, 17412 },
+    { 17416, 17423 },
+    { 17430, 17440 },
+    { 17450, 17457 },
+    { 17464, 17471 },
+    { 17478, 17491 },
+    { 17504, 17508 },
+    { 17512, 17516 },
+    { 17520, 17530 },
+    { 17540, 17547 },
+    { 17554, 17567 },
+    { 17580, 17584 },
+    { 17588, 17592 },
+    { 17596, 17600 },
+    { 17604, 17611 },
+    { 17618, 17622 },
+    { 17626, 17630 },
+    { 17634, 17638 },
+    { 17642, 17646 },
+    { 17650, 17657 },
+    { 17664, 17668 },
+    { 17672, 17679 },
+    { 17686, 17693 },
+    { 17700, 17707 },
+    { 17714, 17721 },
+    { 17728, 17735 },
+    { 17742, 17749 },
+    { 17756, 17763 },
+    { 17770, 17777 },
+    { 17784, 17797 },
+    { 17810, 17823 },
+    { 17836, 17840 },
+    { 17844, 17851 },
+    { 17858, 17865 },
+    { 17872, 17879 },
+    { 17886, 17893 },
+    { 17900, 17907 },
+    { 17914, 17924 },
+    { 17934, 17944 },
+    { 17954, 17967 },
+    { 17980, 17993 },
+    { 18006, 18013 },
+    { 18020, 18024 },
+    { 18028, 18035 },
+    { 18042, 18046 },
+    { 18050, 18054 },
+    { 18058, 18068 },
+    { 18078, 18088 },
+    { 18098, 18102 },
+    { 18106, 18113 },
+    { 18120, 18127 },
+    { 18134, 18141 },
+    { 18148, 18158 },
+    { 18168, 18178 },
+    { 18188, 18195 },
+    { 18202, 18212 },
+    { 18222, 18232 },
+    { 18242, 18249 },
+    { 18256, 18263 },
+    { 18270, 18277 },
+    { 18284, 18291 },
+    { 18298, 18308 },
+    { 18318, 18331 },
+    { 18344, 18354 },
+    { 18364, 18377 },
+    { 18390, 18403 },
+    { 18416, 18426 },
+    { 18436, 18443 },
+    { 18450, 18463 },
+    { 18476, 18483 },
+    { 18490, 18497 },
+    { 18504, 18511 },
+    { 18518, 18528 },
+    { 18538, 18545 },
+    { 18552, 18562 },
+    { 18572, 18576 },
+    { 18580, 18590 },
+    { 18600, 18604 },
+    { 18608, 18615 },
+    { 18622, 18626 },
+    { 18630, 18637 },
+    { 18644, 18654 },
+    { 18664, 18671 },
+    { 18678, 18685 },
+    { 18692, 18705 },
+    { 18718, 18722 },
+    { 18726, 18736 },
+    { 18746, 18756 },
+    { 18766, 18779 },
+    { 18792, 18802 },
+    { 18812, 18825 },
+    { 18838, 18848 },
+    { 18858, 18871 },
+    { 18884, 18891 },
+    { 18898, 18905 },
+    { 18912, 18922 },
+    { 18932, 18945 },
+    { 18958, 18965 },
+    { 18972, 18982 },
+    { 18992, 18999 },
+    { 19006, 19019 },
+    { 19032, 19036 },
+    { 19040, 19050 },
+    { 19060, 19064 },
+    { 19068, 19075 },
+    { 19082, 19092 },
+    { 19102, 19109 },
+    { 19116, 19123 },
+    { 19130, 19137 },
+    { 19144, 19151 },
+    { 19158, 19165 },
+    { 19172, 19179 },
+    { 19186, 19193 },
+    { 19200, 19207 },
+    { 19214, 19221 },
+    { 19228, 19235 },
+    { 19242, 19249 },
+    { 19256, 19263 },
+    { 19270, 19277 },
+    { 19284, 19291 },
+    { 19298, 19305 },
+    { 19312, 19319 },
+    { 19326, 19333 },
+    { 19340, 19347 },
+    { 19354, 19361 },
+    { 19368, 19375 },
+    { 19382, 19386 },
+    { 19390, 19397 },
+    { 19404, 19408 },
+    { 19412, 19425 },
+    { 19438, 19448 },
+    { 19458, 19465 },
+    { 19472, 19485 },
+    { 19498, 19505 },
+    { 19512, 19516 },
+    { 19520, 19533 },
+    { 19546, 19553 },
+    { 19560, 19567 },
+    { 19574, 19581 },
+    { 19588, 19595 },
+    { 19602, 19609 },
+    { 19616, 19623 },
+    { 19630, 19637 },
+    { 19644, 19654 },
+    { 19664, 19671 },
+    { 19678, 19691 },
+    { 19704, 19711 },
+    { 19718, 19725 },
+    { 19732, 19742 },
+    { 19752, 19759 },
+    { 19766, 19776 },
+    { 19786, 19793 },
+    { 19800, 19807 },
+    { 19814, 19821 },
+    { 19828, 19835 },
+    { 19842, 19849 },
+    { 19856, 19863 },
+    { 19870, 19880 },
+    { 19890, 19897 },
+    { 19904, 19914 },
+    { 19924, 19931 },
+    { 19938, 19945 },
+    { 19952, 19959 },
+    { 19966, 19973 },
+    { 19980, 19987 },
+    { 19994, 20001 },
+    { 20008, 20015 },
+    { 20022, 20029 },
+    { 20036, 20043 },
+    { 20050, 20060 },
+    { 20070, 20077 },
+    { 20084, 20091 },
+    { 20098, 20102 },
+    { 20106, 20110 },
+    { 20114, 20118 },
+    { 20122, 20129 },
+    { 20136, 20143 },
+    { 20150, 20160 },
+    { 20170, 20177 },
+    { 20184, 20191 },
+    { 20198, 20205 },
+    { 20212, 20219 },
+    { 20226, 20233 },
+    { 20240, 20250 },
+    { 20260, 20267 },
+    { 20274, 20281 },
+    { 20288, 20295 },
+    { 20302, 20315 },
+    { 20328, 20335 },
+    { 20342, 20349 },
+    { 20356, 20363 },
+    { 20370, 20374 },
+    { 20378, 20382 },
+    { 20386, 20396 },
+    { 20406, 20416 },
+    { 20426, 20430 },
+    { 20434, 20438 },
+    { 20442, 20446 },
+    { 20450, 20457 },
+    { 20464, 20471 },
+    { 20478, 20485 },
+    { 20492, 20499 },
+    { 20506, 20513 },
+    { 20520, 20527 },
+    { 20534, 20541 },
+    { 20548, 20558 },
+    { 20568, 20578 },
+    { 20588, 20595 },
+    { 20602, 20606 },
+    { 20610, 20614 },
+    { 20618, 20622 },
+    { 20626, 20630 },
+    { 20634, 20641 },
+    { 20648, 20652 },
+    { 20656, 20660 },
+    { 20664, 20671 },
+    { 20678, 20688 },
+    { 20698, 20702 },
+    { 20706, 20713 },
+    { 20720, 20727 },
+    { 20734, 20738 },
+    { 20742, 20752 },
+    { 20762, 20772 },
+    { 20782, 20789 },
+    { 20796, 20800 },
+    { 20804, 20811 },
+    { 20818, 20828 },
+    { 20838, 20848 },
+    { 20858, 20865 },
+    { 20872, 20879 },
+    { 20886, 20899 },
+    { 20912, 20919 },
+    { 20926, 20936 },
+    { 20946, 20959 },
+    { 20972, 20979 },
+    { 20986, 20990 },
+    { 20994, 21007 },
+    { 21020, 21033 },
+    { 21046, 21053 },
+    { 21060, 21076 },
+    { 21092, 21099 },
+    { 21106, 21119 },
+    { 21132, 21139 },
+    { 21146, 21153 },
+    { 21160, 21170 },
+    { 21180, 21187 },
+    { 21194, 21201 },
+    { 21208, 21215 },
+    { 21222, 21229 },
+    { 21236, 21249 },
+    { 21262, 21269 },
+    { 21276, 21283 },
+    { 21290, 21297 },
+    { 21304, 21311 },
+    { 21318, 21331 },
+    { 21344, 21354 },
+    { 21364, 21371 },
+    { 21378, 21385 },
+    { 21392, 21399 },
+    { 21406, 21413 },
+    { 21420, 21427 },
+    { 21434, 21444 },
+    { 21454, 21464 },
+    { 21474, 21481 },
+    { 21488, 21501 },
+    { 21514, 21521 },
+    { 21528, 21535 },
+    { 21542, 21549 },
+    { 21556, 21563 },
+    { 21570, 21577 },
+    { 21584, 21591 },
+    { 21598, 21608 },
+    { 21618, 21625 },
+    { 21632, 21639 },
+    { 21646, 21653 },
+    { 21660, 21667 },
+    { 21674, 21681 },
+    { 21688, 21701 },
+    { 21714, 21721 },
+    { 21728, 21735 },
+    { 21742, 21749 },
+    { 21756, 21763 },
+    { 21770, 21777 },
+    { 21784, 21791 },
+    { 21798, 21805 },
+    { 21812, 21819 },
+    { 21826, 21833 },
+    { 21840, 21847 },
+    { 21854, 21861 },
+    { 21868, 21875 },
+    { 21882, 21889 },
+    { 21896, 21900 },
+    { 21904, 21911 },
+    { 21918, 21925 },
+    { 21932, 21936 },
+    { 21940, 21944 },
+    { 21948, 21955 },
+    { 21962, 21969 },
+    { 21976, 21986 },
+    { 21996, 22009 },
+    { 22022, 22035 },
+    { 22048, 22055 },
+    { 22062, 22069 },
+    { 22076, 22086 },
+    { 22096, 22106 },
+    { 22116, 22123 },
+    { 22130, 22140 },
+    { 22150, 22160 },
+    { 22170, 22177 },
+    { 22184, 22191 },
+    { 22198, 22208 },
+    { 22218, 22225 },
+    { 22232, 22239 },
+    { 22246, 22253 },
+    { 22260, 22276 },
+    { 22292, 22299 },
+    { 22306, 22313 },
+    { 22320, 22330 },
+    { 22340, 22353 },
+    { 22366, 22373 },
+    { 22380, 22393 },
+    { 22406, 22413 },
+    { 22420, 22433 },
+    { 22446, 22459 },
+    { 22472, 22482 },
+    { 22492, 22502 },
+    { 22512, 22522 },
+    { 22532, 22542 },
+    { 22552, 22559 },
+    { 22566, 22576 },
+    { 22586, 22599 },
+    { 22612, 22619 },
+    { 22626, 22639 },
+    { 22652, 22659 },
+    { 22666, 22673 },
+    { 22680, 22687 },
+    { 22694, 22704 },
+    { 22714, 22724 },
+    { 22734, 22741 },
+    { 22748, 22755 },
+    { 22762, 22769 },
+    { 22776, 22786 },
+    { 22796, 22806 },
+    { 22816, 22826 },
+    { 22836, 22843 },
+    { 22850, 22860 },
+    { 22870, 22880 },
+    { 22890, 22903 },
+    { 22916, 22923 },
+    { 22930, 22934 },
+    { 22938, 22948 },
+    { 22958, 22968 },
+    { 22978, 22985 },
+    { 22992, 22996 },
+    { 23000, 23007 },
+    { 23014, 23018 },
+    { 23022, 23026 },
+    { 23030, 23037 },
+    { 23044, 23051 },
+    { 23058, 23065 },
+    { 23072, 23079 },
+    { 23086, 23099 },
+    { 23112, 23122 },
+    { 23132, 23145 },
+    { 23158, 23171 },
+    { 23184, 23191 },
+    { 23198, 23208 },
+    { 23218, 23225 },
+    { 23232, 23239 },
+    { 23246, 23253 },
+    { 23260, 23267 },
+    { 23274, 23284 },
+    { 23294, 23301 },
+    { 23308, 23315 },
+    { 23322, 23335 },
+    { 23348, 23355 },
+    { 23362, 23369 },
+    { 23376, 23383 },
+    { 23390, 23397 },
+    { 23404, 23411 },
+    { 23418, 23425 },
+    { 23432, 23439 },
+    { 23446, 23453 },
+    { 23460, 23467 },
+    { 23474, 23481 },
+    { 23488, 23495 },
+    { 23502, 23509 },
+    { 23516, 23523 },
+    { 23530, 23537 },
+    { 23544, 23551 },
+    { 23558, 23565 },
+    { 23572, 23579 },
+    { 23586, 23593 },
+    { 23600, 23607 },
+    { 23614, 23621 },
+    { 23628, 23635 },
+    { 23642, 23649 },
+    { 23656, 23663 },
+    { 23670, 23677 },
+    { 23684, 23697 },
+    { 23710, 23723 },
+    { 23736, 23749 },
+    { 23762, 23772 },
+    { 23782, 23789 },
+    { 23796, 23803 },
+    { 23810, 23817 },
+    { 23824, 23837 },
+    { 23850, 23857 },
+    { 23864, 23871 },
+    { 23878, 23885 },
+    { 23892, 23902 },
+    { 23912, 23919 },
+    { 23926, 23933 },
+    { 23940, 23950 },
+    { 23960, 23964 },
+    { 23968, 23975 },
+    { 23982, 23989 },
+    { 23996, 24006 },
+    { 24016, 24032 },
+    { 24048, 24061 },
+    { 24074, 24081 },
+    { 24088, 24098 },
+    { 24108, 24115 },
+    { 24122, 24132 },
+    { 24142, 24155 },
+    { 24168, 24181 },
+    { 24194, 24201 },
+    { 24208, 24215 },
+    { 24222, 24232 },
+    { 24242, 24252 },
+    { 24262, 24269 },
+    { 24276, 24283 },
+    { 24290, 24294 },
+    { 24298, 24302 },
+    { 24306, 24313 },
+    { 24320, 24324 },
+    { 24328, 24335 },
+    { 24342, 24349 },
+    { 24356, 24360 },
+    { 24364, 24371 },
+    { 24378, 24382 },
+    { 24386, 24399 },
+    { 24412, 24416 },
+    { 24420, 24424 },
+    { 24428, 24438 },
+    { 24448, 24452 },
+    { 24456, 24463 },
+    { 24470, 24477 },
+    { 24484, 24491 },
+    { 24498, 24508 },
+    { 24518, 24531 },
+    { 24544, 24551 },
+    { 24558, 24565 },
+    { 24572, 24576 },
+    { 24580, 24584 },
+    { 24588, 24592 },
+    { 24596, 24600 },
+    { 24604, 24608 },
+    { 24612, 24616 },
+    { 24620, 24627 },
+    { 24634, 24638 },
+    { 24642, 24646 },
+    { 24650, 24654 },
+    { 24658, 24662 },
+    { 24666, 24673 },
+    { 24680, 24690 },
+    { 24700, 24707 },
+    { 24714, 24727 },
+    { 24740, 24747 },
+    { 24754, 24764 },
+    { 24774, 24787 },
+    { 24800, 24807 },
+    { 24814, 24821 },
+    { 24828, 24832 },
+    { 24836, 24846 },
+    { 24856, 24860 },
+    { 24864, 24874 },
+    { 24884, 24888 },
+    { 24892, 24899 },
+    { 24906, 24913 },
+    { 24920, 24933 },
+    { 24946, 24953 },
+    { 24960, 24967 },
+    { 24974, 24981 },
+    { 24988, 24995 },
+    { 25002, 25015 },
+    { 25028, 25035 },
+    { 25042, 25049 },
+    { 25056, 25063 },
+    { 25070, 25077 },
+    { 25084, 25091 },
+    { 25098, 25105 },
+    { 25112, 25119 },
+    { 25126, 25133 },
+    { 25140, 25147 },
+    { 25154, 25161 },
+    { 25168, 25175 },
+    { 25182, 25189 },
+    { 25196, 25203 },
+    { 25210, 25217 },
+    { 25224, 25231 },
+    { 25238, 25245 },
+    { 25252, 25259 },
+    { 25266, 25273 },
+    { 25280, 25287 },
+    { 25294, 25304 },
+    { 25314, 25321 },
+    { 25328, 25335 },
+    { 25342, 25349 },
+    { 25356, 25366 },
+    { 25376, 25383 },
+    { 25390, 25397 },
+    { 25404, 25411 },
+    { 25418, 25425 },
+    { 25432, 25439 },
+    { 25446, 25453 },
+    { 25460, 25464 },
+    { 25468, 25475 },
+    { 25482, 25486 },
+    { 25490, 25494 },
+    { 25498, 25502 },
+    { 25506, 25510 },
+    { 25514, 25518 },
+    { 25522, 25526 },
+    { 25530, 25537 },
+    { 25544, 25551 },
+    { 25558, 25565 },
+    { 25572, 25579 },
+    { 25586, 25593 },
+    { 25600, 25607 },
+    { 25614, 25618 },
+    { 25622, 25626 },
+    { 25630, 25634 },
+    { 25638, 25642 },
+    { 25646, 25653 },
+    { 25660, 25667 },
+    { 25674, 25681 },
+    { 25688, 25695 },
+    { 25702, 25706 },
+    { 25710, 25714 },
+    { 25718, 25722 },
+    { 25726, 25730 },
+    { 25734, 25741 },
+    { 25748, 25755 },
+    { 25762, 25775 },
+    { 25788, 25795 },
+    { 25802, 25812 },
+    { 25822, 25835 },
+    { 25848, 25852 },
+    { 25856, 25860 },
+    { 25864, 25868 },
+    { 25872, 25876 },
+    { 25880, 25887 },
+    { 25894, 25901 },
+    { 25908, 25918 },
+    { 25928, 25935 },
+    { 25942, 25946 },
+    { 25950, 25954 },
+    { 25958, 25971 },
+    { 25984, 25991 },
+    { 25998, 26008 },
+    { 26018, 26028 },
+    { 26038, 26051 },
+    { 26064, 26071 },
+    { 26078, 26085 },
+    { 26092, 26099 },
+    { 26106, 26110 },
+    { 26114, 26118 },
+    { 26122, 26126 },
+    { 26130, 26134 },
+    { 26138, 26142 },
+    { 26146, 26153 },
+    { 26160, 26164 },
+    { 26168, 26172 },
+    { 26176, 26180 },
+    { 26184, 26191 },
+    { 26198, 26205 },
+    { 26212, 26225 },
+    { 26238, 26242 },
+    { 26246, 26253 },
+    { 26260, 26267 },
+    { 26274, 26278 },
+    { 26282, 26289 },
+    { 26296, 26303 },
+    { 26310, 26317 },
+    { 26324, 26337 },
+    { 26350, 26360 },
+    { 26370, 26383 },
+    { 26396, 26403 },
+    { 26410, 26420 },
+    { 26430, 26440 },
+    { 26450, 26457 },
+    { 26464, 26477 },
+    { 26490, 26503 },
+    { 26516, 26529 },
+    { 26542, 26552 },
+    { 26562, 26575 },
+    { 26588, 26595 },
+    { 26602, 26612 },
+    { 26622, 26629 },
+    { 26636, 26643 },
+    { 26650, 26660 },
+    { 26670, 26680 },
+    { 26690, 26703 },
+    { 26716, 26729 },
+    { 26742, 26752 },
+    { 26762, 26775 },
+    { 26788, 26795 },
+    { 26802, 26812 },
+    { 26822, 26835 },
+    { 26848, 26858 },
+    { 26868, 26881 },
+    { 26894, 26907 },
+    { 26920, 26930 },
+    { 26940, 26950 },
+    { 26960, 26970 },
+    { 26980, 26987 },
+    { 26994, 27001 },
+    { 27008, 27015 },
+    { 27022, 27032 },
+    { 27042, 27049 },
+    { 27056, 27063 },
+    { 27070, 27077 },
+    { 27084, 27097 },
+    { 27110, 27117 },
+    { 27124, 27131 },
+    { 27138, 27145 },
+    { 27152, 27159 },
+    { 27166, 27176 },
+    { 27186, 27193 },
+    { 27200, 27207 },
+    { 27214, 27221 },
+    { 27228, 27235 },
+    { 27242, 27246 },
+    { 27250, 27257 },
+    { 27264, 27268 },
+    { 27272, 27282 },
+    { 27292, 27299 },
+    { 27306, 27313 },
+    { 27320, 27327 },
+    { 27334, 27347 },
+    { 27360, 27373 },
+    { 27386, 27399 },
+    { 27412, 27419 },
+    { 27426, 27433 },
+    { 27440, 27444 },
+    { 27448, 27452 },
+    { 27456, 27460 },
+    { 27464, 27471 },
+    { 27478, 27482 },
+    { 27486, 27499 },
+    { 27512, 27519 },
+    { 27526, 27533 },
+    { 27540, 27550 },
+    { 27560, 27570 },
+    { 27580, 27590 },
+    { 27600, 27610 },
+    { 27620, 27630 },
+    { 27640, 27650 },
+    { 27660, 27664 },
+    { 27668, 27678 },
+    { 27688, 27695 },
+    { 27702, 27706 },
+    { 27710, 27717 },
+    { 27724, 27731 },
+    { 27738, 27745 },
+    { 27752, 27762 },
+    { 27772, 27779 },
+    { 27786, 27790 },
+    { 27794, 27804 },
+    { 27814, 27821 },
+    { 27828, 27844 },
+    { 27860, 27870 },
+    { 27880, 27893 },
+    { 27906, 27916 },
+    { 27926, 27939 },
+    { 27952, 27959 },
+    { 27966, 27970 },
+    { 27974, 27978 },
+    { 27982, 27989 },
+    { 27996, 28000 },
+    { 28004, 28011 },
+    { 28018, 28028 },
+    { 28038, 28048 },
+    { 28058, 28065 },
+    { 28072, 28079 },
+    { 28086, 28090 },
+    { 28094, 28098 },
+    { 28102, 28109 },
+    { 28116, 28120 },
+    { 28124, 28137 },
+    { 28150, 28157 },
+    { 28164, 28168 },
+    { 28172, 28176 },
+    { 28180, 28184 },
+    { 28188, 28192 },
+    { 28196, 28200 },
+    { 28204, 28211 },
+    { 28218, 28225 },
+    { 28232, 28242 },
+    { 28252, 28259 },
+    { 28266, 28273 },
+    { 28280, 28287 },
+    { 28294, 28298 },
+    { 28302, 28306 },
+    { 28310, 28317 },
+    { 28324, 28328 },
+    { 28332, 28336 },
+    { 28340, 28347 },
+    { 28354, 28358 },
+    { 28362, 28366 },
+    { 28370, 28374 },
+    { 28378, 28382 },
+    { 28386, 28396 },
+    { 28406, 28419 },
+    { 28432, 28445 },
+    { 28458, 28468 },
+    { 28478, 28488 },
+    { 28498, 28505 },
+    { 28512, 28522 },
+    { 28532, 28536 },
+    { 28540, 28544 },
+    { 28548, 28552 },
+    { 28556, 28563 },
+    { 28570, 28577 },
+    { 28584, 28591 },
+    { 28598, 28602 },
+    { 28606, 28610 },
+    { 28614, 28621 },
+    { 28628, 28641 },
+    { 28654, 28661 },
+    { 28668, 28675 },
+    { 28682, 28692 },
+    { 28702, 28706 },
+    { 28710, 28717 },
+    { 28724, 28731 },
+    { 28738, 28745 },
+    { 28752, 28756 },
+    { 28760, 28767 },
+    { 28774, 28781 },
+    { 28788, 28792 },
+    { 28796, 28806 },
+    { 28816, 28820 },
+    { 28824, 28831 },
+    { 28838, 28842 },
+    { 28846, 28853 },
+    { 28860, 28867 },
+    { 28874, 28878 },
+    { 28882, 28886 },
+    { 28890, 28897 },
+    { 28904, 28908 },
+    { 28912, 28919 },
+    { 28926, 28933 },
+    { 28940, 28950 },
+    { 28960, 28967 },
+    { 28974, 28981 },
+    { 28988, 28998 },
+    { 29008, 29018 },
+    { 29028, 29038 },
+    { 29048, 29058 },
+    { 29068, 29075 },
+    { 29082, 29089 },
+    { 29096, 29103 },
+    { 29110, 29117 },
+    { 29124, 29137 },
+    { 29150, 29157 },
+    { 29164, 29171 },
+    { 29178, 29185 },
+    { 29192, 29199 },
+    { 29206, 29213 },
+    { 29220, 29227 },
+    { 29234, 29244 },
+    { 29254, 29261 },
+    { 29268, 29278 },
+    { 29288, 29298 },
+    { 29308, 29315 },
+    { 29322, 29329 },
+    { 29336, 29343 },
+    { 29350, 29357 },
+    { 29364, 29371 },
+    { 29378, 29385 },
+    { 29392, 29399 },
+    { 29406, 29413 },
+    { 29420, 29427 },
+    { 29434, 29450 },
+    { 29466, 29473 },
+    { 29480, 29487 },
+    { 29494, 29501 },
+    { 29508, 29515 },
+    { 29522, 29529 },
+    { 29536, 29543 },
+    { 29550, 29557 },
+    { 29564, 29571 },
+    { 29578, 29585 },
+    { 29592, 29599 },
+    { 29606, 29613 },
+    { 29620, 29627 },
+    { 29634, 29641 },
+    { 29648, 29655 },
+    { 29662, 29669 },
+    { 29676, 29683 },
+    { 29690, 29700 },
+    { 29710, 29717 },
+    { 29724, 29731 },
+    { 29738, 29745 },
+    { 29752, 29759 },
+    { 29766, 29773 },
+    { 29780, 29787 },
+    { 29794, 29804 },
+    { 29814, 29821 },
+    { 29828, 29838 },
+    { 29848, 29855 },
+    { 29862, 29869 },
+    { 29876, 29889 },
+    { 29902, 29909 },
+    { 29916, 29923 },
+    { 29930, 29937 },
+    { 29944, 29957 },
+    { 29970, 29977 },
+    { 29984, 29994 },
+    { 30004, 30014 },
+    { 30024, 30034 },
+    { 30044, 30054 },
+    { 30064, 30074 },
+    { 30084, 30091 },
+    { 30098, 30105 },
+    { 30112, 30116 },
+    { 30120, 30127 },
+    { 30134, 30141 },
+    { 30148, 30158 },
+    { 30168, 30175 },
+    { 30182, 30192 },
+    { 30202, 30212 },
+    { 30222, 30229 },
+    { 30236, 30246 },
+    { 30256, 30266 },
+    { 30276, 30286 },
+    { 30296, 30309 },
+    { 30322, 30338 },
+    { 30354, 30367 },
+    { 30380, 30387 },
+    { 30394, 30401 },
+    { 30408, 30421 },
+    { 30434, 30444 },
+    { 30454, 30464 },
+    { 30474, 30487 },
+    { 30500, 30510 },
+    { 30520, 30533 },
+    { 30546, 30559 },
+    { 30572, 30582 },
+    { 30592, 30602 },
+    { 30612, 30625 },
+    { 30638, 30645 },
+    { 30652, 30665 },
+    { 30678, 30685 },
+    { 30692, 30702 },
+    { 30712, 30725 },
+    { 30738, 30745 },
+    { 30752, 30762 },
+    { 30772, 30782 },
+    { 30792, 30802 },
+    { 30812, 30822 },
+    { 30832, 30842 },
+    { 30852, 30865 },
+    { 30878, 30891 },
+    { 30904, 30917 },
+    { 30930, 30940 },
+    { 30950, 30957 },
+    { 30964, 30971 },
+    { 30978, 30985 },
+    { 30992, 30999 },
+    { 31006, 31016 },
+    { 31026, 31039 },
+    { 31052, 31059 },
+    { 31066, 31070 },
+    { 31074, 31081 },
+    { 31088, 31098 },
+    { 31108, 31115 },
+    { 31122, 31132 },
+    { 31142, 31155 },
+    { 31168, 31175 },
+    { 31182, 31189 },
+    { 31196, 31203 },
+    { 31210, 31217 },
+    { 31224, 31231 },
+    { 31238, 31245 },
+    { 31252, 31259 },
+    { 31266, 31273 },
+    { 31280, 31287 },
+    { 31294, 31307 },
+    { 31320, 31327 },
+    { 31334, 31341 },
+    { 31348, 31361 },
+    { 31374, 31381 },
+    { 31388, 31395 },
+    { 31402, 31409 },
+    { 31416, 31423 },
+    { 31430, 31437 },
+    { 31444, 31451 },
+    { 31458, 31471 },
+    { 31484, 31491 },
+    { 31498, 31505 },
+    { 31512, 31519 },
+    { 31526, 31533 },
+    { 31540, 31553 },
+    { 31566, 31573 },
+    { 31580, 31590 },
+    { 31600, 31607 },
+    { 31614, 31621 },
+    { 31628, 31635 },
+    { 31642, 31655 },
+    { 31668, 31675 },
+    { 31682, 31695 },
+    { 31708, 31715 },
+    { 31722, 31729 },
+    { 31736, 31743 },
+    { 31750, 31757 },
+    { 31764, 31771 },
+    { 31778, 31785 },
+    { 31792, 31799 },
+    { 31806, 31813 },
+    { 31820, 31827 },
+    { 31834, 31838 },
+    { 31842, 31849 },
+    { 31856, 31863 },
+    { 31870, 31874 },
+    { 31878, 31885 },
+    { 31892, 31896 },
+    { 31900, 31904 },
+    { 31908, 31915 },
+    { 31922, 31929 },
+    { 31936, 31943 },
+    { 31950, 31954 },
+    { 31958, 31965 },
+    { 31972, 31979 },
+    { 31986, 31990 },
+    { 31994, 32001 },
+    { 32008, 32012 },
+    { 32016, 32023 },
+    { 32030, 32037 },
+    { 32044, 32051 },
+    { 32058, 32065 },
+    { 32072, 32079 },
+    { 32086, 32093 },
+    { 32100, 32107 },
+    { 32114, 32121 },
+    { 32128, 32141 },
+    { 32154, 32161 },
+    { 32168, 32175 },
+    { 32182, 32195 },
+    { 32208, 32215 },
+    { 32222, 32232 },
+    { 32242, 32249 },
+    { 32256, 32266 },
+    { 32276, 32283 },
+    { 32290, 32300 },
+    { 32310, 32323 },
+    { 32336, 32340 },
+    { 32344, 32351 },
+    { 32358, 32362 },
+    { 32366, 32370 },
+    { 32374, 32387 },
+    { 32400, 32404 },
+    { 32408, 32412 },
+    { 32416, 32420 },
+    { 32424, 32431 },
+    { 32438, 32448 },
+    { 32458, 32462 },
+    { 32466, 32473 },
+    { 32480, 32487 },
+    { 32494, 32510 },
+    { 32526, 32533 },
+    { 32540, 32547 },
+    { 32554, 32561 },
+    { 32568, 32575 },
+    { 32582, 32589 },
+    { 32596, 32603 },
+    { 32610, 32617 },
+    { 32624, 32634 },
+    { 32644, 32651 },
+    { 32658, 32665 },
+    { 32672, 32691 },
+    { 32710, 32717 },
+    { 32724, 32731 },
+    { 32738, 32745 },
+    { 32752, 32756 },
+    { 32760, 32767 },
+    { 32774, 32778 },
+    { 32782, 32786 },
+    { 32790, 32794 },
+    { 32798, 32802 },
+    { 32806, 32810 },
+    { 32814, 32818 },
+    { 32822, 32826 },
+    { 32830, 32834 },
+    { 32838, 32845 },
+    { 32852, 32856 },
+    { 32860, 32864 },
+    { 32868, 32872 },
+    { 32876, 32880 },
+    { 32884, 32891 },
+    { 32898, 32911 },
+    { 32924, 32928 },
+    { 32932, 32936 },
+    { 32940, 32947 },
+    { 32954, 32958 },
+    { 32962, 32969 },
+    { 32976, 32983 },
+    { 32990, 32997 },
+    { 33004, 33008 },
+    { 33012, 33019 },
+    { 33026, 33036 },
+    { 33046, 33053 },
+    { 33060, 33070 },
+    { 33080, 33093 },
+    { 33106, 33113 },
+    { 33120, 33124 },
+    { 33128, 33135 },
+    { 33142, 33146 },
+    { 33150, 33157 },
+    { 33164, 33171 },
+    { 33178, 33182 },
+    { 33186, 33190 },
+    { 33194, 33204 },
+    { 33214, 33227 },
+    { 33240, 33250 },
+    { 33260, 33270 },
+    { 33280, 33287 },
+    { 33294, 33304 },
+    { 33314, 33327 },
+    { 33340, 33347 },
+    { 33354, 33361 },
+    { 33368, 33372 },
+    { 33376, 33383 },
+    { 33390, 33400 },
+    { 33410, 33423 },
+    { 33436, 33443 },
+    { 33450, 33454 },
+    { 33458, 33465 },
+    { 33472, 33482 },
+    { 33492, 33502 },
+    { 33512, 33516 },
+    { 33520, 33524 },
+    { 33528, 33535 },
+    { 33542, 33549 },
+    { 33556, 33560 },
+    { 33564, 33574 },
+    { 33584, 33588 },
+    { 33592, 33599 },
+    { 33606, 33613 },
+    { 33620, 33627 },
+    { 33634, 33641 },
+    { 33648, 33655 },
+    { 33662, 33669 },
+    { 33676, 33683 },
+    { 33690, 33694 },
+    { 33698, 33705 },
+    { 33712, 33719 },
+    { 33726, 33736 },
+    { 33746, 33750 },
+    { 33754, 33761 },
+    { 33768, 33775 },
+    { 33782, 33789 },
+    { 33796, 33803 },
+    { 33810, 33817 },
+    { 33824, 33831 },
+    { 33838, 33851 },
+    { 33864, 33868 },
+    { 33872, 33879 },
+    { 33886, 33893 },
+    { 33900, 33913 },
+    { 33926, 33930 },
+    { 33934, 33944 },
+    { 33954, 33961 },
+    { 33968, 33978 },
+    { 33988, 33998 },
+    { 34008, 34021 },
+    { 34034, 34044 },
+    { 34054, 34061 },
+    { 34068, 34078 },
+    { 34088, 34098 },
+    { 34108, 34118 },
+    { 34128, 34138 },
+    { 34148, 34158 },
+    { 34168, 34178 },
+    { 34188, 34198 },
+    { 34208, 34215 },
+    { 34222, 34226 },
+    { 34230, 34234 },
+    { 34238, 34245 },
+    { 34252, 34256 },
+    { 34260, 34267 },
+    { 34274, 34284 },
+    { 34294, 34304 },
+    { 34314, 34321 },
+    { 34328, 34332 },
+    { 34336, 34343 },
+    { 34350, 34357 },
+    { 34364, 34374 },
+    { 34384, 34394 },
+    { 34404, 34417 },
+    { 34430, 34446 },
+    { 34462, 34475 },
+    { 34488, 34498 },
+    { 34508, 34518 },
+    { 34528, 34535 },
+    { 34542, 34546 },
+    { 34550, 34560 },
+    { 34570, 34574 },
+    { 34578, 34582 },
+    { 34586, 34590 },
+    { 34594, 34601 },
+    { 34608, 34615 },
+    { 34622, 34626 },
+    { 34630, 34634 },
+    { 34638, 34651 },
+    { 34664, 34674 },
+    { 34684, 34691 },
+    { 34698, 34705 },
+    { 34712, 34725 },
+    { 34738, 34745 },
+    { 34752, 34759 },
+    { 34766, 34770 },
+    { 34774, 34781 },
+    { 34788, 34801 },
+    { 34814, 34824 },
+    { 34834, 34841 },
+    { 34848, 34855 },
+    { 34862, 34869 },
+    { 34876, 34883 },
+    { 34890, 34897 },
+    { 34904, 34911 },
+    { 34918, 34925 },
+    { 34932, 34939 },
+    { 34946, 34953 },
+    { 34960, 34967 },
+    { 34974, 34981 },
+    { 34988, 34995 },
+    { 35002, 35006 },
+    { 35010, 35014 },
+    { 35018, 35022 },
+    { 35026, 35033 },
+    { 35040, 35047 },
+    { 35054, 35064 },
+    { 35074, 35078 },
+    { 35082, 35089 },
+    { 35096, 35100 },
+    { 35104, 35117 },
+    { 35130, 35134 },
+    { 35138, 35145 },
+    { 35152, 35159 },
+    { 35166, 35173 },
+    { 35180, 35193 },
+    { 35206, 35213 },
+    { 35220, 35227 },
+    { 35234, 35244 },
+    { 35254, 35264 },
+    { 35274, 35284 },
+    { 35294, 35307 },
+    { 35320, 35324 },
+    { 35328, 35332 },
+    { 35336, 35349 },
+    { 35362, 35366 },
+    { 35370, 35374 },
+    { 35378, 35382 },
+    { 35386, 35390 },
+    { 35394, 35398 },
+    { 35402, 35406 },
+    { 35410, 35417 },
+    { 35424, 35428 },
+    { 35432, 35439 },
+    { 35446, 35453 },
+    { 35460, 35467 },
+    { 35474, 35478 },
+    { 35482, 35486 },
+    { 35490, 35494 },
+    { 35498, 35502 },
+    { 35506, 35510 },
+    { 35514, 35518 },
+    { 35522, 35529 },
+    { 35536, 35540 },
+    { 35544, 35548 },
+    { 35552, 35556 },
+    { 35560, 35564 },
+    { 35568, 35572 },
+    { 35576, 35583 },
+    { 35590, 35594 },
+    { 35598, 35605 },
+    { 35612, 35625 },
+    { 35638, 35645 },
+    { 35652, 35662 },
+    { 35672, 35685 },
+    { 35698, 35705 },
+    { 35712, 35722 },
+    { 35732, 35739 },
+    { 35746, 35753 },
+    { 35760, 35764 },
+    { 35768, 35772 },
+    { 35776, 35786 },
+    { 35796, 35806 },
+    { 35816, 35823 },
+    { 35830, 35834 },
+    { 35838, 35848 },
+    { 35858, 35865 },
+    { 35872, 35882 },
+    { 35892, 35905 },
+    { 35918, 35922 },
+    { 35926, 35930 },
+    { 35934, 35941 },
+    { 35948, 35961 },
+    { 35974, 35990 },
+    { 36006, 36010 },
+    { 36014, 36018 },
+    { 36022, 36026 },
+    { 36030, 36034 },
+    { 36038, 36048 },
+    { 36058, 36062 },
+    { 36066, 36073 },
+    { 36080, 36093 },
+    { 36106, 36113 },
+    { 36120, 36124 },
+    { 36128, 36135 },
+    { 36142, 36149 },
+    { 36156, 36160 },
+    { 36164, 36168 },
+    { 36172, 36176 },
+    { 36180, 36184 },
+    { 36188, 36192 },
+    { 36196, 36206 },
+    { 36216, 36223 },
+    { 36230, 36240 },
+    { 36250, 36260 },
+    { 36270, 36280 },
+    { 36290, 36297 },
+    { 36304, 36311 },
+    { 36318, 36328 },
+    { 36338, 36345 },
+    { 36352, 36359 },
+    { 36366, 36373 },
+    { 36380, 36387 },
+    { 36394, 36401 },
+    { 36408, 36415 },
+    { 36422, 36429 },
+    { 36436, 36443 },
+    { 36450, 36460 },
+    { 36470, 36477 },
+    { 36484, 36491 },
+    { 36498, 36505 },
+    { 36512, 36519 },
+    { 36526, 36533 },
+    { 36540, 36547 },
+    { 36554, 36561 },
+    { 36568, 36578 },
+    { 36588, 36598 },
+    { 36608, 36615 },
+    { 36622, 36629 },
+    { 36636, 36643 },
+    { 36650, 36657 },
+    { 36664, 36671 },
+    { 36678, 36685 },
+    { 36692, 36699 },
+    { 36706, 36713 },
+    { 36720, 36727 },
+    { 36734, 36741 },
+    { 36748, 36755 },
+    { 36762, 36769 },
+    { 36776, 36783 },
+    { 36790, 36797 },
+    { 36804, 36811 },
+    { 36818, 36825 },
+    { 36832, 36839 },
+    { 36846, 36853 },
+    { 36860, 36870 },
+    { 36880, 36893 },
+    { 36906, 36916 },
+    { 36926, 36933 },
+    { 36940, 36950 },
+    { 36960, 36967 },
+    { 36974, 36981 },
+    { 36988, 36998 },
+    { 37008, 37015 },
+    { 37022, 37029 },
+    { 37036, 37043 },
+    { 37050, 37057 },
+    { 37064, 37071 },
+    { 37078, 37085 },
+    { 37092, 37099 },
+    { 37106, 37113 },
+    { 37120, 37127 },
+    { 37134, 37141 },
+    { 37148, 37155 },
+    { 37162, 37172 },
+    { 37182, 37189 },
+    { 37196, 37203 },
+    { 37210, 37223 },
+    { 37236, 37243 },
+    { 37250, 37257 },
+    { 37264, 37271 },
+    { 37278, 37285 },
+    { 37292, 37299 },
+    { 37306, 37313 },
+    { 37320, 37330 },
+    { 37340, 37347 },
+    { 37354, 37364 },
+    { 37374, 37381 },
+    { 37388, 37398 },
+    { 37408, 37415 },
+    { 37422, 37429 },
+    { 37436, 37446 },
+    { 37456, 37466 },
+    { 37476, 37483 },
+    { 37490, 37500 },
+    { 37510, 37520 },
+    { 37530, 37537 },
+    { 37544, 37551 },
+    { 37558, 37565 },
+    { 37572, 37579 },
+    { 37586, 37596 },
+    { 37606, 37613 },
+    { 37620, 37627 },
+    { 37634, 37641 },
+    { 37648, 37655 },
+    { 37662, 37675 },
+    { 37688, 37695 },
+    { 37702, 37709 },
+    { 37716, 37723 },
+    { 37730, 37737 },
+    { 37744, 37751 },
+    { 37758, 37765 },
+    { 37772, 37779 },
+    { 37786, 37793 },
+    { 37800, 37807 },
+    { 37814, 37821 },
+    { 37828, 37835 },
+    { 37842, 37849 },
+    { 37856, 37863 },
+    { 37870, 37877 },
+    { 37884, 37891 },
+    { 37898, 37905 },
+    { 37912, 37922 },
+    { 37932, 37939 },
+    { 37946, 37953 },
+    { 37960, 37967 },
+    { 37974, 37987 },
+    { 38000, 38007 },
+    { 38014, 38021 },
+    { 38028, 38035 },
+    { 38042, 38049 },
+    { 38056, 38063 },
+    { 38070, 38083 },
+    { 38096, 38106 },
+    { 38116, 38126 },
+    { 38136, 38146 },
+    { 38156, 38163 },
+    { 38170, 38177 },
+    { 38184, 38191 },
+    { 38198, 38205 },
+    { 38212, 38219 },
+    { 38226, 38233 },
+    { 38240, 38247 },
+    { 38254, 38261 },
+    { 38268, 38278 },
+    { 38288, 38304 },
+    { 38320, 38327 },
+    { 38334, 38344 },
+    { 38354, 38367 },
+    { 38380, 38387 },
+    { 38394, 38404 },
+    { 38414, 38421 },
+    { 38428, 38435 },
+    { 38442, 38449 },
+    { 38456, 38463 },
+    { 38470, 38480 },
+    { 38490, 38497 },
+    { 38504, 38511 },
+    { 38518, 38525 },
+    { 38532, 38539 },
+    { 38546, 38562 },
+    { 38578, 38585 },
+    { 38592, 38599 },
+    { 38606, 38613 },
+    { 38620, 38630 },
+    { 38640, 38647 },
+    { 38654, 38661 },
+    { 38668, 38675 },
+    { 38682, 38695 },
+    { 38708, 38715 },
+    { 38722, 38732 },
+    { 38742, 38749 },
+    { 38756, 38763 },
+    { 38770, 38777 },
+    { 38784, 38794 },
+    { 38804, 38811 },
+    { 38818, 38825 },
+    { 38832, 38842 },
+    { 38852, 38862 },
+    { 38872, 38879 },
+    { 38886, 38893 },
+    { 38900, 38910 },
+    { 38920, 38927 },
+    { 38934, 38941 },
+    { 38948, 38955 },
+    { 38962, 38969 },
+    { 38976, 38986 },
+    { 38996, 39003 },
+    { 39010, 39017 },
+    { 39024, 39031 },
+    { 39038, 39045 },
+    { 39052, 39059 },
+    { 39066, 39076 },
+    { 39086, 39093 },
+    { 39100, 39107 },
+    { 39114, 39121 },
+    { 39128, 39135 },
+    { 39142, 39149 },
+    { 39156, 39163 },
+    { 39170, 39177 },
+    { 39184, 39194 },
+    { 39204, 39211 },
+    { 39218, 39225 },
+    { 39232, 39239 },
+    { 39246, 39253 },
+    { 39260, 39270 },
+    { 39280, 39287 },
+    { 39294, 39304 },
+    { 39314, 39321 },
+    { 39328, 39338 },
+    { 39348, 39355 },
+    { 39362, 39369 },
+    { 39376, 39383 },
+    { 39390, 39397 },
+    { 39404, 39411 },
+    { 39418, 39425 },
+    { 39432, 39439 },
+    { 39446, 39453 },
+    { 39460, 39473 },
+    { 39486, 39496 },
+    { 39506, 39513 },
+    { 39520, 39530 },
+    { 39540, 39550 },
+    { 39560, 39567 },
+    { 39574, 39581 },
+    { 39588, 39595 },
+    { 39602, 39606 },
+    { 39610, 39623 },
+    { 39636, 39649 },
+    { 39662, 39675 },
+    { 39688, 39695 },
+    { 39702, 39709 },
+    { 39716, 39723 },
+    { 39730, 39737 },
+    { 39744, 39754 },
+    { 39764, 39780 },
+    { 39796, 39806 },
+    { 39816, 39826 },
+    { 39836, 39849 },
+    { 39862, 39872 },
+    { 39882, 39892 },
+    { 39902, 39912 },
+    { 39922, 39935 },
+    { 39948, 39955 },
+    { 39962, 39969 },
+    { 39976, 39983 },
+    { 39990, 39997 },
+    { 40004, 40014 },
+    { 40024, 40031 },
+    { 40038, 40051 },
+    { 40064, 40071 },
+    { 40078, 40085 },
+    { 40092, 40099 },
+    { 40106, 40113 },
+    { 40120, 40130 },
+    { 40140, 40147 },
+    { 40154, 40161 },
+    { 40168, 40175 },
+    { 40182, 40189 },
+    { 40196, 40203 },
+    { 40210, 40217 },
+    { 40224, 40234 },
+    { 40244, 40248 },
+    { 40252, 40259 },
+    { 40266, 40276 },
+    { 40286, 40293 },
+    { 40300, 40304 },
+    { 40308, 40321 },
+    { 40334, 40341 },
+    { 40348, 40352 },
+    { 40356, 40363 },
+    { 40370, 40380 },
+    { 40390, 40397 },
+    { 40404, 40411 },
+    { 40418, 40422 },
+    { 40426, 40430 },
+    { 40434, 40438 },
+    { 40442, 40446 },
+    { 40450, 40460 },
+    { 40470, 40477 },
+    { 40484, 40491 },
+    { 40498, 40505 },
+    { 40512, 40516 },
+    { 40520, 40527 },
+    { 40534, 40541 },
+    { 40548, 40558 },
+    { 40568, 40578 },
+    { 40588, 40592 },
+    { 40596, 40600 },
+    { 40604, 40611 },
+    { 40618, 40625 },
+    { 40632, 40636 },
+    { 40640, 40647 },
+    { 40654, 40664 },
+    { 40674, 40684 },
+    { 40694, 40698 },
+    { 40702, 40709 },
+    { 40716, 40723 },
+    { 40730, 40737 },
+    { 40744, 40757 },
+    { 40770, 40777 },
+    { 40784, 40791 },
+    { 40798, 40805 },
+    { 40812, 40816 },
+    { 40820, 40824 },
+    { 40828, 40835 },
+    { 40842, 40849 },
+    { 40856, 40863 },
+    { 40870, 40877 },
+    { 40884, 40894 },
+    { 40904, 40917 },
+    { 40930, 40934 },
+    { 40938, 40945 },
+    { 40952, 40959 },
+    { 40966, 40973 },
+    { 40980, 40990 },
+    { 41000, 41004 },
+    { 41008, 41018 },
+    { 41028, 41044 },
+    { 41060, 41067 },
+    { 41074, 41081 },
+    { 41088, 41098 },
+    { 41108, 41112 },
+    { 41116, 41129 },
+    { 41142, 41149 },
+    { 41156, 41163 },
+    { 41170, 41174 },
+    { 41178, 41182 },
+    { 41186, 41190 },
+    { 41194, 41204 },
+    { 41214, 41224 },
+    { 41234, 41238 },
+    { 41242, 41249 },
+    { 41256, 41269 },
+    { 41282, 41289 },
+    { 41296, 41303 },
+    { 41310, 41314 },
+    { 41318, 41325 },
+    { 41332, 41339 },
+    { 41346, 41350 },
+    { 41354, 41361 },
+    { 41368, 41375 },
+    { 41382, 41389 },
+    { 41396, 41409 },
+    { 41422, 41432 },
+    { 41442, 41446 },
+    { 41450, 41457 },
+    { 41464, 41477 },
+    { 41490, 41494 },
+    { 41498, 41508 },
+    { 41518, 41522 },
+    { 41526, 41536 },
+    { 41546, 41559 },
+    { 41572, 41579 },
+    { 41586, 41593 },
+    { 41600, 41607 },
+    { 41614, 41621 },
+    { 41628, 41635 },
+    { 41642, 41649 },
+    { 41656, 41663 },
+    { 41670, 41677 },
+    { 41684, 41691 },
+    { 41698, 41705 },
+    { 41712, 41719 },
+    { 41726, 41739 },
+    { 41752, 41759 },
+    { 41766, 41773 },
+    { 41780, 41787 },
+    { 41794, 41801 },
+    { 41808, 41815 },
+    { 41822, 41829 },
+    { 41836, 41843 },
+    { 41850, 41857 },
+    { 41864, 41871 },
+    { 41878, 41885 },
+    { 41892, 41899 },
+    { 41906, 41913 },
+    { 41920, 41927 },
+    { 41934, 41941 },
+    { 41948, 41955 },
+    { 41962, 41969 },
+    { 41976, 41983 },
+    { 41990, 41997 },
+    { 42004, 42011 },
+    { 42018, 42025 },
+    { 42032, 42039 },
+    { 42046, 42053 },
+    { 42060, 42067 },
+    { 42074, 42081 },
+    { 42088, 42095 },
+    { 42102, 42109 },
+    { 42116, 42123 },
+    { 42130, 42137 },
+    { 42144, 42151 },
+    { 42158, 42165 },
+    { 42172, 42179 },
+    { 42186, 42193 },
+    { 42200, 42207 },
+    { 42214, 42221 },
+    { 42228, 42235 },
+    { 42242, 42255 },
+    { 42268, 42275 },
+    { 42282, 42286 },
+    { 42290, 42297 },
+    { 42304, 42311 },
+    { 42318, 42325 },
+    { 42332, 42339 },
+    { 42346, 42353 },
+    { 42360, 42367 },
+    { 42374, 42384 },
+    { 42394, 42401 },
+    { 42408, 42421 },
+    { 42434, 42438 },
+    { 42442, 42455 },
+    { 42468, 42481 },
+    { 42494, 42501 },
+    { 42508, 42515 },
+    { 42522, 42529 },
+    { 42536, 42543 },
+    { 42550, 42560 },
+    { 42570, 42577 },
+    { 42584, 42591 },
+    { 42598, 42608 },
+    { 42618, 42628 },
+    { 42638, 42648 },
+    { 42658, 42668 },
+    { 42678, 42688 },
+    { 42698, 42708 },
+    { 42718, 42728 },
+    { 42738, 42748 },
+    { 42758, 42768 },
+    { 42778, 42788 },
+    { 42798, 42808 },
+    { 42818, 42828 },
+    { 42838, 42848 },
+    { 42858, 42868 },
+    { 42878, 42888 },
+    { 42898, 42908 },
+    { 42918, 42928 },
+    { 42938, 42948 },
+    { 42958, 42968 },
+    { 42978, 42988 },
+    { 42998, 43008 },
+    { 43018, 43028 },
+    { 43038, 43048 },
+    { 43058, 43068 },
+    { 43078, 43088 },
+    { 43098, 43108 },
+    { 43118, 43128 },
+    { 43138, 43148 },
+    { 43158, 43168 },
+    { 43178, 43188 },
+    { 43198, 43208 },
+    { 43218, 43228 },
+    { 43238, 43248 },
+    { 43258, 43268 },
+    { 43278, 43288 },
+    { 43298, 43308 },
+    { 43318, 43328 },
+    { 43338, 43348 },
+    { 43358, 43368 },
+    { 43378, 43388 },
+    { 43398, 43408 },
+    { 43418, 43428 },
+    { 43438, 43448 },
+    { 43458, 43468 },
+    { 43478, 43488 },
+    { 43498, 43508 },
+    { 43518, 43528 },
+    { 43538, 43548 },
+    { 43558, 43568 },
+    { 43578, 43588 },
+    { 43598, 43608 },
+    { 43618, 43628 },
+    { 43638, 43648 },
+    { 43658, 43668 },
+    { 43678, 43688 },
+    { 43698, 43708 },
+    { 43718, 43728 },
+    { 43738, 43748 },
+    { 43758, 43768 },
+    { 43778, 43788 },
+    { 43798, 43808 },
+    { 43818, 43828 },
+    { 43838, 43848 },
+    { 43858, 43868 },
+    { 43878, 43888 },
+    { 43898, 43908 },
+    { 43918, 43928 },
+    { 43938, 43948 },
+    { 43958, 43968 },
+    { 43978, 43988 },
+    { 43998, 44008 },
+    { 44018, 44028 },
+    { 44038, 44048 },
+    { 44058, 44068 },
+    { 44078, 44088 },
+    { 44098, 44108 },
+    { 44118, 44128 },
+    { 44138, 44148 },
+    { 44158, 44168 },
+    { 44178, 44188 },
+    { 44198, 44208 },
+    { 44218, 44228 },
+    { 44238, 44248 },
+    { 44258, 44268 },
+    { 44278, 44288 },
+    { 44298, 44308 },
+    { 44318, 44328 },
+    { 44338, 44348 },
+    { 44358, 44368 },
+    { 44378, 44388 },
+    { 44398, 44408 },
+    { 44418, 44428 },
+    { 44438, 44448 },
+    { 44458, 44468 },
+    { 44478, 44488 },
+    { 44498, 44508 },
+    { 44518, 44528 },
+    { 44538, 44548 },
+    { 44558, 44568 },
+    { 44578, 44588 },
+    { 44598, 44608 },
+    { 44618, 44628 },
+    { 44638, 44648 },
+    { 44658, 44668 },
+    { 44678, 44688 },
+    { 44698, 44708 },
+    { 44718, 44728 },
+    { 44738, 44748 },
+    { 44758, 44768 },
+    { 44778, 44788 },
+    { 44798, 44808 },
+    { 44818, 44831 },
+    { 44844, 44851 },
+    { 44858, 44871 },
+    { 44884, 44891 },
+    { 44898, 44905 },
+    { 44912, 44922 },
+    { 44932, 44945 },
+    { 44958, 44965 },
+    { 44972, 44976 },
+    { 44980, 44984 },
+    { 44988, 44995 },
+    { 45002, 45009 },
+    { 45016, 45023 },
+    { 45030, 45037 },
+    { 45044, 45051 },
+    { 45058, 45071 },
+    { 45084, 45091 },
+    { 45098, 45102 },
+    { 45106, 45113 },
+    { 45120, 45127 },
+    { 45134, 45147 },
+    { 45160, 45164 },
+    { 45168, 45172 },
+    { 45176, 45183 },
+    { 45190, 45197 },
+    { 45204, 45208 },
+    { 45212, 45216 },
+    { 45220, 45224 },
+    { 45228, 45232 },
+    { 45236, 45240 },
+    { 45244, 45248 },
+    { 45252, 45262 },
+    { 45272, 45285 },
+    { 45298, 45311 },
+    { 45324, 45337 },
+    { 45350, 45354 },
+    { 45358, 45371 },
+    { 45384, 45397 },
+    { 45410, 45423 },
+    { 45436, 45443 },
+    { 45450, 45457 },
+    { 45464, 45477 },
+    { 45490, 45503 },
+    { 45516, 45523 },
+    { 45530, 45534 },
+    { 45538, 45548 },
+    { 45558, 45568 },
+    { 45578, 45588 },
+    { 45598, 45602 },
+    { 45606, 45610 },
+    { 45614, 45621 },
+    { 45628, 45632 },
+    { 45636, 45649 },
+    { 45662, 45666 },
+    { 45670, 45683 },
+    { 45696, 45703 },
+    { 45710, 45714 },
+    { 45718, 45725 },
+    { 45732, 45736 },
+    { 45740, 45747 },
+    { 45754, 45761 },
+    { 45768, 45775 },
+    { 45782, 45795 },
+    { 45808, 45812 },
+    { 45816, 45820 },
+    { 45824, 45828 },
+    { 45832, 45836 },
+    { 45840, 45844 },
+    { 45848, 45852 },
+    { 45856, 45863 },
+    { 45870, 45883 },
+    { 45896, 45903 },
+    { 45910, 45917 },
+    { 45924, 45928 },
+    { 45932, 45936 },
+    { 45940, 45944 },
+    { 45948, 45955 },
+    { 45962, 45969 },
+    { 45976, 45986 },
+    { 45996, 46003 },
+    { 46010, 46014 },
+    { 46018, 46022 },
+    { 46026, 46033 },
+    { 46040, 46047 },
+    { 46054, 46061 },
+    { 46068, 46075 },
+    { 46082, 46089 },
+    { 46096, 46100 },
+    { 46104, 46111 },
+    { 46118, 46125 },
+    { 46132, 46139 },
+    { 46146, 46150 },
+    { 46154, 46158 },
+    { 46162, 46169 },
+    { 46176, 46180 },
+    { 46184, 46197 },
+    { 46210, 46214 },
+    { 46218, 46222 },
+    { 46226, 46230 },
+    { 46234, 46238 },
+    { 46242, 46246 },
+    { 46250, 46257 },
+    { 46264, 46271 },
+    { 46278, 46291 },
+    { 46304, 46308 },
+    { 46312, 46316 },
+    { 46320, 46324 },
+    { 46328, 46332 },
+    { 46336, 46343 },
+    { 46350, 46357 },
+    { 46364, 46377 },
+    { 46390, 46394 },
+    { 46398, 46405 },
+    { 46412, 46416 },
+    { 46420, 46424 },
+    { 46428, 46432 },
+    { 46436, 46443 },
+    { 46450, 46457 },
+    { 46464, 46468 },
+    { 46472, 46476 },
+    { 46480, 46484 },
+    { 46488, 46495 },
+    { 46502, 46512 },
+    { 46522, 46526 },
+    { 46530, 46534 },
+    { 46538, 46551 },
+    { 46564, 46571 },
+    { 46578, 46585 },
+    { 46592, 46596 },
+    { 46600, 46607 },
+    { 46614, 46618 },
+    { 46622, 46635 },
+    { 46648, 46652 },
+    { 46656, 46663 },
+    { 46670, 46677 },
+    { 46684, 46700 },
+    { 46716, 46729 },
+    { 46742, 46749 },
+    { 46756, 46763 },
+    { 46770, 46777 },
+    { 46784, 46791 },
+    { 46798, 46808 },
+    { 46818, 46828 },
+    { 46838, 46848 },
+    { 46858, 46868 },
+    { 46878, 46885 },
+    { 46892, 46902 },
+    { 46912, 46919 },
+    { 46926, 46933 },
+    { 46940, 46950 },
+    { 46960, 46970 },
+    { 46980, 46987 },
+    { 46994, 47001 },
+    { 47008, 47015 },
+    { 47022, 47029 },
+    { 47036, 47043 },
+    { 47050, 47057 },
+    { 47064, 47074 },
+    { 47084, 47091 },
+    { 47098, 47105 },
+    { 47112, 47119 },
+    { 47126, 47133 },
+    { 47140, 47147 },
+    { 47154, 47161 },
+    { 47168, 47175 },
+    { 47182, 47189 },
+    { 47196, 47203 },
+    { 47210, 47214 },
+    { 47218, 47225 },
+    { 47232, 47239 },
+    { 47246, 47256 },
+    { 47266, 47273 },
+    { 47280, 47293 },
+    { 47306, 47316 },
+    { 47326, 47333 },
+    { 47340, 47347 },
+    { 47354, 47364 },
+    { 47374, 47381 },
+    { 47388, 47398 },
+    { 47408, 47415 },
+    { 47422, 47429 },
+    { 47436, 47446 },
+    { 47456, 47463 },
+    { 47470, 47477 },
+    { 47484, 47491 },
+    { 47498, 47505 },
+    { 47512, 47519 },
+    { 47526, 47533 },
+    { 47540, 47550 },
+    { 47560, 47567 },
+    { 47574, 47587 },
+    { 47600, 47607 },
+    { 47614, 47621 },
+    { 47628, 47635 },
+    { 47642, 47649 },
+    { 47656, 47663 },
+    { 47670, 47677 },
+    { 47684, 47691 },
+    { 47698, 47705 },
+    { 47712, 47719 },
+    { 47726, 47733 },
+    { 47740, 47750 },
+    { 47760, 47767 },
+    { 47774, 47781 },
+    { 47788, 47795 },
+    { 47802, 47809 },
+    { 47816, 47823 },
+    { 47830, 47837 },
+    { 47844, 47854 },
+    { 47864, 47871 },
+    { 47878, 47888 },
+    { 47898, 47902 },
+    { 47906, 47910 },
+    { 47914, 47918 },
+    { 47922, 47926 },
+    { 47930, 47937 },
+    { 47944, 47948 },
+    { 47952, 47959 },
+    { 47966, 47970 },
+    { 47974, 47981 },
+    { 47988, 48001 },
+    { 48014, 48021 },
+    { 48028, 48035 },
+    { 48042, 48049 },
+    { 48056, 48063 },
+    { 48070, 48083 },
+    { 48096, 48103 },
+    { 48110, 48117 },
+    { 48124, 48131 },
+    { 48138, 48145 },
+    { 48152, 48159 },
+    { 48166, 48173 },
+    { 48180, 48187 },
+    { 48194, 48201 },
+    { 48208, 48215 },
+    { 48222, 48232 },
+    { 48242, 48249 },
+    { 48256, 48263 },
+    { 48270, 48277 },
+    { 48284, 48291 },
+    { 48298, 48305 },
+    { 48312, 48319 },
+    { 48326, 48333 },
+    { 48340, 48347 },
+    { 48354, 48358 },
+    { 48362, 48366 },
+    { 48370, 48374 },
+    { 48378, 48382 },
+    { 48386, 48390 },
+    { 48394, 48398 },
+    { 48402, 48406 },
+    { 48410, 48417 },
+    { 48424, 48428 },
+    { 48432, 48439 },
+    { 48446, 48459 },
+    { 48472, 48485 },
+    { 48498, 48517 },
+    { 48536, 48549 },
+    { 48562, 48569 },
+    { 48576, 48583 },
+    { 48590, 48597 },
+    { 48604, 48611 },
+    { 48618, 48628 },
+    { 48638, 48645 },
+    { 48652, 48659 },
+    { 48666, 48673 },
+    { 48680, 48693 },
+    { 48706, 48710 },
+    { 48714, 48724 },
+    { 48734, 48744 },
+    { 48754, 48761 },
+    { 48768, 48775 },
+    { 48782, 48801 },
+    { 48820, 48827 },
+    { 48834, 48841 },
+    { 48848, 48858 },
+    { 48868, 48875 },
+    { 48882, 48889 },
+    { 48896, 48903 },
+    { 48910, 48917 },
+    { 48924, 48931 },
+    { 48938, 48945 },
+    { 48952, 48959 },
+    { 48966, 48973 },
+    { 48980, 48984 },
+    { 48988, 48992 },
+    { 48996, 49000 },
+    { 49004, 49008 },
+    { 49012, 49016 },
+    { 49020, 49024 },
+    { 49028, 49035 },
+    { 49042, 49046 },
+    { 49050, 49057 },
+    { 49064, 49068 },
+    { 49072, 49079 },
+    { 49086, 49093 },
+    { 49100, 49107 },
+    { 49114, 49121 },
+    { 49128, 49135 },
+    { 49142, 49149 },
+    { 49156, 49166 },
+    { 49176, 49180 },
+    { 49184, 49191 },
+    { 49198, 49205 },
+    { 49212, 49219 },
+    { 49226, 49233 },
+    { 49240, 49247 },
+    { 49254, 49264 },
+    { 49274, 49281 },
+    { 49288, 49292 },
+    { 49296, 49300 },
+    { 49304, 49308 },
+    { 49312, 49316 },
+    { 49320, 49324 },
+    { 49328, 49332 },
+    { 49336, 49340 },
+    { 49344, 49348 },
+    { 49352, 49356 },
+    { 49360, 49364 },
+    { 49368, 49372 },
+    { 49376, 49386 },
+    { 49396, 49403 },
+    { 49410, 49417 },
+    { 49424, 49431 },
+    { 49438, 49445 },
+    { 49452, 49459 },
+    { 49466, 49473 },
+    { 49480, 49487 },
+    { 49494, 49501 },
+    { 49508, 49515 },
+    { 49522, 49529 },
+    { 49536, 49543 },
+    { 49550, 49560 },
+    { 49570, 49580 },
+    { 49590, 49600 },
+    { 49610, 49617 },
+    { 49624, 49634 },
+    { 49644, 49648 },
+    { 49652, 49659 },
+    { 49666, 49673 },
+    { 49680, 49684 },
+    { 49688, 49692 },
+    { 49696, 49700 },
+    { 49704, 49711 },
+    { 49718, 49725 },
+    { 49732, 49736 },
+    { 49740, 49753 },
+    { 49766, 49770 },
+    { 49774, 49781 },
+    { 49788, 49795 },
+    { 49802, 49809 },
+    { 49816, 49823 },
+    { 49830, 49840 },
+    { 49850, 49857 },
+    { 49864, 49874 },
+    { 49884, 49894 },
+    { 49904, 49911 },
+    { 49918, 49931 },
+    { 49944, 49951 },
+    { 49958, 49971 },
+    { 49984, 49988 },
+    { 49992, 49996 },
+    { 50000, 50004 },
+    { 50008, 50012 },
+    { 50016, 50020 },
+    { 50024, 50028 },
+    { 50032, 50042 },
+    { 50052, 50065 },
+    { 50078, 50094 },
+    { 50110, 50120 },
+    { 50130, 50137 },
+    { 50144, 50151 },
+    { 50158, 50165 },
+    { 50172, 50179 },
+    { 50186, 50193 },
+    { 50200, 50207 },
+    { 50214, 50218 },
+    { 50222, 50226 },
+    { 50230, 50234 },
+    { 50238, 50242 },
+    { 50246, 50250 },
+    { 50254, 50258 },
+    { 50262, 50269 },
+    { 50276, 50283 },
+    { 50290, 50297 },
+    { 50304, 50311 },
+    { 50318, 50328 },
+    { 50338, 50342 },
+    { 50346, 50350 },
+    { 50354, 50361 },
+    { 50368, 50372 },
+    { 50376, 50380 },
+    { 50384, 50391 },
+    { 50398, 50402 },
+    { 50406, 50410 },
+    { 50414, 50418 },
+    { 50422, 50435 },
+    { 50448, 50455 },
+    { 50462, 50469 },
+    { 50476, 50483 },
+    { 50490, 50494 },
+    { 50498, 50505 },
+    { 50512, 50516 },
+    { 50520, 50527 },
+    { 50534, 50541 },
+    { 50548, 50561 },
+    { 50574, 50581 },
+    { 50588, 50595 },
+    { 50602, 50606 },
+    { 50610, 50614 },
+    { 50618, 50622 },
+    { 50626, 50630 },
+    { 50634, 50641 },
+    { 50648, 50658 },
+    { 50668, 50672 },
+    { 50676, 50683 },
+    { 50690, 50697 },
+    { 50704, 50708 },
+    { 50712, 50719 },
+    { 50726, 50736 },
+    { 50746, 50753 },
+    { 50760, 50767 },
+    { 50774, 50781 },
+    { 50788, 50798 },
+    { 50808, 50815 },
+    { 50822, 50829 },
+    { 50836, 50843 },
+    { 50850, 50854 },
+    { 50858, 50871 },
+    { 50884, 50894 },
+    { 50904, 50911 },
+    { 50918, 50922 },
+    { 50926, 50933 },
+    { 50940, 50953 },
+    { 50966, 50973 },
+    { 50980, 50987 },
+    { 50994, 51001 },
+    { 51008, 51015 },
+    { 51022, 51026 },
+    { 51030, 51037 },
+    { 51044, 51054 },
+    { 51064, 51077 },
+    { 51090, 51100 },
+    { 51110, 51120 },
+    { 51130, 51140 },
+    { 51150, 51160 },
+    { 51170, 51180 },
+    { 51190, 51200 },
+    { 51210, 51220 },
+    { 51230, 51240 },
+    { 51250, 51260 },
+    { 51270, 51280 },
+    { 51290, 51300 },
+    { 51310, 51320 },
+    { 51330, 51340 },
+    { 51350, 51363 },
+    { 51376, 51389 },
+    { 51402, 51409 },
+    { 51416, 51426 },
+    { 51436, 51446 },
+    { 51456, 51469 },
+    { 51482, 51495 },
+    { 51508, 51515 },
+    { 51522, 51532 },
+    { 51542, 51552 },
+    { 51562, 51572 },
+    { 51582, 51595 },
+    { 51608, 51612 },
+    { 51616, 51620 },
+    { 51624, 51634 },
+    { 51644, 51651 },
+    { 51658, 51665 },
+    { 51672, 51679 },
+    { 51686, 51699 },
+    { 51712, 51719 },
+    { 51726, 51733 },
+    { 51740, 51750 },
+    { 51760, 51770 },
+    { 51780, 51787 },
+    { 51794, 51801 },
+    { 51808, 51815 },
+    { 51822, 51829 },
+    { 51836, 51843 },
+    { 51850, 51860 },
+    { 51870, 51880 },
+    { 51890, 51897 },
+    { 51904, 51911 },
+    { 51918, 51925 },
+    { 51932, 51942 },
+    { 51952, 51959 },
+    { 51966, 51973 },
+    { 51980, 51987 },
+    { 51994, 52001 },
+    { 52008, 52015 },
+    { 52022, 52032 },
+    { 52042, 52049 },
+    { 52056, 52063 },
+    { 52070, 52077 },
+    { 52084, 52094 },
+    { 52104, 52111 },
+    { 52118, 52125 },
+    { 52132, 52139 },
+    { 52146, 52153 },
+    { 52160, 52170 },
+    { 52180, 52187 },
+    { 52194, 52201 },
+    { 52208, 52215 },
+    { 52222, 52229 },
+    { 52236, 52243 },
+    { 52250, 52263 },
+    { 52276, 52283 },
+    { 52290, 52297 },
+    { 52304, 52311 },
+    { 52318, 52325 },
+    { 52332, 52339 },
+    { 52346, 52359 },
+    { 52372, 52385 },
+    { 52398, 52405 },
+    { 52412, 52422 },
+    { 52432, 52439 },
+    { 52446, 52453 },
+    { 52460, 52467 },
+    { 52474, 52484 },
+    { 52494, 52501 },
+    { 52508, 52521 },
+    { 52534, 52547 },
+    { 52560, 52573 },
+    { 52586, 52593 },
+    { 52600, 52607 },
+    { 52614, 52621 },
+    { 52628, 52635 },
+    { 52642, 52649 },
+    { 52656, 52663 },
+    { 52670, 52677 },
+    { 52684, 52694 },
+    { 52704, 52711 },
+    { 52718, 52725 },
+    { 52732, 52739 },
+    { 52746, 52753 },
+    { 52760, 52770 },
+    { 52780, 52787 },
+    { 52794, 52804 },
+    { 52814, 52821 },
+    { 52828, 52835 },
+    { 52842, 52849 },
+    { 52856, 52863 },
+    { 52870, 52880 },
+    { 52890, 52897 },
+    { 52904, 52908 },
+    { 52912, 52925 },
+    { 52938, 52942 },
+    { 52946, 52953 },
+    { 52960, 52973 },
+    { 52986, 52993 },
+    { 53000, 53010 },
+    { 53020, 53030 },
+    { 53040, 53047 },
+    { 53054, 53067 },
+    { 53080, 53090 },
+    { 53100, 53110 },
+    { 53120, 53127 },
+    { 53134, 53147 },
+    { 53160, 53167 },
+    { 53174, 53181 },
+    { 53188, 53195 },
+    { 53202, 53209 },
+    { 53216, 53223 },
+    { 53230, 53234 },
+    { 53238, 53251 },
+    { 53264, 53271 },
+    { 53278, 53291 },
+    { 53304, 53317 },
+    { 53330, 53337 },
+    { 53344, 53354 },
+    { 53364, 53377 },
+    { 53390, 53397 },
+    { 53404, 53411 },
+    { 53418, 53422 },
+    { 53426, 53433 },
+    { 53440, 53450 },
+    { 53460, 53467 },
+    { 53474, 53481 },
+    { 53488, 53495 },
+    { 53502, 53512 },
+    { 53522, 53529 },
+    { 53536, 53540 },
+    { 53544, 53551 },
+    { 53558, 53571 },
+    { 53584, 53588 },
+    { 53592, 53599 },
+    { 53606, 53613 },
+    { 53620, 53627 },
+    { 53634, 53641 },
+    { 53648, 53655 },
+    { 53662, 53672 },
+    { 53682, 53689 },
+    { 53696, 53703 },
+    { 53710, 53717 },
+    { 53724, 53731 },
+    { 53738, 53751 },
+    { 53764, 53771 },
+    { 53778, 53791 },
+    { 53804, 53817 },
+    { 53830, 53837 },
+    { 53844, 53851 },
+    { 53858, 53862 },
+    { 53866, 53873 },
+    { 53880, 53890 },
+    { 53900, 53910 },
+    { 53920, 53936 },
+    { 53952, 53959 },
+    { 53966, 53979 },
+    { 53992, 54002 },
+    { 54012, 54019 },
+    { 54026, 54030 },
+    { 54034, 54038 },
+    { 54042, 54052 },
+    { 54062, 54075 },
+    { 54088, 54101 },
+    { 54114, 54127 },
+    { 54140, 54153 },
+    { 54166, 54179 },
+    { 54192, 54205 },
+    { 54218, 54231 },
+    { 54244, 54254 },
+    { 54264, 54277 },
+    { 54290, 54297 },
+    { 54304, 54308 },
+    { 54312, 54316 },
+    { 54320, 54327 },
+    { 54334, 54341 },
+    { 54348, 54352 },
+    { 54356, 54360 },
+    { 54364, 54368 },
+    { 54372, 54376 },
+    { 54380, 54387 },
+    { 54394, 54401 },
+    { 54408, 54415 },
+    { 54422, 54432 },
+    { 54442, 54449 },
+    { 54456, 54460 },
+    { 54464, 54474 },
+    { 54484, 54491 },
+    { 54498, 54508 },
+    { 54518, 54525 },
+    { 54532, 54536 },
+    { 54540, 54553 },
+    { 54566, 54573 },
+    { 54580, 54587 },
+    { 54594, 54604 },
+    { 54614, 54621 },
+    { 54628, 54638 },
+    { 54648, 54655 },
+    { 54662, 54669 },
+    { 54676, 54689 },
+    { 54702, 54709 },
+    { 54716, 54723 },
+    { 54730, 54737 },
+    { 54744, 54751 },
+    { 54758, 54768 },
+    { 54778, 54791 },
+    { 54804, 54814 },
+    { 54824, 54840 },
+    { 54856, 54863 },
+    { 54870, 54877 },
+    { 54884, 54891 },
+    { 54898, 54914 },
+    { 54930, 54937 },
+    { 54944, 54954 },
+    { 54964, 54974 },
+    { 54984, 54994 },
+    { 55004, 55011 },
+    { 55018, 55028 },
+    { 55038, 55048 },
+    { 55058, 55071 },
+    { 55084, 55091 },
+    { 55098, 55108 },
+    { 55118, 55125 },
+    { 55132, 55145 },
+    { 55158, 55165 },
+    { 55172, 55185 },
+    { 55198, 55205 },
+    { 55212, 55219 },
+    { 55226, 55233 },
+    { 55240, 55247 },
+    { 55254, 55264 },
+    { 55274, 55284 },
+    { 55294, 55301 },
+    { 55308, 55312 },
+    { 55316, 55326 },
+    { 55336, 55343 },
+    { 55350, 55360 },
+    { 55370, 55383 },
+    { 55396, 55412 },
+    { 55428, 55435 },
+    { 55442, 55452 },
+    { 55462, 55469 },
+    { 55476, 55483 },
+    { 55490, 55497 },
+    { 55504, 55514 },
+    { 55524, 55531 },
+    { 55538, 55545 },
+    { 55552, 55559 },
+    { 55566, 55573 },
+    { 55580, 55587 },
+    { 55594, 55601 },
+    { 55608, 55615 },
+    { 55622, 55629 },
+    { 55636, 55643 },
+    { 55650, 55657 },
+    { 55664, 55671 },
+    { 55678, 55685 },
+    { 55692, 55699 },
+    { 55706, 55713 },
+    { 55720, 55724 },
+    { 55728, 55738 },
+    { 55748, 55758 },
+    { 55768, 55778 },
+    { 55788, 55801 },
+    { 55814, 55818 },
+    { 55822, 55826 },
+    { 55830, 55843 },
+    { 55856, 55863 },
+    { 55870, 55877 },
+    { 55884, 55888 },
+    { 55892, 55899 },
+    { 55906, 55913 },
+    { 55920, 55927 },
+    { 55934, 55944 },
+    { 55954, 55961 },
+    { 55968, 55978 },
+    { 55988, 55998 },
+    { 56008, 56018 },
+    { 56028, 56038 },
+    { 56048, 56061 },
+    { 56074, 56087 },
+    { 56100, 56107 },
+    { 56114, 56118 },
+    { 56122, 56129 },
+    { 56136, 56143 },
+    { 56150, 56154 },
+    { 56158, 56168 },
+    { 56178, 56182 },
+    { 56186, 56190 },
+    { 56194, 56204 },
+    { 56214, 56218 },
+    { 56222, 56229 },
+    { 56236, 56243 },
+    { 56250, 56254 },
+    { 56258, 56265 },
+    { 56272, 56282 },
+    { 56292, 56305 },
+    { 56318, 56325 },
+    { 56332, 56339 },
+    { 56346, 56356 },
+    { 56366, 56373 },
+    { 56380, 56387 },
+    { 56394, 56401 },
+    { 56408, 56415 },
+    { 56422, 56432 },
+    { 56442, 56449 },
+    { 56456, 56463 },
+    { 56470, 56477 },
+    { 56484, 56491 },
+    { 56498, 56505 },
+    { 56512, 56519 },
+    { 56526, 56533 },
+    { 56540, 56547 },
+    { 56554, 56561 },
+    { 56568, 56575 },
+    { 56582, 56592 },
+    { 56602, 56609 },
+    { 56616, 56623 },
+    { 56630, 56637 },
+    { 56644, 56654 },
+    { 56664, 56671 },
+    { 56678, 56685 },
+    { 56692, 56699 },
+    { 56706, 56716 },
+    { 56726, 56733 },
+    { 56740, 56747 },
+    { 56754, 56761 },
+    { 56768, 56775 },
+    { 56782, 56789 },
+    { 56796, 56803 },
+    { 56810, 56817 },
+    { 56824, 56828 },
+    { 56832, 56836 },
+    { 56840, 56850 },
+    { 56860, 56867 },
+    { 56874, 56884 },
+    { 56894, 56904 },
+    { 56914, 56921 },
+    { 56928, 56938 },
+    { 56948, 56955 },
+    { 56962, 56966 },
+    { 56970, 56974 },
+    { 56978, 56982 },
+    { 56986, 56990 },
+    { 56994, 56998 },
+    { 57002, 57006 },
+    { 57010, 57017 },
+    { 57024, 57028 },
+    { 57032, 57036 },
+    { 57040, 57047 },
+    { 57054, 57061 },
+    { 57068, 57075 },
+    { 57082, 57089 },
+    { 57096, 57106 },
+    { 57116, 57120 },
+    { 57124, 57131 },
+    { 57138, 57145 },
+    { 57152, 57156 },
+    { 57160, 57170 },
+    { 57180, 57187 },
+    { 57194, 57204 },
+    { 57214, 57218 },
+    { 57222, 57226 },
+    { 57230, 57234 },
+    { 57238, 57242 },
+    { 57246, 57253 },
+    { 57260, 57267 },
+    { 57274, 57287 },
+    { 57300, 57307 },
+    { 57314, 57321 },
+    { 57328, 57335 },
+    { 57342, 57346 },
+    { 57350, 57354 },
+    { 57358, 57368 },
+    { 57378, 57382 },
+    { 57386, 57390 },
+    { 57394, 57401 },
+    { 57408, 57412 },
+    { 57416, 57420 },
+    { 57424, 57428 },
+    { 57432, 57436 },
+    { 57440, 57447 },
+    { 57454, 57464 },
+    { 57474, 57481 },
+    { 57488, 57492 },
+    { 57496, 57503 },
+    { 57510, 57517 },
+    { 57524, 57531 },
+    { 57538, 57542 },
+    { 57546, 57553 },
+    { 57560, 57567 },
+    { 57574, 57581 },
+    { 57588, 57598 },
+    { 57608, 57624 },
+    { 57640, 57644 },
+    { 57648, 57658 },
+    { 57668, 57675 },
+    { 57682, 57689 },
+    { 57696, 57706 },
+    { 57716, 57723 },
+    { 57730, 57737 },
+    { 57744, 57748 },
+    { 57752, 57756 },
+    { 57760, 57764 },
+    { 57768, 57775 },
+    { 57782, 57786 },
+    { 57790, 57794 },
+    { 57798, 57802 },
+    { 57806, 57813 },
+    { 57820, 57824 },
+    { 57828, 57832 },
+    { 57836, 57840 },
+    { 57844, 57848 },
+    { 57852, 57859 },
+    { 57866, 57876 },
+    { 57886, 57893 },
+    { 57900, 57904 },
+    { 57908, 57915 },
+    { 57922, 57929 },
+    { 57936, 57943 },
+    { 57950, 57957 },
+    { 57964, 57971 },
+    { 57978, 57985 },
+    { 57992, 57996 },
+    { 58000, 58004 },
+    { 58008, 58012 },
+    { 58016, 58023 },
+    { 58030, 58037 },
+    { 58044, 58054 },
+    { 58064, 58071 },
+    { 58078, 58088 },
+    { 58098, 58105 },
+    { 58112, 58119 },
+    { 58126, 58133 },
+    { 58140, 58147 },
+    { 58154, 58161 },
+    { 58168, 58175 },
+    { 58182, 58189 },
+    { 58196, 58206 },
+    { 58216, 58223 },
+    { 58230, 58237 },
+    { 58244, 58251 },
+    { 58258, 58265 },
+    { 58272, 58279 },
+    { 58286, 58296 },
+    { 58306, 58310 },
+    { 58314, 58321 },
+    { 58328, 58335 },
+    { 58342, 58346 },
+    { 58350, 58354 },
+    { 58358, 58362 },
+    { 58366, 58370 },
+    { 58374, 58378 },
+    { 58382, 58392 },
+    { 58402, 58406 },
+    { 58410, 58414 },
+    { 58418, 58422 },
+    { 58426, 58430 },
+    { 58434, 58438 },
+    { 58442, 58449 },
+    { 58456, 58460 },
+    { 58464, 58468 },
+    { 58472, 58476 },
+    { 58480, 58487 },
+    { 58494, 58501 },
+    { 58508, 58515 },
+    { 58522, 58535 },
+    { 58548, 58552 },
+    { 58556, 58563 },
+    { 58570, 58580 },
+    { 58590, 58603 },
+    { 58616, 58623 },
+    { 58630, 58634 },
+    { 58638, 58642 },
+    { 58646, 58653 },
+    { 58660, 58664 },
+    { 58668, 58672 },
+    { 58676, 58680 },
+    { 58684, 58688 },
+    { 58692, 58696 },
+    { 58700, 58704 },
+    { 58708, 58712 },
+    { 58716, 58720 },
+    { 58724, 58731 },
+    { 58738, 58751 },
+    { 58764, 58777 },
+    { 58790, 58797 },
+    { 58804, 58811 },
+    { 58818, 58831 },
+    { 58844, 58851 },
+    { 58858, 58865 },
+    { 58872, 58879 },
+    { 58886, 58893 },
+    { 58900, 58910 },
+    { 58920, 58927 },
+    { 58934, 58941 },
+    { 58948, 58961 },
+    { 58974, 58987 },
+    { 59000, 59004 },
+    { 59008, 59012 },
+    { 59016, 59020 },
+    { 59024, 59028 },
+    { 59032, 59039 },
+    { 59046, 59053 },
+    { 59060, 59064 },
+    { 59068, 59072 },
+    { 59076, 59083 },
+    { 59090, 59094 },
+    { 59098, 59102 },
+    { 59106, 59110 },
+    { 59114, 59121 },
+    { 59128, 59141 },
+    { 59154, 59161 },
+    { 59168, 59175 },
+    { 59182, 59195 },
+    { 59208, 59212 },
+    { 59216, 59229 },
+    { 59242, 59246 },
+    { 59250, 59257 },
+    { 59264, 59271 },
+    { 59278, 59285 },
+    { 59292, 59296 },
+    { 59300, 59313 },
+    { 59326, 59330 },
+    { 59334, 59341 },
+    { 59348, 59355 },
+    { 59362, 59366 },
+    { 59370, 59377 },
+    { 59384, 59391 },
+    { 59398, 59402 },
+    { 59406, 59410 },
+    { 59414, 59418 },
+    { 59422, 59435 },
+    { 59448, 59455 },
+    { 59462, 59466 },
+    { 59470, 59477 },
+    { 59484, 59488 },
+    { 59492, 59496 },
+    { 59500, 59507 },
+    { 59514, 59524 },
+    { 59534, 59550 },
+    { 59566, 59573 },
+    { 59580, 59587 },
+    { 59594, 59601 },
+    { 59608, 59618 },
+    { 59628, 59641 },
+    { 59654, 59664 },
+    { 59674, 59681 },
+    { 59688, 59692 },
+    { 59696, 59703 },
+    { 59710, 59717 },
+    { 59724, 59731 },
+    { 59738, 59745 },
+    { 59752, 59756 },
+    { 59760, 59773 },
+    { 59786, 59796 },
+    { 59806, 59813 },
+    { 59820, 59827 },
+    { 59834, 59838 },
+    { 59842, 59852 },
+    { 59862, 59869 },
+    { 59876, 59883 },
+    { 59890, 59897 },
+    { 59904, 59908 },
+    { 59912, 59919 },
+    { 59926, 59939 },
+    { 59952, 59962 },
+    { 59972, 59985 },
+    { 59998, 60008 },
+    { 60018, 60025 },
+    { 60032, 60039 },
+    { 60046, 60056 },
+    { 60066, 60079 },
+    { 60092, 60105 },
+    { 60118, 60128 },
+    { 60138, 60151 },
+    { 60164, 60171 },
+    { 60178, 60185 },
+    { 60192, 60199 },
+    { 60206, 60213 },
+    { 60220, 60233 },
+    { 60246, 60259 },
+    { 60272, 60279 },
+    { 60286, 60293 },
+    { 60300, 60307 },
+    { 60314, 60321 },
+    { 60328, 60335 },
+    { 60342, 60349 },
+    { 60356, 60369 },
+    { 60382, 60386 },
+    { 60390, 60397 },
+    { 60404, 60408 },
+    { 60412, 60422 },
+    { 60432, 60439 },
+    { 60446, 60453 },
+    { 60460, 60473 },
+    { 60486, 60496 },
+    { 60506, 60516 },
+    { 60526, 60530 },
+    { 60534, 60538 },
+    { 60542, 60549 },
+    { 60556, 60560 },
+    { 60564, 60571 },
+    { 60578, 60582 },
+    { 60586, 60590 },
+    { 60594, 60598 },
+    { 60602, 60606 },
+    { 60610, 60617 },
+    { 60624, 60631 },
+    { 60638, 60645 },
+    { 60652, 60662 },
+    { 60672, 60679 },
+    { 60686, 60693 },
+    { 60700, 60707 },
+    { 60714, 60721 },
+    { 60728, 60735 },
+    { 60742, 60749 },
+    { 60756, 60763 },
+    { 60770, 60774 },
+    { 60778, 60785 },
+    { 60792, 60799 },
+    { 60806, 60816 },
+    { 60826, 60836 },
+    { 60846, 60853 },
+    { 60860, 60867 },
+    { 60874, 60881 },
+    { 60888, 60895 },
+    { 60902, 60909 },
+    { 60916, 60923 },
+    { 60930, 60943 },
+    { 60956, 60963 },
+    { 60970, 60977 },
+    { 60984, 60991 },
+    { 60998, 61005 },
+    { 61012, 61019 },
+    { 61026, 61033 },
+    { 61040, 61047 },
+    { 61054, 61061 },
+    { 61068, 61072 },
+    { 61076, 61089 },
+    { 61102, 61109 },
+    { 61116, 61123 },
+    { 61130, 61140 },
+    { 61150, 61154 },
+    { 61158, 61162 },
+    { 61166, 61170 },
+    { 61174, 61178 },
+    { 61182, 61186 },
+    { 61190, 61194 },
+    { 61198, 61202 },
+    { 61206, 61210 },
+    { 61214, 61218 },
+    { 61222, 61226 },
+    { 61230, 61237 },
+    { 61244, 61251 },
+    { 61258, 61265 },
+    { 61272, 61285 },
+    { 61298, 61305 },
+    { 61312, 61322 },
+    { 61332, 61339 },
+    { 61346, 61353 },
+    { 61360, 61364 },
+    { 61368, 61375 },
+    { 61382, 61389 },
+    { 61396, 61409 },
+    { 61422, 61435 },
+    { 61448, 61452 },
+    { 61456, 61460 },
+    { 61464, 61471 },
+    { 61478, 61482 },
+    { 61486, 61490 },
+    { 61494, 61498 },
+    { 61502, 61506 },
+    { 61510, 61514 },
+    { 61518, 61528 },
+    { 61538, 61542 },
+    { 61546, 61550 },
+    { 61554, 61558 },
+    { 61562, 61566 },
+    { 61570, 61577 },
+    { 61584, 61591 },
+    { 61598, 61602 },
+    { 61606, 61610 },
+    { 61614, 61621 },
+    { 61628, 61632 },
+    { 61636, 61643 },
+    { 61650, 61657 },
+    { 61664, 61677 },
+    { 61690, 61697 },
+    { 61704, 61711 },
+    { 61718, 61725 },
+    { 61732, 61739 },
+    { 61746, 61753 },
+    { 61760, 61767 },
+    { 61774, 61781 },
+    { 61788, 61801 },
+    { 61814, 61821 },
+    { 61828, 61832 },
+    { 61836, 61846 },
+    { 61856, 61866 },
+    { 61876, 61886 },
+    { 61896, 61906 },
+    { 61916, 61926 },
+    { 61936, 61946 },
+    { 61956, 61966 },
+    { 61976, 61986 },
+    { 61996, 62003 },
+    { 62010, 62017 },
+    { 62024, 62031 },
+    { 62038, 62045 },
+    { 62052, 62059 },
+    { 62066, 62073 },
+    { 62080, 62087 },
+    { 62094, 62101 },
+    { 62108, 62115 },
+    { 62122, 62129 },
+    { 62136, 62140 },
+    { 62144, 62148 },
+    { 62152, 62156 },
+    { 62160, 62164 },
+    { 62168, 62172 },
+    { 62176, 62180 },
+    { 62184, 62188 },
+    { 62192, 62196 },
+    { 62200, 62204 },
+    { 62208, 62212 },
+    { 62216, 62220 },
+    { 62224, 62228 },
+    { 62232, 62242 },
+    { 62252, 62259 },
+    { 62266, 62273 },
+    { 62280, 62299 },
+    { 62318, 62328 },
+    { 62338, 62345 },
+    { 62352, 62359 },
+    { 62366, 62373 },
+    { 62380, 62387 },
+    { 62394, 62404 },
+    { 62414, 62427 },
+    { 62440, 62450 },
+    { 62460, 62467 },
+    { 62474, 62484 },
+    { 62494, 62501 },
+    { 62508, 62515 },
+    { 62522, 62529 },
+    { 62536, 62552 },
+    { 62568, 62578 },
+    { 62588, 62595 },
+    { 62602, 62606 },
+    { 62610, 62623 },
+    { 62636, 62643 },
+    { 62650, 62654 },
+    { 62658, 62662 },
+    { 62666, 62670 },
+    { 62674, 62678 },
+    { 62682, 62686 },
+    { 62690, 62694 },
+    { 62698, 62702 },
+    { 62706, 62710 },
+    { 62714, 62721 },
+    { 62728, 62735 },
+    { 62742, 62746 },
+    { 62750, 62763 },
+    { 62776, 62783 },
+    { 62790, 62797 },
+    { 62804, 62811 },
+    { 62818, 62825 },
+    { 62832, 62839 },
+    { 62846, 62853 },
+    { 62860, 62867 },
+    { 62874, 62881 },
+    { 62888, 62895 },
+    { 62902, 62909 },
+    { 62916, 62923 },
+    { 62930, 62937 },
+    { 62944, 62951 },
+    { 62958, 62965 },
+    { 62972, 62979 },
+    { 62986, 62993 },
+    { 63000, 63007 },
+    { 63014, 63021 },
+    { 63028, 63041 },
+    { 63054, 63061 },
+    { 63068, 63081 },
+    { 63094, 63101 },
+    { 63108, 63115 },
+    { 63122, 63132 },
+    { 63142, 63155 },
+    { 63168, 63175 },
+    { 63182, 63189 },
+    { 63196, 63203 },
+    { 63210, 63223 },
+    { 63236, 63243 },
+    { 63250, 63257 },
+    { 63264, 63271 },
+    { 63278, 63285 },
+    { 63292, 63299 },
+    { 63306, 63319 },
+    { 63332, 63339 },
+    { 63346, 63353 },
+    { 63360, 63373 },
+    { 63386, 63393 },
+    { 63400, 63407 },
+    { 63414, 63421 },
+    { 63428, 63435 },
+    { 63442, 63449 },
+    { 63456, 63463 },
+    { 63470, 63477 },
+    { 63484, 63491 },
+    { 63498, 63505 },
+    { 63512, 63519 },
+    { 63526, 63533 },
+    { 63540, 63547 },
+    { 63554, 63561 },
+    { 63568, 63575 },
+    { 63582, 63589 },
+    { 63596, 63606 },
+    { 63616, 63623 },
+    { 63630, 63637 },
+    { 63644, 63651 },
+    { 63658, 63665 },
+    { 63672, 63676 },
+    { 63680, 63684 },
+    { 63688, 63692 },
+    { 63696, 63700 },
+    { 63704, 63708 },
+    { 63712, 63719 },
+    { 63726, 63733 },
+    { 63740, 63747 },
+    { 63754, 63761 },
+    { 63768, 63772 },
+    { 63776, 63780 },
+    { 63784, 63788 },
+    { 63792, 63796 },
+    { 63800, 63804 },
+    { 63808, 63812 },
+    { 63816, 63829 },
+    { 63842, 63855 },
+    { 63868, 63872 },
+    { 63876, 63880 },
+    { 63884, 63888 },
+    { 63892, 63896 },
+    { 63900, 63904 },
+    { 63908, 63924 },
+    { 63940, 63944 },
+    { 63948, 63955 },
+    { 63962, 63969 },
+    { 63976, 63983 },
+    { 63990, 63997 },
+    { 64004, 64011 },
+    { 64018, 64025 },
+    { 64032, 64039 },
+    { 64046, 64053 },
+    { 64060, 64067 },
+    { 64074, 64078 },
+    { 64082, 64089 },
+    { 64096, 64103 },
+    { 64110, 64114 },
+    { 64118, 64122 },
+    { 64126, 64130 },
+    { 64134, 64138 },
+    { 64142, 64146 },
+    { 64150, 64163 },
+    { 64176, 64186 },
+    { 64196, 64206 },
+    { 64216, 64229 },
+    { 64242, 64249 },
+    { 64256, 64263 },
+    { 64270, 64274 },
+    { 64278, 64288 },
+    { 64298, 64305 },
+    { 64312, 64316 },
+    { 64320, 64327 },
+    { 64334, 64341 },
+    { 64348, 64355 },
+    { 64362, 64366 },
+    { 64370, 64374 },
+    { 64378, 64382 },
+    { 64386, 64396 },
+    { 64406, 64413 },
+    { 64420, 64430 },
+    { 64440, 64450 },
+    { 64460, 64467 },
+    { 64474, 64478 },
+    { 64482, 64486 },
+    { 64490, 64497 },
+    { 64504, 64514 },
+    { 64524, 64528 },
+    { 64532, 64539 },
+    { 64546, 64550 },
+    { 64554, 64558 },
+    { 64562, 64566 },
+    { 64570, 64577 },
+    { 64584, 64588 },
+    { 64592, 64599 },
+    { 64606, 64610 },
+    { 64614, 64621 },
+    { 64628, 64632 },
+    { 64636, 64640 },
+    { 64644, 64651 },
+    { 64658, 64668 },
+    { 64678, 64682 },
+    { 64686, 64696 },
+    { 64706, 64716 },
+    { 64726, 64736 },
+    { 64746, 64753 },
+    { 64760, 64767 },
+    { 64774, 64781 },
+    { 64788, 64798 },
+    { 64808, 64815 },
+    { 64822, 64826 },
+    { 64830, 64837 },
+    { 64844, 64851 },
+    { 64858, 64865 },
+    { 64872, 64879 },
+    { 64886, 64893 },
+    { 64900, 64907 },
+    { 64914, 64921 },
+    { 64928, 64935 },
+    { 64942, 64949 },
+    { 64956, 64963 },
+    { 64970, 64977 },
+    { 64984, 64994 },
+    { 65004, 65008 },
+    { 65012, 65016 },
+    { 65020, 65024 },
+    { 65028, 65032 },
+    { 65036, 65043 },
+    { 65050, 65057 },
+    { 65064, 65068 },
+    { 65072, 65076 },
+    { 65080, 65087 },
+    { 65094, 65101 },
+    { 65108, 65115 },
+    { 65122, 65129 },
+    { 65136, 65140 },
+    { 65144, 65148 },
+    { 65152, 65159 },
+    { 65166, 65170 },
+    { 65174, 65178 },
+    { 65182, 65189 },
+    { 65196, 65200 },
+    { 65204, 65217 },
+    { 65230, 65243 },
+    { 65256, 65266 },
+    { 65276, 65283 },
+    { 65290, 65300 },
+    { 65310, 65320 },
+    { 65330, 65337 },
+    { 65344, 65348 },
+    { 65352, 65359 },
+    { 65366, 65370 },
+    { 65374, 65381 },
+    { 65388, 65392 },
+    { 65396, 65400 },
+    { 65404, 65408 },
+    { 65412, 65419 },
+    { 65426, 65433 },
+    { 65440, 65450 },
+    { 65460, 65473 },
+    { 65486, 65493 },
+    { 65500, 65507 },
+    { 65514, 65521 },
+    { 65528, 65535 },
+    { 65542, 65549 },
+    { 65556, 65563 },
+    { 65570, 65577 },
+    { 65584, 65591 },
+    { 65598, 65605 },
+    { 65612, 65619 },
+    { 65626, 65633 },
+    { 65640, 65647 },
+    { 65654, 65661 },
+    { 65668, 65675 },
+    { 65682, 65695 },
+    { 65708, 65712 },
+    { 65716, 65723 },
+    { 65730, 65746 },
+    { 65762, 65766 },
+    { 65770, 65777 },
+    { 65784, 65797 },
+    { 65810, 65817 },
+    { 65824, 65834 },
+    { 65844, 65848 },
+    { 65852, 65859 },
+    { 65866, 65873 },
+    { 65880, 65884 },
+    { 65888, 65895 },
+    { 65902, 65906 },
+    { 65910, 65920 },
+    { 65930, 65937 },
+    { 65944, 65951 },
+    { 65958, 65968 },
+    { 65978, 65985 },
+    { 65992, 65996 },
+    { 66000, 66004 },
+    { 66008, 66012 },
+    { 66016, 66020 },
+    { 66024, 66028 },
+    { 66032, 66042 },
+    { 66052, 66062 },
+    { 66072, 66085 },
+    { 66098, 66108 },
+    { 66118, 66122 },
+    { 66126, 66139 },
+    { 66152, 66156 },
+    { 66160, 66164 },
+    { 66168, 66178 },
+    { 66188, 66201 },
+    { 66214, 66218 },
+    { 66222, 66226 },
+    { 66230, 66234 },
+    { 66238, 66242 },
+    { 66246, 66250 },
+    { 66254, 66261 },
+    { 66268, 66272 },
+    { 66276, 66280 },
+    { 66284, 66288 },
+    { 66292, 66296 },
+    { 66300, 66307 },
+    { 66314, 66318 },
+    { 66322, 66326 },
+    { 66330, 66334 },
+    { 66338, 66342 },
+    { 66346, 66350 },
+    { 66354, 66361 },
+    { 66368, 66372 },
+    { 66376, 66383 },
+    { 66390, 66400 },
+    { 66410, 66420 },
+    { 66430, 66437 },
+    { 66444, 66448 },
+    { 66452, 66456 },
+    { 66460, 66464 },
+    { 66468, 66472 },
+    { 66476, 66483 },
+    { 66490, 66494 },
+    { 66498, 66502 },
+    { 66506, 66519 },
+    { 66532, 66536 },
+    { 66540, 66547 },
+    { 66554, 66558 },
+    { 66562, 66569 },
+    { 66576, 66580 },
+    { 66584, 66591 },
+    { 66598, 66611 },
+    { 66624, 66637 },
+    { 66650, 66660 },
+    { 66670, 66677 },
+    { 66684, 66694 },
+    { 66704, 66714 },
+    { 66724, 66728 },
+    { 66732, 66736 },
+    { 66740, 66747 },
+    { 66754, 66758 },
+    { 66762, 66769 },
+    { 66776, 66780 },
+    { 66784, 66791 },
+    { 66798, 66802 },
+    { 66806, 66810 },
+    { 66814, 66818 },
+    { 66822, 66829 },
+    { 66836, 66840 },
+    { 66844, 66851 },
+    { 66858, 66865 },
+    { 66872, 66882 },
+    { 66892, 66902 },
+    { 66912, 66922 },
+    { 66932, 66942 },
+    { 66952, 66959 },
+    { 66966, 66976 },
+    { 66986, 66993 },
+    { 67000, 67010 },
+    { 67020, 67027 },
+    { 67034, 67044 },
+    { 67054, 67061 },
+    { 67068, 67075 },
+    { 67082, 67089 },
+    { 67096, 67100 },
+    { 67104, 67111 },
+    { 67118, 67131 },
+    { 67144, 67157 },
+    { 67170, 67180 },
+    { 67190, 67203 },
+    { 67216, 67226 },
+    { 67236, 67246 },
+    { 67256, 67266 },
+    { 67276, 67286 },
+    { 67296, 67306 },
+    { 67316, 67323 },
+    { 67330, 67343 },
+    { 67356, 67366 },
+    { 67376, 67383 },
+    { 67390, 67397 },
+    { 67404, 67408 },
+    { 67412, 67419 },
+    { 67426, 67430 },
+    { 67434, 67441 },
+    { 67448, 67455 },
+    { 67462, 67469 },
+    { 67476, 67486 },
+    { 67496, 67506 },
+    { 67516, 67526 },
+    { 67536, 67546 },
+    { 67556, 67560 },
+    { 67564, 67571 },
+    { 67578, 67585 },
+    { 67592, 67599 },
+    { 67606, 67610 },
+    { 67614, 67618 },
+    { 67622, 67626 },
+    { 67630, 67634 },
+    { 67638, 67642 },
+    { 67646, 67650 },
+    { 67654, 67658 },
+    { 67662, 67666 },
+    { 67670, 67674 },
+    { 67678, 67685 },
+    { 67692, 67699 },
+    { 67706, 67713 },
+    { 67720, 67727 },
+    { 67734, 67741 },
+    { 67748, 67752 },
+    { 67756, 67760 },
+    { 67764, 67771 },
+    { 67778, 67782 },
+    { 67786, 67790 },
+    { 67794, 67798 },
+    { 67802, 67806 },
+    { 67810, 67814 },
+    { 67818, 67825 },
+    { 67832, 67839 },
+    { 67846, 67850 },
+    { 67854, 67858 },
+    { 67862, 67866 },
+    { 67870, 67874 },
+    { 67878, 67882 },
+    { 67886, 67890 },
+    { 67894, 67898 },
+    { 67902, 67906 },
+    { 67910, 67914 },
+    { 67918, 67922 },
+    { 67926, 67939 },
+    { 67952, 67959 },
+    { 67966, 67979 },
+    { 67992, 68002 },
+    { 68012, 68019 },
+    { 68026, 68033 },
+    { 68040, 68050 },
+    { 68060, 68073 },
+    { 68086, 68093 },
+    { 68100, 68107 },
+    { 68114, 68121 },
+    { 68128, 68135 },
+    { 68142, 68152 },
+    { 68162, 68175 },
+    { 68188, 68198 },
+    { 68208, 68218 },
+    { 68228, 68235 },
+    { 68242, 68255 },
+    { 68268, 68275 },
+    { 68282, 68292 },
+    { 68302, 68312 },
+    { 68322, 68335 },
+    { 68348, 68355 },
+    { 68362, 68372 },
+    { 68382, 68392 },
+    { 68402, 68412 },
+    { 68422, 68432 },
+    { 68442, 68452 },
+    { 68462, 68472 },
+    { 68482, 68489 },
+    { 68496, 68506 },
+    { 68516, 68523 },
+    { 68530, 68543 },
+    { 68556, 68563 },
+    { 68570, 68580 },
+    { 68590, 68600 },
+    { 68610, 68623 },
+    { 68636, 68640 },
+    { 68644, 68651 },
+    { 68658, 68665 },
+    { 68672, 68679 },
+    { 68686, 68693 },
+    { 68700, 68713 },
+    { 68726, 68739 },
+    { 68752, 68756 },
+    { 68760, 68767 },
+    { 68774, 68778 },
+    { 68782, 68789 },
+    { 68796, 68803 },
+    { 68810, 68814 },
+    { 68818, 68822 },
+    { 68826, 68833 },
+    { 68840, 68847 },
+    { 68854, 68870 },
+    { 68886, 68890 },
+    { 68894, 68901 },
+    { 68908, 68915 },
+    { 68922, 68926 },
+    { 68930, 68934 },
+    { 68938, 68945 },
+    { 68952, 68959 },
+    { 68966, 68970 },
+    { 68974, 68981 },
+    { 68988, 68995 },
+    { 69002, 69009 },
+    { 69016, 69023 },
+    { 69030, 69037 },
+    { 69044, 69051 },
+    { 69058, 69065 },
+    { 69072, 69079 },
+    { 69086, 69093 },
+    { 69100, 69107 },
+    { 69114, 69124 },
+    { 69134, 69141 },
+    { 69148, 69155 },
+    { 69162, 69169 },
+    { 69176, 69183 },
+    { 69190, 69197 },
+    { 69204, 69208 },
+    { 69212, 69219 },
+    { 69226, 69236 },
+    { 69246, 69256 },
+    { 69266, 69273 },
+    { 69280, 69284 },
+    { 69288, 69292 },
+    { 69296, 69300 },
+    { 69304, 69314 },
+    { 69324, 69331 },
+    { 69338, 69345 },
+    { 69352, 69356 },
+    { 69360, 69364 },
+    { 69368, 69375 },
+    { 69382, 69389 },
+    { 69396, 69403 },
+    { 69410, 69414 },
+    { 69418, 69425 },
+    { 69432, 69442 },
+    { 69452, 69459 },
+    { 69466, 69476 },
+    { 69486, 69499 },
+    { 69512, 69519 },
+    { 69526, 69530 },
+    { 69534, 69538 },
+    { 69542, 69546 },
+    { 69550, 69554 },
+    { 69558, 69562 },
+    { 69566, 69576 },
+    { 69586, 69593 },
+    { 69600, 69610 },
+    { 69620, 69627 },
+    { 69634, 69638 },
+    { 69642, 69646 },
+    { 69650, 69654 },
+    { 69658, 69665 },
+    { 69672, 69679 },
+    { 69686, 69690 },
+    { 69694, 69698 },
+    { 69702, 69709 },
+    { 69716, 69720 },
+    { 69724, 69728 },
+    { 69732, 69736 },
+    { 69740, 69744 },
+    { 69748, 69752 },
+    { 69756, 69763 },
+    { 69770, 69777 },
+    { 69784, 69788 },
+    { 69792, 69799 },
+    { 69806, 69810 },
+    { 69814, 69818 },
+    { 69822, 69829 },
+    { 69836, 69843 },
+    { 69850, 69854 },
+    { 69858, 69862 },
+    { 69866, 69873 },
+    { 69880, 69884 },
+    { 69888, 69895 },
+    { 69902, 69909 },
+    { 69916, 69923 },
+    { 69930, 69937 },
+    { 69944, 69951 },
+    { 69958, 69965 },
+    { 69972, 69976 },
+    { 69980, 69987 },
+    { 69994, 70001 },
+    { 70008, 70015 },
+    { 70022, 70029 },
+    { 70036, 70043 },
+    { 70050, 70063 },
+    { 70076, 70083 },
+    { 70090, 70094 },
+    { 70098, 70105 },
+    { 70112, 70116 },
+    { 70120, 70124 },
+    { 70128, 70132 },
+    { 70136, 70140 },
+    { 70144, 70151 },
+    { 70158, 70171 },
+    { 70184, 70188 },
+    { 70192, 70196 },
+    { 70200, 70204 },
+    { 70208, 70215 },
+    { 70222, 70229 },
+    { 70236, 70246 },
+    { 70256, 70266 },
+    { 70276, 70286 },
+    { 70296, 70306 },
+    { 70316, 70326 },
+    { 70336, 70346 },
+    { 70356, 70366 },
+    { 70376, 70386 },
+    { 70396, 70406 },
+    { 70416, 70423 },
+    { 70430, 70437 },
+    { 70444, 70448 },
+    { 70452, 70459 },
+    { 70466, 70479 },
+    { 70492, 70496 },
+    { 70500, 70507 },
+    { 70514, 70521 },
+    { 70528, 70532 },
+    { 70536, 70546 },
+    { 70556, 70566 },
+    { 70576, 70583 },
+    { 70590, 70606 },
+    { 70622, 70629 },
+    { 70636, 70643 },
+    { 70650, 70657 },
+    { 70664, 70677 },
+    { 70690, 70694 },
+    { 70698, 70705 },
+    { 70712, 70719 },
+    { 70726, 70739 },
+    { 70752, 70759 },
+    { 70766, 70770 },
+    { 70774, 70781 },
+    { 70788, 70792 },
+    { 70796, 70803 },
+    { 70810, 70814 },
+    { 70818, 70828 },
+    { 70838, 70842 },
+    { 70846, 70850 },
+    { 70854, 70858 },
+    { 70862, 70878 },
+    { 70894, 70901 },
+    { 70908, 70915 },
+    { 70922, 70929 },
+    { 70936, 70943 },
+    { 70950, 70966 },
+    { 70982, 71001 },
+    { 71020, 71024 },
+    { 71028, 71032 },
+    { 71036, 71043 },
+    { 71050, 71063 },
+    { 71076, 71083 },
+    { 71090, 71097 },
+    { 71104, 71114 },
+    { 71124, 71131 },
+    { 71138, 71145 },
+    { 71152, 71156 },
+    { 71160, 71173 },
+    { 71186, 71190 },
+    { 71194, 71198 },
+    { 71202, 71209 },
+    { 71216, 71223 },
+    { 71230, 71243 },
+    { 71256, 71260 },
+    { 71264, 71268 },
+    { 71272, 71279 },
+    { 71286, 71296 },
+    { 71306, 71310 },
+    { 71314, 71318 },
+    { 71322, 71326 },
+    { 71330, 71337 },
+    { 71344, 71348 },
+    { 71352, 71365 },
+    { 71378, 71382 },
+    { 71386, 71393 },
+    { 71400, 71407 },
+    { 71414, 71421 },
+    { 71428, 71435 },
+    { 71442, 71455 },
+    { 71468, 71478 },
+    { 71488, 71495 },
+    { 71502, 71506 },
+    { 71510, 71514 },
+    { 71518, 71525 },
+    { 71532, 71545 },
+    { 71558, 71562 },
+    { 71566, 71573 },
+    { 71580, 71593 },
+    { 71606, 71610 },
+    { 71614, 71618 },
+    { 71622, 71626 },
+    { 71630, 71634 },
+    { 71638, 71642 },
+    { 71646, 71653 },
+    { 71660, 71667 },
+    { 71674, 71681 },
+    { 71688, 71692 },
+    { 71696, 71700 },
+    { 71704, 71708 },
+    { 71712, 71716 },
+    { 71720, 71724 },
+    { 71728, 71735 },
+    { 71742, 71749 },
+    { 71756, 71763 },
+    { 71770, 71774 },
+    { 71778, 71785 },
+    { 71792, 71799 },
+    { 71806, 71816 },
+    { 71826, 71836 },
+    { 71846, 71853 },
+    { 71860, 71867 },
+    { 71874, 71884 },
+    { 71894, 71901 },
+    { 71908, 71912 },
+    { 71916, 71920 },
+    { 71924, 71928 },
+    { 71932, 71936 },
+    { 71940, 71944 },
+    { 71948, 71952 },
+    { 71956, 71963 },
+    { 71970, 71974 },
+    { 71978, 71982 },
+    { 71986, 71990 },
+    { 71994, 71998 },
+    { 72002, 72006 },
+    { 72010, 72017 },
+    { 72024, 72028 },
+    { 72032, 72039 },
+    { 72046, 72053 },
+    { 72060, 72067 },
+    { 72074, 72081 },
+    { 72088, 72092 },
+    { 72096, 72100 },
+    { 72104, 72108 },
+    { 72112, 72122 },
+    { 72132, 72139 },
+    { 72146, 72150 },
+    { 72154, 72158 },
+    { 72162, 72166 },
+    { 72170, 72174 },
+    { 72178, 72191 },
+    { 72204, 72208 },
+    { 72212, 72219 },
+    { 72226, 72233 },
+    { 72240, 72247 },
+    { 72254, 72261 },
+    { 72268, 72275 },
+    { 72282, 72289 },
+    { 72296, 72300 },
+    { 72304, 72308 },
+    { 72312, 72325 },
+    { 72338, 72345 },
+    { 72352, 72362 },
+    { 72372, 72382 },
+    { 72392, 72402 },
+    { 72412, 72425 },
+    { 72438, 72448 },
+    { 72458, 72468 },
+    { 72478, 72488 },
+    { 72498, 72505 },
+    { 72512, 72519 },
+    { 72526, 72539 },
+    { 72552, 72562 },
+    { 72572, 72579 },
+    { 72586, 72593 },
+    { 72600, 72607 },
+    { 72614, 72621 },
+    { 72628, 72635 },
+    { 72642, 72649 },
+    { 72656, 72663 },
+    { 72670, 72677 },
+    { 72684, 72691 },
+    { 72698, 72705 },
+    { 72712, 72719 },
+    { 72726, 72733 },
+    { 72740, 72747 },
+    { 72754, 72761 },
+    { 72768, 72775 },
+    { 72782, 72789 },
+    { 72796, 72803 },
+    { 72810, 72820 },
+    { 72830, 72843 },
+    { 72856, 72863 },
+    { 72870, 72880 },
+    { 72890, 72897 },
+    { 72904, 72911 },
+    { 72918, 72925 },
+    { 72932, 72942 },
+    { 72952, 72956 },
+    { 72960, 72967 },
+    { 72974, 72987 },
+    { 73000, 73007 },
+    { 73014, 73021 },
+    { 73028, 73035 },
+    { 73042, 73055 },
+    { 73068, 73075 },
+    { 73082, 73089 },
+    { 73096, 73100 },
+    { 73104, 73111 },
+    { 73118, 73125 },
+    { 73132, 73136 },
+    { 73140, 73144 },
+    { 73148, 73155 },
+    { 73162, 73169 },
+    { 73176, 73183 },
+    { 73190, 73194 },
+    { 73198, 73205 },
+    { 73212, 73225 },
+    { 73238, 73251 },
+    { 73264, 73271 },
+    { 73278, 73282 },
+    { 73286, 73290 },
+    { 73294, 73301 },
+    { 73308, 73315 },
+    { 73322, 73329 },
+    { 73336, 73340 },
+    { 73344, 73348 },
+    { 73352, 73356 },
+    { 73360, 73364 },
+    { 73368, 73372 },
+    { 73376, 73380 },
+    { 73384, 73391 },
+    { 73398, 73408 },
+    { 73418, 73422 },
+    { 73426, 73430 },
+    { 73434, 73438 },
+    { 73442, 73446 },
+    { 73450, 73457 },
+    { 73464, 73468 },
+    { 73472, 73476 },
+    { 73480, 73484 },
+    { 73488, 73495 },
+    { 73502, 73506 },
+    { 73510, 73517 },
+    { 73524, 73528 },
+    { 73532, 73539 },
+    { 73546, 73550 },
+    { 73554, 73558 },
+    { 73562, 73566 },
+    { 73570, 73577 },
+    { 73584, 73588 },
+    { 73592, 73596 },
+    { 73600, 73604 },
+    { 73608, 73612 },
+    { 73616, 73620 },
+    { 73624, 73634 },
+    { 73644, 73648 },
+    { 73652, 73656 },
+    { 73660, 73664 },
+    { 73668, 73672 },
+    { 73676, 73680 },
+    { 73684, 73691 },
+    { 73698, 73702 },
+    { 73706, 73710 },
+    { 73714, 73727 },
+    { 73740, 73750 },
+    { 73760, 73767 },
+    { 73774, 73781 },
+    { 73788, 73792 },
+    { 73796, 73800 },
+    { 73804, 73808 },
+    { 73812, 73816 },
+    { 73820, 73824 },
+    { 73828, 73832 },
+    { 73836, 73840 },
+    { 73844, 73848 },
+    { 73852, 73856 },
+    { 73860, 73870 },
+    { 73880, 73890 },
+    { 73900, 73904 },
+    { 73908, 73912 },
+    { 73916, 73923 },
+    { 73930, 73934 },
+    { 73938, 73942 },
+    { 73946, 73953 },
+    { 73960, 73973 },
+    { 73986, 73993 },
+    { 74000, 74007 },
+    { 74014, 74021 },
+    { 74028, 74032 },
+    { 74036, 74043 },
+    { 74050, 74054 },
+    { 74058, 74062 },
+    { 74066, 74073 },
+    { 74080, 74084 },
+    { 74088, 74092 },
+    { 74096, 74100 },
+    { 74104, 74108 },
+    { 74112, 74122 },
+    { 74132, 74136 },
+    { 74140, 74144 },
+    { 74148, 74155 },
+    { 74162, 74166 },
+    { 74170, 74174 },
+    { 74178, 74182 },
+    { 74186, 74190 },
+    { 74194, 74198 },
+    { 74202, 74206 },
+    { 74210, 74217 },
+    { 74224, 74228 },
+    { 74232, 74236 },
+    { 74240, 74244 },
+    { 74248, 74252 },
+    { 74256, 74260 },
+    { 74264, 74271 },
+    { 74278, 74282 },
+    { 74286, 74290 },
+    { 74294, 74298 },
+    { 74302, 74306 },
+    { 74310, 74314 },
+    { 74318, 74322 },
+    { 74326, 74330 },
+    { 74334, 74338 },
+    { 74342, 74346 },
+    { 74350, 74357 },
+    { 74364, 74374 },
+    { 74384, 74388 },
+    { 74392, 74396 },
+    { 74400, 74404 },
+    { 74408, 74421 },
+    { 74434, 74438 },
+    { 74442, 74446 },
+    { 74450, 74454 },
+    { 74458, 74462 },
+    { 74466, 74476 },
+    { 74486, 74490 },
+    { 74494, 74498 },
+    { 74502, 74509 },
+    { 74516, 74520 },
+    { 74524, 74531 },
+    { 74538, 74542 },
+    { 74546, 74550 },
+    { 74554, 74558 },
+    { 74562, 74566 },
+    { 74570, 74574 },
+    { 74578, 74582 },
+    { 74586, 74590 },
+    { 74594, 74598 },
+    { 74602, 74606 },
+    { 74610, 74614 },
+    { 74618, 74625 },
+    { 74632, 74636 },
+    { 74640, 74644 },
+    { 74648, 74652 },
+    { 74656, 74660 },
+    { 74664, 74668 },
+    { 74672, 74676 },
+    { 74680, 74684 },
+    { 74688, 74692 },
+    { 74696, 74703 },
+    { 74710, 74717 },
+    { 74724, 74728 },
+    { 74732, 74736 },
+    { 74740, 74744 },
+    { 74748, 74755 },
+    { 74762, 74772 },
+    { 74782, 74792 },
+    { 74802, 74809 },
+    { 74816, 74823 },
+    { 74830, 74834 },
+    { 74838, 74842 },
+    { 74846, 74850 },
+    { 74854, 74858 },
+    { 74862, 74866 },
+    { 74870, 74874 },
+    { 74878, 74885 },
+    { 74892, 74896 },
+    { 74900, 74907 },
+    { 74914, 74921 },
+    { 74928, 74932 },
+    { 74936, 74940 },
+    { 74944, 74951 },
+    { 74958, 74962 },
+    { 74966, 74970 },
+    { 74974, 74978 },
+    { 74982, 74986 },
+    { 74990, 74994 },
+    { 74998, 75002 },
+    { 75006, 75010 },
+    { 75014, 75018 },
+    { 75022, 75026 },
+    { 75030, 75037 },
+    { 75044, 75054 },
+    { 75064, 75068 },
+    { 75072, 75076 },
+    { 75080, 75084 },
+    { 75088, 75092 },
+    { 75096, 75100 },
+    { 75104, 75108 },
+    { 75112, 75116 },
+    { 75120, 75124 },
+    { 75128, 75132 },
+    { 75136, 75140 },
+    { 75144, 75148 },
+    { 75152, 75156 },
+    { 75160, 75164 },
+    { 75168, 75172 },
+    { 75176, 75183 },
+    { 75190, 75197 },
+    { 75204, 75214 },
+    { 75224, 75234 },
+    { 75244, 75251 },
+    { 75258, 75262 },
+    { 75266, 75276 },
+    { 75286, 75299 },
+    { 75312, 75325 },
+    { 75338, 75342 },
+    { 75346, 75350 },
+    { 75354, 75367 },
+    { 75380, 75384 },
+    { 75388, 75392 },
+    { 75396, 75403 },
+    { 75410, 75417 },
+    { 75424, 75434 },
+    { 75444, 75454 },
+    { 75464, 75474 },
+    { 75484, 75494 },
+    { 75504, 75517 },
+    { 75530, 75540 },
+    { 75550, 75563 },
+    { 75576, 75580 },
+    { 75584, 75588 },
+    { 75592, 75599 },
+    { 75606, 75613 },
+    { 75620, 75627 },
+    { 75634, 75638 },
+    { 75642, 75649 },
+    { 75656, 75663 },
+    { 75670, 75677 },
+    { 75684, 75691 },
+    { 75698, 75705 },
+    { 75712, 75719 },
+    { 75726, 75736 },
+    { 75746, 75753 },
+    { 75760, 75770 },
+    { 75780, 75790 },
+    { 75800, 75807 },
+    { 75814, 75827 },
+    { 75840, 75847 },
+    { 75854, 75861 },
+    { 75868, 75872 },
+    { 75876, 75883 },
+    { 75890, 75903 },
+    { 75916, 75920 },
+    { 75924, 75928 },
+    { 75932, 75936 },
+    { 75940, 75953 },
+    { 75966, 75970 },
+    { 75974, 75978 },
+    { 75982, 75986 },
+    { 75990, 75994 },
+    { 75998, 76005 },
+    { 76012, 76019 },
+    { 76026, 76039 },
+    { 76052, 76056 },
+    { 76060, 76064 },
+    { 76068, 76072 },
+    { 76076, 76086 },
+    { 76096, 76103 },
+    { 76110, 76117 },
+    { 76124, 76131 },
+    { 76138, 76148 },
+    { 76158, 76165 },
+    { 76172, 76179 },
+    { 76186, 76193 },
+    { 76200, 76207 },
+    { 76214, 76218 },
+    { 76222, 76229 },
+    { 76236, 76243 },
+    { 76250, 76254 },
+    { 76258, 76262 },
+    { 76266, 76270 },
+    { 76274, 76281 },
+    { 76288, 76295 },
+    { 76302, 76306 },
+    { 76310, 76317 },
+    { 76324, 76328 },
+    { 76332, 76336 },
+    { 76340, 76344 },
+    { 76348, 76355 },
+    { 76362, 76369 },
+    { 76376, 76380 },
+    { 76384, 76394 },
+    { 76404, 76411 },
+    { 76418, 76422 },
+    { 76426, 76433 },
+    { 76440, 76447 },
+    { 76454, 76464 },
+    { 76474, 76484 },
+    { 76494, 76501 },
+    { 76508, 76515 },
+    { 76522, 76535 },
+    { 76548, 76555 },
+    { 76562, 76569 },
+    { 76576, 76583 },
+    { 76590, 76594 },
+    { 76598, 76602 },
+    { 76606, 76610 },
+    { 76614, 76621 },
+    { 76628, 76632 },
+    { 76636, 76643 },
+    { 76650, 76657 },
+    { 76664, 76674 },
+    { 76684, 76694 },
+    { 76704, 76708 },
+    { 76712, 76719 },
+    { 76726, 76733 },
+    { 76740, 76744 },
+    { 76748, 76752 },
+    { 76756, 76763 },
+    { 76770, 76777 },
+    { 76784, 76791 },
+    { 76798, 76802 },
+    { 76806, 76810 },
+    { 76814, 76821 },
+    { 76828, 76832 },
+    { 76836, 76840 },
+    { 76844, 76848 },
+    { 76852, 76859 },
+    { 76866, 76870 },
+    { 76874, 76881 },
+    { 76888, 76898 },
+    { 76908, 76912 },
+    { 76916, 76920 },
+    { 76924, 76931 },
+    { 76938, 76945 },
+    { 76952, 76956 },
+    { 76960, 76967 },
+    { 76974, 76978 },
+    { 76982, 76989 },
+    { 76996, 77003 },
+    { 77010, 77017 },
+    { 77024, 77031 },
+    { 77038, 77045 },
+    { 77052, 77056 },
+    { 77060, 77067 },
+    { 77074, 77078 },
+    { 77082, 77086 },
+    { 77090, 77094 },
+    { 77098, 77102 },
+    { 77106, 77113 },
+    { 77120, 77130 },
+    { 77140, 77147 },
+    { 77154, 77158 },
+    { 77162, 77169 },
+    { 77176, 77183 },
+    { 77190, 77200 },
+    { 77210, 77217 },
+    { 77224, 77237 },
+    { 77250, 77257 },
+    { 77264, 77277 },
+    { 77290, 77297 },
+    { 77304, 77314 },
+    { 77324, 77337 },
+    { 77350, 77360 },
+    { 77370, 77383 },
+    { 77396, 77409 },
+    { 77422, 77429 },
+    { 77436, 77443 },
+    { 77450, 77454 },
+    { 77458, 77471 },
+    { 77484, 77494 },
+    { 77504, 77511 },
+    { 77518, 77525 },
+    { 77532, 77539 },
+    { 77546, 77553 },
+    { 77560, 77567 },
+    { 77574, 77587 },
+    { 77600, 77607 },
+    { 77614, 77627 },
+    { 77640, 77653 },
+    { 77666, 77679 },
+    { 77692, 77705 },
+    { 77718, 77731 },
+    { 77744, 77751 },
+    { 77758, 77765 },
+    { 77772, 77785 },
+    { 77798, 77811 },
+    { 77824, 77837 },
+    { 77850, 77857 },
+    { 77864, 77877 },
+    { 77890, 77897 },
+    { 77904, 77917 },
+    { 77930, 77943 },
+    { 77956, 77963 },
+    { 77970, 77983 },
+    { 77996, 78000 },
+    { 78004, 78014 },
+    { 78024, 78037 },
+    { 78050, 78054 },
+    { 78058, 78065 },
+    { 78072, 78076 },
+    { 78080, 78087 },
+    { 78094, 78101 },
+    { 78108, 78112 },
+    { 78116, 78120 },
+    { 78124, 78131 },
+    { 78138, 78148 },
+    { 78158, 78162 },
+    { 78166, 78173 },
+    { 78180, 78184 },
+    { 78188, 78192 },
+    { 78196, 78203 },
+    { 78210, 78217 },
+    { 78224, 78234 },
+    { 78244, 78248 },
+    { 78252, 78262 },
+    { 78272, 78276 },
+    { 78280, 78284 },
+    { 78288, 78292 },
+    { 78296, 78309 },
+    { 78322, 78329 },
+    { 78336, 78346 },
+    { 78356, 78363 },
+    { 78370, 78383 },
+    { 78396, 78403 },
+    { 78410, 78423 },
+    { 78436, 78443 },
+    { 78450, 78454 },
+    { 78458, 78462 },
+    { 78466, 78470 },
+    { 78474, 78478 },
+    { 78482, 78486 },
+    { 78490, 78494 },
+    { 78498, 78505 },
+    { 78512, 78519 },
+    { 78526, 78533 },
+    { 78540, 78544 },
+    { 78548, 78552 },
+    { 78556, 78563 },
+    { 78570, 78577 },
+    { 78584, 78591 },
+    { 78598, 78605 },
+    { 78612, 78619 },
+    { 78626, 78633 },
+    { 78640, 78644 },
+    { 78648, 78655 },
+    { 78662, 78669 },
+    { 78676, 78686 },
+    { 78696, 78703 },
+    { 78710, 78717 },
+    { 78724, 78734 },
+    { 78744, 78754 },
+    { 78764, 78771 },
+    { 78778, 78785 },
+    { 78792, 78799 },
+    { 78806, 78813 },
+    { 78820, 78827 },
+    { 78834, 78847 },
+    { 78860, 78867 },
+    { 78874, 78881 },
+    { 78888, 78898 },
+    { 78908, 78915 },
+    { 78922, 78929 },
+    { 78936, 78946 },
+    { 78956, 78963 },
+    { 78970, 78980 },
+    { 78990, 78994 },
+    { 78998, 79005 },
+    { 79012, 79016 },
+    { 79020, 79024 },
+    { 79028, 79032 },
+    { 79036, 79040 },
+    { 79044, 79048 },
+    { 79052, 79059 },
+    { 79066, 79073 },
+    { 79080, 79084 },
+    { 79088, 79098 },
+    { 79108, 79115 },
+    { 79122, 79126 },
+    { 79130, 79137 },
+    { 79144, 79148 },
+    { 79152, 79156 },
+    { 79160, 79164 },
+    { 79168, 79172 },
+    { 79176, 79186 },
+    { 79196, 79200 },
+    { 79204, 79208 },
+    { 79212, 79216 },
+    { 79220, 79227 },
+    { 79234, 79241 },
+    { 79248, 79255 },
+    { 79262, 79269 },
+    { 79276, 79283 },
+    { 79290, 79303 },
+    { 79316, 79323 },
+    { 79330, 79343 },
+    { 79356, 79363 },
+    { 79370, 79377 },
+    { 79384, 79391 },
+    { 79398, 79405 },
+    { 79412, 79419 },
+    { 79426, 79433 },
+    { 79440, 79444 },
+    { 79448, 79452 },
+    { 79456, 79460 },
+    { 79464, 79468 },
+    { 79472, 79479 },
+    { 79486, 79490 },
+    { 79494, 79501 },
+    { 79508, 79512 },
+    { 79516, 79520 },
+    { 79524, 79528 },
+    { 79532, 79536 },
+    { 79540, 79544 },
+    { 79548, 79552 },
+    { 79556, 79563 },
+    { 79570, 79580 },
+    { 79590, 79600 },
+    { 79610, 79614 },
+    { 79618, 79625 },
+    { 79632, 79639 },
+    { 79646, 79650 },
+    { 79654, 79658 },
+    { 79662, 79666 },
+    { 79670, 79674 },
+    { 79678, 79682 },
+    { 79686, 79690 },
+    { 79694, 79707 },
+    { 79720, 79724 },
+    { 79728, 79732 },
+    { 79736, 79740 },
+    { 79744, 79748 },
+    { 79752, 79759 },
+    { 79766, 79773 },
+    { 79780, 79787 },
+    { 79794, 79801 },
+    { 79808, 79818 },
+    { 79828, 79838 },
+    { 79848, 79852 },
+    { 79856, 79863 },
+    { 79870, 79880 },
+    { 79890, 79894 },
+    { 79898, 79902 },
+    { 79906, 79913 },
+    { 79920, 79924 },
+    { 79928, 79935 },
+    { 79942, 79946 },
+    { 79950, 79957 },
+    { 79964, 79968 },
+    { 79972, 79979 },
+    { 79986, 79996 },
+    { 80006, 80016 },
+    { 80026, 80039 },
+    { 80052, 80056 },
+    { 80060, 80067 },
+    { 80074, 80078 },
+    { 80082, 80086 },
+    { 80090, 80094 },
+    { 80098, 80102 },
+    { 80106, 80113 },
+    { 80120, 80130 },
+    { 80140, 80153 },
+    { 80166, 80176 },
+    { 80186, 80193 },
+    { 80200, 80207 },
+    { 80214, 80221 },
+    { 80228, 80235 },
+    { 80242, 80249 },
+    { 80256, 80269 },
+    { 80282, 80289 },
+    { 80296, 80306 },
+    { 80316, 80323 },
+    { 80330, 80337 },
+    { 80344, 80351 },
+    { 80358, 80365 },
+    { 80372, 80379 },
+    { 80386, 80393 },
+    { 80400, 80407 },
+    { 80414, 80421 },
+    { 80428, 80435 },
+    { 80442, 80449 },
+    { 80456, 80460 },
+    { 80464, 80471 },
+    { 80478, 80482 },
+    { 80486, 80490 },
+    { 80494, 80498 },
+    { 80502, 80506 },
+    { 80510, 80514 },
+    { 80518, 80525 },
+    { 80532, 80539 },
+    { 80546, 80556 },
+    { 80566, 80570 },
+    { 80574, 80578 },
+    { 80582, 80586 },
+    { 80590, 80594 },
+    { 80598, 80602 },
+    { 80606, 80610 },
+    { 80614, 80618 },
+    { 80622, 80629 },
+    { 80636, 80643 },
+    { 80650, 80657 },
+    { 80664, 80671 },
+    { 80678, 80682 },
+    { 80686, 80693 },
+    { 80700, 80710 },
+    { 80720, 80733 },
+    { 80746, 80750 },
+    { 80754, 80761 },
+    { 80768, 80775 },
+    { 80782, 80786 },
+    { 80790, 80797 },
+    { 80804, 80811 },
+    { 80818, 80822 },
+    { 80826, 80830 },
+    { 80834, 80838 },
+    { 80842, 80849 },
+    { 80856, 80860 },
+    { 80864, 80868 },
+    { 80872, 80885 },
+    { 80898, 80902 },
+    { 80906, 80910 },
+    { 80914, 80921 },
+    { 80928, 80932 },
+    { 80936, 80940 },
+    { 80944, 80948 },
+    { 80952, 80959 },
+    { 80966, 80970 },
+    { 80974, 80987 },
+    { 81000, 81004 },
+    { 81008, 81012 },
+    { 81016, 81029 },
+    { 81042, 81046 },
+    { 81050, 81060 },
+    { 81070, 81074 },
+    { 81078, 81082 },
+    { 81086, 81093 },
+    { 81100, 81104 },
+    { 81108, 81115 },
+    { 81122, 81126 },
+    { 81130, 81134 },
+    { 81138, 81142 },
+    { 81146, 81150 },
+    { 81154, 81158 },
+    { 81162, 81169 },
+    { 81176, 81183 },
+    { 81190, 81194 },
+    { 81198, 81202 },
+    { 81206, 81219 },
+    { 81232, 81236 },
+    { 81240, 81244 },
+    { 81248, 81252 },
+    { 81256, 81260 },
+    { 81264, 81268 },
+    { 81272, 81279 },
+    { 81286, 81290 },
+    { 81294, 81298 },
+    { 81302, 81309 },
+    { 81316, 81320 },
+    { 81324, 81331 },
+    { 81338, 81348 },
+    { 81358, 81371 },
+    { 81384, 81391 },
+    { 81398, 81411 },
+    { 81424, 81428 },
+    { 81432, 81439 },
+    { 81446, 81450 },
+    { 81454, 81461 },
+    { 81468, 81475 },
+    { 81482, 81489 },
+    { 81496, 81503 },
+    { 81510, 81517 },
+    { 81524, 81531 },
+    { 81538, 81545 },
+    { 81552, 81559 },
+    { 81566, 81573 },
+    { 81580, 81587 },
+    { 81594, 81604 },
+    { 81614, 81621 },
+    { 81628, 81635 },
+    { 81642, 81649 },
+    { 81656, 81660 },
+    { 81664, 81671 },
+    { 81678, 81682 },
+    { 81686, 81690 },
+    { 81694, 81698 },
+    { 81702, 81709 },
+    { 81716, 81723 },
+    { 81730, 81737 },
+    { 81744, 81751 },
+    { 81758, 81762 },
+    { 81766, 81779 },
+    { 81792, 81805 },
+    { 81818, 81831 },
+    { 81844, 81857 },
+    { 81870, 81883 },
+    { 81896, 81903 },
+    { 81910, 81920 },
+    { 81930, 81940 },
+    { 81950, 81957 },
+    { 81964, 81968 },
+    { 81972, 81979 },
+    { 81986, 81993 },
+    { 82000, 82004 },
+    { 82008, 82015 },
+    { 82022, 82026 },
+    { 82030, 82034 },
+    { 82038, 82042 },
+    { 82046, 82050 },
+    { 82054, 82058 },
+    { 82062, 82069 },
+    { 82076, 82080 },
+    { 82084, 82088 },
+    { 82092, 82099 },
+    { 82106, 82116 },
+    { 82126, 82136 },
+    { 82146, 82156 },
+    { 82166, 82176 },
+    { 82186, 82196 },
+    { 82206, 82213 },
+    { 82220, 82227 },
+    { 82234, 82241 },
+    { 82248, 82255 },
+    { 82262, 82266 },
+    { 82270, 82283 },
+    { 82296, 82309 },
+    { 82322, 82335 },
+    { 82348, 82352 },
+    { 82356, 82363 },
+    { 82370, 82374 },
+    { 82378, 82385 },
+    { 82392, 82396 },
+    { 82400, 82404 },
+    { 82408, 82412 },
+    { 82416, 82420 },
+    { 82424, 82428 },
+    { 82432, 82436 },
+    { 82440, 82444 },
+    { 82448, 82452 },
+    { 82456, 82460 },
+    { 82464, 82468 },
+    { 82472, 82476 },
+    { 82480, 82484 },
+    { 82488, 82495 },
+    { 82502, 82512 },
+    { 82522, 82532 },
+    { 82542, 82549 },
+    { 82556, 82560 },
+    { 82564, 82577 },
+    { 82590, 82600 },
+    { 82610, 82617 },
+    { 82624, 82628 },
+    { 82632, 82639 },
+    { 82646, 82650 },
+    { 82654, 82661 },
+    { 82668, 82672 },
+    { 82676, 82680 },
+    { 82684, 82691 },
+    { 82698, 82708 },
+    { 82718, 82728 },
+    { 82738, 82748 },
+    { 82758, 82765 },
+    { 82772, 82776 },
+    { 82780, 82787 },
+    { 82794, 82804 },
+    { 82814, 82818 },
+    { 82822, 82829 },
+    { 82836, 82840 },
+    { 82844, 82848 },
+    { 82852, 82859 },
+    { 82866, 82870 },
+    { 82874, 82878 },
+    { 82882, 82886 },
+    { 82890, 82894 },
+    { 82898, 82902 },
+    { 82906, 82910 },
+    { 82914, 82918 },
+    { 82922, 82926 },
+    { 82930, 82934 },
+    { 82938, 82942 },
+    { 82946, 82950 },
+    { 82954, 82958 },
+    { 82962, 82966 },
+    { 82970, 82974 },
+    { 82978, 82982 },
+    { 82986, 82990 },
+    { 82994, 82998 },
+    { 83002, 83006 },
+    { 83010, 83023 },
+    { 83036, 83040 },
+    { 83044, 83048 },
+    { 83052, 83062 },
+    { 83072, 83076 },
+    { 83080, 83084 },
+    { 83088, 83092 },
+    { 83096, 83100 },
+    { 83104, 83108 },
+    { 83112, 83116 },
+    { 83120, 83127 },
+    { 83134, 83138 },
+    { 83142, 83146 },
+    { 83150, 83154 },
+    { 83158, 83168 },
+    { 83178, 83185 },
+    { 83192, 83199 },
+    { 83206, 83210 },
+    { 83214, 83218 },
+    { 83222, 83226 },
+    { 83230, 83234 },
+    { 83238, 83242 },
+    { 83246, 83250 },
+    { 83254, 83258 },
+    { 83262, 83266 },
+    { 83270, 83277 },
+    { 83284, 83291 },
+    { 83298, 83305 },
+    { 83312, 83316 },
+    { 83320, 83324 },
+    { 83328, 83332 },
+    { 83336, 83343 },
+    { 83350, 83360 },
+    { 83370, 83377 },
+    { 83384, 83388 },
+    { 83392, 83396 },
+    { 83400, 83404 },
+    { 83408, 83415 },
+    { 83422, 83426 },
+    { 83430, 83437 },
+    { 83444, 83448 },
+    { 83452, 83456 },
+    { 83460, 83467 },
+    { 83474, 83481 },
+    { 83488, 83495 },
+    { 83502, 83509 },
+    { 83516, 83520 },
+    { 83524, 83528 },
+    { 83532, 83536 },
+    { 83540, 83547 },
+    { 83554, 83561 },
+    { 83568, 83572 },
+    { 83576, 83580 },
+    { 83584, 83588 },
+    { 83592, 83605 },
+    { 83618, 83622 },
+    { 83626, 83630 },
+    { 83634, 83638 },
+    { 83642, 83646 },
+    { 83650, 83654 },
+    { 83658, 83662 },
+    { 83666, 83670 },
+    { 83674, 83678 },
+    { 83682, 83689 },
+    { 83696, 83700 },
+    { 83704, 83717 },
+    { 83730, 83737 },
+    { 83744, 83748 },
+    { 83752, 83756 },
+    { 83760, 83764 },
+    { 83768, 83772 },
+    { 83776, 83780 },
+    { 83784, 83791 },
+    { 83798, 83802 },
+    { 83806, 83813 },
+    { 83820, 83830 },
+    { 83840, 83847 },
+    { 83854, 83864 },
+    { 83874, 83881 },
+    { 83888, 83892 },
+    { 83896, 83900 },
+    { 83904, 83908 },
+    { 83912, 83916 },
+    { 83920, 83927 },
+    { 83934, 83938 },
+    { 83942, 83946 },
+    { 83950, 83954 },
+    { 83958, 83968 },
+    { 83978, 83982 },
+    { 83986, 83990 },
+    { 83994, 83998 },
+    { 84002, 84015 },
+    { 84028, 84035 },
+    { 84042, 84046 },
+    { 84050, 84057 },
+    { 84064, 84068 },
+    { 84072, 84076 },
+    { 84080, 84084 },
+    { 84088, 84092 },
+    { 84096, 84100 },
+    { 84104, 84108 },
+    { 84112, 84119 },
+    { 84126, 84133 },
+    { 84140, 84144 },
+    { 84148, 84152 },
+    { 84156, 84160 },
+    { 84164, 84174 },
+    { 84184, 84188 },
+    { 84192, 84196 },
+    { 84200, 84207 },
+    { 84214, 84221 },
+    { 84228, 84235 },
+    { 84242, 84252 },
+    { 84262, 84266 },
+    { 84270, 84274 },
+    { 84278, 84282 },
+    { 84286, 84290 },
+    { 84294, 84298 },
+    { 84302, 84309 },
+    { 84316, 84320 },
+    { 84324, 84328 },
+    { 84332, 84339 },
+    { 84346, 84350 },
+    { 84354, 84358 },
+    { 84362, 84366 },
+    { 84370, 84374 },
+    { 84378, 84382 },
+    { 84386, 84390 },
+    { 84394, 84398 },
+    { 84402, 84406 },
+    { 84410, 84414 },
+    { 84418, 84422 },
+    { 84426, 84430 },
+    { 84434, 84438 },
+    { 84442, 84446 },
+    { 84450, 84454 },
+    { 84458, 84462 },
+    { 84466, 84470 },
+    { 84474, 84478 },
+    { 84482, 84486 },
+    { 84490, 84494 },
+    { 84498, 84502 },
+    { 84506, 84510 },
+    { 84514, 84518 },
+    { 84522, 84532 },
+    { 84542, 84549 },
+    { 84556, 84560 },
+    { 84564, 84568 },
+    { 84572, 84576 },
+    { 84580, 84584 },
+    { 84588, 84592 },
+    { 84596, 84600 },
+    { 84604, 84611 },
+    { 84618, 84622 },
+    { 84626, 84630 },
+    { 84634, 84638 },
+    { 84642, 84646 },
+    { 84650, 84657 },
+    { 84664, 84677 },
+    { 84690, 84694 },
+    { 84698, 84702 },
+    { 84706, 84710 },
+    { 84714, 84718 },
+    { 84722, 84726 },
+    { 84730, 84734 },
+    { 84738, 84742 },
+    { 84746, 84750 },
+    { 84754, 84758 },
+    { 84762, 84766 },
+    { 84770, 84777 },
+    { 84784, 84791 },
+    { 84798, 84811 },
+    { 84824, 84831 },
+    { 84838, 84845 },
+    { 84852, 84862 },
+    { 84872, 84879 },
+    { 84886, 84893 },
+    { 84900, 84907 },
+    { 84914, 84921 },
+    { 84928, 84935 },
+    { 84942, 84949 },
+    { 84956, 84963 },
+    { 84970, 84977 },
+    { 84984, 84991 },
+    { 84998, 85005 },
+    { 85012, 85019 },
+    { 85026, 85033 },
+    { 85040, 85047 },
+    { 85054, 85061 },
+    { 85068, 85075 },
+    { 85082, 85089 },
+    { 85096, 85103 },
+    { 85110, 85117 },
+    { 85124, 85137 },
+    { 85150, 85163 },
+    { 85176, 85183 },
+    { 85190, 85197 },
+    { 85204, 85211 },
+    { 85218, 85228 },
+    { 85238, 85245 },
+    { 85252, 85256 },
+    { 85260, 85264 },
+    { 85268, 85272 },
+    { 85276, 85280 },
+    { 85284, 85288 },
+    { 85292, 85296 },
+    { 85300, 85304 },
+    { 85308, 85315 },
+    { 85322, 85326 },
+    { 85330, 85334 },
+    { 85338, 85342 },
+    { 85346, 85350 },
+    { 85354, 85364 },
+    { 85374, 85381 },
+    { 85388, 85392 },
+    { 85396, 85400 },
+    { 85404, 85411 },
+    { 85418, 85422 },
+    { 85426, 85430 },
+    { 85434, 85438 },
+    { 85442, 85452 },
+    { 85462, 85469 },
+    { 85476, 85480 },
+    { 85484, 85488 },
+    { 85492, 85496 },
+    { 85500, 85504 },
+    { 85508, 85512 },
+    { 85516, 85520 },
+    { 85524, 85528 },
+    { 85532, 85536 },
+    { 85540, 85547 },
+    { 85554, 85561 },
+    { 85568, 85575 },
+    { 85582, 85586 },
+    { 85590, 85594 },
+    { 85598, 85602 },
+    { 85606, 85610 },
+    { 85614, 85624 },
+    { 85634, 85638 },
+    { 85642, 85646 },
+    { 85650, 85657 },
+    { 85664, 85668 },
+    { 85672, 85676 },
+    { 85680, 85684 },
+    { 85688, 85695 },
+    { 85702, 85706 },
+    { 85710, 85714 },
+    { 85718, 85722 },
+    { 85726, 85730 },
+    { 85734, 85738 },
+    { 85742, 85746 },
+    { 85750, 85754 },
+    { 85758, 85762 },
+    { 85766, 85770 },
+    { 85774, 85778 },
+    { 85782, 85789 },
+    { 85796, 85800 },
+    { 85804, 85808 },
+    { 85812, 85816 },
+    { 85820, 85827 },
+    { 85834, 85838 },
+    { 85842, 85849 },
+    { 85856, 85863 },
+    { 85870, 85877 },
+    { 85884, 85888 },
+    { 85892, 85896 },
+    { 85900, 85904 },
+    { 85908, 85915 },
+    { 85922, 85926 },
+    { 85930, 85934 },
+    { 85938, 85942 },
+    { 85946, 85950 },
+    { 85954, 85958 },
+    { 85962, 85966 },
+    { 85970, 85974 },
+    { 85978, 85982 },
+    { 85986, 85990 },
+    { 85994, 85998 },
+    { 86002, 86006 },
+    { 86010, 86014 },
+    { 86018, 86028 },
+    { 86038, 86051 },
+    { 86064, 86071 },
+    { 86078, 86085 },
+    { 86092, 86099 },
+    { 86106, 86113 },
+    { 86120, 86127 },
+    { 86134, 86141 },
+    { 86148, 86155 },
+    { 86162, 86169 },
+    { 86176, 86183 },
+    { 86190, 86197 },
+    { 86204, 86211 },
+    { 86218, 86225 },
+    { 86232, 86239 },
+    { 86246, 86253 },
+    { 86260, 86264 },
+    { 86268, 86272 },
+    { 86276, 86280 },
+    { 86284, 86291 },
+    { 86298, 86302 },
+    { 86306, 86313 },
+    { 86320, 86333 },
+    { 86346, 86350 },
+    { 86354, 86364 },
+    { 86374, 86384 },
+    { 86394, 86404 },
+    { 86414, 86418 },
+    { 86422, 86429 },
+    { 86436, 86446 },
+    { 86456, 86463 },
+    { 86470, 86480 },
+    { 86490, 86497 },
+    { 86504, 86508 },
+    { 86512, 86516 },
+    { 86520, 86527 },
+    { 86534, 86538 },
+    { 86542, 86546 },
+    { 86550, 86554 },
+    { 86558, 86562 },
+    { 86566, 86576 },
+    { 86586, 86593 },
+    { 86600, 86613 },
+    { 86626, 86633 },
+    { 86640, 86644 },
+    { 86648, 86652 },
+    { 86656, 86660 },
+    { 86664, 86668 },
+    { 86672, 86676 },
+    { 86680, 86684 },
+    { 86688, 86692 },
+    { 86696, 86703 },
+    { 86710, 86714 },
+    { 86718, 86722 },
+    { 86726, 86730 },
+    { 86734, 86738 },
+    { 86742, 86746 },
+    { 86750, 86757 },
+    { 86764, 86774 },
+    { 86784, 86788 },
+    { 86792, 86796 },
+    { 86800, 86807 },
+    { 86814, 86818 },
+    { 86822, 86826 },
+    { 86830, 86843 },
+    { 86856, 86860 },
+    { 86864, 86871 },
+    { 86878, 86882 },
+    { 86886, 86896 },
+    { 86906, 86916 },
+    { 86926, 86933 },
+    { 86940, 86959 },
+    { 86978, 86982 },
+    { 86986, 86990 },
+    { 86994, 87001 },
+    { 87008, 87012 },
+    { 87016, 87023 },
+    { 87030, 87034 },
+    { 87038, 87042 },
+    { 87046, 87053 },
+    { 87060, 87067 },
+    { 87074, 87087 },
+    { 87100, 87104 },
+    { 87108, 87112 },
+    { 87116, 87123 },
+    { 87130, 87137 },
+    { 87144, 87148 },
+    { 87152, 87156 },
+    { 87160, 87164 },
+    { 87168, 87172 },
+    { 87176, 87180 },
+    { 87184, 87188 },
+    { 87192, 87196 },
+    { 87200, 87204 },
+    { 87208, 87212 },
+    { 87216, 87220 },
+    { 87224, 87228 },
+    { 87232, 87239 },
+    { 87246, 87256 },
+    { 87266, 87270 },
+    { 87274, 87278 },
+    { 87282, 87286 },
+    { 87290, 87294 },
+    { 87298, 87302 },
+    { 87306, 87310 },
+    { 87314, 87318 },
+    { 87322, 87326 },
+    { 87330, 87334 },
+    { 87338, 87342 },
+    { 87346, 87350 },
+    { 87354, 87358 },
+    { 87362, 87366 },
+    { 87370, 87374 },
+    { 87378, 87382 },
+    { 87386, 87390 },
+    { 87394, 87398 },
+    { 87402, 87406 },
+    { 87410, 87414 },
+    { 87418, 87422 },
+    { 87426, 87430 },
+    { 87434, 87438 },
+    { 87442, 87446 },
+    { 87450, 87454 },
+    { 87458, 87462 },
+    { 87466, 87470 },
+    { 87474, 87478 },
+    { 87482, 87486 },
+    { 87490, 87494 },
+    { 87498, 87505 },
+    { 87512, 87519 },
+    { 87526, 87533 },
+    { 87540, 87547 },
+    { 87554, 87561 },
+    { 87568, 87575 },
+    { 87582, 87589 },
+    { 87596, 87603 },
+    { 87610, 87617 },
+    { 87624, 87631 },
+    { 87638, 87645 },
+    { 87652, 87659 },
+    { 87666, 87673 },
+    { 87680, 87687 },
+    { 87694, 87707 },
+    { 87720, 87727 },
+    { 87734, 87738 },
+    { 87742, 87749 },
+    { 87756, 87760 },
+    { 87764, 87771 },
+    { 87778, 87788 },
+    { 87798, 87802 },
+    { 87806, 87810 },
+    { 87814, 87821 },
+    { 87828, 87832 },
+    { 87836, 87840 },
+    { 87844, 87851 },
+    { 87858, 87862 },
+    { 87866, 87876 },
+    { 87886, 87890 },
+    { 87894, 87898 },
+    { 87902, 87915 },
+    { 87928, 87935 },
+    { 87942, 87946 },
+    { 87950, 87957 },
+    { 87964, 87971 },
+    { 87978, 87982 },
+    { 87986, 87996 },
+    { 88006, 88016 },
+    { 88026, 88033 },
+    { 88040, 88050 },
+    { 88060, 88070 },
+    { 88080, 88090 },
+    { 88100, 88110 },
+    { 88120, 88130 },
+    { 88140, 88150 },
+    { 88160, 88170 },
+    { 88180, 88190 },
+    { 88200, 88210 },
+    { 88220, 88227 },
+    { 88234, 88244 },
+    { 88254, 88267 },
+    { 88280, 88290 },
+    { 88300, 88310 },
+    { 88320, 88333 },
+    { 88346, 88356 },
+    { 88366, 88376 },
+    { 88386, 88396 },
+    { 88406, 88416 },
+    { 88426, 88436 },
+    { 88446, 88456 },
+    { 88466, 88476 },
+    { 88486, 88496 },
+    { 88506, 88516 },
+    { 88526, 88536 },
+    { 88546, 88556 },
+    { 88566, 88576 },
+    { 88586, 88593 },
+    { 88600, 88607 },
+    { 88614, 88618 },
+    { 88622, 88632 },
+    { 88642, 88649 },
+    { 88656, 88660 },
+    { 88664, 88671 },
+    { 88678, 88682 },
+    { 88686, 88690 },
+    { 88694, 88707 },
+    { 88720, 88730 },
+    { 88740, 88747 },
+    { 88754, 88761 },
+    { 88768, 88772 },
+    { 88776, 88789 },
+    { 88802, 88806 },
+    { 88810, 88814 },
+    { 88818, 88825 },
+    { 88832, 88836 },
+    { 88840, 88847 },
+    { 88854, 88861 },
+    { 88868, 88872 },
+    { 88876, 88883 },
+    { 88890, 88900 },
+    { 88910, 88920 },
+    { 88930, 88934 },
+    { 88938, 88951 },
+    { 88964, 88977 },
+    { 88990, 89003 },
+    { 89016, 89029 },
+    { 89042, 89055 },
+    { 89068, 89072 },
+    { 89076, 89083 },
+    { 89090, 89100 },
+    { 89110, 89117 },
+    { 89124, 89128 },
+    { 89132, 89139 },
+    { 89146, 89153 },
+    { 89160, 89170 },
+    { 89180, 89187 },
+    { 89194, 89204 },
+    { 89214, 89221 },
+    { 89228, 89241 },
+    { 89254, 89261 },
+    { 89268, 89272 },
+    { 89276, 89280 },
+    { 89284, 89291 },
+    { 89298, 89305 },
+    { 89312, 89322 },
+    { 89332, 89339 },
+    { 89346, 89350 },
+    { 89354, 89364 },
+    { 89374, 89381 },
+    { 89388, 89395 },
+    { 89402, 89406 },
+    { 89410, 89417 },
+    { 89424, 89431 },
+    { 89438, 89451 },
+    { 89464, 89477 },
+    { 89490, 89494 },
+    { 89498, 89502 },
+    { 89506, 89513 },
+    { 89520, 89527 },
+    { 89534, 89547 },
+    { 89560, 89570 },
+    { 89580, 89590 },
+    { 89600, 89610 },
+    { 89620, 89627 },
+    { 89634, 89638 },
+    { 89642, 89646 },
+    { 89650, 89654 },
+    { 89658, 89662 },
+    { 89666, 89670 },
+    { 89674, 89681 },
+    { 89688, 89695 },
+    { 89702, 89709 },
+    { 89716, 89723 },
+    { 89730, 89737 },
+    { 89744, 89757 },
+    { 89770, 89777 },
+    { 89784, 89791 },
+    { 89798, 89805 },
+    { 89812, 89819 },
+    { 89826, 89833 },
+    { 89840, 89847 },
+    { 89854, 89861 },
+    { 89868, 89875 },
+    { 89882, 89889 },
+    { 89896, 89903 },
+    { 89910, 89920 },
+    { 89930, 89937 },
+    { 89944, 89951 },
+    { 89958, 89965 },
+    { 89972, 89979 },
+    { 89986, 89993 },
+    { 90000, 90007 },
+    { 90014, 90021 },
+    { 90028, 90035 },
+    { 90042, 90049 },
+    { 90056, 90063 },
+    { 90070, 90077 },
+    { 90084, 90091 },
+    { 90098, 90105 },
+    { 90112, 90125 },
+    { 90138, 90151 },
+    { 90164, 90177 },
+    { 90190, 90203 },
+    { 90216, 90229 },
+    { 90242, 90255 },
+    { 90268, 90275 },
+    { 90282, 90289 },
+    { 90296, 90303 },
+    { 90310, 90317 },
+    { 90324, 90331 },
+    { 90338, 90345 },
+    { 90352, 90356 },
+    { 90360, 90364 },
+    { 90368, 90372 },
+    { 90376, 90386 },
+    { 90396, 90400 },
+    { 90404, 90411 },
+    { 90418, 90422 },
+    { 90426, 90430 },
+    { 90434, 90444 },
+    { 90454, 90458 },
+    { 90462, 90472 },
+    { 90482, 90489 },
+    { 90496, 90509 },
+    { 90522, 90532 },
+    { 90542, 90549 },
+    { 90556, 90563 },
+    { 90570, 90583 },
+    { 90596, 90603 },
+    { 90610, 90614 },
+    { 90618, 90625 },
+    { 90632, 90636 },
+    { 90640, 90647 },
+    { 90654, 90658 },
+    { 90662, 90666 },
+    { 90670, 90674 },
+    { 90678, 90685 },
+    { 90692, 90699 },
+    { 90706, 90713 },
+    { 90720, 90727 },
+    { 90734, 90741 },
+    { 90748, 90755 },
+    { 90762, 90769 },
+    { 90776, 90783 },
+    { 90790, 90797 },
+    { 90804, 90811 },
+    { 90818, 90825 },
+    { 90832, 90839 },
+    { 90846, 90853 },
+    { 90860, 90867 },
+    { 90874, 90881 },
+    { 90888, 90895 },
+    { 90902, 90909 },
+    { 90916, 90923 },
+    { 90930, 90937 },
+    { 90944, 90951 },
+    { 90958, 90965 },
+    { 90972, 90979 },
+    { 90986, 90993 },
+    { 91000, 91007 },
+    { 91014, 91021 },
+    { 91028, 91035 },
+    { 91042, 91049 },
+    { 91056, 91063 },
+    { 91070, 91077 },
+    { 91084, 91091 },
+    { 91098, 91105 },
+    { 91112, 91122 },
+    { 91132, 91139 },
+    { 91146, 91153 },
+    { 91160, 91170 },
+    { 91180, 91187 },
+    { 91194, 91201 },
+    { 91208, 91215 },
+    { 91222, 91229 },
+    { 91236, 91243 },
+    { 91250, 91263 },
+    { 91276, 91283 },
+    { 91290, 91297 },
+    { 91304, 91311 },
+    { 91318, 91331 },
+    { 91344, 91354 },
+    { 91364, 91371 },
+    { 91378, 91388 },
+    { 91398, 91405 },
+    { 91412, 91422 },
+    { 91432, 91445 },
+    { 91458, 91465 },
+    { 91472, 91479 },
+    { 91486, 91493 },
+    { 91500, 91507 },
+    { 91514, 91524 },
+    { 91534, 91541 },
+    { 91548, 91555 },
+    { 91562, 91569 },
+    { 91576, 91583 },
+    { 91590, 91597 },
+    { 91604, 91611 },
+    { 91618, 91625 },
+    { 91632, 91639 },
+    { 91646, 91653 },
+    { 91660, 91667 },
+    { 91674, 91681 },
+    { 91688, 91695 },
+    { 91702, 91709 },
+    { 91716, 91723 },
+    { 91730, 91737 },
+    { 91744, 91751 },
+    { 91758, 91765 },
+    { 91772, 91779 },
+    { 91786, 91793 },
+    { 91800, 91807 },
+    { 91814, 91827 },
+    { 91840, 91847 },
+    { 91854, 91858 },
+    { 91862, 91875 },
+    { 91888, 91895 },
+    { 91902, 91909 },
+    { 91916, 91923 },
+    { 91930, 91937 },
+    { 91944, 91957 },
+    { 91970, 91977 },
+    { 91984, 91994 },
+    { 92004, 92011 },
+    { 92018, 92031 },
+    { 92044, 92051 },
+    { 92058, 92065 },
+    { 92072, 92079 },
+    { 92086, 92093 },
+    { 92100, 92110 },
+    { 92120, 92133 },
+    { 92146, 92159 },
+    { 92172, 92179 },
+    { 92186, 92193 },
+    { 92200, 92207 },
+    { 92214, 92224 },
+    { 92234, 92241 },
+    { 92248, 92255 },
+    { 92262, 92269 },
+    { 92276, 92283 },
+    { 92290, 92300 },
+    { 92310, 92317 },
+    { 92324, 92331 },
+    { 92338, 92348 },
+    { 92358, 92368 },
+    { 92378, 92385 },
+    { 92392, 92402 },
+    { 92412, 92422 },
+    { 92432, 92439 },
+    { 92446, 92456 },
+    { 92466, 92476 },
+    { 92486, 92496 },
+    { 92506, 92516 },
+    { 92526, 92539 },
+    { 92552, 92559 },
+    { 92566, 92573 },
+    { 92580, 92584 },
+    { 92588, 92595 },
+    { 92602, 92609 },
+    { 92616, 92623 },
+    { 92630, 92637 },
+    { 92644, 92651 },
+    { 92658, 92671 },
+    { 92684, 92691 },
+    { 92698, 92705 },
+    { 92712, 92719 },
+    { 92726, 92733 },
+    { 92740, 92747 },
+    { 92754, 92761 },
+    { 92768, 92775 },
+    { 92782, 92786 },
+    { 92790, 92794 },
+    { 92798, 92802 },
+    { 92806, 92810 },
+    { 92814, 92818 },
+    { 92822, 92826 },
+    { 92830, 92834 },
+    { 92838, 92842 },
+    { 92846, 92850 },
+    { 92854, 92858 },
+    { 92862, 92866 },
+    { 92870, 92874 },
+    { 92878, 92882 },
+    { 92886, 92890 },
+    { 92894, 92898 },
+    { 92902, 92906 },
+    { 92910, 92914 },
+    { 92918, 92922 },
+    { 92926, 92930 },
+    { 92934, 92938 },
+    { 92942, 92946 },
+    { 92950, 92954 },
+    { 92958, 92962 },
+    { 92966, 92973 },
+    { 92980, 92987 },
+    { 92994, 93001 },
+    { 93008, 93024 },
+    { 93040, 93056 },
+    { 93072, 93088 },
+    { 93104, 93120 },
+    { 93136, 93146 },
+    { 93156, 93166 },
+    { 93176, 93183 },
+    { 93190, 93197 },
+    { 93204, 93211 },
+    { 93218, 93225 },
+    { 93232, 93242 },
+    { 93252, 93259 },
+    { 93266, 93273 },
+    { 93280, 93293 },
+    { 93306, 93313 },
+    { 93320, 93327 },
+    { 93334, 93341 },
+    { 93348, 93355 },
+    { 93362, 93369 },
+    { 93376, 93383 },
+    { 93390, 93397 },
+    { 93404, 93414 },
+    { 93424, 93431 },
+    { 93438, 93445 },
+    { 93452, 93459 },
+    { 93466, 93476 },
+    { 93486, 93493 },
+    { 93500, 93507 },
+    { 93514, 93521 },
+    { 93528, 93535 },
+    { 93542, 93549 },
+    { 93556, 93563 },
+    { 93570, 93577 },
+    { 93584, 93591 },
+    { 93598, 93605 },
+    { 93612, 93619 },
+    { 93626, 93633 },
+    { 93640, 93647 },
+    { 93654, 93661 },
+    { 93668, 93675 },
+    { 93682, 93689 },
+    { 93696, 93703 },
+    { 93710, 93717 },
+    { 93724, 93731 },
+    { 93738, 93745 },
+    { 93752, 93759 },
+    { 93766, 93773 },
+    { 93780, 93787 },
+    { 93794, 93801 },
+    { 93808, 93815 },
+    { 93822, 93832 },
+    { 93842, 93852 },
+    { 93862, 93872 },
+    { 93882, 93892 },
+    { 93902, 93912 },
+    { 93922, 93932 },
+    { 93942, 93952 },
+    { 93962, 93969 },
+    { 93976, 93983 },
+    { 93990, 93997 },
+    { 94004, 94011 },
+    { 94018, 94028 },
+    { 94038, 94045 },
+    { 94052, 94059 },
+    { 94066, 94073 },
+    { 94080, 94087 },
+    { 94094, 94101 },
+    { 94108, 94112 },
+    { 94116, 94120 },
+    { 94124, 94128 },
+    { 94132, 94151 },
+    { 94170, 94177 },
+    { 94184, 94191 },
+    { 94198, 94202 },
+    { 94206, 94210 },
+    { 94214, 94218 },
+    { 94222, 94226 },
+    { 94230, 94234 },
+    { 94238, 94242 },
+    { 94246, 94250 },
+    { 94254, 94267 },
+    { 94280, 94284 },
+    { 94288, 94292 },
+    { 94296, 94300 },
+    { 94304, 94308 },
+    { 94312, 94316 },
+    { 94320, 94324 },
+    { 94328, 94332 },
+    { 94336, 94340 },
+    { 94344, 94351 },
+    { 94358, 94365 },
+    { 94372, 94376 },
+    { 94380, 94384 },
+    { 94388, 94392 },
+    { 94396, 94400 },
+    { 94404, 94408 },
+    { 94412, 94416 },
+    { 94420, 94424 },
+    { 94428, 94432 },
+    { 94436, 94440 },
+    { 94444, 94448 },
+    { 94452, 94456 },
+    { 94460, 94464 },
+    { 94468, 94472 },
+    { 94476, 94480 },
+    { 94484, 94488 },
+    { 94492, 94499 },
+    { 94506, 94513 },
+    { 94520, 94527 },
+    { 94534, 94538 },
+    { 94542, 94546 },
+    { 94550, 94554 },
+    { 94558, 94562 },
+    { 94566, 94570 },
+    { 94574, 94578 },
+    { 94582, 94586 },
+    { 94590, 94594 },
+    { 94598, 94602 },
+    { 94606, 94610 },
+    { 94614, 94618 },
+    { 94622, 94626 },
+    { 94630, 94634 },
+    { 94638, 94642 },
+    { 94646, 94650 },
+    { 94654, 94658 },
+    { 94662, 94666 },
+    { 94670, 94674 },
+    { 94678, 94682 },
+    { 94686, 94690 },
+    { 94694, 94698 },
+    { 94702, 94709 },
+    { 94716, 94723 },
+    { 94730, 94737 },
+    { 94744, 94748 },
+    { 94752, 94759 },
+    { 94766, 94770 },
+    { 94774, 94778 },
+    { 94782, 94786 },
+    { 94790, 94794 },
+    { 94798, 94802 },
+    { 94806, 94810 },
+    { 94814, 94818 },
+    { 94822, 94826 },
+    { 94830, 94834 },
+    { 94838, 94842 },
+    { 94846, 94850 },
+    { 94854, 94858 },
+    { 94862, 94866 },
+    { 94870, 94874 },
+    { 94878, 94882 },
+    { 94886, 94890 },
+    { 94894, 94901 },
+    { 94908, 94912 },
+    { 94916, 94920 },
+    { 94924, 94928 },
+    { 94932, 94939 },
+    { 94946, 94953 },
+    { 94960, 94967 },
+    { 94974, 94981 },
+    { 94988, 94995 },
+    { 95002, 95006 },
+    { 95010, 95014 },
+    { 95018, 95022 },
+    { 95026, 95030 },
+    { 95034, 95041 },
+    { 95048, 95055 },
+    { 95062, 95066 },
+    { 95070, 95074 },
+    { 95078, 95085 },
+    { 95092, 95096 },
+    { 95100, 95104 },
+    { 95108, 95112 },
+    { 95116, 95120 },
+    { 95124, 95128 },
+    { 95132, 95139 },
+    { 95146, 95150 },
+    { 95154, 95158 },
+    { 95162, 95166 },
+    { 95170, 95174 },
+    { 95178, 95182 },
+    { 95186, 95190 },
+    { 95194, 95198 },
+    { 95202, 95206 },
+    { 95210, 95214 },
+    { 95218, 95225 },
+    { 95232, 95239 },
+    { 95246, 95253 },
+    { 95260, 95264 },
+    { 95268, 95272 },
+    { 95276, 95280 },
+    { 95284, 95288 },
+    { 95292, 95299 },
+    { 95306, 95310 },
+    { 95314, 95318 },
+    { 95322, 95326 },
+    { 95330, 95334 },
+    { 95338, 95342 },
+    { 95346, 95350 },
+    { 95354, 95358 },
+    { 95362, 95366 },
+    { 95370, 95374 },
+    { 95378, 95382 },
+    { 95386, 95390 },
+    { 95394, 95398 },
+    { 95402, 95406 },
+    { 95410, 95414 },
+    { 95418, 95422 },
+    { 95426, 95430 },
+    { 95434, 95438 },
+    { 95442, 95449 },
+    { 95456, 95460 },
+    { 95464, 95468 },
+    { 95472, 95479 },
+    { 95486, 95499 },
+    { 95512, 95516 },
+    { 95520, 95524 },
+    { 95528, 95532 },
+    { 95536, 95540 },
+    { 95544, 95548 },
+    { 95552, 95556 },
+    { 95560, 95564 },
+    { 95568, 95572 },
+    { 95576, 95580 },
+    { 95584, 95597 },
+    { 95610, 95614 },
+    { 95618, 95622 },
+    { 95626, 95630 },
+    { 95634, 95638 },
+    { 95642, 95646 },
+    { 95650, 95654 },
+    { 95658, 95662 },
+    { 95666, 95670 },
+    { 95674, 95678 },
+    { 95682, 95686 },
+    { 95690, 95694 },
+    { 95698, 95702 },
+    { 95706, 95710 },
+    { 95714, 95718 },
+    { 95722, 95726 },
+    { 95730, 95734 },
+    { 95738, 95745 },
+    { 95752, 95756 },
+    { 95760, 95764 },
+    { 95768, 95772 },
+    { 95776, 95780 },
+    { 95784, 95788 },
+    { 95792, 95796 },
+    { 95800, 95804 },
+    { 95808, 95812 },
+    { 95816, 95820 },
+    { 95824, 95828 },
+    { 95832, 95836 },
+    { 95840, 95844 },
+    { 95848, 95852 },
+    { 95856, 95860 },
+    { 95864, 95868 },
+    { 95872, 95876 },
+    { 95880, 95890 },
+    { 95900, 95904 },
+    { 95908, 95912 },
+    { 95916, 95920 },
+    { 95924, 95928 },
+    { 95932, 95936 },
+    { 95940, 95944 },
+    { 95948, 95952 },
+    { 95956, 95960 },
+    { 95964, 95968 },
+    { 95972, 95976 },
+    { 95980, 95984 },
+    { 95988, 95992 },
+    { 95996, 96000 },
+    { 96004, 96008 },
+    { 96012, 96016 },
+    { 96020, 96024 },
+    { 96028, 96035 },
+    { 96042, 96046 },
+    { 96050, 96054 },
+    { 96058, 96062 },
+    { 96066, 96070 },
+    { 96074, 96081 },
+    { 96088, 96095 },
+    { 96102, 96112 },
+    { 96122, 96135 },
+    { 96148, 96158 },
+    { 96168, 96181 },
+    { 96194, 96204 },
+    { 96214, 96218 },
+    { 96222, 96232 },
+    { 96242, 96249 },
+    { 96256, 96263 },
+    { 96270, 96274 },
+    { 96278, 96282 },
+    { 96286, 96290 },
+    { 96294, 96304 },
+    { 96314, 96318 },
+    { 96322, 96326 },
+    { 96330, 96334 },
+    { 96338, 96345 },
+    { 96352, 96359 },
+    { 96366, 96370 },
+    { 96374, 96378 },
+    { 96382, 96386 },
+    { 96390, 96403 },
+    { 96416, 96423 },
+    { 96430, 96437 },
+    { 96444, 96451 },
+    { 96458, 96462 },
+    { 96466, 96470 },
+    { 96474, 96487 },
+    { 96500, 96507 },
+    { 96514, 96518 },
+    { 96522, 96532 },
+    { 96542, 96546 },
+    { 96550, 96554 },
+    { 96558, 96562 },
+    { 96566, 96570 },
+    { 96574, 96581 },
+    { 96588, 96595 },
+    { 96602, 96606 },
+    { 96610, 96617 },
+    { 96624, 96628 },
+    { 96632, 96642 },
+    { 96652, 96656 },
+    { 96660, 96664 },
+    { 96668, 96672 },
+    { 96676, 96680 },
+    { 96684, 96688 },
+    { 96692, 96699 },
+    { 96706, 96710 },
+    { 96714, 96718 },
+    { 96722, 96729 },
+    { 96736, 96740 },
+    { 96744, 96748 },
+    { 96752, 96756 },
+    { 96760, 96764 },
+    { 96768, 96772 },
+    { 96776, 96780 },
+    { 96784, 96788 },
+    { 96792, 96796 },
+    { 96800, 96804 },
+    { 96808, 96812 },
+    { 96816, 96820 },
+    { 96824, 96828 },
+    { 96832, 96836 },
+    { 96840, 96844 },
+    { 96848, 96852 },
+    { 96856, 96860 },
+    { 96864, 96868 },
+    { 96872, 96876 },
+    { 96880, 96884 },
+    { 96888, 96892 },
+    { 96896, 96900 },
+    { 96904, 96911 },
+    { 96918, 96925 },
+    { 96932, 96942 },
+    { 96952, 96959 },
+    { 96966, 96973 },
+    { 96980, 96984 },
+    { 96988, 96995 },
+    { 97002, 97012 },
+    { 97022, 97032 },
+    { 97042, 97049 },
+    { 97056, 97060 },
+    { 97064, 97071 },
+    { 97078, 97088 },
+    { 97098, 97105 },
+    { 97112, 97128 },
+    { 97144, 97151 },
+    { 97158, 97162 },
+    { 97166, 97170 },
+    { 97174, 97181 },
+    { 97188, 97192 },
+    { 97196, 97200 },
+    { 97204, 97208 },
+    { 97212, 97216 },
+    { 97220, 97227 },
+    { 97234, 97244 },
+    { 97254, 97261 },
+    { 97268, 97275 },
+    { 97282, 97286 },
+    { 97290, 97294 },
+    { 97298, 97305 },
+    { 97312, 97316 },
+    { 97320, 97324 },
+    { 97328, 97332 },
+    { 97336, 97343 },
+    { 97350, 97357 },
+    { 97364, 97371 },
+    { 97378, 97388 },
+    { 97398, 97402 },
+    { 97406, 97410 },
+    { 97414, 97421 },
+    { 97428, 97435 },
+    { 97442, 97446 },
+    { 97450, 97454 },
+    { 97458, 97462 },
+    { 97466, 97473 },
+    { 97480, 97487 },
+    { 97494, 97501 },
+    { 97508, 97518 },
+    { 97528, 97538 },
+    { 97548, 97555 },
+    { 97562, 97569 },
+    { 97576, 97583 },
+    { 97590, 97597 },
+    { 97604, 97611 },
+    { 97618, 97625 },
+    { 97632, 97639 },
+    { 97646, 97653 },
+    { 97660, 97667 },
+    { 97674, 97681 },
+    { 97688, 97692 },
+    { 97696, 97709 },
+    { 97722, 97729 },
+    { 97736, 97749 },
+    { 97762, 97769 },
+    { 97776, 97783 },
+    { 97790, 97794 },
+    { 97798, 97808 },
+    { 97818, 97831 },
+    { 97844, 97851 },
+    { 97858, 97868 },
+    { 97878, 97888 },
+    { 97898, 97902 },
+    { 97906, 97913 },
+    { 97920, 97927 },
+    { 97934, 97941 },
+    { 97948, 97958 },
+    { 97968, 97978 },
+    { 97988, 97992 },
+    { 97996, 98003 },
+    { 98010, 98014 },
+    { 98018, 98025 },
+    { 98032, 98039 },
+    { 98046, 98053 },
+    { 98060, 98073 },
+    { 98086, 98093 },
+    { 98100, 98107 },
+    { 98114, 98121 },
+    { 98128, 98135 },
+    { 98142, 98146 },
+    { 98150, 98157 },
+    { 98164, 98177 },
+    { 98190, 98197 },
+    { 98204, 98208 },
+    { 98212, 98216 },
+    { 98220, 98230 },
+    { 98240, 98250 },
+    { 98260, 98270 },
+    { 98280, 98287 },
+    { 98294, 98304 },
+    { 98314, 98324 },
+    { 98334, 98344 },
+    { 98354, 98364 },
+    { 98374, 98384 },
+    { 98394, 98404 },
+    { 98414, 98424 },
+    { 98434, 98444 },
+    { 98454, 98461 },
+    { 98468, 98475 },
+    { 98482, 98489 },
+    { 98496, 98506 },
+    { 98516, 98523 },
+    { 98530, 98537 },
+    { 98544, 98554 },
+    { 98564, 98571 },
+    { 98578, 98585 },
+    { 98592, 98599 },
+    { 98606, 98616 },
+    { 98626, 98633 },
+    { 98640, 98647 },
+    { 98654, 98664 },
+    { 98674, 98684 },
+    { 98694, 98701 },
+    { 98708, 98718 },
+    { 98728, 98735 },
+    { 98742, 98749 },
+    { 98756, 98766 },
+    { 98776, 98783 },
+    { 98790, 98797 },
+    { 98804, 98811 },
+    { 98818, 98825 },
+    { 98832, 98842 },
+    { 98852, 98859 },
+    { 98866, 98873 },
+    { 98880, 98887 },
+    { 98894, 98898 },
+    { 98902, 98909 },
+    { 98916, 98920 },
+    { 98924, 98931 },
+    { 98938, 98951 },
+    { 98964, 98968 },
+    { 98972, 98976 },
+    { 98980, 98987 },
+    { 98994, 98998 },
+    { 99002, 99006 },
+    { 99010, 99017 },
+    { 99024, 99034 },
+    { 99044, 99048 },
+    { 99052, 99056 },
+    { 99060, 99064 },
+    { 99068, 99078 },
+    { 99088, 99095 },
+    { 99102, 99115 },
+    { 99128, 99132 },
+    { 99136, 99146 },
+    { 99156, 99160 },
+    { 99164, 99171 },
+    { 99178, 99182 },
+    { 99186, 99193 },
+    { 99200, 99207 },
+    { 99214, 99218 },
+    { 99222, 99226 },
+    { 99230, 99234 },
+    { 99238, 99245 },
+    { 99252, 99256 },
+    { 99260, 99270 },
+    { 99280, 99290 },
+    { 99300, 99304 },
+    { 99308, 99315 },
+    { 99322, 99329 },
+    { 99336, 99346 },
+    { 99356, 99363 },
+    { 99370, 99377 },
+    { 99384, 99391 },
+    { 99398, 99405 },
+    { 99412, 99419 },
+    { 99426, 99433 },
+    { 99440, 99447 },
+    { 99454, 99458 },
+    { 99462, 99466 },
+    { 99470, 99474 },
+    { 99478, 99482 },
+    { 99486, 99490 },
+    { 99494, 99498 },
+    { 99502, 99506 },
+    { 99510, 99517 },
+    { 99524, 99531 },
+    { 99538, 99542 },
+    { 99546, 99550 },
+    { 99554, 99561 },
+    { 99568, 99581 },
+    { 99594, 99598 },
+    { 99602, 99606 },
+    { 99610, 99620 },
+    { 99630, 99634 },
+    { 99638, 99642 },
+    { 99646, 99650 },
+    { 99654, 99658 },
+    { 99662, 99669 },
+    { 99676, 99680 },
+    { 99684, 99688 },
+    { 99692, 99696 },
+    { 99700, 99704 },
+    { 99708, 99712 },
+    { 99716, 99720 },
+    { 99724, 99728 },
+    { 99732, 99736 },
+    { 99740, 99744 },
+    { 99748, 99752 },
+    { 99756, 99760 },
+    { 99764, 99768 },
+    { 99772, 99782 },
+    { 99792, 99796 },
+    { 99800, 99807 },
+    { 99814, 99818 },
+    { 99822, 99829 },
+    { 99836, 99849 },
+    { 99862, 99878 },
+    { 99894, 99898 },
+    { 99902, 99906 },
+    { 99910, 99914 },
+    { 99918, 99931 },
+    { 99944, 99957 },
+    { 99970, 99974 },
+    { 99978, 99982 },
+    { 99986, 99990 },
+    { 99994, 100001 },
+    { 100008, 100012 },
+    { 100016, 100020 },
+    { 100024, 100028 },
+    { 100032, 100039 },
+    { 100046, 100059 },
+    { 100072, 100079 },
+    { 100086, 100096 },
+    { 100106, 100113 },
+    { 100120, 100130 },
+    { 100140, 100147 },
+    { 100154, 100167 },
+    { 100180, 100187 },
+    { 100194, 100201 },
+    { 100208, 100212 },
+    { 100216, 100220 },
+    { 100224, 100228 },
+    { 100232, 100236 },
+    { 100240, 100244 },
+    { 100248, 100267 },
+    { 100286, 100293 },
+    { 100300, 100307 },
+    { 100314, 100327 },
+    { 100340, 100344 },
+    { 100348, 100352 },
+    { 100356, 100369 },
+    { 100382, 100389 },
+    { 100396, 100406 },
+    { 100416, 100423 },
+    { 100430, 100437 },
+    { 100444, 100448 },
+    { 100452, 100456 },
+    { 100460, 100467 },
+    { 100474, 100478 },
+    { 100482, 100489 },
+    { 100496, 100503 },
+    { 100510, 100517 },
+    { 100524, 100531 },
+    { 100538, 100545 },
+    { 100552, 100559 },
+    { 100566, 100573 },
+    { 100580, 100584 },
+    { 100588, 100592 },
+    { 100596, 100600 },
+    { 100604, 100608 },
+    { 100612, 100616 },
+    { 100620, 100624 },
+    { 100628, 100632 },
+    { 100636, 100646 },
+    { 100656, 100663 },
+    { 100670, 100674 },
+    { 100678, 100682 },
+    { 100686, 100690 },
+    { 100694, 100698 },
+    { 100702, 100706 },
+    { 100710, 100714 },
+    { 100718, 100722 },
+    { 100726, 100730 },
+    { 100734, 100738 },
+    { 100742, 100746 },
+    { 100750, 100754 },
+    { 100758, 100765 },
+    { 100772, 100776 },
+    { 100780, 100784 },
+    { 100788, 100792 },
+    { 100796, 100800 },
+    { 100804, 100808 },
+    { 100812, 100822 },
+    { 100832, 100836 },
+    { 100840, 100844 },
+    { 100848, 100855 },
+    { 100862, 100869 },
+    { 100876, 100880 },
+    { 100884, 100888 },
+    { 100892, 100896 },
+    { 100900, 100904 },
+    { 100908, 100912 },
+    { 100916, 100920 },
+    { 100924, 100928 },
+    { 100932, 100936 },
+    { 100940, 100944 },
+    { 100948, 100961 },
+    { 100974, 100981 },
+    { 100988, 100995 },
+    { 101002, 101015 },
+    { 101028, 101035 },
+    { 101042, 101046 },
+    { 101050, 101057 },
+    { 101064, 101074 },
+    { 101084, 101100 },
+    { 101116, 101129 },
+    { 101142, 101146 },
+    { 101150, 101154 },
+    { 101158, 101162 },
+    { 101166, 101170 },
+    { 101174, 101178 },
+    { 101182, 101186 },
+    { 101190, 101194 },
+    { 101198, 101202 },
+    { 101206, 101210 },
+    { 101214, 101218 },
+    { 101222, 101226 },
+    { 101230, 101234 },
+    { 101238, 101242 },
+    { 101246, 101250 },
+    { 101254, 101261 },
+    { 101268, 101272 },
+    { 101276, 101280 },
+    { 101284, 101288 },
+    { 101292, 101296 },
+    { 101300, 101304 },
+    { 101308, 101315 },
+    { 101322, 101326 },
+    { 101330, 101334 },
+    { 101338, 101342 },
+    { 101346, 101350 },
+    { 101354, 101358 },
+    { 101362, 101366 },
+    { 101370, 101374 },
+    { 101378, 101382 },
+    { 101386, 101390 },
+    { 101394, 101398 },
+    { 101402, 101406 },
+    { 101410, 101414 },
+    { 101418, 101422 },
+    { 101426, 101430 },
+    { 101434, 101438 },
+    { 101442, 101446 },
+    { 101450, 101454 },
+    { 101458, 101462 },
+    { 101466, 101470 },
+    { 101474, 101478 },
+    { 101482, 101486 },
+    { 101490, 101494 },
+    { 101498, 101502 },
+    { 101506, 101510 },
+    { 101514, 101518 },
+    { 101522, 101526 },
+    { 101530, 101534 },
+    { 101538, 101542 },
+    { 101546, 101550 },
+    { 101554, 101558 },
+    { 101562, 101566 },
+    { 101570, 101577 },
+    { 101584, 101591 },
+    { 101598, 101608 },
+    { 101618, 101622 },
+    { 101626, 101630 },
+    { 101634, 101638 },
+    { 101642, 101649 },
+    { 101656, 101666 },
+    { 101676, 101686 },
+    { 101696, 101703 },
+    { 101710, 101717 },
+    { 101724, 101731 },
+    { 101738, 101745 },
+    { 101752, 101759 },
+    { 101766, 101773 },
+    { 101780, 101787 },
+    { 101794, 101801 },
+    { 101808, 101812 },
+    { 101816, 101823 },
+    { 101830, 101843 },
+    { 101856, 101869 },
+    { 101882, 101886 },
+    { 101890, 101894 },
+    { 101898, 101905 },
+    { 101912, 101919 },
+    { 101926, 101930 },
+    { 101934, 101941 },
+    { 101948, 101955 },
+    { 101962, 101966 },
+    { 101970, 101974 },
+    { 101978, 101982 },
+    { 101986, 101990 },
+    { 101994, 101998 },
+    { 102002, 102006 },
+    { 102010, 102014 },
+    { 102018, 102022 },
+    { 102026, 102030 },
+    { 102034, 102038 },
+    { 102042, 102046 },
+    { 102050, 102054 },
+    { 102058, 102062 },
+    { 102066, 102070 },
+    { 102074, 102078 },
+    { 102082, 102086 },
+    { 102090, 102094 },
+    { 102098, 102105 },
+    { 102112, 102116 },
+    { 102120, 102124 },
+    { 102128, 102132 },
+    { 102136, 102140 },
+    { 102144, 102148 },
+    { 102152, 102156 },
+    { 102160, 102164 },
+    { 102168, 102172 },
+    { 102176, 102180 },
+    { 102184, 102188 },
+    { 102192, 102196 },
+    { 102200, 102204 },
+    { 102208, 102212 },
+    { 102216, 102220 },
+    { 102224, 102228 },
+    { 102232, 102236 },
+    { 102240, 102244 },
+    { 102248, 102252 },
+    { 102256, 102260 },
+    { 102264, 102268 },
+    { 102272, 102276 },
+    { 102280, 102284 },
+    { 102288, 102295 },
+    { 102302, 102306 },
+    { 102310, 102314 },
+    { 102318, 102322 },
+    { 102326, 102330 },
+    { 102334, 102338 },
+    { 102342, 102346 },
+    { 102350, 102354 },
+    { 102358, 102362 },
+    { 102366, 102370 },
+    { 102374, 102378 },
+    { 102382, 102386 },
+    { 102390, 102394 },
+    { 102398, 102402 },
+    { 102406, 102410 },
+    { 102414, 102418 },
+    { 102422, 102426 },
+    { 102430, 102434 },
+    { 102438, 102442 },
+    { 102446, 102450 },
+    { 102454, 102458 },
+    { 102462, 102466 },
+    { 102470, 102474 },
+    { 102478, 102482 },
+    { 102486, 102496 },
+    { 102506, 102510 },
+    { 102514, 102518 },
+    { 102522, 102529 },
+    { 102536, 102546 },
+    { 102556, 102569 },
+    { 102582, 102589 },
+    { 102596, 102609 },
+    { 102622, 102629 },
+    { 102636, 102646 },
+    { 102656, 102675 },
+    { 102694, 102698 },
+    { 102702, 102706 },
+    { 102710, 102717 },
+    { 102724, 102728 },
+    { 102732, 102736 },
+    { 102740, 102744 },
+    { 102748, 102752 },
+    { 102756, 102760 },
+    { 102764, 102768 },
+    { 102772, 102776 },
+    { 102780, 102784 },
+    { 102788, 102792 },
+    { 102796, 102800 },
+    { 102804, 102808 },
+    { 102812, 102816 },
+    { 102820, 102824 },
+    { 102828, 102832 },
+    { 102836, 102840 },
+    { 102844, 102848 },
+    { 102852, 102856 },
+    { 102860, 102864 },
+    { 102868, 102872 },
+    { 102876, 102880 },
+    { 102884, 102891 },
+    { 102898, 102902 },
+    { 102906, 102913 },
+    { 102920, 102924 },
+    { 102928, 102932 },
+    { 102936, 102940 },
+    { 102944, 102948 },
+    { 102952, 102959 },
+    { 102966, 102970 },
+    { 102974, 102981 },
+    { 102988, 102992 },
+    { 102996, 103000 },
+    { 103004, 103008 },
+    { 103012, 103016 },
+    { 103020, 103024 },
+    { 103028, 103032 },
+    { 103036, 103040 },
+    { 103044, 103048 },
+    { 103052, 103056 },
+    { 103060, 103064 },
+    { 103068, 103072 },
+    { 103076, 103080 },
+    { 103084, 103088 },
+    { 103092, 103096 },
+    { 103100, 103104 },
+    { 103108, 103112 },
+    { 103116, 103120 },
+    { 103124, 103131 },
+    { 103138, 103145 },
+    { 103152, 103162 },
+    { 103172, 103176 },
+    { 103180, 103184 },
+    { 103188, 103192 },
+    { 103196, 103200 },
+    { 103204, 103208 },
+    { 103212, 103216 },
+    { 103220, 103224 },
+    { 103228, 103232 },
+    { 103236, 103240 },
+    { 103244, 103251 },
+    { 103258, 103262 },
+    { 103266, 103270 },
+    { 103274, 103281 },
+    { 103288, 103292 },
+    { 103296, 103300 },
+    { 103304, 103308 },
+    { 103312, 103319 },
+    { 103326, 103336 },
+    { 103346, 103356 },
+    { 103366, 103370 },
+    { 103374, 103381 },
+    { 103388, 103398 },
+    { 103408, 103415 },
+    { 103422, 103432 },
+    { 103442, 103452 },
+    { 103462, 103475 },
+    { 103488, 103501 },
+    { 103514, 103521 },
+    { 103528, 103538 },
+    { 103548, 103558 },
+    { 103568, 103578 },
+    { 103588, 103595 },
+    { 103602, 103612 },
+    { 103622, 103626 },
+    { 103630, 103640 },
+    { 103650, 103657 },
+    { 103664, 103680 },
+    { 103696, 103706 },
+    { 103716, 103726 },
+    { 103736, 103740 },
+    { 103744, 103748 },
+    { 103752, 103756 },
+    { 103760, 103764 },
+    { 103768, 103772 },
+    { 103776, 103783 },
+    { 103790, 103797 },
+    { 103804, 103808 },
+    { 103812, 103822 },
+    { 103832, 103836 },
+    { 103840, 103847 },
+    { 103854, 103861 },
+    { 103868, 103878 },
+    { 103888, 103892 },
+    { 103896, 103909 },
+    { 103922, 103926 },
+    { 103930, 103934 },
+    { 103938, 103951 },
+    { 103964, 103971 },
+    { 103978, 103991 },
+    { 104004, 104008 },
+    { 104012, 104016 },
+    { 104020, 104024 },
+    { 104028, 104032 },
+    { 104036, 104040 },
+    { 104044, 104048 },
+    { 104052, 104056 },
+    { 104060, 104064 },
+    { 104068, 104072 },
+    { 104076, 104080 },
+    { 104084, 104088 },
+    { 104092, 104096 },
+    { 104100, 104107 },
+    { 104114, 104121 },
+    { 104128, 104141 },
+    { 104154, 104164 },
+    { 104174, 104181 },
+    { 104188, 104198 },
+    { 104208, 104212 },
+    { 104216, 104220 },
+    { 104224, 104228 },
+    { 104232, 104239 },
 };
 #define SIMP_TO_TRAD_MAX_LEN (6)
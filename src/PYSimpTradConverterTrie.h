@@ -0,0 +1,10052 @@
+static const struct {
+    gunichar ch;
+    guint32 first_child;
+    guint32 n_children;
+    gint32 trad;
+} simp_to_trad_trie[] = {
+    { 0x0, 1, 3155, -1 },   // root
+    { 0x3007, 3156, 3, -1 },   // 〇
+    { 0x4e00, 3159, 22, -1 },   // 一
+    { 0x4e01, 3181, 1, -1 },   // 丁
+    { 0x4e03, 3182, 7, -1 },   // 七
+    { 0x4e07, 3189, 11, 42 },   // 万
+    { 0x4e09, 3200, 10, -1 },   // 三
+    { 0x4e0a, 3210, 5, -1 },   // 上
+    { 0x4e0b, 3215, 4, -1 },   // 下
+    { 0x4e0d, 3219, 16, -1 },   // 不
+    { 0x4e0e, 0, 0, 116 },   // 与
+    { 0x4e11, 3235, 48, -1 },   // 丑
+    { 0x4e13, 3283, 1, 168 },   // 专
+    { 0x4e16, 3284, 2, -1 },   // 世
+    { 0x4e1a, 3286, 1, 174 },   // 业
+    { 0x4e1b, 3287, 1, 176 },   // 丛
+    { 0x4e1c, 3288, 4, 178 },   // 东
+    { 0x4e1d, 3292, 3, 183 },   // 丝
+    { 0x4e22, 3295, 1, 187 },   // 丢
+    { 0x4e24, 3296, 10, 189 },   // 两
+    { 0x4e25, 3306, 1, 200 },   // 严
+    { 0x4e27, 3307, 1, 202 },   // 丧
+    { 0x4e2a, 3308, 5, 204 },   // 个
+    { 0x4e2d, 3313, 6, -1 },   // 中
+    { 0x4e30, 3319, 6, 240 },   // 丰
+    { 0x4e34, 3325, 1, 249 },   // 临
+    { 0x4e39, 3326, 1, -1 },   // 丹
+    { 0x4e3a, 3327, 2, 252 },   // 为
+    { 0x4e3b, 3329, 3, -1 },   // 主
+    { 0x4e3d, 0, 0, 259 },   // 丽
+    { 0x4e3e, 3332, 1, 260 },   // 举
+    { 0x4e43, 3333, 1, -1 },   // 乃
+    { 0x4e48, 0, 0, 263 },   // 么
+    { 0x4e49, 3334, 1, 264 },   // 义
+    { 0x4e4b, 3335, 5, -1 },   // 之
+    { 0x4e4c, 3340, 4, 271 },   // 乌
+    { 0x4e50, 3344, 2, 276 },   // 乐
+    { 0x4e54, 3346, 1, 279 },   // 乔
+    { 0x4e5d, 3347, 8, -1 },   // 九
+    { 0x4e60, 0, 0, 289 },   // 习
+    { 0x4e61, 3355, 1, 290 },   // 乡
+    { 0x4e66, 3356, 2, 292 },   // 书
+    { 0x4e70, 3358, 2, 295 },   // 买
+    { 0x4e71, 3360, 3, 298 },   // 乱
+    { 0x4e7e, 3363, 1, -1 },   // 乾
+    { 0x4e86, 3364, 3, -1 },   // 了
+    { 0x4e89, 3367, 4, 309 },   // 争
+    { 0x4e8b, 3371, 2, -1 },   // 事
+    { 0x4e8c, 3373, 9, -1 },   // 二
+    { 0x4e8e, 3382, 57, 328 },   // 于
+    { 0x4e8f, 0, 0, 397 },   // 亏
+    { 0x4e91, 3439, 8, 398 },   // 云
+    { 0x4e94, 3447, 11, -1 },   // 五
+    { 0x4e95, 3458, 2, -1 },   // 井
+    { 0x4e9a, 0, 0, 421 },   // 亚
+    { 0x4ea4, 3460, 3, -1 },   // 交
+    { 0x4ea7, 0, 0, 425 },   // 产
+    { 0x4ea9, 0, 0, 426 },   // 亩
+    { 0x4eac, 3463, 1, -1 },   // 京
+    { 0x4eae, 3464, 2, -1 },   // 亮
+    { 0x4eb2, 0, 0, 430 },   // 亲
+    { 0x4eb5, 0, 0, 431 },   // 亵
+    { 0x4eba, 3466, 5, -1 },   // 人
+    { 0x4ebf, 3471, 5, 438 },   // 亿
+    { 0x4ec0, 3476, 1, -1 },   // 什
+    { 0x4ec1, 3477, 1, -1 },   // 仁
+    { 0x4ec5, 3478, 1, 446 },   // 仅
+    { 0x4ec6, 3479, 18, -1 },   // 仆
+    { 0x4ec7, 3497, 1, -1 },   // 仇
+    { 0x4ecb, 3498, 1, -1 },   // 介
+    { 0x4ece, 3499, 4, 468 },   // 从
+    { 0x4ed1, 0, 0, 474 },   // 仑
+    { 0x4ed3, 0, 0, 475 },   // 仓
+    { 0x4ed6, 3503, 1, -1 },   // 他
+    { 0x4ed8, 3504, 1, -1 },   // 付
+    { 0x4ed9, 3505, 1, -1 },   // 仙
+    { 0x4ee3, 3506, 3, -1 },   // 代
+    { 0x4eea, 3509, 1, 482 },   // 仪
+    { 0x4eec, 3510, 1, 484 },   // 们
+    { 0x4ef6, 3511, 1, -1 },   // 件
+    { 0x4ef7, 0, 0, 487 },   // 价
+    { 0x4efb, 3512, 1, -1 },   // 任
+    { 0x4eff, 3513, 1, -1 },   // 仿
+    { 0x4f0a, 3514, 7, -1 },   // 伊
+    { 0x4f10, 3521, 1, -1 },   // 伐
+    { 0x4f11, 3522, 1, -1 },   // 休
+    { 0x4f17, 0, 0, 503 },   // 众
+    { 0x4f18, 3523, 1, 504 },   // 优
+    { 0x4f19, 3524, 6, -1 },   // 伙
+    { 0x4f1a, 3530, 3, 512 },   // 会
+    { 0x4f1b, 0, 0, 517 },   // 伛
+    { 0x4f1e, 0, 0, 518 },   // 伞
+    { 0x4f1f, 0, 0, 519 },   // 伟
+    { 0x4f20, 3533, 1, 520 },   // 传
+    { 0x4f24, 0, 0, 522 },   // 伤
+    { 0x4f25, 0, 0, 523 },   // 伥
+    { 0x4f26, 0, 0, 524 },   // 伦
+    { 0x4f27, 0, 0, 525 },   // 伧
+    { 0x4f2a, 0, 0, 526 },   // 伪
+    { 0x4f2b, 0, 0, 527 },   // 伫
+    { 0x4f34, 3534, 1, -1 },   // 伴
+    { 0x4f4d, 3535, 1, -1 },   // 位
+    { 0x4f4f, 3536, 1, -1 },   // 住
+    { 0x4f53, 3537, 4, 531 },   // 体
+    { 0x4f59, 3541, 104, -1 },   // 余
+    { 0x4f5b, 3645, 2, -1 },   // 佛
+    { 0x4f5c, 3647, 2, -1 },   // 作
+    { 0x4f60, 3649, 1, -1 },   // 你
+    { 0x4f63, 3650, 3, 647 },   // 佣
+    { 0x4f65, 0, 0, 651 },   // 佥
+    { 0x4f7f, 3653, 1, -1 },   // 使
+    { 0x4f8d, 3654, 1, -1 },   // 侍
+    { 0x4f9d, 3655, 2, -1 },   // 依
+    { 0x4fa0, 0, 0, 656 },   // 侠
+    { 0x4fa3, 0, 0, 657 },   // 侣
+    { 0x4fa5, 3657, 1, 658 },   // 侥
+    { 0x4fa6, 0, 0, 660 },   // 侦
+    { 0x4fa7, 0, 0, 661 },   // 侧
+    { 0x4fa8, 0, 0, 662 },   // 侨
+    { 0x4fa9, 0, 0, 663 },   // 侩
+    { 0x4faa, 0, 0, 664 },   // 侪
+    { 0x4fac, 0, 0, 665 },   // 侬
+    { 0x4fb5, 3658, 1, -1 },   // 侵
+    { 0x4fdd, 3659, 1, -1 },   // 保
+    { 0x4fe1, 3660, 1, -1 },   // 信
+    { 0x4fe3, 0, 0, 670 },   // 俣
+    { 0x4fe6, 0, 0, 671 },   // 俦
+    { 0x4fe8, 0, 0, 672 },   // 俨
+    { 0x4fe9, 0, 0, 673 },   // 俩
+    { 0x4fea, 0, 0, 674 },   // 俪
+    { 0x4fed, 3661, 3, 675 },   // 俭
+    { 0x4fee, 3664, 2, -1 },   // 修
+    { 0x4fef, 3666, 1, -1 },   // 俯
+    { 0x5019, 3667, 1, -1 },   // 候
+    { 0x501a, 3668, 1, -1 },   // 倚
+    { 0x501b, 3669, 1, -1 },   // 倛
+    { 0x501f, 3670, 12, -1 },   // 借
+    { 0x5026, 3682, 1, -1 },   // 倦
+    { 0x503a, 3683, 1, 699 },   // 债
+    { 0x503e, 0, 0, 701 },   // 倾
+    { 0x5047, 3684, 3, -1 },   // 假
+    { 0x504e, 3687, 1, -1 },   // 偎
+    { 0x505c, 3688, 3, -1 },   // 停
+    { 0x506c, 0, 0, 710 },   // 偬
+    { 0x507b, 0, 0, 711 },   // 偻
+    { 0x507e, 0, 0, 712 },   // 偾
+    { 0x507f, 0, 0, 713 },   // 偿
+    { 0x50a5, 0, 0, 714 },   // 傥
+    { 0x50a7, 0, 0, 715 },   // 傧
+    { 0x50a8, 0, 0, 716 },   // 储
+    { 0x50a9, 0, 0, 717 },   // 傩
+    { 0x50ac, 3691, 1, -1 },   // 催
+    { 0x50b2, 3692, 2, -1 },   // 傲
+    { 0x50bb, 3694, 1, -1 },   // 傻
+    { 0x50cf, 3695, 1, -1 },   // 像
+    { 0x50ee, 3696, 1, -1 },   // 僮
+    { 0x50f5, 3697, 1, -1 },   // 僵
+    { 0x5112, 3698, 1, -1 },   // 儒
+    { 0x513f, 0, 0, 729 },   // 儿
+    { 0x5140, 3699, 1, -1 },   // 兀
+    { 0x5143, 3700, 1, -1 },   // 元
+    { 0x5146, 3701, 2, -1 },   // 兆
+    { 0x5148, 3703, 1, -1 },   // 先
+    { 0x5149, 3704, 1, -1 },   // 光
+    { 0x514b, 3705, 5, -1 },   // 克
+    { 0x514d, 3710, 1, -1 },   // 免
+    { 0x5151, 0, 0, 743 },   // 兑
+    { 0x5156, 0, 0, 744 },   // 兖
+    { 0x515a, 3711, 3, 745 },   // 党
+    { 0x5168, 3714, 1, -1 },   // 全
+    { 0x516b, 3715, 7, -1 },   // 八
+    { 0x516c, 3722, 7, -1 },   // 公
+    { 0x516d, 3729, 9, -1 },   // 六
+    { 0x5170, 3738, 1, 774 },   // 兰
+    { 0x5171, 3739, 1, -1 },   // 共
+    { 0x5173, 3740, 1, 778 },   // 关
+    { 0x5174, 0, 0, 784 },   // 兴
+    { 0x5176, 3741, 1, -1 },   // 其
+    { 0x5178, 3742, 1, -1 },   // 典
+    { 0x5179, 0, 0, 787 },   // 兹
+    { 0x517b, 3743, 1, 788 },   // 养
+    { 0x517c, 3744, 1, -1 },   // 兼
+    { 0x517d, 3745, 1, 791 },   // 兽
+    { 0x5181, 0, 0, 793 },   // 冁
+    { 0x5185, 3746, 5, 794 },   // 内
+    { 0x5188, 0, 0, 801 },   // 冈
+    { 0x5189, 3751, 1, -1 },   // 冉
+    { 0x518c, 0, 0, 803 },   // 册
+    { 0x5197, 3752, 1, -1 },   // 冗
+    { 0x5199, 3753, 1, 805 },   // 写
+    { 0x519b, 0, 0, 807 },   // 军
+    { 0x519c, 3754, 2, 808 },   // 农
+    { 0x51a4, 3756, 1, -1 },   // 冤
+    { 0x51a5, 3757, 1, -1 },   // 冥
+    { 0x51ac, 3758, 2, -1 },   // 冬
+    { 0x51af, 0, 0, 817 },   // 冯
+    { 0x51b0, 3760, 1, -1 },   // 冰
+    { 0x51b2, 3761, 47, 819 },   // 冲
+    { 0x51b3, 3808, 1, 870 },   // 决
+    { 0x51b5, 0, 0, 872 },   // 况
+    { 0x51b6, 3809, 1, -1 },   // 冶
+    { 0x51b7, 3810, 1, -1 },   // 冷
+    { 0x51bb, 0, 0, 875 },   // 冻
+    { 0x51c0, 3811, 2, 876 },   // 净
+    { 0x51c4, 3813, 12, 879 },   // 凄
+    { 0x51c6, 3825, 32, -1 },   // 准
+    { 0x51c9, 3857, 2, 927 },   // 凉
+    { 0x51cc, 3859, 1, -1 },   // 凌
+    { 0x51cf, 0, 0, 931 },   // 减
+    { 0x51d1, 0, 0, 932 },   // 凑
+    { 0x51db, 0, 0, 933 },   // 凛
+    { 0x51dd, 3860, 1, -1 },   // 凝
+    { 0x51e0, 3861, 7, 935 },   // 几
+    { 0x51e4, 3868, 1, 943 },   // 凤
+    { 0x51eb, 0, 0, 945 },   // 凫
+    { 0x51ed, 3869, 6, 946 },   // 凭
+    { 0x51ef, 0, 0, 953 },   // 凯
+    { 0x51f6, 3875, 20, -1 },   // 凶
+    { 0x51fa, 3895, 3, -1 },   // 出
+    { 0x51fb, 3898, 2, 979 },   // 击
+    { 0x51fd, 3900, 1, -1 },   // 函
+    { 0x51ff, 0, 0, 983 },   // 凿
+    { 0x5206, 3901, 4, -1 },   // 分
+    { 0x520d, 0, 0, 990 },   // 刍
+    { 0x5211, 3905, 1, -1 },   // 刑
+    { 0x5212, 3906, 13, 992 },   // 划
+    { 0x5218, 3919, 2, 1007 },   // 刘
+    { 0x5219, 0, 0, 1010 },   // 则
+    { 0x521a, 3921, 2, 1011 },   // 刚
+    { 0x521b, 3923, 2, 1014 },   // 创
+    { 0x5220, 0, 0, 1017 },   // 删
+    { 0x5224, 3925, 1, -1 },   // 判
+    { 0x5229, 3926, 1, -1 },   // 利
+    { 0x522b, 3927, 4, 1020 },   // 别
+    { 0x522d, 0, 0, 1025 },   // 刭
+    { 0x522e, 3931, 9, -1 },   // 刮
+    { 0x5230, 3940, 1, -1 },   // 到
+    { 0x5236, 3941, 30, -1 },   // 制
+    { 0x5239, 0, 0, 1069 },   // 刹
+    { 0x523b, 3971, 3, -1 },   // 刻
+    { 0x523d, 0, 0, 1073 },   // 刽
+    { 0x523f, 0, 0, 1074 },   // 刿
+    { 0x5240, 0, 0, 1075 },   // 剀
+    { 0x5242, 0, 0, 1076 },   // 剂
+    { 0x5243, 3974, 3, -1 },   // 剃
+    { 0x524a, 3977, 2, -1 },   // 削
+    { 0x5250, 0, 0, 1082 },   // 剐
+    { 0x5251, 0, 0, 1083 },   // 剑
+    { 0x5256, 3979, 1, -1 },   // 剖
+    { 0x5265, 3980, 1, 1085 },   // 剥
+    { 0x5267, 0, 0, 1087 },   // 剧
+    { 0x5269, 3981, 1, -1 },   // 剩
+    { 0x526a, 3982, 2, -1 },   // 剪
+    { 0x5272, 3984, 1, -1 },   // 割
+    { 0x529b, 3985, 1, -1 },   // 力
+    { 0x529d, 0, 0, 1093 },   // 劝
+    { 0x529e, 3986, 1, 1094 },   // 办
+    { 0x529f, 3987, 1, -1 },   // 功
+    { 0x52a0, 3988, 1, -1 },   // 加
+    { 0x52a1, 0, 0, 1098 },   // 务
+    { 0x52a2, 0, 0, 1099 },   // 劢
+    { 0x52a8, 0, 0, 1100 },   // 动
+    { 0x52ab, 3989, 1, -1 },   // 劫
+    { 0x52b1, 0, 0, 1102 },   // 励
+    { 0x52b2, 0, 0, 1103 },   // 劲
+    { 0x52b3, 0, 0, 1104 },   // 劳
+    { 0x52bf, 0, 0, 1105 },   // 势
+    { 0x52c3, 3990, 1, -1 },   // 勃
+    { 0x52cb, 3991, 5, 1107 },   // 勋
+    { 0x52e4, 3996, 2, -1 },   // 勤
+    { 0x52fe, 3998, 3, -1 },   // 勾
+    { 0x5300, 0, 0, 1118 },   // 匀
+    { 0x5305, 4001, 4, -1 },   // 包
+    { 0x530f, 4005, 1, -1 },   // 匏
+    { 0x5317, 4006, 4, -1 },   // 北
+    { 0x5326, 0, 0, 1129 },   // 匦
+    { 0x532a, 4010, 1, -1 },   // 匪
+    { 0x532e, 0, 0, 1131 },   // 匮
+    { 0x533a, 4011, 1, 1132 },   // 区
+    { 0x533b, 0, 0, 1135 },   // 医
+    { 0x5341, 4012, 7, -1 },   // 十
+    { 0x5343, 4019, 8, -1 },   // 千
+    { 0x5347, 4027, 4, -1 },   // 升
+    { 0x534a, 4031, 1, -1 },   // 半
+    { 0x534e, 4032, 1, 1162 },   // 华
+    { 0x534f, 4033, 1, 1164 },   // 协
+    { 0x5355, 4034, 5, 1166 },   // 单
+    { 0x5356, 4039, 1, 1172 },   // 卖
+    { 0x5357, 4040, 6, -1 },   // 南
+    { 0x535a, 4046, 3, -1 },   // 博
+    { 0x5360, 4049, 3, -1 },   // 占
+    { 0x5362, 4052, 1, 1188 },   // 卢
+    { 0x5364, 4053, 22, 1190 },   // 卤
+    { 0x5367, 4075, 1, 1213 },   // 卧
+    { 0x536b, 4076, 2, 1215 },   // 卫
+    { 0x5370, 4078, 3, -1 },   // 印
+    { 0x5374, 0, 0, 1221 },   // 却
+    { 0x5375, 4081, 1, -1 },   // 卵
+    { 0x5377, 4082, 35, -1 },   // 卷
+    { 0x5382, 0, 0, 1259 },   // 厂
+    { 0x5385, 0, 0, 1260 },   // 厅
+    { 0x5386, 4117, 16, 1261 },   // 历
+    { 0x5389, 0, 0, 1278 },   // 厉
+    { 0x538b, 4133, 1, 1279 },   // 压
+    { 0x538c, 0, 0, 1282 },   // 厌
+    { 0x538d, 0, 0, 1283 },   // 厍
+    { 0x5395, 0, 0, 1284 },   // 厕
+    { 0x5398, 4134, 7, -1 },   // 厘
+    { 0x539f, 4141, 3, -1 },   // 原
+    { 0x53a2, 0, 0, 1295 },   // 厢
+    { 0x53a3, 0, 0, 1296 },   // 厣
+    { 0x53a6, 0, 0, 1297 },   // 厦
+    { 0x53a8, 4144, 1, 1298 },   // 厨
+    { 0x53a9, 0, 0, 1300 },   // 厩
+    { 0x53ae, 4145, 1, 1301 },   // 厮
+    { 0x53bb, 4146, 1, -1 },   // 去
+    { 0x53bf, 4147, 2, 1304 },   // 县
+    { 0x53c2, 4149, 2, 1307 },   // 参
+    { 0x53cc, 4151, 3, 1311 },   // 双
+    { 0x53cd, 4154, 5, -1 },   // 反
+    { 0x53d1, 4159, 49, 1322 },   // 发
+    { 0x53d6, 4208, 1, -1 },   // 取
+    { 0x53d7, 4209, 2, -1 },   // 受
+    { 0x53d8, 4211, 2, 1378 },   // 变
+    { 0x53d9, 0, 0, 1381 },   // 叙
+    { 0x53e0, 4213, 1, 1382 },   // 叠
+    { 0x53e3, 4214, 5, -1 },   // 口
+    { 0x53e4, 4219, 7, -1 },   // 古
+    { 0x53e6, 4226, 1, -1 },   // 另
+    { 0x53e9, 4227, 1, -1 },   // 叩
+    { 0x53ea, 4228, 9, -1 },   // 只
+    { 0x53ee, 4237, 2, -1 },   // 叮
+    { 0x53ef, 4239, 2, -1 },   // 可
+    { 0x53f0, 4241, 9, -1 },   // 台
+    { 0x53f2, 4250, 1, -1 },   // 史
+    { 0x53f6, 4251, 3, 1436 },   // 叶
+    { 0x53f7, 4254, 1, 1440 },   // 号
+    { 0x53f9, 0, 0, 1442 },   // 叹
+    { 0x53fd, 0, 0, 1443 },   // 叽
+    { 0x5401, 4255, 3, -1 },   // 吁
+    { 0x5403, 4258, 5, -1 },   // 吃
+    { 0x5404, 4263, 2, -1 },   // 各
+    { 0x5408, 4265, 5, -1 },   // 合
+    { 0x5409, 4270, 2, -1 },   // 吉
+    { 0x540a, 4272, 34, -1 },   // 吊
+    { 0x540c, 4306, 3, -1 },   // 同
+    { 0x540d, 4309, 1, -1 },   // 名
+    { 0x540e, 4310, 8, 1501 },   // 后
+    { 0x5410, 4318, 1, -1 },   // 吐
+    { 0x5411, 4319, 4, -1 },   // 向
+    { 0x5413, 0, 0, 1519 },   // 吓
+    { 0x5415, 4323, 1, 1520 },   // 吕
+    { 0x5417, 0, 0, 1522 },   // 吗
+    { 0x541e, 4324, 1, -1 },   // 吞
+    { 0x541f, 4325, 1, -1 },   // 吟
+    { 0x5423, 0, 0, 1525 },   // 吣
+    { 0x5427, 4326, 1, -1 },   // 吧
+    { 0x5428, 0, 0, 1527 },   // 吨
+    { 0x542b, 4327, 1, -1 },   // 含
+    { 0x542c, 0, 0, 1529 },   // 听
+    { 0x542f, 4328, 1, 1530 },   // 启
+    { 0x5434, 0, 0, 1532 },   // 吴
+    { 0x5438, 4329, 1, -1 },   // 吸
+    { 0x5439, 4330, 2, -1 },   // 吹
+    { 0x5446, 4332, 2, -1 },   // 呆
+    { 0x544a, 4334, 2, -1 },   // 告
+    { 0x5450, 0, 0, 1540 },   // 呐
+    { 0x5452, 0, 0, 1541 },   // 呒
+    { 0x5453, 0, 0, 1542 },   // 呓
+    { 0x5455, 0, 0, 1543 },   // 呕
+    { 0x5456, 0, 0, 1544 },   // 呖
+    { 0x5457, 4336, 1, 1545 },   // 呗
+    { 0x5458, 0, 0, 1547 },   // 员
+    { 0x5459, 0, 0, 1548 },   // 呙
+    { 0x545b, 0, 0, 1549 },   // 呛
+    { 0x545c, 0, 0, 1550 },   // 呜
+    { 0x5468, 4337, 2, -1 },   // 周
+    { 0x547c, 4339, 1, -1 },   // 呼
+    { 0x548c, 4340, 2, -1 },   // 和
+    { 0x548e, 4342, 1, -1 },   // 咎
+    { 0x548f, 0, 0, 1560 },   // 咏
+    { 0x5495, 4343, 1, -1 },   // 咕
+    { 0x5499, 0, 0, 1562 },   // 咙
+    { 0x549a, 4344, 1, -1 },   // 咚
+    { 0x549b, 0, 0, 1564 },   // 咛
+    { 0x54a8, 4345, 1, -1 },   // 咨
+    { 0x54aa, 4346, 1, -1 },   // 咪
+    { 0x54ac, 4347, 1, -1 },   // 咬
+    { 0x54af, 4348, 1, -1 },   // 咯
+    { 0x54b8, 4349, 27, -1 },   // 咸
+    { 0x54c0, 4376, 2, -1 },   // 哀
+    { 0x54c1, 4378, 1, -1 },   // 品
+    { 0x54c4, 4379, 3, -1 },   // 哄
+    { 0x54cd, 4382, 1, 1603 },   // 响
+    { 0x54d1, 0, 0, 1605 },   // 哑
+    { 0x54d2, 0, 0, 1606 },   // 哒
+    { 0x54d3, 0, 0, 1607 },   // 哓
+    { 0x54d4, 0, 0, 1608 },   // 哔
+    { 0x54d5, 0, 0, 1609 },   // 哕
+    { 0x54d7, 4383, 6, 1610 },   // 哗
+    { 0x54d9, 0, 0, 1617 },   // 哙
+    { 0x54dc, 0, 0, 1618 },   // 哜
+    { 0x54dd, 0, 0, 1619 },   // 哝
+    { 0x54df, 4389, 1, 1620 },   // 哟
+    { 0x54ea, 4390, 1, -1 },   // 哪
+    { 0x5501, 4391, 1, -1 },   // 唁
+    { 0x5507, 4392, 1, -1 },   // 唇
+    { 0x551b, 0, 0, 1625 },   // 唛
+    { 0x5520, 0, 0, 1626 },   // 唠
+    { 0x5522, 0, 0, 1627 },   // 唢
+    { 0x5524, 0, 0, 1628 },   // 唤
+    { 0x5531, 4393, 1, -1 },   // 唱
+    { 0x553e, 4394, 2, -1 },   // 唾
+    { 0x5546, 4396, 2, -1 },   // 商
+    { 0x5567, 0, 0, 1635 },   // 啧
+    { 0x556c, 0, 0, 1636 },   // 啬
+    { 0x556d, 0, 0, 1637 },   // 啭
+    { 0x556e, 4398, 3, 1638 },   // 啮
+    { 0x5577, 4401, 1, -1 },   // 啷
+    { 0x5578, 0, 0, 1643 },   // 啸
+    { 0x5582, 4402, 2, 1644 },   // 喂
+    { 0x559c, 4404, 1, -1 },   // 喜
+    { 0x559d, 4405, 1, -1 },   // 喝
+    { 0x55a7, 4406, 2, -1 },   // 喧
+    { 0x55b7, 0, 0, 1653 },   // 喷
+    { 0x55bd, 0, 0, 1654 },   // 喽
+    { 0x55be, 0, 0, 1655 },   // 喾
+    { 0x55eb, 0, 0, 1656 },   // 嗫
+    { 0x55f3, 0, 0, 1657 },   // 嗳
+    { 0x5609, 4408, 1, -1 },   // 嘉
+    { 0x5618, 0, 0, 1659 },   // 嘘
+    { 0x5624, 0, 0, 1660 },   // 嘤
+    { 0x5631, 4409, 1, 1661 },   // 嘱
+    { 0x5634, 4410, 1, -1 },   // 嘴
+    { 0x5659, 4411, 1, -1 },   // 噙
+    { 0x565c, 4412, 1, 1665 },   // 噜
+    { 0x566a, 4413, 1, -1 },   // 噪
+    { 0x56a3, 0, 0, 1668 },   // 嚣
+    { 0x56bc, 4414, 1, -1 },   // 嚼
+    { 0x56db, 4415, 11, -1 },   // 四
+    { 0x56de, 4426, 24, -1 },   // 回
+    { 0x56e2, 4450, 1, 1720 },   // 团
+    { 0x56ed, 4451, 2, 1722 },   // 园
+    { 0x56f0, 4453, 5, -1 },   // 困
+    { 0x56f1, 0, 0, 1732 },   // 囱
+    { 0x56f4, 0, 0, 1733 },   // 围
+    { 0x56f5, 0, 0, 1734 },   // 囵
+    { 0x56fa, 4458, 1, -1 },   // 固
+    { 0x56fd, 4459, 3, 1736 },   // 国
+    { 0x56fe, 4462, 2, 1746 },   // 图
+    { 0x5706, 0, 0, 1749 },   // 圆
+    { 0x5708, 4464, 2, -1 },   // 圈
+    { 0x571f, 4466, 3, -1 },   // 土
+    { 0x5723, 4469, 3, 1755 },   // 圣
+    { 0x5728, 4472, 1, -1 },   // 在
+    { 0x5730, 4473, 4, -1 },   // 地
+    { 0x5739, 0, 0, 1764 },   // 圹
+    { 0x573a, 4477, 1, 1765 },   // 场
+    { 0x574f, 0, 0, 1767 },   // 坏
+    { 0x5750, 4478, 3, -1 },   // 坐
+    { 0x5751, 4481, 1, -1 },   // 坑
+    { 0x5757, 0, 0, 1773 },   // 块
+    { 0x575a, 4482, 1, 1774 },   // 坚
+    { 0x575b, 4483, 2, 1776 },   // 坛
+    { 0x575c, 0, 0, 1779 },   // 坜
+    { 0x575d, 0, 0, 1780 },   // 坝
+    { 0x575e, 0, 0, 1781 },   // 坞
+    { 0x575f, 0, 0, 1782 },   // 坟
+    { 0x5760, 0, 0, 1783 },   // 坠
+    { 0x5764, 4485, 1, -1 },   // 坤
+    { 0x5766, 4486, 1, -1 },   // 坦
+    { 0x5771, 4487, 1, -1 },   // 坱
+    { 0x5782, 4488, 2, -1 },   // 垂
+    { 0x5784, 0, 0, 1790 },   // 垄
+    { 0x5786, 0, 0, 1791 },   // 垆
+    { 0x578b, 4490, 1, -1 },   // 型
+    { 0x5792, 0, 0, 1793 },   // 垒
+    { 0x57a6, 4491, 1, 1794 },   // 垦
+    { 0x57a9, 0, 0, 1796 },   // 垩
+    { 0x57ab, 0, 0, 1797 },   // 垫
+    { 0x57ad, 0, 0, 1798 },   // 垭
+    { 0x57b2, 0, 0, 1799 },   // 垲
+    { 0x57c3, 4492, 2, -1 },   // 埃
+    { 0x57ce, 4494, 2, -1 },   // 城
+    { 0x57d4, 4496, 1, -1 },   // 埔
+    { 0x57d8, 0, 0, 1807 },   // 埘
+    { 0x57d9, 0, 0, 1808 },   // 埙
+    { 0x57da, 0, 0, 1809 },   // 埚
+    { 0x57df, 4497, 1, -1 },   // 域
+    { 0x57fa, 4498, 2, -1 },   // 基
+    { 0x5811, 0, 0, 1813 },   // 堑
+    { 0x5815, 0, 0, 1814 },   // 堕
+    { 0x5819, 4500, 1, -1 },   // 堙
+    { 0x585e, 4501, 1, -1 },   // 塞
+    { 0x5883, 4502, 1, -1 },   // 境
+    { 0x5893, 4503, 1, -1 },   // 墓
+    { 0x5899, 4504, 1, 1820 },   // 墙
+    { 0x589e, 4505, 1, -1 },   // 增
+    { 0x58a8, 4506, 1, -1 },   // 墨
+    { 0x58ee, 4507, 2, 1824 },   // 壮
+    { 0x58f0, 4509, 1, 1827 },   // 声
+    { 0x58f3, 4510, 1, 1829 },   // 壳
+    { 0x58f6, 4511, 1, 1831 },   // 壶
+    { 0x58f9, 4512, 1, -1 },   // 壹
+    { 0x5904, 0, 0, 1834 },   // 处
+    { 0x5907, 4513, 1, 1835 },   // 备
+    { 0x590d, 4514, 55, 1837 },   // 复
+    { 0x590f, 4569, 3, -1 },   // 夏
+    { 0x5916, 4572, 2, -1 },   // 外
+    { 0x591a, 4574, 7, -1 },   // 多
+    { 0x591c, 4581, 3, -1 },   // 夜
+    { 0x591f, 0, 0, 1913 },   // 够
+    { 0x5927, 4584, 20, -1 },   // 大
+    { 0x5929, 4604, 6, -1 },   // 天
+    { 0x592a, 4610, 5, -1 },   // 太
+    { 0x5934, 4615, 3, 1961 },   // 头
+    { 0x5938, 4618, 41, -1 },   // 夸
+    { 0x5939, 4659, 2, 2009 },   // 夹
+    { 0x593a, 4661, 1, 2012 },   // 夺
+    { 0x5941, 0, 0, 2014 },   // 奁
+    { 0x5942, 0, 0, 2015 },   // 奂
+    { 0x5947, 4662, 3, -1 },   // 奇
+    { 0x594b, 4665, 1, 2019 },   // 奋
+    { 0x594f, 4666, 1, -1 },   // 奏
+    { 0x5956, 4667, 1, 2022 },   // 奖
+    { 0x5965, 0, 0, 2024 },   // 奥
+    { 0x5973, 4668, 1, -1 },   // 女
+    { 0x5974, 4669, 1, -1 },   // 奴
+    { 0x5978, 4670, 6, -1 },   // 奸
+    { 0x597d, 4676, 7, -1 },   // 好
+    { 0x5982, 4683, 2, -1 },   // 如
+    { 0x5986, 4685, 1, 2044 },   // 妆
+    { 0x5987, 0, 0, 2046 },   // 妇
+    { 0x5988, 0, 0, 2047 },   // 妈
+    { 0x5996, 4686, 1, -1 },   // 妖
+    { 0x59a9, 0, 0, 2049 },   // 妩
+    { 0x59aa, 0, 0, 2050 },   // 妪
+    { 0x59ab, 0, 0, 2051 },   // 妫
+    { 0x59d4, 4687, 1, -1 },   // 委
+    { 0x59d7, 0, 0, 2054 },   // 姗
+    { 0x59dc, 4688, 17, -1 },   // 姜
+    { 0x59f9, 0, 0, 2072 },   // 姹
+    { 0x5a01, 4705, 1, -1 },   // 威
+    { 0x5a04, 0, 0, 2074 },   // 娄
+    { 0x5a05, 0, 0, 2075 },   // 娅
+    { 0x5a06, 0, 0, 2076 },   // 娆
+    { 0x5a07, 0, 0, 2077 },   // 娇
+    { 0x5a08, 0, 0, 2078 },   // 娈
+    { 0x5a31, 0, 0, 2079 },   // 娱
+    { 0x5a32, 0, 0, 2080 },   // 娲
+    { 0x5a34, 0, 0, 2081 },   // 娴
+    { 0x5a62, 4706, 1, -1 },   // 婢
+    { 0x5a74, 0, 0, 2083 },   // 婴
+    { 0x5a75, 0, 0, 2084 },   // 婵
+    { 0x5a76, 0, 0, 2085 },   // 婶
+    { 0x5aaa, 0, 0, 2086 },   // 媪
+    { 0x5acc, 4707, 2, -1 },   // 嫌
+    { 0x5ad2, 0, 0, 2089 },   // 嫒
+    { 0x5ad4, 0, 0, 2090 },   // 嫔
+    { 0x5ae9, 4709, 1, -1 },   // 嫩
+    { 0x5af1, 0, 0, 2092 },   // 嫱
+    { 0x5b09, 4710, 1, -1 },   // 嬉
+    { 0x5b16, 4711, 1, -1 },   // 嬖
+    { 0x5b34, 4712, 1, -1 },   // 嬴
+    { 0x5b37, 0, 0, 2096 },   // 嬷
+    { 0x5b50, 4713, 1, -1 },   // 子
+    { 0x5b57, 4714, 4, -1 },   // 字
+    { 0x5b58, 4718, 1, -1 },   // 存
+    { 0x5b59, 4719, 1, 2103 },   // 孙
+    { 0x5b66, 4720, 2, 2105 },   // 学
+    { 0x5b6a, 0, 0, 2108 },   // 孪
+    { 0x5b81, 0, 0, 2109 },   // 宁
+    { 0x5b87, 4722, 1, -1 },   // 宇
+    { 0x5b89, 4723, 1, -1 },   // 安
+    { 0x5b8b, 4724, 1, -1 },   // 宋
+    { 0x5b97, 4725, 1, -1 },   // 宗
+    { 0x5b98, 4726, 2, -1 },   // 官
+    { 0x5b9a, 4728, 2, -1 },   // 定
+    { 0x5b9d, 4730, 3, 2119 },   // 宝
+    { 0x5b9e, 4733, 3, 2124 },   // 实
+    { 0x5ba0, 0, 0, 2128 },   // 宠
+    { 0x5ba1, 0, 0, 2129 },   // 审
+    { 0x5ba3, 4736, 1, -1 },   // 宣
+    { 0x5ba6, 4737, 1, -1 },   // 宦
+    { 0x5baa, 4738, 1, 2132 },   // 宪
+    { 0x5bab, 4739, 1, 2134 },   // 宫
+    { 0x5bb4, 4740, 1, -1 },   // 宴
+    { 0x5bb6, 4741, 4, -1 },   // 家
+    { 0x5bb9, 4745, 1, -1 },   // 容
+    { 0x5bbd, 4746, 2, 2142 },   // 宽
+    { 0x5bbe, 0, 0, 2146 },   // 宾
+    { 0x5bc4, 4748, 1, -1 },   // 寄
+    { 0x5bc6, 4749, 1, -1 },   // 密
+    { 0x5bc7, 4750, 2, -1 },   // 寇
+    { 0x5bcc, 4752, 1, -1 },   // 富
+    { 0x5bd2, 4753, 1, -1 },   // 寒
+    { 0x5bd3, 4754, 1, -1 },   // 寓
+    { 0x5bdd, 0, 0, 2154 },   // 寝
+    { 0x5be1, 4755, 1, -1 },   // 寡
+    { 0x5bee, 4756, 1, -1 },   // 寮
+    { 0x5bf8, 4757, 1, -1 },   // 寸
+    { 0x5bf9, 4758, 6, 2158 },   // 对
+    { 0x5bfa, 4764, 1, -1 },   // 寺
+    { 0x5bfb, 0, 0, 2174 },   // 寻
+    { 0x5bfc, 4765, 1, 2175 },   // 导
+    { 0x5bff, 4766, 1, 2177 },   // 寿
+    { 0x5c01, 4767, 2, -1 },   // 封
+    { 0x5c04, 4769, 1, -1 },   // 射
+    { 0x5c06, 0, 0, 2182 },   // 将
+    { 0x5c0f, 4770, 5, -1 },   // 小
+    { 0x5c11, 4775, 1, -1 },   // 少
+    { 0x5c14, 4776, 1, 2193 },   // 尔
+    { 0x5c18, 0, 0, 2195 },   // 尘
+    { 0x5c1d, 0, 0, 2196 },   // 尝
+    { 0x5c27, 0, 0, 2197 },   // 尧
+    { 0x5c31, 4777, 2, -1 },   // 就
+    { 0x5c34, 0, 0, 2200 },   // 尴
+    { 0x5c38, 4779, 6, 2201 },   // 尸
+    { 0x5c3d, 4785, 11, 2209 },   // 尽
+    { 0x5c40, 4796, 4, -1 },   // 局
+    { 0x5c42, 0, 0, 2225 },   // 层
+    { 0x5c49, 0, 0, 2226 },   // 屉
+    { 0x5c4a, 0, 0, 2227 },   // 届
+    { 0x5c4b, 4800, 2, -1 },   // 屋
+    { 0x5c4f, 4802, 1, -1 },   // 屏
+    { 0x5c5e, 4803, 1, 2231 },   // 属
+    { 0x5c61, 4804, 1, 2233 },   // 屡
+    { 0x5c66, 0, 0, 2235 },   // 屦
+    { 0x5c6f, 4805, 2, -1 },   // 屯
+    { 0x5c71, 4807, 7, -1 },   // 山
+    { 0x5c7f, 0, 0, 2246 },   // 屿
+    { 0x5c81, 4814, 1, 2247 },   // 岁
+    { 0x5c82, 0, 0, 2249 },   // 岂
+    { 0x5c96, 0, 0, 2250 },   // 岖
+    { 0x5c97, 0, 0, 2251 },   // 岗
+    { 0x5c98, 0, 0, 2252 },   // 岘
+    { 0x5c9a, 0, 0, 2253 },   // 岚
+    { 0x5c9b, 0, 0, 2254 },   // 岛
+    { 0x5cab, 4815, 1, -1 },   // 岫
+    { 0x5cad, 0, 0, 2256 },   // 岭
+    { 0x5cb1, 4816, 1, -1 },   // 岱
+    { 0x5cb3, 4817, 2, -1 },   // 岳
+    { 0x5cbf, 0, 0, 2260 },   // 岿
+    { 0x5cc4, 0, 0, 2261 },   // 峄
+    { 0x5ce1, 0, 0, 2262 },   // 峡
+    { 0x5ce4, 0, 0, 2263 },   // 峤
+    { 0x5ce5, 0, 0, 2264 },   // 峥
+    { 0x5ce6, 0, 0, 2265 },   // 峦
+    { 0x5cf0, 4819, 1, -1 },   // 峰
+    { 0x5d02, 0, 0, 2267 },   // 崂
+    { 0x5d03, 0, 0, 2268 },   // 崃
+    { 0x5d2d, 0, 0, 2269 },   // 崭
+    { 0x5d58, 0, 0, 2270 },   // 嵘
+    { 0x5d5d, 0, 0, 2271 },   // 嵝
+    { 0x5d92, 4820, 1, -1 },   // 嶒
+    { 0x5dc5, 0, 0, 2273 },   // 巅
+    { 0x5de1, 4821, 2, -1 },   // 巡
+    { 0x5de5, 4823, 1, -1 },   // 工
+    { 0x5de6, 4824, 1, -1 },   // 左
+    { 0x5de7, 4825, 2, -1 },   // 巧
+    { 0x5de8, 4827, 1, -1 },   // 巨
+    { 0x5de9, 0, 0, 2283 },   // 巩
+    { 0x5def, 0, 0, 2284 },   // 巯
+    { 0x5df4, 4828, 2, -1 },   // 巴
+    { 0x5df7, 4830, 1, -1 },   // 巷
+    { 0x5e01, 0, 0, 2288 },   // 币
+    { 0x5e02, 4831, 1, -1 },   // 市
+    { 0x5e03, 4832, 1, -1 },   // 布
+    { 0x5e05, 0, 0, 2293 },   // 帅
+    { 0x5e08, 4833, 1, 2294 },   // 师
+    { 0x5e0c, 4834, 1, -1 },   // 希
+    { 0x5e0f, 0, 0, 2298 },   // 帏
+    { 0x5e10, 0, 0, 2299 },   // 帐
+    { 0x5e18, 0, 0, 2300 },   // 帘
+    { 0x5e1c, 0, 0, 2301 },   // 帜
+    { 0x5e1d, 4835, 1, -1 },   // 帝
+    { 0x5e26, 4836, 3, 2303 },   // 带
+    { 0x5e27, 0, 0, 2307 },   // 帧
+    { 0x5e2d, 4839, 2, -1 },   // 席
+    { 0x5e2e, 0, 0, 2310 },   // 帮
+    { 0x5e31, 0, 0, 2311 },   // 帱
+    { 0x5e3b, 0, 0, 2312 },   // 帻
+    { 0x5e3c, 0, 0, 2313 },   // 帼
+    { 0x5e42, 0, 0, 2314 },   // 幂
+    { 0x5e45, 4841, 1, -1 },   // 幅
+    { 0x5e72, 4842, 194, -1 },   // 干
+    { 0x5e73, 5036, 2, -1 },   // 平
+    { 0x5e74, 5038, 5, -1 },   // 年
+    { 0x5e76, 5043, 21, 2530 },   // 并
+    { 0x5e78, 5064, 4, -1 },   // 幸
+    { 0x5e7f, 5068, 3, 2566 },   // 广
+    { 0x5e84, 5071, 2, 2570 },   // 庄
+    { 0x5e86, 5073, 2, 2573 },   // 庆
+    { 0x5e8a, 5075, 1, -1 },   // 床
+    { 0x5e90, 0, 0, 2578 },   // 庐
+    { 0x5e91, 0, 0, 2579 },   // 庑
+    { 0x5e93, 0, 0, 2580 },   // 库
+    { 0x5e94, 5076, 3, 2581 },   // 应
+    { 0x5e97, 5079, 1, -1 },   // 店
+    { 0x5e99, 5080, 1, 2586 },   // 庙
+    { 0x5e9c, 5081, 1, -1 },   // 府
+    { 0x5e9e, 0, 0, 2591 },   // 庞
+    { 0x5e9f, 5082, 1, 2592 },   // 废
+    { 0x5ea7, 5083, 1, -1 },   // 座
+    { 0x5eea, 0, 0, 2595 },   // 廪
+    { 0x5ef6, 5084, 1, -1 },   // 延
+    { 0x5efa, 5085, 1, -1 },   // 建
+    { 0x5f00, 5086, 7, 2599 },   // 开
+    { 0x5f02, 0, 0, 2607 },   // 异
+    { 0x5f03, 5093, 1, 2608 },   // 弃
+    { 0x5f04, 5094, 5, -1 },   // 弄
+    { 0x5f11, 0, 0, 2615 },   // 弑
+    { 0x5f15, 5099, 2, -1 },   // 引
+    { 0x5f18, 5101, 1, -1 },   // 弘
+    { 0x5f20, 5102, 5, 2620 },   // 张
+    { 0x5f25, 5107, 3, 2626 },   // 弥
+    { 0x5f2a, 0, 0, 2630 },   // 弪
+    { 0x5f2f, 0, 0, 2631 },   // 弯
+    { 0x5f39, 5110, 2, 2632 },   // 弹
+    { 0x5f3a, 5112, 3, 2635 },   // 强
+    { 0x5f52, 5115, 2, 2640 },   // 归
+    { 0x5f53, 5117, 3, 2643 },   // 当
+    { 0x5f55, 5120, 1, 2649 },   // 录
+    { 0x5f62, 5121, 1, -1 },   // 形
+    { 0x5f66, 0, 0, 2652 },   // 彦
+    { 0x5f71, 5122, 1, -1 },   // 影
+    { 0x5f7b, 0, 0, 2654 },   // 彻
+    { 0x5f80, 5123, 3, -1 },   // 往
+    { 0x5f81, 5126, 48, -1 },   // 征
+    { 0x5f84, 0, 0, 2706 },   // 径
+    { 0x5f85, 5174, 1, -1 },   // 待
+    { 0x5f88, 5175, 5, -1 },   // 很
+    { 0x5f8b, 5180, 1, -1 },   // 律
+    { 0x5f90, 5181, 1, -1 },   // 徐
+    { 0x5f92, 5182, 1, -1 },   // 徒
+    { 0x5f95, 0, 0, 2716 },   // 徕
+    { 0x5f97, 5183, 2, -1 },   // 得
+    { 0x5fa1, 5185, 6, -1 },   // 御
+    { 0x5fc3, 5191, 7, -1 },   // 心
+    { 0x5fc5, 5198, 1, -1 },   // 必
+    { 0x5fc6, 0, 0, 2845 },   // 忆
+    { 0x5fcf, 0, 0, 2846 },   // 忏
+    { 0x5fd7, 5199, 4, -1 },   // 志
+    { 0x5fd9, 5203, 1, -1 },   // 忙
+    { 0x5fe0, 5204, 1, -1 },   // 忠
+    { 0x5fe7, 5205, 1, 2854 },   // 忧
+    { 0x5feb, 5206, 2, -1 },   // 快
+    { 0x5ffe, 0, 0, 2858 },   // 忾
+    { 0x6000, 5208, 2, 2859 },   // 怀
+    { 0x6001, 0, 0, 2862 },   // 态
+    { 0x6002, 0, 0, 2863 },   // 怂
+    { 0x6003, 0, 0, 2864 },   // 怃
+    { 0x6004, 0, 0, 2865 },   // 怄
+    { 0x6005, 0, 0, 2866 },   // 怅
+    { 0x6006, 0, 0, 2867 },   // 怆
+    { 0x600e, 5210, 1, -1 },   // 怎
+    { 0x6012, 5211, 3, -1 },   // 怒
+    { 0x601c, 0, 0, 2872 },   // 怜
+    { 0x601d, 5214, 1, -1 },   // 思
+    { 0x6025, 5215, 1, -1 },   // 急
+    { 0x6027, 5216, 3, -1 },   // 性
+    { 0x6028, 5219, 1, -1 },   // 怨
+    { 0x602a, 5220, 1, -1 },   // 怪
+    { 0x602b, 5221, 1, -1 },   // 怫
+    { 0x603b, 5222, 2, 2881 },   // 总
+    { 0x603c, 0, 0, 2885 },   // 怼
+    { 0x603f, 0, 0, 2886 },   // 怿
+    { 0x6042, 5224, 1, -1 },   // 恂
+    { 0x604b, 5225, 1, 2888 },   // 恋
+    { 0x6052, 0, 0, 2890 },   // 恒
+    { 0x606f, 5226, 2, -1 },   // 息
+    { 0x6073, 5228, 1, 2893 },   // 恳
+    { 0x6076, 5229, 4, 2895 },   // 恶
+    { 0x6078, 0, 0, 2900 },   // 恸
+    { 0x6079, 0, 0, 2901 },   // 恹
+    { 0x607a, 0, 0, 2902 },   // 恺
+    { 0x607b, 0, 0, 2903 },   // 恻
+    { 0x607c, 0, 0, 2904 },   // 恼
+    { 0x607d, 0, 0, 2905 },   // 恽
+    { 0x6092, 5233, 1, -1 },   // 悒
+    { 0x60a0, 5234, 3, -1 },   // 悠
+    { 0x60a6, 0, 0, 2910 },   // 悦
+    { 0x60ab, 0, 0, 2911 },   // 悫
+    { 0x60ac, 5237, 4, 2912 },   // 悬
+    { 0x60ad, 0, 0, 2917 },   // 悭
+    { 0x60af, 0, 0, 2918 },   // 悯
+    { 0x60b2, 5241, 2, -1 },   // 悲
+    { 0x60b8, 5243, 1, -1 },   // 悸
+    { 0x60c5, 5244, 1, -1 },   // 情
+    { 0x60c7, 5245, 1, -1 },   // 惇
+    { 0x60ca, 5246, 3, 2924 },   // 惊
+    { 0x60e7, 0, 0, 2928 },   // 惧
+    { 0x60e8, 5249, 1, 2929 },   // 惨
+    { 0x60e9, 5250, 1, 2931 },   // 惩
+    { 0x60eb, 0, 0, 2933 },   // 惫
+    { 0x60ec, 0, 0, 2934 },   // 惬
+    { 0x60ed, 0, 0, 2935 },   // 惭
+    { 0x60ee, 0, 0, 2936 },   // 惮
+    { 0x60ef, 0, 0, 2937 },   // 惯
+    { 0x60f4, 5251, 1, -1 },   // 惴
+    { 0x6108, 5252, 1, -1 },   // 愈
+    { 0x610f, 5253, 1, -1 },   // 意
+    { 0x6120, 0, 0, 2941 },   // 愠
+    { 0x6124, 0, 0, 2942 },   // 愤
+    { 0x6126, 0, 0, 2943 },   // 愦
+    { 0x613f, 5254, 1, 2944 },   // 愿
+    { 0x6148, 5255, 1, -1 },   // 慈
+    { 0x614c, 5256, 1, -1 },   // 慌
+    { 0x6151, 0, 0, 2948 },   // 慑
+    { 0x61c8, 5257, 1, -1 },   // 懈
+    { 0x61d1, 0, 0, 2950 },   // 懑
+    { 0x61d2, 0, 0, 2951 },   // 懒
+    { 0x61d4, 5258, 1, 2952 },   // 懔
+    { 0x61ff, 5259, 1, -1 },   // 懿
+    { 0x6206, 0, 0, 2955 },   // 戆
+    { 0x620b, 0, 0, 2956 },   // 戋
+    { 0x620f, 5260, 1, 2957 },   // 戏
+    { 0x6210, 5261, 1, -1 },   // 成
+    { 0x6217, 0, 0, 2960 },   // 戗
+    { 0x6218, 5262, 3, 2961 },   // 战
+    { 0x622c, 5265, 1, 2965 },   // 戬
+    { 0x622f, 0, 0, 2967 },   // 戯
+    { 0x6234, 5266, 1, -1 },   // 戴
+    { 0x6237, 0, 0, 2969 },   // 户
+    { 0x623f, 5267, 1, -1 },   // 房
+    { 0x6240, 5268, 1, -1 },   // 所
+    { 0x6241, 5269, 1, -1 },   // 扁
+    { 0x624b, 5270, 7, -1 },   // 手
+    { 0x624d, 5277, 1, -1 },   // 才
+    { 0x624e, 5278, 16, -1 },   // 扎
+    { 0x6251, 5294, 3, 3004 },   // 扑
+    { 0x6253, 5297, 9, -1 },   // 打
+    { 0x6258, 5306, 27, -1 },   // 托
+    { 0x625b, 5333, 1, -1 },   // 扛
+    { 0x6267, 0, 0, 3048 },   // 执
+    { 0x6269, 0, 0, 3049 },   // 扩
+    { 0x626a, 0, 0, 3050 },   // 扪
+    { 0x626b, 5334, 1, 3051 },   // 扫
+    { 0x626c, 0, 0, 3053 },   // 扬
+    { 0x626f, 5335, 1, -1 },   // 扯
+    { 0x6270, 0, 0, 3055 },   // 扰
+    { 0x6276, 5336, 1, -1 },   // 扶
+    { 0x6279, 5337, 4, -1 },   // 批
+    { 0x627c, 5341, 1, -1 },   // 扼
+    { 0x6291, 5342, 1, -1 },   // 抑
+    { 0x6293, 5343, 2, -1 },   // 抓
+    { 0x6297, 5345, 1, -1 },   // 抗
+    { 0x6298, 5346, 13, -1 },   // 折
+    { 0x629a, 0, 0, 3081 },   // 抚
+    { 0x629b, 0, 0, 3082 },   // 抛
+    { 0x629f, 0, 0, 3083 },   // 抟
+    { 0x62a0, 0, 0, 3084 },   // 抠
+    { 0x62a1, 0, 0, 3085 },   // 抡
+    { 0x62a2, 0, 0, 3086 },   // 抢
+    { 0x62a4, 5359, 1, 3087 },   // 护
+    { 0x62a5, 0, 0, 3089 },   // 报
+    { 0x62ab, 5360, 3, -1 },   // 披
+    { 0x62b1, 5363, 2, -1 },   // 抱
+    { 0x62b5, 5365, 3, -1 },   // 抵
+    { 0x62b9, 5368, 1, -1 },   // 抹
+    { 0x62bd, 5369, 3, -1 },   // 抽
+    { 0x62bf, 5372, 1, -1 },   // 抿
+    { 0x62c2, 5373, 1, -1 },   // 拂
+    { 0x62c5, 5374, 2, 3104 },   // 担
+    { 0x62c6, 5376, 1, -1 },   // 拆
+    { 0x62c8, 5377, 1, -1 },   // 拈
+    { 0x62c9, 5378, 3, -1 },   // 拉
+    { 0x62cc, 5381, 1, -1 },   // 拌
+    { 0x62d3, 5382, 1, -1 },   // 拓
+    { 0x62d4, 5383, 2, -1 },   // 拔
+    { 0x62d7, 5385, 1, -1 },   // 拗
+    { 0x62d9, 5386, 1, -1 },   // 拙
+    { 0x62da, 5387, 1, -1 },   // 拚
+    { 0x62dc, 5388, 1, -1 },   // 拜
+    { 0x62df, 0, 0, 3121 },   // 拟
+    { 0x62e2, 0, 0, 3122 },   // 拢
+    { 0x62e3, 0, 0, 3123 },   // 拣
+    { 0x62e5, 0, 0, 3124 },   // 拥
+    { 0x62e6, 0, 0, 3125 },   // 拦
+    { 0x62e7, 5389, 1, 3126 },   // 拧
+    { 0x62e8, 5390, 1, 3128 },   // 拨
+    { 0x62e9, 0, 0, 3130 },   // 择
+    { 0x62ec, 5391, 1, -1 },   // 括
+    { 0x62ed, 5392, 1, -1 },   // 拭
+    { 0x62f3, 5393, 1, -1 },   // 拳
+    { 0x62fc, 5394, 1, -1 },   // 拼
+    { 0x62fe, 5395, 1, -1 },   // 拾
+    { 0x62ff, 5396, 2, -1 },   // 拿
+    { 0x6302, 5398, 4, 3138 },   // 挂
+    { 0x630c, 5402, 1, -1 },   // 挌
+    { 0x6311, 5403, 2, -1 },   // 挑
+    { 0x631a, 0, 0, 3146 },   // 挚
+    { 0x631b, 0, 0, 3147 },   // 挛
+    { 0x631d, 0, 0, 3148 },   // 挝
+    { 0x631e, 0, 0, 3149 },   // 挞
+    { 0x631f, 0, 0, 3150 },   // 挟
+    { 0x6320, 0, 0, 3151 },   // 挠
+    { 0x6321, 0, 0, 3152 },   // 挡
+    { 0x6322, 0, 0, 3153 },   // 挢
+    { 0x6323, 0, 0, 3154 },   // 挣
+    { 0x6324, 0, 0, 3155 },   // 挤
+    { 0x6325, 5405, 1, 3156 },   // 挥
+    { 0x633d, 5406, 8, -1 },   // 挽
+    { 0x6346, 5414, 1, -1 },   // 捆
+    { 0x6349, 5415, 2, -1 },   // 捉
+    { 0x634d, 5417, 1, -1 },   // 捍
+    { 0x634f, 5418, 1, -1 },   // 捏
+    { 0x635e, 5419, 2, 3174 },   // 捞
+    { 0x635f, 0, 0, 3177 },   // 损
+    { 0x6361, 0, 0, 3178 },   // 捡
+    { 0x6362, 5421, 2, 3179 },   // 换
+    { 0x6363, 5423, 1, 3182 },   // 捣
+    { 0x636e, 5424, 1, 3184 },   // 据
+    { 0x6375, 5425, 1, -1 },   // 捵
+    { 0x6376, 5426, 1, -1 },   // 捶
+    { 0x6388, 5427, 2, -1 },   // 授
+    { 0x6392, 5429, 2, -1 },   // 排
+    { 0x63a3, 5431, 1, -1 },   // 掣
+    { 0x63a8, 5432, 2, -1 },   // 推
+    { 0x63b3, 0, 0, 3197 },   // 掳
+    { 0x63b4, 0, 0, 3198 },   // 掴
+    { 0x63b7, 0, 0, 3199 },   // 掷
+    { 0x63b8, 0, 0, 3200 },   // 掸
+    { 0x63ba, 0, 0, 3201 },   // 掺
+    { 0x63bc, 0, 0, 3202 },   // 掼
+    { 0x63d0, 5434, 4, -1 },   // 提
+    { 0x63e1, 5438, 1, -1 },   // 握
+    { 0x63e9, 5439, 1, -1 },   // 揩
+    { 0x63ea, 5440, 3, -1 },   // 揪
+    { 0x63ed, 5443, 1, -1 },   // 揭
+    { 0x63fd, 0, 0, 3213 },   // 揽
+    { 0x63ff, 0, 0, 3214 },   // 揿
+    { 0x6400, 0, 0, 3215 },   // 搀
+    { 0x6401, 0, 0, 3216 },   // 搁
+    { 0x6402, 0, 0, 3217 },   // 搂
+    { 0x6405, 0, 0, 3218 },   // 搅
+    { 0x640b, 5444, 1, -1 },   // 搋
+    { 0x640f, 5445, 1, -1 },   // 搏
+    { 0x642c, 5446, 1, -1 },   // 搬
+    { 0x642d, 5447, 2, -1 },   // 搭
+    { 0x643a, 0, 0, 3224 },   // 携
+    { 0x6444, 5449, 1, 3225 },   // 摄
+    { 0x6445, 0, 0, 3227 },   // 摅
+    { 0x6446, 5450, 1, 3228 },   // 摆
+    { 0x6447, 0, 0, 3230 },   // 摇
+    { 0x6448, 0, 0, 3231 },   // 摈
+    { 0x644a, 0, 0, 3232 },   // 摊
+    { 0x6467, 5451, 1, -1 },   // 摧
+    { 0x646d, 5452, 1, -1 },   // 摭
+    { 0x6478, 5453, 2, -1 },   // 摸
+    { 0x6484, 0, 0, 3237 },   // 撄
+    { 0x6487, 5455, 1, -1 },   // 撇
+    { 0x6491, 0, 0, 3239 },   // 撑
+    { 0x649a, 5456, 1, -1 },   // 撚
+    { 0x649e, 5457, 2, -1 },   // 撞
+    { 0x64a4, 5459, 1, -1 },   // 撤
+    { 0x64a9, 5460, 1, -1 },   // 撩
+    { 0x64b5, 0, 0, 3245 },   // 撵
+    { 0x64b7, 0, 0, 3246 },   // 撷
+    { 0x64b8, 0, 0, 3247 },   // 撸
+    { 0x64ba, 0, 0, 3248 },   // 撺
+    { 0x64c0, 5461, 1, -1 },   // 擀
+    { 0x64cd, 5462, 1, -1 },   // 操
+    { 0x64de, 0, 0, 3251 },   // 擞
+    { 0x64e2, 5463, 1, -1 },   // 擢
+    { 0x64e6, 5464, 1, -1 },   // 擦
+    { 0x6512, 0, 0, 3254 },   // 攒
+    { 0x652f, 5465, 2, -1 },   // 支
+    { 0x6536, 5467, 1, -1 },   // 收
+    { 0x6539, 5468, 2, -1 },   // 改
+    { 0x653e, 5470, 3, -1 },   // 放
+    { 0x653f, 5473, 1, -1 },   // 政
+    { 0x654c, 5474, 1, 3264 },   // 敌
+    { 0x6559, 5475, 2, -1 },   // 教
+    { 0x655b, 0, 0, 3268 },   // 敛
+    { 0x6562, 5477, 2, -1 },   // 敢
+    { 0x6563, 5479, 2, -1 },   // 散
+    { 0x6566, 5481, 1, -1 },   // 敦
+    { 0x656c, 5482, 1, -1 },   // 敬
+    { 0x6570, 5483, 4, 3275 },   // 数
+    { 0x6572, 5487, 1, -1 },   // 敲
+    { 0x6574, 5488, 4, -1 },   // 整
+    { 0x6587, 5492, 3, -1 },   // 文
+    { 0x658b, 0, 0, 3304 },   // 斋
+    { 0x6593, 0, 0, 3305 },   // 斓
+    { 0x6597, 5495, 75, -1 },   // 斗
+    { 0x65a9, 0, 0, 3385 },   // 斩
+    { 0x65ab, 5570, 1, -1 },   // 斫
+    { 0x65ad, 5571, 1, 3387 },   // 断
+    { 0x65b0, 5572, 3, -1 },   // 新
+    { 0x65b2, 5575, 1, -1 },   // 斲
+    { 0x65b9, 5576, 2, -1 },   // 方
+    { 0x65bd, 5578, 1, -1 },   // 施
+    { 0x65c1, 5579, 2, -1 },   // 旁
+    { 0x65c5, 5581, 1, -1 },   // 旅
+    { 0x65cb, 5582, 2, -1 },   // 旋
+    { 0x65cf, 5584, 1, -1 },   // 族
+    { 0x65e0, 5585, 4, 3404 },   // 无
+    { 0x65e5, 5589, 4, -1 },   // 日
+    { 0x65e7, 5593, 4, 3414 },   // 旧
+    { 0x65f1, 5597, 1, -1 },   // 旱
+    { 0x65f6, 5598, 2, 3422 },   // 时
+    { 0x65f7, 0, 0, 3425 },   // 旷
+    { 0x6606, 5600, 10, -1 },   // 昆
+    { 0x660a, 5610, 1, -1 },   // 昊
+    { 0x660e, 5611, 5, -1 },   // 明
+    { 0x6619, 0, 0, 3442 },   // 昙
+    { 0x661f, 5616, 3, -1 },   // 星
+    { 0x6625, 5619, 2, -1 },   // 春
+    { 0x662f, 5621, 1, -1 },   // 是
+    { 0x6635, 5622, 1, -1 },   // 昵
+    { 0x663c, 0, 0, 3451 },   // 昼
+    { 0x663e, 5623, 1, 3452 },   // 显
+    { 0x6643, 5624, 1, -1 },   // 晃
+    { 0x664b, 0, 0, 3464 },   // 晋
+    { 0x6652, 5625, 2, 3465 },   // 晒
+    { 0x6653, 0, 0, 3468 },   // 晓
+    { 0x6654, 0, 0, 3469 },   // 晔
+    { 0x6655, 0, 0, 3470 },   // 晕
+    { 0x6656, 0, 0, 3471 },   // 晖
+    { 0x665a, 5627, 1, -1 },   // 晚
+    { 0x665e, 5628, 1, -1 },   // 晞
+    { 0x6668, 5629, 1, -1 },   // 晨
+    { 0x666e, 5630, 1, -1 },   // 普
+    { 0x667e, 5631, 1, -1 },   // 晾
+    { 0x6682, 0, 0, 3477 },   // 暂
+    { 0x6697, 5632, 4, -1 },   // 暗
+    { 0x66a7, 0, 0, 3482 },   // 暧
+    { 0x66b4, 5636, 1, -1 },   // 暴
+    { 0x66f2, 5637, 7, -1 },   // 曲
+    { 0x66f4, 5644, 3, -1 },   // 更
+    { 0x66fe, 5647, 1, -1 },   // 曾
+    { 0x6708, 5648, 3, -1 },   // 月
+    { 0x6709, 5651, 10, -1 },   // 有
+    { 0x671d, 5661, 2, -1 },   // 朝
+    { 0x6726, 5663, 1, -1 },   // 朦
+    { 0x6728, 5664, 6, -1 },   // 木
+    { 0x672a, 5670, 1, -1 },   // 未
+    { 0x672c, 5671, 2, -1 },   // 本
+    { 0x672f, 5673, 2, 3525 },   // 术
+    { 0x6731, 5675, 3, -1 },   // 朱
+    { 0x6734, 5678, 19, -1 },   // 朴
+    { 0x673a, 5697, 1, 3551 },   // 机
+    { 0x6740, 0, 0, 3556 },   // 杀
+    { 0x6742, 5698, 3, 3557 },   // 杂
+    { 0x6743, 0, 0, 3561 },   // 权
+    { 0x6746, 5701, 3, -1 },   // 杆
+    { 0x674e, 5704, 1, -1 },   // 李
+    { 0x6750, 5705, 1, -1 },   // 材
+    { 0x6751, 5706, 2, -1 },   // 村
+    { 0x675c, 5708, 2, -1 },   // 杜
+    { 0x675e, 5710, 1, -1 },   // 杞
+    { 0x675f, 5711, 1, -1 },   // 束
+    { 0x6760, 5712, 2, 3574 },   // 杠
+    { 0x6761, 5714, 1, 3577 },   // 条
+    { 0x6765, 0, 0, 3579 },   // 来
+    { 0x6768, 5715, 1, 3580 },   // 杨
+    { 0x6769, 0, 0, 3582 },   // 杩
+    { 0x676f, 5716, 2, -1 },   // 杯
+    { 0x6770, 5718, 2, 3585 },   // 杰
+    { 0x677e, 5720, 33, -1 },   // 松
+    { 0x677f, 5753, 1, -1 },   // 板
+    { 0x6781, 0, 0, 3623 },   // 极
+    { 0x6784, 0, 0, 3624 },   // 构
+    { 0x6797, 5754, 3, -1 },   // 林
+    { 0x679c, 5757, 3, -1 },   // 果
+    { 0x679d, 5760, 1, -1 },   // 枝
+    { 0x679e, 0, 0, 3632 },   // 枞
+    { 0x67a2, 0, 0, 3633 },   // 枢
+    { 0x67a3, 0, 0, 3634 },   // 枣
+    { 0x67a5, 0, 0, 3635 },   // 枥
+    { 0x67a8, 0, 0, 3636 },   // 枨
+    { 0x67aa, 5761, 1, 3637 },   // 枪
+    { 0x67ab, 0, 0, 3639 },   // 枫
+    { 0x67ad, 0, 0, 3640 },   // 枭
+    { 0x67af, 5762, 1, -1 },   // 枯
+    { 0x67b6, 5763, 1, -1 },   // 架
+    { 0x67d0, 5764, 1, -1 },   // 某
+    { 0x67d3, 5765, 1, -1 },   // 染
+    { 0x67dc, 5766, 2, 3646 },   // 柜
+    { 0x67e0, 0, 0, 3649 },   // 柠
+    { 0x67e5, 5768, 1, -1 },   // 查
+    { 0x67f1, 5769, 1, -1 },   // 柱
+    { 0x67f3, 5770, 1, -1 },   // 柳
+    { 0x67fd, 0, 0, 3653 },   // 柽
+    { 0x6800, 0, 0, 3654 },   // 栀
+    { 0x6805, 0, 0, 3655 },   // 栅
+    { 0x6807, 5771, 6, 3656 },   // 标
+    { 0x6808, 0, 0, 3663 },   // 栈
+    { 0x6809, 5777, 1, 3664 },   // 栉
+    { 0x680a, 0, 0, 3666 },   // 栊
+    { 0x680b, 5778, 1, 3667 },   // 栋
+    { 0x680c, 0, 0, 3669 },   // 栌
+    { 0x680e, 0, 0, 3670 },   // 栎
+    { 0x680f, 0, 0, 3671 },   // 栏
+    { 0x6811, 5779, 3, 3672 },   // 树
+    { 0x6816, 0, 0, 3676 },   // 栖
+    { 0x6817, 5782, 2, -1 },   // 栗
+    { 0x6821, 5784, 1, -1 },   // 校
+    { 0x6837, 5785, 1, 3680 },   // 样
+    { 0x683c, 5786, 3, -1 },   // 格
+    { 0x683e, 0, 0, 3686 },   // 栾
+    { 0x6842, 5789, 1, -1 },   // 桂
+    { 0x6846, 5790, 1, -1 },   // 框
+    { 0x684c, 5791, 2, -1 },   // 桌
+    { 0x6851, 5793, 1, -1 },   // 桑
+    { 0x6860, 0, 0, 3693 },   // 桠
+    { 0x6861, 0, 0, 3694 },   // 桡
+    { 0x6862, 5794, 1, 3695 },   // 桢
+    { 0x6863, 0, 0, 3697 },   // 档
+    { 0x6864, 0, 0, 3698 },   // 桤
+    { 0x6865, 5795, 1, 3699 },   // 桥
+    { 0x6866, 0, 0, 3701 },   // 桦
+    { 0x6867, 0, 0, 3702 },   // 桧
+    { 0x6868, 0, 0, 3703 },   // 桨
+    { 0x6869, 0, 0, 3704 },   // 桩
+    { 0x6881, 5796, 3, -1 },   // 梁
+    { 0x68a6, 5799, 2, 3708 },   // 梦
+    { 0x68a8, 5801, 1, -1 },   // 梨
+    { 0x68af, 5802, 1, -1 },   // 梯
+    { 0x68b0, 5803, 2, -1 },   // 械
+    { 0x68bc, 0, 0, 3715 },   // 梼
+    { 0x68c0, 0, 0, 3716 },   // 检
+    { 0x68c2, 0, 0, 3717 },   // 棂
+    { 0x68c9, 5805, 2, -1 },   // 棉
+    { 0x68d2, 5807, 1, -1 },   // 棒
+    { 0x68eb, 5808, 1, -1 },   // 棫
+    { 0x68ee, 5809, 1, -1 },   // 森
+    { 0x68f1, 5810, 13, -1 },   // 棱
+    { 0x68fa, 5823, 1, -1 },   // 棺
+    { 0x6901, 0, 0, 3737 },   // 椁
+    { 0x690d, 5824, 1, -1 },   // 植
+    { 0x6912, 5825, 1, -1 },   // 椒
+    { 0x691f, 0, 0, 3740 },   // 椟
+    { 0x6920, 0, 0, 3741 },   // 椠
+    { 0x6922, 0, 0, 3742 },   // 椢
+    { 0x6924, 0, 0, 3743 },   // 椤
+    { 0x692d, 0, 0, 3744 },   // 椭
+    { 0x6930, 5826, 1, -1 },   // 椰
+    { 0x697c, 0, 0, 3746 },   // 楼
+    { 0x6984, 0, 0, 3747 },   // 榄
+    { 0x6987, 0, 0, 3748 },   // 榇
+    { 0x6988, 0, 0, 3749 },   // 榈
+    { 0x6989, 0, 0, 3750 },   // 榉
+    { 0x69a8, 5827, 1, -1 },   // 榨
+    { 0x69db, 0, 0, 3752 },   // 槛
+    { 0x69df, 0, 0, 3753 },   // 槟
+    { 0x69e0, 0, 0, 3754 },   // 槠
+    { 0x6a21, 5828, 3, -1 },   // 模
+    { 0x6a2a, 5831, 4, 3759 },   // 横
+    { 0x6a2f, 0, 0, 3764 },   // 樯
+    { 0x6a31, 0, 0, 3765 },   // 樱
+    { 0x6a35, 5835, 1, -1 },   // 樵
+    { 0x6a65, 0, 0, 3767 },   // 橥
+    { 0x6a71, 0, 0, 3768 },   // 橱
+    { 0x6a79, 0, 0, 3769 },   // 橹
+    { 0x6a7c, 0, 0, 3770 },   // 橼
+    { 0x6aa9, 0, 0, 3771 },   // 檩
+    { 0x6b22, 0, 0, 3772 },   // 欢
+    { 0x6b24, 0, 0, 3773 },   // 欤
+    { 0x6b27, 5836, 1, 3774 },   // 欧
+    { 0x6b32, 5837, 6, -1 },   // 欲
+    { 0x6b3a, 5843, 1, -1 },   // 欺
+    { 0x6b4c, 5844, 1, -1 },   // 歌
+    { 0x6b63, 5845, 1, -1 },   // 正
+    { 0x6b66, 5846, 1, -1 },   // 武
+    { 0x6b79, 5847, 1, -1 },   // 歹
+    { 0x6b7b, 5848, 1, -1 },   // 死
+    { 0x6b7c, 0, 0, 3790 },   // 歼
+    { 0x6b81, 0, 0, 3791 },   // 殁
+    { 0x6b87, 0, 0, 3792 },   // 殇
+    { 0x6b8b, 5849, 2, 3793 },   // 残
+    { 0x6b92, 0, 0, 3796 },   // 殒
+    { 0x6b93, 0, 0, 3797 },   // 殓
+    { 0x6b96, 5851, 1, -1 },   // 殖
+    { 0x6b9a, 0, 0, 3799 },   // 殚
+    { 0x6ba1, 0, 0, 3800 },   // 殡
+    { 0x6bb4, 5852, 1, 3801 },   // 殴
+    { 0x6bb7, 5853, 2, -1 },   // 殷
+    { 0x6bbf, 5855, 2, -1 },   // 殿
+    { 0x6bc1, 5857, 1, 3807 },   // 毁
+    { 0x6bc2, 0, 0, 3809 },   // 毂
+    { 0x6bcd, 5858, 2, -1 },   // 母
+    { 0x6bcf, 5860, 1, -1 },   // 每
+    { 0x6bd5, 5861, 1, 3813 },   // 毕
+    { 0x6bd9, 0, 0, 3815 },   // 毙
+    { 0x6bdb, 5862, 2, -1 },   // 毛
+    { 0x6be1, 0, 0, 3818 },   // 毡
+    { 0x6beb, 5864, 2, -1 },   // 毫
+    { 0x6bf5, 0, 0, 3821 },   // 毵
+    { 0x6c07, 0, 0, 3822 },   // 氇
+    { 0x6c14, 5866, 2, 3823 },   // 气
+    { 0x6c22, 0, 0, 3826 },   // 氢
+    { 0x6c24, 5868, 1, -1 },   // 氤
+    { 0x6c29, 0, 0, 3828 },   // 氩
+    { 0x6c32, 0, 0, 3829 },   // 氲
+    { 0x6c34, 5869, 5, -1 },   // 水
+    { 0x6c38, 5874, 2, -1 },   // 永
+    { 0x6c42, 5876, 2, -1 },   // 求
+    { 0x6c47, 5878, 4, 3840 },   // 汇
+    { 0x6c49, 5882, 1, 3845 },   // 汉
+    { 0x6c5f, 5883, 1, -1 },   // 江
+    { 0x6c60, 5884, 1, -1 },   // 池
+    { 0x6c61, 5885, 1, -1 },   // 污
+    { 0x6c64, 5886, 4, 3850 },   // 汤
+    { 0x6c79, 5890, 1, 3855 },   // 汹
+    { 0x6c88, 5891, 13, -1 },   // 沈
+    { 0x6c89, 5904, 2, -1 },   // 沉
+    { 0x6c99, 5906, 2, -1 },   // 沙
+    { 0x6c9f, 5908, 1, 3881 },   // 沟
+    { 0x6ca1, 5909, 5, 3883 },   // 没
+    { 0x6ca3, 0, 0, 3890 },   // 沣
+    { 0x6ca4, 5914, 1, 3891 },   // 沤
+    { 0x6ca5, 5915, 1, 3893 },   // 沥
+    { 0x6ca6, 0, 0, 3895 },   // 沦
+    { 0x6ca7, 0, 0, 3896 },   // 沧
+    { 0x6ca9, 0, 0, 3897 },   // 沩
+    { 0x6caa, 0, 0, 3898 },   // 沪
+    { 0x6cb3, 5916, 2, -1 },   // 河
+    { 0x6cb9, 5918, 3, -1 },   // 油
+    { 0x6cbb, 5921, 1, -1 },   // 治
+    { 0x6cbe, 5922, 2, -1 },   // 沾
+    { 0x6cbf, 5924, 1, -1 },   // 沿
+    { 0x6cc4, 5925, 1, -1 },   // 泄
+    { 0x6cdb, 5926, 1, -1 },   // 泛
+    { 0x6cde, 0, 0, 3910 },   // 泞
+    { 0x6ce1, 5927, 2, -1 },   // 泡
+    { 0x6ce2, 5929, 2, -1 },   // 波
+    { 0x6ce8, 5931, 15, -1 },   // 注
+    { 0x6cea, 5946, 2, 3930 },   // 泪
+    { 0x6cf1, 5948, 1, -1 },   // 泱
+    { 0x6cf3, 5949, 1, -1 },   // 泳
+    { 0x6cf6, 0, 0, 3935 },   // 泶
+    { 0x6cf7, 0, 0, 3936 },   // 泷
+    { 0x6cf8, 0, 0, 3937 },   // 泸
+    { 0x6cfa, 0, 0, 3938 },   // 泺
+    { 0x6cfb, 0, 0, 3939 },   // 泻
+    { 0x6cfc, 0, 0, 3940 },   // 泼
+    { 0x6cfd, 0, 0, 3941 },   // 泽
+    { 0x6cfe, 0, 0, 3942 },   // 泾
+    { 0x6d01, 0, 0, 3943 },   // 洁
+    { 0x6d12, 0, 0, 3944 },   // 洒
+    { 0x6d17, 5950, 3, -1 },   // 洗
+    { 0x6d1b, 5953, 1, -1 },   // 洛
+    { 0x6d1e, 5954, 1, -1 },   // 洞
+    { 0x6d2a, 5955, 2, -1 },   // 洪
+    { 0x6d3c, 0, 0, 3953 },   // 洼
+    { 0x6d41, 5957, 3, -1 },   // 流
+    { 0x6d43, 0, 0, 3958 },   // 浃
+    { 0x6d45, 5960, 1, 3959 },   // 浅
+    { 0x6d46, 0, 0, 3961 },   // 浆
+    { 0x6d47, 0, 0, 3962 },   // 浇
+    { 0x6d48, 0, 0, 3963 },   // 浈
+    { 0x6d4a, 0, 0, 3964 },   // 浊
+    { 0x6d4b, 5961, 1, 3965 },   // 测
+    { 0x6d4d, 0, 0, 3967 },   // 浍
+    { 0x6d4e, 0, 0, 3968 },   // 济
+    { 0x6d4f, 0, 0, 3969 },   // 浏
+    { 0x6d51, 5962, 2, 3970 },   // 浑
+    { 0x6d52, 0, 0, 3973 },   // 浒
+    { 0x6d53, 5964, 1, 3974 },   // 浓
+    { 0x6d54, 0, 0, 3976 },   // 浔
+    { 0x6d5a, 5965, 2, -1 },   // 浚
+    { 0x6d69, 5967, 2, -1 },   // 浩
+    { 0x6d6a, 5969, 2, -1 },   // 浪
+    { 0x6d6e, 5971, 3, -1 },   // 浮
+    { 0x6d77, 5974, 2, -1 },   // 海
+    { 0x6d78, 5976, 1, -1 },   // 浸
+    { 0x6d82, 5977, 8, 3989 },   // 涂
+    { 0x6d8c, 5985, 10, -1 },   // 涌
+    { 0x6d9b, 0, 0, 4008 },   // 涛
+    { 0x6d9d, 0, 0, 4009 },   // 涝
+    { 0x6d9e, 0, 0, 4010 },   // 涞
+    { 0x6d9f, 0, 0, 4011 },   // 涟
+    { 0x6da0, 0, 0, 4012 },   // 涠
+    { 0x6da1, 0, 0, 4013 },   // 涡
+    { 0x6da3, 0, 0, 4014 },   // 涣
+    { 0x6da4, 0, 0, 4015 },   // 涤
+    { 0x6da6, 0, 0, 4016 },   // 润
+    { 0x6da7, 0, 0, 4017 },   // 涧
+    { 0x6da8, 0, 0, 4018 },   // 涨
+    { 0x6da9, 5995, 1, 4019 },   // 涩
+    { 0x6db3, 5996, 1, -1 },   // 涳
+    { 0x6db8, 5997, 1, -1 },   // 涸
+    { 0x6dc0, 5998, 8, -1 },   // 淀
+    { 0x6dcb, 6006, 1, -1 },   // 淋
+    { 0x6dd1, 6007, 1, -1 },   // 淑
+    { 0x6de1, 6008, 1, -1 },   // 淡
+    { 0x6deb, 6009, 2, -1 },   // 淫
+    { 0x6dec, 6011, 1, -1 },   // 淬
+    { 0x6df1, 6012, 1, -1 },   // 深
+    { 0x6df3, 6013, 1, -1 },   // 淳
+    { 0x6e0a, 6014, 2, 4040 },   // 渊
+    { 0x6e0c, 0, 0, 4043 },   // 渌
+    { 0x6e0d, 0, 0, 4044 },   // 渍
+    { 0x6e0e, 0, 0, 4045 },   // 渎
+    { 0x6e10, 0, 0, 4046 },   // 渐
+    { 0x6e11, 0, 0, 4047 },   // 渑
+    { 0x6e14, 0, 0, 4048 },   // 渔
+    { 0x6e16, 0, 0, 4049 },   // 渖
+    { 0x6e17, 6016, 1, 4050 },   // 渗
+    { 0x6e20, 6017, 1, -1 },   // 渠
+    { 0x6e29, 6018, 1, 4053 },   // 温
+    { 0x6e2f, 6019, 1, -1 },   // 港
+    { 0x6e38, 6020, 53, -1 },   // 游
+    { 0x6e56, 6073, 1, -1 },   // 湖
+    { 0x6e58, 6074, 1, -1 },   // 湘
+    { 0x6e6e, 6075, 1, -1 },   // 湮
+    { 0x6e7e, 0, 0, 4113 },   // 湾
+    { 0x6e7f, 0, 0, 4114 },   // 湿
+    { 0x6e83, 0, 0, 4115 },   // 溃
+    { 0x6e85, 0, 0, 4116 },   // 溅
+    { 0x6e86, 0, 0, 4117 },   // 溆
+    { 0x6e9f, 6076, 1, -1 },   // 溟
+    { 0x6eb2, 6077, 1, -1 },   // 溲
+    { 0x6ec3, 6078, 1, -1 },   // 滃
+    { 0x6ed1, 6079, 1, -1 },   // 滑
+    { 0x6ed7, 0, 0, 4122 },   // 滗
+    { 0x6eda, 0, 0, 4123 },   // 滚
+    { 0x6ede, 0, 0, 4124 },   // 滞
+    { 0x6edf, 0, 0, 4125 },   // 滟
+    { 0x6ee0, 0, 0, 4126 },   // 滠
+    { 0x6ee1, 6080, 2, 4127 },   // 满
+    { 0x6ee2, 0, 0, 4130 },   // 滢
+    { 0x6ee4, 0, 0, 4131 },   // 滤
+    { 0x6ee5, 0, 0, 4132 },   // 滥
+    { 0x6ee6, 0, 0, 4133 },   // 滦
+    { 0x6ee8, 6082, 1, 4134 },   // 滨
+    { 0x6ee9, 6083, 2, 4136 },   // 滩
+    { 0x6f02, 6085, 1, -1 },   // 漂
+    { 0x6f13, 6086, 4, -1 },   // 漓
+    { 0x6f15, 6090, 1, -1 },   // 漕
+    { 0x6f20, 6091, 1, -1 },   // 漠
+    { 0x6f24, 0, 0, 4146 },   // 漤
+    { 0x6f2b, 6092, 2, -1 },   // 漫
+    { 0x6f46, 0, 0, 4149 },   // 潆
+    { 0x6f47, 0, 0, 4150 },   // 潇
+    { 0x6f4b, 0, 0, 4151 },   // 潋
+    { 0x6f4d, 0, 0, 4152 },   // 潍
+    { 0x6f5c, 6094, 2, 4153 },   // 潜
+    { 0x6f6d, 6096, 1, -1 },   // 潭
+    { 0x6f6e, 6097, 1, -1 },   // 潮
+    { 0x6f74, 0, 0, 4160 },   // 潴
+    { 0x6f84, 6098, 1, -1 },   // 澄
+    { 0x6f92, 6099, 1, -1 },   // 澒
+    { 0x6f9c, 0, 0, 4163 },   // 澜
+    { 0x6fb9, 6100, 2, -1 },   // 澹
+    { 0x6fc0, 6102, 1, -1 },   // 激
+    { 0x6fd1, 0, 0, 4167 },   // 濑
+    { 0x6fd2, 0, 0, 4168 },   // 濒
+    { 0x704f, 0, 0, 4169 },   // 灏
+    { 0x706b, 6103, 4, -1 },   // 火
+    { 0x706d, 0, 0, 4175 },   // 灭
+    { 0x706f, 0, 0, 4176 },   // 灯
+    { 0x7070, 6107, 1, -1 },   // 灰
+    { 0x7075, 6108, 1, 4179 },   // 灵
+    { 0x707e, 0, 0, 4181 },   // 灾
+    { 0x707f, 0, 0, 4182 },   // 灿
+    { 0x7080, 0, 0, 4183 },   // 炀
+    { 0x7086, 6109, 1, -1 },   // 炆
+    { 0x7089, 0, 0, 4185 },   // 炉
+    { 0x7092, 6110, 1, -1 },   // 炒
+    { 0x7096, 6111, 1, 4187 },   // 炖
+    { 0x709c, 0, 0, 4189 },   // 炜
+    { 0x709d, 0, 0, 4190 },   // 炝
+    { 0x70ae, 6112, 1, -1 },   // 炮
+    { 0x70b8, 6113, 1, -1 },   // 炸
+    { 0x70b9, 6114, 7, 4193 },   // 点
+    { 0x70bc, 6121, 12, 4202 },   // 炼
+    { 0x70bd, 0, 0, 4215 },   // 炽
+    { 0x70c1, 0, 0, 4216 },   // 烁
+    { 0x70c2, 0, 0, 4217 },   // 烂
+    { 0x70c3, 0, 0, 4218 },   // 烃
+    { 0x70d8, 6133, 2, -1 },   // 烘
+    { 0x70db, 0, 0, 4221 },   // 烛
+    { 0x70df, 6135, 2, 4222 },   // 烟
+    { 0x70e4, 6137, 2, -1 },   // 烤
+    { 0x70e6, 0, 0, 4227 },   // 烦
+    { 0x70e7, 6139, 1, 4228 },   // 烧
+    { 0x70e8, 0, 0, 4230 },   // 烨
+    { 0x70e9, 6140, 1, 4231 },   // 烩
+    { 0x70eb, 6141, 6, 4233 },   // 烫
+    { 0x70ec, 6147, 1, 4241 },   // 烬
+    { 0x70ed, 0, 0, 4243 },   // 热
+    { 0x70f9, 6148, 1, -1 },   // 烹
+    { 0x7115, 0, 0, 4245 },   // 焕
+    { 0x7116, 0, 0, 4246 },   // 焖
+    { 0x7118, 0, 0, 4247 },   // 焘
+    { 0x7119, 6149, 1, -1 },   // 焙
+    { 0x714e, 6150, 1, -1 },   // 煎
+    { 0x7167, 6151, 2, -1 },   // 照
+    { 0x7168, 6153, 1, -1 },   // 煨
+    { 0x716e, 6154, 2, -1 },   // 煮
+    { 0x718f, 6156, 7, -1 },   // 熏
+    { 0x71ac, 6163, 1, -1 },   // 熬
+    { 0x71ce, 6164, 1, -1 },   // 燎
+    { 0x71d5, 6165, 1, -1 },   // 燕
+    { 0x7206, 6166, 1, -1 },   // 爆
+    { 0x7230, 6167, 1, -1 },   // 爰
+    { 0x7231, 6168, 2, 4267 },   // 爱
+    { 0x7237, 0, 0, 4270 },   // 爷
+    { 0x723d, 6170, 1, -1 },   // 爽
+    { 0x7247, 6171, 2, -1 },   // 片
+    { 0x7248, 6173, 1, -1 },   // 版
+    { 0x724d, 0, 0, 4275 },   // 牍
+    { 0x7259, 6174, 1, -1 },   // 牙
+    { 0x725b, 6175, 1, -1 },   // 牛
+    { 0x7266, 0, 0, 4278 },   // 牦
+    { 0x7269, 6176, 1, -1 },   // 物
+    { 0x7275, 6177, 2, 4280 },   // 牵
+    { 0x7279, 6179, 2, -1 },   // 特
+    { 0x727a, 0, 0, 4286 },   // 牺
+    { 0x728a, 0, 0, 4287 },   // 犊
+    { 0x72b6, 0, 0, 4288 },   // 状
+    { 0x72b7, 0, 0, 4289 },   // 犷
+    { 0x72b9, 6181, 1, 4290 },   // 犹
+    { 0x72c2, 6182, 1, -1 },   // 狂
+    { 0x72c8, 0, 0, 4295 },   // 狈
+    { 0x72d0, 6183, 1, -1 },   // 狐
+    { 0x72de, 0, 0, 4297 },   // 狞
+    { 0x72ec, 6184, 2, 4298 },   // 独
+    { 0x72ed, 0, 0, 4301 },   // 狭
+    { 0x72ee, 0, 0, 4302 },   // 狮
+    { 0x72ef, 0, 0, 4303 },   // 狯
+    { 0x72f0, 0, 0, 4304 },   // 狰
+    { 0x72f1, 6186, 1, 4305 },   // 狱
+    { 0x72f2, 0, 0, 4307 },   // 狲
+    { 0x7303, 0, 0, 4308 },   // 猃
+    { 0x730e, 0, 0, 4309 },   // 猎
+    { 0x7315, 0, 0, 4310 },   // 猕
+    { 0x731b, 6187, 1, -1 },   // 猛
+    { 0x7321, 0, 0, 4312 },   // 猡
+    { 0x732a, 0, 0, 4313 },   // 猪
+    { 0x732b, 0, 0, 4314 },   // 猫
+    { 0x732c, 0, 0, 4315 },   // 猬
+    { 0x732e, 6188, 1, 4316 },   // 献
+    { 0x736d, 0, 0, 4318 },   // 獭
+    { 0x7389, 6189, 1, -1 },   // 玉
+    { 0x738b, 6190, 2, -1 },   // 王
+    { 0x7391, 0, 0, 4323 },   // 玑
+    { 0x739b, 0, 0, 4324 },   // 玛
+    { 0x73ae, 0, 0, 4325 },   // 玮
+    { 0x73af, 6192, 1, 4326 },   // 环
+    { 0x73b0, 0, 0, 4328 },   // 现
+    { 0x73ba, 0, 0, 4329 },   // 玺
+    { 0x73cd, 6193, 1, -1 },   // 珍
+    { 0x73d0, 6194, 1, 4331 },   // 珐
+    { 0x73d1, 0, 0, 4333 },   // 珑
+    { 0x73ed, 6195, 1, -1 },   // 班
+    { 0x73f2, 0, 0, 4335 },   // 珲
+    { 0x7403, 6196, 1, -1 },   // 球
+    { 0x7406, 6197, 5, -1 },   // 理
+    { 0x740f, 0, 0, 4343 },   // 琏
+    { 0x7410, 0, 0, 4344 },   // 琐
+    { 0x7434, 6202, 1, -1 },   // 琴
+    { 0x743c, 0, 0, 4346 },   // 琼
+    { 0x745e, 6203, 1, -1 },   // 瑞
+    { 0x7476, 6204, 1, 4348 },   // 瑶
+    { 0x7477, 0, 0, 4350 },   // 瑷
+    { 0x748e, 0, 0, 4351 },   // 璎
+    { 0x74d2, 0, 0, 4352 },   // 瓒
+    { 0x74ee, 6205, 1, -1 },   // 瓮
+    { 0x74ef, 0, 0, 4354 },   // 瓯
+    { 0x74f7, 6206, 1, -1 },   // 瓷
+    { 0x751c, 6207, 3, -1 },   // 甜
+    { 0x751f, 6210, 6, -1 },   // 生
+    { 0x7528, 6216, 1, -1 },   // 用
+    { 0x7529, 6217, 1, -1 },   // 甩
+    { 0x7530, 6218, 1, -1 },   // 田
+    { 0x7532, 6219, 1, -1 },   // 甲
+    { 0x7535, 6220, 9, 4370 },   // 电
+    { 0x7537, 6229, 1, -1 },   // 男
+    { 0x753b, 6230, 1, 4386 },   // 画
+    { 0x7545, 6231, 1, 4388 },   // 畅
+    { 0x754c, 6232, 1, -1 },   // 界
+    { 0x7559, 6233, 2, -1 },   // 留
+    { 0x7574, 0, 0, 4396 },   // 畴
+    { 0x758f, 6235, 1, -1 },   // 疏
+    { 0x7591, 6236, 2, -1 },   // 疑
+    { 0x7596, 0, 0, 4400 },   // 疖
+    { 0x7597, 0, 0, 4401 },   // 疗
+    { 0x759f, 0, 0, 4402 },   // 疟
+    { 0x75a0, 0, 0, 4403 },   // 疠
+    { 0x75a1, 0, 0, 4404 },   // 疡
+    { 0x75ac, 0, 0, 4405 },   // 疬
+    { 0x75ae, 0, 0, 4406 },   // 疮
+    { 0x75af, 0, 0, 4407 },   // 疯
+    { 0x75b1, 0, 0, 4408 },   // 疱
+    { 0x75b2, 6238, 1, -1 },   // 疲
+    { 0x75c5, 6239, 3, -1 },   // 病
+    { 0x75c7, 6242, 1, -1 },   // 症
+    { 0x75c8, 0, 0, 4414 },   // 痈
+    { 0x75c9, 0, 0, 4415 },   // 痉
+    { 0x75ca, 6243, 1, -1 },   // 痊
+    { 0x75d2, 0, 0, 4417 },   // 痒
+    { 0x75e8, 0, 0, 4418 },   // 痨
+    { 0x75ea, 0, 0, 4419 },   // 痪
+    { 0x75eb, 0, 0, 4420 },   // 痫
+    { 0x75f3, 6244, 2, 4421 },   // 痳
+    { 0x7605, 0, 0, 4424 },   // 瘅
+    { 0x7617, 0, 0, 4425 },   // 瘗
+    { 0x7618, 0, 0, 4426 },   // 瘘
+    { 0x762a, 0, 0, 4427 },   // 瘪
+    { 0x762b, 0, 0, 4428 },   // 瘫
+    { 0x763e, 0, 0, 4429 },   // 瘾
+    { 0x763f, 0, 0, 4430 },   // 瘿
+    { 0x765e, 0, 0, 4431 },   // 癞
+    { 0x7663, 0, 0, 4432 },   // 癣
+    { 0x766b, 0, 0, 4433 },   // 癫
+    { 0x767d, 6246, 8, -1 },   // 白
+    { 0x767e, 6254, 11, -1 },   // 百
+    { 0x7684, 6265, 8, -1 },   // 的
+    { 0x7686, 6273, 2, -1 },   // 皆
+    { 0x7687, 6275, 2, -1 },   // 皇
+    { 0x7691, 0, 0, 4471 },   // 皑
+    { 0x7693, 6277, 1, -1 },   // 皓
+    { 0x76ae, 6278, 4, -1 },   // 皮
+    { 0x76b1, 6282, 1, 4478 },   // 皱
+    { 0x76b2, 0, 0, 4480 },   // 皲
+    { 0x76c6, 6283, 1, -1 },   // 盆
+    { 0x76c8, 6284, 1, -1 },   // 盈
+    { 0x76cf, 0, 0, 4483 },   // 盏
+    { 0x76d0, 6285, 3, 4484 },   // 盐
+    { 0x76d1, 6288, 1, 4488 },   // 监
+    { 0x76d2, 6289, 1, -1 },   // 盒
+    { 0x76d6, 0, 0, 4491 },   // 盖
+    { 0x76d7, 6290, 2, 4492 },   // 盗
+    { 0x76d8, 6292, 2, 4495 },   // 盘
+    { 0x76db, 6294, 1, -1 },   // 盛
+    { 0x76f2, 6295, 1, -1 },   // 盲
+    { 0x76f4, 6296, 1, -1 },   // 直
+    { 0x76f8, 6297, 4, -1 },   // 相
+    { 0x770b, 6301, 4, -1 },   // 看
+    { 0x771f, 6305, 3, -1 },   // 真
+    { 0x7726, 0, 0, 4512 },   // 眦
+    { 0x773c, 6308, 4, -1 },   // 眼
+    { 0x7741, 0, 0, 4517 },   // 睁
+    { 0x7750, 0, 0, 4518 },   // 睐
+    { 0x7751, 0, 0, 4519 },   // 睑
+    { 0x7761, 6312, 1, -1 },   // 睡
+    { 0x7784, 6313, 1, -1 },   // 瞄
+    { 0x778e, 6314, 1, -1 },   // 瞎
+    { 0x7792, 0, 0, 4523 },   // 瞒
+    { 0x77a9, 6315, 1, 4524 },   // 瞩
+    { 0x77b3, 6316, 1, -1 },   // 瞳
+    { 0x77dc, 6317, 1, -1 },   // 矜
+    { 0x77eb, 0, 0, 4528 },   // 矫
+    { 0x77ed, 6318, 1, -1 },   // 短
+    { 0x77f3, 6319, 3, -1 },   // 石
+    { 0x77f6, 0, 0, 4535 },   // 矶
+    { 0x77fe, 0, 0, 4536 },   // 矾
+    { 0x77ff, 0, 0, 4537 },   // 矿
+    { 0x7800, 0, 0, 4538 },   // 砀
+    { 0x7801, 6322, 2, 4539 },   // 码
+    { 0x7814, 6324, 1, -1 },   // 研
+    { 0x7816, 0, 0, 4544 },   // 砖
+    { 0x7817, 0, 0, 4545 },   // 砗
+    { 0x781a, 0, 0, 4546 },   // 砚
+    { 0x7830, 6325, 1, -1 },   // 砰
+    { 0x7834, 6326, 1, -1 },   // 破
+    { 0x783a, 0, 0, 4549 },   // 砺
+    { 0x783b, 6327, 1, 4550 },   // 砻
+    { 0x783e, 0, 0, 4552 },   // 砾
+    { 0x7840, 0, 0, 4553 },   // 础
+    { 0x7855, 0, 0, 4554 },   // 硕
+    { 0x7856, 0, 0, 4555 },   // 硖
+    { 0x7857, 6328, 1, 4556 },   // 硗
+    { 0x786c, 6329, 1, -1 },   // 硬
+    { 0x786e, 6330, 1, 4559 },   // 确
+    { 0x7877, 0, 0, 4561 },   // 硷
+    { 0x788d, 0, 0, 4562 },   // 碍
+    { 0x7891, 6331, 1, -1 },   // 碑
+    { 0x7897, 6332, 1, -1 },   // 碗
+    { 0x789b, 0, 0, 4565 },   // 碛
+    { 0x789c, 0, 0, 4566 },   // 碜
+    { 0x78b0, 6333, 1, -1 },   // 碰
+    { 0x78b1, 0, 0, 4568 },   // 碱
+    { 0x78c1, 6334, 1, -1 },   // 磁
+    { 0x78e8, 6335, 3, -1 },   // 磨
+    { 0x78ec, 6338, 1, -1 },   // 磬
+    { 0x793a, 6339, 1, -1 },   // 示
+    { 0x793c, 6340, 1, 4575 },   // 礼
+    { 0x793e, 6341, 1, -1 },   // 社
+    { 0x795d, 6342, 2, -1 },   // 祝
+    { 0x795e, 6344, 3, -1 },   // 神
+    { 0x7962, 0, 0, 4583 },   // 祢
+    { 0x796d, 6347, 1, -1 },   // 祭
+    { 0x796f, 0, 0, 4585 },   // 祯
+    { 0x7977, 0, 0, 4586 },   // 祷
+    { 0x7978, 0, 0, 4587 },   // 祸
+    { 0x7980, 0, 0, 4588 },   // 禀
+    { 0x7981, 6348, 1, -1 },   // 禁
+    { 0x7984, 0, 0, 4591 },   // 禄
+    { 0x7985, 0, 0, 4592 },   // 禅
+    { 0x79bb, 0, 0, 4593 },   // 离
+    { 0x79be, 6349, 1, -1 },   // 禾
+    { 0x79c0, 6350, 1, -1 },   // 秀
+    { 0x79c1, 6351, 3, -1 },   // 私
+    { 0x79c3, 6354, 2, 4607 },   // 秃
+    { 0x79c6, 0, 0, 4610 },   // 秆
+    { 0x79cb, 6356, 2, -1 },   // 秋
+    { 0x79cd, 6358, 2, 4613 },   // 种
+    { 0x79d1, 6360, 2, -1 },   // 科
+    { 0x79d2, 6362, 1, -1 },   // 秒
+    { 0x79e4, 6363, 1, -1 },   // 秤
+    { 0x79e6, 6364, 1, -1 },   // 秦
+    { 0x79ef, 6365, 3, 4622 },   // 积
+    { 0x79f0, 6368, 1, 4627 },   // 称
+    { 0x79fd, 0, 0, 4629 },   // 秽
+    { 0x7a00, 6369, 1, -1 },   // 稀
+    { 0x7a06, 0, 0, 4631 },   // 稆
+    { 0x7a0b, 6370, 1, -1 },   // 程
+    { 0x7a0e, 0, 0, 4633 },   // 税
+    { 0x7a23, 0, 0, 4634 },   // 稣
+    { 0x7a33, 6371, 2, 4635 },   // 稳
+    { 0x7a3b, 6373, 1, -1 },   // 稻
+    { 0x7a3d, 6374, 1, -1 },   // 稽
+    { 0x7a46, 6375, 2, -1 },   // 穆
+    { 0x7a51, 0, 0, 4643 },   // 穑
+    { 0x7a77, 6377, 2, 4644 },   // 穷
+    { 0x7a7a, 6379, 4, -1 },   // 空
+    { 0x7a83, 6383, 1, 4652 },   // 窃
+    { 0x7a8d, 0, 0, 4654 },   // 窍
+    { 0x7a91, 0, 0, 4655 },   // 窑
+    { 0x7a92, 6384, 1, -1 },   // 窒
+    { 0x7a97, 6385, 2, -1 },   // 窗
+    { 0x7a9c, 0, 0, 4659 },   // 窜
+    { 0x7a9d, 6387, 1, 4660 },   // 窝
+    { 0x7aa5, 0, 0, 4663 },   // 窥
+    { 0x7aa6, 0, 0, 4664 },   // 窦
+    { 0x7aad, 0, 0, 4665 },   // 窭
+    { 0x7acb, 6388, 1, -1 },   // 立
+    { 0x7ad6, 6389, 1, 4667 },   // 竖
+    { 0x7ade, 6390, 1, 4669 },   // 竞
+    { 0x7ae5, 6391, 1, -1 },   // 童
+    { 0x7af9, 6392, 5, -1 },   // 竹
+    { 0x7b03, 0, 0, 4677 },   // 笃
+    { 0x7b0b, 6397, 1, 4678 },   // 笋
+    { 0x7b11, 6398, 1, -1 },   // 笑
+    { 0x7b14, 6399, 2, 4681 },   // 笔
+    { 0x7b15, 0, 0, 4684 },   // 笕
+    { 0x7b3a, 0, 0, 4685 },   // 笺
+    { 0x7b3c, 0, 0, 4686 },   // 笼
+    { 0x7b3e, 0, 0, 4687 },   // 笾
+    { 0x7b51, 6401, 2, 4688 },   // 筑
+    { 0x7b54, 6403, 1, -1 },   // 答
+    { 0x7b5a, 0, 0, 4692 },   // 筚
+    { 0x7b5b, 0, 0, 4693 },   // 筛
+    { 0x7b5d, 0, 0, 4694 },   // 筝
+    { 0x7b79, 0, 0, 4695 },   // 筹
+    { 0x7b7e, 6404, 3, 4696 },   // 签
+    { 0x7b80, 6407, 4, 4700 },   // 简
+    { 0x7b97, 6411, 2, -1 },   // 算
+    { 0x7ba1, 6413, 1, -1 },   // 管
+    { 0x7ba6, 0, 0, 4709 },   // 箦
+    { 0x7ba7, 0, 0, 4710 },   // 箧
+    { 0x7ba8, 0, 0, 4711 },   // 箨
+    { 0x7ba9, 0, 0, 4712 },   // 箩
+    { 0x7baa, 0, 0, 4713 },   // 箪
+    { 0x7bab, 0, 0, 4714 },   // 箫
+    { 0x7bb1, 6414, 1, -1 },   // 箱
+    { 0x7bd1, 0, 0, 4716 },   // 篑
+    { 0x7bd3, 0, 0, 4717 },   // 篓
+    { 0x7bee, 0, 0, 4718 },   // 篮
+    { 0x7bf1, 0, 0, 4719 },   // 篱
+    { 0x7c16, 0, 0, 4720 },   // 簖
+    { 0x7c38, 6415, 1, -1 },   // 簸
+    { 0x7c41, 0, 0, 4722 },   // 籁
+    { 0x7c73, 6416, 4, -1 },   // 米
+    { 0x7c74, 0, 0, 4727 },   // 籴
+    { 0x7c7b, 0, 0, 4728 },   // 类
+    { 0x7c7c, 0, 0, 4729 },   // 籼
+    { 0x7c89, 6420, 1, -1 },   // 粉
+    { 0x7c97, 6421, 1, -1 },   // 粗
+    { 0x7c9c, 0, 0, 4732 },   // 粜
+    { 0x7c9d, 0, 0, 4733 },   // 粝
+    { 0x7ca4, 0, 0, 4734 },   // 粤
+    { 0x7caa, 6422, 1, 4735 },   // 粪
+    { 0x7cae, 0, 0, 4737 },   // 粮
+    { 0x7cbe, 6423, 6, -1 },   // 精
+    { 0x7cc1, 0, 0, 4744 },   // 糁
+    { 0x7cc7, 0, 0, 4745 },   // 糇
+    { 0x7cca, 6429, 1, -1 },   // 糊
+    { 0x7cd5, 6430, 1, -1 },   // 糕
+    { 0x7cfb, 6431, 23, -1 },   // 系
+    { 0x7d20, 6454, 4, -1 },   // 素
+    { 0x7d22, 6458, 2, -1 },   // 索
+    { 0x7d27, 6460, 2, 4784 },   // 紧
+    { 0x7d2b, 6462, 1, -1 },   // 紫
+    { 0x7d2f, 6463, 5, -1 },   // 累
+    { 0x7d77, 0, 0, 4793 },   // 絷
+    { 0x7e41, 6468, 2, -1 },   // 繁
+    { 0x7ea0, 0, 0, 4796 },   // 纠
+    { 0x7ea1, 6470, 3, 4797 },   // 纡
+    { 0x7ea2, 6473, 4, 4801 },   // 红
+    { 0x7ea3, 0, 0, 4806 },   // 纣
+    { 0x7ea4, 6477, 3, 4807 },   // 纤
+    { 0x7ea5, 0, 0, 4811 },   // 纥
+    { 0x7ea6, 0, 0, 4812 },   // 约
+    { 0x7ea7, 0, 0, 4813 },   // 级
+    { 0x7ea8, 0, 0, 4814 },   // 纨
+    { 0x7ea9, 0, 0, 4815 },   // 纩
+    { 0x7eaa, 6480, 1, 4816 },   // 纪
+    { 0x7eab, 0, 0, 4819 },   // 纫
+    { 0x7eac, 0, 0, 4820 },   // 纬
+    { 0x7ead, 0, 0, 4821 },   // 纭
+    { 0x7eaf, 6481, 1, 4822 },   // 纯
+    { 0x7eb0, 0, 0, 4824 },   // 纰
+    { 0x7eb1, 0, 0, 4825 },   // 纱
+    { 0x7eb2, 6482, 1, 4826 },   // 纲
+    { 0x7eb3, 6483, 1, 4828 },   // 纳
+    { 0x7eb5, 6484, 1, 4830 },   // 纵
+    { 0x7eb6, 0, 0, 4832 },   // 纶
+    { 0x7eb7, 0, 0, 4833 },   // 纷
+    { 0x7eb8, 6485, 1, 4834 },   // 纸
+    { 0x7eb9, 0, 0, 4836 },   // 纹
+    { 0x7eba, 0, 0, 4837 },   // 纺
+    { 0x7ebd, 0, 0, 4838 },   // 纽
+    { 0x7ebe, 0, 0, 4839 },   // 纾
+    { 0x7ebf, 6486, 1, 4840 },   // 线
+    { 0x7ec0, 0, 0, 4842 },   // 绀
+    { 0x7ec1, 0, 0, 4843 },   // 绁
+    { 0x7ec2, 0, 0, 4844 },   // 绂
+    { 0x7ec3, 0, 0, 4845 },   // 练
+    { 0x7ec4, 6487, 1, 4846 },   // 组
+    { 0x7ec5, 0, 0, 4848 },   // 绅
+    { 0x7ec6, 6488, 4, 4849 },   // 细
+    { 0x7ec7, 0, 0, 4854 },   // 织
+    { 0x7ec8, 0, 0, 4855 },   // 终
+    { 0x7ec9, 0, 0, 4856 },   // 绉
+    { 0x7eca, 0, 0, 4857 },   // 绊
+    { 0x7ecb, 0, 0, 4858 },   // 绋
+    { 0x7ecc, 0, 0, 4859 },   // 绌
+    { 0x7ecd, 0, 0, 4860 },   // 绍
+    { 0x7ece, 0, 0, 4861 },   // 绎
+    { 0x7ecf, 6492, 2, 4862 },   // 经
+    { 0x7ed0, 0, 0, 4865 },   // 绐
+    { 0x7ed1, 6494, 1, 4866 },   // 绑
+    { 0x7ed2, 0, 0, 4868 },   // 绒
+    { 0x7ed3, 6495, 5, 4869 },   // 结
+    { 0x7ed5, 6500, 1, 4875 },   // 绕
+    { 0x7ed7, 0, 0, 4877 },   // 绗
+    { 0x7ed8, 6501, 1, 4878 },   // 绘
+    { 0x7ed9, 0, 0, 4880 },   // 给
+    { 0x7eda, 0, 0, 4881 },   // 绚
+    { 0x7edb, 0, 0, 4882 },   // 绛
+    { 0x7edc, 6502, 1, 4883 },   // 络
+    { 0x7edd, 0, 0, 4885 },   // 绝
+    { 0x7ede, 6503, 1, 4886 },   // 绞
+    { 0x7edf, 0, 0, 4888 },   // 统
+    { 0x7ee0, 0, 0, 4889 },   // 绠
+    { 0x7ee1, 0, 0, 4890 },   // 绡
+    { 0x7ee2, 0, 0, 4891 },   // 绢
+    { 0x7ee3, 0, 0, 4892 },   // 绣
+    { 0x7ee5, 6504, 1, 4893 },   // 绥
+    { 0x7ee6, 0, 0, 4895 },   // 绦
+    { 0x7ee7, 0, 0, 4896 },   // 继
+    { 0x7ee8, 0, 0, 4897 },   // 绨
+    { 0x7ee9, 0, 0, 4898 },   // 绩
+    { 0x7eea, 6505, 1, 4899 },   // 绪
+    { 0x7eeb, 0, 0, 4901 },   // 绫
+    { 0x7eed, 0, 0, 4902 },   // 续
+    { 0x7eee, 0, 0, 4903 },   // 绮
+    { 0x7eef, 0, 0, 4904 },   // 绯
+    { 0x7ef0, 0, 0, 4905 },   // 绰
+    { 0x7ef1, 0, 0, 4906 },   // 绱
+    { 0x7ef2, 0, 0, 4907 },   // 绲
+    { 0x7ef3, 0, 0, 4908 },   // 绳
+    { 0x7ef4, 6506, 1, 4909 },   // 维
+    { 0x7ef5, 0, 0, 4912 },   // 绵
+    { 0x7ef6, 0, 0, 4913 },   // 绶
+    { 0x7ef7, 6507, 1, 4914 },   // 绷
+    { 0x7ef8, 0, 0, 4916 },   // 绸
+    { 0x7efa, 0, 0, 4917 },   // 绺
+    { 0x7efb, 0, 0, 4918 },   // 绻
+    { 0x7efc, 6508, 1, 4919 },   // 综
+    { 0x7efd, 0, 0, 4921 },   // 绽
+    { 0x7efe, 6509, 1, 4922 },   // 绾
+    { 0x7eff, 6510, 1, 4924 },   // 绿
+    { 0x7f00, 0, 0, 4926 },   // 缀
+    { 0x7f01, 0, 0, 4927 },   // 缁
+    { 0x7f02, 0, 0, 4928 },   // 缂
+    { 0x7f03, 0, 0, 4929 },   // 缃
+    { 0x7f04, 0, 0, 4930 },   // 缄
+    { 0x7f05, 0, 0, 4931 },   // 缅
+    { 0x7f06, 0, 0, 4932 },   // 缆
+    { 0x7f07, 0, 0, 4933 },   // 缇
+    { 0x7f08, 0, 0, 4934 },   // 缈
+    { 0x7f09, 6511, 1, 4935 },   // 缉
+    { 0x7f0b, 0, 0, 4937 },   // 缋
+    { 0x7f0c, 0, 0, 4938 },   // 缌
+    { 0x7f0d, 0, 0, 4939 },   // 缍
+    { 0x7f0e, 0, 0, 4940 },   // 缎
+    { 0x7f0f, 0, 0, 4941 },   // 缏
+    { 0x7f11, 0, 0, 4942 },   // 缑
+    { 0x7f12, 0, 0, 4943 },   // 缒
+    { 0x7f13, 6512, 2, 4944 },   // 缓
+    { 0x7f14, 0, 0, 4947 },   // 缔
+    { 0x7f15, 0, 0, 4948 },   // 缕
+    { 0x7f16, 6514, 5, 4949 },   // 编
+    { 0x7f17, 0, 0, 4955 },   // 缗
+    { 0x7f18, 0, 0, 4956 },   // 缘
+    { 0x7f19, 0, 0, 4957 },   // 缙
+    { 0x7f1a, 0, 0, 4958 },   // 缚
+    { 0x7f1b, 0, 0, 4959 },   // 缛
+    { 0x7f1c, 6519, 1, 4960 },   // 缜
+    { 0x7f1d, 6520, 2, 4962 },   // 缝
+    { 0x7f1f, 0, 0, 4965 },   // 缟
+    { 0x7f20, 6522, 1, 4966 },   // 缠
+    { 0x7f21, 0, 0, 4968 },   // 缡
+    { 0x7f22, 0, 0, 4969 },   // 缢
+    { 0x7f23, 0, 0, 4970 },   // 缣
+    { 0x7f24, 0, 0, 4971 },   // 缤
+    { 0x7f25, 0, 0, 4972 },   // 缥
+    { 0x7f26, 0, 0, 4973 },   // 缦
+    { 0x7f27, 0, 0, 4974 },   // 缧
+    { 0x7f28, 0, 0, 4975 },   // 缨
+    { 0x7f29, 6523, 2, 4976 },   // 缩
+    { 0x7f2a, 0, 0, 4979 },   // 缪
+    { 0x7f2b, 0, 0, 4980 },   // 缫
+    { 0x7f2c, 0, 0, 4981 },   // 缬
+    { 0x7f2d, 0, 0, 4982 },   // 缭
+    { 0x7f2e, 0, 0, 4983 },   // 缮
+    { 0x7f2f, 0, 0, 4984 },   // 缯
+    { 0x7f30, 0, 0, 4985 },   // 缰
+    { 0x7f31, 0, 0, 4986 },   // 缱
+    { 0x7f32, 0, 0, 4987 },   // 缲
+    { 0x7f33, 0, 0, 4988 },   // 缳
+    { 0x7f34, 0, 0, 4989 },   // 缴
+    { 0x7f35, 0, 0, 4990 },   // 缵
+    { 0x7f42, 0, 0, 4991 },   // 罂
+    { 0x7f51, 6525, 5, 4992 },   // 网
+    { 0x7f57, 6530, 1, 4998 },   // 罗
+    { 0x7f5a, 0, 0, 5002 },   // 罚
+    { 0x7f62, 0, 0, 5003 },   // 罢
+    { 0x7f6e, 6531, 1, -1 },   // 置
+    { 0x7f74, 0, 0, 5005 },   // 罴
+    { 0x7f81, 6532, 1, 5006 },   // 羁
+    { 0x7f8e, 6533, 3, -1 },   // 美
+    { 0x7f9f, 0, 0, 5016 },   // 羟
+    { 0x7fa1, 6536, 1, 5017 },   // 羡
+    { 0x7fa4, 6537, 1, -1 },   // 群
+    { 0x7fd5, 6538, 1, -1 },   // 翕
+    { 0x7fd8, 0, 0, 5021 },   // 翘
+    { 0x7ff1, 6539, 1, -1 },   // 翱
+    { 0x7ffb, 6540, 2, -1 },   // 翻
+    { 0x8001, 6542, 6, -1 },   // 老
+    { 0x8003, 6548, 2, -1 },   // 考
+    { 0x800d, 6550, 1, -1 },   // 耍
+    { 0x8015, 6551, 1, -1 },   // 耕
+    { 0x8027, 0, 0, 5036 },   // 耧
+    { 0x8033, 6552, 1, -1 },   // 耳
+    { 0x8036, 6553, 1, -1 },   // 耶
+    { 0x8038, 0, 0, 5039 },   // 耸
+    { 0x803b, 0, 0, 5040 },   // 耻
+    { 0x8042, 0, 0, 5041 },   // 聂
+    { 0x804a, 6554, 1, -1 },   // 聊
+    { 0x804b, 0, 0, 5043 },   // 聋
+    { 0x804c, 0, 0, 5044 },   // 职
+    { 0x804d, 0, 0, 5045 },   // 聍
+    { 0x8054, 6555, 1, 5046 },   // 联
+    { 0x8058, 6556, 1, -1 },   // 聘
+    { 0x805a, 6557, 1, -1 },   // 聚
+    { 0x8069, 0, 0, 5050 },   // 聩
+    { 0x806a, 0, 0, 5051 },   // 聪
+    { 0x8083, 0, 0, 5052 },   // 肃
+    { 0x8089, 6558, 6, -1 },   // 肉
+    { 0x809a, 6564, 1, -1 },   // 肚
+    { 0x809d, 6565, 2, -1 },   // 肝
+    { 0x80a0, 6567, 1, 5062 },   // 肠
+    { 0x80a1, 6568, 1, -1 },   // 股
+    { 0x80a4, 0, 0, 5065 },   // 肤
+    { 0x80ae, 0, 0, 5066 },   // 肮
+    { 0x80b4, 6569, 1, 5067 },   // 肴
+    { 0x80ba, 6570, 1, -1 },   // 肺
+    { 0x80be, 6571, 1, 5070 },   // 肾
+    { 0x80bf, 0, 0, 5072 },   // 肿
+    { 0x80c0, 0, 0, 5073 },   // 胀
+    { 0x80c1, 0, 0, 5074 },   // 胁
+    { 0x80c3, 6572, 2, -1 },   // 胃
+    { 0x80c6, 0, 0, 5077 },   // 胆
+    { 0x80cc, 6574, 1, -1 },   // 背
+    { 0x80ce, 6575, 1, -1 },   // 胎
+    { 0x80dc, 6576, 1, 5080 },   // 胜
+    { 0x80e1, 6577, 8, -1 },   // 胡
+    { 0x80e7, 0, 0, 5091 },   // 胧
+    { 0x80ea, 0, 0, 5092 },   // 胪
+    { 0x80eb, 0, 0, 5093 },   // 胫
+    { 0x80f0, 6585, 1, -1 },   // 胰
+    { 0x80f6, 6586, 1, 5095 },   // 胶
+    { 0x80fd, 6587, 1, -1 },   // 能
+    { 0x8109, 6588, 1, 5100 },   // 脉
+    { 0x810a, 6589, 1, -1 },   // 脊
+    { 0x810d, 0, 0, 5103 },   // 脍
+    { 0x810f, 6590, 3, 5104 },   // 脏
+    { 0x8110, 0, 0, 5108 },   // 脐
+    { 0x8111, 6593, 1, 5109 },   // 脑
+    { 0x8113, 0, 0, 5111 },   // 脓
+    { 0x8114, 0, 0, 5112 },   // 脔
+    { 0x811a, 6594, 1, 5113 },   // 脚
+    { 0x8131, 6595, 2, 5115 },   // 脱
+    { 0x8136, 0, 0, 5118 },   // 脶
+    { 0x8138, 0, 0, 5119 },   // 脸
+    { 0x813a, 6597, 1, -1 },   // 脺
+    { 0x813e, 6598, 1, -1 },   // 脾
+    { 0x814a, 6599, 1, 5122 },   // 腊
+    { 0x814c, 6600, 1, 5124 },   // 腌
+    { 0x8150, 6601, 2, -1 },   // 腐
+    { 0x8151, 6603, 1, -1 },   // 腑
+    { 0x8155, 6604, 1, -1 },   // 腕
+    { 0x816d, 0, 0, 5130 },   // 腭
+    { 0x8170, 6605, 1, -1 },   // 腰
+    { 0x817b, 0, 0, 5132 },   // 腻
+    { 0x817c, 0, 0, 5133 },   // 腼
+    { 0x817d, 0, 0, 5134 },   // 腽
+    { 0x817e, 6606, 3, 5135 },   // 腾
+    { 0x8191, 0, 0, 5139 },   // 膑
+    { 0x81a8, 6609, 1, -1 },   // 膨
+    { 0x81b5, 6610, 1, -1 },   // 膵
+    { 0x81ca, 6611, 1, -1 },   // 臊
+    { 0x81e3, 6612, 1, -1 },   // 臣
+    { 0x81e7, 6613, 1, -1 },   // 臧
+    { 0x81ea, 6614, 6, -1 },   // 自
+    { 0x81ed, 6620, 1, -1 },   // 臭
+    { 0x81f4, 6621, 1, -1 },   // 致
+    { 0x8202, 6622, 1, -1 },   // 舂
+    { 0x8206, 0, 0, 5155 },   // 舆
+    { 0x820c, 6623, 1, -1 },   // 舌
+    { 0x820d, 6624, 19, -1 },   // 舍
+    { 0x8212, 6643, 1, -1 },   // 舒
+    { 0x821e, 6644, 1, -1 },   // 舞
+    { 0x8223, 0, 0, 5182 },   // 舣
+    { 0x822a, 6645, 1, -1 },   // 航
+    { 0x8230, 6646, 1, 5185 },   // 舰
+    { 0x8231, 0, 0, 5187 },   // 舱
+    { 0x8239, 6647, 2, -1 },   // 船
+    { 0x823b, 0, 0, 5190 },   // 舻
+    { 0x8270, 0, 0, 5191 },   // 艰
+    { 0x8272, 6649, 2, -1 },   // 色
+    { 0x8273, 6651, 1, 5194 },   // 艳
+    { 0x827a, 0, 0, 5196 },   // 艺
+    { 0x8282, 6652, 3, 5197 },   // 节
+    { 0x8288, 0, 0, 5201 },   // 芈
+    { 0x8292, 6655, 1, -1 },   // 芒
+    { 0x8297, 0, 0, 5203 },   // 芗
+    { 0x829c, 0, 0, 5204 },   // 芜
+    { 0x82a6, 0, 0, 5205 },   // 芦
+    { 0x82b1, 6656, 7, -1 },   // 花
+    { 0x82b8, 6663, 1, -1 },   // 芸
+    { 0x82c1, 0, 0, 5214 },   // 苁
+    { 0x82c7, 0, 0, 5215 },   // 苇
+    { 0x82c8, 0, 0, 5216 },   // 苈
+    { 0x82cb, 0, 0, 5217 },   // 苋
+    { 0x82cc, 0, 0, 5218 },   // 苌
+    { 0x82cd, 6664, 3, 5219 },   // 苍
+    { 0x82ce, 0, 0, 5223 },   // 苎
+    { 0x82cf, 6667, 2, 5224 },   // 苏
+    { 0x82d1, 6669, 1, -1 },   // 苑
+    { 0x82e6, 6670, 3, -1 },   // 苦
+    { 0x82e7, 6673, 2, 5231 },   // 苧
+    { 0x82f1, 6675, 1, -1 },   // 英
+    { 0x82f9, 6676, 2, -1 },   // 苹
+    { 0x8302, 6678, 1, -1 },   // 茂
+    { 0x8303, 6679, 12, -1 },   // 范
+    { 0x8305, 6691, 1, -1 },   // 茅
+    { 0x830e, 6692, 1, 5253 },   // 茎
+    { 0x830f, 0, 0, 5255 },   // 茏
+    { 0x8311, 0, 0, 5256 },   // 茑
+    { 0x8314, 0, 0, 5257 },   // 茔
+    { 0x8315, 0, 0, 5258 },   // 茕
+    { 0x8327, 0, 0, 5259 },   // 茧
+    { 0x8336, 6693, 2, -1 },   // 茶
+    { 0x8346, 0, 0, 5262 },   // 荆
+    { 0x8349, 6695, 2, -1 },   // 草
+    { 0x8350, 6697, 1, 5265 },   // 荐
+    { 0x835a, 0, 0, 5267 },   // 荚
+    { 0x835b, 0, 0, 5268 },   // 荛
+    { 0x835c, 0, 0, 5269 },   // 荜
+    { 0x835e, 6698, 1, 5270 },   // 荞
+    { 0x835f, 0, 0, 5272 },   // 荟
+    { 0x8360, 0, 0, 5273 },   // 荠
+    { 0x8361, 6699, 13, 5274 },   // 荡
+    { 0x8363, 0, 0, 5289 },   // 荣
+    { 0x8364, 0, 0, 5290 },   // 荤
+    { 0x8365, 0, 0, 5291 },   // 荥
+    { 0x8366, 6712, 1, 5292 },   // 荦
+    { 0x8367, 6713, 1, 5294 },   // 荧
+    { 0x8368, 0, 0, 5296 },   // 荨
+    { 0x8369, 0, 0, 5297 },   // 荩
+    { 0x836a, 0, 0, 5298 },   // 荪
+    { 0x836b, 0, 0, 5299 },   // 荫
+    { 0x836d, 0, 0, 5300 },   // 荭
+    { 0x836f, 6714, 2, 5301 },   // 药
+    { 0x8377, 6716, 1, -1 },   // 荷
+    { 0x8385, 0, 0, 5305 },   // 莅
+    { 0x839c, 6717, 1, -1 },   // 莜
+    { 0x83aa, 6718, 1, -1 },   // 莪
+    { 0x83b1, 0, 0, 5308 },   // 莱
+    { 0x83b2, 0, 0, 5309 },   // 莲
+    { 0x83b3, 0, 0, 5310 },   // 莳
+    { 0x83b4, 0, 0, 5311 },   // 莴
+    { 0x83b6, 0, 0, 5312 },   // 莶
+    { 0x83b7, 6719, 1, 5313 },   // 获
+    { 0x83b8, 0, 0, 5315 },   // 莸
+    { 0x83b9, 0, 0, 5316 },   // 莹
+    { 0x83ba, 0, 0, 5317 },   // 莺
+    { 0x83bc, 0, 0, 5318 },   // 莼
+    { 0x83bd, 6720, 1, -1 },   // 莽
+    { 0x83dc, 6721, 3, -1 },   // 菜
+    { 0x83e0, 6724, 2, -1 },   // 菠
+    { 0x841d, 6726, 1, 5325 },   // 萝
+    { 0x8424, 0, 0, 5328 },   // 萤
+    { 0x8425, 6727, 1, 5329 },   // 营
+    { 0x8426, 6728, 1, 5331 },   // 萦
+    { 0x8427, 6729, 1, 5333 },   // 萧
+    { 0x8428, 0, 0, 5335 },   // 萨
+    { 0x843d, 6730, 2, -1 },   // 落
+    { 0x8461, 6732, 1, -1 },   // 葡
+    { 0x8463, 6733, 1, -1 },   // 董
+    { 0x8471, 6734, 1, 5340 },   // 葱
+    { 0x8487, 0, 0, 5342 },   // 蒇
+    { 0x8489, 0, 0, 5343 },   // 蒉
+    { 0x848b, 0, 0, 5344 },   // 蒋
+    { 0x848c, 0, 0, 5345 },   // 蒌
+    { 0x8499, 6735, 13, -1 },   // 蒙
+    { 0x849c, 6748, 1, -1 },   // 蒜
+    { 0x84b2, 6749, 1, -1 },   // 蒲
+    { 0x84b8, 6750, 2, -1 },   // 蒸
+    { 0x84c4, 6752, 3, -1 },   // 蓄
+    { 0x84ca, 6755, 1, -1 },   // 蓊
+    { 0x84dd, 6756, 1, 5368 },   // 蓝
+    { 0x84df, 0, 0, 5370 },   // 蓟
+    { 0x84e0, 0, 0, 5371 },   // 蓠
+    { 0x84e3, 0, 0, 5372 },   // 蓣
+    { 0x84e5, 0, 0, 5373 },   // 蓥
+    { 0x84e6, 0, 0, 5374 },   // 蓦
+    { 0x84ec, 6757, 2, -1 },   // 蓬
+    { 0x8502, 0, 0, 5378 },   // 蔂
+    { 0x8537, 0, 0, 5379 },   // 蔷
+    { 0x8539, 0, 0, 5380 },   // 蔹
+    { 0x853a, 0, 0, 5381 },   // 蔺
+    { 0x853c, 0, 0, 5382 },   // 蔼
+    { 0x8572, 0, 0, 5383 },   // 蕲
+    { 0x8574, 0, 0, 5384 },   // 蕴
+    { 0x8584, 6759, 2, -1 },   // 薄
+    { 0x8599, 6761, 1, -1 },   // 薙
+    { 0x859d, 6762, 1, -1 },   // 薝
+    { 0x85ae, 0, 0, 5389 },   // 薮
+    { 0x85cf, 6763, 2, -1 },   // 藏
+    { 0x85d3, 0, 0, 5393 },   // 藓
+    { 0x85e4, 6765, 2, -1 },   // 藤
+    { 0x8616, 0, 0, 5396 },   // 蘖
+    { 0x864e, 6767, 2, -1 },   // 虎
+    { 0x864f, 0, 0, 5399 },   // 虏
+    { 0x8651, 0, 0, 5400 },   // 虑
+    { 0x865a, 6769, 1, 5401 },   // 虚
+    { 0x866b, 0, 0, 5403 },   // 虫
+    { 0x866e, 6770, 1, 5404 },   // 虮
+    { 0x867d, 0, 0, 5406 },   // 虽
+    { 0x867e, 6771, 1, 5407 },   // 虾
+    { 0x867f, 0, 0, 5409 },   // 虿
+    { 0x8680, 0, 0, 5410 },   // 蚀
+    { 0x8681, 6772, 1, 5411 },   // 蚁
+    { 0x8682, 0, 0, 5413 },   // 蚂
+    { 0x868a, 6773, 1, -1 },   // 蚊
+    { 0x8695, 0, 0, 5415 },   // 蚕
+    { 0x86ac, 0, 0, 5416 },   // 蚬
+    { 0x86c7, 6774, 1, -1 },   // 蛇
+    { 0x86ca, 0, 0, 5418 },   // 蛊
+    { 0x86cb, 6775, 1, -1 },   // 蛋
+    { 0x86ce, 0, 0, 5420 },   // 蛎
+    { 0x86cf, 6776, 1, 5421 },   // 蛏
+    { 0x86ee, 6777, 1, 5423 },   // 蛮
+    { 0x86f0, 0, 0, 5425 },   // 蛰
+    { 0x86f1, 0, 0, 5426 },   // 蛱
+    { 0x86f2, 0, 0, 5427 },   // 蛲
+    { 0x86f3, 0, 0, 5428 },   // 蛳
+    { 0x86f4, 0, 0, 5429 },   // 蛴
+    { 0x8702, 6778, 2, -1 },   // 蜂
+    { 0x8715, 0, 0, 5432 },   // 蜕
+    { 0x8717, 0, 0, 5433 },   // 蜗
+    { 0x871c, 6780, 1, -1 },   // 蜜
+    { 0x8721, 0, 0, 5435 },   // 蜡
+    { 0x8747, 0, 0, 5436 },   // 蝇
+    { 0x8748, 0, 0, 5437 },   // 蝈
+    { 0x8749, 0, 0, 5438 },   // 蝉
+    { 0x874e, 6781, 1, 5439 },   // 蝎
+    { 0x877c, 0, 0, 5441 },   // 蝼
+    { 0x877e, 0, 0, 5442 },   // 蝾
+    { 0x8840, 6782, 1, -1 },   // 血
+    { 0x8845, 6783, 1, 5444 },   // 衅
+    { 0x884c, 6784, 3, -1 },   // 行
+    { 0x8854, 0, 0, 5450 },   // 衔
+    { 0x8861, 6787, 1, -1 },   // 衡
+    { 0x8865, 6788, 1, 5452 },   // 补
+    { 0x8868, 6789, 13, -1 },   // 表
+    { 0x886c, 6802, 1, 5467 },   // 衬
+    { 0x886e, 0, 0, 5469 },   // 衮
+    { 0x8884, 0, 0, 5470 },   // 袄
+    { 0x8885, 0, 0, 5471 },   // 袅
+    { 0x888b, 6803, 3, -1 },   // 袋
+    { 0x8896, 6806, 1, -1 },   // 袖
+    { 0x889c, 0, 0, 5476 },   // 袜
+    { 0x88ab, 6807, 5, -1 },   // 被
+    { 0x88ad, 0, 0, 5486 },   // 袭
+    { 0x88c1, 6812, 2, -1 },   // 裁
+    { 0x88c5, 6814, 1, 5489 },   // 装
+    { 0x88c6, 0, 0, 5491 },   // 裆
+    { 0x88e2, 0, 0, 5492 },   // 裢
+    { 0x88e3, 0, 0, 5493 },   // 裣
+    { 0x88e4, 0, 0, 5494 },   // 裤
+    { 0x88e5, 0, 0, 5495 },   // 裥
+    { 0x8912, 6815, 1, -1 },   // 褒
+    { 0x891b, 0, 0, 5497 },   // 褛
+    { 0x8934, 0, 0, 5498 },   // 褴
+    { 0x897f, 6816, 5, -1 },   // 西
+    { 0x8981, 6821, 1, -1 },   // 要
+    { 0x89c1, 6822, 3, 5509 },   // 见
+    { 0x89c2, 6825, 1, 5513 },   // 观
+    { 0x89c4, 6826, 1, 5515 },   // 规
+    { 0x89c5, 0, 0, 5517 },   // 觅
+    { 0x89c6, 0, 0, 5518 },   // 视
+    { 0x89c7, 0, 0, 5519 },   // 觇
+    { 0x89c8, 0, 0, 5520 },   // 览
+    { 0x89c9, 0, 0, 5521 },   // 觉
+    { 0x89ca, 0, 0, 5522 },   // 觊
+    { 0x89cb, 0, 0, 5523 },   // 觋
+    { 0x89cc, 0, 0, 5524 },   // 觌
+    { 0x89ce, 0, 0, 5525 },   // 觎
+    { 0x89cf, 0, 0, 5526 },   // 觏
+    { 0x89d0, 0, 0, 5527 },   // 觐
+    { 0x89d1, 0, 0, 5528 },   // 觑
+    { 0x89d2, 6827, 2, -1 },   // 角
+    { 0x89da, 6829, 1, -1 },   // 觚
+    { 0x89de, 0, 0, 5533 },   // 觞
+    { 0x89e3, 6830, 3, -1 },   // 解
+    { 0x89e6, 6833, 1, 5537 },   // 触
+    { 0x89ef, 0, 0, 5539 },   // 觯
+    { 0x8a00, 6834, 1, -1 },   // 言
+    { 0x8a89, 0, 0, 5541 },   // 誉
+    { 0x8a8a, 0, 0, 5542 },   // 誊
+    { 0x8b37, 6835, 1, -1 },   // 謷
+    { 0x8b66, 6836, 4, -1 },   // 警
+    { 0x8ba1, 6840, 2, 5548 },   // 计
+    { 0x8ba2, 6842, 1, 5551 },   // 订
+    { 0x8ba3, 0, 0, 5553 },   // 讣
+    { 0x8ba4, 6843, 1, 5554 },   // 认
+    { 0x8ba5, 0, 0, 5556 },   // 讥
+    { 0x8ba6, 0, 0, 5557 },   // 讦
+    { 0x8ba7, 0, 0, 5558 },   // 讧
+    { 0x8ba8, 0, 0, 5559 },   // 讨
+    { 0x8ba9, 0, 0, 5560 },   // 让
+    { 0x8baa, 0, 0, 5561 },   // 讪
+    { 0x8bab, 0, 0, 5562 },   // 讫
+    { 0x8bad, 0, 0, 5563 },   // 训
+    { 0x8bae, 0, 0, 5564 },   // 议
+    { 0x8baf, 0, 0, 5565 },   // 讯
+    { 0x8bb0, 0, 0, 5566 },   // 记
+    { 0x8bb2, 0, 0, 5567 },   // 讲
+    { 0x8bb3, 0, 0, 5568 },   // 讳
+    { 0x8bb4, 0, 0, 5569 },   // 讴
+    { 0x8bb5, 0, 0, 5570 },   // 讵
+    { 0x8bb6, 0, 0, 5571 },   // 讶
+    { 0x8bb7, 0, 0, 5572 },   // 讷
+    { 0x8bb8, 6844, 1, 5573 },   // 许
+    { 0x8bb9, 0, 0, 5575 },   // 讹
+    { 0x8bba, 6845, 1, 5576 },   // 论
+    { 0x8bbc, 0, 0, 5578 },   // 讼
+    { 0x8bbd, 0, 0, 5579 },   // 讽
+    { 0x8bbe, 0, 0, 5580 },   // 设
+    { 0x8bbf, 0, 0, 5581 },   // 访
+    { 0x8bc0, 0, 0, 5582 },   // 诀
+    { 0x8bc1, 6846, 1, 5583 },   // 证
+    { 0x8bc2, 0, 0, 5585 },   // 诂
+    { 0x8bc3, 0, 0, 5586 },   // 诃
+    { 0x8bc4, 6847, 3, 5587 },   // 评
+    { 0x8bc5, 0, 0, 5591 },   // 诅
+    { 0x8bc6, 0, 0, 5592 },   // 识
+    { 0x8bc8, 0, 0, 5593 },   // 诈
+    { 0x8bc9, 0, 0, 5594 },   // 诉
+    { 0x8bca, 0, 0, 5595 },   // 诊
+    { 0x8bcb, 0, 0, 5596 },   // 诋
+    { 0x8bcc, 0, 0, 5597 },   // 诌
+    { 0x8bcd, 6850, 3, 5598 },   // 词
+    { 0x8bce, 0, 0, 5602 },   // 诎
+    { 0x8bcf, 0, 0, 5603 },   // 诏
+    { 0x8bd1, 6853, 3, 5604 },   // 译
+    { 0x8bd2, 0, 0, 5608 },   // 诒
+    { 0x8bd3, 0, 0, 5609 },   // 诓
+    { 0x8bd4, 6856, 1, 5610 },   // 诔
+    { 0x8bd5, 6857, 1, 5612 },   // 试
+    { 0x8bd6, 0, 0, 5614 },   // 诖
+    { 0x8bd7, 6858, 4, 5615 },   // 诗
+    { 0x8bd8, 0, 0, 5620 },   // 诘
+    { 0x8bd9, 0, 0, 5621 },   // 诙
+    { 0x8bda, 6862, 2, 5622 },   // 诚
+    { 0x8bdb, 0, 0, 5625 },   // 诛
+    { 0x8bdc, 0, 0, 5626 },   // 诜
+    { 0x8bdd, 6864, 1, 5627 },   // 话
+    { 0x8bde, 0, 0, 5629 },   // 诞
+    { 0x8bdf, 0, 0, 5630 },   // 诟
+    { 0x8be0, 0, 0, 5631 },   // 诠
+    { 0x8be1, 0, 0, 5632 },   // 诡
+    { 0x8be2, 0, 0, 5633 },   // 询
+    { 0x8be3, 0, 0, 5634 },   // 诣
+    { 0x8be4, 0, 0, 5635 },   // 诤
+    { 0x8be5, 6865, 1, 5636 },   // 该
+    { 0x8be6, 6866, 2, 5638 },   // 详
+    { 0x8be7, 0, 0, 5641 },   // 诧
+    { 0x8be8, 0, 0, 5642 },   // 诨
+    { 0x8be9, 0, 0, 5643 },   // 诩
+    { 0x8beb, 0, 0, 5644 },   // 诫
+    { 0x8bec, 6868, 1, 5645 },   // 诬
+    { 0x8bed, 6869, 5, 5647 },   // 语
+    { 0x8bee, 0, 0, 5653 },   // 诮
+    { 0x8bef, 0, 0, 5654 },   // 误
+    { 0x8bf0, 0, 0, 5655 },   // 诰
+    { 0x8bf1, 6874, 1, 5656 },   // 诱
+    { 0x8bf2, 0, 0, 5658 },   // 诲
+    { 0x8bf3, 0, 0, 5659 },   // 诳
+    { 0x8bf4, 6875, 1, 5660 },   // 说
+    { 0x8bf5, 0, 0, 5662 },   // 诵
+    { 0x8bf6, 0, 0, 5663 },   // 诶
+    { 0x8bf7, 6876, 2, 5664 },   // 请
+    { 0x8bf8, 6878, 1, 5667 },   // 诸
+    { 0x8bf9, 0, 0, 5669 },   // 诹
+    { 0x8bfa, 0, 0, 5670 },   // 诺
+    { 0x8bfb, 0, 0, 5671 },   // 读
+    { 0x8bfc, 0, 0, 5672 },   // 诼
+    { 0x8bfd, 0, 0, 5673 },   // 诽
+    { 0x8bfe, 6879, 2, 5674 },   // 课
+    { 0x8bff, 0, 0, 5677 },   // 诿
+    { 0x8c00, 0, 0, 5678 },   // 谀
+    { 0x8c01, 6881, 1, 5679 },   // 谁
+    { 0x8c02, 0, 0, 5681 },   // 谂
+    { 0x8c03, 6882, 4, 5682 },   // 调
+    { 0x8c04, 0, 0, 5687 },   // 谄
+    { 0x8c05, 0, 0, 5688 },   // 谅
+    { 0x8c06, 0, 0, 5689 },   // 谆
+    { 0x8c07, 0, 0, 5690 },   // 谇
+    { 0x8c08, 6886, 1, 5691 },   // 谈
+    { 0x8c0a, 0, 0, 5693 },   // 谊
+    { 0x8c0b, 6887, 1, 5694 },   // 谋
+    { 0x8c0c, 0, 0, 5696 },   // 谌
+    { 0x8c0d, 0, 0, 5697 },   // 谍
+    { 0x8c0e, 0, 0, 5698 },   // 谎
+    { 0x8c0f, 0, 0, 5699 },   // 谏
+    { 0x8c10, 0, 0, 5700 },   // 谐
+    { 0x8c11, 0, 0, 5701 },   // 谑
+    { 0x8c12, 0, 0, 5702 },   // 谒
+    { 0x8c13, 0, 0, 5703 },   // 谓
+    { 0x8c14, 0, 0, 5704 },   // 谔
+    { 0x8c15, 0, 0, 5705 },   // 谕
+    { 0x8c16, 0, 0, 5706 },   // 谖
+    { 0x8c17, 0, 0, 5707 },   // 谗
+    { 0x8c18, 0, 0, 5708 },   // 谘
+    { 0x8c19, 0, 0, 5709 },   // 谙
+    { 0x8c1a, 0, 0, 5710 },   // 谚
+    { 0x8c1b, 0, 0, 5711 },   // 谛
+    { 0x8c1c, 0, 0, 5712 },   // 谜
+    { 0x8c1d, 0, 0, 5713 },   // 谝
+    { 0x8c1f, 0, 0, 5714 },   // 谟
+    { 0x8c20, 0, 0, 5715 },   // 谠
+    { 0x8c21, 0, 0, 5716 },   // 谡
+    { 0x8c22, 6888, 2, 5717 },   // 谢
+    { 0x8c23, 0, 0, 5720 },   // 谣
+    { 0x8c24, 0, 0, 5721 },   // 谤
+    { 0x8c25, 0, 0, 5722 },   // 谥
+    { 0x8c26, 0, 0, 5723 },   // 谦
+    { 0x8c27, 0, 0, 5724 },   // 谧
+    { 0x8c28, 6890, 1, 5725 },   // 谨
+    { 0x8c29, 0, 0, 5727 },   // 谩
+    { 0x8c2a, 0, 0, 5728 },   // 谪
+    { 0x8c2b, 0, 0, 5729 },   // 谫
+    { 0x8c2c, 6891, 2, 5730 },   // 谬
+    { 0x8c2d, 0, 0, 5733 },   // 谭
+    { 0x8c2e, 0, 0, 5734 },   // 谮
+    { 0x8c2f, 0, 0, 5735 },   // 谯
+    { 0x8c30, 0, 0, 5736 },   // 谰
+    { 0x8c31, 0, 0, 5737 },   // 谱
+    { 0x8c32, 0, 0, 5738 },   // 谲
+    { 0x8c33, 0, 0, 5739 },   // 谳
+    { 0x8c34, 0, 0, 5740 },   // 谴
+    { 0x8c35, 0, 0, 5741 },   // 谵
+    { 0x8c36, 0, 0, 5742 },   // 谶
+    { 0x8c37, 6893, 28, -1 },   // 谷
+    { 0x8c46, 6921, 2, -1 },   // 豆
+    { 0x8c61, 6923, 1, -1 },   // 象
+    { 0x8d1d, 0, 0, 5774 },   // 贝
+    { 0x8d1e, 0, 0, 5775 },   // 贞
+    { 0x8d1f, 0, 0, 5776 },   // 负
+    { 0x8d21, 0, 0, 5777 },   // 贡
+    { 0x8d22, 0, 0, 5778 },   // 财
+    { 0x8d23, 0, 0, 5779 },   // 责
+    { 0x8d24, 6924, 1, 5780 },   // 贤
+    { 0x8d25, 0, 0, 5782 },   // 败
+    { 0x8d26, 0, 0, 5783 },   // 账
+    { 0x8d27, 0, 0, 5784 },   // 货
+    { 0x8d28, 6925, 2, 5785 },   // 质
+    { 0x8d29, 0, 0, 5788 },   // 贩
+    { 0x8d2a, 6927, 1, 5789 },   // 贪
+    { 0x8d2b, 0, 0, 5791 },   // 贫
+    { 0x8d2c, 0, 0, 5792 },   // 贬
+    { 0x8d2d, 6928, 2, 5793 },   // 购
+    { 0x8d2e, 0, 0, 5796 },   // 贮
+    { 0x8d2f, 0, 0, 5797 },   // 贯
+    { 0x8d30, 0, 0, 5798 },   // 贰
+    { 0x8d31, 0, 0, 5799 },   // 贱
+    { 0x8d32, 0, 0, 5800 },   // 贲
+    { 0x8d33, 0, 0, 5801 },   // 贳
+    { 0x8d34, 0, 0, 5802 },   // 贴
+    { 0x8d35, 6930, 3, 5803 },   // 贵
+    { 0x8d36, 0, 0, 5807 },   // 贶
+    { 0x8d37, 0, 0, 5808 },   // 贷
+    { 0x8d38, 0, 0, 5809 },   // 贸
+    { 0x8d39, 6933, 1, 5810 },   // 费
+    { 0x8d3a, 0, 0, 5812 },   // 贺
+    { 0x8d3b, 6934, 1, 5813 },   // 贻
+    { 0x8d3c, 0, 0, 5815 },   // 贼
+    { 0x8d3d, 0, 0, 5816 },   // 贽
+    { 0x8d3e, 6935, 1, 5817 },   // 贾
+    { 0x8d3f, 0, 0, 5819 },   // 贿
+    { 0x8d40, 0, 0, 5820 },   // 赀
+    { 0x8d41, 0, 0, 5821 },   // 赁
+    { 0x8d42, 0, 0, 5822 },   // 赂
+    { 0x8d43, 0, 0, 5823 },   // 赃
+    { 0x8d44, 0, 0, 5824 },   // 资
+    { 0x8d45, 0, 0, 5825 },   // 赅
+    { 0x8d46, 0, 0, 5826 },   // 赆
+    { 0x8d47, 0, 0, 5827 },   // 赇
+    { 0x8d48, 6936, 1, 5828 },   // 赈
+    { 0x8d49, 0, 0, 5830 },   // 赉
+    { 0x8d4a, 0, 0, 5831 },   // 赊
+    { 0x8d4b, 6937, 1, 5832 },   // 赋
+    { 0x8d4c, 6938, 3, 5834 },   // 赌
+    { 0x8d4d, 0, 0, 5838 },   // 赍
+    { 0x8d4e, 0, 0, 5839 },   // 赎
+    { 0x8d4f, 6941, 1, 5840 },   // 赏
+    { 0x8d50, 0, 0, 5842 },   // 赐
+    { 0x8d53, 0, 0, 5843 },   // 赓
+    { 0x8d54, 0, 0, 5844 },   // 赔
+    { 0x8d55, 0, 0, 5845 },   // 赕
+    { 0x8d56, 0, 0, 5846 },   // 赖
+    { 0x8d58, 0, 0, 5847 },   // 赘
+    { 0x8d59, 0, 0, 5848 },   // 赙
+    { 0x8d5a, 0, 0, 5849 },   // 赚
+    { 0x8d5b, 0, 0, 5850 },   // 赛
+    { 0x8d5c, 0, 0, 5851 },   // 赜
+    { 0x8d5d, 0, 0, 5852 },   // 赝
+    { 0x8d5e, 6942, 16, 5853 },   // 赞
+    { 0x8d60, 0, 0, 5870 },   // 赠
+    { 0x8d61, 0, 0, 5871 },   // 赡
+    { 0x8d62, 6958, 1, 5872 },   // 赢
+    { 0x8d63, 0, 0, 5874 },   // 赣
+    { 0x8d64, 6959, 2, -1 },   // 赤
+    { 0x8d75, 6961, 3, 5877 },   // 赵
+    { 0x8d76, 6964, 2, 5881 },   // 赶
+    { 0x8d77, 6966, 1, -1 },   // 起
+    { 0x8d85, 6967, 2, -1 },   // 超
+    { 0x8d8b, 0, 0, 5887 },   // 趋
+    { 0x8db1, 6969, 1, 5888 },   // 趱
+    { 0x8db8, 0, 0, 5890 },   // 趸
+    { 0x8dc3, 0, 0, 5891 },   // 跃
+    { 0x8dc4, 0, 0, 5892 },   // 跄
+    { 0x8dde, 0, 0, 5893 },   // 跞
+    { 0x8def, 6970, 2, -1 },   // 路
+    { 0x8df3, 6972, 2, -1 },   // 跳
+    { 0x8df5, 0, 0, 5898 },   // 践
+    { 0x8df7, 0, 0, 5899 },   // 跷
+    { 0x8df8, 0, 0, 5900 },   // 跸
+    { 0x8df9, 0, 0, 5901 },   // 跹
+    { 0x8dfb, 0, 0, 5902 },   // 跻
+    { 0x8e0a, 0, 0, 5903 },   // 踊
+    { 0x8e0c, 0, 0, 5904 },   // 踌
+    { 0x8e21, 6974, 1, -1 },   // 踡
+    { 0x8e2a, 0, 0, 5906 },   // 踪
+    { 0x8e2c, 0, 0, 5907 },   // 踬
+    { 0x8e2f, 0, 0, 5908 },   // 踯
+    { 0x8e51, 0, 0, 5909 },   // 蹑
+    { 0x8e52, 6975, 1, 5910 },   // 蹒
+    { 0x8e6d, 6976, 1, -1 },   // 蹭
+    { 0x8e70, 0, 0, 5913 },   // 蹰
+    { 0x8e7f, 0, 0, 5914 },   // 蹿
+    { 0x8e81, 6977, 1, -1 },   // 躁
+    { 0x8e8f, 0, 0, 5916 },   // 躏
+    { 0x8e9c, 0, 0, 5917 },   // 躜
+    { 0x8eab, 6978, 1, -1 },   // 身
+    { 0x8eaf, 6979, 1, 5919 },   // 躯
+    { 0x8f66, 6980, 3, 5921 },   // 车
+    { 0x8f67, 0, 0, 5926 },   // 轧
+    { 0x8f68, 6983, 1, 5927 },   // 轨
+    { 0x8f69, 6984, 1, 5929 },   // 轩
+    { 0x8f6b, 0, 0, 5931 },   // 轫
+    { 0x8f6c, 6985, 3, 5932 },   // 转
+    { 0x8f6d, 0, 0, 5936 },   // 轭
+    { 0x8f6e, 6988, 2, 5937 },   // 轮
+    { 0x8f6f, 0, 0, 5940 },   // 软
+    { 0x8f70, 0, 0, 5941 },   // 轰
+    { 0x8f72, 0, 0, 5942 },   // 轲
+    { 0x8f73, 0, 0, 5943 },   // 轳
+    { 0x8f74, 0, 0, 5944 },   // 轴
+    { 0x8f75, 0, 0, 5945 },   // 轵
+    { 0x8f76, 0, 0, 5946 },   // 轶
+    { 0x8f78, 0, 0, 5947 },   // 轸
+    { 0x8f79, 0, 0, 5948 },   // 轹
+    { 0x8f7a, 0, 0, 5949 },   // 轺
+    { 0x8f7b, 6990, 1, 5950 },   // 轻
+    { 0x8f7c, 0, 0, 5953 },   // 轼
+    { 0x8f7d, 0, 0, 5954 },   // 载
+    { 0x8f7e, 0, 0, 5955 },   // 轾
+    { 0x8f7f, 0, 0, 5956 },   // 轿
+    { 0x8f81, 0, 0, 5957 },   // 辁
+    { 0x8f82, 0, 0, 5958 },   // 辂
+    { 0x8f83, 0, 0, 5959 },   // 较
+    { 0x8f84, 0, 0, 5960 },   // 辄
+    { 0x8f85, 0, 0, 5961 },   // 辅
+    { 0x8f86, 0, 0, 5962 },   // 辆
+    { 0x8f87, 0, 0, 5963 },   // 辇
+    { 0x8f88, 0, 0, 5964 },   // 辈
+    { 0x8f89, 0, 0, 5965 },   // 辉
+    { 0x8f8a, 0, 0, 5966 },   // 辊
+    { 0x8f8b, 0, 0, 5967 },   // 辋
+    { 0x8f8d, 0, 0, 5968 },   // 辍
+    { 0x8f8e, 0, 0, 5969 },   // 辎
+    { 0x8f8f, 0, 0, 5970 },   // 辏
+    { 0x8f90, 0, 0, 5971 },   // 辐
+    { 0x8f91, 0, 0, 5972 },   // 辑
+    { 0x8f93, 0, 0, 5973 },   // 输
+    { 0x8f94, 0, 0, 5974 },   // 辔
+    { 0x8f95, 0, 0, 5975 },   // 辕
+    { 0x8f96, 0, 0, 5976 },   // 辖
+    { 0x8f97, 0, 0, 5977 },   // 辗
+    { 0x8f98, 0, 0, 5978 },   // 辘
+    { 0x8f99, 0, 0, 5979 },   // 辙
+    { 0x8f9a, 0, 0, 5980 },   // 辚
+    { 0x8f9e, 6991, 1, 5981 },   // 辞
+    { 0x8f9f, 6992, 14, -1 },   // 辟
+    { 0x8fa3, 7006, 1, -1 },   // 辣
+    { 0x8fa9, 7007, 1, 5998 },   // 辩
+    { 0x8fab, 7008, 1, 6000 },   // 辫
+    { 0x8fb0, 7009, 1, -1 },   // 辰
+    { 0x8fb9, 0, 0, 6003 },   // 边
+    { 0x8fbd, 7010, 1, 6004 },   // 辽
+    { 0x8fbe, 0, 0, 6006 },   // 达
+    { 0x8fc1, 0, 0, 6007 },   // 迁
+    { 0x8fc2, 7011, 1, -1 },   // 迂
+    { 0x8fc7, 7012, 1, 6009 },   // 过
+    { 0x8fc8, 0, 0, 6011 },   // 迈
+    { 0x8fd0, 0, 0, 6012 },   // 运
+    { 0x8fd1, 7013, 1, -1 },   // 近
+    { 0x8fd4, 7014, 1, -1 },   // 返
+    { 0x8fd8, 7015, 2, 6015 },   // 还
+    { 0x8fd9, 7017, 6, 6018 },   // 这
+    { 0x8fdb, 7023, 2, 6051 },   // 进
+    { 0x8fdc, 7025, 1, 6054 },   // 远
+    { 0x8fdd, 0, 0, 6056 },   // 违
+    { 0x8fde, 7026, 4, 6057 },   // 连
+    { 0x8fdf, 0, 0, 6062 },   // 迟
+    { 0x8fe5, 7030, 1, -1 },   // 迥
+    { 0x8fe9, 0, 0, 6064 },   // 迩
+    { 0x8ff3, 0, 0, 6065 },   // 迳
+    { 0x8ff7, 7031, 1, -1 },   // 迷
+    { 0x8ff9, 0, 0, 6067 },   // 迹
+    { 0x8ffd, 7032, 1, -1 },   // 追
+    { 0x9000, 7033, 1, -1 },   // 退
+    { 0x9002, 0, 0, 6070 },   // 适
+    { 0x9006, 7034, 2, -1 },   // 逆
+    { 0x9009, 7036, 1, 6074 },   // 选
+    { 0x900a, 0, 0, 6080 },   // 逊
+    { 0x900b, 7037, 1, -1 },   // 逋
+    { 0x900d, 7038, 1, -1 },   // 逍
+    { 0x900f, 7039, 1, -1 },   // 透
+    { 0x9012, 7040, 1, 6084 },   // 递
+    { 0x901a, 7041, 4, -1 },   // 通
+    { 0x901e, 7045, 1, -1 },   // 逞
+    { 0x9020, 7046, 1, -1 },   // 造
+    { 0x9026, 0, 0, 6093 },   // 逦
+    { 0x903b, 0, 0, 6094 },   // 逻
+    { 0x903c, 7047, 1, -1 },   // 逼
+    { 0x903e, 7048, 1, -1 },   // 逾
+    { 0x9047, 7049, 1, -1 },   // 遇
+    { 0x9053, 7050, 1, -1 },   // 道
+    { 0x9057, 7051, 3, 6099 },   // 遗
+    { 0x9065, 0, 0, 6103 },   // 遥
+    { 0x9068, 7054, 1, -1 },   // 遨
+    { 0x906e, 7055, 1, -1 },   // 遮
+    { 0x9080, 7056, 1, -1 },   // 邀
+    { 0x908b, 7057, 1, -1 },   // 邋
+    { 0x9093, 0, 0, 6108 },   // 邓
+    { 0x909d, 0, 0, 6109 },   // 邝
+    { 0x90a3, 7058, 3, -1 },   // 那
+    { 0x90ac, 0, 0, 6117 },   // 邬
+    { 0x90ae, 0, 0, 6118 },   // 邮
+    { 0x90b9, 0, 0, 6119 },   // 邹
+    { 0x90ba, 0, 0, 6120 },   // 邺
+    { 0x90bb, 0, 0, 6121 },   // 邻
+    { 0x90c1, 7061, 35, -1 },   // 郁
+    { 0x90ca, 7096, 1, -1 },   // 郊
+    { 0x90cf, 0, 0, 6164 },   // 郏
+    { 0x90d0, 0, 0, 6165 },   // 郐
+    { 0x90d1, 7097, 1, 6166 },   // 郑
+    { 0x90d3, 0, 0, 6168 },   // 郓
+    { 0x90d8, 7098, 1, -1 },   // 郘
+    { 0x90e6, 0, 0, 6170 },   // 郦
+    { 0x90e7, 0, 0, 6171 },   // 郧
+    { 0x90e8, 7099, 1, -1 },   // 部
+    { 0x90f8, 0, 0, 6173 },   // 郸
+    { 0x90fd, 7100, 1, -1 },   // 都
+    { 0x914d, 7101, 2, -1 },   // 配
+    { 0x9152, 7103, 4, -1 },   // 酒
+    { 0x915d, 0, 0, 6182 },   // 酝
+    { 0x9165, 7107, 1, -1 },   // 酥
+    { 0x9171, 0, 0, 6184 },   // 酱
+    { 0x9178, 7108, 1, -1 },   // 酸
+    { 0x917d, 0, 0, 6186 },   // 酽
+    { 0x917e, 0, 0, 6187 },   // 酾
+    { 0x917f, 7109, 1, 6188 },   // 酿
+    { 0x9187, 7110, 1, -1 },   // 醇
+    { 0x918b, 7111, 1, -1 },   // 醋
+    { 0x91c7, 7112, 71, -1 },   // 采
+    { 0x91ca, 0, 0, 6267 },   // 释
+    { 0x91cc, 7183, 18, -1 },   // 里
+    { 0x91cd, 7201, 5, -1 },   // 重
+    { 0x91ce, 7206, 2, -1 },   // 野
+    { 0x91cf, 7208, 1, -1 },   // 量
+    { 0x91d1, 7209, 9, -1 },   // 金
+    { 0x9274, 7218, 13, 6309 },   // 鉴
+    { 0x92ae, 0, 0, 6323 },   // 銮
+    { 0x933e, 0, 0, 6324 },   // 錾
+    { 0x9486, 0, 0, 6325 },   // 钆
+    { 0x9487, 0, 0, 6326 },   // 钇
+    { 0x9488, 0, 0, 6327 },   // 针
+    { 0x9489, 0, 0, 6328 },   // 钉
+    { 0x948a, 0, 0, 6329 },   // 钊
+    { 0x948b, 0, 0, 6330 },   // 钋
+    { 0x948c, 0, 0, 6331 },   // 钌
+    { 0x948d, 0, 0, 6332 },   // 钍
+    { 0x948f, 0, 0, 6333 },   // 钏
+    { 0x9490, 0, 0, 6334 },   // 钐
+    { 0x9492, 0, 0, 6335 },   // 钒
+    { 0x9493, 0, 0, 6336 },   // 钓
+    { 0x9494, 0, 0, 6337 },   // 钔
+    { 0x9495, 0, 0, 6338 },   // 钕
+    { 0x9497, 0, 0, 6339 },   // 钗
+    { 0x9499, 0, 0, 6340 },   // 钙
+    { 0x949b, 0, 0, 6341 },   // 钛
+    { 0x949c, 0, 0, 6342 },   // 钜
+    { 0x949d, 0, 0, 6343 },   // 钝
+    { 0x949e, 0, 0, 6344 },   // 钞
+    { 0x949f, 7231, 57, 6345 },   // 钟
+    { 0x94a0, 0, 0, 6416 },   // 钠
+    { 0x94a1, 0, 0, 6417 },   // 钡
+    { 0x94a2, 7288, 3, 6418 },   // 钢
+    { 0x94a3, 0, 0, 6422 },   // 钣
+    { 0x94a4, 0, 0, 6423 },   // 钤
+    { 0x94a5, 0, 0, 6424 },   // 钥
+    { 0x94a6, 0, 0, 6425 },   // 钦
+    { 0x94a7, 0, 0, 6426 },   // 钧
+    { 0x94a8, 0, 0, 6427 },   // 钨
+    { 0x94a9, 7291, 1, 6428 },   // 钩
+    { 0x94aa, 0, 0, 6430 },   // 钪
+    { 0x94ab, 0, 0, 6431 },   // 钫
+    { 0x94ac, 0, 0, 6432 },   // 钬
+    { 0x94ad, 0, 0, 6433 },   // 钭
+    { 0x94ae, 0, 0, 6434 },   // 钮
+    { 0x94af, 0, 0, 6435 },   // 钯
+    { 0x94b0, 0, 0, 6436 },   // 钰
+    { 0x94b1, 7292, 2, 6437 },   // 钱
+    { 0x94b2, 0, 0, 6440 },   // 钲
+    { 0x94b3, 0, 0, 6441 },   // 钳
+    { 0x94b4, 0, 0, 6442 },   // 钴
+    { 0x94b5, 0, 0, 6443 },   // 钵
+    { 0x94b6, 0, 0, 6444 },   // 钶
+    { 0x94b8, 0, 0, 6445 },   // 钸
+    { 0x94b9, 0, 0, 6446 },   // 钹
+    { 0x94ba, 0, 0, 6447 },   // 钺
+    { 0x94bb, 0, 0, 6448 },   // 钻
+    { 0x94bc, 0, 0, 6449 },   // 钼
+    { 0x94bd, 0, 0, 6450 },   // 钽
+    { 0x94be, 0, 0, 6451 },   // 钾
+    { 0x94bf, 0, 0, 6452 },   // 钿
+    { 0x94c0, 0, 0, 6453 },   // 铀
+    { 0x94c1, 7294, 3, 6454 },   // 铁
+    { 0x94c2, 0, 0, 6458 },   // 铂
+    { 0x94c3, 0, 0, 6459 },   // 铃
+    { 0x94c4, 0, 0, 6460 },   // 铄
+    { 0x94c5, 0, 0, 6461 },   // 铅
+    { 0x94c6, 0, 0, 6462 },   // 铆
+    { 0x94c8, 0, 0, 6463 },   // 铈
+    { 0x94c9, 0, 0, 6464 },   // 铉
+    { 0x94ca, 0, 0, 6465 },   // 铊
+    { 0x94cb, 0, 0, 6466 },   // 铋
+    { 0x94cc, 0, 0, 6467 },   // 铌
+    { 0x94cd, 0, 0, 6468 },   // 铍
+    { 0x94ce, 0, 0, 6469 },   // 铎
+    { 0x94d0, 0, 0, 6470 },   // 铐
+    { 0x94d1, 0, 0, 6471 },   // 铑
+    { 0x94d2, 0, 0, 6472 },   // 铒
+    { 0x94d5, 0, 0, 6473 },   // 铕
+    { 0x94d6, 0, 0, 6474 },   // 铖
+    { 0x94d7, 0, 0, 6475 },   // 铗
+    { 0x94d9, 0, 0, 6476 },   // 铙
+    { 0x94db, 0, 0, 6477 },   // 铛
+    { 0x94dc, 7297, 3, 6478 },   // 铜
+    { 0x94dd, 7300, 1, 6482 },   // 铝
+    { 0x94df, 0, 0, 6484 },   // 铟
+    { 0x94e0, 0, 0, 6485 },   // 铠
+    { 0x94e1, 0, 0, 6486 },   // 铡
+    { 0x94e2, 0, 0, 6487 },   // 铢
+    { 0x94e3, 0, 0, 6488 },   // 铣
+    { 0x94e4, 0, 0, 6489 },   // 铤
+    { 0x94e5, 0, 0, 6490 },   // 铥
+    { 0x94e7, 0, 0, 6491 },   // 铧
+    { 0x94e8, 0, 0, 6492 },   // 铨
+    { 0x94e9, 0, 0, 6493 },   // 铩
+    { 0x94ea, 0, 0, 6494 },   // 铪
+    { 0x94eb, 0, 0, 6495 },   // 铫
+    { 0x94ec, 0, 0, 6496 },   // 铬
+    { 0x94ed, 0, 0, 6497 },   // 铭
+    { 0x94ee, 0, 0, 6498 },   // 铮
+    { 0x94ef, 7301, 1, 6499 },   // 铯
+    { 0x94f0, 0, 0, 6501 },   // 铰
+    { 0x94f1, 0, 0, 6502 },   // 铱
+    { 0x94f2, 7302, 5, 6503 },   // 铲
+    { 0x94f3, 0, 0, 6509 },   // 铳
+    { 0x94f4, 0, 0, 6510 },   // 铴
+    { 0x94f5, 0, 0, 6511 },   // 铵
+    { 0x94f6, 7307, 2, 6512 },   // 银
+    { 0x94f7, 0, 0, 6515 },   // 铷
+    { 0x94f8, 7309, 1, 6516 },   // 铸
+    { 0x94f9, 0, 0, 6518 },   // 铹
+    { 0x94fa, 0, 0, 6519 },   // 铺
+    { 0x94fc, 0, 0, 6520 },   // 铼
+    { 0x94fd, 0, 0, 6521 },   // 铽
+    { 0x94fe, 7310, 1, 6522 },   // 链
+    { 0x94ff, 0, 0, 6524 },   // 铿
+    { 0x9500, 0, 0, 6525 },   // 销
+    { 0x9501, 0, 0, 6526 },   // 锁
+    { 0x9502, 0, 0, 6527 },   // 锂
+    { 0x9504, 0, 0, 6528 },   // 锄
+    { 0x9505, 0, 0, 6529 },   // 锅
+    { 0x9506, 0, 0, 6530 },   // 锆
+    { 0x9507, 0, 0, 6531 },   // 锇
+    { 0x9508, 7311, 3, 6532 },   // 锈
+    { 0x9509, 0, 0, 6536 },   // 锉
+    { 0x950a, 0, 0, 6537 },   // 锊
+    { 0x950b, 0, 0, 6538 },   // 锋
+    { 0x950c, 7314, 1, 6539 },   // 锌
+    { 0x9510, 0, 0, 6541 },   // 锐
+    { 0x9511, 0, 0, 6542 },   // 锑
+    { 0x9512, 0, 0, 6543 },   // 锒
+    { 0x9513, 0, 0, 6544 },   // 锓
+    { 0x9514, 0, 0, 6545 },   // 锔
+    { 0x9515, 0, 0, 6546 },   // 锕
+    { 0x9516, 0, 0, 6547 },   // 锖
+    { 0x9517, 0, 0, 6548 },   // 锗
+    { 0x9519, 0, 0, 6549 },   // 错
+    { 0x951a, 0, 0, 6550 },   // 锚
+    { 0x951b, 0, 0, 6551 },   // 锛
+    { 0x951e, 0, 0, 6552 },   // 锞
+    { 0x951f, 0, 0, 6553 },   // 锟
+    { 0x9521, 0, 0, 6554 },   // 锡
+    { 0x9522, 0, 0, 6555 },   // 锢
+    { 0x9523, 0, 0, 6556 },   // 锣
+    { 0x9524, 7315, 1, 6557 },   // 锤
+    { 0x9525, 0, 0, 6559 },   // 锥
+    { 0x9526, 7316, 2, 6560 },   // 锦
+    { 0x9528, 0, 0, 6563 },   // 锨
+    { 0x9529, 0, 0, 6564 },   // 锩
+    { 0x952c, 0, 0, 6565 },   // 锬
+    { 0x952d, 0, 0, 6566 },   // 锭
+    { 0x952e, 0, 0, 6567 },   // 键
+    { 0x952f, 0, 0, 6568 },   // 锯
+    { 0x9530, 0, 0, 6569 },   // 锰
+    { 0x9531, 0, 0, 6570 },   // 锱
+    { 0x9532, 7318, 1, 6571 },   // 锲
+    { 0x9534, 0, 0, 6573 },   // 锴
+    { 0x9535, 0, 0, 6574 },   // 锵
+    { 0x9536, 0, 0, 6575 },   // 锶
+    { 0x9537, 0, 0, 6576 },   // 锷
+    { 0x9538, 0, 0, 6577 },   // 锸
+    { 0x9539, 0, 0, 6578 },   // 锹
+    { 0x953a, 0, 0, 6579 },   // 锺
+    { 0x953b, 0, 0, 6580 },   // 锻
+    { 0x953c, 0, 0, 6581 },   // 锼
+    { 0x953e, 0, 0, 6582 },   // 锾
+    { 0x9540, 0, 0, 6583 },   // 镀
+    { 0x9541, 0, 0, 6584 },   // 镁
+    { 0x9542, 0, 0, 6585 },   // 镂
+    { 0x9544, 0, 0, 6586 },   // 镄
+    { 0x9546, 0, 0, 6587 },   // 镆
+    { 0x9547, 7319, 1, 6588 },   // 镇
+    { 0x9549, 0, 0, 6590 },   // 镉
+    { 0x954a, 0, 0, 6591 },   // 镊
+    { 0x954c, 0, 0, 6592 },   // 镌
+    { 0x954d, 0, 0, 6593 },   // 镍
+    { 0x954f, 0, 0, 6594 },   // 镏
+    { 0x9550, 0, 0, 6595 },   // 镐
+    { 0x9551, 0, 0, 6596 },   // 镑
+    { 0x9552, 0, 0, 6597 },   // 镒
+    { 0x9553, 0, 0, 6598 },   // 镓
+    { 0x9554, 0, 0, 6599 },   // 镔
+    { 0x9556, 0, 0, 6600 },   // 镖
+    { 0x9557, 0, 0, 6601 },   // 镗
+    { 0x9558, 0, 0, 6602 },   // 镘
+    { 0x9559, 0, 0, 6603 },   // 镙
+    { 0x955b, 0, 0, 6604 },   // 镛
+    { 0x955c, 7320, 1, 6605 },   // 镜
+    { 0x955d, 0, 0, 6607 },   // 镝
+    { 0x955e, 0, 0, 6608 },   // 镞
+    { 0x955f, 0, 0, 6609 },   // 镟
+    { 0x9561, 0, 0, 6610 },   // 镡
+    { 0x9562, 0, 0, 6611 },   // 镢
+    { 0x9563, 0, 0, 6612 },   // 镣
+    { 0x9564, 0, 0, 6613 },   // 镤
+    { 0x9566, 0, 0, 6614 },   // 镦
+    { 0x9567, 0, 0, 6615 },   // 镧
+    { 0x9568, 0, 0, 6616 },   // 镨
+    { 0x956a, 0, 0, 6617 },   // 镪
+    { 0x956b, 0, 0, 6618 },   // 镫
+    { 0x956c, 0, 0, 6619 },   // 镬
+    { 0x956d, 0, 0, 6620 },   // 镭
+    { 0x956f, 0, 0, 6621 },   // 镯
+    { 0x9570, 7321, 1, 6622 },   // 镰
+    { 0x9571, 0, 0, 6624 },   // 镱
+    { 0x9573, 0, 0, 6625 },   // 镳
+    { 0x9576, 0, 0, 6626 },   // 镶
+    { 0x957f, 7322, 4, 6627 },   // 长
+    { 0x95e8, 7326, 3, 6635 },   // 门
+    { 0x95e9, 0, 0, 6639 },   // 闩
+    { 0x95ea, 0, 0, 6640 },   // 闪
+    { 0x95eb, 7329, 1, 6641 },   // 闫
+    { 0x95ed, 0, 0, 6643 },   // 闭
+    { 0x95ee, 0, 0, 6644 },   // 问
+    { 0x95ef, 7330, 2, 6645 },   // 闯
+    { 0x95f0, 0, 0, 6648 },   // 闰
+    { 0x95f1, 0, 0, 6649 },   // 闱
+    { 0x95f2, 7332, 4, 6650 },   // 闲
+    { 0x95f3, 0, 0, 6655 },   // 闳
+    { 0x95f4, 7336, 2, 6656 },   // 间
+    { 0x95f5, 7338, 1, 6659 },   // 闵
+    { 0x95f6, 0, 0, 6661 },   // 闶
+    { 0x95f7, 0, 0, 6662 },   // 闷
+    { 0x95f8, 0, 0, 6663 },   // 闸
+    { 0x95f9, 7339, 2, 6664 },   // 闹
+    { 0x95fa, 7341, 1, 6667 },   // 闺
+    { 0x95fb, 7342, 1, 6669 },   // 闻
+    { 0x95fc, 0, 0, 6671 },   // 闼
+    { 0x95fd, 0, 0, 6672 },   // 闽
+    { 0x95fe, 0, 0, 6673 },   // 闾
+    { 0x9600, 0, 0, 6674 },   // 阀
+    { 0x9601, 7343, 1, 6675 },   // 阁
+    { 0x9602, 0, 0, 6677 },   // 阂
+    { 0x9603, 7344, 1, 6678 },   // 阃
+    { 0x9604, 0, 0, 6680 },   // 阄
+    { 0x9605, 0, 0, 6681 },   // 阅
+    { 0x9606, 0, 0, 6682 },   // 阆
+    { 0x9608, 0, 0, 6683 },   // 阈
+    { 0x9609, 0, 0, 6684 },   // 阉
+    { 0x960a, 0, 0, 6685 },   // 阊
+    { 0x960b, 0, 0, 6686 },   // 阋
+    { 0x960c, 0, 0, 6687 },   // 阌
+    { 0x960d, 0, 0, 6688 },   // 阍
+    { 0x960e, 0, 0, 6689 },   // 阎
+    { 0x960f, 0, 0, 6690 },   // 阏
+    { 0x9610, 0, 0, 6691 },   // 阐
+    { 0x9611, 0, 0, 6692 },   // 阑
+    { 0x9612, 0, 0, 6693 },   // 阒
+    { 0x9614, 0, 0, 6694 },   // 阔
+    { 0x9615, 0, 0, 6695 },   // 阕
+    { 0x9616, 0, 0, 6696 },   // 阖
+    { 0x9617, 0, 0, 6697 },   // 阗
+    { 0x9619, 0, 0, 6698 },   // 阙
+    { 0x961a, 0, 0, 6699 },   // 阚
+    { 0x961f, 7345, 1, 6700 },   // 队
+    { 0x9632, 7346, 4, -1 },   // 防
+    { 0x9633, 7350, 3, 6706 },   // 阳
+    { 0x9634, 7353, 4, 6711 },   // 阴
+    { 0x9635, 0, 0, 6717 },   // 阵
+    { 0x9636, 0, 0, 6718 },   // 阶
+    { 0x9644, 7357, 1, -1 },   // 附
+    { 0x9645, 0, 0, 6720 },   // 际
+    { 0x9646, 0, 0, 6721 },   // 陆
+    { 0x9647, 0, 0, 6722 },   // 陇
+    { 0x9648, 7358, 4, 6723 },   // 陈
+    { 0x9649, 0, 0, 6728 },   // 陉
+    { 0x9655, 0, 0, 6729 },   // 陕
+    { 0x9662, 7362, 1, -1 },   // 院
+    { 0x9667, 0, 0, 6731 },   // 陧
+    { 0x9668, 0, 0, 6732 },   // 陨
+    { 0x9669, 0, 0, 6733 },   // 险
+    { 0x966a, 7363, 1, -1 },   // 陪
+    { 0x9676, 7364, 1, -1 },   // 陶
+    { 0x9686, 7365, 1, -1 },   // 隆
+    { 0x968f, 0, 0, 6738 },   // 随
+    { 0x9690, 7366, 2, 6739 },   // 隐
+    { 0x96b6, 0, 0, 6742 },   // 隶
+    { 0x96bd, 0, 0, 6743 },   // 隽
+    { 0x96be, 7368, 1, 6744 },   // 难
+    { 0x96c5, 7369, 1, -1 },   // 雅
+    { 0x96c6, 7370, 4, -1 },   // 集
+    { 0x96c7, 7374, 9, -1 },   // 雇
+    { 0x96cf, 0, 0, 6760 },   // 雏
+    { 0x96d5, 7383, 5, -1 },   // 雕
+    { 0x96e0, 0, 0, 6766 },   // 雠
+    { 0x96e8, 7388, 1, -1 },   // 雨
+    { 0x96ea, 7389, 2, -1 },   // 雪
+    { 0x96f3, 0, 0, 6772 },   // 雳
+    { 0x96f6, 7391, 5, -1 },   // 零
+    { 0x96fe, 7396, 1, 6778 },   // 雾
+    { 0x9701, 7397, 1, 6780 },   // 霁
+    { 0x9707, 7398, 1, -1 },   // 震
+    { 0x9709, 7399, 6, -1 },   // 霉
+    { 0x972d, 0, 0, 6789 },   // 霭
+    { 0x9732, 7405, 1, -1 },   // 露
+    { 0x9752, 7406, 2, -1 },   // 青
+    { 0x9753, 0, 0, 6793 },   // 靓
+    { 0x9759, 0, 0, 6794 },   // 静
+    { 0x975e, 7408, 1, -1 },   // 非
+    { 0x9762, 7409, 27, -1 },   // 面
+    { 0x9765, 0, 0, 6835 },   // 靥
+    { 0x978b, 7436, 1, -1 },   // 鞋
+    { 0x9791, 0, 0, 6837 },   // 鞑
+    { 0x97a3, 7437, 1, -1 },   // 鞣
+    { 0x97ad, 7438, 1, -1 },   // 鞭
+    { 0x97af, 0, 0, 6840 },   // 鞯
+    { 0x97e6, 7439, 1, 6841 },   // 韦
+    { 0x97e7, 0, 0, 6843 },   // 韧
+    { 0x97e9, 7440, 2, 6844 },   // 韩
+    { 0x97ea, 0, 0, 6847 },   // 韪
+    { 0x97eb, 0, 0, 6848 },   // 韫
+    { 0x97ec, 0, 0, 6849 },   // 韬
+    { 0x97f3, 7442, 3, -1 },   // 音
+    { 0x97f5, 0, 0, 6853 },   // 韵
+    { 0x97f6, 7445, 1, -1 },   // 韶
+    { 0x9875, 7446, 1, 6855 },   // 页
+    { 0x9876, 7447, 2, 6857 },   // 顶
+    { 0x9877, 0, 0, 6860 },   // 顷
+    { 0x9878, 0, 0, 6861 },   // 顸
+    { 0x9879, 7449, 1, 6862 },   // 项
+    { 0x987a, 7450, 2, 6864 },   // 顺
+    { 0x987b, 7452, 9, 6867 },   // 须
+    { 0x987c, 0, 0, 6878 },   // 顼
+    { 0x987d, 0, 0, 6879 },   // 顽
+    { 0x987e, 0, 0, 6880 },   // 顾
+    { 0x987f, 0, 0, 6881 },   // 顿
+    { 0x9880, 0, 0, 6882 },   // 颀
+    { 0x9881, 0, 0, 6883 },   // 颁
+    { 0x9882, 7461, 2, 6884 },   // 颂
+    { 0x9883, 0, 0, 6887 },   // 颃
+    { 0x9884, 7463, 2, 6888 },   // 预
+    { 0x9885, 0, 0, 6891 },   // 颅
+    { 0x9886, 7465, 1, 6892 },   // 领
+    { 0x9887, 0, 0, 6894 },   // 颇
+    { 0x9888, 0, 0, 6895 },   // 颈
+    { 0x9889, 0, 0, 6896 },   // 颉
+    { 0x988a, 7466, 1, 6897 },   // 颊
+    { 0x988c, 0, 0, 6899 },   // 颌
+    { 0x988d, 0, 0, 6900 },   // 颍
+    { 0x988f, 0, 0, 6901 },   // 颏
+    { 0x9890, 0, 0, 6902 },   // 颐
+    { 0x9891, 0, 0, 6903 },   // 频
+    { 0x9893, 0, 0, 6904 },   // 颓
+    { 0x9894, 0, 0, 6905 },   // 颔
+    { 0x9896, 0, 0, 6906 },   // 颖
+    { 0x9897, 0, 0, 6907 },   // 颗
+    { 0x9898, 0, 0, 6908 },   // 题
+    { 0x989a, 0, 0, 6909 },   // 颚
+    { 0x989b, 7467, 1, 6910 },   // 颛
+    { 0x989c, 7468, 1, 6912 },   // 颜
+    { 0x989d, 7469, 2, 6914 },   // 额
+    { 0x989e, 0, 0, 6918 },   // 颞
+    { 0x989f, 0, 0, 6919 },   // 颟
+    { 0x98a0, 7471, 2, 6920 },   // 颠
+    { 0x98a1, 0, 0, 6923 },   // 颡
+    { 0x98a2, 0, 0, 6924 },   // 颢
+    { 0x98a4, 7473, 1, 6925 },   // 颤
+    { 0x98a6, 0, 0, 6927 },   // 颦
+    { 0x98a7, 0, 0, 6928 },   // 颧
+    { 0x98ce, 7474, 10, 6929 },   // 风
+    { 0x98d1, 0, 0, 6940 },   // 飑
+    { 0x98d2, 0, 0, 6941 },   // 飒
+    { 0x98d3, 0, 0, 6942 },   // 飓
+    { 0x98d5, 0, 0, 6943 },   // 飕
+    { 0x98d8, 7484, 4, 6944 },   // 飘
+    { 0x98d9, 0, 0, 6949 },   // 飙
+    { 0x98de, 7488, 3, 6950 },   // 飞
+    { 0x98df, 7491, 2, -1 },   // 食
+    { 0x98e8, 0, 0, 6956 },   // 飨
+    { 0x990d, 0, 0, 6957 },   // 餍
+    { 0x9910, 7493, 1, -1 },   // 餐
+    { 0x9965, 7494, 7, 6959 },   // 饥
+    { 0x9967, 0, 0, 6967 },   // 饧
+    { 0x9968, 0, 0, 6968 },   // 饨
+    { 0x9969, 0, 0, 6969 },   // 饩
+    { 0x996a, 0, 0, 6970 },   // 饪
+    { 0x996b, 0, 0, 6971 },   // 饫
+    { 0x996c, 0, 0, 6972 },   // 饬
+    { 0x996d, 7501, 2, 6973 },   // 饭
+    { 0x996e, 0, 0, 6976 },   // 饮
+    { 0x996f, 0, 0, 6977 },   // 饯
+    { 0x9970, 0, 0, 6978 },   // 饰
+    { 0x9971, 0, 0, 6979 },   // 饱
+    { 0x9972, 0, 0, 6980 },   // 饲
+    { 0x9974, 0, 0, 6981 },   // 饴
+    { 0x9975, 0, 0, 6982 },   // 饵
+    { 0x9976, 0, 0, 6983 },   // 饶
+    { 0x9977, 0, 0, 6984 },   // 饷
+    { 0x997a, 0, 0, 6985 },   // 饺
+    { 0x997c, 7503, 1, 6986 },   // 饼
+    { 0x997d, 0, 0, 6988 },   // 饽
+    { 0x997f, 0, 0, 6989 },   // 饿
+    { 0x9980, 0, 0, 6990 },   // 馀
+    { 0x9981, 0, 0, 6991 },   // 馁
+    { 0x9984, 7504, 1, 6992 },   // 馄
+    { 0x9985, 0, 0, 6994 },   // 馅
+    { 0x9986, 7505, 2, 6995 },   // 馆
+    { 0x9988, 0, 0, 6998 },   // 馈
+    { 0x998a, 0, 0, 6999 },   // 馊
+    { 0x998b, 0, 0, 7000 },   // 馋
+    { 0x998d, 0, 0, 7001 },   // 馍
+    { 0x998f, 0, 0, 7002 },   // 馏
+    { 0x9990, 0, 0, 7003 },   // 馐
+    { 0x9991, 0, 0, 7004 },   // 馑
+    { 0x9992, 0, 0, 7005 },   // 馒
+    { 0x9994, 0, 0, 7006 },   // 馔
+    { 0x9996, 7507, 4, -1 },   // 首
+    { 0x9999, 7511, 1, -1 },   // 香
+    { 0x9a6c, 7512, 4, 7012 },   // 马
+    { 0x9a6d, 0, 0, 7017 },   // 驭
+    { 0x9a6e, 0, 0, 7018 },   // 驮
+    { 0x9a6f, 0, 0, 7019 },   // 驯
+    { 0x9a70, 0, 0, 7020 },   // 驰
+    { 0x9a71, 0, 0, 7021 },   // 驱
+    { 0x9a73, 0, 0, 7022 },   // 驳
+    { 0x9a74, 0, 0, 7023 },   // 驴
+    { 0x9a75, 0, 0, 7024 },   // 驵
+    { 0x9a76, 0, 0, 7025 },   // 驶
+    { 0x9a77, 0, 0, 7026 },   // 驷
+    { 0x9a78, 0, 0, 7027 },   // 驸
+    { 0x9a79, 0, 0, 7028 },   // 驹
+    { 0x9a7a, 0, 0, 7029 },   // 驺
+    { 0x9a7b, 7516, 1, 7030 },   // 驻
+    { 0x9a7c, 0, 0, 7032 },   // 驼
+    { 0x9a7d, 0, 0, 7033 },   // 驽
+    { 0x9a7e, 0, 0, 7034 },   // 驾
+    { 0x9a7f, 0, 0, 7035 },   // 驿
+    { 0x9a80, 7517, 1, 7036 },   // 骀
+    { 0x9a81, 0, 0, 7038 },   // 骁
+    { 0x9a82, 0, 0, 7039 },   // 骂
+    { 0x9a84, 0, 0, 7040 },   // 骄
+    { 0x9a85, 0, 0, 7041 },   // 骅
+    { 0x9a86, 0, 0, 7042 },   // 骆
+    { 0x9a87, 0, 0, 7043 },   // 骇
+    { 0x9a88, 0, 0, 7044 },   // 骈
+    { 0x9a8a, 0, 0, 7045 },   // 骊
+    { 0x9a8b, 0, 0, 7046 },   // 骋
+    { 0x9a8c, 0, 0, 7047 },   // 验
+    { 0x9a8f, 0, 0, 7048 },   // 骏
+    { 0x9a90, 0, 0, 7049 },   // 骐
+    { 0x9a91, 0, 0, 7050 },   // 骑
+    { 0x9a92, 0, 0, 7051 },   // 骒
+    { 0x9a93, 0, 0, 7052 },   // 骓
+    { 0x9a96, 0, 0, 7053 },   // 骖
+    { 0x9a97, 0, 0, 7054 },   // 骗
+    { 0x9a98, 0, 0, 7055 },   // 骘
+    { 0x9a9a, 0, 0, 7056 },   // 骚
+    { 0x9a9b, 0, 0, 7057 },   // 骛
+    { 0x9a9c, 0, 0, 7058 },   // 骜
+    { 0x9a9d, 0, 0, 7059 },   // 骝
+    { 0x9a9e, 0, 0, 7060 },   // 骞
+    { 0x9a9f, 0, 0, 7061 },   // 骟
+    { 0x9aa0, 0, 0, 7062 },   // 骠
+    { 0x9aa1, 0, 0, 7063 },   // 骡
+    { 0x9aa2, 0, 0, 7064 },   // 骢
+    { 0x9aa3, 0, 0, 7065 },   // 骣
+    { 0x9aa4, 0, 0, 7066 },   // 骤
+    { 0x9aa5, 0, 0, 7067 },   // 骥
+    { 0x9aa7, 0, 0, 7068 },   // 骧
+    { 0x9aa8, 7518, 3, -1 },   // 骨
+    { 0x9ac5, 0, 0, 7072 },   // 髅
+    { 0x9acb, 0, 0, 7073 },   // 髋
+    { 0x9acc, 0, 0, 7074 },   // 髌
+    { 0x9ad8, 7521, 1, -1 },   // 高
+    { 0x9ae1, 7522, 1, -1 },   // 髡
+    { 0x9aed, 7523, 2, -1 },   // 髭
+    { 0x9aef, 7525, 1, -1 },   // 髯
+    { 0x9afc, 7526, 1, -1 },   // 髼
+    { 0x9b05, 7527, 1, -1 },   // 鬅
+    { 0x9b08, 7528, 1, -1 },   // 鬈
+    { 0x9b12, 7529, 1, -1 },   // 鬒
+    { 0x9b13, 7530, 1, 7086 },   // 鬓
+    { 0x9b3c, 7531, 1, -1 },   // 鬼
+    { 0x9b42, 7532, 1, -1 },   // 魂
+    { 0x9b47, 0, 0, 7090 },   // 魇
+    { 0x9b49, 0, 0, 7091 },   // 魉
+    { 0x9b4f, 7533, 1, -1 },   // 魏
+    { 0x9b54, 7534, 1, -1 },   // 魔
+    { 0x9c7c, 7535, 2, 7094 },   // 鱼
+    { 0x9c7f, 0, 0, 7097 },   // 鱿
+    { 0x9c81, 0, 0, 7098 },   // 鲁
+    { 0x9c82, 0, 0, 7099 },   // 鲂
+    { 0x9c86, 0, 0, 7100 },   // 鲆
+    { 0x9c87, 0, 0, 7101 },   // 鲇
+    { 0x9c88, 0, 0, 7102 },   // 鲈
+    { 0x9c8b, 0, 0, 7103 },   // 鲋
+    { 0x9c8d, 0, 0, 7104 },   // 鲍
+    { 0x9c8e, 0, 0, 7105 },   // 鲎
+    { 0x9c90, 0, 0, 7106 },   // 鲐
+    { 0x9c91, 0, 0, 7107 },   // 鲑
+    { 0x9c92, 0, 0, 7108 },   // 鲒
+    { 0x9c94, 0, 0, 7109 },   // 鲔
+    { 0x9c95, 0, 0, 7110 },   // 鲕
+    { 0x9c9a, 0, 0, 7111 },   // 鲚
+    { 0x9c9b, 0, 0, 7112 },   // 鲛
+    { 0x9c9c, 7537, 1, 7113 },   // 鲜
+    { 0x9c9e, 0, 0, 7115 },   // 鲞
+    { 0x9c9f, 0, 0, 7116 },   // 鲟
+    { 0x9ca0, 0, 0, 7117 },   // 鲠
+    { 0x9ca1, 0, 0, 7118 },   // 鲡
+    { 0x9ca2, 0, 0, 7119 },   // 鲢
+    { 0x9ca3, 0, 0, 7120 },   // 鲣
+    { 0x9ca4, 0, 0, 7121 },   // 鲤
+    { 0x9ca5, 0, 0, 7122 },   // 鲥
+    { 0x9ca6, 0, 0, 7123 },   // 鲦
+    { 0x9ca7, 0, 0, 7124 },   // 鲧
+    { 0x9ca8, 0, 0, 7125 },   // 鲨
+    { 0x9ca9, 0, 0, 7126 },   // 鲩
+    { 0x9cab, 0, 0, 7127 },   // 鲫
+    { 0x9cad, 0, 0, 7128 },   // 鲭
+    { 0x9cae, 0, 0, 7129 },   // 鲮
+    { 0x9cb0, 0, 0, 7130 },   // 鲰
+    { 0x9cb1, 0, 0, 7131 },   // 鲱
+    { 0x9cb2, 0, 0, 7132 },   // 鲲
+    { 0x9cb3, 0, 0, 7133 },   // 鲳
+    { 0x9cb5, 0, 0, 7134 },   // 鲵
+    { 0x9cb7, 0, 0, 7135 },   // 鲷
+    { 0x9cb8, 7538, 1, 7136 },   // 鲸
+    { 0x9cbb, 0, 0, 7138 },   // 鲻
+    { 0x9cbd, 0, 0, 7139 },   // 鲽
+    { 0x9cc3, 0, 0, 7140 },   // 鳃
+    { 0x9cc4, 0, 0, 7141 },   // 鳄
+    { 0x9cc5, 0, 0, 7142 },   // 鳅
+    { 0x9cc6, 0, 0, 7143 },   // 鳆
+    { 0x9cc7, 0, 0, 7144 },   // 鳇
+    { 0x9ccc, 0, 0, 7145 },   // 鳌
+    { 0x9ccd, 0, 0, 7146 },   // 鳍
+    { 0x9cce, 0, 0, 7147 },   // 鳎
+    { 0x9ccf, 0, 0, 7148 },   // 鳏
+    { 0x9cd0, 0, 0, 7149 },   // 鳐
+    { 0x9cd3, 0, 0, 7150 },   // 鳓
+    { 0x9cd4, 0, 0, 7151 },   // 鳔
+    { 0x9cd5, 0, 0, 7152 },   // 鳕
+    { 0x9cd6, 0, 0, 7153 },   // 鳖
+    { 0x9cd7, 0, 0, 7154 },   // 鳗
+    { 0x9cdc, 0, 0, 7155 },   // 鳜
+    { 0x9cdd, 0, 0, 7156 },   // 鳝
+    { 0x9cde, 0, 0, 7157 },   // 鳞
+    { 0x9cdf, 0, 0, 7158 },   // 鳟
+    { 0x9ce2, 0, 0, 7159 },   // 鳢
+    { 0x9e1f, 7539, 1, 7160 },   // 鸟
+    { 0x9e20, 0, 0, 7162 },   // 鸠
+    { 0x9e21, 7540, 7, 7163 },   // 鸡
+    { 0x9e22, 0, 0, 7172 },   // 鸢
+    { 0x9e23, 7547, 1, 7173 },   // 鸣
+    { 0x9e25, 0, 0, 7175 },   // 鸥
+    { 0x9e26, 0, 0, 7176 },   // 鸦
+    { 0x9e28, 0, 0, 7177 },   // 鸨
+    { 0x9e29, 0, 0, 7178 },   // 鸩
+    { 0x9e2a, 0, 0, 7179 },   // 鸪
+    { 0x9e2b, 0, 0, 7180 },   // 鸫
+    { 0x9e2c, 0, 0, 7181 },   // 鸬
+    { 0x9e2d, 0, 0, 7182 },   // 鸭
+    { 0x9e2f, 0, 0, 7183 },   // 鸯
+    { 0x9e31, 0, 0, 7184 },   // 鸱
+    { 0x9e32, 0, 0, 7185 },   // 鸲
+    { 0x9e33, 0, 0, 7186 },   // 鸳
+    { 0x9e35, 0, 0, 7187 },   // 鸵
+    { 0x9e36, 0, 0, 7188 },   // 鸶
+    { 0x9e37, 0, 0, 7189 },   // 鸷
+    { 0x9e38, 0, 0, 7190 },   // 鸸
+    { 0x9e39, 0, 0, 7191 },   // 鸹
+    { 0x9e3a, 0, 0, 7192 },   // 鸺
+    { 0x9e3d, 0, 0, 7193 },   // 鸽
+    { 0x9e3e, 7548, 1, 7194 },   // 鸾
+    { 0x9e3f, 7549, 1, 7196 },   // 鸿
+    { 0x9e41, 0, 0, 7198 },   // 鹁
+    { 0x9e42, 0, 0, 7199 },   // 鹂
+    { 0x9e43, 0, 0, 7200 },   // 鹃
+    { 0x9e44, 7550, 1, 7201 },   // 鹄
+    { 0x9e45, 7551, 1, 7203 },   // 鹅
+    { 0x9e46, 0, 0, 7205 },   // 鹆
+    { 0x9e47, 0, 0, 7206 },   // 鹇
+    { 0x9e48, 0, 0, 7207 },   // 鹈
+    { 0x9e49, 0, 0, 7208 },   // 鹉
+    { 0x9e4a, 0, 0, 7209 },   // 鹊
+    { 0x9e4c, 0, 0, 7210 },   // 鹌
+    { 0x9e4e, 0, 0, 7211 },   // 鹎
+    { 0x9e4f, 0, 0, 7212 },   // 鹏
+    { 0x9e51, 0, 0, 7213 },   // 鹑
+    { 0x9e55, 0, 0, 7214 },   // 鹕
+    { 0x9e57, 0, 0, 7215 },   // 鹗
+    { 0x9e58, 0, 0, 7216 },   // 鹘
+    { 0x9e5a, 0, 0, 7217 },   // 鹚
+    { 0x9e5c, 0, 0, 7218 },   // 鹜
+    { 0x9e5e, 0, 0, 7219 },   // 鹞
+    { 0x9e63, 0, 0, 7220 },   // 鹣
+    { 0x9e64, 7552, 3, 7221 },   // 鹤
+    { 0x9e66, 0, 0, 7225 },   // 鹦
+    { 0x9e67, 0, 0, 7226 },   // 鹧
+    { 0x9e68, 0, 0, 7227 },   // 鹨
+    { 0x9e69, 0, 0, 7228 },   // 鹩
+    { 0x9e6a, 0, 0, 7229 },   // 鹪
+    { 0x9e6b, 0, 0, 7230 },   // 鹫
+    { 0x9e6c, 0, 0, 7231 },   // 鹬
+    { 0x9e6d, 0, 0, 7232 },   // 鹭
+    { 0x9e70, 7555, 1, 7233 },   // 鹰
+    { 0x9e73, 0, 0, 7235 },   // 鹳
+    { 0x9e7e, 0, 0, 7236 },   // 鹾
+    { 0x9e9f, 7556, 1, -1 },   // 麟
+    { 0x9ea6, 0, 0, 7238 },   // 麦
+    { 0x9eb8, 0, 0, 7239 },   // 麸
+    { 0x9eb9, 7557, 1, 7240 },   // 麹
+    { 0x9ebb, 7558, 2, -1 },   // 麻
+    { 0x9ec4, 7560, 11, 7244 },   // 黄
+    { 0x9ec9, 0, 0, 7258 },   // 黉
+    { 0x9ece, 7571, 1, -1 },   // 黎
+    { 0x9ed1, 7572, 4, -1 },   // 黑
+    { 0x9ee9, 0, 0, 7264 },   // 黩
+    { 0x9eea, 0, 0, 7265 },   // 黪
+    { 0x9efe, 0, 0, 7266 },   // 黾
+    { 0x9f0b, 0, 0, 7267 },   // 鼋
+    { 0x9f0d, 0, 0, 7268 },   // 鼍
+    { 0x9f13, 7576, 2, -1 },   // 鼓
+    { 0x9f17, 0, 0, 7271 },   // 鼗
+    { 0x9f20, 7578, 1, -1 },   // 鼠
+    { 0x9f39, 0, 0, 7273 },   // 鼹
+    { 0x9f3b, 7579, 2, -1 },   // 鼻
+    { 0x9f50, 7581, 1, 7277 },   // 齐
+    { 0x9f51, 0, 0, 7279 },   // 齑
+    { 0x9f7f, 7582, 3, 7280 },   // 齿
+    { 0x9f80, 0, 0, 7284 },   // 龀
+    { 0x9f83, 0, 0, 7285 },   // 龃
+    { 0x9f84, 0, 0, 7286 },   // 龄
+    { 0x9f85, 0, 0, 7287 },   // 龅
+    { 0x9f86, 0, 0, 7288 },   // 龆
+    { 0x9f87, 0, 0, 7289 },   // 龇
+    { 0x9f88, 0, 0, 7290 },   // 龈
+    { 0x9f89, 0, 0, 7291 },   // 龉
+    { 0x9f8a, 0, 0, 7292 },   // 龊
+    { 0x9f8b, 0, 0, 7293 },   // 龋
+    { 0x9f8c, 0, 0, 7294 },   // 龌
+    { 0x9f99, 7585, 5, 7295 },   // 龙
+    { 0x9f9a, 0, 0, 7302 },   // 龚
+    { 0x9f9b, 0, 0, 7303 },   // 龛
+    { 0x9f9f, 7590, 1, 7304 },   // 龟
+    { 0x4f59, 0, 0, 0 },   // 余
+    { 0x53ea, 0, 0, 1 },   // 只
+    { 0x5468, 7591, 1, -1 },   // 周
+    { 0x4e2a, 7592, 1, 3 },   // 个
+    { 0x4e89, 7593, 1, -1 },   // 争
+    { 0x4f19, 7594, 1, 6 },   // 伙
+    { 0x4f59, 0, 0, 8 },   // 余
+    { 0x51b2, 0, 0, 9 },   // 冲
+    { 0x51c6, 0, 0, 10 },   // 准
+    { 0x51fa, 7595, 7, -1 },   // 出
+    { 0x5398, 7602, 1, -1 },   // 厘
+    { 0x53d1, 7603, 1, -1 },   // 发
+    { 0x53ea, 0, 0, 20 },   // 只
+    { 0x540a, 7604, 1, -1 },   // 吊
+    { 0x5468, 7605, 1, -1 },   // 周
+    { 0x54c4, 7606, 1, -1 },   // 哄
+    { 0x5730, 7607, 1, -1 },   // 地
+    { 0x5929, 7608, 2, -1 },   // 天
+    { 0x5e72, 7610, 1, -1 },   // 干
+    { 0x5e76, 0, 0, 28 },   // 并
+    { 0x624e, 0, 0, 29 },   // 扎
+    { 0x6811, 7611, 1, -1 },   // 树
+    { 0x7269, 7612, 1, -1 },   // 物
+    { 0x7897, 7613, 1, -1 },   // 碗
+    { 0x9505, 7614, 1, -1 },   // 锅
+    { 0x4e01, 7615, 1, -1 },   // 丁
+    { 0x4e2a, 0, 0, 35 },   // 个
+    { 0x4f59, 0, 0, 36 },   // 余
+    { 0x53ea, 0, 0, 37 },   // 只
+    { 0x5468, 7616, 1, -1 },   // 周
+    { 0x5929, 7617, 1, -1 },   // 天
+    { 0x60c5, 7618, 1, -1 },   // 情
+    { 0x624e, 0, 0, 41 },   // 扎
+    { 0x4e00, 7619, 1, -1 },   // 一
+    { 0x4e2a, 0, 0, 44 },   // 个
+    { 0x4f59, 0, 0, 45 },   // 余
+    { 0x5386, 7620, 1, 46 },   // 历
+    { 0x53ea, 0, 0, 48 },   // 只
+    { 0x5468, 7621, 1, -1 },   // 周
+    { 0x5929, 7622, 1, -1 },   // 天
+    { 0x5e74, 7623, 1, -1 },   // 年
+    { 0x624e, 0, 0, 52 },   // 扎
+    { 0x7b7e, 7624, 1, -1 },   // 签
+    { 0x8c61, 0, 0, 54 },   // 象
+    { 0x4e2a, 0, 0, 55 },   // 个
+    { 0x4f59, 0, 0, 56 },   // 余
+    { 0x51c6, 0, 0, 57 },   // 准
+    { 0x51fa, 7625, 1, -1 },   // 出
+    { 0x53ea, 0, 0, 59 },   // 只
+    { 0x5468, 7626, 1, -1 },   // 周
+    { 0x5929, 7627, 1, -1 },   // 天
+    { 0x5f81, 7628, 1, -1 },   // 征
+    { 0x624e, 0, 0, 63 },   // 扎
+    { 0x7edf, 7629, 1, -1 },   // 统
+    { 0x53f0, 7630, 1, -1 },   // 台
+    { 0x6881, 0, 0, 67 },   // 梁
+    { 0x7b7e, 7631, 11, 68 },   // 签
+    { 0x7cfb, 7642, 1, -1 },   // 系
+    { 0x8bfe, 7643, 1, -1 },   // 课
+    { 0x6587, 7644, 1, -1 },   // 文
+    { 0x6881, 0, 0, 83 },   // 梁
+    { 0x7b7e, 7645, 11, 84 },   // 签
+    { 0x8bfe, 7656, 1, -1 },   // 课
+    { 0x4e11, 0, 0, 97 },   // 丑
+    { 0x5377, 0, 0, 98 },   // 卷
+    { 0x592a, 7657, 1, -1 },   // 太
+    { 0x597d, 7658, 1, -1 },   // 好
+    { 0x5acc, 7659, 1, -1 },   // 嫌
+    { 0x5bd2, 7660, 1, -1 },   // 寒
+    { 0x5e72, 7661, 2, -1 },   // 干
+    { 0x6258, 0, 0, 105 },   // 托
+    { 0x6597, 7663, 1, 106 },   // 斗
+    { 0x65ad, 7664, 1, -1 },   // 断
+    { 0x8c37, 0, 0, 109 },   // 谷
+    { 0x8d1f, 7665, 1, -1 },   // 负
+    { 0x901a, 7666, 1, -1 },   // 通
+    { 0x91c7, 7667, 1, 112 },   // 采
+    { 0x9508, 7668, 1, -1 },   // 锈
+    { 0x98df, 7669, 1, -1 },   // 食
+    { 0x4e11, 0, 0, 117 },   // 丑
+    { 0x4e2b, 7670, 1, -1 },   // 丫
+    { 0x4e8b, 0, 0, 119 },   // 事
+    { 0x4eba, 0, 0, 120 },   // 人
+    { 0x4faa, 0, 0, 121 },   // 侪
+    { 0x516b, 7671, 1, -1 },   // 八
+    { 0x524c, 7672, 1, -1 },   // 剌
+    { 0x5267, 0, 0, 124 },   // 剧
+    { 0x5316, 0, 0, 125 },   // 化
+    { 0x53f2, 0, 0, 126 },   // 史
+    { 0x540d, 0, 0, 127 },   // 名
+    { 0x5412, 0, 0, 128 },   // 吒
+    { 0x5730, 0, 0, 129 },   // 地
+    { 0x58f0, 7673, 1, 130 },   // 声
+    { 0x5934, 7674, 1, -1 },   // 头
+    { 0x5937, 0, 0, 133 },   // 夷
+    { 0x5973, 7675, 1, 134 },   // 女
+    { 0x5974, 7676, 1, -1 },   // 奴
+    { 0x5987, 0, 0, 137 },   // 妇
+    { 0x5ab3, 7677, 1, 138 },   // 媳
+    { 0x5c0f, 7678, 1, -1 },   // 小
+    { 0x5df4, 7679, 1, -1 },   // 巴
+    { 0x5f92, 0, 0, 142 },   // 徒
+    { 0x6001, 0, 0, 143 },   // 态
+    { 0x6076, 0, 0, 144 },   // 恶
+    { 0x65f6, 0, 0, 145 },   // 时
+    { 0x672b, 0, 0, 146 },   // 末
+    { 0x6742, 0, 0, 147 },   // 杂
+    { 0x6837, 0, 0, 148 },   // 样
+    { 0x6b7b, 0, 0, 149 },   // 死
+    { 0x6bd4, 0, 0, 150 },   // 比
+    { 0x6bd9, 7680, 1, -1 },   // 毙
+    { 0x6cae, 0, 0, 152 },   // 沮
+    { 0x7537, 0, 0, 153 },   // 男
+    { 0x7c7b, 0, 0, 154 },   // 类
+    { 0x8138, 0, 0, 155 },   // 脸
+    { 0x864f, 0, 0, 156 },   // 虏
+    { 0x884c, 0, 0, 157 },   // 行
+    { 0x8a00, 0, 0, 158 },   // 言
+    { 0x8bcb, 0, 0, 159 },   // 诋
+    { 0x8bdd, 0, 0, 160 },   // 话
+    { 0x8bed, 0, 0, 161 },   // 语
+    { 0x8d3c, 7681, 1, -1 },   // 贼
+    { 0x8f9e, 0, 0, 163 },   // 辞
+    { 0x8fb1, 0, 0, 164 },   // 辱
+    { 0x9006, 0, 0, 165 },   // 逆
+    { 0x95fb, 0, 0, 166 },   // 闻
+    { 0x964b, 0, 0, 167 },   // 陋
+    { 0x8f91, 7682, 1, -1 },   // 辑
+    { 0x754c, 7683, 1, -1 },   // 界
+    { 0x7eaa, 7684, 2, -1 },   // 纪
+    { 0x4f59, 0, 0, 175 },   // 余
+    { 0x6797, 7686, 1, -1 },   // 林
+    { 0x51b2, 7687, 1, -1 },   // 冲
+    { 0x5468, 7688, 1, -1 },   // 周
+    { 0x5cb3, 0, 0, 181 },   // 岳
+    { 0x6e38, 0, 0, 182 },   // 游
+    { 0x5236, 0, 0, 184 },   // 制
+    { 0x53d1, 0, 0, 185 },   // 发
+    { 0x6069, 7689, 1, -1 },   // 恩
+    { 0x4e11, 0, 0, 188 },   // 丑
+    { 0x4e2a, 0, 0, 190 },   // 个
+    { 0x4f59, 0, 0, 191 },   // 余
+    { 0x51fa, 0, 0, 192 },   // 出
+    { 0x53ea, 0, 0, 193 },   // 只
+    { 0x5468, 7690, 1, -1 },   // 周
+    { 0x5929, 7691, 1, -1 },   // 天
+    { 0x624e, 0, 0, 196 },   // 扎
+    { 0x6746, 0, 0, 197 },   // 杆
+    { 0x864e, 7692, 1, -1 },   // 虎
+    { 0x9f20, 7693, 1, -1 },   // 鼠
+    { 0x4e91, 7694, 1, -1 },   // 云
+    { 0x949f, 0, 0, 203 },   // 钟
+    { 0x4e2d, 7695, 10, -1 },   // 中
+    { 0x65e7, 7705, 1, -1 },   // 旧
+    { 0x6708, 7706, 1, -1 },   // 月
+    { 0x91cc, 0, 0, 217 },   // 里
+    { 0x949f, 7707, 1, 218 },   // 钟
+    { 0x578b, 7708, 1, -1 },   // 型
+    { 0x5cb3, 0, 0, 224 },   // 岳
+    { 0x6587, 7709, 1, -1 },   // 文
+    { 0x65ad, 7710, 1, -1 },   // 断
+    { 0x7b7e, 7711, 11, 227 },   // 签
+    { 0x98ce, 7722, 1, -1 },   // 风
+    { 0x4eea, 0, 0, 241 },   // 仪
+    { 0x53f0, 0, 0, 242 },   // 台
+    { 0x5ea6, 0, 0, 243 },   // 度
+    { 0x6807, 7723, 1, 244 },   // 标
+    { 0x6ee8, 7724, 1, 246 },   // 滨
+    { 0x97f5, 0, 0, 248 },   // 韵
+    { 0x6f7c, 7725, 1, -1 },   // 潼
+    { 0x68f1, 0, 0, 251 },   // 棱
+    { 0x51c6, 0, 0, 253 },   // 准
+    { 0x9274, 0, 0, 254 },   // 鉴
+    { 0x4ec6, 0, 0, 255 },   // 仆
+    { 0x5e72, 0, 0, 256 },   // 干
+    { 0x949f, 7726, 2, -1 },   // 钟
+    { 0x624b, 7728, 1, -1 },   // 手
+    { 0x7cfb, 0, 0, 262 },   // 系
+    { 0x4ec6, 0, 0, 265 },   // 仆
+    { 0x4f59, 0, 0, 266 },   // 余
+    { 0x5f81, 0, 0, 267 },   // 征
+    { 0x6258, 0, 0, 268 },   // 托
+    { 0x9274, 0, 0, 269 },   // 鉴
+    { 0x949f, 0, 0, 270 },   // 钟
+    { 0x5179, 7729, 1, -1 },   // 兹
+    { 0x53d1, 0, 0, 273 },   // 发
+    { 0x82cf, 7730, 1, -1 },   // 苏
+    { 0x9f99, 7731, 1, -1 },   // 龙
+    { 0x5668, 7732, 1, -1 },   // 器
+    { 0x6e38, 7733, 1, -1 },   // 游
+    { 0x5cb3, 0, 0, 280 },   // 岳
+    { 0x4e16, 7734, 1, -1 },   // 世
+    { 0x4e2a, 0, 0, 282 },   // 个
+    { 0x4f59, 0, 0, 283 },   // 余
+    { 0x53ea, 0, 0, 284 },   // 只
+    { 0x5468, 7735, 1, -1 },   // 周
+    { 0x5929, 7736, 1, -1 },   // 天
+    { 0x624e, 0, 0, 287 },   // 扎
+    { 0x8c37, 0, 0, 288 },   // 谷
+    { 0x613f, 0, 0, 291 },   // 愿
+    { 0x7b7e, 0, 0, 293 },   // 签
+    { 0x9762, 0, 0, 294 },   // 面
+    { 0x51f6, 0, 0, 296 },   // 凶
+    { 0x65ad, 7737, 1, -1 },   // 断
+    { 0x53d1, 7738, 2, 299 },   // 发
+    { 0x54c4, 7740, 1, -1 },   // 哄
+    { 0x6597, 0, 0, 303 },   // 斗
+    { 0x8c61, 7741, 1, -1 },   // 象
+    { 0x671b, 0, 0, 305 },   // 望
+    { 0x7136, 7742, 1, 306 },   // 然
+    { 0x82e5, 7743, 1, -1 },   // 若
+    { 0x5947, 7744, 1, -1 },   // 奇
+    { 0x598d, 7745, 1, -1 },   // 妍
+    { 0x6597, 0, 0, 315 },   // 斗
+    { 0x7ea2, 7746, 1, -1 },   // 红
+    { 0x6709, 7747, 1, -1 },   // 有
+    { 0x91cc, 0, 0, 318 },   // 里
+    { 0x4e0d, 7748, 1, -1 },   // 不
+    { 0x4e2a, 0, 0, 320 },   // 个
+    { 0x4f59, 0, 0, 321 },   // 余
+    { 0x53ea, 0, 0, 322 },   // 只
+    { 0x5468, 7749, 1, -1 },   // 周
+    { 0x5929, 7750, 1, -1 },   // 天
+    { 0x7f36, 7751, 1, -1 },   // 缶
+    { 0x864e, 7752, 1, -1 },   // 虎
+    { 0x91cc, 7753, 1, -1 },   // 里
+    { 0x4e91, 7754, 1, -1 },   // 云
+    { 0x4ece, 7755, 1, -1 },   // 从
+    { 0x4f1a, 7756, 1, -1 },   // 会
+    { 0x4f1f, 7757, 1, -1 },   // 伟
+    { 0x4f59, 7758, 1, -1 },   // 余
+    { 0x5149, 7759, 1, -1 },   // 光
+    { 0x51a0, 7760, 1, -1 },   // 冠
+    { 0x51e4, 7761, 2, -1 },   // 凤
+    { 0x53cb, 7763, 1, -1 },   // 友
+    { 0x53cc, 7764, 1, -1 },   // 双
+    { 0x53f0, 7765, 1, -1 },   // 台
+    { 0x548c, 7766, 1, -1 },   // 和
+    { 0x56fd, 7767, 2, -1 },   // 国
+    { 0x575a, 0, 0, 344 },   // 坚
+    { 0x5927, 7769, 1, -1 },   // 大
+    { 0x5929, 7770, 1, -1 },   // 天
+    { 0x5947, 7771, 1, -1 },   // 奇
+    { 0x5b66, 7772, 1, -1 },   // 学
+    { 0x5b9d, 7773, 1, -1 },   // 宝
+    { 0x5c0f, 7774, 1, -1 },   // 小
+    { 0x5c14, 7775, 3, -1 },   // 尔
+    { 0x5c71, 7778, 3, -1 },   // 山
+    { 0x5e05, 0, 0, 357 },   // 帅
+    { 0x5e7c, 7781, 1, -1 },   // 幼
+    { 0x5e7f, 7782, 1, -1 },   // 广
+    { 0x5efa, 7783, 1, -1 },   // 建
+    { 0x5f52, 0, 0, 361 },   // 归
+    { 0x5fd7, 7784, 1, -1 },   // 志
+    { 0x5fe0, 7785, 1, -1 },   // 忠
+    { 0x6210, 7786, 1, -1 },   // 成
+    { 0x65af, 7787, 1, -1 },   // 斯
+    { 0x660e, 7788, 1, -1 },   // 明
+    { 0x6765, 7789, 1, -1 },   // 来
+    { 0x67ab, 0, 0, 368 },   // 枫
+    { 0x6811, 7790, 1, -1 },   // 树
+    { 0x6839, 7791, 1, -1 },   // 根
+    { 0x6c49, 7792, 1, -1 },   // 汉
+    { 0x6cfd, 7793, 1, -1 },   // 泽
+    { 0x6d2a, 7794, 1, -1 },   // 洪
+    { 0x6d77, 7795, 3, -1 },   // 海
+    { 0x6d9b, 0, 0, 377 },   // 涛
+    { 0x6e58, 7798, 1, -1 },   // 湘
+    { 0x8363, 7799, 1, -1 },   // 荣
+    { 0x836b, 7800, 1, -1 },   // 荫
+    { 0x8c26, 0, 0, 381 },   // 谦
+    { 0x8c28, 0, 0, 382 },   // 谨
+    { 0x8d1d, 7801, 1, -1 },   // 贝
+    { 0x8d60, 0, 0, 384 },   // 赠
+    { 0x8fdc, 7802, 1, -1 },   // 远
+    { 0x90fd, 7803, 1, -1 },   // 都
+    { 0x9617, 0, 0, 387 },   // 阗
+    { 0x9707, 7804, 4, -1 },   // 震
+    { 0x975e, 7808, 1, -1 },   // 非
+    { 0x97e6, 7809, 1, -1 },   // 韦
+    { 0x98ce, 7810, 1, -1 },   // 风
+    { 0x98de, 0, 0, 395 },   // 飞
+    { 0x9ed8, 7811, 1, -1 },   // 默
+    { 0x4e3a, 0, 0, 399 },   // 为
+    { 0x5357, 7812, 1, -1 },   // 南
+    { 0x541e, 7813, 1, 401 },   // 吞
+    { 0x5c14, 0, 0, 403 },   // 尔
+    { 0x6e38, 0, 0, 404 },   // 游
+    { 0x7b08, 7814, 1, -1 },   // 笈
+    { 0x91cc, 7815, 1, -1 },   // 里
+    { 0x987b, 0, 0, 407 },   // 须
+    { 0x4e2a, 0, 0, 408 },   // 个
+    { 0x4f59, 0, 0, 409 },   // 余
+    { 0x53ea, 0, 0, 410 },   // 只
+    { 0x5468, 7816, 1, -1 },   // 周
+    { 0x5929, 7817, 1, -1 },   // 天
+    { 0x5cb3, 0, 0, 413 },   // 岳
+    { 0x5cf0, 7818, 1, -1 },   // 峰
+    { 0x624e, 0, 0, 415 },   // 扎
+    { 0x810f, 0, 0, 416 },   // 脏
+    { 0x884c, 7819, 1, -1 },   // 行
+    { 0x8c37, 0, 0, 418 },   // 谷
+    { 0x5e72, 0, 0, 419 },   // 干
+    { 0x91cc, 0, 0, 420 },   // 里
+    { 0x54c4, 0, 0, 422 },   // 哄
+    { 0x6258, 0, 0, 423 },   // 托
+    { 0x6e38, 0, 0, 424 },   // 游
+    { 0x6c88, 0, 0, 427 },   // 沈
+    { 0x4e11, 0, 0, 428 },   // 丑
+    { 0x949f, 0, 0, 429 },   // 钟
+    { 0x53d1, 7820, 1, -1 },   // 发
+    { 0x5e72, 7821, 1, -1 },   // 干
+    { 0x6570, 7822, 2, -1 },   // 数
+    { 0x6b32, 0, 0, 436 },   // 欲
+    { 0x7269, 7824, 1, -1 },   // 物
+    { 0x4e2a, 0, 0, 439 },   // 个
+    { 0x4f59, 0, 0, 440 },   // 余
+    { 0x53ea, 0, 0, 441 },   // 只
+    { 0x5468, 7825, 1, -1 },   // 周
+    { 0x5929, 7826, 1, -1 },   // 天
+    { 0x9526, 7827, 1, -1 },   // 锦
+    { 0x8d35, 0, 0, 445 },   // 贵
+    { 0x4f59, 0, 0, 447 },   // 余
+    { 0x4eba, 0, 0, 448 },   // 人
+    { 0x4ec6, 0, 0, 449 },   // 仆
+    { 0x4ece, 0, 0, 450 },   // 从
+    { 0x4f7f, 0, 0, 451 },   // 使
+    { 0x50ee, 0, 0, 452 },   // 僮
+    { 0x540f, 0, 0, 453 },   // 吏
+    { 0x56fa, 7828, 1, -1 },   // 固
+    { 0x592b, 0, 0, 455 },   // 夫
+    { 0x5987, 0, 0, 456 },   // 妇
+    { 0x59d1, 0, 0, 457 },   // 姑
+    { 0x5a62, 0, 0, 458 },   // 婢
+    { 0x5c04, 0, 0, 459 },   // 射
+    { 0x5c11, 0, 0, 460 },   // 少
+    { 0x5f79, 0, 0, 461 },   // 役
+    { 0x618e, 0, 0, 462 },   // 憎
+    { 0x6b27, 0, 0, 463 },   // 欧
+    { 0x7a0b, 0, 0, 464 },   // 程
+    { 0x867d, 7829, 1, -1 },   // 虽
+    { 0x9699, 0, 0, 466 },   // 隙
+    { 0x80c4, 0, 0, 467 },   // 胄
+    { 0x4ec6, 0, 0, 469 },   // 仆
+    { 0x56fe, 7830, 1, -1 },   // 图
+    { 0x5c71, 7831, 1, -1 },   // 山
+    { 0x91cc, 7832, 2, -1 },   // 里
+    { 0x5e72, 7834, 1, -1 },   // 干
+    { 0x6258, 0, 0, 477 },   // 托
+    { 0x6e38, 0, 0, 478 },   // 游
+    { 0x6570, 7835, 1, -1 },   // 数
+    { 0x7406, 7836, 1, -1 },   // 理
+    { 0x7801, 7837, 1, -1 },   // 码
+    { 0x8303, 0, 0, 483 },   // 范
+    { 0x5e72, 7838, 1, -1 },   // 干
+    { 0x949f, 0, 0, 486 },   // 钟
+    { 0x4f55, 7839, 1, -1 },   // 何
+    { 0x5236, 0, 0, 490 },   // 制
+    { 0x4e1c, 7840, 1, -1 },   // 东
+    { 0x5c14, 7841, 1, -1 },   // 尔
+    { 0x5e9c, 7842, 1, -1 },   // 府
+    { 0x65af, 7843, 1, -1 },   // 斯
+    { 0x8fbe, 7844, 1, -1 },   // 达
+    { 0x9002, 7845, 1, -1 },   // 适
+    { 0x90c1, 0, 0, 500 },   // 郁
+    { 0x7f6a, 7846, 1, -1 },   // 罪
+    { 0x5f81, 0, 0, 502 },   // 征
+    { 0x6e38, 0, 0, 505 },   // 游
+    { 0x4f17, 0, 0, 506 },   // 众
+    { 0x4f34, 0, 0, 507 },   // 伴
+    { 0x53cb, 0, 0, 508 },   // 友
+    { 0x540c, 0, 0, 509 },   // 同
+    { 0x5934, 0, 0, 510 },   // 头
+    { 0x8ba1, 0, 0, 511 },   // 计
+    { 0x540a, 0, 0, 513 },   // 吊
+    { 0x5e72, 7847, 1, 514 },   // 干
+    { 0x91cc, 0, 0, 516 },   // 里
+    { 0x4f4d, 7848, 1, -1 },   // 位
+    { 0x6e38, 0, 0, 528 },   // 游
+    { 0x51c6, 0, 0, 529 },   // 准
+    { 0x624e, 0, 0, 530 },   // 扎
+    { 0x5f81, 0, 0, 532 },   // 征
+    { 0x7cfb, 0, 0, 533 },   // 系
+    { 0x8303, 0, 0, 534 },   // 范
+    { 0x91cc, 0, 0, 535 },   // 里
+    { 0x3007, 0, 0, 536 },   // 〇
+    { 0x4e00, 0, 0, 537 },   // 一
+    { 0x4e03, 0, 0, 538 },   // 七
+    { 0x4e09, 7849, 1, 539 },   // 三
+    { 0x4e0b, 0, 0, 541 },   // 下
+    { 0x4e1a, 0, 0, 542 },   // 业
+    { 0x4e5d, 0, 0, 543 },   // 九
+    { 0x4e8b, 0, 0, 544 },   // 事
+    { 0x4e8c, 0, 0, 545 },   // 二
+    { 0x4e94, 0, 0, 546 },   // 五
+    { 0x4eba, 0, 0, 547 },   // 人
+    { 0x4f17, 0, 0, 548 },   // 众
+    { 0x4fd7, 0, 0, 549 },   // 俗
+    { 0x500d, 0, 0, 550 },   // 倍
+    { 0x50c7, 0, 0, 551 },   // 僇
+    { 0x5149, 0, 0, 552 },   // 光
+    { 0x515a, 0, 0, 553 },   // 党
+    { 0x516b, 0, 0, 554 },   // 八
+    { 0x516d, 0, 0, 555 },   // 六
+    { 0x5174, 0, 0, 556 },   // 兴
+    { 0x5203, 0, 0, 557 },   // 刃
+    { 0x5207, 0, 0, 558 },   // 切
+    { 0x5229, 0, 0, 559 },   // 利
+    { 0x5272, 0, 0, 560 },   // 割
+    { 0x529b, 7850, 1, 561 },   // 力
+    { 0x52c7, 0, 0, 563 },   // 勇
+    { 0x5341, 0, 0, 564 },   // 十
+    { 0x5473, 0, 0, 565 },   // 味
+    { 0x54cd, 0, 0, 566 },   // 响
+    { 0x5598, 0, 0, 567 },   // 喘
+    { 0x56db, 0, 0, 568 },   // 四
+    { 0x5730, 0, 0, 569 },   // 地
+    { 0x58a8, 0, 0, 570 },   // 墨
+    { 0x58f0, 0, 0, 571 },   // 声
+    { 0x5916, 0, 0, 572 },   // 外
+    { 0x5999, 0, 0, 573 },   // 妙
+    { 0x59da, 0, 0, 574 },   // 姚
+    { 0x5a01, 0, 0, 575 },   // 威
+    { 0x5b50, 0, 0, 576 },   // 子
+    { 0x5b58, 0, 0, 577 },   // 存
+    { 0x5b7d, 0, 0, 578 },   // 孽
+    { 0x5e72, 0, 0, 579 },   // 干
+    { 0x5e74, 0, 0, 580 },   // 年
+    { 0x5e86, 0, 0, 581 },   // 庆
+    { 0x5f0f, 0, 0, 582 },   // 式
+    { 0x5f26, 0, 0, 583 },   // 弦
+    { 0x601d, 0, 0, 584 },   // 思
+    { 0x60b8, 0, 0, 585 },   // 悸
+    { 0x6570, 0, 0, 586 },   // 数
+    { 0x660e, 0, 0, 587 },   // 明
+    { 0x6620, 0, 0, 588 },   // 映
+    { 0x6656, 0, 0, 589 },   // 晖
+    { 0x6687, 0, 0, 590 },   // 暇
+    { 0x676d, 0, 0, 591 },   // 杭
+    { 0x676f, 0, 0, 592 },   // 杯
+    { 0x6843, 0, 0, 593 },   // 桃
+    { 0x6876, 0, 0, 594 },   // 桶
+    { 0x6b22, 0, 0, 595 },   // 欢
+    { 0x6b3e, 0, 0, 596 },   // 款
+    { 0x6b65, 0, 0, 597 },   // 步
+    { 0x6b83, 0, 0, 598 },   // 殃
+    { 0x6bd2, 0, 0, 599 },   // 毒
+    { 0x6c14, 0, 0, 600 },   // 气
+    { 0x6c5f, 0, 0, 601 },   // 江
+    { 0x6ca5, 0, 0, 602 },   // 沥
+    { 0x6ce2, 0, 0, 603 },   // 波
+    { 0x6cfd, 0, 0, 604 },   // 泽
+    { 0x6e29, 0, 0, 605 },   // 温
+    { 0x70c8, 0, 0, 606 },   // 烈
+    { 0x70ec, 0, 0, 607 },   // 烬
+    { 0x70ed, 0, 0, 608 },   // 热
+    { 0x73cd, 0, 0, 609 },   // 珍
+    { 0x751f, 0, 0, 610 },   // 生
+    { 0x7559, 0, 0, 611 },   // 留
+    { 0x7a8d, 0, 0, 612 },   // 窍
+    { 0x7cae, 0, 0, 613 },   // 粮
+    { 0x7eea, 0, 0, 614 },   // 绪
+    { 0x7f3a, 0, 0, 615 },   // 缺
+    { 0x7f6a, 0, 0, 616 },   // 罪
+    { 0x7fa1, 0, 0, 617 },   // 羡
+    { 0x818f, 0, 0, 618 },   // 膏
+    { 0x836b, 0, 0, 619 },   // 荫
+    { 0x84c4, 0, 0, 620 },   // 蓄
+    { 0x88d5, 0, 0, 621 },   // 裕
+    { 0x89d2, 0, 0, 622 },   // 角
+    { 0x8bba, 0, 0, 623 },   // 论
+    { 0x8cbe, 0, 0, 624 },   // 貾
+    { 0x8d23, 0, 0, 625 },   // 责
+    { 0x8f89, 0, 0, 626 },   // 辉
+    { 0x8f9c, 0, 0, 627 },   // 辜
+    { 0x90e8, 0, 0, 628 },   // 部
+    { 0x9172, 0, 0, 629 },   // 酲
+    { 0x91cf, 0, 0, 630 },   // 量
+    { 0x95f0, 0, 0, 631 },   // 闰
+    { 0x95f2, 0, 0, 632 },   // 闲
+    { 0x96f6, 0, 0, 633 },   // 零
+    { 0x9707, 0, 0, 634 },   // 震
+    { 0x971e, 0, 0, 635 },   // 霞
+    { 0x97f3, 0, 0, 636 },   // 音
+    { 0x97f5, 0, 0, 637 },   // 韵
+    { 0x9879, 0, 0, 638 },   // 项
+    { 0x989d, 0, 0, 639 },   // 额
+    { 0x98ce, 0, 0, 640 },   // 风
+    { 0x98df, 0, 0, 641 },   // 食
+    { 0x7f57, 7851, 1, -1 },   // 罗
+    { 0x949f, 0, 0, 643 },   // 钟
+    { 0x51c6, 0, 0, 644 },   // 准
+    { 0x54c1, 7852, 1, -1 },   // 品
+    { 0x5938, 0, 0, 646 },   // 夸
+    { 0x4ec6, 0, 0, 648 },   // 仆
+    { 0x94b1, 0, 0, 649 },   // 钱
+    { 0x94bf, 0, 0, 650 },   // 钿
+    { 0x5176, 7853, 1, -1 },   // 其
+    { 0x4ec6, 0, 0, 653 },   // 仆
+    { 0x4f9d, 7854, 1, -1 },   // 依
+    { 0x6258, 0, 0, 655 },   // 托
+    { 0x5e78, 0, 0, 659 },   // 幸
+    { 0x5e76, 0, 0, 666 },   // 并
+    { 0x9669, 7855, 1, -1 },   // 险
+    { 0x6258, 7856, 1, 668 },   // 托
+    { 0x4ec6, 0, 0, 676 },   // 仆
+    { 0x6734, 0, 0, 677 },   // 朴
+    { 0x786e, 7857, 1, -1 },   // 确
+    { 0x7b51, 7858, 2, -1 },   // 筑
+    { 0x80e1, 7860, 1, -1 },   // 胡
+    { 0x51b2, 0, 0, 682 },   // 冲
+    { 0x590d, 0, 0, 683 },   // 复
+    { 0x95f2, 0, 0, 684 },   // 闲
+    { 0x4e11, 0, 0, 685 },   // 丑
+    { 0x4ee5, 0, 0, 686 },   // 以
+    { 0x52a9, 0, 0, 687 },   // 助
+    { 0x53e3, 0, 0, 688 },   // 口
+    { 0x5bc7, 7861, 1, -1 },   // 寇
+    { 0x624b, 0, 0, 690 },   // 手
+    { 0x6545, 0, 0, 691 },   // 故
+    { 0x673a, 0, 0, 692 },   // 机
+    { 0x6b64, 0, 0, 693 },   // 此
+    { 0x7531, 0, 0, 694 },   // 由
+    { 0x7bb8, 7862, 1, -1 },   // 箸
+    { 0x8d44, 0, 0, 696 },   // 资
+    { 0x9274, 0, 0, 697 },   // 鉴
+    { 0x6e38, 0, 0, 698 },   // 游
+    { 0x7d2f, 7863, 1, -1 },   // 累
+    { 0x53d1, 7864, 1, 702 },   // 发
+    { 0x6258, 0, 0, 704 },   // 托
+    { 0x91cc, 0, 0, 705 },   // 里
+    { 0x5e72, 0, 0, 706 },   // 干
+    { 0x505c, 7865, 1, -1 },   // 停
+    { 0x5236, 0, 0, 708 },   // 制
+    { 0x5f81, 0, 0, 709 },   // 征
+    { 0x5e76, 0, 0, 718 },   // 并
+    { 0x6e38, 0, 0, 719 },   // 游
+    { 0x971c, 7866, 1, -1 },   // 霜
+    { 0x91cc, 7867, 1, -1 },   // 里
+    { 0x8d5e, 0, 0, 722 },   // 赞
+    { 0x4ec6, 0, 0, 723 },   // 仆
+    { 0x5c38, 0, 0, 724 },   // 尸
+    { 0x7565, 7868, 2, -1 },   // 略
+    { 0x672f, 0, 0, 730 },   // 术
+    { 0x51f6, 0, 0, 731 },   // 凶
+    { 0x4e2a, 0, 0, 732 },   // 个
+    { 0x4f59, 0, 0, 733 },   // 余
+    { 0x91c7, 0, 0, 734 },   // 采
+    { 0x81f4, 7870, 1, -1 },   // 致
+    { 0x5265, 0, 0, 736 },   // 剥
+    { 0x6263, 0, 0, 737 },   // 扣
+    { 0x671f, 7871, 1, 738 },   // 期
+    { 0x6b7b, 0, 0, 740 },   // 死
+    { 0x8584, 0, 0, 741 },   // 薄
+    { 0x5f81, 0, 0, 742 },   // 征
+    { 0x6000, 7872, 1, -1 },   // 怀
+    { 0x8fdb, 0, 0, 747 },   // 进
+    { 0x9879, 0, 0, 748 },   // 项
+    { 0x5e72, 0, 0, 749 },   // 干
+    { 0x4e2a, 0, 0, 750 },   // 个
+    { 0x4f59, 0, 0, 751 },   // 余
+    { 0x53ea, 0, 0, 752 },   // 只
+    { 0x5468, 7873, 1, -1 },   // 周
+    { 0x5929, 7874, 1, -1 },   // 天
+    { 0x5b57, 7875, 1, -1 },   // 字
+    { 0x624e, 0, 0, 756 },   // 扎
+    { 0x4ec6, 0, 0, 757 },   // 仆
+    { 0x4ed4, 7876, 1, -1 },   // 仔
+    { 0x4f59, 0, 0, 759 },   // 余
+    { 0x5386, 7877, 1, 760 },   // 历
+    { 0x5b59, 7878, 1, -1 },   // 孙
+    { 0x5bd3, 7879, 1, -1 },   // 寓
+    { 0x5e72, 0, 0, 764 },   // 干
+    { 0x4e2a, 0, 0, 765 },   // 个
+    { 0x4f59, 0, 0, 766 },   // 余
+    { 0x51b2, 0, 0, 767 },   // 冲
+    { 0x53ea, 0, 0, 768 },   // 只
+    { 0x5468, 7880, 1, -1 },   // 周
+    { 0x5929, 7881, 1, -1 },   // 天
+    { 0x624e, 0, 0, 771 },   // 扎
+    { 0x697c, 7882, 1, -1 },   // 楼
+    { 0x8c37, 0, 0, 773 },   // 谷
+    { 0x6eaa, 7883, 1, -1 },   // 溪
+    { 0x548c, 7884, 1, -1 },   // 和
+    { 0x7cfb, 7885, 4, 779 },   // 系
+    { 0x4f59, 0, 0, 785 },   // 余
+    { 0x8303, 0, 0, 786 },   // 范
+    { 0x810f, 0, 0, 789 },   // 脏
+    { 0x5e76, 0, 0, 790 },   // 并
+    { 0x6b32, 0, 0, 792 },   // 欲
+    { 0x5236, 0, 0, 795 },   // 制
+    { 0x54c4, 0, 0, 796 },   // 哄
+    { 0x6597, 0, 0, 797 },   // 斗
+    { 0x810f, 0, 0, 798 },   // 脏
+    { 0x9762, 7889, 1, -1 },   // 面
+    { 0x6709, 7890, 1, -1 },   // 有
+    { 0x4f59, 0, 0, 804 },   // 余
+    { 0x5b57, 7891, 1, -1 },   // 字
+    { 0x5386, 7892, 1, 809 },   // 历
+    { 0x6c11, 7893, 1, -1 },   // 民
+    { 0x4ec7, 0, 0, 813 },   // 仇
+    { 0x8499, 0, 0, 814 },   // 蒙
+    { 0x51ac, 7894, 1, -1 },   // 冬
+    { 0x6e38, 0, 0, 816 },   // 游
+    { 0x5c71, 7895, 1, -1 },   // 山
+    { 0x4e0a, 0, 0, 820 },   // 上
+    { 0x4e0b, 0, 0, 821 },   // 下
+    { 0x5012, 0, 0, 822 },   // 倒
+    { 0x514b, 0, 0, 823 },   // 克
+    { 0x51a0, 7896, 1, 824 },   // 冠
+    { 0x51b3, 0, 0, 826 },   // 决
+    { 0x51fa, 0, 0, 827 },   // 出
+    { 0x51fb, 0, 0, 828 },   // 击
+    { 0x5230, 0, 0, 829 },   // 到
+    { 0x523a, 0, 0, 830 },   // 刺
+    { 0x529b, 0, 0, 831 },   // 力
+    { 0x52a8, 0, 0, 832 },   // 动
+    { 0x52b2, 0, 0, 833 },   // 劲
+    { 0x538b, 0, 0, 834 },   // 压
+    { 0x53bb, 0, 0, 835 },   // 去
+    { 0x53e3, 0, 0, 836 },   // 口
+    { 0x575a, 7897, 1, -1 },   // 坚
+    { 0x57ae, 0, 0, 838 },   // 垮
+    { 0x5802, 0, 0, 839 },   // 堂
+    { 0x5929, 7898, 1, 840 },   // 天
+    { 0x5934, 7899, 1, -1 },   // 头
+    { 0x5dde, 7900, 1, -1 },   // 州
+    { 0x5fc3, 0, 0, 844 },   // 心
+    { 0x6389, 0, 0, 845 },   // 掉
+    { 0x649e, 0, 0, 846 },   // 撞
+    { 0x6563, 0, 0, 847 },   // 散
+    { 0x6740, 0, 0, 848 },   // 杀
+    { 0x6765, 0, 0, 849 },   // 来
+    { 0x6ce2, 0, 0, 850 },   // 波
+    { 0x6d6a, 0, 0, 851 },   // 浪
+    { 0x6fc0, 0, 0, 852 },   // 激
+    { 0x7136, 0, 0, 853 },   // 然
+    { 0x76f9, 0, 0, 854 },   // 盹
+    { 0x7740, 0, 0, 855 },   // 着
+    { 0x7834, 0, 0, 856 },   // 破
+    { 0x7a0b, 0, 0, 857 },   // 程
+    { 0x7a81, 0, 0, 858 },   // 突
+    { 0x7ebf, 0, 0, 859 },   // 线
+    { 0x8981, 0, 0, 860 },   // 要
+    { 0x8d77, 0, 0, 861 },   // 起
+    { 0x8f66, 0, 0, 862 },   // 车
+    { 0x8fc7, 0, 0, 863 },   // 过
+    { 0x8fdb, 0, 0, 864 },   // 进
+    { 0x91cf, 0, 0, 865 },   // 量
+    { 0x950b, 7901, 1, 866 },   // 锋
+    { 0x9677, 0, 0, 868 },   // 陷
+    { 0x98ce, 0, 0, 869 },   // 风
+    { 0x6597, 0, 0, 871 },   // 斗
+    { 0x6e38, 0, 0, 873 },   // 游
+    { 0x9762, 0, 0, 874 },   // 面
+    { 0x4f59, 0, 0, 877 },   // 余
+    { 0x53d1, 0, 0, 878 },   // 发
+    { 0x5389, 0, 0, 880 },   // 厉
+    { 0x6006, 0, 0, 881 },   // 怆
+    { 0x6028, 0, 0, 882 },   // 怨
+    { 0x607b, 0, 0, 883 },   // 恻
+    { 0x60cb, 0, 0, 884 },   // 惋
+    { 0x60e8, 0, 0, 885 },   // 惨
+    { 0x60f6, 0, 0, 886 },   // 惶
+    { 0x623e, 0, 0, 887 },   // 戾
+    { 0x7136, 0, 0, 888 },   // 然
+    { 0x7f8e, 0, 0, 889 },   // 美
+    { 0x82e6, 0, 0, 890 },   // 苦
+    { 0x9178, 0, 0, 891 },   // 酸
+    { 0x4e0d, 7902, 1, -1 },   // 不
+    { 0x4f1a, 0, 0, 893 },   // 会
+    { 0x4f8b, 0, 0, 894 },   // 例
+    { 0x4fdd, 7903, 2, 895 },   // 保
+    { 0x513f, 0, 0, 898 },   // 儿
+    { 0x519b, 7905, 1, -1 },   // 军
+    { 0x51b3, 7906, 1, -1 },   // 决
+    { 0x5206, 7907, 1, -1 },   // 分
+    { 0x5219, 0, 0, 902 },   // 则
+    { 0x5676, 7908, 1, -1 },   // 噶
+    { 0x5907, 0, 0, 904 },   // 备
+    { 0x5934, 0, 0, 905 },   // 头
+    { 0x5b9a, 0, 0, 906 },   // 定
+    { 0x5e73, 7909, 1, -1 },   // 平
+    { 0x5ea6, 0, 0, 908 },   // 度
+    { 0x5f0f, 0, 0, 909 },   // 式
+    { 0x62df, 0, 0, 910 },   // 拟
+    { 0x62ff, 7910, 1, -1 },   // 拿
+    { 0x636e, 0, 0, 912 },   // 据
+    { 0x65b0, 7911, 2, -1 },   // 新
+    { 0x65f6, 0, 0, 915 },   // 时
+    { 0x661f, 0, 0, 916 },   // 星
+    { 0x662f, 0, 0, 917 },   // 是
+    { 0x70b9, 0, 0, 918 },   // 点
+    { 0x7684, 0, 0, 919 },   // 的
+    { 0x76f4, 0, 0, 920 },   // 直
+    { 0x786e, 0, 0, 921 },   // 确
+    { 0x7ebf, 0, 0, 922 },   // 线
+    { 0x7ef3, 0, 0, 923 },   // 绳
+    { 0x8bdd, 0, 0, 924 },   // 话
+    { 0x8c31, 0, 0, 925 },   // 谱
+    { 0x8d27, 7913, 1, -1 },   // 货
+    { 0x5e2d, 0, 0, 928 },   // 席
+    { 0x9762, 0, 0, 929 },   // 面
+    { 0x8499, 7914, 1, -1 },   // 蒙
+    { 0x70bc, 0, 0, 934 },   // 炼
+    { 0x4e2a, 0, 0, 936 },   // 个
+    { 0x51c0, 7915, 1, -1 },   // 净
+    { 0x51fa, 0, 0, 938 },   // 出
+    { 0x53ea, 0, 0, 939 },   // 只
+    { 0x5468, 7916, 1, -1 },   // 周
+    { 0x5929, 7917, 1, -1 },   // 天
+    { 0x8fdb, 7918, 1, -1 },   // 进
+    { 0x68a8, 7919, 1, -1 },   // 梨
+    { 0x501f, 0, 0, 947 },   // 借
+    { 0x51c6, 0, 0, 948 },   // 准
+    { 0x51e0, 0, 0, 949 },   // 几
+    { 0x540a, 0, 0, 950 },   // 吊
+    { 0x6298, 0, 0, 951 },   // 折
+    { 0x95f2, 0, 0, 952 },   // 闲
+    { 0x5200, 0, 0, 954 },   // 刀
+    { 0x5668, 0, 0, 955 },   // 器
+    { 0x5acc, 0, 0, 956 },   // 嫌
+    { 0x5df4, 7920, 1, -1 },   // 巴
+    { 0x5f81, 0, 0, 958 },   // 征
+    { 0x5f92, 0, 0, 959 },   // 徒
+    { 0x6076, 0, 0, 960 },   // 恶
+    { 0x608d, 0, 0, 961 },   // 悍
+    { 0x624b, 0, 0, 962 },   // 手
+    { 0x6740, 0, 0, 963 },   // 杀
+    { 0x67aa, 0, 0, 964 },   // 枪
+    { 0x6848, 0, 0, 965 },   // 案
+    { 0x6a2a, 0, 0, 966 },   // 横
+    { 0x6b8b, 0, 0, 967 },   // 残
+    { 0x72af, 0, 0, 968 },   // 犯
+    { 0x72e0, 0, 0, 969 },   // 狠
+    { 0x731b, 0, 0, 970 },   // 猛
+    { 0x7591, 0, 0, 971 },   // 疑
+    { 0x76f8, 7921, 1, 972 },   // 相
+    { 0x9669, 0, 0, 974 },   // 险
+    { 0x4e11, 0, 0, 975 },   // 丑
+    { 0x4e56, 7922, 2, -1 },   // 乖
+    { 0x6e38, 0, 0, 978 },   // 游
+    { 0x6251, 0, 0, 980 },   // 扑
+    { 0x949f, 0, 0, 981 },   // 钟
+    { 0x6570, 7924, 1, -1 },   // 数
+    { 0x534a, 7925, 1, -1 },   // 半
+    { 0x591a, 7926, 1, -1 },   // 多
+    { 0x5b50, 7927, 2, -1 },   // 子
+    { 0x949f, 7929, 1, 988 },   // 钟
+    { 0x4f59, 0, 0, 991 },   // 余
+    { 0x4e00, 7930, 1, -1 },   // 一
+    { 0x4e0d, 7931, 1, -1 },   // 不
+    { 0x4e3a, 0, 0, 995 },   // 为
+    { 0x4e86, 7932, 1, -1 },   // 了
+    { 0x5165, 0, 0, 997 },   // 入
+    { 0x52a8, 0, 0, 998 },   // 动
+    { 0x5f97, 7933, 1, -1 },   // 得
+    { 0x6765, 7934, 1, -1 },   // 来
+    { 0x6868, 0, 0, 1001 },   // 桨
+    { 0x7740, 7935, 1, -1 },   // 着
+    { 0x8fc7, 0, 0, 1003 },   // 过
+    { 0x8fdb, 0, 0, 1004 },   // 进
+    { 0x9f99, 7936, 2, -1 },   // 龙
+    { 0x4f73, 7938, 1, -1 },   // 佳
+    { 0x82b8, 7939, 1, -1 },   // 芸
+    { 0x5e72, 0, 0, 1012 },   // 干
+    { 0x96c7, 0, 0, 1013 },   // 雇
+    { 0x5236, 0, 0, 1015 },   // 制
+    { 0x83b7, 0, 0, 1016 },   // 获
+    { 0x65ad, 7940, 1, -1 },   // 断
+    { 0x6b32, 0, 0, 1019 },   // 欲
+    { 0x626d, 0, 0, 1021 },   // 扭
+    { 0x62d7, 0, 0, 1022 },   // 拗
+    { 0x6c14, 0, 0, 1023 },   // 气
+    { 0x8f9f, 0, 0, 1024 },   // 辟
+    { 0x4e86, 0, 0, 1026 },   // 了
+    { 0x5012, 0, 0, 1027 },   // 倒
+    { 0x5927, 7941, 1, -1 },   // 大
+    { 0x5f97, 0, 0, 1029 },   // 得
+    { 0x80e1, 0, 0, 1030 },   // 胡
+    { 0x8d70, 0, 0, 1031 },   // 走
+    { 0x8d77, 7942, 1, 1032 },   // 起
+    { 0x96ea, 0, 0, 1034 },   // 雪
+    { 0x98ce, 7943, 1, 1035 },   // 风
+    { 0x5c71, 7944, 1, -1 },   // 山
+    { 0x4ef6, 0, 0, 1038 },   // 件
+    { 0x4f5c, 0, 0, 1039 },   // 作
+    { 0x505a, 0, 0, 1040 },   // 做
+    { 0x51b0, 0, 0, 1041 },   // 冰
+    { 0x51b7, 7945, 1, 1042 },   // 冷
+    { 0x5242, 0, 0, 1044 },   // 剂
+    { 0x53d6, 0, 0, 1045 },   // 取
+    { 0x54c1, 0, 0, 1046 },   // 品
+    { 0x56fe, 0, 0, 1047 },   // 图
+    { 0x5907, 0, 0, 1048 },   // 备
+    { 0x5f97, 0, 0, 1049 },   // 得
+    { 0x6210, 0, 0, 1050 },   // 成
+    { 0x6bd2, 0, 0, 1051 },   // 毒
+    { 0x6cd5, 0, 0, 1052 },   // 法
+    { 0x6d46, 0, 0, 1053 },   // 浆
+    { 0x7247, 0, 0, 1054 },   // 片
+    { 0x7248, 0, 0, 1055 },   // 版
+    { 0x76d0, 0, 0, 1056 },   // 盐
+    { 0x7a0b, 0, 0, 1057 },   // 程
+    { 0x7b7e, 0, 0, 1058 },   // 签
+    { 0x7cd6, 0, 0, 1059 },   // 糖
+    { 0x7eb8, 0, 0, 1060 },   // 纸
+    { 0x836f, 0, 0, 1061 },   // 药
+    { 0x8863, 0, 0, 1062 },   // 衣
+    { 0x8868, 7946, 1, -1 },   // 表
+    { 0x8d29, 0, 0, 1064 },   // 贩
+    { 0x9020, 0, 0, 1065 },   // 造
+    { 0x949f, 0, 0, 1066 },   // 钟
+    { 0x9769, 0, 0, 1067 },   // 革
+    { 0x978b, 0, 0, 1068 },   // 鞋
+    { 0x534a, 7947, 1, -1 },   // 半
+    { 0x591a, 7948, 1, -1 },   // 多
+    { 0x949f, 0, 0, 1072 },   // 钟
+    { 0x53d1, 0, 0, 1077 },   // 发
+    { 0x80e1, 0, 0, 1078 },   // 胡
+    { 0x987b, 0, 0, 1079 },   // 须
+    { 0x53d1, 0, 0, 1080 },   // 发
+    { 0x9762, 0, 0, 1081 },   // 面
+    { 0x5398, 0, 0, 1084 },   // 厘
+    { 0x5236, 0, 0, 1086 },   // 制
+    { 0x4f59, 0, 0, 1088 },   // 余
+    { 0x5176, 7949, 1, -1 },   // 其
+    { 0x53d1, 0, 0, 1090 },   // 发
+    { 0x820d, 0, 0, 1091 },   // 舍
+    { 0x4e89, 7950, 1, -1 },   // 争
+    { 0x516c, 7951, 1, -1 },   // 公
+    { 0x52cb, 0, 0, 1096 },   // 勋
+    { 0x6c22, 7952, 1, -1 },   // 氢
+    { 0x4f59, 0, 0, 1101 },   // 余
+    { 0x90c1, 0, 0, 1106 },   // 郁
+    { 0x4e1a, 0, 0, 1108 },   // 业
+    { 0x52b3, 0, 0, 1109 },   // 劳
+    { 0x7235, 0, 0, 1110 },   // 爵
+    { 0x7ae0, 0, 0, 1111 },   // 章
+    { 0x7ee9, 0, 0, 1112 },   // 绩
+    { 0x4ec6, 0, 0, 1113 },   // 仆
+    { 0x6734, 0, 0, 1114 },   // 朴
+    { 0x5e72, 0, 0, 1115 },   // 干
+    { 0x5fc3, 7953, 1, -1 },   // 心
+    { 0x9b42, 7954, 1, -1 },   // 魂
+    { 0x51c6, 0, 0, 1119 },   // 准
+    { 0x5e72, 0, 0, 1120 },   // 干
+    { 0x624e, 0, 0, 1121 },   // 扎
+    { 0x8c37, 0, 0, 1122 },   // 谷
+    { 0x7cfb, 0, 0, 1123 },   // 系
+    { 0x4ed1, 7955, 1, -1 },   // 仑
+    { 0x56de, 7956, 2, -1 },   // 回
+    { 0x5c71, 7958, 1, -1 },   // 山
+    { 0x5cb3, 0, 0, 1128 },   // 岳
+    { 0x5e72, 0, 0, 1130 },   // 干
+    { 0x91cc, 7959, 2, -1 },   // 里
+    { 0x4e2a, 0, 0, 1136 },   // 个
+    { 0x4f59, 0, 0, 1137 },   // 余
+    { 0x51fa, 7961, 2, 1138 },   // 出
+    { 0x53ea, 0, 0, 1141 },   // 只
+    { 0x5468, 7963, 1, -1 },   // 周
+    { 0x5929, 7964, 1, -1 },   // 天
+    { 0x624e, 0, 0, 1144 },   // 扎
+    { 0x4e2a, 0, 0, 1145 },   // 个
+    { 0x4f59, 0, 0, 1146 },   // 余
+    { 0x53ea, 7965, 2, 1147 },   // 只
+    { 0x5468, 7967, 1, -1 },   // 周
+    { 0x56de, 7968, 1, -1 },   // 回
+    { 0x5929, 7969, 1, -1 },   // 天
+    { 0x624e, 0, 0, 1154 },   // 扎
+    { 0x94a7, 7970, 1, -1 },   // 钧
+    { 0x5dde, 0, 0, 1156 },   // 州
+    { 0x5e73, 0, 0, 1157 },   // 平
+    { 0x9633, 0, 0, 1158 },   // 阳
+    { 0x9ad8, 7971, 1, -1 },   // 高
+    { 0x53ea, 7972, 1, 1160 },   // 只
+    { 0x4e25, 7973, 1, -1 },   // 严
+    { 0x9632, 0, 0, 1165 },   // 防
+    { 0x4e8e, 0, 0, 1167 },   // 于
+    { 0x5355, 7974, 1, -1 },   // 单
+    { 0x5411, 0, 0, 1169 },   // 向
+    { 0x5e72, 0, 0, 1170 },   // 干
+    { 0x6253, 7975, 1, -1 },   // 打
+    { 0x65ad, 7976, 1, -1 },   // 断
+    { 0x4eac, 7977, 1, -1 },   // 京
+    { 0x56de, 7978, 2, -1 },   // 回
+    { 0x5bab, 7980, 1, -1 },   // 宫
+    { 0x5c4f, 7981, 1, -1 },   // 屏
+    { 0x5cb3, 0, 0, 1180 },   // 岳
+    { 0x6e38, 0, 0, 1181 },   // 游
+    { 0x5c14, 7982, 1, -1 },   // 尔
+    { 0x6770, 7983, 1, -1 },   // 杰
+    { 0x91c7, 0, 0, 1184 },   // 采
+    { 0x5934, 7984, 1, -1 },   // 头
+    { 0x6bd5, 0, 0, 1186 },   // 毕
+    { 0x9ad8, 7985, 1, -1 },   // 高
+    { 0x68f1, 7986, 1, -1 },   // 棱
+    { 0x4e86, 0, 0, 1191 },   // 了
+    { 0x4e94, 7987, 1, -1 },   // 五
+    { 0x5236, 0, 0, 1193 },   // 制
+    { 0x5473, 0, 0, 1194 },   // 味
+    { 0x597d, 0, 0, 1195 },   // 好
+    { 0x5b50, 0, 0, 1196 },   // 子
+    { 0x6599, 0, 0, 1197 },   // 料
+    { 0x6c34, 0, 0, 1198 },   // 水
+    { 0x6c41, 0, 0, 1199 },   // 汁
+    { 0x6e56, 0, 0, 1200 },   // 湖
+    { 0x716e, 0, 0, 1201 },   // 煮
+    { 0x725b, 0, 0, 1202 },   // 牛
+    { 0x7684, 0, 0, 1203 },   // 的
+    { 0x8089, 0, 0, 1204 },   // 肉
+    { 0x83dc, 0, 0, 1205 },   // 菜
+    { 0x867e, 0, 0, 1206 },   // 虾
+    { 0x86cb, 0, 0, 1207 },   // 蛋
+    { 0x8c46, 0, 0, 1208 },   // 豆
+    { 0x9762, 0, 0, 1209 },   // 面
+    { 0x9e21, 0, 0, 1210 },   // 鸡
+    { 0x9e2d, 0, 0, 1211 },   // 鸭
+    { 0x9e45, 0, 0, 1212 },   // 鹅
+    { 0x6e38, 0, 0, 1214 },   // 游
+    { 0x540e, 7988, 1, -1 },   // 后
+    { 0x661f, 7989, 1, -1 },   // 星
+    { 0x5236, 0, 0, 1218 },   // 制
+    { 0x7d2f, 7990, 1, -1 },   // 累
+    { 0x9274, 0, 0, 1220 },   // 鉴
+    { 0x4e0e, 7991, 1, -1 },   // 与
+    { 0x4e91, 0, 0, 1223 },   // 云
+    { 0x4f4f, 0, 0, 1224 },   // 住
+    { 0x513f, 0, 0, 1225 },   // 儿
+    { 0x5165, 0, 0, 1226 },   // 入
+    { 0x52a8, 0, 0, 1227 },   // 动
+    { 0x53bb, 0, 0, 1228 },   // 去
+    { 0x53d1, 0, 0, 1229 },   // 发
+    { 0x53f6, 7992, 1, -1 },   // 叶
+    { 0x56fe, 0, 0, 1231 },   // 图
+    { 0x571f, 7993, 1, -1 },   // 土
+    { 0x5730, 0, 0, 1233 },   // 地
+    { 0x5c3a, 0, 0, 1234 },   // 尺
+    { 0x5c3e, 7994, 1, -1 },   // 尾
+    { 0x5e18, 0, 0, 1236 },   // 帘
+    { 0x5fc3, 7995, 1, -1 },   // 心
+    { 0x6210, 0, 0, 1238 },   // 成
+    { 0x66f2, 0, 0, 1239 },   // 曲
+    { 0x6765, 0, 0, 1240 },   // 来
+    { 0x6b3e, 0, 0, 1241 },   // 款
+    { 0x6bdb, 0, 0, 1242 },   // 毛
+    { 0x70df, 7996, 1, 1243 },   // 烟
+    { 0x74e3, 0, 0, 1245 },   // 瓣
+    { 0x79ef, 7997, 1, -1 },   // 积
+    { 0x7b52, 0, 0, 1247 },   // 筒
+    { 0x7eb8, 0, 0, 1248 },   // 纸
+    { 0x7f29, 0, 0, 1249 },   // 缩
+    { 0x820c, 0, 0, 1250 },   // 舌
+    { 0x8896, 0, 0, 1251 },   // 袖
+    { 0x8d70, 0, 0, 1252 },   // 走
+    { 0x8d77, 0, 0, 1253 },   // 起
+    { 0x8f74, 0, 0, 1254 },   // 轴
+    { 0x9003, 0, 0, 1255 },   // 逃
+    { 0x94fa, 7998, 1, -1 },   // 铺
+    { 0x987b, 0, 0, 1257 },   // 须
+    { 0x98ce, 0, 0, 1258 },   // 风
+    { 0x4e66, 0, 0, 1262 },   // 书
+    { 0x5143, 0, 0, 1263 },   // 元
+    { 0x53f2, 7999, 1, -1 },   // 史
+    { 0x547d, 0, 0, 1265 },   // 命
+    { 0x59cb, 0, 0, 1266 },   // 始
+    { 0x5ba4, 0, 0, 1267 },   // 室
+    { 0x5c3e, 0, 0, 1268 },   // 尾
+    { 0x5c40, 0, 0, 1269 },   // 局
+    { 0x6570, 8000, 1, -1 },   // 数
+    { 0x65e5, 0, 0, 1271 },   // 日
+    { 0x672c, 0, 0, 1272 },   // 本
+    { 0x6cd5, 0, 0, 1273 },   // 法
+    { 0x7269, 8001, 1, -1 },   // 物
+    { 0x72f1, 0, 0, 1275 },   // 狱
+    { 0x7eaa, 0, 0, 1276 },   // 纪
+    { 0x8c61, 0, 0, 1277 },   // 象
+    { 0x5236, 8002, 2, -1 },   // 制
+    { 0x6539, 0, 0, 1285 },   // 改
+    { 0x6574, 0, 0, 1286 },   // 整
+    { 0x6b63, 0, 0, 1287 },   // 正
+    { 0x6beb, 0, 0, 1288 },   // 毫
+    { 0x6e05, 0, 0, 1289 },   // 清
+    { 0x8ba2, 0, 0, 1290 },   // 订
+    { 0x9769, 0, 0, 1291 },   // 革
+    { 0x5b50, 8004, 1, -1 },   // 子
+    { 0x6587, 8005, 1, -1 },   // 文
+    { 0x949f, 0, 0, 1294 },   // 钟
+    { 0x4f59, 0, 0, 1299 },   // 余
+    { 0x6597, 0, 0, 1302 },   // 斗
+    { 0x5c71, 8006, 1, -1 },   // 山
+    { 0x5fd7, 0, 0, 1305 },   // 志
+    { 0x91cc, 0, 0, 1306 },   // 里
+    { 0x6570, 8007, 2, -1 },   // 数
+    { 0x7ee5, 0, 0, 1310 },   // 绥
+    { 0x6298, 8009, 1, 1312 },   // 折
+    { 0x80dc, 8010, 1, -1 },   // 胜
+    { 0x96d5, 0, 0, 1315 },   // 雕
+    { 0x51b2, 0, 0, 1316 },   // 冲
+    { 0x53cd, 8011, 1, -1 },   // 反
+    { 0x590d, 8012, 1, 1318 },   // 复
+    { 0x5e94, 8013, 1, -1 },   // 应
+    { 0x6734, 0, 0, 1321 },   // 朴
+    { 0x4e0a, 8014, 2, -1 },   // 上
+    { 0x4e1d, 0, 0, 1325 },   // 丝
+    { 0x4e3a, 8016, 1, -1 },   // 为
+    { 0x4e73, 0, 0, 1327 },   // 乳
+    { 0x5149, 8017, 1, -1 },   // 光
+    { 0x532a, 0, 0, 1329 },   // 匪
+    { 0x5377, 0, 0, 1330 },   // 卷
+    { 0x53ca, 8018, 1, -1 },   // 及
+    { 0x578b, 0, 0, 1332 },   // 型
+    { 0x5939, 0, 0, 1333 },   // 夹
+    { 0x59bb, 0, 0, 1334 },   // 妻
+    { 0x5c4b, 0, 0, 1335 },   // 屋
+    { 0x5df2, 8019, 1, -1 },   // 已
+    { 0x5e26, 0, 0, 1337 },   // 带
+    { 0x5e72, 0, 0, 1338 },   // 干
+    { 0x5eca, 0, 0, 1339 },   // 廊
+    { 0x5f0f, 0, 0, 1340 },   // 式
+    { 0x5f15, 8020, 1, -1 },   // 引
+    { 0x62ab, 8021, 1, -1 },   // 披
+    { 0x677e, 0, 0, 1343 },   // 松
+    { 0x6839, 0, 0, 1344 },   // 根
+    { 0x6cb9, 0, 0, 1345 },   // 油
+    { 0x6f02, 0, 0, 1346 },   // 漂
+    { 0x72b6, 8022, 2, 1347 },   // 状
+    { 0x7663, 0, 0, 1350 },   // 癣
+    { 0x77ed, 8024, 1, -1 },   // 短
+    { 0x7981, 0, 0, 1352 },   // 禁
+    { 0x7b3a, 0, 0, 1353 },   // 笺
+    { 0x7b7e, 0, 0, 1354 },   // 签
+    { 0x7c2a, 0, 0, 1355 },   // 簪
+    { 0x7eb1, 0, 0, 1356 },   // 纱
+    { 0x7ed3, 0, 0, 1357 },   // 结
+    { 0x7f51, 8025, 1, -1 },   // 网
+    { 0x80a4, 0, 0, 1359 },   // 肤
+    { 0x80f6, 0, 0, 1360 },   // 胶
+    { 0x811a, 0, 0, 1361 },   // 脚
+    { 0x83dc, 0, 0, 1362 },   // 菜
+    { 0x8721, 0, 0, 1363 },   // 蜡
+    { 0x8e0a, 8026, 1, -1 },   // 踊
+    { 0x8fab, 0, 0, 1365 },   // 辫
+    { 0x9497, 0, 0, 1366 },   // 钗
+    { 0x957f, 0, 0, 1367 },   // 长
+    { 0x9645, 0, 0, 1368 },   // 际
+    { 0x96d5, 0, 0, 1369 },   // 雕
+    { 0x971c, 0, 0, 1370 },   // 霜
+    { 0x9762, 0, 0, 1371 },   // 面
+    { 0x9970, 0, 0, 1372 },   // 饰
+    { 0x9afb, 0, 0, 1373 },   // 髻
+    { 0x9b13, 0, 0, 1374 },   // 鬓
+    { 0x820d, 0, 0, 1375 },   // 舍
+    { 0x6258, 0, 0, 1376 },   // 托
+    { 0x96c7, 0, 0, 1377 },   // 雇
+    { 0x4e11, 0, 0, 1379 },   // 丑
+    { 0x5f81, 0, 0, 1380 },   // 征
+    { 0x5e2d, 0, 0, 1383 },   // 席
+    { 0x5e72, 8027, 1, 1384 },   // 干
+    { 0x71e5, 8028, 1, -1 },   // 燥
+    { 0x8179, 8029, 1, -1 },   // 腹
+    { 0x91cc, 0, 0, 1388 },   // 里
+    { 0x949f, 0, 0, 1389 },   // 钟
+    { 0x4e66, 8030, 1, -1 },   // 书
+    { 0x6587, 8031, 1, -1 },   // 文
+    { 0x6734, 0, 0, 1392 },   // 朴
+    { 0x67ef, 8032, 1, -1 },   // 柯
+    { 0x8bed, 8033, 1, -1 },   // 语
+    { 0x8ff9, 0, 0, 1395 },   // 迹
+    { 0x949f, 8034, 1, 1396 },   // 钟
+    { 0x8f9f, 0, 0, 1398 },   // 辟
+    { 0x949f, 0, 0, 1399 },   // 钟
+    { 0x51b2, 0, 0, 1400 },   // 冲
+    { 0x5360, 8035, 1, -1 },   // 占
+    { 0x5b57, 0, 0, 1402 },   // 字
+    { 0x5f71, 8036, 1, 1403 },   // 影
+    { 0x624b, 8037, 1, -1 },   // 手
+    { 0x773c, 0, 0, 1406 },   // 眼
+    { 0x8a00, 8038, 1, -1 },   // 言
+    { 0x8eab, 8039, 5, 1408 },   // 身
+    { 0x91c7, 8044, 1, 1415 },   // 采
+    { 0x53ee, 8045, 1, -1 },   // 叮
+    { 0x5f53, 0, 0, 1418 },   // 当
+    { 0x7d27, 8046, 1, -1 },   // 紧
+    { 0x9274, 0, 0, 1420 },   // 鉴
+    { 0x4f5f, 0, 0, 1421 },   // 佟
+    { 0x5386, 8047, 1, 1422 },   // 历
+    { 0x5b50, 8048, 1, -1 },   // 子
+    { 0x706f, 0, 0, 1425 },   // 灯
+    { 0x7403, 0, 0, 1426 },   // 球
+    { 0x949f, 0, 0, 1427 },   // 钟
+    { 0x9759, 8049, 1, -1 },   // 静
+    { 0x9762, 8050, 2, -1 },   // 面
+    { 0x98ce, 8052, 3, 1431 },   // 风
+    { 0x9274, 0, 0, 1435 },   // 鉴
+    { 0x53f6, 8055, 1, -1 },   // 叶
+    { 0x9633, 8056, 1, -1 },   // 阳
+    { 0x97f5, 0, 0, 1439 },   // 韵
+    { 0x5fd7, 0, 0, 1441 },   // 志
+    { 0x5929, 0, 0, 1444 },   // 天
+    { 0x6c42, 0, 0, 1445 },   // 求
+    { 0x8bf7, 0, 0, 1446 },   // 请
+    { 0x59dc, 0, 0, 1447 },   // 姜
+    { 0x677f, 8057, 1, -1 },   // 板
+    { 0x7897, 8058, 1, -1 },   // 碗
+    { 0x91cc, 8059, 2, -1 },   // 里
+    { 0x9762, 0, 0, 1452 },   // 面
+    { 0x7c7b, 8061, 1, -1 },   // 类
+    { 0x8f9f, 0, 0, 1454 },   // 辟
+    { 0x4f19, 0, 0, 1455 },   // 伙
+    { 0x51c6, 0, 0, 1456 },   // 准
+    { 0x5386, 8062, 1, 1457 },   // 历
+    { 0x5e76, 0, 0, 1459 },   // 并
+    { 0x91c7, 0, 0, 1460 },   // 采
+    { 0x51f6, 8063, 1, -1 },   // 凶
+    { 0x5f81, 0, 0, 1462 },   // 征
+    { 0x4e27, 0, 0, 1463 },   // 丧
+    { 0x5377, 0, 0, 1464 },   // 卷
+    { 0x53d6, 0, 0, 1465 },   // 取
+    { 0x53e4, 0, 0, 1466 },   // 古
+    { 0x5501, 0, 0, 1467 },   // 唁
+    { 0x5589, 0, 0, 1468 },   // 喉
+    { 0x55ad, 0, 0, 1469 },   // 喭
+    { 0x5934, 0, 0, 1470 },   // 头
+    { 0x5960, 0, 0, 1471 },   // 奠
+    { 0x5b5d, 0, 0, 1472 },   // 孝
+    { 0x5ba2, 0, 0, 1473 },   // 客
+    { 0x5bb4, 0, 0, 1474 },   // 宴
+    { 0x5f71, 0, 0, 1475 },   // 影
+    { 0x6064, 0, 0, 1476 },   // 恤
+    { 0x6170, 0, 0, 1477 },   // 慰
+    { 0x6263, 0, 0, 1478 },   // 扣
+    { 0x62f7, 0, 0, 1479 },   // 拷
+    { 0x6492, 0, 0, 1480 },   // 撒
+    { 0x6587, 0, 0, 1481 },   // 文
+    { 0x65d7, 0, 0, 1482 },   // 旗
+    { 0x6c11, 0, 0, 1483 },   // 民
+    { 0x796d, 0, 0, 1484 },   // 祭
+    { 0x7eb8, 0, 0, 1485 },   // 纸
+    { 0x8005, 8064, 1, -1 },   // 者
+    { 0x811a, 8065, 1, -1 },   // 脚
+    { 0x8170, 8066, 1, -1 },   // 腰
+    { 0x8180, 8067, 1, -1 },   // 膀
+    { 0x8bcd, 0, 0, 1490 },   // 词
+    { 0x8be1, 0, 0, 1491 },   // 诡
+    { 0x8c0e, 0, 0, 1492 },   // 谎
+    { 0x8d3a, 8068, 1, -1 },   // 贺
+    { 0x949f, 0, 0, 1494 },   // 钟
+    { 0x95ee, 0, 0, 1495 },   // 问
+    { 0x9e64, 0, 0, 1496 },   // 鹤
+    { 0x4eba, 8069, 1, -1 },   // 人
+    { 0x4f19, 0, 0, 1498 },   // 伙
+    { 0x4f59, 0, 0, 1499 },   // 余
+    { 0x5355, 8070, 1, -1 },   // 单
+    { 0x4e30, 0, 0, 1502 },   // 丰
+    { 0x5370, 0, 0, 1503 },   // 印
+    { 0x53d1, 8071, 2, -1 },   // 发
+    { 0x53f0, 8073, 1, -1 },   // 台
+    { 0x5929, 0, 0, 1507 },   // 天
+    { 0x6d77, 8074, 1, -1 },   // 海
+    { 0x82cd, 0, 0, 1509 },   // 苍
+    { 0x9762, 8075, 1, -1 },   // 面
+    { 0x54fa, 8076, 2, -1 },   // 哺
+    { 0x5bfc, 0, 0, 1513 },   // 导
+    { 0x5f80, 8078, 2, 1514 },   // 往
+    { 0x6155, 0, 0, 1517 },   // 慕
+    { 0x8fe9, 0, 0, 1518 },   // 迩
+    { 0x540e, 0, 0, 1521 },   // 后
+    { 0x5e76, 0, 0, 1523 },   // 并
+    { 0x6e38, 0, 0, 1524 },   // 游
+    { 0x53f0, 0, 0, 1526 },   // 台
+    { 0x9f7f, 8080, 1, -1 },   // 齿
+    { 0x53d1, 8081, 1, -1 },   // 发
+    { 0x5e72, 0, 0, 1533 },   // 干
+    { 0x53d1, 0, 0, 1534 },   // 发
+    { 0x5e72, 0, 0, 1535 },   // 干
+    { 0x81f4, 8082, 1, -1 },   // 致
+    { 0x91cc, 8083, 1, -1 },   // 里
+    { 0x672d, 0, 0, 1538 },   // 札
+    { 0x91cc, 0, 0, 1539 },   // 里
+    { 0x8d5e, 0, 0, 1546 },   // 赞
+    { 0x5386, 8084, 1, 1551 },   // 历
+    { 0x6e38, 8085, 1, 1553 },   // 游
+    { 0x5401, 0, 0, 1555 },   // 吁
+    { 0x5236, 8086, 2, -1 },   // 制
+    { 0x5978, 0, 0, 1558 },   // 奸
+    { 0x5f81, 0, 0, 1559 },   // 征
+    { 0x5495, 8088, 1, -1 },   // 咕
+    { 0x549a, 8089, 1, -1 },   // 咚
+    { 0x8be2, 0, 0, 1565 },   // 询
+    { 0x8868, 0, 0, 1566 },   // 表
+    { 0x59dc, 8090, 1, -1 },   // 姜
+    { 0x5f53, 0, 0, 1568 },   // 当
+    { 0x5364, 0, 0, 1569 },   // 卤
+    { 0x5473, 0, 0, 1570 },   // 味
+    { 0x54b8, 0, 0, 1571 },   // 咸
+    { 0x5634, 8091, 1, -1 },   // 嘴
+    { 0x571f, 0, 0, 1573 },   // 土
+    { 0x5ea6, 0, 0, 1574 },   // 度
+    { 0x5f97, 0, 0, 1575 },   // 得
+    { 0x6279, 0, 0, 1576 },   // 批
+    { 0x6c34, 0, 0, 1577 },   // 水
+    { 0x6c64, 0, 0, 1578 },   // 汤
+    { 0x6d3e, 0, 0, 1579 },   // 派
+    { 0x6d77, 0, 0, 1580 },   // 海
+    { 0x6de1, 0, 0, 1581 },   // 淡
+    { 0x6e56, 0, 0, 1582 },   // 湖
+    { 0x6e7f, 0, 0, 1583 },   // 湿
+    { 0x6f5f, 0, 0, 1584 },   // 潟
+    { 0x732a, 0, 0, 1585 },   // 猪
+    { 0x751c, 0, 0, 1586 },   // 甜
+    { 0x7684, 0, 0, 1587 },   // 的
+    { 0x7c7b, 0, 0, 1588 },   // 类
+    { 0x7ca5, 0, 0, 1589 },   // 粥
+    { 0x8089, 0, 0, 1590 },   // 肉
+    { 0x83dc, 8092, 1, 1591 },   // 菜
+    { 0x86cb, 0, 0, 1593 },   // 蛋
+    { 0x98df, 0, 0, 1594 },   // 食
+    { 0x9c7c, 0, 0, 1595 },   // 鱼
+    { 0x9e2d, 8093, 1, -1 },   // 鸭
+    { 0x540a, 0, 0, 1597 },   // 吊
+    { 0x633d, 0, 0, 1598 },   // 挽
+    { 0x9274, 0, 0, 1599 },   // 鉴
+    { 0x52a8, 0, 0, 1600 },   // 动
+    { 0x5802, 0, 0, 1601 },   // 堂
+    { 0x7b11, 0, 0, 1602 },   // 笑
+    { 0x949f, 0, 0, 1604 },   // 钟
+    { 0x4f17, 0, 0, 1611 },   // 众
+    { 0x53d8, 0, 0, 1612 },   // 变
+    { 0x566a, 0, 0, 1613 },   // 噪
+    { 0x56a3, 0, 0, 1614 },   // 嚣
+    { 0x7136, 0, 0, 1615 },   // 然
+    { 0x7b11, 0, 0, 1616 },   // 笑
+    { 0x5582, 0, 0, 1621 },   // 喂
+    { 0x91cc, 0, 0, 1622 },   // 里
+    { 0x540a, 0, 0, 1623 },   // 吊
+    { 0x5e72, 0, 0, 1624 },   // 干
+    { 0x6e38, 0, 0, 1629 },   // 游
+    { 0x4f59, 0, 0, 1630 },   // 余
+    { 0x9762, 8094, 1, -1 },   // 面
+    { 0x5386, 8095, 1, 1632 },   // 历
+    { 0x6807, 8096, 1, -1 },   // 标
+    { 0x5408, 0, 0, 1639 },   // 合
+    { 0x866b, 0, 0, 1640 },   // 虫
+    { 0x9f7f, 8097, 1, -1 },   // 齿
+    { 0x5f53, 0, 0, 1642 },   // 当
+    { 0x4e86, 8098, 1, -1 },   // 了
+    { 0x54df, 0, 0, 1646 },   // 哟
+    { 0x6b22, 8099, 2, -1 },   // 欢
+    { 0x5e72, 0, 0, 1650 },   // 干
+    { 0x54c4, 0, 0, 1651 },   // 哄
+    { 0x54d7, 0, 0, 1652 },   // 哗
+    { 0x8c37, 0, 0, 1658 },   // 谷
+    { 0x6258, 0, 0, 1662 },   // 托
+    { 0x91cc, 0, 0, 1663 },   // 里
+    { 0x9f7f, 8101, 1, -1 },   // 齿
+    { 0x82cf, 0, 0, 1666 },   // 苏
+    { 0x8bc8, 0, 0, 1667 },   // 诈
+    { 0x8c37, 0, 0, 1669 },   // 谷
+    { 0x4e2a, 0, 0, 1670 },   // 个
+    { 0x4f59, 0, 0, 1671 },   // 余
+    { 0x51fa, 8102, 1, -1 },   // 出
+    { 0x5206, 8103, 1, -1 },   // 分
+    { 0x53ea, 0, 0, 1675 },   // 只
+    { 0x5468, 8104, 1, -1 },   // 周
+    { 0x5929, 8105, 1, -1 },   // 天
+    { 0x624e, 0, 0, 1678 },   // 扎
+    { 0x6746, 8106, 1, -1 },   // 杆
+    { 0x820d, 8107, 2, -1 },   // 舍
+    { 0x9762, 8109, 1, -1 },   // 面
+    { 0x5149, 8110, 1, -1 },   // 光
+    { 0x5386, 8111, 1, 1684 },   // 历
+    { 0x54cd, 0, 0, 1686 },   // 响
+    { 0x5708, 0, 0, 1687 },   // 圈
+    { 0x590d, 8112, 6, -1 },   // 复
+    { 0x5eca, 0, 0, 1694 },   // 廊
+    { 0x5f62, 8118, 1, -1 },   // 形
+    { 0x6587, 8119, 7, -1 },   // 文
+    { 0x65cb, 0, 0, 1703 },   // 旋
+    { 0x6e38, 0, 0, 1704 },   // 游
+    { 0x73af, 0, 0, 1705 },   // 环
+    { 0x7eb9, 8126, 1, -1 },   // 纹
+    { 0x7ed5, 0, 0, 1707 },   // 绕
+    { 0x7fd4, 0, 0, 1708 },   // 翔
+    { 0x80a0, 8127, 1, 1709 },   // 肠
+    { 0x8361, 0, 0, 1711 },   // 荡
+    { 0x8bf5, 0, 0, 1712 },   // 诵
+    { 0x8def, 0, 0, 1713 },   // 路
+    { 0x8f6c, 0, 0, 1714 },   // 转
+    { 0x9012, 8128, 1, -1 },   // 递
+    { 0x907f, 0, 0, 1716 },   // 避
+    { 0x91c7, 0, 0, 1717 },   // 采
+    { 0x92ae, 0, 0, 1718 },   // 銮
+    { 0x98ce, 0, 0, 1719 },   // 风
+    { 0x5b50, 0, 0, 1721 },   // 子
+    { 0x6e38, 8129, 1, -1 },   // 游
+    { 0x91cc, 0, 0, 1724 },   // 里
+    { 0x4e4f, 0, 0, 1725 },   // 乏
+    { 0x5026, 8130, 1, 1726 },   // 倦
+    { 0x517d, 8131, 2, -1 },   // 兽
+    { 0x6597, 0, 0, 1730 },   // 斗
+    { 0x89c9, 0, 0, 1731 },   // 觉
+    { 0x5f81, 0, 0, 1735 },   // 征
+    { 0x4e4b, 8133, 1, -1 },   // 之
+    { 0x4ec7, 0, 0, 1738 },   // 仇
+    { 0x5386, 8134, 6, 1739 },   // 历
+    { 0x91cc, 8140, 1, -1 },   // 里
+    { 0x9274, 0, 0, 1748 },   // 鉴
+    { 0x6881, 0, 0, 1750 },   // 梁
+    { 0x91cc, 0, 0, 1751 },   // 里
+    { 0x5236, 0, 0, 1752 },   // 制
+    { 0x7d22, 8141, 1, -1 },   // 索
+    { 0x91cc, 0, 0, 1754 },   // 里
+    { 0x4eba, 8142, 1, -1 },   // 人
+    { 0x540e, 0, 0, 1757 },   // 后
+    { 0x9a6c, 8143, 1, -1 },   // 马
+    { 0x5c71, 8144, 1, -1 },   // 山
+    { 0x4e11, 8145, 1, -1 },   // 丑
+    { 0x56fe, 8146, 1, -1 },   // 图
+    { 0x5fc3, 8147, 1, -1 },   // 心
+    { 0x5fd7, 0, 0, 1763 },   // 志
+    { 0x91cc, 0, 0, 1766 },   // 里
+    { 0x53f0, 8148, 1, 1768 },   // 台
+    { 0x5982, 8149, 1, -1 },   // 如
+    { 0x949f, 0, 0, 1771 },   // 钟
+    { 0x91cc, 0, 0, 1772 },   // 里
+    { 0x81f4, 0, 0, 1775 },   // 致
+    { 0x575b, 8150, 1, -1 },   // 坛
+    { 0x5b50, 0, 0, 1778 },   // 子
+    { 0x8303, 0, 0, 1784 },   // 范
+    { 0x8361, 8151, 1, 1785 },   // 荡
+    { 0x90c1, 0, 0, 1787 },   // 郁
+    { 0x53d1, 0, 0, 1788 },   // 发
+    { 0x8303, 0, 0, 1789 },   // 范
+    { 0x8303, 0, 0, 1792 },   // 范
+    { 0x8f9f, 0, 0, 1795 },   // 辟
+    { 0x53ca, 8152, 2, -1 },   // 及
+    { 0x8363, 8154, 1, -1 },   // 荣
+    { 0x5e02, 8155, 1, -1 },   // 市
+    { 0x91cc, 0, 0, 1805 },   // 里
+    { 0x91cc, 8156, 1, -1 },   // 里
+    { 0x91cc, 0, 0, 1810 },   // 里
+    { 0x51c6, 0, 0, 1811 },   // 准
+    { 0x5e72, 0, 0, 1812 },   // 干
+    { 0x6dc0, 0, 0, 1815 },   // 淀
+    { 0x8033, 8157, 1, -1 },   // 耳
+    { 0x91cc, 0, 0, 1817 },   // 里
+    { 0x5fd7, 8158, 1, 1818 },   // 志
+    { 0x91cc, 0, 0, 1821 },   // 里
+    { 0x8f9f, 0, 0, 1822 },   // 辟
+    { 0x6c88, 0, 0, 1823 },   // 沈
+    { 0x6e38, 0, 0, 1825 },   // 游
+    { 0x9762, 0, 0, 1826 },   // 面
+    { 0x6bcd, 8159, 1, -1 },   // 母
+    { 0x91cc, 0, 0, 1830 },   // 里
+    { 0x91cc, 0, 0, 1832 },   // 里
+    { 0x90c1, 0, 0, 1833 },   // 郁
+    { 0x6ce8, 0, 0, 1836 },   // 注
+    { 0x4e60, 0, 0, 1838 },   // 习
+    { 0x4fe1, 0, 0, 1839 },   // 信
+    { 0x5143, 8160, 1, -1 },   // 元
+    { 0x5199, 0, 0, 1841 },   // 写
+    { 0x51b3, 0, 0, 1842 },   // 决
+    { 0x51fd, 8161, 1, -1 },   // 函
+    { 0x5206, 8162, 3, -1 },   // 分
+    { 0x5217, 0, 0, 1847 },   // 列
+    { 0x5229, 0, 0, 1848 },   // 利
+    { 0x5236, 0, 0, 1849 },   // 制
+    { 0x5370, 0, 0, 1850 },   // 印
+    { 0x53d8, 8165, 1, -1 },   // 变
+    { 0x53e5, 0, 0, 1852 },   // 句
+    { 0x53f6, 0, 0, 1853 },   // 叶
+    { 0x5408, 0, 0, 1854 },   // 合
+    { 0x58c1, 0, 0, 1855 },   // 壁
+    { 0x59cb, 0, 0, 1856 },   // 始
+    { 0x59d3, 0, 0, 1857 },   // 姓
+    { 0x5b57, 8166, 1, -1 },   // 字
+    { 0x5ba1, 0, 0, 1859 },   // 审
+    { 0x5bf9, 8167, 1, -1 },   // 对
+    { 0x5e73, 8168, 1, -1 },   // 平
+    { 0x5f0f, 0, 0, 1862 },   // 式
+    { 0x6570, 0, 0, 1863 },   // 数
+    { 0x65b9, 0, 0, 1864 },   // 方
+    { 0x672c, 0, 0, 1865 },   // 本
+    { 0x6742, 0, 0, 1866 },   // 杂
+    { 0x67e5, 0, 0, 1867 },   // 查
+    { 0x6838, 0, 0, 1868 },   // 核
+    { 0x6b21, 0, 0, 1869 },   // 次
+    { 0x6bd4, 0, 0, 1870 },   // 比
+    { 0x6d3b, 8169, 1, -1 },   // 活
+    { 0x6d41, 0, 0, 1872 },   // 流
+    { 0x6d4b, 0, 0, 1873 },   // 测
+    { 0x76ee, 0, 0, 1874 },   // 目
+    { 0x773c, 0, 0, 1875 },   // 眼
+    { 0x79cd, 0, 0, 1876 },   // 种
+    { 0x7a57, 0, 0, 1877 },   // 穗
+    { 0x7ebf, 0, 0, 1878 },   // 线
+    { 0x8272, 0, 0, 1879 },   // 色
+    { 0x82cf, 0, 0, 1880 },   // 苏
+    { 0x8bae, 0, 0, 1881 },   // 议
+    { 0x8bc4, 0, 0, 1882 },   // 评
+    { 0x8bca, 0, 0, 1883 },   // 诊
+    { 0x8bcd, 0, 0, 1884 },   // 词
+    { 0x8bd5, 0, 0, 1885 },   // 试
+    { 0x8bfe, 0, 0, 1886 },   // 课
+    { 0x8d5b, 0, 0, 1887 },   // 赛
+    { 0x8f85, 8170, 1, -1 },   // 辅
+    { 0x8ff0, 0, 0, 1889 },   // 述
+    { 0x9009, 0, 0, 1890 },   // 选
+    { 0x94b1, 0, 0, 1891 },   // 钱
+    { 0x9605, 0, 0, 1892 },   // 阅
+    { 0x97f3, 0, 0, 1893 },   // 音
+    { 0x97f5, 0, 0, 1894 },   // 韵
+    { 0x4e8e, 8171, 1, -1 },   // 于
+    { 0x5386, 8172, 1, 1896 },   // 历
+    { 0x6e38, 0, 0, 1898 },   // 游
+    { 0x5236, 0, 0, 1899 },   // 制
+    { 0x5f3a, 8173, 1, -1 },   // 强
+    { 0x4e11, 0, 0, 1901 },   // 丑
+    { 0x4f59, 0, 0, 1902 },   // 余
+    { 0x51b2, 0, 0, 1903 },   // 冲
+    { 0x51fa, 8174, 1, -1 },   // 出
+    { 0x53ea, 8175, 2, 1905 },   // 只
+    { 0x5468, 8177, 1, -1 },   // 周
+    { 0x5929, 8178, 1, -1 },   // 天
+    { 0x665a, 8179, 1, -1 },   // 晚
+    { 0x6e38, 0, 0, 1911 },   // 游
+    { 0x91cc, 0, 0, 1912 },   // 里
+    { 0x4e11, 0, 0, 1914 },   // 丑
+    { 0x4f19, 8180, 1, 1915 },   // 伙
+    { 0x5386, 8181, 2, 1917 },   // 历
+    { 0x53ea, 8183, 1, 1920 },   // 只
+    { 0x5468, 8184, 1, -1 },   // 周
+    { 0x578b, 8185, 1, -1 },   // 型
+    { 0x5938, 0, 0, 1927 },   // 夸
+    { 0x5e72, 0, 0, 1928 },   // 干
+    { 0x6279, 8186, 1, -1 },   // 批
+    { 0x6298, 8187, 1, -1 },   // 折
+    { 0x660e, 8188, 1, -1 },   // 明
+    { 0x672c, 8189, 1, -1 },   // 本
+    { 0x75c5, 8190, 1, -1 },   // 病
+    { 0x76ee, 8191, 1, -1 },   // 目
+    { 0x7b28, 8192, 1, -1 },   // 笨
+    { 0x884d, 8193, 1, -1 },   // 衍
+    { 0x8d5e, 0, 0, 1939 },   // 赞
+    { 0x91d1, 8194, 1, -1 },   // 金
+    { 0x949f, 0, 0, 1941 },   // 钟
+    { 0x98ce, 8195, 1, -1 },   // 风
+    { 0x514b, 8196, 1, -1 },   // 克
+    { 0x5386, 8197, 1, 1944 },   // 历
+    { 0x540e, 8198, 4, -1 },   // 后
+    { 0x5730, 8202, 1, -1 },   // 地
+    { 0x6587, 8203, 3, -1 },   // 文
+    { 0x91cc, 0, 0, 1954 },   // 里
+    { 0x4e11, 0, 0, 1955 },   // 丑
+    { 0x4ec6, 0, 0, 1956 },   // 仆
+    { 0x51f6, 0, 0, 1957 },   // 凶
+    { 0x521d, 8206, 1, -1 },   // 初
+    { 0x9601, 0, 0, 1960 },   // 阁
+    { 0x53d1, 8207, 1, 1962 },   // 发
+    { 0x91cc, 0, 0, 1964 },   // 里
+    { 0x957f, 8208, 1, -1 },   // 长
+    { 0x4e0b, 8209, 1, -1 },   // 下
+    { 0x4e3d, 0, 0, 1967 },   // 丽
+    { 0x4e86, 0, 0, 1968 },   // 了
+    { 0x4eba, 0, 0, 1969 },   // 人
+    { 0x4ed6, 0, 0, 1970 },   // 他
+    { 0x4f60, 0, 0, 1971 },   // 你
+    { 0x522b, 0, 0, 1972 },   // 别
+    { 0x529f, 0, 0, 1973 },   // 功
+    { 0x53e3, 0, 0, 1974 },   // 口
+    { 0x5634, 0, 0, 1975 },   // 嘴
+    { 0x591a, 8210, 1, -1 },   // 多
+    { 0x5927, 0, 0, 1977 },   // 大
+    { 0x5938, 8211, 1, 1978 },   // 夸
+    { 0x5956, 0, 0, 1980 },   // 奖
+    { 0x5979, 0, 0, 1981 },   // 她
+    { 0x59e3, 0, 0, 1982 },   // 姣
+    { 0x5b98, 0, 0, 1983 },   // 官
+    { 0x5bb9, 0, 0, 1984 },   // 容
+    { 0x5f20, 0, 0, 1985 },   // 张
+    { 0x5f3a, 8212, 1, -1 },   // 强
+    { 0x5f97, 0, 0, 1987 },   // 得
+    { 0x6210, 0, 0, 1988 },   // 成
+    { 0x6211, 0, 0, 1989 },   // 我
+    { 0x624d, 0, 0, 1990 },   // 才
+    { 0x6765, 8213, 1, -1 },   // 来
+    { 0x6bd7, 0, 0, 1992 },   // 毗
+    { 0x6d77, 8214, 1, -1 },   // 海
+    { 0x793a, 0, 0, 1994 },   // 示
+    { 0x79f0, 0, 0, 1995 },   // 称
+    { 0x8000, 0, 0, 1996 },   // 耀
+    { 0x80dc, 8215, 1, -1 },   // 胜
+    { 0x80fd, 8216, 1, 1998 },   // 能
+    { 0x8131, 0, 0, 2000 },   // 脱
+    { 0x8bde, 0, 0, 2001 },   // 诞
+    { 0x8be9, 0, 0, 2002 },   // 诩
+    { 0x8bf4, 0, 0, 2003 },   // 说
+    { 0x8d5e, 0, 0, 2004 },   // 赞
+    { 0x8d77, 0, 0, 2005 },   // 起
+    { 0x8fa9, 0, 0, 2006 },   // 辩
+    { 0x8fc7, 0, 0, 2007 },   // 过
+    { 0x9970, 0, 0, 2008 },   // 饰
+    { 0x8863, 0, 0, 2010 },   // 衣
+    { 0x88d9, 0, 0, 2011 },   // 裙
+    { 0x6597, 0, 0, 2013 },   // 斗
+    { 0x4e11, 0, 0, 2016 },   // 丑
+    { 0x52cb, 0, 0, 2017 },   // 勋
+    { 0x8ff9, 0, 0, 2018 },   // 迹
+    { 0x6597, 0, 0, 2020 },   // 斗
+    { 0x6298, 0, 0, 2021 },   // 折
+    { 0x676f, 0, 0, 2023 },   // 杯
+    { 0x4ec6, 0, 0, 2025 },   // 仆
+    { 0x4ec6, 0, 0, 2026 },   // 仆
+    { 0x592b, 0, 0, 2027 },   // 夫
+    { 0x5987, 0, 0, 2028 },   // 妇
+    { 0x60c5, 0, 0, 2029 },   // 情
+    { 0x6740, 0, 0, 2030 },   // 杀
+    { 0x6c61, 0, 0, 2031 },   // 污
+    { 0x6deb, 8217, 1, 2032 },   // 淫
+    { 0x4e11, 0, 0, 2034 },   // 丑
+    { 0x51f6, 0, 0, 2035 },   // 凶
+    { 0x52c7, 8218, 1, -1 },   // 勇
+    { 0x56f0, 0, 0, 2037 },   // 困
+    { 0x5bb6, 8219, 1, -1 },   // 家
+    { 0x6597, 8220, 1, 2039 },   // 斗
+    { 0x7b7e, 0, 0, 2041 },   // 签
+    { 0x679c, 8221, 1, -1 },   // 果
+    { 0x9965, 8222, 1, -1 },   // 饥
+    { 0x53f0, 0, 0, 2045 },   // 台
+    { 0x6c14, 8223, 1, -1 },   // 气
+    { 0x6258, 8224, 1, 2052 },   // 托
+    { 0x4e1d, 0, 0, 2055 },   // 丝
+    { 0x5564, 0, 0, 2056 },   // 啤
+    { 0x662f, 8225, 1, -1 },   // 是
+    { 0x672b, 0, 0, 2058 },   // 末
+    { 0x6842, 0, 0, 2059 },   // 桂
+    { 0x6bcd, 0, 0, 2060 },   // 母
+    { 0x6c41, 0, 0, 2061 },   // 汁
+    { 0x6c64, 0, 0, 2062 },   // 汤
+    { 0x7247, 0, 0, 2063 },   // 片
+    { 0x7cd6, 0, 0, 2064 },   // 糖
+    { 0x8001, 8226, 1, -1 },   // 老
+    { 0x8336, 0, 0, 2066 },   // 茶
+    { 0x84c9, 0, 0, 2067 },   // 蓉
+    { 0x8fd8, 8227, 1, -1 },   // 还
+    { 0x916e, 0, 0, 2069 },   // 酮
+    { 0x997c, 0, 0, 2070 },   // 饼
+    { 0x9ec4, 0, 0, 2071 },   // 黄
+    { 0x68f1, 0, 0, 2073 },   // 棱
+    { 0x4ec6, 0, 0, 2082 },   // 仆
+    { 0x51f6, 0, 0, 2087 },   // 凶
+    { 0x597d, 8228, 1, -1 },   // 好
+    { 0x59dc, 0, 0, 2091 },   // 姜
+    { 0x6e38, 0, 0, 2093 },   // 游
+    { 0x5e78, 0, 0, 2094 },   // 幸
+    { 0x4f59, 0, 0, 2095 },   // 余
+    { 0x91cc, 0, 0, 2097 },   // 里
+    { 0x6bcd, 8229, 1, -1 },   // 母
+    { 0x6c47, 0, 0, 2099 },   // 汇
+    { 0x7801, 8230, 1, -1 },   // 码
+    { 0x91cc, 8231, 1, -1 },   // 里
+    { 0x6298, 0, 0, 2102 },   // 折
+    { 0x6770, 0, 0, 2104 },   // 杰
+    { 0x5bb6, 0, 0, 2106 },   // 家
+    { 0x91cc, 0, 0, 2107 },   // 里
+    { 0x5b99, 8232, 1, -1 },   // 宙
+    { 0x6c88, 8233, 1, -1 },   // 沈
+    { 0x738b, 8234, 1, -1 },   // 王
+    { 0x5468, 8235, 1, -1 },   // 周
+    { 0x5386, 8236, 1, 2114 },   // 历
+    { 0x5730, 8237, 1, -1 },   // 地
+    { 0x51c6, 0, 0, 2117 },   // 准
+    { 0x5236, 0, 0, 2118 },   // 制
+    { 0x5386, 8238, 1, 2120 },   // 历
+    { 0x91cc, 8239, 1, -1 },   // 里
+    { 0x9274, 0, 0, 2123 },   // 鉴
+    { 0x5e72, 0, 0, 2125 },   // 干
+    { 0x7d2f, 8240, 1, -1 },   // 累
+    { 0x9a8c, 8241, 1, -1 },   // 验
+    { 0x6cc4, 0, 0, 2130 },   // 泄
+    { 0x6e38, 0, 0, 2131 },   // 游
+    { 0x6cd5, 8242, 1, -1 },   // 法
+    { 0x91cc, 0, 0, 2135 },   // 里
+    { 0x6e38, 0, 0, 2136 },   // 游
+    { 0x4e11, 0, 0, 2137 },   // 丑
+    { 0x4ec6, 0, 0, 2138 },   // 仆
+    { 0x4f19, 0, 0, 2139 },   // 伙
+    { 0x91cc, 0, 0, 2140 },   // 里
+    { 0x8303, 0, 0, 2141 },   // 范
+    { 0x4f59, 0, 0, 2143 },   // 余
+    { 0x677e, 8243, 1, 2144 },   // 松
+    { 0x6258, 0, 0, 2147 },   // 托
+    { 0x81f4, 0, 0, 2148 },   // 致
+    { 0x4ec7, 0, 0, 2149 },   // 仇
+    { 0x51c6, 0, 0, 2150 },   // 准
+    { 0x4f59, 0, 0, 2151 },   // 余
+    { 0x6817, 0, 0, 2152 },   // 栗
+    { 0x7981, 8244, 1, -1 },   // 禁
+    { 0x6b32, 0, 0, 2155 },   // 欲
+    { 0x91c7, 0, 0, 2156 },   // 采
+    { 0x53d1, 8245, 1, -1 },   // 发
+    { 0x4e0d, 8246, 1, -1 },   // 不
+    { 0x51c6, 8247, 2, 2160 },   // 准
+    { 0x534e, 8249, 1, -1 },   // 华
+    { 0x6298, 0, 0, 2165 },   // 折
+    { 0x7740, 8250, 1, -1 },   // 着
+    { 0x8868, 8251, 6, -1 },   // 表
+    { 0x949f, 0, 0, 2173 },   // 钟
+    { 0x6e38, 0, 0, 2176 },   // 游
+    { 0x9762, 0, 0, 2178 },   // 面
+    { 0x4e3a, 8257, 1, -1 },   // 为
+    { 0x9762, 8258, 1, -1 },   // 面
+    { 0x96d5, 0, 0, 2181 },   // 雕
+    { 0x4ec6, 0, 0, 2183 },   // 仆
+    { 0x53ea, 8259, 1, 2184 },   // 只
+    { 0x578b, 8260, 1, -1 },   // 型
+    { 0x65f6, 8261, 1, -1 },   // 时
+    { 0x7c73, 8262, 1, -1 },   // 米
+    { 0x91c7, 0, 0, 2192 },   // 采
+    { 0x51ac, 8263, 1, -1 },   // 冬
+    { 0x8303, 0, 0, 2198 },   // 范
+    { 0x91cc, 0, 0, 2199 },   // 里
+    { 0x5c45, 8264, 1, -1 },   // 居
+    { 0x5f03, 8265, 1, -1 },   // 弃
+    { 0x7984, 0, 0, 2204 },   // 禄
+    { 0x7f57, 8266, 1, 2205 },   // 罗
+    { 0x8c0f, 0, 0, 2207 },   // 谏
+    { 0x9e20, 0, 0, 2208 },   // 鸠
+    { 0x5148, 0, 0, 2210 },   // 先
+    { 0x5176, 8267, 1, -1 },   // 其
+    { 0x53ef, 8268, 1, -1 },   // 可
+    { 0x5c3d, 0, 0, 2213 },   // 尽
+    { 0x5feb, 0, 0, 2214 },   // 快
+    { 0x65e9, 0, 0, 2215 },   // 早
+    { 0x662f, 0, 0, 2216 },   // 是
+    { 0x7ba1, 0, 0, 2217 },   // 管
+    { 0x81ea, 0, 0, 2218 },   // 自
+    { 0x901f, 0, 0, 2219 },   // 速
+    { 0x91cf, 0, 0, 2220 },   // 量
+    { 0x4fc3, 0, 0, 2221 },   // 促
+    { 0x8e50, 0, 0, 2222 },   // 蹐
+    { 0x8e85, 0, 0, 2223 },   // 躅
+    { 0x91cc, 0, 0, 2224 },   // 里
+    { 0x6881, 0, 0, 2228 },   // 梁
+    { 0x91cc, 0, 0, 2229 },   // 里
+    { 0x98ce, 8269, 1, -1 },   // 风
+    { 0x6258, 0, 0, 2232 },   // 托
+    { 0x987e, 8270, 1, -1 },   // 顾
+    { 0x624e, 0, 0, 2236 },   // 扎
+    { 0x91cc, 0, 0, 2237 },   // 里
+    { 0x5cb3, 0, 0, 2238 },   // 岳
+    { 0x5d29, 8271, 1, -1 },   // 崩
+    { 0x6881, 0, 0, 2240 },   // 梁
+    { 0x68f1, 0, 0, 2241 },   // 棱
+    { 0x7f8a, 8272, 1, -1 },   // 羊
+    { 0x91cc, 8273, 2, -1 },   // 里
+    { 0x91cd, 8275, 1, -1 },   // 重
+    { 0x807f, 8276, 1, -1 },   // 聿
+    { 0x5ca9, 0, 0, 2255 },   // 岩
+    { 0x5cb3, 0, 0, 2257 },   // 岳
+    { 0x5cb3, 0, 0, 2258 },   // 岳
+    { 0x9e93, 0, 0, 2259 },   // 麓
+    { 0x56de, 0, 0, 2266 },   // 回
+    { 0x68f1, 0, 0, 2272 },   // 棱
+    { 0x56de, 8277, 1, 2274 },   // 回
+    { 0x6e38, 0, 0, 2276 },   // 游
+    { 0x4f5c, 8278, 1, -1 },   // 作
+    { 0x51b2, 8279, 1, -1 },   // 冲
+    { 0x5386, 8280, 1, 2279 },   // 历
+    { 0x5e72, 0, 0, 2281 },   // 干
+    { 0x5236, 0, 0, 2282 },   // 制
+    { 0x5c14, 8281, 1, -1 },   // 尔
+    { 0x800c, 8282, 1, -1 },   // 而
+    { 0x91cc, 0, 0, 2287 },   // 里
+    { 0x91cc, 8283, 1, -1 },   // 里
+    { 0x8c37, 8284, 1, 2290 },   // 谷
+    { 0x8303, 0, 0, 2295 },   // 范
+    { 0x4f2f, 8285, 1, -1 },   // 伯
+    { 0x540e, 8286, 1, -1 },   // 后
+    { 0x4f59, 0, 0, 2304 },   // 余
+    { 0x53d1, 8287, 1, -1 },   // 发
+    { 0x5f81, 0, 0, 2306 },   // 征
+    { 0x5377, 0, 0, 2308 },   // 卷
+    { 0x5b50, 0, 0, 2309 },   // 子
+    { 0x56fe, 8288, 1, -1 },   // 图
+    { 0x4e0a, 0, 0, 2316 },   // 上
+    { 0x4e0b, 8289, 1, -1 },   // 下
+    { 0x4e0d, 8290, 2, -1 },   // 不
+    { 0x4e1d, 0, 0, 2320 },   // 丝
+    { 0x4e2a, 8292, 1, 2321 },   // 个
+    { 0x4e48, 0, 0, 2323 },   // 么
+    { 0x4e54, 0, 0, 2324 },   // 乔
+    { 0x4e86, 0, 0, 2325 },   // 了
+    { 0x4e8b, 0, 0, 2326 },   // 事
+    { 0x4e95, 0, 0, 2327 },   // 井
+    { 0x4e9b, 0, 0, 2328 },   // 些
+    { 0x4ea7, 0, 0, 2329 },   // 产
+    { 0x4eb2, 0, 0, 2330 },   // 亲
+    { 0x4ec0, 8293, 1, -1 },   // 什
+    { 0x4ed7, 0, 0, 2332 },   // 仗
+    { 0x513f, 0, 0, 2333 },   // 儿
+    { 0x51b0, 0, 0, 2334 },   // 冰
+    { 0x51b7, 0, 0, 2335 },   // 冷
+    { 0x51c0, 0, 0, 2336 },   // 净
+    { 0x51c9, 0, 0, 2337 },   // 凉
+    { 0x520d, 0, 0, 2338 },   // 刍
+    { 0x523b, 8294, 1, -1 },   // 刻
+    { 0x5265, 8295, 1, -1 },   // 剥
+    { 0x529e, 0, 0, 2341 },   // 办
+    { 0x52b2, 0, 0, 2342 },   // 劲
+    { 0x5366, 0, 0, 2343 },   // 卦
+    { 0x53f7, 0, 0, 2344 },   // 号
+    { 0x540f, 0, 0, 2345 },   // 吏
+    { 0x5417, 0, 0, 2346 },   // 吗
+    { 0x5455, 0, 0, 2347 },   // 呕
+    { 0x5458, 0, 0, 2348 },   // 员
+    { 0x54b3, 0, 0, 2349 },   // 咳
+    { 0x54bd, 0, 0, 2350 },   // 咽
+    { 0x54d5, 0, 0, 2351 },   // 哕
+    { 0x54e5, 0, 0, 2352 },   // 哥
+    { 0x54ed, 0, 0, 2353 },   // 哭
+    { 0x5531, 0, 0, 2354 },   // 唱
+    { 0x5565, 0, 0, 2355 },   // 啥
+    { 0x557c, 0, 0, 2356 },   // 啼
+    { 0x561b, 0, 0, 2357 },   // 嘛
+    { 0x568e, 0, 0, 2358 },   // 嚎
+    { 0x56de, 8296, 1, -1 },   // 回
+    { 0x5706, 8297, 1, -1 },   // 圆
+    { 0x574f, 8298, 1, -1 },   // 坏
+    { 0x575e, 0, 0, 2362 },   // 坞
+    { 0x5927, 8299, 1, -1 },   // 大
+    { 0x5934, 0, 0, 2364 },   // 头
+    { 0x5973, 0, 0, 2365 },   // 女
+    { 0x5974, 8300, 1, -1 },   // 奴
+    { 0x5988, 0, 0, 2367 },   // 妈
+    { 0x59b9, 0, 0, 2368 },   // 妹
+    { 0x59ca, 0, 0, 2369 },   // 姊
+    { 0x59d0, 0, 0, 2370 },   // 姐
+    { 0x59dc, 0, 0, 2371 },   // 姜
+    { 0x5a18, 0, 0, 2372 },   // 娘
+    { 0x5b50, 0, 0, 2373 },   // 子
+    { 0x5b63, 0, 0, 2374 },   // 季
+    { 0x5b8c, 0, 0, 2375 },   // 完
+    { 0x5bb6, 0, 0, 2376 },   // 家
+    { 0x5c38, 0, 0, 2377 },   // 尸
+    { 0x5c4e, 8301, 1, -1 },   // 屎
+    { 0x5df4, 0, 0, 2379 },   // 巴
+    { 0x5e72, 8302, 1, 2380 },   // 干
+    { 0x5f0f, 0, 0, 2382 },   // 式
+    { 0x5f1f, 0, 0, 2383 },   // 弟
+    { 0x5f53, 0, 0, 2384 },   // 当
+    { 0x5f97, 0, 0, 2385 },   // 得
+    { 0x6025, 0, 0, 2386 },   // 急
+    { 0x6027, 8303, 1, 2387 },   // 性
+    { 0x624d, 0, 0, 2389 },   // 才
+    { 0x6253, 8304, 1, -1 },   // 打
+    { 0x6298, 0, 0, 2391 },   // 折
+    { 0x62cc, 8305, 1, -1 },   // 拌
+    { 0x6389, 0, 0, 2393 },   // 掉
+    { 0x63a2, 0, 0, 2394 },   // 探
+    { 0x6482, 8306, 1, -1 },   // 撂
+    { 0x6487, 8307, 1, -1 },   // 撇
+    { 0x64e6, 0, 0, 2397 },   // 擦
+    { 0x652f, 8308, 2, -1 },   // 支
+    { 0x6599, 0, 0, 2400 },   // 料
+    { 0x65f1, 0, 0, 2401 },   // 旱
+    { 0x6696, 0, 0, 2402 },   // 暖
+    { 0x6750, 0, 0, 2403 },   // 材
+    { 0x6751, 8310, 1, -1 },   // 村
+    { 0x676f, 0, 0, 2405 },   // 杯
+    { 0x679c, 0, 0, 2406 },   // 果
+    { 0x67af, 0, 0, 2407 },   // 枯
+    { 0x67f4, 8311, 1, 2408 },   // 柴
+    { 0x6821, 0, 0, 2410 },   // 校
+    { 0x6885, 0, 0, 2411 },   // 梅
+    { 0x6b7b, 0, 0, 2412 },   // 死
+    { 0x6c60, 0, 0, 2413 },   // 池
+    { 0x6c9f, 0, 0, 2414 },   // 沟
+    { 0x6ca1, 0, 0, 2415 },   // 没
+    { 0x6d17, 0, 0, 2416 },   // 洗
+    { 0x6d3b, 0, 0, 2417 },   // 活
+    { 0x6d41, 0, 0, 2418 },   // 流
+    { 0x6d4e, 0, 0, 2419 },   // 济
+    { 0x6da9, 0, 0, 2420 },   // 涩
+    { 0x6db8, 0, 0, 2421 },   // 涸
+    { 0x6e20, 0, 0, 2422 },   // 渠
+    { 0x6e34, 0, 0, 2423 },   // 渴
+    { 0x6e7f, 0, 0, 2424 },   // 湿
+    { 0x6f06, 0, 0, 2425 },   // 漆
+    { 0x706f, 8312, 1, -1 },   // 灯
+    { 0x70ed, 0, 0, 2427 },   // 热
+    { 0x71ac, 0, 0, 2428 },   // 熬
+    { 0x71e5, 0, 0, 2429 },   // 燥
+    { 0x7236, 8313, 1, -1 },   // 父
+    { 0x7238, 0, 0, 2431 },   // 爸
+    { 0x7239, 0, 0, 2432 },   // 爹
+    { 0x723d, 0, 0, 2433 },   // 爽
+    { 0x7247, 0, 0, 2434 },   // 片
+    { 0x7269, 0, 0, 2435 },   // 物
+    { 0x7403, 8314, 1, -1 },   // 球
+    { 0x751a, 8315, 1, -1 },   // 甚
+    { 0x751f, 8316, 2, -1 },   // 生
+    { 0x7530, 0, 0, 2440 },   // 田
+    { 0x7535, 0, 0, 2441 },   // 电
+    { 0x7565, 0, 0, 2442 },   // 略
+    { 0x75a5, 0, 0, 2443 },   // 疥
+    { 0x7626, 0, 0, 2444 },   // 瘦
+    { 0x762a, 0, 0, 2445 },   // 瘪
+    { 0x763e, 0, 0, 2446 },   // 瘾
+    { 0x7663, 0, 0, 2447 },   // 癣
+    { 0x767d, 8318, 2, -1 },   // 白
+    { 0x7684, 8320, 2, 2450 },   // 的
+    { 0x773c, 0, 0, 2453 },   // 眼
+    { 0x77aa, 8322, 1, -1 },   // 瞪
+    { 0x793c, 0, 0, 2455 },   // 礼
+    { 0x7a3f, 0, 0, 2456 },   // 稿
+    { 0x7b11, 0, 0, 2457 },   // 笑
+    { 0x7b49, 0, 0, 2458 },   // 等
+    { 0x7bfe, 8323, 1, -1 },   // 篾
+    { 0x7c89, 0, 0, 2460 },   // 粉
+    { 0x7cae, 0, 0, 2461 },   // 粮
+    { 0x7cc7, 0, 0, 2462 },   // 糇
+    { 0x7cfb, 0, 0, 2463 },   // 系
+    { 0x7ea2, 8324, 1, -1 },   // 红
+    { 0x7eb2, 0, 0, 2465 },   // 纲
+    { 0x7ebf, 0, 0, 2466 },   // 线
+    { 0x7ec3, 0, 0, 2467 },   // 练
+    { 0x7ec6, 8325, 1, -1 },   // 细
+    { 0x7ed3, 0, 0, 2469 },   // 结
+    { 0x7ef7, 0, 0, 2470 },   // 绷
+    { 0x7f3a, 0, 0, 2471 },   // 缺
+    { 0x7fa4, 8326, 1, -1 },   // 群
+    { 0x8017, 0, 0, 2473 },   // 耗
+    { 0x8089, 8327, 1, -1 },   // 肉
+    { 0x80a1, 0, 0, 2475 },   // 股
+    { 0x80a5, 0, 0, 2476 },   // 肥
+    { 0x8106, 8328, 1, 2477 },   // 脆
+    { 0x82b1, 0, 0, 2479 },   // 花
+    { 0x82d4, 0, 0, 2480 },   // 苔
+    { 0x8328, 8329, 1, -1 },   // 茨
+    { 0x8336, 8330, 1, -1 },   // 茶
+    { 0x8349, 0, 0, 2483 },   // 草
+    { 0x83dc, 0, 0, 2484 },   // 菜
+    { 0x8425, 8331, 1, -1 },   // 营
+    { 0x843d, 0, 0, 2486 },   // 落
+    { 0x85aa, 0, 0, 2487 },   // 薪
+    { 0x8654, 0, 0, 2488 },   // 虔
+    { 0x86ca, 0, 0, 2489 },   // 蛊
+    { 0x8840, 8332, 1, -1 },   // 血
+    { 0x8863, 0, 0, 2491 },   // 衣
+    { 0x88c2, 0, 0, 2492 },   // 裂
+    { 0x8b66, 0, 0, 2493 },   // 警
+    { 0x8d1d, 0, 0, 2494 },   // 贝
+    { 0x8d27, 0, 0, 2495 },   // 货
+    { 0x8d77, 8333, 1, -1 },   // 起
+    { 0x8def, 0, 0, 2497 },   // 路
+    { 0x8e81, 0, 0, 2498 },   // 躁
+    { 0x8fd9, 0, 0, 2499 },   // 这
+    { 0x903c, 0, 0, 2500 },   // 逼
+    { 0x9053, 0, 0, 2501 },   // 道
+    { 0x90e8, 0, 0, 2502 },   // 部
+    { 0x916a, 0, 0, 2503 },   // 酪
+    { 0x9175, 8334, 1, -1 },   // 酵
+    { 0x918b, 0, 0, 2505 },   // 醋
+    { 0x91cd, 0, 0, 2506 },   // 重
+    { 0x91cf, 0, 0, 2507 },   // 量
+    { 0x9505, 0, 0, 2508 },   // 锅
+    { 0x963f, 8335, 1, -1 },   // 阿
+    { 0x96f7, 0, 0, 2510 },   // 雷
+    { 0x970d, 8336, 1, -1 },   // 霍
+    { 0x9762, 0, 0, 2512 },   // 面
+    { 0x9769, 8337, 1, -1 },   // 革
+    { 0x98a1, 0, 0, 2514 },   // 颡
+    { 0x98df, 0, 0, 2515 },   // 食
+    { 0x996d, 0, 0, 2516 },   // 饭
+    { 0x9986, 0, 0, 2517 },   // 馆
+    { 0x998f, 0, 0, 2518 },   // 馏
+    { 0x9c7c, 0, 0, 2519 },   // 鱼
+    { 0x9c9c, 0, 0, 2520 },   // 鲜
+    { 0x51c6, 0, 0, 2521 },   // 准
+    { 0x5e73, 8338, 1, -1 },   // 平
+    { 0x4ee3, 8339, 1, -1 },   // 代
+    { 0x5386, 8340, 2, 2524 },   // 历
+    { 0x8c37, 0, 0, 2527 },   // 谷
+    { 0x91cc, 0, 0, 2528 },   // 里
+    { 0x9274, 0, 0, 2529 },   // 鉴
+    { 0x4e00, 8342, 1, -1 },   // 一
+    { 0x4e3a, 8343, 1, -1 },   // 为
+    { 0x5165, 0, 0, 2534 },   // 入
+    { 0x517c, 0, 0, 2535 },   // 兼
+    { 0x5230, 0, 0, 2536 },   // 到
+    { 0x529b, 0, 0, 2537 },   // 力
+    { 0x53d1, 8344, 9, -1 },   // 发
+    { 0x53e0, 0, 0, 2547 },   // 叠
+    { 0x5408, 0, 0, 2548 },   // 合
+    { 0x540d, 0, 0, 2549 },   // 名
+    { 0x541e, 8353, 1, 2550 },   // 吞
+    { 0x62e2, 0, 0, 2552 },   // 拢
+    { 0x66f0, 8354, 1, -1 },   // 曰
+    { 0x6848, 0, 0, 2554 },   // 案
+    { 0x79d1, 0, 0, 2555 },   // 科
+    { 0x7ebf, 0, 0, 2556 },   // 线
+    { 0x7f51, 0, 0, 2557 },   // 网
+    { 0x80a9, 8355, 1, -1 },   // 肩
+    { 0x884c, 0, 0, 2559 },   // 行
+    { 0x8d2d, 0, 0, 2560 },   // 购
+    { 0x9aa8, 0, 0, 2561 },   // 骨
+    { 0x514d, 0, 0, 2562 },   // 免
+    { 0x5b58, 0, 0, 2563 },   // 存
+    { 0x5e78, 0, 0, 2564 },   // 幸
+    { 0x8fd0, 8356, 1, -1 },   // 运
+    { 0x5f81, 0, 0, 2567 },   // 征
+    { 0x64ad, 8357, 1, -1 },   // 播
+    { 0x820d, 0, 0, 2569 },   // 舍
+    { 0x5185, 8358, 1, -1 },   // 内
+    { 0x91cc, 0, 0, 2572 },   // 里
+    { 0x5386, 8359, 1, 2574 },   // 历
+    { 0x540a, 0, 0, 2576 },   // 吊
+    { 0x5e2d, 0, 0, 2577 },   // 席
+    { 0x5236, 8360, 1, -1 },   // 制
+    { 0x5f81, 0, 0, 2583 },   // 征
+    { 0x949f, 0, 0, 2584 },   // 钟
+    { 0x91cc, 0, 0, 2585 },   // 里
+    { 0x91cc, 0, 0, 2587 },   // 里
+    { 0x5e72, 8361, 2, 2588 },   // 干
+    { 0x540e, 0, 0, 2593 },   // 后
+    { 0x949f, 0, 0, 2594 },   // 钟
+    { 0x5386, 0, 0, 2596 },   // 历
+    { 0x7b51, 8363, 2, -1 },   // 筑
+    { 0x53d1, 0, 0, 2600 },   // 发
+    { 0x540a, 0, 0, 2601 },   // 吊
+    { 0x54c4, 0, 0, 2602 },   // 哄
+    { 0x5c71, 8365, 1, -1 },   // 山
+    { 0x5f81, 0, 0, 2604 },   // 征
+    { 0x8f9f, 0, 0, 2605 },   // 辟
+    { 0x91c7, 0, 0, 2606 },   // 采
+    { 0x820d, 0, 0, 2609 },   // 舍
+    { 0x4e11, 0, 0, 2610 },   // 丑
+    { 0x5e72, 0, 0, 2611 },   // 干
+    { 0x677e, 0, 0, 2612 },   // 松
+    { 0x810f, 8366, 1, -1 },   // 脏
+    { 0x9b3c, 8367, 1, -1 },   // 鬼
+    { 0x53d1, 0, 0, 2616 },   // 发
+    { 0x6597, 0, 0, 2617 },   // 斗
+    { 0x5386, 8368, 1, 2618 },   // 历
+    { 0x4e09, 8369, 1, -1 },   // 三
+    { 0x4e50, 8370, 1, -1 },   // 乐
+    { 0x52cb, 0, 0, 2623 },   // 勋
+    { 0x6770, 0, 0, 2624 },   // 杰
+    { 0x67cf, 8371, 1, -1 },   // 柏
+    { 0x5c71, 8372, 1, -1 },   // 山
+    { 0x5f25, 0, 0, 2628 },   // 弥
+    { 0x6f2b, 0, 0, 2629 },   // 漫
+    { 0x5b50, 8373, 1, -1 },   // 子
+    { 0x73e0, 8374, 1, -1 },   // 珠
+    { 0x5236, 8375, 1, 2636 },   // 制
+    { 0x5978, 0, 0, 2638 },   // 奸
+    { 0x5e72, 0, 0, 2639 },   // 干
+    { 0x4f59, 0, 0, 2641 },   // 余
+    { 0x5e76, 0, 0, 2642 },   // 并
+    { 0x51c6, 0, 0, 2644 },   // 准
+    { 0x5577, 0, 0, 2645 },   // 啷
+    { 0x5f53, 8376, 2, 2646 },   // 当
+    { 0x5236, 0, 0, 2650 },   // 制
+    { 0x5355, 8378, 1, -1 },   // 单
+    { 0x76f8, 8379, 1, -1 },   // 相
+    { 0x590d, 8380, 1, -1 },   // 复
+    { 0x65e5, 8381, 1, -1 },   // 日
+    { 0x91cc, 0, 0, 2657 },   // 里
+    { 0x4ee4, 0, 0, 2658 },   // 令
+    { 0x4fe1, 0, 0, 2659 },   // 信
+    { 0x5019, 0, 0, 2660 },   // 候
+    { 0x5146, 0, 0, 2661 },   // 兆
+    { 0x5175, 0, 0, 2662 },   // 兵
+    { 0x5230, 0, 0, 2663 },   // 到
+    { 0x52df, 0, 0, 2664 },   // 募
+    { 0x53cb, 0, 0, 2665 },   // 友
+    { 0x53d1, 0, 0, 2666 },   // 发
+    { 0x53ec, 0, 0, 2667 },   // 召
+    { 0x540d, 8382, 1, -1 },   // 名
+    { 0x540f, 0, 0, 2669 },   // 吏
+    { 0x542f, 0, 0, 2670 },   // 启
+    { 0x548e, 0, 0, 2671 },   // 咎
+    { 0x5723, 0, 0, 2672 },   // 圣
+    { 0x58eb, 0, 0, 2673 },   // 士
+    { 0x5a5a, 0, 0, 2674 },   // 婚
+    { 0x5b9e, 0, 0, 2675 },   // 实
+    { 0x5eb8, 0, 0, 2676 },   // 庸
+    { 0x5f15, 0, 0, 2677 },   // 引
+    { 0x5f97, 0, 0, 2678 },   // 得
+    { 0x602a, 0, 0, 2679 },   // 怪
+    { 0x624d, 0, 0, 2680 },   // 才
+    { 0x62db, 0, 0, 2681 },   // 招
+    { 0x6536, 0, 0, 2682 },   // 收
+    { 0x6548, 0, 0, 2683 },   // 效
+    { 0x6587, 0, 0, 2684 },   // 文
+    { 0x6c42, 0, 0, 2685 },   // 求
+    { 0x72b6, 0, 0, 2686 },   // 状
+    { 0x7528, 0, 0, 2687 },   // 用
+    { 0x7a0e, 0, 0, 2688 },   // 税
+    { 0x7a3f, 0, 0, 2689 },   // 稿
+    { 0x7b54, 0, 0, 2690 },   // 答
+    { 0x7ed3, 0, 0, 2691 },   // 结
+    { 0x8058, 0, 0, 2692 },   // 聘
+    { 0x8bad, 0, 0, 2693 },   // 训
+    { 0x8be2, 0, 0, 2694 },   // 询
+    { 0x8c03, 0, 0, 2695 },   // 调
+    { 0x8c61, 0, 0, 2696 },   // 象
+    { 0x8d2d, 0, 0, 2697 },   // 购
+    { 0x8f66, 0, 0, 2698 },   // 车
+    { 0x8f9f, 0, 0, 2699 },   // 辟
+    { 0x8ff9, 0, 0, 2700 },   // 迹
+    { 0x9009, 0, 0, 2701 },   // 选
+    { 0x9010, 0, 0, 2702 },   // 逐
+    { 0x96c6, 0, 0, 2703 },   // 集
+    { 0x98ce, 8383, 1, -1 },   // 风
+    { 0x9a8c, 0, 0, 2705 },   // 验
+    { 0x590d, 0, 0, 2707 },   // 复
+    { 0x4e11, 0, 0, 2708 },   // 丑
+    { 0x51c6, 0, 0, 2709 },   // 准
+    { 0x51f6, 0, 0, 2710 },   // 凶
+    { 0x5e72, 0, 0, 2711 },   // 干
+    { 0x677e, 0, 0, 2712 },   // 松
+    { 0x5386, 8384, 1, -1 },   // 历
+    { 0x5e72, 0, 0, 2714 },   // 干
+    { 0x6258, 8385, 1, -1 },   // 托
+    { 0x5230, 8386, 1, -1 },   // 到
+    { 0x529b, 8387, 1, -1 },   // 力
+    { 0x4fae, 0, 0, 2719 },   // 侮
+    { 0x5236, 0, 0, 2720 },   // 制
+    { 0x5bc7, 0, 0, 2721 },   // 寇
+    { 0x5bd2, 0, 0, 2722 },   // 寒
+    { 0x5cb3, 8388, 1, -1 },   // 岳
+    { 0x654c, 0, 0, 2724 },   // 敌
+    { 0x4f59, 0, 0, 2725 },   // 余
+    { 0x7cfb, 8389, 111, -1 },   // 系
+    { 0x7ec6, 8500, 1, -1 },   // 细
+    { 0x810f, 8501, 1, 2838 },   // 脏
+    { 0x8361, 0, 0, 2840 },   // 荡
+    { 0x91cc, 8502, 1, 2841 },   // 里
+    { 0x957f, 8503, 1, -1 },   // 长
+    { 0x987b, 0, 0, 2844 },   // 须
+    { 0x54c0, 0, 0, 2847 },   // 哀
+    { 0x559c, 0, 0, 2848 },   // 喜
+    { 0x5e86, 0, 0, 2849 },   // 庆
+    { 0x5f02, 0, 0, 2850 },   // 异
+    { 0x91cc, 8504, 1, 2851 },   // 里
+    { 0x4ec6, 0, 0, 2853 },   // 仆
+    { 0x90c1, 0, 0, 2855 },   // 郁
+    { 0x51b2, 0, 0, 2856 },   // 冲
+    { 0x5feb, 8505, 1, -1 },   // 快
+    { 0x91cc, 0, 0, 2860 },   // 里
+    { 0x949f, 0, 0, 2861 },   // 钟
+    { 0x4e48, 8506, 1, -1 },   // 么
+    { 0x53d1, 8507, 1, -1 },   // 发
+    { 0x6c14, 8508, 1, -1 },   // 气
+    { 0x706b, 8509, 1, -1 },   // 火
+    { 0x5982, 8510, 1, -1 },   // 如
+    { 0x51b2, 8511, 1, -1 },   // 冲
+    { 0x522b, 8512, 1, -1 },   // 别
+    { 0x5f81, 0, 0, 2876 },   // 征
+    { 0x6b32, 0, 0, 2877 },   // 欲
+    { 0x6c14, 8513, 1, -1 },   // 气
+    { 0x91cc, 8514, 1, -1 },   // 里
+    { 0x90c1, 0, 0, 2880 },   // 郁
+    { 0x6570, 8515, 2, -1 },   // 数
+    { 0x88c1, 8517, 1, -1 },   // 裁
+    { 0x6817, 0, 0, 2887 },   // 栗
+    { 0x604b, 8518, 1, -1 },   // 恋
+    { 0x4ea4, 8519, 1, -1 },   // 交
+    { 0x8c37, 0, 0, 2892 },   // 谷
+    { 0x6258, 0, 0, 2894 },   // 托
+    { 0x4ec6, 0, 0, 2896 },   // 仆
+    { 0x5fc3, 0, 0, 2897 },   // 心
+    { 0x6597, 0, 0, 2898 },   // 斗
+    { 0x76f4, 8520, 1, -1 },   // 直
+    { 0x90c1, 0, 0, 2906 },   // 郁
+    { 0x60a0, 8521, 1, -1 },   // 悠
+    { 0x6e38, 0, 0, 2908 },   // 游
+    { 0x8361, 0, 0, 2909 },   // 荡
+    { 0x6302, 0, 0, 2913 },   // 挂
+    { 0x6881, 0, 0, 2914 },   // 梁
+    { 0x81c2, 8522, 1, -1 },   // 臂
+    { 0x949f, 0, 0, 2916 },   // 钟
+    { 0x51c4, 0, 0, 2919 },   // 凄
+    { 0x90c1, 0, 0, 2920 },   // 郁
+    { 0x6817, 0, 0, 2921 },   // 栗
+    { 0x6b32, 0, 0, 2922 },   // 欲
+    { 0x6734, 0, 0, 2923 },   // 朴
+    { 0x6817, 0, 0, 2925 },   // 栗
+    { 0x8d5e, 0, 0, 2926 },   // 赞
+    { 0x949f, 0, 0, 2927 },   // 钟
+    { 0x6de1, 0, 0, 2930 },   // 淡
+    { 0x5fff, 8523, 1, -1 },   // 忿
+    { 0x6817, 0, 0, 2938 },   // 栗
+    { 0x5408, 0, 0, 2939 },   // 合
+    { 0x5927, 8524, 1, -1 },   // 大
+    { 0x6734, 0, 0, 2945 },   // 朴
+    { 0x6eaa, 0, 0, 2946 },   // 溪
+    { 0x91cc, 8525, 1, -1 },   // 里
+    { 0x677e, 0, 0, 2949 },   // 松
+    { 0x6817, 0, 0, 2953 },   // 栗
+    { 0x8303, 0, 0, 2954 },   // 范
+    { 0x91cc, 0, 0, 2958 },   // 里
+    { 0x4e8e, 8526, 1, -1 },   // 于
+    { 0x5929, 8527, 1, -1 },   // 天
+    { 0x6597, 0, 0, 2963 },   // 斗
+    { 0x6817, 0, 0, 2964 },   // 栗
+    { 0x8c37, 0, 0, 2966 },   // 谷
+    { 0x53d1, 8528, 1, -1 },   // 发
+    { 0x91cc, 0, 0, 2970 },   // 里
+    { 0x6258, 0, 0, 2971 },   // 托
+    { 0x62df, 8529, 1, -1 },   // 拟
+    { 0x51a2, 8530, 1, -1 },   // 冢
+    { 0x6298, 0, 0, 2974 },   // 折
+    { 0x677e, 0, 0, 2975 },   // 松
+    { 0x6e38, 0, 0, 2976 },   // 游
+    { 0x8868, 8531, 4, 2977 },   // 表
+    { 0x91cc, 8535, 1, 2982 },   // 里
+    { 0x94fe, 0, 0, 2984 },   // 链
+    { 0x5e72, 8536, 2, 2985 },   // 干
+    { 0x4e0a, 0, 0, 2988 },   // 上
+    { 0x4e0b, 0, 0, 2989 },   // 下
+    { 0x56ee, 0, 0, 2990 },   // 囮
+    { 0x597d, 0, 0, 2991 },   // 好
+    { 0x5b9e, 0, 0, 2992 },   // 实
+    { 0x5be8, 0, 0, 2993 },   // 寨
+    { 0x5e26, 8538, 1, -1 },   // 带
+    { 0x6210, 0, 0, 2995 },   // 成
+    { 0x6839, 0, 0, 2996 },   // 根
+    { 0x7d27, 0, 0, 2997 },   // 紧
+    { 0x811a, 0, 0, 2998 },   // 脚
+    { 0x8425, 0, 0, 2999 },   // 营
+    { 0x88f9, 0, 0, 3000 },   // 裹
+    { 0x8bc8, 0, 0, 3001 },   // 诈
+    { 0x8d77, 0, 0, 3002 },   // 起
+    { 0x94c1, 0, 0, 3003 },   // 铁
+    { 0x51ac, 0, 0, 3005 },   // 冬
+    { 0x549a, 8539, 1, 3006 },   // 咚
+    { 0x631e, 0, 0, 3008 },   // 挞
+    { 0x51fa, 8540, 1, -1 },   // 出
+    { 0x5361, 8541, 1, -1 },   // 卡
+    { 0x5364, 0, 0, 3011 },   // 卤
+    { 0x5e72, 8542, 1, 3012 },   // 干
+    { 0x6597, 0, 0, 3014 },   // 斗
+    { 0x65ad, 8543, 1, -1 },   // 断
+    { 0x8c37, 0, 0, 3016 },   // 谷
+    { 0x949f, 0, 0, 3017 },   // 钟
+    { 0x98ce, 8544, 1, -1 },   // 风
+    { 0x4e70, 0, 0, 3019 },   // 买
+    { 0x4e86, 0, 0, 3020 },   // 了
+    { 0x4e8b, 0, 0, 3021 },   // 事
+    { 0x4ea4, 0, 0, 3022 },   // 交
+    { 0x4ed8, 0, 0, 3023 },   // 付
+    { 0x513f, 0, 0, 3024 },   // 儿
+    { 0x514b, 8545, 1, -1 },   // 克
+    { 0x5356, 0, 0, 3026 },   // 卖
+    { 0x53e4, 8546, 1, -1 },   // 古
+    { 0x540d, 0, 0, 3028 },   // 名
+    { 0x547d, 0, 0, 3029 },   // 命
+    { 0x548e, 0, 0, 3030 },   // 咎
+    { 0x5b64, 0, 0, 3031 },   // 孤
+    { 0x5e87, 0, 0, 3032 },   // 庇
+    { 0x6545, 0, 0, 3033 },   // 故
+    { 0x68a6, 0, 0, 3034 },   // 梦
+    { 0x75be, 0, 0, 3035 },   // 疾
+    { 0x75c5, 0, 0, 3036 },   // 病
+    { 0x7ba1, 8547, 1, 3037 },   // 管
+    { 0x8a00, 0, 0, 3039 },   // 言
+    { 0x8bcd, 0, 0, 3040 },   // 词
+    { 0x8eab, 0, 0, 3041 },   // 身
+    { 0x8f9e, 0, 0, 3042 },   // 辞
+    { 0x8fc7, 0, 0, 3043 },   // 过
+    { 0x8fd0, 0, 0, 3044 },   // 运
+    { 0x91cc, 8548, 1, -1 },   // 里
+    { 0x9644, 0, 0, 3046 },   // 附
+    { 0x5927, 8549, 1, -1 },   // 大
+    { 0x8361, 0, 0, 3052 },   // 荡
+    { 0x9762, 0, 0, 3054 },   // 面
+    { 0x4f59, 0, 0, 3056 },   // 余
+    { 0x51c6, 8550, 1, -1 },   // 准
+    { 0x590d, 0, 0, 3058 },   // 复
+    { 0x6597, 0, 0, 3059 },   // 斗
+    { 0x6ce8, 0, 0, 3060 },   // 注
+    { 0x80ae, 8551, 1, 3061 },   // 肮
+    { 0x90c1, 0, 0, 3063 },   // 郁
+    { 0x5978, 0, 0, 3064 },   // 奸
+    { 0x6597, 0, 0, 3065 },   // 斗
+    { 0x5fa1, 0, 0, 3066 },   // 御
+    { 0x51b2, 0, 0, 3067 },   // 冲
+    { 0x53e0, 0, 0, 3068 },   // 叠
+    { 0x53f0, 0, 0, 3069 },   // 台
+    { 0x594f, 0, 0, 3070 },   // 奏
+    { 0x5b50, 8552, 1, 3071 },   // 子
+    { 0x5c3a, 0, 0, 3073 },   // 尺
+    { 0x6247, 0, 0, 3074 },   // 扇
+    { 0x68af, 0, 0, 3075 },   // 梯
+    { 0x6905, 0, 0, 3076 },   // 椅
+    { 0x75d5, 0, 0, 3077 },   // 痕
+    { 0x7bf7, 0, 0, 3078 },   // 篷
+    { 0x7eb8, 0, 0, 3079 },   // 纸
+    { 0x88d9, 0, 0, 3080 },   // 裙
+    { 0x53d1, 0, 0, 3088 },   // 发
+    { 0x53d1, 0, 0, 3090 },   // 发
+    { 0x5934, 8553, 1, -1 },   // 头
+    { 0x699b, 8554, 1, -1 },   // 榛
+    { 0x6734, 8555, 1, -1 },   // 朴
+    { 0x7d20, 8556, 1, -1 },   // 素
+    { 0x5fa1, 0, 0, 3095 },   // 御
+    { 0x727e, 0, 0, 3096 },   // 牾
+    { 0x89e6, 0, 0, 3097 },   // 触
+    { 0x5e72, 0, 0, 3098 },   // 干
+    { 0x516c, 8557, 1, -1 },   // 公
+    { 0x5e72, 0, 0, 3100 },   // 干
+    { 0x7b7e, 0, 0, 3101 },   // 签
+    { 0x53d1, 0, 0, 3102 },   // 发
+    { 0x949f, 8558, 1, -1 },   // 钟
+    { 0x4ed4, 8559, 1, -1 },   // 仔
+    { 0x62c5, 8560, 1, -1 },   // 担
+    { 0x4f19, 0, 0, 3107 },   // 伙
+    { 0x987b, 0, 0, 3108 },   // 须
+    { 0x514b, 8561, 1, -1 },   // 克
+    { 0x7ea4, 0, 0, 3110 },   // 纤
+    { 0x9762, 8562, 1, 3111 },   // 面
+    { 0x9762, 0, 0, 3113 },   // 面
+    { 0x6734, 0, 0, 3114 },   // 朴
+    { 0x53d1, 0, 0, 3115 },   // 发
+    { 0x987b, 0, 0, 3116 },   // 须
+    { 0x522b, 0, 0, 3117 },   // 别
+    { 0x6734, 0, 0, 3118 },   // 朴
+    { 0x820d, 0, 0, 3119 },   // 舍
+    { 0x6258, 0, 0, 3120 },   // 托
+    { 0x5e72, 0, 0, 3127 },   // 干
+    { 0x8c37, 0, 0, 3129 },   // 谷
+    { 0x53d1, 0, 0, 3131 },   // 发
+    { 0x5e72, 0, 0, 3132 },   // 干
+    { 0x5c40, 0, 0, 3133 },   // 局
+    { 0x6597, 0, 0, 3134 },   // 斗
+    { 0x6c88, 0, 0, 3135 },   // 沈
+    { 0x51c6, 0, 0, 3136 },   // 准
+    { 0x7834, 8563, 1, -1 },   // 破
+    { 0x5386, 0, 0, 3139 },   // 历
+    { 0x540d, 0, 0, 3140 },   // 名
+    { 0x94a9, 0, 0, 3141 },   // 钩
+    { 0x9762, 0, 0, 3142 },   // 面
+    { 0x6597, 0, 0, 3143 },   // 斗
+    { 0x5927, 8564, 1, -1 },   // 大
+    { 0x6597, 0, 0, 3145 },   // 斗
+    { 0x624b, 8565, 1, -1 },   // 手
+    { 0x66f2, 0, 0, 3158 },   // 曲
+    { 0x6b4c, 0, 0, 3159 },   // 歌
+    { 0x8054, 0, 0, 3160 },   // 联
+    { 0x8bcd, 0, 0, 3161 },   // 词
+    { 0x8bd7, 0, 0, 3162 },   // 诗
+    { 0x8f66, 0, 0, 3163 },   // 车
+    { 0x8f93, 0, 0, 3164 },   // 输
+    { 0x8f9e, 0, 0, 3165 },   // 辞
+    { 0x624e, 0, 0, 3166 },   // 扎
+    { 0x53d1, 0, 0, 3167 },   // 发
+    { 0x5978, 8566, 3, 3168 },   // 奸
+    { 0x5fa1, 0, 0, 3172 },   // 御
+    { 0x9762, 8569, 1, -1 },   // 面
+    { 0x5e72, 0, 0, 3175 },   // 干
+    { 0x9762, 0, 0, 3176 },   // 面
+    { 0x53ea, 0, 0, 3180 },   // 只
+    { 0x7b7e, 0, 0, 3181 },   // 签
+    { 0x9b3c, 8570, 1, -1 },   // 鬼
+    { 0x4e91, 0, 0, 3185 },   // 云
+    { 0x9762, 0, 0, 3186 },   // 面
+    { 0x70bc, 0, 0, 3187 },   // 炼
+    { 0x52cb, 0, 0, 3188 },   // 勋
+    { 0x65f6, 8571, 1, -1 },   // 时
+    { 0x5e72, 8572, 1, 3190 },   // 干
+    { 0x9aa8, 8573, 1, -1 },   // 骨
+    { 0x7b7e, 0, 0, 3193 },   // 签
+    { 0x60c5, 8574, 1, -1 },   // 情
+    { 0x6258, 8575, 1, 3195 },   // 托
+    { 0x5b50, 8576, 1, -1 },   // 子
+    { 0x5fc3, 8577, 1, -1 },   // 心
+    { 0x6469, 8578, 1, -1 },   // 摩
+    { 0x9ad8, 8579, 1, -1 },   // 高
+    { 0x53d1, 0, 0, 3207 },   // 发
+    { 0x5e72, 0, 0, 3208 },   // 干
+    { 0x53d1, 0, 0, 3209 },   // 发
+    { 0x91c7, 0, 0, 3210 },   // 采
+    { 0x987b, 0, 0, 3211 },   // 须
+    { 0x4e11, 0, 0, 3212 },   // 丑
+    { 0x9762, 0, 0, 3219 },   // 面
+    { 0x6597, 0, 0, 3220 },   // 斗
+    { 0x6597, 0, 0, 3221 },   // 斗
+    { 0x4f19, 0, 0, 3222 },   // 伙
+    { 0x5e72, 8580, 1, -1 },   // 干
+    { 0x5236, 0, 0, 3226 },   // 制
+    { 0x949f, 0, 0, 3229 },   // 钟
+    { 0x575a, 8581, 1, -1 },   // 坚
+    { 0x91c7, 0, 0, 3234 },   // 采
+    { 0x68f1, 0, 0, 3235 },   // 棱
+    { 0x949f, 0, 0, 3236 },   // 钟
+    { 0x540a, 0, 0, 3238 },   // 吊
+    { 0x987b, 0, 0, 3240 },   // 须
+    { 0x949f, 0, 0, 3241 },   // 钟
+    { 0x9635, 8582, 1, -1 },   // 阵
+    { 0x5e76, 0, 0, 3243 },   // 并
+    { 0x6597, 0, 0, 3244 },   // 斗
+    { 0x9762, 0, 0, 3249 },   // 面
+    { 0x4f5c, 8583, 1, -1 },   // 作
+    { 0x53d1, 0, 0, 3252 },   // 发
+    { 0x5e72, 0, 0, 3253 },   // 干
+    { 0x5e72, 0, 0, 3255 },   // 干
+    { 0x914d, 8584, 1, -1 },   // 配
+    { 0x83b7, 0, 0, 3257 },   // 获
+    { 0x5f81, 0, 0, 3258 },   // 征
+    { 0x91c7, 0, 0, 3259 },   // 采
+    { 0x61de, 8585, 1, -1 },   // 懞
+    { 0x677e, 0, 0, 3261 },   // 松
+    { 0x8361, 0, 0, 3262 },   // 荡
+    { 0x6597, 0, 0, 3263 },   // 斗
+    { 0x5ffe, 8586, 1, -1 },   // 忾
+    { 0x5b66, 8587, 1, -1 },   // 学
+    { 0x8303, 0, 0, 3267 },   // 范
+    { 0x5e72, 0, 0, 3269 },   // 干
+    { 0x6597, 8588, 1, -1 },   // 斗
+    { 0x4f19, 0, 0, 3271 },   // 伙
+    { 0x8361, 0, 0, 3272 },   // 荡
+    { 0x6734, 0, 0, 3273 },   // 朴
+    { 0x633d, 0, 0, 3274 },   // 挽
+    { 0x53ea, 8589, 13, 3276 },   // 只
+    { 0x5929, 8602, 1, -1 },   // 天
+    { 0x5b57, 8603, 1, -1 },   // 字
+    { 0x7f6a, 8604, 1, -1 },   // 罪
+    { 0x949f, 0, 0, 3294 },   // 钟
+    { 0x51fa, 8605, 3, -1 },   // 出
+    { 0x53d1, 8608, 1, -1 },   // 发
+    { 0x53ea, 0, 0, 3299 },   // 只
+    { 0x98ce, 8609, 1, -1 },   // 风
+    { 0x5b66, 8610, 1, -1 },   // 学
+    { 0x5f81, 8611, 1, -1 },   // 征
+    { 0x601d, 8612, 1, -1 },   // 思
+    { 0x4e0d, 8613, 1, -1 },   // 不
+    { 0x4e3d, 0, 0, 3307 },   // 丽
+    { 0x4e86, 0, 0, 3308 },   // 了
+    { 0x4e89, 8614, 1, 3309 },   // 争
+    { 0x5012, 0, 0, 3311 },   // 倒
+    { 0x517d, 0, 0, 3312 },   // 兽
+    { 0x5206, 8615, 1, -1 },   // 分
+    { 0x522b, 8616, 1, -1 },   // 别
+    { 0x5251, 0, 0, 3315 },   // 剑
+    { 0x529b, 0, 0, 3316 },   // 力
+    { 0x52b2, 0, 0, 3317 },   // 劲
+    { 0x52c7, 0, 0, 3318 },   // 勇
+    { 0x53e0, 0, 0, 3319 },   // 叠
+    { 0x53f6, 8617, 2, -1 },   // 叶
+    { 0x5408, 0, 0, 3322 },   // 合
+    { 0x54c4, 0, 0, 3323 },   // 哄
+    { 0x5634, 0, 0, 3324 },   // 嘴
+    { 0x5730, 8619, 1, -1 },   // 地
+    { 0x57ae, 0, 0, 3326 },   // 垮
+    { 0x58eb, 0, 0, 3327 },   // 士
+    { 0x5934, 0, 0, 3328 },   // 头
+    { 0x5bcc, 0, 0, 3329 },   // 富
+    { 0x5de7, 0, 0, 3330 },   // 巧
+    { 0x5e4c, 8620, 1, -1 },   // 幌
+    { 0x5f04, 0, 0, 3332 },   // 弄
+    { 0x5f15, 0, 0, 3333 },   // 引
+    { 0x5f69, 0, 0, 3334 },   // 彩
+    { 0x5fc3, 8621, 1, -1 },   // 心
+    { 0x5fd7, 0, 0, 3336 },   // 志
+    { 0x6210, 0, 0, 3337 },   // 成
+    { 0x6218, 0, 0, 3338 },   // 战
+    { 0x6253, 0, 0, 3339 },   // 打
+    { 0x6279, 8622, 1, -1 },   // 批
+    { 0x6280, 0, 0, 3341 },   // 技
+    { 0x6587, 0, 0, 3342 },   // 文
+    { 0x6597, 0, 0, 3343 },   // 斗
+    { 0x667a, 0, 0, 3344 },   // 智
+    { 0x66b4, 0, 0, 3345 },   // 暴
+    { 0x6765, 8623, 1, -1 },   // 来
+    { 0x6b66, 0, 0, 3347 },   // 武
+    { 0x6bb4, 0, 0, 3348 },   // 殴
+    { 0x6c14, 0, 0, 3349 },   // 气
+    { 0x6cd5, 0, 0, 3350 },   // 法
+    { 0x724c, 0, 0, 3351 },   // 牌
+    { 0x7259, 8624, 2, -1 },   // 牙
+    { 0x725b, 0, 0, 3354 },   // 牛
+    { 0x7280, 8626, 1, -1 },   // 犀
+    { 0x72ac, 0, 0, 3356 },   // 犬
+    { 0x72d7, 0, 0, 3357 },   // 狗
+    { 0x72e0, 0, 0, 3358 },   // 狠
+    { 0x767e, 8627, 1, -1 },   // 百
+    { 0x773c, 0, 0, 3360 },   // 眼
+    { 0x79c1, 8628, 1, -1 },   // 私
+    { 0x800c, 8629, 1, -1 },   // 而
+    { 0x80dc, 0, 0, 3364 },   // 胜
+    { 0x811a, 0, 0, 3365 },   // 脚
+    { 0x8230, 0, 0, 3366 },   // 舰
+    { 0x8273, 0, 0, 3367 },   // 艳
+    { 0x8336, 0, 0, 3368 },   // 茶
+    { 0x8349, 0, 0, 3369 },   // 草
+    { 0x86d0, 0, 0, 3370 },   // 蛐
+    { 0x87cb, 8630, 1, -1 },   // 蟋
+    { 0x8bdd, 0, 0, 3372 },   // 话
+    { 0x8d25, 0, 0, 3373 },   // 败
+    { 0x8d77, 0, 0, 3374 },   // 起
+    { 0x8da3, 0, 0, 3375 },   // 趣
+    { 0x95f2, 8631, 1, -1 },   // 闲
+    { 0x95f7, 0, 0, 3377 },   // 闷
+    { 0x96ea, 8632, 1, -1 },   // 雪
+    { 0x98ce, 0, 0, 3379 },   // 风
+    { 0x9c7c, 0, 0, 3380 },   // 鱼
+    { 0x9e21, 0, 0, 3381 },   // 鸡
+    { 0x9e2d, 0, 0, 3382 },   // 鸭
+    { 0x9e4c, 8633, 1, -1 },   // 鹌
+    { 0x9f99, 0, 0, 3384 },   // 龙
+    { 0x96d5, 8634, 1, -1 },   // 雕
+    { 0x53d1, 8635, 1, 3388 },   // 发
+    { 0x5386, 8636, 1, 3390 },   // 历
+    { 0x5e72, 8637, 1, -1 },   // 干
+    { 0x624e, 0, 0, 3393 },   // 扎
+    { 0x96d5, 8638, 1, -1 },   // 雕
+    { 0x4fbf, 8639, 1, -1 },   // 便
+    { 0x6cd5, 8640, 1, -1 },   // 法
+    { 0x820d, 0, 0, 3397 },   // 舍
+    { 0x5f81, 8641, 1, -1 },   // 征
+    { 0x6ce8, 0, 0, 3399 },   // 注
+    { 0x6e38, 0, 0, 3400 },   // 游
+    { 0x56de, 0, 0, 3401 },   // 回
+    { 0x677e, 0, 0, 3402 },   // 松
+    { 0x91cc, 0, 0, 3403 },   // 里
+    { 0x4e1a, 8642, 1, -1 },   // 业
+    { 0x4f59, 0, 0, 3406 },   // 余
+    { 0x5f81, 8643, 1, -1 },   // 征
+    { 0x6881, 8644, 1, -1 },   // 梁
+    { 0x5386, 8645, 1, 3409 },   // 历
+    { 0x5fc3, 8646, 1, -1 },   // 心
+    { 0x5fd7, 0, 0, 3412 },   // 志
+    { 0x91cc, 0, 0, 3413 },   // 里
+    { 0x5386, 8647, 1, 3415 },   // 历
+    { 0x6e38, 0, 0, 3417 },   // 游
+    { 0x8868, 0, 0, 3418 },   // 表
+    { 0x949f, 8648, 1, 3419 },   // 钟
+    { 0x5e72, 0, 0, 3421 },   // 干
+    { 0x949f, 0, 0, 3423 },   // 钟
+    { 0x95f4, 8649, 1, -1 },   // 间
+    { 0x4ed1, 0, 0, 3426 },   // 仑
+    { 0x5188, 0, 0, 3427 },   // 冈
+    { 0x5267, 0, 0, 3428 },   // 剧
+    { 0x5c71, 0, 0, 3429 },   // 山
+    { 0x5d5b, 0, 0, 3430 },   // 嵛
+    { 0x627f, 8650, 1, -1 },   // 承
+    { 0x66f2, 0, 0, 3432 },   // 曲
+    { 0x8154, 0, 0, 3433 },   // 腔
+    { 0x82cf, 0, 0, 3434 },   // 苏
+    { 0x8c03, 0, 0, 3435 },   // 调
+    { 0x5929, 8651, 1, -1 },   // 天
+    { 0x5f81, 0, 0, 3437 },   // 征
+    { 0x76ee, 8652, 1, -1 },   // 目
+    { 0x7a97, 8653, 1, -1 },   // 窗
+    { 0x8303, 0, 0, 3440 },   // 范
+    { 0x9274, 0, 0, 3441 },   // 鉴
+    { 0x5386, 8654, 1, 3443 },   // 历
+    { 0x671f, 8655, 1, -1 },   // 期
+    { 0x9732, 8656, 1, -1 },   // 露
+    { 0x6e38, 0, 0, 3447 },   // 游
+    { 0x9999, 8657, 1, -1 },   // 香
+    { 0x53d1, 8658, 1, -1 },   // 发
+    { 0x79f0, 0, 0, 3450 },   // 称
+    { 0x793a, 8659, 2, -1 },   // 示
+    { 0x8361, 0, 0, 3463 },   // 荡
+    { 0x5e72, 0, 0, 3466 },   // 干
+    { 0x8c37, 0, 0, 3467 },   // 谷
+    { 0x949f, 0, 0, 3472 },   // 钟
+    { 0x53d1, 0, 0, 3473 },   // 发
+    { 0x949f, 0, 0, 3474 },   // 钟
+    { 0x549a, 8661, 1, -1 },   // 咚
+    { 0x5e72, 0, 0, 3476 },   // 干
+    { 0x5730, 8662, 1, -1 },   // 地
+    { 0x6597, 0, 0, 3479 },   // 斗
+    { 0x6c9f, 8663, 1, -1 },   // 沟
+    { 0x91cc, 0, 0, 3481 },   // 里
+    { 0x655b, 8664, 1, -1 },   // 敛
+    { 0x5c18, 0, 0, 3484 },   // 尘
+    { 0x6af1, 0, 0, 3485 },   // 櫱
+    { 0x79c0, 8665, 1, -1 },   // 秀
+    { 0x8f66, 0, 0, 3487 },   // 车
+    { 0x9053, 8666, 1, -1 },   // 道
+    { 0x94b1, 0, 0, 3489 },   // 钱
+    { 0x9709, 0, 0, 3490 },   // 霉
+    { 0x4ec6, 8667, 1, -1 },   // 仆
+    { 0x7b7e, 0, 0, 3492 },   // 签
+    { 0x949f, 0, 0, 3493 },   // 钟
+    { 0x6734, 0, 0, 3494 },   // 朴
+    { 0x5386, 8668, 1, 3495 },   // 历
+    { 0x7403, 8669, 1, -1 },   // 球
+    { 0x91cc, 8670, 1, -1 },   // 里
+    { 0x4e8b, 8671, 1, -1 },   // 事
+    { 0x4ec6, 0, 0, 3500 },   // 仆
+    { 0x4f59, 0, 0, 3501 },   // 余
+    { 0x51c6, 0, 0, 3502 },   // 准
+    { 0x53d1, 8672, 1, -1 },   // 发
+    { 0x53ea, 8673, 1, 3504 },   // 只
+    { 0x56de, 8674, 1, -1 },   // 回
+    { 0x591f, 8675, 1, -1 },   // 够
+    { 0x5f81, 8676, 2, 3508 },   // 征
+    { 0x68f1, 8678, 1, -1 },   // 棱
+    { 0x949f, 0, 0, 3512 },   // 钟
+    { 0x9c9c, 8679, 1, -1 },   // 鲜
+    { 0x80e7, 0, 0, 3514 },   // 胧
+    { 0x5076, 8680, 1, -1 },   // 偶
+    { 0x5236, 0, 0, 3516 },   // 制
+    { 0x6750, 8681, 1, -1 },   // 材
+    { 0x6881, 0, 0, 3518 },   // 梁
+    { 0x7b7e, 0, 0, 3519 },   // 签
+    { 0x949f, 0, 0, 3520 },   // 钟
+    { 0x5e72, 8682, 1, 3521 },   // 干
+    { 0x51fa, 8683, 1, -1 },   // 出
+    { 0x5f81, 0, 0, 3524 },   // 征
+    { 0x864e, 8684, 1, -1 },   // 虎
+    { 0x8d64, 0, 0, 3527 },   // 赤
+    { 0x5e86, 8685, 1, -1 },   // 庆
+    { 0x7406, 8686, 1, -1 },   // 理
+    { 0x7802, 0, 0, 3531 },   // 砂
+    { 0x4fee, 8687, 1, -1 },   // 修
+    { 0x539a, 0, 0, 3533 },   // 厚
+    { 0x5b66, 0, 0, 3534 },   // 学
+    { 0x5b9e, 0, 0, 3535 },   // 实
+    { 0x5ff5, 8688, 1, -1 },   // 念
+    { 0x62d9, 0, 0, 3537 },   // 拙
+    { 0x6a15, 0, 0, 3538 },   // 樕
+    { 0x7236, 0, 0, 3539 },   // 父
+    { 0x76f4, 0, 0, 3540 },   // 直
+    { 0x7d20, 0, 0, 3541 },   // 素
+    { 0x8bb7, 0, 0, 3542 },   // 讷
+    { 0x8d28, 0, 0, 3543 },   // 质
+    { 0x9119, 0, 0, 3544 },   // 鄙
+    { 0x91cd, 0, 0, 3545 },   // 重
+    { 0x91ce, 0, 0, 3546 },   // 野
+    { 0x949d, 0, 0, 3547 },   // 钝
+    { 0x964b, 0, 0, 3548 },   // 陋
+    { 0x9a6c, 0, 0, 3549 },   // 马
+    { 0x9c81, 0, 0, 3550 },   // 鲁
+    { 0x68b0, 8689, 3, -1 },   // 械
+    { 0x5408, 8692, 1, -1 },   // 合
+    { 0x5fd7, 0, 0, 3559 },   // 志
+    { 0x9762, 0, 0, 3560 },   // 面
+    { 0x67aa, 0, 0, 3562 },   // 枪
+    { 0x79e4, 0, 0, 3563 },   // 秤
+    { 0x83cc, 0, 0, 3564 },   // 菌
+    { 0x8fde, 8693, 1, -1 },   // 连
+    { 0x5e72, 0, 0, 3566 },   // 干
+    { 0x843d, 8694, 1, -1 },   // 落
+    { 0x91cc, 8695, 2, -1 },   // 里
+    { 0x742a, 8697, 1, -1 },   // 琪
+    { 0x8001, 8698, 1, -1 },   // 老
+    { 0x5b8b, 8699, 1, -1 },   // 宋
+    { 0x53d1, 0, 0, 3573 },   // 发
+    { 0x6746, 0, 0, 3575 },   // 杆
+    { 0x6bc2, 0, 0, 3576 },   // 毂
+    { 0x6587, 8700, 1, -1 },   // 文
+    { 0x96c5, 8701, 1, -1 },   // 雅
+    { 0x5e72, 0, 0, 3583 },   // 干
+    { 0x9762, 0, 0, 3584 },   // 面
+    { 0x4f26, 0, 0, 3586 },   // 伦
+    { 0x5a01, 8702, 1, -1 },   // 威
+    { 0x4e00, 8703, 1, -1 },   // 一
+    { 0x4e86, 0, 0, 3589 },   // 了
+    { 0x4e9b, 0, 0, 3590 },   // 些
+    { 0x5143, 8704, 1, -1 },   // 元
+    { 0x52a8, 0, 0, 3592 },   // 动
+    { 0x52b2, 0, 0, 3593 },   // 劲
+    { 0x5316, 0, 0, 3594 },   // 化
+    { 0x53e3, 8705, 1, 3595 },   // 口
+    { 0x5589, 0, 0, 3597 },   // 喉
+    { 0x571f, 0, 0, 3598 },   // 土
+    { 0x5bbd, 0, 0, 3599 },   // 宽
+    { 0x5f00, 0, 0, 3600 },   // 开
+    { 0x5f1b, 0, 0, 3601 },   // 弛
+    { 0x5feb, 0, 0, 3602 },   // 快
+    { 0x61c8, 0, 0, 3603 },   // 懈
+    { 0x624b, 0, 0, 3604 },   // 手
+    { 0x6389, 0, 0, 3605 },   // 掉
+    { 0x6563, 0, 0, 3606 },   // 散
+    { 0x677e, 8706, 1, -1 },   // 松
+    { 0x67d4, 0, 0, 3608 },   // 柔
+    { 0x6c14, 0, 0, 3609 },   // 气
+    { 0x6d6e, 0, 0, 3610 },   // 浮
+    { 0x6eaa, 8707, 1, -1 },   // 溪
+    { 0x7d27, 0, 0, 3612 },   // 紧
+    { 0x7ed1, 0, 0, 3613 },   // 绑
+    { 0x7f13, 0, 0, 3614 },   // 缓
+    { 0x8026, 8708, 1, -1 },   // 耦
+    { 0x8106, 0, 0, 3616 },   // 脆
+    { 0x8131, 0, 0, 3617 },   // 脱
+    { 0x86cb, 0, 0, 3618 },   // 蛋
+    { 0x8f6f, 0, 0, 3619 },   // 软
+    { 0x901a, 0, 0, 3620 },   // 通
+    { 0x997c, 0, 0, 3621 },   // 饼
+    { 0x8361, 0, 0, 3622 },   // 荡
+    { 0x5b8f, 8709, 1, -1 },   // 宏
+    { 0x949f, 0, 0, 3626 },   // 钟
+    { 0x9e45, 8710, 1, -1 },   // 鹅
+    { 0x5b50, 8711, 1, -1 },   // 子
+    { 0x5e72, 0, 0, 3629 },   // 干
+    { 0x7d2f, 8712, 1, -1 },   // 累
+    { 0x5e72, 0, 0, 3631 },   // 干
+    { 0x6746, 0, 0, 3638 },   // 杆
+    { 0x5e72, 0, 0, 3641 },   // 干
+    { 0x949f, 0, 0, 3642 },   // 钟
+    { 0x53ea, 0, 0, 3643 },   // 只
+    { 0x53d1, 8713, 1, 3644 },   // 发
+    { 0x53f0, 0, 0, 3647 },   // 台
+    { 0x91cc, 0, 0, 3648 },   // 里
+    { 0x5c01, 8714, 1, -1 },   // 封
+    { 0x6881, 0, 0, 3651 },   // 梁
+    { 0x8bd2, 8715, 1, -1 },   // 诒
+    { 0x51c6, 0, 0, 3657 },   // 准
+    { 0x5fd7, 0, 0, 3658 },   // 志
+    { 0x6807, 8716, 1, -1 },   // 标
+    { 0x6ce8, 0, 0, 3660 },   // 注
+    { 0x7b7e, 0, 0, 3661 },   // 签
+    { 0x81f4, 0, 0, 3662 },   // 致
+    { 0x53d1, 8717, 1, -1 },   // 发
+    { 0x6881, 0, 0, 3668 },   // 梁
+    { 0x5e72, 0, 0, 3673 },   // 干
+    { 0x6797, 8718, 1, -1 },   // 林
+    { 0x6881, 0, 0, 3675 },   // 梁
+    { 0x51bd, 0, 0, 3677 },   // 冽
+    { 0x6817, 0, 0, 3678 },   // 栗
+    { 0x51c6, 0, 0, 3679 },   // 准
+    { 0x8303, 0, 0, 3681 },   // 范
+    { 0x6597, 0, 0, 3682 },   // 斗
+    { 0x8303, 0, 0, 3683 },   // 范
+    { 0x91cc, 8719, 2, -1 },   // 里
+    { 0x5706, 8721, 1, -1 },   // 圆
+    { 0x91cc, 0, 0, 3688 },   // 里
+    { 0x5386, 8722, 1, 3689 },   // 历
+    { 0x6e38, 0, 0, 3691 },   // 游
+    { 0x5e72, 0, 0, 3692 },   // 干
+    { 0x5e72, 0, 0, 3696 },   // 干
+    { 0x6881, 0, 0, 3700 },   // 梁
+    { 0x4e0a, 0, 0, 3705 },   // 上
+    { 0x542f, 8723, 1, -1 },   // 启
+    { 0x67f1, 0, 0, 3707 },   // 柱
+    { 0x6e38, 0, 0, 3709 },   // 游
+    { 0x91cc, 0, 0, 3710 },   // 里
+    { 0x5e72, 0, 0, 3711 },   // 干
+    { 0x51b2, 0, 0, 3712 },   // 冲
+    { 0x6597, 0, 0, 3713 },   // 斗
+    { 0x7cfb, 0, 0, 3714 },   // 系
+    { 0x5236, 0, 0, 3718 },   // 制
+    { 0x91cc, 0, 0, 3719 },   // 里
+    { 0x5b50, 8724, 1, -1 },   // 子
+    { 0x6734, 0, 0, 3721 },   // 朴
+    { 0x6797, 8725, 1, -1 },   // 林
+    { 0x4f53, 0, 0, 3723 },   // 体
+    { 0x53f0, 0, 0, 3724 },   // 台
+    { 0x5b50, 0, 0, 3725 },   // 子
+    { 0x5c42, 0, 0, 3726 },   // 层
+    { 0x67f1, 0, 0, 3727 },   // 柱
+    { 0x68f1, 0, 0, 3728 },   // 棱
+    { 0x767b, 0, 0, 3729 },   // 登
+    { 0x7b49, 8726, 1, -1 },   // 等
+    { 0x7ebf, 0, 0, 3731 },   // 线
+    { 0x7f1d, 0, 0, 3732 },   // 缝
+    { 0x89d2, 0, 0, 3733 },   // 角
+    { 0x9525, 0, 0, 3734 },   // 锥
+    { 0x955c, 0, 0, 3735 },   // 镜
+    { 0x6750, 8727, 1, -1 },   // 材
+    { 0x53d1, 0, 0, 3738 },   // 发
+    { 0x9762, 0, 0, 3739 },   // 面
+    { 0x67a3, 8728, 1, -1 },   // 枣
+    { 0x5e72, 0, 0, 3751 },   // 干
+    { 0x5236, 0, 0, 3755 },   // 制
+    { 0x68f1, 0, 0, 3756 },   // 棱
+    { 0x8303, 8729, 1, 3757 },   // 范
+    { 0x51b2, 0, 0, 3760 },   // 冲
+    { 0x5cf0, 8730, 1, -1 },   // 峰
+    { 0x5f81, 8731, 1, -1 },   // 征
+    { 0x6881, 0, 0, 3763 },   // 梁
+    { 0x91c7, 0, 0, 3766 },   // 采
+    { 0x6e38, 0, 0, 3775 },   // 游
+    { 0x4ee4, 8732, 1, -1 },   // 令
+    { 0x58d1, 8733, 1, -1 },   // 壑
+    { 0x5ff5, 0, 0, 3778 },   // 念
+    { 0x6d77, 8734, 1, 3779 },   // 海
+    { 0x706b, 0, 0, 3781 },   // 火
+    { 0x969c, 0, 0, 3782 },   // 障
+    { 0x8499, 0, 0, 3783 },   // 蒙
+    { 0x949f, 0, 0, 3784 },   // 钟
+    { 0x6587, 8735, 1, -1 },   // 文
+    { 0x6597, 0, 0, 3786 },   // 斗
+    { 0x6597, 0, 0, 3787 },   // 斗
+    { 0x91cc, 8736, 2, -1 },   // 里
+    { 0x4f59, 0, 0, 3794 },   // 余
+    { 0x80b4, 0, 0, 3795 },   // 肴
+    { 0x8c37, 0, 0, 3798 },   // 谷
+    { 0x6597, 0, 0, 3802 },   // 斗
+    { 0x5e08, 8738, 1, -1 },   // 师
+    { 0x9274, 0, 0, 3804 },   // 鉴
+    { 0x91cc, 0, 0, 3805 },   // 里
+    { 0x949f, 8739, 1, -1 },   // 钟
+    { 0x949f, 8740, 1, -1 },   // 钟
+    { 0x4e11, 0, 0, 3810 },   // 丑
+    { 0x8303, 0, 0, 3811 },   // 范
+    { 0x53ea, 0, 0, 3812 },   // 只
+    { 0x751f, 8741, 1, -1 },   // 生
+    { 0x53d1, 0, 0, 3816 },   // 发
+    { 0x59dc, 0, 0, 3817 },   // 姜
+    { 0x5398, 0, 0, 3819 },   // 厘
+    { 0x53d1, 0, 0, 3820 },   // 发
+    { 0x51b2, 8742, 1, -1 },   // 冲
+    { 0x90c1, 0, 0, 3825 },   // 郁
+    { 0x90c1, 0, 0, 3827 },   // 郁
+    { 0x51c6, 0, 0, 3830 },   // 准
+    { 0x5e76, 8743, 1, -1 },   // 并
+    { 0x6765, 8744, 1, -1 },   // 来
+    { 0x8868, 0, 0, 3833 },   // 表
+    { 0x91cc, 0, 0, 3834 },   // 里
+    { 0x5386, 8745, 1, 3835 },   // 历
+    { 0x5fd7, 8746, 1, -1 },   // 志
+    { 0x77e5, 8747, 1, -1 },   // 知
+    { 0x7b7e, 0, 0, 3839 },   // 签
+    { 0x520a, 0, 0, 3841 },   // 刊
+    { 0x7b97, 0, 0, 3842 },   // 算
+    { 0x7e82, 0, 0, 3843 },   // 纂
+    { 0x8f91, 0, 0, 3844 },   // 辑
+    { 0x5f25, 8748, 1, -1 },   // 弥
+    { 0x5e76, 8749, 1, -1 },   // 并
+    { 0x91cc, 0, 0, 3848 },   // 里
+    { 0x8511, 0, 0, 3849 },   // 蔑
+    { 0x4e0b, 8750, 1, -1 },   // 下
+    { 0x5364, 0, 0, 3852 },   // 卤
+    { 0x56e2, 0, 0, 3853 },   // 团
+    { 0x9762, 0, 0, 3854 },   // 面
+    { 0x6d8c, 0, 0, 3856 },   // 涌
+    { 0x4e39, 8751, 4, -1 },   // 丹
+    { 0x5317, 0, 0, 3861 },   // 北
+    { 0x5409, 0, 0, 3862 },   // 吉
+    { 0x5927, 8755, 3, -1 },   // 大
+    { 0x5c71, 8758, 2, -1 },   // 山
+    { 0x5dde, 0, 0, 3868 },   // 州
+    { 0x629a, 0, 0, 3869 },   // 抚
+    { 0x6c34, 0, 0, 3870 },   // 水
+    { 0x6cb3, 0, 0, 3871 },   // 河
+    { 0x6d77, 8760, 2, -1 },   // 海
+    { 0x6dc0, 0, 0, 3874 },   // 淀
+    { 0x90c1, 0, 0, 3875 },   // 郁
+    { 0x9633, 0, 0, 3876 },   // 阳
+    { 0x6dc0, 0, 0, 3877 },   // 淀
+    { 0x90c1, 0, 0, 3878 },   // 郁
+    { 0x7405, 0, 0, 3879 },   // 琅
+    { 0x91cc, 8762, 1, -1 },   // 里
+    { 0x8c37, 0, 0, 3882 },   // 谷
+    { 0x4e8b, 8763, 1, -1 },   // 事
+    { 0x51c6, 0, 0, 3885 },   // 准
+    { 0x5e72, 8764, 1, 3886 },   // 干
+    { 0x6298, 8765, 1, -1 },   // 折
+    { 0x6837, 8766, 1, -1 },   // 样
+    { 0x90c1, 0, 0, 3892 },   // 郁
+    { 0x5e72, 0, 0, 3894 },   // 干
+    { 0x5cb3, 0, 0, 3899 },   // 岳
+    { 0x91cc, 0, 0, 3900 },   // 里
+    { 0x6597, 0, 0, 3901 },   // 斗
+    { 0x6cfc, 8767, 1, -1 },   // 泼
+    { 0x9762, 0, 0, 3903 },   // 面
+    { 0x6108, 0, 0, 3904 },   // 愈
+    { 0x5316, 0, 0, 3905 },   // 化
+    { 0x76ca, 0, 0, 3906 },   // 益
+    { 0x6eaf, 0, 0, 3907 },   // 溯
+    { 0x6b32, 0, 0, 3908 },   // 欲
+    { 0x6e38, 0, 0, 3909 },   // 游
+    { 0x5236, 0, 0, 3911 },   // 制
+    { 0x9762, 0, 0, 3912 },   // 面
+    { 0x53d1, 8768, 1, -1 },   // 发
+    { 0x68f1, 8769, 1, -1 },   // 棱
+    { 0x4e0a, 0, 0, 3915 },   // 上
+    { 0x518c, 0, 0, 3916 },   // 册
+    { 0x5931, 0, 0, 3917 },   // 失
+    { 0x5b9a, 0, 0, 3918 },   // 定
+    { 0x660e, 0, 0, 3919 },   // 明
+    { 0x6807, 0, 0, 3920 },   // 标
+    { 0x751f, 8770, 1, -1 },   // 生
+    { 0x758f, 0, 0, 3922 },   // 疏
+    { 0x811a, 0, 0, 3923 },   // 脚
+    { 0x89e3, 0, 0, 3924 },   // 解
+    { 0x8bb0, 0, 0, 3925 },   // 记
+    { 0x8bd1, 0, 0, 3926 },   // 译
+    { 0x91ca, 0, 0, 3927 },   // 释
+    { 0x91cc, 0, 0, 3928 },   // 里
+    { 0x9500, 0, 0, 3929 },   // 销
+    { 0x5982, 8771, 1, -1 },   // 如
+    { 0x5e72, 0, 0, 3932 },   // 干
+    { 0x90c1, 0, 0, 3933 },   // 郁
+    { 0x6c14, 8772, 1, -1 },   // 气
+    { 0x53d1, 0, 0, 3945 },   // 发
+    { 0x70bc, 0, 0, 3946 },   // 炼
+    { 0x7ec3, 0, 0, 3947 },   // 练
+    { 0x949f, 8773, 1, -1 },   // 钟
+    { 0x91cc, 8774, 1, 3949 },   // 里
+    { 0x8303, 0, 0, 3951 },   // 范
+    { 0x949f, 0, 0, 3952 },   // 钟
+    { 0x5f81, 0, 0, 3954 },   // 征
+    { 0x8361, 0, 0, 3955 },   // 荡
+    { 0x98ce, 8775, 1, -1 },   // 风
+    { 0x6dc0, 0, 0, 3960 },   // 淀
+    { 0x4e0d, 8776, 1, -1 },   // 不
+    { 0x4e2a, 0, 0, 3971 },   // 个
+    { 0x6734, 0, 0, 3972 },   // 朴
+    { 0x53d1, 0, 0, 3975 },   // 发
+    { 0x53bf, 0, 0, 3977 },   // 县
+    { 0x5dde, 0, 0, 3978 },   // 州
+    { 0x6d69, 8777, 1, -1 },   // 浩
+    { 0x8361, 0, 0, 3980 },   // 荡
+    { 0x6e38, 0, 0, 3981 },   // 游
+    { 0x8361, 0, 0, 3982 },   // 荡
+    { 0x5938, 0, 0, 3983 },   // 夸
+    { 0x677e, 0, 0, 3984 },   // 松
+    { 0x8361, 0, 0, 3985 },   // 荡
+    { 0x5e72, 0, 0, 3986 },   // 干
+    { 0x6dc0, 8778, 1, -1 },   // 淀
+    { 0x5364, 0, 0, 3988 },   // 卤
+    { 0x58ee, 8779, 1, -1 },   // 壮
+    { 0x5c14, 8780, 1, -1 },   // 尔
+    { 0x654f, 8781, 1, -1 },   // 敏
+    { 0x6cfd, 8782, 1, -1 },   // 泽
+    { 0x7ecd, 8783, 1, -1 },   // 绍
+    { 0x8c28, 8784, 1, -1 },   // 谨
+    { 0x957f, 8785, 1, -1 },   // 长
+    { 0x9e3f, 8786, 1, -1 },   // 鸿
+    { 0x4e0a, 0, 0, 3998 },   // 上
+    { 0x5165, 0, 0, 3999 },   // 入
+    { 0x51fa, 0, 0, 4000 },   // 出
+    { 0x5411, 0, 0, 4001 },   // 向
+    { 0x6765, 0, 0, 4002 },   // 来
+    { 0x6c34, 0, 0, 4003 },   // 水
+    { 0x6cc9, 0, 0, 4004 },   // 泉
+    { 0x73b0, 0, 0, 4005 },   // 现
+    { 0x8d77, 0, 0, 4006 },   // 起
+    { 0x8fdb, 0, 0, 4007 },   // 进
+    { 0x8c37, 8787, 1, -1 },   // 谷
+    { 0x8499, 0, 0, 4021 },   // 蒙
+    { 0x5e72, 0, 0, 4022 },   // 干
+    { 0x4e43, 8788, 1, -1 },   // 乃
+    { 0x5317, 8789, 1, -1 },   // 北
+    { 0x5c71, 0, 0, 4025 },   // 山
+    { 0x6dc0, 0, 0, 4026 },   // 淀
+    { 0x79ef, 0, 0, 4027 },   // 积
+    { 0x7c89, 0, 0, 4028 },   // 粉
+    { 0x89e3, 8790, 1, -1 },   // 解
+    { 0x8c13, 8791, 1, -1 },   // 谓
+    { 0x4f59, 8792, 1, -1 },   // 余
+    { 0x8303, 0, 0, 4032 },   // 范
+    { 0x8499, 8793, 1, -1 },   // 蒙
+    { 0x6b32, 0, 0, 4034 },   // 欲
+    { 0x8361, 0, 0, 4035 },   // 荡
+    { 0x70bc, 0, 0, 4036 },   // 炼
+    { 0x5c71, 8794, 2, -1 },   // 山
+    { 0x6734, 0, 0, 4039 },   // 朴
+    { 0x6df3, 8796, 1, -1 },   // 淳
+    { 0x91cc, 0, 0, 4042 },   // 里
+    { 0x6f13, 0, 0, 4051 },   // 漓
+    { 0x51b2, 0, 0, 4052 },   // 冲
+    { 0x6d1b, 8797, 1, -1 },   // 洛
+    { 0x5236, 0, 0, 4055 },   // 制
+    { 0x4e1d, 0, 0, 4056 },   // 丝
+    { 0x4e50, 0, 0, 4057 },   // 乐
+    { 0x4e86, 0, 0, 4058 },   // 了
+    { 0x4eba, 0, 0, 4059 },   // 人
+    { 0x4ed9, 0, 0, 4060 },   // 仙
+    { 0x4f34, 0, 0, 4061 },   // 伴
+    { 0x4fa0, 0, 0, 4062 },   // 侠
+    { 0x5174, 0, 0, 4063 },   // 兴
+    { 0x51b6, 0, 0, 4064 },   // 冶
+    { 0x5203, 0, 0, 4065 },   // 刃
+    { 0x52a8, 0, 0, 4066 },   // 动
+    { 0x5386, 0, 0, 4067 },   // 历
+    { 0x56ed, 0, 0, 4068 },   // 园
+    { 0x5b50, 0, 0, 4069 },   // 子
+    { 0x5b66, 0, 0, 4070 },   // 学
+    { 0x5ba2, 0, 0, 4071 },   // 客
+    { 0x5ba6, 0, 0, 4072 },   // 宦
+    { 0x5c71, 8798, 1, -1 },   // 山
+    { 0x5eca, 0, 0, 4074 },   // 廊
+    { 0x5fc5, 8799, 1, -1 },   // 必
+    { 0x61a9, 0, 0, 4076 },   // 憩
+    { 0x620f, 8800, 1, 4077 },   // 戏
+    { 0x624b, 8801, 1, -1 },   // 手
+    { 0x65b9, 0, 0, 4080 },   // 方
+    { 0x661f, 0, 0, 4081 },   // 星
+    { 0x6625, 0, 0, 4082 },   // 春
+    { 0x6807, 8802, 1, -1 },   // 标
+    { 0x6c11, 0, 0, 4084 },   // 民
+    { 0x6cb3, 0, 0, 4085 },   // 河
+    { 0x7267, 0, 0, 4086 },   // 牧
+    { 0x730e, 0, 0, 4087 },   // 猎
+    { 0x73a9, 0, 0, 4088 },   // 玩
+    { 0x76ee, 8803, 1, -1 },   // 目
+    { 0x79bb, 0, 0, 4090 },   // 离
+    { 0x7a0b, 0, 0, 4091 },   // 程
+    { 0x7f8e, 8804, 1, -1 },   // 美
+    { 0x8239, 0, 0, 4093 },   // 船
+    { 0x8247, 0, 0, 4094 },   // 艇
+    { 0x827a, 0, 0, 4095 },   // 艺
+    { 0x8361, 0, 0, 4096 },   // 荡
+    { 0x884c, 0, 0, 4097 },   // 行
+    { 0x8857, 0, 0, 4098 },   // 街
+    { 0x89c8, 0, 0, 4099 },   // 览
+    { 0x8bb0, 0, 0, 4100 },   // 记
+    { 0x8bf4, 0, 0, 4101 },   // 说
+    { 0x8d44, 0, 0, 4102 },   // 资
+    { 0x8d70, 0, 0, 4103 },   // 走
+    { 0x8e2a, 0, 0, 4104 },   // 踪
+    { 0x8f6e, 0, 0, 4105 },   // 轮
+    { 0x901b, 0, 0, 4106 },   // 逛
+    { 0x9519, 0, 0, 4107 },   // 错
+    { 0x9a91, 8805, 1, -1 },   // 骑
+    { 0x9b42, 0, 0, 4109 },   // 魂
+    { 0x91cc, 0, 0, 4110 },   // 里
+    { 0x7d2f, 0, 0, 4111 },   // 累
+    { 0x90c1, 0, 0, 4112 },   // 郁
+    { 0x8499, 0, 0, 4118 },   // 蒙
+    { 0x9762, 0, 0, 4119 },   // 面
+    { 0x90c1, 0, 0, 4120 },   // 郁
+    { 0x501f, 0, 0, 4121 },   // 借
+    { 0x5934, 8806, 1, -1 },   // 头
+    { 0x6ee1, 8807, 1, -1 },   // 满
+    { 0x7530, 8808, 1, -1 },   // 田
+    { 0x5e2d, 0, 0, 4137 },   // 席
+    { 0x6d82, 0, 0, 4138 },   // 涂
+    { 0x8361, 0, 0, 4139 },   // 荡
+    { 0x6c34, 0, 0, 4140 },   // 水
+    { 0x6c5f, 0, 0, 4141 },   // 江
+    { 0x6e58, 0, 0, 4142 },   // 湘
+    { 0x7136, 0, 0, 4143 },   // 然
+    { 0x633d, 0, 0, 4144 },   // 挽
+    { 0x91cc, 0, 0, 4145 },   // 里
+    { 0x5377, 0, 0, 4147 },   // 卷
+    { 0x6e38, 0, 0, 4148 },   // 游
+    { 0x610f, 8809, 1, -1 },   // 意
+    { 0x6c34, 8810, 2, -1 },   // 水
+    { 0x91cc, 0, 0, 4158 },   // 里
+    { 0x6d8c, 0, 0, 4159 },   // 涌
+    { 0x6c5f, 8812, 1, -1 },   // 江
+    { 0x8499, 0, 0, 4162 },   // 蒙
+    { 0x53f0, 0, 0, 4164 },   // 台
+    { 0x8361, 0, 0, 4165 },   // 荡
+    { 0x6597, 0, 0, 4166 },   // 斗
+    { 0x5c71, 8813, 1, -1 },   // 山
+    { 0x5e76, 8814, 1, 4171 },   // 并
+    { 0x6298, 8815, 1, -1 },   // 折
+    { 0x7b7e, 0, 0, 4174 },   // 签
+    { 0x8499, 8816, 1, 4177 },   // 蒙
+    { 0x6606, 0, 0, 4180 },   // 昆
+    { 0x9762, 0, 0, 4184 },   // 面
+    { 0x9762, 0, 0, 4186 },   // 面
+    { 0x5236, 0, 0, 4188 },   // 制
+    { 0x5236, 0, 0, 4191 },   // 制
+    { 0x9171, 8817, 1, -1 },   // 酱
+    { 0x4e2a, 8818, 1, -1 },   // 个
+    { 0x534a, 8819, 1, -1 },   // 半
+    { 0x591a, 8820, 1, -1 },   // 多
+    { 0x672d, 0, 0, 4197 },   // 札
+    { 0x8d5e, 0, 0, 4198 },   // 赞
+    { 0x91cc, 8821, 1, 4199 },   // 里
+    { 0x949f, 0, 0, 4201 },   // 钟
+    { 0x51b6, 0, 0, 4203 },   // 冶
+    { 0x5236, 0, 0, 4204 },   // 制
+    { 0x53e5, 0, 0, 4205 },   // 句
+    { 0x5b57, 0, 0, 4206 },   // 字
+    { 0x5e08, 0, 0, 4207 },   // 师
+    { 0x5ea6, 0, 0, 4208 },   // 度
+    { 0x5f62, 0, 0, 4209 },   // 形
+    { 0x6c14, 0, 0, 4210 },   // 气
+    { 0x6c5e, 0, 0, 4211 },   // 汞
+    { 0x77f3, 0, 0, 4212 },   // 石
+    { 0x8d2b, 0, 0, 4213 },   // 贫
+    { 0x91d1, 8822, 1, -1 },   // 金
+    { 0x5236, 0, 0, 4219 },   // 制
+    { 0x5e72, 0, 0, 4220 },   // 干
+    { 0x5377, 0, 0, 4223 },   // 卷
+    { 0x53f0, 0, 0, 4224 },   // 台
+    { 0x5364, 0, 0, 4225 },   // 卤
+    { 0x5e72, 0, 0, 4226 },   // 干
+    { 0x5e72, 0, 0, 4229 },   // 干
+    { 0x9762, 0, 0, 4232 },   // 面
+    { 0x4e00, 8823, 2, -1 },   // 一
+    { 0x4e2a, 8825, 1, -1 },   // 个
+    { 0x53d1, 0, 0, 4237 },   // 发
+    { 0x5b8c, 8826, 1, -1 },   // 完
+    { 0x6b21, 8827, 1, -1 },   // 次
+    { 0x9762, 0, 0, 4240 },   // 面
+    { 0x4f59, 0, 0, 4242 },   // 余
+    { 0x5236, 0, 0, 4244 },   // 制
+    { 0x5e72, 0, 0, 4248 },   // 干
+    { 0x9762, 0, 0, 4249 },   // 面
+    { 0x5165, 8828, 1, -1 },   // 入
+    { 0x76f8, 8829, 1, -1 },   // 相
+    { 0x5e72, 0, 0, 4252 },   // 干
+    { 0x5236, 0, 0, 4253 },   // 制
+    { 0x9762, 0, 0, 4254 },   // 面
+    { 0x4e60, 0, 0, 4255 },   // 习
+    { 0x5fc3, 0, 0, 4256 },   // 心
+    { 0x67d3, 0, 0, 4257 },   // 染
+    { 0x6c90, 0, 0, 4258 },   // 沐
+    { 0x9676, 0, 0, 4259 },   // 陶
+    { 0x98ce, 0, 0, 4260 },   // 风
+    { 0x9999, 0, 0, 4261 },   // 香
+    { 0x5236, 0, 0, 4262 },   // 制
+    { 0x53d1, 0, 0, 4263 },   // 发
+    { 0x6e38, 0, 0, 4264 },   // 游
+    { 0x53d1, 0, 0, 4265 },   // 发
+    { 0x5b9a, 8830, 1, -1 },   // 定
+    { 0x56f0, 0, 0, 4268 },   // 困
+    { 0x6cb3, 8831, 1, -1 },   // 河
+    { 0x8361, 0, 0, 4271 },   // 荡
+    { 0x8a00, 8832, 1, -1 },   // 言
+    { 0x91cc, 0, 0, 4273 },   // 里
+    { 0x56fe, 8833, 1, -1 },   // 图
+    { 0x7b7e, 0, 0, 4276 },   // 签
+    { 0x53ea, 0, 0, 4277 },   // 只
+    { 0x6b32, 0, 0, 4279 },   // 欲
+    { 0x4e00, 8834, 1, -1 },   // 一
+    { 0x7cfb, 0, 0, 4282 },   // 系
+    { 0x5236, 8835, 1, 4283 },   // 制
+    { 0x5f81, 0, 0, 4285 },   // 征
+    { 0x5982, 8836, 2, -1 },   // 如
+    { 0x5e76, 8838, 1, -1 },   // 并
+    { 0x501f, 8839, 1, -1 },   // 借
+    { 0x88c1, 8840, 1, -1 },   // 裁
+    { 0x8f9f, 8841, 1, -1 },   // 辟
+    { 0x91cc, 0, 0, 4306 },   // 里
+    { 0x51b2, 0, 0, 4311 },   // 冲
+    { 0x4e11, 0, 0, 4317 },   // 丑
+    { 0x5386, 8842, 1, 4319 },   // 历
+    { 0x4f59, 8843, 1, -1 },   // 余
+    { 0x9274, 0, 0, 4322 },   // 鉴
+    { 0x6e38, 0, 0, 4327 },   // 游
+    { 0x80b4, 8844, 1, -1 },   // 肴
+    { 0x7405, 0, 0, 4332 },   // 琅
+    { 0x91cc, 0, 0, 4334 },   // 里
+    { 0x53f0, 0, 0, 4336 },   // 台
+    { 0x4e00, 8845, 2, -1 },   // 一
+    { 0x4e2a, 8847, 1, -1 },   // 个
+    { 0x53d1, 0, 0, 4340 },   // 发
+    { 0x5b8c, 8848, 1, -1 },   // 完
+    { 0x6b21, 8849, 1, -1 },   // 次
+    { 0x949f, 0, 0, 4345 },   // 钟
+    { 0x5f81, 0, 0, 4347 },   // 征
+    { 0x7b7e, 0, 0, 4349 },   // 签
+    { 0x5b89, 0, 0, 4353 },   // 安
+    { 0x5236, 0, 0, 4355 },   // 制
+    { 0x54b8, 0, 0, 4356 },   // 咸
+    { 0x6c34, 8850, 1, -1 },   // 水
+    { 0x9762, 8851, 1, -1 },   // 面
+    { 0x529b, 8852, 1, -1 },   // 力
+    { 0x534e, 8853, 1, -1 },   // 华
+    { 0x53d1, 8854, 1, 4361 },   // 发
+    { 0x59dc, 0, 0, 4363 },   // 姜
+    { 0x7269, 8855, 1, -1 },   // 物
+    { 0x9508, 0, 0, 4365 },   // 锈
+    { 0x6cd5, 8856, 1, -1 },   // 法
+    { 0x53d1, 0, 0, 4367 },   // 发
+    { 0x91cc, 0, 0, 4368 },   // 里
+    { 0x80c4, 0, 0, 4369 },   // 胄
+    { 0x51b2, 0, 0, 4371 },   // 冲
+    { 0x5b50, 8857, 3, -1 },   // 子
+    { 0x5f71, 8860, 2, -1 },   // 影
+    { 0x68af, 8862, 1, -1 },   // 梯
+    { 0x6ce2, 8863, 1, -1 },   // 波
+    { 0x7801, 8864, 1, -1 },   // 码
+    { 0x8868, 0, 0, 4381 },   // 表
+    { 0x89c6, 8865, 2, -1 },   // 视
+    { 0x949f, 0, 0, 4384 },   // 钟
+    { 0x4ec6, 0, 0, 4385 },   // 仆
+    { 0x91cc, 0, 0, 4387 },   // 里
+    { 0x6e38, 0, 0, 4389 },   // 游
+    { 0x91cc, 0, 0, 4390 },   // 里
+    { 0x53d1, 8867, 3, 4391 },   // 发
+    { 0x957f, 8870, 1, -1 },   // 长
+    { 0x677e, 0, 0, 4397 },   // 松
+    { 0x51f6, 0, 0, 4398 },   // 凶
+    { 0x7cfb, 0, 0, 4399 },   // 系
+    { 0x56f0, 0, 0, 4409 },   // 困
+    { 0x4f59, 0, 0, 4410 },   // 余
+    { 0x5f81, 0, 0, 4411 },   // 征
+    { 0x6108, 0, 0, 4412 },   // 愈
+    { 0x7ed3, 0, 0, 4413 },   // 结
+    { 0x6108, 0, 0, 4416 },   // 愈
+    { 0x75af, 0, 0, 4422 },   // 疯
+    { 0x75f9, 0, 0, 4423 },   // 痹
+    { 0x51c0, 8871, 1, -1 },   // 净
+    { 0x53d1, 8872, 1, 4435 },   // 发
+    { 0x5e72, 8873, 1, -1 },   // 干
+    { 0x672f, 0, 0, 4438 },   // 术
+    { 0x6734, 0, 0, 4439 },   // 朴
+    { 0x7c89, 8874, 1, -1 },   // 粉
+    { 0x91cc, 8875, 1, -1 },   // 里
+    { 0x9709, 0, 0, 4442 },   // 霉
+    { 0x4e2a, 0, 0, 4443 },   // 个
+    { 0x4f59, 0, 0, 4444 },   // 余
+    { 0x53ea, 8876, 2, 4445 },   // 只
+    { 0x5468, 8878, 1, -1 },   // 周
+    { 0x5929, 8879, 1, -1 },   // 天
+    { 0x624e, 0, 0, 4450 },   // 扎
+    { 0x62d9, 8880, 1, -1 },   // 拙
+    { 0x70bc, 0, 0, 4452 },   // 炼
+    { 0x79d1, 8881, 1, -1 },   // 科
+    { 0x82b1, 8882, 1, -1 },   // 花
+    { 0x8c37, 0, 0, 4456 },   // 谷
+    { 0x4e2a, 8883, 1, -1 },   // 个
+    { 0x53d1, 8884, 1, -1 },   // 发
+    { 0x56de, 8885, 1, -1 },   // 回
+    { 0x56fe, 8886, 1, -1 },   // 图
+    { 0x5c71, 8887, 1, -1 },   // 山
+    { 0x5e72, 8888, 1, -1 },   // 干
+    { 0x949f, 0, 0, 4463 },   // 钟
+    { 0x957f, 8889, 1, -1 },   // 长
+    { 0x51c6, 0, 0, 4465 },   // 准
+    { 0x53ef, 8890, 1, -1 },   // 可
+    { 0x5386, 8891, 1, 4467 },   // 历
+    { 0x6781, 8892, 1, -1 },   // 极
+    { 0x53d1, 0, 0, 4472 },   // 发
+    { 0x5236, 0, 0, 4473 },   // 制
+    { 0x677e, 0, 0, 4474 },   // 松
+    { 0x80a4, 0, 0, 4475 },   // 肤
+    { 0x91cc, 8893, 2, -1 },   // 里
+    { 0x6298, 0, 0, 4479 },   // 折
+    { 0x540a, 0, 0, 4481 },   // 吊
+    { 0x4f59, 0, 0, 4482 },   // 余
+    { 0x4f59, 0, 0, 4485 },   // 余
+    { 0x5364, 0, 0, 4486 },   // 卤
+    { 0x6253, 8895, 1, -1 },   // 打
+    { 0x5236, 0, 0, 4489 },   // 制
+    { 0x91cc, 0, 0, 4490 },   // 里
+    { 0x91c7, 0, 0, 4493 },   // 采
+    { 0x949f, 0, 0, 4494 },   // 钟
+    { 0x56de, 0, 0, 4496 },   // 回
+    { 0x91cc, 0, 0, 4497 },   // 里
+    { 0x8d5e, 0, 0, 4498 },   // 赞
+    { 0x5e72, 0, 0, 4499 },   // 干
+    { 0x51b2, 0, 0, 4500 },   // 冲
+    { 0x514b, 0, 0, 4501 },   // 克
+    { 0x51b2, 0, 0, 4502 },   // 冲
+    { 0x5e76, 0, 0, 4503 },   // 并
+    { 0x6597, 0, 0, 4504 },   // 斗
+    { 0x51c6, 0, 0, 4505 },   // 准
+    { 0x6cd5, 8896, 1, -1 },   // 法
+    { 0x8868, 0, 0, 4507 },   // 表
+    { 0x949f, 0, 0, 4508 },   // 钟
+    { 0x4e11, 0, 0, 4509 },   // 丑
+    { 0x4e2a, 0, 0, 4510 },   // 个
+    { 0x51f6, 0, 0, 4511 },   // 凶
+    { 0x5e72, 0, 0, 4513 },   // 干
+    { 0x7736, 8897, 1, -1 },   // 眶
+    { 0x775b, 8898, 1, -1 },   // 睛
+    { 0x91cc, 0, 0, 4516 },   // 里
+    { 0x6e38, 8899, 1, -1 },   // 游
+    { 0x51c6, 0, 0, 4521 },   // 准
+    { 0x8499, 0, 0, 4522 },   // 蒙
+    { 0x6258, 0, 0, 4525 },   // 托
+    { 0x8499, 0, 0, 4526 },   // 蒙
+    { 0x5938, 0, 0, 4527 },   // 夸
+    { 0x53d1, 8900, 1, 4529 },   // 发
+    { 0x6881, 0, 0, 4531 },   // 梁
+    { 0x82f1, 8901, 1, -1 },   // 英
+    { 0x949f, 0, 0, 4534 },   // 钟
+    { 0x7801, 8902, 1, -1 },   // 码
+    { 0x8868, 8903, 1, 4541 },   // 表
+    { 0x5236, 0, 0, 4543 },   // 制
+    { 0x5f53, 0, 0, 4547 },   // 当
+    { 0x9274, 0, 0, 4548 },   // 鉴
+    { 0x8c37, 0, 0, 4551 },   // 谷
+    { 0x786e, 0, 0, 4557 },   // 确
+    { 0x5e72, 0, 0, 4558 },   // 干
+    { 0x7cfb, 0, 0, 4560 },   // 系
+    { 0x5fd7, 0, 0, 4563 },   // 志
+    { 0x91cc, 0, 0, 4564 },   // 里
+    { 0x949f, 0, 0, 4567 },   // 钟
+    { 0x5236, 0, 0, 4569 },   // 制
+    { 0x5236, 0, 0, 4570 },   // 制
+    { 0x70bc, 0, 0, 4571 },   // 炼
+    { 0x9762, 0, 0, 4572 },   // 面
+    { 0x949f, 0, 0, 4573 },   // 钟
+    { 0x8303, 0, 0, 4574 },   // 范
+    { 0x8d5e, 0, 0, 4576 },   // 赞
+    { 0x91cc, 0, 0, 4577 },   // 里
+    { 0x53d1, 0, 0, 4578 },   // 发
+    { 0x8d5e, 0, 0, 4579 },   // 赞
+    { 0x6e38, 0, 0, 4580 },   // 游
+    { 0x837c, 8904, 1, -1 },   // 荼
+    { 0x96d5, 0, 0, 4582 },   // 雕
+    { 0x540a, 0, 0, 4584 },   // 吊
+    { 0x6b32, 8905, 1, 4589 },   // 欲
+    { 0x8c37, 0, 0, 4594 },   // 谷
+    { 0x53d1, 8906, 8, 4595 },   // 发
+    { 0x4e0b, 8914, 1, -1 },   // 下
+    { 0x6597, 0, 0, 4605 },   // 斗
+    { 0x6b32, 0, 0, 4606 },   // 欲
+    { 0x53d1, 0, 0, 4608 },   // 发
+    { 0x5983, 8915, 1, -1 },   // 妃
+    { 0x5343, 0, 0, 4611 },   // 千
+    { 0x6e38, 0, 0, 4612 },   // 游
+    { 0x5e08, 8916, 2, -1 },   // 师
+    { 0x8c37, 0, 0, 4616 },   // 谷
+    { 0x5c3c, 8918, 1, -1 },   // 尼
+    { 0x8303, 0, 0, 4618 },   // 范
+    { 0x949f, 0, 0, 4619 },   // 钟
+    { 0x6746, 0, 0, 4620 },   // 杆
+    { 0x6c88, 8919, 1, -1 },   // 沈
+    { 0x6dc0, 0, 0, 4623 },   // 淀
+    { 0x8c37, 8920, 1, 4624 },   // 谷
+    { 0x90c1, 0, 0, 4626 },   // 郁
+    { 0x8d5e, 0, 0, 4628 },   // 赞
+    { 0x677e, 0, 0, 4630 },   // 松
+    { 0x5341, 8921, 1, -1 },   // 十
+    { 0x5065, 8922, 1, -1 },   // 健
+    { 0x624e, 0, 0, 4637 },   // 扎
+    { 0x8c37, 0, 0, 4638 },   // 谷
+    { 0x5f81, 0, 0, 4639 },   // 征
+    { 0x68f1, 0, 0, 4640 },   // 棱
+    { 0x7f55, 8923, 1, -1 },   // 罕
+    { 0x53d1, 0, 0, 4645 },   // 发
+    { 0x8ffd, 8924, 1, -1 },   // 追
+    { 0x4f59, 0, 0, 4647 },   // 余
+    { 0x8361, 8925, 1, 4648 },   // 荡
+    { 0x8499, 0, 0, 4650 },   // 蒙
+    { 0x949f, 0, 0, 4651 },   // 钟
+    { 0x949f, 8926, 1, -1 },   // 钟
+    { 0x6b32, 0, 0, 4656 },   // 欲
+    { 0x5e18, 0, 0, 4657 },   // 帘
+    { 0x660e, 8927, 1, -1 },   // 明
+    { 0x91cc, 8928, 1, 4661 },   // 里
+    { 0x8303, 0, 0, 4666 },   // 范
+    { 0x8d77, 8929, 1, -1 },   // 起
+    { 0x6597, 0, 0, 4670 },   // 斗
+    { 0x4ec6, 0, 0, 4671 },   // 仆
+    { 0x5236, 0, 0, 4672 },   // 制
+    { 0x5e2d, 0, 0, 4673 },   // 席
+    { 0x6797, 8930, 1, -1 },   // 林
+    { 0x6eaa, 8931, 1, -1 },   // 溪
+    { 0x7b7e, 0, 0, 4676 },   // 签
+    { 0x5e72, 0, 0, 4679 },   // 干
+    { 0x91cc, 8932, 1, -1 },   // 里
+    { 0x6746, 0, 0, 4682 },   // 杆
+    { 0x79c3, 8933, 1, -1 },   // 秃
+    { 0x540e, 0, 0, 4689 },   // 后
+    { 0x9633, 0, 0, 4690 },   // 阳
+    { 0x590d, 0, 0, 4691 },   // 复
+    { 0x62bc, 0, 0, 4697 },   // 押
+    { 0x6761, 0, 0, 4698 },   // 条
+    { 0x8bd7, 0, 0, 4699 },   // 诗
+    { 0x5e76, 0, 0, 4701 },   // 并
+    { 0x6734, 0, 0, 4702 },   // 朴
+    { 0x77ed, 8934, 1, -1 },   // 短
+    { 0x7b51, 8935, 1, -1 },   // 筑
+    { 0x51c6, 0, 0, 4705 },   // 准
+    { 0x5386, 8936, 1, 4706 },   // 历
+    { 0x5e72, 0, 0, 4708 },   // 干
+    { 0x91cc, 0, 0, 4715 },   // 里
+    { 0x8361, 0, 0, 4721 },   // 荡
+    { 0x4f59, 0, 0, 4723 },   // 余
+    { 0x56e2, 0, 0, 4724 },   // 团
+    { 0x6c88, 0, 0, 4725 },   // 沈
+    { 0x9762, 0, 0, 4726 },   // 面
+    { 0x7b7e, 8937, 1, -1 },   // 签
+    { 0x5236, 0, 0, 4731 },   // 制
+    { 0x79fd, 8938, 1, -1 },   // 秽
+    { 0x51c6, 0, 0, 4738 },   // 准
+    { 0x5236, 0, 0, 4739 },   // 制
+    { 0x5e72, 0, 0, 4740 },   // 干
+    { 0x677e, 0, 0, 4741 },   // 松
+    { 0x81f4, 0, 0, 4742 },   // 致
+    { 0x8f9f, 0, 0, 4743 },   // 辟
+    { 0x91cc, 8939, 1, -1 },   // 里
+    { 0x5e72, 0, 0, 4747 },   // 干
+    { 0x4e0a, 8940, 7, -1 },   // 上
+    { 0x4e3a, 0, 0, 4755 },   // 为
+    { 0x4e8e, 8947, 1, 4756 },   // 于
+    { 0x5217, 8948, 1, -1 },   // 列
+    { 0x5230, 0, 0, 4759 },   // 到
+    { 0x56da, 0, 0, 4760 },   // 囚
+    { 0x5fc3, 0, 0, 4761 },   // 心
+    { 0x5ff5, 0, 0, 4762 },   // 念
+    { 0x6000, 0, 0, 4763 },   // 怀
+    { 0x604b, 0, 0, 4764 },   // 恋
+    { 0x6570, 0, 0, 4765 },   // 数
+    { 0x7740, 0, 0, 4766 },   // 着
+    { 0x7d27, 0, 0, 4767 },   // 紧
+    { 0x7d2f, 0, 0, 4768 },   // 累
+    { 0x7ed3, 0, 0, 4769 },   // 结
+    { 0x7ef3, 0, 0, 4770 },   // 绳
+    { 0x819c, 0, 0, 4771 },   // 膜
+    { 0x821f, 0, 0, 4772 },   // 舟
+    { 0x8239, 0, 0, 4773 },   // 船
+    { 0x8f9e, 0, 0, 4774 },   // 辞
+    { 0x91cc, 0, 0, 4775 },   // 里
+    { 0x978b, 8949, 1, -1 },   // 鞋
+    { 0x98ce, 8950, 1, -1 },   // 风
+    { 0x53d1, 0, 0, 4778 },   // 发
+    { 0x6570, 8951, 1, -1 },   // 数
+    { 0x6734, 0, 0, 4780 },   // 朴
+    { 0x9762, 0, 0, 4781 },   // 面
+    { 0x9762, 0, 0, 4782 },   // 面
+    { 0x9a6c, 8952, 1, -1 },   // 马
+    { 0x81f4, 0, 0, 4785 },   // 致
+    { 0x8ffd, 8953, 1, -1 },   // 追
+    { 0x59dc, 0, 0, 4787 },   // 姜
+    { 0x56da, 0, 0, 4788 },   // 囚
+    { 0x5806, 0, 0, 4789 },   // 堆
+    { 0x74e6, 8954, 1, -1 },   // 瓦
+    { 0x7ec1, 0, 0, 4791 },   // 绁
+    { 0x81e3, 0, 0, 4792 },   // 臣
+    { 0x590d, 0, 0, 4794 },   // 复
+    { 0x949f, 0, 0, 4795 },   // 钟
+    { 0x4f59, 0, 0, 4798 },   // 余
+    { 0x56de, 0, 0, 4799 },   // 回
+    { 0x90c1, 0, 0, 4800 },   // 郁
+    { 0x53d1, 0, 0, 4802 },   // 发
+    { 0x540e, 8955, 1, -1 },   // 后
+    { 0x7ef3, 8956, 1, -1 },   // 绳
+    { 0x949f, 0, 0, 4805 },   // 钟
+    { 0x592b, 0, 0, 4808 },   // 夫
+    { 0x624b, 0, 0, 4809 },   // 手
+    { 0x7ef3, 0, 0, 4810 },   // 绳
+    { 0x5386, 8957, 1, 4817 },   // 历
+    { 0x6734, 0, 0, 4823 },   // 朴
+    { 0x9274, 0, 0, 4827 },   // 鉴
+    { 0x5f81, 0, 0, 4829 },   // 征
+    { 0x6b32, 0, 0, 4831 },   // 欲
+    { 0x624e, 0, 0, 4835 },   // 扎
+    { 0x56fe, 8958, 1, -1 },   // 图
+    { 0x91cc, 0, 0, 4847 },   // 里
+    { 0x4e0d, 8959, 1, -1 },   // 不
+    { 0x5982, 8960, 1, -1 },   // 如
+    { 0x70bc, 0, 0, 4852 },   // 炼
+    { 0x81f4, 0, 0, 4853 },   // 致
+    { 0x6587, 8961, 1, -1 },   // 文
+    { 0x6709, 8962, 1, -1 },   // 有
+    { 0x624e, 0, 0, 4867 },   // 扎
+    { 0x4f19, 0, 0, 4870 },   // 伙
+    { 0x4f34, 8963, 1, -1 },   // 伴
+    { 0x4f59, 0, 0, 4872 },   // 余
+    { 0x53d1, 0, 0, 4873 },   // 发
+    { 0x624e, 0, 0, 4874 },   // 扎
+    { 0x6881, 0, 0, 4876 },   // 梁
+    { 0x5236, 0, 0, 4879 },   // 制
+    { 0x816e, 8964, 1, -1 },   // 腮
+    { 0x5e72, 0, 0, 4887 },   // 干
+    { 0x68f1, 0, 0, 4894 },   // 棱
+    { 0x4f59, 0, 0, 4900 },   // 余
+    { 0x7cfb, 8965, 1, 4910 },   // 系
+    { 0x6252, 8966, 1, -1 },   // 扒
+    { 0x5408, 8967, 1, -1 },   // 合
+    { 0x53d1, 0, 0, 4923 },   // 发
+    { 0x53d1, 0, 0, 4925 },   // 发
+    { 0x51f6, 0, 0, 4936 },   // 凶
+    { 0x51b2, 0, 0, 4945 },   // 冲
+    { 0x5f81, 0, 0, 4946 },   // 征
+    { 0x4f59, 0, 0, 4950 },   // 余
+    { 0x5236, 8968, 1, -1 },   // 制
+    { 0x7801, 8969, 1, -1 },   // 码
+    { 0x91c7, 0, 0, 4953 },   // 采
+    { 0x949f, 0, 0, 4954 },   // 钟
+    { 0x81f4, 0, 0, 4961 },   // 致
+    { 0x5236, 0, 0, 4963 },   // 制
+    { 0x91cc, 0, 0, 4964 },   // 里
+    { 0x6597, 0, 0, 4967 },   // 斗
+    { 0x6817, 0, 0, 4977 },   // 栗
+    { 0x77ed, 8970, 1, -1 },   // 短
+    { 0x5fd7, 0, 0, 4993 },   // 志
+    { 0x6e38, 0, 0, 4994 },   // 游
+    { 0x7403, 8971, 1, -1 },   // 球
+    { 0x7ad9, 8972, 1, -1 },   // 站
+    { 0x91cc, 0, 0, 4997 },   // 里
+    { 0x9a6c, 8973, 1, -1 },   // 马
+    { 0x8a00, 8974, 1, -1 },   // 言
+    { 0x7cfb, 0, 0, 5007 },   // 系
+    { 0x4e11, 0, 0, 5008 },   // 丑
+    { 0x53d1, 8975, 6, -1 },   // 发
+    { 0x5bb9, 8981, 1, -1 },   // 容
+    { 0x4f59, 0, 0, 5018 },   // 余
+    { 0x4e11, 0, 0, 5019 },   // 丑
+    { 0x8f9f, 0, 0, 5020 },   // 辟
+    { 0x6e38, 0, 0, 5022 },   // 游
+    { 0x677e, 0, 0, 5023 },   // 松
+    { 0x6d8c, 0, 0, 5024 },   // 涌
+    { 0x4ec6, 0, 0, 5025 },   // 仆
+    { 0x59dc, 0, 0, 5026 },   // 姜
+    { 0x5e72, 8982, 1, 5027 },   // 干
+    { 0x677f, 0, 0, 5029 },   // 板
+    { 0x7237, 8983, 1, -1 },   // 爷
+    { 0x767d, 8984, 1, -1 },   // 白
+    { 0x5f81, 0, 0, 5032 },   // 征
+    { 0x8bd5, 8985, 1, -1 },   // 试
+    { 0x6597, 0, 0, 5034 },   // 斗
+    { 0x83b7, 0, 0, 5035 },   // 获
+    { 0x4f59, 0, 0, 5037 },   // 余
+    { 0x5f8b, 8986, 1, -1 },   // 律
+    { 0x658b, 8987, 1, -1 },   // 斋
+    { 0x7cfb, 0, 0, 5047 },   // 系
+    { 0x96c7, 0, 0, 5048 },   // 雇
+    { 0x836f, 8988, 1, -1 },   // 药
+    { 0x4e1d, 8989, 1, -1 },   // 丝
+    { 0x5e72, 0, 0, 5054 },   // 干
+    { 0x677e, 0, 0, 5055 },   // 松
+    { 0x6b32, 0, 0, 5056 },   // 欲
+    { 0x7fb9, 8990, 1, -1 },   // 羹
+    { 0x9762, 0, 0, 5058 },   // 面
+    { 0x91cc, 0, 0, 5059 },   // 里
+    { 0x810f, 0, 0, 5060 },   // 脏
+    { 0x90c1, 0, 0, 5061 },   // 郁
+    { 0x810f, 0, 0, 5063 },   // 脏
+    { 0x6817, 0, 0, 5064 },   // 栗
+    { 0x9994, 0, 0, 5068 },   // 馔
+    { 0x810f, 0, 0, 5069 },   // 脏
+    { 0x810f, 0, 0, 5071 },   // 脏
+    { 0x810f, 0, 0, 5075 },   // 脏
+    { 0x91cc, 0, 0, 5076 },   // 里
+    { 0x5730, 8991, 1, -1 },   // 地
+    { 0x53d1, 0, 0, 5079 },   // 发
+    { 0x952e, 0, 0, 5081 },   // 键
+    { 0x5b50, 8992, 1, 5082 },   // 子
+    { 0x6734, 8993, 1, -1 },   // 朴
+    { 0x68a2, 0, 0, 5085 },   // 梢
+    { 0x6e23, 0, 0, 5086 },   // 渣
+    { 0x91cc, 8994, 1, -1 },   // 里
+    { 0x987b, 0, 0, 5088 },   // 须
+    { 0x9aed, 0, 0, 5089 },   // 髭
+    { 0x9aef, 0, 0, 5090 },   // 髯
+    { 0x810f, 0, 0, 5094 },   // 脏
+    { 0x5377, 0, 0, 5096 },   // 卷
+    { 0x5e72, 8995, 2, 5097 },   // 干
+    { 0x51b2, 0, 0, 5101 },   // 冲
+    { 0x6881, 0, 0, 5102 },   // 梁
+    { 0x5668, 0, 0, 5105 },   // 器
+    { 0x80f8, 0, 0, 5106 },   // 胸
+    { 0x8151, 0, 0, 5107 },   // 腑
+    { 0x5e72, 0, 0, 5110 },   // 干
+    { 0x6ce8, 0, 0, 5114 },   // 注
+    { 0x53d1, 0, 0, 5116 },   // 发
+    { 0x8c37, 8997, 1, -1 },   // 谷
+    { 0x810f, 0, 0, 5120 },   // 脏
+    { 0x810f, 0, 0, 5121 },   // 脏
+    { 0x7b14, 0, 0, 5123 },   // 笔
+    { 0x5236, 0, 0, 5125 },   // 制
+    { 0x4f59, 0, 0, 5126 },   // 余
+    { 0x5e72, 0, 0, 5127 },   // 干
+    { 0x810f, 0, 0, 5128 },   // 脏
+    { 0x8868, 0, 0, 5129 },   // 表
+    { 0x91cc, 0, 0, 5131 },   // 里
+    { 0x51b2, 0, 0, 5136 },   // 冲
+    { 0x683c, 8998, 1, -1 },   // 格
+    { 0x6d8c, 0, 0, 5138 },   // 涌
+    { 0x677e, 0, 0, 5140 },   // 松
+    { 0x810f, 0, 0, 5141 },   // 脏
+    { 0x5b50, 8999, 1, -1 },   // 子
+    { 0x4ec6, 0, 0, 5143 },   // 仆
+    { 0x8c37, 9000, 1, -1 },   // 谷
+    { 0x5236, 9001, 1, 5145 },   // 制
+    { 0x5938, 0, 0, 5147 },   // 夸
+    { 0x5e72, 9002, 1, -1 },   // 干
+    { 0x7136, 9003, 1, -1 },   // 然
+    { 0x7531, 9004, 1, -1 },   // 由
+    { 0x89c9, 9005, 1, -1 },   // 觉
+    { 0x6c14, 9006, 1, -1 },   // 气
+    { 0x5bc6, 0, 0, 5153 },   // 密
+    { 0x8c37, 0, 0, 5154 },   // 谷
+    { 0x5e72, 9007, 1, -1 },   // 干
+    { 0x4e0d, 9008, 1, -1 },   // 不
+    { 0x5165, 0, 0, 5158 },   // 入
+    { 0x51fa, 0, 0, 5159 },   // 出
+    { 0x53bb, 0, 0, 5160 },   // 去
+    { 0x547d, 0, 0, 5161 },   // 命
+    { 0x5815, 0, 0, 5162 },   // 堕
+    { 0x5b89, 9009, 1, -1 },   // 安
+    { 0x5b9e, 0, 0, 5164 },   // 实
+    { 0x5df1, 9010, 3, -1 },   // 己
+    { 0x5f03, 0, 0, 5170 },   // 弃
+    { 0x5f97, 0, 0, 5171 },   // 得
+    { 0x6211, 9013, 1, -1 },   // 我
+    { 0x672c, 9014, 1, -1 },   // 本
+    { 0x6b7b, 9015, 1, -1 },   // 死
+    { 0x751f, 0, 0, 5175 },   // 生
+    { 0x77ed, 9016, 1, -1 },   // 短
+    { 0x8eab, 0, 0, 5177 },   // 身
+    { 0x8f66, 9017, 1, -1 },   // 车
+    { 0x8fd1, 9018, 1, -1 },   // 近
+    { 0x5377, 0, 0, 5180 },   // 卷
+    { 0x53f0, 9019, 1, -1 },   // 台
+    { 0x6d77, 9020, 1, -1 },   // 海
+    { 0x53ea, 0, 0, 5186 },   // 只
+    { 0x53ea, 0, 0, 5188 },   // 只
+    { 0x949f, 0, 0, 5189 },   // 钟
+    { 0x6b32, 0, 0, 5192 },   // 欲
+    { 0x957f, 9021, 1, -1 },   // 长
+    { 0x540e, 0, 0, 5195 },   // 后
+    { 0x4f59, 0, 0, 5198 },   // 余
+    { 0x6b32, 0, 0, 5199 },   // 欲
+    { 0x76ee, 9022, 1, -1 },   // 目
+    { 0x679c, 9023, 1, -1 },   // 果
+    { 0x4e0d, 9024, 1, -1 },   // 不
+    { 0x54c4, 0, 0, 5207 },   // 哄
+    { 0x76c6, 9025, 1, -1 },   // 盆
+    { 0x836f, 0, 0, 5209 },   // 药
+    { 0x83f4, 9026, 1, -1 },   // 菴
+    { 0x949f, 0, 0, 5211 },   // 钟
+    { 0x9a6c, 9027, 1, -1 },   // 马
+    { 0x85b9, 0, 0, 5213 },   // 薹
+    { 0x53d1, 0, 0, 5220 },   // 发
+    { 0x672f, 0, 0, 5221 },   // 术
+    { 0x90c1, 0, 0, 5222 },   // 郁
+    { 0x6606, 0, 0, 5225 },   // 昆
+    { 0x9192, 0, 0, 5226 },   // 醒
+    { 0x91cc, 0, 0, 5227 },   // 里
+    { 0x5e72, 0, 0, 5228 },   // 干
+    { 0x6597, 0, 0, 5229 },   // 斗
+    { 0x91cc, 0, 0, 5230 },   // 里
+    { 0x60b4, 0, 0, 5232 },   // 悴
+    { 0x70ef, 0, 0, 5233 },   // 烯
+    { 0x6587, 9028, 1, -1 },   // 文
+    { 0x5a46, 0, 0, 5235 },   // 婆
+    { 0x679c, 9029, 1, 5236 },   // 果
+    { 0x90fd, 9030, 1, -1 },   // 都
+    { 0x4ead, 0, 0, 5239 },   // 亭
+    { 0x4f8b, 0, 0, 5240 },   // 例
+    { 0x56f4, 0, 0, 5241 },   // 围
+    { 0x5b57, 0, 0, 5242 },   // 字
+    { 0x5f0f, 0, 0, 5243 },   // 式
+    { 0x6027, 9031, 1, -1 },   // 性
+    { 0x6570, 0, 0, 5245 },   // 数
+    { 0x6587, 9032, 1, 5246 },   // 文
+    { 0x672c, 0, 0, 5248 },   // 本
+    { 0x7574, 0, 0, 5249 },   // 畴
+    { 0x8d24, 9033, 1, -1 },   // 贤
+    { 0x91d1, 0, 0, 5251 },   // 金
+    { 0x4e8e, 9034, 1, -1 },   // 于
+    { 0x5e72, 0, 0, 5254 },   // 干
+    { 0x4f59, 0, 0, 5260 },   // 余
+    { 0x9762, 0, 0, 5261 },   // 面
+    { 0x4e1b, 9035, 1, -1 },   // 丛
+    { 0x5e2d, 0, 0, 5264 },   // 席
+    { 0x9965, 0, 0, 5266 },   // 饥
+    { 0x9ea6, 9036, 1, -1 },   // 麦
+    { 0x4ea7, 0, 0, 5275 },   // 产
+    { 0x5973, 0, 0, 5276 },   // 女
+    { 0x5987, 0, 0, 5277 },   // 妇
+    { 0x5bc7, 0, 0, 5278 },   // 寇
+    { 0x5e73, 0, 0, 5279 },   // 平
+    { 0x6765, 9037, 1, -1 },   // 来
+    { 0x6c14, 9038, 1, 5281 },   // 气
+    { 0x6da4, 0, 0, 5283 },   // 涤
+    { 0x6f3e, 0, 0, 5284 },   // 漾
+    { 0x7136, 0, 0, 5285 },   // 然
+    { 0x821f, 0, 0, 5286 },   // 舟
+    { 0x8239, 0, 0, 5287 },   // 船
+    { 0x8361, 0, 0, 5288 },   // 荡
+    { 0x786e, 0, 0, 5293 },   // 确
+    { 0x90c1, 0, 0, 5295 },   // 郁
+    { 0x7b7e, 0, 0, 5302 },   // 签
+    { 0x9762, 9039, 1, -1 },   // 面
+    { 0x82b1, 9040, 1, -1 },   // 花
+    { 0x9762, 0, 0, 5306 },   // 面
+    { 0x672f, 0, 0, 5307 },   // 术
+    { 0x532a, 9041, 1, -1 },   // 匪
+    { 0x8361, 0, 0, 5319 },   // 荡
+    { 0x575b, 0, 0, 5320 },   // 坛
+    { 0x5e72, 0, 0, 5321 },   // 干
+    { 0x80b4, 0, 0, 5322 },   // 肴
+    { 0x68f1, 9042, 1, -1 },   // 棱
+    { 0x841d, 9043, 1, -1 },   // 萝
+    { 0x535c, 9044, 1, 5326 },   // 卜
+    { 0x5e72, 0, 0, 5330 },   // 干
+    { 0x56de, 0, 0, 5332 },   // 回
+    { 0x53c2, 0, 0, 5334 },   // 参
+    { 0x53d1, 0, 0, 5336 },   // 发
+    { 0x816e, 9045, 1, -1 },   // 腮
+    { 0x8404, 9046, 1, -1 },   // 萄
+    { 0x6c0f, 9047, 1, -1 },   // 氏
+    { 0x90c1, 0, 0, 5341 },   // 郁
+    { 0x4e8b, 0, 0, 5346 },   // 事
+    { 0x5934, 9048, 1, -1 },   // 头
+    { 0x6627, 9049, 1, -1 },   // 昧
+    { 0x677e, 9050, 1, -1 },   // 松
+    { 0x6c5c, 0, 0, 5350 },   // 汜
+    { 0x6df7, 0, 0, 5351 },   // 混
+    { 0x778d, 0, 0, 5352 },   // 瞍
+    { 0x8069, 0, 0, 5353 },   // 聩
+    { 0x80e7, 0, 0, 5354 },   // 胧
+    { 0x8499, 9051, 1, -1 },   // 蒙
+    { 0x96fe, 9052, 1, 5356 },   // 雾
+    { 0x9a97, 0, 0, 5358 },   // 骗
+    { 0x9e3f, 0, 0, 5359 },   // 鸿
+    { 0x53d1, 0, 0, 5360 },   // 发
+    { 0x5e2d, 0, 0, 5361 },   // 席
+    { 0x5236, 0, 0, 5362 },   // 制
+    { 0x5e72, 0, 0, 5363 },   // 干
+    { 0x53d1, 0, 0, 5364 },   // 发
+    { 0x80e1, 0, 0, 5365 },   // 胡
+    { 0x987b, 0, 0, 5366 },   // 须
+    { 0x90c1, 0, 0, 5367 },   // 郁
+    { 0x6dc0, 0, 0, 5369 },   // 淀
+    { 0x53d1, 0, 0, 5375 },   // 发
+    { 0x677e, 9053, 1, 5376 },   // 松
+    { 0x5e72, 0, 0, 5385 },   // 干
+    { 0x5e78, 0, 0, 5386 },   // 幸
+    { 0x53d1, 0, 0, 5387 },   // 发
+    { 0x535c, 0, 0, 5388 },   // 卜
+    { 0x5386, 9054, 1, 5390 },   // 历
+    { 0x8499, 9055, 1, -1 },   // 蒙
+    { 0x5236, 0, 0, 5394 },   // 制
+    { 0x5e2d, 0, 0, 5395 },   // 席
+    { 0x6597, 0, 0, 5397 },   // 斗
+    { 0x987b, 0, 0, 5398 },   // 须
+    { 0x5938, 0, 0, 5402 },   // 夸
+    { 0x8671, 9056, 1, -1 },   // 虱
+    { 0x9762, 0, 0, 5408 },   // 面
+    { 0x540e, 0, 0, 5412 },   // 后
+    { 0x52a8, 9057, 1, -1 },   // 动
+    { 0x53d1, 9058, 1, -1 },   // 发
+    { 0x767d, 9059, 1, -1 },   // 白
+    { 0x5e72, 0, 0, 5422 },   // 干
+    { 0x5e72, 0, 0, 5424 },   // 干
+    { 0x51c6, 0, 0, 5430 },   // 准
+    { 0x6d8c, 0, 0, 5431 },   // 涌
+    { 0x91cc, 9060, 1, -1 },   // 里
+    { 0x8c2e, 0, 0, 5440 },   // 谮
+    { 0x4f59, 0, 0, 5443 },   // 余
+    { 0x949f, 0, 0, 5445 },   // 钟
+    { 0x4e8b, 9061, 1, -1 },   // 事
+    { 0x51f6, 0, 0, 5448 },   // 凶
+    { 0x5bb6, 9062, 1, -1 },   // 家
+    { 0x9274, 0, 0, 5451 },   // 鉴
+    { 0x6ce8, 0, 0, 5453 },   // 注
+    { 0x505c, 0, 0, 5454 },   // 停
+    { 0x51a0, 0, 0, 5455 },   // 冠
+    { 0x5e26, 0, 0, 5456 },   // 带
+    { 0x5f81, 0, 0, 5457 },   // 征
+    { 0x5feb, 0, 0, 5458 },   // 快
+    { 0x6162, 0, 0, 5459 },   // 慢
+    { 0x677f, 0, 0, 5460 },   // 板
+    { 0x738b, 0, 0, 5461 },   // 王
+    { 0x76d8, 0, 0, 5462 },   // 盘
+    { 0x8499, 9063, 1, -1 },   // 蒙
+    { 0x8f6c, 0, 0, 5464 },   // 转
+    { 0x901f, 0, 0, 5465 },   // 速
+    { 0x9488, 0, 0, 5466 },   // 针
+    { 0x91cc, 0, 0, 5468 },   // 里
+    { 0x6746, 0, 0, 5472 },   // 杆
+    { 0x8868, 0, 0, 5473 },   // 表
+    { 0x91cc, 0, 0, 5474 },   // 里
+    { 0x91cc, 0, 0, 5475 },   // 里
+    { 0x53d1, 9064, 5, -1 },   // 发
+    { 0x5938, 0, 0, 5482 },   // 夸
+    { 0x5e9f, 9069, 1, -1 },   // 废
+    { 0x7cfb, 9070, 1, -1 },   // 系
+    { 0x91cc, 0, 0, 5485 },   // 里
+    { 0x5236, 0, 0, 5487 },   // 制
+    { 0x5e76, 0, 0, 5488 },   // 并
+    { 0x6298, 0, 0, 5490 },   // 折
+    { 0x8d5e, 0, 0, 5496 },   // 赞
+    { 0x5386, 9071, 4, 5499 },   // 历
+    { 0x5468, 9075, 1, -1 },   // 周
+    { 0x5cb3, 0, 0, 5505 },   // 岳
+    { 0x6606, 0, 0, 5506 },   // 昆
+    { 0x6e38, 0, 0, 5507 },   // 游
+    { 0x51b2, 0, 0, 5508 },   // 冲
+    { 0x68f1, 9076, 1, -1 },   // 棱
+    { 0x7d20, 9077, 1, -1 },   // 素
+    { 0x949f, 9078, 1, -1 },   // 钟
+    { 0x91c7, 0, 0, 5514 },   // 采
+    { 0x8303, 0, 0, 5516 },   // 范
+    { 0x62b5, 0, 0, 5529 },   // 抵
+    { 0x843d, 9079, 2, -1 },   // 落
+    { 0x68f1, 0, 0, 5532 },   // 棱
+    { 0x53d1, 9081, 1, -1 },   // 发
+    { 0x5c01, 9082, 1, -1 },   // 封
+    { 0x96c7, 0, 0, 5536 },   // 雇
+    { 0x987b, 0, 0, 5538 },   // 须
+    { 0x91cc, 0, 0, 5540 },   // 里
+    { 0x4e11, 0, 0, 5543 },   // 丑
+    { 0x4e16, 9083, 1, -1 },   // 世
+    { 0x62a5, 9084, 1, -1 },   // 报
+    { 0x793a, 9085, 1, -1 },   // 示
+    { 0x949f, 0, 0, 5547 },   // 钟
+    { 0x5212, 0, 0, 5549 },   // 划
+    { 0x65f6, 9086, 1, -1 },   // 时
+    { 0x5236, 0, 0, 5552 },   // 制
+    { 0x51c6, 0, 0, 5555 },   // 准
+    { 0x613f, 9087, 1, -1 },   // 愿
+    { 0x6587, 9088, 1, -1 },   // 文
+    { 0x8c0f, 0, 0, 5584 },   // 谏
+    { 0x65ad, 9089, 1, -1 },   // 断
+    { 0x6ce8, 0, 0, 5589 },   // 注
+    { 0x9274, 0, 0, 5590 },   // 鉴
+    { 0x4f59, 0, 0, 5599 },   // 余
+    { 0x5e72, 0, 0, 5600 },   // 干
+    { 0x6c47, 0, 0, 5601 },   // 汇
+    { 0x5236, 0, 0, 5605 },   // 制
+    { 0x6587, 9090, 1, -1 },   // 文
+    { 0x6ce8, 0, 0, 5607 },   // 注
+    { 0x8d5e, 0, 0, 5611 },   // 赞
+    { 0x5236, 0, 0, 5613 },   // 制
+    { 0x4e91, 0, 0, 5616 },   // 云
+    { 0x4f59, 0, 0, 5617 },   // 余
+    { 0x8d5e, 0, 0, 5618 },   // 赞
+    { 0x949f, 0, 0, 5619 },   // 钟
+    { 0x5f81, 0, 0, 5623 },   // 征
+    { 0x6734, 0, 0, 5624 },   // 朴
+    { 0x91cc, 9091, 1, -1 },   // 里
+    { 0x949f, 0, 0, 5637 },   // 钟
+    { 0x5f81, 9092, 1, -1 },   // 征
+    { 0x6ce8, 0, 0, 5640 },   // 注
+    { 0x8511, 0, 0, 5646 },   // 蔑
+    { 0x4e91, 0, 0, 5648 },   // 云
+    { 0x6709, 9093, 1, -1 },   // 有
+    { 0x6c47, 0, 0, 5650 },   // 汇
+    { 0x6cd5, 9094, 1, -1 },   // 法
+    { 0x91cc, 0, 0, 5652 },   // 里
+    { 0x5978, 0, 0, 5657 },   // 奸
+    { 0x4e0d, 9095, 1, -1 },   // 不
+    { 0x541b, 9096, 1, -1 },   // 君
+    { 0x6258, 0, 0, 5666 },   // 托
+    { 0x4f59, 0, 0, 5668 },   // 余
+    { 0x4f59, 0, 0, 5675 },   // 余
+    { 0x5f81, 0, 0, 5676 },   // 征
+    { 0x5e72, 9097, 1, -1 },   // 干
+    { 0x51c6, 0, 0, 5683 },   // 准
+    { 0x5236, 0, 0, 5684 },   // 制
+    { 0x8868, 0, 0, 5685 },   // 表
+    { 0x949f, 9098, 1, -1 },   // 钟
+    { 0x5f81, 0, 0, 5692 },   // 征
+    { 0x5e72, 0, 0, 5695 },   // 干
+    { 0x534e, 9099, 1, -1 },   // 华
+    { 0x6770, 0, 0, 5719 },   // 杰
+    { 0x613f, 0, 0, 5726 },   // 愿
+    { 0x8d5e, 0, 0, 5731 },   // 赞
+    { 0x91c7, 9100, 1, -1 },   // 采
+    { 0x4eba, 0, 0, 5743 },   // 人
+    { 0x4ed3, 0, 0, 5744 },   // 仓
+    { 0x4fdd, 9101, 1, -1 },   // 保
+    { 0x572d, 0, 0, 5746 },   // 圭
+    { 0x573a, 0, 0, 5747 },   // 场
+    { 0x57ce, 9102, 1, -1 },   // 城
+    { 0x58f3, 0, 0, 5749 },   // 壳
+    { 0x5b50, 0, 0, 5750 },   // 子
+    { 0x65e5, 0, 0, 5751 },   // 日
+    { 0x65e6, 0, 0, 5752 },   // 旦
+    { 0x6881, 0, 0, 5753 },   // 梁
+    { 0x6c28, 0, 0, 5754 },   // 氨
+    { 0x7269, 0, 0, 5755 },   // 物
+    { 0x76ae, 0, 0, 5756 },   // 皮
+    { 0x795e, 0, 0, 5757 },   // 神
+    { 0x7984, 0, 0, 5758 },   // 禄
+    { 0x7c73, 0, 0, 5759 },   // 米
+    { 0x7c7b, 0, 0, 5760 },   // 类
+    { 0x7c92, 0, 0, 5761 },   // 粒
+    { 0x80f1, 0, 0, 5762 },   // 胱
+    { 0x8231, 0, 0, 5763 },   // 舱
+    { 0x82d7, 0, 0, 5764 },   // 苗
+    { 0x8349, 0, 0, 5765 },   // 草
+    { 0x8c37, 0, 0, 5766 },   // 谷
+    { 0x8d31, 9103, 1, -1 },   // 贱
+    { 0x8d35, 9104, 1, -1 },   // 贵
+    { 0x96e8, 0, 0, 5769 },   // 雨
+    { 0x98df, 0, 0, 5770 },   // 食
+    { 0x5e72, 0, 0, 5771 },   // 干
+    { 0x8150, 9105, 1, -1 },   // 腐
+    { 0x5f81, 0, 0, 5773 },   // 征
+    { 0x540e, 0, 0, 5781 },   // 后
+    { 0x6570, 9106, 1, -1 },   // 数
+    { 0x6734, 0, 0, 5787 },   // 朴
+    { 0x6b32, 0, 0, 5790 },   // 欲
+    { 0x4e70, 9107, 1, -1 },   // 买
+    { 0x5e76, 0, 0, 5795 },   // 并
+    { 0x4ef7, 0, 0, 5804 },   // 价
+    { 0x5e72, 0, 0, 5805 },   // 干
+    { 0x5f81, 0, 0, 5806 },   // 征
+    { 0x7c73, 9108, 1, -1 },   // 米
+    { 0x8303, 0, 0, 5814 },   // 范
+    { 0x540e, 0, 0, 5818 },   // 后
+    { 0x9965, 0, 0, 5829 },   // 饥
+    { 0x8303, 0, 0, 5833 },   // 范
+    { 0x53f0, 0, 0, 5835 },   // 台
+    { 0x540e, 0, 0, 5836 },   // 后
+    { 0x6597, 0, 0, 5837 },   // 斗
+    { 0x8d5e, 0, 0, 5841 },   // 赞
+    { 0x4e00, 9109, 1, -1 },   // 一
+    { 0x4e0d, 9110, 1, -1 },   // 不
+    { 0x4e50, 0, 0, 5856 },   // 乐
+    { 0x4f69, 0, 0, 5857 },   // 佩
+    { 0x53f9, 0, 0, 5858 },   // 叹
+    { 0x5457, 0, 0, 5859 },   // 呗
+    { 0x626c, 0, 0, 5860 },   // 扬
+    { 0x6b4c, 0, 0, 5861 },   // 歌
+    { 0x7f8e, 0, 0, 5862 },   // 美
+    { 0x7fa1, 0, 0, 5863 },   // 羡
+    { 0x8a89, 0, 0, 5864 },   // 誉
+    { 0x8bb8, 0, 0, 5865 },   // 许
+    { 0x8bcd, 0, 0, 5866 },   // 词
+    { 0x8d4f, 0, 0, 5867 },   // 赏
+    { 0x8f9e, 0, 0, 5868 },   // 辞
+    { 0x9882, 0, 0, 5869 },   // 颂
+    { 0x4f59, 0, 0, 5873 },   // 余
+    { 0x672f, 0, 0, 5875 },   // 术
+    { 0x7ef3, 9111, 1, -1 },   // 绳
+    { 0x5a01, 9112, 1, -1 },   // 威
+    { 0x60e0, 9113, 1, -1 },   // 惠
+    { 0x6cbb, 9114, 1, -1 },   // 治
+    { 0x5236, 0, 0, 5882 },   // 制
+    { 0x9762, 9115, 1, -1 },   // 面
+    { 0x54c4, 0, 0, 5884 },   // 哄
+    { 0x7ea7, 9116, 1, -1 },   // 级
+    { 0x8d5e, 0, 0, 5886 },   // 赞
+    { 0x5e72, 0, 0, 5889 },   // 干
+    { 0x56fe, 9117, 1, -1 },   // 图
+    { 0x7b7e, 0, 0, 5895 },   // 签
+    { 0x6881, 9118, 1, -1 },   // 梁
+    { 0x8361, 0, 0, 5897 },   // 荡
+    { 0x5c40, 0, 0, 5905 },   // 局
+    { 0x5c40, 0, 0, 5911 },   // 局
+    { 0x68f1, 9119, 1, -1 },   // 棱
+    { 0x90c1, 0, 0, 5915 },   // 郁
+    { 0x4f53, 9120, 1, -1 },   // 体
+    { 0x5e72, 0, 0, 5920 },   // 干
+    { 0x5e93, 9121, 1, -1 },   // 库
+    { 0x7ad9, 9122, 1, -1 },   // 站
+    { 0x91cc, 9123, 1, 5924 },   // 里
+    { 0x8303, 0, 0, 5928 },   // 范
+    { 0x8f9f, 0, 0, 5930 },   // 辟
+    { 0x5411, 0, 0, 5933 },   // 向
+    { 0x6258, 0, 0, 5934 },   // 托
+    { 0x6597, 9124, 1, -1 },   // 斗
+    { 0x56de, 0, 0, 5938 },   // 回
+    { 0x5978, 0, 0, 5939 },   // 奸
+    { 0x677e, 9125, 1, 5951 },   // 松
+    { 0x6c47, 0, 0, 5982 },   // 汇
+    { 0x4e3a, 0, 0, 5983 },   // 为
+    { 0x4f5b, 0, 0, 5984 },   // 佛
+    { 0x4f5c, 0, 0, 5985 },   // 作
+    { 0x5212, 0, 0, 5986 },   // 划
+    { 0x571f, 0, 0, 5987 },   // 土
+    { 0x5730, 0, 0, 5988 },   // 地
+    { 0x5ba4, 0, 0, 5989 },   // 室
+    { 0x5efa, 0, 0, 5990 },   // 建
+    { 0x7530, 0, 0, 5991 },   // 田
+    { 0x7b51, 0, 0, 5992 },   // 筑
+    { 0x8c23, 0, 0, 5993 },   // 谣
+    { 0x8c37, 0, 0, 5994 },   // 谷
+    { 0x8f9f, 0, 0, 5995 },   // 辟
+    { 0x90aa, 9126, 1, -1 },   // 邪
+    { 0x9762, 0, 0, 5997 },   // 面
+    { 0x6597, 0, 0, 5999 },   // 斗
+    { 0x53d1, 0, 0, 6001 },   // 发
+    { 0x6eaa, 9127, 1, -1 },   // 溪
+    { 0x6c88, 0, 0, 6005 },   // 沈
+    { 0x56de, 0, 0, 6008 },   // 回
+    { 0x6c34, 9128, 1, -1 },   // 水
+    { 0x65e5, 9129, 1, -1 },   // 日
+    { 0x6734, 0, 0, 6014 },   // 朴
+    { 0x51b2, 0, 0, 6016 },   // 冲
+    { 0x91c7, 0, 0, 6017 },   // 采
+    { 0x4e48, 9130, 1, -1 },   // 么
+    { 0x4f19, 9131, 1, -1 },   // 伙
+    { 0x51fa, 9132, 9, 6021 },   // 出
+    { 0x53ea, 9141, 16, 6031 },   // 只
+    { 0x91cc, 0, 0, 6049 },   // 里
+    { 0x949f, 0, 0, 6050 },   // 钟
+    { 0x4e24, 9157, 1, -1 },   // 两
+    { 0x5236, 0, 0, 6053 },   // 制
+    { 0x6e38, 0, 0, 6055 },   // 游
+    { 0x4e09, 9158, 1, -1 },   // 三
+    { 0x53d1, 9159, 1, -1 },   // 发
+    { 0x7cfb, 0, 0, 6060 },   // 系
+    { 0x91c7, 0, 0, 6061 },   // 采
+    { 0x7136, 9160, 1, -1 },   // 然
+    { 0x8499, 0, 0, 6066 },   // 蒙
+    { 0x51f6, 0, 0, 6068 },   // 凶
+    { 0x4f19, 0, 0, 6069 },   // 伙
+    { 0x949f, 9161, 1, 6071 },   // 钟
+    { 0x98ce, 9162, 1, -1 },   // 风
+    { 0x624b, 9163, 1, -1 },   // 手
+    { 0x53d1, 0, 0, 6081 },   // 发
+    { 0x9065, 9164, 1, -1 },   // 遥
+    { 0x8f9f, 0, 0, 6083 },   // 辟
+    { 0x56de, 0, 0, 6085 },   // 回
+    { 0x5386, 9165, 1, 6086 },   // 历
+    { 0x5978, 0, 0, 6088 },   // 奸
+    { 0x5fc3, 9166, 1, -1 },   // 心
+    { 0x9274, 0, 0, 6090 },   // 鉴
+    { 0x51f6, 9167, 1, -1 },   // 凶
+    { 0x949f, 0, 0, 6092 },   // 钟
+    { 0x5e76, 0, 0, 6095 },   // 并
+    { 0x95f2, 0, 0, 6096 },   // 闲
+    { 0x98ce, 9168, 1, -1 },   // 风
+    { 0x8303, 0, 0, 6098 },   // 范
+    { 0x4f20, 9169, 1, -1 },   // 传
+    { 0x8303, 0, 0, 6101 },   // 范
+    { 0x8ff9, 0, 0, 6102 },   // 迹
+    { 0x6e38, 0, 0, 6104 },   // 游
+    { 0x4e11, 0, 0, 6105 },   // 丑
+    { 0x5929, 9170, 1, -1 },   // 天
+    { 0x91cc, 9171, 1, -1 },   // 里
+    { 0x5377, 0, 0, 6110 },   // 卷
+    { 0x53ea, 9172, 4, 6111 },   // 只
+    { 0x91cc, 0, 0, 6116 },   // 里
+    { 0x4f0a, 0, 0, 6122 },   // 伊
+    { 0x52c3, 0, 0, 6123 },   // 勃
+    { 0x5352, 0, 0, 6124 },   // 卒
+    { 0x5357, 0, 0, 6125 },   // 南
+    { 0x5792, 0, 0, 6126 },   // 垒
+    { 0x5819, 9176, 1, -1 },   // 堙
+    { 0x585e, 0, 0, 6128 },   // 塞
+    { 0x5f8b, 0, 0, 6129 },   // 律
+    { 0x6092, 0, 0, 6130 },   // 悒
+    { 0x6124, 0, 0, 6131 },   // 愤
+    { 0x6291, 0, 0, 6132 },   // 抑
+    { 0x6339, 0, 0, 6133 },   // 挹
+    { 0x6734, 0, 0, 6134 },   // 朴
+    { 0x6797, 0, 0, 6135 },   // 林
+    { 0x6c14, 0, 0, 6136 },   // 气
+    { 0x6c5f, 0, 0, 6137 },   // 江
+    { 0x6c89, 9177, 1, -1 },   // 沉
+    { 0x6cf1, 0, 0, 6139 },   // 泱
+    { 0x706b, 0, 0, 6140 },   // 火
+    { 0x70ed, 0, 0, 6141 },   // 热
+    { 0x71e0, 0, 0, 6142 },   // 燠
+    { 0x75c7, 0, 0, 6143 },   // 症
+    { 0x79ef, 0, 0, 6144 },   // 积
+    { 0x7ea1, 0, 0, 6145 },   // 纡
+    { 0x7ed3, 0, 0, 6146 },   // 结
+    { 0x84b8, 0, 0, 6147 },   // 蒸
+    { 0x84ca, 0, 0, 6148 },   // 蓊
+    { 0x8840, 0, 0, 6149 },   // 血
+    { 0x9091, 0, 0, 6150 },   // 邑
+    { 0x90c1, 9178, 5, 6151 },   // 郁
+    { 0x91d1, 0, 0, 6158 },   // 金
+    { 0x95ed, 0, 0, 6159 },   // 闭
+    { 0x95f7, 0, 0, 6160 },   // 闷
+    { 0x9676, 0, 0, 6161 },   // 陶
+    { 0x9ed1, 0, 0, 6162 },   // 黑
+    { 0x6e38, 0, 0, 6163 },   // 游
+    { 0x51ef, 9183, 1, -1 },   // 凯
+    { 0x949f, 0, 0, 6169 },   // 钟
+    { 0x843d, 9184, 1, -1 },   // 落
+    { 0x5e02, 9185, 1, -1 },   // 市
+    { 0x5236, 9186, 1, 6175 },   // 制
+    { 0x56fe, 9187, 1, -1 },   // 图
+    { 0x575b, 0, 0, 6178 },   // 坛
+    { 0x66f2, 0, 0, 6179 },   // 曲
+    { 0x6c14, 9188, 1, -1 },   // 气
+    { 0x9eb9, 0, 0, 6181 },   // 麹
+    { 0x677e, 0, 0, 6183 },   // 松
+    { 0x59dc, 0, 0, 6185 },   // 姜
+    { 0x5236, 0, 0, 6189 },   // 制
+    { 0x6734, 0, 0, 6190 },   // 朴
+    { 0x575b, 0, 0, 6191 },   // 坛
+    { 0x4e0b, 0, 0, 6192 },   // 下
+    { 0x4e3a, 0, 0, 6193 },   // 为
+    { 0x4e70, 0, 0, 6194 },   // 买
+    { 0x4f10, 0, 0, 6195 },   // 伐
+    { 0x4f4f, 0, 0, 6196 },   // 住
+    { 0x4fe1, 0, 0, 6197 },   // 信
+    { 0x5149, 0, 0, 6198 },   // 光
+    { 0x5230, 0, 0, 6199 },   // 到
+    { 0x5236, 0, 0, 6200 },   // 制
+    { 0x529e, 0, 0, 6201 },   // 办
+    { 0x533a, 0, 0, 6202 },   // 区
+    { 0x53bb, 0, 0, 6203 },   // 去
+    { 0x53d6, 0, 0, 6204 },   // 取
+    { 0x56de, 0, 0, 6205 },   // 回
+    { 0x5728, 0, 0, 6206 },   // 在
+    { 0x597d, 0, 0, 6207 },   // 好
+    { 0x5f55, 0, 0, 6208 },   // 录
+    { 0x5f97, 0, 0, 6209 },   // 得
+    { 0x62e9, 0, 0, 6210 },   // 择
+    { 0x62fe, 0, 0, 6211 },   // 拾
+    { 0x6316, 0, 0, 6212 },   // 挖
+    { 0x6398, 0, 0, 6213 },   // 掘
+    { 0x6458, 0, 0, 6214 },   // 摘
+    { 0x646d, 0, 0, 6215 },   // 摭
+    { 0x64b7, 0, 0, 6216 },   // 撷
+    { 0x6536, 0, 0, 6217 },   // 收
+    { 0x6599, 0, 0, 6218 },   // 料
+    { 0x6696, 0, 0, 6219 },   // 暖
+    { 0x6811, 9189, 1, -1 },   // 树
+    { 0x6837, 0, 0, 6221 },   // 样
+    { 0x6851, 0, 0, 6222 },   // 桑
+    { 0x6a35, 9190, 1, -1 },   // 樵
+    { 0x6c14, 0, 0, 6224 },   // 气
+    { 0x6cb9, 0, 0, 6225 },   // 油
+    { 0x7164, 0, 0, 6226 },   // 煤
+    { 0x730e, 0, 0, 6227 },   // 猎
+    { 0x73e0, 0, 0, 6228 },   // 珠
+    { 0x751f, 9191, 1, -1 },   // 生
+    { 0x7528, 0, 0, 6230 },   // 用
+    { 0x76d0, 0, 0, 6231 },   // 盐
+    { 0x77f3, 9192, 2, 6232 },   // 石
+    { 0x77ff, 0, 0, 6235 },   // 矿
+    { 0x7802, 9194, 1, -1 },   // 砂
+    { 0x79cd, 0, 0, 6237 },   // 种
+    { 0x7a7a, 9195, 2, -1 },   // 空
+    { 0x7d0d, 0, 0, 6240 },   // 納
+    { 0x7eb3, 0, 0, 6241 },   // 纳
+    { 0x7ed9, 0, 0, 6242 },   // 给
+    { 0x82b1, 0, 0, 6243 },   // 花
+    { 0x82b9, 9197, 1, -1 },   // 芹
+    { 0x8336, 0, 0, 6245 },   // 茶
+    { 0x836f, 0, 0, 6246 },   // 药
+    { 0x83b2, 0, 0, 6247 },   // 莲
+    { 0x83b7, 0, 0, 6248 },   // 获
+    { 0x83ca, 0, 0, 6249 },   // 菊
+    { 0x8587, 0, 0, 6250 },   // 薇
+    { 0x85aa, 0, 0, 6251 },   // 薪
+    { 0x8840, 0, 0, 6252 },   // 血
+    { 0x884c, 0, 0, 6253 },   // 行
+    { 0x8865, 0, 0, 6254 },   // 补
+    { 0x8bbf, 0, 0, 6255 },   // 访
+    { 0x8bc1, 0, 0, 6256 },   // 证
+    { 0x8d2d, 0, 0, 6257 },   // 购
+    { 0x8fc7, 0, 0, 6258 },   // 过
+    { 0x8fd0, 0, 0, 6259 },   // 运
+    { 0x9009, 0, 0, 6260 },   // 选
+    { 0x91d1, 0, 0, 6261 },   // 金
+    { 0x94c1, 0, 0, 6262 },   // 铁
+    { 0x96c6, 0, 0, 6263 },   // 集
+    { 0x98ce, 9198, 1, 6264 },   // 风
+    { 0x98df, 0, 0, 6266 },   // 食
+    { 0x52fe, 9199, 1, -1 },   // 勾
+    { 0x5934, 0, 0, 6269 },   // 头
+    { 0x5c42, 0, 0, 6270 },   // 层
+    { 0x5c4b, 0, 0, 6271 },   // 屋
+    { 0x5e26, 0, 0, 6272 },   // 带
+    { 0x5e94, 9200, 1, -1 },   // 应
+    { 0x5f26, 0, 0, 6274 },   // 弦
+    { 0x6c34, 9201, 1, -1 },   // 水
+    { 0x6d77, 9202, 1, 6276 },   // 海
+    { 0x767d, 0, 0, 6278 },   // 白
+    { 0x810a, 0, 0, 6279 },   // 脊
+    { 0x8863, 0, 0, 6280 },   // 衣
+    { 0x8fb9, 0, 0, 6281 },   // 边
+    { 0x8fd0, 9203, 1, -1 },   // 运
+    { 0x901a, 9204, 1, -1 },   // 通
+    { 0x94fa, 0, 0, 6285 },   // 铺
+    { 0x95f4, 0, 0, 6286 },   // 间
+    { 0x9762, 9205, 1, 6287 },   // 面
+    { 0x5236, 0, 0, 6289 },   // 制
+    { 0x590d, 0, 0, 6290 },   // 复
+    { 0x6258, 0, 0, 6291 },   // 托
+    { 0x6e38, 0, 0, 6292 },   // 游
+    { 0x7f57, 9206, 1, -1 },   // 罗
+    { 0x59dc, 0, 0, 6294 },   // 姜
+    { 0x6e38, 0, 0, 6295 },   // 游
+    { 0x4e0d, 9207, 1, -1 },   // 不
+    { 0x4ec6, 9208, 1, -1 },   // 仆
+    { 0x53d1, 0, 0, 6298 },   // 发
+    { 0x5723, 9209, 1, -1 },   // 圣
+    { 0x6eaa, 9210, 1, -1 },   // 溪
+    { 0x8303, 0, 0, 6301 },   // 范
+    { 0x8868, 9211, 4, -1 },   // 表
+    { 0x88c5, 9215, 1, -1 },   // 装
+    { 0x949f, 0, 0, 6307 },   // 钟
+    { 0x94fe, 0, 0, 6308 },   // 链
+    { 0x4e8e, 0, 0, 6310 },   // 于
+    { 0x522b, 0, 0, 6311 },   // 别
+    { 0x53e4, 0, 0, 6312 },   // 古
+    { 0x5b9a, 0, 0, 6313 },   // 定
+    { 0x5bdf, 0, 0, 6314 },   // 察
+    { 0x5f80, 9216, 1, -1 },   // 往
+    { 0x6212, 0, 0, 6316 },   // 戒
+    { 0x6e56, 0, 0, 6317 },   // 湖
+    { 0x85cf, 0, 0, 6318 },   // 藏
+    { 0x8bc1, 0, 0, 6319 },   // 证
+    { 0x8bc6, 0, 0, 6320 },   // 识
+    { 0x8c05, 0, 0, 6321 },   // 谅
+    { 0x8d4f, 0, 0, 6322 },   // 赏
+    { 0x4e0a, 0, 0, 6346 },   // 上
+    { 0x4e0b, 0, 0, 6347 },   // 下
+    { 0x4e0d, 9217, 4, 6348 },   // 不
+    { 0x4e73, 9221, 2, -1 },   // 乳
+    { 0x4f53, 0, 0, 6355 },   // 体
+    { 0x505c, 0, 0, 6356 },   // 停
+    { 0x5173, 0, 0, 6357 },   // 关
+    { 0x5320, 0, 0, 6358 },   // 匠
+    { 0x53d1, 9223, 1, -1 },   // 发
+    { 0x53e3, 0, 0, 6360 },   // 口
+    { 0x54cd, 0, 0, 6361 },   // 响
+    { 0x5728, 9224, 1, -1 },   // 在
+    { 0x5854, 0, 0, 6363 },   // 塔
+    { 0x58c1, 0, 0, 6364 },   // 壁
+    { 0x58f0, 0, 0, 6365 },   // 声
+    { 0x592a, 0, 0, 6366 },   // 太
+    { 0x5934, 0, 0, 6367 },   // 头
+    { 0x597d, 0, 0, 6368 },   // 好
+    { 0x5c71, 0, 0, 6369 },   // 山
+    { 0x5de6, 9225, 1, -1 },   // 左
+    { 0x5dee, 0, 0, 6371 },   // 差
+    { 0x5ea7, 0, 0, 6372 },   // 座
+    { 0x5f62, 9226, 1, 6373 },   // 形
+    { 0x5f8b, 0, 0, 6375 },   // 律
+    { 0x5feb, 0, 0, 6376 },   // 快
+    { 0x6162, 0, 0, 6377 },   // 慢
+    { 0x6446, 0, 0, 6378 },   // 摆
+    { 0x6572, 0, 0, 6379 },   // 敲
+    { 0x6709, 0, 0, 6380 },   // 有
+    { 0x697c, 0, 0, 6381 },   // 楼
+    { 0x6a21, 0, 0, 6382 },   // 模
+    { 0x6ca1, 0, 0, 6383 },   // 没
+    { 0x6f0f, 0, 0, 6384 },   // 漏
+    { 0x70b9, 0, 0, 6385 },   // 点
+    { 0x738b, 0, 0, 6386 },   // 王
+    { 0x7434, 0, 0, 6387 },   // 琴
+    { 0x7684, 0, 0, 6388 },   // 的
+    { 0x76d8, 0, 0, 6389 },   // 盘
+    { 0x76f8, 0, 0, 6390 },   // 相
+    { 0x78ec, 0, 0, 6391 },   // 磬
+    { 0x7ebd, 0, 0, 6392 },   // 纽
+    { 0x7f69, 0, 0, 6393 },   // 罩
+    { 0x8170, 0, 0, 6394 },   // 腰
+    { 0x82b1, 0, 0, 6395 },   // 花
+    { 0x87ba, 0, 0, 6396 },   // 螺
+    { 0x884c, 0, 0, 6397 },   // 行
+    { 0x8868, 9227, 7, 6398 },   // 表
+    { 0x88ab, 0, 0, 6406 },   // 被
+    { 0x8c03, 0, 0, 6407 },   // 调
+    { 0x8eab, 0, 0, 6408 },   // 身
+    { 0x901f, 0, 0, 6409 },   // 速
+    { 0x9648, 9234, 1, -1 },   // 陈
+    { 0x9762, 0, 0, 6411 },   // 面
+    { 0x9876, 0, 0, 6412 },   // 顶
+    { 0x9e23, 0, 0, 6413 },   // 鸣
+    { 0x9f0e, 0, 0, 6414 },   // 鼎
+    { 0x9f13, 0, 0, 6415 },   // 鼓
+    { 0x4e4b, 9235, 1, -1 },   // 之
+    { 0x5236, 0, 0, 6420 },   // 制
+    { 0x6881, 0, 0, 6421 },   // 梁
+    { 0x5fc3, 9236, 1, -1 },   // 心
+    { 0x8303, 0, 0, 6438 },   // 范
+    { 0x8c37, 0, 0, 6439 },   // 谷
+    { 0x5236, 0, 0, 6455 },   // 制
+    { 0x949f, 0, 0, 6456 },   // 钟
+    { 0x9508, 0, 0, 6457 },   // 锈
+    { 0x5236, 0, 0, 6479 },   // 制
+    { 0x8303, 0, 0, 6480 },   // 范
+    { 0x949f, 0, 0, 6481 },   // 钟
+    { 0x5236, 0, 0, 6483 },   // 制
+    { 0x949f, 0, 0, 6500 },   // 钟
+    { 0x51fa, 0, 0, 6504 },   // 出
+    { 0x5208, 0, 0, 6505 },   // 刈
+    { 0x5934, 0, 0, 6506 },   // 头
+    { 0x5e73, 0, 0, 6507 },   // 平
+    { 0x9664, 0, 0, 6508 },   // 除
+    { 0x53d1, 0, 0, 6513 },   // 发
+    { 0x6731, 0, 0, 6514 },   // 朱
+    { 0x949f, 0, 0, 6517 },   // 钟
+    { 0x8868, 0, 0, 6523 },   // 表
+    { 0x75c5, 0, 0, 6533 },   // 病
+    { 0x83cc, 0, 0, 6534 },   // 菌
+    { 0x8680, 0, 0, 6535 },   // 蚀
+    { 0x5236, 0, 0, 6540 },   // 制
+    { 0x70bc, 0, 0, 6558 },   // 炼
+    { 0x5364, 0, 0, 6561 },   // 卤
+    { 0x7ee3, 9237, 1, -1 },   // 绣
+    { 0x800c, 9238, 1, -1 },   // 而
+    { 0x91cc, 0, 0, 6589 },   // 里
+    { 0x56fe, 9239, 1, -1 },   // 图
+    { 0x4ed3, 0, 0, 6623 },   // 仓
+    { 0x51e0, 0, 0, 6628 },   // 几
+    { 0x5386, 9240, 1, 6629 },   // 历
+    { 0x53d1, 9241, 3, -1 },   // 发
+    { 0x5f97, 9244, 1, -1 },   // 得
+    { 0x540a, 9245, 1, -1 },   // 吊
+    { 0x5e18, 0, 0, 6637 },   // 帘
+    { 0x91cc, 0, 0, 6638 },   // 里
+    { 0x6000, 9246, 1, -1 },   // 怀
+    { 0x70bc, 0, 0, 6646 },   // 炼
+    { 0x8361, 0, 0, 6647 },   // 荡
+    { 0x60c5, 9247, 1, -1 },   // 情
+    { 0x6e38, 0, 0, 6652 },   // 游
+    { 0x8361, 0, 0, 6653 },   // 荡
+    { 0x90aa, 0, 0, 6654 },   // 邪
+    { 0x4e0d, 9248, 1, -1 },   // 不
+    { 0x91cc, 0, 0, 6658 },   // 里
+    { 0x91c7, 9249, 1, -1 },   // 采
+    { 0x8868, 0, 0, 6665 },   // 表
+    { 0x949f, 0, 0, 6666 },   // 钟
+    { 0x8303, 0, 0, 6668 },   // 范
+    { 0x98ce, 9250, 1, -1 },   // 风
+    { 0x5e9c, 0, 0, 6676 },   // 府
+    { 0x8303, 0, 0, 6679 },   // 范
+    { 0x91cc, 0, 0, 6701 },   // 里
+    { 0x5fa1, 0, 0, 6702 },   // 御
+    { 0x6c34, 9251, 1, -1 },   // 水
+    { 0x8303, 0, 0, 6704 },   // 范
+    { 0x9508, 0, 0, 6705 },   // 锈
+    { 0x5386, 9252, 1, 6707 },   // 历
+    { 0x6625, 9253, 1, -1 },   // 春
+    { 0x8c37, 0, 0, 6710 },   // 谷
+    { 0x5386, 9254, 1, 6712 },   // 历
+    { 0x5e72, 0, 0, 6714 },   // 干
+    { 0x6c9f, 9255, 1, -1 },   // 沟
+    { 0x90c1, 0, 0, 6716 },   // 郁
+    { 0x6ce8, 0, 0, 6719 },   // 注
+    { 0x5347, 0, 0, 6724 },   // 升
+    { 0x6709, 9256, 1, -1 },   // 有
+    { 0x6770, 0, 0, 6726 },   // 杰
+    { 0x70bc, 0, 0, 6727 },   // 炼
+    { 0x91cc, 0, 0, 6730 },   // 里
+    { 0x540a, 0, 0, 6734 },   // 吊
+    { 0x5236, 0, 0, 6735 },   // 制
+    { 0x51c6, 9257, 1, 6736 },   // 准
+    { 0x51e0, 0, 0, 6740 },   // 几
+    { 0x5360, 0, 0, 6741 },   // 占
+    { 0x820d, 0, 0, 6745 },   // 舍
+    { 0x8303, 0, 0, 6746 },   // 范
+    { 0x56e2, 0, 0, 6747 },   // 团
+    { 0x6570, 9258, 1, -1 },   // 数
+    { 0x6e38, 9259, 1, -1 },   // 游
+    { 0x91cc, 0, 0, 6750 },   // 里
+    { 0x4e3b, 0, 0, 6751 },   // 主
+    { 0x4eba, 0, 0, 6752 },   // 人
+    { 0x4f63, 0, 0, 6753 },   // 佣
+    { 0x519c, 0, 0, 6754 },   // 农
+    { 0x5230, 0, 0, 6755 },   // 到
+    { 0x5de5, 0, 0, 6756 },   // 工
+    { 0x8239, 0, 0, 6757 },   // 船
+    { 0x8bf7, 0, 0, 6758 },   // 请
+    { 0x8f66, 0, 0, 6759 },   // 车
+    { 0x5fc3, 9260, 1, -1 },   // 心
+    { 0x608d, 0, 0, 6762 },   // 悍
+    { 0x6881, 9261, 1, -1 },   // 梁
+    { 0x7fce, 0, 0, 6764 },   // 翎
+    { 0x9e57, 0, 0, 6765 },   // 鹗
+    { 0x8499, 9262, 1, -1 },   // 蒙
+    { 0x7a97, 9263, 1, -1 },   // 窗
+    { 0x91cc, 9264, 2, 6769 },   // 里
+    { 0x4e2a, 0, 0, 6773 },   // 个
+    { 0x4f59, 0, 0, 6774 },   // 余
+    { 0x53ea, 0, 0, 6775 },   // 只
+    { 0x5468, 9266, 1, -1 },   // 周
+    { 0x5929, 9267, 1, -1 },   // 天
+    { 0x91cc, 0, 0, 6779 },   // 里
+    { 0x8303, 0, 0, 6781 },   // 范
+    { 0x6817, 0, 0, 6782 },   // 栗
+    { 0x6bd2, 0, 0, 6783 },   // 毒
+    { 0x6c14, 9268, 1, -1 },   // 气
+    { 0x7d20, 0, 0, 6785 },   // 素
+    { 0x83cc, 0, 0, 6786 },   // 菌
+    { 0x9ed1, 0, 0, 6787 },   // 黑
+    { 0x9ee7, 0, 0, 6788 },   // 黧
+    { 0x4e11, 0, 0, 6790 },   // 丑
+    { 0x5c71, 9269, 1, -1 },   // 山
+    { 0x9709, 0, 0, 6792 },   // 霉
+    { 0x5e38, 9270, 1, -1 },   // 常
+    { 0x4eba, 9271, 1, -1 },   // 人
+    { 0x5236, 9272, 1, -1 },   // 制
+    { 0x5305, 9273, 8, 6798 },   // 包
+    { 0x5382, 0, 0, 6807 },   // 厂
+    { 0x56e2, 0, 0, 6808 },   // 团
+    { 0x574a, 0, 0, 6809 },   // 坊
+    { 0x576f, 9281, 1, -1 },   // 坯
+    { 0x5851, 0, 0, 6811 },   // 塑
+    { 0x5e97, 9282, 1, 6812 },   // 店
+    { 0x644a, 0, 0, 6814 },   // 摊
+    { 0x6756, 0, 0, 6815 },   // 杖
+    { 0x6761, 9283, 1, 6816 },   // 条
+    { 0x6c64, 0, 0, 6818 },   // 汤
+    { 0x6d46, 0, 0, 6819 },   // 浆
+    { 0x70b9, 9284, 1, -1 },   // 点
+    { 0x7599, 9285, 1, -1 },   // 疙
+    { 0x76ae, 0, 0, 6822 },   // 皮
+    { 0x7801, 9286, 1, -1 },   // 码
+    { 0x7b4b, 0, 0, 6824 },   // 筋
+    { 0x7c89, 9287, 1, 6825 },   // 粉
+    { 0x7cca, 0, 0, 6827 },   // 糊
+    { 0x7f38, 0, 0, 6828 },   // 缸
+    { 0x8336, 0, 0, 6829 },   // 茶
+    { 0x98df, 9288, 1, 6830 },   // 食
+    { 0x997a, 0, 0, 6832 },   // 饺
+    { 0x997c, 0, 0, 6833 },   // 饼
+    { 0x9986, 0, 0, 6834 },   // 馆
+    { 0x91cc, 0, 0, 6836 },   // 里
+    { 0x5236, 0, 0, 6838 },   // 制
+    { 0x8f9f, 9289, 1, -1 },   // 辟
+    { 0x5e2d, 0, 0, 6842 },   // 席
+    { 0x5236, 0, 0, 6845 },   // 制
+    { 0x56fd, 9290, 1, -1 },   // 国
+    { 0x4e0d, 9291, 1, -1 },   // 不
+    { 0x51c6, 0, 0, 6851 },   // 准
+    { 0x58f0, 9292, 1, -1 },   // 声
+    { 0x5c71, 9293, 1, -1 },   // 山
+    { 0x9762, 0, 0, 6856 },   // 面
+    { 0x51f6, 0, 0, 6858 },   // 凶
+    { 0x591a, 0, 0, 6859 },   // 多
+    { 0x94fe, 0, 0, 6863 },   // 链
+    { 0x949f, 9294, 1, -1 },   // 钟
+    { 0x98ce, 9295, 1, -1 },   // 风
+    { 0x53d1, 0, 0, 6868 },   // 发
+    { 0x6839, 9296, 1, 6869 },   // 根
+    { 0x6bdb, 0, 0, 6871 },   // 毛
+    { 0x751f, 0, 0, 6872 },   // 生
+    { 0x7709, 0, 0, 6873 },   // 眉
+    { 0x80e1, 0, 0, 6874 },   // 胡
+    { 0x987b, 0, 0, 6875 },   // 须
+    { 0x9ca8, 0, 0, 6876 },   // 鲨
+    { 0x9cb8, 0, 0, 6877 },   // 鲸
+    { 0x7cfb, 0, 0, 6885 },   // 系
+    { 0x8d5e, 0, 0, 6886 },   // 赞
+    { 0x5236, 0, 0, 6889 },   // 制
+    { 0x62a5, 9297, 1, -1 },   // 报
+    { 0x8896, 9298, 1, -1 },   // 袖
+    { 0x987b, 0, 0, 6898 },   // 须
+    { 0x987c, 9299, 1, -1 },   // 顼
+    { 0x8303, 0, 0, 6913 },   // 范
+    { 0x5f81, 0, 0, 6915 },   // 征
+    { 0x6211, 9300, 1, -1 },   // 我
+    { 0x5e72, 9301, 1, -1 },   // 干
+    { 0x98a0, 9302, 1, -1 },   // 颠
+    { 0x6817, 0, 0, 6926 },   // 栗
+    { 0x522e, 0, 0, 6930 },   // 刮
+    { 0x5377, 9303, 1, -1 },   // 卷
+    { 0x540e, 0, 0, 6932 },   // 后
+    { 0x571f, 9304, 1, -1 },   // 土
+    { 0x5e72, 0, 0, 6934 },   // 干
+    { 0x7269, 9305, 1, -1 },   // 物
+    { 0x8303, 0, 0, 6936 },   // 范
+    { 0x8d77, 9306, 1, -1 },   // 起
+    { 0x91c7, 0, 0, 6938 },   // 采
+    { 0x91cc, 0, 0, 6939 },   // 里
+    { 0x53d1, 9307, 1, -1 },   // 发
+    { 0x6e38, 0, 0, 6946 },   // 游
+    { 0x8361, 0, 0, 6947 },   // 荡
+    { 0x98d8, 9308, 1, -1 },   // 飘
+    { 0x520d, 9309, 1, -1 },   // 刍
+    { 0x624e, 0, 0, 6952 },   // 扎
+    { 0x884c, 9310, 1, -1 },   // 行
+    { 0x6b32, 0, 0, 6954 },   // 欲
+    { 0x9762, 0, 0, 6955 },   // 面
+    { 0x53f0, 0, 0, 6958 },   // 台
+    { 0x5bd2, 0, 0, 6960 },   // 寒
+    { 0x6c11, 0, 0, 6961 },   // 民
+    { 0x6e34, 0, 0, 6962 },   // 渴
+    { 0x6eba, 0, 0, 6963 },   // 溺
+    { 0x8352, 0, 0, 6964 },   // 荒
+    { 0x9971, 0, 0, 6965 },   // 饱
+    { 0x9991, 0, 0, 6966 },   // 馑
+    { 0x540e, 9311, 1, -1 },   // 后
+    { 0x56e2, 0, 0, 6975 },   // 团
+    { 0x5e72, 0, 0, 6987 },   // 干
+    { 0x9968, 9312, 1, -1 },   // 饨
+    { 0x8c37, 0, 0, 6996 },   // 谷
+    { 0x91cc, 0, 0, 6997 },   // 里
+    { 0x51fa, 9313, 1, -1 },   // 出
+    { 0x53d1, 0, 0, 7008 },   // 发
+    { 0x53ea, 0, 0, 7009 },   // 只
+    { 0x5f53, 9314, 1, -1 },   // 当
+    { 0x5e72, 0, 0, 7011 },   // 干
+    { 0x5e72, 0, 0, 7013 },   // 干
+    { 0x5fb7, 9315, 1, -1 },   // 德
+    { 0x65af, 9316, 1, -1 },   // 斯
+    { 0x683c, 9317, 1, -1 },   // 格
+    { 0x624e, 0, 0, 7031 },   // 扎
+    { 0x8361, 0, 0, 7037 },   // 荡
+    { 0x575b, 0, 0, 7069 },   // 坛
+    { 0x5e72, 0, 0, 7070 },   // 干
+    { 0x7070, 9318, 1, -1 },   // 灰
+    { 0x5e72, 9319, 2, 7075 },   // 干
+    { 0x53d1, 0, 0, 7078 },   // 发
+    { 0x80e1, 0, 0, 7079 },   // 胡
+    { 0x987b, 0, 0, 7080 },   // 须
+    { 0x80e1, 0, 0, 7081 },   // 胡
+    { 0x677e, 0, 0, 7082 },   // 松
+    { 0x677e, 0, 0, 7083 },   // 松
+    { 0x53d1, 0, 0, 7084 },   // 发
+    { 0x53d1, 0, 0, 7085 },   // 发
+    { 0x53d1, 0, 0, 7087 },   // 发
+    { 0x6c14, 9321, 1, -1 },   // 气
+    { 0x7275, 9322, 1, -1 },   // 牵
+    { 0x5f81, 0, 0, 7092 },   // 征
+    { 0x8868, 0, 0, 7093 },   // 表
+    { 0x5e72, 0, 0, 7095 },   // 干
+    { 0x677e, 0, 0, 7096 },   // 松
+    { 0x4e8e, 0, 0, 7114 },   // 于
+    { 0x987b, 0, 0, 7137 },   // 须
+    { 0x6816, 9323, 1, -1 },   // 栖
+    { 0x4e1d, 9324, 1, 7164 },   // 丝
+    { 0x4e89, 9325, 1, -1 },   // 争
+    { 0x53ea, 0, 0, 7167 },   // 只
+    { 0x5435, 9326, 1, -1 },   // 吵
+    { 0x5978, 0, 0, 7169 },   // 奸
+    { 0x817f, 9327, 1, -1 },   // 腿
+    { 0x86cb, 9328, 1, -1 },   // 蛋
+    { 0x949f, 0, 0, 7174 },   // 钟
+    { 0x9274, 0, 0, 7195 },   // 鉴
+    { 0x8303, 0, 0, 7197 },   // 范
+    { 0x53d1, 0, 0, 7202 },   // 发
+    { 0x51c6, 0, 0, 7204 },   // 准
+    { 0x53d1, 0, 0, 7222 },   // 发
+    { 0x540a, 0, 0, 7223 },   // 吊
+    { 0x5cf0, 9329, 1, -1 },   // 峰
+    { 0x96d5, 0, 0, 7234 },   // 雕
+    { 0x6e38, 0, 0, 7237 },   // 游
+    { 0x9709, 0, 0, 7241 },   // 霉
+    { 0x5c06, 9330, 1, -1 },   // 将
+    { 0x9171, 9331, 1, -1 },   // 酱
+    { 0x5386, 9332, 1, 7245 },   // 历
+    { 0x53d1, 0, 0, 7247 },   // 发
+    { 0x5ca9, 9333, 2, -1 },   // 岩
+    { 0x5e72, 9335, 1, -1 },   // 干
+    { 0x66f2, 9336, 1, -1 },   // 曲
+    { 0x6770, 0, 0, 7252 },   // 杰
+    { 0x767d, 9337, 1, -1 },   // 白
+    { 0x8bd7, 9338, 1, -1 },   // 诗
+    { 0x91d1, 9339, 1, -1 },   // 金
+    { 0x949f, 0, 0, 7256 },   // 钟
+    { 0x94b0, 9340, 1, -1 },   // 钰
+    { 0x5409, 9341, 1, -1 },   // 吉
+    { 0x53d1, 0, 0, 7260 },   // 发
+    { 0x5974, 9342, 1, -1 },   // 奴
+    { 0x5e72, 9343, 1, -1 },   // 干
+    { 0x957f, 9344, 1, -1 },   // 长
+    { 0x566a, 0, 0, 7269 },   // 噪
+    { 0x91cc, 0, 0, 7270 },   // 里
+    { 0x66f2, 9345, 1, -1 },   // 曲
+    { 0x51c6, 0, 0, 7274 },   // 准
+    { 0x6881, 9346, 1, 7275 },   // 梁
+    { 0x738b, 9347, 1, -1 },   // 王
+    { 0x5371, 9348, 1, -1 },   // 危
+    { 0x53d1, 0, 0, 7282 },   // 发
+    { 0x843d, 9349, 1, -1 },   // 落
+    { 0x5377, 0, 0, 7296 },   // 卷
+    { 0x5ca9, 0, 0, 7297 },   // 岩
+    { 0x6597, 9350, 1, -1 },   // 斗
+    { 0x773c, 9351, 1, -1 },   // 眼
+    { 0x987b, 9352, 1, 7300 },   // 须
+    { 0x9274, 0, 0, 7305 },   // 鉴
+    { 0x540e, 0, 0, 2 },   // 后
+    { 0x51c6, 0, 0, 4 },   // 准
+    { 0x4e24, 9353, 1, -1 },   // 两
+    { 0x5934, 0, 0, 7 },   // 头
+    { 0x5267, 0, 0, 11 },   // 剧
+    { 0x559c, 9354, 1, -1 },   // 喜
+    { 0x597d, 9355, 1, -1 },   // 好
+    { 0x5b50, 0, 0, 14 },   // 子
+    { 0x60b2, 9356, 1, -1 },   // 悲
+    { 0x620f, 0, 0, 16 },   // 戏
+    { 0x7535, 9357, 1, -1 },   // 电
+    { 0x4e00, 9358, 1, -1 },   // 一
+    { 0x5343, 9359, 1, -1 },   // 千
+    { 0x94b1, 0, 0, 21 },   // 钱
+    { 0x540e, 0, 0, 22 },   // 后
+    { 0x800c, 9360, 1, -1 },   // 而
+    { 0x91cc, 0, 0, 24 },   // 里
+    { 0x540e, 0, 0, 25 },   // 后
+    { 0x949f, 0, 0, 26 },   // 钟
+    { 0x4e8c, 9361, 1, -1 },   // 二
+    { 0x767e, 9362, 1, -1 },   // 百
+    { 0x514b, 9363, 1, -1 },   // 克
+    { 0x9762, 0, 0, 32 },   // 面
+    { 0x9762, 0, 0, 33 },   // 面
+    { 0x5f53, 9364, 1, -1 },   // 当
+    { 0x540e, 0, 0, 38 },   // 后
+    { 0x540e, 0, 0, 39 },   // 后
+    { 0x516d, 9365, 1, -1 },   // 六
+    { 0x53ea, 0, 0, 43 },   // 只
+    { 0x53f2, 0, 0, 47 },   // 史
+    { 0x540e, 0, 0, 49 },   // 后
+    { 0x540e, 0, 0, 50 },   // 后
+    { 0x5386, 9366, 1, -1 },   // 历
+    { 0x63d2, 9367, 1, -1 },   // 插
+    { 0x620f, 0, 0, 58 },   // 戏
+    { 0x540e, 0, 0, 60 },   // 后
+    { 0x540e, 0, 0, 61 },   // 后
+    { 0x4e03, 9368, 1, -1 },   // 七
+    { 0x5386, 9369, 1, 64 },   // 历
+    { 0x9762, 0, 0, 66 },   // 面
+    { 0x4e86, 0, 0, 69 },   // 了
+    { 0x5199, 0, 0, 70 },   // 写
+    { 0x53d1, 0, 0, 71 },   // 发
+    { 0x540d, 0, 0, 72 },   // 名
+    { 0x5b57, 0, 0, 73 },   // 字
+    { 0x5b9a, 0, 0, 74 },   // 定
+    { 0x6536, 0, 0, 75 },   // 收
+    { 0x7ea6, 0, 0, 76 },   // 约
+    { 0x7f72, 0, 0, 77 },   // 署
+    { 0x8ba2, 0, 0, 78 },   // 订
+    { 0x8bc1, 0, 0, 79 },   // 证
+    { 0x4e0a, 0, 0, 80 },   // 上
+    { 0x949f, 0, 0, 81 },   // 钟
+    { 0x91cc, 0, 0, 82 },   // 里
+    { 0x4e86, 0, 0, 85 },   // 了
+    { 0x5199, 0, 0, 86 },   // 写
+    { 0x53d1, 0, 0, 87 },   // 发
+    { 0x540d, 0, 0, 88 },   // 名
+    { 0x5b57, 0, 0, 89 },   // 字
+    { 0x5b9a, 0, 0, 90 },   // 定
+    { 0x6536, 0, 0, 91 },   // 收
+    { 0x7ea6, 0, 0, 92 },   // 约
+    { 0x7f72, 0, 0, 93 },   // 署
+    { 0x8ba2, 0, 0, 94 },   // 订
+    { 0x8bc1, 0, 0, 95 },   // 证
+    { 0x949f, 0, 0, 96 },   // 钟
+    { 0x51c6, 0, 0, 99 },   // 准
+    { 0x5e72, 9370, 1, -1 },   // 干
+    { 0x6bcd, 9371, 1, -1 },   // 母
+    { 0x800c, 9372, 1, -1 },   // 而
+    { 0x4e0d, 9373, 1, -1 },   // 不
+    { 0x80f6, 0, 0, 104 },   // 胶
+    { 0x80c6, 0, 0, 107 },   // 胆
+    { 0x53d1, 0, 0, 108 },   // 发
+    { 0x6240, 9374, 1, -1 },   // 所
+    { 0x540a, 9375, 1, -1 },   // 吊
+    { 0x58f0, 0, 0, 113 },   // 声
+    { 0x94a2, 0, 0, 114 },   // 钢
+    { 0x5e72, 9376, 1, -1 },   // 干
+    { 0x5934, 0, 0, 118 },   // 头
+    { 0x602a, 0, 0, 122 },   // 怪
+    { 0x524c, 0, 0, 123 },   // 剌
+    { 0x8fdc, 9377, 1, -1 },   // 远
+    { 0x602a, 9378, 1, -1 },   // 怪
+    { 0x6548, 9379, 1, -1 },   // 效
+    { 0x513f, 0, 0, 136 },   // 儿
+    { 0x5987, 0, 0, 139 },   // 妇
+    { 0x9e2d, 0, 0, 140 },   // 鸭
+    { 0x602a, 0, 0, 141 },   // 怪
+    { 0x4e86, 0, 0, 151 },   // 了
+    { 0x751f, 0, 0, 162 },   // 生
+    { 0x91cc, 0, 0, 169 },   // 里
+    { 0x676f, 0, 0, 170 },   // 杯
+    { 0x91cc, 0, 0, 171 },   // 里
+    { 0x949f, 9380, 1, 172 },   // 钟
+    { 0x91cc, 0, 0, 177 },   // 里
+    { 0x897f, 9381, 1, -1 },   // 西
+    { 0x949f, 0, 0, 180 },   // 钟
+    { 0x53d1, 9382, 1, -1 },   // 发
+    { 0x540e, 0, 0, 194 },   // 后
+    { 0x540e, 0, 0, 195 },   // 后
+    { 0x5171, 9383, 1, -1 },   // 共
+    { 0x6597, 9384, 1, -1 },   // 斗
+    { 0x519c, 0, 0, 201 },   // 农
+    { 0x539f, 9385, 1, -1 },   // 原
+    { 0x5965, 0, 0, 206 },   // 奥
+    { 0x597d, 9386, 1, -1 },   // 好
+    { 0x5f3a, 9387, 1, -1 },   // 强
+    { 0x6ecb, 9388, 1, -1 },   // 滋
+    { 0x7384, 9389, 1, -1 },   // 玄
+    { 0x7406, 9390, 1, -1 },   // 理
+    { 0x7fd8, 9391, 1, -1 },   // 翘
+    { 0x9053, 9392, 1, -1 },   // 道
+    { 0x9ad8, 9393, 1, -1 },   // 高
+    { 0x5e02, 0, 0, 215 },   // 市
+    { 0x91cc, 0, 0, 216 },   // 里
+    { 0x8868, 0, 0, 219 },   // 表
+    { 0x949f, 9394, 2, 220 },   // 钟
+    { 0x91cc, 0, 0, 225 },   // 里
+    { 0x53d1, 0, 0, 226 },   // 发
+    { 0x4e86, 0, 0, 228 },   // 了
+    { 0x5199, 0, 0, 229 },   // 写
+    { 0x53d1, 0, 0, 230 },   // 发
+    { 0x540d, 0, 0, 231 },   // 名
+    { 0x5b57, 0, 0, 232 },   // 字
+    { 0x5b9a, 0, 0, 233 },   // 定
+    { 0x6536, 0, 0, 234 },   // 收
+    { 0x7ea6, 0, 0, 235 },   // 约
+    { 0x7f72, 0, 0, 236 },   // 署
+    { 0x8ba2, 0, 0, 237 },   // 订
+    { 0x8bc1, 0, 0, 238 },   // 证
+    { 0x540e, 0, 0, 239 },   // 后
+    { 0x4e0d, 9396, 1, -1 },   // 不
+    { 0x4e61, 0, 0, 247 },   // 乡
+    { 0x6597, 9397, 1, -1 },   // 斗
+    { 0x5dee, 0, 0, 257 },   // 差
+    { 0x66f2, 9398, 1, -1 },   // 曲
+    { 0x8868, 0, 0, 261 },   // 表
+    { 0x51b2, 9399, 1, -1 },   // 冲
+    { 0x91cc, 0, 0, 274 },   // 里
+    { 0x9762, 0, 0, 275 },   // 面
+    { 0x949f, 0, 0, 277 },   // 钟
+    { 0x539f, 0, 0, 278 },   // 原
+    { 0x4e4b, 9400, 1, -1 },   // 之
+    { 0x540e, 0, 0, 285 },   // 后
+    { 0x540e, 0, 0, 286 },   // 后
+    { 0x53d1, 0, 0, 297 },   // 发
+    { 0x751f, 0, 0, 300 },   // 生
+    { 0x813e, 9401, 1, -1 },   // 脾
+    { 0x54c4, 0, 0, 302 },   // 哄
+    { 0x5386, 0, 0, 304 },   // 历
+    { 0x540e, 0, 0, 307 },   // 后
+    { 0x6307, 9402, 1, -1 },   // 指
+    { 0x6597, 9403, 3, -1 },   // 斗
+    { 0x6597, 9406, 2, -1 },   // 斗
+    { 0x6597, 9408, 1, -1 },   // 斗
+    { 0x6597, 9409, 1, -1 },   // 斗
+    { 0x68f1, 9410, 1, -1 },   // 棱
+    { 0x540e, 0, 0, 323 },   // 后
+    { 0x540e, 0, 0, 324 },   // 后
+    { 0x949f, 9411, 1, -1 },   // 钟
+    { 0x76f8, 9412, 1, -1 },   // 相
+    { 0x5934, 0, 0, 327 },   // 头
+    { 0x9e64, 0, 0, 329 },   // 鹤
+    { 0x6fc2, 0, 0, 330 },   // 濂
+    { 0x6cf3, 0, 0, 331 },   // 泳
+    { 0x56fd, 0, 0, 332 },   // 国
+    { 0x66f2, 9413, 1, -1 },   // 曲
+    { 0x8fdc, 0, 0, 334 },   // 远
+    { 0x534e, 0, 0, 335 },   // 华
+    { 0x6850, 0, 0, 336 },   // 桐
+    { 0x81f3, 0, 0, 337 },   // 至
+    { 0x6cfd, 0, 0, 338 },   // 泽
+    { 0x6208, 0, 0, 339 },   // 戈
+    { 0x70df, 0, 0, 340 },   // 烟
+    { 0x4f1f, 0, 0, 341 },   // 伟
+    { 0x6862, 0, 0, 342 },   // 桢
+    { 0x6cbb, 0, 0, 343 },   // 治
+    { 0x5b9d, 0, 0, 345 },   // 宝
+    { 0x9f99, 0, 0, 346 },   // 龙
+    { 0x5e93, 9414, 1, -1 },   // 库
+    { 0x5fe0, 0, 0, 348 },   // 忠
+    { 0x8f69, 0, 0, 349 },   // 轩
+    { 0x4f1f, 0, 0, 350 },   // 伟
+    { 0x5c91, 0, 0, 351 },   // 岑
+    { 0x6839, 0, 0, 352 },   // 根
+    { 0x91cc, 9415, 1, -1 },   // 里
+    { 0x4e1c, 0, 0, 354 },   // 东
+    { 0x56fd, 0, 0, 355 },   // 国
+    { 0x897f, 0, 0, 356 },   // 西
+    { 0x519b, 0, 0, 358 },   // 军
+    { 0x6d32, 0, 0, 359 },   // 洲
+    { 0x5d58, 0, 0, 360 },   // 嵘
+    { 0x5b81, 0, 0, 362 },   // 宁
+    { 0x8083, 9416, 1, -1 },   // 肃
+    { 0x9f99, 0, 0, 364 },   // 龙
+    { 0x8fbe, 9417, 1, -1 },   // 达
+    { 0x6d9b, 0, 0, 366 },   // 涛
+    { 0x5c71, 0, 0, 367 },   // 山
+    { 0x6d01, 0, 0, 369 },   // 洁
+    { 0x4f1f, 0, 0, 370 },   // 伟
+    { 0x8d85, 0, 0, 371 },   // 超
+    { 0x5c14, 0, 0, 372 },   // 尔
+    { 0x533a, 0, 0, 373 },   // 区
+    { 0x4e0a, 0, 0, 374 },   // 上
+    { 0x62d4, 0, 0, 375 },   // 拔
+    { 0x8fb9, 0, 0, 376 },   // 边
+    { 0x5170, 0, 0, 378 },   // 兰
+    { 0x5149, 0, 0, 379 },   // 光
+    { 0x9716, 0, 0, 380 },   // 霖
+    { 0x5c14, 0, 0, 383 },   // 尔
+    { 0x4f1f, 0, 0, 385 },   // 伟
+    { 0x53bf, 0, 0, 386 },   // 县
+    { 0x4e2d, 0, 0, 388 },   // 中
+    { 0x524d, 0, 0, 389 },   // 前
+    { 0x540e, 0, 0, 390 },   // 后
+    { 0x73af, 0, 0, 391 },   // 环
+    { 0x6697, 0, 0, 392 },   // 暗
+    { 0x65af, 9418, 1, -1 },   // 斯
+    { 0x653f, 0, 0, 394 },   // 政
+    { 0x5965, 0, 0, 396 },   // 奥
+    { 0x4e2a, 9419, 1, -1 },   // 个
+    { 0x9762, 0, 0, 402 },   // 面
+    { 0x4e03, 9420, 1, -1 },   // 七
+    { 0x96fe, 9421, 1, -1 },   // 雾
+    { 0x540e, 0, 0, 411 },   // 后
+    { 0x540e, 0, 0, 412 },   // 后
+    { 0x53bf, 0, 0, 414 },   // 县
+    { 0x751f, 9422, 1, -1 },   // 生
+    { 0x6307, 0, 0, 432 },   // 指
+    { 0x7684, 0, 0, 433 },   // 的
+    { 0x53ea, 0, 0, 434 },   // 只
+    { 0x91cc, 0, 0, 435 },   // 里
+    { 0x5fd7, 0, 0, 437 },   // 志
+    { 0x540e, 0, 0, 442 },   // 后
+    { 0x540e, 0, 0, 443 },   // 后
+    { 0x9762, 0, 0, 444 },   // 面
+    { 0x6000, 9423, 1, -1 },   // 怀
+    { 0x7f62, 9424, 1, -1 },   // 罢
+    { 0x91cc, 0, 0, 470 },   // 里
+    { 0x91cc, 0, 0, 471 },   // 里
+    { 0x5230, 9425, 1, -1 },   // 到
+    { 0x5411, 9426, 1, -1 },   // 向
+    { 0x7684, 0, 0, 476 },   // 的
+    { 0x91cc, 0, 0, 479 },   // 里
+    { 0x53d1, 9427, 1, -1 },   // 发
+    { 0x8868, 0, 0, 481 },   // 表
+    { 0x7684, 0, 0, 485 },   // 的
+    { 0x949f, 9428, 1, 488 },   // 钟
+    { 0x601c, 0, 0, 491 },   // 怜
+    { 0x6c57, 9429, 1, -1 },   // 汗
+    { 0x9762, 0, 0, 493 },   // 面
+    { 0x5170, 9430, 2, -1 },   // 兰
+    { 0x91cc, 9432, 1, -1 },   // 里
+    { 0x6770, 0, 0, 499 },   // 杰
+    { 0x540a, 9433, 1, -1 },   // 吊
+    { 0x6270, 0, 0, 515 },   // 扰
+    { 0x4e8e, 9434, 1, -1 },   // 于
+    { 0x80dc, 0, 0, 540 },   // 胜
+    { 0x4e3a, 0, 0, 562 },   // 为
+    { 0x68f1, 9435, 1, -1 },   // 棱
+    { 0x91cc, 0, 0, 645 },   // 里
+    { 0x6597, 0, 0, 652 },   // 斗
+    { 0x4e0d, 9436, 1, -1 },   // 不
+    { 0x67dc, 0, 0, 667 },   // 柜
+    { 0x8d38, 9437, 1, -1 },   // 贸
+    { 0x4e4b, 9438, 1, -1 },   // 之
+    { 0x524d, 0, 0, 679 },   // 前
+    { 0x540e, 0, 0, 680 },   // 后
+    { 0x5200, 0, 0, 681 },   // 刀
+    { 0x5175, 0, 0, 689 },   // 兵
+    { 0x4ee3, 9439, 1, -1 },   // 代
+    { 0x7d2f, 0, 0, 700 },   // 累
+    { 0x7968, 0, 0, 703 },   // 票
+    { 0x5f53, 9440, 1, -1 },   // 当
+    { 0x6597, 9441, 1, -1 },   // 斗
+    { 0x50bb, 9442, 1, -1 },   // 傻
+    { 0x5386, 9443, 1, 725 },   // 历
+    { 0x6539, 9444, 1, -1 },   // 改
+    { 0x81f4, 0, 0, 735 },   // 致
+    { 0x95f4, 0, 0, 739 },   // 间
+    { 0x82f1, 0, 0, 746 },   // 英
+    { 0x540e, 0, 0, 753 },   // 后
+    { 0x540e, 0, 0, 754 },   // 后
+    { 0x80e1, 0, 0, 755 },   // 胡
+    { 0x9762, 0, 0, 758 },   // 面
+    { 0x53f2, 0, 0, 761 },   // 史
+    { 0x4e11, 0, 0, 762 },   // 丑
+    { 0x91cc, 0, 0, 763 },   // 里
+    { 0x540e, 0, 0, 769 },   // 后
+    { 0x540e, 0, 0, 770 },   // 后
+    { 0x540e, 9445, 1, -1 },   // 后
+    { 0x5e02, 0, 0, 775 },   // 市
+    { 0x5386, 9446, 1, 776 },   // 历
+    { 0x5217, 0, 0, 780 },   // 列
+    { 0x6240, 0, 0, 781 },   // 所
+    { 0x79d1, 0, 0, 782 },   // 科
+    { 0x7edf, 0, 0, 783 },   // 统
+    { 0x5305, 9447, 1, 799 },   // 包
+    { 0x4ec6, 0, 0, 802 },   // 仆
+    { 0x53f0, 0, 0, 806 },   // 台
+    { 0x53f2, 0, 0, 810 },   // 史
+    { 0x5386, 9448, 1, 811 },   // 历
+    { 0x9f13, 0, 0, 815 },   // 鼓
+    { 0x91cc, 0, 0, 818 },   // 里
+    { 0x53d1, 9449, 1, -1 },   // 发
+    { 0x9677, 9450, 1, -1 },   // 陷
+    { 0x70ae, 0, 0, 841 },   // 炮
+    { 0x9635, 0, 0, 842 },   // 阵
+    { 0x649e, 9451, 1, -1 },   // 撞
+    { 0x67aa, 0, 0, 867 },   // 枪
+    { 0x51c6, 0, 0, 892 },   // 准
+    { 0x62a4, 0, 0, 896 },   // 护
+    { 0x91ca, 0, 0, 897 },   // 释
+    { 0x4e8b, 0, 0, 899 },   // 事
+    { 0x8d5b, 0, 0, 900 },   // 赛
+    { 0x5b50, 0, 0, 901 },   // 子
+    { 0x5c14, 0, 0, 903 },   // 尔
+    { 0x539f, 0, 0, 907 },   // 原
+    { 0x7763, 0, 0, 911 },   // 督
+    { 0x5a18, 0, 0, 913 },   // 娘
+    { 0x90ce, 0, 0, 914 },   // 郎
+    { 0x5e01, 0, 0, 926 },   // 币
+    { 0x521d, 0, 0, 930 },   // 初
+    { 0x7a97, 9452, 1, -1 },   // 窗
+    { 0x540e, 0, 0, 940 },   // 后
+    { 0x540e, 0, 0, 941 },   // 后
+    { 0x51e0, 9453, 1, -1 },   // 几
+    { 0x5e72, 0, 0, 944 },   // 干
+    { 0x5df4, 0, 0, 957 },   // 巴
+    { 0x6bd5, 9454, 1, -1 },   // 毕
+    { 0x5f04, 9455, 1, -1 },   // 弄
+    { 0x9732, 9456, 1, -1 },   // 露
+    { 0x91cc, 0, 0, 982 },   // 里
+    { 0x949f, 0, 0, 984 },   // 钟
+    { 0x949f, 0, 0, 985 },   // 钟
+    { 0x4e91, 0, 0, 986 },   // 云
+    { 0x949f, 0, 0, 987 },   // 钟
+    { 0x91cc, 0, 0, 989 },   // 里
+    { 0x6868, 0, 0, 993 },   // 桨
+    { 0x6765, 0, 0, 994 },   // 来
+    { 0x4e00, 9457, 1, -1 },   // 一
+    { 0x6765, 0, 0, 999 },   // 来
+    { 0x5212, 9458, 1, -1 },   // 划
+    { 0x72ec, 9459, 1, -1 },   // 独
+    { 0x821f, 0, 0, 1005 },   // 舟
+    { 0x8239, 0, 0, 1006 },   // 船
+    { 0x601c, 0, 0, 1008 },   // 怜
+    { 0x540e, 0, 0, 1009 },   // 后
+    { 0x53d1, 0, 0, 1018 },   // 发
+    { 0x98ce, 0, 0, 1028 },   // 风
+    { 0x6765, 0, 0, 1033 },   // 来
+    { 0x540e, 0, 0, 1036 },   // 后
+    { 0x91cc, 0, 0, 1037 },   // 里
+    { 0x673a, 0, 0, 1043 },   // 机
+    { 0x952e, 0, 0, 1063 },   // 键
+    { 0x949f, 0, 0, 1070 },   // 钟
+    { 0x949f, 0, 0, 1071 },   // 钟
+    { 0x53d1, 0, 0, 1089 },   // 发
+    { 0x4e0a, 9460, 1, -1 },   // 上
+    { 0x53f0, 0, 0, 1095 },   // 台
+    { 0x7cbe, 9461, 1, -1 },   // 精
+    { 0x6597, 9462, 1, -1 },   // 斗
+    { 0x8361, 9463, 1, -1 },   // 荡
+    { 0x6cb3, 0, 0, 1124 },   // 河
+    { 0x7ebf, 0, 0, 1125 },   // 线
+    { 0x94c1, 9464, 1, -1 },   // 铁
+    { 0x7d22, 9465, 1, -1 },   // 索
+    { 0x6709, 0, 0, 1133 },   // 有
+    { 0x7684, 0, 0, 1134 },   // 的
+    { 0x51fb, 0, 0, 1139 },   // 击
+    { 0x5934, 0, 0, 1140 },   // 头
+    { 0x540e, 0, 0, 1142 },   // 后
+    { 0x540e, 0, 0, 1143 },   // 后
+    { 0x591f, 0, 0, 1148 },   // 够
+    { 0x8db3, 9466, 1, -1 },   // 足
+    { 0x540e, 0, 0, 1150 },   // 后
+    { 0x767e, 9467, 2, -1 },   // 百
+    { 0x540e, 0, 0, 1153 },   // 后
+    { 0x4e00, 9469, 1, -1 },   // 一
+    { 0x540e, 0, 0, 1159 },   // 后
+    { 0x591f, 0, 0, 1161 },   // 够
+    { 0x949f, 0, 0, 1163 },   // 钟
+    { 0x4e8e, 0, 0, 1168 },   // 于
+    { 0x72ec, 9470, 1, -1 },   // 独
+    { 0x53d1, 0, 0, 1173 },   // 发
+    { 0x949f, 9471, 1, 1174 },   // 钟
+    { 0x7ebf, 0, 0, 1176 },   // 线
+    { 0x94c1, 9472, 1, -1 },   // 铁
+    { 0x9002, 0, 0, 1178 },   // 适
+    { 0x665a, 9473, 1, -1 },   // 晚
+    { 0x672f, 0, 0, 1182 },   // 术
+    { 0x666e, 9474, 1, -1 },   // 普
+    { 0x7b79, 0, 0, 1185 },   // 筹
+    { 0x679d, 9475, 1, -1 },   // 枝
+    { 0x4f3d, 0, 0, 1189 },   // 伽
+    { 0x82b1, 0, 0, 1192 },   // 花
+    { 0x5e84, 9476, 1, -1 },   // 庄
+    { 0x949f, 0, 0, 1217 },   // 钟
+    { 0x7ef6, 9477, 1, -1 },   // 绶
+    { 0x77f3, 9478, 1, -1 },   // 石
+    { 0x86fe, 0, 0, 1230 },   // 蛾
+    { 0x91cd, 9479, 1, -1 },   // 重
+    { 0x7334, 0, 0, 1235 },   // 猴
+    { 0x83dc, 0, 0, 1237 },   // 菜
+    { 0x76d2, 0, 0, 1244 },   // 盒
+    { 0x4e91, 0, 0, 1246 },   // 云
+    { 0x76d6, 0, 0, 1256 },   // 盖
+    { 0x91cc, 0, 0, 1264 },   // 里
+    { 0x4e66, 0, 0, 1270 },   // 书
+    { 0x4e4b, 9480, 1, -1 },   // 之
+    { 0x51fa, 0, 0, 1280 },   // 出
+    { 0x673a, 0, 0, 1281 },   // 机
+    { 0x949f, 0, 0, 1292 },   // 钟
+    { 0x91cc, 0, 0, 1293 },   // 里
+    { 0x91cc, 0, 0, 1303 },   // 里
+    { 0x53ea, 0, 0, 1308 },   // 只
+    { 0x91cc, 0, 0, 1309 },   // 里
+    { 0x5c04, 0, 0, 1313 },   // 射
+    { 0x7c7b, 0, 0, 1314 },   // 类
+    { 0x590d, 9481, 1, -1 },   // 复
+    { 0x5236, 0, 0, 1319 },   // 制
+    { 0x5236, 9482, 1, -1 },   // 制
+    { 0x51b2, 9483, 1, -1 },   // 冲
+    { 0x6307, 9484, 1, -1 },   // 指
+    { 0x8840, 9485, 1, -1 },   // 血
+    { 0x53ef, 9486, 1, -1 },   // 可
+    { 0x8170, 0, 0, 1331 },   // 腰
+    { 0x971c, 9487, 1, -1 },   // 霜
+    { 0x5343, 9488, 1, -1 },   // 千
+    { 0x80a9, 0, 0, 1342 },   // 肩
+    { 0x51b5, 0, 0, 1348 },   // 况
+    { 0x6001, 0, 0, 1349 },   // 态
+    { 0x5fc3, 9489, 1, -1 },   // 心
+    { 0x83cc, 0, 0, 1358 },   // 菌
+    { 0x51b2, 9490, 1, -1 },   // 冲
+    { 0x9884, 0, 0, 1385 },   // 预
+    { 0x5507, 9491, 1, -1 },   // 唇
+    { 0x4e4b, 9492, 1, -1 },   // 之
+    { 0x4e91, 0, 0, 1390 },   // 云
+    { 0x91cc, 0, 0, 1391 },   // 里
+    { 0x54b8, 0, 0, 1393 },   // 咸
+    { 0x4e91, 0, 0, 1394 },   // 云
+    { 0x8868, 0, 0, 1397 },   // 表
+    { 0x795e, 9493, 1, -1 },   // 神
+    { 0x54cd, 0, 0, 1404 },   // 响
+    { 0x906e, 9494, 1, -1 },   // 遮
+    { 0x7247, 9495, 1, -1 },   // 片
+    { 0x4e0a, 9496, 2, -1 },   // 上
+    { 0x4e3a, 0, 0, 1411 },   // 为
+    { 0x4f53, 0, 0, 1412 },   // 体
+    { 0x540e, 0, 0, 1413 },   // 后
+    { 0x8fb9, 0, 0, 1414 },   // 边
+    { 0x58f0, 0, 0, 1416 },   // 声
+    { 0x5f53, 9498, 1, -1 },   // 当
+    { 0x53ef, 9499, 1, -1 },   // 可
+    { 0x53f2, 0, 0, 1423 },   // 史
+    { 0x5b59, 0, 0, 1424 },   // 孙
+    { 0x519c, 0, 0, 1428 },   // 农
+    { 0x4e0a, 0, 0, 1429 },   // 上
+    { 0x5316, 0, 0, 1430 },   // 化
+    { 0x540e, 0, 0, 1432 },   // 后
+    { 0x5956, 0, 0, 1433 },   // 奖
+    { 0x7a33, 9500, 1, -1 },   // 稳
+    { 0x7434, 0, 0, 1437 },   // 琴
+    { 0x540e, 0, 0, 1438 },   // 后
+    { 0x5200, 9501, 1, -1 },   // 刀
+    { 0x9762, 0, 0, 1449 },   // 面
+    { 0x6252, 9502, 1, -1 },   // 扒
+    { 0x722c, 9503, 1, -1 },   // 爬
+    { 0x949f, 0, 0, 1453 },   // 钟
+    { 0x53f2, 0, 0, 1458 },   // 史
+    { 0x5e86, 9504, 1, -1 },   // 庆
+    { 0x5927, 9505, 1, -1 },   // 大
+    { 0x513f, 9506, 1, -1 },   // 儿
+    { 0x6492, 9507, 1, -1 },   // 撒
+    { 0x5b50, 0, 0, 1489 },   // 子
+    { 0x8fce, 9508, 1, -1 },   // 迎
+    { 0x5fd7, 0, 0, 1497 },   // 志
+    { 0x4e8e, 0, 0, 1500 },   // 于
+    { 0x5ea7, 0, 0, 1504 },   // 座
+    { 0x661f, 9509, 1, -1 },   // 星
+    { 0x8001, 9510, 1, -1 },   // 老
+    { 0x6e7e, 0, 0, 1508 },   // 湾
+    { 0x5e97, 0, 0, 1510 },   // 店
+    { 0x6349, 9511, 1, -1 },   // 捉
+    { 0x63e1, 9512, 1, -1 },   // 握
+    { 0x65f6, 0, 0, 1515 },   // 时
+    { 0x6765, 0, 0, 1516 },   // 来
+    { 0x6234, 9513, 1, -1 },   // 戴
+    { 0x5f0f, 0, 0, 1531 },   // 式
+    { 0x81f4, 0, 0, 1536 },   // 致
+    { 0x5446, 9514, 1, -1 },   // 呆
+    { 0x53f2, 0, 0, 1552 },   // 史
+    { 0x5217, 9515, 1, -1 },   // 列
+    { 0x6c49, 0, 0, 1556 },   // 汉
+    { 0x82f1, 9516, 1, -1 },   // 英
+    { 0x949f, 0, 0, 1561 },   // 钟
+    { 0x9f13, 0, 0, 1563 },   // 鼓
+    { 0x5477, 9517, 1, -1 },   // 呷
+    { 0x6de1, 9518, 1, -1 },   // 淡
+    { 0x5e72, 0, 0, 1592 },   // 干
+    { 0x86cb, 0, 0, 1596 },   // 蛋
+    { 0x81ea, 9519, 1, -1 },   // 自
+    { 0x53f2, 0, 0, 1633 },   // 史
+    { 0x51c6, 9520, 1, -1 },   // 准
+    { 0x7c7b, 0, 0, 1641 },   // 类
+    { 0x4e00, 9521, 1, -1 },   // 一
+    { 0x8868, 0, 0, 1647 },   // 表
+    { 0x949f, 9522, 1, 1648 },   // 钟
+    { 0x6234, 9523, 1, -1 },   // 戴
+    { 0x5f81, 9524, 1, -1 },   // 征
+    { 0x5386, 9525, 1, 1673 },   // 历
+    { 0x540e, 0, 0, 1676 },   // 后
+    { 0x540e, 0, 0, 1677 },   // 后
+    { 0x94c1, 9526, 1, -1 },   // 铁
+    { 0x4e94, 9527, 1, -1 },   // 五
+    { 0x516d, 9528, 1, -1 },   // 六
+    { 0x949f, 0, 0, 1682 },   // 钟
+    { 0x8fd4, 9529, 1, -1 },   // 返
+    { 0x53f2, 0, 0, 1685 },   // 史
+    { 0x4e2d, 0, 0, 1688 },   // 中
+    { 0x4f60, 0, 0, 1689 },   // 你
+    { 0x5e16, 9530, 1, -1 },   // 帖
+    { 0x610f, 9531, 1, -1 },   // 意
+    { 0x8bf4, 0, 0, 1692 },   // 说
+    { 0x90ae, 9532, 1, -1 },   // 邮
+    { 0x5939, 0, 0, 1695 },   // 夹
+    { 0x5e8f, 9533, 1, -1 },   // 序
+    { 0x6570, 0, 0, 1697 },   // 数
+    { 0x6784, 9534, 1, -1 },   // 构
+    { 0x7ed3, 9535, 1, -1 },   // 结
+    { 0x8054, 0, 0, 1700 },   // 联
+    { 0x8bd7, 0, 0, 1701 },   // 诗
+    { 0x9526, 0, 0, 1702 },   // 锦
+    { 0x9488, 0, 0, 1706 },   // 针
+    { 0x8361, 9536, 1, -1 },   // 荡
+    { 0x6027, 0, 0, 1715 },   // 性
+    { 0x4f1a, 0, 0, 1723 },   // 会
+    { 0x8d77, 9537, 1, -1 },   // 起
+    { 0x4e4b, 9538, 1, -1 },   // 之
+    { 0x72b9, 9539, 1, -1 },   // 犹
+    { 0x6862, 9540, 1, -1 },   // 桢
+    { 0x4ee3, 0, 0, 1740 },   // 代
+    { 0x4efb, 0, 0, 1741 },   // 任
+    { 0x53f2, 0, 0, 1742 },   // 史
+    { 0x5c4a, 0, 0, 1743 },   // 届
+    { 0x6765, 0, 0, 1744 },   // 来
+    { 0x7ecf, 0, 0, 1745 },   // 经
+    { 0x7684, 0, 0, 1747 },   // 的
+    { 0x9762, 0, 0, 1753 },   // 面
+    { 0x5386, 0, 0, 1756 },   // 历
+    { 0x5c14, 9541, 1, -1 },   // 尔
+    { 0x91cc, 0, 0, 1759 },   // 里
+    { 0x5fb7, 9542, 1, -1 },   // 德
+    { 0x91cc, 0, 0, 1761 },   // 里
+    { 0x5386, 9543, 1, -1 },   // 历
+    { 0x94c1, 0, 0, 1769 },   // 铁
+    { 0x949f, 0, 0, 1770 },   // 钟
+    { 0x7f50, 9544, 1, -1 },   // 罐
+    { 0x8361, 0, 0, 1786 },   // 荡
+    { 0x5386, 9545, 1, 1800 },   // 历
+    { 0x8273, 9546, 1, -1 },   // 艳
+    { 0x51b2, 0, 0, 1803 },   // 冲
+    { 0x91cc, 0, 0, 1804 },   // 里
+    { 0x793e, 0, 0, 1806 },   // 社
+    { 0x76d7, 9547, 1, -1 },   // 盗
+    { 0x94ed, 0, 0, 1819 },   // 铭
+    { 0x540e, 0, 0, 1828 },   // 后
+    { 0x97f3, 0, 0, 1840 },   // 音
+    { 0x6570, 0, 0, 1843 },   // 数
+    { 0x6570, 0, 0, 1844 },   // 数
+    { 0x6790, 0, 0, 1845 },   // 析
+    { 0x89e3, 0, 0, 1846 },   // 解
+    { 0x51fd, 9548, 1, -1 },   // 函
+    { 0x952e, 0, 0, 1858 },   // 键
+    { 0x6570, 0, 0, 1860 },   // 数
+    { 0x9762, 0, 0, 1861 },   // 面
+    { 0x8282, 9549, 1, -1 },   // 节
+    { 0x97f3, 0, 0, 1888 },   // 音
+    { 0x4e54, 0, 0, 1895 },   // 乔
+    { 0x53f2, 0, 0, 1897 },   // 史
+    { 0x4e2d, 9550, 1, -1 },   // 中
+    { 0x7535, 9551, 1, -1 },   // 电
+    { 0x4f1a, 0, 0, 1906 },   // 会
+    { 0x987b, 0, 0, 1907 },   // 须
+    { 0x540e, 0, 0, 1908 },   // 后
+    { 0x540e, 0, 0, 1909 },   // 后
+    { 0x91cc, 0, 0, 1910 },   // 里
+    { 0x513f, 0, 0, 1916 },   // 儿
+    { 0x53f2, 0, 0, 1918 },   // 史
+    { 0x9669, 0, 0, 1919 },   // 险
+    { 0x4f1a, 0, 0, 1921 },   // 会
+    { 0x6298, 0, 0, 1922 },   // 折
+    { 0x949f, 9552, 2, 1923 },   // 钟
+    { 0x6d8c, 9554, 1, -1 },   // 涌
+    { 0x513f, 0, 0, 1930 },   // 儿
+    { 0x5386, 9555, 1, 1931 },   // 历
+    { 0x949f, 0, 0, 1933 },   // 钟
+    { 0x521d, 9556, 1, -1 },   // 初
+    { 0x5e72, 9557, 1, -1 },   // 干
+    { 0x949f, 0, 0, 1936 },   // 钟
+    { 0x5386, 9558, 1, 1937 },   // 历
+    { 0x53d1, 9559, 1, -1 },   // 发
+    { 0x540e, 0, 0, 1942 },   // 后
+    { 0x5730, 9560, 1, -1 },   // 地
+    { 0x53f2, 0, 0, 1945 },   // 史
+    { 0x534a, 0, 0, 1946 },   // 半
+    { 0x5929, 0, 0, 1947 },   // 天
+    { 0x5bab, 0, 0, 1948 },   // 宫
+    { 0x6765, 0, 0, 1949 },   // 来
+    { 0x4e3a, 9561, 1, -1 },   // 为
+    { 0x5386, 9562, 1, -1 },   // 历
+    { 0x5b66, 9563, 1, -1 },   // 学
+    { 0x949f, 0, 0, 1953 },   // 钟
+    { 0x5386, 9564, 1, 1958 },   // 历
+    { 0x73b0, 0, 0, 1963 },   // 现
+    { 0x53d1, 0, 0, 1965 },   // 发
+    { 0x6d77, 9565, 1, -1 },   // 海
+    { 0x6597, 9566, 1, -1 },   // 斗
+    { 0x5176, 9567, 1, -1 },   // 其
+    { 0x8bf4, 9568, 1, -1 },   // 说
+    { 0x5938, 9569, 1, -1 },   // 夸
+    { 0x53e3, 0, 0, 1993 },   // 口
+    { 0x9053, 9570, 1, -1 },   // 道
+    { 0x6597, 9571, 1, -1 },   // 斗
+    { 0x63b3, 9572, 1, -1 },   // 掳
+    { 0x6597, 9573, 1, -1 },   // 斗
+    { 0x4f19, 0, 0, 2038 },   // 伙
+    { 0x80c6, 0, 0, 2040 },   // 胆
+    { 0x5e72, 0, 0, 2042 },   // 干
+    { 0x4f3c, 9574, 1, -1 },   // 似
+    { 0x51b2, 9575, 1, -1 },   // 冲
+    { 0x4e66, 0, 0, 2053 },   // 书
+    { 0x8001, 9576, 1, -1 },   // 老
+    { 0x8fa3, 0, 0, 2065 },   // 辣
+    { 0x662f, 9577, 1, -1 },   // 是
+    { 0x9053, 9578, 1, -1 },   // 道
+    { 0x540e, 0, 0, 2098 },   // 后
+    { 0x8868, 0, 0, 2100 },   // 表
+    { 0x884c, 9579, 1, -1 },   // 行
+    { 0x5fd7, 0, 0, 2110 },   // 志
+    { 0x94c1, 9580, 1, -1 },   // 铁
+    { 0x53f0, 0, 0, 2112 },   // 台
+    { 0x949f, 0, 0, 2113 },   // 钟
+    { 0x53f2, 0, 0, 2115 },   // 史
+    { 0x4e3a, 9581, 1, -1 },   // 为
+    { 0x53f2, 0, 0, 2121 },   // 史
+    { 0x5b9d, 9582, 1, -1 },   // 宝
+    { 0x7d2f, 0, 0, 2126 },   // 累
+    { 0x91cc, 0, 0, 2127 },   // 里
+    { 0x91cc, 0, 0, 2133 },   // 里
+    { 0x677e, 0, 0, 2145 },   // 松
+    { 0x4e8e, 9583, 1, -1 },   // 于
+    { 0x5343, 9584, 1, -1 },   // 千
+    { 0x51c6, 0, 0, 2159 },   // 准
+    { 0x8868, 0, 0, 2161 },   // 表
+    { 0x949f, 9585, 1, 2162 },   // 钟
+    { 0x53d1, 0, 0, 2164 },   // 发
+    { 0x5e72, 0, 0, 2166 },   // 干
+    { 0x4e2d, 0, 0, 2167 },   // 中
+    { 0x626c, 0, 0, 2168 },   // 扬
+    { 0x660e, 0, 0, 2169 },   // 明
+    { 0x6f14, 0, 0, 2170 },   // 演
+    { 0x73b0, 0, 0, 2171 },   // 现
+    { 0x8fbe, 0, 0, 2172 },   // 达
+    { 0x540e, 0, 0, 2179 },   // 后
+    { 0x91cc, 0, 0, 2180 },   // 里
+    { 0x4f1a, 0, 0, 2185 },   // 会
+    { 0x949f, 9586, 2, 2186 },   // 钟
+    { 0x91cc, 0, 0, 2190 },   // 里
+    { 0x9762, 0, 0, 2191 },   // 面
+    { 0x5347, 0, 0, 2194 },   // 升
+    { 0x4f59, 9588, 1, -1 },   // 余
+    { 0x4f5b, 0, 0, 2203 },   // 佛
+    { 0x7cbe, 9589, 1, -1 },   // 精
+    { 0x6240, 9590, 1, -1 },   // 所
+    { 0x80fd, 0, 0, 2212 },   // 能
+    { 0x540e, 0, 0, 2230 },   // 后
+    { 0x5c14, 9591, 1, -1 },   // 尔
+    { 0x949f, 9592, 1, -1 },   // 钟
+    { 0x80e1, 0, 0, 2242 },   // 胡
+    { 0x6709, 0, 0, 2243 },   // 有
+    { 0x7684, 0, 0, 2244 },   // 的
+    { 0x6c34, 9593, 1, -1 },   // 水
+    { 0x4e91, 9594, 1, -1 },   // 云
+    { 0x533b, 9595, 1, -1 },   // 医
+    { 0x53f0, 0, 0, 2277 },   // 台
+    { 0x53f3, 9596, 1, -1 },   // 右
+    { 0x53f2, 0, 0, 2280 },   // 史
+    { 0x5e72, 0, 0, 2285 },   // 干
+    { 0x672f, 0, 0, 2286 },   // 术
+    { 0x7684, 0, 0, 2289 },   // 的
+    { 0x9e1f, 9597, 1, 2291 },   // 鸟
+    { 0x6765, 9598, 1, -1 },   // 来
+    { 0x53f0, 0, 0, 2302 },   // 台
+    { 0x4fee, 9599, 1, -1 },   // 修
+    { 0x91cc, 0, 0, 2315 },   // 里
+    { 0x53bb, 0, 0, 2317 },   // 去
+    { 0x4e86, 0, 0, 2318 },   // 了
+    { 0x6210, 0, 0, 2319 },   // 成
+    { 0x591f, 0, 0, 2322 },   // 够
+    { 0x4e48, 0, 0, 2331 },   // 么
+    { 0x7248, 0, 0, 2339 },   // 版
+    { 0x5265, 0, 0, 2340 },   // 剥
+    { 0x4ed8, 0, 0, 2359 },   // 付
+    { 0x6d01, 9600, 1, -1 },   // 洁
+    { 0x4e8b, 0, 0, 2361 },   // 事
+    { 0x4e8b, 0, 0, 2363 },   // 事
+    { 0x624d, 0, 0, 2366 },   // 才
+    { 0x6a5b, 0, 0, 2378 },   // 橛
+    { 0x51c0, 9601, 1, -1 },   // 净
+    { 0x6cb9, 0, 0, 2388 },   // 油
+    { 0x96f7, 0, 0, 2390 },   // 雷
+    { 0x9762, 0, 0, 2392 },   // 面
+    { 0x53f0, 0, 0, 2395 },   // 台
+    { 0x4e0b, 0, 0, 2396 },   // 下
+    { 0x524c, 0, 0, 2398 },   // 剌
+    { 0x652f, 0, 0, 2399 },   // 支
+    { 0x6c99, 0, 0, 2404 },   // 沙
+    { 0x70c8, 9602, 1, -1 },   // 烈
+    { 0x76cf, 0, 0, 2426 },   // 盏
+    { 0x4e4b, 9603, 1, -1 },   // 之
+    { 0x6e29, 9604, 1, -1 },   // 温
+    { 0x4e48, 0, 0, 2437 },   // 么
+    { 0x53d7, 0, 0, 2438 },   // 受
+    { 0x5b50, 0, 0, 2439 },   // 子
+    { 0x513f, 0, 0, 2448 },   // 儿
+    { 0x8461, 9605, 1, -1 },   // 葡
+    { 0x4e8b, 0, 0, 2451 },   // 事
+    { 0x597d, 9606, 1, -1 },   // 好
+    { 0x773c, 0, 0, 2454 },   // 眼
+    { 0x7247, 0, 0, 2459 },   // 片
+    { 0x8461, 9607, 1, -1 },   // 葡
+    { 0x80de, 0, 0, 2468 },   // 胞
+    { 0x5173, 9608, 1, -1 },   // 关
+    { 0x7247, 0, 0, 2474 },   // 片
+    { 0x9762, 0, 0, 2478 },   // 面
+    { 0x814a, 0, 0, 2481 },   // 腊
+    { 0x94b1, 0, 0, 2482 },   // 钱
+    { 0x751f, 0, 0, 2485 },   // 生
+    { 0x6d46, 0, 0, 2490 },   // 浆
+    { 0x6765, 0, 0, 2496 },   // 来
+    { 0x6bcd, 0, 0, 2504 },   // 母
+    { 0x5976, 0, 0, 2509 },   // 奶
+    { 0x4e71, 0, 0, 2511 },   // 乱
+    { 0x547d, 0, 0, 2513 },   // 命
+    { 0x5f53, 9609, 1, -1 },   // 当
+    { 0x91cc, 0, 0, 2523 },   // 里
+    { 0x53f2, 0, 0, 2525 },   // 史
+    { 0x6b21, 0, 0, 2526 },   // 次
+    { 0x4e0d, 9610, 1, -1 },   // 不
+    { 0x4e00, 9611, 2, -1 },   // 一
+    { 0x52a8, 0, 0, 2538 },   // 动
+    { 0x578b, 9613, 1, -1 },   // 型
+    { 0x5c55, 0, 0, 2540 },   // 展
+    { 0x5e03, 0, 0, 2541 },   // 布
+    { 0x6a21, 9614, 1, -1 },   // 模
+    { 0x73b0, 0, 0, 2543 },   // 现
+    { 0x75c7, 0, 0, 2544 },   // 症
+    { 0x8868, 0, 0, 2545 },   // 表
+    { 0x91cd, 9615, 1, -1 },   // 重
+    { 0x4e0b, 0, 0, 2551 },   // 下
+    { 0x5165, 9616, 1, -1 },   // 入
+    { 0x5b50, 0, 0, 2558 },   // 子
+    { 0x80e1, 0, 0, 2565 },   // 胡
+    { 0x91cc, 0, 0, 2568 },   // 里
+    { 0x5730, 9617, 1, -1 },   // 地
+    { 0x53f2, 0, 0, 2575 },   // 史
+    { 0x5f97, 0, 0, 2582 },   // 得
+    { 0x6270, 0, 0, 2589 },   // 扰
+    { 0x9884, 0, 0, 2590 },   // 预
+    { 0x524d, 0, 0, 2597 },   // 前
+    { 0x540e, 0, 0, 2598 },   // 后
+    { 0x8f9f, 9618, 1, -1 },   // 辟
+    { 0x80f8, 0, 0, 2613 },   // 胸
+    { 0x540a, 9619, 1, -1 },   // 吊
+    { 0x53f2, 0, 0, 2619 },   // 史
+    { 0x4e30, 0, 0, 2621 },   // 丰
+    { 0x4e8e, 9620, 1, -1 },   // 于
+    { 0x829d, 0, 0, 2625 },   // 芝
+    { 0x904d, 9621, 1, -1 },   // 遍
+    { 0x53f0, 0, 0, 2633 },   // 台
+    { 0x53f0, 0, 0, 2634 },   // 台
+    { 0x4f5c, 9622, 1, -1 },   // 作
+    { 0x4e01, 9623, 1, -1 },   // 丁
+    { 0x7f51, 0, 0, 2648 },   // 网
+    { 0x5f71, 9624, 1, -1 },   // 影
+    { 0x540a, 0, 0, 2653 },   // 吊
+    { 0x5f0f, 0, 0, 2655 },   // 式
+    { 0x65e0, 9625, 1, -1 },   // 无
+    { 0x8d23, 9626, 1, -1 },   // 责
+    { 0x53ec, 9627, 1, -1 },   // 召
+    { 0x5fd7, 0, 0, 2713 },   // 志
+    { 0x7a7a, 9628, 1, -1 },   // 空
+    { 0x56de, 9629, 1, -1 },   // 回
+    { 0x5e72, 9630, 1, -1 },   // 干
+    { 0x5c71, 0, 0, 2723 },   // 山
+    { 0x4e00, 0, 0, 2726 },   // 一
+    { 0x4e07, 0, 0, 2727 },   // 万
+    { 0x4e16, 0, 0, 2728 },   // 世
+    { 0x4e1c, 0, 0, 2729 },   // 东
+    { 0x4e24, 0, 0, 2730 },   // 两
+    { 0x4e2d, 0, 0, 2731 },   // 中
+    { 0x4e54, 0, 0, 2732 },   // 乔
+    { 0x4e94, 0, 0, 2733 },   // 五
+    { 0x4eac, 0, 0, 2734 },   // 京
+    { 0x4eba, 0, 0, 2735 },   // 人
+    { 0x4ed6, 0, 0, 2736 },   // 他
+    { 0x4f0a, 0, 0, 2737 },   // 伊
+    { 0x4f17, 0, 0, 2738 },   // 众
+    { 0x4f20, 0, 0, 2739 },   // 传
+    { 0x4f55, 0, 0, 2740 },   // 何
+    { 0x4f60, 0, 0, 2741 },   // 你
+    { 0x5065, 0, 0, 2742 },   // 健
+    { 0x5168, 0, 0, 2743 },   // 全
+    { 0x5170, 0, 0, 2744 },   // 兰
+    { 0x519c, 0, 0, 2745 },   // 农
+    { 0x529f, 0, 0, 2746 },   // 功
+    { 0x52a8, 0, 0, 2747 },   // 动
+    { 0x52df, 0, 0, 2748 },   // 募
+    { 0x5317, 0, 0, 2749 },   // 北
+    { 0x5341, 0, 0, 2750 },   // 十
+    { 0x5343, 0, 0, 2751 },   // 千
+    { 0x5357, 0, 0, 2752 },   // 南
+    { 0x53f0, 0, 0, 2753 },   // 台
+    { 0x548c, 0, 0, 2754 },   // 和
+    { 0x54ea, 0, 0, 2755 },   // 哪
+    { 0x5510, 0, 0, 2756 },   // 唐
+    { 0x5631, 0, 0, 2757 },   // 嘱
+    { 0x56db, 0, 0, 2758 },   // 四
+    { 0x56f0, 0, 0, 2759 },   // 困
+    { 0x56fd, 0, 0, 2760 },   // 国
+    { 0x5728, 0, 0, 2761 },   // 在
+    { 0x5730, 0, 0, 2762 },   // 地
+    { 0x5927, 0, 0, 2763 },   // 大
+    { 0x5929, 0, 0, 2764 },   // 天
+    { 0x592b, 0, 0, 2765 },   // 夫
+    { 0x5965, 0, 0, 2766 },   // 奥
+    { 0x5973, 0, 0, 2767 },   // 女
+    { 0x5979, 0, 0, 2768 },   // 她
+    { 0x5987, 0, 0, 2769 },   // 妇
+    { 0x59bb, 0, 0, 2770 },   // 妻
+    { 0x5b50, 0, 0, 2771 },   // 子
+    { 0x5b83, 0, 0, 2772 },   // 它
+    { 0x5ba3, 0, 0, 2773 },   // 宣
+    { 0x5bb6, 0, 0, 2774 },   // 家
+    { 0x5bcc, 0, 0, 2775 },   // 富
+    { 0x5c0f, 0, 0, 2776 },   // 小
+    { 0x5c71, 0, 0, 2777 },   // 山
+    { 0x5ddd, 0, 0, 2778 },   // 川
+    { 0x5e7c, 0, 0, 2779 },   // 幼
+    { 0x5e7f, 0, 0, 2780 },   // 广
+    { 0x5f7c, 0, 0, 2781 },   // 彼
+    { 0x5fb7, 0, 0, 2782 },   // 德
+    { 0x60a8, 0, 0, 2783 },   // 您
+    { 0x6148, 0, 0, 2784 },   // 慈
+    { 0x6211, 0, 0, 2785 },   // 我
+    { 0x6469, 0, 0, 2786 },   // 摩
+    { 0x6545, 0, 0, 2787 },   // 故
+    { 0x65b0, 0, 0, 2788 },   // 新
+    { 0x65e5, 0, 0, 2789 },   // 日
+    { 0x660c, 0, 0, 2790 },   // 昌
+    { 0x6653, 0, 0, 2791 },   // 晓
+    { 0x66fc, 0, 0, 2792 },   // 曼
+    { 0x6797, 0, 0, 2793 },   // 林
+    { 0x6bcd, 0, 0, 2794 },   // 母
+    { 0x6c11, 0, 0, 2795 },   // 民
+    { 0x6c5f, 0, 0, 2796 },   // 江
+    { 0x6c76, 0, 0, 2797 },   // 汶
+    { 0x6c88, 0, 0, 2798 },   // 沈
+    { 0x6c99, 0, 0, 2799 },   // 沙
+    { 0x6cf0, 0, 0, 2800 },   // 泰
+    { 0x6d59, 0, 0, 2801 },   // 浙
+    { 0x6e2f, 0, 0, 2802 },   // 港
+    { 0x6e56, 0, 0, 2803 },   // 湖
+    { 0x6fb3, 0, 0, 2804 },   // 澳
+    { 0x707e, 0, 0, 2805 },   // 灾
+    { 0x7236, 0, 0, 2806 },   // 父
+    { 0x751f, 0, 0, 2807 },   // 生
+    { 0x75c5, 0, 0, 2808 },   // 病
+    { 0x767e, 0, 0, 2809 },   // 百
+    { 0x7684, 0, 0, 2810 },   // 的
+    { 0x793e, 0, 0, 2811 },   // 社
+    { 0x7956, 0, 0, 2812 },   // 祖
+    { 0x795e, 0, 0, 2813 },   // 神
+    { 0x7ea2, 0, 0, 2814 },   // 红
+    { 0x7f8e, 0, 0, 2815 },   // 美
+    { 0x7fa4, 0, 0, 2816 },   // 群
+    { 0x8001, 0, 0, 2817 },   // 老
+    { 0x821e, 0, 0, 2818 },   // 舞
+    { 0x82f1, 0, 0, 2819 },   // 英
+    { 0x8336, 0, 0, 2820 },   // 茶
+    { 0x897f, 0, 0, 2821 },   // 西
+    { 0x8d2b, 0, 0, 2822 },   // 贫
+    { 0x8f93, 0, 0, 2823 },   // 输
+    { 0x8fd1, 0, 0, 2824 },   // 近
+    { 0x8fdc, 0, 0, 2825 },   // 远
+    { 0x9009, 0, 0, 2826 },   // 选
+    { 0x91cd, 0, 0, 2827 },   // 重
+    { 0x957f, 0, 0, 2828 },   // 长
+    { 0x962e, 0, 0, 2829 },   // 阮
+    { 0x9707, 0, 0, 2830 },   // 震
+    { 0x975e, 0, 0, 2831 },   // 非
+    { 0x98ce, 0, 0, 2832 },   // 风
+    { 0x9999, 0, 0, 2833 },   // 香
+    { 0x9ad8, 0, 0, 2834 },   // 高
+    { 0x9ea6, 0, 0, 2835 },   // 麦
+    { 0x9ec4, 0, 0, 2836 },   // 黄
+    { 0x5982, 9631, 1, -1 },   // 如
+    { 0x75f3, 9632, 1, -1 },   // 痳
+    { 0x9762, 0, 0, 2842 },   // 面
+    { 0x53d1, 9633, 1, -1 },   // 发
+    { 0x5077, 9634, 1, -1 },   // 偷
+    { 0x5f53, 9635, 1, -1 },   // 当
+    { 0x5e72, 0, 0, 2868 },   // 干
+    { 0x51b2, 9636, 1, -1 },   // 冲
+    { 0x51b2, 9637, 1, -1 },   // 冲
+    { 0x51b2, 9638, 1, -1 },   // 冲
+    { 0x6cc9, 9639, 1, -1 },   // 泉
+    { 0x800c, 9640, 1, -1 },   // 而
+    { 0x626d, 9641, 1, -1 },   // 扭
+    { 0x51b2, 9642, 1, -1 },   // 冲
+    { 0x602a, 9643, 1, -1 },   // 怪
+    { 0x53ea, 0, 0, 2882 },   // 只
+    { 0x91cc, 0, 0, 2883 },   // 里
+    { 0x5236, 0, 0, 2884 },   // 制
+    { 0x4e0d, 9644, 1, -1 },   // 不
+    { 0x7edd, 9645, 1, -1 },   // 绝
+    { 0x4e11, 9646, 1, -1 },   // 丑
+    { 0x8361, 9647, 1, -1 },   // 荡
+    { 0x6881, 0, 0, 2915 },   // 梁
+    { 0x7a92, 9648, 1, -1 },   // 窒
+    { 0x5229, 9649, 1, -1 },   // 利
+    { 0x614c, 9650, 1, -1 },   // 慌
+    { 0x601d, 0, 0, 2959 },   // 思
+    { 0x6597, 9651, 1, -1 },   // 斗
+    { 0x542b, 9652, 1, -1 },   // 含
+    { 0x8c37, 9653, 1, -1 },   // 谷
+    { 0x6cbb, 9654, 1, -1 },   // 治
+    { 0x51b3, 0, 0, 2978 },   // 决
+    { 0x6001, 0, 0, 2979 },   // 态
+    { 0x73b0, 0, 0, 2980 },   // 现
+    { 0x8fbe, 0, 0, 2981 },   // 达
+    { 0x5251, 0, 0, 2983 },   // 剑
+    { 0x6270, 0, 0, 2986 },   // 扰
+    { 0x9884, 0, 0, 2987 },   // 预
+    { 0x5b50, 0, 0, 2994 },   // 子
+    { 0x549a, 0, 0, 3007 },   // 咚
+    { 0x540a, 9655, 1, -1 },   // 吊
+    { 0x949f, 0, 0, 3010 },   // 钟
+    { 0x54d5, 0, 0, 3013 },   // 哕
+    { 0x53d1, 0, 0, 3015 },   // 发
+    { 0x540e, 0, 0, 3018 },   // 后
+    { 0x900a, 0, 0, 3025 },   // 逊
+    { 0x8bbd, 9656, 1, -1 },   // 讽
+    { 0x56fd, 0, 0, 3038 },   // 国
+    { 0x53bf, 0, 0, 3045 },   // 县
+    { 0x6881, 0, 0, 3047 },   // 梁
+    { 0x786e, 9657, 1, -1 },   // 确
+    { 0x62ca, 9658, 1, -1 },   // 拊
+    { 0x620f, 0, 0, 3072 },   // 戏
+    { 0x6563, 9659, 1, -1 },   // 散
+    { 0x91c7, 9660, 1, -1 },   // 采
+    { 0x800c, 9661, 1, -1 },   // 而
+    { 0x6000, 9662, 1, -1 },   // 怀
+    { 0x7b7e, 0, 0, 3099 },   // 签
+    { 0x65e0, 9663, 1, -1 },   // 无
+    { 0x9762, 0, 0, 3105 },   // 面
+    { 0x9762, 0, 0, 3106 },   // 面
+    { 0x65bd, 9664, 1, -1 },   // 施
+    { 0x65e0, 0, 0, 3112 },   // 无
+    { 0x4ed1, 0, 0, 3137 },   // 仑
+    { 0x6881, 0, 0, 3144 },   // 梁
+    { 0x8868, 0, 0, 3157 },   // 表
+    { 0x515a, 0, 0, 3169 },   // 党
+    { 0x7ec6, 0, 0, 3170 },   // 细
+    { 0x8d3c, 0, 0, 3171 },   // 贼
+    { 0x4eba, 0, 0, 3173 },   // 人
+    { 0x540a, 9665, 1, -1 },   // 吊
+    { 0x5386, 0, 0, 3189 },   // 历
+    { 0x90e8, 0, 0, 3191 },   // 部
+    { 0x9762, 0, 0, 3192 },   // 面
+    { 0x51c6, 9666, 1, -1 },   // 准
+    { 0x4e4b, 9667, 1, -1 },   // 之
+    { 0x5e72, 0, 0, 3203 },   // 干
+    { 0x540a, 9668, 1, -1 },   // 吊
+    { 0x592a, 9669, 1, -1 },   // 太
+    { 0x540e, 0, 0, 3206 },   // 后
+    { 0x94fa, 0, 0, 3223 },   // 铺
+    { 0x83b7, 9670, 1, -1 },   // 获
+    { 0x51b2, 9671, 1, -1 },   // 冲
+    { 0x949f, 0, 0, 3250 },   // 钟
+    { 0x6b32, 0, 0, 3256 },   // 欲
+    { 0x6323, 0, 0, 3260 },   // 挣
+    { 0x540c, 9672, 1, -1 },   // 同
+    { 0x949f, 0, 0, 3266 },   // 钟
+    { 0x4e86, 9673, 1, -1 },   // 了
+    { 0x4f1a, 0, 0, 3277 },   // 会
+    { 0x5305, 9674, 1, -1 },   // 包
+    { 0x53ef, 0, 0, 3279 },   // 可
+    { 0x542b, 0, 0, 3280 },   // 含
+    { 0x5728, 0, 0, 3281 },   // 在
+    { 0x5e94, 0, 0, 3282 },   // 应
+    { 0x662f, 0, 0, 3283 },   // 是
+    { 0x6709, 0, 0, 3284 },   // 有
+    { 0x6bd4, 0, 0, 3285 },   // 比
+    { 0x80fd, 0, 0, 3286 },   // 能
+    { 0x9650, 0, 0, 3287 },   // 限
+    { 0x9700, 0, 0, 3288 },   // 需
+    { 0x987b, 0, 0, 3289 },   // 须
+    { 0x540e, 0, 0, 3290 },   // 后
+    { 0x949f, 9675, 1, 3291 },   // 钟
+    { 0x5e76, 9676, 1, -1 },   // 并
+    { 0x5267, 0, 0, 3295 },   // 剧
+    { 0x620f, 0, 0, 3296 },   // 戏
+    { 0x7535, 9677, 1, -1 },   // 电
+    { 0x7528, 9678, 1, -1 },   // 用
+    { 0x540e, 0, 0, 3300 },   // 后
+    { 0x5fd7, 0, 0, 3301 },   // 志
+    { 0x660e, 0, 0, 3302 },   // 明
+    { 0x6cc9, 9679, 1, -1 },   // 泉
+    { 0x8fc7, 0, 0, 3306 },   // 过
+    { 0x6597, 9680, 1, -1 },   // 斗
+    { 0x5b50, 0, 0, 3313 },   // 子
+    { 0x6c14, 0, 0, 3314 },   // 气
+    { 0x513f, 0, 0, 3320 },   // 儿
+    { 0x5b50, 0, 0, 3321 },   // 子
+    { 0x4e3b, 0, 0, 3325 },   // 主
+    { 0x5b50, 0, 0, 3331 },   // 子
+    { 0x773c, 0, 0, 3335 },   // 眼
+    { 0x6539, 0, 0, 3340 },   // 改
+    { 0x6597, 9681, 1, -1 },   // 斗
+    { 0x62cc, 9682, 1, -1 },   // 拌
+    { 0x6597, 9683, 1, -1 },   // 斗
+    { 0x53f0, 0, 0, 3355 },   // 台
+    { 0x8349, 0, 0, 3359 },   // 草
+    { 0x6279, 9684, 1, -1 },   // 批
+    { 0x94f8, 9685, 2, -1 },   // 铸
+    { 0x87c0, 0, 0, 3371 },   // 蟀
+    { 0x6c14, 0, 0, 3376 },   // 气
+    { 0x7ea2, 0, 0, 3378 },   // 红
+    { 0x9e51, 0, 0, 3383 },   // 鹑
+    { 0x4e3a, 9687, 1, -1 },   // 为
+    { 0x6587, 9688, 1, -1 },   // 文
+    { 0x53f2, 0, 0, 3391 },   // 史
+    { 0x53bf, 0, 0, 3392 },   // 县
+    { 0x4e3a, 9689, 1, -1 },   // 为
+    { 0x9762, 0, 0, 3395 },   // 面
+    { 0x91cc, 0, 0, 3396 },   // 里
+    { 0x535a, 9690, 1, -1 },   // 博
+    { 0x6e38, 9691, 1, -1 },   // 游
+    { 0x4e0d, 9692, 1, -1 },   // 不
+    { 0x697c, 9693, 1, -1 },   // 楼
+    { 0x53f2, 0, 0, 3410 },   // 史
+    { 0x5386, 9694, 1, -1 },   // 历
+    { 0x53f2, 0, 0, 3416 },   // 史
+    { 0x8868, 0, 0, 3420 },   // 表
+    { 0x4e0d, 9695, 1, -1 },   // 不
+    { 0x6e56, 0, 0, 3431 },   // 湖
+    { 0x4e0d, 9696, 1, -1 },   // 不
+    { 0x5f20, 9697, 1, -1 },   // 张
+    { 0x51c0, 9698, 1, -1 },   // 净
+    { 0x53f2, 0, 0, 3444 },   // 史
+    { 0x540e, 0, 0, 3445 },   // 后
+    { 0x8c37, 9699, 1, -1 },   // 谷
+    { 0x6597, 9700, 1, -1 },   // 斗
+    { 0x5c0f, 0, 0, 3449 },   // 小
+    { 0x8868, 9701, 7, 3453 },   // 表
+    { 0x949f, 9708, 1, 3461 },   // 钟
+    { 0x549a, 0, 0, 3475 },   // 咚
+    { 0x91cc, 0, 0, 3478 },   // 里
+    { 0x91cc, 0, 0, 3480 },   // 里
+    { 0x6a2a, 9709, 1, -1 },   // 横
+    { 0x624d, 0, 0, 3486 },   // 才
+    { 0x58eb, 0, 0, 3488 },   // 士
+    { 0x96be, 9710, 1, -1 },   // 难
+    { 0x53f2, 0, 0, 3496 },   // 史
+    { 0x5386, 9711, 1, -1 },   // 历
+    { 0x6765, 0, 0, 3498 },   // 来
+    { 0x4e4b, 9712, 1, -1 },   // 之
+    { 0x5934, 9713, 1, -1 },   // 头
+    { 0x91c7, 0, 0, 3505 },   // 采
+    { 0x590d, 0, 0, 3506 },   // 复
+    { 0x8d5e, 0, 0, 3507 },   // 赞
+    { 0x6218, 0, 0, 3509 },   // 战
+    { 0x8ba8, 0, 0, 3510 },   // 讨
+    { 0x6709, 9714, 1, -1 },   // 有
+    { 0x4e8e, 0, 0, 3513 },   // 于
+    { 0x620f, 9715, 1, -1 },   // 戏
+    { 0x5e72, 9716, 1, -1 },   // 干
+    { 0x9884, 0, 0, 3522 },   // 预
+    { 0x620f, 0, 0, 3523 },   // 戏
+    { 0x9ad8, 0, 0, 3526 },   // 高
+    { 0x4f59, 0, 0, 3528 },   // 余
+    { 0x5b89, 9717, 1, -1 },   // 安
+    { 0x65af, 0, 0, 3532 },   // 斯
+    { 0x4ec1, 0, 0, 3536 },   // 仁
+    { 0x7cfb, 0, 0, 3552 },   // 系
+    { 0x8868, 0, 0, 3553 },   // 表
+    { 0x949f, 9718, 1, 3554 },   // 钟
+    { 0x9762, 9719, 1, -1 },   // 面
+    { 0x6770, 0, 0, 3565 },   // 杰
+    { 0x53d1, 0, 0, 3567 },   // 发
+    { 0x6709, 0, 0, 3568 },   // 有
+    { 0x7684, 0, 0, 3569 },   // 的
+    { 0x5cf0, 0, 0, 3570 },   // 峰
+    { 0x5fd7, 9720, 1, -1 },   // 志
+    { 0x65e0, 9721, 1, -1 },   // 无
+    { 0x91cc, 0, 0, 3578 },   // 里
+    { 0x7b51, 0, 0, 3581 },   // 筑
+    { 0x5c14, 0, 0, 3587 },   // 尔
+    { 0x53e3, 9722, 1, -1 },   // 口
+    { 0x97f3, 0, 0, 3591 },   // 音
+    { 0x9547, 0, 0, 3596 },   // 镇
+    { 0x5730, 0, 0, 3607 },   // 地
+    { 0x53bf, 0, 0, 3611 },   // 县
+    { 0x5408, 0, 0, 3615 },   // 合
+    { 0x5cb3, 0, 0, 3625 },   // 岳
+    { 0x5cf0, 0, 0, 3627 },   // 峰
+    { 0x5e72, 0, 0, 3628 },   // 干
+    { 0x7d2f, 0, 0, 3630 },   // 累
+    { 0x751f, 0, 0, 3645 },   // 生
+    { 0x540e, 0, 0, 3650 },   // 后
+    { 0x5f81, 0, 0, 3652 },   // 征
+    { 0x81f4, 9723, 1, -1 },   // 致
+    { 0x5de5, 0, 0, 3665 },   // 工
+    { 0x91cc, 0, 0, 3674 },   // 里
+    { 0x5386, 0, 0, 3684 },   // 历
+    { 0x9ad8, 9724, 1, -1 },   // 高
+    { 0x5e72, 0, 0, 3687 },   // 干
+    { 0x53f2, 0, 0, 3690 },   // 史
+    { 0x8d85, 0, 0, 3706 },   // 超
+    { 0x9762, 0, 0, 3720 },   // 面
+    { 0x91cc, 0, 0, 3722 },   // 里
+    { 0x767b, 0, 0, 3730 },   // 登
+    { 0x91cc, 0, 0, 3736 },   // 里
+    { 0x5e72, 0, 0, 3745 },   // 干
+    { 0x4e09, 9725, 1, -1 },   // 三
+    { 0x53bf, 0, 0, 3761 },   // 县
+    { 0x66b4, 9726, 1, -1 },   // 暴
+    { 0x667a, 9727, 1, -1 },   // 智
+    { 0x96be, 9728, 1, -1 },   // 难
+    { 0x96be, 9729, 1, -1 },   // 难
+    { 0x91cc, 0, 0, 3785 },   // 里
+    { 0x6c42, 9730, 1, -1 },   // 求
+    { 0x9003, 9731, 1, -1 },   // 逃
+    { 0x725b, 9732, 1, -1 },   // 牛
+    { 0x81ea, 9733, 1, -1 },   // 自
+    { 0x4e3a, 9734, 1, -1 },   // 为
+    { 0x53d1, 9735, 1, -1 },   // 发
+    { 0x6597, 9736, 1, -1 },   // 斗
+    { 0x6d41, 0, 0, 3831 },   // 流
+    { 0x6c64, 9737, 1, -1 },   // 汤
+    { 0x53f2, 0, 0, 3836 },   // 史
+    { 0x4e0d, 9738, 1, -1 },   // 不
+    { 0x6b32, 0, 0, 3838 },   // 欲
+    { 0x767b, 9739, 1, -1 },   // 登
+    { 0x6d41, 0, 0, 3847 },   // 流
+    { 0x9762, 0, 0, 3851 },   // 面
+    { 0x5ba2, 9740, 1, -1 },   // 客
+    { 0x7ebf, 0, 0, 3858 },   // 线
+    { 0x94c1, 9741, 1, -1 },   // 铁
+    { 0x9ad8, 0, 0, 3860 },   // 高
+    { 0x7ebf, 0, 0, 3863 },   // 线
+    { 0x94c1, 9742, 1, -1 },   // 铁
+    { 0x9ad8, 9743, 1, -1 },   // 高
+    { 0x7ebf, 0, 0, 3866 },   // 线
+    { 0x94c1, 9744, 1, -1 },   // 铁
+    { 0x94c1, 9745, 1, -1 },   // 铁
+    { 0x9ad8, 9746, 1, -1 },   // 高
+    { 0x6dd8, 9747, 1, -1 },   // 淘
+    { 0x5e72, 0, 0, 3884 },   // 干
+    { 0x6ca1, 9748, 1, -1 },   // 没
+    { 0x81f3, 0, 0, 3888 },   // 至
+    { 0x8303, 0, 0, 3889 },   // 范
+    { 0x9762, 0, 0, 3902 },   // 面
+    { 0x85fb, 0, 0, 3913 },   // 藻
+    { 0x83dc, 0, 0, 3914 },   // 菜
+    { 0x5a18, 9749, 1, -1 },   // 娘
+    { 0x6cc9, 9750, 1, -1 },   // 泉
+    { 0x949f, 0, 0, 3934 },   // 钟
+    { 0x4e1c, 9751, 1, -1 },   // 东
+    { 0x8428, 0, 0, 3950 },   // 萨
+    { 0x4f59, 9752, 2, -1 },   // 余
+    { 0x51c6, 0, 0, 3966 },   // 准
+    { 0x8361, 9754, 1, -1 },   // 荡
+    { 0x5c71, 9755, 1, -1 },   // 山
+    { 0x52cb, 0, 0, 3990 },   // 勋
+    { 0x5e72, 0, 0, 3991 },   // 干
+    { 0x6052, 0, 0, 3992 },   // 恒
+    { 0x6c11, 0, 0, 3993 },   // 民
+    { 0x7143, 0, 0, 3994 },   // 煃
+    { 0x7533, 0, 0, 3995 },   // 申
+    { 0x671b, 0, 0, 3996 },   // 望
+    { 0x94a6, 0, 0, 3997 },   // 钦
+    { 0x533a, 0, 0, 4020 },   // 区
+    { 0x4e0d, 9756, 1, -1 },   // 不
+    { 0x7247, 0, 0, 4024 },   // 片
+    { 0x7269, 0, 0, 4029 },   // 物
+    { 0x4e4b, 9757, 1, -1 },   // 之
+    { 0x571f, 0, 0, 4031 },   // 土
+    { 0x8499, 0, 0, 4033 },   // 蒙
+    { 0x4f55, 9758, 1, -1 },   // 何
+    { 0x91cc, 0, 0, 4038 },   // 里
+    { 0x5cb3, 9759, 1, -1 },   // 岳
+    { 0x514b, 9760, 1, -1 },   // 克
+    { 0x73a9, 9761, 1, -1 },   // 玩
+    { 0x6709, 9762, 1, -1 },   // 有
+    { 0x91cc, 0, 0, 4078 },   // 里
+    { 0x597d, 9763, 1, -1 },   // 好
+    { 0x5361, 9764, 1, -1 },   // 卡
+    { 0x9a8b, 9765, 1, -1 },   // 骋
+    { 0x5b66, 9766, 1, -1 },   // 学
+    { 0x5175, 0, 0, 4108 },   // 兵
+    { 0x6d0b, 9767, 1, -1 },   // 洋
+    { 0x5f53, 9768, 1, -1 },   // 当
+    { 0x91cc, 9769, 1, -1 },   // 里
+    { 0x8bc6, 9770, 1, -1 },   // 识
+    { 0x8868, 0, 0, 4155 },   // 表
+    { 0x949f, 9771, 1, 4156 },   // 钟
+    { 0x53bf, 0, 0, 4161 },   // 县
+    { 0x91cc, 0, 0, 4170 },   // 里
+    { 0x975e, 0, 0, 4172 },   // 非
+    { 0x5b50, 0, 0, 4173 },   // 子
+    { 0x8499, 0, 0, 4178 },   // 蒙
+    { 0x9762, 0, 0, 4192 },   // 面
+    { 0x8d5e, 0, 0, 4194 },   // 赞
+    { 0x949f, 0, 0, 4195 },   // 钟
+    { 0x949f, 0, 0, 4196 },   // 钟
+    { 0x7a0b, 0, 0, 4200 },   // 程
+    { 0x672f, 0, 0, 4214 },   // 术
+    { 0x4e2a, 9772, 1, -1 },   // 个
+    { 0x6b21, 9773, 1, -1 },   // 次
+    { 0x53d1, 0, 0, 4236 },   // 发
+    { 0x53d1, 0, 0, 4238 },   // 发
+    { 0x53d1, 0, 0, 4239 },   // 发
+    { 0x7b7e, 0, 0, 4250 },   // 签
+    { 0x5e72, 9774, 1, -1 },   // 干
+    { 0x7965, 9775, 1, -1 },   // 祥
+    { 0x91cc, 9776, 1, -1 },   // 里
+    { 0x53ea, 9777, 1, -1 },   // 只
+    { 0x91cc, 0, 0, 4274 },   // 里
+    { 0x53d1, 0, 0, 4281 },   // 发
+    { 0x8ba2, 0, 0, 4284 },   // 订
+    { 0x8868, 0, 0, 4291 },   // 表
+    { 0x949f, 9778, 1, 4292 },   // 钟
+    { 0x6f6e, 0, 0, 4294 },   // 潮
+    { 0x864e, 9779, 1, -1 },   // 虎
+    { 0x5236, 0, 0, 4299 },   // 制
+    { 0x8e4a, 9780, 1, -1 },   // 蹊
+    { 0x53f2, 0, 0, 4320 },   // 史
+    { 0x9c7c, 0, 0, 4321 },   // 鱼
+    { 0x5f02, 9781, 1, -1 },   // 异
+    { 0x4e2a, 9782, 1, -1 },   // 个
+    { 0x6b21, 9783, 1, -1 },   // 次
+    { 0x53d1, 0, 0, 4339 },   // 发
+    { 0x53d1, 0, 0, 4341 },   // 发
+    { 0x53d1, 0, 0, 4342 },   // 发
+    { 0x9762, 0, 0, 4357 },   // 面
+    { 0x9171, 0, 0, 4358 },   // 酱
+    { 0x9762, 0, 0, 4359 },   // 面
+    { 0x53d1, 0, 0, 4360 },   // 发
+    { 0x751f, 0, 0, 4362 },   // 生
+    { 0x949f, 0, 0, 4364 },   // 钟
+    { 0x91cc, 0, 0, 4366 },   // 里
+    { 0x5236, 9784, 1, -1 },   // 制
+    { 0x8868, 9785, 1, -1 },   // 表
+    { 0x949f, 9786, 1, 4374 },   // 钟
+    { 0x540e, 0, 0, 4376 },   // 后
+    { 0x91cc, 0, 0, 4377 },   // 里
+    { 0x91cc, 0, 0, 4378 },   // 里
+    { 0x949f, 0, 0, 4379 },   // 钟
+    { 0x8868, 0, 0, 4380 },   // 表
+    { 0x53f0, 9787, 1, -1 },   // 台
+    { 0x91cc, 0, 0, 4383 },   // 里
+    { 0x5c55, 0, 0, 4392 },   // 展
+    { 0x751f, 0, 0, 4393 },   // 生
+    { 0x884c, 0, 0, 4394 },   // 行
+    { 0x53d1, 0, 0, 4395 },   // 发
+    { 0x9762, 9788, 1, -1 },   // 面
+    { 0x5176, 9789, 1, -1 },   // 其
+    { 0x513f, 0, 0, 4437 },   // 儿
+    { 0x9762, 0, 0, 4440 },   // 面
+    { 0x900f, 9790, 1, -1 },   // 透
+    { 0x591f, 0, 0, 4446 },   // 够
+    { 0x8db3, 9791, 1, -1 },   // 足
+    { 0x540e, 0, 0, 4448 },   // 后
+    { 0x540e, 0, 0, 4449 },   // 后
+    { 0x5343, 9792, 1, -1 },   // 千
+    { 0x91cc, 0, 0, 4453 },   // 里
+    { 0x5386, 9793, 1, 4454 },   // 历
+    { 0x4e2d, 0, 0, 4457 },   // 中
+    { 0x5c0f, 0, 0, 4458 },   // 小
+    { 0x590d, 0, 0, 4459 },   // 复
+    { 0x91cc, 0, 0, 4460 },   // 里
+    { 0x91cc, 0, 0, 4461 },   // 里
+    { 0x5c06, 0, 0, 4462 },   // 将
+    { 0x53d1, 0, 0, 4464 },   // 发
+    { 0x4f5c, 9794, 1, -1 },   // 作
+    { 0x53f2, 0, 0, 4468 },   // 史
+    { 0x5386, 9795, 1, 4469 },   // 历
+    { 0x6625, 9796, 1, -1 },   // 春
+    { 0x9633, 9797, 1, -1 },   // 阳
+    { 0x600e, 9798, 1, -1 },   // 怎
+    { 0x91cc, 0, 0, 4506 },   // 里
+    { 0x91cc, 0, 0, 4514 },   // 里
+    { 0x91cc, 0, 0, 4515 },   // 里
+    { 0x75c5, 0, 0, 4520 },   // 病
+    { 0x751f, 0, 0, 4530 },   // 生
+    { 0x949f, 9799, 1, 4532 },   // 钟
+    { 0x8868, 0, 0, 4540 },   // 表
+    { 0x793a, 0, 0, 4542 },   // 示
+    { 0x90c1, 9800, 1, -1 },   // 郁
+    { 0x4e3b, 9801, 1, -1 },   // 主
+    { 0x52a8, 0, 0, 4596 },   // 动
+    { 0x5c55, 0, 0, 4597 },   // 展
+    { 0x5e03, 0, 0, 4598 },   // 布
+    { 0x6751, 0, 0, 4599 },   // 村
+    { 0x73b0, 0, 0, 4600 },   // 现
+    { 0x751f, 0, 0, 4601 },   // 生
+    { 0x8868, 0, 0, 4602 },   // 表
+    { 0x8d77, 0, 0, 4603 },   // 起
+    { 0x91cc, 0, 0, 4604 },   // 里
+    { 0x4e4b, 9802, 1, -1 },   // 之
+    { 0x4e2d, 0, 0, 4614 },   // 中
+    { 0x9053, 0, 0, 4615 },   // 道
+    { 0x4e9a, 9803, 1, -1 },   // 亚
+    { 0x5ba2, 9804, 1, -1 },   // 客
+    { 0x9632, 9805, 1, -1 },   // 防
+    { 0x53d1, 0, 0, 4632 },   // 发
+    { 0x7684, 9806, 1, -1 },   // 的
+    { 0x9ed8, 9807, 1, -1 },   // 默
+    { 0x4e0d, 9808, 1, -1 },   // 不
+    { 0x8361, 0, 0, 4649 },   // 荡
+    { 0x63a9, 9809, 1, -1 },   // 掩
+    { 0x51e0, 9810, 1, -1 },   // 几
+    { 0x6597, 0, 0, 4662 },   // 斗
+    { 0x810a, 9811, 1, -1 },   // 脊
+    { 0x4e4b, 9812, 1, -1 },   // 之
+    { 0x53bf, 0, 0, 4675 },   // 县
+    { 0x85cf, 9813, 1, -1 },   // 藏
+    { 0x58a8, 9814, 1, -1 },   // 墨
+    { 0x53d1, 0, 0, 4703 },   // 发
+    { 0x7fce, 0, 0, 4704 },   // 翎
+    { 0x53f2, 0, 0, 4707 },   // 史
+    { 0x5b50, 0, 0, 4730 },   // 子
+    { 0x8511, 9815, 1, -1 },   // 蔑
+    { 0x7cca, 9816, 1, -1 },   // 糊
+    { 0x4e1d, 0, 0, 4748 },   // 丝
+    { 0x4e86, 0, 0, 4749 },   // 了
+    { 0x5934, 0, 0, 4750 },   // 头
+    { 0x5b89, 9817, 1, -1 },   // 安
+    { 0x7ea2, 0, 0, 4752 },   // 红
+    { 0x7ef3, 0, 0, 4753 },   // 绳
+    { 0x9ed1, 0, 0, 4754 },   // 黑
+    { 0x4e00, 9818, 1, -1 },   // 一
+    { 0x91cc, 0, 0, 4758 },   // 里
+    { 0x5e26, 0, 0, 4776 },   // 带
+    { 0x6355, 9819, 1, -1 },   // 捕
+    { 0x91cc, 0, 0, 4779 },   // 里
+    { 0x91cc, 0, 0, 4783 },   // 里
+    { 0x4e0d, 9820, 1, -1 },   // 不
+    { 0x7ed3, 9821, 1, -1 },   // 结
+    { 0x5047, 9822, 1, -1 },   // 假
+    { 0x7cfb, 9823, 1, -1 },   // 系
+    { 0x53f2, 0, 0, 4818 },   // 史
+    { 0x91cc, 0, 0, 4841 },   // 里
+    { 0x5bb9, 9824, 1, -1 },   // 容
+    { 0x53d1, 0, 0, 4851 },   // 发
+    { 0x91cc, 0, 0, 4863 },   // 里
+    { 0x4e91, 0, 0, 4864 },   // 云
+    { 0x540c, 9825, 1, -1 },   // 同
+    { 0x80e1, 0, 0, 4884 },   // 胡
+    { 0x7edf, 0, 0, 4911 },   // 统
+    { 0x540a, 9826, 1, -1 },   // 吊
+    { 0x5f81, 0, 0, 4920 },   // 征
+    { 0x6cd5, 0, 0, 4951 },   // 法
+    { 0x8868, 0, 0, 4952 },   // 表
+    { 0x53d1, 0, 0, 4978 },   // 发
+    { 0x53f0, 0, 0, 4995 },   // 台
+    { 0x91cc, 0, 0, 4996 },   // 里
+    { 0x5386, 9827, 2, 4999 },   // 历
+    { 0x6210, 9829, 1, -1 },   // 成
+    { 0x4e1a, 0, 0, 5009 },   // 业
+    { 0x5b66, 0, 0, 5010 },   // 学
+    { 0x5e08, 0, 0, 5011 },   // 师
+    { 0x5e97, 0, 0, 5012 },   // 店
+    { 0x6c99, 9830, 1, -1 },   // 沙
+    { 0x9986, 0, 0, 5014 },   // 馆
+    { 0x7f8e, 9831, 1, -1 },   // 美
+    { 0x90e8, 0, 0, 5028 },   // 部
+    { 0x949f, 0, 0, 5030 },   // 钟
+    { 0x5e72, 0, 0, 5031 },   // 干
+    { 0x5236, 9832, 1, -1 },   // 制
+    { 0x672f, 9833, 1, -1 },   // 术
+    { 0x5fd7, 9834, 1, -1 },   // 志
+    { 0x96c4, 9835, 1, -1 },   // 雄
+    { 0x9762, 0, 0, 5053 },   // 面
+    { 0x9762, 0, 0, 5057 },   // 面
+    { 0x91cc, 0, 0, 5078 },   // 里
+    { 0x5a74, 0, 0, 5083 },   // 婴
+    { 0x5b89, 0, 0, 5084 },   // 安
+    { 0x80e1, 9836, 1, -1 },   // 胡
+    { 0x6270, 0, 0, 5098 },   // 扰
+    { 0x9884, 0, 0, 5099 },   // 预
+    { 0x673a, 0, 0, 5117 },   // 机
+    { 0x91cc, 0, 0, 5137 },   // 里
+    { 0x9762, 0, 0, 5142 },   // 面
+    { 0x4ea1, 9837, 1, -1 },   // 亡
+    { 0x4e0b, 9838, 1, -1 },   // 下
+    { 0x4e94, 0, 0, 5148 },   // 五
+    { 0x6570, 9839, 1, -1 },   // 数
+    { 0x949f, 0, 0, 5150 },   // 钟
+    { 0x81ea, 9840, 1, -1 },   // 自
+    { 0x51b2, 9841, 1, -1 },   // 冲
+    { 0x5507, 9842, 1, -1 },   // 唇
+    { 0x5f97, 0, 0, 5157 },   // 得
+    { 0x5c31, 9843, 1, -1 },   // 就
+    { 0x4e3a, 9844, 3, -1 },   // 为
+    { 0x4ece, 9847, 1, -1 },   // 从
+    { 0x6551, 9848, 1, -1 },   // 救
+    { 0x5176, 9849, 1, -1 },   // 其
+    { 0x9010, 9850, 1, -1 },   // 逐
+    { 0x5fd8, 9851, 1, -1 },   // 忘
+    { 0x53d6, 9852, 1, -1 },   // 取
+    { 0x4fdd, 9853, 1, -1 },   // 保
+    { 0x6c42, 9854, 1, -1 },   // 求
+    { 0x98ce, 9855, 1, -1 },   // 风
+    { 0x5386, 9856, 1, 5183 },   // 历
+    { 0x53d1, 0, 0, 5193 },   // 发
+    { 0x91cc, 0, 0, 5200 },   // 里
+    { 0x5e72, 0, 0, 5202 },   // 干
+    { 0x8981, 9857, 1, -1 },   // 要
+    { 0x91cc, 0, 0, 5208 },   // 里
+    { 0x8bcd, 9858, 1, -1 },   // 词
+    { 0x540a, 9859, 1, -1 },   // 吊
+    { 0x91cc, 0, 0, 5234 },   // 里
+    { 0x5e72, 0, 0, 5237 },   // 干
+    { 0x6dc0, 0, 0, 5238 },   // 淀
+    { 0x5f62, 9860, 1, -1 },   // 形
+    { 0x6f9c, 0, 0, 5247 },   // 澜
+    { 0x60e0, 0, 0, 5250 },   // 惠
+    { 0x8f7c, 0, 0, 5252 },   // 轼
+    { 0x91cc, 0, 0, 5263 },   // 里
+    { 0x9762, 0, 0, 5271 },   // 面
+    { 0x8361, 9861, 1, -1 },   // 荡
+    { 0x56de, 9862, 1, -1 },   // 回
+    { 0x513f, 0, 0, 5303 },   // 儿
+    { 0x6dc0, 0, 0, 5304 },   // 淀
+    { 0x5176, 9863, 1, -1 },   // 其
+    { 0x83dc, 0, 0, 5323 },   // 菜
+    { 0x5e72, 0, 0, 5324 },   // 干
+    { 0x5e72, 0, 0, 5327 },   // 干
+    { 0x80e1, 0, 0, 5337 },   // 胡
+    { 0x5e72, 0, 0, 5338 },   // 干
+    { 0x5c01, 9864, 1, -1 },   // 封
+    { 0x8f6c, 0, 0, 5347 },   // 转
+    { 0x65e0, 9865, 1, -1 },   // 无
+    { 0x96e8, 0, 0, 5349 },   // 雨
+    { 0x7ec6, 9866, 1, -1 },   // 细
+    { 0x9732, 0, 0, 5357 },   // 露
+    { 0x677e, 0, 0, 5377 },   // 松
+    { 0x53f2, 0, 0, 5391 },   // 史
+    { 0x6b4c, 9867, 1, -1 },   // 歌
+    { 0x76f8, 9868, 1, -1 },   // 相
+    { 0x725b, 9869, 1, -1 },   // 牛
+    { 0x5973, 9870, 1, -1 },   // 女
+    { 0x53d1, 0, 0, 5419 },   // 发
+    { 0x8c03, 9871, 1, -1 },   // 调
+    { 0x5386, 9872, 1, 5446 },   // 历
+    { 0x91cc, 9873, 1, -1 },   // 里
+    { 0x5b50, 0, 0, 5463 },   // 子
+    { 0x4f6f, 9874, 1, -1 },   // 佯
+    { 0x5165, 9875, 1, -1 },   // 入
+    { 0x5de6, 9876, 1, -1 },   // 左
+    { 0x7f28, 9877, 1, -1 },   // 缨
+    { 0x9633, 9878, 1, -1 },   // 阳
+    { 0x540e, 0, 0, 5483 },   // 后
+    { 0x4e0a, 0, 0, 5484 },   // 上
+    { 0x4ee3, 0, 0, 5500 },   // 代
+    { 0x4efb, 0, 0, 5501 },   // 任
+    { 0x53f2, 0, 0, 5502 },   // 史
+    { 0x6b21, 0, 0, 5503 },   // 次
+    { 0x949f, 0, 0, 5504 },   // 钟
+    { 0x89c1, 9879, 1, -1 },   // 见
+    { 0x62b1, 9880, 1, -1 },   // 抱
+    { 0x4e0d, 9881, 1, -1 },   // 不
+    { 0x53d1, 0, 0, 5530 },   // 发
+    { 0x91cc, 0, 0, 5531 },   // 里
+    { 0x4f6f, 9882, 1, -1 },   // 佯
+    { 0x540e, 0, 0, 5535 },   // 后
+    { 0x949f, 0, 0, 5544 },   // 钟
+    { 0x949f, 0, 0, 5545 },   // 钟
+    { 0x949f, 0, 0, 5546 },   // 钟
+    { 0x8868, 0, 0, 5550 },   // 表
+    { 0x8d77, 9883, 1, -1 },   // 起
+    { 0x91cc, 0, 0, 5577 },   // 里
+    { 0x53d1, 0, 0, 5588 },   // 发
+    { 0x91cc, 0, 0, 5606 },   // 里
+    { 0x6709, 9884, 1, -1 },   // 有
+    { 0x535a, 9885, 1, -1 },   // 博
+    { 0x4e91, 0, 0, 5649 },   // 云
+    { 0x91cc, 0, 0, 5651 },   // 里
+    { 0x51c6, 0, 0, 5661 },   // 准
+    { 0x5165, 9886, 1, -1 },   // 入
+    { 0x7684, 0, 0, 5680 },   // 的
+    { 0x8868, 0, 0, 5686 },   // 表
+    { 0x540e, 0, 0, 5718 },   // 后
+    { 0x865a, 9887, 1, -1 },   // 虚
+    { 0x5bb6, 9888, 1, -1 },   // 家
+    { 0x53bf, 0, 0, 5748 },   // 县
+    { 0x4f24, 9889, 1, -1 },   // 伤
+    { 0x997f, 9890, 1, -1 },   // 饿
+    { 0x5e72, 0, 0, 5772 },   // 干
+    { 0x91cc, 0, 0, 5786 },   // 里
+    { 0x6b32, 0, 0, 5794 },   // 欲
+    { 0x9762, 0, 0, 5811 },   // 面
+    { 0x4e2a, 0, 0, 5854 },   // 个
+    { 0x7edd, 9891, 1, -1 },   // 绝
+    { 0x7cfb, 9892, 1, -1 },   // 系
+    { 0x540e, 0, 0, 5878 },   // 后
+    { 0x540e, 0, 0, 5879 },   // 后
+    { 0x52cb, 0, 0, 5880 },   // 勋
+    { 0x68cd, 0, 0, 5883 },   // 棍
+    { 0x676f, 0, 0, 5885 },   // 杯
+    { 0x91cc, 0, 0, 5894 },   // 里
+    { 0x5c0f, 9893, 1, -1 },   // 小
+    { 0x5b50, 0, 0, 5912 },   // 子
+    { 0x53d1, 9894, 1, -1 },   // 发
+    { 0x91cc, 0, 0, 5922 },   // 里
+    { 0x91cc, 0, 0, 5923 },   // 里
+    { 0x96c5, 9895, 1, -1 },   // 雅
+    { 0x5343, 9896, 1, -1 },   // 千
+    { 0x677e, 0, 0, 5952 },   // 松
+    { 0x4ee5, 9897, 1, -1 },   // 以
+    { 0x53bf, 0, 0, 6002 },   // 县
+    { 0x9762, 0, 0, 6010 },   // 面
+    { 0x65e0, 9898, 1, -1 },   // 无
+    { 0x5e72, 0, 0, 6019 },   // 干
+    { 0x4eba, 0, 0, 6020 },   // 人
+    { 0x4e16, 0, 0, 6022 },   // 世
+    { 0x4e4e, 0, 0, 6023 },   // 乎
+    { 0x4eba, 0, 0, 6024 },   // 人
+    { 0x7248, 0, 0, 6025 },   // 版
+    { 0x73b0, 0, 0, 6026 },   // 现
+    { 0x751f, 0, 0, 6027 },   // 生
+    { 0x8272, 0, 0, 6028 },   // 色
+    { 0x8eab, 0, 0, 6029 },   // 身
+    { 0x9053, 0, 0, 6030 },   // 道
+    { 0x4e0d, 9899, 1, 6032 },   // 不
+    { 0x4f1a, 0, 0, 6034 },   // 会
+    { 0x5141, 0, 0, 6035 },   // 允
+    { 0x5305, 9900, 1, -1 },   // 包
+    { 0x53ef, 0, 0, 6037 },   // 可
+    { 0x5728, 0, 0, 6038 },   // 在
+    { 0x5bb9, 0, 0, 6039 },   // 容
+    { 0x5e94, 0, 0, 6040 },   // 应
+    { 0x662f, 0, 0, 6041 },   // 是
+    { 0x6bd4, 0, 0, 6042 },   // 比
+    { 0x7528, 0, 0, 6043 },   // 用
+    { 0x80fd, 0, 0, 6044 },   // 能
+    { 0x91c7, 0, 0, 6045 },   // 采
+    { 0x9650, 0, 0, 6046 },   // 限
+    { 0x9700, 0, 0, 6047 },   // 需
+    { 0x987b, 0, 0, 6048 },   // 须
+    { 0x51fa, 0, 0, 6052 },   // 出
+    { 0x5e76, 9901, 1, -1 },   // 并
+    { 0x5f0f, 0, 0, 6059 },   // 式
+    { 0x56de, 9902, 1, -1 },   // 回
+    { 0x5411, 0, 0, 6072 },   // 向
+    { 0x540e, 0, 0, 6073 },   // 后
+    { 0x8868, 9903, 5, -1 },   // 表
+    { 0x6e38, 0, 0, 6082 },   // 游
+    { 0x53f2, 0, 0, 6087 },   // 史
+    { 0x9762, 0, 0, 6089 },   // 面
+    { 0x6597, 9908, 1, -1 },   // 斗
+    { 0x540e, 0, 0, 6097 },   // 后
+    { 0x949f, 0, 0, 6100 },   // 钟
+    { 0x4e4b, 9909, 1, -1 },   // 之
+    { 0x908b, 9910, 1, -1 },   // 邋
+    { 0x4e0d, 9911, 1, -1 },   // 不
+    { 0x4f1a, 0, 0, 6113 },   // 会
+    { 0x5e94, 0, 0, 6114 },   // 应
+    { 0x987b, 0, 0, 6115 },   // 须
+    { 0x4e0d, 9912, 1, -1 },   // 不
+    { 0x6c89, 0, 0, 6138 },   // 沉
+    { 0x4e0d, 9913, 2, -1 },   // 不
+    { 0x5be1, 9915, 1, -1 },   // 寡
+    { 0x800c, 9916, 1, -1 },   // 而
+    { 0x82cd, 9917, 1, -1 },   // 苍
+    { 0x8471, 9918, 1, -1 },   // 葱
+    { 0x4e91, 0, 0, 6167 },   // 云
+    { 0x53d1, 0, 0, 6172 },   // 发
+    { 0x91cc, 0, 0, 6174 },   // 里
+    { 0x9972, 9919, 1, -1 },   // 饲
+    { 0x91cc, 0, 0, 6177 },   // 里
+    { 0x51b2, 9920, 1, -1 },   // 冲
+    { 0x79cd, 0, 0, 6220 },   // 种
+    { 0x4eba, 0, 0, 6223 },   // 人
+    { 0x6298, 9921, 1, -1 },   // 折
+    { 0x4e4b, 9922, 1, -1 },   // 之
+    { 0x77f6, 0, 0, 6234 },   // 矶
+    { 0x573a, 0, 0, 6236 },   // 场
+    { 0x533a, 0, 0, 6238 },   // 区
+    { 0x91c7, 9923, 1, -1 },   // 采
+    { 0x4eba, 0, 0, 6244 },   // 人
+    { 0x95ee, 9924, 1, -1 },   // 问
+    { 0x5916, 9925, 1, -1 },   // 外
+    { 0x5916, 9926, 1, -1 },   // 外
+    { 0x9547, 0, 0, 6275 },   // 镇
+    { 0x5927, 9927, 1, -1 },   // 大
+    { 0x6cb3, 0, 0, 6282 },   // 河
+    { 0x5916, 9928, 2, -1 },   // 外
+    { 0x5305, 0, 0, 6288 },   // 包
+    { 0x9762, 0, 0, 6293 },   // 面
+    { 0x51c6, 0, 0, 6296 },   // 准
+    { 0x59d1, 0, 0, 6297 },   // 姑
+    { 0x53f9, 0, 0, 6299 },   // 叹
+    { 0x53bf, 0, 0, 6300 },   // 县
+    { 0x6001, 0, 0, 6302 },   // 态
+    { 0x626c, 0, 0, 6303 },   // 扬
+    { 0x73b0, 0, 0, 6304 },   // 现
+    { 0x8fbe, 0, 0, 6305 },   // 达
+    { 0x7389, 9930, 1, -1 },   // 玉
+    { 0x77e5, 9931, 1, -1 },   // 知
+    { 0x6263, 9932, 1, -1 },   // 扣
+    { 0x649e, 9933, 1, -1 },   // 撞
+    { 0x6572, 9934, 1, -1 },   // 敲
+    { 0x7a7a, 9935, 1, -1 },   // 空
+    { 0x6d1e, 0, 0, 6353 },   // 洞
+    { 0x77f3, 0, 0, 6354 },   // 石
+    { 0x97f3, 0, 0, 6359 },   // 音
+    { 0x5bfa, 9936, 1, -1 },   // 寺
+    { 0x53f3, 0, 0, 6370 },   // 右
+    { 0x866b, 0, 0, 6374 },   // 虫
+    { 0x505c, 0, 0, 6399 },   // 停
+    { 0x5feb, 0, 0, 6400 },   // 快
+    { 0x6162, 0, 0, 6401 },   // 慢
+    { 0x738b, 0, 0, 6402 },   // 王
+    { 0x76d8, 0, 0, 6403 },   // 盘
+    { 0x901f, 0, 0, 6404 },   // 速
+    { 0x9762, 0, 0, 6405 },   // 面
+    { 0x5217, 0, 0, 6410 },   // 列
+    { 0x70bc, 9937, 1, -1 },   // 炼
+    { 0x6597, 9938, 1, -1 },   // 斗
+    { 0x82b1, 9939, 1, -1 },   // 花
+    { 0x4e0d, 9940, 1, -1 },   // 不
+    { 0x91cc, 0, 0, 6606 },   // 里
+    { 0x53f2, 0, 0, 6630 },   // 史
+    { 0x516c, 9941, 1, -1 },   // 公
+    { 0x59b9, 0, 0, 6632 },   // 妹
+    { 0x59d1, 9942, 1, -1 },   // 姑
+    { 0x4e11, 0, 0, 6634 },   // 丑
+    { 0x513f, 0, 0, 6636 },   // 儿
+    { 0x793c, 0, 0, 6642 },   // 礼
+    { 0x9038, 9943, 1, -1 },   // 逸
+    { 0x5bb9, 9944, 1, -1 },   // 容
+    { 0x5c14, 0, 0, 6660 },   // 尔
+    { 0x540e, 0, 0, 6670 },   // 后
+    { 0x8868, 0, 0, 6703 },   // 表
+    { 0x53f2, 0, 0, 6708 },   // 史
+    { 0x9762, 0, 0, 6709 },   // 面
+    { 0x53f2, 0, 0, 6713 },   // 史
+    { 0x91cc, 9945, 1, -1 },   // 里
+    { 0x540e, 0, 0, 6725 },   // 后
+    { 0x8bb8, 0, 0, 6737 },   // 许
+    { 0x91cc, 0, 0, 6748 },   // 里
+    { 0x6cd5, 0, 0, 6749 },   // 法
+    { 0x96c1, 9946, 1, -1 },   // 雁
+    { 0x753b, 9947, 1, -1 },   // 画
+    { 0x8499, 0, 0, 6767 },   // 蒙
+    { 0x8424, 9948, 1, -1 },   // 萤
+    { 0x7ea2, 0, 0, 6770 },   // 红
+    { 0x857b, 0, 0, 6771 },   // 蕻
+    { 0x540e, 0, 0, 6776 },   // 后
+    { 0x540e, 0, 0, 6777 },   // 后
+    { 0x51b2, 9949, 1, -1 },   // 冲
+    { 0x4e00, 9950, 1, -1 },   // 一
+    { 0x51c6, 0, 0, 6795 },   // 准
+    { 0x513f, 0, 0, 6796 },   // 儿
+    { 0x54c1, 0, 0, 6797 },   // 品
+    { 0x529e, 0, 0, 6799 },   // 办
+    { 0x53a2, 0, 0, 6800 },   // 厢
+    { 0x56f4, 0, 0, 6801 },   // 围
+    { 0x624e, 0, 0, 6802 },   // 扎
+    { 0x63fd, 0, 0, 6803 },   // 揽
+    { 0x7740, 0, 0, 6804 },   // 着
+    { 0x7f57, 0, 0, 6805 },   // 罗
+    { 0x88c5, 0, 0, 6806 },   // 装
+    { 0x513f, 0, 0, 6810 },   // 儿
+    { 0x94fa, 0, 0, 6813 },   // 铺
+    { 0x76ee, 0, 0, 6817 },   // 目
+    { 0x5e08, 0, 0, 6820 },   // 师
+    { 0x7629, 0, 0, 6821 },   // 瘩
+    { 0x513f, 0, 0, 6823 },   // 儿
+    { 0x7ea2, 0, 0, 6826 },   // 红
+    { 0x996d, 0, 0, 6831 },   // 饭
+    { 0x5165, 9951, 1, -1 },   // 入
+    { 0x5236, 0, 0, 6846 },   // 制
+    { 0x51c6, 0, 0, 6850 },   // 准
+    { 0x5982, 9952, 1, -1 },   // 如
+    { 0x51b2, 0, 0, 6854 },   // 冲
+    { 0x5411, 0, 0, 6865 },   // 向
+    { 0x540e, 0, 0, 6866 },   // 后
+    { 0x636e, 0, 0, 6870 },   // 据
+    { 0x4e0d, 9953, 1, -1 },   // 不
+    { 0x6b32, 0, 0, 6893 },   // 欲
+    { 0x5386, 0, 0, 6911 },   // 历
+    { 0x7565, 9954, 1, -1 },   // 略
+    { 0x5012, 9955, 1, -1 },   // 倒
+    { 0x4ec6, 9956, 1, -1 },   // 仆
+    { 0x6b8b, 9957, 1, -1 },   // 残
+    { 0x5fd7, 0, 0, 6933 },   // 志
+    { 0x5fd7, 0, 0, 6935 },   // 志
+    { 0x4e91, 9958, 1, -1 },   // 云
+    { 0x81ea, 9959, 1, -1 },   // 自
+    { 0x8361, 9960, 1, -1 },   // 荡
+    { 0x633d, 9961, 1, -1 },   // 挽
+    { 0x949f, 0, 0, 6953 },   // 钟
+    { 0x949f, 0, 0, 6974 },   // 钟
+    { 0x9762, 0, 0, 6993 },   // 面
+    { 0x7535, 9962, 1, -1 },   // 电
+    { 0x5176, 9963, 1, -1 },   // 其
+    { 0x949f, 0, 0, 7014 },   // 钟
+    { 0x5782, 9964, 1, -1 },   // 垂
+    { 0x91cc, 9965, 1, -1 },   // 里
+    { 0x575b, 0, 0, 7071 },   // 坛
+    { 0x6270, 0, 0, 7076 },   // 扰
+    { 0x9884, 0, 0, 7077 },   // 预
+    { 0x51b2, 9966, 1, -1 },   // 冲
+    { 0x68a6, 9967, 1, -1 },   // 梦
+    { 0x5e02, 0, 0, 7161 },   // 市
+    { 0x9762, 0, 0, 7165 },   // 面
+    { 0x9e45, 9968, 1, -1 },   // 鹅
+    { 0x9e45, 9969, 1, -1 },   // 鹅
+    { 0x9762, 0, 0, 7170 },   // 面
+    { 0x91cc, 9970, 1, -1 },   // 里
+    { 0x53bf, 0, 0, 7224 },   // 县
+    { 0x5e2d, 0, 0, 7242 },   // 席
+    { 0x9762, 0, 0, 7243 },   // 面
+    { 0x53f2, 0, 0, 7246 },   // 史
+    { 0x533a, 0, 0, 7248 },   // 区
+    { 0x53bf, 0, 0, 7249 },   // 县
+    { 0x9ed1, 9971, 1, -1 },   // 黑
+    { 0x6bd2, 9972, 1, -1 },   // 毒
+    { 0x672f, 0, 0, 7253 },   // 术
+    { 0x6770, 0, 0, 7254 },   // 杰
+    { 0x8868, 0, 0, 7255 },   // 表
+    { 0x7b51, 0, 0, 7257 },   // 筑
+    { 0x4e91, 0, 0, 7259 },   // 云
+    { 0x5401, 9973, 1, -1 },   // 吁
+    { 0x5c06, 0, 0, 7262 },   // 将
+    { 0x53d1, 0, 0, 7263 },   // 发
+    { 0x8349, 0, 0, 7272 },   // 草
+    { 0x513f, 0, 0, 7276 },   // 儿
+    { 0x820d, 9974, 1, -1 },   // 舍
+    { 0x53d1, 9975, 1, -1 },   // 发
+    { 0x53d1, 9976, 1, -1 },   // 发
+    { 0x864e, 9977, 1, -1 },   // 虎
+    { 0x5e72, 0, 0, 7299 },   // 干
+    { 0x9762, 0, 0, 7301 },   // 面
+    { 0x4e11, 0, 0, 5 },   // 丑
+    { 0x5267, 0, 0, 12 },   // 剧
+    { 0x620f, 0, 0, 13 },   // 戏
+    { 0x5267, 0, 0, 15 },   // 剧
+    { 0x5f71, 0, 0, 17 },   // 影
+    { 0x6beb, 0, 0, 18 },   // 毫
+    { 0x94a7, 0, 0, 19 },   // 钧
+    { 0x6563, 0, 0, 23 },   // 散
+    { 0x51c0, 0, 0, 27 },   // 净
+    { 0x83b7, 0, 0, 30 },   // 获
+    { 0x4e00, 9978, 1, -1 },   // 一
+    { 0x5f53, 0, 0, 34 },   // 当
+    { 0x6b32, 0, 0, 40 },   // 欲
+    { 0x8868, 0, 0, 51 },   // 表
+    { 0x67b6, 0, 0, 53 },   // 架
+    { 0x8f9f, 0, 0, 62 },   // 辟
+    { 0x53f2, 0, 0, 65 },   // 史
+    { 0x9884, 0, 0, 100 },   // 预
+    { 0x4e11, 0, 0, 101 },   // 丑
+    { 0x6817, 0, 0, 102 },   // 栗
+    { 0x51c0, 0, 0, 103 },   // 净
+    { 0x6258, 0, 0, 110 },   // 托
+    { 0x5e86, 0, 0, 111 },   // 庆
+    { 0x814a, 0, 0, 115 },   // 腊
+    { 0x64ad, 0, 0, 131 },   // 播
+    { 0x8138, 0, 0, 132 },   // 脸
+    { 0x98a6, 0, 0, 135 },   // 颦
+    { 0x8868, 0, 0, 173 },   // 表
+    { 0x7a81, 0, 0, 179 },   // 突
+    { 0x6028, 0, 0, 186 },   // 怨
+    { 0x6597, 0, 0, 198 },   // 斗
+    { 0x7a74, 0, 0, 199 },   // 穴
+    { 0x56e0, 0, 0, 205 },   // 因
+    { 0x624b, 0, 0, 207 },   // 手
+    { 0x624b, 0, 0, 208 },   // 手
+    { 0x5473, 0, 0, 209 },   // 味
+    { 0x673a, 0, 0, 210 },   // 机
+    { 0x7531, 0, 0, 211 },   // 由
+    { 0x695a, 0, 0, 212 },   // 楚
+    { 0x7406, 0, 0, 213 },   // 理
+    { 0x624b, 0, 0, 214 },   // 手
+    { 0x8868, 9979, 1, 221 },   // 表
+    { 0x9762, 0, 0, 223 },   // 面
+    { 0x51e1, 0, 0, 245 },   // 凡
+    { 0x5b9d, 0, 0, 250 },   // 宝
+    { 0x7ebf, 0, 0, 258 },   // 线
+    { 0x950b, 9980, 1, -1 },   // 锋
+    { 0x4ec7, 0, 0, 281 },   // 仇
+    { 0x6c14, 0, 0, 301 },   // 气
+    { 0x638c, 0, 0, 308 },   // 掌
+    { 0x598d, 0, 0, 310 },   // 妍
+    { 0x5f02, 0, 0, 311 },   // 异
+    { 0x8273, 0, 0, 312 },   // 艳
+    { 0x5947, 0, 0, 313 },   // 奇
+    { 0x8273, 0, 0, 314 },   // 艳
+    { 0x7d2b, 0, 0, 316 },   // 紫
+    { 0x5de7, 0, 0, 317 },   // 巧
+    { 0x767b, 0, 0, 319 },   // 登
+    { 0x60d1, 0, 0, 325 },   // 惑
+    { 0x6597, 0, 0, 326 },   // 斗
+    { 0x6298, 0, 0, 333 },   // 折
+    { 0x675c, 9981, 1, -1 },   // 杜
+    { 0x514b, 0, 0, 353 },   // 克
+    { 0x96c6, 0, 0, 363 },   // 集
+    { 0x5c14, 0, 0, 365 },   // 尔
+    { 0x5c48, 9982, 1, -1 },   // 屈
+    { 0x65e7, 0, 0, 400 },   // 旧
+    { 0x7b7e, 0, 0, 405 },   // 签
+    { 0x91cc, 0, 0, 406 },   // 里
+    { 0x514b, 0, 0, 417 },   // 克
+    { 0x6069, 0, 0, 454 },   // 恩
+    { 0x9a7d, 0, 0, 465 },   // 驽
+    { 0x5916, 0, 0, 472 },   // 外
+    { 0x5916, 0, 0, 473 },   // 外
+    { 0x884c, 0, 0, 480 },   // 行
+    { 0x8868, 0, 0, 489 },   // 表
+    { 0x5386, 9983, 1, -1 },   // 历
+    { 0x5386, 9984, 1, 494 },   // 历
+    { 0x6559, 9985, 1, -1 },   // 教
+    { 0x5b50, 0, 0, 498 },   // 子
+    { 0x6c11, 0, 0, 501 },   // 民
+    { 0x56db, 9986, 1, -1 },   // 四
+    { 0x8428, 0, 0, 642 },   // 萨
+    { 0x820d, 0, 0, 654 },   // 舍
+    { 0x6613, 0, 0, 669 },   // 易
+    { 0x6559, 0, 0, 678 },   // 教
+    { 0x7b79, 0, 0, 695 },   // 筹
+    { 0x5f53, 0, 0, 707 },   // 当
+    { 0x96ea, 0, 0, 720 },   // 雪
+    { 0x6c14, 0, 0, 721 },   // 气
+    { 0x53f2, 0, 0, 726 },   // 史
+    { 0x9769, 9987, 1, -1 },   // 革
+    { 0x5ea7, 0, 0, 772 },   // 座
+    { 0x53f2, 0, 0, 777 },   // 史
+    { 0x7684, 0, 0, 800 },   // 的
+    { 0x53f2, 0, 0, 812 },   // 史
+    { 0x6012, 0, 0, 825 },   // 怒
+    { 0x9635, 0, 0, 837 },   // 阵
+    { 0x5e9c, 0, 0, 843 },   // 府
+    { 0x660e, 0, 0, 937 },   // 明
+    { 0x51fa, 0, 0, 942 },   // 出
+    { 0x9732, 0, 0, 973 },   // 露
+    { 0x4e11, 0, 0, 976 },   // 丑
+    { 0x4e11, 0, 0, 977 },   // 丑
+    { 0x4f1a, 0, 0, 996 },   // 会
+    { 0x53bb, 0, 0, 1000 },   // 去
+    { 0x6728, 9988, 1, -1 },   // 木
+    { 0x6e38, 0, 0, 1092 },   // 游
+    { 0x5236, 0, 0, 1097 },   // 制
+    { 0x89d2, 0, 0, 1116 },   // 角
+    { 0x9b44, 0, 0, 1117 },   // 魄
+    { 0x8def, 0, 0, 1126 },   // 路
+    { 0x9762, 0, 0, 1127 },   // 面
+    { 0x591f, 0, 0, 1149 },   // 够
+    { 0x6298, 0, 0, 1151 },   // 折
+    { 0x8f6c, 0, 0, 1152 },   // 转
+    { 0x53d1, 0, 0, 1155 },   // 发
+    { 0x6597, 0, 0, 1171 },   // 斗
+    { 0x8868, 0, 0, 1175 },   // 表
+    { 0x8def, 0, 0, 1177 },   // 路
+    { 0x949f, 0, 0, 1179 },   // 钟
+    { 0x5c14, 0, 0, 1183 },   // 尔
+    { 0x513f, 0, 0, 1187 },   // 儿
+    { 0x516c, 0, 0, 1216 },   // 公
+    { 0x82e5, 0, 0, 1219 },   // 若
+    { 0x6597, 0, 0, 1222 },   // 斗
+    { 0x6765, 0, 0, 1232 },   // 来
+    { 0x610f, 0, 0, 1274 },   // 意
+    { 0x590d, 0, 0, 1317 },   // 复
+    { 0x5f97, 0, 0, 1320 },   // 得
+    { 0x51a0, 0, 0, 1323 },   // 冠
+    { 0x51a0, 0, 0, 1324 },   // 冠
+    { 0x4e4b, 9989, 1, -1 },   // 之
+    { 0x9274, 0, 0, 1328 },   // 鉴
+    { 0x767d, 0, 0, 1336 },   // 白
+    { 0x94a7, 0, 0, 1341 },   // 钧
+    { 0x957f, 0, 0, 1351 },   // 长
+    { 0x51a0, 0, 0, 1364 },   // 冠
+    { 0x5e72, 0, 0, 1386 },   // 干
+    { 0x6b32, 0, 0, 1387 },   // 欲
+    { 0x95ee, 9990, 1, -1 },   // 问
+    { 0x5929, 0, 0, 1405 },   // 天
+    { 0x8bed, 0, 0, 1407 },   // 语
+    { 0x65e0, 0, 0, 1409 },   // 无
+    { 0x6ca1, 0, 0, 1410 },   // 没
+    { 0x5f53, 0, 0, 1417 },   // 当
+    { 0x677e, 0, 0, 1419 },   // 松
+    { 0x5065, 0, 0, 1434 },   // 健
+    { 0x9762, 0, 0, 1448 },   // 面
+    { 0x5916, 0, 0, 1450 },   // 外
+    { 0x5916, 0, 0, 1451 },   // 外
+    { 0x540a, 0, 0, 1461 },   // 吊
+    { 0x60a6, 0, 0, 1486 },   // 悦
+    { 0x4e8b, 0, 0, 1487 },   // 事
+    { 0x8de8, 0, 0, 1488 },   // 跨
+    { 0x9001, 0, 0, 1493 },   // 送
+    { 0x7cfb, 9991, 1, -1 },   // 系
+    { 0x677f, 0, 0, 1506 },   // 板
+    { 0x53d1, 0, 0, 1511 },   // 发
+    { 0x53d1, 0, 0, 1512 },   // 发
+    { 0x53d1, 0, 0, 1528 },   // 发
+    { 0x6c14, 0, 0, 1537 },   // 气
+    { 0x56fd, 0, 0, 1554 },   // 国
+    { 0x8bed, 0, 0, 1557 },   // 语
+    { 0x918b, 0, 0, 1567 },   // 醋
+    { 0x820c, 0, 0, 1572 },   // 舌
+    { 0x5e72, 0, 0, 1631 },   // 干
+    { 0x8bb8, 0, 0, 1634 },   // 许
+    { 0x58f0, 0, 0, 1645 },   // 声
+    { 0x8868, 0, 0, 1649 },   // 表
+    { 0x53d1, 0, 0, 1664 },   // 发
+    { 0x6536, 0, 0, 1672 },   // 收
+    { 0x53f2, 0, 0, 1674 },   // 史
+    { 0x7b14, 0, 0, 1679 },   // 笔
+    { 0x5165, 0, 0, 1680 },   // 入
+    { 0x5165, 0, 0, 1681 },   // 入
+    { 0x7167, 0, 0, 1683 },   // 照
+    { 0x5b50, 0, 0, 1690 },   // 子
+    { 0x89c1, 0, 0, 1691 },   // 见
+    { 0x4ef6, 0, 0, 1693 },   // 件
+    { 0x5217, 0, 0, 1696 },   // 列
+    { 0x8bcd, 0, 0, 1698 },   // 词
+    { 0x6784, 0, 0, 1699 },   // 构
+    { 0x6c14, 0, 0, 1710 },   // 气
+    { 0x6765, 0, 0, 1727 },   // 来
+    { 0x6597, 0, 0, 1728 },   // 斗
+    { 0x6597, 0, 0, 1729 },   // 斗
+    { 0x5e72, 0, 0, 1737 },   // 干
+    { 0x8c37, 9992, 1, -1 },   // 谷
+    { 0x9f50, 0, 0, 1760 },   // 齐
+    { 0x8868, 0, 0, 1762 },   // 表
+    { 0x7f50, 0, 0, 1777 },   // 罐
+    { 0x53f2, 0, 0, 1801 },   // 史
+    { 0x540e, 0, 0, 1802 },   // 后
+    { 0x949f, 0, 0, 1816 },   // 钟
+    { 0x6570, 0, 0, 1851 },   // 数
+    { 0x5386, 9993, 1, -1 },   // 历
+    { 0x5e72, 0, 0, 1900 },   // 干
+    { 0x5f71, 0, 0, 1904 },   // 影
+    { 0x8868, 9994, 1, 1924 },   // 表
+    { 0x9762, 0, 0, 1926 },   // 面
+    { 0x5230, 0, 0, 1929 },   // 到
+    { 0x53f2, 0, 0, 1932 },   // 史
+    { 0x6108, 0, 0, 1934 },   // 愈
+    { 0x8fde, 0, 0, 1935 },   // 连
+    { 0x53f2, 0, 0, 1938 },   // 史
+    { 0x82d4, 0, 0, 1940 },   // 苔
+    { 0x51b2, 0, 0, 1943 },   // 冲
+    { 0x8303, 0, 0, 1950 },   // 范
+    { 0x8868, 0, 0, 1951 },   // 表
+    { 0x949f, 0, 0, 1952 },   // 钟
+    { 0x53f2, 0, 0, 1959 },   // 史
+    { 0x53e3, 0, 0, 1966 },   // 口
+    { 0x9761, 0, 0, 1976 },   // 靡
+    { 0x8c08, 0, 0, 1979 },   // 谈
+    { 0x4f1a, 0, 0, 1986 },   // 会
+    { 0x53bb, 0, 0, 1991 },   // 去
+    { 0x5f3a, 0, 0, 1997 },   // 强
+    { 0x667a, 0, 0, 1999 },   // 智
+    { 0x63a0, 0, 0, 2033 },   // 掠
+    { 0x72e0, 0, 0, 2036 },   // 狠
+    { 0x6e34, 0, 0, 2043 },   // 渴
+    { 0x5929, 0, 0, 2048 },   // 天
+    { 0x7684, 9995, 1, -1 },   // 的
+    { 0x8001, 9996, 1, -1 },   // 老
+    { 0x4e11, 0, 0, 2088 },   // 丑
+    { 0x95f4, 0, 0, 2101 },   // 间
+    { 0x8def, 0, 0, 2111 },   // 路
+    { 0x91c7, 0, 0, 2116 },   // 采
+    { 0x6c14, 0, 0, 2122 },   // 气
+    { 0x5f81, 0, 0, 2153 },   // 征
+    { 0x91d1, 0, 0, 2157 },   // 金
+    { 0x8868, 0, 0, 2163 },   // 表
+    { 0x8868, 9997, 1, 2187 },   // 表
+    { 0x9762, 0, 0, 2189 },   // 面
+    { 0x6c14, 0, 0, 2202 },   // 气
+    { 0x820d, 0, 0, 2206 },   // 舍
+    { 0x6709, 0, 0, 2211 },   // 有
+    { 0x4ec6, 0, 0, 2234 },   // 仆
+    { 0x5e94, 0, 0, 2239 },   // 应
+    { 0x590d, 0, 0, 2245 },   // 复
+    { 0x66ae, 0, 0, 2248 },   // 暮
+    { 0x7597, 0, 0, 2275 },   // 疗
+    { 0x7a81, 0, 0, 2278 },   // 突
+    { 0x949f, 0, 0, 2292 },   // 钟
+    { 0x5386, 9998, 1, 2296 },   // 历
+    { 0x884c, 0, 0, 2305 },   // 行
+    { 0x51c0, 0, 0, 2360 },   // 净
+    { 0x51c0, 0, 0, 2381 },   // 净
+    { 0x706b, 0, 0, 2409 },   // 火
+    { 0x86ca, 0, 0, 2430 },   // 蛊
+    { 0x5ea6, 0, 0, 2436 },   // 度
+    { 0x8404, 9999, 1, -1 },   // 萄
+    { 0x4e8b, 0, 0, 2452 },   // 事
+    { 0x8404, 10000, 1, -1 },   // 萄
+    { 0x7cfb, 0, 0, 2472 },   // 系
+    { 0x5f53, 0, 0, 2522 },   // 当
+    { 0x4e8c, 0, 0, 2531 },   // 二
+    { 0x4f53, 0, 0, 2532 },   // 体
+    { 0x5bb6, 0, 0, 2533 },   // 家
+    { 0x6a21, 10001, 1, -1 },   // 模
+    { 0x5f0f, 0, 0, 2542 },   // 式
+    { 0x75c7, 0, 0, 2546 },   // 症
+    { 0x6dc0, 0, 0, 2553 },   // 淀
+    { 0x65b9, 0, 0, 2571 },   // 方
+    { 0x8c37, 0, 0, 2603 },   // 谷
+    { 0x7334, 0, 0, 2614 },   // 猴
+    { 0x5f20, 10002, 1, -1 },   // 张
+    { 0x91ce, 0, 0, 2627 },   // 野
+    { 0x7528, 0, 0, 2637 },   // 用
+    { 0x4e01, 0, 0, 2647 },   // 丁
+    { 0x53ea, 0, 0, 2651 },   // 只
+    { 0x4ec7, 0, 0, 2656 },   // 仇
+    { 0x5b9e, 0, 0, 2668 },   // 实
+    { 0x96e8, 0, 0, 2704 },   // 雨
+    { 0x8a00, 0, 0, 2715 },   // 言
+    { 0x590d, 0, 0, 2717 },   // 复
+    { 0x5c06, 0, 0, 2718 },   // 将
+    { 0x53d1, 0, 0, 2837 },   // 发
+    { 0x75f9, 0, 0, 2839 },   // 痹
+    { 0x77ed, 0, 0, 2843 },   // 短
+    { 0x95f2, 0, 0, 2852 },   // 闲
+    { 0x5f53, 0, 0, 2857 },   // 当
+    { 0x51a0, 0, 0, 2869 },   // 冠
+    { 0x5929, 0, 0, 2870 },   // 天
+    { 0x5929, 0, 0, 2871 },   // 天
+    { 0x6d8c, 0, 0, 2873 },   // 涌
+    { 0x4e0b, 0, 0, 2874 },   // 下
+    { 0x66f2, 0, 0, 2875 },   // 曲
+    { 0x5929, 0, 0, 2878 },   // 天
+    { 0x6c14, 0, 0, 2879 },   // 气
+    { 0x820d, 0, 0, 2889 },   // 舍
+    { 0x6e38, 0, 0, 2891 },   // 游
+    { 0x6b63, 0, 0, 2899 },   // 正
+    { 0x8361, 0, 0, 2907 },   // 荡
+    { 0x6b32, 0, 0, 2932 },   // 欲
+    { 0x9762, 0, 0, 2940 },   // 面
+    { 0x5f20, 0, 0, 2947 },   // 张
+    { 0x5730, 0, 0, 2962 },   // 地
+    { 0x9f7f, 0, 0, 2968 },   // 齿
+    { 0x76d7, 10003, 1, -1 },   // 盗
+    { 0x866b, 0, 0, 2973 },   // 虫
+    { 0x5165, 0, 0, 3009 },   // 入
+    { 0x4eca, 0, 0, 3027 },   // 今
+    { 0x5b9a, 0, 0, 3057 },   // 定
+    { 0x80cc, 0, 0, 3062 },   // 背
+    { 0x53d1, 0, 0, 3091 },   // 发
+    { 0x5170, 0, 0, 3092 },   // 兰
+    { 0x957f, 10004, 1, -1 },   // 长
+    { 0x6734, 0, 0, 3094 },   // 朴
+    { 0x58f0, 0, 0, 3103 },   // 声
+    { 0x5c14, 10005, 1, -1 },   // 尔
+    { 0x767d, 0, 0, 3183 },   // 白
+    { 0x7406, 0, 0, 3194 },   // 理
+    { 0x8bcd, 0, 0, 3196 },   // 词
+    { 0x80c6, 0, 0, 3204 },   // 胆
+    { 0x540e, 10006, 1, -1 },   // 后
+    { 0x4e11, 0, 0, 3233 },   // 丑
+    { 0x519b, 0, 0, 3242 },   // 军
+    { 0x4ec7, 0, 0, 3265 },   // 仇
+    { 0x80c6, 0, 0, 3270 },   // 胆
+    { 0x62ec, 0, 0, 3278 },   // 括
+    { 0x8868, 0, 0, 3292 },   // 表
+    { 0x7f5a, 0, 0, 3293 },   // 罚
+    { 0x5f71, 0, 0, 3297 },   // 影
+    { 0x54c1, 0, 0, 3298 },   // 品
+    { 0x6d8c, 0, 0, 3303 },   // 涌
+    { 0x5408, 0, 0, 3310 },   // 合
+    { 0x53bb, 0, 0, 3346 },   // 去
+    { 0x9f7f, 0, 0, 3352 },   // 齿
+    { 0x9f7f, 0, 0, 3353 },   // 齿
+    { 0x4fee, 0, 0, 3361 },   // 修
+    { 0x5175, 0, 0, 3362 },   // 兵
+    { 0x9525, 0, 0, 3363 },   // 锥
+    { 0x6734, 0, 0, 3386 },   // 朴
+    { 0x8eab, 0, 0, 3389 },   // 身
+    { 0x6734, 0, 0, 3394 },   // 朴
+    { 0x5f15, 0, 0, 3398 },   // 引
+    { 0x6c11, 0, 0, 3405 },   // 民
+    { 0x4fe1, 0, 0, 3407 },   // 信
+    { 0x76d6, 0, 0, 3408 },   // 盖
+    { 0x8868, 0, 0, 3411 },   // 表
+    { 0x51c6, 0, 0, 3424 },   // 准
+    { 0x540a, 0, 0, 3436 },   // 吊
+    { 0x80c6, 0, 0, 3438 },   // 胆
+    { 0x51e0, 0, 0, 3439 },   // 几
+    { 0x7269, 10007, 1, -1 },   // 物
+    { 0x5b66, 0, 0, 3448 },   // 学
+    { 0x5934, 0, 0, 3454 },   // 头
+    { 0x660e, 0, 0, 3455 },   // 明
+    { 0x683c, 0, 0, 3456 },   // 格
+    { 0x73b0, 0, 0, 3457 },   // 现
+    { 0x793a, 0, 0, 3458 },   // 示
+    { 0x8fbe, 0, 0, 3459 },   // 达
+    { 0x9762, 0, 0, 3460 },   // 面
+    { 0x8868, 0, 0, 3462 },   // 表
+    { 0x5f81, 0, 0, 3483 },   // 征
+    { 0x6570, 0, 0, 3491 },   // 数
+    { 0x8868, 0, 0, 3497 },   // 表
+    { 0x65e0, 10008, 1, -1 },   // 无
+    { 0x9640, 10009, 1, -1 },   // 陀
+    { 0x89d2, 0, 0, 3511 },   // 角
+    { 0x624e, 0, 0, 3515 },   // 扎
+    { 0x998f, 0, 0, 3517 },   // 馏
+    { 0x5386, 10010, 1, 3529 },   // 历
+    { 0x8868, 0, 0, 3555 },   // 表
+    { 0x513f, 0, 0, 3558 },   // 儿
+    { 0x9053, 0, 0, 3571 },   // 道
+    { 0x5f81, 0, 0, 3572 },   // 征
+    { 0x6c14, 0, 0, 3588 },   // 气
+    { 0x81f4, 0, 0, 3659 },   // 致
+    { 0x5229, 10011, 1, -1 },   // 利
+    { 0x519b, 0, 0, 3758 },   // 军
+    { 0x655b, 0, 0, 3762 },   // 敛
+    { 0x660f, 0, 0, 3776 },   // 昏
+    { 0x586b, 0, 0, 3777 },   // 填
+    { 0x586b, 0, 0, 3780 },   // 填
+    { 0x751f, 0, 0, 3788 },   // 生
+    { 0x751f, 0, 0, 3789 },   // 生
+    { 0x6597, 0, 0, 3803 },   // 斗
+    { 0x9e23, 0, 0, 3806 },   // 鸣
+    { 0x94ce, 0, 0, 3808 },   // 铎
+    { 0x5c55, 0, 0, 3814 },   // 展
+    { 0x725b, 0, 0, 3824 },   // 牛
+    { 0x91cc, 10012, 1, -1 },   // 里
+    { 0x5fd8, 0, 0, 3837 },   // 忘
+    { 0x949f, 0, 0, 3846 },   // 钟
+    { 0x8fd0, 0, 0, 3857 },   // 运
+    { 0x8def, 0, 0, 3859 },   // 路
+    { 0x8def, 0, 0, 3864 },   // 路
+    { 0x901f, 0, 0, 3865 },   // 速
+    { 0x8def, 0, 0, 3867 },   // 路
+    { 0x8def, 0, 0, 3872 },   // 路
+    { 0x901f, 0, 0, 3873 },   // 速
+    { 0x91d1, 0, 0, 3880 },   // 金
+    { 0x51c0, 0, 0, 3887 },   // 净
+    { 0x5a18, 0, 0, 3921 },   // 娘
+    { 0x6d8c, 0, 0, 3931 },   // 涌
+    { 0x5e94, 0, 0, 3948 },   // 应
+    { 0x4fd7, 0, 0, 3956 },   // 俗
+    { 0x97f5, 0, 0, 3957 },   // 韵
+    { 0x8361, 0, 0, 3979 },   // 荡
+    { 0x540e, 0, 0, 3987 },   // 后
+    { 0x8015, 10013, 1, -1 },   // 耕
+    { 0x6ed3, 0, 0, 4030 },   // 滓
+    { 0x5904, 10014, 1, -1 },   // 处
+    { 0x5cd9, 0, 0, 4041 },   // 峙
+    { 0x671f, 0, 0, 4054 },   // 期
+    { 0x6c34, 0, 0, 4073 },   // 水
+    { 0x65b9, 0, 0, 4075 },   // 方
+    { 0x95f2, 0, 0, 4079 },   // 闲
+    { 0x5c3a, 0, 0, 4083 },   // 尺
+    { 0x6000, 0, 0, 4089 },   // 怀
+    { 0x52a1, 0, 0, 4092 },   // 务
+    { 0x53d1, 0, 0, 4128 },   // 发
+    { 0x5f53, 0, 0, 4129 },   // 当
+    { 0x4f73, 10015, 1, -1 },   // 佳
+    { 0x91cc, 0, 0, 4154 },   // 里
+    { 0x8868, 0, 0, 4157 },   // 表
+    { 0x53d1, 0, 0, 4234 },   // 发
+    { 0x53d1, 0, 0, 4235 },   // 发
+    { 0x7247, 0, 0, 4251 },   // 片
+    { 0x5386, 0, 0, 4266 },   // 历
+    { 0x82b1, 10016, 1, -1 },   // 花
+    { 0x8bed, 0, 0, 4272 },   // 语
+    { 0x8868, 0, 0, 4293 },   // 表
+    { 0x5a01, 0, 0, 4296 },   // 威
+    { 0x5f84, 0, 0, 4300 },   // 径
+    { 0x9994, 0, 0, 4330 },   // 馔
+    { 0x53d1, 0, 0, 4337 },   // 发
+    { 0x53d1, 0, 0, 4338 },   // 发
+    { 0x8868, 0, 0, 4372 },   // 表
+    { 0x683c, 0, 0, 4373 },   // 格
+    { 0x8868, 0, 0, 4375 },   // 表
+    { 0x98ce, 0, 0, 4382 },   // 风
+    { 0x76ae, 0, 0, 4434 },   // 皮
+    { 0x4e8b, 0, 0, 4436 },   // 事
+    { 0x7ea2, 0, 0, 4441 },   // 红
+    { 0x591f, 0, 0, 4447 },   // 够
+    { 0x4e11, 0, 0, 4451 },   // 丑
+    { 0x53f2, 0, 0, 4455 },   // 史
+    { 0x6dc0, 0, 0, 4466 },   // 淀
+    { 0x53f2, 0, 0, 4470 },   // 史
+    { 0x79cb, 0, 0, 4476 },   // 秋
+    { 0x79cb, 0, 0, 4477 },   // 秋
+    { 0x4e48, 10017, 1, -1 },   // 么
+    { 0x8868, 0, 0, 4533 },   // 表
+    { 0x5792, 0, 0, 4581 },   // 垒
+    { 0x4e49, 0, 0, 4590 },   // 义
+    { 0x53d1, 0, 0, 4609 },   // 发
+    { 0x514b, 10018, 1, -1 },   // 克
+    { 0x8fd0, 0, 0, 4621 },   // 运
+    { 0x9965, 0, 0, 4625 },   // 饥
+    { 0x53f0, 10019, 1, -1 },   // 台
+    { 0x5fb7, 10020, 1, -1 },   // 德
+    { 0x820d, 0, 0, 4646 },   // 舍
+    { 0x8033, 0, 0, 4653 },   // 耳
+    { 0x51c0, 0, 0, 4658 },   // 净
+    { 0x6881, 0, 0, 4668 },   // 梁
+    { 0x6e38, 0, 0, 4674 },   // 游
+    { 0x5200, 0, 0, 4680 },   // 刀
+    { 0x5e72, 0, 0, 4683 },   // 干
+    { 0x9762, 0, 0, 4736 },   // 面
+    { 0x6d82, 0, 0, 4746 },   // 涂
+    { 0x5168, 0, 0, 4751 },   // 全
+    { 0x53d1, 0, 0, 4757 },   // 发
+    { 0x5f71, 0, 0, 4777 },   // 影
+    { 0x820d, 0, 0, 4786 },   // 舍
+    { 0x7ef3, 0, 0, 4790 },   // 绳
+    { 0x8bf4, 0, 0, 4803 },   // 说
+    { 0x8db3, 0, 0, 4804 },   // 足
+    { 0x53d1, 0, 0, 4850 },   // 发
+    { 0x6e38, 0, 0, 4871 },   // 游
+    { 0x62f7, 0, 0, 4915 },   // 拷
+    { 0x4ee3, 0, 0, 5000 },   // 代
+    { 0x53f2, 0, 0, 5001 },   // 史
+    { 0x8303, 0, 0, 5004 },   // 范
+    { 0x9f99, 0, 0, 5013 },   // 龙
+    { 0x53d1, 0, 0, 5015 },   // 发
+    { 0x5ea6, 0, 0, 5033 },   // 度
+    { 0x70c8, 0, 0, 5038 },   // 烈
+    { 0x5f02, 0, 0, 5042 },   // 异
+    { 0x854a, 0, 0, 5049 },   // 蕊
+    { 0x6d82, 0, 0, 5087 },   // 涂
+    { 0x7f8a, 0, 0, 5144 },   // 羊
+    { 0x6765, 0, 0, 5146 },   // 来
+    { 0x91cc, 0, 0, 5149 },   // 里
+    { 0x613f, 0, 0, 5151 },   // 愿
+    { 0x5929, 0, 0, 5152 },   // 天
+    { 0x7126, 0, 0, 5156 },   // 焦
+    { 0x5371, 0, 0, 5163 },   // 危
+    { 0x4eba, 0, 0, 5165 },   // 人
+    { 0x516c, 0, 0, 5166 },   // 公
+    { 0x56fd, 0, 0, 5167 },   // 国
+    { 0x4eba, 0, 0, 5168 },   // 人
+    { 0x4eba, 0, 0, 5169 },   // 人
+    { 0x8c01, 0, 0, 5172 },   // 谁
+    { 0x672b, 0, 0, 5173 },   // 末
+    { 0x751f, 0, 0, 5174 },   // 生
+    { 0x957f, 0, 0, 5176 },   // 长
+    { 0x5e05, 0, 0, 5178 },   // 帅
+    { 0x8fdc, 0, 0, 5179 },   // 远
+    { 0x683c, 0, 0, 5181 },   // 格
+    { 0x53f2, 0, 0, 5184 },   // 史
+    { 0x91c7, 0, 0, 5206 },   // 采
+    { 0x9009, 0, 0, 5210 },   // 选
+    { 0x5634, 0, 0, 5212 },   // 嘴
+    { 0x53d8, 0, 0, 5244 },   // 变
+    { 0x53bb, 0, 0, 5280 },   // 去
+    { 0x80a0, 0, 0, 5282 },   // 肠
+    { 0x4e11, 0, 0, 5314 },   // 丑
+    { 0x53d1, 0, 0, 5339 },   // 发
+    { 0x77e5, 0, 0, 5348 },   // 知
+    { 0x96e8, 0, 0, 5355 },   // 雨
+    { 0x513f, 0, 0, 5392 },   // 儿
+    { 0x540a, 0, 0, 5405 },   // 吊
+    { 0x6597, 0, 0, 5414 },   // 斗
+    { 0x5996, 0, 0, 5417 },   // 妖
+    { 0x6cb9, 0, 0, 5434 },   // 油
+    { 0x53f2, 0, 0, 5447 },   // 史
+    { 0x624b, 0, 0, 5449 },   // 手
+    { 0x72c2, 0, 0, 5477 },   // 狂
+    { 0x5c71, 0, 0, 5478 },   // 山
+    { 0x887d, 0, 0, 5479 },   // 衽
+    { 0x51a0, 0, 0, 5480 },   // 冠
+    { 0x72c2, 0, 0, 5481 },   // 狂
+    { 0x89d2, 0, 0, 5510 },   // 角
+    { 0x6734, 0, 0, 5511 },   // 朴
+    { 0x6253, 0, 0, 5512 },   // 打
+    { 0x72c2, 0, 0, 5534 },   // 狂
+    { 0x7ecf, 0, 0, 5574 },   // 经
+    { 0x8bdd, 0, 0, 5628 },   // 话
+    { 0x5f15, 0, 0, 5639 },   // 引
+    { 0x74ee, 0, 0, 5665 },   // 瓮
+    { 0x58f0, 0, 0, 5732 },   // 声
+    { 0x5546, 0, 0, 5745 },   // 商
+    { 0x519c, 0, 0, 5767 },   // 农
+    { 0x519c, 0, 0, 5768 },   // 农
+    { 0x53e3, 0, 0, 5855 },   // 口
+    { 0x8db3, 0, 0, 5876 },   // 足
+    { 0x4e11, 0, 0, 5896 },   // 丑
+    { 0x80a4, 0, 0, 5918 },   // 肤
+    { 0x5bbe, 10021, 1, -1 },   // 宾
+    { 0x91cc, 0, 0, 5935 },   // 里
+    { 0x5f8b, 0, 0, 5996 },   // 律
+    { 0x4ec7, 0, 0, 6013 },   // 仇
+    { 0x8fc7, 0, 0, 6033 },   // 过
+    { 0x62ec, 0, 0, 6036 },   // 括
+    { 0x56db, 0, 0, 6058 },   // 四
+    { 0x5f02, 0, 0, 6063 },   // 异
+    { 0x51b3, 0, 0, 6075 },   // 决
+    { 0x660e, 0, 0, 6076 },   // 明
+    { 0x73b0, 0, 0, 6077 },   // 现
+    { 0x793a, 0, 0, 6078 },   // 示
+    { 0x8fbe, 0, 0, 6079 },   // 达
+    { 0x72e0, 0, 0, 6091 },   // 狠
+    { 0x5e78, 0, 0, 6106 },   // 幸
+    { 0x9062, 0, 0, 6107 },   // 遢
+    { 0x8fc7, 0, 0, 6112 },   // 过
+    { 0x5076, 0, 0, 6127 },   // 偶
+    { 0x4e50, 0, 0, 6152 },   // 乐
+    { 0x5e73, 0, 0, 6153 },   // 平
+    { 0x6b22, 0, 0, 6154 },   // 欢
+    { 0x7ec8, 0, 0, 6155 },   // 终
+    { 0x82cd, 0, 0, 6156 },   // 苍
+    { 0x8471, 0, 0, 6157 },   // 葱
+    { 0x6599, 0, 0, 6176 },   // 料
+    { 0x5929, 0, 0, 6180 },   // 天
+    { 0x5272, 0, 0, 6229 },   // 割
+    { 0x6218, 0, 0, 6233 },   // 战
+    { 0x7a57, 0, 0, 6239 },   // 穗
+    { 0x4fd7, 0, 0, 6265 },   // 俗
+    { 0x8fde, 0, 0, 6268 },   // 连
+    { 0x5408, 0, 0, 6273 },   // 合
+    { 0x5b66, 0, 0, 6277 },   // 学
+    { 0x56fd, 0, 0, 6283 },   // 国
+    { 0x654c, 0, 0, 6284 },   // 敌
+    { 0x91cc, 0, 0, 6306 },   // 里
+    { 0x6765, 0, 0, 6315 },   // 来
+    { 0x4e0d, 10022, 1, -1 },   // 不
+    { 0x4e0d, 10023, 1, -1 },   // 不
+    { 0x4e0d, 10024, 1, -1 },   // 不
+    { 0x5219, 10025, 1, -1 },   // 则
+    { 0x91cc, 0, 0, 6362 },   // 里
+    { 0x91d1, 10026, 1, -1 },   // 金
+    { 0x89d2, 0, 0, 6429 },   // 角
+    { 0x56ed, 0, 0, 6562 },   // 园
+    { 0x820d, 0, 0, 6572 },   // 舍
+    { 0x4e3b, 0, 0, 6631 },   // 主
+    { 0x5a18, 0, 0, 6633 },   // 娘
+    { 0x81f4, 0, 0, 6651 },   // 致
+    { 0x53d1, 0, 0, 6657 },   // 发
+    { 0x7ffb, 10027, 1, -1 },   // 翻
+    { 0x722a, 0, 0, 6761 },   // 爪
+    { 0x680b, 0, 0, 6763 },   // 栋
+    { 0x51e0, 0, 0, 6768 },   // 几
+    { 0x5929, 0, 0, 6784 },   // 天
+    { 0x53d1, 0, 0, 6791 },   // 发
+    { 0x91cc, 0, 0, 6839 },   // 里
+    { 0x949f, 0, 0, 6852 },   // 钟
+    { 0x51c6, 0, 0, 6890 },   // 准
+    { 0x5386, 10028, 1, 6916 },   // 历
+    { 0x5764, 0, 0, 6921 },   // 坤
+    { 0x4ec6, 0, 0, 6922 },   // 仆
+    { 0x4e91, 0, 0, 6931 },   // 云
+    { 0x6d8c, 0, 0, 6937 },   // 涌
+    { 0x7531, 10029, 1, -1 },   // 由
+    { 0x8361, 0, 0, 6948 },   // 荡
+    { 0x7c9f, 0, 0, 6951 },   // 粟
+    { 0x5f71, 0, 0, 7007 },   // 影
+    { 0x51b2, 0, 0, 7010 },   // 冲
+    { 0x514b, 10030, 1, -1 },   // 克
+    { 0x5e03, 0, 0, 7016 },   // 布
+    { 0x5929, 0, 0, 7088 },   // 天
+    { 0x7cfb, 0, 0, 7089 },   // 系
+    { 0x6597, 0, 0, 7166 },   // 斗
+    { 0x6597, 0, 0, 7168 },   // 斗
+    { 0x6311, 10031, 1, -1 },   // 挑
+    { 0x7626, 0, 0, 7250 },   // 瘦
+    { 0x7d20, 0, 0, 7251 },   // 素
+    { 0x5929, 10032, 1, -1 },   // 天
+    { 0x725b, 0, 0, 7278 },   // 牛
+    { 0x79c0, 0, 0, 7281 },   // 秀
+    { 0x767d, 0, 0, 7283 },   // 白
+    { 0x4f24, 0, 0, 7298 },   // 伤
+    { 0x7269, 0, 0, 31 },   // 物
+    { 0x9762, 0, 0, 222 },   // 面
+    { 0x67aa, 0, 0, 272 },   // 枪
+    { 0x514b, 0, 0, 347 },   // 克
+    { 0x83b1, 0, 0, 393 },   // 莱
+    { 0x8868, 0, 0, 492 },   // 表
+    { 0x53f2, 0, 0, 495 },   // 史
+    { 0x5386, 10033, 1, 496 },   // 历
+    { 0x592a, 10034, 1, -1 },   // 太
+    { 0x5386, 10035, 1, 727 },   // 历
+    { 0x821f, 0, 0, 1002 },   // 舟
+    { 0x672c, 0, 0, 1326 },   // 本
+    { 0x535c, 0, 0, 1401 },   // 卜
+    { 0x56e2, 0, 0, 1505 },   // 团
+    { 0x65e5, 0, 0, 1758 },   // 日
+    { 0x8868, 0, 0, 1871 },   // 表
+    { 0x9762, 0, 0, 1925 },   // 面
+    { 0x8fa3, 0, 0, 2057 },   // 辣
+    { 0x7684, 10036, 1, -1 },   // 的
+    { 0x9762, 0, 0, 2188 },   // 面
+    { 0x53f2, 0, 0, 2297 },   // 史
+    { 0x9152, 0, 0, 2449 },   // 酒
+    { 0x9152, 0, 0, 2464 },   // 酒
+    { 0x5f0f, 0, 0, 2539 },   // 式
+    { 0x5f90, 0, 0, 2622 },   // 徐
+    { 0x866b, 0, 0, 2972 },   // 虫
+    { 0x541f, 10037, 1, -1 },   // 吟
+    { 0x5fb7, 10038, 1, -1 },   // 德
+    { 0x4e66, 0, 0, 3205 },   // 书
+    { 0x8bed, 0, 0, 3446 },   // 语
+    { 0x8303, 0, 0, 3499 },   // 范
+    { 0x5bfa, 0, 0, 3503 },   // 寺
+    { 0x53f2, 0, 0, 3530 },   // 史
+    { 0x5386, 0, 0, 3685 },   // 历
+    { 0x53bb, 0, 0, 3832 },   // 去
+    { 0x4e4b, 10039, 1, -1 },   // 之
+    { 0x949f, 0, 0, 4037 },   // 钟
+    { 0x5b50, 0, 0, 4135 },   // 子
+    { 0x5b50, 0, 0, 4269 },   // 子
+    { 0x54b8, 0, 0, 4487 },   // 咸
+    { 0x671f, 0, 0, 4617 },   // 期
+    { 0x98ce, 0, 0, 4636 },   // 风
+    { 0x5386, 10040, 1, 4641 },   // 历
+    { 0x65af, 10041, 1, -1 },   // 斯
+    { 0x9e23, 0, 0, 6349 },   // 鸣
+    { 0x9e23, 0, 0, 6350 },   // 鸣
+    { 0x54cd, 0, 0, 6351 },   // 响
+    { 0x54d1, 0, 0, 6352 },   // 哑
+    { 0x672f, 10042, 1, -1 },   // 术
+    { 0x8239, 0, 0, 6715 },   // 船
+    { 0x53f2, 0, 0, 6917 },   // 史
+    { 0x5973, 10043, 1, -1 },   // 女
+    { 0x671f, 0, 0, 7015 },   // 期
+    { 0x9aa8, 10044, 1, -1 },   // 骨
+    { 0x5f55, 0, 0, 7261 },   // 录
+    { 0x53f2, 0, 0, 497 },   // 史
+    { 0x5b50, 0, 0, 521 },   // 子
+    { 0x53f2, 0, 0, 728 },   // 史
+    { 0x8fa3, 0, 0, 2068 },   // 辣
+    { 0x516e, 0, 0, 3093 },   // 兮
+    { 0x949f, 0, 0, 3109 },   // 钟
+    { 0x5730, 0, 0, 4023 },   // 地
+    { 0x53f2, 0, 0, 4642 },   // 史
+    { 0x514b, 0, 0, 5925 },   // 克
+    { 0x5e08, 0, 0, 6419 },   // 师
+    { 0x795e, 0, 0, 6945 },   // 神
+    { 0x5934, 0, 0, 7171 },   // 头
+};
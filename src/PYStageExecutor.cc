@@ -0,0 +1,130 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "PYStageExecutor.h"
+
+namespace PY {
+
+/* at most four threads including the calling thread. */
+#define STAGE_EXECUTOR_MAX_THREADS (4)
+
+struct StageExecutor::Job {
+    StageFunc func;
+    gpointer data;
+    guint n;
+    guint chunk_size;
+
+    gint next;          /* the begin of the next unclaimed chunk */
+    gint done;          /* the number of finished items */
+    gint ref_count;     /* late workers may still hold the job */
+
+    GMutex lock;
+    GCond cond;
+};
+
+GThreadPool *StageExecutor::m_pool = NULL;
+guint StageExecutor::m_threads = 0;
+
+/* claim the chunks until none is left, the faster threads take
+   more chunks. */
+void
+StageExecutor::runChunks (Job *job)
+{
+    while (TRUE) {
+        guint begin = g_atomic_int_add (&job->next, job->chunk_size);
+        if (begin >= job->n)
+            break;
+        guint end = MIN (begin + job->chunk_size, job->n);
+
+        job->func (begin, end, job->data);
+
+        if (g_atomic_int_add (&job->done, end - begin) + (end - begin) ==
+            job->n) {
+            g_mutex_lock (&job->lock);
+            g_cond_signal (&job->cond);
+            g_mutex_unlock (&job->lock);
+        }
+    }
+}
+
+void
+StageExecutor::unrefJob (Job *job)
+{
+    if (!g_atomic_int_dec_and_test (&job->ref_count))
+        return;
+
+    g_mutex_clear (&job->lock);
+    g_cond_clear (&job->cond);
+    g_slice_free (Job, job);
+}
+
+void
+StageExecutor::workerFunc (gpointer data, gpointer user_data)
+{
+    Job *job = static_cast<Job *> (data);
+    runChunks (job);
+    unrefJob (job);
+}
+
+void
+StageExecutor::run (guint n, guint chunk_size, StageFunc func, gpointer data)
+{
+    if (G_UNLIKELY (0 == m_threads))
+        m_threads = MIN (g_get_num_processors (), STAGE_EXECUTOR_MAX_THREADS);
+
+    guint helpers = MIN (m_threads, (n + chunk_size - 1) / chunk_size) - 1;
+
+    /* not worth the threads. */
+    if (helpers == 0 || n == 0) {
+        if (n)
+            func (0, n, data);
+        return;
+    }
+
+    if (G_UNLIKELY (NULL == m_pool))
+        m_pool = g_thread_pool_new (StageExecutor::workerFunc, NULL,
+                                    m_threads - 1, FALSE, NULL);
+
+    Job *job = g_slice_new (Job);
+    job->func = func;
+    job->data = data;
+    job->n = n;
+    job->chunk_size = chunk_size;
+    job->next = 0;
+    job->done = 0;
+    job->ref_count = 1 + helpers;
+    g_mutex_init (&job->lock);
+    g_cond_init (&job->cond);
+
+    for (guint i = 0; i < helpers; i++)
+        g_thread_pool_push (m_pool, job, NULL);
+
+    runChunks (job);
+
+    g_mutex_lock (&job->lock);
+    while ((guint) g_atomic_int_get (&job->done) < n)
+        g_cond_wait (&job->cond, &job->lock);
+    g_mutex_unlock (&job->lock);
+
+    unrefJob (job);
+}
+
+};
@@ -0,0 +1,50 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __PY_STAGE_EXECUTOR_H_
+#define __PY_STAGE_EXECUTOR_H_
+
+#include <glib.h>
+
+namespace PY {
+
+typedef void (* StageFunc) (guint begin, guint end, gpointer data);
+
+/* Run the pure candidate stages on a small thread pool. */
+class StageExecutor {
+public:
+    /* call func on the chunks of [0, n), the calling thread takes
+       part in the work and returns after all chunks are done. */
+    static void run (guint n, guint chunk_size, StageFunc func, gpointer data);
+
+private:
+    struct Job;
+    static void runChunks (Job *job);
+    static void unrefJob (Job *job);
+    static void workerFunc (gpointer data, gpointer user_data);
+
+    static GThreadPool *m_pool;
+    static guint m_threads;
+};
+
+};
+
+#endif
@@ -0,0 +1,133 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYStats.h"
+
+namespace PY {
+
+#define STATS_OBJECT_PATH "/org/freedesktop/IBus/Libpinyin/Stats"
+#define STATS_INTERFACE "org.freedesktop.IBus.Libpinyin.Stats"
+
+static const char * const stats_counter_names[STATS_LAST] = {
+    "keys.init",
+    "keys.punct",
+    "keys.raw",
+    "keys.english",
+    "keys.stroke",
+    "keys.extension",
+    "keys.suggestion",
+    "candidates",
+    "traditional_cache.hits",
+    "traditional_cache.misses",
+    "lua_converter_cache.hits",
+    "lua_converter_cache.misses",
+    "suggestion_cache.hits",
+    "suggestion_cache.misses",
+    "cloud_cache.hits",
+    "cloud_cache.misses",
+    "save_user_db.calls",
+    "save_user_db.time_us",
+    "persistence.wakeups",
+    "english_db.queries",
+    "english_db.time_us",
+    "english_inline.skips",
+    "stroke_db.queries",
+    "stroke_db.time_us",
+    "lua.calls",
+    "lua.time_us",
+    "context_init.calls",
+    "context_init.time_us",
+    "reclaim.calls",
+    "reclaim.time_us",
+    "reclaim.freed_kib",
+    "memory.rss_kib",
+    "memory.rss_high_water_kib",
+    "memory.heap_high_water_kib",
+    "sqlite.high_water_kib",
+};
+
+static const gchar stats_introspection_xml[] =
+    "<node>"
+    "  <interface name='" STATS_INTERFACE "'>"
+    "    <method name='GetCounters'>"
+    "      <arg type='a{st}' name='counters' direction='out'/>"
+    "    </method>"
+    "  </interface>"
+    "</node>";
+
+std::atomic<guint64> Stats::m_counters[STATS_LAST];
+
+gboolean
+Stats::registerObject (GDBusConnection *connection)
+{
+    static const GDBusInterfaceVTable vtable = {
+        Stats::methodCall, NULL, NULL,
+    };
+
+    GError *error = NULL;
+    GDBusNodeInfo *info =
+        g_dbus_node_info_new_for_xml (stats_introspection_xml, &error);
+    if (info == NULL) {
+        g_warning ("can not parse the stats interface: %s", error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+
+    guint id = g_dbus_connection_register_object
+        (connection, STATS_OBJECT_PATH, info->interfaces[0], &vtable,
+         NULL, NULL, &error);
+    g_dbus_node_info_unref (info);
+
+    if (id == 0) {
+        g_warning ("can not export the stats: %s", error->message);
+        g_error_free (error);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void
+Stats::methodCall (GDBusConnection *connection,
+                   const gchar *sender,
+                   const gchar *object_path,
+                   const gchar *interface_name,
+                   const gchar *method_name,
+                   GVariant *parameters,
+                   GDBusMethodInvocation *invocation,
+                   gpointer user_data)
+{
+    if (g_strcmp0 (method_name, "GetCounters") != 0) {
+        g_dbus_method_invocation_return_error
+            (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD,
+             "unknown method %s", method_name);
+        return;
+    }
+
+    GVariantBuilder builder;
+    g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{st}"));
+    for (guint i = 0; i < STATS_LAST; i++)
+        g_variant_builder_add (&builder, "{st}", stats_counter_names[i],
+                               get ((StatsCounter) i));
+
+    g_dbus_method_invocation_return_value
+        (invocation, g_variant_new ("(a{st})", &builder));
+}
+
+};
@@ -0,0 +1,144 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_STATS_H_
+#define __PY_STATS_H_
+
+#include <gio/gio.h>
+#include <atomic>
+
+namespace PY {
+
+/* the always-on counters, the times are in microseconds,
+   each calls counter is followed by its time counter. */
+enum StatsCounter {
+    STATS_KEYS_INIT = 0,
+    STATS_KEYS_PUNCT,
+    STATS_KEYS_RAW,
+    STATS_KEYS_ENGLISH,
+    STATS_KEYS_STROKE,
+    STATS_KEYS_EXTENSION,
+    STATS_KEYS_SUGGESTION,
+    STATS_CANDIDATES,
+    STATS_TRADITIONAL_CACHE_HITS,
+    STATS_TRADITIONAL_CACHE_MISSES,
+    STATS_LUA_CONVERTER_CACHE_HITS,
+    STATS_LUA_CONVERTER_CACHE_MISSES,
+    STATS_SUGGESTION_CACHE_HITS,
+    STATS_SUGGESTION_CACHE_MISSES,
+    STATS_CLOUD_CACHE_HITS,
+    STATS_CLOUD_CACHE_MISSES,
+    STATS_SAVES,
+    STATS_SAVE_TIME,
+    /* the wakeups of the persistence scheduler. */
+    STATS_PERSISTENCE_WAKEUPS,
+    STATS_ENGLISH_QUERIES,
+    STATS_ENGLISH_QUERY_TIME,
+    /* the inline english candidates skipped by the time budget. */
+    STATS_ENGLISH_INLINE_SKIPS,
+    STATS_STROKE_QUERIES,
+    STATS_STROKE_QUERY_TIME,
+    STATS_LUA_CALLS,
+    STATS_LUA_CALL_TIME,
+    STATS_CONTEXT_INITS,
+    STATS_CONTEXT_INIT_TIME,
+    STATS_RECLAIMS,
+    STATS_RECLAIM_TIME,
+    STATS_RECLAIMED,
+    /* the gauges in KiB, updated by each reclaim. */
+    STATS_RSS,
+    STATS_RSS_HIGH_WATER,
+    STATS_HEAP_HIGH_WATER,
+    STATS_SQLITE_HIGH_WATER,
+    STATS_LAST
+};
+
+/* Aggregate counters of the process, read over D-Bus. The counters
+ * are relaxed atomics, so the key path only pays the increments. */
+class Stats {
+public:
+    static void add (StatsCounter counter, guint64 value = 1)
+    {
+        m_counters[counter].fetch_add (value, std::memory_order_relaxed);
+    }
+
+    static void set (StatsCounter counter, guint64 value)
+    {
+        m_counters[counter].store (value, std::memory_order_relaxed);
+    }
+
+    static void setMax (StatsCounter counter, guint64 value)
+    {
+        guint64 old = get (counter);
+        while (old < value &&
+               !m_counters[counter].compare_exchange_weak
+               (old, value, std::memory_order_relaxed));
+    }
+
+    static guint64 get (StatsCounter counter)
+    {
+        return m_counters[counter].load (std::memory_order_relaxed);
+    }
+
+    /* count the hits and the misses of a cache, the misses counter
+       follows the hits counter, STATS_LAST is not counted. */
+    static void lookup (StatsCounter hits, gboolean hit)
+    {
+        if (hits != STATS_LAST)
+            add (hit ? hits : (StatsCounter) (hits + 1));
+    }
+
+    /* export the counters on the connection of the bus name. */
+    static gboolean registerObject (GDBusConnection *connection);
+
+private:
+    static void methodCall (GDBusConnection *connection,
+                            const gchar *sender,
+                            const gchar *object_path,
+                            const gchar *interface_name,
+                            const gchar *method_name,
+                            GVariant *parameters,
+                            GDBusMethodInvocation *invocation,
+                            gpointer user_data);
+
+    static std::atomic<guint64> m_counters[STATS_LAST];
+};
+
+/* Count a call and its elapsed time, the time counter follows. */
+class StatsScope {
+public:
+    StatsScope (StatsCounter calls)
+        : m_calls (calls), m_start (g_get_monotonic_time ()) { }
+
+    ~StatsScope (void)
+    {
+        Stats::add (m_calls);
+        Stats::add ((StatsCounter) (m_calls + 1),
+                    g_get_monotonic_time () - m_start);
+    }
+
+private:
+    StatsCounter m_calls;
+    gint64 m_start;
+};
+
+};
+
+#endif
@@ -37,30 +37,78 @@ public:
 
     String & printf (const gchar *fmt, ...)
     {
-        gchar *str;
         va_list args;
 
+        clear ();
         va_start (args, fmt);
-        str = g_strdup_vprintf (fmt, args);
+        appendVprintf (fmt, args);
         va_end (args);
-
-        assign (str);
-        g_free (str);
         return *this;
     }
 
     String & appendPrintf (const gchar *fmt, ...)
     {
-        gchar *str;
         va_list args;
 
         va_start (args, fmt);
-        str = g_strdup_vprintf (fmt, args);
+        appendVprintf (fmt, args);
         va_end (args);
+        return *this;
+    }
 
-        append (str);
-        g_free (str);
+    /* format into the inline buffer first, the longer result is
+       formatted again into the reserved tail of the string. */
+    String & appendVprintf (const gchar *fmt, va_list args)
+    {
+        gchar buf[128];
+        va_list copy;
+
+        va_copy (copy, args);
+        gint len = g_vsnprintf (buf, sizeof (buf), fmt, copy);
+        va_end (copy);
+
+        if (G_UNLIKELY (len < 0))
+            return *this;
+
+        if (G_LIKELY (len < (gint) sizeof (buf))) {
+            append (buf, len);
+            return *this;
+        }
+
+        size_type pos = size ();
+        resize (pos + len);
+        g_vsnprintf (&*(begin () + pos), len + 1, fmt, args);
+        return *this;
+    }
 
+    String & appendInt (gint64 i)
+    {
+        if (i < 0) {
+            append (1, '-');
+            return appendUInt (- (guint64) i);
+        }
+        return appendUInt (i);
+    }
+
+    String & appendUInt (guint64 i)
+    {
+        gchar buf[20];
+        gchar *p = buf + sizeof (buf);
+
+        do {
+            *--p = '0' + i % 10;
+            i /= 10;
+        } while (i);
+
+        append (p, buf + sizeof (buf) - p);
+        return *this;
+    }
+
+    /* in the C locale, such as the numbers in the sql. */
+    String & appendDouble (gdouble d)
+    {
+        gchar buf[G_ASCII_DTOSTR_BUF_SIZE];
+        append (g_ascii_dtostr (buf, sizeof (buf), d));
         return *this;
     }
 
@@ -93,12 +141,12 @@ public:
 
     String & operator<< (gint i)
     {
-        return appendPrintf ("%d", i);
+        return appendInt (i);
     }
 
     String & operator<< (guint i)
     {
-        return appendPrintf ("%u", i);
+        return appendUInt (i);
     }
 
     String & operator<< (const gchar ch)
@@ -0,0 +1,99 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __PY_STRING_ARENA_H_
+#define __PY_STRING_ARENA_H_
+
+#include <glib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace PY {
+
+/* Bump allocator of NUL-terminated strings, the chunks are kept
+ * and re-used after clear, only the large strings are freed. */
+class StringArena {
+public:
+    StringArena (gsize chunk_size = 4096)
+        : m_chunk_size (chunk_size), m_current (0), m_used (0) { }
+
+    ~StringArena (void)
+    {
+        clear ();
+        for (gsize i = 0; i < m_chunks.size (); i++)
+            g_free (m_chunks[i]);
+    }
+
+    const gchar * dup (const std::string & str)
+    {
+        gsize size = str.size () + 1;
+        gchar *dest = NULL;
+
+        if (G_UNLIKELY (size > m_chunk_size)) {
+            dest = (gchar *) g_malloc (size);
+            m_large.push_back (dest);
+        } else {
+            if (m_chunks.empty () || m_used + size > m_chunk_size) {
+                if (!m_chunks.empty ())
+                    m_current ++;
+                if (m_current == m_chunks.size ())
+                    m_chunks.push_back ((gchar *) g_malloc (m_chunk_size));
+                m_used = 0;
+            }
+            dest = m_chunks[m_current] + m_used;
+            m_used += size;
+        }
+
+        memcpy (dest, str.c_str (), size);
+        return dest;
+    }
+
+    void clear (void)
+    {
+        for (gsize i = 0; i < m_large.size (); i++)
+            g_free (m_large[i]);
+        m_large.clear ();
+        m_current = 0;
+        m_used = 0;
+    }
+
+    /* keep only the first chunk. */
+    void shrink (void)
+    {
+        clear ();
+        for (gsize i = 1; i < m_chunks.size (); i++)
+            g_free (m_chunks[i]);
+        if (m_chunks.size () > 1)
+            m_chunks.resize (1);
+    }
+
+private:
+    gsize m_chunk_size;
+    std::vector<gchar *> m_chunks;
+    std::vector<gchar *> m_large;
+    gsize m_current;
+    gsize m_used;
+};
+
+};
+
+#endif
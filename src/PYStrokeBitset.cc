@@ -0,0 +1,217 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYStrokeBitset.h"
+#include <string.h>
+
+namespace PY {
+
+#define STROKE_BITSET_MAGIC "PYSTRBS1"
+
+/* in the order of the bitsets of a position. */
+static const char stroke_types[] = "hspnz";
+
+/* All integers are stored in little endian, see data/stroke-bitset.py. */
+struct StrokeBitset::Header {
+    gchar magic[8];
+    guint32 n_characters;
+    guint32 n_positions;
+    guint32 n_words;
+    guint32 bitsets_offset;
+    guint32 characters_offset;
+    guint32 strings_offset;
+};
+
+StrokeBitset::StrokeBitset ()
+    : m_file (NULL),
+      m_data (NULL),
+      m_length (0),
+      m_n_characters (0),
+      m_n_positions (0),
+      m_n_words (0),
+      m_bitsets (NULL),
+      m_characters (NULL),
+      m_strings (NULL)
+{
+}
+
+StrokeBitset::~StrokeBitset ()
+{
+    unload ();
+}
+
+void
+StrokeBitset::unload (void)
+{
+    if (m_file)
+        g_mapped_file_unref (m_file);
+    m_file = NULL;
+    m_data = NULL;
+    m_length = 0;
+    m_n_characters = 0;
+    m_n_positions = 0;
+    m_n_words = 0;
+    m_bitsets = NULL;
+    m_characters = NULL;
+    m_strings = NULL;
+}
+
+gboolean
+StrokeBitset::load (const char *filename)
+{
+    unload ();
+
+    if (!g_file_test (filename, G_FILE_TEST_IS_REGULAR))
+        return FALSE;
+
+    GMappedFile *file = g_mapped_file_new (filename, FALSE, NULL);
+    if (file == NULL)
+        return FALSE;
+
+    const gchar *data = g_mapped_file_get_contents (file);
+    gsize length = g_mapped_file_get_length (file);
+    const Header *header = (const Header *) data;
+
+    do {
+        if (length < sizeof (Header))
+            break;
+        if (memcmp (header->magic, STROKE_BITSET_MAGIC, sizeof (header->magic)))
+            break;
+
+        guint32 n_characters = GUINT32_FROM_LE (header->n_characters);
+        guint32 n_positions = GUINT32_FROM_LE (header->n_positions);
+        guint32 n_words = GUINT32_FROM_LE (header->n_words);
+        guint32 bitsets_offset = GUINT32_FROM_LE (header->bitsets_offset);
+        guint32 characters_offset = GUINT32_FROM_LE (header->characters_offset);
+        guint32 strings_offset = GUINT32_FROM_LE (header->strings_offset);
+
+        /* check the sections are inside of the file, in order. */
+        if (n_words != (n_characters + 31) / 32 || bitsets_offset % 4)
+            break;
+        if (bitsets_offset + (guint64) n_positions * N_STROKE_TYPES *
+            n_words * sizeof (guint32) > characters_offset)
+            break;
+        if (characters_offset + (guint64) n_characters * sizeof (guint32) >
+            strings_offset)
+            break;
+        if (strings_offset > length || data[length - 1] != '\0')
+            break;
+
+        m_file = file;
+        m_data = data;
+        m_length = length;
+        m_n_characters = n_characters;
+        m_n_positions = n_positions;
+        m_n_words = n_words;
+        m_bitsets = (const guint32 *) (data + bitsets_offset);
+        m_characters = (const guint32 *) (data + characters_offset);
+        m_strings = data + strings_offset;
+        return TRUE;
+    } while (0);
+
+    g_warning ("invalid stroke bitset: %s.\n", filename);
+    g_mapped_file_unref (file);
+    return FALSE;
+}
+
+/* the plain loops over the words are vectorized by the compiler. */
+static void
+bitset_and (guint32 *result, const guint32 *bitset, guint n_words)
+{
+    for (guint i = 0; i < n_words; i++)
+        result[i] &= GUINT32_FROM_LE (bitset[i]);
+}
+
+static void
+bitset_and_any (guint32 *result, const guint32 *bitsets, guint n_bitsets,
+                guint n_words)
+{
+    for (guint i = 0; i < n_words; i++) {
+        guint32 any = 0;
+        for (guint j = 0; j < n_bitsets; j++)
+            any |= GUINT32_FROM_LE (bitsets[j * n_words + i]);
+        result[i] &= any;
+    }
+}
+
+gboolean
+StrokeBitset::match (const char *strokes, Bitset & result) const
+{
+    result.clear ();
+    if (!isLoaded ())
+        return FALSE;
+
+    guint len = strlen (strokes);
+    if (0 == len || len > m_n_positions)
+        return FALSE;
+
+    /* the bits after the last character are cleared by the bitsets. */
+    result.assign (m_n_words, ~0u);
+
+    for (guint position = 0; position < len; position++) {
+        if (STROKE_WILDCARD == strokes[position])
+            continue;
+
+        const char *stroke = strchr (stroke_types, strokes[position]);
+        if (NULL == stroke || '\0' == *stroke) {
+            result.clear ();
+            return FALSE;
+        }
+        bitset_and (&result[0], bitset (position, stroke - stroke_types),
+                    m_n_words);
+    }
+
+    /* the trailing wildcard matches the characters of more strokes. */
+    if (STROKE_WILDCARD == strokes[len - 1])
+        bitset_and_any (&result[0], bitset (len - 1, 0), N_STROKE_TYPES,
+                        m_n_words);
+
+    return next (result, 0) >= 0;
+}
+
+gint
+StrokeBitset::next (const Bitset & result, guint index)
+{
+    guint i = index / 32;
+    if (i >= result.size ())
+        return -1;
+
+    guint32 word = result[i] & (~0u << (index % 32));
+    while (0 == word) {
+        if (++i >= result.size ())
+            return -1;
+        word = result[i];
+    }
+    return i * 32 + g_bit_nth_lsf (word, -1);
+}
+
+const char *
+StrokeBitset::character (guint index) const
+{
+    if (G_UNLIKELY (index >= m_n_characters))
+        return NULL;
+
+    guint32 offset = GUINT32_FROM_LE (m_characters[index]);
+    if (G_UNLIKELY (offset >= m_length - (m_strings - m_data)))
+        return NULL;
+    return m_strings + offset;
+}
+
+};
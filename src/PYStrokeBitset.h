@@ -0,0 +1,80 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2010-2011 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_STROKE_BITSET_
+#define __PY_STROKE_BITSET_
+
+#include <glib.h>
+#include <vector>
+
+namespace PY {
+
+/* matches any stroke. */
+#define STROKE_WILDCARD 'x'
+
+/* Read only positional bitset index of the strokes table, generated by
+ * data/stroke-bitset.py and mapped into memory. The bits of the
+ * characters are in sequence order. */
+class StrokeBitset {
+public:
+    typedef std::vector<guint32> Bitset;
+
+    StrokeBitset ();
+    ~StrokeBitset ();
+
+    gboolean load (const char *filename);
+    gboolean isLoaded (void) const { return m_file != NULL; }
+
+    /* Match the strokes from the first one, with the wildcards, the
+     * matched characters are set in the result. */
+    gboolean match (const char *strokes, Bitset & result) const;
+
+    /* The index of the first matched character from index, or -1. */
+    static gint next (const Bitset & result, guint index);
+    const char *character (guint index) const;
+
+private:
+    struct Header;
+
+    const guint32 *bitset (guint position, guint stroke) const
+    {
+        return m_bitsets + (position * N_STROKE_TYPES + stroke) * m_n_words;
+    }
+
+    void unload (void);
+
+    static const guint N_STROKE_TYPES = 5;
+
+    GMappedFile *m_file;
+    const gchar *m_data;
+    gsize m_length;
+
+    guint32 m_n_characters;
+    guint32 m_n_positions;
+    guint32 m_n_words;
+
+    const guint32 *m_bitsets;
+    const guint32 *m_characters;
+    const gchar *m_strings;
+};
+
+};
+
+#endif
@@ -27,13 +27,114 @@
 #include <glib.h>
 #include <sqlite3.h>
 #include "PYString.h"
+#include "PYTypes.h"
 #include "PYConfig.h"
+#include "PYPrefixIndex.h"
+#include "PYStrokeBitset.h"
+#include "PYStats.h"
+#include "PYReclaim.h"
 
 #define _(text) (gettext (text))
 
 namespace PY {
 
-class StrokeDatabase{
+/* Step the characters of a strokes prefix in sequence order, only the
+   rows of the shown pages are read, and the query is kept open between
+   the pages instead of being re-run with an offset. The strokes with
+   the wildcards are matched in the bitset index. */
+class StrokeCursor {
+    friend class StrokeDatabase;
+
+public:
+    StrokeCursor () {
+        m_stmt = NULL;
+        m_wildcard_stmt = NULL;
+        m_active_stmt = NULL;
+        m_index = NULL;
+        m_bitset = NULL;
+        m_position = 0;
+        m_done = TRUE;
+    }
+
+    /* finalized before the database is closed. */
+    ~StrokeCursor () {
+        if (m_stmt) {
+            sqlite3_finalize (m_stmt);
+            m_stmt = NULL;
+        }
+        if (m_wildcard_stmt) {
+            sqlite3_finalize (m_wildcard_stmt);
+            m_wildcard_stmt = NULL;
+        }
+    }
+
+    /* The character is valid until the next call. */
+    gboolean next (const char * & character) {
+        if (m_done)
+            return FALSE;
+
+        if (m_index) {
+            PrefixIndex::Word word;
+            if (m_position >= m_range.size () ||
+                !m_index->getWord (m_range, m_position, word)) {
+                m_done = TRUE;
+                return FALSE;
+            }
+            m_position ++;
+            character = word.word;
+            return TRUE;
+        }
+
+        if (m_bitset) {
+            gint index = StrokeBitset::next (m_matched, m_position);
+            character = index >= 0 ? m_bitset->character (index) : NULL;
+            if (NULL == character) {
+                m_done = TRUE;
+                return FALSE;
+            }
+            m_position = index + 1;
+            return TRUE;
+        }
+
+        gint64 start = g_get_monotonic_time ();
+        int result = sqlite3_step (m_active_stmt);
+        Stats::add (STATS_STROKE_QUERY_TIME, g_get_monotonic_time () - start);
+
+        if (result != SQLITE_ROW ||
+            sqlite3_column_type (m_active_stmt, 0) != SQLITE_TEXT) {
+            close ();
+            return FALSE;
+        }
+        character = (const char *) sqlite3_column_text (m_active_stmt, 0);
+        return TRUE;
+    }
+
+    /* the statements are kept for the next prefix. */
+    void close (void) {
+        if (m_active_stmt)
+            sqlite3_reset (m_active_stmt);
+        m_active_stmt = NULL;
+        m_index = NULL;
+        m_bitset = NULL;
+        m_done = TRUE;
+    }
+
+private:
+    sqlite3_stmt *m_stmt;
+    sqlite3_stmt *m_wildcard_stmt;
+    sqlite3_stmt *m_active_stmt;
+
+    const PrefixIndex *m_index;
+    PrefixIndex::Range m_range;
+    guint m_position;
+
+    const StrokeBitset *m_bitset;
+    StrokeBitset::Bitset m_matched;
+
+    gboolean m_done;
+};
+
+class StrokeDatabase : public Reclaimable {
 public:
     StrokeDatabase(){
         m_sqlite = NULL;
@@ -97,66 +198,172 @@ public:
             return FALSE;
         }
 
+        String sql;
+        sql.printf ("PRAGMA mmap_size = %d; PRAGMA query_only = ON;",
+                    SYSTEM_DB_MMAP_SIZE);
+        sqlite3_exec (m_sqlite, sql, NULL, NULL, NULL);
+
         return TRUE;
     }
 
-    /* List the characters in sequence order. */
-    gboolean listCharacters(const char *prefix,
-                            std::vector<std::string> & characters){
-        sqlite3_stmt *stmt = NULL;
-        const char *tail = NULL;
-        characters.clear ();
-
-        /* list characters */
-        const char *SQL_DB_LIST =
-            "SELECT \"character\", \"token\" FROM \"strokes\""
-            "WHERE \"strokes\" LIKE \"%s%\" ORDER BY \"sequence\" ASC;";
-        m_sql.printf (SQL_DB_LIST, prefix);
-        int result = sqlite3_prepare_v2 (m_sqlite, m_sql.c_str(), -1, &stmt, &tail);
-        if (result != SQLITE_OK)
+    /* Load the prefix index of the strokes table. */
+    gboolean openIndex(const char *filename) {
+        return m_index.load (filename);
+    }
+
+    /* Load the bitset index of the strokes table. */
+    gboolean openBitset(const char *filename) {
+        return m_bitset.load (filename);
+    }
+
+    /* Open the cursor of the prefix. */
+    gboolean openCursor(const char *prefix, StrokeCursor & cursor){
+        cursor.close ();
+
+        if (strchr (prefix, STROKE_WILDCARD))
+            return openWildcardCursor (prefix, cursor);
+
+        if (m_index.isLoaded ()) {
+            if (!m_index.lookup (prefix, cursor.m_range))
+                return FALSE;
+
+            cursor.m_index = &m_index;
+            cursor.m_position = 0;
+            cursor.m_done = FALSE;
+            return TRUE;
+        }
+
+        if (m_sqlite == NULL)
             return FALSE;
 
-        result = sqlite3_step (stmt);
-        while (result == SQLITE_ROW){
-            /* get the characters. */
-            result = sqlite3_column_type (stmt, 0);
-            if (result != SQLITE_TEXT)
+        /* the statement is prepared once per cursor and reused. */
+        if (cursor.m_stmt == NULL) {
+            const char *SQL_DB_LIST =
+                "SELECT \"character\" FROM \"strokes\" "
+                "WHERE \"strokes\" >= ?1 AND \"strokes\" < ?1 || x'ff' "
+                "ORDER BY \"sequence\" ASC;";
+            if (sqlite3_prepare_v2 (m_sqlite, SQL_DB_LIST, -1,
+                                    &cursor.m_stmt, NULL) != SQLITE_OK) {
+                cursor.m_stmt = NULL;
                 return FALSE;
+            }
+        }
 
-            const char *character = (const char *)sqlite3_column_text (stmt, 0);
-            characters.push_back (character);
+        sqlite3_bind_text (cursor.m_stmt, 1, prefix, -1, SQLITE_TRANSIENT);
+        cursor.m_active_stmt = cursor.m_stmt;
+        cursor.m_done = FALSE;
+        /* the rows are stepped by the cursor, see StrokeCursor::next. */
+        Stats::add (STATS_STROKE_QUERIES);
+        return TRUE;
+    }
 
-            result = sqlite3_step (stmt);
+    /* Open the cursor of the prefix with the wildcards, the bitsets of
+       the positions are and-ed, the characters are in sequence order. */
+    gboolean openWildcardCursor(const char *prefix, StrokeCursor & cursor){
+        if (m_bitset.isLoaded ()) {
+            if (!m_bitset.match (prefix, cursor.m_matched))
+                return FALSE;
+
+            cursor.m_bitset = &m_bitset;
+            cursor.m_position = 0;
+            cursor.m_done = FALSE;
+            return TRUE;
         }
 
-        sqlite3_finalize (stmt);
-        if (result != SQLITE_DONE)
+        if (m_sqlite == NULL)
             return FALSE;
+
+        /* fall back to the glob pattern of the wildcards. */
+        if (cursor.m_wildcard_stmt == NULL) {
+            const char *SQL_DB_GLOB =
+                "SELECT \"character\" FROM \"strokes\" "
+                "WHERE \"strokes\" GLOB ?1 "
+                "ORDER BY \"sequence\" ASC;";
+            if (sqlite3_prepare_v2 (m_sqlite, SQL_DB_GLOB, -1,
+                                    &cursor.m_wildcard_stmt,
+                                    NULL) != SQLITE_OK) {
+                cursor.m_wildcard_stmt = NULL;
+                return FALSE;
+            }
+        }
+
+        String pattern = prefix;
+        for (guint i = 0; i < pattern.length (); i++) {
+            if (STROKE_WILDCARD == pattern[i])
+                pattern[i] = '?';
+        }
+        pattern += '*';
+
+        sqlite3_bind_text (cursor.m_wildcard_stmt, 1, pattern.c_str (), -1,
+                           SQLITE_TRANSIENT);
+        cursor.m_active_stmt = cursor.m_wildcard_stmt;
+        cursor.m_done = FALSE;
+        Stats::add (STATS_STROKE_QUERIES);
         return TRUE;
     }
+
+    void reclaim (void){
+        if (m_sqlite)
+            sqlite3_db_release_memory (m_sqlite);
+        Stats::setMax (STATS_SQLITE_HIGH_WATER,
+                       sqlite3_memory_highwater (FALSE) / 1024);
+    }
 private:
     sqlite3 *m_sqlite;
     String m_sql;
+
+    PrefixIndex m_index;
+    StrokeBitset m_bitset;
 };
 
-StrokeEditor::StrokeEditor (PinyinProperties &props, Config &config)
-    : Editor (props, config)
+/* opened by the first stroke editor, closed with the last one. */
+static std::weak_ptr<StrokeDatabase> stroke_database;
+
+static std::shared_ptr<StrokeDatabase>
+open_stroke_database (void)
 {
-    m_stroke_database = new StrokeDatabase;
+    std::shared_ptr<StrokeDatabase> database = stroke_database.lock ();
+    if (database)
+        return database;
 
-    gboolean result = m_stroke_database->openDatabase
+    database.reset (new StrokeDatabase);
+
+    gboolean result = database->openDatabase
         (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "strokes.db") ||
-        m_stroke_database->openDatabase
+        database->openDatabase
         (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "strokes.db");
 
     if (!result)
         g_warning ("can't open strokes database.\n");
+
+    /* fall back to the sql query without the index. */
+    if (!database->openIndex
+        (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "strokes.index"))
+        database->openIndex
+            (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "strokes.index");
+
+    /* the wildcards fall back to the glob query without the bitsets. */
+    if (!database->openBitset
+        (".." G_DIR_SEPARATOR_S "data" G_DIR_SEPARATOR_S "strokes.bitset"))
+        database->openBitset
+            (PKGDATADIR G_DIR_SEPARATOR_S "db" G_DIR_SEPARATOR_S "strokes.bitset");
+
+    stroke_database = database;
+    return database;
+}
+
+StrokeEditor::StrokeEditor (PinyinProperties &props, Config &config)
+    : Editor (props, config),
+      m_lookup_table_complete (FALSE),
+      m_stroke_cursor (new StrokeCursor)
+{
+    m_stroke_database = open_stroke_database ();
 }
 
 StrokeEditor::~StrokeEditor ()
 {
-    delete m_stroke_database;
-    m_stroke_database = NULL;
+    m_stroke_cursor.reset ();
+    m_stroke_database.reset ();
 }
 
 gboolean
@@ -384,7 +591,7 @@ StrokeEditor::updateStateFromInput (void)
         clearLookupTable ();
 
         const char * help_string =
-            _("Please use \"hspnz\" to input.");
+            _("Please use \"hspnz\" to input, \"x\" for any stroke.");
         int space_len = std::max ( 0, m_aux_text_len
                                    - (int) g_utf8_strlen (help_string, -1));
         m_auxiliary_text.append(space_len, ' ');
@@ -398,17 +605,31 @@ StrokeEditor::updateStateFromInput (void)
     String prefix = m_text.substr (1);
     m_auxiliary_text += prefix;
 
-    /* lookup table candidate fill here. */
-    std::vector<std::string> characters;
-    gboolean retval = m_stroke_database->listCharacters
-        (prefix.c_str (), characters);
-    if (!retval)
+    /* lookup table candidate fill here, one more page is prefetched. */
+    clearLookupTable ();
+    m_lookup_table_complete = FALSE;
+    if (!m_stroke_database->openCursor (prefix.c_str (), *m_stroke_cursor)) {
+        m_lookup_table_complete = TRUE;
         return FALSE;
+    }
+    return fillLookupTable (2 * m_lookup_table.pageSize ());
+}
 
-    clearLookupTable ();
-    std::vector<std::string>::iterator iter;
-    for (iter = characters.begin (); iter != characters.end (); ++iter){
-        Text text(*iter);
+gboolean
+StrokeEditor::fillLookupTable (guint end)
+{
+    guint begin = m_lookup_table.size ();
+    if (m_lookup_table_complete || begin >= end)
+        return TRUE;
+
+    /* the characters are appended as they are stepped. */
+    const char *character = NULL;
+    for (guint i = begin; i < end; ++i) {
+        if (!m_stroke_cursor->next (character)) {
+            m_lookup_table_complete = TRUE;
+            break;
+        }
+        Text text (character);
         m_lookup_table.appendCandidate (text);
     }
     return TRUE;
@@ -427,6 +648,10 @@ StrokeEditor::pageUp (void)
 void
 StrokeEditor::pageDown (void)
 {
+    guint page_size = m_lookup_table.pageSize ();
+    guint cursor_pos = m_lookup_table.cursorPos ();
+    fillLookupTable ((cursor_pos / page_size + 3) * page_size);
+
     if (G_LIKELY (m_lookup_table.pageDown ())) {
         update ();
     }
@@ -443,6 +668,10 @@ StrokeEditor::cursorUp (void)
 void
 StrokeEditor::cursorDown (void)
 {
+    guint page_size = m_lookup_table.pageSize ();
+    guint cursor_pos = m_lookup_table.cursorPos ();
+    fillLookupTable ((cursor_pos / page_size + 2) * page_size);
+
     if (G_LIKELY (m_lookup_table.cursorDown ())) {
         update ();
     }
@@ -554,12 +783,13 @@ public:
         g_assert (retval);
         retval = db->openDatabase ("../data/strokes.db");
         g_assert (retval);
-        std::vector<std::string> chars;
-        std::vector<std::string>::iterator iter;
-        db->listCharacters("hshshhh", chars);
+        StrokeCursor cursor;
+        retval = db->openCursor("hshshhh", cursor);
+        g_assert (retval);
+        const char *character = NULL;
         printf ("characters:\t");
-        for (iter = chars.begin(); iter != chars.end(); ++iter)
-            printf ("%s ", iter->c_str());
+        while (cursor.next (character))
+            printf ("%s ", character);
         printf ("\n");
         printf ("stroke database test ok.\n");
     }
@@ -28,6 +28,7 @@
 namespace PY {
 
 class StrokeDatabase;
+class StrokeCursor;
 
 class StrokeEditor : public Editor {
 public:
@@ -47,6 +48,7 @@ private:
     gboolean updateStateFromInput (void);
 
     void clearLookupTable (void);
+    gboolean fillLookupTable (guint end);
     void updateLookupTable (void);
     void updatePreeditText (void);
     void updateAuxiliaryText (void);
@@ -67,11 +69,16 @@ private:
 private:
     /* variables */
     LookupTable m_lookup_table;
+    /* all candidates of the strokes are in the lookup table. */
+    gboolean m_lookup_table_complete;
 
     String m_preedit_text;
     String m_auxiliary_text;
 
-    StrokeDatabase *m_stroke_database;
+    /* shared by the stroke editors of all engines. */
+    std::shared_ptr<StrokeDatabase> m_stroke_database;
+    /* the characters of the strokes not yet in the lookup table. */
+    std::unique_ptr<StrokeCursor> m_stroke_cursor;
 
     const static int m_aux_text_len = 50;
 };
@@ -0,0 +1,97 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Check that the ordinary syllables inject no English emoji, the emoji
+ * names are only completed from the input not parsed as pinyin.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+#include <ibus.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <locale.h>
+#include "PYConfig.h"
+#include "PYPConfig.h"
+#include "PYLibPinyin.h"
+#include "PYPinyinProperties.h"
+#include "PYPFullPinyinEditor.h"
+
+using namespace PY;
+
+/* the candidates are checked after the deferred update. */
+class EmojiTestEditor : public FullPinyinEditor {
+public:
+    EmojiTestEditor (PinyinProperties & props, Config & config)
+        : FullPinyinEditor (props, config) { }
+
+    gboolean injectsEmoji (const char *pinyin)
+    {
+        reset ();
+        for (const char *p = pinyin; *p; p++) {
+            processKeyEvent (*p, 0, 0);
+            processKeyEvent (*p, 0, IBUS_RELEASE_MASK);
+        }
+        update ();
+
+        for (guint i = 0; i < m_candidates.size (); i++) {
+            if (CANDIDATE_EMOJI == m_candidates[i].m_candidate_type)
+                return TRUE;
+        }
+        return FALSE;
+    }
+};
+
+int
+main (gint argc, gchar **argv)
+{
+    static const char * const syllables[] = {
+        "shi", "you", "han", "she", "che", "wan", "ben",
+    };
+
+    setlocale (LC_ALL, "");
+    ibus_init ();
+
+    LibPinyinBackEnd::init ();
+    PinyinConfig::init ();
+    LibPinyinBackEnd::instance ().waitPinyinContext (-1);
+
+    gint failures = 0;
+    {
+        /* the editor is freed before the back end. */
+        PinyinProperties props (PinyinConfig::instance ());
+        EmojiTestEditor editor (props, PinyinConfig::instance ());
+        editor.focusIn ();
+
+        for (guint i = 0; i < G_N_ELEMENTS (syllables); i++) {
+            if (editor.injectsEmoji (syllables[i])) {
+                g_print ("FAIL: \"%s\" injects an emoji\n", syllables[i]);
+                failures ++;
+            }
+        }
+
+        editor.focusOut ();
+    }
+
+    LibPinyinBackEnd::finalize ();
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYTrace.h"
+#include <stdio.h>
+#include <string.h>
+#include <glib/gstdio.h>
+
+namespace PY {
+
+#define TRACE_REPORT_TIMEOUT (60)
+
+/* four buckets per power of two microseconds. */
+#define TRACE_SUB_BUCKETS (4)
+#define TRACE_BUCKETS (1 + TRACE_SUB_BUCKETS * 32)
+
+static const char * const trace_stage_names[TRACE_LAST] = {
+    "processKeyEvent",
+    "processAccelKeyEvent",
+    "parsePinyin",
+    "guessSentence",
+    "guessCandidates",
+    "libpinyinCandidates",
+    "luaTriggerCandidates",
+    "luaConverterCandidates",
+    "emojiCandidates",
+    "englishCandidates",
+    "traditionalCandidates",
+    "fillLookupTable",
+    "updatePreeditText",
+    "updateAuxiliaryText",
+    "updateLookupTable",
+};
+
+struct TraceHistogram {
+    guint64 buckets[TRACE_BUCKETS];
+    guint64 count;
+    gint64 max;
+};
+
+static TraceHistogram trace_histograms[TRACE_LAST];
+static gboolean trace_dirty = FALSE;
+
+gboolean Trace::m_enabled = FALSE;
+
+static guint
+trace_bucket (gint64 elapsed)
+{
+    if (elapsed <= 0)
+        return 0;
+
+    guint64 value = elapsed;
+    guint n = g_bit_storage (value) - 1;
+    guint sub = n >= 2 ? (value >> (n - 2)) & 3 : (value << (2 - n)) & 3;
+    guint bucket = 1 + TRACE_SUB_BUCKETS * n + sub;
+    return MIN (bucket, TRACE_BUCKETS - 1);
+}
+
+/* the lower bound of the bucket in microseconds. */
+static gint64
+trace_bucket_value (guint bucket)
+{
+    if (bucket == 0)
+        return 0;
+
+    guint n = (bucket - 1) / TRACE_SUB_BUCKETS;
+    guint sub = (bucket - 1) % TRACE_SUB_BUCKETS;
+    return ((gint64) (TRACE_SUB_BUCKETS + sub) << n) / TRACE_SUB_BUCKETS;
+}
+
+static gint64
+trace_percentile (const TraceHistogram & histogram, guint percent)
+{
+    guint64 rank = (histogram.count * percent + 99) / 100;
+    guint64 sum = 0;
+
+    for (guint i = 0; i < TRACE_BUCKETS; i++) {
+        sum += histogram.buckets[i];
+        if (sum >= rank && sum > 0)
+            return MIN (trace_bucket_value (i), histogram.max);
+    }
+    return histogram.max;
+}
+
+void
+Trace::enable (void)
+{
+    if (m_enabled)
+        return;
+
+    memset (trace_histograms, 0, sizeof (trace_histograms));
+    m_enabled = TRUE;
+    g_timeout_add_seconds (TRACE_REPORT_TIMEOUT, Trace::timeoutCallback, NULL);
+}
+
+void
+Trace::record (TraceStage stage, gint64 elapsed)
+{
+    TraceHistogram & histogram = trace_histograms[stage];
+    histogram.buckets[trace_bucket (elapsed)] ++;
+    histogram.count ++;
+    histogram.max = MAX (histogram.max, elapsed);
+    trace_dirty = TRUE;
+}
+
+void
+Trace::report (void)
+{
+    if (!m_enabled || !trace_dirty)
+        return;
+
+    gchar *dirname = g_build_filename (g_get_user_cache_dir (),
+                                       "ibus", "libpinyin", NULL);
+    g_mkdir_with_parents (dirname, 0700);
+    gchar *filename = g_build_filename (dirname, "trace.log", NULL);
+    g_free (dirname);
+
+    FILE *file = g_fopen (filename, "a");
+    g_free (filename);
+    if (file == NULL)
+        return;
+
+    GDateTime *now = g_date_time_new_now_local ();
+    gchar *time = g_date_time_format (now, "%F %T");
+    g_date_time_unref (now);
+
+    for (guint i = 0; i < TRACE_LAST; i++) {
+        const TraceHistogram & histogram = trace_histograms[i];
+        if (histogram.count == 0)
+            continue;
+
+        fprintf (file, "%s %s count=%" G_GUINT64_FORMAT
+                 " p50=%" G_GINT64_FORMAT "us p99=%" G_GINT64_FORMAT "us"
+                 " max=%" G_GINT64_FORMAT "us\n",
+                 time, trace_stage_names[i], histogram.count,
+                 trace_percentile (histogram, 50),
+                 trace_percentile (histogram, 99),
+                 histogram.max);
+    }
+
+    g_free (time);
+    fclose (file);
+    trace_dirty = FALSE;
+}
+
+gboolean
+Trace::timeoutCallback (gpointer data)
+{
+    report ();
+    return TRUE;
+}
+
+};
@@ -0,0 +1,86 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_TRACE_H_
+#define __PY_TRACE_H_
+
+#include <glib.h>
+
+namespace PY {
+
+/* the traced stages of a key event. */
+enum TraceStage {
+    TRACE_PROCESS_KEY_EVENT = 0,
+    TRACE_PROCESS_ACCEL_KEY_EVENT,
+    TRACE_PARSE_PINYIN,
+    TRACE_GUESS_SENTENCE,
+    TRACE_GUESS_CANDIDATES,
+    TRACE_LIBPINYIN_CANDIDATES,
+    TRACE_LUA_TRIGGER_CANDIDATES,
+    TRACE_LUA_CONVERTER_CANDIDATES,
+    TRACE_EMOJI_CANDIDATES,
+    TRACE_ENGLISH_CANDIDATES,
+    TRACE_TRADITIONAL_CANDIDATES,
+    TRACE_FILL_LOOKUP_TABLE,
+    TRACE_UPDATE_PREEDIT_TEXT,
+    TRACE_UPDATE_AUXILIARY_TEXT,
+    TRACE_UPDATE_LOOKUP_TABLE,
+    TRACE_LAST
+};
+
+/* Opt-in latency histograms of the stages,
+ * reported to a log file periodically. */
+class Trace {
+public:
+    static void enable (void);
+    static gboolean enabled (void) { return m_enabled; }
+
+    static void record (TraceStage stage, gint64 elapsed);
+
+    /* append the p50/p99 of the stages to the log file. */
+    static void report (void);
+
+private:
+    static gboolean timeoutCallback (gpointer data);
+
+    static gboolean m_enabled;
+};
+
+/* Record the elapsed time of the scope. */
+class TraceScope {
+public:
+    TraceScope (TraceStage stage)
+        : m_stage (stage),
+          m_start (G_UNLIKELY (Trace::enabled ()) ? g_get_monotonic_time () : 0) { }
+
+    ~TraceScope (void)
+    {
+        if (G_UNLIKELY (m_start))
+            Trace::record (m_stage, g_get_monotonic_time () - m_start);
+    }
+
+private:
+    TraceStage m_stage;
+    gint64 m_start;
+};
+
+};
+
+#endif
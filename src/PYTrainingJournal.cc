@@ -0,0 +1,145 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PYTrainingJournal.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <glib/gstdio.h>
+
+namespace PY {
+
+/* one record per line: "flags\tpinyin\tphrase\n". */
+
+TrainingJournal::TrainingJournal () : m_fd (-1)
+{
+}
+
+TrainingJournal::~TrainingJournal ()
+{
+    sync ();
+    if (m_fd >= 0)
+        close (m_fd);
+}
+
+gboolean
+TrainingJournal::open (const char *filename)
+{
+    if (m_fd >= 0)
+        return TRUE;
+
+    m_fd = g_open (filename, O_WRONLY | O_CREAT | O_APPEND, 0600);
+    if (m_fd < 0) {
+        g_warning ("can not open %s: %s", filename, g_strerror (errno));
+        return FALSE;
+    }
+
+    m_filename = filename;
+    return TRUE;
+}
+
+void
+TrainingJournal::append (guint flags, const char *pinyin, const char *phrase)
+{
+    gchar buf[16];
+    g_snprintf (buf, sizeof (buf), "%u\t", flags);
+    m_buffer += buf;
+    m_buffer += pinyin;
+    m_buffer += '\t';
+    m_buffer += phrase;
+    m_buffer += '\n';
+}
+
+gboolean
+TrainingJournal::sync (void)
+{
+    if (m_buffer.empty ())
+        return TRUE;
+    if (m_fd < 0)
+        return FALSE;
+
+    const gchar *data = m_buffer.c_str ();
+    gsize length = m_buffer.length ();
+    while (length > 0) {
+        gssize written = write (m_fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            g_warning ("can not write %s: %s", m_filename.c_str (),
+                       g_strerror (errno));
+            return FALSE;
+        }
+        data += written;
+        length -= written;
+    }
+    m_buffer.clear ();
+
+    return fdatasync (m_fd) == 0;
+}
+
+void
+TrainingJournal::truncate (void)
+{
+    /* the buffered records are saved with the context. */
+    m_buffer.clear ();
+    if (m_fd >= 0 && ftruncate (m_fd, 0) != 0)
+        g_warning ("can not truncate %s: %s", m_filename.c_str (),
+                   g_strerror (errno));
+}
+
+gboolean
+TrainingJournal::read (const char *filename, std::vector<Record> & records)
+{
+    gchar *contents = NULL;
+    gsize length = 0;
+    if (!g_file_get_contents (filename, &contents, &length, NULL))
+        return FALSE;
+
+    const gchar *p = contents;
+    const gchar *end = contents + length;
+    while (p < end) {
+        const gchar *eol = (const gchar *) memchr (p, '\n', end - p);
+        /* killed in the middle of the write. */
+        if (eol == NULL)
+            break;
+
+        std::string line (p, eol);
+        p = eol + 1;
+
+        size_t first = line.find ('\t');
+        size_t second = first == std::string::npos ?
+            std::string::npos : line.find ('\t', first + 1);
+        if (second == std::string::npos)
+            continue;
+
+        Record record;
+        record.flags = atoi (line.c_str ());
+        record.pinyin = line.substr (first + 1, second - first - 1);
+        record.phrase = line.substr (second + 1);
+        records.push_back (record);
+    }
+
+    g_free (contents);
+    return TRUE;
+}
+
+};
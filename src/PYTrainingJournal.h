@@ -0,0 +1,72 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * ibus-libpinyin - Intelligent Pinyin engine based on libpinyin for IBus
+ *
+ * Copyright (c) 2018 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PY_TRAINING_JOURNAL_H_
+#define __PY_TRAINING_JOURNAL_H_
+
+#include <glib.h>
+#include <string>
+#include <vector>
+
+namespace PY {
+
+/* Append-only journal of the trainings since the last save of a
+ * libpinyin context, the records are replayed after the crash. */
+class TrainingJournal {
+public:
+    enum {
+        RECORD_TRAIN    = 1 << 0,
+        RECORD_REMEMBER = 1 << 1,
+    };
+
+    struct Record {
+        guint flags;
+        std::string pinyin;
+        std::string phrase;
+    };
+
+    TrainingJournal ();
+    ~TrainingJournal ();
+
+    gboolean open (const char *filename);
+    gboolean isOpened (void) const { return m_fd >= 0; }
+
+    /* buffered until the next sync. */
+    void append (guint flags, const char *pinyin, const char *phrase);
+    gboolean hasPending (void) const { return !m_buffer.empty (); }
+
+    /* write the buffered records and fsync the journal. */
+    gboolean sync (void);
+
+    /* drop the records after the context is saved. */
+    void truncate (void);
+
+    /* read the records, the partial record at the end is skipped. */
+    static gboolean read (const char *filename, std::vector<Record> & records);
+
+private:
+    std::string m_filename;
+    gint m_fd;
+    std::string m_buffer;
+};
+
+};
+
+#endif
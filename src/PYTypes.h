@@ -28,6 +28,10 @@ namespace PY {
 #define MAX_UTF8_LEN 6
 #define MAX_PHRASE_LEN 16
 
+/* the system databases are read through a shared read-only mapping,
+   the pages are shared by the engine processes of all the users. */
+#define SYSTEM_DB_MMAP_SIZE (64 * 1024 * 1024)
+
 };
 
 #endif